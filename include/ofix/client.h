@@ -0,0 +1,92 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_CLIENT_H__
+#define __OFIX_CLIENT_H__
+
+#include <stdint.h>
+
+#include "err.h"
+#include "msg.h"
+#include "role.h"
+#include "session.h"
+#include "versionspec.h"
+
+struct _ofixEngine;
+
+/**
+ * @file client.h
+ *
+ * This file defines the functions used to work with a FIX client.
+ */
+
+/**
+ * The ofixClient structure is the representation of a FIX engine for the
+ * library.
+ */
+typedef struct _ofixClient	*ofixClient;
+
+extern ofixClient	ofix_client_create(ofixErr err,
+					   const char *cid,
+					   const char *sid,
+					   const char *store_path,
+					   ofixVersionSpec spec,
+					   ofixRecvCallback cb, void *ctx);
+
+extern void		ofix_client_set_credentials(ofixClient client, const char *user, const char *password);
+
+/**
+ * Replaces the client store with the journal in __dir__, creating it if
+ * needed, and continues from the last stored sequence numbers. A resumed
+ * client does not set ResetSeqNumFlag on logon.
+ *
+ * @param err pointer to error struct or NULL
+ * @param client client to open the store for
+ * @param dir journal directory
+ */
+extern void		ofix_client_open_store(ofixErr err, ofixClient client, const char *dir);
+
+/**
+ *
+ *
+ * @param err pointer to error struct or NULL
+ */
+extern void	ofix_client_destroy(ofixErr err, ofixClient client);
+
+/**
+ *
+ *
+ * @param err pointer to error struct or NULL
+ */
+extern void	ofix_client_connect(ofixErr err, ofixClient client, const char *host, int port, double timeout);
+
+extern void	ofix_client_logout(ofixErr err, ofixClient client, const char *txt);
+
+/**
+ *
+ *
+ * @param err pointer to error struct or NULL
+ */
+extern void	ofix_client_send(ofixErr err, ofixClient client, ofixMsg msg);
+
+/**
+ *
+ *
+ * @param err pointer to error struct or NULL
+ *
+ * @return Returns a sent message or NULL on error or not found.
+ */
+extern ofixMsg	ofix_client_get_msg(ofixErr err, ofixClient client, int64_t seq_num);
+
+extern int64_t	ofix_client_send_seqnum(ofixClient client);
+extern int64_t	ofix_client_recv_seqnum(ofixClient client);
+
+extern void	ofix_client_set_log(ofixClient client, ofixLogOn log_on, ofixLog log, void *ctx);
+extern void	ofix_client_set_heartbeat(ofixClient client, int interval);
+// see ofix_session_set_send_delay()
+extern void	ofix_client_set_send_delay(ofixClient client, int usec);
+// see ofix_session_set_validate()
+extern void	ofix_client_set_validate(ofixClient client, ofixValidate mode);
+// see ofix_session_set_busy_poll(), call before connecting
+extern void	ofix_client_set_busy_poll(ofixClient client, bool on, int cpu);
+
+#endif /* __OFIX_CLIENT_H__ */
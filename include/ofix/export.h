@@ -0,0 +1,186 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_EXPORT_H__
+#define __OFIX_EXPORT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "err.h"
+#include "msg.h"
+#include "store.h"
+
+#define OFIX_EXPORT_MAGIC	"ofixcol1"
+// rows buffered before a chunk is written, bounds the memory of a writer
+#define OFIX_EXPORT_CHUNK_ROWS	16384
+
+/**
+ * Column value types. The type of a column is picked from the __ofixTagType__
+ * of the tag in the FIX version of the export.
+ */
+typedef enum {
+    OFIX_COL_INT	= 'i',	// int64_t
+    OFIX_COL_FLOAT	= 'f',	// double
+    OFIX_COL_CHAR	= 'c',	// char, also used for Boolean
+    OFIX_COL_STR	= 's',	// dictionary encoded string
+} ofixColType;
+
+// An export file starts with the magic and then the FIX version and the
+// columns as int32 values in host byte order:
+//
+//   magic[8] major minor col_cnt (tag type)*col_cnt
+//
+// then chunks, each with a header of int32 rows, body size, and CRC32C of the
+// body. For each column the body has a null bitmap of (rows + 7) / 8 bytes
+// followed by the values. Integer and float columns have 8 bytes per row and
+// char columns 1. String columns have a dictionary, int32 entry count, int32
+// byte count, the int32 end offset of each entry, the entry bytes, and then
+// an int32 dictionary index per row. Dictionaries are per chunk.
+
+typedef struct _ExCol {
+    int			tag;
+    ofixColType		type;
+    uint8_t		*nulls;
+    char		*values;
+    // string columns only
+    int32_t		*slots;
+    int32_t		*ends;
+    char		*bytes;
+    int32_t		dict_cnt;
+    int32_t		byte_cnt;
+    int32_t		byte_cap;
+} *ExCol;
+
+typedef struct _Export {
+    FILE		*f;
+    int			major;
+    int			minor;
+    int			col_cnt;
+    ExCol		cols;
+    char		**types;
+    int			type_cnt;
+    int32_t		rows;
+    int32_t		slot_mask;
+    int64_t		total;
+    char		*out;
+    size_t		out_cap;
+} *Export;
+
+typedef struct _ExportReader {
+    FILE		*f;
+    int			major;
+    int			minor;
+    int			col_cnt;
+    int			*tags;
+    ofixColType		*ctypes;
+    char		*buf;
+    size_t		cap;
+    int32_t		rows;
+    // per column offsets into buf for the current chunk
+    const uint8_t	**nulls;
+    const char		**values;
+    const char		**ends;
+    const char		**bytes;
+} *ExportReader;
+
+/**
+ * Creates an export file at __path__ with a column for each of __tags__.
+ * Column types are taken from the tag specs of FIX __major__.__minor__. Only
+ * messages with a type in __types__ are exported, all messages if
+ * __type_cnt__ is 0.
+ *
+ * @param err pointer to error struct or NULL
+ * @param path file to write
+ * @param major FIX major version used to type the columns
+ * @param minor FIX minor version used to type the columns
+ * @param tags tags to export, one column each
+ * @param tag_cnt number of __tags__
+ * @param types message types to export
+ * @param type_cnt number of __types__
+ * @return the new export or NULL on error
+ */
+extern Export		ofix_export_create(ofixErr err,
+					   const char *path,
+					   int major,
+					   int minor,
+					   const int *tags,
+					   int tag_cnt,
+					   const char **types,
+					   int type_cnt);
+
+/**
+ * Adds a row for __msg__ if it is one of the exported types. Missing tags
+ * and values that do not parse as the column type are null.
+ *
+ * @param err pointer to error struct or NULL
+ * @param ex export to add to
+ * @param msg message to add
+ * @return true if a row was added
+ */
+extern bool		ofix_export_add(ofixErr err, Export ex, ofixMsg msg);
+
+/**
+ * Writes any buffered rows, closes the file, and frees the export.
+ *
+ * @param err pointer to error struct or NULL
+ * @param ex export to close
+ * @return the number of rows written
+ */
+extern int64_t		ofix_export_close(ofixErr err, Export ex);
+
+/**
+ * Adds the messages in a journal or file store to an export.
+ *
+ * @param err pointer to error struct or NULL
+ * @param ex export to add to
+ * @param store store to read
+ */
+extern void		ofix_export_store(ofixErr err, Export ex, Store store);
+
+/**
+ * Adds the messages in a store file to an export in a single pass with the
+ * file parsed in parallel by ofix_store_piterate(). Rows are added in file
+ * order.
+ *
+ * @param err pointer to error struct or NULL
+ * @param ex export to add to
+ * @param path store file to read
+ * @param threads parse workers, 0 for one per core
+ */
+extern void		ofix_export_store_file(ofixErr err, Export ex, const char *path, int threads);
+
+/**
+ * Opens an export file for reading. Call ofix_export_reader_next() to load
+ * the first chunk.
+ *
+ * @param err pointer to error struct or NULL
+ * @param path export file to read
+ * @return the reader or NULL on error
+ */
+extern ExportReader	ofix_export_reader_open(ofixErr err, const char *path);
+extern void		ofix_export_reader_destroy(ExportReader r);
+
+/**
+ * Loads the next chunk.
+ *
+ * @param err pointer to error struct or NULL
+ * @param r reader
+ * @return the number of rows in the chunk, 0 at the end of the file
+ */
+extern int		ofix_export_reader_next(ofixErr err, ExportReader r);
+
+extern int		ofix_export_reader_col_cnt(ExportReader r);
+extern int		ofix_export_reader_col_tag(ExportReader r, int col);
+extern ofixColType	ofix_export_reader_col_type(ExportReader r, int col);
+
+// Value getters for a row of the current chunk. The column must be of the
+// matching type. Null values are 0 or an empty string.
+extern bool		ofix_export_reader_is_null(ExportReader r, int col, int row);
+extern int64_t		ofix_export_reader_int(ExportReader r, int col, int row);
+extern double		ofix_export_reader_float(ExportReader r, int col, int row);
+extern char		ofix_export_reader_char(ExportReader r, int col, int row);
+// the string is not terminated and is valid until the next chunk is loaded
+extern const char*	ofix_export_reader_str(ExportReader r, int col, int row, int *lenp);
+
+#endif /* __OFIX_EXPORT_H__ */
@@ -0,0 +1,2128 @@
+
+// This file is auto-generated from ref/FIX40.xml and should not be modified.
+
+#ifndef __OFIX_FIX40MSGS_H__
+#define __OFIX_FIX40MSGS_H__
+
+#include <stdint.h>
+
+#include "ofix/err.h"
+#include "ofix/msg.h"
+#include "ofix/date.h"
+#include "ofix/typed.h"
+
+// Heartbeat [0]
+enum {
+    FIX40_Heartbeat_BeginString = 0,
+    FIX40_Heartbeat_BodyLength = 1,
+    FIX40_Heartbeat_MsgType = 2,
+    FIX40_Heartbeat_SenderCompID = 3,
+    FIX40_Heartbeat_TargetCompID = 4,
+    FIX40_Heartbeat_OnBehalfOfCompID = 5,
+    FIX40_Heartbeat_DeliverToCompID = 6,
+    FIX40_Heartbeat_SecureDataLen = 7,
+    FIX40_Heartbeat_SecureData = 8,
+    FIX40_Heartbeat_MsgSeqNum = 9,
+    FIX40_Heartbeat_SenderSubID = 10,
+    FIX40_Heartbeat_TargetSubID = 11,
+    FIX40_Heartbeat_OnBehalfOfSubID = 12,
+    FIX40_Heartbeat_DeliverToSubID = 13,
+    FIX40_Heartbeat_PossDupFlag = 14,
+    FIX40_Heartbeat_PossResend = 15,
+    FIX40_Heartbeat_SendingTime = 16,
+    FIX40_Heartbeat_OrigSendingTime = 17,
+    FIX40_Heartbeat_TestReqID = 18,
+    FIX40_Heartbeat_SignatureLength = 19,
+    FIX40_Heartbeat_Signature = 20,
+    FIX40_Heartbeat_CheckSum = 21,
+};
+
+typedef struct _fix40Heartbeat {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Heartbeat;
+
+extern void	fix40_decode_Heartbeat(ofixErr err, fix40Heartbeat m, const char *raw, int len);
+extern void	fix40_decode_Heartbeat_msg(ofixErr err, fix40Heartbeat m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Heartbeat(ofixErr err, fix40Heartbeat m);
+
+// TestRequest [1]
+enum {
+    FIX40_TestRequest_BeginString = 0,
+    FIX40_TestRequest_BodyLength = 1,
+    FIX40_TestRequest_MsgType = 2,
+    FIX40_TestRequest_SenderCompID = 3,
+    FIX40_TestRequest_TargetCompID = 4,
+    FIX40_TestRequest_OnBehalfOfCompID = 5,
+    FIX40_TestRequest_DeliverToCompID = 6,
+    FIX40_TestRequest_SecureDataLen = 7,
+    FIX40_TestRequest_SecureData = 8,
+    FIX40_TestRequest_MsgSeqNum = 9,
+    FIX40_TestRequest_SenderSubID = 10,
+    FIX40_TestRequest_TargetSubID = 11,
+    FIX40_TestRequest_OnBehalfOfSubID = 12,
+    FIX40_TestRequest_DeliverToSubID = 13,
+    FIX40_TestRequest_PossDupFlag = 14,
+    FIX40_TestRequest_PossResend = 15,
+    FIX40_TestRequest_SendingTime = 16,
+    FIX40_TestRequest_OrigSendingTime = 17,
+    FIX40_TestRequest_TestReqID = 18,
+    FIX40_TestRequest_SignatureLength = 19,
+    FIX40_TestRequest_Signature = 20,
+    FIX40_TestRequest_CheckSum = 21,
+};
+
+typedef struct _fix40TestRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40TestRequest;
+
+extern void	fix40_decode_TestRequest(ofixErr err, fix40TestRequest m, const char *raw, int len);
+extern void	fix40_decode_TestRequest_msg(ofixErr err, fix40TestRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_TestRequest(ofixErr err, fix40TestRequest m);
+
+// ResendRequest [2]
+enum {
+    FIX40_ResendRequest_BeginString = 0,
+    FIX40_ResendRequest_BodyLength = 1,
+    FIX40_ResendRequest_MsgType = 2,
+    FIX40_ResendRequest_SenderCompID = 3,
+    FIX40_ResendRequest_TargetCompID = 4,
+    FIX40_ResendRequest_OnBehalfOfCompID = 5,
+    FIX40_ResendRequest_DeliverToCompID = 6,
+    FIX40_ResendRequest_SecureDataLen = 7,
+    FIX40_ResendRequest_SecureData = 8,
+    FIX40_ResendRequest_MsgSeqNum = 9,
+    FIX40_ResendRequest_SenderSubID = 10,
+    FIX40_ResendRequest_TargetSubID = 11,
+    FIX40_ResendRequest_OnBehalfOfSubID = 12,
+    FIX40_ResendRequest_DeliverToSubID = 13,
+    FIX40_ResendRequest_PossDupFlag = 14,
+    FIX40_ResendRequest_PossResend = 15,
+    FIX40_ResendRequest_SendingTime = 16,
+    FIX40_ResendRequest_OrigSendingTime = 17,
+    FIX40_ResendRequest_BeginSeqNo = 18,
+    FIX40_ResendRequest_EndSeqNo = 19,
+    FIX40_ResendRequest_SignatureLength = 20,
+    FIX40_ResendRequest_Signature = 21,
+    FIX40_ResendRequest_CheckSum = 22,
+};
+
+typedef struct _fix40ResendRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	BeginSeqNo;
+    int64_t	EndSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40ResendRequest;
+
+extern void	fix40_decode_ResendRequest(ofixErr err, fix40ResendRequest m, const char *raw, int len);
+extern void	fix40_decode_ResendRequest_msg(ofixErr err, fix40ResendRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_ResendRequest(ofixErr err, fix40ResendRequest m);
+
+// Reject [3]
+enum {
+    FIX40_Reject_BeginString = 0,
+    FIX40_Reject_BodyLength = 1,
+    FIX40_Reject_MsgType = 2,
+    FIX40_Reject_SenderCompID = 3,
+    FIX40_Reject_TargetCompID = 4,
+    FIX40_Reject_OnBehalfOfCompID = 5,
+    FIX40_Reject_DeliverToCompID = 6,
+    FIX40_Reject_SecureDataLen = 7,
+    FIX40_Reject_SecureData = 8,
+    FIX40_Reject_MsgSeqNum = 9,
+    FIX40_Reject_SenderSubID = 10,
+    FIX40_Reject_TargetSubID = 11,
+    FIX40_Reject_OnBehalfOfSubID = 12,
+    FIX40_Reject_DeliverToSubID = 13,
+    FIX40_Reject_PossDupFlag = 14,
+    FIX40_Reject_PossResend = 15,
+    FIX40_Reject_SendingTime = 16,
+    FIX40_Reject_OrigSendingTime = 17,
+    FIX40_Reject_RefSeqNum = 18,
+    FIX40_Reject_Text = 19,
+    FIX40_Reject_SignatureLength = 20,
+    FIX40_Reject_Signature = 21,
+    FIX40_Reject_CheckSum = 22,
+};
+
+typedef struct _fix40Reject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	RefSeqNum;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Reject;
+
+extern void	fix40_decode_Reject(ofixErr err, fix40Reject m, const char *raw, int len);
+extern void	fix40_decode_Reject_msg(ofixErr err, fix40Reject m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Reject(ofixErr err, fix40Reject m);
+
+// SequenceReset [4]
+enum {
+    FIX40_SequenceReset_BeginString = 0,
+    FIX40_SequenceReset_BodyLength = 1,
+    FIX40_SequenceReset_MsgType = 2,
+    FIX40_SequenceReset_SenderCompID = 3,
+    FIX40_SequenceReset_TargetCompID = 4,
+    FIX40_SequenceReset_OnBehalfOfCompID = 5,
+    FIX40_SequenceReset_DeliverToCompID = 6,
+    FIX40_SequenceReset_SecureDataLen = 7,
+    FIX40_SequenceReset_SecureData = 8,
+    FIX40_SequenceReset_MsgSeqNum = 9,
+    FIX40_SequenceReset_SenderSubID = 10,
+    FIX40_SequenceReset_TargetSubID = 11,
+    FIX40_SequenceReset_OnBehalfOfSubID = 12,
+    FIX40_SequenceReset_DeliverToSubID = 13,
+    FIX40_SequenceReset_PossDupFlag = 14,
+    FIX40_SequenceReset_PossResend = 15,
+    FIX40_SequenceReset_SendingTime = 16,
+    FIX40_SequenceReset_OrigSendingTime = 17,
+    FIX40_SequenceReset_GapFillFlag = 18,
+    FIX40_SequenceReset_NewSeqNo = 19,
+    FIX40_SequenceReset_SignatureLength = 20,
+    FIX40_SequenceReset_Signature = 21,
+    FIX40_SequenceReset_CheckSum = 22,
+};
+
+typedef struct _fix40SequenceReset {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	GapFillFlag;
+    int64_t	NewSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40SequenceReset;
+
+extern void	fix40_decode_SequenceReset(ofixErr err, fix40SequenceReset m, const char *raw, int len);
+extern void	fix40_decode_SequenceReset_msg(ofixErr err, fix40SequenceReset m, ofixMsg msg);
+extern ofixMsg	fix40_encode_SequenceReset(ofixErr err, fix40SequenceReset m);
+
+// Logout [5]
+enum {
+    FIX40_Logout_BeginString = 0,
+    FIX40_Logout_BodyLength = 1,
+    FIX40_Logout_MsgType = 2,
+    FIX40_Logout_SenderCompID = 3,
+    FIX40_Logout_TargetCompID = 4,
+    FIX40_Logout_OnBehalfOfCompID = 5,
+    FIX40_Logout_DeliverToCompID = 6,
+    FIX40_Logout_SecureDataLen = 7,
+    FIX40_Logout_SecureData = 8,
+    FIX40_Logout_MsgSeqNum = 9,
+    FIX40_Logout_SenderSubID = 10,
+    FIX40_Logout_TargetSubID = 11,
+    FIX40_Logout_OnBehalfOfSubID = 12,
+    FIX40_Logout_DeliverToSubID = 13,
+    FIX40_Logout_PossDupFlag = 14,
+    FIX40_Logout_PossResend = 15,
+    FIX40_Logout_SendingTime = 16,
+    FIX40_Logout_OrigSendingTime = 17,
+    FIX40_Logout_Text = 18,
+    FIX40_Logout_SignatureLength = 19,
+    FIX40_Logout_Signature = 20,
+    FIX40_Logout_CheckSum = 21,
+};
+
+typedef struct _fix40Logout {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Logout;
+
+extern void	fix40_decode_Logout(ofixErr err, fix40Logout m, const char *raw, int len);
+extern void	fix40_decode_Logout_msg(ofixErr err, fix40Logout m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Logout(ofixErr err, fix40Logout m);
+
+// IndicationofInterest [6]
+enum {
+    FIX40_IndicationofInterest_BeginString = 0,
+    FIX40_IndicationofInterest_BodyLength = 1,
+    FIX40_IndicationofInterest_MsgType = 2,
+    FIX40_IndicationofInterest_SenderCompID = 3,
+    FIX40_IndicationofInterest_TargetCompID = 4,
+    FIX40_IndicationofInterest_OnBehalfOfCompID = 5,
+    FIX40_IndicationofInterest_DeliverToCompID = 6,
+    FIX40_IndicationofInterest_SecureDataLen = 7,
+    FIX40_IndicationofInterest_SecureData = 8,
+    FIX40_IndicationofInterest_MsgSeqNum = 9,
+    FIX40_IndicationofInterest_SenderSubID = 10,
+    FIX40_IndicationofInterest_TargetSubID = 11,
+    FIX40_IndicationofInterest_OnBehalfOfSubID = 12,
+    FIX40_IndicationofInterest_DeliverToSubID = 13,
+    FIX40_IndicationofInterest_PossDupFlag = 14,
+    FIX40_IndicationofInterest_PossResend = 15,
+    FIX40_IndicationofInterest_SendingTime = 16,
+    FIX40_IndicationofInterest_OrigSendingTime = 17,
+    FIX40_IndicationofInterest_IOIid = 18,
+    FIX40_IndicationofInterest_IOITransType = 19,
+    FIX40_IndicationofInterest_IOIRefID = 20,
+    FIX40_IndicationofInterest_Symbol = 21,
+    FIX40_IndicationofInterest_SymbolSfx = 22,
+    FIX40_IndicationofInterest_SecurityID = 23,
+    FIX40_IndicationofInterest_IDSource = 24,
+    FIX40_IndicationofInterest_Issuer = 25,
+    FIX40_IndicationofInterest_SecurityDesc = 26,
+    FIX40_IndicationofInterest_Side = 27,
+    FIX40_IndicationofInterest_IOIShares = 28,
+    FIX40_IndicationofInterest_Price = 29,
+    FIX40_IndicationofInterest_Currency = 30,
+    FIX40_IndicationofInterest_ValidUntilTime = 31,
+    FIX40_IndicationofInterest_IOIQltyInd = 32,
+    FIX40_IndicationofInterest_IOIOthSvc = 33,
+    FIX40_IndicationofInterest_IOINaturalFlag = 34,
+    FIX40_IndicationofInterest_IOIQualifier = 35,
+    FIX40_IndicationofInterest_Text = 36,
+    FIX40_IndicationofInterest_SignatureLength = 37,
+    FIX40_IndicationofInterest_Signature = 38,
+    FIX40_IndicationofInterest_CheckSum = 39,
+};
+
+typedef struct _fix40IndicationofInterest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	IOIid;
+    struct _ofixStrView	IOITransType;
+    int64_t	IOIRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	IOIShares;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixStrView	IOIQltyInd;
+    struct _ofixStrView	IOIOthSvc;
+    struct _ofixStrView	IOINaturalFlag;
+    struct _ofixStrView	IOIQualifier;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40IndicationofInterest;
+
+extern void	fix40_decode_IndicationofInterest(ofixErr err, fix40IndicationofInterest m, const char *raw, int len);
+extern void	fix40_decode_IndicationofInterest_msg(ofixErr err, fix40IndicationofInterest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_IndicationofInterest(ofixErr err, fix40IndicationofInterest m);
+
+// Advertisement [7]
+enum {
+    FIX40_Advertisement_BeginString = 0,
+    FIX40_Advertisement_BodyLength = 1,
+    FIX40_Advertisement_MsgType = 2,
+    FIX40_Advertisement_SenderCompID = 3,
+    FIX40_Advertisement_TargetCompID = 4,
+    FIX40_Advertisement_OnBehalfOfCompID = 5,
+    FIX40_Advertisement_DeliverToCompID = 6,
+    FIX40_Advertisement_SecureDataLen = 7,
+    FIX40_Advertisement_SecureData = 8,
+    FIX40_Advertisement_MsgSeqNum = 9,
+    FIX40_Advertisement_SenderSubID = 10,
+    FIX40_Advertisement_TargetSubID = 11,
+    FIX40_Advertisement_OnBehalfOfSubID = 12,
+    FIX40_Advertisement_DeliverToSubID = 13,
+    FIX40_Advertisement_PossDupFlag = 14,
+    FIX40_Advertisement_PossResend = 15,
+    FIX40_Advertisement_SendingTime = 16,
+    FIX40_Advertisement_OrigSendingTime = 17,
+    FIX40_Advertisement_AdvId = 18,
+    FIX40_Advertisement_AdvTransType = 19,
+    FIX40_Advertisement_AdvRefID = 20,
+    FIX40_Advertisement_Symbol = 21,
+    FIX40_Advertisement_SymbolSfx = 22,
+    FIX40_Advertisement_SecurityID = 23,
+    FIX40_Advertisement_IDSource = 24,
+    FIX40_Advertisement_Issuer = 25,
+    FIX40_Advertisement_SecurityDesc = 26,
+    FIX40_Advertisement_AdvSide = 27,
+    FIX40_Advertisement_Shares = 28,
+    FIX40_Advertisement_Price = 29,
+    FIX40_Advertisement_Currency = 30,
+    FIX40_Advertisement_TransactTime = 31,
+    FIX40_Advertisement_Text = 32,
+    FIX40_Advertisement_SignatureLength = 33,
+    FIX40_Advertisement_Signature = 34,
+    FIX40_Advertisement_CheckSum = 35,
+};
+
+typedef struct _fix40Advertisement {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	AdvId;
+    struct _ofixStrView	AdvTransType;
+    int64_t	AdvRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	AdvSide;
+    int64_t	Shares;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Advertisement;
+
+extern void	fix40_decode_Advertisement(ofixErr err, fix40Advertisement m, const char *raw, int len);
+extern void	fix40_decode_Advertisement_msg(ofixErr err, fix40Advertisement m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Advertisement(ofixErr err, fix40Advertisement m);
+
+// ExecutionReport [8]
+enum {
+    FIX40_ExecutionReport_BeginString = 0,
+    FIX40_ExecutionReport_BodyLength = 1,
+    FIX40_ExecutionReport_MsgType = 2,
+    FIX40_ExecutionReport_SenderCompID = 3,
+    FIX40_ExecutionReport_TargetCompID = 4,
+    FIX40_ExecutionReport_OnBehalfOfCompID = 5,
+    FIX40_ExecutionReport_DeliverToCompID = 6,
+    FIX40_ExecutionReport_SecureDataLen = 7,
+    FIX40_ExecutionReport_SecureData = 8,
+    FIX40_ExecutionReport_MsgSeqNum = 9,
+    FIX40_ExecutionReport_SenderSubID = 10,
+    FIX40_ExecutionReport_TargetSubID = 11,
+    FIX40_ExecutionReport_OnBehalfOfSubID = 12,
+    FIX40_ExecutionReport_DeliverToSubID = 13,
+    FIX40_ExecutionReport_PossDupFlag = 14,
+    FIX40_ExecutionReport_PossResend = 15,
+    FIX40_ExecutionReport_SendingTime = 16,
+    FIX40_ExecutionReport_OrigSendingTime = 17,
+    FIX40_ExecutionReport_OrderID = 18,
+    FIX40_ExecutionReport_ClOrdID = 19,
+    FIX40_ExecutionReport_ClientID = 20,
+    FIX40_ExecutionReport_ExecBroker = 21,
+    FIX40_ExecutionReport_ListID = 22,
+    FIX40_ExecutionReport_ExecID = 23,
+    FIX40_ExecutionReport_ExecTransType = 24,
+    FIX40_ExecutionReport_ExecRefID = 25,
+    FIX40_ExecutionReport_OrdStatus = 26,
+    FIX40_ExecutionReport_OrdRejReason = 27,
+    FIX40_ExecutionReport_Account = 28,
+    FIX40_ExecutionReport_SettlmntTyp = 29,
+    FIX40_ExecutionReport_FutSettDate = 30,
+    FIX40_ExecutionReport_Symbol = 31,
+    FIX40_ExecutionReport_SymbolSfx = 32,
+    FIX40_ExecutionReport_SecurityID = 33,
+    FIX40_ExecutionReport_IDSource = 34,
+    FIX40_ExecutionReport_Issuer = 35,
+    FIX40_ExecutionReport_SecurityDesc = 36,
+    FIX40_ExecutionReport_Side = 37,
+    FIX40_ExecutionReport_OrderQty = 38,
+    FIX40_ExecutionReport_OrdType = 39,
+    FIX40_ExecutionReport_Price = 40,
+    FIX40_ExecutionReport_StopPx = 41,
+    FIX40_ExecutionReport_Currency = 42,
+    FIX40_ExecutionReport_TimeInForce = 43,
+    FIX40_ExecutionReport_ExpireTime = 44,
+    FIX40_ExecutionReport_ExecInst = 45,
+    FIX40_ExecutionReport_Rule80A = 46,
+    FIX40_ExecutionReport_LastShares = 47,
+    FIX40_ExecutionReport_LastPx = 48,
+    FIX40_ExecutionReport_LastMkt = 49,
+    FIX40_ExecutionReport_LastCapacity = 50,
+    FIX40_ExecutionReport_CumQty = 51,
+    FIX40_ExecutionReport_AvgPx = 52,
+    FIX40_ExecutionReport_TradeDate = 53,
+    FIX40_ExecutionReport_TransactTime = 54,
+    FIX40_ExecutionReport_ReportToExch = 55,
+    FIX40_ExecutionReport_Commission = 56,
+    FIX40_ExecutionReport_CommType = 57,
+    FIX40_ExecutionReport_NoMiscFees = 58,
+    FIX40_ExecutionReport_NetMoney = 59,
+    FIX40_ExecutionReport_SettlCurrAmt = 60,
+    FIX40_ExecutionReport_SettlCurrency = 61,
+    FIX40_ExecutionReport_Text = 62,
+    FIX40_ExecutionReport_SignatureLength = 63,
+    FIX40_ExecutionReport_Signature = 64,
+    FIX40_ExecutionReport_CheckSum = 65,
+};
+
+typedef struct _fix40ExecutionReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	ListID;
+    int64_t	ExecID;
+    struct _ofixStrView	ExecTransType;
+    int64_t	ExecRefID;
+    struct _ofixStrView	OrdStatus;
+    int64_t	OrdRejReason;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixStrView	ExecInst;
+    struct _ofixStrView	Rule80A;
+    int64_t	LastShares;
+    struct _ofixDecimal	LastPx;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	LastCapacity;
+    int64_t	CumQty;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDate	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	ReportToExch;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    int64_t	NoMiscFees;
+    struct _ofixDecimal	NetMoney;
+    struct _ofixDecimal	SettlCurrAmt;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40ExecutionReport;
+
+extern void	fix40_decode_ExecutionReport(ofixErr err, fix40ExecutionReport m, const char *raw, int len);
+extern void	fix40_decode_ExecutionReport_msg(ofixErr err, fix40ExecutionReport m, ofixMsg msg);
+extern ofixMsg	fix40_encode_ExecutionReport(ofixErr err, fix40ExecutionReport m);
+
+// OrderCancelReject [9]
+enum {
+    FIX40_OrderCancelReject_BeginString = 0,
+    FIX40_OrderCancelReject_BodyLength = 1,
+    FIX40_OrderCancelReject_MsgType = 2,
+    FIX40_OrderCancelReject_SenderCompID = 3,
+    FIX40_OrderCancelReject_TargetCompID = 4,
+    FIX40_OrderCancelReject_OnBehalfOfCompID = 5,
+    FIX40_OrderCancelReject_DeliverToCompID = 6,
+    FIX40_OrderCancelReject_SecureDataLen = 7,
+    FIX40_OrderCancelReject_SecureData = 8,
+    FIX40_OrderCancelReject_MsgSeqNum = 9,
+    FIX40_OrderCancelReject_SenderSubID = 10,
+    FIX40_OrderCancelReject_TargetSubID = 11,
+    FIX40_OrderCancelReject_OnBehalfOfSubID = 12,
+    FIX40_OrderCancelReject_DeliverToSubID = 13,
+    FIX40_OrderCancelReject_PossDupFlag = 14,
+    FIX40_OrderCancelReject_PossResend = 15,
+    FIX40_OrderCancelReject_SendingTime = 16,
+    FIX40_OrderCancelReject_OrigSendingTime = 17,
+    FIX40_OrderCancelReject_OrderID = 18,
+    FIX40_OrderCancelReject_ClOrdID = 19,
+    FIX40_OrderCancelReject_ClientID = 20,
+    FIX40_OrderCancelReject_ExecBroker = 21,
+    FIX40_OrderCancelReject_ListID = 22,
+    FIX40_OrderCancelReject_CxlRejReason = 23,
+    FIX40_OrderCancelReject_Text = 24,
+    FIX40_OrderCancelReject_SignatureLength = 25,
+    FIX40_OrderCancelReject_Signature = 26,
+    FIX40_OrderCancelReject_CheckSum = 27,
+};
+
+typedef struct _fix40OrderCancelReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	ListID;
+    int64_t	CxlRejReason;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40OrderCancelReject;
+
+extern void	fix40_decode_OrderCancelReject(ofixErr err, fix40OrderCancelReject m, const char *raw, int len);
+extern void	fix40_decode_OrderCancelReject_msg(ofixErr err, fix40OrderCancelReject m, ofixMsg msg);
+extern ofixMsg	fix40_encode_OrderCancelReject(ofixErr err, fix40OrderCancelReject m);
+
+// Logon [A]
+enum {
+    FIX40_Logon_BeginString = 0,
+    FIX40_Logon_BodyLength = 1,
+    FIX40_Logon_MsgType = 2,
+    FIX40_Logon_SenderCompID = 3,
+    FIX40_Logon_TargetCompID = 4,
+    FIX40_Logon_OnBehalfOfCompID = 5,
+    FIX40_Logon_DeliverToCompID = 6,
+    FIX40_Logon_SecureDataLen = 7,
+    FIX40_Logon_SecureData = 8,
+    FIX40_Logon_MsgSeqNum = 9,
+    FIX40_Logon_SenderSubID = 10,
+    FIX40_Logon_TargetSubID = 11,
+    FIX40_Logon_OnBehalfOfSubID = 12,
+    FIX40_Logon_DeliverToSubID = 13,
+    FIX40_Logon_PossDupFlag = 14,
+    FIX40_Logon_PossResend = 15,
+    FIX40_Logon_SendingTime = 16,
+    FIX40_Logon_OrigSendingTime = 17,
+    FIX40_Logon_EncryptMethod = 18,
+    FIX40_Logon_HeartBtInt = 19,
+    FIX40_Logon_RawDataLength = 20,
+    FIX40_Logon_RawData = 21,
+    FIX40_Logon_SignatureLength = 22,
+    FIX40_Logon_Signature = 23,
+    FIX40_Logon_CheckSum = 24,
+};
+
+typedef struct _fix40Logon {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	EncryptMethod;
+    int64_t	HeartBtInt;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Logon;
+
+extern void	fix40_decode_Logon(ofixErr err, fix40Logon m, const char *raw, int len);
+extern void	fix40_decode_Logon_msg(ofixErr err, fix40Logon m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Logon(ofixErr err, fix40Logon m);
+
+// News [B]
+enum {
+    FIX40_News_BeginString = 0,
+    FIX40_News_BodyLength = 1,
+    FIX40_News_MsgType = 2,
+    FIX40_News_SenderCompID = 3,
+    FIX40_News_TargetCompID = 4,
+    FIX40_News_OnBehalfOfCompID = 5,
+    FIX40_News_DeliverToCompID = 6,
+    FIX40_News_SecureDataLen = 7,
+    FIX40_News_SecureData = 8,
+    FIX40_News_MsgSeqNum = 9,
+    FIX40_News_SenderSubID = 10,
+    FIX40_News_TargetSubID = 11,
+    FIX40_News_OnBehalfOfSubID = 12,
+    FIX40_News_DeliverToSubID = 13,
+    FIX40_News_PossDupFlag = 14,
+    FIX40_News_PossResend = 15,
+    FIX40_News_SendingTime = 16,
+    FIX40_News_OrigSendingTime = 17,
+    FIX40_News_OrigTime = 18,
+    FIX40_News_Urgency = 19,
+    FIX40_News_RelatdSym = 20,
+    FIX40_News_LinesOfText = 21,
+    FIX40_News_RawDataLength = 22,
+    FIX40_News_RawData = 23,
+    FIX40_News_SignatureLength = 24,
+    FIX40_News_Signature = 25,
+    FIX40_News_CheckSum = 26,
+};
+
+typedef struct _fix40News {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixDate	OrigTime;
+    struct _ofixStrView	Urgency;
+    struct _ofixStrView	RelatdSym;
+    int64_t	LinesOfText;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40News;
+
+extern void	fix40_decode_News(ofixErr err, fix40News m, const char *raw, int len);
+extern void	fix40_decode_News_msg(ofixErr err, fix40News m, ofixMsg msg);
+extern ofixMsg	fix40_encode_News(ofixErr err, fix40News m);
+
+// Email [C]
+enum {
+    FIX40_Email_BeginString = 0,
+    FIX40_Email_BodyLength = 1,
+    FIX40_Email_MsgType = 2,
+    FIX40_Email_SenderCompID = 3,
+    FIX40_Email_TargetCompID = 4,
+    FIX40_Email_OnBehalfOfCompID = 5,
+    FIX40_Email_DeliverToCompID = 6,
+    FIX40_Email_SecureDataLen = 7,
+    FIX40_Email_SecureData = 8,
+    FIX40_Email_MsgSeqNum = 9,
+    FIX40_Email_SenderSubID = 10,
+    FIX40_Email_TargetSubID = 11,
+    FIX40_Email_OnBehalfOfSubID = 12,
+    FIX40_Email_DeliverToSubID = 13,
+    FIX40_Email_PossDupFlag = 14,
+    FIX40_Email_PossResend = 15,
+    FIX40_Email_SendingTime = 16,
+    FIX40_Email_OrigSendingTime = 17,
+    FIX40_Email_EmailType = 18,
+    FIX40_Email_OrigTime = 19,
+    FIX40_Email_RelatdSym = 20,
+    FIX40_Email_OrderID = 21,
+    FIX40_Email_ClOrdID = 22,
+    FIX40_Email_LinesOfText = 23,
+    FIX40_Email_RawDataLength = 24,
+    FIX40_Email_RawData = 25,
+    FIX40_Email_SignatureLength = 26,
+    FIX40_Email_Signature = 27,
+    FIX40_Email_CheckSum = 28,
+};
+
+typedef struct _fix40Email {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	EmailType;
+    struct _ofixDate	OrigTime;
+    struct _ofixStrView	RelatdSym;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	LinesOfText;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Email;
+
+extern void	fix40_decode_Email(ofixErr err, fix40Email m, const char *raw, int len);
+extern void	fix40_decode_Email_msg(ofixErr err, fix40Email m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Email(ofixErr err, fix40Email m);
+
+// NewOrderSingle [D]
+enum {
+    FIX40_NewOrderSingle_BeginString = 0,
+    FIX40_NewOrderSingle_BodyLength = 1,
+    FIX40_NewOrderSingle_MsgType = 2,
+    FIX40_NewOrderSingle_SenderCompID = 3,
+    FIX40_NewOrderSingle_TargetCompID = 4,
+    FIX40_NewOrderSingle_OnBehalfOfCompID = 5,
+    FIX40_NewOrderSingle_DeliverToCompID = 6,
+    FIX40_NewOrderSingle_SecureDataLen = 7,
+    FIX40_NewOrderSingle_SecureData = 8,
+    FIX40_NewOrderSingle_MsgSeqNum = 9,
+    FIX40_NewOrderSingle_SenderSubID = 10,
+    FIX40_NewOrderSingle_TargetSubID = 11,
+    FIX40_NewOrderSingle_OnBehalfOfSubID = 12,
+    FIX40_NewOrderSingle_DeliverToSubID = 13,
+    FIX40_NewOrderSingle_PossDupFlag = 14,
+    FIX40_NewOrderSingle_PossResend = 15,
+    FIX40_NewOrderSingle_SendingTime = 16,
+    FIX40_NewOrderSingle_OrigSendingTime = 17,
+    FIX40_NewOrderSingle_ClOrdID = 18,
+    FIX40_NewOrderSingle_ClientID = 19,
+    FIX40_NewOrderSingle_ExecBroker = 20,
+    FIX40_NewOrderSingle_Account = 21,
+    FIX40_NewOrderSingle_SettlmntTyp = 22,
+    FIX40_NewOrderSingle_FutSettDate = 23,
+    FIX40_NewOrderSingle_HandlInst = 24,
+    FIX40_NewOrderSingle_ExecInst = 25,
+    FIX40_NewOrderSingle_MinQty = 26,
+    FIX40_NewOrderSingle_MaxFloor = 27,
+    FIX40_NewOrderSingle_ExDestination = 28,
+    FIX40_NewOrderSingle_ProcessCode = 29,
+    FIX40_NewOrderSingle_Symbol = 30,
+    FIX40_NewOrderSingle_SymbolSfx = 31,
+    FIX40_NewOrderSingle_SecurityID = 32,
+    FIX40_NewOrderSingle_IDSource = 33,
+    FIX40_NewOrderSingle_Issuer = 34,
+    FIX40_NewOrderSingle_SecurityDesc = 35,
+    FIX40_NewOrderSingle_PrevClosePx = 36,
+    FIX40_NewOrderSingle_Side = 37,
+    FIX40_NewOrderSingle_LocateReqd = 38,
+    FIX40_NewOrderSingle_OrderQty = 39,
+    FIX40_NewOrderSingle_OrdType = 40,
+    FIX40_NewOrderSingle_Price = 41,
+    FIX40_NewOrderSingle_StopPx = 42,
+    FIX40_NewOrderSingle_Currency = 43,
+    FIX40_NewOrderSingle_IOIid = 44,
+    FIX40_NewOrderSingle_QuoteID = 45,
+    FIX40_NewOrderSingle_TimeInForce = 46,
+    FIX40_NewOrderSingle_ExpireTime = 47,
+    FIX40_NewOrderSingle_Commission = 48,
+    FIX40_NewOrderSingle_CommType = 49,
+    FIX40_NewOrderSingle_Rule80A = 50,
+    FIX40_NewOrderSingle_ForexReq = 51,
+    FIX40_NewOrderSingle_SettlCurrency = 52,
+    FIX40_NewOrderSingle_Text = 53,
+    FIX40_NewOrderSingle_SignatureLength = 54,
+    FIX40_NewOrderSingle_Signature = 55,
+    FIX40_NewOrderSingle_CheckSum = 56,
+};
+
+typedef struct _fix40NewOrderSingle {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	HandlInst;
+    struct _ofixStrView	ExecInst;
+    int64_t	MinQty;
+    int64_t	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	ProcessCode;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	LocateReqd;
+    int64_t	OrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    int64_t	IOIid;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    struct _ofixStrView	Rule80A;
+    struct _ofixStrView	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40NewOrderSingle;
+
+extern void	fix40_decode_NewOrderSingle(ofixErr err, fix40NewOrderSingle m, const char *raw, int len);
+extern void	fix40_decode_NewOrderSingle_msg(ofixErr err, fix40NewOrderSingle m, ofixMsg msg);
+extern ofixMsg	fix40_encode_NewOrderSingle(ofixErr err, fix40NewOrderSingle m);
+
+// NewOrderList [E]
+enum {
+    FIX40_NewOrderList_BeginString = 0,
+    FIX40_NewOrderList_BodyLength = 1,
+    FIX40_NewOrderList_MsgType = 2,
+    FIX40_NewOrderList_SenderCompID = 3,
+    FIX40_NewOrderList_TargetCompID = 4,
+    FIX40_NewOrderList_OnBehalfOfCompID = 5,
+    FIX40_NewOrderList_DeliverToCompID = 6,
+    FIX40_NewOrderList_SecureDataLen = 7,
+    FIX40_NewOrderList_SecureData = 8,
+    FIX40_NewOrderList_MsgSeqNum = 9,
+    FIX40_NewOrderList_SenderSubID = 10,
+    FIX40_NewOrderList_TargetSubID = 11,
+    FIX40_NewOrderList_OnBehalfOfSubID = 12,
+    FIX40_NewOrderList_DeliverToSubID = 13,
+    FIX40_NewOrderList_PossDupFlag = 14,
+    FIX40_NewOrderList_PossResend = 15,
+    FIX40_NewOrderList_SendingTime = 16,
+    FIX40_NewOrderList_OrigSendingTime = 17,
+    FIX40_NewOrderList_ListID = 18,
+    FIX40_NewOrderList_WaveNo = 19,
+    FIX40_NewOrderList_ListSeqNo = 20,
+    FIX40_NewOrderList_ListNoOrds = 21,
+    FIX40_NewOrderList_ListExecInst = 22,
+    FIX40_NewOrderList_ClOrdID = 23,
+    FIX40_NewOrderList_ClientID = 24,
+    FIX40_NewOrderList_ExecBroker = 25,
+    FIX40_NewOrderList_Account = 26,
+    FIX40_NewOrderList_SettlmntTyp = 27,
+    FIX40_NewOrderList_FutSettDate = 28,
+    FIX40_NewOrderList_HandlInst = 29,
+    FIX40_NewOrderList_ExecInst = 30,
+    FIX40_NewOrderList_MinQty = 31,
+    FIX40_NewOrderList_MaxFloor = 32,
+    FIX40_NewOrderList_ExDestination = 33,
+    FIX40_NewOrderList_ProcessCode = 34,
+    FIX40_NewOrderList_Symbol = 35,
+    FIX40_NewOrderList_SymbolSfx = 36,
+    FIX40_NewOrderList_SecurityID = 37,
+    FIX40_NewOrderList_IDSource = 38,
+    FIX40_NewOrderList_Issuer = 39,
+    FIX40_NewOrderList_SecurityDesc = 40,
+    FIX40_NewOrderList_PrevClosePx = 41,
+    FIX40_NewOrderList_Side = 42,
+    FIX40_NewOrderList_LocateReqd = 43,
+    FIX40_NewOrderList_OrderQty = 44,
+    FIX40_NewOrderList_OrdType = 45,
+    FIX40_NewOrderList_Price = 46,
+    FIX40_NewOrderList_StopPx = 47,
+    FIX40_NewOrderList_Currency = 48,
+    FIX40_NewOrderList_TimeInForce = 49,
+    FIX40_NewOrderList_ExpireTime = 50,
+    FIX40_NewOrderList_Commission = 51,
+    FIX40_NewOrderList_CommType = 52,
+    FIX40_NewOrderList_Rule80A = 53,
+    FIX40_NewOrderList_ForexReq = 54,
+    FIX40_NewOrderList_SettlCurrency = 55,
+    FIX40_NewOrderList_Text = 56,
+    FIX40_NewOrderList_SignatureLength = 57,
+    FIX40_NewOrderList_Signature = 58,
+    FIX40_NewOrderList_CheckSum = 59,
+};
+
+typedef struct _fix40NewOrderList {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    int64_t	ListSeqNo;
+    int64_t	ListNoOrds;
+    struct _ofixStrView	ListExecInst;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	HandlInst;
+    struct _ofixStrView	ExecInst;
+    int64_t	MinQty;
+    int64_t	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	ProcessCode;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	LocateReqd;
+    int64_t	OrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    struct _ofixStrView	Rule80A;
+    struct _ofixStrView	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40NewOrderList;
+
+extern void	fix40_decode_NewOrderList(ofixErr err, fix40NewOrderList m, const char *raw, int len);
+extern void	fix40_decode_NewOrderList_msg(ofixErr err, fix40NewOrderList m, ofixMsg msg);
+extern ofixMsg	fix40_encode_NewOrderList(ofixErr err, fix40NewOrderList m);
+
+// OrderCancelRequest [F]
+enum {
+    FIX40_OrderCancelRequest_BeginString = 0,
+    FIX40_OrderCancelRequest_BodyLength = 1,
+    FIX40_OrderCancelRequest_MsgType = 2,
+    FIX40_OrderCancelRequest_SenderCompID = 3,
+    FIX40_OrderCancelRequest_TargetCompID = 4,
+    FIX40_OrderCancelRequest_OnBehalfOfCompID = 5,
+    FIX40_OrderCancelRequest_DeliverToCompID = 6,
+    FIX40_OrderCancelRequest_SecureDataLen = 7,
+    FIX40_OrderCancelRequest_SecureData = 8,
+    FIX40_OrderCancelRequest_MsgSeqNum = 9,
+    FIX40_OrderCancelRequest_SenderSubID = 10,
+    FIX40_OrderCancelRequest_TargetSubID = 11,
+    FIX40_OrderCancelRequest_OnBehalfOfSubID = 12,
+    FIX40_OrderCancelRequest_DeliverToSubID = 13,
+    FIX40_OrderCancelRequest_PossDupFlag = 14,
+    FIX40_OrderCancelRequest_PossResend = 15,
+    FIX40_OrderCancelRequest_SendingTime = 16,
+    FIX40_OrderCancelRequest_OrigSendingTime = 17,
+    FIX40_OrderCancelRequest_OrigClOrdID = 18,
+    FIX40_OrderCancelRequest_OrderID = 19,
+    FIX40_OrderCancelRequest_ClOrdID = 20,
+    FIX40_OrderCancelRequest_ListID = 21,
+    FIX40_OrderCancelRequest_CxlType = 22,
+    FIX40_OrderCancelRequest_ClientID = 23,
+    FIX40_OrderCancelRequest_ExecBroker = 24,
+    FIX40_OrderCancelRequest_Symbol = 25,
+    FIX40_OrderCancelRequest_SymbolSfx = 26,
+    FIX40_OrderCancelRequest_SecurityID = 27,
+    FIX40_OrderCancelRequest_IDSource = 28,
+    FIX40_OrderCancelRequest_Issuer = 29,
+    FIX40_OrderCancelRequest_SecurityDesc = 30,
+    FIX40_OrderCancelRequest_Side = 31,
+    FIX40_OrderCancelRequest_OrderQty = 32,
+    FIX40_OrderCancelRequest_Text = 33,
+    FIX40_OrderCancelRequest_SignatureLength = 34,
+    FIX40_OrderCancelRequest_Signature = 35,
+    FIX40_OrderCancelRequest_CheckSum = 36,
+};
+
+typedef struct _fix40OrderCancelRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	CxlType;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40OrderCancelRequest;
+
+extern void	fix40_decode_OrderCancelRequest(ofixErr err, fix40OrderCancelRequest m, const char *raw, int len);
+extern void	fix40_decode_OrderCancelRequest_msg(ofixErr err, fix40OrderCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_OrderCancelRequest(ofixErr err, fix40OrderCancelRequest m);
+
+// OrderCancelReplaceRequest [G]
+enum {
+    FIX40_OrderCancelReplaceRequest_BeginString = 0,
+    FIX40_OrderCancelReplaceRequest_BodyLength = 1,
+    FIX40_OrderCancelReplaceRequest_MsgType = 2,
+    FIX40_OrderCancelReplaceRequest_SenderCompID = 3,
+    FIX40_OrderCancelReplaceRequest_TargetCompID = 4,
+    FIX40_OrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX40_OrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX40_OrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX40_OrderCancelReplaceRequest_SecureData = 8,
+    FIX40_OrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX40_OrderCancelReplaceRequest_SenderSubID = 10,
+    FIX40_OrderCancelReplaceRequest_TargetSubID = 11,
+    FIX40_OrderCancelReplaceRequest_OnBehalfOfSubID = 12,
+    FIX40_OrderCancelReplaceRequest_DeliverToSubID = 13,
+    FIX40_OrderCancelReplaceRequest_PossDupFlag = 14,
+    FIX40_OrderCancelReplaceRequest_PossResend = 15,
+    FIX40_OrderCancelReplaceRequest_SendingTime = 16,
+    FIX40_OrderCancelReplaceRequest_OrigSendingTime = 17,
+    FIX40_OrderCancelReplaceRequest_OrderID = 18,
+    FIX40_OrderCancelReplaceRequest_ClientID = 19,
+    FIX40_OrderCancelReplaceRequest_ExecBroker = 20,
+    FIX40_OrderCancelReplaceRequest_OrigClOrdID = 21,
+    FIX40_OrderCancelReplaceRequest_ClOrdID = 22,
+    FIX40_OrderCancelReplaceRequest_ListID = 23,
+    FIX40_OrderCancelReplaceRequest_Account = 24,
+    FIX40_OrderCancelReplaceRequest_SettlmntTyp = 25,
+    FIX40_OrderCancelReplaceRequest_FutSettDate = 26,
+    FIX40_OrderCancelReplaceRequest_HandlInst = 27,
+    FIX40_OrderCancelReplaceRequest_ExecInst = 28,
+    FIX40_OrderCancelReplaceRequest_MinQty = 29,
+    FIX40_OrderCancelReplaceRequest_MaxFloor = 30,
+    FIX40_OrderCancelReplaceRequest_ExDestination = 31,
+    FIX40_OrderCancelReplaceRequest_Symbol = 32,
+    FIX40_OrderCancelReplaceRequest_SymbolSfx = 33,
+    FIX40_OrderCancelReplaceRequest_SecurityID = 34,
+    FIX40_OrderCancelReplaceRequest_IDSource = 35,
+    FIX40_OrderCancelReplaceRequest_Issuer = 36,
+    FIX40_OrderCancelReplaceRequest_SecurityDesc = 37,
+    FIX40_OrderCancelReplaceRequest_Side = 38,
+    FIX40_OrderCancelReplaceRequest_OrderQty = 39,
+    FIX40_OrderCancelReplaceRequest_OrdType = 40,
+    FIX40_OrderCancelReplaceRequest_Price = 41,
+    FIX40_OrderCancelReplaceRequest_StopPx = 42,
+    FIX40_OrderCancelReplaceRequest_Currency = 43,
+    FIX40_OrderCancelReplaceRequest_TimeInForce = 44,
+    FIX40_OrderCancelReplaceRequest_ExpireTime = 45,
+    FIX40_OrderCancelReplaceRequest_Commission = 46,
+    FIX40_OrderCancelReplaceRequest_CommType = 47,
+    FIX40_OrderCancelReplaceRequest_Rule80A = 48,
+    FIX40_OrderCancelReplaceRequest_ForexReq = 49,
+    FIX40_OrderCancelReplaceRequest_SettlCurrency = 50,
+    FIX40_OrderCancelReplaceRequest_Text = 51,
+    FIX40_OrderCancelReplaceRequest_SignatureLength = 52,
+    FIX40_OrderCancelReplaceRequest_Signature = 53,
+    FIX40_OrderCancelReplaceRequest_CheckSum = 54,
+};
+
+typedef struct _fix40OrderCancelReplaceRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	HandlInst;
+    struct _ofixStrView	ExecInst;
+    int64_t	MinQty;
+    int64_t	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    struct _ofixStrView	Rule80A;
+    struct _ofixStrView	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40OrderCancelReplaceRequest;
+
+extern void	fix40_decode_OrderCancelReplaceRequest(ofixErr err, fix40OrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix40_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix40OrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_OrderCancelReplaceRequest(ofixErr err, fix40OrderCancelReplaceRequest m);
+
+// OrderStatusRequest [H]
+enum {
+    FIX40_OrderStatusRequest_BeginString = 0,
+    FIX40_OrderStatusRequest_BodyLength = 1,
+    FIX40_OrderStatusRequest_MsgType = 2,
+    FIX40_OrderStatusRequest_SenderCompID = 3,
+    FIX40_OrderStatusRequest_TargetCompID = 4,
+    FIX40_OrderStatusRequest_OnBehalfOfCompID = 5,
+    FIX40_OrderStatusRequest_DeliverToCompID = 6,
+    FIX40_OrderStatusRequest_SecureDataLen = 7,
+    FIX40_OrderStatusRequest_SecureData = 8,
+    FIX40_OrderStatusRequest_MsgSeqNum = 9,
+    FIX40_OrderStatusRequest_SenderSubID = 10,
+    FIX40_OrderStatusRequest_TargetSubID = 11,
+    FIX40_OrderStatusRequest_OnBehalfOfSubID = 12,
+    FIX40_OrderStatusRequest_DeliverToSubID = 13,
+    FIX40_OrderStatusRequest_PossDupFlag = 14,
+    FIX40_OrderStatusRequest_PossResend = 15,
+    FIX40_OrderStatusRequest_SendingTime = 16,
+    FIX40_OrderStatusRequest_OrigSendingTime = 17,
+    FIX40_OrderStatusRequest_OrderID = 18,
+    FIX40_OrderStatusRequest_ClOrdID = 19,
+    FIX40_OrderStatusRequest_ClientID = 20,
+    FIX40_OrderStatusRequest_ExecBroker = 21,
+    FIX40_OrderStatusRequest_Symbol = 22,
+    FIX40_OrderStatusRequest_SymbolSfx = 23,
+    FIX40_OrderStatusRequest_Issuer = 24,
+    FIX40_OrderStatusRequest_SecurityDesc = 25,
+    FIX40_OrderStatusRequest_Side = 26,
+    FIX40_OrderStatusRequest_SignatureLength = 27,
+    FIX40_OrderStatusRequest_Signature = 28,
+    FIX40_OrderStatusRequest_CheckSum = 29,
+};
+
+typedef struct _fix40OrderStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40OrderStatusRequest;
+
+extern void	fix40_decode_OrderStatusRequest(ofixErr err, fix40OrderStatusRequest m, const char *raw, int len);
+extern void	fix40_decode_OrderStatusRequest_msg(ofixErr err, fix40OrderStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_OrderStatusRequest(ofixErr err, fix40OrderStatusRequest m);
+
+// Allocation [J]
+enum {
+    FIX40_Allocation_BeginString = 0,
+    FIX40_Allocation_BodyLength = 1,
+    FIX40_Allocation_MsgType = 2,
+    FIX40_Allocation_SenderCompID = 3,
+    FIX40_Allocation_TargetCompID = 4,
+    FIX40_Allocation_OnBehalfOfCompID = 5,
+    FIX40_Allocation_DeliverToCompID = 6,
+    FIX40_Allocation_SecureDataLen = 7,
+    FIX40_Allocation_SecureData = 8,
+    FIX40_Allocation_MsgSeqNum = 9,
+    FIX40_Allocation_SenderSubID = 10,
+    FIX40_Allocation_TargetSubID = 11,
+    FIX40_Allocation_OnBehalfOfSubID = 12,
+    FIX40_Allocation_DeliverToSubID = 13,
+    FIX40_Allocation_PossDupFlag = 14,
+    FIX40_Allocation_PossResend = 15,
+    FIX40_Allocation_SendingTime = 16,
+    FIX40_Allocation_OrigSendingTime = 17,
+    FIX40_Allocation_AllocID = 18,
+    FIX40_Allocation_AllocTransType = 19,
+    FIX40_Allocation_RefAllocID = 20,
+    FIX40_Allocation_NoOrders = 21,
+    FIX40_Allocation_NoExecs = 22,
+    FIX40_Allocation_Side = 23,
+    FIX40_Allocation_Symbol = 24,
+    FIX40_Allocation_SymbolSfx = 25,
+    FIX40_Allocation_SecurityID = 26,
+    FIX40_Allocation_IDSource = 27,
+    FIX40_Allocation_Issuer = 28,
+    FIX40_Allocation_SecurityDesc = 29,
+    FIX40_Allocation_Shares = 30,
+    FIX40_Allocation_AvgPx = 31,
+    FIX40_Allocation_Currency = 32,
+    FIX40_Allocation_AvgPrxPrecision = 33,
+    FIX40_Allocation_TradeDate = 34,
+    FIX40_Allocation_TransactTime = 35,
+    FIX40_Allocation_SettlmntTyp = 36,
+    FIX40_Allocation_FutSettDate = 37,
+    FIX40_Allocation_NetMoney = 38,
+    FIX40_Allocation_NoMiscFees = 39,
+    FIX40_Allocation_SettlCurrAmt = 40,
+    FIX40_Allocation_SettlCurrency = 41,
+    FIX40_Allocation_OpenClose = 42,
+    FIX40_Allocation_Text = 43,
+    FIX40_Allocation_NoAllocs = 44,
+    FIX40_Allocation_SignatureLength = 45,
+    FIX40_Allocation_Signature = 46,
+    FIX40_Allocation_CheckSum = 47,
+};
+
+typedef struct _fix40Allocation {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	AllocID;
+    struct _ofixStrView	AllocTransType;
+    int64_t	RefAllocID;
+    int64_t	NoOrders;
+    int64_t	NoExecs;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	Shares;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixStrView	Currency;
+    int64_t	AvgPrxPrecision;
+    struct _ofixDate	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixDecimal	NetMoney;
+    int64_t	NoMiscFees;
+    struct _ofixDecimal	SettlCurrAmt;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	OpenClose;
+    struct _ofixStrView	Text;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Allocation;
+
+extern void	fix40_decode_Allocation(ofixErr err, fix40Allocation m, const char *raw, int len);
+extern void	fix40_decode_Allocation_msg(ofixErr err, fix40Allocation m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Allocation(ofixErr err, fix40Allocation m);
+
+// ListCancelRequest [K]
+enum {
+    FIX40_ListCancelRequest_BeginString = 0,
+    FIX40_ListCancelRequest_BodyLength = 1,
+    FIX40_ListCancelRequest_MsgType = 2,
+    FIX40_ListCancelRequest_SenderCompID = 3,
+    FIX40_ListCancelRequest_TargetCompID = 4,
+    FIX40_ListCancelRequest_OnBehalfOfCompID = 5,
+    FIX40_ListCancelRequest_DeliverToCompID = 6,
+    FIX40_ListCancelRequest_SecureDataLen = 7,
+    FIX40_ListCancelRequest_SecureData = 8,
+    FIX40_ListCancelRequest_MsgSeqNum = 9,
+    FIX40_ListCancelRequest_SenderSubID = 10,
+    FIX40_ListCancelRequest_TargetSubID = 11,
+    FIX40_ListCancelRequest_OnBehalfOfSubID = 12,
+    FIX40_ListCancelRequest_DeliverToSubID = 13,
+    FIX40_ListCancelRequest_PossDupFlag = 14,
+    FIX40_ListCancelRequest_PossResend = 15,
+    FIX40_ListCancelRequest_SendingTime = 16,
+    FIX40_ListCancelRequest_OrigSendingTime = 17,
+    FIX40_ListCancelRequest_ListID = 18,
+    FIX40_ListCancelRequest_WaveNo = 19,
+    FIX40_ListCancelRequest_Text = 20,
+    FIX40_ListCancelRequest_SignatureLength = 21,
+    FIX40_ListCancelRequest_Signature = 22,
+    FIX40_ListCancelRequest_CheckSum = 23,
+};
+
+typedef struct _fix40ListCancelRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40ListCancelRequest;
+
+extern void	fix40_decode_ListCancelRequest(ofixErr err, fix40ListCancelRequest m, const char *raw, int len);
+extern void	fix40_decode_ListCancelRequest_msg(ofixErr err, fix40ListCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_ListCancelRequest(ofixErr err, fix40ListCancelRequest m);
+
+// ListExecute [L]
+enum {
+    FIX40_ListExecute_BeginString = 0,
+    FIX40_ListExecute_BodyLength = 1,
+    FIX40_ListExecute_MsgType = 2,
+    FIX40_ListExecute_SenderCompID = 3,
+    FIX40_ListExecute_TargetCompID = 4,
+    FIX40_ListExecute_OnBehalfOfCompID = 5,
+    FIX40_ListExecute_DeliverToCompID = 6,
+    FIX40_ListExecute_SecureDataLen = 7,
+    FIX40_ListExecute_SecureData = 8,
+    FIX40_ListExecute_MsgSeqNum = 9,
+    FIX40_ListExecute_SenderSubID = 10,
+    FIX40_ListExecute_TargetSubID = 11,
+    FIX40_ListExecute_OnBehalfOfSubID = 12,
+    FIX40_ListExecute_DeliverToSubID = 13,
+    FIX40_ListExecute_PossDupFlag = 14,
+    FIX40_ListExecute_PossResend = 15,
+    FIX40_ListExecute_SendingTime = 16,
+    FIX40_ListExecute_OrigSendingTime = 17,
+    FIX40_ListExecute_ListID = 18,
+    FIX40_ListExecute_WaveNo = 19,
+    FIX40_ListExecute_Text = 20,
+    FIX40_ListExecute_SignatureLength = 21,
+    FIX40_ListExecute_Signature = 22,
+    FIX40_ListExecute_CheckSum = 23,
+};
+
+typedef struct _fix40ListExecute {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40ListExecute;
+
+extern void	fix40_decode_ListExecute(ofixErr err, fix40ListExecute m, const char *raw, int len);
+extern void	fix40_decode_ListExecute_msg(ofixErr err, fix40ListExecute m, ofixMsg msg);
+extern ofixMsg	fix40_encode_ListExecute(ofixErr err, fix40ListExecute m);
+
+// ListStatusRequest [M]
+enum {
+    FIX40_ListStatusRequest_BeginString = 0,
+    FIX40_ListStatusRequest_BodyLength = 1,
+    FIX40_ListStatusRequest_MsgType = 2,
+    FIX40_ListStatusRequest_SenderCompID = 3,
+    FIX40_ListStatusRequest_TargetCompID = 4,
+    FIX40_ListStatusRequest_OnBehalfOfCompID = 5,
+    FIX40_ListStatusRequest_DeliverToCompID = 6,
+    FIX40_ListStatusRequest_SecureDataLen = 7,
+    FIX40_ListStatusRequest_SecureData = 8,
+    FIX40_ListStatusRequest_MsgSeqNum = 9,
+    FIX40_ListStatusRequest_SenderSubID = 10,
+    FIX40_ListStatusRequest_TargetSubID = 11,
+    FIX40_ListStatusRequest_OnBehalfOfSubID = 12,
+    FIX40_ListStatusRequest_DeliverToSubID = 13,
+    FIX40_ListStatusRequest_PossDupFlag = 14,
+    FIX40_ListStatusRequest_PossResend = 15,
+    FIX40_ListStatusRequest_SendingTime = 16,
+    FIX40_ListStatusRequest_OrigSendingTime = 17,
+    FIX40_ListStatusRequest_ListID = 18,
+    FIX40_ListStatusRequest_WaveNo = 19,
+    FIX40_ListStatusRequest_Text = 20,
+    FIX40_ListStatusRequest_SignatureLength = 21,
+    FIX40_ListStatusRequest_Signature = 22,
+    FIX40_ListStatusRequest_CheckSum = 23,
+};
+
+typedef struct _fix40ListStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40ListStatusRequest;
+
+extern void	fix40_decode_ListStatusRequest(ofixErr err, fix40ListStatusRequest m, const char *raw, int len);
+extern void	fix40_decode_ListStatusRequest_msg(ofixErr err, fix40ListStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_ListStatusRequest(ofixErr err, fix40ListStatusRequest m);
+
+// ListStatus [N]
+enum {
+    FIX40_ListStatus_BeginString = 0,
+    FIX40_ListStatus_BodyLength = 1,
+    FIX40_ListStatus_MsgType = 2,
+    FIX40_ListStatus_SenderCompID = 3,
+    FIX40_ListStatus_TargetCompID = 4,
+    FIX40_ListStatus_OnBehalfOfCompID = 5,
+    FIX40_ListStatus_DeliverToCompID = 6,
+    FIX40_ListStatus_SecureDataLen = 7,
+    FIX40_ListStatus_SecureData = 8,
+    FIX40_ListStatus_MsgSeqNum = 9,
+    FIX40_ListStatus_SenderSubID = 10,
+    FIX40_ListStatus_TargetSubID = 11,
+    FIX40_ListStatus_OnBehalfOfSubID = 12,
+    FIX40_ListStatus_DeliverToSubID = 13,
+    FIX40_ListStatus_PossDupFlag = 14,
+    FIX40_ListStatus_PossResend = 15,
+    FIX40_ListStatus_SendingTime = 16,
+    FIX40_ListStatus_OrigSendingTime = 17,
+    FIX40_ListStatus_ListID = 18,
+    FIX40_ListStatus_WaveNo = 19,
+    FIX40_ListStatus_NoRpts = 20,
+    FIX40_ListStatus_RptSeq = 21,
+    FIX40_ListStatus_NoOrders = 22,
+    FIX40_ListStatus_SignatureLength = 23,
+    FIX40_ListStatus_Signature = 24,
+    FIX40_ListStatus_CheckSum = 25,
+};
+
+typedef struct _fix40ListStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    int64_t	NoRpts;
+    int64_t	RptSeq;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40ListStatus;
+
+extern void	fix40_decode_ListStatus(ofixErr err, fix40ListStatus m, const char *raw, int len);
+extern void	fix40_decode_ListStatus_msg(ofixErr err, fix40ListStatus m, ofixMsg msg);
+extern ofixMsg	fix40_encode_ListStatus(ofixErr err, fix40ListStatus m);
+
+// AllocationACK [P]
+enum {
+    FIX40_AllocationACK_BeginString = 0,
+    FIX40_AllocationACK_BodyLength = 1,
+    FIX40_AllocationACK_MsgType = 2,
+    FIX40_AllocationACK_SenderCompID = 3,
+    FIX40_AllocationACK_TargetCompID = 4,
+    FIX40_AllocationACK_OnBehalfOfCompID = 5,
+    FIX40_AllocationACK_DeliverToCompID = 6,
+    FIX40_AllocationACK_SecureDataLen = 7,
+    FIX40_AllocationACK_SecureData = 8,
+    FIX40_AllocationACK_MsgSeqNum = 9,
+    FIX40_AllocationACK_SenderSubID = 10,
+    FIX40_AllocationACK_TargetSubID = 11,
+    FIX40_AllocationACK_OnBehalfOfSubID = 12,
+    FIX40_AllocationACK_DeliverToSubID = 13,
+    FIX40_AllocationACK_PossDupFlag = 14,
+    FIX40_AllocationACK_PossResend = 15,
+    FIX40_AllocationACK_SendingTime = 16,
+    FIX40_AllocationACK_OrigSendingTime = 17,
+    FIX40_AllocationACK_ClientID = 18,
+    FIX40_AllocationACK_ExecBroker = 19,
+    FIX40_AllocationACK_AllocID = 20,
+    FIX40_AllocationACK_TradeDate = 21,
+    FIX40_AllocationACK_TransactTime = 22,
+    FIX40_AllocationACK_AllocStatus = 23,
+    FIX40_AllocationACK_AllocRejCode = 24,
+    FIX40_AllocationACK_Text = 25,
+    FIX40_AllocationACK_SignatureLength = 26,
+    FIX40_AllocationACK_Signature = 27,
+    FIX40_AllocationACK_CheckSum = 28,
+};
+
+typedef struct _fix40AllocationACK {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    int64_t	AllocID;
+    struct _ofixDate	TradeDate;
+    struct _ofixDate	TransactTime;
+    int64_t	AllocStatus;
+    int64_t	AllocRejCode;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40AllocationACK;
+
+extern void	fix40_decode_AllocationACK(ofixErr err, fix40AllocationACK m, const char *raw, int len);
+extern void	fix40_decode_AllocationACK_msg(ofixErr err, fix40AllocationACK m, ofixMsg msg);
+extern ofixMsg	fix40_encode_AllocationACK(ofixErr err, fix40AllocationACK m);
+
+// DontKnowTrade [Q]
+enum {
+    FIX40_DontKnowTrade_BeginString = 0,
+    FIX40_DontKnowTrade_BodyLength = 1,
+    FIX40_DontKnowTrade_MsgType = 2,
+    FIX40_DontKnowTrade_SenderCompID = 3,
+    FIX40_DontKnowTrade_TargetCompID = 4,
+    FIX40_DontKnowTrade_OnBehalfOfCompID = 5,
+    FIX40_DontKnowTrade_DeliverToCompID = 6,
+    FIX40_DontKnowTrade_SecureDataLen = 7,
+    FIX40_DontKnowTrade_SecureData = 8,
+    FIX40_DontKnowTrade_MsgSeqNum = 9,
+    FIX40_DontKnowTrade_SenderSubID = 10,
+    FIX40_DontKnowTrade_TargetSubID = 11,
+    FIX40_DontKnowTrade_OnBehalfOfSubID = 12,
+    FIX40_DontKnowTrade_DeliverToSubID = 13,
+    FIX40_DontKnowTrade_PossDupFlag = 14,
+    FIX40_DontKnowTrade_PossResend = 15,
+    FIX40_DontKnowTrade_SendingTime = 16,
+    FIX40_DontKnowTrade_OrigSendingTime = 17,
+    FIX40_DontKnowTrade_OrderID = 18,
+    FIX40_DontKnowTrade_ExecID = 19,
+    FIX40_DontKnowTrade_DKReason = 20,
+    FIX40_DontKnowTrade_Symbol = 21,
+    FIX40_DontKnowTrade_Side = 22,
+    FIX40_DontKnowTrade_OrderQty = 23,
+    FIX40_DontKnowTrade_LastShares = 24,
+    FIX40_DontKnowTrade_LastPx = 25,
+    FIX40_DontKnowTrade_Text = 26,
+    FIX40_DontKnowTrade_SignatureLength = 27,
+    FIX40_DontKnowTrade_Signature = 28,
+    FIX40_DontKnowTrade_CheckSum = 29,
+};
+
+typedef struct _fix40DontKnowTrade {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    int64_t	ExecID;
+    struct _ofixStrView	DKReason;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    int64_t	LastShares;
+    struct _ofixDecimal	LastPx;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40DontKnowTrade;
+
+extern void	fix40_decode_DontKnowTrade(ofixErr err, fix40DontKnowTrade m, const char *raw, int len);
+extern void	fix40_decode_DontKnowTrade_msg(ofixErr err, fix40DontKnowTrade m, ofixMsg msg);
+extern ofixMsg	fix40_encode_DontKnowTrade(ofixErr err, fix40DontKnowTrade m);
+
+// QuoteRequest [R]
+enum {
+    FIX40_QuoteRequest_BeginString = 0,
+    FIX40_QuoteRequest_BodyLength = 1,
+    FIX40_QuoteRequest_MsgType = 2,
+    FIX40_QuoteRequest_SenderCompID = 3,
+    FIX40_QuoteRequest_TargetCompID = 4,
+    FIX40_QuoteRequest_OnBehalfOfCompID = 5,
+    FIX40_QuoteRequest_DeliverToCompID = 6,
+    FIX40_QuoteRequest_SecureDataLen = 7,
+    FIX40_QuoteRequest_SecureData = 8,
+    FIX40_QuoteRequest_MsgSeqNum = 9,
+    FIX40_QuoteRequest_SenderSubID = 10,
+    FIX40_QuoteRequest_TargetSubID = 11,
+    FIX40_QuoteRequest_OnBehalfOfSubID = 12,
+    FIX40_QuoteRequest_DeliverToSubID = 13,
+    FIX40_QuoteRequest_PossDupFlag = 14,
+    FIX40_QuoteRequest_PossResend = 15,
+    FIX40_QuoteRequest_SendingTime = 16,
+    FIX40_QuoteRequest_OrigSendingTime = 17,
+    FIX40_QuoteRequest_QuoteReqID = 18,
+    FIX40_QuoteRequest_Symbol = 19,
+    FIX40_QuoteRequest_SymbolSfx = 20,
+    FIX40_QuoteRequest_SecurityID = 21,
+    FIX40_QuoteRequest_IDSource = 22,
+    FIX40_QuoteRequest_Issuer = 23,
+    FIX40_QuoteRequest_SecurityDesc = 24,
+    FIX40_QuoteRequest_PrevClosePx = 25,
+    FIX40_QuoteRequest_Side = 26,
+    FIX40_QuoteRequest_OrderQty = 27,
+    FIX40_QuoteRequest_SignatureLength = 28,
+    FIX40_QuoteRequest_Signature = 29,
+    FIX40_QuoteRequest_CheckSum = 30,
+};
+
+typedef struct _fix40QuoteRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40QuoteRequest;
+
+extern void	fix40_decode_QuoteRequest(ofixErr err, fix40QuoteRequest m, const char *raw, int len);
+extern void	fix40_decode_QuoteRequest_msg(ofixErr err, fix40QuoteRequest m, ofixMsg msg);
+extern ofixMsg	fix40_encode_QuoteRequest(ofixErr err, fix40QuoteRequest m);
+
+// Quote [S]
+enum {
+    FIX40_Quote_BeginString = 0,
+    FIX40_Quote_BodyLength = 1,
+    FIX40_Quote_MsgType = 2,
+    FIX40_Quote_SenderCompID = 3,
+    FIX40_Quote_TargetCompID = 4,
+    FIX40_Quote_OnBehalfOfCompID = 5,
+    FIX40_Quote_DeliverToCompID = 6,
+    FIX40_Quote_SecureDataLen = 7,
+    FIX40_Quote_SecureData = 8,
+    FIX40_Quote_MsgSeqNum = 9,
+    FIX40_Quote_SenderSubID = 10,
+    FIX40_Quote_TargetSubID = 11,
+    FIX40_Quote_OnBehalfOfSubID = 12,
+    FIX40_Quote_DeliverToSubID = 13,
+    FIX40_Quote_PossDupFlag = 14,
+    FIX40_Quote_PossResend = 15,
+    FIX40_Quote_SendingTime = 16,
+    FIX40_Quote_OrigSendingTime = 17,
+    FIX40_Quote_QuoteReqID = 18,
+    FIX40_Quote_QuoteID = 19,
+    FIX40_Quote_Symbol = 20,
+    FIX40_Quote_SymbolSfx = 21,
+    FIX40_Quote_SecurityID = 22,
+    FIX40_Quote_IDSource = 23,
+    FIX40_Quote_Issuer = 24,
+    FIX40_Quote_SecurityDesc = 25,
+    FIX40_Quote_BidPx = 26,
+    FIX40_Quote_OfferPx = 27,
+    FIX40_Quote_BidSize = 28,
+    FIX40_Quote_OfferSize = 29,
+    FIX40_Quote_ValidUntilTime = 30,
+    FIX40_Quote_SignatureLength = 31,
+    FIX40_Quote_Signature = 32,
+    FIX40_Quote_CheckSum = 33,
+};
+
+typedef struct _fix40Quote {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    int64_t	BidSize;
+    int64_t	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix40Quote;
+
+extern void	fix40_decode_Quote(ofixErr err, fix40Quote m, const char *raw, int len);
+extern void	fix40_decode_Quote_msg(ofixErr err, fix40Quote m, ofixMsg msg);
+extern ofixMsg	fix40_encode_Quote(ofixErr err, fix40Quote m);
+
+#endif /* __OFIX_FIX40MSGS_H__ */
@@ -0,0 +1,2772 @@
+
+// This file is auto-generated from ref/FIX41.xml and should not be modified.
+
+#ifndef __OFIX_FIX41MSGS_H__
+#define __OFIX_FIX41MSGS_H__
+
+#include <stdint.h>
+
+#include "ofix/err.h"
+#include "ofix/msg.h"
+#include "ofix/date.h"
+#include "ofix/typed.h"
+
+// Heartbeat [0]
+enum {
+    FIX41_Heartbeat_BeginString = 0,
+    FIX41_Heartbeat_BodyLength = 1,
+    FIX41_Heartbeat_MsgType = 2,
+    FIX41_Heartbeat_SenderCompID = 3,
+    FIX41_Heartbeat_TargetCompID = 4,
+    FIX41_Heartbeat_OnBehalfOfCompID = 5,
+    FIX41_Heartbeat_DeliverToCompID = 6,
+    FIX41_Heartbeat_SecureDataLen = 7,
+    FIX41_Heartbeat_SecureData = 8,
+    FIX41_Heartbeat_MsgSeqNum = 9,
+    FIX41_Heartbeat_SenderSubID = 10,
+    FIX41_Heartbeat_SenderLocationID = 11,
+    FIX41_Heartbeat_TargetSubID = 12,
+    FIX41_Heartbeat_TargetLocationID = 13,
+    FIX41_Heartbeat_OnBehalfOfSubID = 14,
+    FIX41_Heartbeat_OnBehalfOfLocationID = 15,
+    FIX41_Heartbeat_DeliverToSubID = 16,
+    FIX41_Heartbeat_DeliverToLocationID = 17,
+    FIX41_Heartbeat_PossDupFlag = 18,
+    FIX41_Heartbeat_PossResend = 19,
+    FIX41_Heartbeat_SendingTime = 20,
+    FIX41_Heartbeat_OrigSendingTime = 21,
+    FIX41_Heartbeat_TestReqID = 22,
+    FIX41_Heartbeat_SignatureLength = 23,
+    FIX41_Heartbeat_Signature = 24,
+    FIX41_Heartbeat_CheckSum = 25,
+};
+
+typedef struct _fix41Heartbeat {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Heartbeat;
+
+extern void	fix41_decode_Heartbeat(ofixErr err, fix41Heartbeat m, const char *raw, int len);
+extern void	fix41_decode_Heartbeat_msg(ofixErr err, fix41Heartbeat m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Heartbeat(ofixErr err, fix41Heartbeat m);
+
+// TestRequest [1]
+enum {
+    FIX41_TestRequest_BeginString = 0,
+    FIX41_TestRequest_BodyLength = 1,
+    FIX41_TestRequest_MsgType = 2,
+    FIX41_TestRequest_SenderCompID = 3,
+    FIX41_TestRequest_TargetCompID = 4,
+    FIX41_TestRequest_OnBehalfOfCompID = 5,
+    FIX41_TestRequest_DeliverToCompID = 6,
+    FIX41_TestRequest_SecureDataLen = 7,
+    FIX41_TestRequest_SecureData = 8,
+    FIX41_TestRequest_MsgSeqNum = 9,
+    FIX41_TestRequest_SenderSubID = 10,
+    FIX41_TestRequest_SenderLocationID = 11,
+    FIX41_TestRequest_TargetSubID = 12,
+    FIX41_TestRequest_TargetLocationID = 13,
+    FIX41_TestRequest_OnBehalfOfSubID = 14,
+    FIX41_TestRequest_OnBehalfOfLocationID = 15,
+    FIX41_TestRequest_DeliverToSubID = 16,
+    FIX41_TestRequest_DeliverToLocationID = 17,
+    FIX41_TestRequest_PossDupFlag = 18,
+    FIX41_TestRequest_PossResend = 19,
+    FIX41_TestRequest_SendingTime = 20,
+    FIX41_TestRequest_OrigSendingTime = 21,
+    FIX41_TestRequest_TestReqID = 22,
+    FIX41_TestRequest_SignatureLength = 23,
+    FIX41_TestRequest_Signature = 24,
+    FIX41_TestRequest_CheckSum = 25,
+};
+
+typedef struct _fix41TestRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41TestRequest;
+
+extern void	fix41_decode_TestRequest(ofixErr err, fix41TestRequest m, const char *raw, int len);
+extern void	fix41_decode_TestRequest_msg(ofixErr err, fix41TestRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_TestRequest(ofixErr err, fix41TestRequest m);
+
+// ResendRequest [2]
+enum {
+    FIX41_ResendRequest_BeginString = 0,
+    FIX41_ResendRequest_BodyLength = 1,
+    FIX41_ResendRequest_MsgType = 2,
+    FIX41_ResendRequest_SenderCompID = 3,
+    FIX41_ResendRequest_TargetCompID = 4,
+    FIX41_ResendRequest_OnBehalfOfCompID = 5,
+    FIX41_ResendRequest_DeliverToCompID = 6,
+    FIX41_ResendRequest_SecureDataLen = 7,
+    FIX41_ResendRequest_SecureData = 8,
+    FIX41_ResendRequest_MsgSeqNum = 9,
+    FIX41_ResendRequest_SenderSubID = 10,
+    FIX41_ResendRequest_SenderLocationID = 11,
+    FIX41_ResendRequest_TargetSubID = 12,
+    FIX41_ResendRequest_TargetLocationID = 13,
+    FIX41_ResendRequest_OnBehalfOfSubID = 14,
+    FIX41_ResendRequest_OnBehalfOfLocationID = 15,
+    FIX41_ResendRequest_DeliverToSubID = 16,
+    FIX41_ResendRequest_DeliverToLocationID = 17,
+    FIX41_ResendRequest_PossDupFlag = 18,
+    FIX41_ResendRequest_PossResend = 19,
+    FIX41_ResendRequest_SendingTime = 20,
+    FIX41_ResendRequest_OrigSendingTime = 21,
+    FIX41_ResendRequest_BeginSeqNo = 22,
+    FIX41_ResendRequest_EndSeqNo = 23,
+    FIX41_ResendRequest_SignatureLength = 24,
+    FIX41_ResendRequest_Signature = 25,
+    FIX41_ResendRequest_CheckSum = 26,
+};
+
+typedef struct _fix41ResendRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	BeginSeqNo;
+    int64_t	EndSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41ResendRequest;
+
+extern void	fix41_decode_ResendRequest(ofixErr err, fix41ResendRequest m, const char *raw, int len);
+extern void	fix41_decode_ResendRequest_msg(ofixErr err, fix41ResendRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_ResendRequest(ofixErr err, fix41ResendRequest m);
+
+// Reject [3]
+enum {
+    FIX41_Reject_BeginString = 0,
+    FIX41_Reject_BodyLength = 1,
+    FIX41_Reject_MsgType = 2,
+    FIX41_Reject_SenderCompID = 3,
+    FIX41_Reject_TargetCompID = 4,
+    FIX41_Reject_OnBehalfOfCompID = 5,
+    FIX41_Reject_DeliverToCompID = 6,
+    FIX41_Reject_SecureDataLen = 7,
+    FIX41_Reject_SecureData = 8,
+    FIX41_Reject_MsgSeqNum = 9,
+    FIX41_Reject_SenderSubID = 10,
+    FIX41_Reject_SenderLocationID = 11,
+    FIX41_Reject_TargetSubID = 12,
+    FIX41_Reject_TargetLocationID = 13,
+    FIX41_Reject_OnBehalfOfSubID = 14,
+    FIX41_Reject_OnBehalfOfLocationID = 15,
+    FIX41_Reject_DeliverToSubID = 16,
+    FIX41_Reject_DeliverToLocationID = 17,
+    FIX41_Reject_PossDupFlag = 18,
+    FIX41_Reject_PossResend = 19,
+    FIX41_Reject_SendingTime = 20,
+    FIX41_Reject_OrigSendingTime = 21,
+    FIX41_Reject_RefSeqNum = 22,
+    FIX41_Reject_Text = 23,
+    FIX41_Reject_SignatureLength = 24,
+    FIX41_Reject_Signature = 25,
+    FIX41_Reject_CheckSum = 26,
+};
+
+typedef struct _fix41Reject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	RefSeqNum;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Reject;
+
+extern void	fix41_decode_Reject(ofixErr err, fix41Reject m, const char *raw, int len);
+extern void	fix41_decode_Reject_msg(ofixErr err, fix41Reject m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Reject(ofixErr err, fix41Reject m);
+
+// SequenceReset [4]
+enum {
+    FIX41_SequenceReset_BeginString = 0,
+    FIX41_SequenceReset_BodyLength = 1,
+    FIX41_SequenceReset_MsgType = 2,
+    FIX41_SequenceReset_SenderCompID = 3,
+    FIX41_SequenceReset_TargetCompID = 4,
+    FIX41_SequenceReset_OnBehalfOfCompID = 5,
+    FIX41_SequenceReset_DeliverToCompID = 6,
+    FIX41_SequenceReset_SecureDataLen = 7,
+    FIX41_SequenceReset_SecureData = 8,
+    FIX41_SequenceReset_MsgSeqNum = 9,
+    FIX41_SequenceReset_SenderSubID = 10,
+    FIX41_SequenceReset_SenderLocationID = 11,
+    FIX41_SequenceReset_TargetSubID = 12,
+    FIX41_SequenceReset_TargetLocationID = 13,
+    FIX41_SequenceReset_OnBehalfOfSubID = 14,
+    FIX41_SequenceReset_OnBehalfOfLocationID = 15,
+    FIX41_SequenceReset_DeliverToSubID = 16,
+    FIX41_SequenceReset_DeliverToLocationID = 17,
+    FIX41_SequenceReset_PossDupFlag = 18,
+    FIX41_SequenceReset_PossResend = 19,
+    FIX41_SequenceReset_SendingTime = 20,
+    FIX41_SequenceReset_OrigSendingTime = 21,
+    FIX41_SequenceReset_GapFillFlag = 22,
+    FIX41_SequenceReset_NewSeqNo = 23,
+    FIX41_SequenceReset_SignatureLength = 24,
+    FIX41_SequenceReset_Signature = 25,
+    FIX41_SequenceReset_CheckSum = 26,
+};
+
+typedef struct _fix41SequenceReset {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	GapFillFlag;
+    int64_t	NewSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41SequenceReset;
+
+extern void	fix41_decode_SequenceReset(ofixErr err, fix41SequenceReset m, const char *raw, int len);
+extern void	fix41_decode_SequenceReset_msg(ofixErr err, fix41SequenceReset m, ofixMsg msg);
+extern ofixMsg	fix41_encode_SequenceReset(ofixErr err, fix41SequenceReset m);
+
+// Logout [5]
+enum {
+    FIX41_Logout_BeginString = 0,
+    FIX41_Logout_BodyLength = 1,
+    FIX41_Logout_MsgType = 2,
+    FIX41_Logout_SenderCompID = 3,
+    FIX41_Logout_TargetCompID = 4,
+    FIX41_Logout_OnBehalfOfCompID = 5,
+    FIX41_Logout_DeliverToCompID = 6,
+    FIX41_Logout_SecureDataLen = 7,
+    FIX41_Logout_SecureData = 8,
+    FIX41_Logout_MsgSeqNum = 9,
+    FIX41_Logout_SenderSubID = 10,
+    FIX41_Logout_SenderLocationID = 11,
+    FIX41_Logout_TargetSubID = 12,
+    FIX41_Logout_TargetLocationID = 13,
+    FIX41_Logout_OnBehalfOfSubID = 14,
+    FIX41_Logout_OnBehalfOfLocationID = 15,
+    FIX41_Logout_DeliverToSubID = 16,
+    FIX41_Logout_DeliverToLocationID = 17,
+    FIX41_Logout_PossDupFlag = 18,
+    FIX41_Logout_PossResend = 19,
+    FIX41_Logout_SendingTime = 20,
+    FIX41_Logout_OrigSendingTime = 21,
+    FIX41_Logout_Text = 22,
+    FIX41_Logout_SignatureLength = 23,
+    FIX41_Logout_Signature = 24,
+    FIX41_Logout_CheckSum = 25,
+};
+
+typedef struct _fix41Logout {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Logout;
+
+extern void	fix41_decode_Logout(ofixErr err, fix41Logout m, const char *raw, int len);
+extern void	fix41_decode_Logout_msg(ofixErr err, fix41Logout m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Logout(ofixErr err, fix41Logout m);
+
+// IndicationofInterest [6]
+enum {
+    FIX41_IndicationofInterest_BeginString = 0,
+    FIX41_IndicationofInterest_BodyLength = 1,
+    FIX41_IndicationofInterest_MsgType = 2,
+    FIX41_IndicationofInterest_SenderCompID = 3,
+    FIX41_IndicationofInterest_TargetCompID = 4,
+    FIX41_IndicationofInterest_OnBehalfOfCompID = 5,
+    FIX41_IndicationofInterest_DeliverToCompID = 6,
+    FIX41_IndicationofInterest_SecureDataLen = 7,
+    FIX41_IndicationofInterest_SecureData = 8,
+    FIX41_IndicationofInterest_MsgSeqNum = 9,
+    FIX41_IndicationofInterest_SenderSubID = 10,
+    FIX41_IndicationofInterest_SenderLocationID = 11,
+    FIX41_IndicationofInterest_TargetSubID = 12,
+    FIX41_IndicationofInterest_TargetLocationID = 13,
+    FIX41_IndicationofInterest_OnBehalfOfSubID = 14,
+    FIX41_IndicationofInterest_OnBehalfOfLocationID = 15,
+    FIX41_IndicationofInterest_DeliverToSubID = 16,
+    FIX41_IndicationofInterest_DeliverToLocationID = 17,
+    FIX41_IndicationofInterest_PossDupFlag = 18,
+    FIX41_IndicationofInterest_PossResend = 19,
+    FIX41_IndicationofInterest_SendingTime = 20,
+    FIX41_IndicationofInterest_OrigSendingTime = 21,
+    FIX41_IndicationofInterest_IOIid = 22,
+    FIX41_IndicationofInterest_IOITransType = 23,
+    FIX41_IndicationofInterest_IOIRefID = 24,
+    FIX41_IndicationofInterest_Symbol = 25,
+    FIX41_IndicationofInterest_SymbolSfx = 26,
+    FIX41_IndicationofInterest_SecurityID = 27,
+    FIX41_IndicationofInterest_IDSource = 28,
+    FIX41_IndicationofInterest_SecurityType = 29,
+    FIX41_IndicationofInterest_MaturityMonthYear = 30,
+    FIX41_IndicationofInterest_MaturityDay = 31,
+    FIX41_IndicationofInterest_PutOrCall = 32,
+    FIX41_IndicationofInterest_StrikePrice = 33,
+    FIX41_IndicationofInterest_OptAttribute = 34,
+    FIX41_IndicationofInterest_SecurityExchange = 35,
+    FIX41_IndicationofInterest_Issuer = 36,
+    FIX41_IndicationofInterest_SecurityDesc = 37,
+    FIX41_IndicationofInterest_Side = 38,
+    FIX41_IndicationofInterest_IOIShares = 39,
+    FIX41_IndicationofInterest_Price = 40,
+    FIX41_IndicationofInterest_Currency = 41,
+    FIX41_IndicationofInterest_ValidUntilTime = 42,
+    FIX41_IndicationofInterest_IOIQltyInd = 43,
+    FIX41_IndicationofInterest_IOIOthSvc = 44,
+    FIX41_IndicationofInterest_IOINaturalFlag = 45,
+    FIX41_IndicationofInterest_NoIOIQualifiers = 46,
+    FIX41_IndicationofInterest_Text = 47,
+    FIX41_IndicationofInterest_TransactTime = 48,
+    FIX41_IndicationofInterest_URLLink = 49,
+    FIX41_IndicationofInterest_SignatureLength = 50,
+    FIX41_IndicationofInterest_Signature = 51,
+    FIX41_IndicationofInterest_CheckSum = 52,
+};
+
+typedef struct _fix41IndicationofInterest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	IOITransType;
+    struct _ofixStrView	IOIRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	IOIShares;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixStrView	IOIQltyInd;
+    struct _ofixStrView	IOIOthSvc;
+    struct _ofixStrView	IOINaturalFlag;
+    int64_t	NoIOIQualifiers;
+    struct _ofixStrView	Text;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	URLLink;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41IndicationofInterest;
+
+extern void	fix41_decode_IndicationofInterest(ofixErr err, fix41IndicationofInterest m, const char *raw, int len);
+extern void	fix41_decode_IndicationofInterest_msg(ofixErr err, fix41IndicationofInterest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_IndicationofInterest(ofixErr err, fix41IndicationofInterest m);
+
+// Advertisement [7]
+enum {
+    FIX41_Advertisement_BeginString = 0,
+    FIX41_Advertisement_BodyLength = 1,
+    FIX41_Advertisement_MsgType = 2,
+    FIX41_Advertisement_SenderCompID = 3,
+    FIX41_Advertisement_TargetCompID = 4,
+    FIX41_Advertisement_OnBehalfOfCompID = 5,
+    FIX41_Advertisement_DeliverToCompID = 6,
+    FIX41_Advertisement_SecureDataLen = 7,
+    FIX41_Advertisement_SecureData = 8,
+    FIX41_Advertisement_MsgSeqNum = 9,
+    FIX41_Advertisement_SenderSubID = 10,
+    FIX41_Advertisement_SenderLocationID = 11,
+    FIX41_Advertisement_TargetSubID = 12,
+    FIX41_Advertisement_TargetLocationID = 13,
+    FIX41_Advertisement_OnBehalfOfSubID = 14,
+    FIX41_Advertisement_OnBehalfOfLocationID = 15,
+    FIX41_Advertisement_DeliverToSubID = 16,
+    FIX41_Advertisement_DeliverToLocationID = 17,
+    FIX41_Advertisement_PossDupFlag = 18,
+    FIX41_Advertisement_PossResend = 19,
+    FIX41_Advertisement_SendingTime = 20,
+    FIX41_Advertisement_OrigSendingTime = 21,
+    FIX41_Advertisement_AdvId = 22,
+    FIX41_Advertisement_AdvTransType = 23,
+    FIX41_Advertisement_AdvRefID = 24,
+    FIX41_Advertisement_Symbol = 25,
+    FIX41_Advertisement_SymbolSfx = 26,
+    FIX41_Advertisement_SecurityID = 27,
+    FIX41_Advertisement_IDSource = 28,
+    FIX41_Advertisement_SecurityType = 29,
+    FIX41_Advertisement_MaturityMonthYear = 30,
+    FIX41_Advertisement_MaturityDay = 31,
+    FIX41_Advertisement_PutOrCall = 32,
+    FIX41_Advertisement_StrikePrice = 33,
+    FIX41_Advertisement_OptAttribute = 34,
+    FIX41_Advertisement_SecurityExchange = 35,
+    FIX41_Advertisement_Issuer = 36,
+    FIX41_Advertisement_SecurityDesc = 37,
+    FIX41_Advertisement_AdvSide = 38,
+    FIX41_Advertisement_Shares = 39,
+    FIX41_Advertisement_Price = 40,
+    FIX41_Advertisement_Currency = 41,
+    FIX41_Advertisement_TradeDate = 42,
+    FIX41_Advertisement_TransactTime = 43,
+    FIX41_Advertisement_Text = 44,
+    FIX41_Advertisement_URLLink = 45,
+    FIX41_Advertisement_LastMkt = 46,
+    FIX41_Advertisement_SignatureLength = 47,
+    FIX41_Advertisement_Signature = 48,
+    FIX41_Advertisement_CheckSum = 49,
+};
+
+typedef struct _fix41Advertisement {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	AdvId;
+    struct _ofixStrView	AdvTransType;
+    struct _ofixStrView	AdvRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	AdvSide;
+    int64_t	Shares;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixDate	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    struct _ofixStrView	URLLink;
+    struct _ofixStrView	LastMkt;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Advertisement;
+
+extern void	fix41_decode_Advertisement(ofixErr err, fix41Advertisement m, const char *raw, int len);
+extern void	fix41_decode_Advertisement_msg(ofixErr err, fix41Advertisement m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Advertisement(ofixErr err, fix41Advertisement m);
+
+// ExecutionReport [8]
+enum {
+    FIX41_ExecutionReport_BeginString = 0,
+    FIX41_ExecutionReport_BodyLength = 1,
+    FIX41_ExecutionReport_MsgType = 2,
+    FIX41_ExecutionReport_SenderCompID = 3,
+    FIX41_ExecutionReport_TargetCompID = 4,
+    FIX41_ExecutionReport_OnBehalfOfCompID = 5,
+    FIX41_ExecutionReport_DeliverToCompID = 6,
+    FIX41_ExecutionReport_SecureDataLen = 7,
+    FIX41_ExecutionReport_SecureData = 8,
+    FIX41_ExecutionReport_MsgSeqNum = 9,
+    FIX41_ExecutionReport_SenderSubID = 10,
+    FIX41_ExecutionReport_SenderLocationID = 11,
+    FIX41_ExecutionReport_TargetSubID = 12,
+    FIX41_ExecutionReport_TargetLocationID = 13,
+    FIX41_ExecutionReport_OnBehalfOfSubID = 14,
+    FIX41_ExecutionReport_OnBehalfOfLocationID = 15,
+    FIX41_ExecutionReport_DeliverToSubID = 16,
+    FIX41_ExecutionReport_DeliverToLocationID = 17,
+    FIX41_ExecutionReport_PossDupFlag = 18,
+    FIX41_ExecutionReport_PossResend = 19,
+    FIX41_ExecutionReport_SendingTime = 20,
+    FIX41_ExecutionReport_OrigSendingTime = 21,
+    FIX41_ExecutionReport_OrderID = 22,
+    FIX41_ExecutionReport_SecondaryOrderID = 23,
+    FIX41_ExecutionReport_ClOrdID = 24,
+    FIX41_ExecutionReport_OrigClOrdID = 25,
+    FIX41_ExecutionReport_ClientID = 26,
+    FIX41_ExecutionReport_ExecBroker = 27,
+    FIX41_ExecutionReport_ListID = 28,
+    FIX41_ExecutionReport_ExecID = 29,
+    FIX41_ExecutionReport_ExecTransType = 30,
+    FIX41_ExecutionReport_ExecRefID = 31,
+    FIX41_ExecutionReport_ExecType = 32,
+    FIX41_ExecutionReport_OrdStatus = 33,
+    FIX41_ExecutionReport_OrdRejReason = 34,
+    FIX41_ExecutionReport_Account = 35,
+    FIX41_ExecutionReport_SettlmntTyp = 36,
+    FIX41_ExecutionReport_FutSettDate = 37,
+    FIX41_ExecutionReport_Symbol = 38,
+    FIX41_ExecutionReport_SymbolSfx = 39,
+    FIX41_ExecutionReport_SecurityID = 40,
+    FIX41_ExecutionReport_IDSource = 41,
+    FIX41_ExecutionReport_SecurityType = 42,
+    FIX41_ExecutionReport_MaturityMonthYear = 43,
+    FIX41_ExecutionReport_MaturityDay = 44,
+    FIX41_ExecutionReport_PutOrCall = 45,
+    FIX41_ExecutionReport_StrikePrice = 46,
+    FIX41_ExecutionReport_OptAttribute = 47,
+    FIX41_ExecutionReport_SecurityExchange = 48,
+    FIX41_ExecutionReport_Issuer = 49,
+    FIX41_ExecutionReport_SecurityDesc = 50,
+    FIX41_ExecutionReport_Side = 51,
+    FIX41_ExecutionReport_OrderQty = 52,
+    FIX41_ExecutionReport_OrdType = 53,
+    FIX41_ExecutionReport_Price = 54,
+    FIX41_ExecutionReport_StopPx = 55,
+    FIX41_ExecutionReport_PegDifference = 56,
+    FIX41_ExecutionReport_Currency = 57,
+    FIX41_ExecutionReport_TimeInForce = 58,
+    FIX41_ExecutionReport_ExpireTime = 59,
+    FIX41_ExecutionReport_ExecInst = 60,
+    FIX41_ExecutionReport_Rule80A = 61,
+    FIX41_ExecutionReport_LastShares = 62,
+    FIX41_ExecutionReport_LastPx = 63,
+    FIX41_ExecutionReport_LastSpotRate = 64,
+    FIX41_ExecutionReport_LastForwardPoints = 65,
+    FIX41_ExecutionReport_LastMkt = 66,
+    FIX41_ExecutionReport_LastCapacity = 67,
+    FIX41_ExecutionReport_LeavesQty = 68,
+    FIX41_ExecutionReport_CumQty = 69,
+    FIX41_ExecutionReport_AvgPx = 70,
+    FIX41_ExecutionReport_TradeDate = 71,
+    FIX41_ExecutionReport_TransactTime = 72,
+    FIX41_ExecutionReport_ReportToExch = 73,
+    FIX41_ExecutionReport_Commission = 74,
+    FIX41_ExecutionReport_CommType = 75,
+    FIX41_ExecutionReport_SettlCurrAmt = 76,
+    FIX41_ExecutionReport_SettlCurrency = 77,
+    FIX41_ExecutionReport_Text = 78,
+    FIX41_ExecutionReport_SignatureLength = 79,
+    FIX41_ExecutionReport_Signature = 80,
+    FIX41_ExecutionReport_CheckSum = 81,
+};
+
+typedef struct _fix41ExecutionReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	ExecID;
+    struct _ofixStrView	ExecTransType;
+    struct _ofixStrView	ExecRefID;
+    struct _ofixStrView	ExecType;
+    struct _ofixStrView	OrdStatus;
+    int64_t	OrdRejReason;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	PegDifference;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixStrView	ExecInst;
+    struct _ofixStrView	Rule80A;
+    int64_t	LastShares;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDecimal	LastSpotRate;
+    struct _ofixDecimal	LastForwardPoints;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	LastCapacity;
+    int64_t	LeavesQty;
+    int64_t	CumQty;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDate	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	ReportToExch;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    struct _ofixDecimal	SettlCurrAmt;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41ExecutionReport;
+
+extern void	fix41_decode_ExecutionReport(ofixErr err, fix41ExecutionReport m, const char *raw, int len);
+extern void	fix41_decode_ExecutionReport_msg(ofixErr err, fix41ExecutionReport m, ofixMsg msg);
+extern ofixMsg	fix41_encode_ExecutionReport(ofixErr err, fix41ExecutionReport m);
+
+// OrderCancelReject [9]
+enum {
+    FIX41_OrderCancelReject_BeginString = 0,
+    FIX41_OrderCancelReject_BodyLength = 1,
+    FIX41_OrderCancelReject_MsgType = 2,
+    FIX41_OrderCancelReject_SenderCompID = 3,
+    FIX41_OrderCancelReject_TargetCompID = 4,
+    FIX41_OrderCancelReject_OnBehalfOfCompID = 5,
+    FIX41_OrderCancelReject_DeliverToCompID = 6,
+    FIX41_OrderCancelReject_SecureDataLen = 7,
+    FIX41_OrderCancelReject_SecureData = 8,
+    FIX41_OrderCancelReject_MsgSeqNum = 9,
+    FIX41_OrderCancelReject_SenderSubID = 10,
+    FIX41_OrderCancelReject_SenderLocationID = 11,
+    FIX41_OrderCancelReject_TargetSubID = 12,
+    FIX41_OrderCancelReject_TargetLocationID = 13,
+    FIX41_OrderCancelReject_OnBehalfOfSubID = 14,
+    FIX41_OrderCancelReject_OnBehalfOfLocationID = 15,
+    FIX41_OrderCancelReject_DeliverToSubID = 16,
+    FIX41_OrderCancelReject_DeliverToLocationID = 17,
+    FIX41_OrderCancelReject_PossDupFlag = 18,
+    FIX41_OrderCancelReject_PossResend = 19,
+    FIX41_OrderCancelReject_SendingTime = 20,
+    FIX41_OrderCancelReject_OrigSendingTime = 21,
+    FIX41_OrderCancelReject_OrderID = 22,
+    FIX41_OrderCancelReject_SecondaryOrderID = 23,
+    FIX41_OrderCancelReject_ClOrdID = 24,
+    FIX41_OrderCancelReject_OrigClOrdID = 25,
+    FIX41_OrderCancelReject_OrdStatus = 26,
+    FIX41_OrderCancelReject_ClientID = 27,
+    FIX41_OrderCancelReject_ExecBroker = 28,
+    FIX41_OrderCancelReject_ListID = 29,
+    FIX41_OrderCancelReject_CxlRejReason = 30,
+    FIX41_OrderCancelReject_Text = 31,
+    FIX41_OrderCancelReject_SignatureLength = 32,
+    FIX41_OrderCancelReject_Signature = 33,
+    FIX41_OrderCancelReject_CheckSum = 34,
+};
+
+typedef struct _fix41OrderCancelReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	OrdStatus;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	ListID;
+    int64_t	CxlRejReason;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41OrderCancelReject;
+
+extern void	fix41_decode_OrderCancelReject(ofixErr err, fix41OrderCancelReject m, const char *raw, int len);
+extern void	fix41_decode_OrderCancelReject_msg(ofixErr err, fix41OrderCancelReject m, ofixMsg msg);
+extern ofixMsg	fix41_encode_OrderCancelReject(ofixErr err, fix41OrderCancelReject m);
+
+// Logon [A]
+enum {
+    FIX41_Logon_BeginString = 0,
+    FIX41_Logon_BodyLength = 1,
+    FIX41_Logon_MsgType = 2,
+    FIX41_Logon_SenderCompID = 3,
+    FIX41_Logon_TargetCompID = 4,
+    FIX41_Logon_OnBehalfOfCompID = 5,
+    FIX41_Logon_DeliverToCompID = 6,
+    FIX41_Logon_SecureDataLen = 7,
+    FIX41_Logon_SecureData = 8,
+    FIX41_Logon_MsgSeqNum = 9,
+    FIX41_Logon_SenderSubID = 10,
+    FIX41_Logon_SenderLocationID = 11,
+    FIX41_Logon_TargetSubID = 12,
+    FIX41_Logon_TargetLocationID = 13,
+    FIX41_Logon_OnBehalfOfSubID = 14,
+    FIX41_Logon_OnBehalfOfLocationID = 15,
+    FIX41_Logon_DeliverToSubID = 16,
+    FIX41_Logon_DeliverToLocationID = 17,
+    FIX41_Logon_PossDupFlag = 18,
+    FIX41_Logon_PossResend = 19,
+    FIX41_Logon_SendingTime = 20,
+    FIX41_Logon_OrigSendingTime = 21,
+    FIX41_Logon_EncryptMethod = 22,
+    FIX41_Logon_HeartBtInt = 23,
+    FIX41_Logon_RawDataLength = 24,
+    FIX41_Logon_RawData = 25,
+    FIX41_Logon_ResetSeqNumFlag = 26,
+    FIX41_Logon_SignatureLength = 27,
+    FIX41_Logon_Signature = 28,
+    FIX41_Logon_CheckSum = 29,
+};
+
+typedef struct _fix41Logon {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	EncryptMethod;
+    int64_t	HeartBtInt;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    struct _ofixStrView	ResetSeqNumFlag;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Logon;
+
+extern void	fix41_decode_Logon(ofixErr err, fix41Logon m, const char *raw, int len);
+extern void	fix41_decode_Logon_msg(ofixErr err, fix41Logon m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Logon(ofixErr err, fix41Logon m);
+
+// News [B]
+enum {
+    FIX41_News_BeginString = 0,
+    FIX41_News_BodyLength = 1,
+    FIX41_News_MsgType = 2,
+    FIX41_News_SenderCompID = 3,
+    FIX41_News_TargetCompID = 4,
+    FIX41_News_OnBehalfOfCompID = 5,
+    FIX41_News_DeliverToCompID = 6,
+    FIX41_News_SecureDataLen = 7,
+    FIX41_News_SecureData = 8,
+    FIX41_News_MsgSeqNum = 9,
+    FIX41_News_SenderSubID = 10,
+    FIX41_News_SenderLocationID = 11,
+    FIX41_News_TargetSubID = 12,
+    FIX41_News_TargetLocationID = 13,
+    FIX41_News_OnBehalfOfSubID = 14,
+    FIX41_News_OnBehalfOfLocationID = 15,
+    FIX41_News_DeliverToSubID = 16,
+    FIX41_News_DeliverToLocationID = 17,
+    FIX41_News_PossDupFlag = 18,
+    FIX41_News_PossResend = 19,
+    FIX41_News_SendingTime = 20,
+    FIX41_News_OrigSendingTime = 21,
+    FIX41_News_OrigTime = 22,
+    FIX41_News_Urgency = 23,
+    FIX41_News_Headline = 24,
+    FIX41_News_NoRelatedSym = 25,
+    FIX41_News_LinesOfText = 26,
+    FIX41_News_URLLink = 27,
+    FIX41_News_RawDataLength = 28,
+    FIX41_News_RawData = 29,
+    FIX41_News_SignatureLength = 30,
+    FIX41_News_Signature = 31,
+    FIX41_News_CheckSum = 32,
+};
+
+typedef struct _fix41News {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixDate	OrigTime;
+    struct _ofixStrView	Urgency;
+    struct _ofixStrView	Headline;
+    int64_t	NoRelatedSym;
+    int64_t	LinesOfText;
+    struct _ofixStrView	URLLink;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41News;
+
+extern void	fix41_decode_News(ofixErr err, fix41News m, const char *raw, int len);
+extern void	fix41_decode_News_msg(ofixErr err, fix41News m, ofixMsg msg);
+extern ofixMsg	fix41_encode_News(ofixErr err, fix41News m);
+
+// Email [C]
+enum {
+    FIX41_Email_BeginString = 0,
+    FIX41_Email_BodyLength = 1,
+    FIX41_Email_MsgType = 2,
+    FIX41_Email_SenderCompID = 3,
+    FIX41_Email_TargetCompID = 4,
+    FIX41_Email_OnBehalfOfCompID = 5,
+    FIX41_Email_DeliverToCompID = 6,
+    FIX41_Email_SecureDataLen = 7,
+    FIX41_Email_SecureData = 8,
+    FIX41_Email_MsgSeqNum = 9,
+    FIX41_Email_SenderSubID = 10,
+    FIX41_Email_SenderLocationID = 11,
+    FIX41_Email_TargetSubID = 12,
+    FIX41_Email_TargetLocationID = 13,
+    FIX41_Email_OnBehalfOfSubID = 14,
+    FIX41_Email_OnBehalfOfLocationID = 15,
+    FIX41_Email_DeliverToSubID = 16,
+    FIX41_Email_DeliverToLocationID = 17,
+    FIX41_Email_PossDupFlag = 18,
+    FIX41_Email_PossResend = 19,
+    FIX41_Email_SendingTime = 20,
+    FIX41_Email_OrigSendingTime = 21,
+    FIX41_Email_EmailThreadID = 22,
+    FIX41_Email_EmailType = 23,
+    FIX41_Email_OrigTime = 24,
+    FIX41_Email_Subject = 25,
+    FIX41_Email_NoRelatedSym = 26,
+    FIX41_Email_OrderID = 27,
+    FIX41_Email_ClOrdID = 28,
+    FIX41_Email_LinesOfText = 29,
+    FIX41_Email_RawDataLength = 30,
+    FIX41_Email_RawData = 31,
+    FIX41_Email_SignatureLength = 32,
+    FIX41_Email_Signature = 33,
+    FIX41_Email_CheckSum = 34,
+};
+
+typedef struct _fix41Email {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	EmailThreadID;
+    struct _ofixStrView	EmailType;
+    struct _ofixDate	OrigTime;
+    struct _ofixStrView	Subject;
+    int64_t	NoRelatedSym;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	LinesOfText;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Email;
+
+extern void	fix41_decode_Email(ofixErr err, fix41Email m, const char *raw, int len);
+extern void	fix41_decode_Email_msg(ofixErr err, fix41Email m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Email(ofixErr err, fix41Email m);
+
+// NewOrderSingle [D]
+enum {
+    FIX41_NewOrderSingle_BeginString = 0,
+    FIX41_NewOrderSingle_BodyLength = 1,
+    FIX41_NewOrderSingle_MsgType = 2,
+    FIX41_NewOrderSingle_SenderCompID = 3,
+    FIX41_NewOrderSingle_TargetCompID = 4,
+    FIX41_NewOrderSingle_OnBehalfOfCompID = 5,
+    FIX41_NewOrderSingle_DeliverToCompID = 6,
+    FIX41_NewOrderSingle_SecureDataLen = 7,
+    FIX41_NewOrderSingle_SecureData = 8,
+    FIX41_NewOrderSingle_MsgSeqNum = 9,
+    FIX41_NewOrderSingle_SenderSubID = 10,
+    FIX41_NewOrderSingle_SenderLocationID = 11,
+    FIX41_NewOrderSingle_TargetSubID = 12,
+    FIX41_NewOrderSingle_TargetLocationID = 13,
+    FIX41_NewOrderSingle_OnBehalfOfSubID = 14,
+    FIX41_NewOrderSingle_OnBehalfOfLocationID = 15,
+    FIX41_NewOrderSingle_DeliverToSubID = 16,
+    FIX41_NewOrderSingle_DeliverToLocationID = 17,
+    FIX41_NewOrderSingle_PossDupFlag = 18,
+    FIX41_NewOrderSingle_PossResend = 19,
+    FIX41_NewOrderSingle_SendingTime = 20,
+    FIX41_NewOrderSingle_OrigSendingTime = 21,
+    FIX41_NewOrderSingle_ClOrdID = 22,
+    FIX41_NewOrderSingle_ClientID = 23,
+    FIX41_NewOrderSingle_ExecBroker = 24,
+    FIX41_NewOrderSingle_Account = 25,
+    FIX41_NewOrderSingle_SettlmntTyp = 26,
+    FIX41_NewOrderSingle_FutSettDate = 27,
+    FIX41_NewOrderSingle_HandlInst = 28,
+    FIX41_NewOrderSingle_ExecInst = 29,
+    FIX41_NewOrderSingle_MinQty = 30,
+    FIX41_NewOrderSingle_MaxFloor = 31,
+    FIX41_NewOrderSingle_ExDestination = 32,
+    FIX41_NewOrderSingle_ProcessCode = 33,
+    FIX41_NewOrderSingle_Symbol = 34,
+    FIX41_NewOrderSingle_SymbolSfx = 35,
+    FIX41_NewOrderSingle_SecurityID = 36,
+    FIX41_NewOrderSingle_IDSource = 37,
+    FIX41_NewOrderSingle_SecurityType = 38,
+    FIX41_NewOrderSingle_MaturityMonthYear = 39,
+    FIX41_NewOrderSingle_MaturityDay = 40,
+    FIX41_NewOrderSingle_PutOrCall = 41,
+    FIX41_NewOrderSingle_StrikePrice = 42,
+    FIX41_NewOrderSingle_OptAttribute = 43,
+    FIX41_NewOrderSingle_SecurityExchange = 44,
+    FIX41_NewOrderSingle_Issuer = 45,
+    FIX41_NewOrderSingle_SecurityDesc = 46,
+    FIX41_NewOrderSingle_PrevClosePx = 47,
+    FIX41_NewOrderSingle_Side = 48,
+    FIX41_NewOrderSingle_LocateReqd = 49,
+    FIX41_NewOrderSingle_OrderQty = 50,
+    FIX41_NewOrderSingle_CashOrderQty = 51,
+    FIX41_NewOrderSingle_OrdType = 52,
+    FIX41_NewOrderSingle_Price = 53,
+    FIX41_NewOrderSingle_StopPx = 54,
+    FIX41_NewOrderSingle_Currency = 55,
+    FIX41_NewOrderSingle_IOIid = 56,
+    FIX41_NewOrderSingle_QuoteID = 57,
+    FIX41_NewOrderSingle_TimeInForce = 58,
+    FIX41_NewOrderSingle_ExpireTime = 59,
+    FIX41_NewOrderSingle_Commission = 60,
+    FIX41_NewOrderSingle_CommType = 61,
+    FIX41_NewOrderSingle_Rule80A = 62,
+    FIX41_NewOrderSingle_ForexReq = 63,
+    FIX41_NewOrderSingle_SettlCurrency = 64,
+    FIX41_NewOrderSingle_Text = 65,
+    FIX41_NewOrderSingle_FutSettDate2 = 66,
+    FIX41_NewOrderSingle_OrderQty2 = 67,
+    FIX41_NewOrderSingle_OpenClose = 68,
+    FIX41_NewOrderSingle_CoveredOrUncovered = 69,
+    FIX41_NewOrderSingle_CustomerOrFirm = 70,
+    FIX41_NewOrderSingle_MaxShow = 71,
+    FIX41_NewOrderSingle_PegDifference = 72,
+    FIX41_NewOrderSingle_SignatureLength = 73,
+    FIX41_NewOrderSingle_Signature = 74,
+    FIX41_NewOrderSingle_CheckSum = 75,
+};
+
+typedef struct _fix41NewOrderSingle {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	HandlInst;
+    struct _ofixStrView	ExecInst;
+    int64_t	MinQty;
+    int64_t	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	ProcessCode;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	LocateReqd;
+    int64_t	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    struct _ofixStrView	Rule80A;
+    struct _ofixStrView	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    struct _ofixDate	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	OpenClose;
+    int64_t	CoveredOrUncovered;
+    int64_t	CustomerOrFirm;
+    int64_t	MaxShow;
+    struct _ofixDecimal	PegDifference;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41NewOrderSingle;
+
+extern void	fix41_decode_NewOrderSingle(ofixErr err, fix41NewOrderSingle m, const char *raw, int len);
+extern void	fix41_decode_NewOrderSingle_msg(ofixErr err, fix41NewOrderSingle m, ofixMsg msg);
+extern ofixMsg	fix41_encode_NewOrderSingle(ofixErr err, fix41NewOrderSingle m);
+
+// NewOrderList [E]
+enum {
+    FIX41_NewOrderList_BeginString = 0,
+    FIX41_NewOrderList_BodyLength = 1,
+    FIX41_NewOrderList_MsgType = 2,
+    FIX41_NewOrderList_SenderCompID = 3,
+    FIX41_NewOrderList_TargetCompID = 4,
+    FIX41_NewOrderList_OnBehalfOfCompID = 5,
+    FIX41_NewOrderList_DeliverToCompID = 6,
+    FIX41_NewOrderList_SecureDataLen = 7,
+    FIX41_NewOrderList_SecureData = 8,
+    FIX41_NewOrderList_MsgSeqNum = 9,
+    FIX41_NewOrderList_SenderSubID = 10,
+    FIX41_NewOrderList_SenderLocationID = 11,
+    FIX41_NewOrderList_TargetSubID = 12,
+    FIX41_NewOrderList_TargetLocationID = 13,
+    FIX41_NewOrderList_OnBehalfOfSubID = 14,
+    FIX41_NewOrderList_OnBehalfOfLocationID = 15,
+    FIX41_NewOrderList_DeliverToSubID = 16,
+    FIX41_NewOrderList_DeliverToLocationID = 17,
+    FIX41_NewOrderList_PossDupFlag = 18,
+    FIX41_NewOrderList_PossResend = 19,
+    FIX41_NewOrderList_SendingTime = 20,
+    FIX41_NewOrderList_OrigSendingTime = 21,
+    FIX41_NewOrderList_ListID = 22,
+    FIX41_NewOrderList_WaveNo = 23,
+    FIX41_NewOrderList_ListSeqNo = 24,
+    FIX41_NewOrderList_ListNoOrds = 25,
+    FIX41_NewOrderList_ListExecInst = 26,
+    FIX41_NewOrderList_ClOrdID = 27,
+    FIX41_NewOrderList_ClientID = 28,
+    FIX41_NewOrderList_ExecBroker = 29,
+    FIX41_NewOrderList_Account = 30,
+    FIX41_NewOrderList_SettlmntTyp = 31,
+    FIX41_NewOrderList_FutSettDate = 32,
+    FIX41_NewOrderList_HandlInst = 33,
+    FIX41_NewOrderList_ExecInst = 34,
+    FIX41_NewOrderList_MinQty = 35,
+    FIX41_NewOrderList_MaxFloor = 36,
+    FIX41_NewOrderList_ExDestination = 37,
+    FIX41_NewOrderList_ProcessCode = 38,
+    FIX41_NewOrderList_Symbol = 39,
+    FIX41_NewOrderList_SymbolSfx = 40,
+    FIX41_NewOrderList_SecurityID = 41,
+    FIX41_NewOrderList_IDSource = 42,
+    FIX41_NewOrderList_SecurityType = 43,
+    FIX41_NewOrderList_MaturityMonthYear = 44,
+    FIX41_NewOrderList_MaturityDay = 45,
+    FIX41_NewOrderList_PutOrCall = 46,
+    FIX41_NewOrderList_StrikePrice = 47,
+    FIX41_NewOrderList_OptAttribute = 48,
+    FIX41_NewOrderList_SecurityExchange = 49,
+    FIX41_NewOrderList_Issuer = 50,
+    FIX41_NewOrderList_SecurityDesc = 51,
+    FIX41_NewOrderList_PrevClosePx = 52,
+    FIX41_NewOrderList_Side = 53,
+    FIX41_NewOrderList_LocateReqd = 54,
+    FIX41_NewOrderList_OrderQty = 55,
+    FIX41_NewOrderList_OrdType = 56,
+    FIX41_NewOrderList_Price = 57,
+    FIX41_NewOrderList_StopPx = 58,
+    FIX41_NewOrderList_PegDifference = 59,
+    FIX41_NewOrderList_Currency = 60,
+    FIX41_NewOrderList_TimeInForce = 61,
+    FIX41_NewOrderList_ExpireTime = 62,
+    FIX41_NewOrderList_Commission = 63,
+    FIX41_NewOrderList_CommType = 64,
+    FIX41_NewOrderList_Rule80A = 65,
+    FIX41_NewOrderList_ForexReq = 66,
+    FIX41_NewOrderList_SettlCurrency = 67,
+    FIX41_NewOrderList_Text = 68,
+    FIX41_NewOrderList_FutSettDate2 = 69,
+    FIX41_NewOrderList_OrderQty2 = 70,
+    FIX41_NewOrderList_OpenClose = 71,
+    FIX41_NewOrderList_CoveredOrUncovered = 72,
+    FIX41_NewOrderList_CustomerOrFirm = 73,
+    FIX41_NewOrderList_MaxShow = 74,
+    FIX41_NewOrderList_SignatureLength = 75,
+    FIX41_NewOrderList_Signature = 76,
+    FIX41_NewOrderList_CheckSum = 77,
+};
+
+typedef struct _fix41NewOrderList {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    int64_t	ListSeqNo;
+    int64_t	ListNoOrds;
+    struct _ofixStrView	ListExecInst;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	HandlInst;
+    struct _ofixStrView	ExecInst;
+    int64_t	MinQty;
+    int64_t	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	ProcessCode;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	LocateReqd;
+    int64_t	OrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	PegDifference;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    struct _ofixStrView	Rule80A;
+    struct _ofixStrView	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    struct _ofixDate	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	OpenClose;
+    int64_t	CoveredOrUncovered;
+    int64_t	CustomerOrFirm;
+    int64_t	MaxShow;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41NewOrderList;
+
+extern void	fix41_decode_NewOrderList(ofixErr err, fix41NewOrderList m, const char *raw, int len);
+extern void	fix41_decode_NewOrderList_msg(ofixErr err, fix41NewOrderList m, ofixMsg msg);
+extern ofixMsg	fix41_encode_NewOrderList(ofixErr err, fix41NewOrderList m);
+
+// OrderCancelRequest [F]
+enum {
+    FIX41_OrderCancelRequest_BeginString = 0,
+    FIX41_OrderCancelRequest_BodyLength = 1,
+    FIX41_OrderCancelRequest_MsgType = 2,
+    FIX41_OrderCancelRequest_SenderCompID = 3,
+    FIX41_OrderCancelRequest_TargetCompID = 4,
+    FIX41_OrderCancelRequest_OnBehalfOfCompID = 5,
+    FIX41_OrderCancelRequest_DeliverToCompID = 6,
+    FIX41_OrderCancelRequest_SecureDataLen = 7,
+    FIX41_OrderCancelRequest_SecureData = 8,
+    FIX41_OrderCancelRequest_MsgSeqNum = 9,
+    FIX41_OrderCancelRequest_SenderSubID = 10,
+    FIX41_OrderCancelRequest_SenderLocationID = 11,
+    FIX41_OrderCancelRequest_TargetSubID = 12,
+    FIX41_OrderCancelRequest_TargetLocationID = 13,
+    FIX41_OrderCancelRequest_OnBehalfOfSubID = 14,
+    FIX41_OrderCancelRequest_OnBehalfOfLocationID = 15,
+    FIX41_OrderCancelRequest_DeliverToSubID = 16,
+    FIX41_OrderCancelRequest_DeliverToLocationID = 17,
+    FIX41_OrderCancelRequest_PossDupFlag = 18,
+    FIX41_OrderCancelRequest_PossResend = 19,
+    FIX41_OrderCancelRequest_SendingTime = 20,
+    FIX41_OrderCancelRequest_OrigSendingTime = 21,
+    FIX41_OrderCancelRequest_OrigClOrdID = 22,
+    FIX41_OrderCancelRequest_OrderID = 23,
+    FIX41_OrderCancelRequest_ClOrdID = 24,
+    FIX41_OrderCancelRequest_ListID = 25,
+    FIX41_OrderCancelRequest_ClientID = 26,
+    FIX41_OrderCancelRequest_ExecBroker = 27,
+    FIX41_OrderCancelRequest_Symbol = 28,
+    FIX41_OrderCancelRequest_SymbolSfx = 29,
+    FIX41_OrderCancelRequest_SecurityID = 30,
+    FIX41_OrderCancelRequest_IDSource = 31,
+    FIX41_OrderCancelRequest_SecurityType = 32,
+    FIX41_OrderCancelRequest_MaturityMonthYear = 33,
+    FIX41_OrderCancelRequest_MaturityDay = 34,
+    FIX41_OrderCancelRequest_PutOrCall = 35,
+    FIX41_OrderCancelRequest_StrikePrice = 36,
+    FIX41_OrderCancelRequest_OptAttribute = 37,
+    FIX41_OrderCancelRequest_SecurityExchange = 38,
+    FIX41_OrderCancelRequest_Issuer = 39,
+    FIX41_OrderCancelRequest_SecurityDesc = 40,
+    FIX41_OrderCancelRequest_Side = 41,
+    FIX41_OrderCancelRequest_OrderQty = 42,
+    FIX41_OrderCancelRequest_CashOrderQty = 43,
+    FIX41_OrderCancelRequest_Text = 44,
+    FIX41_OrderCancelRequest_SignatureLength = 45,
+    FIX41_OrderCancelRequest_Signature = 46,
+    FIX41_OrderCancelRequest_CheckSum = 47,
+};
+
+typedef struct _fix41OrderCancelRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41OrderCancelRequest;
+
+extern void	fix41_decode_OrderCancelRequest(ofixErr err, fix41OrderCancelRequest m, const char *raw, int len);
+extern void	fix41_decode_OrderCancelRequest_msg(ofixErr err, fix41OrderCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_OrderCancelRequest(ofixErr err, fix41OrderCancelRequest m);
+
+// OrderCancelReplaceRequest [G]
+enum {
+    FIX41_OrderCancelReplaceRequest_BeginString = 0,
+    FIX41_OrderCancelReplaceRequest_BodyLength = 1,
+    FIX41_OrderCancelReplaceRequest_MsgType = 2,
+    FIX41_OrderCancelReplaceRequest_SenderCompID = 3,
+    FIX41_OrderCancelReplaceRequest_TargetCompID = 4,
+    FIX41_OrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX41_OrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX41_OrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX41_OrderCancelReplaceRequest_SecureData = 8,
+    FIX41_OrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX41_OrderCancelReplaceRequest_SenderSubID = 10,
+    FIX41_OrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX41_OrderCancelReplaceRequest_TargetSubID = 12,
+    FIX41_OrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX41_OrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX41_OrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX41_OrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX41_OrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX41_OrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX41_OrderCancelReplaceRequest_PossResend = 19,
+    FIX41_OrderCancelReplaceRequest_SendingTime = 20,
+    FIX41_OrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX41_OrderCancelReplaceRequest_OrderID = 22,
+    FIX41_OrderCancelReplaceRequest_ClientID = 23,
+    FIX41_OrderCancelReplaceRequest_ExecBroker = 24,
+    FIX41_OrderCancelReplaceRequest_OrigClOrdID = 25,
+    FIX41_OrderCancelReplaceRequest_ClOrdID = 26,
+    FIX41_OrderCancelReplaceRequest_ListID = 27,
+    FIX41_OrderCancelReplaceRequest_Account = 28,
+    FIX41_OrderCancelReplaceRequest_SettlmntTyp = 29,
+    FIX41_OrderCancelReplaceRequest_FutSettDate = 30,
+    FIX41_OrderCancelReplaceRequest_HandlInst = 31,
+    FIX41_OrderCancelReplaceRequest_ExecInst = 32,
+    FIX41_OrderCancelReplaceRequest_MinQty = 33,
+    FIX41_OrderCancelReplaceRequest_MaxFloor = 34,
+    FIX41_OrderCancelReplaceRequest_ExDestination = 35,
+    FIX41_OrderCancelReplaceRequest_Symbol = 36,
+    FIX41_OrderCancelReplaceRequest_SymbolSfx = 37,
+    FIX41_OrderCancelReplaceRequest_SecurityID = 38,
+    FIX41_OrderCancelReplaceRequest_IDSource = 39,
+    FIX41_OrderCancelReplaceRequest_SecurityType = 40,
+    FIX41_OrderCancelReplaceRequest_MaturityMonthYear = 41,
+    FIX41_OrderCancelReplaceRequest_MaturityDay = 42,
+    FIX41_OrderCancelReplaceRequest_PutOrCall = 43,
+    FIX41_OrderCancelReplaceRequest_StrikePrice = 44,
+    FIX41_OrderCancelReplaceRequest_OptAttribute = 45,
+    FIX41_OrderCancelReplaceRequest_SecurityExchange = 46,
+    FIX41_OrderCancelReplaceRequest_Issuer = 47,
+    FIX41_OrderCancelReplaceRequest_SecurityDesc = 48,
+    FIX41_OrderCancelReplaceRequest_Side = 49,
+    FIX41_OrderCancelReplaceRequest_OrderQty = 50,
+    FIX41_OrderCancelReplaceRequest_CashOrderQty = 51,
+    FIX41_OrderCancelReplaceRequest_OrdType = 52,
+    FIX41_OrderCancelReplaceRequest_Price = 53,
+    FIX41_OrderCancelReplaceRequest_StopPx = 54,
+    FIX41_OrderCancelReplaceRequest_PegDifference = 55,
+    FIX41_OrderCancelReplaceRequest_Currency = 56,
+    FIX41_OrderCancelReplaceRequest_TimeInForce = 57,
+    FIX41_OrderCancelReplaceRequest_ExpireTime = 58,
+    FIX41_OrderCancelReplaceRequest_Commission = 59,
+    FIX41_OrderCancelReplaceRequest_CommType = 60,
+    FIX41_OrderCancelReplaceRequest_Rule80A = 61,
+    FIX41_OrderCancelReplaceRequest_ForexReq = 62,
+    FIX41_OrderCancelReplaceRequest_SettlCurrency = 63,
+    FIX41_OrderCancelReplaceRequest_Text = 64,
+    FIX41_OrderCancelReplaceRequest_FutSettDate2 = 65,
+    FIX41_OrderCancelReplaceRequest_OrderQty2 = 66,
+    FIX41_OrderCancelReplaceRequest_OpenClose = 67,
+    FIX41_OrderCancelReplaceRequest_CoveredOrUncovered = 68,
+    FIX41_OrderCancelReplaceRequest_CustomerOrFirm = 69,
+    FIX41_OrderCancelReplaceRequest_MaxShow = 70,
+    FIX41_OrderCancelReplaceRequest_LocateReqd = 71,
+    FIX41_OrderCancelReplaceRequest_SignatureLength = 72,
+    FIX41_OrderCancelReplaceRequest_Signature = 73,
+    FIX41_OrderCancelReplaceRequest_CheckSum = 74,
+};
+
+typedef struct _fix41OrderCancelReplaceRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	HandlInst;
+    struct _ofixStrView	ExecInst;
+    int64_t	MinQty;
+    int64_t	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixStrView	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	PegDifference;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TimeInForce;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDecimal	Commission;
+    struct _ofixStrView	CommType;
+    struct _ofixStrView	Rule80A;
+    struct _ofixStrView	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    struct _ofixDate	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	OpenClose;
+    int64_t	CoveredOrUncovered;
+    int64_t	CustomerOrFirm;
+    int64_t	MaxShow;
+    struct _ofixStrView	LocateReqd;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41OrderCancelReplaceRequest;
+
+extern void	fix41_decode_OrderCancelReplaceRequest(ofixErr err, fix41OrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix41_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix41OrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_OrderCancelReplaceRequest(ofixErr err, fix41OrderCancelReplaceRequest m);
+
+// OrderStatusRequest [H]
+enum {
+    FIX41_OrderStatusRequest_BeginString = 0,
+    FIX41_OrderStatusRequest_BodyLength = 1,
+    FIX41_OrderStatusRequest_MsgType = 2,
+    FIX41_OrderStatusRequest_SenderCompID = 3,
+    FIX41_OrderStatusRequest_TargetCompID = 4,
+    FIX41_OrderStatusRequest_OnBehalfOfCompID = 5,
+    FIX41_OrderStatusRequest_DeliverToCompID = 6,
+    FIX41_OrderStatusRequest_SecureDataLen = 7,
+    FIX41_OrderStatusRequest_SecureData = 8,
+    FIX41_OrderStatusRequest_MsgSeqNum = 9,
+    FIX41_OrderStatusRequest_SenderSubID = 10,
+    FIX41_OrderStatusRequest_SenderLocationID = 11,
+    FIX41_OrderStatusRequest_TargetSubID = 12,
+    FIX41_OrderStatusRequest_TargetLocationID = 13,
+    FIX41_OrderStatusRequest_OnBehalfOfSubID = 14,
+    FIX41_OrderStatusRequest_OnBehalfOfLocationID = 15,
+    FIX41_OrderStatusRequest_DeliverToSubID = 16,
+    FIX41_OrderStatusRequest_DeliverToLocationID = 17,
+    FIX41_OrderStatusRequest_PossDupFlag = 18,
+    FIX41_OrderStatusRequest_PossResend = 19,
+    FIX41_OrderStatusRequest_SendingTime = 20,
+    FIX41_OrderStatusRequest_OrigSendingTime = 21,
+    FIX41_OrderStatusRequest_OrderID = 22,
+    FIX41_OrderStatusRequest_ClOrdID = 23,
+    FIX41_OrderStatusRequest_ClientID = 24,
+    FIX41_OrderStatusRequest_ExecBroker = 25,
+    FIX41_OrderStatusRequest_Symbol = 26,
+    FIX41_OrderStatusRequest_SymbolSfx = 27,
+    FIX41_OrderStatusRequest_SecurityID = 28,
+    FIX41_OrderStatusRequest_IDSource = 29,
+    FIX41_OrderStatusRequest_SecurityType = 30,
+    FIX41_OrderStatusRequest_MaturityMonthYear = 31,
+    FIX41_OrderStatusRequest_MaturityDay = 32,
+    FIX41_OrderStatusRequest_PutOrCall = 33,
+    FIX41_OrderStatusRequest_StrikePrice = 34,
+    FIX41_OrderStatusRequest_OptAttribute = 35,
+    FIX41_OrderStatusRequest_SecurityExchange = 36,
+    FIX41_OrderStatusRequest_Issuer = 37,
+    FIX41_OrderStatusRequest_SecurityDesc = 38,
+    FIX41_OrderStatusRequest_Side = 39,
+    FIX41_OrderStatusRequest_SignatureLength = 40,
+    FIX41_OrderStatusRequest_Signature = 41,
+    FIX41_OrderStatusRequest_CheckSum = 42,
+};
+
+typedef struct _fix41OrderStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41OrderStatusRequest;
+
+extern void	fix41_decode_OrderStatusRequest(ofixErr err, fix41OrderStatusRequest m, const char *raw, int len);
+extern void	fix41_decode_OrderStatusRequest_msg(ofixErr err, fix41OrderStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_OrderStatusRequest(ofixErr err, fix41OrderStatusRequest m);
+
+// Allocation [J]
+enum {
+    FIX41_Allocation_BeginString = 0,
+    FIX41_Allocation_BodyLength = 1,
+    FIX41_Allocation_MsgType = 2,
+    FIX41_Allocation_SenderCompID = 3,
+    FIX41_Allocation_TargetCompID = 4,
+    FIX41_Allocation_OnBehalfOfCompID = 5,
+    FIX41_Allocation_DeliverToCompID = 6,
+    FIX41_Allocation_SecureDataLen = 7,
+    FIX41_Allocation_SecureData = 8,
+    FIX41_Allocation_MsgSeqNum = 9,
+    FIX41_Allocation_SenderSubID = 10,
+    FIX41_Allocation_SenderLocationID = 11,
+    FIX41_Allocation_TargetSubID = 12,
+    FIX41_Allocation_TargetLocationID = 13,
+    FIX41_Allocation_OnBehalfOfSubID = 14,
+    FIX41_Allocation_OnBehalfOfLocationID = 15,
+    FIX41_Allocation_DeliverToSubID = 16,
+    FIX41_Allocation_DeliverToLocationID = 17,
+    FIX41_Allocation_PossDupFlag = 18,
+    FIX41_Allocation_PossResend = 19,
+    FIX41_Allocation_SendingTime = 20,
+    FIX41_Allocation_OrigSendingTime = 21,
+    FIX41_Allocation_AllocID = 22,
+    FIX41_Allocation_AllocTransType = 23,
+    FIX41_Allocation_RefAllocID = 24,
+    FIX41_Allocation_AllocLinkID = 25,
+    FIX41_Allocation_AllocLinkType = 26,
+    FIX41_Allocation_NoOrders = 27,
+    FIX41_Allocation_NoExecs = 28,
+    FIX41_Allocation_Side = 29,
+    FIX41_Allocation_Symbol = 30,
+    FIX41_Allocation_SymbolSfx = 31,
+    FIX41_Allocation_SecurityID = 32,
+    FIX41_Allocation_IDSource = 33,
+    FIX41_Allocation_SecurityType = 34,
+    FIX41_Allocation_MaturityMonthYear = 35,
+    FIX41_Allocation_MaturityDay = 36,
+    FIX41_Allocation_PutOrCall = 37,
+    FIX41_Allocation_StrikePrice = 38,
+    FIX41_Allocation_OptAttribute = 39,
+    FIX41_Allocation_SecurityExchange = 40,
+    FIX41_Allocation_Issuer = 41,
+    FIX41_Allocation_SecurityDesc = 42,
+    FIX41_Allocation_Shares = 43,
+    FIX41_Allocation_LastMkt = 44,
+    FIX41_Allocation_AvgPx = 45,
+    FIX41_Allocation_Currency = 46,
+    FIX41_Allocation_AvgPrxPrecision = 47,
+    FIX41_Allocation_TradeDate = 48,
+    FIX41_Allocation_TransactTime = 49,
+    FIX41_Allocation_SettlmntTyp = 50,
+    FIX41_Allocation_FutSettDate = 51,
+    FIX41_Allocation_NetMoney = 52,
+    FIX41_Allocation_OpenClose = 53,
+    FIX41_Allocation_Text = 54,
+    FIX41_Allocation_NumDaysInterest = 55,
+    FIX41_Allocation_AccruedInterestRate = 56,
+    FIX41_Allocation_NoAllocs = 57,
+    FIX41_Allocation_SignatureLength = 58,
+    FIX41_Allocation_Signature = 59,
+    FIX41_Allocation_CheckSum = 60,
+};
+
+typedef struct _fix41Allocation {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	AllocTransType;
+    struct _ofixStrView	RefAllocID;
+    struct _ofixStrView	AllocLinkID;
+    int64_t	AllocLinkType;
+    int64_t	NoOrders;
+    int64_t	NoExecs;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	Shares;
+    struct _ofixStrView	LastMkt;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixStrView	Currency;
+    int64_t	AvgPrxPrecision;
+    struct _ofixDate	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	SettlmntTyp;
+    struct _ofixDate	FutSettDate;
+    struct _ofixDecimal	NetMoney;
+    struct _ofixStrView	OpenClose;
+    struct _ofixStrView	Text;
+    int64_t	NumDaysInterest;
+    struct _ofixDecimal	AccruedInterestRate;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Allocation;
+
+extern void	fix41_decode_Allocation(ofixErr err, fix41Allocation m, const char *raw, int len);
+extern void	fix41_decode_Allocation_msg(ofixErr err, fix41Allocation m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Allocation(ofixErr err, fix41Allocation m);
+
+// ListCancelRequest [K]
+enum {
+    FIX41_ListCancelRequest_BeginString = 0,
+    FIX41_ListCancelRequest_BodyLength = 1,
+    FIX41_ListCancelRequest_MsgType = 2,
+    FIX41_ListCancelRequest_SenderCompID = 3,
+    FIX41_ListCancelRequest_TargetCompID = 4,
+    FIX41_ListCancelRequest_OnBehalfOfCompID = 5,
+    FIX41_ListCancelRequest_DeliverToCompID = 6,
+    FIX41_ListCancelRequest_SecureDataLen = 7,
+    FIX41_ListCancelRequest_SecureData = 8,
+    FIX41_ListCancelRequest_MsgSeqNum = 9,
+    FIX41_ListCancelRequest_SenderSubID = 10,
+    FIX41_ListCancelRequest_SenderLocationID = 11,
+    FIX41_ListCancelRequest_TargetSubID = 12,
+    FIX41_ListCancelRequest_TargetLocationID = 13,
+    FIX41_ListCancelRequest_OnBehalfOfSubID = 14,
+    FIX41_ListCancelRequest_OnBehalfOfLocationID = 15,
+    FIX41_ListCancelRequest_DeliverToSubID = 16,
+    FIX41_ListCancelRequest_DeliverToLocationID = 17,
+    FIX41_ListCancelRequest_PossDupFlag = 18,
+    FIX41_ListCancelRequest_PossResend = 19,
+    FIX41_ListCancelRequest_SendingTime = 20,
+    FIX41_ListCancelRequest_OrigSendingTime = 21,
+    FIX41_ListCancelRequest_ListID = 22,
+    FIX41_ListCancelRequest_WaveNo = 23,
+    FIX41_ListCancelRequest_Text = 24,
+    FIX41_ListCancelRequest_SignatureLength = 25,
+    FIX41_ListCancelRequest_Signature = 26,
+    FIX41_ListCancelRequest_CheckSum = 27,
+};
+
+typedef struct _fix41ListCancelRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41ListCancelRequest;
+
+extern void	fix41_decode_ListCancelRequest(ofixErr err, fix41ListCancelRequest m, const char *raw, int len);
+extern void	fix41_decode_ListCancelRequest_msg(ofixErr err, fix41ListCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_ListCancelRequest(ofixErr err, fix41ListCancelRequest m);
+
+// ListExecute [L]
+enum {
+    FIX41_ListExecute_BeginString = 0,
+    FIX41_ListExecute_BodyLength = 1,
+    FIX41_ListExecute_MsgType = 2,
+    FIX41_ListExecute_SenderCompID = 3,
+    FIX41_ListExecute_TargetCompID = 4,
+    FIX41_ListExecute_OnBehalfOfCompID = 5,
+    FIX41_ListExecute_DeliverToCompID = 6,
+    FIX41_ListExecute_SecureDataLen = 7,
+    FIX41_ListExecute_SecureData = 8,
+    FIX41_ListExecute_MsgSeqNum = 9,
+    FIX41_ListExecute_SenderSubID = 10,
+    FIX41_ListExecute_SenderLocationID = 11,
+    FIX41_ListExecute_TargetSubID = 12,
+    FIX41_ListExecute_TargetLocationID = 13,
+    FIX41_ListExecute_OnBehalfOfSubID = 14,
+    FIX41_ListExecute_OnBehalfOfLocationID = 15,
+    FIX41_ListExecute_DeliverToSubID = 16,
+    FIX41_ListExecute_DeliverToLocationID = 17,
+    FIX41_ListExecute_PossDupFlag = 18,
+    FIX41_ListExecute_PossResend = 19,
+    FIX41_ListExecute_SendingTime = 20,
+    FIX41_ListExecute_OrigSendingTime = 21,
+    FIX41_ListExecute_ListID = 22,
+    FIX41_ListExecute_WaveNo = 23,
+    FIX41_ListExecute_Text = 24,
+    FIX41_ListExecute_SignatureLength = 25,
+    FIX41_ListExecute_Signature = 26,
+    FIX41_ListExecute_CheckSum = 27,
+};
+
+typedef struct _fix41ListExecute {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41ListExecute;
+
+extern void	fix41_decode_ListExecute(ofixErr err, fix41ListExecute m, const char *raw, int len);
+extern void	fix41_decode_ListExecute_msg(ofixErr err, fix41ListExecute m, ofixMsg msg);
+extern ofixMsg	fix41_encode_ListExecute(ofixErr err, fix41ListExecute m);
+
+// ListStatusRequest [M]
+enum {
+    FIX41_ListStatusRequest_BeginString = 0,
+    FIX41_ListStatusRequest_BodyLength = 1,
+    FIX41_ListStatusRequest_MsgType = 2,
+    FIX41_ListStatusRequest_SenderCompID = 3,
+    FIX41_ListStatusRequest_TargetCompID = 4,
+    FIX41_ListStatusRequest_OnBehalfOfCompID = 5,
+    FIX41_ListStatusRequest_DeliverToCompID = 6,
+    FIX41_ListStatusRequest_SecureDataLen = 7,
+    FIX41_ListStatusRequest_SecureData = 8,
+    FIX41_ListStatusRequest_MsgSeqNum = 9,
+    FIX41_ListStatusRequest_SenderSubID = 10,
+    FIX41_ListStatusRequest_SenderLocationID = 11,
+    FIX41_ListStatusRequest_TargetSubID = 12,
+    FIX41_ListStatusRequest_TargetLocationID = 13,
+    FIX41_ListStatusRequest_OnBehalfOfSubID = 14,
+    FIX41_ListStatusRequest_OnBehalfOfLocationID = 15,
+    FIX41_ListStatusRequest_DeliverToSubID = 16,
+    FIX41_ListStatusRequest_DeliverToLocationID = 17,
+    FIX41_ListStatusRequest_PossDupFlag = 18,
+    FIX41_ListStatusRequest_PossResend = 19,
+    FIX41_ListStatusRequest_SendingTime = 20,
+    FIX41_ListStatusRequest_OrigSendingTime = 21,
+    FIX41_ListStatusRequest_ListID = 22,
+    FIX41_ListStatusRequest_WaveNo = 23,
+    FIX41_ListStatusRequest_Text = 24,
+    FIX41_ListStatusRequest_SignatureLength = 25,
+    FIX41_ListStatusRequest_Signature = 26,
+    FIX41_ListStatusRequest_CheckSum = 27,
+};
+
+typedef struct _fix41ListStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41ListStatusRequest;
+
+extern void	fix41_decode_ListStatusRequest(ofixErr err, fix41ListStatusRequest m, const char *raw, int len);
+extern void	fix41_decode_ListStatusRequest_msg(ofixErr err, fix41ListStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_ListStatusRequest(ofixErr err, fix41ListStatusRequest m);
+
+// ListStatus [N]
+enum {
+    FIX41_ListStatus_BeginString = 0,
+    FIX41_ListStatus_BodyLength = 1,
+    FIX41_ListStatus_MsgType = 2,
+    FIX41_ListStatus_SenderCompID = 3,
+    FIX41_ListStatus_TargetCompID = 4,
+    FIX41_ListStatus_OnBehalfOfCompID = 5,
+    FIX41_ListStatus_DeliverToCompID = 6,
+    FIX41_ListStatus_SecureDataLen = 7,
+    FIX41_ListStatus_SecureData = 8,
+    FIX41_ListStatus_MsgSeqNum = 9,
+    FIX41_ListStatus_SenderSubID = 10,
+    FIX41_ListStatus_SenderLocationID = 11,
+    FIX41_ListStatus_TargetSubID = 12,
+    FIX41_ListStatus_TargetLocationID = 13,
+    FIX41_ListStatus_OnBehalfOfSubID = 14,
+    FIX41_ListStatus_OnBehalfOfLocationID = 15,
+    FIX41_ListStatus_DeliverToSubID = 16,
+    FIX41_ListStatus_DeliverToLocationID = 17,
+    FIX41_ListStatus_PossDupFlag = 18,
+    FIX41_ListStatus_PossResend = 19,
+    FIX41_ListStatus_SendingTime = 20,
+    FIX41_ListStatus_OrigSendingTime = 21,
+    FIX41_ListStatus_ListID = 22,
+    FIX41_ListStatus_WaveNo = 23,
+    FIX41_ListStatus_NoRpts = 24,
+    FIX41_ListStatus_RptSeq = 25,
+    FIX41_ListStatus_NoOrders = 26,
+    FIX41_ListStatus_SignatureLength = 27,
+    FIX41_ListStatus_Signature = 28,
+    FIX41_ListStatus_CheckSum = 29,
+};
+
+typedef struct _fix41ListStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	WaveNo;
+    int64_t	NoRpts;
+    int64_t	RptSeq;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41ListStatus;
+
+extern void	fix41_decode_ListStatus(ofixErr err, fix41ListStatus m, const char *raw, int len);
+extern void	fix41_decode_ListStatus_msg(ofixErr err, fix41ListStatus m, ofixMsg msg);
+extern ofixMsg	fix41_encode_ListStatus(ofixErr err, fix41ListStatus m);
+
+// AllocationACK [P]
+enum {
+    FIX41_AllocationACK_BeginString = 0,
+    FIX41_AllocationACK_BodyLength = 1,
+    FIX41_AllocationACK_MsgType = 2,
+    FIX41_AllocationACK_SenderCompID = 3,
+    FIX41_AllocationACK_TargetCompID = 4,
+    FIX41_AllocationACK_OnBehalfOfCompID = 5,
+    FIX41_AllocationACK_DeliverToCompID = 6,
+    FIX41_AllocationACK_SecureDataLen = 7,
+    FIX41_AllocationACK_SecureData = 8,
+    FIX41_AllocationACK_MsgSeqNum = 9,
+    FIX41_AllocationACK_SenderSubID = 10,
+    FIX41_AllocationACK_SenderLocationID = 11,
+    FIX41_AllocationACK_TargetSubID = 12,
+    FIX41_AllocationACK_TargetLocationID = 13,
+    FIX41_AllocationACK_OnBehalfOfSubID = 14,
+    FIX41_AllocationACK_OnBehalfOfLocationID = 15,
+    FIX41_AllocationACK_DeliverToSubID = 16,
+    FIX41_AllocationACK_DeliverToLocationID = 17,
+    FIX41_AllocationACK_PossDupFlag = 18,
+    FIX41_AllocationACK_PossResend = 19,
+    FIX41_AllocationACK_SendingTime = 20,
+    FIX41_AllocationACK_OrigSendingTime = 21,
+    FIX41_AllocationACK_ClientID = 22,
+    FIX41_AllocationACK_ExecBroker = 23,
+    FIX41_AllocationACK_AllocID = 24,
+    FIX41_AllocationACK_TradeDate = 25,
+    FIX41_AllocationACK_TransactTime = 26,
+    FIX41_AllocationACK_AllocStatus = 27,
+    FIX41_AllocationACK_AllocRejCode = 28,
+    FIX41_AllocationACK_Text = 29,
+    FIX41_AllocationACK_SignatureLength = 30,
+    FIX41_AllocationACK_Signature = 31,
+    FIX41_AllocationACK_CheckSum = 32,
+};
+
+typedef struct _fix41AllocationACK {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	AllocID;
+    struct _ofixDate	TradeDate;
+    struct _ofixDate	TransactTime;
+    int64_t	AllocStatus;
+    int64_t	AllocRejCode;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41AllocationACK;
+
+extern void	fix41_decode_AllocationACK(ofixErr err, fix41AllocationACK m, const char *raw, int len);
+extern void	fix41_decode_AllocationACK_msg(ofixErr err, fix41AllocationACK m, ofixMsg msg);
+extern ofixMsg	fix41_encode_AllocationACK(ofixErr err, fix41AllocationACK m);
+
+// DontKnowTrade [Q]
+enum {
+    FIX41_DontKnowTrade_BeginString = 0,
+    FIX41_DontKnowTrade_BodyLength = 1,
+    FIX41_DontKnowTrade_MsgType = 2,
+    FIX41_DontKnowTrade_SenderCompID = 3,
+    FIX41_DontKnowTrade_TargetCompID = 4,
+    FIX41_DontKnowTrade_OnBehalfOfCompID = 5,
+    FIX41_DontKnowTrade_DeliverToCompID = 6,
+    FIX41_DontKnowTrade_SecureDataLen = 7,
+    FIX41_DontKnowTrade_SecureData = 8,
+    FIX41_DontKnowTrade_MsgSeqNum = 9,
+    FIX41_DontKnowTrade_SenderSubID = 10,
+    FIX41_DontKnowTrade_SenderLocationID = 11,
+    FIX41_DontKnowTrade_TargetSubID = 12,
+    FIX41_DontKnowTrade_TargetLocationID = 13,
+    FIX41_DontKnowTrade_OnBehalfOfSubID = 14,
+    FIX41_DontKnowTrade_OnBehalfOfLocationID = 15,
+    FIX41_DontKnowTrade_DeliverToSubID = 16,
+    FIX41_DontKnowTrade_DeliverToLocationID = 17,
+    FIX41_DontKnowTrade_PossDupFlag = 18,
+    FIX41_DontKnowTrade_PossResend = 19,
+    FIX41_DontKnowTrade_SendingTime = 20,
+    FIX41_DontKnowTrade_OrigSendingTime = 21,
+    FIX41_DontKnowTrade_OrderID = 22,
+    FIX41_DontKnowTrade_ExecID = 23,
+    FIX41_DontKnowTrade_DKReason = 24,
+    FIX41_DontKnowTrade_Symbol = 25,
+    FIX41_DontKnowTrade_SymbolSfx = 26,
+    FIX41_DontKnowTrade_SecurityID = 27,
+    FIX41_DontKnowTrade_IDSource = 28,
+    FIX41_DontKnowTrade_SecurityType = 29,
+    FIX41_DontKnowTrade_MaturityMonthYear = 30,
+    FIX41_DontKnowTrade_MaturityDay = 31,
+    FIX41_DontKnowTrade_PutOrCall = 32,
+    FIX41_DontKnowTrade_StrikePrice = 33,
+    FIX41_DontKnowTrade_OptAttribute = 34,
+    FIX41_DontKnowTrade_SecurityExchange = 35,
+    FIX41_DontKnowTrade_Issuer = 36,
+    FIX41_DontKnowTrade_SecurityDesc = 37,
+    FIX41_DontKnowTrade_Side = 38,
+    FIX41_DontKnowTrade_OrderQty = 39,
+    FIX41_DontKnowTrade_CashOrderQty = 40,
+    FIX41_DontKnowTrade_LastShares = 41,
+    FIX41_DontKnowTrade_LastPx = 42,
+    FIX41_DontKnowTrade_Text = 43,
+    FIX41_DontKnowTrade_SignatureLength = 44,
+    FIX41_DontKnowTrade_Signature = 45,
+    FIX41_DontKnowTrade_CheckSum = 46,
+};
+
+typedef struct _fix41DontKnowTrade {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ExecID;
+    struct _ofixStrView	DKReason;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    int64_t	LastShares;
+    struct _ofixDecimal	LastPx;
+    struct _ofixStrView	Text;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41DontKnowTrade;
+
+extern void	fix41_decode_DontKnowTrade(ofixErr err, fix41DontKnowTrade m, const char *raw, int len);
+extern void	fix41_decode_DontKnowTrade_msg(ofixErr err, fix41DontKnowTrade m, ofixMsg msg);
+extern ofixMsg	fix41_encode_DontKnowTrade(ofixErr err, fix41DontKnowTrade m);
+
+// QuoteRequest [R]
+enum {
+    FIX41_QuoteRequest_BeginString = 0,
+    FIX41_QuoteRequest_BodyLength = 1,
+    FIX41_QuoteRequest_MsgType = 2,
+    FIX41_QuoteRequest_SenderCompID = 3,
+    FIX41_QuoteRequest_TargetCompID = 4,
+    FIX41_QuoteRequest_OnBehalfOfCompID = 5,
+    FIX41_QuoteRequest_DeliverToCompID = 6,
+    FIX41_QuoteRequest_SecureDataLen = 7,
+    FIX41_QuoteRequest_SecureData = 8,
+    FIX41_QuoteRequest_MsgSeqNum = 9,
+    FIX41_QuoteRequest_SenderSubID = 10,
+    FIX41_QuoteRequest_SenderLocationID = 11,
+    FIX41_QuoteRequest_TargetSubID = 12,
+    FIX41_QuoteRequest_TargetLocationID = 13,
+    FIX41_QuoteRequest_OnBehalfOfSubID = 14,
+    FIX41_QuoteRequest_OnBehalfOfLocationID = 15,
+    FIX41_QuoteRequest_DeliverToSubID = 16,
+    FIX41_QuoteRequest_DeliverToLocationID = 17,
+    FIX41_QuoteRequest_PossDupFlag = 18,
+    FIX41_QuoteRequest_PossResend = 19,
+    FIX41_QuoteRequest_SendingTime = 20,
+    FIX41_QuoteRequest_OrigSendingTime = 21,
+    FIX41_QuoteRequest_QuoteReqID = 22,
+    FIX41_QuoteRequest_Symbol = 23,
+    FIX41_QuoteRequest_SymbolSfx = 24,
+    FIX41_QuoteRequest_SecurityID = 25,
+    FIX41_QuoteRequest_IDSource = 26,
+    FIX41_QuoteRequest_SecurityType = 27,
+    FIX41_QuoteRequest_MaturityMonthYear = 28,
+    FIX41_QuoteRequest_MaturityDay = 29,
+    FIX41_QuoteRequest_PutOrCall = 30,
+    FIX41_QuoteRequest_StrikePrice = 31,
+    FIX41_QuoteRequest_OptAttribute = 32,
+    FIX41_QuoteRequest_SecurityExchange = 33,
+    FIX41_QuoteRequest_Issuer = 34,
+    FIX41_QuoteRequest_SecurityDesc = 35,
+    FIX41_QuoteRequest_PrevClosePx = 36,
+    FIX41_QuoteRequest_Side = 37,
+    FIX41_QuoteRequest_OrderQty = 38,
+    FIX41_QuoteRequest_FutSettDate = 39,
+    FIX41_QuoteRequest_OrdType = 40,
+    FIX41_QuoteRequest_FutSettDate2 = 41,
+    FIX41_QuoteRequest_OrderQty2 = 42,
+    FIX41_QuoteRequest_SignatureLength = 43,
+    FIX41_QuoteRequest_Signature = 44,
+    FIX41_QuoteRequest_CheckSum = 45,
+};
+
+typedef struct _fix41QuoteRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    struct _ofixStrView	Side;
+    int64_t	OrderQty;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	OrdType;
+    struct _ofixDate	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41QuoteRequest;
+
+extern void	fix41_decode_QuoteRequest(ofixErr err, fix41QuoteRequest m, const char *raw, int len);
+extern void	fix41_decode_QuoteRequest_msg(ofixErr err, fix41QuoteRequest m, ofixMsg msg);
+extern ofixMsg	fix41_encode_QuoteRequest(ofixErr err, fix41QuoteRequest m);
+
+// Quote [S]
+enum {
+    FIX41_Quote_BeginString = 0,
+    FIX41_Quote_BodyLength = 1,
+    FIX41_Quote_MsgType = 2,
+    FIX41_Quote_SenderCompID = 3,
+    FIX41_Quote_TargetCompID = 4,
+    FIX41_Quote_OnBehalfOfCompID = 5,
+    FIX41_Quote_DeliverToCompID = 6,
+    FIX41_Quote_SecureDataLen = 7,
+    FIX41_Quote_SecureData = 8,
+    FIX41_Quote_MsgSeqNum = 9,
+    FIX41_Quote_SenderSubID = 10,
+    FIX41_Quote_SenderLocationID = 11,
+    FIX41_Quote_TargetSubID = 12,
+    FIX41_Quote_TargetLocationID = 13,
+    FIX41_Quote_OnBehalfOfSubID = 14,
+    FIX41_Quote_OnBehalfOfLocationID = 15,
+    FIX41_Quote_DeliverToSubID = 16,
+    FIX41_Quote_DeliverToLocationID = 17,
+    FIX41_Quote_PossDupFlag = 18,
+    FIX41_Quote_PossResend = 19,
+    FIX41_Quote_SendingTime = 20,
+    FIX41_Quote_OrigSendingTime = 21,
+    FIX41_Quote_QuoteReqID = 22,
+    FIX41_Quote_QuoteID = 23,
+    FIX41_Quote_Symbol = 24,
+    FIX41_Quote_SymbolSfx = 25,
+    FIX41_Quote_SecurityID = 26,
+    FIX41_Quote_IDSource = 27,
+    FIX41_Quote_SecurityType = 28,
+    FIX41_Quote_MaturityMonthYear = 29,
+    FIX41_Quote_MaturityDay = 30,
+    FIX41_Quote_PutOrCall = 31,
+    FIX41_Quote_StrikePrice = 32,
+    FIX41_Quote_OptAttribute = 33,
+    FIX41_Quote_SecurityExchange = 34,
+    FIX41_Quote_Issuer = 35,
+    FIX41_Quote_SecurityDesc = 36,
+    FIX41_Quote_BidPx = 37,
+    FIX41_Quote_OfferPx = 38,
+    FIX41_Quote_BidSize = 39,
+    FIX41_Quote_OfferSize = 40,
+    FIX41_Quote_ValidUntilTime = 41,
+    FIX41_Quote_BidSpotRate = 42,
+    FIX41_Quote_OfferSpotRate = 43,
+    FIX41_Quote_BidForwardPoints = 44,
+    FIX41_Quote_OfferForwardPoints = 45,
+    FIX41_Quote_TransactTime = 46,
+    FIX41_Quote_FutSettDate = 47,
+    FIX41_Quote_OrdType = 48,
+    FIX41_Quote_FutSettDate2 = 49,
+    FIX41_Quote_OrderQty2 = 50,
+    FIX41_Quote_SignatureLength = 51,
+    FIX41_Quote_Signature = 52,
+    FIX41_Quote_CheckSum = 53,
+};
+
+typedef struct _fix41Quote {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	OptAttribute;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    struct _ofixStrView	SecurityDesc;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    int64_t	BidSize;
+    int64_t	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixDecimal	BidSpotRate;
+    struct _ofixDecimal	OfferSpotRate;
+    struct _ofixDecimal	BidForwardPoints;
+    struct _ofixDecimal	OfferForwardPoints;
+    struct _ofixDate	TransactTime;
+    struct _ofixDate	FutSettDate;
+    struct _ofixStrView	OrdType;
+    struct _ofixDate	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41Quote;
+
+extern void	fix41_decode_Quote(ofixErr err, fix41Quote m, const char *raw, int len);
+extern void	fix41_decode_Quote_msg(ofixErr err, fix41Quote m, ofixMsg msg);
+extern ofixMsg	fix41_encode_Quote(ofixErr err, fix41Quote m);
+
+// SettlementInstructions [T]
+enum {
+    FIX41_SettlementInstructions_BeginString = 0,
+    FIX41_SettlementInstructions_BodyLength = 1,
+    FIX41_SettlementInstructions_MsgType = 2,
+    FIX41_SettlementInstructions_SenderCompID = 3,
+    FIX41_SettlementInstructions_TargetCompID = 4,
+    FIX41_SettlementInstructions_OnBehalfOfCompID = 5,
+    FIX41_SettlementInstructions_DeliverToCompID = 6,
+    FIX41_SettlementInstructions_SecureDataLen = 7,
+    FIX41_SettlementInstructions_SecureData = 8,
+    FIX41_SettlementInstructions_MsgSeqNum = 9,
+    FIX41_SettlementInstructions_SenderSubID = 10,
+    FIX41_SettlementInstructions_SenderLocationID = 11,
+    FIX41_SettlementInstructions_TargetSubID = 12,
+    FIX41_SettlementInstructions_TargetLocationID = 13,
+    FIX41_SettlementInstructions_OnBehalfOfSubID = 14,
+    FIX41_SettlementInstructions_OnBehalfOfLocationID = 15,
+    FIX41_SettlementInstructions_DeliverToSubID = 16,
+    FIX41_SettlementInstructions_DeliverToLocationID = 17,
+    FIX41_SettlementInstructions_PossDupFlag = 18,
+    FIX41_SettlementInstructions_PossResend = 19,
+    FIX41_SettlementInstructions_SendingTime = 20,
+    FIX41_SettlementInstructions_OrigSendingTime = 21,
+    FIX41_SettlementInstructions_SettlInstID = 22,
+    FIX41_SettlementInstructions_SettlInstTransType = 23,
+    FIX41_SettlementInstructions_SettlInstMode = 24,
+    FIX41_SettlementInstructions_SettlInstSource = 25,
+    FIX41_SettlementInstructions_AllocAccount = 26,
+    FIX41_SettlementInstructions_SettlLocation = 27,
+    FIX41_SettlementInstructions_TradeDate = 28,
+    FIX41_SettlementInstructions_AllocID = 29,
+    FIX41_SettlementInstructions_LastMkt = 30,
+    FIX41_SettlementInstructions_Side = 31,
+    FIX41_SettlementInstructions_SecurityType = 32,
+    FIX41_SettlementInstructions_EffectiveTime = 33,
+    FIX41_SettlementInstructions_TransactTime = 34,
+    FIX41_SettlementInstructions_ClientID = 35,
+    FIX41_SettlementInstructions_ExecBroker = 36,
+    FIX41_SettlementInstructions_StandInstDbType = 37,
+    FIX41_SettlementInstructions_StandInstDbName = 38,
+    FIX41_SettlementInstructions_StandInstDbID = 39,
+    FIX41_SettlementInstructions_SettlDeliveryType = 40,
+    FIX41_SettlementInstructions_SettlDepositoryCode = 41,
+    FIX41_SettlementInstructions_SettlBrkrCode = 42,
+    FIX41_SettlementInstructions_SettlInstCode = 43,
+    FIX41_SettlementInstructions_SecuritySettlAgentName = 44,
+    FIX41_SettlementInstructions_SecuritySettlAgentCode = 45,
+    FIX41_SettlementInstructions_SecuritySettlAgentAcctNum = 46,
+    FIX41_SettlementInstructions_SecuritySettlAgentAcctName = 47,
+    FIX41_SettlementInstructions_SecuritySettlAgentContactName = 48,
+    FIX41_SettlementInstructions_SecuritySettlAgentContactPhone = 49,
+    FIX41_SettlementInstructions_CashSettlAgentName = 50,
+    FIX41_SettlementInstructions_CashSettlAgentCode = 51,
+    FIX41_SettlementInstructions_CashSettlAgentAcctNum = 52,
+    FIX41_SettlementInstructions_CashSettlAgentAcctName = 53,
+    FIX41_SettlementInstructions_CashSettlAgentContactName = 54,
+    FIX41_SettlementInstructions_CashSettlAgentContactPhone = 55,
+    FIX41_SettlementInstructions_SignatureLength = 56,
+    FIX41_SettlementInstructions_Signature = 57,
+    FIX41_SettlementInstructions_CheckSum = 58,
+};
+
+typedef struct _fix41SettlementInstructions {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    struct _ofixStrView	PossDupFlag;
+    struct _ofixStrView	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    struct _ofixStrView	SettlInstID;
+    struct _ofixStrView	SettlInstTransType;
+    struct _ofixStrView	SettlInstMode;
+    struct _ofixStrView	SettlInstSource;
+    struct _ofixStrView	AllocAccount;
+    struct _ofixStrView	SettlLocation;
+    struct _ofixDate	TradeDate;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	Side;
+    struct _ofixStrView	SecurityType;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	SettlDeliveryType;
+    struct _ofixStrView	SettlDepositoryCode;
+    struct _ofixStrView	SettlBrkrCode;
+    struct _ofixStrView	SettlInstCode;
+    struct _ofixStrView	SecuritySettlAgentName;
+    struct _ofixStrView	SecuritySettlAgentCode;
+    struct _ofixStrView	SecuritySettlAgentAcctNum;
+    struct _ofixStrView	SecuritySettlAgentAcctName;
+    struct _ofixStrView	SecuritySettlAgentContactName;
+    struct _ofixStrView	SecuritySettlAgentContactPhone;
+    struct _ofixStrView	CashSettlAgentName;
+    struct _ofixStrView	CashSettlAgentCode;
+    struct _ofixStrView	CashSettlAgentAcctNum;
+    struct _ofixStrView	CashSettlAgentAcctName;
+    struct _ofixStrView	CashSettlAgentContactName;
+    struct _ofixStrView	CashSettlAgentContactPhone;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix41SettlementInstructions;
+
+extern void	fix41_decode_SettlementInstructions(ofixErr err, fix41SettlementInstructions m, const char *raw, int len);
+extern void	fix41_decode_SettlementInstructions_msg(ofixErr err, fix41SettlementInstructions m, ofixMsg msg);
+extern ofixMsg	fix41_encode_SettlementInstructions(ofixErr err, fix41SettlementInstructions m);
+
+#endif /* __OFIX_FIX41MSGS_H__ */
@@ -0,0 +1,5096 @@
+
+// This file is auto-generated from ref/FIX42.xml and should not be modified.
+
+#ifndef __OFIX_FIX42MSGS_H__
+#define __OFIX_FIX42MSGS_H__
+
+#include <stdint.h>
+
+#include "ofix/err.h"
+#include "ofix/msg.h"
+#include "ofix/date.h"
+#include "ofix/typed.h"
+
+// Heartbeat [0]
+enum {
+    FIX42_Heartbeat_BeginString = 0,
+    FIX42_Heartbeat_BodyLength = 1,
+    FIX42_Heartbeat_MsgType = 2,
+    FIX42_Heartbeat_SenderCompID = 3,
+    FIX42_Heartbeat_TargetCompID = 4,
+    FIX42_Heartbeat_OnBehalfOfCompID = 5,
+    FIX42_Heartbeat_DeliverToCompID = 6,
+    FIX42_Heartbeat_SecureDataLen = 7,
+    FIX42_Heartbeat_SecureData = 8,
+    FIX42_Heartbeat_MsgSeqNum = 9,
+    FIX42_Heartbeat_SenderSubID = 10,
+    FIX42_Heartbeat_SenderLocationID = 11,
+    FIX42_Heartbeat_TargetSubID = 12,
+    FIX42_Heartbeat_TargetLocationID = 13,
+    FIX42_Heartbeat_OnBehalfOfSubID = 14,
+    FIX42_Heartbeat_OnBehalfOfLocationID = 15,
+    FIX42_Heartbeat_DeliverToSubID = 16,
+    FIX42_Heartbeat_DeliverToLocationID = 17,
+    FIX42_Heartbeat_PossDupFlag = 18,
+    FIX42_Heartbeat_PossResend = 19,
+    FIX42_Heartbeat_SendingTime = 20,
+    FIX42_Heartbeat_OrigSendingTime = 21,
+    FIX42_Heartbeat_XmlDataLen = 22,
+    FIX42_Heartbeat_XmlData = 23,
+    FIX42_Heartbeat_MessageEncoding = 24,
+    FIX42_Heartbeat_LastMsgSeqNumProcessed = 25,
+    FIX42_Heartbeat_OnBehalfOfSendingTime = 26,
+    FIX42_Heartbeat_TestReqID = 27,
+    FIX42_Heartbeat_SignatureLength = 28,
+    FIX42_Heartbeat_Signature = 29,
+    FIX42_Heartbeat_CheckSum = 30,
+};
+
+typedef struct _fix42Heartbeat {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Heartbeat;
+
+extern void	fix42_decode_Heartbeat(ofixErr err, fix42Heartbeat m, const char *raw, int len);
+extern void	fix42_decode_Heartbeat_msg(ofixErr err, fix42Heartbeat m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Heartbeat(ofixErr err, fix42Heartbeat m);
+
+// TestRequest [1]
+enum {
+    FIX42_TestRequest_BeginString = 0,
+    FIX42_TestRequest_BodyLength = 1,
+    FIX42_TestRequest_MsgType = 2,
+    FIX42_TestRequest_SenderCompID = 3,
+    FIX42_TestRequest_TargetCompID = 4,
+    FIX42_TestRequest_OnBehalfOfCompID = 5,
+    FIX42_TestRequest_DeliverToCompID = 6,
+    FIX42_TestRequest_SecureDataLen = 7,
+    FIX42_TestRequest_SecureData = 8,
+    FIX42_TestRequest_MsgSeqNum = 9,
+    FIX42_TestRequest_SenderSubID = 10,
+    FIX42_TestRequest_SenderLocationID = 11,
+    FIX42_TestRequest_TargetSubID = 12,
+    FIX42_TestRequest_TargetLocationID = 13,
+    FIX42_TestRequest_OnBehalfOfSubID = 14,
+    FIX42_TestRequest_OnBehalfOfLocationID = 15,
+    FIX42_TestRequest_DeliverToSubID = 16,
+    FIX42_TestRequest_DeliverToLocationID = 17,
+    FIX42_TestRequest_PossDupFlag = 18,
+    FIX42_TestRequest_PossResend = 19,
+    FIX42_TestRequest_SendingTime = 20,
+    FIX42_TestRequest_OrigSendingTime = 21,
+    FIX42_TestRequest_XmlDataLen = 22,
+    FIX42_TestRequest_XmlData = 23,
+    FIX42_TestRequest_MessageEncoding = 24,
+    FIX42_TestRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_TestRequest_OnBehalfOfSendingTime = 26,
+    FIX42_TestRequest_TestReqID = 27,
+    FIX42_TestRequest_SignatureLength = 28,
+    FIX42_TestRequest_Signature = 29,
+    FIX42_TestRequest_CheckSum = 30,
+};
+
+typedef struct _fix42TestRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42TestRequest;
+
+extern void	fix42_decode_TestRequest(ofixErr err, fix42TestRequest m, const char *raw, int len);
+extern void	fix42_decode_TestRequest_msg(ofixErr err, fix42TestRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_TestRequest(ofixErr err, fix42TestRequest m);
+
+// ResendRequest [2]
+enum {
+    FIX42_ResendRequest_BeginString = 0,
+    FIX42_ResendRequest_BodyLength = 1,
+    FIX42_ResendRequest_MsgType = 2,
+    FIX42_ResendRequest_SenderCompID = 3,
+    FIX42_ResendRequest_TargetCompID = 4,
+    FIX42_ResendRequest_OnBehalfOfCompID = 5,
+    FIX42_ResendRequest_DeliverToCompID = 6,
+    FIX42_ResendRequest_SecureDataLen = 7,
+    FIX42_ResendRequest_SecureData = 8,
+    FIX42_ResendRequest_MsgSeqNum = 9,
+    FIX42_ResendRequest_SenderSubID = 10,
+    FIX42_ResendRequest_SenderLocationID = 11,
+    FIX42_ResendRequest_TargetSubID = 12,
+    FIX42_ResendRequest_TargetLocationID = 13,
+    FIX42_ResendRequest_OnBehalfOfSubID = 14,
+    FIX42_ResendRequest_OnBehalfOfLocationID = 15,
+    FIX42_ResendRequest_DeliverToSubID = 16,
+    FIX42_ResendRequest_DeliverToLocationID = 17,
+    FIX42_ResendRequest_PossDupFlag = 18,
+    FIX42_ResendRequest_PossResend = 19,
+    FIX42_ResendRequest_SendingTime = 20,
+    FIX42_ResendRequest_OrigSendingTime = 21,
+    FIX42_ResendRequest_XmlDataLen = 22,
+    FIX42_ResendRequest_XmlData = 23,
+    FIX42_ResendRequest_MessageEncoding = 24,
+    FIX42_ResendRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_ResendRequest_OnBehalfOfSendingTime = 26,
+    FIX42_ResendRequest_BeginSeqNo = 27,
+    FIX42_ResendRequest_EndSeqNo = 28,
+    FIX42_ResendRequest_SignatureLength = 29,
+    FIX42_ResendRequest_Signature = 30,
+    FIX42_ResendRequest_CheckSum = 31,
+};
+
+typedef struct _fix42ResendRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	BeginSeqNo;
+    int64_t	EndSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42ResendRequest;
+
+extern void	fix42_decode_ResendRequest(ofixErr err, fix42ResendRequest m, const char *raw, int len);
+extern void	fix42_decode_ResendRequest_msg(ofixErr err, fix42ResendRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_ResendRequest(ofixErr err, fix42ResendRequest m);
+
+// Reject [3]
+enum {
+    FIX42_Reject_BeginString = 0,
+    FIX42_Reject_BodyLength = 1,
+    FIX42_Reject_MsgType = 2,
+    FIX42_Reject_SenderCompID = 3,
+    FIX42_Reject_TargetCompID = 4,
+    FIX42_Reject_OnBehalfOfCompID = 5,
+    FIX42_Reject_DeliverToCompID = 6,
+    FIX42_Reject_SecureDataLen = 7,
+    FIX42_Reject_SecureData = 8,
+    FIX42_Reject_MsgSeqNum = 9,
+    FIX42_Reject_SenderSubID = 10,
+    FIX42_Reject_SenderLocationID = 11,
+    FIX42_Reject_TargetSubID = 12,
+    FIX42_Reject_TargetLocationID = 13,
+    FIX42_Reject_OnBehalfOfSubID = 14,
+    FIX42_Reject_OnBehalfOfLocationID = 15,
+    FIX42_Reject_DeliverToSubID = 16,
+    FIX42_Reject_DeliverToLocationID = 17,
+    FIX42_Reject_PossDupFlag = 18,
+    FIX42_Reject_PossResend = 19,
+    FIX42_Reject_SendingTime = 20,
+    FIX42_Reject_OrigSendingTime = 21,
+    FIX42_Reject_XmlDataLen = 22,
+    FIX42_Reject_XmlData = 23,
+    FIX42_Reject_MessageEncoding = 24,
+    FIX42_Reject_LastMsgSeqNumProcessed = 25,
+    FIX42_Reject_OnBehalfOfSendingTime = 26,
+    FIX42_Reject_RefSeqNum = 27,
+    FIX42_Reject_RefTagID = 28,
+    FIX42_Reject_RefMsgType = 29,
+    FIX42_Reject_SessionRejectReason = 30,
+    FIX42_Reject_Text = 31,
+    FIX42_Reject_EncodedTextLen = 32,
+    FIX42_Reject_EncodedText = 33,
+    FIX42_Reject_SignatureLength = 34,
+    FIX42_Reject_Signature = 35,
+    FIX42_Reject_CheckSum = 36,
+};
+
+typedef struct _fix42Reject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	RefSeqNum;
+    int64_t	RefTagID;
+    struct _ofixStrView	RefMsgType;
+    int64_t	SessionRejectReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Reject;
+
+extern void	fix42_decode_Reject(ofixErr err, fix42Reject m, const char *raw, int len);
+extern void	fix42_decode_Reject_msg(ofixErr err, fix42Reject m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Reject(ofixErr err, fix42Reject m);
+
+// SequenceReset [4]
+enum {
+    FIX42_SequenceReset_BeginString = 0,
+    FIX42_SequenceReset_BodyLength = 1,
+    FIX42_SequenceReset_MsgType = 2,
+    FIX42_SequenceReset_SenderCompID = 3,
+    FIX42_SequenceReset_TargetCompID = 4,
+    FIX42_SequenceReset_OnBehalfOfCompID = 5,
+    FIX42_SequenceReset_DeliverToCompID = 6,
+    FIX42_SequenceReset_SecureDataLen = 7,
+    FIX42_SequenceReset_SecureData = 8,
+    FIX42_SequenceReset_MsgSeqNum = 9,
+    FIX42_SequenceReset_SenderSubID = 10,
+    FIX42_SequenceReset_SenderLocationID = 11,
+    FIX42_SequenceReset_TargetSubID = 12,
+    FIX42_SequenceReset_TargetLocationID = 13,
+    FIX42_SequenceReset_OnBehalfOfSubID = 14,
+    FIX42_SequenceReset_OnBehalfOfLocationID = 15,
+    FIX42_SequenceReset_DeliverToSubID = 16,
+    FIX42_SequenceReset_DeliverToLocationID = 17,
+    FIX42_SequenceReset_PossDupFlag = 18,
+    FIX42_SequenceReset_PossResend = 19,
+    FIX42_SequenceReset_SendingTime = 20,
+    FIX42_SequenceReset_OrigSendingTime = 21,
+    FIX42_SequenceReset_XmlDataLen = 22,
+    FIX42_SequenceReset_XmlData = 23,
+    FIX42_SequenceReset_MessageEncoding = 24,
+    FIX42_SequenceReset_LastMsgSeqNumProcessed = 25,
+    FIX42_SequenceReset_OnBehalfOfSendingTime = 26,
+    FIX42_SequenceReset_GapFillFlag = 27,
+    FIX42_SequenceReset_NewSeqNo = 28,
+    FIX42_SequenceReset_SignatureLength = 29,
+    FIX42_SequenceReset_Signature = 30,
+    FIX42_SequenceReset_CheckSum = 31,
+};
+
+typedef struct _fix42SequenceReset {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    char	GapFillFlag;
+    int64_t	NewSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42SequenceReset;
+
+extern void	fix42_decode_SequenceReset(ofixErr err, fix42SequenceReset m, const char *raw, int len);
+extern void	fix42_decode_SequenceReset_msg(ofixErr err, fix42SequenceReset m, ofixMsg msg);
+extern ofixMsg	fix42_encode_SequenceReset(ofixErr err, fix42SequenceReset m);
+
+// Logout [5]
+enum {
+    FIX42_Logout_BeginString = 0,
+    FIX42_Logout_BodyLength = 1,
+    FIX42_Logout_MsgType = 2,
+    FIX42_Logout_SenderCompID = 3,
+    FIX42_Logout_TargetCompID = 4,
+    FIX42_Logout_OnBehalfOfCompID = 5,
+    FIX42_Logout_DeliverToCompID = 6,
+    FIX42_Logout_SecureDataLen = 7,
+    FIX42_Logout_SecureData = 8,
+    FIX42_Logout_MsgSeqNum = 9,
+    FIX42_Logout_SenderSubID = 10,
+    FIX42_Logout_SenderLocationID = 11,
+    FIX42_Logout_TargetSubID = 12,
+    FIX42_Logout_TargetLocationID = 13,
+    FIX42_Logout_OnBehalfOfSubID = 14,
+    FIX42_Logout_OnBehalfOfLocationID = 15,
+    FIX42_Logout_DeliverToSubID = 16,
+    FIX42_Logout_DeliverToLocationID = 17,
+    FIX42_Logout_PossDupFlag = 18,
+    FIX42_Logout_PossResend = 19,
+    FIX42_Logout_SendingTime = 20,
+    FIX42_Logout_OrigSendingTime = 21,
+    FIX42_Logout_XmlDataLen = 22,
+    FIX42_Logout_XmlData = 23,
+    FIX42_Logout_MessageEncoding = 24,
+    FIX42_Logout_LastMsgSeqNumProcessed = 25,
+    FIX42_Logout_OnBehalfOfSendingTime = 26,
+    FIX42_Logout_Text = 27,
+    FIX42_Logout_EncodedTextLen = 28,
+    FIX42_Logout_EncodedText = 29,
+    FIX42_Logout_SignatureLength = 30,
+    FIX42_Logout_Signature = 31,
+    FIX42_Logout_CheckSum = 32,
+};
+
+typedef struct _fix42Logout {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Logout;
+
+extern void	fix42_decode_Logout(ofixErr err, fix42Logout m, const char *raw, int len);
+extern void	fix42_decode_Logout_msg(ofixErr err, fix42Logout m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Logout(ofixErr err, fix42Logout m);
+
+// IndicationofInterest [6]
+enum {
+    FIX42_IndicationofInterest_BeginString = 0,
+    FIX42_IndicationofInterest_BodyLength = 1,
+    FIX42_IndicationofInterest_MsgType = 2,
+    FIX42_IndicationofInterest_SenderCompID = 3,
+    FIX42_IndicationofInterest_TargetCompID = 4,
+    FIX42_IndicationofInterest_OnBehalfOfCompID = 5,
+    FIX42_IndicationofInterest_DeliverToCompID = 6,
+    FIX42_IndicationofInterest_SecureDataLen = 7,
+    FIX42_IndicationofInterest_SecureData = 8,
+    FIX42_IndicationofInterest_MsgSeqNum = 9,
+    FIX42_IndicationofInterest_SenderSubID = 10,
+    FIX42_IndicationofInterest_SenderLocationID = 11,
+    FIX42_IndicationofInterest_TargetSubID = 12,
+    FIX42_IndicationofInterest_TargetLocationID = 13,
+    FIX42_IndicationofInterest_OnBehalfOfSubID = 14,
+    FIX42_IndicationofInterest_OnBehalfOfLocationID = 15,
+    FIX42_IndicationofInterest_DeliverToSubID = 16,
+    FIX42_IndicationofInterest_DeliverToLocationID = 17,
+    FIX42_IndicationofInterest_PossDupFlag = 18,
+    FIX42_IndicationofInterest_PossResend = 19,
+    FIX42_IndicationofInterest_SendingTime = 20,
+    FIX42_IndicationofInterest_OrigSendingTime = 21,
+    FIX42_IndicationofInterest_XmlDataLen = 22,
+    FIX42_IndicationofInterest_XmlData = 23,
+    FIX42_IndicationofInterest_MessageEncoding = 24,
+    FIX42_IndicationofInterest_LastMsgSeqNumProcessed = 25,
+    FIX42_IndicationofInterest_OnBehalfOfSendingTime = 26,
+    FIX42_IndicationofInterest_IOIid = 27,
+    FIX42_IndicationofInterest_IOITransType = 28,
+    FIX42_IndicationofInterest_IOIRefID = 29,
+    FIX42_IndicationofInterest_Symbol = 30,
+    FIX42_IndicationofInterest_SymbolSfx = 31,
+    FIX42_IndicationofInterest_SecurityID = 32,
+    FIX42_IndicationofInterest_IDSource = 33,
+    FIX42_IndicationofInterest_SecurityType = 34,
+    FIX42_IndicationofInterest_MaturityMonthYear = 35,
+    FIX42_IndicationofInterest_MaturityDay = 36,
+    FIX42_IndicationofInterest_PutOrCall = 37,
+    FIX42_IndicationofInterest_StrikePrice = 38,
+    FIX42_IndicationofInterest_OptAttribute = 39,
+    FIX42_IndicationofInterest_ContractMultiplier = 40,
+    FIX42_IndicationofInterest_CouponRate = 41,
+    FIX42_IndicationofInterest_SecurityExchange = 42,
+    FIX42_IndicationofInterest_Issuer = 43,
+    FIX42_IndicationofInterest_EncodedIssuerLen = 44,
+    FIX42_IndicationofInterest_EncodedIssuer = 45,
+    FIX42_IndicationofInterest_SecurityDesc = 46,
+    FIX42_IndicationofInterest_EncodedSecurityDescLen = 47,
+    FIX42_IndicationofInterest_EncodedSecurityDesc = 48,
+    FIX42_IndicationofInterest_Side = 49,
+    FIX42_IndicationofInterest_IOIShares = 50,
+    FIX42_IndicationofInterest_Price = 51,
+    FIX42_IndicationofInterest_Currency = 52,
+    FIX42_IndicationofInterest_ValidUntilTime = 53,
+    FIX42_IndicationofInterest_IOIQltyInd = 54,
+    FIX42_IndicationofInterest_IOINaturalFlag = 55,
+    FIX42_IndicationofInterest_NoIOIQualifiers = 56,
+    FIX42_IndicationofInterest_Text = 57,
+    FIX42_IndicationofInterest_EncodedTextLen = 58,
+    FIX42_IndicationofInterest_EncodedText = 59,
+    FIX42_IndicationofInterest_TransactTime = 60,
+    FIX42_IndicationofInterest_URLLink = 61,
+    FIX42_IndicationofInterest_NoRoutingIDs = 62,
+    FIX42_IndicationofInterest_SpreadToBenchmark = 63,
+    FIX42_IndicationofInterest_Benchmark = 64,
+    FIX42_IndicationofInterest_SignatureLength = 65,
+    FIX42_IndicationofInterest_Signature = 66,
+    FIX42_IndicationofInterest_CheckSum = 67,
+};
+
+typedef struct _fix42IndicationofInterest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	IOIid;
+    char	IOITransType;
+    struct _ofixStrView	IOIRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixStrView	IOIShares;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixDate	ValidUntilTime;
+    char	IOIQltyInd;
+    char	IOINaturalFlag;
+    int64_t	NoIOIQualifiers;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	URLLink;
+    int64_t	NoRoutingIDs;
+    struct _ofixDecimal	SpreadToBenchmark;
+    char	Benchmark;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42IndicationofInterest;
+
+extern void	fix42_decode_IndicationofInterest(ofixErr err, fix42IndicationofInterest m, const char *raw, int len);
+extern void	fix42_decode_IndicationofInterest_msg(ofixErr err, fix42IndicationofInterest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_IndicationofInterest(ofixErr err, fix42IndicationofInterest m);
+
+// Advertisement [7]
+enum {
+    FIX42_Advertisement_BeginString = 0,
+    FIX42_Advertisement_BodyLength = 1,
+    FIX42_Advertisement_MsgType = 2,
+    FIX42_Advertisement_SenderCompID = 3,
+    FIX42_Advertisement_TargetCompID = 4,
+    FIX42_Advertisement_OnBehalfOfCompID = 5,
+    FIX42_Advertisement_DeliverToCompID = 6,
+    FIX42_Advertisement_SecureDataLen = 7,
+    FIX42_Advertisement_SecureData = 8,
+    FIX42_Advertisement_MsgSeqNum = 9,
+    FIX42_Advertisement_SenderSubID = 10,
+    FIX42_Advertisement_SenderLocationID = 11,
+    FIX42_Advertisement_TargetSubID = 12,
+    FIX42_Advertisement_TargetLocationID = 13,
+    FIX42_Advertisement_OnBehalfOfSubID = 14,
+    FIX42_Advertisement_OnBehalfOfLocationID = 15,
+    FIX42_Advertisement_DeliverToSubID = 16,
+    FIX42_Advertisement_DeliverToLocationID = 17,
+    FIX42_Advertisement_PossDupFlag = 18,
+    FIX42_Advertisement_PossResend = 19,
+    FIX42_Advertisement_SendingTime = 20,
+    FIX42_Advertisement_OrigSendingTime = 21,
+    FIX42_Advertisement_XmlDataLen = 22,
+    FIX42_Advertisement_XmlData = 23,
+    FIX42_Advertisement_MessageEncoding = 24,
+    FIX42_Advertisement_LastMsgSeqNumProcessed = 25,
+    FIX42_Advertisement_OnBehalfOfSendingTime = 26,
+    FIX42_Advertisement_AdvId = 27,
+    FIX42_Advertisement_AdvTransType = 28,
+    FIX42_Advertisement_AdvRefID = 29,
+    FIX42_Advertisement_Symbol = 30,
+    FIX42_Advertisement_SymbolSfx = 31,
+    FIX42_Advertisement_SecurityID = 32,
+    FIX42_Advertisement_IDSource = 33,
+    FIX42_Advertisement_SecurityType = 34,
+    FIX42_Advertisement_MaturityMonthYear = 35,
+    FIX42_Advertisement_MaturityDay = 36,
+    FIX42_Advertisement_PutOrCall = 37,
+    FIX42_Advertisement_StrikePrice = 38,
+    FIX42_Advertisement_OptAttribute = 39,
+    FIX42_Advertisement_ContractMultiplier = 40,
+    FIX42_Advertisement_CouponRate = 41,
+    FIX42_Advertisement_SecurityExchange = 42,
+    FIX42_Advertisement_Issuer = 43,
+    FIX42_Advertisement_EncodedIssuerLen = 44,
+    FIX42_Advertisement_EncodedIssuer = 45,
+    FIX42_Advertisement_SecurityDesc = 46,
+    FIX42_Advertisement_EncodedSecurityDescLen = 47,
+    FIX42_Advertisement_EncodedSecurityDesc = 48,
+    FIX42_Advertisement_AdvSide = 49,
+    FIX42_Advertisement_Shares = 50,
+    FIX42_Advertisement_Price = 51,
+    FIX42_Advertisement_Currency = 52,
+    FIX42_Advertisement_TradeDate = 53,
+    FIX42_Advertisement_TransactTime = 54,
+    FIX42_Advertisement_Text = 55,
+    FIX42_Advertisement_EncodedTextLen = 56,
+    FIX42_Advertisement_EncodedText = 57,
+    FIX42_Advertisement_URLLink = 58,
+    FIX42_Advertisement_LastMkt = 59,
+    FIX42_Advertisement_TradingSessionID = 60,
+    FIX42_Advertisement_SignatureLength = 61,
+    FIX42_Advertisement_Signature = 62,
+    FIX42_Advertisement_CheckSum = 63,
+};
+
+typedef struct _fix42Advertisement {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	AdvId;
+    struct _ofixStrView	AdvTransType;
+    struct _ofixStrView	AdvRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	AdvSide;
+    struct _ofixDecimal	Shares;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	URLLink;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Advertisement;
+
+extern void	fix42_decode_Advertisement(ofixErr err, fix42Advertisement m, const char *raw, int len);
+extern void	fix42_decode_Advertisement_msg(ofixErr err, fix42Advertisement m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Advertisement(ofixErr err, fix42Advertisement m);
+
+// ExecutionReport [8]
+enum {
+    FIX42_ExecutionReport_BeginString = 0,
+    FIX42_ExecutionReport_BodyLength = 1,
+    FIX42_ExecutionReport_MsgType = 2,
+    FIX42_ExecutionReport_SenderCompID = 3,
+    FIX42_ExecutionReport_TargetCompID = 4,
+    FIX42_ExecutionReport_OnBehalfOfCompID = 5,
+    FIX42_ExecutionReport_DeliverToCompID = 6,
+    FIX42_ExecutionReport_SecureDataLen = 7,
+    FIX42_ExecutionReport_SecureData = 8,
+    FIX42_ExecutionReport_MsgSeqNum = 9,
+    FIX42_ExecutionReport_SenderSubID = 10,
+    FIX42_ExecutionReport_SenderLocationID = 11,
+    FIX42_ExecutionReport_TargetSubID = 12,
+    FIX42_ExecutionReport_TargetLocationID = 13,
+    FIX42_ExecutionReport_OnBehalfOfSubID = 14,
+    FIX42_ExecutionReport_OnBehalfOfLocationID = 15,
+    FIX42_ExecutionReport_DeliverToSubID = 16,
+    FIX42_ExecutionReport_DeliverToLocationID = 17,
+    FIX42_ExecutionReport_PossDupFlag = 18,
+    FIX42_ExecutionReport_PossResend = 19,
+    FIX42_ExecutionReport_SendingTime = 20,
+    FIX42_ExecutionReport_OrigSendingTime = 21,
+    FIX42_ExecutionReport_XmlDataLen = 22,
+    FIX42_ExecutionReport_XmlData = 23,
+    FIX42_ExecutionReport_MessageEncoding = 24,
+    FIX42_ExecutionReport_LastMsgSeqNumProcessed = 25,
+    FIX42_ExecutionReport_OnBehalfOfSendingTime = 26,
+    FIX42_ExecutionReport_OrderID = 27,
+    FIX42_ExecutionReport_SecondaryOrderID = 28,
+    FIX42_ExecutionReport_ClOrdID = 29,
+    FIX42_ExecutionReport_OrigClOrdID = 30,
+    FIX42_ExecutionReport_ClientID = 31,
+    FIX42_ExecutionReport_ExecBroker = 32,
+    FIX42_ExecutionReport_NoContraBrokers = 33,
+    FIX42_ExecutionReport_ListID = 34,
+    FIX42_ExecutionReport_ExecID = 35,
+    FIX42_ExecutionReport_ExecTransType = 36,
+    FIX42_ExecutionReport_ExecRefID = 37,
+    FIX42_ExecutionReport_ExecType = 38,
+    FIX42_ExecutionReport_OrdStatus = 39,
+    FIX42_ExecutionReport_OrdRejReason = 40,
+    FIX42_ExecutionReport_ExecRestatementReason = 41,
+    FIX42_ExecutionReport_Account = 42,
+    FIX42_ExecutionReport_SettlmntTyp = 43,
+    FIX42_ExecutionReport_FutSettDate = 44,
+    FIX42_ExecutionReport_Symbol = 45,
+    FIX42_ExecutionReport_SymbolSfx = 46,
+    FIX42_ExecutionReport_SecurityID = 47,
+    FIX42_ExecutionReport_IDSource = 48,
+    FIX42_ExecutionReport_SecurityType = 49,
+    FIX42_ExecutionReport_MaturityMonthYear = 50,
+    FIX42_ExecutionReport_MaturityDay = 51,
+    FIX42_ExecutionReport_PutOrCall = 52,
+    FIX42_ExecutionReport_StrikePrice = 53,
+    FIX42_ExecutionReport_OptAttribute = 54,
+    FIX42_ExecutionReport_ContractMultiplier = 55,
+    FIX42_ExecutionReport_CouponRate = 56,
+    FIX42_ExecutionReport_SecurityExchange = 57,
+    FIX42_ExecutionReport_Issuer = 58,
+    FIX42_ExecutionReport_EncodedIssuerLen = 59,
+    FIX42_ExecutionReport_EncodedIssuer = 60,
+    FIX42_ExecutionReport_SecurityDesc = 61,
+    FIX42_ExecutionReport_EncodedSecurityDescLen = 62,
+    FIX42_ExecutionReport_EncodedSecurityDesc = 63,
+    FIX42_ExecutionReport_Side = 64,
+    FIX42_ExecutionReport_OrderQty = 65,
+    FIX42_ExecutionReport_CashOrderQty = 66,
+    FIX42_ExecutionReport_OrdType = 67,
+    FIX42_ExecutionReport_Price = 68,
+    FIX42_ExecutionReport_StopPx = 69,
+    FIX42_ExecutionReport_PegDifference = 70,
+    FIX42_ExecutionReport_DiscretionInst = 71,
+    FIX42_ExecutionReport_DiscretionOffset = 72,
+    FIX42_ExecutionReport_Currency = 73,
+    FIX42_ExecutionReport_ComplianceID = 74,
+    FIX42_ExecutionReport_SolicitedFlag = 75,
+    FIX42_ExecutionReport_TimeInForce = 76,
+    FIX42_ExecutionReport_EffectiveTime = 77,
+    FIX42_ExecutionReport_ExpireDate = 78,
+    FIX42_ExecutionReport_ExpireTime = 79,
+    FIX42_ExecutionReport_ExecInst = 80,
+    FIX42_ExecutionReport_Rule80A = 81,
+    FIX42_ExecutionReport_LastShares = 82,
+    FIX42_ExecutionReport_LastPx = 83,
+    FIX42_ExecutionReport_LastSpotRate = 84,
+    FIX42_ExecutionReport_LastForwardPoints = 85,
+    FIX42_ExecutionReport_LastMkt = 86,
+    FIX42_ExecutionReport_TradingSessionID = 87,
+    FIX42_ExecutionReport_LastCapacity = 88,
+    FIX42_ExecutionReport_LeavesQty = 89,
+    FIX42_ExecutionReport_CumQty = 90,
+    FIX42_ExecutionReport_AvgPx = 91,
+    FIX42_ExecutionReport_DayOrderQty = 92,
+    FIX42_ExecutionReport_DayCumQty = 93,
+    FIX42_ExecutionReport_DayAvgPx = 94,
+    FIX42_ExecutionReport_GTBookingInst = 95,
+    FIX42_ExecutionReport_TradeDate = 96,
+    FIX42_ExecutionReport_TransactTime = 97,
+    FIX42_ExecutionReport_ReportToExch = 98,
+    FIX42_ExecutionReport_Commission = 99,
+    FIX42_ExecutionReport_CommType = 100,
+    FIX42_ExecutionReport_GrossTradeAmt = 101,
+    FIX42_ExecutionReport_SettlCurrAmt = 102,
+    FIX42_ExecutionReport_SettlCurrency = 103,
+    FIX42_ExecutionReport_SettlCurrFxRate = 104,
+    FIX42_ExecutionReport_SettlCurrFxRateCalc = 105,
+    FIX42_ExecutionReport_HandlInst = 106,
+    FIX42_ExecutionReport_MinQty = 107,
+    FIX42_ExecutionReport_MaxFloor = 108,
+    FIX42_ExecutionReport_OpenClose = 109,
+    FIX42_ExecutionReport_MaxShow = 110,
+    FIX42_ExecutionReport_Text = 111,
+    FIX42_ExecutionReport_EncodedTextLen = 112,
+    FIX42_ExecutionReport_EncodedText = 113,
+    FIX42_ExecutionReport_FutSettDate2 = 114,
+    FIX42_ExecutionReport_OrderQty2 = 115,
+    FIX42_ExecutionReport_ClearingFirm = 116,
+    FIX42_ExecutionReport_ClearingAccount = 117,
+    FIX42_ExecutionReport_MultiLegReportingType = 118,
+    FIX42_ExecutionReport_SignatureLength = 119,
+    FIX42_ExecutionReport_Signature = 120,
+    FIX42_ExecutionReport_CheckSum = 121,
+};
+
+typedef struct _fix42ExecutionReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    int64_t	NoContraBrokers;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	ExecID;
+    char	ExecTransType;
+    struct _ofixStrView	ExecRefID;
+    char	ExecType;
+    char	OrdStatus;
+    int64_t	OrdRejReason;
+    int64_t	ExecRestatementReason;
+    struct _ofixStrView	Account;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    char	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    struct _ofixStrView	ExecInst;
+    char	Rule80A;
+    struct _ofixDecimal	LastShares;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDecimal	LastSpotRate;
+    struct _ofixDecimal	LastForwardPoints;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    char	LastCapacity;
+    struct _ofixDecimal	LeavesQty;
+    struct _ofixDecimal	CumQty;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDecimal	DayOrderQty;
+    struct _ofixDecimal	DayCumQty;
+    struct _ofixDecimal	DayAvgPx;
+    int64_t	GTBookingInst;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	ReportToExch;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixDecimal	GrossTradeAmt;
+    struct _ofixDecimal	SettlCurrAmt;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixDecimal	SettlCurrFxRate;
+    char	SettlCurrFxRateCalc;
+    char	HandlInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    char	OpenClose;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	ClearingFirm;
+    struct _ofixStrView	ClearingAccount;
+    char	MultiLegReportingType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42ExecutionReport;
+
+extern void	fix42_decode_ExecutionReport(ofixErr err, fix42ExecutionReport m, const char *raw, int len);
+extern void	fix42_decode_ExecutionReport_msg(ofixErr err, fix42ExecutionReport m, ofixMsg msg);
+extern ofixMsg	fix42_encode_ExecutionReport(ofixErr err, fix42ExecutionReport m);
+
+// OrderCancelReject [9]
+enum {
+    FIX42_OrderCancelReject_BeginString = 0,
+    FIX42_OrderCancelReject_BodyLength = 1,
+    FIX42_OrderCancelReject_MsgType = 2,
+    FIX42_OrderCancelReject_SenderCompID = 3,
+    FIX42_OrderCancelReject_TargetCompID = 4,
+    FIX42_OrderCancelReject_OnBehalfOfCompID = 5,
+    FIX42_OrderCancelReject_DeliverToCompID = 6,
+    FIX42_OrderCancelReject_SecureDataLen = 7,
+    FIX42_OrderCancelReject_SecureData = 8,
+    FIX42_OrderCancelReject_MsgSeqNum = 9,
+    FIX42_OrderCancelReject_SenderSubID = 10,
+    FIX42_OrderCancelReject_SenderLocationID = 11,
+    FIX42_OrderCancelReject_TargetSubID = 12,
+    FIX42_OrderCancelReject_TargetLocationID = 13,
+    FIX42_OrderCancelReject_OnBehalfOfSubID = 14,
+    FIX42_OrderCancelReject_OnBehalfOfLocationID = 15,
+    FIX42_OrderCancelReject_DeliverToSubID = 16,
+    FIX42_OrderCancelReject_DeliverToLocationID = 17,
+    FIX42_OrderCancelReject_PossDupFlag = 18,
+    FIX42_OrderCancelReject_PossResend = 19,
+    FIX42_OrderCancelReject_SendingTime = 20,
+    FIX42_OrderCancelReject_OrigSendingTime = 21,
+    FIX42_OrderCancelReject_XmlDataLen = 22,
+    FIX42_OrderCancelReject_XmlData = 23,
+    FIX42_OrderCancelReject_MessageEncoding = 24,
+    FIX42_OrderCancelReject_LastMsgSeqNumProcessed = 25,
+    FIX42_OrderCancelReject_OnBehalfOfSendingTime = 26,
+    FIX42_OrderCancelReject_OrderID = 27,
+    FIX42_OrderCancelReject_SecondaryOrderID = 28,
+    FIX42_OrderCancelReject_ClOrdID = 29,
+    FIX42_OrderCancelReject_OrigClOrdID = 30,
+    FIX42_OrderCancelReject_OrdStatus = 31,
+    FIX42_OrderCancelReject_ClientID = 32,
+    FIX42_OrderCancelReject_ExecBroker = 33,
+    FIX42_OrderCancelReject_ListID = 34,
+    FIX42_OrderCancelReject_Account = 35,
+    FIX42_OrderCancelReject_TransactTime = 36,
+    FIX42_OrderCancelReject_CxlRejResponseTo = 37,
+    FIX42_OrderCancelReject_CxlRejReason = 38,
+    FIX42_OrderCancelReject_Text = 39,
+    FIX42_OrderCancelReject_EncodedTextLen = 40,
+    FIX42_OrderCancelReject_EncodedText = 41,
+    FIX42_OrderCancelReject_SignatureLength = 42,
+    FIX42_OrderCancelReject_Signature = 43,
+    FIX42_OrderCancelReject_CheckSum = 44,
+};
+
+typedef struct _fix42OrderCancelReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrigClOrdID;
+    char	OrdStatus;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Account;
+    struct _ofixDate	TransactTime;
+    char	CxlRejResponseTo;
+    int64_t	CxlRejReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42OrderCancelReject;
+
+extern void	fix42_decode_OrderCancelReject(ofixErr err, fix42OrderCancelReject m, const char *raw, int len);
+extern void	fix42_decode_OrderCancelReject_msg(ofixErr err, fix42OrderCancelReject m, ofixMsg msg);
+extern ofixMsg	fix42_encode_OrderCancelReject(ofixErr err, fix42OrderCancelReject m);
+
+// Logon [A]
+enum {
+    FIX42_Logon_BeginString = 0,
+    FIX42_Logon_BodyLength = 1,
+    FIX42_Logon_MsgType = 2,
+    FIX42_Logon_SenderCompID = 3,
+    FIX42_Logon_TargetCompID = 4,
+    FIX42_Logon_OnBehalfOfCompID = 5,
+    FIX42_Logon_DeliverToCompID = 6,
+    FIX42_Logon_SecureDataLen = 7,
+    FIX42_Logon_SecureData = 8,
+    FIX42_Logon_MsgSeqNum = 9,
+    FIX42_Logon_SenderSubID = 10,
+    FIX42_Logon_SenderLocationID = 11,
+    FIX42_Logon_TargetSubID = 12,
+    FIX42_Logon_TargetLocationID = 13,
+    FIX42_Logon_OnBehalfOfSubID = 14,
+    FIX42_Logon_OnBehalfOfLocationID = 15,
+    FIX42_Logon_DeliverToSubID = 16,
+    FIX42_Logon_DeliverToLocationID = 17,
+    FIX42_Logon_PossDupFlag = 18,
+    FIX42_Logon_PossResend = 19,
+    FIX42_Logon_SendingTime = 20,
+    FIX42_Logon_OrigSendingTime = 21,
+    FIX42_Logon_XmlDataLen = 22,
+    FIX42_Logon_XmlData = 23,
+    FIX42_Logon_MessageEncoding = 24,
+    FIX42_Logon_LastMsgSeqNumProcessed = 25,
+    FIX42_Logon_OnBehalfOfSendingTime = 26,
+    FIX42_Logon_EncryptMethod = 27,
+    FIX42_Logon_HeartBtInt = 28,
+    FIX42_Logon_RawDataLength = 29,
+    FIX42_Logon_RawData = 30,
+    FIX42_Logon_ResetSeqNumFlag = 31,
+    FIX42_Logon_MaxMessageSize = 32,
+    FIX42_Logon_NoMsgTypes = 33,
+    FIX42_Logon_SignatureLength = 34,
+    FIX42_Logon_Signature = 35,
+    FIX42_Logon_CheckSum = 36,
+};
+
+typedef struct _fix42Logon {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	EncryptMethod;
+    int64_t	HeartBtInt;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    char	ResetSeqNumFlag;
+    int64_t	MaxMessageSize;
+    int64_t	NoMsgTypes;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Logon;
+
+extern void	fix42_decode_Logon(ofixErr err, fix42Logon m, const char *raw, int len);
+extern void	fix42_decode_Logon_msg(ofixErr err, fix42Logon m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Logon(ofixErr err, fix42Logon m);
+
+// News [B]
+enum {
+    FIX42_News_BeginString = 0,
+    FIX42_News_BodyLength = 1,
+    FIX42_News_MsgType = 2,
+    FIX42_News_SenderCompID = 3,
+    FIX42_News_TargetCompID = 4,
+    FIX42_News_OnBehalfOfCompID = 5,
+    FIX42_News_DeliverToCompID = 6,
+    FIX42_News_SecureDataLen = 7,
+    FIX42_News_SecureData = 8,
+    FIX42_News_MsgSeqNum = 9,
+    FIX42_News_SenderSubID = 10,
+    FIX42_News_SenderLocationID = 11,
+    FIX42_News_TargetSubID = 12,
+    FIX42_News_TargetLocationID = 13,
+    FIX42_News_OnBehalfOfSubID = 14,
+    FIX42_News_OnBehalfOfLocationID = 15,
+    FIX42_News_DeliverToSubID = 16,
+    FIX42_News_DeliverToLocationID = 17,
+    FIX42_News_PossDupFlag = 18,
+    FIX42_News_PossResend = 19,
+    FIX42_News_SendingTime = 20,
+    FIX42_News_OrigSendingTime = 21,
+    FIX42_News_XmlDataLen = 22,
+    FIX42_News_XmlData = 23,
+    FIX42_News_MessageEncoding = 24,
+    FIX42_News_LastMsgSeqNumProcessed = 25,
+    FIX42_News_OnBehalfOfSendingTime = 26,
+    FIX42_News_OrigTime = 27,
+    FIX42_News_Urgency = 28,
+    FIX42_News_Headline = 29,
+    FIX42_News_EncodedHeadlineLen = 30,
+    FIX42_News_EncodedHeadline = 31,
+    FIX42_News_NoRoutingIDs = 32,
+    FIX42_News_NoRelatedSym = 33,
+    FIX42_News_LinesOfText = 34,
+    FIX42_News_URLLink = 35,
+    FIX42_News_RawDataLength = 36,
+    FIX42_News_RawData = 37,
+    FIX42_News_SignatureLength = 38,
+    FIX42_News_Signature = 39,
+    FIX42_News_CheckSum = 40,
+};
+
+typedef struct _fix42News {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixDate	OrigTime;
+    char	Urgency;
+    struct _ofixStrView	Headline;
+    int64_t	EncodedHeadlineLen;
+    struct _ofixStrView	EncodedHeadline;
+    int64_t	NoRoutingIDs;
+    int64_t	NoRelatedSym;
+    int64_t	LinesOfText;
+    struct _ofixStrView	URLLink;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42News;
+
+extern void	fix42_decode_News(ofixErr err, fix42News m, const char *raw, int len);
+extern void	fix42_decode_News_msg(ofixErr err, fix42News m, ofixMsg msg);
+extern ofixMsg	fix42_encode_News(ofixErr err, fix42News m);
+
+// Email [C]
+enum {
+    FIX42_Email_BeginString = 0,
+    FIX42_Email_BodyLength = 1,
+    FIX42_Email_MsgType = 2,
+    FIX42_Email_SenderCompID = 3,
+    FIX42_Email_TargetCompID = 4,
+    FIX42_Email_OnBehalfOfCompID = 5,
+    FIX42_Email_DeliverToCompID = 6,
+    FIX42_Email_SecureDataLen = 7,
+    FIX42_Email_SecureData = 8,
+    FIX42_Email_MsgSeqNum = 9,
+    FIX42_Email_SenderSubID = 10,
+    FIX42_Email_SenderLocationID = 11,
+    FIX42_Email_TargetSubID = 12,
+    FIX42_Email_TargetLocationID = 13,
+    FIX42_Email_OnBehalfOfSubID = 14,
+    FIX42_Email_OnBehalfOfLocationID = 15,
+    FIX42_Email_DeliverToSubID = 16,
+    FIX42_Email_DeliverToLocationID = 17,
+    FIX42_Email_PossDupFlag = 18,
+    FIX42_Email_PossResend = 19,
+    FIX42_Email_SendingTime = 20,
+    FIX42_Email_OrigSendingTime = 21,
+    FIX42_Email_XmlDataLen = 22,
+    FIX42_Email_XmlData = 23,
+    FIX42_Email_MessageEncoding = 24,
+    FIX42_Email_LastMsgSeqNumProcessed = 25,
+    FIX42_Email_OnBehalfOfSendingTime = 26,
+    FIX42_Email_EmailThreadID = 27,
+    FIX42_Email_EmailType = 28,
+    FIX42_Email_OrigTime = 29,
+    FIX42_Email_Subject = 30,
+    FIX42_Email_EncodedSubjectLen = 31,
+    FIX42_Email_EncodedSubject = 32,
+    FIX42_Email_NoRoutingIDs = 33,
+    FIX42_Email_NoRelatedSym = 34,
+    FIX42_Email_OrderID = 35,
+    FIX42_Email_ClOrdID = 36,
+    FIX42_Email_LinesOfText = 37,
+    FIX42_Email_RawDataLength = 38,
+    FIX42_Email_RawData = 39,
+    FIX42_Email_SignatureLength = 40,
+    FIX42_Email_Signature = 41,
+    FIX42_Email_CheckSum = 42,
+};
+
+typedef struct _fix42Email {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	EmailThreadID;
+    char	EmailType;
+    struct _ofixDate	OrigTime;
+    struct _ofixStrView	Subject;
+    int64_t	EncodedSubjectLen;
+    struct _ofixStrView	EncodedSubject;
+    int64_t	NoRoutingIDs;
+    int64_t	NoRelatedSym;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	LinesOfText;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Email;
+
+extern void	fix42_decode_Email(ofixErr err, fix42Email m, const char *raw, int len);
+extern void	fix42_decode_Email_msg(ofixErr err, fix42Email m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Email(ofixErr err, fix42Email m);
+
+// NewOrderSingle [D]
+enum {
+    FIX42_NewOrderSingle_BeginString = 0,
+    FIX42_NewOrderSingle_BodyLength = 1,
+    FIX42_NewOrderSingle_MsgType = 2,
+    FIX42_NewOrderSingle_SenderCompID = 3,
+    FIX42_NewOrderSingle_TargetCompID = 4,
+    FIX42_NewOrderSingle_OnBehalfOfCompID = 5,
+    FIX42_NewOrderSingle_DeliverToCompID = 6,
+    FIX42_NewOrderSingle_SecureDataLen = 7,
+    FIX42_NewOrderSingle_SecureData = 8,
+    FIX42_NewOrderSingle_MsgSeqNum = 9,
+    FIX42_NewOrderSingle_SenderSubID = 10,
+    FIX42_NewOrderSingle_SenderLocationID = 11,
+    FIX42_NewOrderSingle_TargetSubID = 12,
+    FIX42_NewOrderSingle_TargetLocationID = 13,
+    FIX42_NewOrderSingle_OnBehalfOfSubID = 14,
+    FIX42_NewOrderSingle_OnBehalfOfLocationID = 15,
+    FIX42_NewOrderSingle_DeliverToSubID = 16,
+    FIX42_NewOrderSingle_DeliverToLocationID = 17,
+    FIX42_NewOrderSingle_PossDupFlag = 18,
+    FIX42_NewOrderSingle_PossResend = 19,
+    FIX42_NewOrderSingle_SendingTime = 20,
+    FIX42_NewOrderSingle_OrigSendingTime = 21,
+    FIX42_NewOrderSingle_XmlDataLen = 22,
+    FIX42_NewOrderSingle_XmlData = 23,
+    FIX42_NewOrderSingle_MessageEncoding = 24,
+    FIX42_NewOrderSingle_LastMsgSeqNumProcessed = 25,
+    FIX42_NewOrderSingle_OnBehalfOfSendingTime = 26,
+    FIX42_NewOrderSingle_ClOrdID = 27,
+    FIX42_NewOrderSingle_ClientID = 28,
+    FIX42_NewOrderSingle_ExecBroker = 29,
+    FIX42_NewOrderSingle_Account = 30,
+    FIX42_NewOrderSingle_NoAllocs = 31,
+    FIX42_NewOrderSingle_SettlmntTyp = 32,
+    FIX42_NewOrderSingle_FutSettDate = 33,
+    FIX42_NewOrderSingle_HandlInst = 34,
+    FIX42_NewOrderSingle_ExecInst = 35,
+    FIX42_NewOrderSingle_MinQty = 36,
+    FIX42_NewOrderSingle_MaxFloor = 37,
+    FIX42_NewOrderSingle_ExDestination = 38,
+    FIX42_NewOrderSingle_NoTradingSessions = 39,
+    FIX42_NewOrderSingle_ProcessCode = 40,
+    FIX42_NewOrderSingle_Symbol = 41,
+    FIX42_NewOrderSingle_SymbolSfx = 42,
+    FIX42_NewOrderSingle_SecurityID = 43,
+    FIX42_NewOrderSingle_IDSource = 44,
+    FIX42_NewOrderSingle_SecurityType = 45,
+    FIX42_NewOrderSingle_MaturityMonthYear = 46,
+    FIX42_NewOrderSingle_MaturityDay = 47,
+    FIX42_NewOrderSingle_PutOrCall = 48,
+    FIX42_NewOrderSingle_StrikePrice = 49,
+    FIX42_NewOrderSingle_OptAttribute = 50,
+    FIX42_NewOrderSingle_ContractMultiplier = 51,
+    FIX42_NewOrderSingle_CouponRate = 52,
+    FIX42_NewOrderSingle_SecurityExchange = 53,
+    FIX42_NewOrderSingle_Issuer = 54,
+    FIX42_NewOrderSingle_EncodedIssuerLen = 55,
+    FIX42_NewOrderSingle_EncodedIssuer = 56,
+    FIX42_NewOrderSingle_SecurityDesc = 57,
+    FIX42_NewOrderSingle_EncodedSecurityDescLen = 58,
+    FIX42_NewOrderSingle_EncodedSecurityDesc = 59,
+    FIX42_NewOrderSingle_PrevClosePx = 60,
+    FIX42_NewOrderSingle_Side = 61,
+    FIX42_NewOrderSingle_LocateReqd = 62,
+    FIX42_NewOrderSingle_TransactTime = 63,
+    FIX42_NewOrderSingle_OrderQty = 64,
+    FIX42_NewOrderSingle_CashOrderQty = 65,
+    FIX42_NewOrderSingle_OrdType = 66,
+    FIX42_NewOrderSingle_Price = 67,
+    FIX42_NewOrderSingle_StopPx = 68,
+    FIX42_NewOrderSingle_Currency = 69,
+    FIX42_NewOrderSingle_ComplianceID = 70,
+    FIX42_NewOrderSingle_SolicitedFlag = 71,
+    FIX42_NewOrderSingle_IOIid = 72,
+    FIX42_NewOrderSingle_QuoteID = 73,
+    FIX42_NewOrderSingle_TimeInForce = 74,
+    FIX42_NewOrderSingle_EffectiveTime = 75,
+    FIX42_NewOrderSingle_ExpireDate = 76,
+    FIX42_NewOrderSingle_ExpireTime = 77,
+    FIX42_NewOrderSingle_GTBookingInst = 78,
+    FIX42_NewOrderSingle_Commission = 79,
+    FIX42_NewOrderSingle_CommType = 80,
+    FIX42_NewOrderSingle_Rule80A = 81,
+    FIX42_NewOrderSingle_ForexReq = 82,
+    FIX42_NewOrderSingle_SettlCurrency = 83,
+    FIX42_NewOrderSingle_Text = 84,
+    FIX42_NewOrderSingle_EncodedTextLen = 85,
+    FIX42_NewOrderSingle_EncodedText = 86,
+    FIX42_NewOrderSingle_FutSettDate2 = 87,
+    FIX42_NewOrderSingle_OrderQty2 = 88,
+    FIX42_NewOrderSingle_OpenClose = 89,
+    FIX42_NewOrderSingle_CoveredOrUncovered = 90,
+    FIX42_NewOrderSingle_CustomerOrFirm = 91,
+    FIX42_NewOrderSingle_MaxShow = 92,
+    FIX42_NewOrderSingle_PegDifference = 93,
+    FIX42_NewOrderSingle_DiscretionInst = 94,
+    FIX42_NewOrderSingle_DiscretionOffset = 95,
+    FIX42_NewOrderSingle_ClearingFirm = 96,
+    FIX42_NewOrderSingle_ClearingAccount = 97,
+    FIX42_NewOrderSingle_SignatureLength = 98,
+    FIX42_NewOrderSingle_Signature = 99,
+    FIX42_NewOrderSingle_CheckSum = 100,
+};
+
+typedef struct _fix42NewOrderSingle {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Account;
+    int64_t	NoAllocs;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    char	Side;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    char	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    char	Rule80A;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    char	OpenClose;
+    int64_t	CoveredOrUncovered;
+    int64_t	CustomerOrFirm;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    struct _ofixStrView	ClearingFirm;
+    struct _ofixStrView	ClearingAccount;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42NewOrderSingle;
+
+extern void	fix42_decode_NewOrderSingle(ofixErr err, fix42NewOrderSingle m, const char *raw, int len);
+extern void	fix42_decode_NewOrderSingle_msg(ofixErr err, fix42NewOrderSingle m, ofixMsg msg);
+extern ofixMsg	fix42_encode_NewOrderSingle(ofixErr err, fix42NewOrderSingle m);
+
+// NewOrderList [E]
+enum {
+    FIX42_NewOrderList_BeginString = 0,
+    FIX42_NewOrderList_BodyLength = 1,
+    FIX42_NewOrderList_MsgType = 2,
+    FIX42_NewOrderList_SenderCompID = 3,
+    FIX42_NewOrderList_TargetCompID = 4,
+    FIX42_NewOrderList_OnBehalfOfCompID = 5,
+    FIX42_NewOrderList_DeliverToCompID = 6,
+    FIX42_NewOrderList_SecureDataLen = 7,
+    FIX42_NewOrderList_SecureData = 8,
+    FIX42_NewOrderList_MsgSeqNum = 9,
+    FIX42_NewOrderList_SenderSubID = 10,
+    FIX42_NewOrderList_SenderLocationID = 11,
+    FIX42_NewOrderList_TargetSubID = 12,
+    FIX42_NewOrderList_TargetLocationID = 13,
+    FIX42_NewOrderList_OnBehalfOfSubID = 14,
+    FIX42_NewOrderList_OnBehalfOfLocationID = 15,
+    FIX42_NewOrderList_DeliverToSubID = 16,
+    FIX42_NewOrderList_DeliverToLocationID = 17,
+    FIX42_NewOrderList_PossDupFlag = 18,
+    FIX42_NewOrderList_PossResend = 19,
+    FIX42_NewOrderList_SendingTime = 20,
+    FIX42_NewOrderList_OrigSendingTime = 21,
+    FIX42_NewOrderList_XmlDataLen = 22,
+    FIX42_NewOrderList_XmlData = 23,
+    FIX42_NewOrderList_MessageEncoding = 24,
+    FIX42_NewOrderList_LastMsgSeqNumProcessed = 25,
+    FIX42_NewOrderList_OnBehalfOfSendingTime = 26,
+    FIX42_NewOrderList_ListID = 27,
+    FIX42_NewOrderList_BidID = 28,
+    FIX42_NewOrderList_ClientBidID = 29,
+    FIX42_NewOrderList_ProgRptReqs = 30,
+    FIX42_NewOrderList_BidType = 31,
+    FIX42_NewOrderList_ProgPeriodInterval = 32,
+    FIX42_NewOrderList_ListExecInstType = 33,
+    FIX42_NewOrderList_ListExecInst = 34,
+    FIX42_NewOrderList_EncodedListExecInstLen = 35,
+    FIX42_NewOrderList_EncodedListExecInst = 36,
+    FIX42_NewOrderList_TotNoOrders = 37,
+    FIX42_NewOrderList_NoOrders = 38,
+    FIX42_NewOrderList_SignatureLength = 39,
+    FIX42_NewOrderList_Signature = 40,
+    FIX42_NewOrderList_CheckSum = 41,
+};
+
+typedef struct _fix42NewOrderList {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    int64_t	ProgRptReqs;
+    int64_t	BidType;
+    int64_t	ProgPeriodInterval;
+    char	ListExecInstType;
+    struct _ofixStrView	ListExecInst;
+    int64_t	EncodedListExecInstLen;
+    struct _ofixStrView	EncodedListExecInst;
+    int64_t	TotNoOrders;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42NewOrderList;
+
+extern void	fix42_decode_NewOrderList(ofixErr err, fix42NewOrderList m, const char *raw, int len);
+extern void	fix42_decode_NewOrderList_msg(ofixErr err, fix42NewOrderList m, ofixMsg msg);
+extern ofixMsg	fix42_encode_NewOrderList(ofixErr err, fix42NewOrderList m);
+
+// OrderCancelRequest [F]
+enum {
+    FIX42_OrderCancelRequest_BeginString = 0,
+    FIX42_OrderCancelRequest_BodyLength = 1,
+    FIX42_OrderCancelRequest_MsgType = 2,
+    FIX42_OrderCancelRequest_SenderCompID = 3,
+    FIX42_OrderCancelRequest_TargetCompID = 4,
+    FIX42_OrderCancelRequest_OnBehalfOfCompID = 5,
+    FIX42_OrderCancelRequest_DeliverToCompID = 6,
+    FIX42_OrderCancelRequest_SecureDataLen = 7,
+    FIX42_OrderCancelRequest_SecureData = 8,
+    FIX42_OrderCancelRequest_MsgSeqNum = 9,
+    FIX42_OrderCancelRequest_SenderSubID = 10,
+    FIX42_OrderCancelRequest_SenderLocationID = 11,
+    FIX42_OrderCancelRequest_TargetSubID = 12,
+    FIX42_OrderCancelRequest_TargetLocationID = 13,
+    FIX42_OrderCancelRequest_OnBehalfOfSubID = 14,
+    FIX42_OrderCancelRequest_OnBehalfOfLocationID = 15,
+    FIX42_OrderCancelRequest_DeliverToSubID = 16,
+    FIX42_OrderCancelRequest_DeliverToLocationID = 17,
+    FIX42_OrderCancelRequest_PossDupFlag = 18,
+    FIX42_OrderCancelRequest_PossResend = 19,
+    FIX42_OrderCancelRequest_SendingTime = 20,
+    FIX42_OrderCancelRequest_OrigSendingTime = 21,
+    FIX42_OrderCancelRequest_XmlDataLen = 22,
+    FIX42_OrderCancelRequest_XmlData = 23,
+    FIX42_OrderCancelRequest_MessageEncoding = 24,
+    FIX42_OrderCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_OrderCancelRequest_OnBehalfOfSendingTime = 26,
+    FIX42_OrderCancelRequest_OrigClOrdID = 27,
+    FIX42_OrderCancelRequest_OrderID = 28,
+    FIX42_OrderCancelRequest_ClOrdID = 29,
+    FIX42_OrderCancelRequest_ListID = 30,
+    FIX42_OrderCancelRequest_Account = 31,
+    FIX42_OrderCancelRequest_ClientID = 32,
+    FIX42_OrderCancelRequest_ExecBroker = 33,
+    FIX42_OrderCancelRequest_Symbol = 34,
+    FIX42_OrderCancelRequest_SymbolSfx = 35,
+    FIX42_OrderCancelRequest_SecurityID = 36,
+    FIX42_OrderCancelRequest_IDSource = 37,
+    FIX42_OrderCancelRequest_SecurityType = 38,
+    FIX42_OrderCancelRequest_MaturityMonthYear = 39,
+    FIX42_OrderCancelRequest_MaturityDay = 40,
+    FIX42_OrderCancelRequest_PutOrCall = 41,
+    FIX42_OrderCancelRequest_StrikePrice = 42,
+    FIX42_OrderCancelRequest_OptAttribute = 43,
+    FIX42_OrderCancelRequest_ContractMultiplier = 44,
+    FIX42_OrderCancelRequest_CouponRate = 45,
+    FIX42_OrderCancelRequest_SecurityExchange = 46,
+    FIX42_OrderCancelRequest_Issuer = 47,
+    FIX42_OrderCancelRequest_EncodedIssuerLen = 48,
+    FIX42_OrderCancelRequest_EncodedIssuer = 49,
+    FIX42_OrderCancelRequest_SecurityDesc = 50,
+    FIX42_OrderCancelRequest_EncodedSecurityDescLen = 51,
+    FIX42_OrderCancelRequest_EncodedSecurityDesc = 52,
+    FIX42_OrderCancelRequest_Side = 53,
+    FIX42_OrderCancelRequest_TransactTime = 54,
+    FIX42_OrderCancelRequest_OrderQty = 55,
+    FIX42_OrderCancelRequest_CashOrderQty = 56,
+    FIX42_OrderCancelRequest_ComplianceID = 57,
+    FIX42_OrderCancelRequest_SolicitedFlag = 58,
+    FIX42_OrderCancelRequest_Text = 59,
+    FIX42_OrderCancelRequest_EncodedTextLen = 60,
+    FIX42_OrderCancelRequest_EncodedText = 61,
+    FIX42_OrderCancelRequest_SignatureLength = 62,
+    FIX42_OrderCancelRequest_Signature = 63,
+    FIX42_OrderCancelRequest_CheckSum = 64,
+};
+
+typedef struct _fix42OrderCancelRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42OrderCancelRequest;
+
+extern void	fix42_decode_OrderCancelRequest(ofixErr err, fix42OrderCancelRequest m, const char *raw, int len);
+extern void	fix42_decode_OrderCancelRequest_msg(ofixErr err, fix42OrderCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_OrderCancelRequest(ofixErr err, fix42OrderCancelRequest m);
+
+// OrderCancelReplaceRequest [G]
+enum {
+    FIX42_OrderCancelReplaceRequest_BeginString = 0,
+    FIX42_OrderCancelReplaceRequest_BodyLength = 1,
+    FIX42_OrderCancelReplaceRequest_MsgType = 2,
+    FIX42_OrderCancelReplaceRequest_SenderCompID = 3,
+    FIX42_OrderCancelReplaceRequest_TargetCompID = 4,
+    FIX42_OrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX42_OrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX42_OrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX42_OrderCancelReplaceRequest_SecureData = 8,
+    FIX42_OrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX42_OrderCancelReplaceRequest_SenderSubID = 10,
+    FIX42_OrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX42_OrderCancelReplaceRequest_TargetSubID = 12,
+    FIX42_OrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX42_OrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX42_OrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX42_OrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX42_OrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX42_OrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX42_OrderCancelReplaceRequest_PossResend = 19,
+    FIX42_OrderCancelReplaceRequest_SendingTime = 20,
+    FIX42_OrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX42_OrderCancelReplaceRequest_XmlDataLen = 22,
+    FIX42_OrderCancelReplaceRequest_XmlData = 23,
+    FIX42_OrderCancelReplaceRequest_MessageEncoding = 24,
+    FIX42_OrderCancelReplaceRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_OrderCancelReplaceRequest_OnBehalfOfSendingTime = 26,
+    FIX42_OrderCancelReplaceRequest_OrderID = 27,
+    FIX42_OrderCancelReplaceRequest_ClientID = 28,
+    FIX42_OrderCancelReplaceRequest_ExecBroker = 29,
+    FIX42_OrderCancelReplaceRequest_OrigClOrdID = 30,
+    FIX42_OrderCancelReplaceRequest_ClOrdID = 31,
+    FIX42_OrderCancelReplaceRequest_ListID = 32,
+    FIX42_OrderCancelReplaceRequest_Account = 33,
+    FIX42_OrderCancelReplaceRequest_NoAllocs = 34,
+    FIX42_OrderCancelReplaceRequest_SettlmntTyp = 35,
+    FIX42_OrderCancelReplaceRequest_FutSettDate = 36,
+    FIX42_OrderCancelReplaceRequest_HandlInst = 37,
+    FIX42_OrderCancelReplaceRequest_ExecInst = 38,
+    FIX42_OrderCancelReplaceRequest_MinQty = 39,
+    FIX42_OrderCancelReplaceRequest_MaxFloor = 40,
+    FIX42_OrderCancelReplaceRequest_ExDestination = 41,
+    FIX42_OrderCancelReplaceRequest_NoTradingSessions = 42,
+    FIX42_OrderCancelReplaceRequest_Symbol = 43,
+    FIX42_OrderCancelReplaceRequest_SymbolSfx = 44,
+    FIX42_OrderCancelReplaceRequest_SecurityID = 45,
+    FIX42_OrderCancelReplaceRequest_IDSource = 46,
+    FIX42_OrderCancelReplaceRequest_SecurityType = 47,
+    FIX42_OrderCancelReplaceRequest_MaturityMonthYear = 48,
+    FIX42_OrderCancelReplaceRequest_MaturityDay = 49,
+    FIX42_OrderCancelReplaceRequest_PutOrCall = 50,
+    FIX42_OrderCancelReplaceRequest_StrikePrice = 51,
+    FIX42_OrderCancelReplaceRequest_OptAttribute = 52,
+    FIX42_OrderCancelReplaceRequest_ContractMultiplier = 53,
+    FIX42_OrderCancelReplaceRequest_CouponRate = 54,
+    FIX42_OrderCancelReplaceRequest_SecurityExchange = 55,
+    FIX42_OrderCancelReplaceRequest_Issuer = 56,
+    FIX42_OrderCancelReplaceRequest_EncodedIssuerLen = 57,
+    FIX42_OrderCancelReplaceRequest_EncodedIssuer = 58,
+    FIX42_OrderCancelReplaceRequest_SecurityDesc = 59,
+    FIX42_OrderCancelReplaceRequest_EncodedSecurityDescLen = 60,
+    FIX42_OrderCancelReplaceRequest_EncodedSecurityDesc = 61,
+    FIX42_OrderCancelReplaceRequest_Side = 62,
+    FIX42_OrderCancelReplaceRequest_TransactTime = 63,
+    FIX42_OrderCancelReplaceRequest_OrderQty = 64,
+    FIX42_OrderCancelReplaceRequest_CashOrderQty = 65,
+    FIX42_OrderCancelReplaceRequest_OrdType = 66,
+    FIX42_OrderCancelReplaceRequest_Price = 67,
+    FIX42_OrderCancelReplaceRequest_StopPx = 68,
+    FIX42_OrderCancelReplaceRequest_PegDifference = 69,
+    FIX42_OrderCancelReplaceRequest_DiscretionInst = 70,
+    FIX42_OrderCancelReplaceRequest_DiscretionOffset = 71,
+    FIX42_OrderCancelReplaceRequest_ComplianceID = 72,
+    FIX42_OrderCancelReplaceRequest_SolicitedFlag = 73,
+    FIX42_OrderCancelReplaceRequest_Currency = 74,
+    FIX42_OrderCancelReplaceRequest_TimeInForce = 75,
+    FIX42_OrderCancelReplaceRequest_EffectiveTime = 76,
+    FIX42_OrderCancelReplaceRequest_ExpireDate = 77,
+    FIX42_OrderCancelReplaceRequest_ExpireTime = 78,
+    FIX42_OrderCancelReplaceRequest_GTBookingInst = 79,
+    FIX42_OrderCancelReplaceRequest_Commission = 80,
+    FIX42_OrderCancelReplaceRequest_CommType = 81,
+    FIX42_OrderCancelReplaceRequest_Rule80A = 82,
+    FIX42_OrderCancelReplaceRequest_ForexReq = 83,
+    FIX42_OrderCancelReplaceRequest_SettlCurrency = 84,
+    FIX42_OrderCancelReplaceRequest_Text = 85,
+    FIX42_OrderCancelReplaceRequest_EncodedTextLen = 86,
+    FIX42_OrderCancelReplaceRequest_EncodedText = 87,
+    FIX42_OrderCancelReplaceRequest_FutSettDate2 = 88,
+    FIX42_OrderCancelReplaceRequest_OrderQty2 = 89,
+    FIX42_OrderCancelReplaceRequest_OpenClose = 90,
+    FIX42_OrderCancelReplaceRequest_CoveredOrUncovered = 91,
+    FIX42_OrderCancelReplaceRequest_CustomerOrFirm = 92,
+    FIX42_OrderCancelReplaceRequest_MaxShow = 93,
+    FIX42_OrderCancelReplaceRequest_LocateReqd = 94,
+    FIX42_OrderCancelReplaceRequest_ClearingFirm = 95,
+    FIX42_OrderCancelReplaceRequest_ClearingAccount = 96,
+    FIX42_OrderCancelReplaceRequest_SignatureLength = 97,
+    FIX42_OrderCancelReplaceRequest_Signature = 98,
+    FIX42_OrderCancelReplaceRequest_CheckSum = 99,
+};
+
+typedef struct _fix42OrderCancelReplaceRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Account;
+    int64_t	NoAllocs;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    char	OrdType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	Currency;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    char	Rule80A;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    char	OpenClose;
+    int64_t	CoveredOrUncovered;
+    int64_t	CustomerOrFirm;
+    struct _ofixDecimal	MaxShow;
+    char	LocateReqd;
+    struct _ofixStrView	ClearingFirm;
+    struct _ofixStrView	ClearingAccount;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42OrderCancelReplaceRequest;
+
+extern void	fix42_decode_OrderCancelReplaceRequest(ofixErr err, fix42OrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix42_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix42OrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_OrderCancelReplaceRequest(ofixErr err, fix42OrderCancelReplaceRequest m);
+
+// OrderStatusRequest [H]
+enum {
+    FIX42_OrderStatusRequest_BeginString = 0,
+    FIX42_OrderStatusRequest_BodyLength = 1,
+    FIX42_OrderStatusRequest_MsgType = 2,
+    FIX42_OrderStatusRequest_SenderCompID = 3,
+    FIX42_OrderStatusRequest_TargetCompID = 4,
+    FIX42_OrderStatusRequest_OnBehalfOfCompID = 5,
+    FIX42_OrderStatusRequest_DeliverToCompID = 6,
+    FIX42_OrderStatusRequest_SecureDataLen = 7,
+    FIX42_OrderStatusRequest_SecureData = 8,
+    FIX42_OrderStatusRequest_MsgSeqNum = 9,
+    FIX42_OrderStatusRequest_SenderSubID = 10,
+    FIX42_OrderStatusRequest_SenderLocationID = 11,
+    FIX42_OrderStatusRequest_TargetSubID = 12,
+    FIX42_OrderStatusRequest_TargetLocationID = 13,
+    FIX42_OrderStatusRequest_OnBehalfOfSubID = 14,
+    FIX42_OrderStatusRequest_OnBehalfOfLocationID = 15,
+    FIX42_OrderStatusRequest_DeliverToSubID = 16,
+    FIX42_OrderStatusRequest_DeliverToLocationID = 17,
+    FIX42_OrderStatusRequest_PossDupFlag = 18,
+    FIX42_OrderStatusRequest_PossResend = 19,
+    FIX42_OrderStatusRequest_SendingTime = 20,
+    FIX42_OrderStatusRequest_OrigSendingTime = 21,
+    FIX42_OrderStatusRequest_XmlDataLen = 22,
+    FIX42_OrderStatusRequest_XmlData = 23,
+    FIX42_OrderStatusRequest_MessageEncoding = 24,
+    FIX42_OrderStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_OrderStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX42_OrderStatusRequest_OrderID = 27,
+    FIX42_OrderStatusRequest_ClOrdID = 28,
+    FIX42_OrderStatusRequest_ClientID = 29,
+    FIX42_OrderStatusRequest_Account = 30,
+    FIX42_OrderStatusRequest_ExecBroker = 31,
+    FIX42_OrderStatusRequest_Symbol = 32,
+    FIX42_OrderStatusRequest_SymbolSfx = 33,
+    FIX42_OrderStatusRequest_SecurityID = 34,
+    FIX42_OrderStatusRequest_IDSource = 35,
+    FIX42_OrderStatusRequest_SecurityType = 36,
+    FIX42_OrderStatusRequest_MaturityMonthYear = 37,
+    FIX42_OrderStatusRequest_MaturityDay = 38,
+    FIX42_OrderStatusRequest_PutOrCall = 39,
+    FIX42_OrderStatusRequest_StrikePrice = 40,
+    FIX42_OrderStatusRequest_OptAttribute = 41,
+    FIX42_OrderStatusRequest_ContractMultiplier = 42,
+    FIX42_OrderStatusRequest_CouponRate = 43,
+    FIX42_OrderStatusRequest_SecurityExchange = 44,
+    FIX42_OrderStatusRequest_Issuer = 45,
+    FIX42_OrderStatusRequest_EncodedIssuerLen = 46,
+    FIX42_OrderStatusRequest_EncodedIssuer = 47,
+    FIX42_OrderStatusRequest_SecurityDesc = 48,
+    FIX42_OrderStatusRequest_EncodedSecurityDescLen = 49,
+    FIX42_OrderStatusRequest_EncodedSecurityDesc = 50,
+    FIX42_OrderStatusRequest_Side = 51,
+    FIX42_OrderStatusRequest_SignatureLength = 52,
+    FIX42_OrderStatusRequest_Signature = 53,
+    FIX42_OrderStatusRequest_CheckSum = 54,
+};
+
+typedef struct _fix42OrderStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42OrderStatusRequest;
+
+extern void	fix42_decode_OrderStatusRequest(ofixErr err, fix42OrderStatusRequest m, const char *raw, int len);
+extern void	fix42_decode_OrderStatusRequest_msg(ofixErr err, fix42OrderStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_OrderStatusRequest(ofixErr err, fix42OrderStatusRequest m);
+
+// Allocation [J]
+enum {
+    FIX42_Allocation_BeginString = 0,
+    FIX42_Allocation_BodyLength = 1,
+    FIX42_Allocation_MsgType = 2,
+    FIX42_Allocation_SenderCompID = 3,
+    FIX42_Allocation_TargetCompID = 4,
+    FIX42_Allocation_OnBehalfOfCompID = 5,
+    FIX42_Allocation_DeliverToCompID = 6,
+    FIX42_Allocation_SecureDataLen = 7,
+    FIX42_Allocation_SecureData = 8,
+    FIX42_Allocation_MsgSeqNum = 9,
+    FIX42_Allocation_SenderSubID = 10,
+    FIX42_Allocation_SenderLocationID = 11,
+    FIX42_Allocation_TargetSubID = 12,
+    FIX42_Allocation_TargetLocationID = 13,
+    FIX42_Allocation_OnBehalfOfSubID = 14,
+    FIX42_Allocation_OnBehalfOfLocationID = 15,
+    FIX42_Allocation_DeliverToSubID = 16,
+    FIX42_Allocation_DeliverToLocationID = 17,
+    FIX42_Allocation_PossDupFlag = 18,
+    FIX42_Allocation_PossResend = 19,
+    FIX42_Allocation_SendingTime = 20,
+    FIX42_Allocation_OrigSendingTime = 21,
+    FIX42_Allocation_XmlDataLen = 22,
+    FIX42_Allocation_XmlData = 23,
+    FIX42_Allocation_MessageEncoding = 24,
+    FIX42_Allocation_LastMsgSeqNumProcessed = 25,
+    FIX42_Allocation_OnBehalfOfSendingTime = 26,
+    FIX42_Allocation_AllocID = 27,
+    FIX42_Allocation_AllocTransType = 28,
+    FIX42_Allocation_RefAllocID = 29,
+    FIX42_Allocation_AllocLinkID = 30,
+    FIX42_Allocation_AllocLinkType = 31,
+    FIX42_Allocation_NoOrders = 32,
+    FIX42_Allocation_NoExecs = 33,
+    FIX42_Allocation_Side = 34,
+    FIX42_Allocation_Symbol = 35,
+    FIX42_Allocation_SymbolSfx = 36,
+    FIX42_Allocation_SecurityID = 37,
+    FIX42_Allocation_IDSource = 38,
+    FIX42_Allocation_SecurityType = 39,
+    FIX42_Allocation_MaturityMonthYear = 40,
+    FIX42_Allocation_MaturityDay = 41,
+    FIX42_Allocation_PutOrCall = 42,
+    FIX42_Allocation_StrikePrice = 43,
+    FIX42_Allocation_OptAttribute = 44,
+    FIX42_Allocation_ContractMultiplier = 45,
+    FIX42_Allocation_CouponRate = 46,
+    FIX42_Allocation_SecurityExchange = 47,
+    FIX42_Allocation_Issuer = 48,
+    FIX42_Allocation_EncodedIssuerLen = 49,
+    FIX42_Allocation_EncodedIssuer = 50,
+    FIX42_Allocation_SecurityDesc = 51,
+    FIX42_Allocation_EncodedSecurityDescLen = 52,
+    FIX42_Allocation_EncodedSecurityDesc = 53,
+    FIX42_Allocation_Shares = 54,
+    FIX42_Allocation_LastMkt = 55,
+    FIX42_Allocation_TradingSessionID = 56,
+    FIX42_Allocation_AvgPx = 57,
+    FIX42_Allocation_Currency = 58,
+    FIX42_Allocation_AvgPrxPrecision = 59,
+    FIX42_Allocation_TradeDate = 60,
+    FIX42_Allocation_TransactTime = 61,
+    FIX42_Allocation_SettlmntTyp = 62,
+    FIX42_Allocation_FutSettDate = 63,
+    FIX42_Allocation_GrossTradeAmt = 64,
+    FIX42_Allocation_NetMoney = 65,
+    FIX42_Allocation_OpenClose = 66,
+    FIX42_Allocation_Text = 67,
+    FIX42_Allocation_EncodedTextLen = 68,
+    FIX42_Allocation_EncodedText = 69,
+    FIX42_Allocation_NumDaysInterest = 70,
+    FIX42_Allocation_AccruedInterestRate = 71,
+    FIX42_Allocation_NoAllocs = 72,
+    FIX42_Allocation_SignatureLength = 73,
+    FIX42_Allocation_Signature = 74,
+    FIX42_Allocation_CheckSum = 75,
+};
+
+typedef struct _fix42Allocation {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	AllocID;
+    char	AllocTransType;
+    struct _ofixStrView	RefAllocID;
+    struct _ofixStrView	AllocLinkID;
+    int64_t	AllocLinkType;
+    int64_t	NoOrders;
+    int64_t	NoExecs;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	Shares;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixStrView	Currency;
+    int64_t	AvgPrxPrecision;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    struct _ofixDecimal	GrossTradeAmt;
+    struct _ofixDecimal	NetMoney;
+    char	OpenClose;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NumDaysInterest;
+    struct _ofixDecimal	AccruedInterestRate;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Allocation;
+
+extern void	fix42_decode_Allocation(ofixErr err, fix42Allocation m, const char *raw, int len);
+extern void	fix42_decode_Allocation_msg(ofixErr err, fix42Allocation m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Allocation(ofixErr err, fix42Allocation m);
+
+// ListCancelRequest [K]
+enum {
+    FIX42_ListCancelRequest_BeginString = 0,
+    FIX42_ListCancelRequest_BodyLength = 1,
+    FIX42_ListCancelRequest_MsgType = 2,
+    FIX42_ListCancelRequest_SenderCompID = 3,
+    FIX42_ListCancelRequest_TargetCompID = 4,
+    FIX42_ListCancelRequest_OnBehalfOfCompID = 5,
+    FIX42_ListCancelRequest_DeliverToCompID = 6,
+    FIX42_ListCancelRequest_SecureDataLen = 7,
+    FIX42_ListCancelRequest_SecureData = 8,
+    FIX42_ListCancelRequest_MsgSeqNum = 9,
+    FIX42_ListCancelRequest_SenderSubID = 10,
+    FIX42_ListCancelRequest_SenderLocationID = 11,
+    FIX42_ListCancelRequest_TargetSubID = 12,
+    FIX42_ListCancelRequest_TargetLocationID = 13,
+    FIX42_ListCancelRequest_OnBehalfOfSubID = 14,
+    FIX42_ListCancelRequest_OnBehalfOfLocationID = 15,
+    FIX42_ListCancelRequest_DeliverToSubID = 16,
+    FIX42_ListCancelRequest_DeliverToLocationID = 17,
+    FIX42_ListCancelRequest_PossDupFlag = 18,
+    FIX42_ListCancelRequest_PossResend = 19,
+    FIX42_ListCancelRequest_SendingTime = 20,
+    FIX42_ListCancelRequest_OrigSendingTime = 21,
+    FIX42_ListCancelRequest_XmlDataLen = 22,
+    FIX42_ListCancelRequest_XmlData = 23,
+    FIX42_ListCancelRequest_MessageEncoding = 24,
+    FIX42_ListCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_ListCancelRequest_OnBehalfOfSendingTime = 26,
+    FIX42_ListCancelRequest_ListID = 27,
+    FIX42_ListCancelRequest_TransactTime = 28,
+    FIX42_ListCancelRequest_Text = 29,
+    FIX42_ListCancelRequest_EncodedTextLen = 30,
+    FIX42_ListCancelRequest_EncodedText = 31,
+    FIX42_ListCancelRequest_SignatureLength = 32,
+    FIX42_ListCancelRequest_Signature = 33,
+    FIX42_ListCancelRequest_CheckSum = 34,
+};
+
+typedef struct _fix42ListCancelRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42ListCancelRequest;
+
+extern void	fix42_decode_ListCancelRequest(ofixErr err, fix42ListCancelRequest m, const char *raw, int len);
+extern void	fix42_decode_ListCancelRequest_msg(ofixErr err, fix42ListCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_ListCancelRequest(ofixErr err, fix42ListCancelRequest m);
+
+// ListExecute [L]
+enum {
+    FIX42_ListExecute_BeginString = 0,
+    FIX42_ListExecute_BodyLength = 1,
+    FIX42_ListExecute_MsgType = 2,
+    FIX42_ListExecute_SenderCompID = 3,
+    FIX42_ListExecute_TargetCompID = 4,
+    FIX42_ListExecute_OnBehalfOfCompID = 5,
+    FIX42_ListExecute_DeliverToCompID = 6,
+    FIX42_ListExecute_SecureDataLen = 7,
+    FIX42_ListExecute_SecureData = 8,
+    FIX42_ListExecute_MsgSeqNum = 9,
+    FIX42_ListExecute_SenderSubID = 10,
+    FIX42_ListExecute_SenderLocationID = 11,
+    FIX42_ListExecute_TargetSubID = 12,
+    FIX42_ListExecute_TargetLocationID = 13,
+    FIX42_ListExecute_OnBehalfOfSubID = 14,
+    FIX42_ListExecute_OnBehalfOfLocationID = 15,
+    FIX42_ListExecute_DeliverToSubID = 16,
+    FIX42_ListExecute_DeliverToLocationID = 17,
+    FIX42_ListExecute_PossDupFlag = 18,
+    FIX42_ListExecute_PossResend = 19,
+    FIX42_ListExecute_SendingTime = 20,
+    FIX42_ListExecute_OrigSendingTime = 21,
+    FIX42_ListExecute_XmlDataLen = 22,
+    FIX42_ListExecute_XmlData = 23,
+    FIX42_ListExecute_MessageEncoding = 24,
+    FIX42_ListExecute_LastMsgSeqNumProcessed = 25,
+    FIX42_ListExecute_OnBehalfOfSendingTime = 26,
+    FIX42_ListExecute_ListID = 27,
+    FIX42_ListExecute_ClientBidID = 28,
+    FIX42_ListExecute_BidID = 29,
+    FIX42_ListExecute_TransactTime = 30,
+    FIX42_ListExecute_Text = 31,
+    FIX42_ListExecute_EncodedTextLen = 32,
+    FIX42_ListExecute_EncodedText = 33,
+    FIX42_ListExecute_SignatureLength = 34,
+    FIX42_ListExecute_Signature = 35,
+    FIX42_ListExecute_CheckSum = 36,
+};
+
+typedef struct _fix42ListExecute {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	ClientBidID;
+    struct _ofixStrView	BidID;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42ListExecute;
+
+extern void	fix42_decode_ListExecute(ofixErr err, fix42ListExecute m, const char *raw, int len);
+extern void	fix42_decode_ListExecute_msg(ofixErr err, fix42ListExecute m, ofixMsg msg);
+extern ofixMsg	fix42_encode_ListExecute(ofixErr err, fix42ListExecute m);
+
+// ListStatusRequest [M]
+enum {
+    FIX42_ListStatusRequest_BeginString = 0,
+    FIX42_ListStatusRequest_BodyLength = 1,
+    FIX42_ListStatusRequest_MsgType = 2,
+    FIX42_ListStatusRequest_SenderCompID = 3,
+    FIX42_ListStatusRequest_TargetCompID = 4,
+    FIX42_ListStatusRequest_OnBehalfOfCompID = 5,
+    FIX42_ListStatusRequest_DeliverToCompID = 6,
+    FIX42_ListStatusRequest_SecureDataLen = 7,
+    FIX42_ListStatusRequest_SecureData = 8,
+    FIX42_ListStatusRequest_MsgSeqNum = 9,
+    FIX42_ListStatusRequest_SenderSubID = 10,
+    FIX42_ListStatusRequest_SenderLocationID = 11,
+    FIX42_ListStatusRequest_TargetSubID = 12,
+    FIX42_ListStatusRequest_TargetLocationID = 13,
+    FIX42_ListStatusRequest_OnBehalfOfSubID = 14,
+    FIX42_ListStatusRequest_OnBehalfOfLocationID = 15,
+    FIX42_ListStatusRequest_DeliverToSubID = 16,
+    FIX42_ListStatusRequest_DeliverToLocationID = 17,
+    FIX42_ListStatusRequest_PossDupFlag = 18,
+    FIX42_ListStatusRequest_PossResend = 19,
+    FIX42_ListStatusRequest_SendingTime = 20,
+    FIX42_ListStatusRequest_OrigSendingTime = 21,
+    FIX42_ListStatusRequest_XmlDataLen = 22,
+    FIX42_ListStatusRequest_XmlData = 23,
+    FIX42_ListStatusRequest_MessageEncoding = 24,
+    FIX42_ListStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_ListStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX42_ListStatusRequest_ListID = 27,
+    FIX42_ListStatusRequest_Text = 28,
+    FIX42_ListStatusRequest_EncodedTextLen = 29,
+    FIX42_ListStatusRequest_EncodedText = 30,
+    FIX42_ListStatusRequest_SignatureLength = 31,
+    FIX42_ListStatusRequest_Signature = 32,
+    FIX42_ListStatusRequest_CheckSum = 33,
+};
+
+typedef struct _fix42ListStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42ListStatusRequest;
+
+extern void	fix42_decode_ListStatusRequest(ofixErr err, fix42ListStatusRequest m, const char *raw, int len);
+extern void	fix42_decode_ListStatusRequest_msg(ofixErr err, fix42ListStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_ListStatusRequest(ofixErr err, fix42ListStatusRequest m);
+
+// ListStatus [N]
+enum {
+    FIX42_ListStatus_BeginString = 0,
+    FIX42_ListStatus_BodyLength = 1,
+    FIX42_ListStatus_MsgType = 2,
+    FIX42_ListStatus_SenderCompID = 3,
+    FIX42_ListStatus_TargetCompID = 4,
+    FIX42_ListStatus_OnBehalfOfCompID = 5,
+    FIX42_ListStatus_DeliverToCompID = 6,
+    FIX42_ListStatus_SecureDataLen = 7,
+    FIX42_ListStatus_SecureData = 8,
+    FIX42_ListStatus_MsgSeqNum = 9,
+    FIX42_ListStatus_SenderSubID = 10,
+    FIX42_ListStatus_SenderLocationID = 11,
+    FIX42_ListStatus_TargetSubID = 12,
+    FIX42_ListStatus_TargetLocationID = 13,
+    FIX42_ListStatus_OnBehalfOfSubID = 14,
+    FIX42_ListStatus_OnBehalfOfLocationID = 15,
+    FIX42_ListStatus_DeliverToSubID = 16,
+    FIX42_ListStatus_DeliverToLocationID = 17,
+    FIX42_ListStatus_PossDupFlag = 18,
+    FIX42_ListStatus_PossResend = 19,
+    FIX42_ListStatus_SendingTime = 20,
+    FIX42_ListStatus_OrigSendingTime = 21,
+    FIX42_ListStatus_XmlDataLen = 22,
+    FIX42_ListStatus_XmlData = 23,
+    FIX42_ListStatus_MessageEncoding = 24,
+    FIX42_ListStatus_LastMsgSeqNumProcessed = 25,
+    FIX42_ListStatus_OnBehalfOfSendingTime = 26,
+    FIX42_ListStatus_ListID = 27,
+    FIX42_ListStatus_ListStatusType = 28,
+    FIX42_ListStatus_NoRpts = 29,
+    FIX42_ListStatus_ListOrderStatus = 30,
+    FIX42_ListStatus_RptSeq = 31,
+    FIX42_ListStatus_ListStatusText = 32,
+    FIX42_ListStatus_EncodedListStatusTextLen = 33,
+    FIX42_ListStatus_EncodedListStatusText = 34,
+    FIX42_ListStatus_TransactTime = 35,
+    FIX42_ListStatus_TotNoOrders = 36,
+    FIX42_ListStatus_NoOrders = 37,
+    FIX42_ListStatus_SignatureLength = 38,
+    FIX42_ListStatus_Signature = 39,
+    FIX42_ListStatus_CheckSum = 40,
+};
+
+typedef struct _fix42ListStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ListID;
+    int64_t	ListStatusType;
+    int64_t	NoRpts;
+    int64_t	ListOrderStatus;
+    int64_t	RptSeq;
+    struct _ofixStrView	ListStatusText;
+    int64_t	EncodedListStatusTextLen;
+    struct _ofixStrView	EncodedListStatusText;
+    struct _ofixDate	TransactTime;
+    int64_t	TotNoOrders;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42ListStatus;
+
+extern void	fix42_decode_ListStatus(ofixErr err, fix42ListStatus m, const char *raw, int len);
+extern void	fix42_decode_ListStatus_msg(ofixErr err, fix42ListStatus m, ofixMsg msg);
+extern ofixMsg	fix42_encode_ListStatus(ofixErr err, fix42ListStatus m);
+
+// AllocationACK [P]
+enum {
+    FIX42_AllocationACK_BeginString = 0,
+    FIX42_AllocationACK_BodyLength = 1,
+    FIX42_AllocationACK_MsgType = 2,
+    FIX42_AllocationACK_SenderCompID = 3,
+    FIX42_AllocationACK_TargetCompID = 4,
+    FIX42_AllocationACK_OnBehalfOfCompID = 5,
+    FIX42_AllocationACK_DeliverToCompID = 6,
+    FIX42_AllocationACK_SecureDataLen = 7,
+    FIX42_AllocationACK_SecureData = 8,
+    FIX42_AllocationACK_MsgSeqNum = 9,
+    FIX42_AllocationACK_SenderSubID = 10,
+    FIX42_AllocationACK_SenderLocationID = 11,
+    FIX42_AllocationACK_TargetSubID = 12,
+    FIX42_AllocationACK_TargetLocationID = 13,
+    FIX42_AllocationACK_OnBehalfOfSubID = 14,
+    FIX42_AllocationACK_OnBehalfOfLocationID = 15,
+    FIX42_AllocationACK_DeliverToSubID = 16,
+    FIX42_AllocationACK_DeliverToLocationID = 17,
+    FIX42_AllocationACK_PossDupFlag = 18,
+    FIX42_AllocationACK_PossResend = 19,
+    FIX42_AllocationACK_SendingTime = 20,
+    FIX42_AllocationACK_OrigSendingTime = 21,
+    FIX42_AllocationACK_XmlDataLen = 22,
+    FIX42_AllocationACK_XmlData = 23,
+    FIX42_AllocationACK_MessageEncoding = 24,
+    FIX42_AllocationACK_LastMsgSeqNumProcessed = 25,
+    FIX42_AllocationACK_OnBehalfOfSendingTime = 26,
+    FIX42_AllocationACK_ClientID = 27,
+    FIX42_AllocationACK_ExecBroker = 28,
+    FIX42_AllocationACK_AllocID = 29,
+    FIX42_AllocationACK_TradeDate = 30,
+    FIX42_AllocationACK_TransactTime = 31,
+    FIX42_AllocationACK_AllocStatus = 32,
+    FIX42_AllocationACK_AllocRejCode = 33,
+    FIX42_AllocationACK_Text = 34,
+    FIX42_AllocationACK_EncodedTextLen = 35,
+    FIX42_AllocationACK_EncodedText = 36,
+    FIX42_AllocationACK_SignatureLength = 37,
+    FIX42_AllocationACK_Signature = 38,
+    FIX42_AllocationACK_CheckSum = 39,
+};
+
+typedef struct _fix42AllocationACK {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    int64_t	AllocStatus;
+    int64_t	AllocRejCode;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42AllocationACK;
+
+extern void	fix42_decode_AllocationACK(ofixErr err, fix42AllocationACK m, const char *raw, int len);
+extern void	fix42_decode_AllocationACK_msg(ofixErr err, fix42AllocationACK m, ofixMsg msg);
+extern ofixMsg	fix42_encode_AllocationACK(ofixErr err, fix42AllocationACK m);
+
+// DontKnowTrade [Q]
+enum {
+    FIX42_DontKnowTrade_BeginString = 0,
+    FIX42_DontKnowTrade_BodyLength = 1,
+    FIX42_DontKnowTrade_MsgType = 2,
+    FIX42_DontKnowTrade_SenderCompID = 3,
+    FIX42_DontKnowTrade_TargetCompID = 4,
+    FIX42_DontKnowTrade_OnBehalfOfCompID = 5,
+    FIX42_DontKnowTrade_DeliverToCompID = 6,
+    FIX42_DontKnowTrade_SecureDataLen = 7,
+    FIX42_DontKnowTrade_SecureData = 8,
+    FIX42_DontKnowTrade_MsgSeqNum = 9,
+    FIX42_DontKnowTrade_SenderSubID = 10,
+    FIX42_DontKnowTrade_SenderLocationID = 11,
+    FIX42_DontKnowTrade_TargetSubID = 12,
+    FIX42_DontKnowTrade_TargetLocationID = 13,
+    FIX42_DontKnowTrade_OnBehalfOfSubID = 14,
+    FIX42_DontKnowTrade_OnBehalfOfLocationID = 15,
+    FIX42_DontKnowTrade_DeliverToSubID = 16,
+    FIX42_DontKnowTrade_DeliverToLocationID = 17,
+    FIX42_DontKnowTrade_PossDupFlag = 18,
+    FIX42_DontKnowTrade_PossResend = 19,
+    FIX42_DontKnowTrade_SendingTime = 20,
+    FIX42_DontKnowTrade_OrigSendingTime = 21,
+    FIX42_DontKnowTrade_XmlDataLen = 22,
+    FIX42_DontKnowTrade_XmlData = 23,
+    FIX42_DontKnowTrade_MessageEncoding = 24,
+    FIX42_DontKnowTrade_LastMsgSeqNumProcessed = 25,
+    FIX42_DontKnowTrade_OnBehalfOfSendingTime = 26,
+    FIX42_DontKnowTrade_OrderID = 27,
+    FIX42_DontKnowTrade_ExecID = 28,
+    FIX42_DontKnowTrade_DKReason = 29,
+    FIX42_DontKnowTrade_Symbol = 30,
+    FIX42_DontKnowTrade_SymbolSfx = 31,
+    FIX42_DontKnowTrade_SecurityID = 32,
+    FIX42_DontKnowTrade_IDSource = 33,
+    FIX42_DontKnowTrade_SecurityType = 34,
+    FIX42_DontKnowTrade_MaturityMonthYear = 35,
+    FIX42_DontKnowTrade_MaturityDay = 36,
+    FIX42_DontKnowTrade_PutOrCall = 37,
+    FIX42_DontKnowTrade_StrikePrice = 38,
+    FIX42_DontKnowTrade_OptAttribute = 39,
+    FIX42_DontKnowTrade_ContractMultiplier = 40,
+    FIX42_DontKnowTrade_CouponRate = 41,
+    FIX42_DontKnowTrade_SecurityExchange = 42,
+    FIX42_DontKnowTrade_Issuer = 43,
+    FIX42_DontKnowTrade_EncodedIssuerLen = 44,
+    FIX42_DontKnowTrade_EncodedIssuer = 45,
+    FIX42_DontKnowTrade_SecurityDesc = 46,
+    FIX42_DontKnowTrade_EncodedSecurityDescLen = 47,
+    FIX42_DontKnowTrade_EncodedSecurityDesc = 48,
+    FIX42_DontKnowTrade_Side = 49,
+    FIX42_DontKnowTrade_OrderQty = 50,
+    FIX42_DontKnowTrade_CashOrderQty = 51,
+    FIX42_DontKnowTrade_LastShares = 52,
+    FIX42_DontKnowTrade_LastPx = 53,
+    FIX42_DontKnowTrade_Text = 54,
+    FIX42_DontKnowTrade_EncodedTextLen = 55,
+    FIX42_DontKnowTrade_EncodedText = 56,
+    FIX42_DontKnowTrade_SignatureLength = 57,
+    FIX42_DontKnowTrade_Signature = 58,
+    FIX42_DontKnowTrade_CheckSum = 59,
+};
+
+typedef struct _fix42DontKnowTrade {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ExecID;
+    char	DKReason;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	LastShares;
+    struct _ofixDecimal	LastPx;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42DontKnowTrade;
+
+extern void	fix42_decode_DontKnowTrade(ofixErr err, fix42DontKnowTrade m, const char *raw, int len);
+extern void	fix42_decode_DontKnowTrade_msg(ofixErr err, fix42DontKnowTrade m, ofixMsg msg);
+extern ofixMsg	fix42_encode_DontKnowTrade(ofixErr err, fix42DontKnowTrade m);
+
+// QuoteRequest [R]
+enum {
+    FIX42_QuoteRequest_BeginString = 0,
+    FIX42_QuoteRequest_BodyLength = 1,
+    FIX42_QuoteRequest_MsgType = 2,
+    FIX42_QuoteRequest_SenderCompID = 3,
+    FIX42_QuoteRequest_TargetCompID = 4,
+    FIX42_QuoteRequest_OnBehalfOfCompID = 5,
+    FIX42_QuoteRequest_DeliverToCompID = 6,
+    FIX42_QuoteRequest_SecureDataLen = 7,
+    FIX42_QuoteRequest_SecureData = 8,
+    FIX42_QuoteRequest_MsgSeqNum = 9,
+    FIX42_QuoteRequest_SenderSubID = 10,
+    FIX42_QuoteRequest_SenderLocationID = 11,
+    FIX42_QuoteRequest_TargetSubID = 12,
+    FIX42_QuoteRequest_TargetLocationID = 13,
+    FIX42_QuoteRequest_OnBehalfOfSubID = 14,
+    FIX42_QuoteRequest_OnBehalfOfLocationID = 15,
+    FIX42_QuoteRequest_DeliverToSubID = 16,
+    FIX42_QuoteRequest_DeliverToLocationID = 17,
+    FIX42_QuoteRequest_PossDupFlag = 18,
+    FIX42_QuoteRequest_PossResend = 19,
+    FIX42_QuoteRequest_SendingTime = 20,
+    FIX42_QuoteRequest_OrigSendingTime = 21,
+    FIX42_QuoteRequest_XmlDataLen = 22,
+    FIX42_QuoteRequest_XmlData = 23,
+    FIX42_QuoteRequest_MessageEncoding = 24,
+    FIX42_QuoteRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_QuoteRequest_OnBehalfOfSendingTime = 26,
+    FIX42_QuoteRequest_QuoteReqID = 27,
+    FIX42_QuoteRequest_NoRelatedSym = 28,
+    FIX42_QuoteRequest_SignatureLength = 29,
+    FIX42_QuoteRequest_Signature = 30,
+    FIX42_QuoteRequest_CheckSum = 31,
+};
+
+typedef struct _fix42QuoteRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42QuoteRequest;
+
+extern void	fix42_decode_QuoteRequest(ofixErr err, fix42QuoteRequest m, const char *raw, int len);
+extern void	fix42_decode_QuoteRequest_msg(ofixErr err, fix42QuoteRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_QuoteRequest(ofixErr err, fix42QuoteRequest m);
+
+// Quote [S]
+enum {
+    FIX42_Quote_BeginString = 0,
+    FIX42_Quote_BodyLength = 1,
+    FIX42_Quote_MsgType = 2,
+    FIX42_Quote_SenderCompID = 3,
+    FIX42_Quote_TargetCompID = 4,
+    FIX42_Quote_OnBehalfOfCompID = 5,
+    FIX42_Quote_DeliverToCompID = 6,
+    FIX42_Quote_SecureDataLen = 7,
+    FIX42_Quote_SecureData = 8,
+    FIX42_Quote_MsgSeqNum = 9,
+    FIX42_Quote_SenderSubID = 10,
+    FIX42_Quote_SenderLocationID = 11,
+    FIX42_Quote_TargetSubID = 12,
+    FIX42_Quote_TargetLocationID = 13,
+    FIX42_Quote_OnBehalfOfSubID = 14,
+    FIX42_Quote_OnBehalfOfLocationID = 15,
+    FIX42_Quote_DeliverToSubID = 16,
+    FIX42_Quote_DeliverToLocationID = 17,
+    FIX42_Quote_PossDupFlag = 18,
+    FIX42_Quote_PossResend = 19,
+    FIX42_Quote_SendingTime = 20,
+    FIX42_Quote_OrigSendingTime = 21,
+    FIX42_Quote_XmlDataLen = 22,
+    FIX42_Quote_XmlData = 23,
+    FIX42_Quote_MessageEncoding = 24,
+    FIX42_Quote_LastMsgSeqNumProcessed = 25,
+    FIX42_Quote_OnBehalfOfSendingTime = 26,
+    FIX42_Quote_QuoteReqID = 27,
+    FIX42_Quote_QuoteID = 28,
+    FIX42_Quote_QuoteResponseLevel = 29,
+    FIX42_Quote_TradingSessionID = 30,
+    FIX42_Quote_Symbol = 31,
+    FIX42_Quote_SymbolSfx = 32,
+    FIX42_Quote_SecurityID = 33,
+    FIX42_Quote_IDSource = 34,
+    FIX42_Quote_SecurityType = 35,
+    FIX42_Quote_MaturityMonthYear = 36,
+    FIX42_Quote_MaturityDay = 37,
+    FIX42_Quote_PutOrCall = 38,
+    FIX42_Quote_StrikePrice = 39,
+    FIX42_Quote_OptAttribute = 40,
+    FIX42_Quote_ContractMultiplier = 41,
+    FIX42_Quote_CouponRate = 42,
+    FIX42_Quote_SecurityExchange = 43,
+    FIX42_Quote_Issuer = 44,
+    FIX42_Quote_EncodedIssuerLen = 45,
+    FIX42_Quote_EncodedIssuer = 46,
+    FIX42_Quote_SecurityDesc = 47,
+    FIX42_Quote_EncodedSecurityDescLen = 48,
+    FIX42_Quote_EncodedSecurityDesc = 49,
+    FIX42_Quote_BidPx = 50,
+    FIX42_Quote_OfferPx = 51,
+    FIX42_Quote_BidSize = 52,
+    FIX42_Quote_OfferSize = 53,
+    FIX42_Quote_ValidUntilTime = 54,
+    FIX42_Quote_BidSpotRate = 55,
+    FIX42_Quote_OfferSpotRate = 56,
+    FIX42_Quote_BidForwardPoints = 57,
+    FIX42_Quote_OfferForwardPoints = 58,
+    FIX42_Quote_TransactTime = 59,
+    FIX42_Quote_FutSettDate = 60,
+    FIX42_Quote_OrdType = 61,
+    FIX42_Quote_FutSettDate2 = 62,
+    FIX42_Quote_OrderQty2 = 63,
+    FIX42_Quote_Currency = 64,
+    FIX42_Quote_SignatureLength = 65,
+    FIX42_Quote_Signature = 66,
+    FIX42_Quote_CheckSum = 67,
+};
+
+typedef struct _fix42Quote {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteResponseLevel;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    struct _ofixDecimal	BidSize;
+    struct _ofixDecimal	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixDecimal	BidSpotRate;
+    struct _ofixDecimal	OfferSpotRate;
+    struct _ofixDecimal	BidForwardPoints;
+    struct _ofixDecimal	OfferForwardPoints;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	FutSettDate;
+    char	OrdType;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	Currency;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42Quote;
+
+extern void	fix42_decode_Quote(ofixErr err, fix42Quote m, const char *raw, int len);
+extern void	fix42_decode_Quote_msg(ofixErr err, fix42Quote m, ofixMsg msg);
+extern ofixMsg	fix42_encode_Quote(ofixErr err, fix42Quote m);
+
+// SettlementInstructions [T]
+enum {
+    FIX42_SettlementInstructions_BeginString = 0,
+    FIX42_SettlementInstructions_BodyLength = 1,
+    FIX42_SettlementInstructions_MsgType = 2,
+    FIX42_SettlementInstructions_SenderCompID = 3,
+    FIX42_SettlementInstructions_TargetCompID = 4,
+    FIX42_SettlementInstructions_OnBehalfOfCompID = 5,
+    FIX42_SettlementInstructions_DeliverToCompID = 6,
+    FIX42_SettlementInstructions_SecureDataLen = 7,
+    FIX42_SettlementInstructions_SecureData = 8,
+    FIX42_SettlementInstructions_MsgSeqNum = 9,
+    FIX42_SettlementInstructions_SenderSubID = 10,
+    FIX42_SettlementInstructions_SenderLocationID = 11,
+    FIX42_SettlementInstructions_TargetSubID = 12,
+    FIX42_SettlementInstructions_TargetLocationID = 13,
+    FIX42_SettlementInstructions_OnBehalfOfSubID = 14,
+    FIX42_SettlementInstructions_OnBehalfOfLocationID = 15,
+    FIX42_SettlementInstructions_DeliverToSubID = 16,
+    FIX42_SettlementInstructions_DeliverToLocationID = 17,
+    FIX42_SettlementInstructions_PossDupFlag = 18,
+    FIX42_SettlementInstructions_PossResend = 19,
+    FIX42_SettlementInstructions_SendingTime = 20,
+    FIX42_SettlementInstructions_OrigSendingTime = 21,
+    FIX42_SettlementInstructions_XmlDataLen = 22,
+    FIX42_SettlementInstructions_XmlData = 23,
+    FIX42_SettlementInstructions_MessageEncoding = 24,
+    FIX42_SettlementInstructions_LastMsgSeqNumProcessed = 25,
+    FIX42_SettlementInstructions_OnBehalfOfSendingTime = 26,
+    FIX42_SettlementInstructions_SettlInstID = 27,
+    FIX42_SettlementInstructions_SettlInstTransType = 28,
+    FIX42_SettlementInstructions_SettlInstRefID = 29,
+    FIX42_SettlementInstructions_SettlInstMode = 30,
+    FIX42_SettlementInstructions_SettlInstSource = 31,
+    FIX42_SettlementInstructions_AllocAccount = 32,
+    FIX42_SettlementInstructions_SettlLocation = 33,
+    FIX42_SettlementInstructions_TradeDate = 34,
+    FIX42_SettlementInstructions_AllocID = 35,
+    FIX42_SettlementInstructions_LastMkt = 36,
+    FIX42_SettlementInstructions_TradingSessionID = 37,
+    FIX42_SettlementInstructions_Side = 38,
+    FIX42_SettlementInstructions_SecurityType = 39,
+    FIX42_SettlementInstructions_EffectiveTime = 40,
+    FIX42_SettlementInstructions_TransactTime = 41,
+    FIX42_SettlementInstructions_ClientID = 42,
+    FIX42_SettlementInstructions_ExecBroker = 43,
+    FIX42_SettlementInstructions_StandInstDbType = 44,
+    FIX42_SettlementInstructions_StandInstDbName = 45,
+    FIX42_SettlementInstructions_StandInstDbID = 46,
+    FIX42_SettlementInstructions_SettlDeliveryType = 47,
+    FIX42_SettlementInstructions_SettlDepositoryCode = 48,
+    FIX42_SettlementInstructions_SettlBrkrCode = 49,
+    FIX42_SettlementInstructions_SettlInstCode = 50,
+    FIX42_SettlementInstructions_SecuritySettlAgentName = 51,
+    FIX42_SettlementInstructions_SecuritySettlAgentCode = 52,
+    FIX42_SettlementInstructions_SecuritySettlAgentAcctNum = 53,
+    FIX42_SettlementInstructions_SecuritySettlAgentAcctName = 54,
+    FIX42_SettlementInstructions_SecuritySettlAgentContactName = 55,
+    FIX42_SettlementInstructions_SecuritySettlAgentContactPhone = 56,
+    FIX42_SettlementInstructions_CashSettlAgentName = 57,
+    FIX42_SettlementInstructions_CashSettlAgentCode = 58,
+    FIX42_SettlementInstructions_CashSettlAgentAcctNum = 59,
+    FIX42_SettlementInstructions_CashSettlAgentAcctName = 60,
+    FIX42_SettlementInstructions_CashSettlAgentContactName = 61,
+    FIX42_SettlementInstructions_CashSettlAgentContactPhone = 62,
+    FIX42_SettlementInstructions_SignatureLength = 63,
+    FIX42_SettlementInstructions_Signature = 64,
+    FIX42_SettlementInstructions_CheckSum = 65,
+};
+
+typedef struct _fix42SettlementInstructions {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	SettlInstID;
+    char	SettlInstTransType;
+    struct _ofixStrView	SettlInstRefID;
+    char	SettlInstMode;
+    char	SettlInstSource;
+    struct _ofixStrView	AllocAccount;
+    struct _ofixStrView	SettlLocation;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    char	Side;
+    struct _ofixStrView	SecurityType;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	ClientID;
+    struct _ofixStrView	ExecBroker;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	SettlDeliveryType;
+    struct _ofixStrView	SettlDepositoryCode;
+    struct _ofixStrView	SettlBrkrCode;
+    struct _ofixStrView	SettlInstCode;
+    struct _ofixStrView	SecuritySettlAgentName;
+    struct _ofixStrView	SecuritySettlAgentCode;
+    struct _ofixStrView	SecuritySettlAgentAcctNum;
+    struct _ofixStrView	SecuritySettlAgentAcctName;
+    struct _ofixStrView	SecuritySettlAgentContactName;
+    struct _ofixStrView	SecuritySettlAgentContactPhone;
+    struct _ofixStrView	CashSettlAgentName;
+    struct _ofixStrView	CashSettlAgentCode;
+    struct _ofixStrView	CashSettlAgentAcctNum;
+    struct _ofixStrView	CashSettlAgentAcctName;
+    struct _ofixStrView	CashSettlAgentContactName;
+    struct _ofixStrView	CashSettlAgentContactPhone;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42SettlementInstructions;
+
+extern void	fix42_decode_SettlementInstructions(ofixErr err, fix42SettlementInstructions m, const char *raw, int len);
+extern void	fix42_decode_SettlementInstructions_msg(ofixErr err, fix42SettlementInstructions m, ofixMsg msg);
+extern ofixMsg	fix42_encode_SettlementInstructions(ofixErr err, fix42SettlementInstructions m);
+
+// MarketDataRequest [V]
+enum {
+    FIX42_MarketDataRequest_BeginString = 0,
+    FIX42_MarketDataRequest_BodyLength = 1,
+    FIX42_MarketDataRequest_MsgType = 2,
+    FIX42_MarketDataRequest_SenderCompID = 3,
+    FIX42_MarketDataRequest_TargetCompID = 4,
+    FIX42_MarketDataRequest_OnBehalfOfCompID = 5,
+    FIX42_MarketDataRequest_DeliverToCompID = 6,
+    FIX42_MarketDataRequest_SecureDataLen = 7,
+    FIX42_MarketDataRequest_SecureData = 8,
+    FIX42_MarketDataRequest_MsgSeqNum = 9,
+    FIX42_MarketDataRequest_SenderSubID = 10,
+    FIX42_MarketDataRequest_SenderLocationID = 11,
+    FIX42_MarketDataRequest_TargetSubID = 12,
+    FIX42_MarketDataRequest_TargetLocationID = 13,
+    FIX42_MarketDataRequest_OnBehalfOfSubID = 14,
+    FIX42_MarketDataRequest_OnBehalfOfLocationID = 15,
+    FIX42_MarketDataRequest_DeliverToSubID = 16,
+    FIX42_MarketDataRequest_DeliverToLocationID = 17,
+    FIX42_MarketDataRequest_PossDupFlag = 18,
+    FIX42_MarketDataRequest_PossResend = 19,
+    FIX42_MarketDataRequest_SendingTime = 20,
+    FIX42_MarketDataRequest_OrigSendingTime = 21,
+    FIX42_MarketDataRequest_XmlDataLen = 22,
+    FIX42_MarketDataRequest_XmlData = 23,
+    FIX42_MarketDataRequest_MessageEncoding = 24,
+    FIX42_MarketDataRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_MarketDataRequest_OnBehalfOfSendingTime = 26,
+    FIX42_MarketDataRequest_MDReqID = 27,
+    FIX42_MarketDataRequest_SubscriptionRequestType = 28,
+    FIX42_MarketDataRequest_MarketDepth = 29,
+    FIX42_MarketDataRequest_MDUpdateType = 30,
+    FIX42_MarketDataRequest_AggregatedBook = 31,
+    FIX42_MarketDataRequest_NoMDEntryTypes = 32,
+    FIX42_MarketDataRequest_NoRelatedSym = 33,
+    FIX42_MarketDataRequest_SignatureLength = 34,
+    FIX42_MarketDataRequest_Signature = 35,
+    FIX42_MarketDataRequest_CheckSum = 36,
+};
+
+typedef struct _fix42MarketDataRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	MDReqID;
+    char	SubscriptionRequestType;
+    int64_t	MarketDepth;
+    int64_t	MDUpdateType;
+    char	AggregatedBook;
+    int64_t	NoMDEntryTypes;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42MarketDataRequest;
+
+extern void	fix42_decode_MarketDataRequest(ofixErr err, fix42MarketDataRequest m, const char *raw, int len);
+extern void	fix42_decode_MarketDataRequest_msg(ofixErr err, fix42MarketDataRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_MarketDataRequest(ofixErr err, fix42MarketDataRequest m);
+
+// MarketDataSnapshotFullRefresh [W]
+enum {
+    FIX42_MarketDataSnapshotFullRefresh_BeginString = 0,
+    FIX42_MarketDataSnapshotFullRefresh_BodyLength = 1,
+    FIX42_MarketDataSnapshotFullRefresh_MsgType = 2,
+    FIX42_MarketDataSnapshotFullRefresh_SenderCompID = 3,
+    FIX42_MarketDataSnapshotFullRefresh_TargetCompID = 4,
+    FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfCompID = 5,
+    FIX42_MarketDataSnapshotFullRefresh_DeliverToCompID = 6,
+    FIX42_MarketDataSnapshotFullRefresh_SecureDataLen = 7,
+    FIX42_MarketDataSnapshotFullRefresh_SecureData = 8,
+    FIX42_MarketDataSnapshotFullRefresh_MsgSeqNum = 9,
+    FIX42_MarketDataSnapshotFullRefresh_SenderSubID = 10,
+    FIX42_MarketDataSnapshotFullRefresh_SenderLocationID = 11,
+    FIX42_MarketDataSnapshotFullRefresh_TargetSubID = 12,
+    FIX42_MarketDataSnapshotFullRefresh_TargetLocationID = 13,
+    FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfSubID = 14,
+    FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfLocationID = 15,
+    FIX42_MarketDataSnapshotFullRefresh_DeliverToSubID = 16,
+    FIX42_MarketDataSnapshotFullRefresh_DeliverToLocationID = 17,
+    FIX42_MarketDataSnapshotFullRefresh_PossDupFlag = 18,
+    FIX42_MarketDataSnapshotFullRefresh_PossResend = 19,
+    FIX42_MarketDataSnapshotFullRefresh_SendingTime = 20,
+    FIX42_MarketDataSnapshotFullRefresh_OrigSendingTime = 21,
+    FIX42_MarketDataSnapshotFullRefresh_XmlDataLen = 22,
+    FIX42_MarketDataSnapshotFullRefresh_XmlData = 23,
+    FIX42_MarketDataSnapshotFullRefresh_MessageEncoding = 24,
+    FIX42_MarketDataSnapshotFullRefresh_LastMsgSeqNumProcessed = 25,
+    FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfSendingTime = 26,
+    FIX42_MarketDataSnapshotFullRefresh_MDReqID = 27,
+    FIX42_MarketDataSnapshotFullRefresh_Symbol = 28,
+    FIX42_MarketDataSnapshotFullRefresh_SymbolSfx = 29,
+    FIX42_MarketDataSnapshotFullRefresh_SecurityID = 30,
+    FIX42_MarketDataSnapshotFullRefresh_IDSource = 31,
+    FIX42_MarketDataSnapshotFullRefresh_SecurityType = 32,
+    FIX42_MarketDataSnapshotFullRefresh_MaturityMonthYear = 33,
+    FIX42_MarketDataSnapshotFullRefresh_MaturityDay = 34,
+    FIX42_MarketDataSnapshotFullRefresh_PutOrCall = 35,
+    FIX42_MarketDataSnapshotFullRefresh_StrikePrice = 36,
+    FIX42_MarketDataSnapshotFullRefresh_OptAttribute = 37,
+    FIX42_MarketDataSnapshotFullRefresh_ContractMultiplier = 38,
+    FIX42_MarketDataSnapshotFullRefresh_CouponRate = 39,
+    FIX42_MarketDataSnapshotFullRefresh_SecurityExchange = 40,
+    FIX42_MarketDataSnapshotFullRefresh_Issuer = 41,
+    FIX42_MarketDataSnapshotFullRefresh_EncodedIssuerLen = 42,
+    FIX42_MarketDataSnapshotFullRefresh_EncodedIssuer = 43,
+    FIX42_MarketDataSnapshotFullRefresh_SecurityDesc = 44,
+    FIX42_MarketDataSnapshotFullRefresh_EncodedSecurityDescLen = 45,
+    FIX42_MarketDataSnapshotFullRefresh_EncodedSecurityDesc = 46,
+    FIX42_MarketDataSnapshotFullRefresh_FinancialStatus = 47,
+    FIX42_MarketDataSnapshotFullRefresh_CorporateAction = 48,
+    FIX42_MarketDataSnapshotFullRefresh_TotalVolumeTraded = 49,
+    FIX42_MarketDataSnapshotFullRefresh_NoMDEntries = 50,
+    FIX42_MarketDataSnapshotFullRefresh_SignatureLength = 51,
+    FIX42_MarketDataSnapshotFullRefresh_Signature = 52,
+    FIX42_MarketDataSnapshotFullRefresh_CheckSum = 53,
+};
+
+typedef struct _fix42MarketDataSnapshotFullRefresh {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	MDReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	FinancialStatus;
+    char	CorporateAction;
+    struct _ofixDecimal	TotalVolumeTraded;
+    int64_t	NoMDEntries;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42MarketDataSnapshotFullRefresh;
+
+extern void	fix42_decode_MarketDataSnapshotFullRefresh(ofixErr err, fix42MarketDataSnapshotFullRefresh m, const char *raw, int len);
+extern void	fix42_decode_MarketDataSnapshotFullRefresh_msg(ofixErr err, fix42MarketDataSnapshotFullRefresh m, ofixMsg msg);
+extern ofixMsg	fix42_encode_MarketDataSnapshotFullRefresh(ofixErr err, fix42MarketDataSnapshotFullRefresh m);
+
+// MarketDataIncrementalRefresh [X]
+enum {
+    FIX42_MarketDataIncrementalRefresh_BeginString = 0,
+    FIX42_MarketDataIncrementalRefresh_BodyLength = 1,
+    FIX42_MarketDataIncrementalRefresh_MsgType = 2,
+    FIX42_MarketDataIncrementalRefresh_SenderCompID = 3,
+    FIX42_MarketDataIncrementalRefresh_TargetCompID = 4,
+    FIX42_MarketDataIncrementalRefresh_OnBehalfOfCompID = 5,
+    FIX42_MarketDataIncrementalRefresh_DeliverToCompID = 6,
+    FIX42_MarketDataIncrementalRefresh_SecureDataLen = 7,
+    FIX42_MarketDataIncrementalRefresh_SecureData = 8,
+    FIX42_MarketDataIncrementalRefresh_MsgSeqNum = 9,
+    FIX42_MarketDataIncrementalRefresh_SenderSubID = 10,
+    FIX42_MarketDataIncrementalRefresh_SenderLocationID = 11,
+    FIX42_MarketDataIncrementalRefresh_TargetSubID = 12,
+    FIX42_MarketDataIncrementalRefresh_TargetLocationID = 13,
+    FIX42_MarketDataIncrementalRefresh_OnBehalfOfSubID = 14,
+    FIX42_MarketDataIncrementalRefresh_OnBehalfOfLocationID = 15,
+    FIX42_MarketDataIncrementalRefresh_DeliverToSubID = 16,
+    FIX42_MarketDataIncrementalRefresh_DeliverToLocationID = 17,
+    FIX42_MarketDataIncrementalRefresh_PossDupFlag = 18,
+    FIX42_MarketDataIncrementalRefresh_PossResend = 19,
+    FIX42_MarketDataIncrementalRefresh_SendingTime = 20,
+    FIX42_MarketDataIncrementalRefresh_OrigSendingTime = 21,
+    FIX42_MarketDataIncrementalRefresh_XmlDataLen = 22,
+    FIX42_MarketDataIncrementalRefresh_XmlData = 23,
+    FIX42_MarketDataIncrementalRefresh_MessageEncoding = 24,
+    FIX42_MarketDataIncrementalRefresh_LastMsgSeqNumProcessed = 25,
+    FIX42_MarketDataIncrementalRefresh_OnBehalfOfSendingTime = 26,
+    FIX42_MarketDataIncrementalRefresh_MDReqID = 27,
+    FIX42_MarketDataIncrementalRefresh_NoMDEntries = 28,
+    FIX42_MarketDataIncrementalRefresh_SignatureLength = 29,
+    FIX42_MarketDataIncrementalRefresh_Signature = 30,
+    FIX42_MarketDataIncrementalRefresh_CheckSum = 31,
+};
+
+typedef struct _fix42MarketDataIncrementalRefresh {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	MDReqID;
+    int64_t	NoMDEntries;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42MarketDataIncrementalRefresh;
+
+extern void	fix42_decode_MarketDataIncrementalRefresh(ofixErr err, fix42MarketDataIncrementalRefresh m, const char *raw, int len);
+extern void	fix42_decode_MarketDataIncrementalRefresh_msg(ofixErr err, fix42MarketDataIncrementalRefresh m, ofixMsg msg);
+extern ofixMsg	fix42_encode_MarketDataIncrementalRefresh(ofixErr err, fix42MarketDataIncrementalRefresh m);
+
+// MarketDataRequestReject [Y]
+enum {
+    FIX42_MarketDataRequestReject_BeginString = 0,
+    FIX42_MarketDataRequestReject_BodyLength = 1,
+    FIX42_MarketDataRequestReject_MsgType = 2,
+    FIX42_MarketDataRequestReject_SenderCompID = 3,
+    FIX42_MarketDataRequestReject_TargetCompID = 4,
+    FIX42_MarketDataRequestReject_OnBehalfOfCompID = 5,
+    FIX42_MarketDataRequestReject_DeliverToCompID = 6,
+    FIX42_MarketDataRequestReject_SecureDataLen = 7,
+    FIX42_MarketDataRequestReject_SecureData = 8,
+    FIX42_MarketDataRequestReject_MsgSeqNum = 9,
+    FIX42_MarketDataRequestReject_SenderSubID = 10,
+    FIX42_MarketDataRequestReject_SenderLocationID = 11,
+    FIX42_MarketDataRequestReject_TargetSubID = 12,
+    FIX42_MarketDataRequestReject_TargetLocationID = 13,
+    FIX42_MarketDataRequestReject_OnBehalfOfSubID = 14,
+    FIX42_MarketDataRequestReject_OnBehalfOfLocationID = 15,
+    FIX42_MarketDataRequestReject_DeliverToSubID = 16,
+    FIX42_MarketDataRequestReject_DeliverToLocationID = 17,
+    FIX42_MarketDataRequestReject_PossDupFlag = 18,
+    FIX42_MarketDataRequestReject_PossResend = 19,
+    FIX42_MarketDataRequestReject_SendingTime = 20,
+    FIX42_MarketDataRequestReject_OrigSendingTime = 21,
+    FIX42_MarketDataRequestReject_XmlDataLen = 22,
+    FIX42_MarketDataRequestReject_XmlData = 23,
+    FIX42_MarketDataRequestReject_MessageEncoding = 24,
+    FIX42_MarketDataRequestReject_LastMsgSeqNumProcessed = 25,
+    FIX42_MarketDataRequestReject_OnBehalfOfSendingTime = 26,
+    FIX42_MarketDataRequestReject_MDReqID = 27,
+    FIX42_MarketDataRequestReject_MDReqRejReason = 28,
+    FIX42_MarketDataRequestReject_Text = 29,
+    FIX42_MarketDataRequestReject_EncodedTextLen = 30,
+    FIX42_MarketDataRequestReject_EncodedText = 31,
+    FIX42_MarketDataRequestReject_SignatureLength = 32,
+    FIX42_MarketDataRequestReject_Signature = 33,
+    FIX42_MarketDataRequestReject_CheckSum = 34,
+};
+
+typedef struct _fix42MarketDataRequestReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	MDReqID;
+    char	MDReqRejReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42MarketDataRequestReject;
+
+extern void	fix42_decode_MarketDataRequestReject(ofixErr err, fix42MarketDataRequestReject m, const char *raw, int len);
+extern void	fix42_decode_MarketDataRequestReject_msg(ofixErr err, fix42MarketDataRequestReject m, ofixMsg msg);
+extern ofixMsg	fix42_encode_MarketDataRequestReject(ofixErr err, fix42MarketDataRequestReject m);
+
+// QuoteCancel [Z]
+enum {
+    FIX42_QuoteCancel_BeginString = 0,
+    FIX42_QuoteCancel_BodyLength = 1,
+    FIX42_QuoteCancel_MsgType = 2,
+    FIX42_QuoteCancel_SenderCompID = 3,
+    FIX42_QuoteCancel_TargetCompID = 4,
+    FIX42_QuoteCancel_OnBehalfOfCompID = 5,
+    FIX42_QuoteCancel_DeliverToCompID = 6,
+    FIX42_QuoteCancel_SecureDataLen = 7,
+    FIX42_QuoteCancel_SecureData = 8,
+    FIX42_QuoteCancel_MsgSeqNum = 9,
+    FIX42_QuoteCancel_SenderSubID = 10,
+    FIX42_QuoteCancel_SenderLocationID = 11,
+    FIX42_QuoteCancel_TargetSubID = 12,
+    FIX42_QuoteCancel_TargetLocationID = 13,
+    FIX42_QuoteCancel_OnBehalfOfSubID = 14,
+    FIX42_QuoteCancel_OnBehalfOfLocationID = 15,
+    FIX42_QuoteCancel_DeliverToSubID = 16,
+    FIX42_QuoteCancel_DeliverToLocationID = 17,
+    FIX42_QuoteCancel_PossDupFlag = 18,
+    FIX42_QuoteCancel_PossResend = 19,
+    FIX42_QuoteCancel_SendingTime = 20,
+    FIX42_QuoteCancel_OrigSendingTime = 21,
+    FIX42_QuoteCancel_XmlDataLen = 22,
+    FIX42_QuoteCancel_XmlData = 23,
+    FIX42_QuoteCancel_MessageEncoding = 24,
+    FIX42_QuoteCancel_LastMsgSeqNumProcessed = 25,
+    FIX42_QuoteCancel_OnBehalfOfSendingTime = 26,
+    FIX42_QuoteCancel_QuoteReqID = 27,
+    FIX42_QuoteCancel_QuoteID = 28,
+    FIX42_QuoteCancel_QuoteCancelType = 29,
+    FIX42_QuoteCancel_QuoteResponseLevel = 30,
+    FIX42_QuoteCancel_TradingSessionID = 31,
+    FIX42_QuoteCancel_NoQuoteEntries = 32,
+    FIX42_QuoteCancel_SignatureLength = 33,
+    FIX42_QuoteCancel_Signature = 34,
+    FIX42_QuoteCancel_CheckSum = 35,
+};
+
+typedef struct _fix42QuoteCancel {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteCancelType;
+    int64_t	QuoteResponseLevel;
+    struct _ofixStrView	TradingSessionID;
+    int64_t	NoQuoteEntries;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42QuoteCancel;
+
+extern void	fix42_decode_QuoteCancel(ofixErr err, fix42QuoteCancel m, const char *raw, int len);
+extern void	fix42_decode_QuoteCancel_msg(ofixErr err, fix42QuoteCancel m, ofixMsg msg);
+extern ofixMsg	fix42_encode_QuoteCancel(ofixErr err, fix42QuoteCancel m);
+
+// QuoteStatusRequest [a]
+enum {
+    FIX42_QuoteStatusRequest_BeginString = 0,
+    FIX42_QuoteStatusRequest_BodyLength = 1,
+    FIX42_QuoteStatusRequest_MsgType = 2,
+    FIX42_QuoteStatusRequest_SenderCompID = 3,
+    FIX42_QuoteStatusRequest_TargetCompID = 4,
+    FIX42_QuoteStatusRequest_OnBehalfOfCompID = 5,
+    FIX42_QuoteStatusRequest_DeliverToCompID = 6,
+    FIX42_QuoteStatusRequest_SecureDataLen = 7,
+    FIX42_QuoteStatusRequest_SecureData = 8,
+    FIX42_QuoteStatusRequest_MsgSeqNum = 9,
+    FIX42_QuoteStatusRequest_SenderSubID = 10,
+    FIX42_QuoteStatusRequest_SenderLocationID = 11,
+    FIX42_QuoteStatusRequest_TargetSubID = 12,
+    FIX42_QuoteStatusRequest_TargetLocationID = 13,
+    FIX42_QuoteStatusRequest_OnBehalfOfSubID = 14,
+    FIX42_QuoteStatusRequest_OnBehalfOfLocationID = 15,
+    FIX42_QuoteStatusRequest_DeliverToSubID = 16,
+    FIX42_QuoteStatusRequest_DeliverToLocationID = 17,
+    FIX42_QuoteStatusRequest_PossDupFlag = 18,
+    FIX42_QuoteStatusRequest_PossResend = 19,
+    FIX42_QuoteStatusRequest_SendingTime = 20,
+    FIX42_QuoteStatusRequest_OrigSendingTime = 21,
+    FIX42_QuoteStatusRequest_XmlDataLen = 22,
+    FIX42_QuoteStatusRequest_XmlData = 23,
+    FIX42_QuoteStatusRequest_MessageEncoding = 24,
+    FIX42_QuoteStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_QuoteStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX42_QuoteStatusRequest_QuoteID = 27,
+    FIX42_QuoteStatusRequest_Symbol = 28,
+    FIX42_QuoteStatusRequest_SymbolSfx = 29,
+    FIX42_QuoteStatusRequest_SecurityID = 30,
+    FIX42_QuoteStatusRequest_IDSource = 31,
+    FIX42_QuoteStatusRequest_SecurityType = 32,
+    FIX42_QuoteStatusRequest_MaturityMonthYear = 33,
+    FIX42_QuoteStatusRequest_MaturityDay = 34,
+    FIX42_QuoteStatusRequest_PutOrCall = 35,
+    FIX42_QuoteStatusRequest_StrikePrice = 36,
+    FIX42_QuoteStatusRequest_OptAttribute = 37,
+    FIX42_QuoteStatusRequest_ContractMultiplier = 38,
+    FIX42_QuoteStatusRequest_CouponRate = 39,
+    FIX42_QuoteStatusRequest_SecurityExchange = 40,
+    FIX42_QuoteStatusRequest_Issuer = 41,
+    FIX42_QuoteStatusRequest_EncodedIssuerLen = 42,
+    FIX42_QuoteStatusRequest_EncodedIssuer = 43,
+    FIX42_QuoteStatusRequest_SecurityDesc = 44,
+    FIX42_QuoteStatusRequest_EncodedSecurityDescLen = 45,
+    FIX42_QuoteStatusRequest_EncodedSecurityDesc = 46,
+    FIX42_QuoteStatusRequest_Side = 47,
+    FIX42_QuoteStatusRequest_TradingSessionID = 48,
+    FIX42_QuoteStatusRequest_SignatureLength = 49,
+    FIX42_QuoteStatusRequest_Signature = 50,
+    FIX42_QuoteStatusRequest_CheckSum = 51,
+};
+
+typedef struct _fix42QuoteStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixStrView	TradingSessionID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42QuoteStatusRequest;
+
+extern void	fix42_decode_QuoteStatusRequest(ofixErr err, fix42QuoteStatusRequest m, const char *raw, int len);
+extern void	fix42_decode_QuoteStatusRequest_msg(ofixErr err, fix42QuoteStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_QuoteStatusRequest(ofixErr err, fix42QuoteStatusRequest m);
+
+// QuoteAcknowledgement [b]
+enum {
+    FIX42_QuoteAcknowledgement_BeginString = 0,
+    FIX42_QuoteAcknowledgement_BodyLength = 1,
+    FIX42_QuoteAcknowledgement_MsgType = 2,
+    FIX42_QuoteAcknowledgement_SenderCompID = 3,
+    FIX42_QuoteAcknowledgement_TargetCompID = 4,
+    FIX42_QuoteAcknowledgement_OnBehalfOfCompID = 5,
+    FIX42_QuoteAcknowledgement_DeliverToCompID = 6,
+    FIX42_QuoteAcknowledgement_SecureDataLen = 7,
+    FIX42_QuoteAcknowledgement_SecureData = 8,
+    FIX42_QuoteAcknowledgement_MsgSeqNum = 9,
+    FIX42_QuoteAcknowledgement_SenderSubID = 10,
+    FIX42_QuoteAcknowledgement_SenderLocationID = 11,
+    FIX42_QuoteAcknowledgement_TargetSubID = 12,
+    FIX42_QuoteAcknowledgement_TargetLocationID = 13,
+    FIX42_QuoteAcknowledgement_OnBehalfOfSubID = 14,
+    FIX42_QuoteAcknowledgement_OnBehalfOfLocationID = 15,
+    FIX42_QuoteAcknowledgement_DeliverToSubID = 16,
+    FIX42_QuoteAcknowledgement_DeliverToLocationID = 17,
+    FIX42_QuoteAcknowledgement_PossDupFlag = 18,
+    FIX42_QuoteAcknowledgement_PossResend = 19,
+    FIX42_QuoteAcknowledgement_SendingTime = 20,
+    FIX42_QuoteAcknowledgement_OrigSendingTime = 21,
+    FIX42_QuoteAcknowledgement_XmlDataLen = 22,
+    FIX42_QuoteAcknowledgement_XmlData = 23,
+    FIX42_QuoteAcknowledgement_MessageEncoding = 24,
+    FIX42_QuoteAcknowledgement_LastMsgSeqNumProcessed = 25,
+    FIX42_QuoteAcknowledgement_OnBehalfOfSendingTime = 26,
+    FIX42_QuoteAcknowledgement_QuoteReqID = 27,
+    FIX42_QuoteAcknowledgement_QuoteID = 28,
+    FIX42_QuoteAcknowledgement_QuoteAckStatus = 29,
+    FIX42_QuoteAcknowledgement_QuoteRejectReason = 30,
+    FIX42_QuoteAcknowledgement_QuoteResponseLevel = 31,
+    FIX42_QuoteAcknowledgement_TradingSessionID = 32,
+    FIX42_QuoteAcknowledgement_Text = 33,
+    FIX42_QuoteAcknowledgement_NoQuoteSets = 34,
+    FIX42_QuoteAcknowledgement_SignatureLength = 35,
+    FIX42_QuoteAcknowledgement_Signature = 36,
+    FIX42_QuoteAcknowledgement_CheckSum = 37,
+};
+
+typedef struct _fix42QuoteAcknowledgement {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteAckStatus;
+    int64_t	QuoteRejectReason;
+    int64_t	QuoteResponseLevel;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	Text;
+    int64_t	NoQuoteSets;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42QuoteAcknowledgement;
+
+extern void	fix42_decode_QuoteAcknowledgement(ofixErr err, fix42QuoteAcknowledgement m, const char *raw, int len);
+extern void	fix42_decode_QuoteAcknowledgement_msg(ofixErr err, fix42QuoteAcknowledgement m, ofixMsg msg);
+extern ofixMsg	fix42_encode_QuoteAcknowledgement(ofixErr err, fix42QuoteAcknowledgement m);
+
+// SecurityDefinitionRequest [c]
+enum {
+    FIX42_SecurityDefinitionRequest_BeginString = 0,
+    FIX42_SecurityDefinitionRequest_BodyLength = 1,
+    FIX42_SecurityDefinitionRequest_MsgType = 2,
+    FIX42_SecurityDefinitionRequest_SenderCompID = 3,
+    FIX42_SecurityDefinitionRequest_TargetCompID = 4,
+    FIX42_SecurityDefinitionRequest_OnBehalfOfCompID = 5,
+    FIX42_SecurityDefinitionRequest_DeliverToCompID = 6,
+    FIX42_SecurityDefinitionRequest_SecureDataLen = 7,
+    FIX42_SecurityDefinitionRequest_SecureData = 8,
+    FIX42_SecurityDefinitionRequest_MsgSeqNum = 9,
+    FIX42_SecurityDefinitionRequest_SenderSubID = 10,
+    FIX42_SecurityDefinitionRequest_SenderLocationID = 11,
+    FIX42_SecurityDefinitionRequest_TargetSubID = 12,
+    FIX42_SecurityDefinitionRequest_TargetLocationID = 13,
+    FIX42_SecurityDefinitionRequest_OnBehalfOfSubID = 14,
+    FIX42_SecurityDefinitionRequest_OnBehalfOfLocationID = 15,
+    FIX42_SecurityDefinitionRequest_DeliverToSubID = 16,
+    FIX42_SecurityDefinitionRequest_DeliverToLocationID = 17,
+    FIX42_SecurityDefinitionRequest_PossDupFlag = 18,
+    FIX42_SecurityDefinitionRequest_PossResend = 19,
+    FIX42_SecurityDefinitionRequest_SendingTime = 20,
+    FIX42_SecurityDefinitionRequest_OrigSendingTime = 21,
+    FIX42_SecurityDefinitionRequest_XmlDataLen = 22,
+    FIX42_SecurityDefinitionRequest_XmlData = 23,
+    FIX42_SecurityDefinitionRequest_MessageEncoding = 24,
+    FIX42_SecurityDefinitionRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_SecurityDefinitionRequest_OnBehalfOfSendingTime = 26,
+    FIX42_SecurityDefinitionRequest_SecurityReqID = 27,
+    FIX42_SecurityDefinitionRequest_SecurityRequestType = 28,
+    FIX42_SecurityDefinitionRequest_Symbol = 29,
+    FIX42_SecurityDefinitionRequest_SymbolSfx = 30,
+    FIX42_SecurityDefinitionRequest_SecurityID = 31,
+    FIX42_SecurityDefinitionRequest_IDSource = 32,
+    FIX42_SecurityDefinitionRequest_SecurityType = 33,
+    FIX42_SecurityDefinitionRequest_MaturityMonthYear = 34,
+    FIX42_SecurityDefinitionRequest_MaturityDay = 35,
+    FIX42_SecurityDefinitionRequest_PutOrCall = 36,
+    FIX42_SecurityDefinitionRequest_StrikePrice = 37,
+    FIX42_SecurityDefinitionRequest_OptAttribute = 38,
+    FIX42_SecurityDefinitionRequest_ContractMultiplier = 39,
+    FIX42_SecurityDefinitionRequest_CouponRate = 40,
+    FIX42_SecurityDefinitionRequest_SecurityExchange = 41,
+    FIX42_SecurityDefinitionRequest_Issuer = 42,
+    FIX42_SecurityDefinitionRequest_EncodedIssuerLen = 43,
+    FIX42_SecurityDefinitionRequest_EncodedIssuer = 44,
+    FIX42_SecurityDefinitionRequest_SecurityDesc = 45,
+    FIX42_SecurityDefinitionRequest_EncodedSecurityDescLen = 46,
+    FIX42_SecurityDefinitionRequest_EncodedSecurityDesc = 47,
+    FIX42_SecurityDefinitionRequest_Currency = 48,
+    FIX42_SecurityDefinitionRequest_Text = 49,
+    FIX42_SecurityDefinitionRequest_EncodedTextLen = 50,
+    FIX42_SecurityDefinitionRequest_EncodedText = 51,
+    FIX42_SecurityDefinitionRequest_TradingSessionID = 52,
+    FIX42_SecurityDefinitionRequest_NoRelatedSym = 53,
+    FIX42_SecurityDefinitionRequest_SignatureLength = 54,
+    FIX42_SecurityDefinitionRequest_Signature = 55,
+    FIX42_SecurityDefinitionRequest_CheckSum = 56,
+};
+
+typedef struct _fix42SecurityDefinitionRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	SecurityReqID;
+    int64_t	SecurityRequestType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42SecurityDefinitionRequest;
+
+extern void	fix42_decode_SecurityDefinitionRequest(ofixErr err, fix42SecurityDefinitionRequest m, const char *raw, int len);
+extern void	fix42_decode_SecurityDefinitionRequest_msg(ofixErr err, fix42SecurityDefinitionRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_SecurityDefinitionRequest(ofixErr err, fix42SecurityDefinitionRequest m);
+
+// SecurityDefinition [d]
+enum {
+    FIX42_SecurityDefinition_BeginString = 0,
+    FIX42_SecurityDefinition_BodyLength = 1,
+    FIX42_SecurityDefinition_MsgType = 2,
+    FIX42_SecurityDefinition_SenderCompID = 3,
+    FIX42_SecurityDefinition_TargetCompID = 4,
+    FIX42_SecurityDefinition_OnBehalfOfCompID = 5,
+    FIX42_SecurityDefinition_DeliverToCompID = 6,
+    FIX42_SecurityDefinition_SecureDataLen = 7,
+    FIX42_SecurityDefinition_SecureData = 8,
+    FIX42_SecurityDefinition_MsgSeqNum = 9,
+    FIX42_SecurityDefinition_SenderSubID = 10,
+    FIX42_SecurityDefinition_SenderLocationID = 11,
+    FIX42_SecurityDefinition_TargetSubID = 12,
+    FIX42_SecurityDefinition_TargetLocationID = 13,
+    FIX42_SecurityDefinition_OnBehalfOfSubID = 14,
+    FIX42_SecurityDefinition_OnBehalfOfLocationID = 15,
+    FIX42_SecurityDefinition_DeliverToSubID = 16,
+    FIX42_SecurityDefinition_DeliverToLocationID = 17,
+    FIX42_SecurityDefinition_PossDupFlag = 18,
+    FIX42_SecurityDefinition_PossResend = 19,
+    FIX42_SecurityDefinition_SendingTime = 20,
+    FIX42_SecurityDefinition_OrigSendingTime = 21,
+    FIX42_SecurityDefinition_XmlDataLen = 22,
+    FIX42_SecurityDefinition_XmlData = 23,
+    FIX42_SecurityDefinition_MessageEncoding = 24,
+    FIX42_SecurityDefinition_LastMsgSeqNumProcessed = 25,
+    FIX42_SecurityDefinition_OnBehalfOfSendingTime = 26,
+    FIX42_SecurityDefinition_SecurityReqID = 27,
+    FIX42_SecurityDefinition_SecurityResponseID = 28,
+    FIX42_SecurityDefinition_SecurityResponseType = 29,
+    FIX42_SecurityDefinition_TotalNumSecurities = 30,
+    FIX42_SecurityDefinition_Symbol = 31,
+    FIX42_SecurityDefinition_SymbolSfx = 32,
+    FIX42_SecurityDefinition_SecurityID = 33,
+    FIX42_SecurityDefinition_IDSource = 34,
+    FIX42_SecurityDefinition_SecurityType = 35,
+    FIX42_SecurityDefinition_MaturityMonthYear = 36,
+    FIX42_SecurityDefinition_MaturityDay = 37,
+    FIX42_SecurityDefinition_PutOrCall = 38,
+    FIX42_SecurityDefinition_StrikePrice = 39,
+    FIX42_SecurityDefinition_OptAttribute = 40,
+    FIX42_SecurityDefinition_ContractMultiplier = 41,
+    FIX42_SecurityDefinition_CouponRate = 42,
+    FIX42_SecurityDefinition_SecurityExchange = 43,
+    FIX42_SecurityDefinition_Issuer = 44,
+    FIX42_SecurityDefinition_EncodedIssuerLen = 45,
+    FIX42_SecurityDefinition_EncodedIssuer = 46,
+    FIX42_SecurityDefinition_SecurityDesc = 47,
+    FIX42_SecurityDefinition_EncodedSecurityDescLen = 48,
+    FIX42_SecurityDefinition_EncodedSecurityDesc = 49,
+    FIX42_SecurityDefinition_Currency = 50,
+    FIX42_SecurityDefinition_TradingSessionID = 51,
+    FIX42_SecurityDefinition_Text = 52,
+    FIX42_SecurityDefinition_EncodedTextLen = 53,
+    FIX42_SecurityDefinition_EncodedText = 54,
+    FIX42_SecurityDefinition_NoRelatedSym = 55,
+    FIX42_SecurityDefinition_SignatureLength = 56,
+    FIX42_SecurityDefinition_Signature = 57,
+    FIX42_SecurityDefinition_CheckSum = 58,
+};
+
+typedef struct _fix42SecurityDefinition {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityResponseType;
+    int64_t	TotalNumSecurities;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42SecurityDefinition;
+
+extern void	fix42_decode_SecurityDefinition(ofixErr err, fix42SecurityDefinition m, const char *raw, int len);
+extern void	fix42_decode_SecurityDefinition_msg(ofixErr err, fix42SecurityDefinition m, ofixMsg msg);
+extern ofixMsg	fix42_encode_SecurityDefinition(ofixErr err, fix42SecurityDefinition m);
+
+// SecurityStatusRequest [e]
+enum {
+    FIX42_SecurityStatusRequest_BeginString = 0,
+    FIX42_SecurityStatusRequest_BodyLength = 1,
+    FIX42_SecurityStatusRequest_MsgType = 2,
+    FIX42_SecurityStatusRequest_SenderCompID = 3,
+    FIX42_SecurityStatusRequest_TargetCompID = 4,
+    FIX42_SecurityStatusRequest_OnBehalfOfCompID = 5,
+    FIX42_SecurityStatusRequest_DeliverToCompID = 6,
+    FIX42_SecurityStatusRequest_SecureDataLen = 7,
+    FIX42_SecurityStatusRequest_SecureData = 8,
+    FIX42_SecurityStatusRequest_MsgSeqNum = 9,
+    FIX42_SecurityStatusRequest_SenderSubID = 10,
+    FIX42_SecurityStatusRequest_SenderLocationID = 11,
+    FIX42_SecurityStatusRequest_TargetSubID = 12,
+    FIX42_SecurityStatusRequest_TargetLocationID = 13,
+    FIX42_SecurityStatusRequest_OnBehalfOfSubID = 14,
+    FIX42_SecurityStatusRequest_OnBehalfOfLocationID = 15,
+    FIX42_SecurityStatusRequest_DeliverToSubID = 16,
+    FIX42_SecurityStatusRequest_DeliverToLocationID = 17,
+    FIX42_SecurityStatusRequest_PossDupFlag = 18,
+    FIX42_SecurityStatusRequest_PossResend = 19,
+    FIX42_SecurityStatusRequest_SendingTime = 20,
+    FIX42_SecurityStatusRequest_OrigSendingTime = 21,
+    FIX42_SecurityStatusRequest_XmlDataLen = 22,
+    FIX42_SecurityStatusRequest_XmlData = 23,
+    FIX42_SecurityStatusRequest_MessageEncoding = 24,
+    FIX42_SecurityStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_SecurityStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX42_SecurityStatusRequest_SecurityStatusReqID = 27,
+    FIX42_SecurityStatusRequest_Symbol = 28,
+    FIX42_SecurityStatusRequest_SymbolSfx = 29,
+    FIX42_SecurityStatusRequest_SecurityID = 30,
+    FIX42_SecurityStatusRequest_IDSource = 31,
+    FIX42_SecurityStatusRequest_SecurityType = 32,
+    FIX42_SecurityStatusRequest_MaturityMonthYear = 33,
+    FIX42_SecurityStatusRequest_MaturityDay = 34,
+    FIX42_SecurityStatusRequest_PutOrCall = 35,
+    FIX42_SecurityStatusRequest_StrikePrice = 36,
+    FIX42_SecurityStatusRequest_OptAttribute = 37,
+    FIX42_SecurityStatusRequest_ContractMultiplier = 38,
+    FIX42_SecurityStatusRequest_CouponRate = 39,
+    FIX42_SecurityStatusRequest_SecurityExchange = 40,
+    FIX42_SecurityStatusRequest_Issuer = 41,
+    FIX42_SecurityStatusRequest_EncodedIssuerLen = 42,
+    FIX42_SecurityStatusRequest_EncodedIssuer = 43,
+    FIX42_SecurityStatusRequest_SecurityDesc = 44,
+    FIX42_SecurityStatusRequest_EncodedSecurityDescLen = 45,
+    FIX42_SecurityStatusRequest_EncodedSecurityDesc = 46,
+    FIX42_SecurityStatusRequest_Currency = 47,
+    FIX42_SecurityStatusRequest_SubscriptionRequestType = 48,
+    FIX42_SecurityStatusRequest_TradingSessionID = 49,
+    FIX42_SecurityStatusRequest_SignatureLength = 50,
+    FIX42_SecurityStatusRequest_Signature = 51,
+    FIX42_SecurityStatusRequest_CheckSum = 52,
+};
+
+typedef struct _fix42SecurityStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	SecurityStatusReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    char	SubscriptionRequestType;
+    struct _ofixStrView	TradingSessionID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42SecurityStatusRequest;
+
+extern void	fix42_decode_SecurityStatusRequest(ofixErr err, fix42SecurityStatusRequest m, const char *raw, int len);
+extern void	fix42_decode_SecurityStatusRequest_msg(ofixErr err, fix42SecurityStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_SecurityStatusRequest(ofixErr err, fix42SecurityStatusRequest m);
+
+// SecurityStatus [f]
+enum {
+    FIX42_SecurityStatus_BeginString = 0,
+    FIX42_SecurityStatus_BodyLength = 1,
+    FIX42_SecurityStatus_MsgType = 2,
+    FIX42_SecurityStatus_SenderCompID = 3,
+    FIX42_SecurityStatus_TargetCompID = 4,
+    FIX42_SecurityStatus_OnBehalfOfCompID = 5,
+    FIX42_SecurityStatus_DeliverToCompID = 6,
+    FIX42_SecurityStatus_SecureDataLen = 7,
+    FIX42_SecurityStatus_SecureData = 8,
+    FIX42_SecurityStatus_MsgSeqNum = 9,
+    FIX42_SecurityStatus_SenderSubID = 10,
+    FIX42_SecurityStatus_SenderLocationID = 11,
+    FIX42_SecurityStatus_TargetSubID = 12,
+    FIX42_SecurityStatus_TargetLocationID = 13,
+    FIX42_SecurityStatus_OnBehalfOfSubID = 14,
+    FIX42_SecurityStatus_OnBehalfOfLocationID = 15,
+    FIX42_SecurityStatus_DeliverToSubID = 16,
+    FIX42_SecurityStatus_DeliverToLocationID = 17,
+    FIX42_SecurityStatus_PossDupFlag = 18,
+    FIX42_SecurityStatus_PossResend = 19,
+    FIX42_SecurityStatus_SendingTime = 20,
+    FIX42_SecurityStatus_OrigSendingTime = 21,
+    FIX42_SecurityStatus_XmlDataLen = 22,
+    FIX42_SecurityStatus_XmlData = 23,
+    FIX42_SecurityStatus_MessageEncoding = 24,
+    FIX42_SecurityStatus_LastMsgSeqNumProcessed = 25,
+    FIX42_SecurityStatus_OnBehalfOfSendingTime = 26,
+    FIX42_SecurityStatus_SecurityStatusReqID = 27,
+    FIX42_SecurityStatus_Symbol = 28,
+    FIX42_SecurityStatus_SymbolSfx = 29,
+    FIX42_SecurityStatus_SecurityID = 30,
+    FIX42_SecurityStatus_IDSource = 31,
+    FIX42_SecurityStatus_SecurityType = 32,
+    FIX42_SecurityStatus_MaturityMonthYear = 33,
+    FIX42_SecurityStatus_MaturityDay = 34,
+    FIX42_SecurityStatus_PutOrCall = 35,
+    FIX42_SecurityStatus_StrikePrice = 36,
+    FIX42_SecurityStatus_OptAttribute = 37,
+    FIX42_SecurityStatus_ContractMultiplier = 38,
+    FIX42_SecurityStatus_CouponRate = 39,
+    FIX42_SecurityStatus_SecurityExchange = 40,
+    FIX42_SecurityStatus_Issuer = 41,
+    FIX42_SecurityStatus_EncodedIssuerLen = 42,
+    FIX42_SecurityStatus_EncodedIssuer = 43,
+    FIX42_SecurityStatus_SecurityDesc = 44,
+    FIX42_SecurityStatus_EncodedSecurityDescLen = 45,
+    FIX42_SecurityStatus_EncodedSecurityDesc = 46,
+    FIX42_SecurityStatus_Currency = 47,
+    FIX42_SecurityStatus_TradingSessionID = 48,
+    FIX42_SecurityStatus_UnsolicitedIndicator = 49,
+    FIX42_SecurityStatus_SecurityTradingStatus = 50,
+    FIX42_SecurityStatus_FinancialStatus = 51,
+    FIX42_SecurityStatus_CorporateAction = 52,
+    FIX42_SecurityStatus_HaltReason = 53,
+    FIX42_SecurityStatus_InViewOfCommon = 54,
+    FIX42_SecurityStatus_DueToRelated = 55,
+    FIX42_SecurityStatus_BuyVolume = 56,
+    FIX42_SecurityStatus_SellVolume = 57,
+    FIX42_SecurityStatus_HighPx = 58,
+    FIX42_SecurityStatus_LowPx = 59,
+    FIX42_SecurityStatus_LastPx = 60,
+    FIX42_SecurityStatus_TransactTime = 61,
+    FIX42_SecurityStatus_Adjustment = 62,
+    FIX42_SecurityStatus_SignatureLength = 63,
+    FIX42_SecurityStatus_Signature = 64,
+    FIX42_SecurityStatus_CheckSum = 65,
+};
+
+typedef struct _fix42SecurityStatus {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	SecurityStatusReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	IDSource;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    int64_t	MaturityDay;
+    int64_t	PutOrCall;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradingSessionID;
+    char	UnsolicitedIndicator;
+    int64_t	SecurityTradingStatus;
+    char	FinancialStatus;
+    char	CorporateAction;
+    char	HaltReason;
+    char	InViewOfCommon;
+    char	DueToRelated;
+    struct _ofixDecimal	BuyVolume;
+    struct _ofixDecimal	SellVolume;
+    struct _ofixDecimal	HighPx;
+    struct _ofixDecimal	LowPx;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDate	TransactTime;
+    int64_t	Adjustment;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42SecurityStatus;
+
+extern void	fix42_decode_SecurityStatus(ofixErr err, fix42SecurityStatus m, const char *raw, int len);
+extern void	fix42_decode_SecurityStatus_msg(ofixErr err, fix42SecurityStatus m, ofixMsg msg);
+extern ofixMsg	fix42_encode_SecurityStatus(ofixErr err, fix42SecurityStatus m);
+
+// TradingSessionStatusRequest [g]
+enum {
+    FIX42_TradingSessionStatusRequest_BeginString = 0,
+    FIX42_TradingSessionStatusRequest_BodyLength = 1,
+    FIX42_TradingSessionStatusRequest_MsgType = 2,
+    FIX42_TradingSessionStatusRequest_SenderCompID = 3,
+    FIX42_TradingSessionStatusRequest_TargetCompID = 4,
+    FIX42_TradingSessionStatusRequest_OnBehalfOfCompID = 5,
+    FIX42_TradingSessionStatusRequest_DeliverToCompID = 6,
+    FIX42_TradingSessionStatusRequest_SecureDataLen = 7,
+    FIX42_TradingSessionStatusRequest_SecureData = 8,
+    FIX42_TradingSessionStatusRequest_MsgSeqNum = 9,
+    FIX42_TradingSessionStatusRequest_SenderSubID = 10,
+    FIX42_TradingSessionStatusRequest_SenderLocationID = 11,
+    FIX42_TradingSessionStatusRequest_TargetSubID = 12,
+    FIX42_TradingSessionStatusRequest_TargetLocationID = 13,
+    FIX42_TradingSessionStatusRequest_OnBehalfOfSubID = 14,
+    FIX42_TradingSessionStatusRequest_OnBehalfOfLocationID = 15,
+    FIX42_TradingSessionStatusRequest_DeliverToSubID = 16,
+    FIX42_TradingSessionStatusRequest_DeliverToLocationID = 17,
+    FIX42_TradingSessionStatusRequest_PossDupFlag = 18,
+    FIX42_TradingSessionStatusRequest_PossResend = 19,
+    FIX42_TradingSessionStatusRequest_SendingTime = 20,
+    FIX42_TradingSessionStatusRequest_OrigSendingTime = 21,
+    FIX42_TradingSessionStatusRequest_XmlDataLen = 22,
+    FIX42_TradingSessionStatusRequest_XmlData = 23,
+    FIX42_TradingSessionStatusRequest_MessageEncoding = 24,
+    FIX42_TradingSessionStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_TradingSessionStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX42_TradingSessionStatusRequest_TradSesReqID = 27,
+    FIX42_TradingSessionStatusRequest_TradingSessionID = 28,
+    FIX42_TradingSessionStatusRequest_TradSesMethod = 29,
+    FIX42_TradingSessionStatusRequest_TradSesMode = 30,
+    FIX42_TradingSessionStatusRequest_SubscriptionRequestType = 31,
+    FIX42_TradingSessionStatusRequest_SignatureLength = 32,
+    FIX42_TradingSessionStatusRequest_Signature = 33,
+    FIX42_TradingSessionStatusRequest_CheckSum = 34,
+};
+
+typedef struct _fix42TradingSessionStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	TradSesReqID;
+    struct _ofixStrView	TradingSessionID;
+    int64_t	TradSesMethod;
+    int64_t	TradSesMode;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42TradingSessionStatusRequest;
+
+extern void	fix42_decode_TradingSessionStatusRequest(ofixErr err, fix42TradingSessionStatusRequest m, const char *raw, int len);
+extern void	fix42_decode_TradingSessionStatusRequest_msg(ofixErr err, fix42TradingSessionStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_TradingSessionStatusRequest(ofixErr err, fix42TradingSessionStatusRequest m);
+
+// TradingSessionStatus [h]
+enum {
+    FIX42_TradingSessionStatus_BeginString = 0,
+    FIX42_TradingSessionStatus_BodyLength = 1,
+    FIX42_TradingSessionStatus_MsgType = 2,
+    FIX42_TradingSessionStatus_SenderCompID = 3,
+    FIX42_TradingSessionStatus_TargetCompID = 4,
+    FIX42_TradingSessionStatus_OnBehalfOfCompID = 5,
+    FIX42_TradingSessionStatus_DeliverToCompID = 6,
+    FIX42_TradingSessionStatus_SecureDataLen = 7,
+    FIX42_TradingSessionStatus_SecureData = 8,
+    FIX42_TradingSessionStatus_MsgSeqNum = 9,
+    FIX42_TradingSessionStatus_SenderSubID = 10,
+    FIX42_TradingSessionStatus_SenderLocationID = 11,
+    FIX42_TradingSessionStatus_TargetSubID = 12,
+    FIX42_TradingSessionStatus_TargetLocationID = 13,
+    FIX42_TradingSessionStatus_OnBehalfOfSubID = 14,
+    FIX42_TradingSessionStatus_OnBehalfOfLocationID = 15,
+    FIX42_TradingSessionStatus_DeliverToSubID = 16,
+    FIX42_TradingSessionStatus_DeliverToLocationID = 17,
+    FIX42_TradingSessionStatus_PossDupFlag = 18,
+    FIX42_TradingSessionStatus_PossResend = 19,
+    FIX42_TradingSessionStatus_SendingTime = 20,
+    FIX42_TradingSessionStatus_OrigSendingTime = 21,
+    FIX42_TradingSessionStatus_XmlDataLen = 22,
+    FIX42_TradingSessionStatus_XmlData = 23,
+    FIX42_TradingSessionStatus_MessageEncoding = 24,
+    FIX42_TradingSessionStatus_LastMsgSeqNumProcessed = 25,
+    FIX42_TradingSessionStatus_OnBehalfOfSendingTime = 26,
+    FIX42_TradingSessionStatus_TradSesReqID = 27,
+    FIX42_TradingSessionStatus_TradingSessionID = 28,
+    FIX42_TradingSessionStatus_TradSesMethod = 29,
+    FIX42_TradingSessionStatus_TradSesMode = 30,
+    FIX42_TradingSessionStatus_UnsolicitedIndicator = 31,
+    FIX42_TradingSessionStatus_TradSesStatus = 32,
+    FIX42_TradingSessionStatus_TradSesStartTime = 33,
+    FIX42_TradingSessionStatus_TradSesOpenTime = 34,
+    FIX42_TradingSessionStatus_TradSesPreCloseTime = 35,
+    FIX42_TradingSessionStatus_TradSesCloseTime = 36,
+    FIX42_TradingSessionStatus_TradSesEndTime = 37,
+    FIX42_TradingSessionStatus_TotalVolumeTraded = 38,
+    FIX42_TradingSessionStatus_Text = 39,
+    FIX42_TradingSessionStatus_EncodedTextLen = 40,
+    FIX42_TradingSessionStatus_EncodedText = 41,
+    FIX42_TradingSessionStatus_SignatureLength = 42,
+    FIX42_TradingSessionStatus_Signature = 43,
+    FIX42_TradingSessionStatus_CheckSum = 44,
+};
+
+typedef struct _fix42TradingSessionStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	TradSesReqID;
+    struct _ofixStrView	TradingSessionID;
+    int64_t	TradSesMethod;
+    int64_t	TradSesMode;
+    char	UnsolicitedIndicator;
+    int64_t	TradSesStatus;
+    struct _ofixDate	TradSesStartTime;
+    struct _ofixDate	TradSesOpenTime;
+    struct _ofixDate	TradSesPreCloseTime;
+    struct _ofixDate	TradSesCloseTime;
+    struct _ofixDate	TradSesEndTime;
+    struct _ofixDecimal	TotalVolumeTraded;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42TradingSessionStatus;
+
+extern void	fix42_decode_TradingSessionStatus(ofixErr err, fix42TradingSessionStatus m, const char *raw, int len);
+extern void	fix42_decode_TradingSessionStatus_msg(ofixErr err, fix42TradingSessionStatus m, ofixMsg msg);
+extern ofixMsg	fix42_encode_TradingSessionStatus(ofixErr err, fix42TradingSessionStatus m);
+
+// MassQuote [i]
+enum {
+    FIX42_MassQuote_BeginString = 0,
+    FIX42_MassQuote_BodyLength = 1,
+    FIX42_MassQuote_MsgType = 2,
+    FIX42_MassQuote_SenderCompID = 3,
+    FIX42_MassQuote_TargetCompID = 4,
+    FIX42_MassQuote_OnBehalfOfCompID = 5,
+    FIX42_MassQuote_DeliverToCompID = 6,
+    FIX42_MassQuote_SecureDataLen = 7,
+    FIX42_MassQuote_SecureData = 8,
+    FIX42_MassQuote_MsgSeqNum = 9,
+    FIX42_MassQuote_SenderSubID = 10,
+    FIX42_MassQuote_SenderLocationID = 11,
+    FIX42_MassQuote_TargetSubID = 12,
+    FIX42_MassQuote_TargetLocationID = 13,
+    FIX42_MassQuote_OnBehalfOfSubID = 14,
+    FIX42_MassQuote_OnBehalfOfLocationID = 15,
+    FIX42_MassQuote_DeliverToSubID = 16,
+    FIX42_MassQuote_DeliverToLocationID = 17,
+    FIX42_MassQuote_PossDupFlag = 18,
+    FIX42_MassQuote_PossResend = 19,
+    FIX42_MassQuote_SendingTime = 20,
+    FIX42_MassQuote_OrigSendingTime = 21,
+    FIX42_MassQuote_XmlDataLen = 22,
+    FIX42_MassQuote_XmlData = 23,
+    FIX42_MassQuote_MessageEncoding = 24,
+    FIX42_MassQuote_LastMsgSeqNumProcessed = 25,
+    FIX42_MassQuote_OnBehalfOfSendingTime = 26,
+    FIX42_MassQuote_QuoteReqID = 27,
+    FIX42_MassQuote_QuoteID = 28,
+    FIX42_MassQuote_QuoteResponseLevel = 29,
+    FIX42_MassQuote_DefBidSize = 30,
+    FIX42_MassQuote_DefOfferSize = 31,
+    FIX42_MassQuote_NoQuoteSets = 32,
+    FIX42_MassQuote_SignatureLength = 33,
+    FIX42_MassQuote_Signature = 34,
+    FIX42_MassQuote_CheckSum = 35,
+};
+
+typedef struct _fix42MassQuote {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteResponseLevel;
+    struct _ofixDecimal	DefBidSize;
+    struct _ofixDecimal	DefOfferSize;
+    int64_t	NoQuoteSets;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42MassQuote;
+
+extern void	fix42_decode_MassQuote(ofixErr err, fix42MassQuote m, const char *raw, int len);
+extern void	fix42_decode_MassQuote_msg(ofixErr err, fix42MassQuote m, ofixMsg msg);
+extern ofixMsg	fix42_encode_MassQuote(ofixErr err, fix42MassQuote m);
+
+// BusinessMessageReject [j]
+enum {
+    FIX42_BusinessMessageReject_BeginString = 0,
+    FIX42_BusinessMessageReject_BodyLength = 1,
+    FIX42_BusinessMessageReject_MsgType = 2,
+    FIX42_BusinessMessageReject_SenderCompID = 3,
+    FIX42_BusinessMessageReject_TargetCompID = 4,
+    FIX42_BusinessMessageReject_OnBehalfOfCompID = 5,
+    FIX42_BusinessMessageReject_DeliverToCompID = 6,
+    FIX42_BusinessMessageReject_SecureDataLen = 7,
+    FIX42_BusinessMessageReject_SecureData = 8,
+    FIX42_BusinessMessageReject_MsgSeqNum = 9,
+    FIX42_BusinessMessageReject_SenderSubID = 10,
+    FIX42_BusinessMessageReject_SenderLocationID = 11,
+    FIX42_BusinessMessageReject_TargetSubID = 12,
+    FIX42_BusinessMessageReject_TargetLocationID = 13,
+    FIX42_BusinessMessageReject_OnBehalfOfSubID = 14,
+    FIX42_BusinessMessageReject_OnBehalfOfLocationID = 15,
+    FIX42_BusinessMessageReject_DeliverToSubID = 16,
+    FIX42_BusinessMessageReject_DeliverToLocationID = 17,
+    FIX42_BusinessMessageReject_PossDupFlag = 18,
+    FIX42_BusinessMessageReject_PossResend = 19,
+    FIX42_BusinessMessageReject_SendingTime = 20,
+    FIX42_BusinessMessageReject_OrigSendingTime = 21,
+    FIX42_BusinessMessageReject_XmlDataLen = 22,
+    FIX42_BusinessMessageReject_XmlData = 23,
+    FIX42_BusinessMessageReject_MessageEncoding = 24,
+    FIX42_BusinessMessageReject_LastMsgSeqNumProcessed = 25,
+    FIX42_BusinessMessageReject_OnBehalfOfSendingTime = 26,
+    FIX42_BusinessMessageReject_RefSeqNum = 27,
+    FIX42_BusinessMessageReject_RefMsgType = 28,
+    FIX42_BusinessMessageReject_BusinessRejectRefID = 29,
+    FIX42_BusinessMessageReject_BusinessRejectReason = 30,
+    FIX42_BusinessMessageReject_Text = 31,
+    FIX42_BusinessMessageReject_EncodedTextLen = 32,
+    FIX42_BusinessMessageReject_EncodedText = 33,
+    FIX42_BusinessMessageReject_SignatureLength = 34,
+    FIX42_BusinessMessageReject_Signature = 35,
+    FIX42_BusinessMessageReject_CheckSum = 36,
+};
+
+typedef struct _fix42BusinessMessageReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	RefSeqNum;
+    struct _ofixStrView	RefMsgType;
+    struct _ofixStrView	BusinessRejectRefID;
+    int64_t	BusinessRejectReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42BusinessMessageReject;
+
+extern void	fix42_decode_BusinessMessageReject(ofixErr err, fix42BusinessMessageReject m, const char *raw, int len);
+extern void	fix42_decode_BusinessMessageReject_msg(ofixErr err, fix42BusinessMessageReject m, ofixMsg msg);
+extern ofixMsg	fix42_encode_BusinessMessageReject(ofixErr err, fix42BusinessMessageReject m);
+
+// BidRequest [k]
+enum {
+    FIX42_BidRequest_BeginString = 0,
+    FIX42_BidRequest_BodyLength = 1,
+    FIX42_BidRequest_MsgType = 2,
+    FIX42_BidRequest_SenderCompID = 3,
+    FIX42_BidRequest_TargetCompID = 4,
+    FIX42_BidRequest_OnBehalfOfCompID = 5,
+    FIX42_BidRequest_DeliverToCompID = 6,
+    FIX42_BidRequest_SecureDataLen = 7,
+    FIX42_BidRequest_SecureData = 8,
+    FIX42_BidRequest_MsgSeqNum = 9,
+    FIX42_BidRequest_SenderSubID = 10,
+    FIX42_BidRequest_SenderLocationID = 11,
+    FIX42_BidRequest_TargetSubID = 12,
+    FIX42_BidRequest_TargetLocationID = 13,
+    FIX42_BidRequest_OnBehalfOfSubID = 14,
+    FIX42_BidRequest_OnBehalfOfLocationID = 15,
+    FIX42_BidRequest_DeliverToSubID = 16,
+    FIX42_BidRequest_DeliverToLocationID = 17,
+    FIX42_BidRequest_PossDupFlag = 18,
+    FIX42_BidRequest_PossResend = 19,
+    FIX42_BidRequest_SendingTime = 20,
+    FIX42_BidRequest_OrigSendingTime = 21,
+    FIX42_BidRequest_XmlDataLen = 22,
+    FIX42_BidRequest_XmlData = 23,
+    FIX42_BidRequest_MessageEncoding = 24,
+    FIX42_BidRequest_LastMsgSeqNumProcessed = 25,
+    FIX42_BidRequest_OnBehalfOfSendingTime = 26,
+    FIX42_BidRequest_BidID = 27,
+    FIX42_BidRequest_ClientBidID = 28,
+    FIX42_BidRequest_BidRequestTransType = 29,
+    FIX42_BidRequest_ListName = 30,
+    FIX42_BidRequest_TotalNumSecurities = 31,
+    FIX42_BidRequest_BidType = 32,
+    FIX42_BidRequest_NumTickets = 33,
+    FIX42_BidRequest_Currency = 34,
+    FIX42_BidRequest_SideValue1 = 35,
+    FIX42_BidRequest_SideValue2 = 36,
+    FIX42_BidRequest_NoBidDescriptors = 37,
+    FIX42_BidRequest_NoBidComponents = 38,
+    FIX42_BidRequest_LiquidityIndType = 39,
+    FIX42_BidRequest_WtAverageLiquidity = 40,
+    FIX42_BidRequest_ExchangeForPhysical = 41,
+    FIX42_BidRequest_OutMainCntryUIndex = 42,
+    FIX42_BidRequest_CrossPercent = 43,
+    FIX42_BidRequest_ProgRptReqs = 44,
+    FIX42_BidRequest_ProgPeriodInterval = 45,
+    FIX42_BidRequest_IncTaxInd = 46,
+    FIX42_BidRequest_ForexReq = 47,
+    FIX42_BidRequest_NumBidders = 48,
+    FIX42_BidRequest_TradeDate = 49,
+    FIX42_BidRequest_TradeType = 50,
+    FIX42_BidRequest_BasisPxType = 51,
+    FIX42_BidRequest_StrikeTime = 52,
+    FIX42_BidRequest_Text = 53,
+    FIX42_BidRequest_EncodedTextLen = 54,
+    FIX42_BidRequest_EncodedText = 55,
+    FIX42_BidRequest_SignatureLength = 56,
+    FIX42_BidRequest_Signature = 57,
+    FIX42_BidRequest_CheckSum = 58,
+};
+
+typedef struct _fix42BidRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    char	BidRequestTransType;
+    struct _ofixStrView	ListName;
+    int64_t	TotalNumSecurities;
+    int64_t	BidType;
+    int64_t	NumTickets;
+    struct _ofixStrView	Currency;
+    struct _ofixDecimal	SideValue1;
+    struct _ofixDecimal	SideValue2;
+    int64_t	NoBidDescriptors;
+    int64_t	NoBidComponents;
+    int64_t	LiquidityIndType;
+    struct _ofixDecimal	WtAverageLiquidity;
+    char	ExchangeForPhysical;
+    struct _ofixDecimal	OutMainCntryUIndex;
+    struct _ofixDecimal	CrossPercent;
+    int64_t	ProgRptReqs;
+    int64_t	ProgPeriodInterval;
+    int64_t	IncTaxInd;
+    char	ForexReq;
+    int64_t	NumBidders;
+    struct _ofixStrView	TradeDate;
+    char	TradeType;
+    char	BasisPxType;
+    struct _ofixDate	StrikeTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42BidRequest;
+
+extern void	fix42_decode_BidRequest(ofixErr err, fix42BidRequest m, const char *raw, int len);
+extern void	fix42_decode_BidRequest_msg(ofixErr err, fix42BidRequest m, ofixMsg msg);
+extern ofixMsg	fix42_encode_BidRequest(ofixErr err, fix42BidRequest m);
+
+// BidResponse [l]
+enum {
+    FIX42_BidResponse_BeginString = 0,
+    FIX42_BidResponse_BodyLength = 1,
+    FIX42_BidResponse_MsgType = 2,
+    FIX42_BidResponse_SenderCompID = 3,
+    FIX42_BidResponse_TargetCompID = 4,
+    FIX42_BidResponse_OnBehalfOfCompID = 5,
+    FIX42_BidResponse_DeliverToCompID = 6,
+    FIX42_BidResponse_SecureDataLen = 7,
+    FIX42_BidResponse_SecureData = 8,
+    FIX42_BidResponse_MsgSeqNum = 9,
+    FIX42_BidResponse_SenderSubID = 10,
+    FIX42_BidResponse_SenderLocationID = 11,
+    FIX42_BidResponse_TargetSubID = 12,
+    FIX42_BidResponse_TargetLocationID = 13,
+    FIX42_BidResponse_OnBehalfOfSubID = 14,
+    FIX42_BidResponse_OnBehalfOfLocationID = 15,
+    FIX42_BidResponse_DeliverToSubID = 16,
+    FIX42_BidResponse_DeliverToLocationID = 17,
+    FIX42_BidResponse_PossDupFlag = 18,
+    FIX42_BidResponse_PossResend = 19,
+    FIX42_BidResponse_SendingTime = 20,
+    FIX42_BidResponse_OrigSendingTime = 21,
+    FIX42_BidResponse_XmlDataLen = 22,
+    FIX42_BidResponse_XmlData = 23,
+    FIX42_BidResponse_MessageEncoding = 24,
+    FIX42_BidResponse_LastMsgSeqNumProcessed = 25,
+    FIX42_BidResponse_OnBehalfOfSendingTime = 26,
+    FIX42_BidResponse_BidID = 27,
+    FIX42_BidResponse_ClientBidID = 28,
+    FIX42_BidResponse_NoBidComponents = 29,
+    FIX42_BidResponse_SignatureLength = 30,
+    FIX42_BidResponse_Signature = 31,
+    FIX42_BidResponse_CheckSum = 32,
+};
+
+typedef struct _fix42BidResponse {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    int64_t	NoBidComponents;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42BidResponse;
+
+extern void	fix42_decode_BidResponse(ofixErr err, fix42BidResponse m, const char *raw, int len);
+extern void	fix42_decode_BidResponse_msg(ofixErr err, fix42BidResponse m, ofixMsg msg);
+extern ofixMsg	fix42_encode_BidResponse(ofixErr err, fix42BidResponse m);
+
+// ListStrikePrice [m]
+enum {
+    FIX42_ListStrikePrice_BeginString = 0,
+    FIX42_ListStrikePrice_BodyLength = 1,
+    FIX42_ListStrikePrice_MsgType = 2,
+    FIX42_ListStrikePrice_SenderCompID = 3,
+    FIX42_ListStrikePrice_TargetCompID = 4,
+    FIX42_ListStrikePrice_OnBehalfOfCompID = 5,
+    FIX42_ListStrikePrice_DeliverToCompID = 6,
+    FIX42_ListStrikePrice_SecureDataLen = 7,
+    FIX42_ListStrikePrice_SecureData = 8,
+    FIX42_ListStrikePrice_MsgSeqNum = 9,
+    FIX42_ListStrikePrice_SenderSubID = 10,
+    FIX42_ListStrikePrice_SenderLocationID = 11,
+    FIX42_ListStrikePrice_TargetSubID = 12,
+    FIX42_ListStrikePrice_TargetLocationID = 13,
+    FIX42_ListStrikePrice_OnBehalfOfSubID = 14,
+    FIX42_ListStrikePrice_OnBehalfOfLocationID = 15,
+    FIX42_ListStrikePrice_DeliverToSubID = 16,
+    FIX42_ListStrikePrice_DeliverToLocationID = 17,
+    FIX42_ListStrikePrice_PossDupFlag = 18,
+    FIX42_ListStrikePrice_PossResend = 19,
+    FIX42_ListStrikePrice_SendingTime = 20,
+    FIX42_ListStrikePrice_OrigSendingTime = 21,
+    FIX42_ListStrikePrice_XmlDataLen = 22,
+    FIX42_ListStrikePrice_XmlData = 23,
+    FIX42_ListStrikePrice_MessageEncoding = 24,
+    FIX42_ListStrikePrice_LastMsgSeqNumProcessed = 25,
+    FIX42_ListStrikePrice_OnBehalfOfSendingTime = 26,
+    FIX42_ListStrikePrice_ListID = 27,
+    FIX42_ListStrikePrice_TotNoStrikes = 28,
+    FIX42_ListStrikePrice_NoStrikes = 29,
+    FIX42_ListStrikePrice_SignatureLength = 30,
+    FIX42_ListStrikePrice_Signature = 31,
+    FIX42_ListStrikePrice_CheckSum = 32,
+};
+
+typedef struct _fix42ListStrikePrice {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    struct _ofixStrView	ListID;
+    int64_t	TotNoStrikes;
+    int64_t	NoStrikes;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix42ListStrikePrice;
+
+extern void	fix42_decode_ListStrikePrice(ofixErr err, fix42ListStrikePrice m, const char *raw, int len);
+extern void	fix42_decode_ListStrikePrice_msg(ofixErr err, fix42ListStrikePrice m, ofixMsg msg);
+extern ofixMsg	fix42_encode_ListStrikePrice(ofixErr err, fix42ListStrikePrice m);
+
+#endif /* __OFIX_FIX42MSGS_H__ */
@@ -0,0 +1,9644 @@
+
+// This file is auto-generated from ref/FIX43.xml and should not be modified.
+
+#ifndef __OFIX_FIX43MSGS_H__
+#define __OFIX_FIX43MSGS_H__
+
+#include <stdint.h>
+
+#include "ofix/err.h"
+#include "ofix/msg.h"
+#include "ofix/date.h"
+#include "ofix/typed.h"
+
+// Heartbeat [0]
+enum {
+    FIX43_Heartbeat_BeginString = 0,
+    FIX43_Heartbeat_BodyLength = 1,
+    FIX43_Heartbeat_MsgType = 2,
+    FIX43_Heartbeat_SenderCompID = 3,
+    FIX43_Heartbeat_TargetCompID = 4,
+    FIX43_Heartbeat_OnBehalfOfCompID = 5,
+    FIX43_Heartbeat_DeliverToCompID = 6,
+    FIX43_Heartbeat_SecureDataLen = 7,
+    FIX43_Heartbeat_SecureData = 8,
+    FIX43_Heartbeat_MsgSeqNum = 9,
+    FIX43_Heartbeat_SenderSubID = 10,
+    FIX43_Heartbeat_SenderLocationID = 11,
+    FIX43_Heartbeat_TargetSubID = 12,
+    FIX43_Heartbeat_TargetLocationID = 13,
+    FIX43_Heartbeat_OnBehalfOfSubID = 14,
+    FIX43_Heartbeat_OnBehalfOfLocationID = 15,
+    FIX43_Heartbeat_DeliverToSubID = 16,
+    FIX43_Heartbeat_DeliverToLocationID = 17,
+    FIX43_Heartbeat_PossDupFlag = 18,
+    FIX43_Heartbeat_PossResend = 19,
+    FIX43_Heartbeat_SendingTime = 20,
+    FIX43_Heartbeat_OrigSendingTime = 21,
+    FIX43_Heartbeat_XmlDataLen = 22,
+    FIX43_Heartbeat_XmlData = 23,
+    FIX43_Heartbeat_MessageEncoding = 24,
+    FIX43_Heartbeat_LastMsgSeqNumProcessed = 25,
+    FIX43_Heartbeat_OnBehalfOfSendingTime = 26,
+    FIX43_Heartbeat_NoHops = 27,
+    FIX43_Heartbeat_TestReqID = 28,
+    FIX43_Heartbeat_SignatureLength = 29,
+    FIX43_Heartbeat_Signature = 30,
+    FIX43_Heartbeat_CheckSum = 31,
+};
+
+typedef struct _fix43Heartbeat {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Heartbeat;
+
+extern void	fix43_decode_Heartbeat(ofixErr err, fix43Heartbeat m, const char *raw, int len);
+extern void	fix43_decode_Heartbeat_msg(ofixErr err, fix43Heartbeat m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Heartbeat(ofixErr err, fix43Heartbeat m);
+
+// TestRequest [1]
+enum {
+    FIX43_TestRequest_BeginString = 0,
+    FIX43_TestRequest_BodyLength = 1,
+    FIX43_TestRequest_MsgType = 2,
+    FIX43_TestRequest_SenderCompID = 3,
+    FIX43_TestRequest_TargetCompID = 4,
+    FIX43_TestRequest_OnBehalfOfCompID = 5,
+    FIX43_TestRequest_DeliverToCompID = 6,
+    FIX43_TestRequest_SecureDataLen = 7,
+    FIX43_TestRequest_SecureData = 8,
+    FIX43_TestRequest_MsgSeqNum = 9,
+    FIX43_TestRequest_SenderSubID = 10,
+    FIX43_TestRequest_SenderLocationID = 11,
+    FIX43_TestRequest_TargetSubID = 12,
+    FIX43_TestRequest_TargetLocationID = 13,
+    FIX43_TestRequest_OnBehalfOfSubID = 14,
+    FIX43_TestRequest_OnBehalfOfLocationID = 15,
+    FIX43_TestRequest_DeliverToSubID = 16,
+    FIX43_TestRequest_DeliverToLocationID = 17,
+    FIX43_TestRequest_PossDupFlag = 18,
+    FIX43_TestRequest_PossResend = 19,
+    FIX43_TestRequest_SendingTime = 20,
+    FIX43_TestRequest_OrigSendingTime = 21,
+    FIX43_TestRequest_XmlDataLen = 22,
+    FIX43_TestRequest_XmlData = 23,
+    FIX43_TestRequest_MessageEncoding = 24,
+    FIX43_TestRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_TestRequest_OnBehalfOfSendingTime = 26,
+    FIX43_TestRequest_NoHops = 27,
+    FIX43_TestRequest_TestReqID = 28,
+    FIX43_TestRequest_SignatureLength = 29,
+    FIX43_TestRequest_Signature = 30,
+    FIX43_TestRequest_CheckSum = 31,
+};
+
+typedef struct _fix43TestRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43TestRequest;
+
+extern void	fix43_decode_TestRequest(ofixErr err, fix43TestRequest m, const char *raw, int len);
+extern void	fix43_decode_TestRequest_msg(ofixErr err, fix43TestRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_TestRequest(ofixErr err, fix43TestRequest m);
+
+// ResendRequest [2]
+enum {
+    FIX43_ResendRequest_BeginString = 0,
+    FIX43_ResendRequest_BodyLength = 1,
+    FIX43_ResendRequest_MsgType = 2,
+    FIX43_ResendRequest_SenderCompID = 3,
+    FIX43_ResendRequest_TargetCompID = 4,
+    FIX43_ResendRequest_OnBehalfOfCompID = 5,
+    FIX43_ResendRequest_DeliverToCompID = 6,
+    FIX43_ResendRequest_SecureDataLen = 7,
+    FIX43_ResendRequest_SecureData = 8,
+    FIX43_ResendRequest_MsgSeqNum = 9,
+    FIX43_ResendRequest_SenderSubID = 10,
+    FIX43_ResendRequest_SenderLocationID = 11,
+    FIX43_ResendRequest_TargetSubID = 12,
+    FIX43_ResendRequest_TargetLocationID = 13,
+    FIX43_ResendRequest_OnBehalfOfSubID = 14,
+    FIX43_ResendRequest_OnBehalfOfLocationID = 15,
+    FIX43_ResendRequest_DeliverToSubID = 16,
+    FIX43_ResendRequest_DeliverToLocationID = 17,
+    FIX43_ResendRequest_PossDupFlag = 18,
+    FIX43_ResendRequest_PossResend = 19,
+    FIX43_ResendRequest_SendingTime = 20,
+    FIX43_ResendRequest_OrigSendingTime = 21,
+    FIX43_ResendRequest_XmlDataLen = 22,
+    FIX43_ResendRequest_XmlData = 23,
+    FIX43_ResendRequest_MessageEncoding = 24,
+    FIX43_ResendRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_ResendRequest_OnBehalfOfSendingTime = 26,
+    FIX43_ResendRequest_NoHops = 27,
+    FIX43_ResendRequest_BeginSeqNo = 28,
+    FIX43_ResendRequest_EndSeqNo = 29,
+    FIX43_ResendRequest_SignatureLength = 30,
+    FIX43_ResendRequest_Signature = 31,
+    FIX43_ResendRequest_CheckSum = 32,
+};
+
+typedef struct _fix43ResendRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    int64_t	BeginSeqNo;
+    int64_t	EndSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43ResendRequest;
+
+extern void	fix43_decode_ResendRequest(ofixErr err, fix43ResendRequest m, const char *raw, int len);
+extern void	fix43_decode_ResendRequest_msg(ofixErr err, fix43ResendRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_ResendRequest(ofixErr err, fix43ResendRequest m);
+
+// Reject [3]
+enum {
+    FIX43_Reject_BeginString = 0,
+    FIX43_Reject_BodyLength = 1,
+    FIX43_Reject_MsgType = 2,
+    FIX43_Reject_SenderCompID = 3,
+    FIX43_Reject_TargetCompID = 4,
+    FIX43_Reject_OnBehalfOfCompID = 5,
+    FIX43_Reject_DeliverToCompID = 6,
+    FIX43_Reject_SecureDataLen = 7,
+    FIX43_Reject_SecureData = 8,
+    FIX43_Reject_MsgSeqNum = 9,
+    FIX43_Reject_SenderSubID = 10,
+    FIX43_Reject_SenderLocationID = 11,
+    FIX43_Reject_TargetSubID = 12,
+    FIX43_Reject_TargetLocationID = 13,
+    FIX43_Reject_OnBehalfOfSubID = 14,
+    FIX43_Reject_OnBehalfOfLocationID = 15,
+    FIX43_Reject_DeliverToSubID = 16,
+    FIX43_Reject_DeliverToLocationID = 17,
+    FIX43_Reject_PossDupFlag = 18,
+    FIX43_Reject_PossResend = 19,
+    FIX43_Reject_SendingTime = 20,
+    FIX43_Reject_OrigSendingTime = 21,
+    FIX43_Reject_XmlDataLen = 22,
+    FIX43_Reject_XmlData = 23,
+    FIX43_Reject_MessageEncoding = 24,
+    FIX43_Reject_LastMsgSeqNumProcessed = 25,
+    FIX43_Reject_OnBehalfOfSendingTime = 26,
+    FIX43_Reject_NoHops = 27,
+    FIX43_Reject_RefSeqNum = 28,
+    FIX43_Reject_RefTagID = 29,
+    FIX43_Reject_RefMsgType = 30,
+    FIX43_Reject_SessionRejectReason = 31,
+    FIX43_Reject_Text = 32,
+    FIX43_Reject_EncodedTextLen = 33,
+    FIX43_Reject_EncodedText = 34,
+    FIX43_Reject_SignatureLength = 35,
+    FIX43_Reject_Signature = 36,
+    FIX43_Reject_CheckSum = 37,
+};
+
+typedef struct _fix43Reject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    int64_t	RefSeqNum;
+    int64_t	RefTagID;
+    struct _ofixStrView	RefMsgType;
+    int64_t	SessionRejectReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Reject;
+
+extern void	fix43_decode_Reject(ofixErr err, fix43Reject m, const char *raw, int len);
+extern void	fix43_decode_Reject_msg(ofixErr err, fix43Reject m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Reject(ofixErr err, fix43Reject m);
+
+// SequenceReset [4]
+enum {
+    FIX43_SequenceReset_BeginString = 0,
+    FIX43_SequenceReset_BodyLength = 1,
+    FIX43_SequenceReset_MsgType = 2,
+    FIX43_SequenceReset_SenderCompID = 3,
+    FIX43_SequenceReset_TargetCompID = 4,
+    FIX43_SequenceReset_OnBehalfOfCompID = 5,
+    FIX43_SequenceReset_DeliverToCompID = 6,
+    FIX43_SequenceReset_SecureDataLen = 7,
+    FIX43_SequenceReset_SecureData = 8,
+    FIX43_SequenceReset_MsgSeqNum = 9,
+    FIX43_SequenceReset_SenderSubID = 10,
+    FIX43_SequenceReset_SenderLocationID = 11,
+    FIX43_SequenceReset_TargetSubID = 12,
+    FIX43_SequenceReset_TargetLocationID = 13,
+    FIX43_SequenceReset_OnBehalfOfSubID = 14,
+    FIX43_SequenceReset_OnBehalfOfLocationID = 15,
+    FIX43_SequenceReset_DeliverToSubID = 16,
+    FIX43_SequenceReset_DeliverToLocationID = 17,
+    FIX43_SequenceReset_PossDupFlag = 18,
+    FIX43_SequenceReset_PossResend = 19,
+    FIX43_SequenceReset_SendingTime = 20,
+    FIX43_SequenceReset_OrigSendingTime = 21,
+    FIX43_SequenceReset_XmlDataLen = 22,
+    FIX43_SequenceReset_XmlData = 23,
+    FIX43_SequenceReset_MessageEncoding = 24,
+    FIX43_SequenceReset_LastMsgSeqNumProcessed = 25,
+    FIX43_SequenceReset_OnBehalfOfSendingTime = 26,
+    FIX43_SequenceReset_NoHops = 27,
+    FIX43_SequenceReset_GapFillFlag = 28,
+    FIX43_SequenceReset_NewSeqNo = 29,
+    FIX43_SequenceReset_SignatureLength = 30,
+    FIX43_SequenceReset_Signature = 31,
+    FIX43_SequenceReset_CheckSum = 32,
+};
+
+typedef struct _fix43SequenceReset {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    char	GapFillFlag;
+    int64_t	NewSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SequenceReset;
+
+extern void	fix43_decode_SequenceReset(ofixErr err, fix43SequenceReset m, const char *raw, int len);
+extern void	fix43_decode_SequenceReset_msg(ofixErr err, fix43SequenceReset m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SequenceReset(ofixErr err, fix43SequenceReset m);
+
+// Logout [5]
+enum {
+    FIX43_Logout_BeginString = 0,
+    FIX43_Logout_BodyLength = 1,
+    FIX43_Logout_MsgType = 2,
+    FIX43_Logout_SenderCompID = 3,
+    FIX43_Logout_TargetCompID = 4,
+    FIX43_Logout_OnBehalfOfCompID = 5,
+    FIX43_Logout_DeliverToCompID = 6,
+    FIX43_Logout_SecureDataLen = 7,
+    FIX43_Logout_SecureData = 8,
+    FIX43_Logout_MsgSeqNum = 9,
+    FIX43_Logout_SenderSubID = 10,
+    FIX43_Logout_SenderLocationID = 11,
+    FIX43_Logout_TargetSubID = 12,
+    FIX43_Logout_TargetLocationID = 13,
+    FIX43_Logout_OnBehalfOfSubID = 14,
+    FIX43_Logout_OnBehalfOfLocationID = 15,
+    FIX43_Logout_DeliverToSubID = 16,
+    FIX43_Logout_DeliverToLocationID = 17,
+    FIX43_Logout_PossDupFlag = 18,
+    FIX43_Logout_PossResend = 19,
+    FIX43_Logout_SendingTime = 20,
+    FIX43_Logout_OrigSendingTime = 21,
+    FIX43_Logout_XmlDataLen = 22,
+    FIX43_Logout_XmlData = 23,
+    FIX43_Logout_MessageEncoding = 24,
+    FIX43_Logout_LastMsgSeqNumProcessed = 25,
+    FIX43_Logout_OnBehalfOfSendingTime = 26,
+    FIX43_Logout_NoHops = 27,
+    FIX43_Logout_Text = 28,
+    FIX43_Logout_EncodedTextLen = 29,
+    FIX43_Logout_EncodedText = 30,
+    FIX43_Logout_SignatureLength = 31,
+    FIX43_Logout_Signature = 32,
+    FIX43_Logout_CheckSum = 33,
+};
+
+typedef struct _fix43Logout {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Logout;
+
+extern void	fix43_decode_Logout(ofixErr err, fix43Logout m, const char *raw, int len);
+extern void	fix43_decode_Logout_msg(ofixErr err, fix43Logout m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Logout(ofixErr err, fix43Logout m);
+
+// IndicationOfInterest [6]
+enum {
+    FIX43_IndicationOfInterest_BeginString = 0,
+    FIX43_IndicationOfInterest_BodyLength = 1,
+    FIX43_IndicationOfInterest_MsgType = 2,
+    FIX43_IndicationOfInterest_SenderCompID = 3,
+    FIX43_IndicationOfInterest_TargetCompID = 4,
+    FIX43_IndicationOfInterest_OnBehalfOfCompID = 5,
+    FIX43_IndicationOfInterest_DeliverToCompID = 6,
+    FIX43_IndicationOfInterest_SecureDataLen = 7,
+    FIX43_IndicationOfInterest_SecureData = 8,
+    FIX43_IndicationOfInterest_MsgSeqNum = 9,
+    FIX43_IndicationOfInterest_SenderSubID = 10,
+    FIX43_IndicationOfInterest_SenderLocationID = 11,
+    FIX43_IndicationOfInterest_TargetSubID = 12,
+    FIX43_IndicationOfInterest_TargetLocationID = 13,
+    FIX43_IndicationOfInterest_OnBehalfOfSubID = 14,
+    FIX43_IndicationOfInterest_OnBehalfOfLocationID = 15,
+    FIX43_IndicationOfInterest_DeliverToSubID = 16,
+    FIX43_IndicationOfInterest_DeliverToLocationID = 17,
+    FIX43_IndicationOfInterest_PossDupFlag = 18,
+    FIX43_IndicationOfInterest_PossResend = 19,
+    FIX43_IndicationOfInterest_SendingTime = 20,
+    FIX43_IndicationOfInterest_OrigSendingTime = 21,
+    FIX43_IndicationOfInterest_XmlDataLen = 22,
+    FIX43_IndicationOfInterest_XmlData = 23,
+    FIX43_IndicationOfInterest_MessageEncoding = 24,
+    FIX43_IndicationOfInterest_LastMsgSeqNumProcessed = 25,
+    FIX43_IndicationOfInterest_OnBehalfOfSendingTime = 26,
+    FIX43_IndicationOfInterest_NoHops = 27,
+    FIX43_IndicationOfInterest_IOIid = 28,
+    FIX43_IndicationOfInterest_IOITransType = 29,
+    FIX43_IndicationOfInterest_IOIRefID = 30,
+    FIX43_IndicationOfInterest_Symbol = 31,
+    FIX43_IndicationOfInterest_SymbolSfx = 32,
+    FIX43_IndicationOfInterest_SecurityID = 33,
+    FIX43_IndicationOfInterest_SecurityIDSource = 34,
+    FIX43_IndicationOfInterest_NoSecurityAltID = 35,
+    FIX43_IndicationOfInterest_Product = 36,
+    FIX43_IndicationOfInterest_CFICode = 37,
+    FIX43_IndicationOfInterest_SecurityType = 38,
+    FIX43_IndicationOfInterest_MaturityMonthYear = 39,
+    FIX43_IndicationOfInterest_MaturityDate = 40,
+    FIX43_IndicationOfInterest_CouponPaymentDate = 41,
+    FIX43_IndicationOfInterest_IssueDate = 42,
+    FIX43_IndicationOfInterest_RepoCollateralSecurityType = 43,
+    FIX43_IndicationOfInterest_RepurchaseTerm = 44,
+    FIX43_IndicationOfInterest_RepurchaseRate = 45,
+    FIX43_IndicationOfInterest_Factor = 46,
+    FIX43_IndicationOfInterest_CreditRating = 47,
+    FIX43_IndicationOfInterest_InstrRegistry = 48,
+    FIX43_IndicationOfInterest_CountryOfIssue = 49,
+    FIX43_IndicationOfInterest_StateOrProvinceOfIssue = 50,
+    FIX43_IndicationOfInterest_LocaleOfIssue = 51,
+    FIX43_IndicationOfInterest_RedemptionDate = 52,
+    FIX43_IndicationOfInterest_StrikePrice = 53,
+    FIX43_IndicationOfInterest_OptAttribute = 54,
+    FIX43_IndicationOfInterest_ContractMultiplier = 55,
+    FIX43_IndicationOfInterest_CouponRate = 56,
+    FIX43_IndicationOfInterest_SecurityExchange = 57,
+    FIX43_IndicationOfInterest_Issuer = 58,
+    FIX43_IndicationOfInterest_EncodedIssuerLen = 59,
+    FIX43_IndicationOfInterest_EncodedIssuer = 60,
+    FIX43_IndicationOfInterest_SecurityDesc = 61,
+    FIX43_IndicationOfInterest_EncodedSecurityDescLen = 62,
+    FIX43_IndicationOfInterest_EncodedSecurityDesc = 63,
+    FIX43_IndicationOfInterest_Side = 64,
+    FIX43_IndicationOfInterest_QuantityType = 65,
+    FIX43_IndicationOfInterest_IOIQty = 66,
+    FIX43_IndicationOfInterest_PriceType = 67,
+    FIX43_IndicationOfInterest_Price = 68,
+    FIX43_IndicationOfInterest_Currency = 69,
+    FIX43_IndicationOfInterest_ValidUntilTime = 70,
+    FIX43_IndicationOfInterest_IOIQltyInd = 71,
+    FIX43_IndicationOfInterest_IOINaturalFlag = 72,
+    FIX43_IndicationOfInterest_NoIOIQualifiers = 73,
+    FIX43_IndicationOfInterest_Text = 74,
+    FIX43_IndicationOfInterest_EncodedTextLen = 75,
+    FIX43_IndicationOfInterest_EncodedText = 76,
+    FIX43_IndicationOfInterest_TransactTime = 77,
+    FIX43_IndicationOfInterest_URLLink = 78,
+    FIX43_IndicationOfInterest_NoRoutingIDs = 79,
+    FIX43_IndicationOfInterest_Spread = 80,
+    FIX43_IndicationOfInterest_BenchmarkCurveCurrency = 81,
+    FIX43_IndicationOfInterest_BenchmarkCurveName = 82,
+    FIX43_IndicationOfInterest_BenchmarkCurvePoint = 83,
+    FIX43_IndicationOfInterest_Benchmark = 84,
+    FIX43_IndicationOfInterest_SignatureLength = 85,
+    FIX43_IndicationOfInterest_Signature = 86,
+    FIX43_IndicationOfInterest_CheckSum = 87,
+};
+
+typedef struct _fix43IndicationOfInterest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	IOIid;
+    char	IOITransType;
+    struct _ofixStrView	IOIRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    int64_t	QuantityType;
+    struct _ofixStrView	IOIQty;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixDate	ValidUntilTime;
+    char	IOIQltyInd;
+    char	IOINaturalFlag;
+    int64_t	NoIOIQualifiers;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	URLLink;
+    int64_t	NoRoutingIDs;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    char	Benchmark;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43IndicationOfInterest;
+
+extern void	fix43_decode_IndicationOfInterest(ofixErr err, fix43IndicationOfInterest m, const char *raw, int len);
+extern void	fix43_decode_IndicationOfInterest_msg(ofixErr err, fix43IndicationOfInterest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_IndicationOfInterest(ofixErr err, fix43IndicationOfInterest m);
+
+// Advertisement [7]
+enum {
+    FIX43_Advertisement_BeginString = 0,
+    FIX43_Advertisement_BodyLength = 1,
+    FIX43_Advertisement_MsgType = 2,
+    FIX43_Advertisement_SenderCompID = 3,
+    FIX43_Advertisement_TargetCompID = 4,
+    FIX43_Advertisement_OnBehalfOfCompID = 5,
+    FIX43_Advertisement_DeliverToCompID = 6,
+    FIX43_Advertisement_SecureDataLen = 7,
+    FIX43_Advertisement_SecureData = 8,
+    FIX43_Advertisement_MsgSeqNum = 9,
+    FIX43_Advertisement_SenderSubID = 10,
+    FIX43_Advertisement_SenderLocationID = 11,
+    FIX43_Advertisement_TargetSubID = 12,
+    FIX43_Advertisement_TargetLocationID = 13,
+    FIX43_Advertisement_OnBehalfOfSubID = 14,
+    FIX43_Advertisement_OnBehalfOfLocationID = 15,
+    FIX43_Advertisement_DeliverToSubID = 16,
+    FIX43_Advertisement_DeliverToLocationID = 17,
+    FIX43_Advertisement_PossDupFlag = 18,
+    FIX43_Advertisement_PossResend = 19,
+    FIX43_Advertisement_SendingTime = 20,
+    FIX43_Advertisement_OrigSendingTime = 21,
+    FIX43_Advertisement_XmlDataLen = 22,
+    FIX43_Advertisement_XmlData = 23,
+    FIX43_Advertisement_MessageEncoding = 24,
+    FIX43_Advertisement_LastMsgSeqNumProcessed = 25,
+    FIX43_Advertisement_OnBehalfOfSendingTime = 26,
+    FIX43_Advertisement_NoHops = 27,
+    FIX43_Advertisement_AdvId = 28,
+    FIX43_Advertisement_AdvTransType = 29,
+    FIX43_Advertisement_AdvRefID = 30,
+    FIX43_Advertisement_Symbol = 31,
+    FIX43_Advertisement_SymbolSfx = 32,
+    FIX43_Advertisement_SecurityID = 33,
+    FIX43_Advertisement_SecurityIDSource = 34,
+    FIX43_Advertisement_NoSecurityAltID = 35,
+    FIX43_Advertisement_Product = 36,
+    FIX43_Advertisement_CFICode = 37,
+    FIX43_Advertisement_SecurityType = 38,
+    FIX43_Advertisement_MaturityMonthYear = 39,
+    FIX43_Advertisement_MaturityDate = 40,
+    FIX43_Advertisement_CouponPaymentDate = 41,
+    FIX43_Advertisement_IssueDate = 42,
+    FIX43_Advertisement_RepoCollateralSecurityType = 43,
+    FIX43_Advertisement_RepurchaseTerm = 44,
+    FIX43_Advertisement_RepurchaseRate = 45,
+    FIX43_Advertisement_Factor = 46,
+    FIX43_Advertisement_CreditRating = 47,
+    FIX43_Advertisement_InstrRegistry = 48,
+    FIX43_Advertisement_CountryOfIssue = 49,
+    FIX43_Advertisement_StateOrProvinceOfIssue = 50,
+    FIX43_Advertisement_LocaleOfIssue = 51,
+    FIX43_Advertisement_RedemptionDate = 52,
+    FIX43_Advertisement_StrikePrice = 53,
+    FIX43_Advertisement_OptAttribute = 54,
+    FIX43_Advertisement_ContractMultiplier = 55,
+    FIX43_Advertisement_CouponRate = 56,
+    FIX43_Advertisement_SecurityExchange = 57,
+    FIX43_Advertisement_Issuer = 58,
+    FIX43_Advertisement_EncodedIssuerLen = 59,
+    FIX43_Advertisement_EncodedIssuer = 60,
+    FIX43_Advertisement_SecurityDesc = 61,
+    FIX43_Advertisement_EncodedSecurityDescLen = 62,
+    FIX43_Advertisement_EncodedSecurityDesc = 63,
+    FIX43_Advertisement_AdvSide = 64,
+    FIX43_Advertisement_Quantity = 65,
+    FIX43_Advertisement_Price = 66,
+    FIX43_Advertisement_Currency = 67,
+    FIX43_Advertisement_TradeDate = 68,
+    FIX43_Advertisement_TransactTime = 69,
+    FIX43_Advertisement_Text = 70,
+    FIX43_Advertisement_EncodedTextLen = 71,
+    FIX43_Advertisement_EncodedText = 72,
+    FIX43_Advertisement_URLLink = 73,
+    FIX43_Advertisement_LastMkt = 74,
+    FIX43_Advertisement_TradingSessionID = 75,
+    FIX43_Advertisement_TradingSessionSubID = 76,
+    FIX43_Advertisement_SignatureLength = 77,
+    FIX43_Advertisement_Signature = 78,
+    FIX43_Advertisement_CheckSum = 79,
+};
+
+typedef struct _fix43Advertisement {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	AdvId;
+    struct _ofixStrView	AdvTransType;
+    struct _ofixStrView	AdvRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	AdvSide;
+    struct _ofixDecimal	Quantity;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	URLLink;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Advertisement;
+
+extern void	fix43_decode_Advertisement(ofixErr err, fix43Advertisement m, const char *raw, int len);
+extern void	fix43_decode_Advertisement_msg(ofixErr err, fix43Advertisement m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Advertisement(ofixErr err, fix43Advertisement m);
+
+// ExecutionReport [8]
+enum {
+    FIX43_ExecutionReport_BeginString = 0,
+    FIX43_ExecutionReport_BodyLength = 1,
+    FIX43_ExecutionReport_MsgType = 2,
+    FIX43_ExecutionReport_SenderCompID = 3,
+    FIX43_ExecutionReport_TargetCompID = 4,
+    FIX43_ExecutionReport_OnBehalfOfCompID = 5,
+    FIX43_ExecutionReport_DeliverToCompID = 6,
+    FIX43_ExecutionReport_SecureDataLen = 7,
+    FIX43_ExecutionReport_SecureData = 8,
+    FIX43_ExecutionReport_MsgSeqNum = 9,
+    FIX43_ExecutionReport_SenderSubID = 10,
+    FIX43_ExecutionReport_SenderLocationID = 11,
+    FIX43_ExecutionReport_TargetSubID = 12,
+    FIX43_ExecutionReport_TargetLocationID = 13,
+    FIX43_ExecutionReport_OnBehalfOfSubID = 14,
+    FIX43_ExecutionReport_OnBehalfOfLocationID = 15,
+    FIX43_ExecutionReport_DeliverToSubID = 16,
+    FIX43_ExecutionReport_DeliverToLocationID = 17,
+    FIX43_ExecutionReport_PossDupFlag = 18,
+    FIX43_ExecutionReport_PossResend = 19,
+    FIX43_ExecutionReport_SendingTime = 20,
+    FIX43_ExecutionReport_OrigSendingTime = 21,
+    FIX43_ExecutionReport_XmlDataLen = 22,
+    FIX43_ExecutionReport_XmlData = 23,
+    FIX43_ExecutionReport_MessageEncoding = 24,
+    FIX43_ExecutionReport_LastMsgSeqNumProcessed = 25,
+    FIX43_ExecutionReport_OnBehalfOfSendingTime = 26,
+    FIX43_ExecutionReport_NoHops = 27,
+    FIX43_ExecutionReport_OrderID = 28,
+    FIX43_ExecutionReport_SecondaryOrderID = 29,
+    FIX43_ExecutionReport_SecondaryClOrdID = 30,
+    FIX43_ExecutionReport_SecondaryExecID = 31,
+    FIX43_ExecutionReport_ClOrdID = 32,
+    FIX43_ExecutionReport_OrigClOrdID = 33,
+    FIX43_ExecutionReport_ClOrdLinkID = 34,
+    FIX43_ExecutionReport_NoPartyIDs = 35,
+    FIX43_ExecutionReport_TradeOriginationDate = 36,
+    FIX43_ExecutionReport_NoContraBrokers = 37,
+    FIX43_ExecutionReport_ListID = 38,
+    FIX43_ExecutionReport_CrossID = 39,
+    FIX43_ExecutionReport_OrigCrossID = 40,
+    FIX43_ExecutionReport_CrossType = 41,
+    FIX43_ExecutionReport_ExecID = 42,
+    FIX43_ExecutionReport_ExecRefID = 43,
+    FIX43_ExecutionReport_ExecType = 44,
+    FIX43_ExecutionReport_OrdStatus = 45,
+    FIX43_ExecutionReport_WorkingIndicator = 46,
+    FIX43_ExecutionReport_OrdRejReason = 47,
+    FIX43_ExecutionReport_ExecRestatementReason = 48,
+    FIX43_ExecutionReport_Account = 49,
+    FIX43_ExecutionReport_AccountType = 50,
+    FIX43_ExecutionReport_DayBookingInst = 51,
+    FIX43_ExecutionReport_BookingUnit = 52,
+    FIX43_ExecutionReport_PreallocMethod = 53,
+    FIX43_ExecutionReport_SettlmntTyp = 54,
+    FIX43_ExecutionReport_FutSettDate = 55,
+    FIX43_ExecutionReport_CashMargin = 56,
+    FIX43_ExecutionReport_ClearingFeeIndicator = 57,
+    FIX43_ExecutionReport_Symbol = 58,
+    FIX43_ExecutionReport_SymbolSfx = 59,
+    FIX43_ExecutionReport_SecurityID = 60,
+    FIX43_ExecutionReport_SecurityIDSource = 61,
+    FIX43_ExecutionReport_NoSecurityAltID = 62,
+    FIX43_ExecutionReport_Product = 63,
+    FIX43_ExecutionReport_CFICode = 64,
+    FIX43_ExecutionReport_SecurityType = 65,
+    FIX43_ExecutionReport_MaturityMonthYear = 66,
+    FIX43_ExecutionReport_MaturityDate = 67,
+    FIX43_ExecutionReport_CouponPaymentDate = 68,
+    FIX43_ExecutionReport_IssueDate = 69,
+    FIX43_ExecutionReport_RepoCollateralSecurityType = 70,
+    FIX43_ExecutionReport_RepurchaseTerm = 71,
+    FIX43_ExecutionReport_RepurchaseRate = 72,
+    FIX43_ExecutionReport_Factor = 73,
+    FIX43_ExecutionReport_CreditRating = 74,
+    FIX43_ExecutionReport_InstrRegistry = 75,
+    FIX43_ExecutionReport_CountryOfIssue = 76,
+    FIX43_ExecutionReport_StateOrProvinceOfIssue = 77,
+    FIX43_ExecutionReport_LocaleOfIssue = 78,
+    FIX43_ExecutionReport_RedemptionDate = 79,
+    FIX43_ExecutionReport_StrikePrice = 80,
+    FIX43_ExecutionReport_OptAttribute = 81,
+    FIX43_ExecutionReport_ContractMultiplier = 82,
+    FIX43_ExecutionReport_CouponRate = 83,
+    FIX43_ExecutionReport_SecurityExchange = 84,
+    FIX43_ExecutionReport_Issuer = 85,
+    FIX43_ExecutionReport_EncodedIssuerLen = 86,
+    FIX43_ExecutionReport_EncodedIssuer = 87,
+    FIX43_ExecutionReport_SecurityDesc = 88,
+    FIX43_ExecutionReport_EncodedSecurityDescLen = 89,
+    FIX43_ExecutionReport_EncodedSecurityDesc = 90,
+    FIX43_ExecutionReport_Side = 91,
+    FIX43_ExecutionReport_NoStipulations = 92,
+    FIX43_ExecutionReport_QuantityType = 93,
+    FIX43_ExecutionReport_OrderQty = 94,
+    FIX43_ExecutionReport_CashOrderQty = 95,
+    FIX43_ExecutionReport_OrderPercent = 96,
+    FIX43_ExecutionReport_RoundingDirection = 97,
+    FIX43_ExecutionReport_RoundingModulus = 98,
+    FIX43_ExecutionReport_OrdType = 99,
+    FIX43_ExecutionReport_PriceType = 100,
+    FIX43_ExecutionReport_Price = 101,
+    FIX43_ExecutionReport_StopPx = 102,
+    FIX43_ExecutionReport_PegDifference = 103,
+    FIX43_ExecutionReport_DiscretionInst = 104,
+    FIX43_ExecutionReport_DiscretionOffset = 105,
+    FIX43_ExecutionReport_Currency = 106,
+    FIX43_ExecutionReport_ComplianceID = 107,
+    FIX43_ExecutionReport_SolicitedFlag = 108,
+    FIX43_ExecutionReport_TimeInForce = 109,
+    FIX43_ExecutionReport_EffectiveTime = 110,
+    FIX43_ExecutionReport_ExpireDate = 111,
+    FIX43_ExecutionReport_ExpireTime = 112,
+    FIX43_ExecutionReport_ExecInst = 113,
+    FIX43_ExecutionReport_OrderCapacity = 114,
+    FIX43_ExecutionReport_OrderRestrictions = 115,
+    FIX43_ExecutionReport_CustOrderCapacity = 116,
+    FIX43_ExecutionReport_Rule80A = 117,
+    FIX43_ExecutionReport_LastQty = 118,
+    FIX43_ExecutionReport_UnderlyingLastQty = 119,
+    FIX43_ExecutionReport_LastPx = 120,
+    FIX43_ExecutionReport_UnderlyingLastPx = 121,
+    FIX43_ExecutionReport_LastSpotRate = 122,
+    FIX43_ExecutionReport_LastForwardPoints = 123,
+    FIX43_ExecutionReport_LastMkt = 124,
+    FIX43_ExecutionReport_TradingSessionID = 125,
+    FIX43_ExecutionReport_TradingSessionSubID = 126,
+    FIX43_ExecutionReport_LastCapacity = 127,
+    FIX43_ExecutionReport_LeavesQty = 128,
+    FIX43_ExecutionReport_CumQty = 129,
+    FIX43_ExecutionReport_AvgPx = 130,
+    FIX43_ExecutionReport_DayOrderQty = 131,
+    FIX43_ExecutionReport_DayCumQty = 132,
+    FIX43_ExecutionReport_DayAvgPx = 133,
+    FIX43_ExecutionReport_GTBookingInst = 134,
+    FIX43_ExecutionReport_TradeDate = 135,
+    FIX43_ExecutionReport_TransactTime = 136,
+    FIX43_ExecutionReport_ReportToExch = 137,
+    FIX43_ExecutionReport_Commission = 138,
+    FIX43_ExecutionReport_CommType = 139,
+    FIX43_ExecutionReport_CommCurrency = 140,
+    FIX43_ExecutionReport_FundRenewWaiv = 141,
+    FIX43_ExecutionReport_Spread = 142,
+    FIX43_ExecutionReport_BenchmarkCurveCurrency = 143,
+    FIX43_ExecutionReport_BenchmarkCurveName = 144,
+    FIX43_ExecutionReport_BenchmarkCurvePoint = 145,
+    FIX43_ExecutionReport_YieldType = 146,
+    FIX43_ExecutionReport_Yield = 147,
+    FIX43_ExecutionReport_GrossTradeAmt = 148,
+    FIX43_ExecutionReport_NumDaysInterest = 149,
+    FIX43_ExecutionReport_ExDate = 150,
+    FIX43_ExecutionReport_AccruedInterestRate = 151,
+    FIX43_ExecutionReport_AccruedInterestAmt = 152,
+    FIX43_ExecutionReport_TradedFlatSwitch = 153,
+    FIX43_ExecutionReport_BasisFeatureDate = 154,
+    FIX43_ExecutionReport_BasisFeaturePrice = 155,
+    FIX43_ExecutionReport_Concession = 156,
+    FIX43_ExecutionReport_TotalTakedown = 157,
+    FIX43_ExecutionReport_NetMoney = 158,
+    FIX43_ExecutionReport_SettlCurrAmt = 159,
+    FIX43_ExecutionReport_SettlCurrency = 160,
+    FIX43_ExecutionReport_SettlCurrFxRate = 161,
+    FIX43_ExecutionReport_SettlCurrFxRateCalc = 162,
+    FIX43_ExecutionReport_HandlInst = 163,
+    FIX43_ExecutionReport_MinQty = 164,
+    FIX43_ExecutionReport_MaxFloor = 165,
+    FIX43_ExecutionReport_PositionEffect = 166,
+    FIX43_ExecutionReport_MaxShow = 167,
+    FIX43_ExecutionReport_Text = 168,
+    FIX43_ExecutionReport_EncodedTextLen = 169,
+    FIX43_ExecutionReport_EncodedText = 170,
+    FIX43_ExecutionReport_FutSettDate2 = 171,
+    FIX43_ExecutionReport_OrderQty2 = 172,
+    FIX43_ExecutionReport_LastForwardPoints2 = 173,
+    FIX43_ExecutionReport_MultiLegReportingType = 174,
+    FIX43_ExecutionReport_CancellationRights = 175,
+    FIX43_ExecutionReport_MoneyLaunderingStatus = 176,
+    FIX43_ExecutionReport_RegistID = 177,
+    FIX43_ExecutionReport_Designation = 178,
+    FIX43_ExecutionReport_TransBkdTime = 179,
+    FIX43_ExecutionReport_ExecValuationPoint = 180,
+    FIX43_ExecutionReport_ExecPriceType = 181,
+    FIX43_ExecutionReport_ExecPriceAdjustment = 182,
+    FIX43_ExecutionReport_PriorityIndicator = 183,
+    FIX43_ExecutionReport_PriceImprovement = 184,
+    FIX43_ExecutionReport_NoContAmts = 185,
+    FIX43_ExecutionReport_NoLegs = 186,
+    FIX43_ExecutionReport_SignatureLength = 187,
+    FIX43_ExecutionReport_Signature = 188,
+    FIX43_ExecutionReport_CheckSum = 189,
+};
+
+typedef struct _fix43ExecutionReport {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	SecondaryExecID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    int64_t	NoPartyIDs;
+    struct _ofixDate	TradeOriginationDate;
+    int64_t	NoContraBrokers;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	CrossID;
+    struct _ofixStrView	OrigCrossID;
+    int64_t	CrossType;
+    struct _ofixStrView	ExecID;
+    struct _ofixStrView	ExecRefID;
+    char	ExecType;
+    char	OrdStatus;
+    char	WorkingIndicator;
+    int64_t	OrdRejReason;
+    int64_t	ExecRestatementReason;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    int64_t	NoStipulations;
+    int64_t	QuantityType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    struct _ofixStrView	ExecInst;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	Rule80A;
+    struct _ofixDecimal	LastQty;
+    struct _ofixDecimal	UnderlyingLastQty;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDecimal	UnderlyingLastPx;
+    struct _ofixDecimal	LastSpotRate;
+    struct _ofixDecimal	LastForwardPoints;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	LastCapacity;
+    struct _ofixDecimal	LeavesQty;
+    struct _ofixDecimal	CumQty;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDecimal	DayOrderQty;
+    struct _ofixDecimal	DayCumQty;
+    struct _ofixDecimal	DayAvgPx;
+    int64_t	GTBookingInst;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	ReportToExch;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixDecimal	GrossTradeAmt;
+    int64_t	NumDaysInterest;
+    struct _ofixDate	ExDate;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    char	TradedFlatSwitch;
+    struct _ofixDate	BasisFeatureDate;
+    struct _ofixDecimal	BasisFeaturePrice;
+    struct _ofixDecimal	Concession;
+    struct _ofixDecimal	TotalTakedown;
+    struct _ofixDecimal	NetMoney;
+    struct _ofixDecimal	SettlCurrAmt;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixDecimal	SettlCurrFxRate;
+    char	SettlCurrFxRateCalc;
+    char	HandlInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    char	PositionEffect;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	LastForwardPoints2;
+    char	MultiLegReportingType;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    struct _ofixDate	TransBkdTime;
+    struct _ofixDate	ExecValuationPoint;
+    char	ExecPriceType;
+    struct _ofixDecimal	ExecPriceAdjustment;
+    int64_t	PriorityIndicator;
+    struct _ofixDecimal	PriceImprovement;
+    int64_t	NoContAmts;
+    int64_t	NoLegs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43ExecutionReport;
+
+extern void	fix43_decode_ExecutionReport(ofixErr err, fix43ExecutionReport m, const char *raw, int len);
+extern void	fix43_decode_ExecutionReport_msg(ofixErr err, fix43ExecutionReport m, ofixMsg msg);
+extern ofixMsg	fix43_encode_ExecutionReport(ofixErr err, fix43ExecutionReport m);
+
+// OrderCancelReject [9]
+enum {
+    FIX43_OrderCancelReject_BeginString = 0,
+    FIX43_OrderCancelReject_BodyLength = 1,
+    FIX43_OrderCancelReject_MsgType = 2,
+    FIX43_OrderCancelReject_SenderCompID = 3,
+    FIX43_OrderCancelReject_TargetCompID = 4,
+    FIX43_OrderCancelReject_OnBehalfOfCompID = 5,
+    FIX43_OrderCancelReject_DeliverToCompID = 6,
+    FIX43_OrderCancelReject_SecureDataLen = 7,
+    FIX43_OrderCancelReject_SecureData = 8,
+    FIX43_OrderCancelReject_MsgSeqNum = 9,
+    FIX43_OrderCancelReject_SenderSubID = 10,
+    FIX43_OrderCancelReject_SenderLocationID = 11,
+    FIX43_OrderCancelReject_TargetSubID = 12,
+    FIX43_OrderCancelReject_TargetLocationID = 13,
+    FIX43_OrderCancelReject_OnBehalfOfSubID = 14,
+    FIX43_OrderCancelReject_OnBehalfOfLocationID = 15,
+    FIX43_OrderCancelReject_DeliverToSubID = 16,
+    FIX43_OrderCancelReject_DeliverToLocationID = 17,
+    FIX43_OrderCancelReject_PossDupFlag = 18,
+    FIX43_OrderCancelReject_PossResend = 19,
+    FIX43_OrderCancelReject_SendingTime = 20,
+    FIX43_OrderCancelReject_OrigSendingTime = 21,
+    FIX43_OrderCancelReject_XmlDataLen = 22,
+    FIX43_OrderCancelReject_XmlData = 23,
+    FIX43_OrderCancelReject_MessageEncoding = 24,
+    FIX43_OrderCancelReject_LastMsgSeqNumProcessed = 25,
+    FIX43_OrderCancelReject_OnBehalfOfSendingTime = 26,
+    FIX43_OrderCancelReject_NoHops = 27,
+    FIX43_OrderCancelReject_OrderID = 28,
+    FIX43_OrderCancelReject_SecondaryOrderID = 29,
+    FIX43_OrderCancelReject_SecondaryClOrdID = 30,
+    FIX43_OrderCancelReject_ClOrdID = 31,
+    FIX43_OrderCancelReject_ClOrdLinkID = 32,
+    FIX43_OrderCancelReject_OrigClOrdID = 33,
+    FIX43_OrderCancelReject_OrdStatus = 34,
+    FIX43_OrderCancelReject_WorkingIndicator = 35,
+    FIX43_OrderCancelReject_OrigOrdModTime = 36,
+    FIX43_OrderCancelReject_ListID = 37,
+    FIX43_OrderCancelReject_Account = 38,
+    FIX43_OrderCancelReject_AccountType = 39,
+    FIX43_OrderCancelReject_TradeOriginationDate = 40,
+    FIX43_OrderCancelReject_TransactTime = 41,
+    FIX43_OrderCancelReject_CxlRejResponseTo = 42,
+    FIX43_OrderCancelReject_CxlRejReason = 43,
+    FIX43_OrderCancelReject_Text = 44,
+    FIX43_OrderCancelReject_EncodedTextLen = 45,
+    FIX43_OrderCancelReject_EncodedText = 46,
+    FIX43_OrderCancelReject_SignatureLength = 47,
+    FIX43_OrderCancelReject_Signature = 48,
+    FIX43_OrderCancelReject_CheckSum = 49,
+};
+
+typedef struct _fix43OrderCancelReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixStrView	OrigClOrdID;
+    char	OrdStatus;
+    char	WorkingIndicator;
+    struct _ofixDate	OrigOrdModTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixDate	TradeOriginationDate;
+    struct _ofixDate	TransactTime;
+    char	CxlRejResponseTo;
+    int64_t	CxlRejReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43OrderCancelReject;
+
+extern void	fix43_decode_OrderCancelReject(ofixErr err, fix43OrderCancelReject m, const char *raw, int len);
+extern void	fix43_decode_OrderCancelReject_msg(ofixErr err, fix43OrderCancelReject m, ofixMsg msg);
+extern ofixMsg	fix43_encode_OrderCancelReject(ofixErr err, fix43OrderCancelReject m);
+
+// Logon [A]
+enum {
+    FIX43_Logon_BeginString = 0,
+    FIX43_Logon_BodyLength = 1,
+    FIX43_Logon_MsgType = 2,
+    FIX43_Logon_SenderCompID = 3,
+    FIX43_Logon_TargetCompID = 4,
+    FIX43_Logon_OnBehalfOfCompID = 5,
+    FIX43_Logon_DeliverToCompID = 6,
+    FIX43_Logon_SecureDataLen = 7,
+    FIX43_Logon_SecureData = 8,
+    FIX43_Logon_MsgSeqNum = 9,
+    FIX43_Logon_SenderSubID = 10,
+    FIX43_Logon_SenderLocationID = 11,
+    FIX43_Logon_TargetSubID = 12,
+    FIX43_Logon_TargetLocationID = 13,
+    FIX43_Logon_OnBehalfOfSubID = 14,
+    FIX43_Logon_OnBehalfOfLocationID = 15,
+    FIX43_Logon_DeliverToSubID = 16,
+    FIX43_Logon_DeliverToLocationID = 17,
+    FIX43_Logon_PossDupFlag = 18,
+    FIX43_Logon_PossResend = 19,
+    FIX43_Logon_SendingTime = 20,
+    FIX43_Logon_OrigSendingTime = 21,
+    FIX43_Logon_XmlDataLen = 22,
+    FIX43_Logon_XmlData = 23,
+    FIX43_Logon_MessageEncoding = 24,
+    FIX43_Logon_LastMsgSeqNumProcessed = 25,
+    FIX43_Logon_OnBehalfOfSendingTime = 26,
+    FIX43_Logon_NoHops = 27,
+    FIX43_Logon_EncryptMethod = 28,
+    FIX43_Logon_HeartBtInt = 29,
+    FIX43_Logon_RawDataLength = 30,
+    FIX43_Logon_RawData = 31,
+    FIX43_Logon_ResetSeqNumFlag = 32,
+    FIX43_Logon_MaxMessageSize = 33,
+    FIX43_Logon_NoMsgTypes = 34,
+    FIX43_Logon_TestMessageIndicator = 35,
+    FIX43_Logon_Username = 36,
+    FIX43_Logon_Password = 37,
+    FIX43_Logon_SignatureLength = 38,
+    FIX43_Logon_Signature = 39,
+    FIX43_Logon_CheckSum = 40,
+};
+
+typedef struct _fix43Logon {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    int64_t	EncryptMethod;
+    int64_t	HeartBtInt;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    char	ResetSeqNumFlag;
+    int64_t	MaxMessageSize;
+    int64_t	NoMsgTypes;
+    char	TestMessageIndicator;
+    struct _ofixStrView	Username;
+    struct _ofixStrView	Password;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Logon;
+
+extern void	fix43_decode_Logon(ofixErr err, fix43Logon m, const char *raw, int len);
+extern void	fix43_decode_Logon_msg(ofixErr err, fix43Logon m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Logon(ofixErr err, fix43Logon m);
+
+// DerivativeSecurityList [AA]
+enum {
+    FIX43_DerivativeSecurityList_BeginString = 0,
+    FIX43_DerivativeSecurityList_BodyLength = 1,
+    FIX43_DerivativeSecurityList_MsgType = 2,
+    FIX43_DerivativeSecurityList_SenderCompID = 3,
+    FIX43_DerivativeSecurityList_TargetCompID = 4,
+    FIX43_DerivativeSecurityList_OnBehalfOfCompID = 5,
+    FIX43_DerivativeSecurityList_DeliverToCompID = 6,
+    FIX43_DerivativeSecurityList_SecureDataLen = 7,
+    FIX43_DerivativeSecurityList_SecureData = 8,
+    FIX43_DerivativeSecurityList_MsgSeqNum = 9,
+    FIX43_DerivativeSecurityList_SenderSubID = 10,
+    FIX43_DerivativeSecurityList_SenderLocationID = 11,
+    FIX43_DerivativeSecurityList_TargetSubID = 12,
+    FIX43_DerivativeSecurityList_TargetLocationID = 13,
+    FIX43_DerivativeSecurityList_OnBehalfOfSubID = 14,
+    FIX43_DerivativeSecurityList_OnBehalfOfLocationID = 15,
+    FIX43_DerivativeSecurityList_DeliverToSubID = 16,
+    FIX43_DerivativeSecurityList_DeliverToLocationID = 17,
+    FIX43_DerivativeSecurityList_PossDupFlag = 18,
+    FIX43_DerivativeSecurityList_PossResend = 19,
+    FIX43_DerivativeSecurityList_SendingTime = 20,
+    FIX43_DerivativeSecurityList_OrigSendingTime = 21,
+    FIX43_DerivativeSecurityList_XmlDataLen = 22,
+    FIX43_DerivativeSecurityList_XmlData = 23,
+    FIX43_DerivativeSecurityList_MessageEncoding = 24,
+    FIX43_DerivativeSecurityList_LastMsgSeqNumProcessed = 25,
+    FIX43_DerivativeSecurityList_OnBehalfOfSendingTime = 26,
+    FIX43_DerivativeSecurityList_NoHops = 27,
+    FIX43_DerivativeSecurityList_SecurityReqID = 28,
+    FIX43_DerivativeSecurityList_SecurityResponseID = 29,
+    FIX43_DerivativeSecurityList_SecurityRequestResult = 30,
+    FIX43_DerivativeSecurityList_UnderlyingSymbol = 31,
+    FIX43_DerivativeSecurityList_UnderlyingSymbolSfx = 32,
+    FIX43_DerivativeSecurityList_UnderlyingSecurityID = 33,
+    FIX43_DerivativeSecurityList_UnderlyingSecurityIDSource = 34,
+    FIX43_DerivativeSecurityList_NoUnderlyingSecurityAltID = 35,
+    FIX43_DerivativeSecurityList_UnderlyingProduct = 36,
+    FIX43_DerivativeSecurityList_UnderlyingCFICode = 37,
+    FIX43_DerivativeSecurityList_UnderlyingSecurityType = 38,
+    FIX43_DerivativeSecurityList_UnderlyingMaturityMonthYear = 39,
+    FIX43_DerivativeSecurityList_UnderlyingMaturityDate = 40,
+    FIX43_DerivativeSecurityList_UnderlyingCouponPaymentDate = 41,
+    FIX43_DerivativeSecurityList_UnderlyingIssueDate = 42,
+    FIX43_DerivativeSecurityList_UnderlyingRepoCollateralSecurityType = 43,
+    FIX43_DerivativeSecurityList_UnderlyingRepurchaseTerm = 44,
+    FIX43_DerivativeSecurityList_UnderlyingRepurchaseRate = 45,
+    FIX43_DerivativeSecurityList_UnderlyingFactor = 46,
+    FIX43_DerivativeSecurityList_UnderlyingCreditRating = 47,
+    FIX43_DerivativeSecurityList_UnderlyingInstrRegistry = 48,
+    FIX43_DerivativeSecurityList_UnderlyingCountryOfIssue = 49,
+    FIX43_DerivativeSecurityList_UnderlyingStateOrProvinceOfIssue = 50,
+    FIX43_DerivativeSecurityList_UnderlyingLocaleOfIssue = 51,
+    FIX43_DerivativeSecurityList_UnderlyingRedemptionDate = 52,
+    FIX43_DerivativeSecurityList_UnderlyingPutOrCall = 53,
+    FIX43_DerivativeSecurityList_UnderlyingStrikePrice = 54,
+    FIX43_DerivativeSecurityList_UnderlyingOptAttribute = 55,
+    FIX43_DerivativeSecurityList_UnderlyingContractMultiplier = 56,
+    FIX43_DerivativeSecurityList_UnderlyingCouponRate = 57,
+    FIX43_DerivativeSecurityList_UnderlyingSecurityExchange = 58,
+    FIX43_DerivativeSecurityList_UnderlyingIssuer = 59,
+    FIX43_DerivativeSecurityList_EncodedUnderlyingIssuerLen = 60,
+    FIX43_DerivativeSecurityList_EncodedUnderlyingIssuer = 61,
+    FIX43_DerivativeSecurityList_UnderlyingSecurityDesc = 62,
+    FIX43_DerivativeSecurityList_EncodedUnderlyingSecurityDescLen = 63,
+    FIX43_DerivativeSecurityList_EncodedUnderlyingSecurityDesc = 64,
+    FIX43_DerivativeSecurityList_TotalNumSecurities = 65,
+    FIX43_DerivativeSecurityList_NoRelatedSym = 66,
+    FIX43_DerivativeSecurityList_SignatureLength = 67,
+    FIX43_DerivativeSecurityList_Signature = 68,
+    FIX43_DerivativeSecurityList_CheckSum = 69,
+};
+
+typedef struct _fix43DerivativeSecurityList {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityRequestResult;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixDate	UnderlyingCouponPaymentDate;
+    struct _ofixDate	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixDate	UnderlyingRedemptionDate;
+    int64_t	UnderlyingPutOrCall;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    int64_t	TotalNumSecurities;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43DerivativeSecurityList;
+
+extern void	fix43_decode_DerivativeSecurityList(ofixErr err, fix43DerivativeSecurityList m, const char *raw, int len);
+extern void	fix43_decode_DerivativeSecurityList_msg(ofixErr err, fix43DerivativeSecurityList m, ofixMsg msg);
+extern ofixMsg	fix43_encode_DerivativeSecurityList(ofixErr err, fix43DerivativeSecurityList m);
+
+// NewOrderMultileg [AB]
+enum {
+    FIX43_NewOrderMultileg_BeginString = 0,
+    FIX43_NewOrderMultileg_BodyLength = 1,
+    FIX43_NewOrderMultileg_MsgType = 2,
+    FIX43_NewOrderMultileg_SenderCompID = 3,
+    FIX43_NewOrderMultileg_TargetCompID = 4,
+    FIX43_NewOrderMultileg_OnBehalfOfCompID = 5,
+    FIX43_NewOrderMultileg_DeliverToCompID = 6,
+    FIX43_NewOrderMultileg_SecureDataLen = 7,
+    FIX43_NewOrderMultileg_SecureData = 8,
+    FIX43_NewOrderMultileg_MsgSeqNum = 9,
+    FIX43_NewOrderMultileg_SenderSubID = 10,
+    FIX43_NewOrderMultileg_SenderLocationID = 11,
+    FIX43_NewOrderMultileg_TargetSubID = 12,
+    FIX43_NewOrderMultileg_TargetLocationID = 13,
+    FIX43_NewOrderMultileg_OnBehalfOfSubID = 14,
+    FIX43_NewOrderMultileg_OnBehalfOfLocationID = 15,
+    FIX43_NewOrderMultileg_DeliverToSubID = 16,
+    FIX43_NewOrderMultileg_DeliverToLocationID = 17,
+    FIX43_NewOrderMultileg_PossDupFlag = 18,
+    FIX43_NewOrderMultileg_PossResend = 19,
+    FIX43_NewOrderMultileg_SendingTime = 20,
+    FIX43_NewOrderMultileg_OrigSendingTime = 21,
+    FIX43_NewOrderMultileg_XmlDataLen = 22,
+    FIX43_NewOrderMultileg_XmlData = 23,
+    FIX43_NewOrderMultileg_MessageEncoding = 24,
+    FIX43_NewOrderMultileg_LastMsgSeqNumProcessed = 25,
+    FIX43_NewOrderMultileg_OnBehalfOfSendingTime = 26,
+    FIX43_NewOrderMultileg_NoHops = 27,
+    FIX43_NewOrderMultileg_ClOrdID = 28,
+    FIX43_NewOrderMultileg_SecondaryClOrdID = 29,
+    FIX43_NewOrderMultileg_ClOrdLinkID = 30,
+    FIX43_NewOrderMultileg_NoPartyIDs = 31,
+    FIX43_NewOrderMultileg_Account = 32,
+    FIX43_NewOrderMultileg_AccountType = 33,
+    FIX43_NewOrderMultileg_DayBookingInst = 34,
+    FIX43_NewOrderMultileg_BookingUnit = 35,
+    FIX43_NewOrderMultileg_PreallocMethod = 36,
+    FIX43_NewOrderMultileg_NoAllocs = 37,
+    FIX43_NewOrderMultileg_SettlmntTyp = 38,
+    FIX43_NewOrderMultileg_FutSettDate = 39,
+    FIX43_NewOrderMultileg_CashMargin = 40,
+    FIX43_NewOrderMultileg_ClearingFeeIndicator = 41,
+    FIX43_NewOrderMultileg_HandlInst = 42,
+    FIX43_NewOrderMultileg_ExecInst = 43,
+    FIX43_NewOrderMultileg_MinQty = 44,
+    FIX43_NewOrderMultileg_MaxFloor = 45,
+    FIX43_NewOrderMultileg_ExDestination = 46,
+    FIX43_NewOrderMultileg_NoTradingSessions = 47,
+    FIX43_NewOrderMultileg_ProcessCode = 48,
+    FIX43_NewOrderMultileg_Side = 49,
+    FIX43_NewOrderMultileg_Symbol = 50,
+    FIX43_NewOrderMultileg_SymbolSfx = 51,
+    FIX43_NewOrderMultileg_SecurityID = 52,
+    FIX43_NewOrderMultileg_SecurityIDSource = 53,
+    FIX43_NewOrderMultileg_NoSecurityAltID = 54,
+    FIX43_NewOrderMultileg_Product = 55,
+    FIX43_NewOrderMultileg_CFICode = 56,
+    FIX43_NewOrderMultileg_SecurityType = 57,
+    FIX43_NewOrderMultileg_MaturityMonthYear = 58,
+    FIX43_NewOrderMultileg_MaturityDate = 59,
+    FIX43_NewOrderMultileg_CouponPaymentDate = 60,
+    FIX43_NewOrderMultileg_IssueDate = 61,
+    FIX43_NewOrderMultileg_RepoCollateralSecurityType = 62,
+    FIX43_NewOrderMultileg_RepurchaseTerm = 63,
+    FIX43_NewOrderMultileg_RepurchaseRate = 64,
+    FIX43_NewOrderMultileg_Factor = 65,
+    FIX43_NewOrderMultileg_CreditRating = 66,
+    FIX43_NewOrderMultileg_InstrRegistry = 67,
+    FIX43_NewOrderMultileg_CountryOfIssue = 68,
+    FIX43_NewOrderMultileg_StateOrProvinceOfIssue = 69,
+    FIX43_NewOrderMultileg_LocaleOfIssue = 70,
+    FIX43_NewOrderMultileg_RedemptionDate = 71,
+    FIX43_NewOrderMultileg_StrikePrice = 72,
+    FIX43_NewOrderMultileg_OptAttribute = 73,
+    FIX43_NewOrderMultileg_ContractMultiplier = 74,
+    FIX43_NewOrderMultileg_CouponRate = 75,
+    FIX43_NewOrderMultileg_SecurityExchange = 76,
+    FIX43_NewOrderMultileg_Issuer = 77,
+    FIX43_NewOrderMultileg_EncodedIssuerLen = 78,
+    FIX43_NewOrderMultileg_EncodedIssuer = 79,
+    FIX43_NewOrderMultileg_SecurityDesc = 80,
+    FIX43_NewOrderMultileg_EncodedSecurityDescLen = 81,
+    FIX43_NewOrderMultileg_EncodedSecurityDesc = 82,
+    FIX43_NewOrderMultileg_PrevClosePx = 83,
+    FIX43_NewOrderMultileg_NoLegs = 84,
+    FIX43_NewOrderMultileg_LocateReqd = 85,
+    FIX43_NewOrderMultileg_TransactTime = 86,
+    FIX43_NewOrderMultileg_QuantityType = 87,
+    FIX43_NewOrderMultileg_OrderQty = 88,
+    FIX43_NewOrderMultileg_CashOrderQty = 89,
+    FIX43_NewOrderMultileg_OrderPercent = 90,
+    FIX43_NewOrderMultileg_RoundingDirection = 91,
+    FIX43_NewOrderMultileg_RoundingModulus = 92,
+    FIX43_NewOrderMultileg_OrdType = 93,
+    FIX43_NewOrderMultileg_PriceType = 94,
+    FIX43_NewOrderMultileg_Price = 95,
+    FIX43_NewOrderMultileg_StopPx = 96,
+    FIX43_NewOrderMultileg_Currency = 97,
+    FIX43_NewOrderMultileg_ComplianceID = 98,
+    FIX43_NewOrderMultileg_SolicitedFlag = 99,
+    FIX43_NewOrderMultileg_IOIid = 100,
+    FIX43_NewOrderMultileg_QuoteID = 101,
+    FIX43_NewOrderMultileg_TimeInForce = 102,
+    FIX43_NewOrderMultileg_EffectiveTime = 103,
+    FIX43_NewOrderMultileg_ExpireDate = 104,
+    FIX43_NewOrderMultileg_ExpireTime = 105,
+    FIX43_NewOrderMultileg_GTBookingInst = 106,
+    FIX43_NewOrderMultileg_Commission = 107,
+    FIX43_NewOrderMultileg_CommType = 108,
+    FIX43_NewOrderMultileg_CommCurrency = 109,
+    FIX43_NewOrderMultileg_FundRenewWaiv = 110,
+    FIX43_NewOrderMultileg_OrderCapacity = 111,
+    FIX43_NewOrderMultileg_OrderRestrictions = 112,
+    FIX43_NewOrderMultileg_CustOrderCapacity = 113,
+    FIX43_NewOrderMultileg_ForexReq = 114,
+    FIX43_NewOrderMultileg_SettlCurrency = 115,
+    FIX43_NewOrderMultileg_Text = 116,
+    FIX43_NewOrderMultileg_EncodedTextLen = 117,
+    FIX43_NewOrderMultileg_EncodedText = 118,
+    FIX43_NewOrderMultileg_PositionEffect = 119,
+    FIX43_NewOrderMultileg_CoveredOrUncovered = 120,
+    FIX43_NewOrderMultileg_MaxShow = 121,
+    FIX43_NewOrderMultileg_PegDifference = 122,
+    FIX43_NewOrderMultileg_DiscretionInst = 123,
+    FIX43_NewOrderMultileg_DiscretionOffset = 124,
+    FIX43_NewOrderMultileg_CancellationRights = 125,
+    FIX43_NewOrderMultileg_MoneyLaunderingStatus = 126,
+    FIX43_NewOrderMultileg_RegistID = 127,
+    FIX43_NewOrderMultileg_Designation = 128,
+    FIX43_NewOrderMultileg_MultiLegRptTypeReq = 129,
+    FIX43_NewOrderMultileg_NetMoney = 130,
+    FIX43_NewOrderMultileg_SignatureLength = 131,
+    FIX43_NewOrderMultileg_Signature = 132,
+    FIX43_NewOrderMultileg_CheckSum = 133,
+};
+
+typedef struct _fix43NewOrderMultileg {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    int64_t	NoAllocs;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    int64_t	NoLegs;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	QuantityType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	MultiLegRptTypeReq;
+    struct _ofixDecimal	NetMoney;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43NewOrderMultileg;
+
+extern void	fix43_decode_NewOrderMultileg(ofixErr err, fix43NewOrderMultileg m, const char *raw, int len);
+extern void	fix43_decode_NewOrderMultileg_msg(ofixErr err, fix43NewOrderMultileg m, ofixMsg msg);
+extern ofixMsg	fix43_encode_NewOrderMultileg(ofixErr err, fix43NewOrderMultileg m);
+
+// MultilegOrderCancelReplaceRequest [AC]
+enum {
+    FIX43_MultilegOrderCancelReplaceRequest_BeginString = 0,
+    FIX43_MultilegOrderCancelReplaceRequest_BodyLength = 1,
+    FIX43_MultilegOrderCancelReplaceRequest_MsgType = 2,
+    FIX43_MultilegOrderCancelReplaceRequest_SenderCompID = 3,
+    FIX43_MultilegOrderCancelReplaceRequest_TargetCompID = 4,
+    FIX43_MultilegOrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX43_MultilegOrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX43_MultilegOrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX43_MultilegOrderCancelReplaceRequest_SecureData = 8,
+    FIX43_MultilegOrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX43_MultilegOrderCancelReplaceRequest_SenderSubID = 10,
+    FIX43_MultilegOrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX43_MultilegOrderCancelReplaceRequest_TargetSubID = 12,
+    FIX43_MultilegOrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX43_MultilegOrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX43_MultilegOrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX43_MultilegOrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX43_MultilegOrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX43_MultilegOrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX43_MultilegOrderCancelReplaceRequest_PossResend = 19,
+    FIX43_MultilegOrderCancelReplaceRequest_SendingTime = 20,
+    FIX43_MultilegOrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX43_MultilegOrderCancelReplaceRequest_XmlDataLen = 22,
+    FIX43_MultilegOrderCancelReplaceRequest_XmlData = 23,
+    FIX43_MultilegOrderCancelReplaceRequest_MessageEncoding = 24,
+    FIX43_MultilegOrderCancelReplaceRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_MultilegOrderCancelReplaceRequest_OnBehalfOfSendingTime = 26,
+    FIX43_MultilegOrderCancelReplaceRequest_NoHops = 27,
+    FIX43_MultilegOrderCancelReplaceRequest_OrderID = 28,
+    FIX43_MultilegOrderCancelReplaceRequest_OrigClOrdID = 29,
+    FIX43_MultilegOrderCancelReplaceRequest_ClOrdID = 30,
+    FIX43_MultilegOrderCancelReplaceRequest_SecondaryClOrdID = 31,
+    FIX43_MultilegOrderCancelReplaceRequest_ClOrdLinkID = 32,
+    FIX43_MultilegOrderCancelReplaceRequest_OrigOrdModTime = 33,
+    FIX43_MultilegOrderCancelReplaceRequest_NoPartyIDs = 34,
+    FIX43_MultilegOrderCancelReplaceRequest_Account = 35,
+    FIX43_MultilegOrderCancelReplaceRequest_AccountType = 36,
+    FIX43_MultilegOrderCancelReplaceRequest_DayBookingInst = 37,
+    FIX43_MultilegOrderCancelReplaceRequest_BookingUnit = 38,
+    FIX43_MultilegOrderCancelReplaceRequest_PreallocMethod = 39,
+    FIX43_MultilegOrderCancelReplaceRequest_NoAllocs = 40,
+    FIX43_MultilegOrderCancelReplaceRequest_SettlmntTyp = 41,
+    FIX43_MultilegOrderCancelReplaceRequest_FutSettDate = 42,
+    FIX43_MultilegOrderCancelReplaceRequest_CashMargin = 43,
+    FIX43_MultilegOrderCancelReplaceRequest_ClearingFeeIndicator = 44,
+    FIX43_MultilegOrderCancelReplaceRequest_HandlInst = 45,
+    FIX43_MultilegOrderCancelReplaceRequest_ExecInst = 46,
+    FIX43_MultilegOrderCancelReplaceRequest_MinQty = 47,
+    FIX43_MultilegOrderCancelReplaceRequest_MaxFloor = 48,
+    FIX43_MultilegOrderCancelReplaceRequest_ExDestination = 49,
+    FIX43_MultilegOrderCancelReplaceRequest_NoTradingSessions = 50,
+    FIX43_MultilegOrderCancelReplaceRequest_ProcessCode = 51,
+    FIX43_MultilegOrderCancelReplaceRequest_Side = 52,
+    FIX43_MultilegOrderCancelReplaceRequest_Symbol = 53,
+    FIX43_MultilegOrderCancelReplaceRequest_SymbolSfx = 54,
+    FIX43_MultilegOrderCancelReplaceRequest_SecurityID = 55,
+    FIX43_MultilegOrderCancelReplaceRequest_SecurityIDSource = 56,
+    FIX43_MultilegOrderCancelReplaceRequest_NoSecurityAltID = 57,
+    FIX43_MultilegOrderCancelReplaceRequest_Product = 58,
+    FIX43_MultilegOrderCancelReplaceRequest_CFICode = 59,
+    FIX43_MultilegOrderCancelReplaceRequest_SecurityType = 60,
+    FIX43_MultilegOrderCancelReplaceRequest_MaturityMonthYear = 61,
+    FIX43_MultilegOrderCancelReplaceRequest_MaturityDate = 62,
+    FIX43_MultilegOrderCancelReplaceRequest_CouponPaymentDate = 63,
+    FIX43_MultilegOrderCancelReplaceRequest_IssueDate = 64,
+    FIX43_MultilegOrderCancelReplaceRequest_RepoCollateralSecurityType = 65,
+    FIX43_MultilegOrderCancelReplaceRequest_RepurchaseTerm = 66,
+    FIX43_MultilegOrderCancelReplaceRequest_RepurchaseRate = 67,
+    FIX43_MultilegOrderCancelReplaceRequest_Factor = 68,
+    FIX43_MultilegOrderCancelReplaceRequest_CreditRating = 69,
+    FIX43_MultilegOrderCancelReplaceRequest_InstrRegistry = 70,
+    FIX43_MultilegOrderCancelReplaceRequest_CountryOfIssue = 71,
+    FIX43_MultilegOrderCancelReplaceRequest_StateOrProvinceOfIssue = 72,
+    FIX43_MultilegOrderCancelReplaceRequest_LocaleOfIssue = 73,
+    FIX43_MultilegOrderCancelReplaceRequest_RedemptionDate = 74,
+    FIX43_MultilegOrderCancelReplaceRequest_StrikePrice = 75,
+    FIX43_MultilegOrderCancelReplaceRequest_OptAttribute = 76,
+    FIX43_MultilegOrderCancelReplaceRequest_ContractMultiplier = 77,
+    FIX43_MultilegOrderCancelReplaceRequest_CouponRate = 78,
+    FIX43_MultilegOrderCancelReplaceRequest_SecurityExchange = 79,
+    FIX43_MultilegOrderCancelReplaceRequest_Issuer = 80,
+    FIX43_MultilegOrderCancelReplaceRequest_EncodedIssuerLen = 81,
+    FIX43_MultilegOrderCancelReplaceRequest_EncodedIssuer = 82,
+    FIX43_MultilegOrderCancelReplaceRequest_SecurityDesc = 83,
+    FIX43_MultilegOrderCancelReplaceRequest_EncodedSecurityDescLen = 84,
+    FIX43_MultilegOrderCancelReplaceRequest_EncodedSecurityDesc = 85,
+    FIX43_MultilegOrderCancelReplaceRequest_PrevClosePx = 86,
+    FIX43_MultilegOrderCancelReplaceRequest_NoLegs = 87,
+    FIX43_MultilegOrderCancelReplaceRequest_LocateReqd = 88,
+    FIX43_MultilegOrderCancelReplaceRequest_TransactTime = 89,
+    FIX43_MultilegOrderCancelReplaceRequest_QuantityType = 90,
+    FIX43_MultilegOrderCancelReplaceRequest_OrderQty = 91,
+    FIX43_MultilegOrderCancelReplaceRequest_CashOrderQty = 92,
+    FIX43_MultilegOrderCancelReplaceRequest_OrderPercent = 93,
+    FIX43_MultilegOrderCancelReplaceRequest_RoundingDirection = 94,
+    FIX43_MultilegOrderCancelReplaceRequest_RoundingModulus = 95,
+    FIX43_MultilegOrderCancelReplaceRequest_OrdType = 96,
+    FIX43_MultilegOrderCancelReplaceRequest_PriceType = 97,
+    FIX43_MultilegOrderCancelReplaceRequest_Price = 98,
+    FIX43_MultilegOrderCancelReplaceRequest_StopPx = 99,
+    FIX43_MultilegOrderCancelReplaceRequest_Currency = 100,
+    FIX43_MultilegOrderCancelReplaceRequest_ComplianceID = 101,
+    FIX43_MultilegOrderCancelReplaceRequest_SolicitedFlag = 102,
+    FIX43_MultilegOrderCancelReplaceRequest_IOIid = 103,
+    FIX43_MultilegOrderCancelReplaceRequest_QuoteID = 104,
+    FIX43_MultilegOrderCancelReplaceRequest_TimeInForce = 105,
+    FIX43_MultilegOrderCancelReplaceRequest_EffectiveTime = 106,
+    FIX43_MultilegOrderCancelReplaceRequest_ExpireDate = 107,
+    FIX43_MultilegOrderCancelReplaceRequest_ExpireTime = 108,
+    FIX43_MultilegOrderCancelReplaceRequest_GTBookingInst = 109,
+    FIX43_MultilegOrderCancelReplaceRequest_Commission = 110,
+    FIX43_MultilegOrderCancelReplaceRequest_CommType = 111,
+    FIX43_MultilegOrderCancelReplaceRequest_CommCurrency = 112,
+    FIX43_MultilegOrderCancelReplaceRequest_FundRenewWaiv = 113,
+    FIX43_MultilegOrderCancelReplaceRequest_OrderCapacity = 114,
+    FIX43_MultilegOrderCancelReplaceRequest_OrderRestrictions = 115,
+    FIX43_MultilegOrderCancelReplaceRequest_CustOrderCapacity = 116,
+    FIX43_MultilegOrderCancelReplaceRequest_ForexReq = 117,
+    FIX43_MultilegOrderCancelReplaceRequest_SettlCurrency = 118,
+    FIX43_MultilegOrderCancelReplaceRequest_Text = 119,
+    FIX43_MultilegOrderCancelReplaceRequest_EncodedTextLen = 120,
+    FIX43_MultilegOrderCancelReplaceRequest_EncodedText = 121,
+    FIX43_MultilegOrderCancelReplaceRequest_PositionEffect = 122,
+    FIX43_MultilegOrderCancelReplaceRequest_CoveredOrUncovered = 123,
+    FIX43_MultilegOrderCancelReplaceRequest_MaxShow = 124,
+    FIX43_MultilegOrderCancelReplaceRequest_PegDifference = 125,
+    FIX43_MultilegOrderCancelReplaceRequest_DiscretionInst = 126,
+    FIX43_MultilegOrderCancelReplaceRequest_DiscretionOffset = 127,
+    FIX43_MultilegOrderCancelReplaceRequest_CancellationRights = 128,
+    FIX43_MultilegOrderCancelReplaceRequest_MoneyLaunderingStatus = 129,
+    FIX43_MultilegOrderCancelReplaceRequest_RegistID = 130,
+    FIX43_MultilegOrderCancelReplaceRequest_Designation = 131,
+    FIX43_MultilegOrderCancelReplaceRequest_MultiLegRptTypeReq = 132,
+    FIX43_MultilegOrderCancelReplaceRequest_NetMoney = 133,
+    FIX43_MultilegOrderCancelReplaceRequest_SignatureLength = 134,
+    FIX43_MultilegOrderCancelReplaceRequest_Signature = 135,
+    FIX43_MultilegOrderCancelReplaceRequest_CheckSum = 136,
+};
+
+typedef struct _fix43MultilegOrderCancelReplaceRequest {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixDate	OrigOrdModTime;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    int64_t	NoAllocs;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    int64_t	NoLegs;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	QuantityType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	MultiLegRptTypeReq;
+    struct _ofixDecimal	NetMoney;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43MultilegOrderCancelReplaceRequest;
+
+extern void	fix43_decode_MultilegOrderCancelReplaceRequest(ofixErr err, fix43MultilegOrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix43_decode_MultilegOrderCancelReplaceRequest_msg(ofixErr err, fix43MultilegOrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_MultilegOrderCancelReplaceRequest(ofixErr err, fix43MultilegOrderCancelReplaceRequest m);
+
+// TradeCaptureReportRequest [AD]
+enum {
+    FIX43_TradeCaptureReportRequest_BeginString = 0,
+    FIX43_TradeCaptureReportRequest_BodyLength = 1,
+    FIX43_TradeCaptureReportRequest_MsgType = 2,
+    FIX43_TradeCaptureReportRequest_SenderCompID = 3,
+    FIX43_TradeCaptureReportRequest_TargetCompID = 4,
+    FIX43_TradeCaptureReportRequest_OnBehalfOfCompID = 5,
+    FIX43_TradeCaptureReportRequest_DeliverToCompID = 6,
+    FIX43_TradeCaptureReportRequest_SecureDataLen = 7,
+    FIX43_TradeCaptureReportRequest_SecureData = 8,
+    FIX43_TradeCaptureReportRequest_MsgSeqNum = 9,
+    FIX43_TradeCaptureReportRequest_SenderSubID = 10,
+    FIX43_TradeCaptureReportRequest_SenderLocationID = 11,
+    FIX43_TradeCaptureReportRequest_TargetSubID = 12,
+    FIX43_TradeCaptureReportRequest_TargetLocationID = 13,
+    FIX43_TradeCaptureReportRequest_OnBehalfOfSubID = 14,
+    FIX43_TradeCaptureReportRequest_OnBehalfOfLocationID = 15,
+    FIX43_TradeCaptureReportRequest_DeliverToSubID = 16,
+    FIX43_TradeCaptureReportRequest_DeliverToLocationID = 17,
+    FIX43_TradeCaptureReportRequest_PossDupFlag = 18,
+    FIX43_TradeCaptureReportRequest_PossResend = 19,
+    FIX43_TradeCaptureReportRequest_SendingTime = 20,
+    FIX43_TradeCaptureReportRequest_OrigSendingTime = 21,
+    FIX43_TradeCaptureReportRequest_XmlDataLen = 22,
+    FIX43_TradeCaptureReportRequest_XmlData = 23,
+    FIX43_TradeCaptureReportRequest_MessageEncoding = 24,
+    FIX43_TradeCaptureReportRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_TradeCaptureReportRequest_OnBehalfOfSendingTime = 26,
+    FIX43_TradeCaptureReportRequest_NoHops = 27,
+    FIX43_TradeCaptureReportRequest_TradeRequestID = 28,
+    FIX43_TradeCaptureReportRequest_TradeRequestType = 29,
+    FIX43_TradeCaptureReportRequest_SubscriptionRequestType = 30,
+    FIX43_TradeCaptureReportRequest_ExecID = 31,
+    FIX43_TradeCaptureReportRequest_OrderID = 32,
+    FIX43_TradeCaptureReportRequest_ClOrdID = 33,
+    FIX43_TradeCaptureReportRequest_MatchStatus = 34,
+    FIX43_TradeCaptureReportRequest_NoPartyIDs = 35,
+    FIX43_TradeCaptureReportRequest_Symbol = 36,
+    FIX43_TradeCaptureReportRequest_SymbolSfx = 37,
+    FIX43_TradeCaptureReportRequest_SecurityID = 38,
+    FIX43_TradeCaptureReportRequest_SecurityIDSource = 39,
+    FIX43_TradeCaptureReportRequest_NoSecurityAltID = 40,
+    FIX43_TradeCaptureReportRequest_Product = 41,
+    FIX43_TradeCaptureReportRequest_CFICode = 42,
+    FIX43_TradeCaptureReportRequest_SecurityType = 43,
+    FIX43_TradeCaptureReportRequest_MaturityMonthYear = 44,
+    FIX43_TradeCaptureReportRequest_MaturityDate = 45,
+    FIX43_TradeCaptureReportRequest_CouponPaymentDate = 46,
+    FIX43_TradeCaptureReportRequest_IssueDate = 47,
+    FIX43_TradeCaptureReportRequest_RepoCollateralSecurityType = 48,
+    FIX43_TradeCaptureReportRequest_RepurchaseTerm = 49,
+    FIX43_TradeCaptureReportRequest_RepurchaseRate = 50,
+    FIX43_TradeCaptureReportRequest_Factor = 51,
+    FIX43_TradeCaptureReportRequest_CreditRating = 52,
+    FIX43_TradeCaptureReportRequest_InstrRegistry = 53,
+    FIX43_TradeCaptureReportRequest_CountryOfIssue = 54,
+    FIX43_TradeCaptureReportRequest_StateOrProvinceOfIssue = 55,
+    FIX43_TradeCaptureReportRequest_LocaleOfIssue = 56,
+    FIX43_TradeCaptureReportRequest_RedemptionDate = 57,
+    FIX43_TradeCaptureReportRequest_StrikePrice = 58,
+    FIX43_TradeCaptureReportRequest_OptAttribute = 59,
+    FIX43_TradeCaptureReportRequest_ContractMultiplier = 60,
+    FIX43_TradeCaptureReportRequest_CouponRate = 61,
+    FIX43_TradeCaptureReportRequest_SecurityExchange = 62,
+    FIX43_TradeCaptureReportRequest_Issuer = 63,
+    FIX43_TradeCaptureReportRequest_EncodedIssuerLen = 64,
+    FIX43_TradeCaptureReportRequest_EncodedIssuer = 65,
+    FIX43_TradeCaptureReportRequest_SecurityDesc = 66,
+    FIX43_TradeCaptureReportRequest_EncodedSecurityDescLen = 67,
+    FIX43_TradeCaptureReportRequest_EncodedSecurityDesc = 68,
+    FIX43_TradeCaptureReportRequest_NoDates = 69,
+    FIX43_TradeCaptureReportRequest_Side = 70,
+    FIX43_TradeCaptureReportRequest_Text = 71,
+    FIX43_TradeCaptureReportRequest_EncodedTextLen = 72,
+    FIX43_TradeCaptureReportRequest_EncodedText = 73,
+    FIX43_TradeCaptureReportRequest_TradeInputSource = 74,
+    FIX43_TradeCaptureReportRequest_TradeInputDevice = 75,
+    FIX43_TradeCaptureReportRequest_SignatureLength = 76,
+    FIX43_TradeCaptureReportRequest_Signature = 77,
+    FIX43_TradeCaptureReportRequest_CheckSum = 78,
+};
+
+typedef struct _fix43TradeCaptureReportRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	TradeRequestID;
+    int64_t	TradeRequestType;
+    char	SubscriptionRequestType;
+    struct _ofixStrView	ExecID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    char	MatchStatus;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    int64_t	NoDates;
+    char	Side;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradeInputSource;
+    struct _ofixStrView	TradeInputDevice;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43TradeCaptureReportRequest;
+
+extern void	fix43_decode_TradeCaptureReportRequest(ofixErr err, fix43TradeCaptureReportRequest m, const char *raw, int len);
+extern void	fix43_decode_TradeCaptureReportRequest_msg(ofixErr err, fix43TradeCaptureReportRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_TradeCaptureReportRequest(ofixErr err, fix43TradeCaptureReportRequest m);
+
+// TradeCaptureReport [AE]
+enum {
+    FIX43_TradeCaptureReport_BeginString = 0,
+    FIX43_TradeCaptureReport_BodyLength = 1,
+    FIX43_TradeCaptureReport_MsgType = 2,
+    FIX43_TradeCaptureReport_SenderCompID = 3,
+    FIX43_TradeCaptureReport_TargetCompID = 4,
+    FIX43_TradeCaptureReport_OnBehalfOfCompID = 5,
+    FIX43_TradeCaptureReport_DeliverToCompID = 6,
+    FIX43_TradeCaptureReport_SecureDataLen = 7,
+    FIX43_TradeCaptureReport_SecureData = 8,
+    FIX43_TradeCaptureReport_MsgSeqNum = 9,
+    FIX43_TradeCaptureReport_SenderSubID = 10,
+    FIX43_TradeCaptureReport_SenderLocationID = 11,
+    FIX43_TradeCaptureReport_TargetSubID = 12,
+    FIX43_TradeCaptureReport_TargetLocationID = 13,
+    FIX43_TradeCaptureReport_OnBehalfOfSubID = 14,
+    FIX43_TradeCaptureReport_OnBehalfOfLocationID = 15,
+    FIX43_TradeCaptureReport_DeliverToSubID = 16,
+    FIX43_TradeCaptureReport_DeliverToLocationID = 17,
+    FIX43_TradeCaptureReport_PossDupFlag = 18,
+    FIX43_TradeCaptureReport_PossResend = 19,
+    FIX43_TradeCaptureReport_SendingTime = 20,
+    FIX43_TradeCaptureReport_OrigSendingTime = 21,
+    FIX43_TradeCaptureReport_XmlDataLen = 22,
+    FIX43_TradeCaptureReport_XmlData = 23,
+    FIX43_TradeCaptureReport_MessageEncoding = 24,
+    FIX43_TradeCaptureReport_LastMsgSeqNumProcessed = 25,
+    FIX43_TradeCaptureReport_OnBehalfOfSendingTime = 26,
+    FIX43_TradeCaptureReport_NoHops = 27,
+    FIX43_TradeCaptureReport_TradeReportID = 28,
+    FIX43_TradeCaptureReport_TradeReportTransType = 29,
+    FIX43_TradeCaptureReport_TradeRequestID = 30,
+    FIX43_TradeCaptureReport_ExecType = 31,
+    FIX43_TradeCaptureReport_TradeReportRefID = 32,
+    FIX43_TradeCaptureReport_ExecID = 33,
+    FIX43_TradeCaptureReport_SecondaryExecID = 34,
+    FIX43_TradeCaptureReport_ExecRestatementReason = 35,
+    FIX43_TradeCaptureReport_PreviouslyReported = 36,
+    FIX43_TradeCaptureReport_Symbol = 37,
+    FIX43_TradeCaptureReport_SymbolSfx = 38,
+    FIX43_TradeCaptureReport_SecurityID = 39,
+    FIX43_TradeCaptureReport_SecurityIDSource = 40,
+    FIX43_TradeCaptureReport_NoSecurityAltID = 41,
+    FIX43_TradeCaptureReport_Product = 42,
+    FIX43_TradeCaptureReport_CFICode = 43,
+    FIX43_TradeCaptureReport_SecurityType = 44,
+    FIX43_TradeCaptureReport_MaturityMonthYear = 45,
+    FIX43_TradeCaptureReport_MaturityDate = 46,
+    FIX43_TradeCaptureReport_CouponPaymentDate = 47,
+    FIX43_TradeCaptureReport_IssueDate = 48,
+    FIX43_TradeCaptureReport_RepoCollateralSecurityType = 49,
+    FIX43_TradeCaptureReport_RepurchaseTerm = 50,
+    FIX43_TradeCaptureReport_RepurchaseRate = 51,
+    FIX43_TradeCaptureReport_Factor = 52,
+    FIX43_TradeCaptureReport_CreditRating = 53,
+    FIX43_TradeCaptureReport_InstrRegistry = 54,
+    FIX43_TradeCaptureReport_CountryOfIssue = 55,
+    FIX43_TradeCaptureReport_StateOrProvinceOfIssue = 56,
+    FIX43_TradeCaptureReport_LocaleOfIssue = 57,
+    FIX43_TradeCaptureReport_RedemptionDate = 58,
+    FIX43_TradeCaptureReport_StrikePrice = 59,
+    FIX43_TradeCaptureReport_OptAttribute = 60,
+    FIX43_TradeCaptureReport_ContractMultiplier = 61,
+    FIX43_TradeCaptureReport_CouponRate = 62,
+    FIX43_TradeCaptureReport_SecurityExchange = 63,
+    FIX43_TradeCaptureReport_Issuer = 64,
+    FIX43_TradeCaptureReport_EncodedIssuerLen = 65,
+    FIX43_TradeCaptureReport_EncodedIssuer = 66,
+    FIX43_TradeCaptureReport_SecurityDesc = 67,
+    FIX43_TradeCaptureReport_EncodedSecurityDescLen = 68,
+    FIX43_TradeCaptureReport_EncodedSecurityDesc = 69,
+    FIX43_TradeCaptureReport_OrderQty = 70,
+    FIX43_TradeCaptureReport_CashOrderQty = 71,
+    FIX43_TradeCaptureReport_OrderPercent = 72,
+    FIX43_TradeCaptureReport_RoundingDirection = 73,
+    FIX43_TradeCaptureReport_RoundingModulus = 74,
+    FIX43_TradeCaptureReport_LastQty = 75,
+    FIX43_TradeCaptureReport_LastPx = 76,
+    FIX43_TradeCaptureReport_LastSpotRate = 77,
+    FIX43_TradeCaptureReport_LastForwardPoints = 78,
+    FIX43_TradeCaptureReport_LastMkt = 79,
+    FIX43_TradeCaptureReport_TradeDate = 80,
+    FIX43_TradeCaptureReport_TransactTime = 81,
+    FIX43_TradeCaptureReport_SettlmntTyp = 82,
+    FIX43_TradeCaptureReport_FutSettDate = 83,
+    FIX43_TradeCaptureReport_MatchStatus = 84,
+    FIX43_TradeCaptureReport_MatchType = 85,
+    FIX43_TradeCaptureReport_NoSides = 86,
+    FIX43_TradeCaptureReport_SignatureLength = 87,
+    FIX43_TradeCaptureReport_Signature = 88,
+    FIX43_TradeCaptureReport_CheckSum = 89,
+};
+
+typedef struct _fix43TradeCaptureReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	TradeReportID;
+    char	TradeReportTransType;
+    struct _ofixStrView	TradeRequestID;
+    char	ExecType;
+    struct _ofixStrView	TradeReportRefID;
+    struct _ofixStrView	ExecID;
+    struct _ofixStrView	SecondaryExecID;
+    int64_t	ExecRestatementReason;
+    char	PreviouslyReported;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    struct _ofixDecimal	LastQty;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDecimal	LastSpotRate;
+    struct _ofixDecimal	LastForwardPoints;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	MatchStatus;
+    struct _ofixStrView	MatchType;
+    int64_t	NoSides;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43TradeCaptureReport;
+
+extern void	fix43_decode_TradeCaptureReport(ofixErr err, fix43TradeCaptureReport m, const char *raw, int len);
+extern void	fix43_decode_TradeCaptureReport_msg(ofixErr err, fix43TradeCaptureReport m, ofixMsg msg);
+extern ofixMsg	fix43_encode_TradeCaptureReport(ofixErr err, fix43TradeCaptureReport m);
+
+// OrderMassStatusRequest [AF]
+enum {
+    FIX43_OrderMassStatusRequest_BeginString = 0,
+    FIX43_OrderMassStatusRequest_BodyLength = 1,
+    FIX43_OrderMassStatusRequest_MsgType = 2,
+    FIX43_OrderMassStatusRequest_SenderCompID = 3,
+    FIX43_OrderMassStatusRequest_TargetCompID = 4,
+    FIX43_OrderMassStatusRequest_OnBehalfOfCompID = 5,
+    FIX43_OrderMassStatusRequest_DeliverToCompID = 6,
+    FIX43_OrderMassStatusRequest_SecureDataLen = 7,
+    FIX43_OrderMassStatusRequest_SecureData = 8,
+    FIX43_OrderMassStatusRequest_MsgSeqNum = 9,
+    FIX43_OrderMassStatusRequest_SenderSubID = 10,
+    FIX43_OrderMassStatusRequest_SenderLocationID = 11,
+    FIX43_OrderMassStatusRequest_TargetSubID = 12,
+    FIX43_OrderMassStatusRequest_TargetLocationID = 13,
+    FIX43_OrderMassStatusRequest_OnBehalfOfSubID = 14,
+    FIX43_OrderMassStatusRequest_OnBehalfOfLocationID = 15,
+    FIX43_OrderMassStatusRequest_DeliverToSubID = 16,
+    FIX43_OrderMassStatusRequest_DeliverToLocationID = 17,
+    FIX43_OrderMassStatusRequest_PossDupFlag = 18,
+    FIX43_OrderMassStatusRequest_PossResend = 19,
+    FIX43_OrderMassStatusRequest_SendingTime = 20,
+    FIX43_OrderMassStatusRequest_OrigSendingTime = 21,
+    FIX43_OrderMassStatusRequest_XmlDataLen = 22,
+    FIX43_OrderMassStatusRequest_XmlData = 23,
+    FIX43_OrderMassStatusRequest_MessageEncoding = 24,
+    FIX43_OrderMassStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_OrderMassStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX43_OrderMassStatusRequest_NoHops = 27,
+    FIX43_OrderMassStatusRequest_MassStatusReqID = 28,
+    FIX43_OrderMassStatusRequest_MassStatusReqType = 29,
+    FIX43_OrderMassStatusRequest_NoPartyIDs = 30,
+    FIX43_OrderMassStatusRequest_Account = 31,
+    FIX43_OrderMassStatusRequest_TradingSessionID = 32,
+    FIX43_OrderMassStatusRequest_TradingSessionSubID = 33,
+    FIX43_OrderMassStatusRequest_Symbol = 34,
+    FIX43_OrderMassStatusRequest_SymbolSfx = 35,
+    FIX43_OrderMassStatusRequest_SecurityID = 36,
+    FIX43_OrderMassStatusRequest_SecurityIDSource = 37,
+    FIX43_OrderMassStatusRequest_NoSecurityAltID = 38,
+    FIX43_OrderMassStatusRequest_Product = 39,
+    FIX43_OrderMassStatusRequest_CFICode = 40,
+    FIX43_OrderMassStatusRequest_SecurityType = 41,
+    FIX43_OrderMassStatusRequest_MaturityMonthYear = 42,
+    FIX43_OrderMassStatusRequest_MaturityDate = 43,
+    FIX43_OrderMassStatusRequest_CouponPaymentDate = 44,
+    FIX43_OrderMassStatusRequest_IssueDate = 45,
+    FIX43_OrderMassStatusRequest_RepoCollateralSecurityType = 46,
+    FIX43_OrderMassStatusRequest_RepurchaseTerm = 47,
+    FIX43_OrderMassStatusRequest_RepurchaseRate = 48,
+    FIX43_OrderMassStatusRequest_Factor = 49,
+    FIX43_OrderMassStatusRequest_CreditRating = 50,
+    FIX43_OrderMassStatusRequest_InstrRegistry = 51,
+    FIX43_OrderMassStatusRequest_CountryOfIssue = 52,
+    FIX43_OrderMassStatusRequest_StateOrProvinceOfIssue = 53,
+    FIX43_OrderMassStatusRequest_LocaleOfIssue = 54,
+    FIX43_OrderMassStatusRequest_RedemptionDate = 55,
+    FIX43_OrderMassStatusRequest_StrikePrice = 56,
+    FIX43_OrderMassStatusRequest_OptAttribute = 57,
+    FIX43_OrderMassStatusRequest_ContractMultiplier = 58,
+    FIX43_OrderMassStatusRequest_CouponRate = 59,
+    FIX43_OrderMassStatusRequest_SecurityExchange = 60,
+    FIX43_OrderMassStatusRequest_Issuer = 61,
+    FIX43_OrderMassStatusRequest_EncodedIssuerLen = 62,
+    FIX43_OrderMassStatusRequest_EncodedIssuer = 63,
+    FIX43_OrderMassStatusRequest_SecurityDesc = 64,
+    FIX43_OrderMassStatusRequest_EncodedSecurityDescLen = 65,
+    FIX43_OrderMassStatusRequest_EncodedSecurityDesc = 66,
+    FIX43_OrderMassStatusRequest_UnderlyingSymbol = 67,
+    FIX43_OrderMassStatusRequest_UnderlyingSymbolSfx = 68,
+    FIX43_OrderMassStatusRequest_UnderlyingSecurityID = 69,
+    FIX43_OrderMassStatusRequest_UnderlyingSecurityIDSource = 70,
+    FIX43_OrderMassStatusRequest_NoUnderlyingSecurityAltID = 71,
+    FIX43_OrderMassStatusRequest_UnderlyingProduct = 72,
+    FIX43_OrderMassStatusRequest_UnderlyingCFICode = 73,
+    FIX43_OrderMassStatusRequest_UnderlyingSecurityType = 74,
+    FIX43_OrderMassStatusRequest_UnderlyingMaturityMonthYear = 75,
+    FIX43_OrderMassStatusRequest_UnderlyingMaturityDate = 76,
+    FIX43_OrderMassStatusRequest_UnderlyingCouponPaymentDate = 77,
+    FIX43_OrderMassStatusRequest_UnderlyingIssueDate = 78,
+    FIX43_OrderMassStatusRequest_UnderlyingRepoCollateralSecurityType = 79,
+    FIX43_OrderMassStatusRequest_UnderlyingRepurchaseTerm = 80,
+    FIX43_OrderMassStatusRequest_UnderlyingRepurchaseRate = 81,
+    FIX43_OrderMassStatusRequest_UnderlyingFactor = 82,
+    FIX43_OrderMassStatusRequest_UnderlyingCreditRating = 83,
+    FIX43_OrderMassStatusRequest_UnderlyingInstrRegistry = 84,
+    FIX43_OrderMassStatusRequest_UnderlyingCountryOfIssue = 85,
+    FIX43_OrderMassStatusRequest_UnderlyingStateOrProvinceOfIssue = 86,
+    FIX43_OrderMassStatusRequest_UnderlyingLocaleOfIssue = 87,
+    FIX43_OrderMassStatusRequest_UnderlyingRedemptionDate = 88,
+    FIX43_OrderMassStatusRequest_UnderlyingPutOrCall = 89,
+    FIX43_OrderMassStatusRequest_UnderlyingStrikePrice = 90,
+    FIX43_OrderMassStatusRequest_UnderlyingOptAttribute = 91,
+    FIX43_OrderMassStatusRequest_UnderlyingContractMultiplier = 92,
+    FIX43_OrderMassStatusRequest_UnderlyingCouponRate = 93,
+    FIX43_OrderMassStatusRequest_UnderlyingSecurityExchange = 94,
+    FIX43_OrderMassStatusRequest_UnderlyingIssuer = 95,
+    FIX43_OrderMassStatusRequest_EncodedUnderlyingIssuerLen = 96,
+    FIX43_OrderMassStatusRequest_EncodedUnderlyingIssuer = 97,
+    FIX43_OrderMassStatusRequest_UnderlyingSecurityDesc = 98,
+    FIX43_OrderMassStatusRequest_EncodedUnderlyingSecurityDescLen = 99,
+    FIX43_OrderMassStatusRequest_EncodedUnderlyingSecurityDesc = 100,
+    FIX43_OrderMassStatusRequest_Side = 101,
+    FIX43_OrderMassStatusRequest_SignatureLength = 102,
+    FIX43_OrderMassStatusRequest_Signature = 103,
+    FIX43_OrderMassStatusRequest_CheckSum = 104,
+};
+
+typedef struct _fix43OrderMassStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	MassStatusReqID;
+    int64_t	MassStatusReqType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixDate	UnderlyingCouponPaymentDate;
+    struct _ofixDate	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixDate	UnderlyingRedemptionDate;
+    int64_t	UnderlyingPutOrCall;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    char	Side;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43OrderMassStatusRequest;
+
+extern void	fix43_decode_OrderMassStatusRequest(ofixErr err, fix43OrderMassStatusRequest m, const char *raw, int len);
+extern void	fix43_decode_OrderMassStatusRequest_msg(ofixErr err, fix43OrderMassStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_OrderMassStatusRequest(ofixErr err, fix43OrderMassStatusRequest m);
+
+// QuoteRequestReject [AG]
+enum {
+    FIX43_QuoteRequestReject_BeginString = 0,
+    FIX43_QuoteRequestReject_BodyLength = 1,
+    FIX43_QuoteRequestReject_MsgType = 2,
+    FIX43_QuoteRequestReject_SenderCompID = 3,
+    FIX43_QuoteRequestReject_TargetCompID = 4,
+    FIX43_QuoteRequestReject_OnBehalfOfCompID = 5,
+    FIX43_QuoteRequestReject_DeliverToCompID = 6,
+    FIX43_QuoteRequestReject_SecureDataLen = 7,
+    FIX43_QuoteRequestReject_SecureData = 8,
+    FIX43_QuoteRequestReject_MsgSeqNum = 9,
+    FIX43_QuoteRequestReject_SenderSubID = 10,
+    FIX43_QuoteRequestReject_SenderLocationID = 11,
+    FIX43_QuoteRequestReject_TargetSubID = 12,
+    FIX43_QuoteRequestReject_TargetLocationID = 13,
+    FIX43_QuoteRequestReject_OnBehalfOfSubID = 14,
+    FIX43_QuoteRequestReject_OnBehalfOfLocationID = 15,
+    FIX43_QuoteRequestReject_DeliverToSubID = 16,
+    FIX43_QuoteRequestReject_DeliverToLocationID = 17,
+    FIX43_QuoteRequestReject_PossDupFlag = 18,
+    FIX43_QuoteRequestReject_PossResend = 19,
+    FIX43_QuoteRequestReject_SendingTime = 20,
+    FIX43_QuoteRequestReject_OrigSendingTime = 21,
+    FIX43_QuoteRequestReject_XmlDataLen = 22,
+    FIX43_QuoteRequestReject_XmlData = 23,
+    FIX43_QuoteRequestReject_MessageEncoding = 24,
+    FIX43_QuoteRequestReject_LastMsgSeqNumProcessed = 25,
+    FIX43_QuoteRequestReject_OnBehalfOfSendingTime = 26,
+    FIX43_QuoteRequestReject_NoHops = 27,
+    FIX43_QuoteRequestReject_QuoteReqID = 28,
+    FIX43_QuoteRequestReject_RFQReqID = 29,
+    FIX43_QuoteRequestReject_QuoteRequestRejectReason = 30,
+    FIX43_QuoteRequestReject_NoRelatedSym = 31,
+    FIX43_QuoteRequestReject_Text = 32,
+    FIX43_QuoteRequestReject_EncodedTextLen = 33,
+    FIX43_QuoteRequestReject_EncodedText = 34,
+    FIX43_QuoteRequestReject_SignatureLength = 35,
+    FIX43_QuoteRequestReject_Signature = 36,
+    FIX43_QuoteRequestReject_CheckSum = 37,
+};
+
+typedef struct _fix43QuoteRequestReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	RFQReqID;
+    int64_t	QuoteRequestRejectReason;
+    int64_t	NoRelatedSym;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43QuoteRequestReject;
+
+extern void	fix43_decode_QuoteRequestReject(ofixErr err, fix43QuoteRequestReject m, const char *raw, int len);
+extern void	fix43_decode_QuoteRequestReject_msg(ofixErr err, fix43QuoteRequestReject m, ofixMsg msg);
+extern ofixMsg	fix43_encode_QuoteRequestReject(ofixErr err, fix43QuoteRequestReject m);
+
+// RFQRequest [AH]
+enum {
+    FIX43_RFQRequest_BeginString = 0,
+    FIX43_RFQRequest_BodyLength = 1,
+    FIX43_RFQRequest_MsgType = 2,
+    FIX43_RFQRequest_SenderCompID = 3,
+    FIX43_RFQRequest_TargetCompID = 4,
+    FIX43_RFQRequest_OnBehalfOfCompID = 5,
+    FIX43_RFQRequest_DeliverToCompID = 6,
+    FIX43_RFQRequest_SecureDataLen = 7,
+    FIX43_RFQRequest_SecureData = 8,
+    FIX43_RFQRequest_MsgSeqNum = 9,
+    FIX43_RFQRequest_SenderSubID = 10,
+    FIX43_RFQRequest_SenderLocationID = 11,
+    FIX43_RFQRequest_TargetSubID = 12,
+    FIX43_RFQRequest_TargetLocationID = 13,
+    FIX43_RFQRequest_OnBehalfOfSubID = 14,
+    FIX43_RFQRequest_OnBehalfOfLocationID = 15,
+    FIX43_RFQRequest_DeliverToSubID = 16,
+    FIX43_RFQRequest_DeliverToLocationID = 17,
+    FIX43_RFQRequest_PossDupFlag = 18,
+    FIX43_RFQRequest_PossResend = 19,
+    FIX43_RFQRequest_SendingTime = 20,
+    FIX43_RFQRequest_OrigSendingTime = 21,
+    FIX43_RFQRequest_XmlDataLen = 22,
+    FIX43_RFQRequest_XmlData = 23,
+    FIX43_RFQRequest_MessageEncoding = 24,
+    FIX43_RFQRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_RFQRequest_OnBehalfOfSendingTime = 26,
+    FIX43_RFQRequest_NoHops = 27,
+    FIX43_RFQRequest_RFQReqID = 28,
+    FIX43_RFQRequest_NoRelatedSym = 29,
+    FIX43_RFQRequest_SubscriptionRequestType = 30,
+    FIX43_RFQRequest_SignatureLength = 31,
+    FIX43_RFQRequest_Signature = 32,
+    FIX43_RFQRequest_CheckSum = 33,
+};
+
+typedef struct _fix43RFQRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	RFQReqID;
+    int64_t	NoRelatedSym;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43RFQRequest;
+
+extern void	fix43_decode_RFQRequest(ofixErr err, fix43RFQRequest m, const char *raw, int len);
+extern void	fix43_decode_RFQRequest_msg(ofixErr err, fix43RFQRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_RFQRequest(ofixErr err, fix43RFQRequest m);
+
+// QuoteStatusReport [AI]
+enum {
+    FIX43_QuoteStatusReport_BeginString = 0,
+    FIX43_QuoteStatusReport_BodyLength = 1,
+    FIX43_QuoteStatusReport_MsgType = 2,
+    FIX43_QuoteStatusReport_SenderCompID = 3,
+    FIX43_QuoteStatusReport_TargetCompID = 4,
+    FIX43_QuoteStatusReport_OnBehalfOfCompID = 5,
+    FIX43_QuoteStatusReport_DeliverToCompID = 6,
+    FIX43_QuoteStatusReport_SecureDataLen = 7,
+    FIX43_QuoteStatusReport_SecureData = 8,
+    FIX43_QuoteStatusReport_MsgSeqNum = 9,
+    FIX43_QuoteStatusReport_SenderSubID = 10,
+    FIX43_QuoteStatusReport_SenderLocationID = 11,
+    FIX43_QuoteStatusReport_TargetSubID = 12,
+    FIX43_QuoteStatusReport_TargetLocationID = 13,
+    FIX43_QuoteStatusReport_OnBehalfOfSubID = 14,
+    FIX43_QuoteStatusReport_OnBehalfOfLocationID = 15,
+    FIX43_QuoteStatusReport_DeliverToSubID = 16,
+    FIX43_QuoteStatusReport_DeliverToLocationID = 17,
+    FIX43_QuoteStatusReport_PossDupFlag = 18,
+    FIX43_QuoteStatusReport_PossResend = 19,
+    FIX43_QuoteStatusReport_SendingTime = 20,
+    FIX43_QuoteStatusReport_OrigSendingTime = 21,
+    FIX43_QuoteStatusReport_XmlDataLen = 22,
+    FIX43_QuoteStatusReport_XmlData = 23,
+    FIX43_QuoteStatusReport_MessageEncoding = 24,
+    FIX43_QuoteStatusReport_LastMsgSeqNumProcessed = 25,
+    FIX43_QuoteStatusReport_OnBehalfOfSendingTime = 26,
+    FIX43_QuoteStatusReport_NoHops = 27,
+    FIX43_QuoteStatusReport_QuoteStatusReqID = 28,
+    FIX43_QuoteStatusReport_QuoteReqID = 29,
+    FIX43_QuoteStatusReport_QuoteID = 30,
+    FIX43_QuoteStatusReport_QuoteType = 31,
+    FIX43_QuoteStatusReport_NoPartyIDs = 32,
+    FIX43_QuoteStatusReport_Account = 33,
+    FIX43_QuoteStatusReport_AccountType = 34,
+    FIX43_QuoteStatusReport_TradingSessionID = 35,
+    FIX43_QuoteStatusReport_TradingSessionSubID = 36,
+    FIX43_QuoteStatusReport_Symbol = 37,
+    FIX43_QuoteStatusReport_SymbolSfx = 38,
+    FIX43_QuoteStatusReport_SecurityID = 39,
+    FIX43_QuoteStatusReport_SecurityIDSource = 40,
+    FIX43_QuoteStatusReport_NoSecurityAltID = 41,
+    FIX43_QuoteStatusReport_Product = 42,
+    FIX43_QuoteStatusReport_CFICode = 43,
+    FIX43_QuoteStatusReport_SecurityType = 44,
+    FIX43_QuoteStatusReport_MaturityMonthYear = 45,
+    FIX43_QuoteStatusReport_MaturityDate = 46,
+    FIX43_QuoteStatusReport_CouponPaymentDate = 47,
+    FIX43_QuoteStatusReport_IssueDate = 48,
+    FIX43_QuoteStatusReport_RepoCollateralSecurityType = 49,
+    FIX43_QuoteStatusReport_RepurchaseTerm = 50,
+    FIX43_QuoteStatusReport_RepurchaseRate = 51,
+    FIX43_QuoteStatusReport_Factor = 52,
+    FIX43_QuoteStatusReport_CreditRating = 53,
+    FIX43_QuoteStatusReport_InstrRegistry = 54,
+    FIX43_QuoteStatusReport_CountryOfIssue = 55,
+    FIX43_QuoteStatusReport_StateOrProvinceOfIssue = 56,
+    FIX43_QuoteStatusReport_LocaleOfIssue = 57,
+    FIX43_QuoteStatusReport_RedemptionDate = 58,
+    FIX43_QuoteStatusReport_StrikePrice = 59,
+    FIX43_QuoteStatusReport_OptAttribute = 60,
+    FIX43_QuoteStatusReport_ContractMultiplier = 61,
+    FIX43_QuoteStatusReport_CouponRate = 62,
+    FIX43_QuoteStatusReport_SecurityExchange = 63,
+    FIX43_QuoteStatusReport_Issuer = 64,
+    FIX43_QuoteStatusReport_EncodedIssuerLen = 65,
+    FIX43_QuoteStatusReport_EncodedIssuer = 66,
+    FIX43_QuoteStatusReport_SecurityDesc = 67,
+    FIX43_QuoteStatusReport_EncodedSecurityDescLen = 68,
+    FIX43_QuoteStatusReport_EncodedSecurityDesc = 69,
+    FIX43_QuoteStatusReport_BidPx = 70,
+    FIX43_QuoteStatusReport_OfferPx = 71,
+    FIX43_QuoteStatusReport_MktBidPx = 72,
+    FIX43_QuoteStatusReport_MktOfferPx = 73,
+    FIX43_QuoteStatusReport_MinBidSize = 74,
+    FIX43_QuoteStatusReport_BidSize = 75,
+    FIX43_QuoteStatusReport_MinOfferSize = 76,
+    FIX43_QuoteStatusReport_OfferSize = 77,
+    FIX43_QuoteStatusReport_ValidUntilTime = 78,
+    FIX43_QuoteStatusReport_BidSpotRate = 79,
+    FIX43_QuoteStatusReport_OfferSpotRate = 80,
+    FIX43_QuoteStatusReport_BidForwardPoints = 81,
+    FIX43_QuoteStatusReport_OfferForwardPoints = 82,
+    FIX43_QuoteStatusReport_MidPx = 83,
+    FIX43_QuoteStatusReport_BidYield = 84,
+    FIX43_QuoteStatusReport_MidYield = 85,
+    FIX43_QuoteStatusReport_OfferYield = 86,
+    FIX43_QuoteStatusReport_TransactTime = 87,
+    FIX43_QuoteStatusReport_FutSettDate = 88,
+    FIX43_QuoteStatusReport_OrdType = 89,
+    FIX43_QuoteStatusReport_FutSettDate2 = 90,
+    FIX43_QuoteStatusReport_OrderQty2 = 91,
+    FIX43_QuoteStatusReport_BidForwardPoints2 = 92,
+    FIX43_QuoteStatusReport_OfferForwardPoints2 = 93,
+    FIX43_QuoteStatusReport_Currency = 94,
+    FIX43_QuoteStatusReport_SettlCurrBidFxRate = 95,
+    FIX43_QuoteStatusReport_SettlCurrOfferFxRate = 96,
+    FIX43_QuoteStatusReport_SettlCurrFxRateCalc = 97,
+    FIX43_QuoteStatusReport_CommType = 98,
+    FIX43_QuoteStatusReport_Commission = 99,
+    FIX43_QuoteStatusReport_CustOrderCapacity = 100,
+    FIX43_QuoteStatusReport_ExDestination = 101,
+    FIX43_QuoteStatusReport_QuoteStatus = 102,
+    FIX43_QuoteStatusReport_SignatureLength = 103,
+    FIX43_QuoteStatusReport_Signature = 104,
+    FIX43_QuoteStatusReport_CheckSum = 105,
+};
+
+typedef struct _fix43QuoteStatusReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteStatusReqID;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    struct _ofixDecimal	MktBidPx;
+    struct _ofixDecimal	MktOfferPx;
+    struct _ofixDecimal	MinBidSize;
+    struct _ofixDecimal	BidSize;
+    struct _ofixDecimal	MinOfferSize;
+    struct _ofixDecimal	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixDecimal	BidSpotRate;
+    struct _ofixDecimal	OfferSpotRate;
+    struct _ofixDecimal	BidForwardPoints;
+    struct _ofixDecimal	OfferForwardPoints;
+    struct _ofixDecimal	MidPx;
+    struct _ofixDecimal	BidYield;
+    struct _ofixDecimal	MidYield;
+    struct _ofixDecimal	OfferYield;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	FutSettDate;
+    char	OrdType;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	BidForwardPoints2;
+    struct _ofixDecimal	OfferForwardPoints2;
+    struct _ofixStrView	Currency;
+    struct _ofixDecimal	SettlCurrBidFxRate;
+    struct _ofixDecimal	SettlCurrOfferFxRate;
+    char	SettlCurrFxRateCalc;
+    char	CommType;
+    struct _ofixDecimal	Commission;
+    int64_t	CustOrderCapacity;
+    struct _ofixStrView	ExDestination;
+    int64_t	QuoteStatus;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43QuoteStatusReport;
+
+extern void	fix43_decode_QuoteStatusReport(ofixErr err, fix43QuoteStatusReport m, const char *raw, int len);
+extern void	fix43_decode_QuoteStatusReport_msg(ofixErr err, fix43QuoteStatusReport m, ofixMsg msg);
+extern ofixMsg	fix43_encode_QuoteStatusReport(ofixErr err, fix43QuoteStatusReport m);
+
+// News [B]
+enum {
+    FIX43_News_BeginString = 0,
+    FIX43_News_BodyLength = 1,
+    FIX43_News_MsgType = 2,
+    FIX43_News_SenderCompID = 3,
+    FIX43_News_TargetCompID = 4,
+    FIX43_News_OnBehalfOfCompID = 5,
+    FIX43_News_DeliverToCompID = 6,
+    FIX43_News_SecureDataLen = 7,
+    FIX43_News_SecureData = 8,
+    FIX43_News_MsgSeqNum = 9,
+    FIX43_News_SenderSubID = 10,
+    FIX43_News_SenderLocationID = 11,
+    FIX43_News_TargetSubID = 12,
+    FIX43_News_TargetLocationID = 13,
+    FIX43_News_OnBehalfOfSubID = 14,
+    FIX43_News_OnBehalfOfLocationID = 15,
+    FIX43_News_DeliverToSubID = 16,
+    FIX43_News_DeliverToLocationID = 17,
+    FIX43_News_PossDupFlag = 18,
+    FIX43_News_PossResend = 19,
+    FIX43_News_SendingTime = 20,
+    FIX43_News_OrigSendingTime = 21,
+    FIX43_News_XmlDataLen = 22,
+    FIX43_News_XmlData = 23,
+    FIX43_News_MessageEncoding = 24,
+    FIX43_News_LastMsgSeqNumProcessed = 25,
+    FIX43_News_OnBehalfOfSendingTime = 26,
+    FIX43_News_NoHops = 27,
+    FIX43_News_OrigTime = 28,
+    FIX43_News_Urgency = 29,
+    FIX43_News_Headline = 30,
+    FIX43_News_EncodedHeadlineLen = 31,
+    FIX43_News_EncodedHeadline = 32,
+    FIX43_News_NoRoutingIDs = 33,
+    FIX43_News_NoRelatedSym = 34,
+    FIX43_News_LinesOfText = 35,
+    FIX43_News_URLLink = 36,
+    FIX43_News_RawDataLength = 37,
+    FIX43_News_RawData = 38,
+    FIX43_News_SignatureLength = 39,
+    FIX43_News_Signature = 40,
+    FIX43_News_CheckSum = 41,
+};
+
+typedef struct _fix43News {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixDate	OrigTime;
+    char	Urgency;
+    struct _ofixStrView	Headline;
+    int64_t	EncodedHeadlineLen;
+    struct _ofixStrView	EncodedHeadline;
+    int64_t	NoRoutingIDs;
+    int64_t	NoRelatedSym;
+    int64_t	LinesOfText;
+    struct _ofixStrView	URLLink;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43News;
+
+extern void	fix43_decode_News(ofixErr err, fix43News m, const char *raw, int len);
+extern void	fix43_decode_News_msg(ofixErr err, fix43News m, ofixMsg msg);
+extern ofixMsg	fix43_encode_News(ofixErr err, fix43News m);
+
+// Email [C]
+enum {
+    FIX43_Email_BeginString = 0,
+    FIX43_Email_BodyLength = 1,
+    FIX43_Email_MsgType = 2,
+    FIX43_Email_SenderCompID = 3,
+    FIX43_Email_TargetCompID = 4,
+    FIX43_Email_OnBehalfOfCompID = 5,
+    FIX43_Email_DeliverToCompID = 6,
+    FIX43_Email_SecureDataLen = 7,
+    FIX43_Email_SecureData = 8,
+    FIX43_Email_MsgSeqNum = 9,
+    FIX43_Email_SenderSubID = 10,
+    FIX43_Email_SenderLocationID = 11,
+    FIX43_Email_TargetSubID = 12,
+    FIX43_Email_TargetLocationID = 13,
+    FIX43_Email_OnBehalfOfSubID = 14,
+    FIX43_Email_OnBehalfOfLocationID = 15,
+    FIX43_Email_DeliverToSubID = 16,
+    FIX43_Email_DeliverToLocationID = 17,
+    FIX43_Email_PossDupFlag = 18,
+    FIX43_Email_PossResend = 19,
+    FIX43_Email_SendingTime = 20,
+    FIX43_Email_OrigSendingTime = 21,
+    FIX43_Email_XmlDataLen = 22,
+    FIX43_Email_XmlData = 23,
+    FIX43_Email_MessageEncoding = 24,
+    FIX43_Email_LastMsgSeqNumProcessed = 25,
+    FIX43_Email_OnBehalfOfSendingTime = 26,
+    FIX43_Email_NoHops = 27,
+    FIX43_Email_EmailThreadID = 28,
+    FIX43_Email_EmailType = 29,
+    FIX43_Email_OrigTime = 30,
+    FIX43_Email_Subject = 31,
+    FIX43_Email_EncodedSubjectLen = 32,
+    FIX43_Email_EncodedSubject = 33,
+    FIX43_Email_NoRoutingIDs = 34,
+    FIX43_Email_NoRelatedSym = 35,
+    FIX43_Email_OrderID = 36,
+    FIX43_Email_ClOrdID = 37,
+    FIX43_Email_LinesOfText = 38,
+    FIX43_Email_RawDataLength = 39,
+    FIX43_Email_RawData = 40,
+    FIX43_Email_SignatureLength = 41,
+    FIX43_Email_Signature = 42,
+    FIX43_Email_CheckSum = 43,
+};
+
+typedef struct _fix43Email {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	EmailThreadID;
+    char	EmailType;
+    struct _ofixDate	OrigTime;
+    struct _ofixStrView	Subject;
+    int64_t	EncodedSubjectLen;
+    struct _ofixStrView	EncodedSubject;
+    int64_t	NoRoutingIDs;
+    int64_t	NoRelatedSym;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	LinesOfText;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Email;
+
+extern void	fix43_decode_Email(ofixErr err, fix43Email m, const char *raw, int len);
+extern void	fix43_decode_Email_msg(ofixErr err, fix43Email m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Email(ofixErr err, fix43Email m);
+
+// NewOrderSingle [D]
+enum {
+    FIX43_NewOrderSingle_BeginString = 0,
+    FIX43_NewOrderSingle_BodyLength = 1,
+    FIX43_NewOrderSingle_MsgType = 2,
+    FIX43_NewOrderSingle_SenderCompID = 3,
+    FIX43_NewOrderSingle_TargetCompID = 4,
+    FIX43_NewOrderSingle_OnBehalfOfCompID = 5,
+    FIX43_NewOrderSingle_DeliverToCompID = 6,
+    FIX43_NewOrderSingle_SecureDataLen = 7,
+    FIX43_NewOrderSingle_SecureData = 8,
+    FIX43_NewOrderSingle_MsgSeqNum = 9,
+    FIX43_NewOrderSingle_SenderSubID = 10,
+    FIX43_NewOrderSingle_SenderLocationID = 11,
+    FIX43_NewOrderSingle_TargetSubID = 12,
+    FIX43_NewOrderSingle_TargetLocationID = 13,
+    FIX43_NewOrderSingle_OnBehalfOfSubID = 14,
+    FIX43_NewOrderSingle_OnBehalfOfLocationID = 15,
+    FIX43_NewOrderSingle_DeliverToSubID = 16,
+    FIX43_NewOrderSingle_DeliverToLocationID = 17,
+    FIX43_NewOrderSingle_PossDupFlag = 18,
+    FIX43_NewOrderSingle_PossResend = 19,
+    FIX43_NewOrderSingle_SendingTime = 20,
+    FIX43_NewOrderSingle_OrigSendingTime = 21,
+    FIX43_NewOrderSingle_XmlDataLen = 22,
+    FIX43_NewOrderSingle_XmlData = 23,
+    FIX43_NewOrderSingle_MessageEncoding = 24,
+    FIX43_NewOrderSingle_LastMsgSeqNumProcessed = 25,
+    FIX43_NewOrderSingle_OnBehalfOfSendingTime = 26,
+    FIX43_NewOrderSingle_NoHops = 27,
+    FIX43_NewOrderSingle_ClOrdID = 28,
+    FIX43_NewOrderSingle_SecondaryClOrdID = 29,
+    FIX43_NewOrderSingle_ClOrdLinkID = 30,
+    FIX43_NewOrderSingle_NoPartyIDs = 31,
+    FIX43_NewOrderSingle_TradeOriginationDate = 32,
+    FIX43_NewOrderSingle_Account = 33,
+    FIX43_NewOrderSingle_AccountType = 34,
+    FIX43_NewOrderSingle_DayBookingInst = 35,
+    FIX43_NewOrderSingle_BookingUnit = 36,
+    FIX43_NewOrderSingle_PreallocMethod = 37,
+    FIX43_NewOrderSingle_NoAllocs = 38,
+    FIX43_NewOrderSingle_SettlmntTyp = 39,
+    FIX43_NewOrderSingle_FutSettDate = 40,
+    FIX43_NewOrderSingle_CashMargin = 41,
+    FIX43_NewOrderSingle_ClearingFeeIndicator = 42,
+    FIX43_NewOrderSingle_HandlInst = 43,
+    FIX43_NewOrderSingle_ExecInst = 44,
+    FIX43_NewOrderSingle_MinQty = 45,
+    FIX43_NewOrderSingle_MaxFloor = 46,
+    FIX43_NewOrderSingle_ExDestination = 47,
+    FIX43_NewOrderSingle_NoTradingSessions = 48,
+    FIX43_NewOrderSingle_ProcessCode = 49,
+    FIX43_NewOrderSingle_Symbol = 50,
+    FIX43_NewOrderSingle_SymbolSfx = 51,
+    FIX43_NewOrderSingle_SecurityID = 52,
+    FIX43_NewOrderSingle_SecurityIDSource = 53,
+    FIX43_NewOrderSingle_NoSecurityAltID = 54,
+    FIX43_NewOrderSingle_Product = 55,
+    FIX43_NewOrderSingle_CFICode = 56,
+    FIX43_NewOrderSingle_SecurityType = 57,
+    FIX43_NewOrderSingle_MaturityMonthYear = 58,
+    FIX43_NewOrderSingle_MaturityDate = 59,
+    FIX43_NewOrderSingle_CouponPaymentDate = 60,
+    FIX43_NewOrderSingle_IssueDate = 61,
+    FIX43_NewOrderSingle_RepoCollateralSecurityType = 62,
+    FIX43_NewOrderSingle_RepurchaseTerm = 63,
+    FIX43_NewOrderSingle_RepurchaseRate = 64,
+    FIX43_NewOrderSingle_Factor = 65,
+    FIX43_NewOrderSingle_CreditRating = 66,
+    FIX43_NewOrderSingle_InstrRegistry = 67,
+    FIX43_NewOrderSingle_CountryOfIssue = 68,
+    FIX43_NewOrderSingle_StateOrProvinceOfIssue = 69,
+    FIX43_NewOrderSingle_LocaleOfIssue = 70,
+    FIX43_NewOrderSingle_RedemptionDate = 71,
+    FIX43_NewOrderSingle_StrikePrice = 72,
+    FIX43_NewOrderSingle_OptAttribute = 73,
+    FIX43_NewOrderSingle_ContractMultiplier = 74,
+    FIX43_NewOrderSingle_CouponRate = 75,
+    FIX43_NewOrderSingle_SecurityExchange = 76,
+    FIX43_NewOrderSingle_Issuer = 77,
+    FIX43_NewOrderSingle_EncodedIssuerLen = 78,
+    FIX43_NewOrderSingle_EncodedIssuer = 79,
+    FIX43_NewOrderSingle_SecurityDesc = 80,
+    FIX43_NewOrderSingle_EncodedSecurityDescLen = 81,
+    FIX43_NewOrderSingle_EncodedSecurityDesc = 82,
+    FIX43_NewOrderSingle_PrevClosePx = 83,
+    FIX43_NewOrderSingle_Side = 84,
+    FIX43_NewOrderSingle_LocateReqd = 85,
+    FIX43_NewOrderSingle_TransactTime = 86,
+    FIX43_NewOrderSingle_NoStipulations = 87,
+    FIX43_NewOrderSingle_QuantityType = 88,
+    FIX43_NewOrderSingle_OrderQty = 89,
+    FIX43_NewOrderSingle_CashOrderQty = 90,
+    FIX43_NewOrderSingle_OrderPercent = 91,
+    FIX43_NewOrderSingle_RoundingDirection = 92,
+    FIX43_NewOrderSingle_RoundingModulus = 93,
+    FIX43_NewOrderSingle_OrdType = 94,
+    FIX43_NewOrderSingle_PriceType = 95,
+    FIX43_NewOrderSingle_Price = 96,
+    FIX43_NewOrderSingle_StopPx = 97,
+    FIX43_NewOrderSingle_Spread = 98,
+    FIX43_NewOrderSingle_BenchmarkCurveCurrency = 99,
+    FIX43_NewOrderSingle_BenchmarkCurveName = 100,
+    FIX43_NewOrderSingle_BenchmarkCurvePoint = 101,
+    FIX43_NewOrderSingle_YieldType = 102,
+    FIX43_NewOrderSingle_Yield = 103,
+    FIX43_NewOrderSingle_Currency = 104,
+    FIX43_NewOrderSingle_ComplianceID = 105,
+    FIX43_NewOrderSingle_SolicitedFlag = 106,
+    FIX43_NewOrderSingle_IOIid = 107,
+    FIX43_NewOrderSingle_QuoteID = 108,
+    FIX43_NewOrderSingle_TimeInForce = 109,
+    FIX43_NewOrderSingle_EffectiveTime = 110,
+    FIX43_NewOrderSingle_ExpireDate = 111,
+    FIX43_NewOrderSingle_ExpireTime = 112,
+    FIX43_NewOrderSingle_GTBookingInst = 113,
+    FIX43_NewOrderSingle_Commission = 114,
+    FIX43_NewOrderSingle_CommType = 115,
+    FIX43_NewOrderSingle_CommCurrency = 116,
+    FIX43_NewOrderSingle_FundRenewWaiv = 117,
+    FIX43_NewOrderSingle_OrderCapacity = 118,
+    FIX43_NewOrderSingle_OrderRestrictions = 119,
+    FIX43_NewOrderSingle_CustOrderCapacity = 120,
+    FIX43_NewOrderSingle_Rule80A = 121,
+    FIX43_NewOrderSingle_ForexReq = 122,
+    FIX43_NewOrderSingle_SettlCurrency = 123,
+    FIX43_NewOrderSingle_Text = 124,
+    FIX43_NewOrderSingle_EncodedTextLen = 125,
+    FIX43_NewOrderSingle_EncodedText = 126,
+    FIX43_NewOrderSingle_FutSettDate2 = 127,
+    FIX43_NewOrderSingle_OrderQty2 = 128,
+    FIX43_NewOrderSingle_Price2 = 129,
+    FIX43_NewOrderSingle_PositionEffect = 130,
+    FIX43_NewOrderSingle_CoveredOrUncovered = 131,
+    FIX43_NewOrderSingle_MaxShow = 132,
+    FIX43_NewOrderSingle_PegDifference = 133,
+    FIX43_NewOrderSingle_DiscretionInst = 134,
+    FIX43_NewOrderSingle_DiscretionOffset = 135,
+    FIX43_NewOrderSingle_CancellationRights = 136,
+    FIX43_NewOrderSingle_MoneyLaunderingStatus = 137,
+    FIX43_NewOrderSingle_RegistID = 138,
+    FIX43_NewOrderSingle_Designation = 139,
+    FIX43_NewOrderSingle_AccruedInterestRate = 140,
+    FIX43_NewOrderSingle_AccruedInterestAmt = 141,
+    FIX43_NewOrderSingle_NetMoney = 142,
+    FIX43_NewOrderSingle_SignatureLength = 143,
+    FIX43_NewOrderSingle_Signature = 144,
+    FIX43_NewOrderSingle_CheckSum = 145,
+};
+
+typedef struct _fix43NewOrderSingle {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    int64_t	NoPartyIDs;
+    struct _ofixDate	TradeOriginationDate;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    int64_t	NoAllocs;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	PrevClosePx;
+    char	Side;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	NoStipulations;
+    int64_t	QuantityType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	Rule80A;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	Price2;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	NetMoney;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43NewOrderSingle;
+
+extern void	fix43_decode_NewOrderSingle(ofixErr err, fix43NewOrderSingle m, const char *raw, int len);
+extern void	fix43_decode_NewOrderSingle_msg(ofixErr err, fix43NewOrderSingle m, ofixMsg msg);
+extern ofixMsg	fix43_encode_NewOrderSingle(ofixErr err, fix43NewOrderSingle m);
+
+// NewOrderList [E]
+enum {
+    FIX43_NewOrderList_BeginString = 0,
+    FIX43_NewOrderList_BodyLength = 1,
+    FIX43_NewOrderList_MsgType = 2,
+    FIX43_NewOrderList_SenderCompID = 3,
+    FIX43_NewOrderList_TargetCompID = 4,
+    FIX43_NewOrderList_OnBehalfOfCompID = 5,
+    FIX43_NewOrderList_DeliverToCompID = 6,
+    FIX43_NewOrderList_SecureDataLen = 7,
+    FIX43_NewOrderList_SecureData = 8,
+    FIX43_NewOrderList_MsgSeqNum = 9,
+    FIX43_NewOrderList_SenderSubID = 10,
+    FIX43_NewOrderList_SenderLocationID = 11,
+    FIX43_NewOrderList_TargetSubID = 12,
+    FIX43_NewOrderList_TargetLocationID = 13,
+    FIX43_NewOrderList_OnBehalfOfSubID = 14,
+    FIX43_NewOrderList_OnBehalfOfLocationID = 15,
+    FIX43_NewOrderList_DeliverToSubID = 16,
+    FIX43_NewOrderList_DeliverToLocationID = 17,
+    FIX43_NewOrderList_PossDupFlag = 18,
+    FIX43_NewOrderList_PossResend = 19,
+    FIX43_NewOrderList_SendingTime = 20,
+    FIX43_NewOrderList_OrigSendingTime = 21,
+    FIX43_NewOrderList_XmlDataLen = 22,
+    FIX43_NewOrderList_XmlData = 23,
+    FIX43_NewOrderList_MessageEncoding = 24,
+    FIX43_NewOrderList_LastMsgSeqNumProcessed = 25,
+    FIX43_NewOrderList_OnBehalfOfSendingTime = 26,
+    FIX43_NewOrderList_NoHops = 27,
+    FIX43_NewOrderList_ListID = 28,
+    FIX43_NewOrderList_BidID = 29,
+    FIX43_NewOrderList_ClientBidID = 30,
+    FIX43_NewOrderList_ProgRptReqs = 31,
+    FIX43_NewOrderList_BidType = 32,
+    FIX43_NewOrderList_ProgPeriodInterval = 33,
+    FIX43_NewOrderList_CancellationRights = 34,
+    FIX43_NewOrderList_MoneyLaunderingStatus = 35,
+    FIX43_NewOrderList_RegistID = 36,
+    FIX43_NewOrderList_ListExecInstType = 37,
+    FIX43_NewOrderList_ListExecInst = 38,
+    FIX43_NewOrderList_EncodedListExecInstLen = 39,
+    FIX43_NewOrderList_EncodedListExecInst = 40,
+    FIX43_NewOrderList_TotNoOrders = 41,
+    FIX43_NewOrderList_NoOrders = 42,
+    FIX43_NewOrderList_SignatureLength = 43,
+    FIX43_NewOrderList_Signature = 44,
+    FIX43_NewOrderList_CheckSum = 45,
+};
+
+typedef struct _fix43NewOrderList {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    int64_t	ProgRptReqs;
+    int64_t	BidType;
+    int64_t	ProgPeriodInterval;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    char	ListExecInstType;
+    struct _ofixStrView	ListExecInst;
+    int64_t	EncodedListExecInstLen;
+    struct _ofixStrView	EncodedListExecInst;
+    int64_t	TotNoOrders;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43NewOrderList;
+
+extern void	fix43_decode_NewOrderList(ofixErr err, fix43NewOrderList m, const char *raw, int len);
+extern void	fix43_decode_NewOrderList_msg(ofixErr err, fix43NewOrderList m, ofixMsg msg);
+extern ofixMsg	fix43_encode_NewOrderList(ofixErr err, fix43NewOrderList m);
+
+// OrderCancelRequest [F]
+enum {
+    FIX43_OrderCancelRequest_BeginString = 0,
+    FIX43_OrderCancelRequest_BodyLength = 1,
+    FIX43_OrderCancelRequest_MsgType = 2,
+    FIX43_OrderCancelRequest_SenderCompID = 3,
+    FIX43_OrderCancelRequest_TargetCompID = 4,
+    FIX43_OrderCancelRequest_OnBehalfOfCompID = 5,
+    FIX43_OrderCancelRequest_DeliverToCompID = 6,
+    FIX43_OrderCancelRequest_SecureDataLen = 7,
+    FIX43_OrderCancelRequest_SecureData = 8,
+    FIX43_OrderCancelRequest_MsgSeqNum = 9,
+    FIX43_OrderCancelRequest_SenderSubID = 10,
+    FIX43_OrderCancelRequest_SenderLocationID = 11,
+    FIX43_OrderCancelRequest_TargetSubID = 12,
+    FIX43_OrderCancelRequest_TargetLocationID = 13,
+    FIX43_OrderCancelRequest_OnBehalfOfSubID = 14,
+    FIX43_OrderCancelRequest_OnBehalfOfLocationID = 15,
+    FIX43_OrderCancelRequest_DeliverToSubID = 16,
+    FIX43_OrderCancelRequest_DeliverToLocationID = 17,
+    FIX43_OrderCancelRequest_PossDupFlag = 18,
+    FIX43_OrderCancelRequest_PossResend = 19,
+    FIX43_OrderCancelRequest_SendingTime = 20,
+    FIX43_OrderCancelRequest_OrigSendingTime = 21,
+    FIX43_OrderCancelRequest_XmlDataLen = 22,
+    FIX43_OrderCancelRequest_XmlData = 23,
+    FIX43_OrderCancelRequest_MessageEncoding = 24,
+    FIX43_OrderCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_OrderCancelRequest_OnBehalfOfSendingTime = 26,
+    FIX43_OrderCancelRequest_NoHops = 27,
+    FIX43_OrderCancelRequest_OrigClOrdID = 28,
+    FIX43_OrderCancelRequest_OrderID = 29,
+    FIX43_OrderCancelRequest_ClOrdID = 30,
+    FIX43_OrderCancelRequest_SecondaryClOrdID = 31,
+    FIX43_OrderCancelRequest_ClOrdLinkID = 32,
+    FIX43_OrderCancelRequest_ListID = 33,
+    FIX43_OrderCancelRequest_OrigOrdModTime = 34,
+    FIX43_OrderCancelRequest_Account = 35,
+    FIX43_OrderCancelRequest_AccountType = 36,
+    FIX43_OrderCancelRequest_NoPartyIDs = 37,
+    FIX43_OrderCancelRequest_Symbol = 38,
+    FIX43_OrderCancelRequest_SymbolSfx = 39,
+    FIX43_OrderCancelRequest_SecurityID = 40,
+    FIX43_OrderCancelRequest_SecurityIDSource = 41,
+    FIX43_OrderCancelRequest_NoSecurityAltID = 42,
+    FIX43_OrderCancelRequest_Product = 43,
+    FIX43_OrderCancelRequest_CFICode = 44,
+    FIX43_OrderCancelRequest_SecurityType = 45,
+    FIX43_OrderCancelRequest_MaturityMonthYear = 46,
+    FIX43_OrderCancelRequest_MaturityDate = 47,
+    FIX43_OrderCancelRequest_CouponPaymentDate = 48,
+    FIX43_OrderCancelRequest_IssueDate = 49,
+    FIX43_OrderCancelRequest_RepoCollateralSecurityType = 50,
+    FIX43_OrderCancelRequest_RepurchaseTerm = 51,
+    FIX43_OrderCancelRequest_RepurchaseRate = 52,
+    FIX43_OrderCancelRequest_Factor = 53,
+    FIX43_OrderCancelRequest_CreditRating = 54,
+    FIX43_OrderCancelRequest_InstrRegistry = 55,
+    FIX43_OrderCancelRequest_CountryOfIssue = 56,
+    FIX43_OrderCancelRequest_StateOrProvinceOfIssue = 57,
+    FIX43_OrderCancelRequest_LocaleOfIssue = 58,
+    FIX43_OrderCancelRequest_RedemptionDate = 59,
+    FIX43_OrderCancelRequest_StrikePrice = 60,
+    FIX43_OrderCancelRequest_OptAttribute = 61,
+    FIX43_OrderCancelRequest_ContractMultiplier = 62,
+    FIX43_OrderCancelRequest_CouponRate = 63,
+    FIX43_OrderCancelRequest_SecurityExchange = 64,
+    FIX43_OrderCancelRequest_Issuer = 65,
+    FIX43_OrderCancelRequest_EncodedIssuerLen = 66,
+    FIX43_OrderCancelRequest_EncodedIssuer = 67,
+    FIX43_OrderCancelRequest_SecurityDesc = 68,
+    FIX43_OrderCancelRequest_EncodedSecurityDescLen = 69,
+    FIX43_OrderCancelRequest_EncodedSecurityDesc = 70,
+    FIX43_OrderCancelRequest_Side = 71,
+    FIX43_OrderCancelRequest_TransactTime = 72,
+    FIX43_OrderCancelRequest_OrderQty = 73,
+    FIX43_OrderCancelRequest_CashOrderQty = 74,
+    FIX43_OrderCancelRequest_OrderPercent = 75,
+    FIX43_OrderCancelRequest_RoundingDirection = 76,
+    FIX43_OrderCancelRequest_RoundingModulus = 77,
+    FIX43_OrderCancelRequest_ComplianceID = 78,
+    FIX43_OrderCancelRequest_Text = 79,
+    FIX43_OrderCancelRequest_EncodedTextLen = 80,
+    FIX43_OrderCancelRequest_EncodedText = 81,
+    FIX43_OrderCancelRequest_SignatureLength = 82,
+    FIX43_OrderCancelRequest_Signature = 83,
+    FIX43_OrderCancelRequest_CheckSum = 84,
+};
+
+typedef struct _fix43OrderCancelRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixStrView	ListID;
+    struct _ofixDate	OrigOrdModTime;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    struct _ofixStrView	ComplianceID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43OrderCancelRequest;
+
+extern void	fix43_decode_OrderCancelRequest(ofixErr err, fix43OrderCancelRequest m, const char *raw, int len);
+extern void	fix43_decode_OrderCancelRequest_msg(ofixErr err, fix43OrderCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_OrderCancelRequest(ofixErr err, fix43OrderCancelRequest m);
+
+// OrderCancelReplaceRequest [G]
+enum {
+    FIX43_OrderCancelReplaceRequest_BeginString = 0,
+    FIX43_OrderCancelReplaceRequest_BodyLength = 1,
+    FIX43_OrderCancelReplaceRequest_MsgType = 2,
+    FIX43_OrderCancelReplaceRequest_SenderCompID = 3,
+    FIX43_OrderCancelReplaceRequest_TargetCompID = 4,
+    FIX43_OrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX43_OrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX43_OrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX43_OrderCancelReplaceRequest_SecureData = 8,
+    FIX43_OrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX43_OrderCancelReplaceRequest_SenderSubID = 10,
+    FIX43_OrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX43_OrderCancelReplaceRequest_TargetSubID = 12,
+    FIX43_OrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX43_OrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX43_OrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX43_OrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX43_OrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX43_OrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX43_OrderCancelReplaceRequest_PossResend = 19,
+    FIX43_OrderCancelReplaceRequest_SendingTime = 20,
+    FIX43_OrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX43_OrderCancelReplaceRequest_XmlDataLen = 22,
+    FIX43_OrderCancelReplaceRequest_XmlData = 23,
+    FIX43_OrderCancelReplaceRequest_MessageEncoding = 24,
+    FIX43_OrderCancelReplaceRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_OrderCancelReplaceRequest_OnBehalfOfSendingTime = 26,
+    FIX43_OrderCancelReplaceRequest_NoHops = 27,
+    FIX43_OrderCancelReplaceRequest_OrderID = 28,
+    FIX43_OrderCancelReplaceRequest_NoPartyIDs = 29,
+    FIX43_OrderCancelReplaceRequest_TradeOriginationDate = 30,
+    FIX43_OrderCancelReplaceRequest_OrigClOrdID = 31,
+    FIX43_OrderCancelReplaceRequest_ClOrdID = 32,
+    FIX43_OrderCancelReplaceRequest_SecondaryClOrdID = 33,
+    FIX43_OrderCancelReplaceRequest_ClOrdLinkID = 34,
+    FIX43_OrderCancelReplaceRequest_ListID = 35,
+    FIX43_OrderCancelReplaceRequest_OrigOrdModTime = 36,
+    FIX43_OrderCancelReplaceRequest_Account = 37,
+    FIX43_OrderCancelReplaceRequest_AccountType = 38,
+    FIX43_OrderCancelReplaceRequest_DayBookingInst = 39,
+    FIX43_OrderCancelReplaceRequest_BookingUnit = 40,
+    FIX43_OrderCancelReplaceRequest_PreallocMethod = 41,
+    FIX43_OrderCancelReplaceRequest_NoAllocs = 42,
+    FIX43_OrderCancelReplaceRequest_SettlmntTyp = 43,
+    FIX43_OrderCancelReplaceRequest_FutSettDate = 44,
+    FIX43_OrderCancelReplaceRequest_CashMargin = 45,
+    FIX43_OrderCancelReplaceRequest_ClearingFeeIndicator = 46,
+    FIX43_OrderCancelReplaceRequest_HandlInst = 47,
+    FIX43_OrderCancelReplaceRequest_ExecInst = 48,
+    FIX43_OrderCancelReplaceRequest_MinQty = 49,
+    FIX43_OrderCancelReplaceRequest_MaxFloor = 50,
+    FIX43_OrderCancelReplaceRequest_ExDestination = 51,
+    FIX43_OrderCancelReplaceRequest_NoTradingSessions = 52,
+    FIX43_OrderCancelReplaceRequest_Symbol = 53,
+    FIX43_OrderCancelReplaceRequest_SymbolSfx = 54,
+    FIX43_OrderCancelReplaceRequest_SecurityID = 55,
+    FIX43_OrderCancelReplaceRequest_SecurityIDSource = 56,
+    FIX43_OrderCancelReplaceRequest_NoSecurityAltID = 57,
+    FIX43_OrderCancelReplaceRequest_Product = 58,
+    FIX43_OrderCancelReplaceRequest_CFICode = 59,
+    FIX43_OrderCancelReplaceRequest_SecurityType = 60,
+    FIX43_OrderCancelReplaceRequest_MaturityMonthYear = 61,
+    FIX43_OrderCancelReplaceRequest_MaturityDate = 62,
+    FIX43_OrderCancelReplaceRequest_CouponPaymentDate = 63,
+    FIX43_OrderCancelReplaceRequest_IssueDate = 64,
+    FIX43_OrderCancelReplaceRequest_RepoCollateralSecurityType = 65,
+    FIX43_OrderCancelReplaceRequest_RepurchaseTerm = 66,
+    FIX43_OrderCancelReplaceRequest_RepurchaseRate = 67,
+    FIX43_OrderCancelReplaceRequest_Factor = 68,
+    FIX43_OrderCancelReplaceRequest_CreditRating = 69,
+    FIX43_OrderCancelReplaceRequest_InstrRegistry = 70,
+    FIX43_OrderCancelReplaceRequest_CountryOfIssue = 71,
+    FIX43_OrderCancelReplaceRequest_StateOrProvinceOfIssue = 72,
+    FIX43_OrderCancelReplaceRequest_LocaleOfIssue = 73,
+    FIX43_OrderCancelReplaceRequest_RedemptionDate = 74,
+    FIX43_OrderCancelReplaceRequest_StrikePrice = 75,
+    FIX43_OrderCancelReplaceRequest_OptAttribute = 76,
+    FIX43_OrderCancelReplaceRequest_ContractMultiplier = 77,
+    FIX43_OrderCancelReplaceRequest_CouponRate = 78,
+    FIX43_OrderCancelReplaceRequest_SecurityExchange = 79,
+    FIX43_OrderCancelReplaceRequest_Issuer = 80,
+    FIX43_OrderCancelReplaceRequest_EncodedIssuerLen = 81,
+    FIX43_OrderCancelReplaceRequest_EncodedIssuer = 82,
+    FIX43_OrderCancelReplaceRequest_SecurityDesc = 83,
+    FIX43_OrderCancelReplaceRequest_EncodedSecurityDescLen = 84,
+    FIX43_OrderCancelReplaceRequest_EncodedSecurityDesc = 85,
+    FIX43_OrderCancelReplaceRequest_Side = 86,
+    FIX43_OrderCancelReplaceRequest_TransactTime = 87,
+    FIX43_OrderCancelReplaceRequest_QuantityType = 88,
+    FIX43_OrderCancelReplaceRequest_OrderQty = 89,
+    FIX43_OrderCancelReplaceRequest_CashOrderQty = 90,
+    FIX43_OrderCancelReplaceRequest_OrderPercent = 91,
+    FIX43_OrderCancelReplaceRequest_RoundingDirection = 92,
+    FIX43_OrderCancelReplaceRequest_RoundingModulus = 93,
+    FIX43_OrderCancelReplaceRequest_OrdType = 94,
+    FIX43_OrderCancelReplaceRequest_PriceType = 95,
+    FIX43_OrderCancelReplaceRequest_Price = 96,
+    FIX43_OrderCancelReplaceRequest_StopPx = 97,
+    FIX43_OrderCancelReplaceRequest_Spread = 98,
+    FIX43_OrderCancelReplaceRequest_BenchmarkCurveCurrency = 99,
+    FIX43_OrderCancelReplaceRequest_BenchmarkCurveName = 100,
+    FIX43_OrderCancelReplaceRequest_BenchmarkCurvePoint = 101,
+    FIX43_OrderCancelReplaceRequest_YieldType = 102,
+    FIX43_OrderCancelReplaceRequest_Yield = 103,
+    FIX43_OrderCancelReplaceRequest_PegDifference = 104,
+    FIX43_OrderCancelReplaceRequest_DiscretionInst = 105,
+    FIX43_OrderCancelReplaceRequest_DiscretionOffset = 106,
+    FIX43_OrderCancelReplaceRequest_ComplianceID = 107,
+    FIX43_OrderCancelReplaceRequest_SolicitedFlag = 108,
+    FIX43_OrderCancelReplaceRequest_Currency = 109,
+    FIX43_OrderCancelReplaceRequest_TimeInForce = 110,
+    FIX43_OrderCancelReplaceRequest_EffectiveTime = 111,
+    FIX43_OrderCancelReplaceRequest_ExpireDate = 112,
+    FIX43_OrderCancelReplaceRequest_ExpireTime = 113,
+    FIX43_OrderCancelReplaceRequest_GTBookingInst = 114,
+    FIX43_OrderCancelReplaceRequest_Commission = 115,
+    FIX43_OrderCancelReplaceRequest_CommType = 116,
+    FIX43_OrderCancelReplaceRequest_CommCurrency = 117,
+    FIX43_OrderCancelReplaceRequest_FundRenewWaiv = 118,
+    FIX43_OrderCancelReplaceRequest_OrderCapacity = 119,
+    FIX43_OrderCancelReplaceRequest_OrderRestrictions = 120,
+    FIX43_OrderCancelReplaceRequest_CustOrderCapacity = 121,
+    FIX43_OrderCancelReplaceRequest_Rule80A = 122,
+    FIX43_OrderCancelReplaceRequest_ForexReq = 123,
+    FIX43_OrderCancelReplaceRequest_SettlCurrency = 124,
+    FIX43_OrderCancelReplaceRequest_Text = 125,
+    FIX43_OrderCancelReplaceRequest_EncodedTextLen = 126,
+    FIX43_OrderCancelReplaceRequest_EncodedText = 127,
+    FIX43_OrderCancelReplaceRequest_FutSettDate2 = 128,
+    FIX43_OrderCancelReplaceRequest_OrderQty2 = 129,
+    FIX43_OrderCancelReplaceRequest_Price2 = 130,
+    FIX43_OrderCancelReplaceRequest_PositionEffect = 131,
+    FIX43_OrderCancelReplaceRequest_CoveredOrUncovered = 132,
+    FIX43_OrderCancelReplaceRequest_MaxShow = 133,
+    FIX43_OrderCancelReplaceRequest_LocateReqd = 134,
+    FIX43_OrderCancelReplaceRequest_CancellationRights = 135,
+    FIX43_OrderCancelReplaceRequest_MoneyLaunderingStatus = 136,
+    FIX43_OrderCancelReplaceRequest_RegistID = 137,
+    FIX43_OrderCancelReplaceRequest_Designation = 138,
+    FIX43_OrderCancelReplaceRequest_AccruedInterestRate = 139,
+    FIX43_OrderCancelReplaceRequest_AccruedInterestAmt = 140,
+    FIX43_OrderCancelReplaceRequest_NetMoney = 141,
+    FIX43_OrderCancelReplaceRequest_SignatureLength = 142,
+    FIX43_OrderCancelReplaceRequest_Signature = 143,
+    FIX43_OrderCancelReplaceRequest_CheckSum = 144,
+};
+
+typedef struct _fix43OrderCancelReplaceRequest {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    int64_t	NoPartyIDs;
+    struct _ofixDate	TradeOriginationDate;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixStrView	ListID;
+    struct _ofixDate	OrigOrdModTime;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    int64_t	NoAllocs;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    int64_t	QuantityType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	Currency;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	Rule80A;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	Price2;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    char	LocateReqd;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	NetMoney;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43OrderCancelReplaceRequest;
+
+extern void	fix43_decode_OrderCancelReplaceRequest(ofixErr err, fix43OrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix43_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix43OrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_OrderCancelReplaceRequest(ofixErr err, fix43OrderCancelReplaceRequest m);
+
+// OrderStatusRequest [H]
+enum {
+    FIX43_OrderStatusRequest_BeginString = 0,
+    FIX43_OrderStatusRequest_BodyLength = 1,
+    FIX43_OrderStatusRequest_MsgType = 2,
+    FIX43_OrderStatusRequest_SenderCompID = 3,
+    FIX43_OrderStatusRequest_TargetCompID = 4,
+    FIX43_OrderStatusRequest_OnBehalfOfCompID = 5,
+    FIX43_OrderStatusRequest_DeliverToCompID = 6,
+    FIX43_OrderStatusRequest_SecureDataLen = 7,
+    FIX43_OrderStatusRequest_SecureData = 8,
+    FIX43_OrderStatusRequest_MsgSeqNum = 9,
+    FIX43_OrderStatusRequest_SenderSubID = 10,
+    FIX43_OrderStatusRequest_SenderLocationID = 11,
+    FIX43_OrderStatusRequest_TargetSubID = 12,
+    FIX43_OrderStatusRequest_TargetLocationID = 13,
+    FIX43_OrderStatusRequest_OnBehalfOfSubID = 14,
+    FIX43_OrderStatusRequest_OnBehalfOfLocationID = 15,
+    FIX43_OrderStatusRequest_DeliverToSubID = 16,
+    FIX43_OrderStatusRequest_DeliverToLocationID = 17,
+    FIX43_OrderStatusRequest_PossDupFlag = 18,
+    FIX43_OrderStatusRequest_PossResend = 19,
+    FIX43_OrderStatusRequest_SendingTime = 20,
+    FIX43_OrderStatusRequest_OrigSendingTime = 21,
+    FIX43_OrderStatusRequest_XmlDataLen = 22,
+    FIX43_OrderStatusRequest_XmlData = 23,
+    FIX43_OrderStatusRequest_MessageEncoding = 24,
+    FIX43_OrderStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_OrderStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX43_OrderStatusRequest_NoHops = 27,
+    FIX43_OrderStatusRequest_OrderID = 28,
+    FIX43_OrderStatusRequest_ClOrdID = 29,
+    FIX43_OrderStatusRequest_SecondaryClOrdID = 30,
+    FIX43_OrderStatusRequest_ClOrdLinkID = 31,
+    FIX43_OrderStatusRequest_NoPartyIDs = 32,
+    FIX43_OrderStatusRequest_Account = 33,
+    FIX43_OrderStatusRequest_Symbol = 34,
+    FIX43_OrderStatusRequest_SymbolSfx = 35,
+    FIX43_OrderStatusRequest_SecurityID = 36,
+    FIX43_OrderStatusRequest_SecurityIDSource = 37,
+    FIX43_OrderStatusRequest_NoSecurityAltID = 38,
+    FIX43_OrderStatusRequest_Product = 39,
+    FIX43_OrderStatusRequest_CFICode = 40,
+    FIX43_OrderStatusRequest_SecurityType = 41,
+    FIX43_OrderStatusRequest_MaturityMonthYear = 42,
+    FIX43_OrderStatusRequest_MaturityDate = 43,
+    FIX43_OrderStatusRequest_CouponPaymentDate = 44,
+    FIX43_OrderStatusRequest_IssueDate = 45,
+    FIX43_OrderStatusRequest_RepoCollateralSecurityType = 46,
+    FIX43_OrderStatusRequest_RepurchaseTerm = 47,
+    FIX43_OrderStatusRequest_RepurchaseRate = 48,
+    FIX43_OrderStatusRequest_Factor = 49,
+    FIX43_OrderStatusRequest_CreditRating = 50,
+    FIX43_OrderStatusRequest_InstrRegistry = 51,
+    FIX43_OrderStatusRequest_CountryOfIssue = 52,
+    FIX43_OrderStatusRequest_StateOrProvinceOfIssue = 53,
+    FIX43_OrderStatusRequest_LocaleOfIssue = 54,
+    FIX43_OrderStatusRequest_RedemptionDate = 55,
+    FIX43_OrderStatusRequest_StrikePrice = 56,
+    FIX43_OrderStatusRequest_OptAttribute = 57,
+    FIX43_OrderStatusRequest_ContractMultiplier = 58,
+    FIX43_OrderStatusRequest_CouponRate = 59,
+    FIX43_OrderStatusRequest_SecurityExchange = 60,
+    FIX43_OrderStatusRequest_Issuer = 61,
+    FIX43_OrderStatusRequest_EncodedIssuerLen = 62,
+    FIX43_OrderStatusRequest_EncodedIssuer = 63,
+    FIX43_OrderStatusRequest_SecurityDesc = 64,
+    FIX43_OrderStatusRequest_EncodedSecurityDescLen = 65,
+    FIX43_OrderStatusRequest_EncodedSecurityDesc = 66,
+    FIX43_OrderStatusRequest_Side = 67,
+    FIX43_OrderStatusRequest_SignatureLength = 68,
+    FIX43_OrderStatusRequest_Signature = 69,
+    FIX43_OrderStatusRequest_CheckSum = 70,
+};
+
+typedef struct _fix43OrderStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43OrderStatusRequest;
+
+extern void	fix43_decode_OrderStatusRequest(ofixErr err, fix43OrderStatusRequest m, const char *raw, int len);
+extern void	fix43_decode_OrderStatusRequest_msg(ofixErr err, fix43OrderStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_OrderStatusRequest(ofixErr err, fix43OrderStatusRequest m);
+
+// Allocation [J]
+enum {
+    FIX43_Allocation_BeginString = 0,
+    FIX43_Allocation_BodyLength = 1,
+    FIX43_Allocation_MsgType = 2,
+    FIX43_Allocation_SenderCompID = 3,
+    FIX43_Allocation_TargetCompID = 4,
+    FIX43_Allocation_OnBehalfOfCompID = 5,
+    FIX43_Allocation_DeliverToCompID = 6,
+    FIX43_Allocation_SecureDataLen = 7,
+    FIX43_Allocation_SecureData = 8,
+    FIX43_Allocation_MsgSeqNum = 9,
+    FIX43_Allocation_SenderSubID = 10,
+    FIX43_Allocation_SenderLocationID = 11,
+    FIX43_Allocation_TargetSubID = 12,
+    FIX43_Allocation_TargetLocationID = 13,
+    FIX43_Allocation_OnBehalfOfSubID = 14,
+    FIX43_Allocation_OnBehalfOfLocationID = 15,
+    FIX43_Allocation_DeliverToSubID = 16,
+    FIX43_Allocation_DeliverToLocationID = 17,
+    FIX43_Allocation_PossDupFlag = 18,
+    FIX43_Allocation_PossResend = 19,
+    FIX43_Allocation_SendingTime = 20,
+    FIX43_Allocation_OrigSendingTime = 21,
+    FIX43_Allocation_XmlDataLen = 22,
+    FIX43_Allocation_XmlData = 23,
+    FIX43_Allocation_MessageEncoding = 24,
+    FIX43_Allocation_LastMsgSeqNumProcessed = 25,
+    FIX43_Allocation_OnBehalfOfSendingTime = 26,
+    FIX43_Allocation_NoHops = 27,
+    FIX43_Allocation_AllocID = 28,
+    FIX43_Allocation_AllocTransType = 29,
+    FIX43_Allocation_AllocType = 30,
+    FIX43_Allocation_RefAllocID = 31,
+    FIX43_Allocation_AllocLinkID = 32,
+    FIX43_Allocation_AllocLinkType = 33,
+    FIX43_Allocation_BookingRefID = 34,
+    FIX43_Allocation_NoOrders = 35,
+    FIX43_Allocation_NoExecs = 36,
+    FIX43_Allocation_Side = 37,
+    FIX43_Allocation_Symbol = 38,
+    FIX43_Allocation_SymbolSfx = 39,
+    FIX43_Allocation_SecurityID = 40,
+    FIX43_Allocation_SecurityIDSource = 41,
+    FIX43_Allocation_NoSecurityAltID = 42,
+    FIX43_Allocation_Product = 43,
+    FIX43_Allocation_CFICode = 44,
+    FIX43_Allocation_SecurityType = 45,
+    FIX43_Allocation_MaturityMonthYear = 46,
+    FIX43_Allocation_MaturityDate = 47,
+    FIX43_Allocation_CouponPaymentDate = 48,
+    FIX43_Allocation_IssueDate = 49,
+    FIX43_Allocation_RepoCollateralSecurityType = 50,
+    FIX43_Allocation_RepurchaseTerm = 51,
+    FIX43_Allocation_RepurchaseRate = 52,
+    FIX43_Allocation_Factor = 53,
+    FIX43_Allocation_CreditRating = 54,
+    FIX43_Allocation_InstrRegistry = 55,
+    FIX43_Allocation_CountryOfIssue = 56,
+    FIX43_Allocation_StateOrProvinceOfIssue = 57,
+    FIX43_Allocation_LocaleOfIssue = 58,
+    FIX43_Allocation_RedemptionDate = 59,
+    FIX43_Allocation_StrikePrice = 60,
+    FIX43_Allocation_OptAttribute = 61,
+    FIX43_Allocation_ContractMultiplier = 62,
+    FIX43_Allocation_CouponRate = 63,
+    FIX43_Allocation_SecurityExchange = 64,
+    FIX43_Allocation_Issuer = 65,
+    FIX43_Allocation_EncodedIssuerLen = 66,
+    FIX43_Allocation_EncodedIssuer = 67,
+    FIX43_Allocation_SecurityDesc = 68,
+    FIX43_Allocation_EncodedSecurityDescLen = 69,
+    FIX43_Allocation_EncodedSecurityDesc = 70,
+    FIX43_Allocation_Quantity = 71,
+    FIX43_Allocation_LastMkt = 72,
+    FIX43_Allocation_TradeOriginationDate = 73,
+    FIX43_Allocation_TradingSessionID = 74,
+    FIX43_Allocation_TradingSessionSubID = 75,
+    FIX43_Allocation_PriceType = 76,
+    FIX43_Allocation_AvgPx = 77,
+    FIX43_Allocation_Currency = 78,
+    FIX43_Allocation_AvgPrxPrecision = 79,
+    FIX43_Allocation_NoPartyIDs = 80,
+    FIX43_Allocation_TradeDate = 81,
+    FIX43_Allocation_TransactTime = 82,
+    FIX43_Allocation_SettlmntTyp = 83,
+    FIX43_Allocation_FutSettDate = 84,
+    FIX43_Allocation_GrossTradeAmt = 85,
+    FIX43_Allocation_Concession = 86,
+    FIX43_Allocation_TotalTakedown = 87,
+    FIX43_Allocation_NetMoney = 88,
+    FIX43_Allocation_PositionEffect = 89,
+    FIX43_Allocation_Text = 90,
+    FIX43_Allocation_EncodedTextLen = 91,
+    FIX43_Allocation_EncodedText = 92,
+    FIX43_Allocation_NumDaysInterest = 93,
+    FIX43_Allocation_AccruedInterestRate = 94,
+    FIX43_Allocation_TotalAccruedInterestAmt = 95,
+    FIX43_Allocation_LegalConfirm = 96,
+    FIX43_Allocation_NoAllocs = 97,
+    FIX43_Allocation_SignatureLength = 98,
+    FIX43_Allocation_Signature = 99,
+    FIX43_Allocation_CheckSum = 100,
+};
+
+typedef struct _fix43Allocation {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	AllocID;
+    char	AllocTransType;
+    int64_t	AllocType;
+    struct _ofixStrView	RefAllocID;
+    struct _ofixStrView	AllocLinkID;
+    int64_t	AllocLinkType;
+    struct _ofixStrView	BookingRefID;
+    int64_t	NoOrders;
+    int64_t	NoExecs;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	Quantity;
+    struct _ofixStrView	LastMkt;
+    struct _ofixDate	TradeOriginationDate;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	PriceType;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixStrView	Currency;
+    int64_t	AvgPrxPrecision;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    struct _ofixDecimal	GrossTradeAmt;
+    struct _ofixDecimal	Concession;
+    struct _ofixDecimal	TotalTakedown;
+    struct _ofixDecimal	NetMoney;
+    char	PositionEffect;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NumDaysInterest;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	TotalAccruedInterestAmt;
+    char	LegalConfirm;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Allocation;
+
+extern void	fix43_decode_Allocation(ofixErr err, fix43Allocation m, const char *raw, int len);
+extern void	fix43_decode_Allocation_msg(ofixErr err, fix43Allocation m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Allocation(ofixErr err, fix43Allocation m);
+
+// ListCancelRequest [K]
+enum {
+    FIX43_ListCancelRequest_BeginString = 0,
+    FIX43_ListCancelRequest_BodyLength = 1,
+    FIX43_ListCancelRequest_MsgType = 2,
+    FIX43_ListCancelRequest_SenderCompID = 3,
+    FIX43_ListCancelRequest_TargetCompID = 4,
+    FIX43_ListCancelRequest_OnBehalfOfCompID = 5,
+    FIX43_ListCancelRequest_DeliverToCompID = 6,
+    FIX43_ListCancelRequest_SecureDataLen = 7,
+    FIX43_ListCancelRequest_SecureData = 8,
+    FIX43_ListCancelRequest_MsgSeqNum = 9,
+    FIX43_ListCancelRequest_SenderSubID = 10,
+    FIX43_ListCancelRequest_SenderLocationID = 11,
+    FIX43_ListCancelRequest_TargetSubID = 12,
+    FIX43_ListCancelRequest_TargetLocationID = 13,
+    FIX43_ListCancelRequest_OnBehalfOfSubID = 14,
+    FIX43_ListCancelRequest_OnBehalfOfLocationID = 15,
+    FIX43_ListCancelRequest_DeliverToSubID = 16,
+    FIX43_ListCancelRequest_DeliverToLocationID = 17,
+    FIX43_ListCancelRequest_PossDupFlag = 18,
+    FIX43_ListCancelRequest_PossResend = 19,
+    FIX43_ListCancelRequest_SendingTime = 20,
+    FIX43_ListCancelRequest_OrigSendingTime = 21,
+    FIX43_ListCancelRequest_XmlDataLen = 22,
+    FIX43_ListCancelRequest_XmlData = 23,
+    FIX43_ListCancelRequest_MessageEncoding = 24,
+    FIX43_ListCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_ListCancelRequest_OnBehalfOfSendingTime = 26,
+    FIX43_ListCancelRequest_NoHops = 27,
+    FIX43_ListCancelRequest_ListID = 28,
+    FIX43_ListCancelRequest_TransactTime = 29,
+    FIX43_ListCancelRequest_TradeOriginationDate = 30,
+    FIX43_ListCancelRequest_Text = 31,
+    FIX43_ListCancelRequest_EncodedTextLen = 32,
+    FIX43_ListCancelRequest_EncodedText = 33,
+    FIX43_ListCancelRequest_SignatureLength = 34,
+    FIX43_ListCancelRequest_Signature = 35,
+    FIX43_ListCancelRequest_CheckSum = 36,
+};
+
+typedef struct _fix43ListCancelRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixDate	TransactTime;
+    struct _ofixDate	TradeOriginationDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43ListCancelRequest;
+
+extern void	fix43_decode_ListCancelRequest(ofixErr err, fix43ListCancelRequest m, const char *raw, int len);
+extern void	fix43_decode_ListCancelRequest_msg(ofixErr err, fix43ListCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_ListCancelRequest(ofixErr err, fix43ListCancelRequest m);
+
+// ListExecute [L]
+enum {
+    FIX43_ListExecute_BeginString = 0,
+    FIX43_ListExecute_BodyLength = 1,
+    FIX43_ListExecute_MsgType = 2,
+    FIX43_ListExecute_SenderCompID = 3,
+    FIX43_ListExecute_TargetCompID = 4,
+    FIX43_ListExecute_OnBehalfOfCompID = 5,
+    FIX43_ListExecute_DeliverToCompID = 6,
+    FIX43_ListExecute_SecureDataLen = 7,
+    FIX43_ListExecute_SecureData = 8,
+    FIX43_ListExecute_MsgSeqNum = 9,
+    FIX43_ListExecute_SenderSubID = 10,
+    FIX43_ListExecute_SenderLocationID = 11,
+    FIX43_ListExecute_TargetSubID = 12,
+    FIX43_ListExecute_TargetLocationID = 13,
+    FIX43_ListExecute_OnBehalfOfSubID = 14,
+    FIX43_ListExecute_OnBehalfOfLocationID = 15,
+    FIX43_ListExecute_DeliverToSubID = 16,
+    FIX43_ListExecute_DeliverToLocationID = 17,
+    FIX43_ListExecute_PossDupFlag = 18,
+    FIX43_ListExecute_PossResend = 19,
+    FIX43_ListExecute_SendingTime = 20,
+    FIX43_ListExecute_OrigSendingTime = 21,
+    FIX43_ListExecute_XmlDataLen = 22,
+    FIX43_ListExecute_XmlData = 23,
+    FIX43_ListExecute_MessageEncoding = 24,
+    FIX43_ListExecute_LastMsgSeqNumProcessed = 25,
+    FIX43_ListExecute_OnBehalfOfSendingTime = 26,
+    FIX43_ListExecute_NoHops = 27,
+    FIX43_ListExecute_ListID = 28,
+    FIX43_ListExecute_ClientBidID = 29,
+    FIX43_ListExecute_BidID = 30,
+    FIX43_ListExecute_TransactTime = 31,
+    FIX43_ListExecute_Text = 32,
+    FIX43_ListExecute_EncodedTextLen = 33,
+    FIX43_ListExecute_EncodedText = 34,
+    FIX43_ListExecute_SignatureLength = 35,
+    FIX43_ListExecute_Signature = 36,
+    FIX43_ListExecute_CheckSum = 37,
+};
+
+typedef struct _fix43ListExecute {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	ClientBidID;
+    struct _ofixStrView	BidID;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43ListExecute;
+
+extern void	fix43_decode_ListExecute(ofixErr err, fix43ListExecute m, const char *raw, int len);
+extern void	fix43_decode_ListExecute_msg(ofixErr err, fix43ListExecute m, ofixMsg msg);
+extern ofixMsg	fix43_encode_ListExecute(ofixErr err, fix43ListExecute m);
+
+// ListStatusRequest [M]
+enum {
+    FIX43_ListStatusRequest_BeginString = 0,
+    FIX43_ListStatusRequest_BodyLength = 1,
+    FIX43_ListStatusRequest_MsgType = 2,
+    FIX43_ListStatusRequest_SenderCompID = 3,
+    FIX43_ListStatusRequest_TargetCompID = 4,
+    FIX43_ListStatusRequest_OnBehalfOfCompID = 5,
+    FIX43_ListStatusRequest_DeliverToCompID = 6,
+    FIX43_ListStatusRequest_SecureDataLen = 7,
+    FIX43_ListStatusRequest_SecureData = 8,
+    FIX43_ListStatusRequest_MsgSeqNum = 9,
+    FIX43_ListStatusRequest_SenderSubID = 10,
+    FIX43_ListStatusRequest_SenderLocationID = 11,
+    FIX43_ListStatusRequest_TargetSubID = 12,
+    FIX43_ListStatusRequest_TargetLocationID = 13,
+    FIX43_ListStatusRequest_OnBehalfOfSubID = 14,
+    FIX43_ListStatusRequest_OnBehalfOfLocationID = 15,
+    FIX43_ListStatusRequest_DeliverToSubID = 16,
+    FIX43_ListStatusRequest_DeliverToLocationID = 17,
+    FIX43_ListStatusRequest_PossDupFlag = 18,
+    FIX43_ListStatusRequest_PossResend = 19,
+    FIX43_ListStatusRequest_SendingTime = 20,
+    FIX43_ListStatusRequest_OrigSendingTime = 21,
+    FIX43_ListStatusRequest_XmlDataLen = 22,
+    FIX43_ListStatusRequest_XmlData = 23,
+    FIX43_ListStatusRequest_MessageEncoding = 24,
+    FIX43_ListStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_ListStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX43_ListStatusRequest_NoHops = 27,
+    FIX43_ListStatusRequest_ListID = 28,
+    FIX43_ListStatusRequest_Text = 29,
+    FIX43_ListStatusRequest_EncodedTextLen = 30,
+    FIX43_ListStatusRequest_EncodedText = 31,
+    FIX43_ListStatusRequest_SignatureLength = 32,
+    FIX43_ListStatusRequest_Signature = 33,
+    FIX43_ListStatusRequest_CheckSum = 34,
+};
+
+typedef struct _fix43ListStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43ListStatusRequest;
+
+extern void	fix43_decode_ListStatusRequest(ofixErr err, fix43ListStatusRequest m, const char *raw, int len);
+extern void	fix43_decode_ListStatusRequest_msg(ofixErr err, fix43ListStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_ListStatusRequest(ofixErr err, fix43ListStatusRequest m);
+
+// ListStatus [N]
+enum {
+    FIX43_ListStatus_BeginString = 0,
+    FIX43_ListStatus_BodyLength = 1,
+    FIX43_ListStatus_MsgType = 2,
+    FIX43_ListStatus_SenderCompID = 3,
+    FIX43_ListStatus_TargetCompID = 4,
+    FIX43_ListStatus_OnBehalfOfCompID = 5,
+    FIX43_ListStatus_DeliverToCompID = 6,
+    FIX43_ListStatus_SecureDataLen = 7,
+    FIX43_ListStatus_SecureData = 8,
+    FIX43_ListStatus_MsgSeqNum = 9,
+    FIX43_ListStatus_SenderSubID = 10,
+    FIX43_ListStatus_SenderLocationID = 11,
+    FIX43_ListStatus_TargetSubID = 12,
+    FIX43_ListStatus_TargetLocationID = 13,
+    FIX43_ListStatus_OnBehalfOfSubID = 14,
+    FIX43_ListStatus_OnBehalfOfLocationID = 15,
+    FIX43_ListStatus_DeliverToSubID = 16,
+    FIX43_ListStatus_DeliverToLocationID = 17,
+    FIX43_ListStatus_PossDupFlag = 18,
+    FIX43_ListStatus_PossResend = 19,
+    FIX43_ListStatus_SendingTime = 20,
+    FIX43_ListStatus_OrigSendingTime = 21,
+    FIX43_ListStatus_XmlDataLen = 22,
+    FIX43_ListStatus_XmlData = 23,
+    FIX43_ListStatus_MessageEncoding = 24,
+    FIX43_ListStatus_LastMsgSeqNumProcessed = 25,
+    FIX43_ListStatus_OnBehalfOfSendingTime = 26,
+    FIX43_ListStatus_NoHops = 27,
+    FIX43_ListStatus_ListID = 28,
+    FIX43_ListStatus_ListStatusType = 29,
+    FIX43_ListStatus_NoRpts = 30,
+    FIX43_ListStatus_ListOrderStatus = 31,
+    FIX43_ListStatus_RptSeq = 32,
+    FIX43_ListStatus_ListStatusText = 33,
+    FIX43_ListStatus_EncodedListStatusTextLen = 34,
+    FIX43_ListStatus_EncodedListStatusText = 35,
+    FIX43_ListStatus_TransactTime = 36,
+    FIX43_ListStatus_TotNoOrders = 37,
+    FIX43_ListStatus_NoOrders = 38,
+    FIX43_ListStatus_SignatureLength = 39,
+    FIX43_ListStatus_Signature = 40,
+    FIX43_ListStatus_CheckSum = 41,
+};
+
+typedef struct _fix43ListStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    int64_t	ListStatusType;
+    int64_t	NoRpts;
+    int64_t	ListOrderStatus;
+    int64_t	RptSeq;
+    struct _ofixStrView	ListStatusText;
+    int64_t	EncodedListStatusTextLen;
+    struct _ofixStrView	EncodedListStatusText;
+    struct _ofixDate	TransactTime;
+    int64_t	TotNoOrders;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43ListStatus;
+
+extern void	fix43_decode_ListStatus(ofixErr err, fix43ListStatus m, const char *raw, int len);
+extern void	fix43_decode_ListStatus_msg(ofixErr err, fix43ListStatus m, ofixMsg msg);
+extern ofixMsg	fix43_encode_ListStatus(ofixErr err, fix43ListStatus m);
+
+// AllocationACK [P]
+enum {
+    FIX43_AllocationACK_BeginString = 0,
+    FIX43_AllocationACK_BodyLength = 1,
+    FIX43_AllocationACK_MsgType = 2,
+    FIX43_AllocationACK_SenderCompID = 3,
+    FIX43_AllocationACK_TargetCompID = 4,
+    FIX43_AllocationACK_OnBehalfOfCompID = 5,
+    FIX43_AllocationACK_DeliverToCompID = 6,
+    FIX43_AllocationACK_SecureDataLen = 7,
+    FIX43_AllocationACK_SecureData = 8,
+    FIX43_AllocationACK_MsgSeqNum = 9,
+    FIX43_AllocationACK_SenderSubID = 10,
+    FIX43_AllocationACK_SenderLocationID = 11,
+    FIX43_AllocationACK_TargetSubID = 12,
+    FIX43_AllocationACK_TargetLocationID = 13,
+    FIX43_AllocationACK_OnBehalfOfSubID = 14,
+    FIX43_AllocationACK_OnBehalfOfLocationID = 15,
+    FIX43_AllocationACK_DeliverToSubID = 16,
+    FIX43_AllocationACK_DeliverToLocationID = 17,
+    FIX43_AllocationACK_PossDupFlag = 18,
+    FIX43_AllocationACK_PossResend = 19,
+    FIX43_AllocationACK_SendingTime = 20,
+    FIX43_AllocationACK_OrigSendingTime = 21,
+    FIX43_AllocationACK_XmlDataLen = 22,
+    FIX43_AllocationACK_XmlData = 23,
+    FIX43_AllocationACK_MessageEncoding = 24,
+    FIX43_AllocationACK_LastMsgSeqNumProcessed = 25,
+    FIX43_AllocationACK_OnBehalfOfSendingTime = 26,
+    FIX43_AllocationACK_NoHops = 27,
+    FIX43_AllocationACK_NoPartyIDs = 28,
+    FIX43_AllocationACK_AllocID = 29,
+    FIX43_AllocationACK_TradeDate = 30,
+    FIX43_AllocationACK_TransactTime = 31,
+    FIX43_AllocationACK_AllocStatus = 32,
+    FIX43_AllocationACK_AllocRejCode = 33,
+    FIX43_AllocationACK_Text = 34,
+    FIX43_AllocationACK_EncodedTextLen = 35,
+    FIX43_AllocationACK_EncodedText = 36,
+    FIX43_AllocationACK_LegalConfirm = 37,
+    FIX43_AllocationACK_SignatureLength = 38,
+    FIX43_AllocationACK_Signature = 39,
+    FIX43_AllocationACK_CheckSum = 40,
+};
+
+typedef struct _fix43AllocationACK {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    int64_t	AllocStatus;
+    int64_t	AllocRejCode;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    char	LegalConfirm;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43AllocationACK;
+
+extern void	fix43_decode_AllocationACK(ofixErr err, fix43AllocationACK m, const char *raw, int len);
+extern void	fix43_decode_AllocationACK_msg(ofixErr err, fix43AllocationACK m, ofixMsg msg);
+extern ofixMsg	fix43_encode_AllocationACK(ofixErr err, fix43AllocationACK m);
+
+// DontKnowTrade [Q]
+enum {
+    FIX43_DontKnowTrade_BeginString = 0,
+    FIX43_DontKnowTrade_BodyLength = 1,
+    FIX43_DontKnowTrade_MsgType = 2,
+    FIX43_DontKnowTrade_SenderCompID = 3,
+    FIX43_DontKnowTrade_TargetCompID = 4,
+    FIX43_DontKnowTrade_OnBehalfOfCompID = 5,
+    FIX43_DontKnowTrade_DeliverToCompID = 6,
+    FIX43_DontKnowTrade_SecureDataLen = 7,
+    FIX43_DontKnowTrade_SecureData = 8,
+    FIX43_DontKnowTrade_MsgSeqNum = 9,
+    FIX43_DontKnowTrade_SenderSubID = 10,
+    FIX43_DontKnowTrade_SenderLocationID = 11,
+    FIX43_DontKnowTrade_TargetSubID = 12,
+    FIX43_DontKnowTrade_TargetLocationID = 13,
+    FIX43_DontKnowTrade_OnBehalfOfSubID = 14,
+    FIX43_DontKnowTrade_OnBehalfOfLocationID = 15,
+    FIX43_DontKnowTrade_DeliverToSubID = 16,
+    FIX43_DontKnowTrade_DeliverToLocationID = 17,
+    FIX43_DontKnowTrade_PossDupFlag = 18,
+    FIX43_DontKnowTrade_PossResend = 19,
+    FIX43_DontKnowTrade_SendingTime = 20,
+    FIX43_DontKnowTrade_OrigSendingTime = 21,
+    FIX43_DontKnowTrade_XmlDataLen = 22,
+    FIX43_DontKnowTrade_XmlData = 23,
+    FIX43_DontKnowTrade_MessageEncoding = 24,
+    FIX43_DontKnowTrade_LastMsgSeqNumProcessed = 25,
+    FIX43_DontKnowTrade_OnBehalfOfSendingTime = 26,
+    FIX43_DontKnowTrade_NoHops = 27,
+    FIX43_DontKnowTrade_OrderID = 28,
+    FIX43_DontKnowTrade_ExecID = 29,
+    FIX43_DontKnowTrade_DKReason = 30,
+    FIX43_DontKnowTrade_Symbol = 31,
+    FIX43_DontKnowTrade_SymbolSfx = 32,
+    FIX43_DontKnowTrade_SecurityID = 33,
+    FIX43_DontKnowTrade_SecurityIDSource = 34,
+    FIX43_DontKnowTrade_NoSecurityAltID = 35,
+    FIX43_DontKnowTrade_Product = 36,
+    FIX43_DontKnowTrade_CFICode = 37,
+    FIX43_DontKnowTrade_SecurityType = 38,
+    FIX43_DontKnowTrade_MaturityMonthYear = 39,
+    FIX43_DontKnowTrade_MaturityDate = 40,
+    FIX43_DontKnowTrade_CouponPaymentDate = 41,
+    FIX43_DontKnowTrade_IssueDate = 42,
+    FIX43_DontKnowTrade_RepoCollateralSecurityType = 43,
+    FIX43_DontKnowTrade_RepurchaseTerm = 44,
+    FIX43_DontKnowTrade_RepurchaseRate = 45,
+    FIX43_DontKnowTrade_Factor = 46,
+    FIX43_DontKnowTrade_CreditRating = 47,
+    FIX43_DontKnowTrade_InstrRegistry = 48,
+    FIX43_DontKnowTrade_CountryOfIssue = 49,
+    FIX43_DontKnowTrade_StateOrProvinceOfIssue = 50,
+    FIX43_DontKnowTrade_LocaleOfIssue = 51,
+    FIX43_DontKnowTrade_RedemptionDate = 52,
+    FIX43_DontKnowTrade_StrikePrice = 53,
+    FIX43_DontKnowTrade_OptAttribute = 54,
+    FIX43_DontKnowTrade_ContractMultiplier = 55,
+    FIX43_DontKnowTrade_CouponRate = 56,
+    FIX43_DontKnowTrade_SecurityExchange = 57,
+    FIX43_DontKnowTrade_Issuer = 58,
+    FIX43_DontKnowTrade_EncodedIssuerLen = 59,
+    FIX43_DontKnowTrade_EncodedIssuer = 60,
+    FIX43_DontKnowTrade_SecurityDesc = 61,
+    FIX43_DontKnowTrade_EncodedSecurityDescLen = 62,
+    FIX43_DontKnowTrade_EncodedSecurityDesc = 63,
+    FIX43_DontKnowTrade_Side = 64,
+    FIX43_DontKnowTrade_OrderQty = 65,
+    FIX43_DontKnowTrade_CashOrderQty = 66,
+    FIX43_DontKnowTrade_OrderPercent = 67,
+    FIX43_DontKnowTrade_RoundingDirection = 68,
+    FIX43_DontKnowTrade_RoundingModulus = 69,
+    FIX43_DontKnowTrade_LastQty = 70,
+    FIX43_DontKnowTrade_LastPx = 71,
+    FIX43_DontKnowTrade_Text = 72,
+    FIX43_DontKnowTrade_EncodedTextLen = 73,
+    FIX43_DontKnowTrade_EncodedText = 74,
+    FIX43_DontKnowTrade_SignatureLength = 75,
+    FIX43_DontKnowTrade_Signature = 76,
+    FIX43_DontKnowTrade_CheckSum = 77,
+};
+
+typedef struct _fix43DontKnowTrade {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ExecID;
+    char	DKReason;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	Side;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    struct _ofixDecimal	LastQty;
+    struct _ofixDecimal	LastPx;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43DontKnowTrade;
+
+extern void	fix43_decode_DontKnowTrade(ofixErr err, fix43DontKnowTrade m, const char *raw, int len);
+extern void	fix43_decode_DontKnowTrade_msg(ofixErr err, fix43DontKnowTrade m, ofixMsg msg);
+extern ofixMsg	fix43_encode_DontKnowTrade(ofixErr err, fix43DontKnowTrade m);
+
+// QuoteRequest [R]
+enum {
+    FIX43_QuoteRequest_BeginString = 0,
+    FIX43_QuoteRequest_BodyLength = 1,
+    FIX43_QuoteRequest_MsgType = 2,
+    FIX43_QuoteRequest_SenderCompID = 3,
+    FIX43_QuoteRequest_TargetCompID = 4,
+    FIX43_QuoteRequest_OnBehalfOfCompID = 5,
+    FIX43_QuoteRequest_DeliverToCompID = 6,
+    FIX43_QuoteRequest_SecureDataLen = 7,
+    FIX43_QuoteRequest_SecureData = 8,
+    FIX43_QuoteRequest_MsgSeqNum = 9,
+    FIX43_QuoteRequest_SenderSubID = 10,
+    FIX43_QuoteRequest_SenderLocationID = 11,
+    FIX43_QuoteRequest_TargetSubID = 12,
+    FIX43_QuoteRequest_TargetLocationID = 13,
+    FIX43_QuoteRequest_OnBehalfOfSubID = 14,
+    FIX43_QuoteRequest_OnBehalfOfLocationID = 15,
+    FIX43_QuoteRequest_DeliverToSubID = 16,
+    FIX43_QuoteRequest_DeliverToLocationID = 17,
+    FIX43_QuoteRequest_PossDupFlag = 18,
+    FIX43_QuoteRequest_PossResend = 19,
+    FIX43_QuoteRequest_SendingTime = 20,
+    FIX43_QuoteRequest_OrigSendingTime = 21,
+    FIX43_QuoteRequest_XmlDataLen = 22,
+    FIX43_QuoteRequest_XmlData = 23,
+    FIX43_QuoteRequest_MessageEncoding = 24,
+    FIX43_QuoteRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_QuoteRequest_OnBehalfOfSendingTime = 26,
+    FIX43_QuoteRequest_NoHops = 27,
+    FIX43_QuoteRequest_QuoteReqID = 28,
+    FIX43_QuoteRequest_RFQReqID = 29,
+    FIX43_QuoteRequest_NoRelatedSym = 30,
+    FIX43_QuoteRequest_Text = 31,
+    FIX43_QuoteRequest_EncodedTextLen = 32,
+    FIX43_QuoteRequest_EncodedText = 33,
+    FIX43_QuoteRequest_SignatureLength = 34,
+    FIX43_QuoteRequest_Signature = 35,
+    FIX43_QuoteRequest_CheckSum = 36,
+};
+
+typedef struct _fix43QuoteRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	RFQReqID;
+    int64_t	NoRelatedSym;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43QuoteRequest;
+
+extern void	fix43_decode_QuoteRequest(ofixErr err, fix43QuoteRequest m, const char *raw, int len);
+extern void	fix43_decode_QuoteRequest_msg(ofixErr err, fix43QuoteRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_QuoteRequest(ofixErr err, fix43QuoteRequest m);
+
+// Quote [S]
+enum {
+    FIX43_Quote_BeginString = 0,
+    FIX43_Quote_BodyLength = 1,
+    FIX43_Quote_MsgType = 2,
+    FIX43_Quote_SenderCompID = 3,
+    FIX43_Quote_TargetCompID = 4,
+    FIX43_Quote_OnBehalfOfCompID = 5,
+    FIX43_Quote_DeliverToCompID = 6,
+    FIX43_Quote_SecureDataLen = 7,
+    FIX43_Quote_SecureData = 8,
+    FIX43_Quote_MsgSeqNum = 9,
+    FIX43_Quote_SenderSubID = 10,
+    FIX43_Quote_SenderLocationID = 11,
+    FIX43_Quote_TargetSubID = 12,
+    FIX43_Quote_TargetLocationID = 13,
+    FIX43_Quote_OnBehalfOfSubID = 14,
+    FIX43_Quote_OnBehalfOfLocationID = 15,
+    FIX43_Quote_DeliverToSubID = 16,
+    FIX43_Quote_DeliverToLocationID = 17,
+    FIX43_Quote_PossDupFlag = 18,
+    FIX43_Quote_PossResend = 19,
+    FIX43_Quote_SendingTime = 20,
+    FIX43_Quote_OrigSendingTime = 21,
+    FIX43_Quote_XmlDataLen = 22,
+    FIX43_Quote_XmlData = 23,
+    FIX43_Quote_MessageEncoding = 24,
+    FIX43_Quote_LastMsgSeqNumProcessed = 25,
+    FIX43_Quote_OnBehalfOfSendingTime = 26,
+    FIX43_Quote_NoHops = 27,
+    FIX43_Quote_QuoteReqID = 28,
+    FIX43_Quote_QuoteID = 29,
+    FIX43_Quote_QuoteType = 30,
+    FIX43_Quote_QuoteResponseLevel = 31,
+    FIX43_Quote_NoPartyIDs = 32,
+    FIX43_Quote_Account = 33,
+    FIX43_Quote_AccountType = 34,
+    FIX43_Quote_TradingSessionID = 35,
+    FIX43_Quote_TradingSessionSubID = 36,
+    FIX43_Quote_Symbol = 37,
+    FIX43_Quote_SymbolSfx = 38,
+    FIX43_Quote_SecurityID = 39,
+    FIX43_Quote_SecurityIDSource = 40,
+    FIX43_Quote_NoSecurityAltID = 41,
+    FIX43_Quote_Product = 42,
+    FIX43_Quote_CFICode = 43,
+    FIX43_Quote_SecurityType = 44,
+    FIX43_Quote_MaturityMonthYear = 45,
+    FIX43_Quote_MaturityDate = 46,
+    FIX43_Quote_CouponPaymentDate = 47,
+    FIX43_Quote_IssueDate = 48,
+    FIX43_Quote_RepoCollateralSecurityType = 49,
+    FIX43_Quote_RepurchaseTerm = 50,
+    FIX43_Quote_RepurchaseRate = 51,
+    FIX43_Quote_Factor = 52,
+    FIX43_Quote_CreditRating = 53,
+    FIX43_Quote_InstrRegistry = 54,
+    FIX43_Quote_CountryOfIssue = 55,
+    FIX43_Quote_StateOrProvinceOfIssue = 56,
+    FIX43_Quote_LocaleOfIssue = 57,
+    FIX43_Quote_RedemptionDate = 58,
+    FIX43_Quote_StrikePrice = 59,
+    FIX43_Quote_OptAttribute = 60,
+    FIX43_Quote_ContractMultiplier = 61,
+    FIX43_Quote_CouponRate = 62,
+    FIX43_Quote_SecurityExchange = 63,
+    FIX43_Quote_Issuer = 64,
+    FIX43_Quote_EncodedIssuerLen = 65,
+    FIX43_Quote_EncodedIssuer = 66,
+    FIX43_Quote_SecurityDesc = 67,
+    FIX43_Quote_EncodedSecurityDescLen = 68,
+    FIX43_Quote_EncodedSecurityDesc = 69,
+    FIX43_Quote_BidPx = 70,
+    FIX43_Quote_OfferPx = 71,
+    FIX43_Quote_MktBidPx = 72,
+    FIX43_Quote_MktOfferPx = 73,
+    FIX43_Quote_MinBidSize = 74,
+    FIX43_Quote_BidSize = 75,
+    FIX43_Quote_MinOfferSize = 76,
+    FIX43_Quote_OfferSize = 77,
+    FIX43_Quote_ValidUntilTime = 78,
+    FIX43_Quote_BidSpotRate = 79,
+    FIX43_Quote_OfferSpotRate = 80,
+    FIX43_Quote_BidForwardPoints = 81,
+    FIX43_Quote_OfferForwardPoints = 82,
+    FIX43_Quote_MidPx = 83,
+    FIX43_Quote_BidYield = 84,
+    FIX43_Quote_MidYield = 85,
+    FIX43_Quote_OfferYield = 86,
+    FIX43_Quote_TransactTime = 87,
+    FIX43_Quote_SettlmntTyp = 88,
+    FIX43_Quote_FutSettDate = 89,
+    FIX43_Quote_OrdType = 90,
+    FIX43_Quote_FutSettDate2 = 91,
+    FIX43_Quote_OrderQty2 = 92,
+    FIX43_Quote_BidForwardPoints2 = 93,
+    FIX43_Quote_OfferForwardPoints2 = 94,
+    FIX43_Quote_Currency = 95,
+    FIX43_Quote_SettlCurrBidFxRate = 96,
+    FIX43_Quote_SettlCurrOfferFxRate = 97,
+    FIX43_Quote_SettlCurrFxRateCalc = 98,
+    FIX43_Quote_CommType = 99,
+    FIX43_Quote_Commission = 100,
+    FIX43_Quote_CustOrderCapacity = 101,
+    FIX43_Quote_ExDestination = 102,
+    FIX43_Quote_Text = 103,
+    FIX43_Quote_EncodedTextLen = 104,
+    FIX43_Quote_EncodedText = 105,
+    FIX43_Quote_SignatureLength = 106,
+    FIX43_Quote_Signature = 107,
+    FIX43_Quote_CheckSum = 108,
+};
+
+typedef struct _fix43Quote {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteType;
+    int64_t	QuoteResponseLevel;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    struct _ofixDecimal	MktBidPx;
+    struct _ofixDecimal	MktOfferPx;
+    struct _ofixDecimal	MinBidSize;
+    struct _ofixDecimal	BidSize;
+    struct _ofixDecimal	MinOfferSize;
+    struct _ofixDecimal	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixDecimal	BidSpotRate;
+    struct _ofixDecimal	OfferSpotRate;
+    struct _ofixDecimal	BidForwardPoints;
+    struct _ofixDecimal	OfferForwardPoints;
+    struct _ofixDecimal	MidPx;
+    struct _ofixDecimal	BidYield;
+    struct _ofixDecimal	MidYield;
+    struct _ofixDecimal	OfferYield;
+    struct _ofixDate	TransactTime;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	OrdType;
+    struct _ofixStrView	FutSettDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	BidForwardPoints2;
+    struct _ofixDecimal	OfferForwardPoints2;
+    struct _ofixStrView	Currency;
+    struct _ofixDecimal	SettlCurrBidFxRate;
+    struct _ofixDecimal	SettlCurrOfferFxRate;
+    char	SettlCurrFxRateCalc;
+    char	CommType;
+    struct _ofixDecimal	Commission;
+    int64_t	CustOrderCapacity;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43Quote;
+
+extern void	fix43_decode_Quote(ofixErr err, fix43Quote m, const char *raw, int len);
+extern void	fix43_decode_Quote_msg(ofixErr err, fix43Quote m, ofixMsg msg);
+extern ofixMsg	fix43_encode_Quote(ofixErr err, fix43Quote m);
+
+// SettlementInstructions [T]
+enum {
+    FIX43_SettlementInstructions_BeginString = 0,
+    FIX43_SettlementInstructions_BodyLength = 1,
+    FIX43_SettlementInstructions_MsgType = 2,
+    FIX43_SettlementInstructions_SenderCompID = 3,
+    FIX43_SettlementInstructions_TargetCompID = 4,
+    FIX43_SettlementInstructions_OnBehalfOfCompID = 5,
+    FIX43_SettlementInstructions_DeliverToCompID = 6,
+    FIX43_SettlementInstructions_SecureDataLen = 7,
+    FIX43_SettlementInstructions_SecureData = 8,
+    FIX43_SettlementInstructions_MsgSeqNum = 9,
+    FIX43_SettlementInstructions_SenderSubID = 10,
+    FIX43_SettlementInstructions_SenderLocationID = 11,
+    FIX43_SettlementInstructions_TargetSubID = 12,
+    FIX43_SettlementInstructions_TargetLocationID = 13,
+    FIX43_SettlementInstructions_OnBehalfOfSubID = 14,
+    FIX43_SettlementInstructions_OnBehalfOfLocationID = 15,
+    FIX43_SettlementInstructions_DeliverToSubID = 16,
+    FIX43_SettlementInstructions_DeliverToLocationID = 17,
+    FIX43_SettlementInstructions_PossDupFlag = 18,
+    FIX43_SettlementInstructions_PossResend = 19,
+    FIX43_SettlementInstructions_SendingTime = 20,
+    FIX43_SettlementInstructions_OrigSendingTime = 21,
+    FIX43_SettlementInstructions_XmlDataLen = 22,
+    FIX43_SettlementInstructions_XmlData = 23,
+    FIX43_SettlementInstructions_MessageEncoding = 24,
+    FIX43_SettlementInstructions_LastMsgSeqNumProcessed = 25,
+    FIX43_SettlementInstructions_OnBehalfOfSendingTime = 26,
+    FIX43_SettlementInstructions_NoHops = 27,
+    FIX43_SettlementInstructions_SettlInstID = 28,
+    FIX43_SettlementInstructions_SettlInstTransType = 29,
+    FIX43_SettlementInstructions_SettlInstRefID = 30,
+    FIX43_SettlementInstructions_SettlInstMode = 31,
+    FIX43_SettlementInstructions_SettlInstSource = 32,
+    FIX43_SettlementInstructions_AllocAccount = 33,
+    FIX43_SettlementInstructions_IndividualAllocID = 34,
+    FIX43_SettlementInstructions_ClOrdID = 35,
+    FIX43_SettlementInstructions_TradeDate = 36,
+    FIX43_SettlementInstructions_AllocID = 37,
+    FIX43_SettlementInstructions_LastMkt = 38,
+    FIX43_SettlementInstructions_TradingSessionID = 39,
+    FIX43_SettlementInstructions_TradingSessionSubID = 40,
+    FIX43_SettlementInstructions_Side = 41,
+    FIX43_SettlementInstructions_SecurityType = 42,
+    FIX43_SettlementInstructions_EffectiveTime = 43,
+    FIX43_SettlementInstructions_TransactTime = 44,
+    FIX43_SettlementInstructions_NoPartyIDs = 45,
+    FIX43_SettlementInstructions_StandInstDbType = 46,
+    FIX43_SettlementInstructions_StandInstDbName = 47,
+    FIX43_SettlementInstructions_StandInstDbID = 48,
+    FIX43_SettlementInstructions_SettlDeliveryType = 49,
+    FIX43_SettlementInstructions_SettlDepositoryCode = 50,
+    FIX43_SettlementInstructions_SettlBrkrCode = 51,
+    FIX43_SettlementInstructions_SettlInstCode = 52,
+    FIX43_SettlementInstructions_SecuritySettlAgentName = 53,
+    FIX43_SettlementInstructions_SecuritySettlAgentCode = 54,
+    FIX43_SettlementInstructions_SecuritySettlAgentAcctNum = 55,
+    FIX43_SettlementInstructions_SecuritySettlAgentAcctName = 56,
+    FIX43_SettlementInstructions_SecuritySettlAgentContactName = 57,
+    FIX43_SettlementInstructions_SecuritySettlAgentContactPhone = 58,
+    FIX43_SettlementInstructions_CashSettlAgentName = 59,
+    FIX43_SettlementInstructions_CashSettlAgentCode = 60,
+    FIX43_SettlementInstructions_CashSettlAgentAcctNum = 61,
+    FIX43_SettlementInstructions_CashSettlAgentAcctName = 62,
+    FIX43_SettlementInstructions_CashSettlAgentContactName = 63,
+    FIX43_SettlementInstructions_CashSettlAgentContactPhone = 64,
+    FIX43_SettlementInstructions_PaymentMethod = 65,
+    FIX43_SettlementInstructions_PaymentRef = 66,
+    FIX43_SettlementInstructions_CardHolderName = 67,
+    FIX43_SettlementInstructions_CardNumber = 68,
+    FIX43_SettlementInstructions_CardStartDate = 69,
+    FIX43_SettlementInstructions_CardExpDate = 70,
+    FIX43_SettlementInstructions_CardIssNo = 71,
+    FIX43_SettlementInstructions_PaymentDate = 72,
+    FIX43_SettlementInstructions_PaymentRemitterID = 73,
+    FIX43_SettlementInstructions_SignatureLength = 74,
+    FIX43_SettlementInstructions_Signature = 75,
+    FIX43_SettlementInstructions_CheckSum = 76,
+};
+
+typedef struct _fix43SettlementInstructions {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SettlInstID;
+    char	SettlInstTransType;
+    struct _ofixStrView	SettlInstRefID;
+    char	SettlInstMode;
+    char	SettlInstSource;
+    struct _ofixStrView	AllocAccount;
+    struct _ofixStrView	IndividualAllocID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	Side;
+    struct _ofixStrView	SecurityType;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixDate	TransactTime;
+    int64_t	NoPartyIDs;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	SettlDeliveryType;
+    struct _ofixStrView	SettlDepositoryCode;
+    struct _ofixStrView	SettlBrkrCode;
+    struct _ofixStrView	SettlInstCode;
+    struct _ofixStrView	SecuritySettlAgentName;
+    struct _ofixStrView	SecuritySettlAgentCode;
+    struct _ofixStrView	SecuritySettlAgentAcctNum;
+    struct _ofixStrView	SecuritySettlAgentAcctName;
+    struct _ofixStrView	SecuritySettlAgentContactName;
+    struct _ofixStrView	SecuritySettlAgentContactPhone;
+    struct _ofixStrView	CashSettlAgentName;
+    struct _ofixStrView	CashSettlAgentCode;
+    struct _ofixStrView	CashSettlAgentAcctNum;
+    struct _ofixStrView	CashSettlAgentAcctName;
+    struct _ofixStrView	CashSettlAgentContactName;
+    struct _ofixStrView	CashSettlAgentContactPhone;
+    int64_t	PaymentMethod;
+    struct _ofixStrView	PaymentRef;
+    struct _ofixStrView	CardHolderName;
+    struct _ofixStrView	CardNumber;
+    struct _ofixStrView	CardStartDate;
+    struct _ofixStrView	CardExpDate;
+    struct _ofixStrView	CardIssNo;
+    struct _ofixStrView	PaymentDate;
+    struct _ofixStrView	PaymentRemitterID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SettlementInstructions;
+
+extern void	fix43_decode_SettlementInstructions(ofixErr err, fix43SettlementInstructions m, const char *raw, int len);
+extern void	fix43_decode_SettlementInstructions_msg(ofixErr err, fix43SettlementInstructions m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SettlementInstructions(ofixErr err, fix43SettlementInstructions m);
+
+// MarketDataRequest [V]
+enum {
+    FIX43_MarketDataRequest_BeginString = 0,
+    FIX43_MarketDataRequest_BodyLength = 1,
+    FIX43_MarketDataRequest_MsgType = 2,
+    FIX43_MarketDataRequest_SenderCompID = 3,
+    FIX43_MarketDataRequest_TargetCompID = 4,
+    FIX43_MarketDataRequest_OnBehalfOfCompID = 5,
+    FIX43_MarketDataRequest_DeliverToCompID = 6,
+    FIX43_MarketDataRequest_SecureDataLen = 7,
+    FIX43_MarketDataRequest_SecureData = 8,
+    FIX43_MarketDataRequest_MsgSeqNum = 9,
+    FIX43_MarketDataRequest_SenderSubID = 10,
+    FIX43_MarketDataRequest_SenderLocationID = 11,
+    FIX43_MarketDataRequest_TargetSubID = 12,
+    FIX43_MarketDataRequest_TargetLocationID = 13,
+    FIX43_MarketDataRequest_OnBehalfOfSubID = 14,
+    FIX43_MarketDataRequest_OnBehalfOfLocationID = 15,
+    FIX43_MarketDataRequest_DeliverToSubID = 16,
+    FIX43_MarketDataRequest_DeliverToLocationID = 17,
+    FIX43_MarketDataRequest_PossDupFlag = 18,
+    FIX43_MarketDataRequest_PossResend = 19,
+    FIX43_MarketDataRequest_SendingTime = 20,
+    FIX43_MarketDataRequest_OrigSendingTime = 21,
+    FIX43_MarketDataRequest_XmlDataLen = 22,
+    FIX43_MarketDataRequest_XmlData = 23,
+    FIX43_MarketDataRequest_MessageEncoding = 24,
+    FIX43_MarketDataRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_MarketDataRequest_OnBehalfOfSendingTime = 26,
+    FIX43_MarketDataRequest_NoHops = 27,
+    FIX43_MarketDataRequest_MDReqID = 28,
+    FIX43_MarketDataRequest_SubscriptionRequestType = 29,
+    FIX43_MarketDataRequest_MarketDepth = 30,
+    FIX43_MarketDataRequest_MDUpdateType = 31,
+    FIX43_MarketDataRequest_AggregatedBook = 32,
+    FIX43_MarketDataRequest_OpenCloseSettleFlag = 33,
+    FIX43_MarketDataRequest_Scope = 34,
+    FIX43_MarketDataRequest_MDImplicitDelete = 35,
+    FIX43_MarketDataRequest_NoMDEntryTypes = 36,
+    FIX43_MarketDataRequest_NoRelatedSym = 37,
+    FIX43_MarketDataRequest_NoTradingSessions = 38,
+    FIX43_MarketDataRequest_SignatureLength = 39,
+    FIX43_MarketDataRequest_Signature = 40,
+    FIX43_MarketDataRequest_CheckSum = 41,
+};
+
+typedef struct _fix43MarketDataRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    char	SubscriptionRequestType;
+    int64_t	MarketDepth;
+    int64_t	MDUpdateType;
+    char	AggregatedBook;
+    struct _ofixStrView	OpenCloseSettleFlag;
+    struct _ofixStrView	Scope;
+    char	MDImplicitDelete;
+    int64_t	NoMDEntryTypes;
+    int64_t	NoRelatedSym;
+    int64_t	NoTradingSessions;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43MarketDataRequest;
+
+extern void	fix43_decode_MarketDataRequest(ofixErr err, fix43MarketDataRequest m, const char *raw, int len);
+extern void	fix43_decode_MarketDataRequest_msg(ofixErr err, fix43MarketDataRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_MarketDataRequest(ofixErr err, fix43MarketDataRequest m);
+
+// MarketDataSnapshotFullRefresh [W]
+enum {
+    FIX43_MarketDataSnapshotFullRefresh_BeginString = 0,
+    FIX43_MarketDataSnapshotFullRefresh_BodyLength = 1,
+    FIX43_MarketDataSnapshotFullRefresh_MsgType = 2,
+    FIX43_MarketDataSnapshotFullRefresh_SenderCompID = 3,
+    FIX43_MarketDataSnapshotFullRefresh_TargetCompID = 4,
+    FIX43_MarketDataSnapshotFullRefresh_OnBehalfOfCompID = 5,
+    FIX43_MarketDataSnapshotFullRefresh_DeliverToCompID = 6,
+    FIX43_MarketDataSnapshotFullRefresh_SecureDataLen = 7,
+    FIX43_MarketDataSnapshotFullRefresh_SecureData = 8,
+    FIX43_MarketDataSnapshotFullRefresh_MsgSeqNum = 9,
+    FIX43_MarketDataSnapshotFullRefresh_SenderSubID = 10,
+    FIX43_MarketDataSnapshotFullRefresh_SenderLocationID = 11,
+    FIX43_MarketDataSnapshotFullRefresh_TargetSubID = 12,
+    FIX43_MarketDataSnapshotFullRefresh_TargetLocationID = 13,
+    FIX43_MarketDataSnapshotFullRefresh_OnBehalfOfSubID = 14,
+    FIX43_MarketDataSnapshotFullRefresh_OnBehalfOfLocationID = 15,
+    FIX43_MarketDataSnapshotFullRefresh_DeliverToSubID = 16,
+    FIX43_MarketDataSnapshotFullRefresh_DeliverToLocationID = 17,
+    FIX43_MarketDataSnapshotFullRefresh_PossDupFlag = 18,
+    FIX43_MarketDataSnapshotFullRefresh_PossResend = 19,
+    FIX43_MarketDataSnapshotFullRefresh_SendingTime = 20,
+    FIX43_MarketDataSnapshotFullRefresh_OrigSendingTime = 21,
+    FIX43_MarketDataSnapshotFullRefresh_XmlDataLen = 22,
+    FIX43_MarketDataSnapshotFullRefresh_XmlData = 23,
+    FIX43_MarketDataSnapshotFullRefresh_MessageEncoding = 24,
+    FIX43_MarketDataSnapshotFullRefresh_LastMsgSeqNumProcessed = 25,
+    FIX43_MarketDataSnapshotFullRefresh_OnBehalfOfSendingTime = 26,
+    FIX43_MarketDataSnapshotFullRefresh_NoHops = 27,
+    FIX43_MarketDataSnapshotFullRefresh_MDReqID = 28,
+    FIX43_MarketDataSnapshotFullRefresh_Symbol = 29,
+    FIX43_MarketDataSnapshotFullRefresh_SymbolSfx = 30,
+    FIX43_MarketDataSnapshotFullRefresh_SecurityID = 31,
+    FIX43_MarketDataSnapshotFullRefresh_SecurityIDSource = 32,
+    FIX43_MarketDataSnapshotFullRefresh_NoSecurityAltID = 33,
+    FIX43_MarketDataSnapshotFullRefresh_Product = 34,
+    FIX43_MarketDataSnapshotFullRefresh_CFICode = 35,
+    FIX43_MarketDataSnapshotFullRefresh_SecurityType = 36,
+    FIX43_MarketDataSnapshotFullRefresh_MaturityMonthYear = 37,
+    FIX43_MarketDataSnapshotFullRefresh_MaturityDate = 38,
+    FIX43_MarketDataSnapshotFullRefresh_CouponPaymentDate = 39,
+    FIX43_MarketDataSnapshotFullRefresh_IssueDate = 40,
+    FIX43_MarketDataSnapshotFullRefresh_RepoCollateralSecurityType = 41,
+    FIX43_MarketDataSnapshotFullRefresh_RepurchaseTerm = 42,
+    FIX43_MarketDataSnapshotFullRefresh_RepurchaseRate = 43,
+    FIX43_MarketDataSnapshotFullRefresh_Factor = 44,
+    FIX43_MarketDataSnapshotFullRefresh_CreditRating = 45,
+    FIX43_MarketDataSnapshotFullRefresh_InstrRegistry = 46,
+    FIX43_MarketDataSnapshotFullRefresh_CountryOfIssue = 47,
+    FIX43_MarketDataSnapshotFullRefresh_StateOrProvinceOfIssue = 48,
+    FIX43_MarketDataSnapshotFullRefresh_LocaleOfIssue = 49,
+    FIX43_MarketDataSnapshotFullRefresh_RedemptionDate = 50,
+    FIX43_MarketDataSnapshotFullRefresh_StrikePrice = 51,
+    FIX43_MarketDataSnapshotFullRefresh_OptAttribute = 52,
+    FIX43_MarketDataSnapshotFullRefresh_ContractMultiplier = 53,
+    FIX43_MarketDataSnapshotFullRefresh_CouponRate = 54,
+    FIX43_MarketDataSnapshotFullRefresh_SecurityExchange = 55,
+    FIX43_MarketDataSnapshotFullRefresh_Issuer = 56,
+    FIX43_MarketDataSnapshotFullRefresh_EncodedIssuerLen = 57,
+    FIX43_MarketDataSnapshotFullRefresh_EncodedIssuer = 58,
+    FIX43_MarketDataSnapshotFullRefresh_SecurityDesc = 59,
+    FIX43_MarketDataSnapshotFullRefresh_EncodedSecurityDescLen = 60,
+    FIX43_MarketDataSnapshotFullRefresh_EncodedSecurityDesc = 61,
+    FIX43_MarketDataSnapshotFullRefresh_FinancialStatus = 62,
+    FIX43_MarketDataSnapshotFullRefresh_CorporateAction = 63,
+    FIX43_MarketDataSnapshotFullRefresh_TotalVolumeTraded = 64,
+    FIX43_MarketDataSnapshotFullRefresh_TotalVolumeTradedDate = 65,
+    FIX43_MarketDataSnapshotFullRefresh_TotalVolumeTradedTime = 66,
+    FIX43_MarketDataSnapshotFullRefresh_NetChgPrevDay = 67,
+    FIX43_MarketDataSnapshotFullRefresh_NoMDEntries = 68,
+    FIX43_MarketDataSnapshotFullRefresh_SignatureLength = 69,
+    FIX43_MarketDataSnapshotFullRefresh_Signature = 70,
+    FIX43_MarketDataSnapshotFullRefresh_CheckSum = 71,
+};
+
+typedef struct _fix43MarketDataSnapshotFullRefresh {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	FinancialStatus;
+    struct _ofixStrView	CorporateAction;
+    struct _ofixDecimal	TotalVolumeTraded;
+    struct _ofixDate	TotalVolumeTradedDate;
+    struct _ofixDate	TotalVolumeTradedTime;
+    struct _ofixDecimal	NetChgPrevDay;
+    int64_t	NoMDEntries;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43MarketDataSnapshotFullRefresh;
+
+extern void	fix43_decode_MarketDataSnapshotFullRefresh(ofixErr err, fix43MarketDataSnapshotFullRefresh m, const char *raw, int len);
+extern void	fix43_decode_MarketDataSnapshotFullRefresh_msg(ofixErr err, fix43MarketDataSnapshotFullRefresh m, ofixMsg msg);
+extern ofixMsg	fix43_encode_MarketDataSnapshotFullRefresh(ofixErr err, fix43MarketDataSnapshotFullRefresh m);
+
+// MarketDataIncrementalRefresh [X]
+enum {
+    FIX43_MarketDataIncrementalRefresh_BeginString = 0,
+    FIX43_MarketDataIncrementalRefresh_BodyLength = 1,
+    FIX43_MarketDataIncrementalRefresh_MsgType = 2,
+    FIX43_MarketDataIncrementalRefresh_SenderCompID = 3,
+    FIX43_MarketDataIncrementalRefresh_TargetCompID = 4,
+    FIX43_MarketDataIncrementalRefresh_OnBehalfOfCompID = 5,
+    FIX43_MarketDataIncrementalRefresh_DeliverToCompID = 6,
+    FIX43_MarketDataIncrementalRefresh_SecureDataLen = 7,
+    FIX43_MarketDataIncrementalRefresh_SecureData = 8,
+    FIX43_MarketDataIncrementalRefresh_MsgSeqNum = 9,
+    FIX43_MarketDataIncrementalRefresh_SenderSubID = 10,
+    FIX43_MarketDataIncrementalRefresh_SenderLocationID = 11,
+    FIX43_MarketDataIncrementalRefresh_TargetSubID = 12,
+    FIX43_MarketDataIncrementalRefresh_TargetLocationID = 13,
+    FIX43_MarketDataIncrementalRefresh_OnBehalfOfSubID = 14,
+    FIX43_MarketDataIncrementalRefresh_OnBehalfOfLocationID = 15,
+    FIX43_MarketDataIncrementalRefresh_DeliverToSubID = 16,
+    FIX43_MarketDataIncrementalRefresh_DeliverToLocationID = 17,
+    FIX43_MarketDataIncrementalRefresh_PossDupFlag = 18,
+    FIX43_MarketDataIncrementalRefresh_PossResend = 19,
+    FIX43_MarketDataIncrementalRefresh_SendingTime = 20,
+    FIX43_MarketDataIncrementalRefresh_OrigSendingTime = 21,
+    FIX43_MarketDataIncrementalRefresh_XmlDataLen = 22,
+    FIX43_MarketDataIncrementalRefresh_XmlData = 23,
+    FIX43_MarketDataIncrementalRefresh_MessageEncoding = 24,
+    FIX43_MarketDataIncrementalRefresh_LastMsgSeqNumProcessed = 25,
+    FIX43_MarketDataIncrementalRefresh_OnBehalfOfSendingTime = 26,
+    FIX43_MarketDataIncrementalRefresh_NoHops = 27,
+    FIX43_MarketDataIncrementalRefresh_MDReqID = 28,
+    FIX43_MarketDataIncrementalRefresh_NoMDEntries = 29,
+    FIX43_MarketDataIncrementalRefresh_SignatureLength = 30,
+    FIX43_MarketDataIncrementalRefresh_Signature = 31,
+    FIX43_MarketDataIncrementalRefresh_CheckSum = 32,
+};
+
+typedef struct _fix43MarketDataIncrementalRefresh {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    int64_t	NoMDEntries;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43MarketDataIncrementalRefresh;
+
+extern void	fix43_decode_MarketDataIncrementalRefresh(ofixErr err, fix43MarketDataIncrementalRefresh m, const char *raw, int len);
+extern void	fix43_decode_MarketDataIncrementalRefresh_msg(ofixErr err, fix43MarketDataIncrementalRefresh m, ofixMsg msg);
+extern ofixMsg	fix43_encode_MarketDataIncrementalRefresh(ofixErr err, fix43MarketDataIncrementalRefresh m);
+
+// MarketDataRequestReject [Y]
+enum {
+    FIX43_MarketDataRequestReject_BeginString = 0,
+    FIX43_MarketDataRequestReject_BodyLength = 1,
+    FIX43_MarketDataRequestReject_MsgType = 2,
+    FIX43_MarketDataRequestReject_SenderCompID = 3,
+    FIX43_MarketDataRequestReject_TargetCompID = 4,
+    FIX43_MarketDataRequestReject_OnBehalfOfCompID = 5,
+    FIX43_MarketDataRequestReject_DeliverToCompID = 6,
+    FIX43_MarketDataRequestReject_SecureDataLen = 7,
+    FIX43_MarketDataRequestReject_SecureData = 8,
+    FIX43_MarketDataRequestReject_MsgSeqNum = 9,
+    FIX43_MarketDataRequestReject_SenderSubID = 10,
+    FIX43_MarketDataRequestReject_SenderLocationID = 11,
+    FIX43_MarketDataRequestReject_TargetSubID = 12,
+    FIX43_MarketDataRequestReject_TargetLocationID = 13,
+    FIX43_MarketDataRequestReject_OnBehalfOfSubID = 14,
+    FIX43_MarketDataRequestReject_OnBehalfOfLocationID = 15,
+    FIX43_MarketDataRequestReject_DeliverToSubID = 16,
+    FIX43_MarketDataRequestReject_DeliverToLocationID = 17,
+    FIX43_MarketDataRequestReject_PossDupFlag = 18,
+    FIX43_MarketDataRequestReject_PossResend = 19,
+    FIX43_MarketDataRequestReject_SendingTime = 20,
+    FIX43_MarketDataRequestReject_OrigSendingTime = 21,
+    FIX43_MarketDataRequestReject_XmlDataLen = 22,
+    FIX43_MarketDataRequestReject_XmlData = 23,
+    FIX43_MarketDataRequestReject_MessageEncoding = 24,
+    FIX43_MarketDataRequestReject_LastMsgSeqNumProcessed = 25,
+    FIX43_MarketDataRequestReject_OnBehalfOfSendingTime = 26,
+    FIX43_MarketDataRequestReject_NoHops = 27,
+    FIX43_MarketDataRequestReject_MDReqID = 28,
+    FIX43_MarketDataRequestReject_MDReqRejReason = 29,
+    FIX43_MarketDataRequestReject_Text = 30,
+    FIX43_MarketDataRequestReject_EncodedTextLen = 31,
+    FIX43_MarketDataRequestReject_EncodedText = 32,
+    FIX43_MarketDataRequestReject_SignatureLength = 33,
+    FIX43_MarketDataRequestReject_Signature = 34,
+    FIX43_MarketDataRequestReject_CheckSum = 35,
+};
+
+typedef struct _fix43MarketDataRequestReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    char	MDReqRejReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43MarketDataRequestReject;
+
+extern void	fix43_decode_MarketDataRequestReject(ofixErr err, fix43MarketDataRequestReject m, const char *raw, int len);
+extern void	fix43_decode_MarketDataRequestReject_msg(ofixErr err, fix43MarketDataRequestReject m, ofixMsg msg);
+extern ofixMsg	fix43_encode_MarketDataRequestReject(ofixErr err, fix43MarketDataRequestReject m);
+
+// QuoteCancel [Z]
+enum {
+    FIX43_QuoteCancel_BeginString = 0,
+    FIX43_QuoteCancel_BodyLength = 1,
+    FIX43_QuoteCancel_MsgType = 2,
+    FIX43_QuoteCancel_SenderCompID = 3,
+    FIX43_QuoteCancel_TargetCompID = 4,
+    FIX43_QuoteCancel_OnBehalfOfCompID = 5,
+    FIX43_QuoteCancel_DeliverToCompID = 6,
+    FIX43_QuoteCancel_SecureDataLen = 7,
+    FIX43_QuoteCancel_SecureData = 8,
+    FIX43_QuoteCancel_MsgSeqNum = 9,
+    FIX43_QuoteCancel_SenderSubID = 10,
+    FIX43_QuoteCancel_SenderLocationID = 11,
+    FIX43_QuoteCancel_TargetSubID = 12,
+    FIX43_QuoteCancel_TargetLocationID = 13,
+    FIX43_QuoteCancel_OnBehalfOfSubID = 14,
+    FIX43_QuoteCancel_OnBehalfOfLocationID = 15,
+    FIX43_QuoteCancel_DeliverToSubID = 16,
+    FIX43_QuoteCancel_DeliverToLocationID = 17,
+    FIX43_QuoteCancel_PossDupFlag = 18,
+    FIX43_QuoteCancel_PossResend = 19,
+    FIX43_QuoteCancel_SendingTime = 20,
+    FIX43_QuoteCancel_OrigSendingTime = 21,
+    FIX43_QuoteCancel_XmlDataLen = 22,
+    FIX43_QuoteCancel_XmlData = 23,
+    FIX43_QuoteCancel_MessageEncoding = 24,
+    FIX43_QuoteCancel_LastMsgSeqNumProcessed = 25,
+    FIX43_QuoteCancel_OnBehalfOfSendingTime = 26,
+    FIX43_QuoteCancel_NoHops = 27,
+    FIX43_QuoteCancel_QuoteReqID = 28,
+    FIX43_QuoteCancel_QuoteID = 29,
+    FIX43_QuoteCancel_QuoteCancelType = 30,
+    FIX43_QuoteCancel_QuoteResponseLevel = 31,
+    FIX43_QuoteCancel_NoPartyIDs = 32,
+    FIX43_QuoteCancel_Account = 33,
+    FIX43_QuoteCancel_AccountType = 34,
+    FIX43_QuoteCancel_TradingSessionID = 35,
+    FIX43_QuoteCancel_TradingSessionSubID = 36,
+    FIX43_QuoteCancel_NoQuoteEntries = 37,
+    FIX43_QuoteCancel_SignatureLength = 38,
+    FIX43_QuoteCancel_Signature = 39,
+    FIX43_QuoteCancel_CheckSum = 40,
+};
+
+typedef struct _fix43QuoteCancel {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteCancelType;
+    int64_t	QuoteResponseLevel;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	NoQuoteEntries;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43QuoteCancel;
+
+extern void	fix43_decode_QuoteCancel(ofixErr err, fix43QuoteCancel m, const char *raw, int len);
+extern void	fix43_decode_QuoteCancel_msg(ofixErr err, fix43QuoteCancel m, ofixMsg msg);
+extern ofixMsg	fix43_encode_QuoteCancel(ofixErr err, fix43QuoteCancel m);
+
+// QuoteStatusRequest [a]
+enum {
+    FIX43_QuoteStatusRequest_BeginString = 0,
+    FIX43_QuoteStatusRequest_BodyLength = 1,
+    FIX43_QuoteStatusRequest_MsgType = 2,
+    FIX43_QuoteStatusRequest_SenderCompID = 3,
+    FIX43_QuoteStatusRequest_TargetCompID = 4,
+    FIX43_QuoteStatusRequest_OnBehalfOfCompID = 5,
+    FIX43_QuoteStatusRequest_DeliverToCompID = 6,
+    FIX43_QuoteStatusRequest_SecureDataLen = 7,
+    FIX43_QuoteStatusRequest_SecureData = 8,
+    FIX43_QuoteStatusRequest_MsgSeqNum = 9,
+    FIX43_QuoteStatusRequest_SenderSubID = 10,
+    FIX43_QuoteStatusRequest_SenderLocationID = 11,
+    FIX43_QuoteStatusRequest_TargetSubID = 12,
+    FIX43_QuoteStatusRequest_TargetLocationID = 13,
+    FIX43_QuoteStatusRequest_OnBehalfOfSubID = 14,
+    FIX43_QuoteStatusRequest_OnBehalfOfLocationID = 15,
+    FIX43_QuoteStatusRequest_DeliverToSubID = 16,
+    FIX43_QuoteStatusRequest_DeliverToLocationID = 17,
+    FIX43_QuoteStatusRequest_PossDupFlag = 18,
+    FIX43_QuoteStatusRequest_PossResend = 19,
+    FIX43_QuoteStatusRequest_SendingTime = 20,
+    FIX43_QuoteStatusRequest_OrigSendingTime = 21,
+    FIX43_QuoteStatusRequest_XmlDataLen = 22,
+    FIX43_QuoteStatusRequest_XmlData = 23,
+    FIX43_QuoteStatusRequest_MessageEncoding = 24,
+    FIX43_QuoteStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_QuoteStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX43_QuoteStatusRequest_NoHops = 27,
+    FIX43_QuoteStatusRequest_QuoteStatusReqID = 28,
+    FIX43_QuoteStatusRequest_QuoteID = 29,
+    FIX43_QuoteStatusRequest_Symbol = 30,
+    FIX43_QuoteStatusRequest_SymbolSfx = 31,
+    FIX43_QuoteStatusRequest_SecurityID = 32,
+    FIX43_QuoteStatusRequest_SecurityIDSource = 33,
+    FIX43_QuoteStatusRequest_NoSecurityAltID = 34,
+    FIX43_QuoteStatusRequest_Product = 35,
+    FIX43_QuoteStatusRequest_CFICode = 36,
+    FIX43_QuoteStatusRequest_SecurityType = 37,
+    FIX43_QuoteStatusRequest_MaturityMonthYear = 38,
+    FIX43_QuoteStatusRequest_MaturityDate = 39,
+    FIX43_QuoteStatusRequest_CouponPaymentDate = 40,
+    FIX43_QuoteStatusRequest_IssueDate = 41,
+    FIX43_QuoteStatusRequest_RepoCollateralSecurityType = 42,
+    FIX43_QuoteStatusRequest_RepurchaseTerm = 43,
+    FIX43_QuoteStatusRequest_RepurchaseRate = 44,
+    FIX43_QuoteStatusRequest_Factor = 45,
+    FIX43_QuoteStatusRequest_CreditRating = 46,
+    FIX43_QuoteStatusRequest_InstrRegistry = 47,
+    FIX43_QuoteStatusRequest_CountryOfIssue = 48,
+    FIX43_QuoteStatusRequest_StateOrProvinceOfIssue = 49,
+    FIX43_QuoteStatusRequest_LocaleOfIssue = 50,
+    FIX43_QuoteStatusRequest_RedemptionDate = 51,
+    FIX43_QuoteStatusRequest_StrikePrice = 52,
+    FIX43_QuoteStatusRequest_OptAttribute = 53,
+    FIX43_QuoteStatusRequest_ContractMultiplier = 54,
+    FIX43_QuoteStatusRequest_CouponRate = 55,
+    FIX43_QuoteStatusRequest_SecurityExchange = 56,
+    FIX43_QuoteStatusRequest_Issuer = 57,
+    FIX43_QuoteStatusRequest_EncodedIssuerLen = 58,
+    FIX43_QuoteStatusRequest_EncodedIssuer = 59,
+    FIX43_QuoteStatusRequest_SecurityDesc = 60,
+    FIX43_QuoteStatusRequest_EncodedSecurityDescLen = 61,
+    FIX43_QuoteStatusRequest_EncodedSecurityDesc = 62,
+    FIX43_QuoteStatusRequest_NoPartyIDs = 63,
+    FIX43_QuoteStatusRequest_Account = 64,
+    FIX43_QuoteStatusRequest_AccountType = 65,
+    FIX43_QuoteStatusRequest_TradingSessionID = 66,
+    FIX43_QuoteStatusRequest_TradingSessionSubID = 67,
+    FIX43_QuoteStatusRequest_SubscriptionRequestType = 68,
+    FIX43_QuoteStatusRequest_SignatureLength = 69,
+    FIX43_QuoteStatusRequest_Signature = 70,
+    FIX43_QuoteStatusRequest_CheckSum = 71,
+};
+
+typedef struct _fix43QuoteStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteStatusReqID;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43QuoteStatusRequest;
+
+extern void	fix43_decode_QuoteStatusRequest(ofixErr err, fix43QuoteStatusRequest m, const char *raw, int len);
+extern void	fix43_decode_QuoteStatusRequest_msg(ofixErr err, fix43QuoteStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_QuoteStatusRequest(ofixErr err, fix43QuoteStatusRequest m);
+
+// MassQuoteAcknowledgement [b]
+enum {
+    FIX43_MassQuoteAcknowledgement_BeginString = 0,
+    FIX43_MassQuoteAcknowledgement_BodyLength = 1,
+    FIX43_MassQuoteAcknowledgement_MsgType = 2,
+    FIX43_MassQuoteAcknowledgement_SenderCompID = 3,
+    FIX43_MassQuoteAcknowledgement_TargetCompID = 4,
+    FIX43_MassQuoteAcknowledgement_OnBehalfOfCompID = 5,
+    FIX43_MassQuoteAcknowledgement_DeliverToCompID = 6,
+    FIX43_MassQuoteAcknowledgement_SecureDataLen = 7,
+    FIX43_MassQuoteAcknowledgement_SecureData = 8,
+    FIX43_MassQuoteAcknowledgement_MsgSeqNum = 9,
+    FIX43_MassQuoteAcknowledgement_SenderSubID = 10,
+    FIX43_MassQuoteAcknowledgement_SenderLocationID = 11,
+    FIX43_MassQuoteAcknowledgement_TargetSubID = 12,
+    FIX43_MassQuoteAcknowledgement_TargetLocationID = 13,
+    FIX43_MassQuoteAcknowledgement_OnBehalfOfSubID = 14,
+    FIX43_MassQuoteAcknowledgement_OnBehalfOfLocationID = 15,
+    FIX43_MassQuoteAcknowledgement_DeliverToSubID = 16,
+    FIX43_MassQuoteAcknowledgement_DeliverToLocationID = 17,
+    FIX43_MassQuoteAcknowledgement_PossDupFlag = 18,
+    FIX43_MassQuoteAcknowledgement_PossResend = 19,
+    FIX43_MassQuoteAcknowledgement_SendingTime = 20,
+    FIX43_MassQuoteAcknowledgement_OrigSendingTime = 21,
+    FIX43_MassQuoteAcknowledgement_XmlDataLen = 22,
+    FIX43_MassQuoteAcknowledgement_XmlData = 23,
+    FIX43_MassQuoteAcknowledgement_MessageEncoding = 24,
+    FIX43_MassQuoteAcknowledgement_LastMsgSeqNumProcessed = 25,
+    FIX43_MassQuoteAcknowledgement_OnBehalfOfSendingTime = 26,
+    FIX43_MassQuoteAcknowledgement_NoHops = 27,
+    FIX43_MassQuoteAcknowledgement_QuoteReqID = 28,
+    FIX43_MassQuoteAcknowledgement_QuoteID = 29,
+    FIX43_MassQuoteAcknowledgement_QuoteStatus = 30,
+    FIX43_MassQuoteAcknowledgement_QuoteRejectReason = 31,
+    FIX43_MassQuoteAcknowledgement_QuoteResponseLevel = 32,
+    FIX43_MassQuoteAcknowledgement_QuoteType = 33,
+    FIX43_MassQuoteAcknowledgement_NoPartyIDs = 34,
+    FIX43_MassQuoteAcknowledgement_Account = 35,
+    FIX43_MassQuoteAcknowledgement_AccountType = 36,
+    FIX43_MassQuoteAcknowledgement_Text = 37,
+    FIX43_MassQuoteAcknowledgement_NoQuoteSets = 38,
+    FIX43_MassQuoteAcknowledgement_SignatureLength = 39,
+    FIX43_MassQuoteAcknowledgement_Signature = 40,
+    FIX43_MassQuoteAcknowledgement_CheckSum = 41,
+};
+
+typedef struct _fix43MassQuoteAcknowledgement {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteStatus;
+    int64_t	QuoteRejectReason;
+    int64_t	QuoteResponseLevel;
+    int64_t	QuoteType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	Text;
+    int64_t	NoQuoteSets;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43MassQuoteAcknowledgement;
+
+extern void	fix43_decode_MassQuoteAcknowledgement(ofixErr err, fix43MassQuoteAcknowledgement m, const char *raw, int len);
+extern void	fix43_decode_MassQuoteAcknowledgement_msg(ofixErr err, fix43MassQuoteAcknowledgement m, ofixMsg msg);
+extern ofixMsg	fix43_encode_MassQuoteAcknowledgement(ofixErr err, fix43MassQuoteAcknowledgement m);
+
+// SecurityDefinitionRequest [c]
+enum {
+    FIX43_SecurityDefinitionRequest_BeginString = 0,
+    FIX43_SecurityDefinitionRequest_BodyLength = 1,
+    FIX43_SecurityDefinitionRequest_MsgType = 2,
+    FIX43_SecurityDefinitionRequest_SenderCompID = 3,
+    FIX43_SecurityDefinitionRequest_TargetCompID = 4,
+    FIX43_SecurityDefinitionRequest_OnBehalfOfCompID = 5,
+    FIX43_SecurityDefinitionRequest_DeliverToCompID = 6,
+    FIX43_SecurityDefinitionRequest_SecureDataLen = 7,
+    FIX43_SecurityDefinitionRequest_SecureData = 8,
+    FIX43_SecurityDefinitionRequest_MsgSeqNum = 9,
+    FIX43_SecurityDefinitionRequest_SenderSubID = 10,
+    FIX43_SecurityDefinitionRequest_SenderLocationID = 11,
+    FIX43_SecurityDefinitionRequest_TargetSubID = 12,
+    FIX43_SecurityDefinitionRequest_TargetLocationID = 13,
+    FIX43_SecurityDefinitionRequest_OnBehalfOfSubID = 14,
+    FIX43_SecurityDefinitionRequest_OnBehalfOfLocationID = 15,
+    FIX43_SecurityDefinitionRequest_DeliverToSubID = 16,
+    FIX43_SecurityDefinitionRequest_DeliverToLocationID = 17,
+    FIX43_SecurityDefinitionRequest_PossDupFlag = 18,
+    FIX43_SecurityDefinitionRequest_PossResend = 19,
+    FIX43_SecurityDefinitionRequest_SendingTime = 20,
+    FIX43_SecurityDefinitionRequest_OrigSendingTime = 21,
+    FIX43_SecurityDefinitionRequest_XmlDataLen = 22,
+    FIX43_SecurityDefinitionRequest_XmlData = 23,
+    FIX43_SecurityDefinitionRequest_MessageEncoding = 24,
+    FIX43_SecurityDefinitionRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityDefinitionRequest_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityDefinitionRequest_NoHops = 27,
+    FIX43_SecurityDefinitionRequest_SecurityReqID = 28,
+    FIX43_SecurityDefinitionRequest_SecurityRequestType = 29,
+    FIX43_SecurityDefinitionRequest_Symbol = 30,
+    FIX43_SecurityDefinitionRequest_SymbolSfx = 31,
+    FIX43_SecurityDefinitionRequest_SecurityID = 32,
+    FIX43_SecurityDefinitionRequest_SecurityIDSource = 33,
+    FIX43_SecurityDefinitionRequest_NoSecurityAltID = 34,
+    FIX43_SecurityDefinitionRequest_Product = 35,
+    FIX43_SecurityDefinitionRequest_CFICode = 36,
+    FIX43_SecurityDefinitionRequest_SecurityType = 37,
+    FIX43_SecurityDefinitionRequest_MaturityMonthYear = 38,
+    FIX43_SecurityDefinitionRequest_MaturityDate = 39,
+    FIX43_SecurityDefinitionRequest_CouponPaymentDate = 40,
+    FIX43_SecurityDefinitionRequest_IssueDate = 41,
+    FIX43_SecurityDefinitionRequest_RepoCollateralSecurityType = 42,
+    FIX43_SecurityDefinitionRequest_RepurchaseTerm = 43,
+    FIX43_SecurityDefinitionRequest_RepurchaseRate = 44,
+    FIX43_SecurityDefinitionRequest_Factor = 45,
+    FIX43_SecurityDefinitionRequest_CreditRating = 46,
+    FIX43_SecurityDefinitionRequest_InstrRegistry = 47,
+    FIX43_SecurityDefinitionRequest_CountryOfIssue = 48,
+    FIX43_SecurityDefinitionRequest_StateOrProvinceOfIssue = 49,
+    FIX43_SecurityDefinitionRequest_LocaleOfIssue = 50,
+    FIX43_SecurityDefinitionRequest_RedemptionDate = 51,
+    FIX43_SecurityDefinitionRequest_StrikePrice = 52,
+    FIX43_SecurityDefinitionRequest_OptAttribute = 53,
+    FIX43_SecurityDefinitionRequest_ContractMultiplier = 54,
+    FIX43_SecurityDefinitionRequest_CouponRate = 55,
+    FIX43_SecurityDefinitionRequest_SecurityExchange = 56,
+    FIX43_SecurityDefinitionRequest_Issuer = 57,
+    FIX43_SecurityDefinitionRequest_EncodedIssuerLen = 58,
+    FIX43_SecurityDefinitionRequest_EncodedIssuer = 59,
+    FIX43_SecurityDefinitionRequest_SecurityDesc = 60,
+    FIX43_SecurityDefinitionRequest_EncodedSecurityDescLen = 61,
+    FIX43_SecurityDefinitionRequest_EncodedSecurityDesc = 62,
+    FIX43_SecurityDefinitionRequest_Currency = 63,
+    FIX43_SecurityDefinitionRequest_Text = 64,
+    FIX43_SecurityDefinitionRequest_EncodedTextLen = 65,
+    FIX43_SecurityDefinitionRequest_EncodedText = 66,
+    FIX43_SecurityDefinitionRequest_TradingSessionID = 67,
+    FIX43_SecurityDefinitionRequest_TradingSessionSubID = 68,
+    FIX43_SecurityDefinitionRequest_NoLegs = 69,
+    FIX43_SecurityDefinitionRequest_SubscriptionRequestType = 70,
+    FIX43_SecurityDefinitionRequest_SignatureLength = 71,
+    FIX43_SecurityDefinitionRequest_Signature = 72,
+    FIX43_SecurityDefinitionRequest_CheckSum = 73,
+};
+
+typedef struct _fix43SecurityDefinitionRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    int64_t	SecurityRequestType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	NoLegs;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityDefinitionRequest;
+
+extern void	fix43_decode_SecurityDefinitionRequest(ofixErr err, fix43SecurityDefinitionRequest m, const char *raw, int len);
+extern void	fix43_decode_SecurityDefinitionRequest_msg(ofixErr err, fix43SecurityDefinitionRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityDefinitionRequest(ofixErr err, fix43SecurityDefinitionRequest m);
+
+// SecurityDefinition [d]
+enum {
+    FIX43_SecurityDefinition_BeginString = 0,
+    FIX43_SecurityDefinition_BodyLength = 1,
+    FIX43_SecurityDefinition_MsgType = 2,
+    FIX43_SecurityDefinition_SenderCompID = 3,
+    FIX43_SecurityDefinition_TargetCompID = 4,
+    FIX43_SecurityDefinition_OnBehalfOfCompID = 5,
+    FIX43_SecurityDefinition_DeliverToCompID = 6,
+    FIX43_SecurityDefinition_SecureDataLen = 7,
+    FIX43_SecurityDefinition_SecureData = 8,
+    FIX43_SecurityDefinition_MsgSeqNum = 9,
+    FIX43_SecurityDefinition_SenderSubID = 10,
+    FIX43_SecurityDefinition_SenderLocationID = 11,
+    FIX43_SecurityDefinition_TargetSubID = 12,
+    FIX43_SecurityDefinition_TargetLocationID = 13,
+    FIX43_SecurityDefinition_OnBehalfOfSubID = 14,
+    FIX43_SecurityDefinition_OnBehalfOfLocationID = 15,
+    FIX43_SecurityDefinition_DeliverToSubID = 16,
+    FIX43_SecurityDefinition_DeliverToLocationID = 17,
+    FIX43_SecurityDefinition_PossDupFlag = 18,
+    FIX43_SecurityDefinition_PossResend = 19,
+    FIX43_SecurityDefinition_SendingTime = 20,
+    FIX43_SecurityDefinition_OrigSendingTime = 21,
+    FIX43_SecurityDefinition_XmlDataLen = 22,
+    FIX43_SecurityDefinition_XmlData = 23,
+    FIX43_SecurityDefinition_MessageEncoding = 24,
+    FIX43_SecurityDefinition_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityDefinition_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityDefinition_NoHops = 27,
+    FIX43_SecurityDefinition_SecurityReqID = 28,
+    FIX43_SecurityDefinition_SecurityResponseID = 29,
+    FIX43_SecurityDefinition_SecurityResponseType = 30,
+    FIX43_SecurityDefinition_Symbol = 31,
+    FIX43_SecurityDefinition_SymbolSfx = 32,
+    FIX43_SecurityDefinition_SecurityID = 33,
+    FIX43_SecurityDefinition_SecurityIDSource = 34,
+    FIX43_SecurityDefinition_NoSecurityAltID = 35,
+    FIX43_SecurityDefinition_Product = 36,
+    FIX43_SecurityDefinition_CFICode = 37,
+    FIX43_SecurityDefinition_SecurityType = 38,
+    FIX43_SecurityDefinition_MaturityMonthYear = 39,
+    FIX43_SecurityDefinition_MaturityDate = 40,
+    FIX43_SecurityDefinition_CouponPaymentDate = 41,
+    FIX43_SecurityDefinition_IssueDate = 42,
+    FIX43_SecurityDefinition_RepoCollateralSecurityType = 43,
+    FIX43_SecurityDefinition_RepurchaseTerm = 44,
+    FIX43_SecurityDefinition_RepurchaseRate = 45,
+    FIX43_SecurityDefinition_Factor = 46,
+    FIX43_SecurityDefinition_CreditRating = 47,
+    FIX43_SecurityDefinition_InstrRegistry = 48,
+    FIX43_SecurityDefinition_CountryOfIssue = 49,
+    FIX43_SecurityDefinition_StateOrProvinceOfIssue = 50,
+    FIX43_SecurityDefinition_LocaleOfIssue = 51,
+    FIX43_SecurityDefinition_RedemptionDate = 52,
+    FIX43_SecurityDefinition_StrikePrice = 53,
+    FIX43_SecurityDefinition_OptAttribute = 54,
+    FIX43_SecurityDefinition_ContractMultiplier = 55,
+    FIX43_SecurityDefinition_CouponRate = 56,
+    FIX43_SecurityDefinition_SecurityExchange = 57,
+    FIX43_SecurityDefinition_Issuer = 58,
+    FIX43_SecurityDefinition_EncodedIssuerLen = 59,
+    FIX43_SecurityDefinition_EncodedIssuer = 60,
+    FIX43_SecurityDefinition_SecurityDesc = 61,
+    FIX43_SecurityDefinition_EncodedSecurityDescLen = 62,
+    FIX43_SecurityDefinition_EncodedSecurityDesc = 63,
+    FIX43_SecurityDefinition_Currency = 64,
+    FIX43_SecurityDefinition_TradingSessionID = 65,
+    FIX43_SecurityDefinition_TradingSessionSubID = 66,
+    FIX43_SecurityDefinition_Text = 67,
+    FIX43_SecurityDefinition_EncodedTextLen = 68,
+    FIX43_SecurityDefinition_EncodedText = 69,
+    FIX43_SecurityDefinition_NoLegs = 70,
+    FIX43_SecurityDefinition_RoundLot = 71,
+    FIX43_SecurityDefinition_MinTradeVol = 72,
+    FIX43_SecurityDefinition_SignatureLength = 73,
+    FIX43_SecurityDefinition_Signature = 74,
+    FIX43_SecurityDefinition_CheckSum = 75,
+};
+
+typedef struct _fix43SecurityDefinition {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityResponseType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NoLegs;
+    struct _ofixDecimal	RoundLot;
+    struct _ofixDecimal	MinTradeVol;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityDefinition;
+
+extern void	fix43_decode_SecurityDefinition(ofixErr err, fix43SecurityDefinition m, const char *raw, int len);
+extern void	fix43_decode_SecurityDefinition_msg(ofixErr err, fix43SecurityDefinition m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityDefinition(ofixErr err, fix43SecurityDefinition m);
+
+// SecurityStatusRequest [e]
+enum {
+    FIX43_SecurityStatusRequest_BeginString = 0,
+    FIX43_SecurityStatusRequest_BodyLength = 1,
+    FIX43_SecurityStatusRequest_MsgType = 2,
+    FIX43_SecurityStatusRequest_SenderCompID = 3,
+    FIX43_SecurityStatusRequest_TargetCompID = 4,
+    FIX43_SecurityStatusRequest_OnBehalfOfCompID = 5,
+    FIX43_SecurityStatusRequest_DeliverToCompID = 6,
+    FIX43_SecurityStatusRequest_SecureDataLen = 7,
+    FIX43_SecurityStatusRequest_SecureData = 8,
+    FIX43_SecurityStatusRequest_MsgSeqNum = 9,
+    FIX43_SecurityStatusRequest_SenderSubID = 10,
+    FIX43_SecurityStatusRequest_SenderLocationID = 11,
+    FIX43_SecurityStatusRequest_TargetSubID = 12,
+    FIX43_SecurityStatusRequest_TargetLocationID = 13,
+    FIX43_SecurityStatusRequest_OnBehalfOfSubID = 14,
+    FIX43_SecurityStatusRequest_OnBehalfOfLocationID = 15,
+    FIX43_SecurityStatusRequest_DeliverToSubID = 16,
+    FIX43_SecurityStatusRequest_DeliverToLocationID = 17,
+    FIX43_SecurityStatusRequest_PossDupFlag = 18,
+    FIX43_SecurityStatusRequest_PossResend = 19,
+    FIX43_SecurityStatusRequest_SendingTime = 20,
+    FIX43_SecurityStatusRequest_OrigSendingTime = 21,
+    FIX43_SecurityStatusRequest_XmlDataLen = 22,
+    FIX43_SecurityStatusRequest_XmlData = 23,
+    FIX43_SecurityStatusRequest_MessageEncoding = 24,
+    FIX43_SecurityStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityStatusRequest_NoHops = 27,
+    FIX43_SecurityStatusRequest_SecurityStatusReqID = 28,
+    FIX43_SecurityStatusRequest_Symbol = 29,
+    FIX43_SecurityStatusRequest_SymbolSfx = 30,
+    FIX43_SecurityStatusRequest_SecurityID = 31,
+    FIX43_SecurityStatusRequest_SecurityIDSource = 32,
+    FIX43_SecurityStatusRequest_NoSecurityAltID = 33,
+    FIX43_SecurityStatusRequest_Product = 34,
+    FIX43_SecurityStatusRequest_CFICode = 35,
+    FIX43_SecurityStatusRequest_SecurityType = 36,
+    FIX43_SecurityStatusRequest_MaturityMonthYear = 37,
+    FIX43_SecurityStatusRequest_MaturityDate = 38,
+    FIX43_SecurityStatusRequest_CouponPaymentDate = 39,
+    FIX43_SecurityStatusRequest_IssueDate = 40,
+    FIX43_SecurityStatusRequest_RepoCollateralSecurityType = 41,
+    FIX43_SecurityStatusRequest_RepurchaseTerm = 42,
+    FIX43_SecurityStatusRequest_RepurchaseRate = 43,
+    FIX43_SecurityStatusRequest_Factor = 44,
+    FIX43_SecurityStatusRequest_CreditRating = 45,
+    FIX43_SecurityStatusRequest_InstrRegistry = 46,
+    FIX43_SecurityStatusRequest_CountryOfIssue = 47,
+    FIX43_SecurityStatusRequest_StateOrProvinceOfIssue = 48,
+    FIX43_SecurityStatusRequest_LocaleOfIssue = 49,
+    FIX43_SecurityStatusRequest_RedemptionDate = 50,
+    FIX43_SecurityStatusRequest_StrikePrice = 51,
+    FIX43_SecurityStatusRequest_OptAttribute = 52,
+    FIX43_SecurityStatusRequest_ContractMultiplier = 53,
+    FIX43_SecurityStatusRequest_CouponRate = 54,
+    FIX43_SecurityStatusRequest_SecurityExchange = 55,
+    FIX43_SecurityStatusRequest_Issuer = 56,
+    FIX43_SecurityStatusRequest_EncodedIssuerLen = 57,
+    FIX43_SecurityStatusRequest_EncodedIssuer = 58,
+    FIX43_SecurityStatusRequest_SecurityDesc = 59,
+    FIX43_SecurityStatusRequest_EncodedSecurityDescLen = 60,
+    FIX43_SecurityStatusRequest_EncodedSecurityDesc = 61,
+    FIX43_SecurityStatusRequest_Currency = 62,
+    FIX43_SecurityStatusRequest_SubscriptionRequestType = 63,
+    FIX43_SecurityStatusRequest_TradingSessionID = 64,
+    FIX43_SecurityStatusRequest_TradingSessionSubID = 65,
+    FIX43_SecurityStatusRequest_SignatureLength = 66,
+    FIX43_SecurityStatusRequest_Signature = 67,
+    FIX43_SecurityStatusRequest_CheckSum = 68,
+};
+
+typedef struct _fix43SecurityStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityStatusReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    char	SubscriptionRequestType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityStatusRequest;
+
+extern void	fix43_decode_SecurityStatusRequest(ofixErr err, fix43SecurityStatusRequest m, const char *raw, int len);
+extern void	fix43_decode_SecurityStatusRequest_msg(ofixErr err, fix43SecurityStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityStatusRequest(ofixErr err, fix43SecurityStatusRequest m);
+
+// SecurityStatus [f]
+enum {
+    FIX43_SecurityStatus_BeginString = 0,
+    FIX43_SecurityStatus_BodyLength = 1,
+    FIX43_SecurityStatus_MsgType = 2,
+    FIX43_SecurityStatus_SenderCompID = 3,
+    FIX43_SecurityStatus_TargetCompID = 4,
+    FIX43_SecurityStatus_OnBehalfOfCompID = 5,
+    FIX43_SecurityStatus_DeliverToCompID = 6,
+    FIX43_SecurityStatus_SecureDataLen = 7,
+    FIX43_SecurityStatus_SecureData = 8,
+    FIX43_SecurityStatus_MsgSeqNum = 9,
+    FIX43_SecurityStatus_SenderSubID = 10,
+    FIX43_SecurityStatus_SenderLocationID = 11,
+    FIX43_SecurityStatus_TargetSubID = 12,
+    FIX43_SecurityStatus_TargetLocationID = 13,
+    FIX43_SecurityStatus_OnBehalfOfSubID = 14,
+    FIX43_SecurityStatus_OnBehalfOfLocationID = 15,
+    FIX43_SecurityStatus_DeliverToSubID = 16,
+    FIX43_SecurityStatus_DeliverToLocationID = 17,
+    FIX43_SecurityStatus_PossDupFlag = 18,
+    FIX43_SecurityStatus_PossResend = 19,
+    FIX43_SecurityStatus_SendingTime = 20,
+    FIX43_SecurityStatus_OrigSendingTime = 21,
+    FIX43_SecurityStatus_XmlDataLen = 22,
+    FIX43_SecurityStatus_XmlData = 23,
+    FIX43_SecurityStatus_MessageEncoding = 24,
+    FIX43_SecurityStatus_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityStatus_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityStatus_NoHops = 27,
+    FIX43_SecurityStatus_SecurityStatusReqID = 28,
+    FIX43_SecurityStatus_Symbol = 29,
+    FIX43_SecurityStatus_SymbolSfx = 30,
+    FIX43_SecurityStatus_SecurityID = 31,
+    FIX43_SecurityStatus_SecurityIDSource = 32,
+    FIX43_SecurityStatus_NoSecurityAltID = 33,
+    FIX43_SecurityStatus_Product = 34,
+    FIX43_SecurityStatus_CFICode = 35,
+    FIX43_SecurityStatus_SecurityType = 36,
+    FIX43_SecurityStatus_MaturityMonthYear = 37,
+    FIX43_SecurityStatus_MaturityDate = 38,
+    FIX43_SecurityStatus_CouponPaymentDate = 39,
+    FIX43_SecurityStatus_IssueDate = 40,
+    FIX43_SecurityStatus_RepoCollateralSecurityType = 41,
+    FIX43_SecurityStatus_RepurchaseTerm = 42,
+    FIX43_SecurityStatus_RepurchaseRate = 43,
+    FIX43_SecurityStatus_Factor = 44,
+    FIX43_SecurityStatus_CreditRating = 45,
+    FIX43_SecurityStatus_InstrRegistry = 46,
+    FIX43_SecurityStatus_CountryOfIssue = 47,
+    FIX43_SecurityStatus_StateOrProvinceOfIssue = 48,
+    FIX43_SecurityStatus_LocaleOfIssue = 49,
+    FIX43_SecurityStatus_RedemptionDate = 50,
+    FIX43_SecurityStatus_StrikePrice = 51,
+    FIX43_SecurityStatus_OptAttribute = 52,
+    FIX43_SecurityStatus_ContractMultiplier = 53,
+    FIX43_SecurityStatus_CouponRate = 54,
+    FIX43_SecurityStatus_SecurityExchange = 55,
+    FIX43_SecurityStatus_Issuer = 56,
+    FIX43_SecurityStatus_EncodedIssuerLen = 57,
+    FIX43_SecurityStatus_EncodedIssuer = 58,
+    FIX43_SecurityStatus_SecurityDesc = 59,
+    FIX43_SecurityStatus_EncodedSecurityDescLen = 60,
+    FIX43_SecurityStatus_EncodedSecurityDesc = 61,
+    FIX43_SecurityStatus_Currency = 62,
+    FIX43_SecurityStatus_TradingSessionID = 63,
+    FIX43_SecurityStatus_TradingSessionSubID = 64,
+    FIX43_SecurityStatus_UnsolicitedIndicator = 65,
+    FIX43_SecurityStatus_SecurityTradingStatus = 66,
+    FIX43_SecurityStatus_FinancialStatus = 67,
+    FIX43_SecurityStatus_CorporateAction = 68,
+    FIX43_SecurityStatus_HaltReason = 69,
+    FIX43_SecurityStatus_InViewOfCommon = 70,
+    FIX43_SecurityStatus_DueToRelated = 71,
+    FIX43_SecurityStatus_BuyVolume = 72,
+    FIX43_SecurityStatus_SellVolume = 73,
+    FIX43_SecurityStatus_HighPx = 74,
+    FIX43_SecurityStatus_LowPx = 75,
+    FIX43_SecurityStatus_LastPx = 76,
+    FIX43_SecurityStatus_TransactTime = 77,
+    FIX43_SecurityStatus_Adjustment = 78,
+    FIX43_SecurityStatus_Text = 79,
+    FIX43_SecurityStatus_EncodedTextLen = 80,
+    FIX43_SecurityStatus_EncodedText = 81,
+    FIX43_SecurityStatus_SignatureLength = 82,
+    FIX43_SecurityStatus_Signature = 83,
+    FIX43_SecurityStatus_CheckSum = 84,
+};
+
+typedef struct _fix43SecurityStatus {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityStatusReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	UnsolicitedIndicator;
+    int64_t	SecurityTradingStatus;
+    struct _ofixStrView	FinancialStatus;
+    struct _ofixStrView	CorporateAction;
+    char	HaltReason;
+    char	InViewOfCommon;
+    char	DueToRelated;
+    struct _ofixDecimal	BuyVolume;
+    struct _ofixDecimal	SellVolume;
+    struct _ofixDecimal	HighPx;
+    struct _ofixDecimal	LowPx;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDate	TransactTime;
+    int64_t	Adjustment;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityStatus;
+
+extern void	fix43_decode_SecurityStatus(ofixErr err, fix43SecurityStatus m, const char *raw, int len);
+extern void	fix43_decode_SecurityStatus_msg(ofixErr err, fix43SecurityStatus m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityStatus(ofixErr err, fix43SecurityStatus m);
+
+// TradingSessionStatusRequest [g]
+enum {
+    FIX43_TradingSessionStatusRequest_BeginString = 0,
+    FIX43_TradingSessionStatusRequest_BodyLength = 1,
+    FIX43_TradingSessionStatusRequest_MsgType = 2,
+    FIX43_TradingSessionStatusRequest_SenderCompID = 3,
+    FIX43_TradingSessionStatusRequest_TargetCompID = 4,
+    FIX43_TradingSessionStatusRequest_OnBehalfOfCompID = 5,
+    FIX43_TradingSessionStatusRequest_DeliverToCompID = 6,
+    FIX43_TradingSessionStatusRequest_SecureDataLen = 7,
+    FIX43_TradingSessionStatusRequest_SecureData = 8,
+    FIX43_TradingSessionStatusRequest_MsgSeqNum = 9,
+    FIX43_TradingSessionStatusRequest_SenderSubID = 10,
+    FIX43_TradingSessionStatusRequest_SenderLocationID = 11,
+    FIX43_TradingSessionStatusRequest_TargetSubID = 12,
+    FIX43_TradingSessionStatusRequest_TargetLocationID = 13,
+    FIX43_TradingSessionStatusRequest_OnBehalfOfSubID = 14,
+    FIX43_TradingSessionStatusRequest_OnBehalfOfLocationID = 15,
+    FIX43_TradingSessionStatusRequest_DeliverToSubID = 16,
+    FIX43_TradingSessionStatusRequest_DeliverToLocationID = 17,
+    FIX43_TradingSessionStatusRequest_PossDupFlag = 18,
+    FIX43_TradingSessionStatusRequest_PossResend = 19,
+    FIX43_TradingSessionStatusRequest_SendingTime = 20,
+    FIX43_TradingSessionStatusRequest_OrigSendingTime = 21,
+    FIX43_TradingSessionStatusRequest_XmlDataLen = 22,
+    FIX43_TradingSessionStatusRequest_XmlData = 23,
+    FIX43_TradingSessionStatusRequest_MessageEncoding = 24,
+    FIX43_TradingSessionStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_TradingSessionStatusRequest_OnBehalfOfSendingTime = 26,
+    FIX43_TradingSessionStatusRequest_NoHops = 27,
+    FIX43_TradingSessionStatusRequest_TradSesReqID = 28,
+    FIX43_TradingSessionStatusRequest_TradingSessionID = 29,
+    FIX43_TradingSessionStatusRequest_TradingSessionSubID = 30,
+    FIX43_TradingSessionStatusRequest_TradSesMethod = 31,
+    FIX43_TradingSessionStatusRequest_TradSesMode = 32,
+    FIX43_TradingSessionStatusRequest_SubscriptionRequestType = 33,
+    FIX43_TradingSessionStatusRequest_SignatureLength = 34,
+    FIX43_TradingSessionStatusRequest_Signature = 35,
+    FIX43_TradingSessionStatusRequest_CheckSum = 36,
+};
+
+typedef struct _fix43TradingSessionStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	TradSesReqID;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	TradSesMethod;
+    int64_t	TradSesMode;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43TradingSessionStatusRequest;
+
+extern void	fix43_decode_TradingSessionStatusRequest(ofixErr err, fix43TradingSessionStatusRequest m, const char *raw, int len);
+extern void	fix43_decode_TradingSessionStatusRequest_msg(ofixErr err, fix43TradingSessionStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_TradingSessionStatusRequest(ofixErr err, fix43TradingSessionStatusRequest m);
+
+// TradingSessionStatus [h]
+enum {
+    FIX43_TradingSessionStatus_BeginString = 0,
+    FIX43_TradingSessionStatus_BodyLength = 1,
+    FIX43_TradingSessionStatus_MsgType = 2,
+    FIX43_TradingSessionStatus_SenderCompID = 3,
+    FIX43_TradingSessionStatus_TargetCompID = 4,
+    FIX43_TradingSessionStatus_OnBehalfOfCompID = 5,
+    FIX43_TradingSessionStatus_DeliverToCompID = 6,
+    FIX43_TradingSessionStatus_SecureDataLen = 7,
+    FIX43_TradingSessionStatus_SecureData = 8,
+    FIX43_TradingSessionStatus_MsgSeqNum = 9,
+    FIX43_TradingSessionStatus_SenderSubID = 10,
+    FIX43_TradingSessionStatus_SenderLocationID = 11,
+    FIX43_TradingSessionStatus_TargetSubID = 12,
+    FIX43_TradingSessionStatus_TargetLocationID = 13,
+    FIX43_TradingSessionStatus_OnBehalfOfSubID = 14,
+    FIX43_TradingSessionStatus_OnBehalfOfLocationID = 15,
+    FIX43_TradingSessionStatus_DeliverToSubID = 16,
+    FIX43_TradingSessionStatus_DeliverToLocationID = 17,
+    FIX43_TradingSessionStatus_PossDupFlag = 18,
+    FIX43_TradingSessionStatus_PossResend = 19,
+    FIX43_TradingSessionStatus_SendingTime = 20,
+    FIX43_TradingSessionStatus_OrigSendingTime = 21,
+    FIX43_TradingSessionStatus_XmlDataLen = 22,
+    FIX43_TradingSessionStatus_XmlData = 23,
+    FIX43_TradingSessionStatus_MessageEncoding = 24,
+    FIX43_TradingSessionStatus_LastMsgSeqNumProcessed = 25,
+    FIX43_TradingSessionStatus_OnBehalfOfSendingTime = 26,
+    FIX43_TradingSessionStatus_NoHops = 27,
+    FIX43_TradingSessionStatus_TradSesReqID = 28,
+    FIX43_TradingSessionStatus_TradingSessionID = 29,
+    FIX43_TradingSessionStatus_TradingSessionSubID = 30,
+    FIX43_TradingSessionStatus_TradSesMethod = 31,
+    FIX43_TradingSessionStatus_TradSesMode = 32,
+    FIX43_TradingSessionStatus_UnsolicitedIndicator = 33,
+    FIX43_TradingSessionStatus_TradSesStatus = 34,
+    FIX43_TradingSessionStatus_TradSesStatusRejReason = 35,
+    FIX43_TradingSessionStatus_TradSesStartTime = 36,
+    FIX43_TradingSessionStatus_TradSesOpenTime = 37,
+    FIX43_TradingSessionStatus_TradSesPreCloseTime = 38,
+    FIX43_TradingSessionStatus_TradSesCloseTime = 39,
+    FIX43_TradingSessionStatus_TradSesEndTime = 40,
+    FIX43_TradingSessionStatus_TotalVolumeTraded = 41,
+    FIX43_TradingSessionStatus_Text = 42,
+    FIX43_TradingSessionStatus_EncodedTextLen = 43,
+    FIX43_TradingSessionStatus_EncodedText = 44,
+    FIX43_TradingSessionStatus_SignatureLength = 45,
+    FIX43_TradingSessionStatus_Signature = 46,
+    FIX43_TradingSessionStatus_CheckSum = 47,
+};
+
+typedef struct _fix43TradingSessionStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	TradSesReqID;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	TradSesMethod;
+    int64_t	TradSesMode;
+    char	UnsolicitedIndicator;
+    int64_t	TradSesStatus;
+    int64_t	TradSesStatusRejReason;
+    struct _ofixDate	TradSesStartTime;
+    struct _ofixDate	TradSesOpenTime;
+    struct _ofixDate	TradSesPreCloseTime;
+    struct _ofixDate	TradSesCloseTime;
+    struct _ofixDate	TradSesEndTime;
+    struct _ofixDecimal	TotalVolumeTraded;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43TradingSessionStatus;
+
+extern void	fix43_decode_TradingSessionStatus(ofixErr err, fix43TradingSessionStatus m, const char *raw, int len);
+extern void	fix43_decode_TradingSessionStatus_msg(ofixErr err, fix43TradingSessionStatus m, ofixMsg msg);
+extern ofixMsg	fix43_encode_TradingSessionStatus(ofixErr err, fix43TradingSessionStatus m);
+
+// MassQuote [i]
+enum {
+    FIX43_MassQuote_BeginString = 0,
+    FIX43_MassQuote_BodyLength = 1,
+    FIX43_MassQuote_MsgType = 2,
+    FIX43_MassQuote_SenderCompID = 3,
+    FIX43_MassQuote_TargetCompID = 4,
+    FIX43_MassQuote_OnBehalfOfCompID = 5,
+    FIX43_MassQuote_DeliverToCompID = 6,
+    FIX43_MassQuote_SecureDataLen = 7,
+    FIX43_MassQuote_SecureData = 8,
+    FIX43_MassQuote_MsgSeqNum = 9,
+    FIX43_MassQuote_SenderSubID = 10,
+    FIX43_MassQuote_SenderLocationID = 11,
+    FIX43_MassQuote_TargetSubID = 12,
+    FIX43_MassQuote_TargetLocationID = 13,
+    FIX43_MassQuote_OnBehalfOfSubID = 14,
+    FIX43_MassQuote_OnBehalfOfLocationID = 15,
+    FIX43_MassQuote_DeliverToSubID = 16,
+    FIX43_MassQuote_DeliverToLocationID = 17,
+    FIX43_MassQuote_PossDupFlag = 18,
+    FIX43_MassQuote_PossResend = 19,
+    FIX43_MassQuote_SendingTime = 20,
+    FIX43_MassQuote_OrigSendingTime = 21,
+    FIX43_MassQuote_XmlDataLen = 22,
+    FIX43_MassQuote_XmlData = 23,
+    FIX43_MassQuote_MessageEncoding = 24,
+    FIX43_MassQuote_LastMsgSeqNumProcessed = 25,
+    FIX43_MassQuote_OnBehalfOfSendingTime = 26,
+    FIX43_MassQuote_NoHops = 27,
+    FIX43_MassQuote_QuoteReqID = 28,
+    FIX43_MassQuote_QuoteID = 29,
+    FIX43_MassQuote_QuoteType = 30,
+    FIX43_MassQuote_QuoteResponseLevel = 31,
+    FIX43_MassQuote_NoPartyIDs = 32,
+    FIX43_MassQuote_Account = 33,
+    FIX43_MassQuote_AccountType = 34,
+    FIX43_MassQuote_DefBidSize = 35,
+    FIX43_MassQuote_DefOfferSize = 36,
+    FIX43_MassQuote_NoQuoteSets = 37,
+    FIX43_MassQuote_SignatureLength = 38,
+    FIX43_MassQuote_Signature = 39,
+    FIX43_MassQuote_CheckSum = 40,
+};
+
+typedef struct _fix43MassQuote {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteType;
+    int64_t	QuoteResponseLevel;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixDecimal	DefBidSize;
+    struct _ofixDecimal	DefOfferSize;
+    int64_t	NoQuoteSets;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43MassQuote;
+
+extern void	fix43_decode_MassQuote(ofixErr err, fix43MassQuote m, const char *raw, int len);
+extern void	fix43_decode_MassQuote_msg(ofixErr err, fix43MassQuote m, ofixMsg msg);
+extern ofixMsg	fix43_encode_MassQuote(ofixErr err, fix43MassQuote m);
+
+// BusinessMessageReject [j]
+enum {
+    FIX43_BusinessMessageReject_BeginString = 0,
+    FIX43_BusinessMessageReject_BodyLength = 1,
+    FIX43_BusinessMessageReject_MsgType = 2,
+    FIX43_BusinessMessageReject_SenderCompID = 3,
+    FIX43_BusinessMessageReject_TargetCompID = 4,
+    FIX43_BusinessMessageReject_OnBehalfOfCompID = 5,
+    FIX43_BusinessMessageReject_DeliverToCompID = 6,
+    FIX43_BusinessMessageReject_SecureDataLen = 7,
+    FIX43_BusinessMessageReject_SecureData = 8,
+    FIX43_BusinessMessageReject_MsgSeqNum = 9,
+    FIX43_BusinessMessageReject_SenderSubID = 10,
+    FIX43_BusinessMessageReject_SenderLocationID = 11,
+    FIX43_BusinessMessageReject_TargetSubID = 12,
+    FIX43_BusinessMessageReject_TargetLocationID = 13,
+    FIX43_BusinessMessageReject_OnBehalfOfSubID = 14,
+    FIX43_BusinessMessageReject_OnBehalfOfLocationID = 15,
+    FIX43_BusinessMessageReject_DeliverToSubID = 16,
+    FIX43_BusinessMessageReject_DeliverToLocationID = 17,
+    FIX43_BusinessMessageReject_PossDupFlag = 18,
+    FIX43_BusinessMessageReject_PossResend = 19,
+    FIX43_BusinessMessageReject_SendingTime = 20,
+    FIX43_BusinessMessageReject_OrigSendingTime = 21,
+    FIX43_BusinessMessageReject_XmlDataLen = 22,
+    FIX43_BusinessMessageReject_XmlData = 23,
+    FIX43_BusinessMessageReject_MessageEncoding = 24,
+    FIX43_BusinessMessageReject_LastMsgSeqNumProcessed = 25,
+    FIX43_BusinessMessageReject_OnBehalfOfSendingTime = 26,
+    FIX43_BusinessMessageReject_NoHops = 27,
+    FIX43_BusinessMessageReject_RefSeqNum = 28,
+    FIX43_BusinessMessageReject_RefMsgType = 29,
+    FIX43_BusinessMessageReject_BusinessRejectRefID = 30,
+    FIX43_BusinessMessageReject_BusinessRejectReason = 31,
+    FIX43_BusinessMessageReject_Text = 32,
+    FIX43_BusinessMessageReject_EncodedTextLen = 33,
+    FIX43_BusinessMessageReject_EncodedText = 34,
+    FIX43_BusinessMessageReject_SignatureLength = 35,
+    FIX43_BusinessMessageReject_Signature = 36,
+    FIX43_BusinessMessageReject_CheckSum = 37,
+};
+
+typedef struct _fix43BusinessMessageReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    int64_t	RefSeqNum;
+    struct _ofixStrView	RefMsgType;
+    struct _ofixStrView	BusinessRejectRefID;
+    int64_t	BusinessRejectReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43BusinessMessageReject;
+
+extern void	fix43_decode_BusinessMessageReject(ofixErr err, fix43BusinessMessageReject m, const char *raw, int len);
+extern void	fix43_decode_BusinessMessageReject_msg(ofixErr err, fix43BusinessMessageReject m, ofixMsg msg);
+extern ofixMsg	fix43_encode_BusinessMessageReject(ofixErr err, fix43BusinessMessageReject m);
+
+// BidRequest [k]
+enum {
+    FIX43_BidRequest_BeginString = 0,
+    FIX43_BidRequest_BodyLength = 1,
+    FIX43_BidRequest_MsgType = 2,
+    FIX43_BidRequest_SenderCompID = 3,
+    FIX43_BidRequest_TargetCompID = 4,
+    FIX43_BidRequest_OnBehalfOfCompID = 5,
+    FIX43_BidRequest_DeliverToCompID = 6,
+    FIX43_BidRequest_SecureDataLen = 7,
+    FIX43_BidRequest_SecureData = 8,
+    FIX43_BidRequest_MsgSeqNum = 9,
+    FIX43_BidRequest_SenderSubID = 10,
+    FIX43_BidRequest_SenderLocationID = 11,
+    FIX43_BidRequest_TargetSubID = 12,
+    FIX43_BidRequest_TargetLocationID = 13,
+    FIX43_BidRequest_OnBehalfOfSubID = 14,
+    FIX43_BidRequest_OnBehalfOfLocationID = 15,
+    FIX43_BidRequest_DeliverToSubID = 16,
+    FIX43_BidRequest_DeliverToLocationID = 17,
+    FIX43_BidRequest_PossDupFlag = 18,
+    FIX43_BidRequest_PossResend = 19,
+    FIX43_BidRequest_SendingTime = 20,
+    FIX43_BidRequest_OrigSendingTime = 21,
+    FIX43_BidRequest_XmlDataLen = 22,
+    FIX43_BidRequest_XmlData = 23,
+    FIX43_BidRequest_MessageEncoding = 24,
+    FIX43_BidRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_BidRequest_OnBehalfOfSendingTime = 26,
+    FIX43_BidRequest_NoHops = 27,
+    FIX43_BidRequest_BidID = 28,
+    FIX43_BidRequest_ClientBidID = 29,
+    FIX43_BidRequest_BidRequestTransType = 30,
+    FIX43_BidRequest_ListName = 31,
+    FIX43_BidRequest_TotalNumSecurities = 32,
+    FIX43_BidRequest_BidType = 33,
+    FIX43_BidRequest_NumTickets = 34,
+    FIX43_BidRequest_Currency = 35,
+    FIX43_BidRequest_SideValue1 = 36,
+    FIX43_BidRequest_SideValue2 = 37,
+    FIX43_BidRequest_NoBidDescriptors = 38,
+    FIX43_BidRequest_NoBidComponents = 39,
+    FIX43_BidRequest_LiquidityIndType = 40,
+    FIX43_BidRequest_WtAverageLiquidity = 41,
+    FIX43_BidRequest_ExchangeForPhysical = 42,
+    FIX43_BidRequest_OutMainCntryUIndex = 43,
+    FIX43_BidRequest_CrossPercent = 44,
+    FIX43_BidRequest_ProgRptReqs = 45,
+    FIX43_BidRequest_ProgPeriodInterval = 46,
+    FIX43_BidRequest_IncTaxInd = 47,
+    FIX43_BidRequest_ForexReq = 48,
+    FIX43_BidRequest_NumBidders = 49,
+    FIX43_BidRequest_TradeDate = 50,
+    FIX43_BidRequest_TradeType = 51,
+    FIX43_BidRequest_BasisPxType = 52,
+    FIX43_BidRequest_StrikeTime = 53,
+    FIX43_BidRequest_Text = 54,
+    FIX43_BidRequest_EncodedTextLen = 55,
+    FIX43_BidRequest_EncodedText = 56,
+    FIX43_BidRequest_SignatureLength = 57,
+    FIX43_BidRequest_Signature = 58,
+    FIX43_BidRequest_CheckSum = 59,
+};
+
+typedef struct _fix43BidRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    char	BidRequestTransType;
+    struct _ofixStrView	ListName;
+    int64_t	TotalNumSecurities;
+    int64_t	BidType;
+    int64_t	NumTickets;
+    struct _ofixStrView	Currency;
+    struct _ofixDecimal	SideValue1;
+    struct _ofixDecimal	SideValue2;
+    int64_t	NoBidDescriptors;
+    int64_t	NoBidComponents;
+    int64_t	LiquidityIndType;
+    struct _ofixDecimal	WtAverageLiquidity;
+    char	ExchangeForPhysical;
+    struct _ofixDecimal	OutMainCntryUIndex;
+    struct _ofixDecimal	CrossPercent;
+    int64_t	ProgRptReqs;
+    int64_t	ProgPeriodInterval;
+    int64_t	IncTaxInd;
+    char	ForexReq;
+    int64_t	NumBidders;
+    struct _ofixStrView	TradeDate;
+    char	TradeType;
+    char	BasisPxType;
+    struct _ofixDate	StrikeTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43BidRequest;
+
+extern void	fix43_decode_BidRequest(ofixErr err, fix43BidRequest m, const char *raw, int len);
+extern void	fix43_decode_BidRequest_msg(ofixErr err, fix43BidRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_BidRequest(ofixErr err, fix43BidRequest m);
+
+// BidResponse [l]
+enum {
+    FIX43_BidResponse_BeginString = 0,
+    FIX43_BidResponse_BodyLength = 1,
+    FIX43_BidResponse_MsgType = 2,
+    FIX43_BidResponse_SenderCompID = 3,
+    FIX43_BidResponse_TargetCompID = 4,
+    FIX43_BidResponse_OnBehalfOfCompID = 5,
+    FIX43_BidResponse_DeliverToCompID = 6,
+    FIX43_BidResponse_SecureDataLen = 7,
+    FIX43_BidResponse_SecureData = 8,
+    FIX43_BidResponse_MsgSeqNum = 9,
+    FIX43_BidResponse_SenderSubID = 10,
+    FIX43_BidResponse_SenderLocationID = 11,
+    FIX43_BidResponse_TargetSubID = 12,
+    FIX43_BidResponse_TargetLocationID = 13,
+    FIX43_BidResponse_OnBehalfOfSubID = 14,
+    FIX43_BidResponse_OnBehalfOfLocationID = 15,
+    FIX43_BidResponse_DeliverToSubID = 16,
+    FIX43_BidResponse_DeliverToLocationID = 17,
+    FIX43_BidResponse_PossDupFlag = 18,
+    FIX43_BidResponse_PossResend = 19,
+    FIX43_BidResponse_SendingTime = 20,
+    FIX43_BidResponse_OrigSendingTime = 21,
+    FIX43_BidResponse_XmlDataLen = 22,
+    FIX43_BidResponse_XmlData = 23,
+    FIX43_BidResponse_MessageEncoding = 24,
+    FIX43_BidResponse_LastMsgSeqNumProcessed = 25,
+    FIX43_BidResponse_OnBehalfOfSendingTime = 26,
+    FIX43_BidResponse_NoHops = 27,
+    FIX43_BidResponse_BidID = 28,
+    FIX43_BidResponse_ClientBidID = 29,
+    FIX43_BidResponse_NoBidComponents = 30,
+    FIX43_BidResponse_SignatureLength = 31,
+    FIX43_BidResponse_Signature = 32,
+    FIX43_BidResponse_CheckSum = 33,
+};
+
+typedef struct _fix43BidResponse {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    int64_t	NoBidComponents;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43BidResponse;
+
+extern void	fix43_decode_BidResponse(ofixErr err, fix43BidResponse m, const char *raw, int len);
+extern void	fix43_decode_BidResponse_msg(ofixErr err, fix43BidResponse m, ofixMsg msg);
+extern ofixMsg	fix43_encode_BidResponse(ofixErr err, fix43BidResponse m);
+
+// ListStrikePrice [m]
+enum {
+    FIX43_ListStrikePrice_BeginString = 0,
+    FIX43_ListStrikePrice_BodyLength = 1,
+    FIX43_ListStrikePrice_MsgType = 2,
+    FIX43_ListStrikePrice_SenderCompID = 3,
+    FIX43_ListStrikePrice_TargetCompID = 4,
+    FIX43_ListStrikePrice_OnBehalfOfCompID = 5,
+    FIX43_ListStrikePrice_DeliverToCompID = 6,
+    FIX43_ListStrikePrice_SecureDataLen = 7,
+    FIX43_ListStrikePrice_SecureData = 8,
+    FIX43_ListStrikePrice_MsgSeqNum = 9,
+    FIX43_ListStrikePrice_SenderSubID = 10,
+    FIX43_ListStrikePrice_SenderLocationID = 11,
+    FIX43_ListStrikePrice_TargetSubID = 12,
+    FIX43_ListStrikePrice_TargetLocationID = 13,
+    FIX43_ListStrikePrice_OnBehalfOfSubID = 14,
+    FIX43_ListStrikePrice_OnBehalfOfLocationID = 15,
+    FIX43_ListStrikePrice_DeliverToSubID = 16,
+    FIX43_ListStrikePrice_DeliverToLocationID = 17,
+    FIX43_ListStrikePrice_PossDupFlag = 18,
+    FIX43_ListStrikePrice_PossResend = 19,
+    FIX43_ListStrikePrice_SendingTime = 20,
+    FIX43_ListStrikePrice_OrigSendingTime = 21,
+    FIX43_ListStrikePrice_XmlDataLen = 22,
+    FIX43_ListStrikePrice_XmlData = 23,
+    FIX43_ListStrikePrice_MessageEncoding = 24,
+    FIX43_ListStrikePrice_LastMsgSeqNumProcessed = 25,
+    FIX43_ListStrikePrice_OnBehalfOfSendingTime = 26,
+    FIX43_ListStrikePrice_NoHops = 27,
+    FIX43_ListStrikePrice_ListID = 28,
+    FIX43_ListStrikePrice_TotNoStrikes = 29,
+    FIX43_ListStrikePrice_NoStrikes = 30,
+    FIX43_ListStrikePrice_SignatureLength = 31,
+    FIX43_ListStrikePrice_Signature = 32,
+    FIX43_ListStrikePrice_CheckSum = 33,
+};
+
+typedef struct _fix43ListStrikePrice {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    int64_t	TotNoStrikes;
+    int64_t	NoStrikes;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43ListStrikePrice;
+
+extern void	fix43_decode_ListStrikePrice(ofixErr err, fix43ListStrikePrice m, const char *raw, int len);
+extern void	fix43_decode_ListStrikePrice_msg(ofixErr err, fix43ListStrikePrice m, ofixMsg msg);
+extern ofixMsg	fix43_encode_ListStrikePrice(ofixErr err, fix43ListStrikePrice m);
+
+// RegistrationInstructions [o]
+enum {
+    FIX43_RegistrationInstructions_BeginString = 0,
+    FIX43_RegistrationInstructions_BodyLength = 1,
+    FIX43_RegistrationInstructions_MsgType = 2,
+    FIX43_RegistrationInstructions_SenderCompID = 3,
+    FIX43_RegistrationInstructions_TargetCompID = 4,
+    FIX43_RegistrationInstructions_OnBehalfOfCompID = 5,
+    FIX43_RegistrationInstructions_DeliverToCompID = 6,
+    FIX43_RegistrationInstructions_SecureDataLen = 7,
+    FIX43_RegistrationInstructions_SecureData = 8,
+    FIX43_RegistrationInstructions_MsgSeqNum = 9,
+    FIX43_RegistrationInstructions_SenderSubID = 10,
+    FIX43_RegistrationInstructions_SenderLocationID = 11,
+    FIX43_RegistrationInstructions_TargetSubID = 12,
+    FIX43_RegistrationInstructions_TargetLocationID = 13,
+    FIX43_RegistrationInstructions_OnBehalfOfSubID = 14,
+    FIX43_RegistrationInstructions_OnBehalfOfLocationID = 15,
+    FIX43_RegistrationInstructions_DeliverToSubID = 16,
+    FIX43_RegistrationInstructions_DeliverToLocationID = 17,
+    FIX43_RegistrationInstructions_PossDupFlag = 18,
+    FIX43_RegistrationInstructions_PossResend = 19,
+    FIX43_RegistrationInstructions_SendingTime = 20,
+    FIX43_RegistrationInstructions_OrigSendingTime = 21,
+    FIX43_RegistrationInstructions_XmlDataLen = 22,
+    FIX43_RegistrationInstructions_XmlData = 23,
+    FIX43_RegistrationInstructions_MessageEncoding = 24,
+    FIX43_RegistrationInstructions_LastMsgSeqNumProcessed = 25,
+    FIX43_RegistrationInstructions_OnBehalfOfSendingTime = 26,
+    FIX43_RegistrationInstructions_NoHops = 27,
+    FIX43_RegistrationInstructions_RegistID = 28,
+    FIX43_RegistrationInstructions_RegistTransType = 29,
+    FIX43_RegistrationInstructions_RegistRefID = 30,
+    FIX43_RegistrationInstructions_ClOrdID = 31,
+    FIX43_RegistrationInstructions_NoPartyIDs = 32,
+    FIX43_RegistrationInstructions_Account = 33,
+    FIX43_RegistrationInstructions_RegistAcctType = 34,
+    FIX43_RegistrationInstructions_TaxAdvantageType = 35,
+    FIX43_RegistrationInstructions_OwnershipType = 36,
+    FIX43_RegistrationInstructions_NoRegistDtls = 37,
+    FIX43_RegistrationInstructions_NoDistribInsts = 38,
+    FIX43_RegistrationInstructions_SignatureLength = 39,
+    FIX43_RegistrationInstructions_Signature = 40,
+    FIX43_RegistrationInstructions_CheckSum = 41,
+};
+
+typedef struct _fix43RegistrationInstructions {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	RegistID;
+    char	RegistTransType;
+    struct _ofixStrView	RegistRefID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    struct _ofixStrView	RegistAcctType;
+    int64_t	TaxAdvantageType;
+    char	OwnershipType;
+    int64_t	NoRegistDtls;
+    int64_t	NoDistribInsts;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43RegistrationInstructions;
+
+extern void	fix43_decode_RegistrationInstructions(ofixErr err, fix43RegistrationInstructions m, const char *raw, int len);
+extern void	fix43_decode_RegistrationInstructions_msg(ofixErr err, fix43RegistrationInstructions m, ofixMsg msg);
+extern ofixMsg	fix43_encode_RegistrationInstructions(ofixErr err, fix43RegistrationInstructions m);
+
+// RegistrationInstructionsResponse [p]
+enum {
+    FIX43_RegistrationInstructionsResponse_BeginString = 0,
+    FIX43_RegistrationInstructionsResponse_BodyLength = 1,
+    FIX43_RegistrationInstructionsResponse_MsgType = 2,
+    FIX43_RegistrationInstructionsResponse_SenderCompID = 3,
+    FIX43_RegistrationInstructionsResponse_TargetCompID = 4,
+    FIX43_RegistrationInstructionsResponse_OnBehalfOfCompID = 5,
+    FIX43_RegistrationInstructionsResponse_DeliverToCompID = 6,
+    FIX43_RegistrationInstructionsResponse_SecureDataLen = 7,
+    FIX43_RegistrationInstructionsResponse_SecureData = 8,
+    FIX43_RegistrationInstructionsResponse_MsgSeqNum = 9,
+    FIX43_RegistrationInstructionsResponse_SenderSubID = 10,
+    FIX43_RegistrationInstructionsResponse_SenderLocationID = 11,
+    FIX43_RegistrationInstructionsResponse_TargetSubID = 12,
+    FIX43_RegistrationInstructionsResponse_TargetLocationID = 13,
+    FIX43_RegistrationInstructionsResponse_OnBehalfOfSubID = 14,
+    FIX43_RegistrationInstructionsResponse_OnBehalfOfLocationID = 15,
+    FIX43_RegistrationInstructionsResponse_DeliverToSubID = 16,
+    FIX43_RegistrationInstructionsResponse_DeliverToLocationID = 17,
+    FIX43_RegistrationInstructionsResponse_PossDupFlag = 18,
+    FIX43_RegistrationInstructionsResponse_PossResend = 19,
+    FIX43_RegistrationInstructionsResponse_SendingTime = 20,
+    FIX43_RegistrationInstructionsResponse_OrigSendingTime = 21,
+    FIX43_RegistrationInstructionsResponse_XmlDataLen = 22,
+    FIX43_RegistrationInstructionsResponse_XmlData = 23,
+    FIX43_RegistrationInstructionsResponse_MessageEncoding = 24,
+    FIX43_RegistrationInstructionsResponse_LastMsgSeqNumProcessed = 25,
+    FIX43_RegistrationInstructionsResponse_OnBehalfOfSendingTime = 26,
+    FIX43_RegistrationInstructionsResponse_NoHops = 27,
+    FIX43_RegistrationInstructionsResponse_RegistID = 28,
+    FIX43_RegistrationInstructionsResponse_RegistTransType = 29,
+    FIX43_RegistrationInstructionsResponse_RegistRefID = 30,
+    FIX43_RegistrationInstructionsResponse_ClOrdID = 31,
+    FIX43_RegistrationInstructionsResponse_NoPartyIDs = 32,
+    FIX43_RegistrationInstructionsResponse_Account = 33,
+    FIX43_RegistrationInstructionsResponse_RegistStatus = 34,
+    FIX43_RegistrationInstructionsResponse_RegistRejReasonCode = 35,
+    FIX43_RegistrationInstructionsResponse_RegistRejReasonText = 36,
+    FIX43_RegistrationInstructionsResponse_SignatureLength = 37,
+    FIX43_RegistrationInstructionsResponse_Signature = 38,
+    FIX43_RegistrationInstructionsResponse_CheckSum = 39,
+};
+
+typedef struct _fix43RegistrationInstructionsResponse {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	RegistID;
+    char	RegistTransType;
+    struct _ofixStrView	RegistRefID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    char	RegistStatus;
+    int64_t	RegistRejReasonCode;
+    struct _ofixStrView	RegistRejReasonText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43RegistrationInstructionsResponse;
+
+extern void	fix43_decode_RegistrationInstructionsResponse(ofixErr err, fix43RegistrationInstructionsResponse m, const char *raw, int len);
+extern void	fix43_decode_RegistrationInstructionsResponse_msg(ofixErr err, fix43RegistrationInstructionsResponse m, ofixMsg msg);
+extern ofixMsg	fix43_encode_RegistrationInstructionsResponse(ofixErr err, fix43RegistrationInstructionsResponse m);
+
+// OrderMassCancelRequest [q]
+enum {
+    FIX43_OrderMassCancelRequest_BeginString = 0,
+    FIX43_OrderMassCancelRequest_BodyLength = 1,
+    FIX43_OrderMassCancelRequest_MsgType = 2,
+    FIX43_OrderMassCancelRequest_SenderCompID = 3,
+    FIX43_OrderMassCancelRequest_TargetCompID = 4,
+    FIX43_OrderMassCancelRequest_OnBehalfOfCompID = 5,
+    FIX43_OrderMassCancelRequest_DeliverToCompID = 6,
+    FIX43_OrderMassCancelRequest_SecureDataLen = 7,
+    FIX43_OrderMassCancelRequest_SecureData = 8,
+    FIX43_OrderMassCancelRequest_MsgSeqNum = 9,
+    FIX43_OrderMassCancelRequest_SenderSubID = 10,
+    FIX43_OrderMassCancelRequest_SenderLocationID = 11,
+    FIX43_OrderMassCancelRequest_TargetSubID = 12,
+    FIX43_OrderMassCancelRequest_TargetLocationID = 13,
+    FIX43_OrderMassCancelRequest_OnBehalfOfSubID = 14,
+    FIX43_OrderMassCancelRequest_OnBehalfOfLocationID = 15,
+    FIX43_OrderMassCancelRequest_DeliverToSubID = 16,
+    FIX43_OrderMassCancelRequest_DeliverToLocationID = 17,
+    FIX43_OrderMassCancelRequest_PossDupFlag = 18,
+    FIX43_OrderMassCancelRequest_PossResend = 19,
+    FIX43_OrderMassCancelRequest_SendingTime = 20,
+    FIX43_OrderMassCancelRequest_OrigSendingTime = 21,
+    FIX43_OrderMassCancelRequest_XmlDataLen = 22,
+    FIX43_OrderMassCancelRequest_XmlData = 23,
+    FIX43_OrderMassCancelRequest_MessageEncoding = 24,
+    FIX43_OrderMassCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_OrderMassCancelRequest_OnBehalfOfSendingTime = 26,
+    FIX43_OrderMassCancelRequest_NoHops = 27,
+    FIX43_OrderMassCancelRequest_ClOrdID = 28,
+    FIX43_OrderMassCancelRequest_SecondaryClOrdID = 29,
+    FIX43_OrderMassCancelRequest_MassCancelRequestType = 30,
+    FIX43_OrderMassCancelRequest_TradingSessionID = 31,
+    FIX43_OrderMassCancelRequest_TradingSessionSubID = 32,
+    FIX43_OrderMassCancelRequest_Symbol = 33,
+    FIX43_OrderMassCancelRequest_SymbolSfx = 34,
+    FIX43_OrderMassCancelRequest_SecurityID = 35,
+    FIX43_OrderMassCancelRequest_SecurityIDSource = 36,
+    FIX43_OrderMassCancelRequest_NoSecurityAltID = 37,
+    FIX43_OrderMassCancelRequest_Product = 38,
+    FIX43_OrderMassCancelRequest_CFICode = 39,
+    FIX43_OrderMassCancelRequest_SecurityType = 40,
+    FIX43_OrderMassCancelRequest_MaturityMonthYear = 41,
+    FIX43_OrderMassCancelRequest_MaturityDate = 42,
+    FIX43_OrderMassCancelRequest_CouponPaymentDate = 43,
+    FIX43_OrderMassCancelRequest_IssueDate = 44,
+    FIX43_OrderMassCancelRequest_RepoCollateralSecurityType = 45,
+    FIX43_OrderMassCancelRequest_RepurchaseTerm = 46,
+    FIX43_OrderMassCancelRequest_RepurchaseRate = 47,
+    FIX43_OrderMassCancelRequest_Factor = 48,
+    FIX43_OrderMassCancelRequest_CreditRating = 49,
+    FIX43_OrderMassCancelRequest_InstrRegistry = 50,
+    FIX43_OrderMassCancelRequest_CountryOfIssue = 51,
+    FIX43_OrderMassCancelRequest_StateOrProvinceOfIssue = 52,
+    FIX43_OrderMassCancelRequest_LocaleOfIssue = 53,
+    FIX43_OrderMassCancelRequest_RedemptionDate = 54,
+    FIX43_OrderMassCancelRequest_StrikePrice = 55,
+    FIX43_OrderMassCancelRequest_OptAttribute = 56,
+    FIX43_OrderMassCancelRequest_ContractMultiplier = 57,
+    FIX43_OrderMassCancelRequest_CouponRate = 58,
+    FIX43_OrderMassCancelRequest_SecurityExchange = 59,
+    FIX43_OrderMassCancelRequest_Issuer = 60,
+    FIX43_OrderMassCancelRequest_EncodedIssuerLen = 61,
+    FIX43_OrderMassCancelRequest_EncodedIssuer = 62,
+    FIX43_OrderMassCancelRequest_SecurityDesc = 63,
+    FIX43_OrderMassCancelRequest_EncodedSecurityDescLen = 64,
+    FIX43_OrderMassCancelRequest_EncodedSecurityDesc = 65,
+    FIX43_OrderMassCancelRequest_UnderlyingSymbol = 66,
+    FIX43_OrderMassCancelRequest_UnderlyingSymbolSfx = 67,
+    FIX43_OrderMassCancelRequest_UnderlyingSecurityID = 68,
+    FIX43_OrderMassCancelRequest_UnderlyingSecurityIDSource = 69,
+    FIX43_OrderMassCancelRequest_NoUnderlyingSecurityAltID = 70,
+    FIX43_OrderMassCancelRequest_UnderlyingProduct = 71,
+    FIX43_OrderMassCancelRequest_UnderlyingCFICode = 72,
+    FIX43_OrderMassCancelRequest_UnderlyingSecurityType = 73,
+    FIX43_OrderMassCancelRequest_UnderlyingMaturityMonthYear = 74,
+    FIX43_OrderMassCancelRequest_UnderlyingMaturityDate = 75,
+    FIX43_OrderMassCancelRequest_UnderlyingCouponPaymentDate = 76,
+    FIX43_OrderMassCancelRequest_UnderlyingIssueDate = 77,
+    FIX43_OrderMassCancelRequest_UnderlyingRepoCollateralSecurityType = 78,
+    FIX43_OrderMassCancelRequest_UnderlyingRepurchaseTerm = 79,
+    FIX43_OrderMassCancelRequest_UnderlyingRepurchaseRate = 80,
+    FIX43_OrderMassCancelRequest_UnderlyingFactor = 81,
+    FIX43_OrderMassCancelRequest_UnderlyingCreditRating = 82,
+    FIX43_OrderMassCancelRequest_UnderlyingInstrRegistry = 83,
+    FIX43_OrderMassCancelRequest_UnderlyingCountryOfIssue = 84,
+    FIX43_OrderMassCancelRequest_UnderlyingStateOrProvinceOfIssue = 85,
+    FIX43_OrderMassCancelRequest_UnderlyingLocaleOfIssue = 86,
+    FIX43_OrderMassCancelRequest_UnderlyingRedemptionDate = 87,
+    FIX43_OrderMassCancelRequest_UnderlyingPutOrCall = 88,
+    FIX43_OrderMassCancelRequest_UnderlyingStrikePrice = 89,
+    FIX43_OrderMassCancelRequest_UnderlyingOptAttribute = 90,
+    FIX43_OrderMassCancelRequest_UnderlyingContractMultiplier = 91,
+    FIX43_OrderMassCancelRequest_UnderlyingCouponRate = 92,
+    FIX43_OrderMassCancelRequest_UnderlyingSecurityExchange = 93,
+    FIX43_OrderMassCancelRequest_UnderlyingIssuer = 94,
+    FIX43_OrderMassCancelRequest_EncodedUnderlyingIssuerLen = 95,
+    FIX43_OrderMassCancelRequest_EncodedUnderlyingIssuer = 96,
+    FIX43_OrderMassCancelRequest_UnderlyingSecurityDesc = 97,
+    FIX43_OrderMassCancelRequest_EncodedUnderlyingSecurityDescLen = 98,
+    FIX43_OrderMassCancelRequest_EncodedUnderlyingSecurityDesc = 99,
+    FIX43_OrderMassCancelRequest_Side = 100,
+    FIX43_OrderMassCancelRequest_TransactTime = 101,
+    FIX43_OrderMassCancelRequest_Text = 102,
+    FIX43_OrderMassCancelRequest_EncodedTextLen = 103,
+    FIX43_OrderMassCancelRequest_EncodedText = 104,
+    FIX43_OrderMassCancelRequest_SignatureLength = 105,
+    FIX43_OrderMassCancelRequest_Signature = 106,
+    FIX43_OrderMassCancelRequest_CheckSum = 107,
+};
+
+typedef struct _fix43OrderMassCancelRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    char	MassCancelRequestType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixDate	UnderlyingCouponPaymentDate;
+    struct _ofixDate	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixDate	UnderlyingRedemptionDate;
+    int64_t	UnderlyingPutOrCall;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43OrderMassCancelRequest;
+
+extern void	fix43_decode_OrderMassCancelRequest(ofixErr err, fix43OrderMassCancelRequest m, const char *raw, int len);
+extern void	fix43_decode_OrderMassCancelRequest_msg(ofixErr err, fix43OrderMassCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_OrderMassCancelRequest(ofixErr err, fix43OrderMassCancelRequest m);
+
+// OrderMassCancelReport [r]
+enum {
+    FIX43_OrderMassCancelReport_BeginString = 0,
+    FIX43_OrderMassCancelReport_BodyLength = 1,
+    FIX43_OrderMassCancelReport_MsgType = 2,
+    FIX43_OrderMassCancelReport_SenderCompID = 3,
+    FIX43_OrderMassCancelReport_TargetCompID = 4,
+    FIX43_OrderMassCancelReport_OnBehalfOfCompID = 5,
+    FIX43_OrderMassCancelReport_DeliverToCompID = 6,
+    FIX43_OrderMassCancelReport_SecureDataLen = 7,
+    FIX43_OrderMassCancelReport_SecureData = 8,
+    FIX43_OrderMassCancelReport_MsgSeqNum = 9,
+    FIX43_OrderMassCancelReport_SenderSubID = 10,
+    FIX43_OrderMassCancelReport_SenderLocationID = 11,
+    FIX43_OrderMassCancelReport_TargetSubID = 12,
+    FIX43_OrderMassCancelReport_TargetLocationID = 13,
+    FIX43_OrderMassCancelReport_OnBehalfOfSubID = 14,
+    FIX43_OrderMassCancelReport_OnBehalfOfLocationID = 15,
+    FIX43_OrderMassCancelReport_DeliverToSubID = 16,
+    FIX43_OrderMassCancelReport_DeliverToLocationID = 17,
+    FIX43_OrderMassCancelReport_PossDupFlag = 18,
+    FIX43_OrderMassCancelReport_PossResend = 19,
+    FIX43_OrderMassCancelReport_SendingTime = 20,
+    FIX43_OrderMassCancelReport_OrigSendingTime = 21,
+    FIX43_OrderMassCancelReport_XmlDataLen = 22,
+    FIX43_OrderMassCancelReport_XmlData = 23,
+    FIX43_OrderMassCancelReport_MessageEncoding = 24,
+    FIX43_OrderMassCancelReport_LastMsgSeqNumProcessed = 25,
+    FIX43_OrderMassCancelReport_OnBehalfOfSendingTime = 26,
+    FIX43_OrderMassCancelReport_NoHops = 27,
+    FIX43_OrderMassCancelReport_ClOrdID = 28,
+    FIX43_OrderMassCancelReport_SecondaryClOrdID = 29,
+    FIX43_OrderMassCancelReport_OrderID = 30,
+    FIX43_OrderMassCancelReport_SecondaryOrderID = 31,
+    FIX43_OrderMassCancelReport_MassCancelRequestType = 32,
+    FIX43_OrderMassCancelReport_MassCancelResponse = 33,
+    FIX43_OrderMassCancelReport_MassCancelRejectReason = 34,
+    FIX43_OrderMassCancelReport_TotalAffectedOrders = 35,
+    FIX43_OrderMassCancelReport_NoAffectedOrders = 36,
+    FIX43_OrderMassCancelReport_TradingSessionID = 37,
+    FIX43_OrderMassCancelReport_TradingSessionSubID = 38,
+    FIX43_OrderMassCancelReport_Symbol = 39,
+    FIX43_OrderMassCancelReport_SymbolSfx = 40,
+    FIX43_OrderMassCancelReport_SecurityID = 41,
+    FIX43_OrderMassCancelReport_SecurityIDSource = 42,
+    FIX43_OrderMassCancelReport_NoSecurityAltID = 43,
+    FIX43_OrderMassCancelReport_Product = 44,
+    FIX43_OrderMassCancelReport_CFICode = 45,
+    FIX43_OrderMassCancelReport_SecurityType = 46,
+    FIX43_OrderMassCancelReport_MaturityMonthYear = 47,
+    FIX43_OrderMassCancelReport_MaturityDate = 48,
+    FIX43_OrderMassCancelReport_CouponPaymentDate = 49,
+    FIX43_OrderMassCancelReport_IssueDate = 50,
+    FIX43_OrderMassCancelReport_RepoCollateralSecurityType = 51,
+    FIX43_OrderMassCancelReport_RepurchaseTerm = 52,
+    FIX43_OrderMassCancelReport_RepurchaseRate = 53,
+    FIX43_OrderMassCancelReport_Factor = 54,
+    FIX43_OrderMassCancelReport_CreditRating = 55,
+    FIX43_OrderMassCancelReport_InstrRegistry = 56,
+    FIX43_OrderMassCancelReport_CountryOfIssue = 57,
+    FIX43_OrderMassCancelReport_StateOrProvinceOfIssue = 58,
+    FIX43_OrderMassCancelReport_LocaleOfIssue = 59,
+    FIX43_OrderMassCancelReport_RedemptionDate = 60,
+    FIX43_OrderMassCancelReport_StrikePrice = 61,
+    FIX43_OrderMassCancelReport_OptAttribute = 62,
+    FIX43_OrderMassCancelReport_ContractMultiplier = 63,
+    FIX43_OrderMassCancelReport_CouponRate = 64,
+    FIX43_OrderMassCancelReport_SecurityExchange = 65,
+    FIX43_OrderMassCancelReport_Issuer = 66,
+    FIX43_OrderMassCancelReport_EncodedIssuerLen = 67,
+    FIX43_OrderMassCancelReport_EncodedIssuer = 68,
+    FIX43_OrderMassCancelReport_SecurityDesc = 69,
+    FIX43_OrderMassCancelReport_EncodedSecurityDescLen = 70,
+    FIX43_OrderMassCancelReport_EncodedSecurityDesc = 71,
+    FIX43_OrderMassCancelReport_UnderlyingSymbol = 72,
+    FIX43_OrderMassCancelReport_UnderlyingSymbolSfx = 73,
+    FIX43_OrderMassCancelReport_UnderlyingSecurityID = 74,
+    FIX43_OrderMassCancelReport_UnderlyingSecurityIDSource = 75,
+    FIX43_OrderMassCancelReport_NoUnderlyingSecurityAltID = 76,
+    FIX43_OrderMassCancelReport_UnderlyingProduct = 77,
+    FIX43_OrderMassCancelReport_UnderlyingCFICode = 78,
+    FIX43_OrderMassCancelReport_UnderlyingSecurityType = 79,
+    FIX43_OrderMassCancelReport_UnderlyingMaturityMonthYear = 80,
+    FIX43_OrderMassCancelReport_UnderlyingMaturityDate = 81,
+    FIX43_OrderMassCancelReport_UnderlyingCouponPaymentDate = 82,
+    FIX43_OrderMassCancelReport_UnderlyingIssueDate = 83,
+    FIX43_OrderMassCancelReport_UnderlyingRepoCollateralSecurityType = 84,
+    FIX43_OrderMassCancelReport_UnderlyingRepurchaseTerm = 85,
+    FIX43_OrderMassCancelReport_UnderlyingRepurchaseRate = 86,
+    FIX43_OrderMassCancelReport_UnderlyingFactor = 87,
+    FIX43_OrderMassCancelReport_UnderlyingCreditRating = 88,
+    FIX43_OrderMassCancelReport_UnderlyingInstrRegistry = 89,
+    FIX43_OrderMassCancelReport_UnderlyingCountryOfIssue = 90,
+    FIX43_OrderMassCancelReport_UnderlyingStateOrProvinceOfIssue = 91,
+    FIX43_OrderMassCancelReport_UnderlyingLocaleOfIssue = 92,
+    FIX43_OrderMassCancelReport_UnderlyingRedemptionDate = 93,
+    FIX43_OrderMassCancelReport_UnderlyingPutOrCall = 94,
+    FIX43_OrderMassCancelReport_UnderlyingStrikePrice = 95,
+    FIX43_OrderMassCancelReport_UnderlyingOptAttribute = 96,
+    FIX43_OrderMassCancelReport_UnderlyingContractMultiplier = 97,
+    FIX43_OrderMassCancelReport_UnderlyingCouponRate = 98,
+    FIX43_OrderMassCancelReport_UnderlyingSecurityExchange = 99,
+    FIX43_OrderMassCancelReport_UnderlyingIssuer = 100,
+    FIX43_OrderMassCancelReport_EncodedUnderlyingIssuerLen = 101,
+    FIX43_OrderMassCancelReport_EncodedUnderlyingIssuer = 102,
+    FIX43_OrderMassCancelReport_UnderlyingSecurityDesc = 103,
+    FIX43_OrderMassCancelReport_EncodedUnderlyingSecurityDescLen = 104,
+    FIX43_OrderMassCancelReport_EncodedUnderlyingSecurityDesc = 105,
+    FIX43_OrderMassCancelReport_Side = 106,
+    FIX43_OrderMassCancelReport_TransactTime = 107,
+    FIX43_OrderMassCancelReport_Text = 108,
+    FIX43_OrderMassCancelReport_EncodedTextLen = 109,
+    FIX43_OrderMassCancelReport_EncodedText = 110,
+    FIX43_OrderMassCancelReport_SignatureLength = 111,
+    FIX43_OrderMassCancelReport_Signature = 112,
+    FIX43_OrderMassCancelReport_CheckSum = 113,
+};
+
+typedef struct _fix43OrderMassCancelReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    char	MassCancelRequestType;
+    char	MassCancelResponse;
+    char	MassCancelRejectReason;
+    int64_t	TotalAffectedOrders;
+    int64_t	NoAffectedOrders;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixDate	UnderlyingCouponPaymentDate;
+    struct _ofixDate	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixDate	UnderlyingRedemptionDate;
+    int64_t	UnderlyingPutOrCall;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43OrderMassCancelReport;
+
+extern void	fix43_decode_OrderMassCancelReport(ofixErr err, fix43OrderMassCancelReport m, const char *raw, int len);
+extern void	fix43_decode_OrderMassCancelReport_msg(ofixErr err, fix43OrderMassCancelReport m, ofixMsg msg);
+extern ofixMsg	fix43_encode_OrderMassCancelReport(ofixErr err, fix43OrderMassCancelReport m);
+
+// NewOrderCross [s]
+enum {
+    FIX43_NewOrderCross_BeginString = 0,
+    FIX43_NewOrderCross_BodyLength = 1,
+    FIX43_NewOrderCross_MsgType = 2,
+    FIX43_NewOrderCross_SenderCompID = 3,
+    FIX43_NewOrderCross_TargetCompID = 4,
+    FIX43_NewOrderCross_OnBehalfOfCompID = 5,
+    FIX43_NewOrderCross_DeliverToCompID = 6,
+    FIX43_NewOrderCross_SecureDataLen = 7,
+    FIX43_NewOrderCross_SecureData = 8,
+    FIX43_NewOrderCross_MsgSeqNum = 9,
+    FIX43_NewOrderCross_SenderSubID = 10,
+    FIX43_NewOrderCross_SenderLocationID = 11,
+    FIX43_NewOrderCross_TargetSubID = 12,
+    FIX43_NewOrderCross_TargetLocationID = 13,
+    FIX43_NewOrderCross_OnBehalfOfSubID = 14,
+    FIX43_NewOrderCross_OnBehalfOfLocationID = 15,
+    FIX43_NewOrderCross_DeliverToSubID = 16,
+    FIX43_NewOrderCross_DeliverToLocationID = 17,
+    FIX43_NewOrderCross_PossDupFlag = 18,
+    FIX43_NewOrderCross_PossResend = 19,
+    FIX43_NewOrderCross_SendingTime = 20,
+    FIX43_NewOrderCross_OrigSendingTime = 21,
+    FIX43_NewOrderCross_XmlDataLen = 22,
+    FIX43_NewOrderCross_XmlData = 23,
+    FIX43_NewOrderCross_MessageEncoding = 24,
+    FIX43_NewOrderCross_LastMsgSeqNumProcessed = 25,
+    FIX43_NewOrderCross_OnBehalfOfSendingTime = 26,
+    FIX43_NewOrderCross_NoHops = 27,
+    FIX43_NewOrderCross_CrossID = 28,
+    FIX43_NewOrderCross_CrossType = 29,
+    FIX43_NewOrderCross_CrossPrioritization = 30,
+    FIX43_NewOrderCross_NoSides = 31,
+    FIX43_NewOrderCross_Symbol = 32,
+    FIX43_NewOrderCross_SymbolSfx = 33,
+    FIX43_NewOrderCross_SecurityID = 34,
+    FIX43_NewOrderCross_SecurityIDSource = 35,
+    FIX43_NewOrderCross_NoSecurityAltID = 36,
+    FIX43_NewOrderCross_Product = 37,
+    FIX43_NewOrderCross_CFICode = 38,
+    FIX43_NewOrderCross_SecurityType = 39,
+    FIX43_NewOrderCross_MaturityMonthYear = 40,
+    FIX43_NewOrderCross_MaturityDate = 41,
+    FIX43_NewOrderCross_CouponPaymentDate = 42,
+    FIX43_NewOrderCross_IssueDate = 43,
+    FIX43_NewOrderCross_RepoCollateralSecurityType = 44,
+    FIX43_NewOrderCross_RepurchaseTerm = 45,
+    FIX43_NewOrderCross_RepurchaseRate = 46,
+    FIX43_NewOrderCross_Factor = 47,
+    FIX43_NewOrderCross_CreditRating = 48,
+    FIX43_NewOrderCross_InstrRegistry = 49,
+    FIX43_NewOrderCross_CountryOfIssue = 50,
+    FIX43_NewOrderCross_StateOrProvinceOfIssue = 51,
+    FIX43_NewOrderCross_LocaleOfIssue = 52,
+    FIX43_NewOrderCross_RedemptionDate = 53,
+    FIX43_NewOrderCross_StrikePrice = 54,
+    FIX43_NewOrderCross_OptAttribute = 55,
+    FIX43_NewOrderCross_ContractMultiplier = 56,
+    FIX43_NewOrderCross_CouponRate = 57,
+    FIX43_NewOrderCross_SecurityExchange = 58,
+    FIX43_NewOrderCross_Issuer = 59,
+    FIX43_NewOrderCross_EncodedIssuerLen = 60,
+    FIX43_NewOrderCross_EncodedIssuer = 61,
+    FIX43_NewOrderCross_SecurityDesc = 62,
+    FIX43_NewOrderCross_EncodedSecurityDescLen = 63,
+    FIX43_NewOrderCross_EncodedSecurityDesc = 64,
+    FIX43_NewOrderCross_SettlmntTyp = 65,
+    FIX43_NewOrderCross_FutSettDate = 66,
+    FIX43_NewOrderCross_HandlInst = 67,
+    FIX43_NewOrderCross_ExecInst = 68,
+    FIX43_NewOrderCross_MinQty = 69,
+    FIX43_NewOrderCross_MaxFloor = 70,
+    FIX43_NewOrderCross_ExDestination = 71,
+    FIX43_NewOrderCross_NoTradingSessions = 72,
+    FIX43_NewOrderCross_ProcessCode = 73,
+    FIX43_NewOrderCross_PrevClosePx = 74,
+    FIX43_NewOrderCross_LocateReqd = 75,
+    FIX43_NewOrderCross_TransactTime = 76,
+    FIX43_NewOrderCross_NoStipulations = 77,
+    FIX43_NewOrderCross_OrdType = 78,
+    FIX43_NewOrderCross_PriceType = 79,
+    FIX43_NewOrderCross_Price = 80,
+    FIX43_NewOrderCross_StopPx = 81,
+    FIX43_NewOrderCross_Spread = 82,
+    FIX43_NewOrderCross_BenchmarkCurveCurrency = 83,
+    FIX43_NewOrderCross_BenchmarkCurveName = 84,
+    FIX43_NewOrderCross_BenchmarkCurvePoint = 85,
+    FIX43_NewOrderCross_YieldType = 86,
+    FIX43_NewOrderCross_Yield = 87,
+    FIX43_NewOrderCross_Currency = 88,
+    FIX43_NewOrderCross_ComplianceID = 89,
+    FIX43_NewOrderCross_IOIid = 90,
+    FIX43_NewOrderCross_QuoteID = 91,
+    FIX43_NewOrderCross_TimeInForce = 92,
+    FIX43_NewOrderCross_EffectiveTime = 93,
+    FIX43_NewOrderCross_ExpireDate = 94,
+    FIX43_NewOrderCross_ExpireTime = 95,
+    FIX43_NewOrderCross_GTBookingInst = 96,
+    FIX43_NewOrderCross_MaxShow = 97,
+    FIX43_NewOrderCross_PegDifference = 98,
+    FIX43_NewOrderCross_DiscretionInst = 99,
+    FIX43_NewOrderCross_DiscretionOffset = 100,
+    FIX43_NewOrderCross_CancellationRights = 101,
+    FIX43_NewOrderCross_MoneyLaunderingStatus = 102,
+    FIX43_NewOrderCross_RegistID = 103,
+    FIX43_NewOrderCross_Designation = 104,
+    FIX43_NewOrderCross_AccruedInterestRate = 105,
+    FIX43_NewOrderCross_AccruedInterestAmt = 106,
+    FIX43_NewOrderCross_NetMoney = 107,
+    FIX43_NewOrderCross_SignatureLength = 108,
+    FIX43_NewOrderCross_Signature = 109,
+    FIX43_NewOrderCross_CheckSum = 110,
+};
+
+typedef struct _fix43NewOrderCross {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	CrossID;
+    int64_t	CrossType;
+    int64_t	CrossPrioritization;
+    int64_t	NoSides;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    struct _ofixDecimal	PrevClosePx;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	NoStipulations;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	NetMoney;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43NewOrderCross;
+
+extern void	fix43_decode_NewOrderCross(ofixErr err, fix43NewOrderCross m, const char *raw, int len);
+extern void	fix43_decode_NewOrderCross_msg(ofixErr err, fix43NewOrderCross m, ofixMsg msg);
+extern ofixMsg	fix43_encode_NewOrderCross(ofixErr err, fix43NewOrderCross m);
+
+// CrossOrderCancelReplaceRequest [t]
+enum {
+    FIX43_CrossOrderCancelReplaceRequest_BeginString = 0,
+    FIX43_CrossOrderCancelReplaceRequest_BodyLength = 1,
+    FIX43_CrossOrderCancelReplaceRequest_MsgType = 2,
+    FIX43_CrossOrderCancelReplaceRequest_SenderCompID = 3,
+    FIX43_CrossOrderCancelReplaceRequest_TargetCompID = 4,
+    FIX43_CrossOrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX43_CrossOrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX43_CrossOrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX43_CrossOrderCancelReplaceRequest_SecureData = 8,
+    FIX43_CrossOrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX43_CrossOrderCancelReplaceRequest_SenderSubID = 10,
+    FIX43_CrossOrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX43_CrossOrderCancelReplaceRequest_TargetSubID = 12,
+    FIX43_CrossOrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX43_CrossOrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX43_CrossOrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX43_CrossOrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX43_CrossOrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX43_CrossOrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX43_CrossOrderCancelReplaceRequest_PossResend = 19,
+    FIX43_CrossOrderCancelReplaceRequest_SendingTime = 20,
+    FIX43_CrossOrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX43_CrossOrderCancelReplaceRequest_XmlDataLen = 22,
+    FIX43_CrossOrderCancelReplaceRequest_XmlData = 23,
+    FIX43_CrossOrderCancelReplaceRequest_MessageEncoding = 24,
+    FIX43_CrossOrderCancelReplaceRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_CrossOrderCancelReplaceRequest_OnBehalfOfSendingTime = 26,
+    FIX43_CrossOrderCancelReplaceRequest_NoHops = 27,
+    FIX43_CrossOrderCancelReplaceRequest_OrderID = 28,
+    FIX43_CrossOrderCancelReplaceRequest_CrossID = 29,
+    FIX43_CrossOrderCancelReplaceRequest_OrigCrossID = 30,
+    FIX43_CrossOrderCancelReplaceRequest_CrossType = 31,
+    FIX43_CrossOrderCancelReplaceRequest_CrossPrioritization = 32,
+    FIX43_CrossOrderCancelReplaceRequest_NoSides = 33,
+    FIX43_CrossOrderCancelReplaceRequest_Symbol = 34,
+    FIX43_CrossOrderCancelReplaceRequest_SymbolSfx = 35,
+    FIX43_CrossOrderCancelReplaceRequest_SecurityID = 36,
+    FIX43_CrossOrderCancelReplaceRequest_SecurityIDSource = 37,
+    FIX43_CrossOrderCancelReplaceRequest_NoSecurityAltID = 38,
+    FIX43_CrossOrderCancelReplaceRequest_Product = 39,
+    FIX43_CrossOrderCancelReplaceRequest_CFICode = 40,
+    FIX43_CrossOrderCancelReplaceRequest_SecurityType = 41,
+    FIX43_CrossOrderCancelReplaceRequest_MaturityMonthYear = 42,
+    FIX43_CrossOrderCancelReplaceRequest_MaturityDate = 43,
+    FIX43_CrossOrderCancelReplaceRequest_CouponPaymentDate = 44,
+    FIX43_CrossOrderCancelReplaceRequest_IssueDate = 45,
+    FIX43_CrossOrderCancelReplaceRequest_RepoCollateralSecurityType = 46,
+    FIX43_CrossOrderCancelReplaceRequest_RepurchaseTerm = 47,
+    FIX43_CrossOrderCancelReplaceRequest_RepurchaseRate = 48,
+    FIX43_CrossOrderCancelReplaceRequest_Factor = 49,
+    FIX43_CrossOrderCancelReplaceRequest_CreditRating = 50,
+    FIX43_CrossOrderCancelReplaceRequest_InstrRegistry = 51,
+    FIX43_CrossOrderCancelReplaceRequest_CountryOfIssue = 52,
+    FIX43_CrossOrderCancelReplaceRequest_StateOrProvinceOfIssue = 53,
+    FIX43_CrossOrderCancelReplaceRequest_LocaleOfIssue = 54,
+    FIX43_CrossOrderCancelReplaceRequest_RedemptionDate = 55,
+    FIX43_CrossOrderCancelReplaceRequest_StrikePrice = 56,
+    FIX43_CrossOrderCancelReplaceRequest_OptAttribute = 57,
+    FIX43_CrossOrderCancelReplaceRequest_ContractMultiplier = 58,
+    FIX43_CrossOrderCancelReplaceRequest_CouponRate = 59,
+    FIX43_CrossOrderCancelReplaceRequest_SecurityExchange = 60,
+    FIX43_CrossOrderCancelReplaceRequest_Issuer = 61,
+    FIX43_CrossOrderCancelReplaceRequest_EncodedIssuerLen = 62,
+    FIX43_CrossOrderCancelReplaceRequest_EncodedIssuer = 63,
+    FIX43_CrossOrderCancelReplaceRequest_SecurityDesc = 64,
+    FIX43_CrossOrderCancelReplaceRequest_EncodedSecurityDescLen = 65,
+    FIX43_CrossOrderCancelReplaceRequest_EncodedSecurityDesc = 66,
+    FIX43_CrossOrderCancelReplaceRequest_SettlmntTyp = 67,
+    FIX43_CrossOrderCancelReplaceRequest_FutSettDate = 68,
+    FIX43_CrossOrderCancelReplaceRequest_HandlInst = 69,
+    FIX43_CrossOrderCancelReplaceRequest_ExecInst = 70,
+    FIX43_CrossOrderCancelReplaceRequest_MinQty = 71,
+    FIX43_CrossOrderCancelReplaceRequest_MaxFloor = 72,
+    FIX43_CrossOrderCancelReplaceRequest_ExDestination = 73,
+    FIX43_CrossOrderCancelReplaceRequest_NoTradingSessions = 74,
+    FIX43_CrossOrderCancelReplaceRequest_ProcessCode = 75,
+    FIX43_CrossOrderCancelReplaceRequest_PrevClosePx = 76,
+    FIX43_CrossOrderCancelReplaceRequest_LocateReqd = 77,
+    FIX43_CrossOrderCancelReplaceRequest_TransactTime = 78,
+    FIX43_CrossOrderCancelReplaceRequest_NoStipulations = 79,
+    FIX43_CrossOrderCancelReplaceRequest_OrdType = 80,
+    FIX43_CrossOrderCancelReplaceRequest_PriceType = 81,
+    FIX43_CrossOrderCancelReplaceRequest_Price = 82,
+    FIX43_CrossOrderCancelReplaceRequest_StopPx = 83,
+    FIX43_CrossOrderCancelReplaceRequest_Spread = 84,
+    FIX43_CrossOrderCancelReplaceRequest_BenchmarkCurveCurrency = 85,
+    FIX43_CrossOrderCancelReplaceRequest_BenchmarkCurveName = 86,
+    FIX43_CrossOrderCancelReplaceRequest_BenchmarkCurvePoint = 87,
+    FIX43_CrossOrderCancelReplaceRequest_YieldType = 88,
+    FIX43_CrossOrderCancelReplaceRequest_Yield = 89,
+    FIX43_CrossOrderCancelReplaceRequest_Currency = 90,
+    FIX43_CrossOrderCancelReplaceRequest_ComplianceID = 91,
+    FIX43_CrossOrderCancelReplaceRequest_IOIid = 92,
+    FIX43_CrossOrderCancelReplaceRequest_QuoteID = 93,
+    FIX43_CrossOrderCancelReplaceRequest_TimeInForce = 94,
+    FIX43_CrossOrderCancelReplaceRequest_EffectiveTime = 95,
+    FIX43_CrossOrderCancelReplaceRequest_ExpireDate = 96,
+    FIX43_CrossOrderCancelReplaceRequest_ExpireTime = 97,
+    FIX43_CrossOrderCancelReplaceRequest_GTBookingInst = 98,
+    FIX43_CrossOrderCancelReplaceRequest_MaxShow = 99,
+    FIX43_CrossOrderCancelReplaceRequest_PegDifference = 100,
+    FIX43_CrossOrderCancelReplaceRequest_DiscretionInst = 101,
+    FIX43_CrossOrderCancelReplaceRequest_DiscretionOffset = 102,
+    FIX43_CrossOrderCancelReplaceRequest_CancellationRights = 103,
+    FIX43_CrossOrderCancelReplaceRequest_MoneyLaunderingStatus = 104,
+    FIX43_CrossOrderCancelReplaceRequest_RegistID = 105,
+    FIX43_CrossOrderCancelReplaceRequest_Designation = 106,
+    FIX43_CrossOrderCancelReplaceRequest_AccruedInterestRate = 107,
+    FIX43_CrossOrderCancelReplaceRequest_AccruedInterestAmt = 108,
+    FIX43_CrossOrderCancelReplaceRequest_NetMoney = 109,
+    FIX43_CrossOrderCancelReplaceRequest_SignatureLength = 110,
+    FIX43_CrossOrderCancelReplaceRequest_Signature = 111,
+    FIX43_CrossOrderCancelReplaceRequest_CheckSum = 112,
+};
+
+typedef struct _fix43CrossOrderCancelReplaceRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	CrossID;
+    struct _ofixStrView	OrigCrossID;
+    int64_t	CrossType;
+    int64_t	CrossPrioritization;
+    int64_t	NoSides;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    char	SettlmntTyp;
+    struct _ofixStrView	FutSettDate;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    struct _ofixDecimal	PrevClosePx;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	NoStipulations;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegDifference;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffset;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	NetMoney;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43CrossOrderCancelReplaceRequest;
+
+extern void	fix43_decode_CrossOrderCancelReplaceRequest(ofixErr err, fix43CrossOrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix43_decode_CrossOrderCancelReplaceRequest_msg(ofixErr err, fix43CrossOrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_CrossOrderCancelReplaceRequest(ofixErr err, fix43CrossOrderCancelReplaceRequest m);
+
+// CrossOrderCancelRequest [u]
+enum {
+    FIX43_CrossOrderCancelRequest_BeginString = 0,
+    FIX43_CrossOrderCancelRequest_BodyLength = 1,
+    FIX43_CrossOrderCancelRequest_MsgType = 2,
+    FIX43_CrossOrderCancelRequest_SenderCompID = 3,
+    FIX43_CrossOrderCancelRequest_TargetCompID = 4,
+    FIX43_CrossOrderCancelRequest_OnBehalfOfCompID = 5,
+    FIX43_CrossOrderCancelRequest_DeliverToCompID = 6,
+    FIX43_CrossOrderCancelRequest_SecureDataLen = 7,
+    FIX43_CrossOrderCancelRequest_SecureData = 8,
+    FIX43_CrossOrderCancelRequest_MsgSeqNum = 9,
+    FIX43_CrossOrderCancelRequest_SenderSubID = 10,
+    FIX43_CrossOrderCancelRequest_SenderLocationID = 11,
+    FIX43_CrossOrderCancelRequest_TargetSubID = 12,
+    FIX43_CrossOrderCancelRequest_TargetLocationID = 13,
+    FIX43_CrossOrderCancelRequest_OnBehalfOfSubID = 14,
+    FIX43_CrossOrderCancelRequest_OnBehalfOfLocationID = 15,
+    FIX43_CrossOrderCancelRequest_DeliverToSubID = 16,
+    FIX43_CrossOrderCancelRequest_DeliverToLocationID = 17,
+    FIX43_CrossOrderCancelRequest_PossDupFlag = 18,
+    FIX43_CrossOrderCancelRequest_PossResend = 19,
+    FIX43_CrossOrderCancelRequest_SendingTime = 20,
+    FIX43_CrossOrderCancelRequest_OrigSendingTime = 21,
+    FIX43_CrossOrderCancelRequest_XmlDataLen = 22,
+    FIX43_CrossOrderCancelRequest_XmlData = 23,
+    FIX43_CrossOrderCancelRequest_MessageEncoding = 24,
+    FIX43_CrossOrderCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_CrossOrderCancelRequest_OnBehalfOfSendingTime = 26,
+    FIX43_CrossOrderCancelRequest_NoHops = 27,
+    FIX43_CrossOrderCancelRequest_OrderID = 28,
+    FIX43_CrossOrderCancelRequest_CrossID = 29,
+    FIX43_CrossOrderCancelRequest_OrigCrossID = 30,
+    FIX43_CrossOrderCancelRequest_CrossType = 31,
+    FIX43_CrossOrderCancelRequest_CrossPrioritization = 32,
+    FIX43_CrossOrderCancelRequest_NoSides = 33,
+    FIX43_CrossOrderCancelRequest_Symbol = 34,
+    FIX43_CrossOrderCancelRequest_SymbolSfx = 35,
+    FIX43_CrossOrderCancelRequest_SecurityID = 36,
+    FIX43_CrossOrderCancelRequest_SecurityIDSource = 37,
+    FIX43_CrossOrderCancelRequest_NoSecurityAltID = 38,
+    FIX43_CrossOrderCancelRequest_Product = 39,
+    FIX43_CrossOrderCancelRequest_CFICode = 40,
+    FIX43_CrossOrderCancelRequest_SecurityType = 41,
+    FIX43_CrossOrderCancelRequest_MaturityMonthYear = 42,
+    FIX43_CrossOrderCancelRequest_MaturityDate = 43,
+    FIX43_CrossOrderCancelRequest_CouponPaymentDate = 44,
+    FIX43_CrossOrderCancelRequest_IssueDate = 45,
+    FIX43_CrossOrderCancelRequest_RepoCollateralSecurityType = 46,
+    FIX43_CrossOrderCancelRequest_RepurchaseTerm = 47,
+    FIX43_CrossOrderCancelRequest_RepurchaseRate = 48,
+    FIX43_CrossOrderCancelRequest_Factor = 49,
+    FIX43_CrossOrderCancelRequest_CreditRating = 50,
+    FIX43_CrossOrderCancelRequest_InstrRegistry = 51,
+    FIX43_CrossOrderCancelRequest_CountryOfIssue = 52,
+    FIX43_CrossOrderCancelRequest_StateOrProvinceOfIssue = 53,
+    FIX43_CrossOrderCancelRequest_LocaleOfIssue = 54,
+    FIX43_CrossOrderCancelRequest_RedemptionDate = 55,
+    FIX43_CrossOrderCancelRequest_StrikePrice = 56,
+    FIX43_CrossOrderCancelRequest_OptAttribute = 57,
+    FIX43_CrossOrderCancelRequest_ContractMultiplier = 58,
+    FIX43_CrossOrderCancelRequest_CouponRate = 59,
+    FIX43_CrossOrderCancelRequest_SecurityExchange = 60,
+    FIX43_CrossOrderCancelRequest_Issuer = 61,
+    FIX43_CrossOrderCancelRequest_EncodedIssuerLen = 62,
+    FIX43_CrossOrderCancelRequest_EncodedIssuer = 63,
+    FIX43_CrossOrderCancelRequest_SecurityDesc = 64,
+    FIX43_CrossOrderCancelRequest_EncodedSecurityDescLen = 65,
+    FIX43_CrossOrderCancelRequest_EncodedSecurityDesc = 66,
+    FIX43_CrossOrderCancelRequest_TransactTime = 67,
+    FIX43_CrossOrderCancelRequest_SignatureLength = 68,
+    FIX43_CrossOrderCancelRequest_Signature = 69,
+    FIX43_CrossOrderCancelRequest_CheckSum = 70,
+};
+
+typedef struct _fix43CrossOrderCancelRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	CrossID;
+    struct _ofixStrView	OrigCrossID;
+    int64_t	CrossType;
+    int64_t	CrossPrioritization;
+    int64_t	NoSides;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixDate	TransactTime;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43CrossOrderCancelRequest;
+
+extern void	fix43_decode_CrossOrderCancelRequest(ofixErr err, fix43CrossOrderCancelRequest m, const char *raw, int len);
+extern void	fix43_decode_CrossOrderCancelRequest_msg(ofixErr err, fix43CrossOrderCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_CrossOrderCancelRequest(ofixErr err, fix43CrossOrderCancelRequest m);
+
+// SecurityTypeRequest [v]
+enum {
+    FIX43_SecurityTypeRequest_BeginString = 0,
+    FIX43_SecurityTypeRequest_BodyLength = 1,
+    FIX43_SecurityTypeRequest_MsgType = 2,
+    FIX43_SecurityTypeRequest_SenderCompID = 3,
+    FIX43_SecurityTypeRequest_TargetCompID = 4,
+    FIX43_SecurityTypeRequest_OnBehalfOfCompID = 5,
+    FIX43_SecurityTypeRequest_DeliverToCompID = 6,
+    FIX43_SecurityTypeRequest_SecureDataLen = 7,
+    FIX43_SecurityTypeRequest_SecureData = 8,
+    FIX43_SecurityTypeRequest_MsgSeqNum = 9,
+    FIX43_SecurityTypeRequest_SenderSubID = 10,
+    FIX43_SecurityTypeRequest_SenderLocationID = 11,
+    FIX43_SecurityTypeRequest_TargetSubID = 12,
+    FIX43_SecurityTypeRequest_TargetLocationID = 13,
+    FIX43_SecurityTypeRequest_OnBehalfOfSubID = 14,
+    FIX43_SecurityTypeRequest_OnBehalfOfLocationID = 15,
+    FIX43_SecurityTypeRequest_DeliverToSubID = 16,
+    FIX43_SecurityTypeRequest_DeliverToLocationID = 17,
+    FIX43_SecurityTypeRequest_PossDupFlag = 18,
+    FIX43_SecurityTypeRequest_PossResend = 19,
+    FIX43_SecurityTypeRequest_SendingTime = 20,
+    FIX43_SecurityTypeRequest_OrigSendingTime = 21,
+    FIX43_SecurityTypeRequest_XmlDataLen = 22,
+    FIX43_SecurityTypeRequest_XmlData = 23,
+    FIX43_SecurityTypeRequest_MessageEncoding = 24,
+    FIX43_SecurityTypeRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityTypeRequest_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityTypeRequest_NoHops = 27,
+    FIX43_SecurityTypeRequest_SecurityReqID = 28,
+    FIX43_SecurityTypeRequest_Text = 29,
+    FIX43_SecurityTypeRequest_EncodedTextLen = 30,
+    FIX43_SecurityTypeRequest_EncodedText = 31,
+    FIX43_SecurityTypeRequest_TradingSessionID = 32,
+    FIX43_SecurityTypeRequest_TradingSessionSubID = 33,
+    FIX43_SecurityTypeRequest_SignatureLength = 34,
+    FIX43_SecurityTypeRequest_Signature = 35,
+    FIX43_SecurityTypeRequest_CheckSum = 36,
+};
+
+typedef struct _fix43SecurityTypeRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityTypeRequest;
+
+extern void	fix43_decode_SecurityTypeRequest(ofixErr err, fix43SecurityTypeRequest m, const char *raw, int len);
+extern void	fix43_decode_SecurityTypeRequest_msg(ofixErr err, fix43SecurityTypeRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityTypeRequest(ofixErr err, fix43SecurityTypeRequest m);
+
+// SecurityTypes [w]
+enum {
+    FIX43_SecurityTypes_BeginString = 0,
+    FIX43_SecurityTypes_BodyLength = 1,
+    FIX43_SecurityTypes_MsgType = 2,
+    FIX43_SecurityTypes_SenderCompID = 3,
+    FIX43_SecurityTypes_TargetCompID = 4,
+    FIX43_SecurityTypes_OnBehalfOfCompID = 5,
+    FIX43_SecurityTypes_DeliverToCompID = 6,
+    FIX43_SecurityTypes_SecureDataLen = 7,
+    FIX43_SecurityTypes_SecureData = 8,
+    FIX43_SecurityTypes_MsgSeqNum = 9,
+    FIX43_SecurityTypes_SenderSubID = 10,
+    FIX43_SecurityTypes_SenderLocationID = 11,
+    FIX43_SecurityTypes_TargetSubID = 12,
+    FIX43_SecurityTypes_TargetLocationID = 13,
+    FIX43_SecurityTypes_OnBehalfOfSubID = 14,
+    FIX43_SecurityTypes_OnBehalfOfLocationID = 15,
+    FIX43_SecurityTypes_DeliverToSubID = 16,
+    FIX43_SecurityTypes_DeliverToLocationID = 17,
+    FIX43_SecurityTypes_PossDupFlag = 18,
+    FIX43_SecurityTypes_PossResend = 19,
+    FIX43_SecurityTypes_SendingTime = 20,
+    FIX43_SecurityTypes_OrigSendingTime = 21,
+    FIX43_SecurityTypes_XmlDataLen = 22,
+    FIX43_SecurityTypes_XmlData = 23,
+    FIX43_SecurityTypes_MessageEncoding = 24,
+    FIX43_SecurityTypes_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityTypes_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityTypes_NoHops = 27,
+    FIX43_SecurityTypes_SecurityReqID = 28,
+    FIX43_SecurityTypes_SecurityResponseID = 29,
+    FIX43_SecurityTypes_SecurityResponseType = 30,
+    FIX43_SecurityTypes_TotalNumSecurityTypes = 31,
+    FIX43_SecurityTypes_NoSecurityTypes = 32,
+    FIX43_SecurityTypes_Text = 33,
+    FIX43_SecurityTypes_EncodedTextLen = 34,
+    FIX43_SecurityTypes_EncodedText = 35,
+    FIX43_SecurityTypes_TradingSessionID = 36,
+    FIX43_SecurityTypes_TradingSessionSubID = 37,
+    FIX43_SecurityTypes_SubscriptionRequestType = 38,
+    FIX43_SecurityTypes_SignatureLength = 39,
+    FIX43_SecurityTypes_Signature = 40,
+    FIX43_SecurityTypes_CheckSum = 41,
+};
+
+typedef struct _fix43SecurityTypes {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityResponseType;
+    int64_t	TotalNumSecurityTypes;
+    int64_t	NoSecurityTypes;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityTypes;
+
+extern void	fix43_decode_SecurityTypes(ofixErr err, fix43SecurityTypes m, const char *raw, int len);
+extern void	fix43_decode_SecurityTypes_msg(ofixErr err, fix43SecurityTypes m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityTypes(ofixErr err, fix43SecurityTypes m);
+
+// SecurityListRequest [x]
+enum {
+    FIX43_SecurityListRequest_BeginString = 0,
+    FIX43_SecurityListRequest_BodyLength = 1,
+    FIX43_SecurityListRequest_MsgType = 2,
+    FIX43_SecurityListRequest_SenderCompID = 3,
+    FIX43_SecurityListRequest_TargetCompID = 4,
+    FIX43_SecurityListRequest_OnBehalfOfCompID = 5,
+    FIX43_SecurityListRequest_DeliverToCompID = 6,
+    FIX43_SecurityListRequest_SecureDataLen = 7,
+    FIX43_SecurityListRequest_SecureData = 8,
+    FIX43_SecurityListRequest_MsgSeqNum = 9,
+    FIX43_SecurityListRequest_SenderSubID = 10,
+    FIX43_SecurityListRequest_SenderLocationID = 11,
+    FIX43_SecurityListRequest_TargetSubID = 12,
+    FIX43_SecurityListRequest_TargetLocationID = 13,
+    FIX43_SecurityListRequest_OnBehalfOfSubID = 14,
+    FIX43_SecurityListRequest_OnBehalfOfLocationID = 15,
+    FIX43_SecurityListRequest_DeliverToSubID = 16,
+    FIX43_SecurityListRequest_DeliverToLocationID = 17,
+    FIX43_SecurityListRequest_PossDupFlag = 18,
+    FIX43_SecurityListRequest_PossResend = 19,
+    FIX43_SecurityListRequest_SendingTime = 20,
+    FIX43_SecurityListRequest_OrigSendingTime = 21,
+    FIX43_SecurityListRequest_XmlDataLen = 22,
+    FIX43_SecurityListRequest_XmlData = 23,
+    FIX43_SecurityListRequest_MessageEncoding = 24,
+    FIX43_SecurityListRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityListRequest_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityListRequest_NoHops = 27,
+    FIX43_SecurityListRequest_SecurityReqID = 28,
+    FIX43_SecurityListRequest_SecurityListRequestType = 29,
+    FIX43_SecurityListRequest_Symbol = 30,
+    FIX43_SecurityListRequest_SymbolSfx = 31,
+    FIX43_SecurityListRequest_SecurityID = 32,
+    FIX43_SecurityListRequest_SecurityIDSource = 33,
+    FIX43_SecurityListRequest_NoSecurityAltID = 34,
+    FIX43_SecurityListRequest_Product = 35,
+    FIX43_SecurityListRequest_CFICode = 36,
+    FIX43_SecurityListRequest_SecurityType = 37,
+    FIX43_SecurityListRequest_MaturityMonthYear = 38,
+    FIX43_SecurityListRequest_MaturityDate = 39,
+    FIX43_SecurityListRequest_CouponPaymentDate = 40,
+    FIX43_SecurityListRequest_IssueDate = 41,
+    FIX43_SecurityListRequest_RepoCollateralSecurityType = 42,
+    FIX43_SecurityListRequest_RepurchaseTerm = 43,
+    FIX43_SecurityListRequest_RepurchaseRate = 44,
+    FIX43_SecurityListRequest_Factor = 45,
+    FIX43_SecurityListRequest_CreditRating = 46,
+    FIX43_SecurityListRequest_InstrRegistry = 47,
+    FIX43_SecurityListRequest_CountryOfIssue = 48,
+    FIX43_SecurityListRequest_StateOrProvinceOfIssue = 49,
+    FIX43_SecurityListRequest_LocaleOfIssue = 50,
+    FIX43_SecurityListRequest_RedemptionDate = 51,
+    FIX43_SecurityListRequest_StrikePrice = 52,
+    FIX43_SecurityListRequest_OptAttribute = 53,
+    FIX43_SecurityListRequest_ContractMultiplier = 54,
+    FIX43_SecurityListRequest_CouponRate = 55,
+    FIX43_SecurityListRequest_SecurityExchange = 56,
+    FIX43_SecurityListRequest_Issuer = 57,
+    FIX43_SecurityListRequest_EncodedIssuerLen = 58,
+    FIX43_SecurityListRequest_EncodedIssuer = 59,
+    FIX43_SecurityListRequest_SecurityDesc = 60,
+    FIX43_SecurityListRequest_EncodedSecurityDescLen = 61,
+    FIX43_SecurityListRequest_EncodedSecurityDesc = 62,
+    FIX43_SecurityListRequest_Currency = 63,
+    FIX43_SecurityListRequest_Text = 64,
+    FIX43_SecurityListRequest_EncodedTextLen = 65,
+    FIX43_SecurityListRequest_EncodedText = 66,
+    FIX43_SecurityListRequest_TradingSessionID = 67,
+    FIX43_SecurityListRequest_TradingSessionSubID = 68,
+    FIX43_SecurityListRequest_SubscriptionRequestType = 69,
+    FIX43_SecurityListRequest_SignatureLength = 70,
+    FIX43_SecurityListRequest_Signature = 71,
+    FIX43_SecurityListRequest_CheckSum = 72,
+};
+
+typedef struct _fix43SecurityListRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    int64_t	SecurityListRequestType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixDate	CouponPaymentDate;
+    struct _ofixDate	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixDate	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityListRequest;
+
+extern void	fix43_decode_SecurityListRequest(ofixErr err, fix43SecurityListRequest m, const char *raw, int len);
+extern void	fix43_decode_SecurityListRequest_msg(ofixErr err, fix43SecurityListRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityListRequest(ofixErr err, fix43SecurityListRequest m);
+
+// SecurityList [y]
+enum {
+    FIX43_SecurityList_BeginString = 0,
+    FIX43_SecurityList_BodyLength = 1,
+    FIX43_SecurityList_MsgType = 2,
+    FIX43_SecurityList_SenderCompID = 3,
+    FIX43_SecurityList_TargetCompID = 4,
+    FIX43_SecurityList_OnBehalfOfCompID = 5,
+    FIX43_SecurityList_DeliverToCompID = 6,
+    FIX43_SecurityList_SecureDataLen = 7,
+    FIX43_SecurityList_SecureData = 8,
+    FIX43_SecurityList_MsgSeqNum = 9,
+    FIX43_SecurityList_SenderSubID = 10,
+    FIX43_SecurityList_SenderLocationID = 11,
+    FIX43_SecurityList_TargetSubID = 12,
+    FIX43_SecurityList_TargetLocationID = 13,
+    FIX43_SecurityList_OnBehalfOfSubID = 14,
+    FIX43_SecurityList_OnBehalfOfLocationID = 15,
+    FIX43_SecurityList_DeliverToSubID = 16,
+    FIX43_SecurityList_DeliverToLocationID = 17,
+    FIX43_SecurityList_PossDupFlag = 18,
+    FIX43_SecurityList_PossResend = 19,
+    FIX43_SecurityList_SendingTime = 20,
+    FIX43_SecurityList_OrigSendingTime = 21,
+    FIX43_SecurityList_XmlDataLen = 22,
+    FIX43_SecurityList_XmlData = 23,
+    FIX43_SecurityList_MessageEncoding = 24,
+    FIX43_SecurityList_LastMsgSeqNumProcessed = 25,
+    FIX43_SecurityList_OnBehalfOfSendingTime = 26,
+    FIX43_SecurityList_NoHops = 27,
+    FIX43_SecurityList_SecurityReqID = 28,
+    FIX43_SecurityList_SecurityResponseID = 29,
+    FIX43_SecurityList_SecurityRequestResult = 30,
+    FIX43_SecurityList_TotalNumSecurities = 31,
+    FIX43_SecurityList_NoRelatedSym = 32,
+    FIX43_SecurityList_SignatureLength = 33,
+    FIX43_SecurityList_Signature = 34,
+    FIX43_SecurityList_CheckSum = 35,
+};
+
+typedef struct _fix43SecurityList {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityRequestResult;
+    int64_t	TotalNumSecurities;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43SecurityList;
+
+extern void	fix43_decode_SecurityList(ofixErr err, fix43SecurityList m, const char *raw, int len);
+extern void	fix43_decode_SecurityList_msg(ofixErr err, fix43SecurityList m, ofixMsg msg);
+extern ofixMsg	fix43_encode_SecurityList(ofixErr err, fix43SecurityList m);
+
+// DerivativeSecurityListRequest [z]
+enum {
+    FIX43_DerivativeSecurityListRequest_BeginString = 0,
+    FIX43_DerivativeSecurityListRequest_BodyLength = 1,
+    FIX43_DerivativeSecurityListRequest_MsgType = 2,
+    FIX43_DerivativeSecurityListRequest_SenderCompID = 3,
+    FIX43_DerivativeSecurityListRequest_TargetCompID = 4,
+    FIX43_DerivativeSecurityListRequest_OnBehalfOfCompID = 5,
+    FIX43_DerivativeSecurityListRequest_DeliverToCompID = 6,
+    FIX43_DerivativeSecurityListRequest_SecureDataLen = 7,
+    FIX43_DerivativeSecurityListRequest_SecureData = 8,
+    FIX43_DerivativeSecurityListRequest_MsgSeqNum = 9,
+    FIX43_DerivativeSecurityListRequest_SenderSubID = 10,
+    FIX43_DerivativeSecurityListRequest_SenderLocationID = 11,
+    FIX43_DerivativeSecurityListRequest_TargetSubID = 12,
+    FIX43_DerivativeSecurityListRequest_TargetLocationID = 13,
+    FIX43_DerivativeSecurityListRequest_OnBehalfOfSubID = 14,
+    FIX43_DerivativeSecurityListRequest_OnBehalfOfLocationID = 15,
+    FIX43_DerivativeSecurityListRequest_DeliverToSubID = 16,
+    FIX43_DerivativeSecurityListRequest_DeliverToLocationID = 17,
+    FIX43_DerivativeSecurityListRequest_PossDupFlag = 18,
+    FIX43_DerivativeSecurityListRequest_PossResend = 19,
+    FIX43_DerivativeSecurityListRequest_SendingTime = 20,
+    FIX43_DerivativeSecurityListRequest_OrigSendingTime = 21,
+    FIX43_DerivativeSecurityListRequest_XmlDataLen = 22,
+    FIX43_DerivativeSecurityListRequest_XmlData = 23,
+    FIX43_DerivativeSecurityListRequest_MessageEncoding = 24,
+    FIX43_DerivativeSecurityListRequest_LastMsgSeqNumProcessed = 25,
+    FIX43_DerivativeSecurityListRequest_OnBehalfOfSendingTime = 26,
+    FIX43_DerivativeSecurityListRequest_NoHops = 27,
+    FIX43_DerivativeSecurityListRequest_SecurityReqID = 28,
+    FIX43_DerivativeSecurityListRequest_SecurityListRequestType = 29,
+    FIX43_DerivativeSecurityListRequest_UnderlyingSymbol = 30,
+    FIX43_DerivativeSecurityListRequest_UnderlyingSymbolSfx = 31,
+    FIX43_DerivativeSecurityListRequest_UnderlyingSecurityID = 32,
+    FIX43_DerivativeSecurityListRequest_UnderlyingSecurityIDSource = 33,
+    FIX43_DerivativeSecurityListRequest_NoUnderlyingSecurityAltID = 34,
+    FIX43_DerivativeSecurityListRequest_UnderlyingProduct = 35,
+    FIX43_DerivativeSecurityListRequest_UnderlyingCFICode = 36,
+    FIX43_DerivativeSecurityListRequest_UnderlyingSecurityType = 37,
+    FIX43_DerivativeSecurityListRequest_UnderlyingMaturityMonthYear = 38,
+    FIX43_DerivativeSecurityListRequest_UnderlyingMaturityDate = 39,
+    FIX43_DerivativeSecurityListRequest_UnderlyingCouponPaymentDate = 40,
+    FIX43_DerivativeSecurityListRequest_UnderlyingIssueDate = 41,
+    FIX43_DerivativeSecurityListRequest_UnderlyingRepoCollateralSecurityType = 42,
+    FIX43_DerivativeSecurityListRequest_UnderlyingRepurchaseTerm = 43,
+    FIX43_DerivativeSecurityListRequest_UnderlyingRepurchaseRate = 44,
+    FIX43_DerivativeSecurityListRequest_UnderlyingFactor = 45,
+    FIX43_DerivativeSecurityListRequest_UnderlyingCreditRating = 46,
+    FIX43_DerivativeSecurityListRequest_UnderlyingInstrRegistry = 47,
+    FIX43_DerivativeSecurityListRequest_UnderlyingCountryOfIssue = 48,
+    FIX43_DerivativeSecurityListRequest_UnderlyingStateOrProvinceOfIssue = 49,
+    FIX43_DerivativeSecurityListRequest_UnderlyingLocaleOfIssue = 50,
+    FIX43_DerivativeSecurityListRequest_UnderlyingRedemptionDate = 51,
+    FIX43_DerivativeSecurityListRequest_UnderlyingPutOrCall = 52,
+    FIX43_DerivativeSecurityListRequest_UnderlyingStrikePrice = 53,
+    FIX43_DerivativeSecurityListRequest_UnderlyingOptAttribute = 54,
+    FIX43_DerivativeSecurityListRequest_UnderlyingContractMultiplier = 55,
+    FIX43_DerivativeSecurityListRequest_UnderlyingCouponRate = 56,
+    FIX43_DerivativeSecurityListRequest_UnderlyingSecurityExchange = 57,
+    FIX43_DerivativeSecurityListRequest_UnderlyingIssuer = 58,
+    FIX43_DerivativeSecurityListRequest_EncodedUnderlyingIssuerLen = 59,
+    FIX43_DerivativeSecurityListRequest_EncodedUnderlyingIssuer = 60,
+    FIX43_DerivativeSecurityListRequest_UnderlyingSecurityDesc = 61,
+    FIX43_DerivativeSecurityListRequest_EncodedUnderlyingSecurityDescLen = 62,
+    FIX43_DerivativeSecurityListRequest_EncodedUnderlyingSecurityDesc = 63,
+    FIX43_DerivativeSecurityListRequest_Currency = 64,
+    FIX43_DerivativeSecurityListRequest_Text = 65,
+    FIX43_DerivativeSecurityListRequest_EncodedTextLen = 66,
+    FIX43_DerivativeSecurityListRequest_EncodedText = 67,
+    FIX43_DerivativeSecurityListRequest_TradingSessionID = 68,
+    FIX43_DerivativeSecurityListRequest_TradingSessionSubID = 69,
+    FIX43_DerivativeSecurityListRequest_SubscriptionRequestType = 70,
+    FIX43_DerivativeSecurityListRequest_SignatureLength = 71,
+    FIX43_DerivativeSecurityListRequest_Signature = 72,
+    FIX43_DerivativeSecurityListRequest_CheckSum = 73,
+};
+
+typedef struct _fix43DerivativeSecurityListRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    struct _ofixDate	OnBehalfOfSendingTime;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    int64_t	SecurityListRequestType;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixDate	UnderlyingCouponPaymentDate;
+    struct _ofixDate	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixDate	UnderlyingRedemptionDate;
+    int64_t	UnderlyingPutOrCall;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix43DerivativeSecurityListRequest;
+
+extern void	fix43_decode_DerivativeSecurityListRequest(ofixErr err, fix43DerivativeSecurityListRequest m, const char *raw, int len);
+extern void	fix43_decode_DerivativeSecurityListRequest_msg(ofixErr err, fix43DerivativeSecurityListRequest m, ofixMsg msg);
+extern ofixMsg	fix43_encode_DerivativeSecurityListRequest(ofixErr err, fix43DerivativeSecurityListRequest m);
+
+#endif /* __OFIX_FIX43MSGS_H__ */
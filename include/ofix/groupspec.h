@@ -0,0 +1,27 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_GROUPSPEC_H__
+#define __OFIX_GROUPSPEC_H__
+
+#include <stdint.h>
+
+#include "tagreq.h"
+
+// Tags below OFIX_TAG_BITS_SIZE are tracked in bitsets of 64 bit words.
+#define OFIX_TAG_BITS_WORDS	16
+#define OFIX_TAG_BITS_SIZE	(OFIX_TAG_BITS_WORDS * 64)
+
+/**
+ * Describes a repeating group. The first tag in tags is the delimiter that
+ * starts each entry. Nested groups are described by their own ofixGroupSpec
+ * and only the count tag of a nested group is included in tags.
+ */
+typedef struct _ofixGroupSpec {
+    int			num_tag;
+    uint64_t		members[OFIX_TAG_BITS_WORDS]; // tags directly in the group
+    struct _ofixTagReq	tags[];
+} *ofixGroupSpec;
+
+extern bool	ofix_group_spec_has_tag(ofixGroupSpec spec, int tag);
+
+#endif /* __OFIX_GROUPSPEC_H__ */
@@ -0,0 +1,12 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_IODIR_H__
+#define __OFIX_IODIR_H__
+
+typedef enum {
+    OFIX_IODIR_NONE	= 0,
+    OFIX_IODIR_SEND	= 's',
+    OFIX_IODIR_RECV	= 'r',
+} IoDir;
+
+#endif /* __OFIX_IODIR_H__ */
@@ -0,0 +1,597 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_JOURNAL_H__
+#define __OFIX_JOURNAL_H__
+
+#include <pthread.h>
+#include <stdint.h>
+
+#include "err.h"
+#include "iodir.h"
+
+#define OFIX_JOURNAL_SEG_SIZE	(64 * 1024 * 1024)
+#define OFIX_JOURNAL_MAX_SEGS	16384
+#define OFIX_JOURNAL_MAX_SEQ	(1 << 26)
+#define OFIX_JOURNAL_QUEUE_SIZE	65536
+#define OFIX_JOURNAL_MAX_SESSIONS	4096
+#define OFIX_JOURNAL_MAX_KEYS	8
+#define OFIX_JOURNAL_TIME_STEP	64
+#define OFIX_JOURNAL_BLOCK_SIZE	(64 * 1024)
+// maintenance passes a decompressed block is kept without being read
+#define OFIX_JOURNAL_CACHE_PASSES	10
+
+/**
+ * Durability policies for the journal writer thread. Messages are always in
+ * the operating system page cache once written by the writer thread but can
+ * be lost on a host failure until synced to disk.
+ */
+typedef enum {
+    /** never sync, the OS writes pages back when it chooses */
+    OFIX_SYNC_NONE	= 'n',
+    /** sync at most every N milliseconds if anything was written */
+    OFIX_SYNC_INTERVAL	= 'i',
+    /** sync after every N messages */
+    OFIX_SYNC_COUNT	= 'c',
+} ofixSyncPolicy;
+
+// First record of an index file. Same size as a _JLoc. The last_seq is the
+// sequence number of the most recent add.
+typedef struct _JHead {
+    char	magic[8];
+    int64_t	last_seq;
+} *JHead;
+
+// Contents of the checkpoint file. The index files cover every record
+// before __pos__ in segment __seg__ and were synced before the mark was
+// written, so a reopen only replays the records from there on.
+typedef struct _JMark {
+    char	magic[8];
+    int32_t	seg;
+    int32_t	pad;
+    int64_t	pos;
+} *JMark;
+
+// Location of a message in the journal. The record for seq N is at offset N
+// in the index file.
+typedef struct _JLoc {
+    int32_t	seg;
+    int32_t	size;
+    int64_t	start;
+} *JLoc;
+
+// An index is backed by a memory mapped file. The journal's own indexes and
+// those of each session in a shared journal have files of their own. Only
+// as much of the file as has been written is mapped. A larger mapping
+// replaces the old one as the index grows and the old one is unmapped once
+// no pinned reader is left.
+typedef struct _JIndex {
+    int		fd;
+    JHead	head;
+    JLoc	locs;
+    int64_t	cap;	// records mapped
+    int64_t	size;	// records backed by the file
+    int64_t	top;	// highest seq set
+    int64_t	written; // last seq written by the writer thread
+    int64_t	synced;	// last seq synced by the writer thread
+    bool	dirty;	// changed since the last checkpoint
+} *JIndex;
+
+// A session in a shared journal. The session id is the position in the
+// journal sessions file. A session that starts over keeps its id.
+typedef struct _JSession {
+    char		name[48];
+    struct _JIndex	sindex;
+    struct _JIndex	rindex;
+} *JSession;
+
+// Header at the start of each segment file.
+typedef struct _JSegHead {
+    char	magic[8];
+    int64_t	end;
+    int64_t	created; // nanoseconds since the epoch
+    char	id[40];
+} *JSegHead;
+
+// Header of a compressed segment file. The block table follows the header
+// and then the block bytes. The leading fields match a _JSegHead.
+typedef struct _JZHead {
+    char	magic[8];
+    int64_t	end;
+    int64_t	created;
+    int32_t	block_cnt;
+    int32_t	pad;
+    char	id[32];
+} *JZHead;
+
+// A block of whole records from the original segment. The block is stored
+// without compression if comp_len equals raw_len.
+typedef struct _JBlock {
+    int64_t	raw_off; // offset in the original segment
+    int64_t	file_off;
+    int32_t	raw_len;
+    int32_t	comp_len;
+} *JBlock;
+
+// A mapped compressed segment and the blocks decompressed for
+// ofix_journal_get(). Cached blocks stay until not read for
+// OFIX_JOURNAL_CACHE_PASSES maintenance passes.
+typedef struct _JZSeg {
+    char		*base;
+    int64_t		size;
+    JBlock		blocks;
+    int32_t		block_cnt;
+    char		**cache;
+    volatile int64_t	*used;
+} *JZSeg;
+
+// Memory retired by maintenance that a pinned reader may still be using. It
+// is freed once no reader pinned before it was retired is left.
+typedef struct _JLimbo {
+    char	*map;	// mapping to unmap or NULL
+    int64_t	size;
+    struct _JSeg	*seg;	// retired segment whose compressed segment to free
+    char	*block;	// decompressed block to free or NULL
+} *JLimbo;
+
+// Header of each record in a segment. The message bytes follow the header
+// and the record is padded to a multiple of 8 bytes. The crc is a CRC32C of
+// the rest of the header and the message bytes so a torn or corrupt record
+// is detected without parsing the message.
+typedef struct _JRec {
+    uint32_t	crc;
+    int32_t	len;
+    int64_t	seq;
+    int64_t	ts;	// nanoseconds since the epoch, never before the previous record
+    uint8_t	dir;
+    uint8_t	pad[3];
+    int32_t	sid;	// session id, 0 for the journal's own indexes
+} *JRec;
+
+// Sparse time index entry for the first record of each segment and every
+// OFIX_JOURNAL_TIME_STEP records after that. Record times never go back in
+// segment order so a range search can start at the last entry earlier than
+// the range.
+typedef struct _JTime {
+    int64_t	ts;
+    int64_t	pos;
+    int32_t	seg;
+} *JTime;
+
+// Key index entry. Keys are not kept, a match is checked against the
+// record itself.
+typedef struct _JKey {
+    uint64_t	hash;
+    int64_t	pos;
+    int32_t	seg;
+    int64_t	next;
+} *JKey;
+
+// A retired segment has a NULL base. A compressed segment has a z and
+// keeps the original mapping as the base until the next maintenance pass so
+// readers that loaded it before z was set can finish.
+typedef struct _JSeg {
+    int		fd;
+    char	*base;
+    int64_t	size;
+    int64_t	live;	// records still referenced by an index
+    bool	trimmed; // file cut back to the end after the segment closed
+    JZSeg	z;
+} *JSeg;
+
+// Frame exchanged by a replicating primary and its follower. A record
+// frame carries the record at seg and pos, a session frame the name of
+// session cnt, a hello the follower's end and session count, and an ack the
+// end of what the follower has synced. The payload follows the frame.
+typedef struct _JFrame {
+    int32_t	type;
+    int32_t	len;	// payload bytes
+    int32_t	seg;
+    int32_t	cnt;
+    int64_t	pos;
+} *JFrame;
+
+// Slot in the bounded MPSC queue feeding the writer thread. The turn is the
+// queue position the slot is ready for.
+typedef struct _JSlot {
+    volatile int64_t	turn;
+    int			sid;
+    int64_t		seq;
+    int64_t		ts;
+    IoDir		dir;
+    int			len;
+    char		*str;
+} *JSlot;
+
+typedef struct _Journal {
+    char		dir[1024];
+    char		id[48];
+    int64_t		seg_size;
+    int			seg_cnt;
+    struct _JSeg	segs[OFIX_JOURNAL_MAX_SEGS];
+    struct _JIndex	sindex;
+    struct _JIndex	rindex;
+    pthread_mutex_t	add_mutex; // serializes adds without a writer thread
+    JSession		sessions[OFIX_JOURNAL_MAX_SESSIONS]; // by sid, 0 is not used
+    volatile int	sess_cnt;
+
+    // secondary indexes, kept in memory and caught up with the segments
+    // under the idx_mutex by the writer and by queries, the time entries of
+    // earlier segments are seeded on open
+    pthread_mutex_t	idx_mutex;
+    int			key_tags[OFIX_JOURNAL_MAX_KEYS];
+    char		key_pats[OFIX_JOURNAL_MAX_KEYS][16];
+    int			key_tag_cnt;
+    int			iseg;	// next record to index
+    int64_t		ipos;
+    int64_t		irec_cnt;
+    JTime		times;
+    int64_t		time_cnt;
+    int64_t		time_max;
+    JKey		keys;
+    int64_t		key_cnt;
+    int64_t		key_max;
+    int64_t		*buckets;
+    int64_t		bucket_cnt;
+
+    // rotation and retention, applied by ofix_journal_maintain() or by the
+    // writer thread once a second when idle
+    double		roll_interval;
+    int			keep_segs;
+    double		keep_age;
+    volatile bool	maintaining;
+    bool		compress;
+    int64_t		passes;
+    pthread_mutex_t	cache_mutex;
+
+    // Readers pin the current epoch while they use mapped records and cached
+    // blocks. What maintenance retires goes into the limbo of the epoch it
+    // was retired in and the epoch moves on. A limbo is freed once no reader
+    // pinned in that epoch is left.
+    volatile int64_t	epoch;
+    volatile int64_t	pins[2];  // by epoch parity
+    JLimbo		limbo[2]; // by epoch parity
+    int64_t		limbo_cnt[2];
+    int64_t		limbo_max[2];
+
+    // replication, a primary streams records to a follower that writes them
+    // at the same positions in its own segments
+    pthread_t		repl_thread;
+    volatile bool	replicating;
+    volatile bool	repl_done;
+    bool		repl_sync; // durable only once the follower has synced
+    char		repl_host[256];
+    int			repl_port;
+    int			repl_sock; // listening socket of a follower
+    volatile int64_t	repl_acked; // end of what the follower has synced
+    pthread_mutex_t	repl_mutex;
+    pthread_cond_t	repl_cond;
+
+    // writer thread, only used after ofix_journal_start_writer()
+    pthread_t		writer;
+    volatile bool	writing;
+    volatile bool	done;
+    ofixSyncPolicy	policy;
+    int			sync_n;
+    JSlot		slots;
+    volatile int64_t	head;	// next queue position to fill
+    volatile int64_t	tail;	// next queue position to write
+    int			dirty_seg;
+    int			mark_seg; // segment of the last index checkpoint
+    int64_t		last_ts; // time of the last record written
+    pthread_mutex_t	sync_mutex;
+    pthread_cond_t	sync_cond;
+    struct _ofixErr	werr;
+} *Journal;
+
+/**
+ * Creates a journal in the __dir__ directory. Messages are appended to
+ * preallocated, memory mapped segment files and located through a memory
+ * mapped index file for each direction. Existing journal files in the
+ * directory are replaced.
+ *
+ * @param err pointer to error struct or NULL
+ * @param dir directory for the journal files, created if it does not exist
+ * @param id sender identifier recorded in each segment
+ * @param seg_size size of each segment or 0 for the default
+ * @return new journal or NULL on error
+ */
+extern Journal		ofix_journal_create(ofixErr err, const char *dir, const char *id, int64_t seg_size);
+
+/**
+ * Opens an existing journal in the __dir__ directory or creates a new one if
+ * there is none. The index files are checkpointed each time a segment is
+ * rolled so only the records written since the last checkpoint are indexed
+ * again. The records of the last segment are checked and a torn or corrupt
+ * tail left by a crash is truncated.
+ *
+ * @param err pointer to error struct or NULL
+ * @param dir directory for the journal files
+ * @param id sender identifier recorded in new segments
+ * @param seg_size size of new segments or 0 for the default
+ * @return the journal or NULL on error
+ */
+extern Journal		ofix_journal_open(ofixErr err, const char *dir, const char *id, int64_t seg_size);
+
+/**
+ * Looks up or registers the session __name__ in a journal shared by many
+ * sessions. Messages for all sessions are interleaved in the same segments
+ * and tagged with the session id. Each session has its own index files,
+ * synced at the checkpoint taken when a segment is rolled, so only the
+ * records since then are read again when the journal is opened. A name
+ * always keeps the same session id. Lookups by sequence number only see the
+ * current start of a session while ofix_journal_iterate(),
+ * ofix_journal_find(), and ofix_journal_time_range() cover every start still
+ * in the journal.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to register with
+ * @param name session name, usually the target comp ID
+ * @param fresh if true the session starts over and earlier messages for
+ *        __name__ are no longer visible
+ * @return the session id or -1 on error
+ */
+extern int		ofix_journal_session(ofixErr err, Journal j, const char *name, bool fresh);
+
+/**
+ * Returns the sequence number of the most recent add for a session and
+ * direction.
+ *
+ * @param j journal to look in
+ * @param sid session id, 0 for a journal that is not shared
+ * @param dir direction
+ * @return the last sequence number or 0
+ */
+extern int64_t		ofix_journal_last_seq(Journal j, int sid, IoDir dir);
+
+/**
+ * Sets rotation and retention for the journal. Segments are rolled when
+ * full or, if __roll_interval__ is not zero, when they are older than that.
+ * Closed segments are then maintained off the hot path: files are cut back
+ * to the bytes used, segments with no messages still referenced by an index
+ * are removed, and the oldest segments are removed to stay within
+ * __keep_segs__ and __keep_age__. Index pages that only referred to removed
+ * segments are released so memory and files stay flat. Messages in a
+ * removed segment are no longer available. The mapping of a removed segment
+ * is kept until no reader pinned with ofix_journal_pin() before the removal
+ * is left.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to set up
+ * @param roll_interval maximum seconds a segment is open or 0
+ * @param keep_segs maximum number of segments to keep or 0 for no limit
+ * @param keep_age seconds to keep a closed segment or 0 for no limit
+ */
+extern void		ofix_journal_set_retention(ofixErr err,
+						   Journal j,
+						   double roll_interval,
+						   int keep_segs,
+						   double keep_age);
+
+/**
+ * Turns compression of closed segments on or off. Closed segments are
+ * compressed in blocks of about OFIX_JOURNAL_BLOCK_SIZE bytes during
+ * maintenance and the original segment file is removed. The segment being
+ * written is never compressed. Messages in a compressed segment are still
+ * returned by ofix_journal_get() and the other reads, a block is
+ * decompressed on first use and cached until it has not been read for a
+ * while. An evicted block or the original mapping of a compressed segment
+ * is freed only once no reader pinned before the release is left.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to set up
+ * @param on true to compress closed segments
+ */
+extern void		ofix_journal_set_compress(ofixErr err, Journal j, bool on);
+
+/**
+ * Applies the retention policy. Called by the writer thread if there is one
+ * and otherwise by the owner of the journal when convenient.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to maintain
+ */
+extern void		ofix_journal_maintain(ofixErr err, Journal j);
+
+/**
+ * Streams the journal to a follower, see ofix_journal_follow(), on
+ * __host__ and __port__. Records already in the journal that the follower
+ * does not have are sent first and then new records as they are written.
+ * The connection is retried if lost. If __sync__ is true then
+ * ofix_journal_wait_durable() also waits for the follower to sync the
+ * message.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to replicate
+ * @param host host of the follower
+ * @param port port the follower listens on
+ * @param sync if true a message is durable only once the follower has it
+ */
+extern void		ofix_journal_replicate(ofixErr err, Journal j, const char *host, int port, bool sync);
+
+/**
+ * Makes the journal a hot standby for a primary that calls
+ * ofix_journal_replicate(). Records from the primary are written at the
+ * same segment positions so the journal must be created with the same
+ * segment size and not be added to while following. Frames longer than a
+ * segment drop the connection. Records are synced before they are
+ * acknowledged. On failover destroy the journal and open it again with
+ * ofix_journal_open() to resume the sessions.
+ *
+ * The follower accepts any primary that connects, so it listens on the
+ * loopback address unless __host__ names an address reachable only by the
+ * primary.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to apply the primary's records to
+ * @param host address to listen on or NULL for the loopback address
+ * @param port port to listen on for the primary
+ */
+extern void		ofix_journal_follow(ofixErr err, Journal j, const char *host, int port);
+
+/**
+ * Unmaps and closes all journal files and frees the journal.
+ *
+ * @param j journal to destroy
+ */
+extern void		ofix_journal_destroy(Journal j);
+
+/**
+ * Appends a message to the journal and records its location in the index for
+ * the __dir__ direction.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to append to
+ * @param sid session id, 0 for a journal that is not shared
+ * @param seq sequence number of the message
+ * @param dir direction of the message
+ * @param str FIX encoded message
+ * @param len length of __str__
+ */
+extern void		ofix_journal_add(ofixErr err, Journal j, int sid, int64_t seq, IoDir dir, const char *str, int len);
+
+/**
+ * Starts a writer thread for the journal. After this call
+ * ofix_journal_add() only copies the message onto a lock free queue and
+ * returns. The writer thread appends queued messages to the segments and
+ * syncs them to disk in groups according to the __policy__. A group commit
+ * syncs only the segments however many sessions share the journal.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to start the writer for
+ * @param policy when to sync to disk
+ * @param n milliseconds for __OFIX_SYNC_INTERVAL__ or messages for __OFIX_SYNC_COUNT__
+ */
+extern void		ofix_journal_start_writer(ofixErr err, Journal j, ofixSyncPolicy policy, int n);
+
+/**
+ * Waits until the message with sequence number __seq__ in the __dir__
+ * direction has been synced to disk. With the __OFIX_SYNC_NONE__ policy a
+ * message counts as durable once it is written to the segment. When
+ * replicating with sync set the follower must also have synced it.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to wait on
+ * @param sid session id, 0 for a journal that is not shared
+ * @param seq sequence number to wait for
+ * @param dir direction of the message
+ * @param timeout maximum seconds to wait
+ * @return true if the message is durable
+ */
+extern bool		ofix_journal_wait_durable(ofixErr err, Journal j, int sid, int64_t seq, IoDir dir, double timeout);
+
+/**
+ * Pins the journal so that records read while pinned stay mapped. Segments
+ * and cached blocks that maintenance removes or releases are freed only
+ * after every reader that pinned before then has unpinned. Pins are cheap
+ * but should not be held for long as nothing retired after the pin is
+ * freed until it is released.
+ *
+ * @param j journal to pin
+ * @return token to pass to ofix_journal_unpin()
+ */
+extern int64_t		ofix_journal_pin(Journal j);
+
+/**
+ * Releases a pin taken with ofix_journal_pin().
+ *
+ * @param j journal to unpin
+ * @param pin token returned by ofix_journal_pin()
+ */
+extern void		ofix_journal_unpin(Journal j, int64_t pin);
+
+/**
+ * Returns a pointer to the stored bytes of a message. The bytes are in the
+ * mapped segment or, for a compressed segment, in the block cache. They
+ * remain valid while the caller holds a pin from ofix_journal_pin() taken
+ * before the call. Without a pin they are only safe to use if nothing else
+ * maintains the journal concurrently, that is there is no writer thread
+ * and ofix_journal_maintain() is not called from another thread. If there
+ * is no message for __seq__ then NULL is returned without setting an
+ * error.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to look in
+ * @param sid session id, 0 for a journal that is not shared
+ * @param seq sequence number of the message
+ * @param dir direction of the message, __OFIX_IODIR_NONE__ checks send first
+ * @param lenp if not NULL, set to the length of the message
+ * @return the message bytes or NULL
+ */
+extern const char*	ofix_journal_get(ofixErr err, Journal j, int sid, int64_t seq, IoDir dir, int *lenp);
+
+/**
+ * Calls __cb__ with each message in the order they were added. Record
+ * boundaries come from the record headers so messages are not parsed.
+ * Iteration stops if __cb__ returns false.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to iterate over
+ * @param sid only messages for this session, all messages if negative
+ * @param cb callback
+ * @param ctx context passed to the callback
+ */
+extern void		ofix_journal_iterate(ofixErr err,
+					     Journal j,
+					     int sid,
+					     bool (*cb)(const char *str, int len, void *ctx),
+					     void *ctx);
+
+/**
+ * Adds __tag__ to the tags indexed by value. The records already written are
+ * read for the tag before the call returns, new records are indexed as they
+ * are written. Other tags and the time index are not rebuilt.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to index
+ * @param tag tag to index such as ClOrdID, OrderID, or ExecID
+ */
+extern void		ofix_journal_index_tag(ofixErr err, Journal j, int tag);
+
+/**
+ * Calls __cb__ with each message, in the order they were added, that has
+ * __value__ for an indexed __tag__. Only the first occurrence of the tag in
+ * a message is indexed. Messages still queued for the writer thread are not
+ * searched, ofix_journal_wait_durable() waits for a recent add.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to search
+ * @param sid only messages for this session, all messages if negative
+ * @param tag tag set with ofix_journal_index_tag()
+ * @param value value to look for
+ * @param cb callback, stops the search if it returns false
+ * @param ctx context passed to the callback
+ * @return the number of messages found
+ */
+extern int		ofix_journal_find(ofixErr err,
+					  Journal j,
+					  int sid,
+					  int tag,
+					  const char *value,
+					  bool (*cb)(const char *str, int len, void *ctx),
+					  void *ctx);
+
+/**
+ * Calls __cb__ with each message added from __start__ through __end__ in the
+ * order they were added. Times are nanoseconds since the epoch as recorded
+ * when each message was sent or received. A time earlier than that of the
+ * message written before it is raised to match so times never go back.
+ * Messages still queued for the writer thread are not searched.
+ *
+ * @param err pointer to error struct or NULL
+ * @param j journal to search
+ * @param sid only messages for this session, all messages if negative
+ * @param start earliest time
+ * @param end latest time
+ * @param cb callback, stops the search if it returns false
+ * @param ctx context passed to the callback
+ * @return the number of messages found
+ */
+extern int		ofix_journal_time_range(ofixErr err,
+						Journal j,
+						int sid,
+						int64_t start,
+						int64_t end,
+						bool (*cb)(const char *str, int len, void *ctx),
+						void *ctx);
+
+#endif /* __OFIX_JOURNAL_H__ */
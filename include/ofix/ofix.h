@@ -0,0 +1,19 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_H__
+#define __OFIX_H__
+
+/**
+ * Current version of oFIX.
+ */
+#define OFIX_VERSION	"1.0.0"
+
+#include "msg.h"
+#include "tag.h"
+#include "engine.h"
+#include "framer.h"
+#include "session.h"
+#include "versionspec.h"
+#include "typed.h"
+
+#endif /* __OFIX_H__ */
@@ -0,0 +1,12 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_ROLE_H__
+#define __OFIX_ROLE_H__
+
+typedef enum {
+    OFIX_ROLE_NONE	= 0,
+    OFIX_ROLE_SERVER	= 's',
+    OFIX_ROLE_CLIENT	= 'c',
+} ofixRole;
+
+#endif /* __OFIX_ROLE_H__ */
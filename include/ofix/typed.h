@@ -0,0 +1,182 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_TYPED_H__
+#define __OFIX_TYPED_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "err.h"
+#include "msg.h"
+#include "date.h"
+
+/**
+ * @file typed.h
+ *
+ * This file defines the support types and functions used by the code
+ * generated typed message structs. Each FIX version spec has a generated
+ * header (fix44msgs.h for example) with a plain C struct for each message type
+ * along with decode and encode functions for that struct. The decode functions
+ * fill the struct in a single pass over the raw FIX string.
+ */
+
+/**
+ * A view into the characters of a field value. The view is only valid as
+ * long as the raw FIX string it was decoded from is valid. The characters are
+ * not NULL terminated.
+ */
+typedef struct _ofixStrView {
+    const char	*str;
+    int		len;
+} *ofixStrView;
+
+/**
+ * A decimal value that is exact in its representation of the FIX float
+ * types. The value represented is mantissa / 10^scale.
+ */
+typedef struct _ofixDecimal {
+    int64_t	mantissa;
+    int		scale;
+} *ofixDecimal;
+
+// Groups nested deeper are not tracked.
+#define OFIX_TYPED_GROUP_DEPTH	16
+
+/**
+ * A repeating group of a message as known to the generated decode
+ * functions. The members are the tags directly in the group, starting with
+ * the delimiter and ending with a 0. The parent is the index of the
+ * enclosing group or -1 for a group at the top level.
+ */
+typedef struct _ofixTypedGroup {
+    int		num_tag;
+    int		parent;
+    const int	*members;
+} *ofixTypedGroup;
+
+/**
+ * The scanner used by the generated decode functions. The members of the
+ * structure should not be modified directly. They are visible only to allow
+ * the structure to be allocated on the stack.
+ */
+typedef struct _ofixTypedScan {
+    const char	*cur;
+    const char	*end;
+    const char	*value;
+    int		vlen;
+    int		data_tag;
+    int64_t	data_len;
+    // group scope, in_group is set when the last field is in a group
+    const struct _ofixTypedGroup	*groups;
+    int				group_cnt;
+    int				depth;
+    bool			in_group;
+    int				stack[OFIX_TYPED_GROUP_DEPTH];
+    int				entries[OFIX_TYPED_GROUP_DEPTH];
+} *ofixTypedScan;
+
+/**
+ * Initializes a scanner over a raw FIX message string.
+ *
+ * @param scan scanner to initialize
+ * @param raw FIX message as an array of characters
+ * @param len the number of characters in the FIX message
+ */
+static inline void
+ofix_typed_scan_init(ofixTypedScan scan, const char *raw, int len) {
+    scan->cur = raw;
+    scan->end = raw + len;
+    scan->value = NULL;
+    scan->vlen = 0;
+    scan->data_tag = 0;
+    scan->data_len = 0;
+    scan->groups = NULL;
+    scan->group_cnt = 0;
+    scan->depth = 0;
+    scan->in_group = false;
+}
+
+/**
+ * Sets the repeating groups of the message being scanned. Fields in a group
+ * entry are then flagged with in_group so they are not taken for top level
+ * fields with the same tag. A group ends, as when a message is parsed, at
+ * the first field that is neither its delimiter nor one of its members.
+ *
+ * @param scan scanner to set the groups of
+ * @param groups the groups of the message
+ * @param cnt the number of groups
+ */
+static inline void
+ofix_typed_scan_groups(ofixTypedScan scan, const struct _ofixTypedGroup *groups, int cnt) {
+    scan->groups = groups;
+    scan->group_cnt = cnt;
+}
+
+/**
+ * Moves to the next field and returns its tag or 0 when there are no more
+ * fields or an error occurred.
+ *
+ * @param err pointer to error struct or NULL
+ * @param scan scanner to advance
+ */
+extern int	ofix_typed_scan_next(ofixErr err, ofixTypedScan scan);
+
+/**
+ * Reads the current field value as a Length and sets up the scanner to read
+ * the next field identified by data_tag as raw data of that length.
+ *
+ * @param err pointer to error struct or NULL
+ * @param scan scanner to read from
+ * @param data_tag the tag of the Data field the length is for
+ * @return the length value
+ */
+extern int64_t	ofix_typed_scan_length(ofixErr err, ofixTypedScan scan, int data_tag);
+
+extern int64_t	ofix_typed_int(ofixErr err, ofixTypedScan scan, int tag);
+extern void	ofix_typed_decimal(ofixErr err, ofixTypedScan scan, int tag, ofixDecimal value);
+extern void	ofix_typed_date(ofixErr err, ofixTypedScan scan, int tag, ofixDateType type, ofixDate value);
+
+static inline char
+ofix_typed_char(ofixTypedScan scan) {
+    return (0 < scan->vlen) ? *scan->value : '\0';
+}
+
+static inline void
+ofix_typed_view(ofixTypedScan scan, ofixStrView value) {
+    value->str = scan->value;
+    value->len = scan->vlen;
+}
+
+static inline bool
+ofix_typed_has(const uint64_t *present, int bit) {
+    return 0 != (present[bit >> 6] & (1ULL << (bit & 0x3F)));
+}
+
+static inline void
+ofix_typed_mark(uint64_t *present, int bit) {
+    present[bit >> 6] |= (1ULL << (bit & 0x3F));
+}
+
+/**
+ * Returns the decimal as a double.
+ *
+ * @param value the decimal to convert
+ */
+extern double	ofix_decimal_to_double(ofixDecimal value);
+
+/**
+ * Writes the decimal as a FIX float string into buf and returns the number of
+ * characters written, not including the terminating NULL.
+ *
+ * @param value the decimal to write
+ * @param buf buffer to write to, must be at least 32 characters long
+ */
+extern int	ofix_decimal_to_str(ofixDecimal value, char *buf);
+
+// Used by the generated encode functions.
+extern void	ofix_typed_set_int(ofixErr err, ofixMsg msg, int tag, int64_t value);
+extern void	ofix_typed_set_decimal(ofixErr err, ofixMsg msg, int tag, ofixDecimal value);
+extern void	ofix_typed_set_char(ofixErr err, ofixMsg msg, int tag, char value);
+extern void	ofix_typed_set_view(ofixErr err, ofixMsg msg, int tag, ofixStrView value);
+
+#endif /* __OFIX_TYPED_H__ */
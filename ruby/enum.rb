@@ -5,6 +5,7 @@ class Enum
 
   attr_reader :name
   attr_reader :tag
+  attr_reader :value
 
   def initialize(xe)
     @value = xe.attributes['enum']
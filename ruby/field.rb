@@ -30,8 +30,38 @@ class Field
   end
 
   def gen_c(f)
-    f.write(%|    { #{@tag}, OFIX_#{@type}, OFIX_#{@where}, #{@related}, #{@tag.to_s.size + 1}, "#{@tag}=", "#{@name}" },
+    if enum_values.empty?
+      f.write(%|    { #{@tag}, OFIX_#{@type}, OFIX_#{@where}, #{@related}, #{@tag.to_s.size + 1}, "#{@tag}=", "#{@name}" },
 |)
+    else
+      f.write(%|    { #{@tag}, OFIX_#{@type}, OFIX_#{@where}, #{@related}, #{@tag.to_s.size + 1}, "#{@tag}=", "#{@name}", &enum#{@tag} },
+|)
+    end
+  end
+
+  def enum_values()
+    return [] if @enums.nil?
+    @enums.map { |e| e.value }.compact.uniq.sort
+  end
+
+  # Single character values are written as a 256 bit map, all others as a
+  # sorted array of strings suitable for a binary search.
+  def gen_enum_c(f)
+    values = enum_values
+    return if values.empty?
+    if values.all? { |v| 1 == v.bytesize }
+      words = [0] * 4
+      values.each { |v|
+        c = v.bytes[0]
+        words[c >> 6] |= 1 << (c & 0x3F)
+      }
+      f.write(%|static struct _ofixEnumSpec	enum#{@tag} = { { #{words.map { |w| '0x%016xULL' % w }.join(', ')} }, 0, 0 }; // #{@name}
+|)
+    else
+      f.write(%|static const char	*enum#{@tag}_values[] = { #{values.map { |v| v.inspect }.join(', ')} };
+static struct _ofixEnumSpec	enum#{@tag} = { { 0, 0, 0, 0 }, #{values.size}, enum#{@tag}_values }; // #{@name}
+|)
+    end
   end
 
   def ofix_type(t)
@@ -20,6 +20,7 @@ require 'spec'
 
 $verbosity = 1
 $out_path = nil
+$typed_path = nil
 
 $opts = OptionParser.new(%|Usage: ofix_ref_to_c.rb [options] <xml-ref>
 
@@ -31,6 +32,7 @@ $opts.on('-s', 'decrease verbosity')                                   { $verbos
 $opts.on('-v', 'increase verbosity')                                   { $verbosity -= 1 }
 $opts.on('-I', '--load-path String', String, 'load path')              { |p| $: << p }
 $opts.on('-o', '--outfile String', String, 'output file path')         { |p| $out_path = p }
+$opts.on('-t', '--typed String', String, 'typed message base path')    { |p| $typed_path = p }
 $opts.on('-h', '--help', 'Show this display')                          { puts $opts.help; Process.exit!(0) }
 files = $opts.parse(ARGV)
 
@@ -53,6 +55,10 @@ begin
   else
     File.open($out_path, 'w') { |f| spec.gen_c(f) }
   end
+  unless $typed_path.nil?
+    File.open("#{$typed_path}.h", 'w') { |f| spec.gen_typed_h(f) }
+    File.open("#{$typed_path}.c", 'w') { |f| spec.gen_typed_c(f, "#{File.basename($typed_path)}.h") }
+  end
 rescue Exception => e
   puts "-*-*- #{e.class}: #{e.message}"
   e.backtrace.each { |line| puts "    #{line}" }
@@ -20,22 +20,32 @@ class Member
     @tag = 0 # filled in later
   end
 
-  def expand(spec, ma)
+  # Fields in an optional component are not required even if marked as
+  # required in the component definition. The required flag only applies when
+  # the component itself is included.
+  def expand(spec, ma, required=true)
     if 'component' == @kind
       if @name.nil? # header or trailer
-        @members.each { |m| m.expand(spec, ma) }
+        @members.each { |m| m.expand(spec, ma, required) }
       else
         raise Exception.new("failed to find component #{@name}.") if (c = spec.find_component(@name)).nil?
-        c.members.each { |m| m.expand(spec, ma) }
+        c.members.each { |m| m.expand(spec, ma, required && @required) }
       end
     elsif 'group' == @kind
       a = []
       @members.each { |m| m.expand(spec, a) }
       @members = a
-      ma << self
+      ma << optional_copy(required)
     else
-      ma << self
+      ma << optional_copy(required)
     end
   end
 
+  def optional_copy(required)
+    return self if required || !@required
+    m = dup
+    m.required = false
+    m
+  end
+
 end # Member
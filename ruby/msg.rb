@@ -3,6 +3,9 @@
 
 class Msg
 
+  # Must match OFIX_TAG_BITS_WORDS in msgspec.h.
+  BITSET_WORDS = 16
+
   attr_reader :name
   attr_reader :type
   attr_reader :members
@@ -34,6 +37,7 @@ class Msg
     f.write(%|
 static struct _ofixGroupSpec	#{@name}Group#{g.tag} = {
     #{g.tag}, // #{g.name}
+    {#{bitset(g.members.map { |m| m.tag })}}, // members
     {
 |)
     g.members.each { |m|
@@ -100,6 +104,8 @@ static struct _ofixMsgSpec	#{@name} = {
     "#{@type}", // type
     "#{@name}", // name
     {#{tagSeq.join(',')}},
+    {#{bitset(required_tags(expanded))}}, // required
+    {#{bitset(allowed_tags(expanded, []))}}, // allowed
     #{@name}Groups, // groups
     {
 |)
@@ -110,6 +116,202 @@ static struct _ofixMsgSpec	#{@name} = {
     }
 };
 
+|)
+  end
+
+  # Tags that must be present at the top level of the message.
+  def required_tags(expanded)
+    expanded.select { |m| m.required }.map { |m| m.tag }
+  end
+
+  # All tags that may appear in the message including those in groups.
+  def allowed_tags(ma, tags)
+    ma.each { |m|
+      tags << m.tag
+      allowed_tags(m.members, tags) if 'group' == m.kind
+    }
+    tags
+  end
+
+  # Bits for tags below OFIX_TAG_BITS_SIZE as a list of 64 bit words.
+  def bitset(tags)
+    words = [0] * BITSET_WORDS
+    tags.each { |t|
+      words[t >> 6] |= 1 << (t & 0x3F) if 0 < t && t < BITSET_WORDS * 64
+    }
+    words.map { |w| '0x%016xULL' % w }.join(',')
+  end
+
+  # Top level fields of the message, deduplicated by tag. Group counts are
+  # included but the fields in the group are not.
+  def typed_fields(spec)
+    expanded = []
+    expand(@members, expanded)
+    seen = {}
+    fields = []
+    expanded.each { |m|
+      next if 0 >= m.tag || seen.has_key?(m.tag)
+      next if (field = spec.find_field(m.name)).nil?
+      seen[m.tag] = true
+      fields << field
+    }
+    fields
+  end
+
+  # Groups in the order they are found along with the index of the enclosing
+  # group, -1 for a group at the top level.
+  def typed_groups(ma, parent, found)
+    ma.each { |m|
+      next unless 'group' == m.kind
+      found << [m, parent]
+      typed_groups(m.members, found.size - 1, found)
+    }
+    found
+  end
+
+  # Length fields in groups have to be decoded so that the Data that follows
+  # is skipped correctly even though the group fields are not in the struct.
+  def group_lengths(ma, spec, found)
+    ma.each { |m|
+      next unless 'group' == m.kind
+      m.members.each { |gm|
+        field = spec.find_field(gm.name)
+        found << field if !field.nil? && 'Length' == field.type && 0 != field.related
+      }
+      group_lengths(m.members, spec, found)
+    }
+  end
+
+  def gen_typed_h(f, spec)
+    prefix = "fix#{spec.major}#{spec.minor}"
+    fields = typed_fields(spec)
+    f.write(%|
+// #{@name} [#{@type}]
+enum {
+|)
+    fields.each_with_index { |field, i|
+      f.write("    #{prefix.upcase}_#{@name}_#{field.name} = #{i},\n")
+    }
+    f.write(%|};
+
+typedef struct _#{prefix}#{@name} {
+    uint64_t	present[#{(fields.size + 63) / 64}];
+|)
+    fields.each { |field|
+      f.write("    #{Typed.ctype(field)}\t#{field.name};\n")
+    }
+    f.write(%|} *#{prefix}#{@name};
+
+extern void	#{prefix}_decode_#{@name}(ofixErr err, #{prefix}#{@name} m, const char *raw, int len);
+extern void	#{prefix}_decode_#{@name}_msg(ofixErr err, #{prefix}#{@name} m, ofixMsg msg);
+extern ofixMsg	#{prefix}_encode_#{@name}(ofixErr err, #{prefix}#{@name} m);
+|)
+  end
+
+  def gen_typed_c(f, spec)
+    prefix = "fix#{spec.major}#{spec.minor}"
+    fields = typed_fields(spec)
+    groups = typed_groups(@members, -1, [])
+    lengths = []
+    group_lengths(@members, spec, lengths)
+    lengths = lengths.uniq { |field| field.tag }
+    f.write(%|
+// #{@name} [#{@type}]
+|)
+    unless groups.empty?
+      f.write("\n")
+      groups.each { |g, _|
+        f.write("static const int\t#{@name}Group#{g.tag}[] = { #{g.members.map { |m| m.tag }.join(', ')}, 0 };\n")
+      }
+      f.write(%|
+static const struct _ofixTypedGroup	#{@name}Groups[] = {
+|)
+      groups.each { |g, parent|
+        f.write("    { #{g.tag}, #{parent}, #{@name}Group#{g.tag} }, // #{g.name}\n")
+      }
+      f.write("};\n")
+    end
+    f.write(%|
+void
+#{prefix}_decode_#{@name}(ofixErr err, #{prefix}#{@name} m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+\treturn;
+    }
+    memset(m, 0, sizeof(struct _#{prefix}#{@name}));
+    ofix_typed_scan_init(&scan, raw, len);
+|)
+    unless groups.empty?
+      f.write("    ofix_typed_scan_groups(&scan, #{@name}Groups, #{groups.size});\n")
+    end
+    f.write("    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {\n")
+    unless groups.empty?
+      # Group fields are not in the struct and must not overwrite the top
+      # level fields with the same tag.
+      f.write("\tif (scan.in_group) {\n")
+      unless lengths.empty?
+        f.write("\t    switch (tag) {\n")
+        lengths.each { |field|
+          f.write(%|\t    case #{field.tag}: // #{field.name}
+\t\tofix_typed_scan_length(err, &scan, #{field.related});
+\t\tbreak;
+|)
+        }
+        f.write("\t    default:\n\t\tbreak;\n\t    }\n")
+      end
+      f.write("\t    continue;\n\t}\n")
+    end
+    f.write(%|\tswitch (tag) {
+|)
+    fields.each { |field|
+      f.write(%|\tcase #{field.tag}: // #{field.name}
+\t    #{Typed.decode(field, "m->#{field.name}")}
+\t    ofix_typed_mark(m->present, #{prefix.upcase}_#{@name}_#{field.name});
+\t    break;
+|)
+    }
+    f.write(%|\tdefault:
+\t    break;
+\t}
+    }
+}
+
+void
+#{prefix}_decode_#{@name}_msg(ofixErr err, #{prefix}#{@name} m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+\treturn;
+    }
+    #{prefix}_decode_#{@name}(err, m, raw, len);
+}
+
+ofixMsg
+#{prefix}_encode_#{@name}(ofixErr err, #{prefix}#{@name} m) {
+    ofixMsg	msg = ofix_msg_create(err, "#{@type}", #{spec.major}, #{spec.minor}, #{fields.size});
+
+    if (NULL == msg) {
+\treturn NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+|)
+    fields.each { |field|
+      next if Typed::SKIP_ENCODE.include?(field.tag)
+      f.write(%|    if (ofix_typed_has(m->present, #{prefix.upcase}_#{@name}_#{field.name})) {
+\t#{Typed.encode(field, "m->#{field.name}")}
+    }
+|)
+    }
+    f.write(%|    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+\tofix_msg_destroy(msg);
+\treturn NULL;
+    }
+    return msg;
+}
 |)
   end
 
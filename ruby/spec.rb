@@ -4,6 +4,7 @@
 require 'field'
 require 'comp'
 require 'msg'
+require 'typed'
 
 class Spec
 
@@ -115,6 +116,12 @@ class Spec
 
 extern struct _ofixVersionSpec	fix#{@major}#{@minor}Spec;
 
+// ----- Enums -----
+|)
+    @fields.values.sort_by { |x| x.tag }.each { |field|
+      field.gen_enum_c(f)
+    }
+    f.write(%|
 // ----- Tags -----
 static struct _ofixTagSpec	tags[] = {
 |)
@@ -140,6 +147,8 @@ struct _ofixVersionSpec	fix#{@major}#{@minor}Spec = {
     false, // ready
     tags, // tags
     { 0 }, // tagTable
+    0, // highTags
+    0, // highCnt
     {
 |)
     
@@ -152,4 +161,40 @@ struct _ofixVersionSpec	fix#{@major}#{@minor}Spec = {
 |)
   end
 
+  def gen_typed_h(f)
+    guard = "__OFIX_FIX#{@major}#{@minor}MSGS_H__"
+    f.write(%|
+// This file is auto-generated from ref/FIX#{@major}#{@minor}.xml and should not be modified.
+
+#ifndef #{guard}
+#define #{guard}
+
+#include <stdint.h>
+
+#include "ofix/err.h"
+#include "ofix/msg.h"
+#include "ofix/date.h"
+#include "ofix/typed.h"
+|)
+    @msgs.values.sort_by { |m| m.type }.each { |m|
+      m.gen_typed_h(f, self)
+    }
+    f.write(%|
+#endif /* #{guard} */
+|)
+  end
+
+  def gen_typed_c(f, header)
+    f.write(%|
+// This file is auto-generated from ref/FIX#{@major}#{@minor}.xml and should not be modified.
+
+#include <string.h>
+
+#include "#{header}"
+|)
+    @msgs.values.sort_by { |m| m.type }.each { |m|
+      m.gen_typed_c(f, self)
+    }
+  end
+
 end # Spec
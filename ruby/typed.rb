@@ -0,0 +1,61 @@
+# encoding: UTF-8
+# Copyright 2015 by Peter Ohler, All Rights Reserved
+
+# Mapping of oFIX tag types to the C types used in the generated typed message
+# structs along with the code fragments to decode and encode each.
+module Typed
+
+  INT_TYPES = %w{ Int Length NumInGroup SeqNum DayOfMonth }
+  DECIMAL_TYPES = %w{ Float Qty Price PriceOffset Amt Percentage }
+  CHAR_TYPES = %w{ Char Boolean }
+  DATE_TYPES = {
+    'UTCTimestamp' => 'OFIX_TIMESTAMP',
+    'UTCTimeOnly' => 'OFIX_TIMEONLY',
+    'UTCDateOnly' => 'OFIX_DATEONLY',
+    'Time' => 'OFIX_TIME',
+  }
+  # Tags that are set by ofix_msg_create() or when the message is sent.
+  SKIP_ENCODE = [8, 9, 35, 10]
+
+  def self.ctype(field)
+    t = field.type
+    return 'int64_t' if INT_TYPES.include?(t)
+    return 'struct _ofixDecimal' if DECIMAL_TYPES.include?(t)
+    return 'char' if CHAR_TYPES.include?(t)
+    return 'struct _ofixDate' if DATE_TYPES.has_key?(t)
+    'struct _ofixStrView'
+  end
+
+  def self.decode(field, var)
+    t = field.type
+    if 'Length' == t && 0 != field.related
+      "#{var} = ofix_typed_scan_length(err, &scan, #{field.related});"
+    elsif INT_TYPES.include?(t)
+      "#{var} = ofix_typed_int(err, &scan, #{field.tag});"
+    elsif DECIMAL_TYPES.include?(t)
+      "ofix_typed_decimal(err, &scan, #{field.tag}, &#{var});"
+    elsif CHAR_TYPES.include?(t)
+      "#{var} = ofix_typed_char(&scan);"
+    elsif DATE_TYPES.has_key?(t)
+      "ofix_typed_date(err, &scan, #{field.tag}, #{DATE_TYPES[t]}, &#{var});"
+    else
+      "ofix_typed_view(&scan, &#{var});"
+    end
+  end
+
+  def self.encode(field, var)
+    t = field.type
+    if INT_TYPES.include?(t)
+      "ofix_typed_set_int(err, msg, #{field.tag}, #{var});"
+    elsif DECIMAL_TYPES.include?(t)
+      "ofix_typed_set_decimal(err, msg, #{field.tag}, &#{var});"
+    elsif CHAR_TYPES.include?(t)
+      "ofix_typed_set_char(err, msg, #{field.tag}, #{var});"
+    elsif DATE_TYPES.has_key?(t)
+      "ofix_msg_set_date(err, msg, #{field.tag}, &#{var});"
+    else
+      "ofix_typed_set_view(err, msg, #{field.tag}, &#{var});"
+    end
+  end
+
+end # Typed
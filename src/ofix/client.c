@@ -18,6 +18,7 @@
 #include "engine.h"
 #include "store.h"
 #include "tag.h"
+#include "versionspec.h"
 #include "private.h"
 
 struct _ofixClient {
@@ -38,6 +39,8 @@ ofix_client_create(ofixErr err,
     if (NULL != err && OFIX_OK != err->code) {
 	return NULL;
     }
+    // Build the spec tables before any session threads are started.
+    ofix_init(err);
     if (NULL == sid) {
 	if (NULL != err) {
 	    err->code = OFIX_ARG_ERR;
@@ -79,6 +82,27 @@ ofix_client_set_credentials(ofixClient client, const char *user, const char *pas
     }
 }
 
+void
+ofix_client_open_store(ofixErr err, ofixClient client, const char *dir) {
+    Store	store;
+    int64_t	sent_seq = 0;
+    int64_t	recv_seq = 0;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == (store = ofix_store_open(err, dir, client->session.sid, &sent_seq, &recv_seq))) {
+	return;
+    }
+    if (NULL != client->session.store) {
+	ofix_store_destroy(client->session.store);
+    }
+    client->session.store = store;
+    client->session.sent_seq = sent_seq;
+    client->session.recv_seq = recv_seq;
+    client->session.resume = true;
+}
+
 void
 ofix_client_destroy(ofixErr err, ofixClient client) {
     if (NULL != client) {
@@ -98,7 +122,9 @@ logon(ofixErr err, ofixClient client) {
     }
     ofix_msg_set_int(err, msg, OFIX_EncryptMethodTAG, 0); // not encrypted
     ofix_msg_set_int(err, msg, OFIX_HeartBtIntTAG, client->session.heartbeat_interval);
-    ofix_msg_set_bool(err, msg, OFIX_ResetSeqNumFlagTAG, true);
+    if (!client->session.resume || 0 == client->session.sent_seq) {
+	ofix_msg_set_bool(err, msg, OFIX_ResetSeqNumFlagTAG, true);
+    }
     //ofix_msg_set_bool(err, msg, OFIX_TestMessageIndicatorTAG, true);
     if (NULL != client->user) {
 	ofix_msg_set_str(err, msg, OFIX_UsernameTAG, client->user);
@@ -238,6 +264,21 @@ ofix_client_set_heartbeat(ofixClient client, int interval) {
     ofix_session_set_heartbeat(&client->session, interval);
 }
 
+void
+ofix_client_set_send_delay(ofixClient client, int usec) {
+    ofix_session_set_send_delay(&client->session, usec);
+}
+
+void
+ofix_client_set_validate(ofixClient client, ofixValidate mode) {
+    ofix_session_set_validate(&client->session, mode);
+}
+
+void
+ofix_client_set_busy_poll(ofixClient client, bool on, int cpu) {
+    ofix_session_set_busy_poll(&client->session, on, cpu);
+}
+
 ofixSession
 _ofix_client_get_session(ofixClient client) {
     return &client->session;
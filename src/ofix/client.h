@@ -34,6 +34,17 @@ extern ofixClient	ofix_client_create(ofixErr err,
 
 extern void		ofix_client_set_credentials(ofixClient client, const char *user, const char *password);
 
+/**
+ * Replaces the client store with the journal in __dir__, creating it if
+ * needed, and continues from the last stored sequence numbers. A resumed
+ * client does not set ResetSeqNumFlag on logon.
+ *
+ * @param err pointer to error struct or NULL
+ * @param client client to open the store for
+ * @param dir journal directory
+ */
+extern void		ofix_client_open_store(ofixErr err, ofixClient client, const char *dir);
+
 /**
  *
  *
@@ -71,5 +82,11 @@ extern int64_t	ofix_client_recv_seqnum(ofixClient client);
 
 extern void	ofix_client_set_log(ofixClient client, ofixLogOn log_on, ofixLog log, void *ctx);
 extern void	ofix_client_set_heartbeat(ofixClient client, int interval);
+// see ofix_session_set_send_delay()
+extern void	ofix_client_set_send_delay(ofixClient client, int usec);
+// see ofix_session_set_validate()
+extern void	ofix_client_set_validate(ofixClient client, ofixValidate mode);
+// see ofix_session_set_busy_poll(), call before connecting
+extern void	ofix_client_set_busy_poll(ofixClient client, bool on, int cpu);
 
 #endif /* __OFIX_CLIENT_H__ */
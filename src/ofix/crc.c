@@ -0,0 +1,71 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <pthread.h>
+#include <stdbool.h>
+#include <string.h>
+
+#include "crc.h"
+
+#define CRC32C_POLY	0x82F63B78
+
+static uint32_t		table[256];
+static bool		use_hw = false;
+static pthread_once_t	init_once = PTHREAD_ONCE_INIT;
+
+static void
+init_table() {
+    uint32_t	crc;
+    int		i;
+    int		k;
+
+    for (i = 0; i < 256; i++) {
+	crc = i;
+	for (k = 0; k < 8; k++) {
+	    crc = (crc & 1) ? (crc >> 1) ^ CRC32C_POLY : crc >> 1;
+	}
+	table[i] = crc;
+    }
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    __builtin_cpu_init();
+    use_hw = __builtin_cpu_supports("sse4.2");
+#endif
+}
+
+static uint32_t
+sw_crc(uint32_t crc, const uint8_t *b, size_t len) {
+    for (; 0 < len; len--, b++) {
+	crc = table[(crc ^ *b) & 0xFF] ^ (crc >> 8);
+    }
+    return crc;
+}
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+__attribute__((target("sse4.2")))
+static uint32_t
+hw_crc(uint32_t crc, const uint8_t *b, size_t len) {
+    uint64_t	c = crc;
+    uint64_t	v;
+
+    for (; 8 <= len; len -= 8, b += 8) {
+	memcpy(&v, b, sizeof(v));
+	c = __builtin_ia32_crc32di(c, v);
+    }
+    crc = (uint32_t)c;
+    for (; 0 < len; len--, b++) {
+	crc = __builtin_ia32_crc32qi(crc, *b);
+    }
+    return crc;
+}
+#endif
+
+uint32_t
+ofix_crc32c(uint32_t crc, const void *buf, size_t len) {
+    pthread_once(&init_once, init_table);
+    crc = ~crc;
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+    if (use_hw) {
+	return ~hw_crc(crc, (const uint8_t*)buf, len);
+    }
+#endif
+    return ~sw_crc(crc, (const uint8_t*)buf, len);
+}
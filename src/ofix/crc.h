@@ -0,0 +1,21 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_CRC_H__
+#define __OFIX_CRC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * Continues a CRC32C (Castagnoli) checksum over __len__ bytes. Start with a
+ * __crc__ of 0. The SSE 4.2 crc32 instruction is used when the CPU supports
+ * it, otherwise a table driven version.
+ *
+ * @param crc checksum so far
+ * @param buf bytes to add
+ * @param len number of bytes to add
+ * @return the updated checksum
+ */
+extern uint32_t	ofix_crc32c(uint32_t crc, const void *buf, size_t len);
+
+#endif /* __OFIX_CRC_H__ */
@@ -123,3 +123,80 @@ ofix_date_set_timestamp(ofixDate ts, uint64_t usec) {
     ts->msec = usec / 1000ULL;
     ts->type = OFIX_TIMESTAMP;
 }
+
+static inline int
+read_digits(const char *s, int cnt) {
+    int	v = 0;
+
+    for (; 0 < cnt; cnt--, s++) {
+	v = v * 10 + (*s - '0');
+    }
+    return v;
+}
+
+// Parses the FIX string representation of a date or time of the type
+// specified. Returns false if the string is not valid for the type.
+bool
+ofix_date_parse(ofixDate date, ofixDateType type, const char *str, int len) {
+    const char	*s;
+
+    for (s = str + len - 1; str <= s; s--) {
+	if ((*s < '0' || '9' < *s) && '-' != *s && ':' != *s && '.' != *s) {
+	    return false;
+	}
+    }
+    date->year = 0;
+    date->month = 0;
+    date->week = 0;
+    date->day = 0;
+    date->hour = 0;
+    date->minute = 0;
+    date->sec = 0;
+    date->msec = 0;
+    date->type = type;
+    switch (type) {
+    case OFIX_TIMEONLY:	// HH:MM:SS or HH:MM:SS.sss
+	if (8 != len && 12 != len) {
+	    return false;
+	}
+	date->hour = read_digits(str, 2);
+	date->minute = read_digits(str + 3, 2);
+	date->sec = read_digits(str + 6, 2);
+	if (12 == len) {
+	    date->msec = read_digits(str + 9, 3);
+	}
+	break;
+    case OFIX_DATEONLY:	// YYYYMMDD
+	if (8 != len) {
+	    return false;
+	}
+	date->year = read_digits(str, 4);
+	date->month = read_digits(str + 4, 2);
+	date->day = read_digits(str + 6, 2);
+	break;
+    case OFIX_YYYYMM:
+	if (6 != len) {
+	    return false;
+	}
+	date->year = read_digits(str, 4);
+	date->month = read_digits(str + 4, 2);
+	break;
+    case OFIX_TIME:		// YYYYMMDD-HH:MM:SS
+    case OFIX_TIMESTAMP:	// YYYYMMDD-HH:MM:SS.sss or YYYYMMDD-HH:MM:SS
+    default:
+	if (17 != len && (OFIX_TIME == type || 21 != len)) {
+	    return false;
+	}
+	date->year = read_digits(str, 4);
+	date->month = read_digits(str + 4, 2);
+	date->day = read_digits(str + 6, 2);
+	date->hour = read_digits(str + 9, 2);
+	date->minute = read_digits(str + 12, 2);
+	date->sec = read_digits(str + 15, 2);
+	if (21 == len) {
+	    date->msec = read_digits(str + 18, 3);
+	}
+	break;
+    }
+    return ofix_date_is_valid(date);
+}
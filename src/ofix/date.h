@@ -30,5 +30,6 @@ typedef struct _ofixDate {
 extern bool	ofix_date_is_valid(ofixDate date);
 extern char*	ofix_date_to_str(ofixDate date);
 extern void	ofix_date_set_timestamp(ofixDate ts, uint64_t usec);
+extern bool	ofix_date_parse(ofixDate date, ofixDateType type, const char *str, int len);
 
 #endif /* __OFIX_DATE_H__ */
@@ -20,6 +20,7 @@
 #include "store.h"
 #include "session.h"
 #include "tag.h"
+#include "versionspec.h"
 #include "private.h"
 
 typedef struct _EngSession {
@@ -44,6 +45,11 @@ struct _ofixEngine {
     char		*auth_data;
     Auth		auths;
     int 		heartbeat_interval;
+    int			send_delay;
+    ofixValidate	validate;
+    bool		resume;
+    Journal		journal;
+    Reactor		reactor;
     bool		done;
     bool		closed;
     EngSession		sessions;
@@ -101,8 +107,12 @@ session_create(ofixErr err, struct _ofixEngine *eng, int sock) {
     es->session.log = eng->log;
     es->session.log_ctx = eng->log_ctx;
     es->session.heartbeat_interval = eng->heartbeat_interval;
+    es->session.send_delay = eng->send_delay;
+    es->session.validate = eng->validate;
     strncpy(es->session.store_dir, eng->store_dir, sizeof(es->session.store_dir));
     es->session.store_dir[sizeof(es->session.store_dir) - 1] = '\0';
+    es->session.resume = eng->resume;
+    es->session.journal = eng->journal;
 
     return es;
 }
@@ -275,6 +285,8 @@ ofix_engine_create(ofixErr err,
     if (NULL != err && OFIX_OK != err->code) {
 	return NULL;
     }
+    // Build the spec tables before any session threads are started.
+    ofix_init(err);
     ofixEngine	eng = (ofixEngine)malloc(sizeof(struct _ofixEngine));
 
     if (NULL == eng) {
@@ -332,6 +344,11 @@ ofix_engine_create(ofixErr err,
 	}
     }
     eng->heartbeat_interval = heartbeat_interval;
+    eng->send_delay = 0;
+    eng->validate = OFIX_VALIDATE_NONE;
+    eng->resume = false;
+    eng->journal = NULL;
+    eng->reactor = NULL;
 
     return eng;
 }
@@ -358,6 +375,8 @@ ofix_engine_destroy(ofixErr err, ofixEngine eng) {
 	while (dtime() < give_up && !eng->closed) {
 	    dsleep(0.1);
 	}
+	_ofix_reactor_destroy(eng->reactor);
+	ofix_journal_destroy(eng->journal);
 	free(eng->id);
 	free(eng->ipaddr);
 	free(eng->store_dir);
@@ -418,6 +437,7 @@ ofix_engine_start(ofixErr err, ofixEngine eng) {
     int			csock;
     int			ssock;
     int			cnt;
+    int			on = 1;
 
     if (-1 == (ssock = socket(AF_INET, SOCK_STREAM, 0))) {
 	if (NULL != err) {
@@ -426,6 +446,8 @@ ofix_engine_start(ofixErr err, ofixEngine eng) {
 	}
 	return;
     }
+    // sessions closed by the engine leave the port in TIME_WAIT
+    setsockopt(ssock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
     memset(&server_addr, 0, sizeof(server_addr));
     server_addr.sin_family = AF_INET;
     server_addr.sin_addr.s_addr = htonl(INADDR_ANY);
@@ -481,7 +503,11 @@ ofix_engine_start(ofixErr err, ofixEngine eng) {
 		} else {
 		    session->next = eng->sessions;
 		    eng->sessions = session;
-		    _ofix_session_start(err, &session->session, false);
+		    if (NULL == eng->reactor) {
+			_ofix_session_start(err, &session->session, false);
+		    } else {
+			_ofix_reactor_add(err, eng->reactor, &session->session);
+		    }
 		    if (NULL != err && OFIX_OK != err->code) {
 			eng->log(eng->log_ctx, OFIX_WARN, "Failed to start session. %s", err->msg);
 			close(csock);
@@ -560,3 +586,130 @@ void
 ofix_engine_set_heartbeat(ofixEngine eng, int interval) {
     eng->heartbeat_interval = interval;
 }
+
+void
+ofix_engine_set_send_delay(ofixEngine eng, int usec) {
+    eng->send_delay = usec;
+}
+
+void
+ofix_engine_set_validate(ofixEngine eng, ofixValidate mode) {
+    eng->validate = mode;
+}
+
+void
+ofix_engine_set_resume(ofixEngine eng, bool resume) {
+    eng->resume = resume;
+}
+
+void
+ofix_engine_set_journal(ofixErr err, ofixEngine eng, ofixSyncPolicy policy, int n) {
+    char	path[1100];
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL != eng->journal) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "The engine journal is already set.");
+	}
+	return;
+    }
+    snprintf(path, sizeof(path), "%s/journal", eng->store_dir);
+    if (NULL == (eng->journal = ofix_journal_open(err, path, eng->id, 0))) {
+	return;
+    }
+    ofix_journal_start_writer(err, eng->journal, policy, n);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_journal_destroy(eng->journal);
+	eng->journal = NULL;
+    }
+}
+
+void
+ofix_engine_set_retention(ofixErr err, ofixEngine eng, double roll_interval, int keep_segs, double keep_age) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == eng->journal) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Retention requires an engine journal.");
+	}
+	return;
+    }
+    ofix_journal_set_retention(err, eng->journal, roll_interval, keep_segs, keep_age);
+}
+
+void
+ofix_engine_replicate(ofixErr err, ofixEngine eng, const char *host, int port, bool sync) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == eng->journal) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Replication requires an engine journal.");
+	}
+	return;
+    }
+    ofix_journal_replicate(err, eng->journal, host, port, sync);
+}
+
+void
+ofix_engine_set_compress(ofixErr err, ofixEngine eng, bool on) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == eng->journal) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Compression requires an engine journal.");
+	}
+	return;
+    }
+    ofix_journal_set_compress(err, eng->journal, on);
+}
+
+void
+ofix_engine_set_reactor(ofixErr err, ofixEngine eng, int threads) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL != eng->reactor) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "The engine reactor is already set.");
+	}
+	return;
+    }
+    eng->reactor = _ofix_reactor_create(err, threads, false);
+}
+
+void
+ofix_engine_set_uring(ofixErr err, ofixEngine eng, int threads) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL != eng->reactor) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "The engine reactor is already set.");
+	}
+	return;
+    }
+    if (NULL != (eng->reactor = _ofix_reactor_create(err, threads, true)) &&
+	0 == _ofix_reactor_uring_cnt(eng->reactor)) {
+	eng->log(eng->log_ctx, OFIX_INFO, "io_uring is not supported, using epoll.");
+    }
+}
+
+// number of reactor loops using io_uring, for tests
+int
+_ofix_engine_uring_cnt(ofixEngine eng) {
+    if (NULL == eng->reactor) {
+	return 0;
+    }
+    return _ofix_reactor_uring_cnt(eng->reactor);
+}
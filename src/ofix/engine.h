@@ -7,6 +7,7 @@
 #include <stdint.h>
 
 #include "err.h"
+#include "journal.h"
 #include "session.h"
 
 /**
@@ -43,6 +44,106 @@ extern const char*	ofix_engine_store_dir(ofixEngine eng);
 extern int		ofix_engine_heartbeat_interval(ofixEngine eng);
 extern int		ofix_engine_port(ofixEngine eng);
 extern void		ofix_engine_set_heartbeat(ofixEngine eng, int interval);
+// send delay of new sessions, see ofix_session_set_send_delay()
+extern void		ofix_engine_set_send_delay(ofixEngine eng, int usec);
+// inbound validation of new sessions, see ofix_session_set_validate()
+extern void		ofix_engine_set_validate(ofixEngine eng, ofixValidate mode);
+
+/**
+ * When resume is on each counterparty gets a journal store in a directory
+ * named by its comp ID under the store directory. A session reopens that
+ * journal and continues from the last stored sequence numbers unless the
+ * counterparty logs on with ResetSeqNumFlag set.
+ *
+ * @param eng engine to set the mode on
+ * @param resume true to resume sessions from the store
+ */
+extern void		ofix_engine_set_resume(ofixEngine eng, bool resume);
+
+/**
+ * Stores the messages of all sessions in one journal in the __journal__
+ * directory under the store directory instead of a store per session. Each
+ * session is tagged by its counterparty comp ID and one writer thread syncs
+ * all sessions together according to the __policy__. Resume, if on, then
+ * picks up the sequence numbers from the shared journal. Must be called
+ * before the engine is started.
+ *
+ * @param err pointer to error struct or NULL
+ * @param eng engine to set the journal for
+ * @param policy when to sync to disk
+ * @param n milliseconds for __OFIX_SYNC_INTERVAL__ or messages for __OFIX_SYNC_COUNT__
+ */
+extern void		ofix_engine_set_journal(ofixErr err, ofixEngine eng, ofixSyncPolicy policy, int n);
+
+/**
+ * Sets rotation and retention for the engine journal. See
+ * ofix_journal_set_retention().
+ *
+ * @param err pointer to error struct or NULL
+ * @param eng engine with a journal
+ * @param roll_interval maximum seconds a segment is open or 0
+ * @param keep_segs maximum number of segments to keep or 0 for no limit
+ * @param keep_age seconds to keep a closed segment or 0 for no limit
+ */
+extern void		ofix_engine_set_retention(ofixErr err,
+						  ofixEngine eng,
+						  double roll_interval,
+						  int keep_segs,
+						  double keep_age);
+
+/**
+ * Streams the engine journal to a hot standby. The standby follows with
+ * ofix_journal_follow() on the journal directory of its own store
+ * directory and on failover starts its engine with
+ * ofix_engine_set_journal() so sessions resume where the primary left off.
+ * See ofix_journal_replicate().
+ *
+ * @param err pointer to error struct or NULL
+ * @param eng engine with a journal
+ * @param host host of the standby
+ * @param port port the standby listens on
+ * @param sync if true a message is durable only once the standby has it
+ */
+extern void		ofix_engine_replicate(ofixErr err, ofixEngine eng, const char *host, int port, bool sync);
+
+/**
+ * Turns compression of closed engine journal segments on or off. See
+ * ofix_journal_set_compress().
+ *
+ * @param err pointer to error struct or NULL
+ * @param eng engine with a journal
+ * @param on true to compress closed segments
+ */
+extern void		ofix_engine_set_compress(ofixErr err, ofixEngine eng, bool on);
+
+/**
+ * Runs sessions on a fixed pool of __threads__ event loop threads that
+ * multiplex the session sockets with epoll instead of starting a thread for
+ * each session. A session stays on one loop so its callbacks are made in
+ * order on one thread as before. Must be called before the engine is
+ * started.
+ *
+ * @param err pointer to error struct or NULL
+ * @param eng engine to set the reactor for
+ * @param threads number of event loop threads, 0 for one per core
+ */
+extern void		ofix_engine_set_reactor(ofixErr err, ofixEngine eng, int threads);
+
+/**
+ * Same as ofix_engine_set_reactor() but the loops use io_uring on Linux.
+ * Each loop keeps a multishot receive on every session socket that fills
+ * buffers from a ring registered with the kernel. Queued sends are written
+ * with a send on the ring, one in flight per session, instead of sendmsg()
+ * calls. All the receives and sends started in a pass are submitted with
+ * the same system call that waits for completions. Loops fall back to epoll if the kernel does not support
+ * io_uring or provided buffer rings. Must be called before the engine is
+ * started.
+ *
+ * @param err pointer to error struct or NULL
+ * @param eng engine to set the reactor for
+ * @param threads number of event loop threads, 0 for one per core
+ */
+extern void		ofix_engine_set_uring(ofixErr err, ofixEngine eng, int threads);
 
 /**
  *
@@ -0,0 +1,753 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "crc.h"
+#include "export.h"
+#include "tagspec.h"
+#include "versionspec.h"
+
+extern ofixVersionSpec	ofix_get_spec(ofixErr err, int major, int minor);
+
+#define NULLS_SIZE(rows)	(((rows) + 7) / 8)
+
+static ofixColType
+col_type(ofixTagType tt) {
+    switch (tt) {
+    case OFIX_Int:
+    case OFIX_Length:
+    case OFIX_NumInGroup:
+    case OFIX_SeqNum:
+    case OFIX_DayOfMonth:
+	return OFIX_COL_INT;
+    case OFIX_Float:
+    case OFIX_Qty:
+    case OFIX_Price:
+    case OFIX_PriceOffset:
+    case OFIX_Amt:
+    case OFIX_Percentage:
+	return OFIX_COL_FLOAT;
+    case OFIX_Char:
+    case OFIX_Boolean:
+	return OFIX_COL_CHAR;
+    default:
+	return OFIX_COL_STR;
+    }
+}
+
+static int
+col_width(ofixColType type) {
+    switch (type) {
+    case OFIX_COL_INT:		return sizeof(int64_t);
+    case OFIX_COL_FLOAT:	return sizeof(double);
+    case OFIX_COL_CHAR:		return 1;
+    default:			return sizeof(int32_t);
+    }
+}
+
+static uint32_t
+str_hash(const char *s, int len) {
+    uint32_t	h = 2166136261U;
+
+    for (; 0 < len; len--, s++) {
+	h = (h ^ (uint8_t)*s) * 16777619U;
+    }
+    return h;
+}
+
+static void
+export_free(Export ex) {
+    ExCol	col;
+    int		i;
+
+    if (NULL != ex->f) {
+	fclose(ex->f);
+    }
+    if (NULL != ex->cols) {
+	for (i = ex->col_cnt, col = ex->cols; 0 < i; i--, col++) {
+	    free(col->nulls);
+	    free(col->values);
+	    free(col->slots);
+	    free(col->ends);
+	    free(col->bytes);
+	}
+	free(ex->cols);
+    }
+    if (NULL != ex->types) {
+	for (i = 0; i < ex->type_cnt; i++) {
+	    free(ex->types[i]);
+	}
+	free(ex->types);
+    }
+    free(ex->out);
+    free(ex);
+}
+
+Export
+ofix_export_create(ofixErr err,
+		   const char *path,
+		   int major,
+		   int minor,
+		   const int *tags,
+		   int tag_cnt,
+		   const char **types,
+		   int type_cnt) {
+    ofixVersionSpec	vspec;
+    ofixTagSpec		ts;
+    Export		ex;
+    ExCol		col;
+    int32_t		head[3];
+    int32_t		cdesc[2];
+    int			i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (0 >= tag_cnt || NULL == tags) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "An export needs at least one tag.");
+	}
+	return NULL;
+    }
+    if (NULL == (vspec = ofix_get_spec(err, major, minor))) {
+	return NULL;
+    }
+    if (NULL == (ex = (Export)malloc(sizeof(struct _Export)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for export.");
+	}
+	return NULL;
+    }
+    memset(ex, 0, sizeof(struct _Export));
+    ex->major = major;
+    ex->minor = minor;
+    ex->col_cnt = tag_cnt;
+    // twice as many slots as rows keeps the dictionary probes short
+    for (ex->slot_mask = 1; ex->slot_mask < OFIX_EXPORT_CHUNK_ROWS * 2; ex->slot_mask <<= 1) {
+    }
+    ex->slot_mask--;
+    if (NULL == (ex->cols = (ExCol)calloc(tag_cnt, sizeof(struct _ExCol))) ||
+	(0 < type_cnt && NULL == (ex->types = (char**)calloc(type_cnt, sizeof(char*))))) {
+	goto MEM_ERR;
+    }
+    for (i = 0; i < type_cnt; i++) {
+	if (NULL == (ex->types[i] = strdup(types[i]))) {
+	    goto MEM_ERR;
+	}
+	ex->type_cnt++;
+    }
+    for (i = 0, col = ex->cols; i < tag_cnt; i++, col++) {
+	if (NULL == (ts = ofix_version_spec_get_tag_spec(err, vspec, tags[i], false))) {
+	    if (NULL != err) {
+		err->code = OFIX_NOT_FOUND_ERR;
+		snprintf(err->msg, sizeof(err->msg), "Tag %d not found in FIX %d.%d.", tags[i], major, minor);
+	    }
+	    export_free(ex);
+	    return NULL;
+	}
+	col->tag = tags[i];
+	col->type = col_type(ts->type);
+	if (NULL == (col->nulls = (uint8_t*)malloc(NULLS_SIZE(OFIX_EXPORT_CHUNK_ROWS))) ||
+	    NULL == (col->values = (char*)malloc((size_t)col_width(col->type) * OFIX_EXPORT_CHUNK_ROWS))) {
+	    goto MEM_ERR;
+	}
+	memset(col->nulls, 0, NULLS_SIZE(OFIX_EXPORT_CHUNK_ROWS));
+	if (OFIX_COL_STR == col->type) {
+	    col->byte_cap = OFIX_EXPORT_CHUNK_ROWS * 8;
+	    if (NULL == (col->slots = (int32_t*)malloc(sizeof(int32_t) * (ex->slot_mask + 1))) ||
+		NULL == (col->ends = (int32_t*)malloc(sizeof(int32_t) * OFIX_EXPORT_CHUNK_ROWS)) ||
+		NULL == (col->bytes = (char*)malloc(col->byte_cap))) {
+		goto MEM_ERR;
+	    }
+	    memset(col->slots, 0, sizeof(int32_t) * (ex->slot_mask + 1));
+	}
+    }
+    if (NULL == (ex->f = fopen(path, "w"))) {
+	if (NULL != err) {
+	    err->code = OFIX_WRITE_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to open export file '%s'.", path);
+	}
+	export_free(ex);
+	return NULL;
+    }
+    head[0] = major;
+    head[1] = minor;
+    head[2] = tag_cnt;
+    if (1 != fwrite(OFIX_EXPORT_MAGIC, 8, 1, ex->f) || 1 != fwrite(head, sizeof(head), 1, ex->f)) {
+	goto WRITE_ERR;
+    }
+    for (i = 0, col = ex->cols; i < tag_cnt; i++, col++) {
+	cdesc[0] = col->tag;
+	cdesc[1] = col->type;
+	if (1 != fwrite(cdesc, sizeof(cdesc), 1, ex->f)) {
+	    goto WRITE_ERR;
+	}
+    }
+    return ex;
+
+ MEM_ERR:
+    if (NULL != err) {
+	err->code = OFIX_MEMORY_ERR;
+	strcpy(err->msg, "Failed to allocate memory for export.");
+    }
+    export_free(ex);
+    return NULL;
+
+ WRITE_ERR:
+    if (NULL != err) {
+	err->code = OFIX_WRITE_ERR;
+	snprintf(err->msg, sizeof(err->msg), "Failed to write export file '%s'.", path);
+    }
+    export_free(ex);
+    return NULL;
+}
+
+static bool
+out_grow(Export ex, size_t size) {
+    char	*out;
+
+    if (size <= ex->out_cap) {
+	return true;
+    }
+    if (NULL == (out = (char*)realloc(ex->out, size))) {
+	return false;
+    }
+    ex->out = out;
+    ex->out_cap = size;
+
+    return true;
+}
+
+static void
+flush_chunk(ofixErr err, Export ex) {
+    ExCol	col;
+    size_t	size = 0;
+    char	*o;
+    int32_t	head[3];
+    int		nsize = NULLS_SIZE(ex->rows);
+    int		i;
+
+    if (0 == ex->rows) {
+	return;
+    }
+    for (i = ex->col_cnt, col = ex->cols; 0 < i; i--, col++) {
+	size += nsize + (size_t)col_width(col->type) * ex->rows;
+	if (OFIX_COL_STR == col->type) {
+	    size += sizeof(int32_t) * (2 + col->dict_cnt) + col->byte_cnt;
+	}
+    }
+    if (!out_grow(ex, size)) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for export chunk.");
+	}
+	return;
+    }
+    o = ex->out;
+    for (i = ex->col_cnt, col = ex->cols; 0 < i; i--, col++) {
+	memcpy(o, col->nulls, nsize);
+	o += nsize;
+	if (OFIX_COL_STR == col->type) {
+	    memcpy(o, &col->dict_cnt, sizeof(int32_t));
+	    o += sizeof(int32_t);
+	    memcpy(o, &col->byte_cnt, sizeof(int32_t));
+	    o += sizeof(int32_t);
+	    memcpy(o, col->ends, sizeof(int32_t) * col->dict_cnt);
+	    o += sizeof(int32_t) * col->dict_cnt;
+	    memcpy(o, col->bytes, col->byte_cnt);
+	    o += col->byte_cnt;
+	    memset(col->slots, 0, sizeof(int32_t) * (ex->slot_mask + 1));
+	    col->dict_cnt = 0;
+	    col->byte_cnt = 0;
+	}
+	memcpy(o, col->values, (size_t)col_width(col->type) * ex->rows);
+	o += (size_t)col_width(col->type) * ex->rows;
+	memset(col->nulls, 0, nsize);
+    }
+    head[0] = ex->rows;
+    head[1] = (int32_t)size;
+    head[2] = (int32_t)ofix_crc32c(0, ex->out, size);
+    if (1 != fwrite(head, sizeof(head), 1, ex->f) || 1 != fwrite(ex->out, size, 1, ex->f)) {
+	if (NULL != err) {
+	    err->code = OFIX_WRITE_ERR;
+	    strcpy(err->msg, "Failed to write export chunk.");
+	}
+    }
+    ex->total += ex->rows;
+    ex->rows = 0;
+}
+
+static int32_t
+dict_add(ofixErr err, Export ex, ExCol col, const char *str, int len) {
+    uint32_t	h = str_hash(str, len) & ex->slot_mask;
+    int32_t	idx;
+    int32_t	start;
+
+    // slots hold the dictionary index plus one so 0 is an empty slot
+    for (; 0 != col->slots[h]; h = (h + 1) & ex->slot_mask) {
+	idx = col->slots[h] - 1;
+	start = (0 == idx) ? 0 : col->ends[idx - 1];
+	if (col->ends[idx] - start == len && 0 == memcmp(col->bytes + start, str, len)) {
+	    return idx;
+	}
+    }
+    if (col->byte_cap < col->byte_cnt + len) {
+	int32_t	cap = col->byte_cap * 2;
+	char	*bytes;
+
+	if (cap < col->byte_cnt + len) {
+	    cap = col->byte_cnt + len;
+	}
+	if (NULL == (bytes = (char*)realloc(col->bytes, cap))) {
+	    if (NULL != err) {
+		err->code = OFIX_MEMORY_ERR;
+		strcpy(err->msg, "Failed to allocate memory for export dictionary.");
+	    }
+	    return -1;
+	}
+	col->bytes = bytes;
+	col->byte_cap = cap;
+    }
+    memcpy(col->bytes + col->byte_cnt, str, len);
+    col->byte_cnt += len;
+    idx = col->dict_cnt++;
+    col->ends[idx] = col->byte_cnt;
+    col->slots[h] = idx + 1;
+
+    return idx;
+}
+
+static bool
+parse_int(const char *v, int len, int64_t *np) {
+    const char	*end = v + len;
+    int64_t	num = 0;
+    bool	neg = false;
+
+    if ('-' == *v) {
+	neg = true;
+	v++;
+    }
+    if (v == end) {
+	return false;
+    }
+    for (; v < end; v++) {
+	if (*v < '0' || '9' < *v) {
+	    return false;
+	}
+	num = num * 10 + (*v - '0');
+    }
+    *np = neg ? -num : num;
+
+    return true;
+}
+
+bool
+ofix_export_add(ofixErr err, Export ex, ofixMsg msg) {
+    ExCol	col;
+    char	*v;
+    char	*end;
+    int		len;
+    int		row;
+    int		i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    if (0 < ex->type_cnt) {
+	const char	*type = ofix_msg_type(msg);
+
+	for (i = 0; i < ex->type_cnt; i++) {
+	    if (0 == strcmp(type, ex->types[i])) {
+		break;
+	    }
+	}
+	if (i == ex->type_cnt) {
+	    return false;
+	}
+    }
+    row = ex->rows;
+    for (i = ex->col_cnt, col = ex->cols; 0 < i; i--, col++) {
+	bool	null = true;
+
+	v = NULL;
+	len = 0;
+	// a missing tag leaves v NULL, a bad tag sets the error so use our own
+	ofix_msg_get_data(NULL, msg, col->tag, &v, &len);
+	switch (col->type) {
+	case OFIX_COL_INT: {
+	    int64_t	num = 0;
+
+	    if (NULL != v && 0 < len) {
+		null = !parse_int(v, len, &num);
+	    }
+	    ((int64_t*)col->values)[row] = null ? 0 : num;
+	    break;
+	}
+	case OFIX_COL_FLOAT: {
+	    double	num = 0.0;
+
+	    // values are followed by the SOH separator so strtod stops there
+	    if (NULL != v && 0 < len) {
+		num = strtod(v, &end);
+		null = (end != v + len);
+	    }
+	    ((double*)col->values)[row] = null ? 0.0 : num;
+	    break;
+	}
+	case OFIX_COL_CHAR:
+	    null = (NULL == v || 0 == len);
+	    col->values[row] = null ? '\0' : *v;
+	    break;
+	default: {
+	    int32_t	idx = 0;
+
+	    if (NULL != v) {
+		if (0 > (idx = dict_add(err, ex, col, v, len))) {
+		    return false;
+		}
+		null = false;
+	    }
+	    ((int32_t*)col->values)[row] = idx;
+	    break;
+	}
+	}
+	if (null) {
+	    col->nulls[row / 8] |= (uint8_t)(1 << (row % 8));
+	} else {
+	    col->nulls[row / 8] &= (uint8_t)~(1 << (row % 8));
+	}
+    }
+    if (OFIX_EXPORT_CHUNK_ROWS <= ++ex->rows) {
+	flush_chunk(err, ex);
+    }
+    return true;
+}
+
+int64_t
+ofix_export_close(ofixErr err, Export ex) {
+    int64_t	total;
+
+    if (NULL == ex) {
+	return 0;
+    }
+    flush_chunk(err, ex);
+    if (0 != fflush(ex->f) && NULL != err && OFIX_OK == err->code) {
+	err->code = OFIX_WRITE_ERR;
+	strcpy(err->msg, "Failed to write export file.");
+    }
+    total = ex->total;
+    export_free(ex);
+
+    return total;
+}
+
+typedef struct _AddCtx {
+    ofixErr	err;
+    Export	ex;
+} *AddCtx;
+
+static bool
+add_cb(ofixMsg msg, void *ctx) {
+    AddCtx	ac = (AddCtx)ctx;
+
+    ofix_export_add(ac->err, ac->ex, msg);
+
+    return true;
+}
+
+void
+ofix_export_store(ofixErr err, Export ex, Store store) {
+    struct _AddCtx	ac = { err, ex };
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    ofix_store_iterate(err, store, add_cb, &ac);
+}
+
+void
+ofix_export_store_file(ofixErr err, Export ex, const char *path, int threads) {
+    struct _AddCtx	ac = { err, ex };
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    // ordered so rows are added on this thread and need no locking
+    ofix_store_piterate(err, path, threads, true, add_cb, &ac);
+}
+
+void
+ofix_export_reader_destroy(ExportReader r) {
+    if (NULL == r) {
+	return;
+    }
+    if (NULL != r->f) {
+	fclose(r->f);
+    }
+    free(r->tags);
+    free(r->ctypes);
+    free(r->buf);
+    free(r->nulls);
+    free(r->values);
+    free(r->ends);
+    free(r->bytes);
+    free(r);
+}
+
+ExportReader
+ofix_export_reader_open(ofixErr err, const char *path) {
+    ExportReader	r;
+    char		magic[8];
+    int32_t		head[3];
+    int32_t		cdesc[2];
+    int			i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (NULL == (r = (ExportReader)malloc(sizeof(struct _ExportReader)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for export reader.");
+	}
+	return NULL;
+    }
+    memset(r, 0, sizeof(struct _ExportReader));
+    if (NULL == (r->f = fopen(path, "r"))) {
+	if (NULL != err) {
+	    err->code = OFIX_READ_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to open export file '%s'.", path);
+	}
+	ofix_export_reader_destroy(r);
+	return NULL;
+    }
+    if (1 != fread(magic, sizeof(magic), 1, r->f) || 0 != memcmp(magic, OFIX_EXPORT_MAGIC, sizeof(magic)) ||
+	1 != fread(head, sizeof(head), 1, r->f) || 0 >= head[2]) {
+	goto BAD;
+    }
+    r->major = head[0];
+    r->minor = head[1];
+    r->col_cnt = head[2];
+    if (NULL == (r->tags = (int*)calloc(r->col_cnt, sizeof(int))) ||
+	NULL == (r->ctypes = (ofixColType*)calloc(r->col_cnt, sizeof(ofixColType))) ||
+	NULL == (r->nulls = (const uint8_t**)calloc(r->col_cnt, sizeof(uint8_t*))) ||
+	NULL == (r->values = (const char**)calloc(r->col_cnt, sizeof(char*))) ||
+	NULL == (r->ends = (const char**)calloc(r->col_cnt, sizeof(char*))) ||
+	NULL == (r->bytes = (const char**)calloc(r->col_cnt, sizeof(char*)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for export reader.");
+	}
+	ofix_export_reader_destroy(r);
+	return NULL;
+    }
+    for (i = 0; i < r->col_cnt; i++) {
+	if (1 != fread(cdesc, sizeof(cdesc), 1, r->f)) {
+	    goto BAD;
+	}
+	switch (cdesc[1]) {
+	case OFIX_COL_INT:
+	case OFIX_COL_FLOAT:
+	case OFIX_COL_CHAR:
+	case OFIX_COL_STR:
+	    break;
+	default:
+	    goto BAD;
+	}
+	r->tags[i] = cdesc[0];
+	r->ctypes[i] = (ofixColType)cdesc[1];
+    }
+    return r;
+
+ BAD:
+    if (NULL != err) {
+	err->code = OFIX_PARSE_ERR;
+	snprintf(err->msg, sizeof(err->msg), "'%s' is not an export file.", path);
+    }
+    ofix_export_reader_destroy(r);
+    return NULL;
+}
+
+int
+ofix_export_reader_next(ofixErr err, ExportReader r) {
+    const char	*b;
+    const char	*end;
+    int32_t	head[3];
+    int32_t	dict_cnt;
+    int32_t	byte_cnt;
+    int		nsize;
+    int		i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return 0;
+    }
+    r->rows = 0;
+    if (1 != fread(head, sizeof(head), 1, r->f)) {
+	if (ferror(r->f)) {
+	    goto READ_ERR;
+	}
+	return 0;
+    }
+    if (0 >= head[0] || 0 > head[1]) {
+	goto BAD;
+    }
+    if (r->cap < (size_t)head[1]) {
+	char	*buf;
+
+	if (NULL == (buf = (char*)realloc(r->buf, head[1]))) {
+	    if (NULL != err) {
+		err->code = OFIX_MEMORY_ERR;
+		strcpy(err->msg, "Failed to allocate memory for export chunk.");
+	    }
+	    return 0;
+	}
+	r->buf = buf;
+	r->cap = head[1];
+    }
+    if (1 != fread(r->buf, head[1], 1, r->f)) {
+	goto READ_ERR;
+    }
+    if ((uint32_t)head[2] != ofix_crc32c(0, r->buf, head[1])) {
+	goto BAD;
+    }
+    nsize = NULLS_SIZE(head[0]);
+    b = r->buf;
+    end = b + head[1];
+    // Sizes are checked against what is left before moving on so a corrupt
+    // count can not point past the chunk. The string dictionaries are
+    // checked once here so ofix_export_reader_str() can trust them.
+    for (i = 0; i < r->col_cnt; i++) {
+	size_t	vsize = (size_t)col_width(r->ctypes[i]) * head[0];
+
+	if ((size_t)(end - b) < (size_t)nsize) {
+	    goto BAD;
+	}
+	r->nulls[i] = (const uint8_t*)b;
+	b += nsize;
+	if (OFIX_COL_STR == r->ctypes[i]) {
+	    int32_t	prev = 0;
+	    int32_t	e;
+	    int32_t	k;
+
+	    if ((size_t)(end - b) < 2 * sizeof(int32_t)) {
+		goto BAD;
+	    }
+	    memcpy(&dict_cnt, b, sizeof(int32_t));
+	    memcpy(&byte_cnt, b + sizeof(int32_t), sizeof(int32_t));
+	    b += 2 * sizeof(int32_t);
+	    if (0 > dict_cnt || 0 > byte_cnt ||
+		(size_t)(end - b) < sizeof(int32_t) * (size_t)dict_cnt + (size_t)byte_cnt + vsize) {
+		goto BAD;
+	    }
+	    r->ends[i] = b;
+	    for (k = 0; k < dict_cnt; k++) {
+		memcpy(&e, b + sizeof(int32_t) * k, sizeof(e));
+		if (e < prev || byte_cnt < e) {
+		    goto BAD;
+		}
+		prev = e;
+	    }
+	    b += sizeof(int32_t) * dict_cnt;
+	    r->bytes[i] = b;
+	    b += byte_cnt;
+	    for (k = 0; k < head[0]; k++) {
+		if (0 == (r->nulls[i][k / 8] & (1 << (k % 8)))) {
+		    memcpy(&e, b + sizeof(int32_t) * k, sizeof(e));
+		    if (0 > e || dict_cnt <= e) {
+			goto BAD;
+		    }
+		}
+	    }
+	}
+	if ((size_t)(end - b) < vsize) {
+	    goto BAD;
+	}
+	r->values[i] = b;
+	b += vsize;
+    }
+    r->rows = head[0];
+
+    return r->rows;
+
+ READ_ERR:
+    if (NULL != err) {
+	err->code = OFIX_READ_ERR;
+	strcpy(err->msg, "Failed to read export chunk.");
+    }
+    return 0;
+
+ BAD:
+    if (NULL != err) {
+	err->code = OFIX_PARSE_ERR;
+	strcpy(err->msg, "Corrupt export chunk.");
+    }
+    return 0;
+}
+
+int
+ofix_export_reader_col_cnt(ExportReader r) {
+    return r->col_cnt;
+}
+
+int
+ofix_export_reader_col_tag(ExportReader r, int col) {
+    return r->tags[col];
+}
+
+ofixColType
+ofix_export_reader_col_type(ExportReader r, int col) {
+    return r->ctypes[col];
+}
+
+bool
+ofix_export_reader_is_null(ExportReader r, int col, int row) {
+    return 0 != (r->nulls[col][row / 8] & (1 << (row % 8)));
+}
+
+// values are not aligned in the chunk so they are copied out
+
+int64_t
+ofix_export_reader_int(ExportReader r, int col, int row) {
+    int64_t	v;
+
+    memcpy(&v, r->values[col] + sizeof(int64_t) * row, sizeof(v));
+
+    return v;
+}
+
+double
+ofix_export_reader_float(ExportReader r, int col, int row) {
+    double	v;
+
+    memcpy(&v, r->values[col] + sizeof(double) * row, sizeof(v));
+
+    return v;
+}
+
+char
+ofix_export_reader_char(ExportReader r, int col, int row) {
+    return r->values[col][row];
+}
+
+const char*
+ofix_export_reader_str(ExportReader r, int col, int row, int *lenp) {
+    int32_t	idx;
+    int32_t	start = 0;
+    int32_t	end;
+
+    if (ofix_export_reader_is_null(r, col, row)) {
+	*lenp = 0;
+	return "";
+    }
+    memcpy(&idx, r->values[col] + sizeof(int32_t) * row, sizeof(idx));
+    if (0 < idx) {
+	memcpy(&start, r->ends[col] + sizeof(int32_t) * (idx - 1), sizeof(start));
+    }
+    memcpy(&end, r->ends[col] + sizeof(int32_t) * idx, sizeof(end));
+    *lenp = end - start;
+
+    return r->bytes[col] + start;
+}
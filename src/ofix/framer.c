@@ -0,0 +1,245 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#define _GNU_SOURCE
+#include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "framer.h"
+#include "private.h"
+
+#define SOH		'\1'
+// longest BeginString field including the 8= and the SOH
+#define BEGIN_MAX	16
+// CheckSum field, 10=nnn and the SOH
+#define TRAILER_LEN	7
+
+struct _ofixFramer {
+    struct _RBuf	rb;
+    bool		check_sum;
+    int			msg_len;	// length of the message at the read position or 0 if not known
+    int64_t		skipped;
+};
+
+ofixFramer
+ofix_framer_create(ofixErr err, bool check_sum) {
+    ofixFramer	fr;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (NULL == (fr = (ofixFramer)malloc(sizeof(struct _ofixFramer)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for framer.");
+	}
+	return NULL;
+    }
+    if (!_ofix_rbuf_init(err, &fr->rb, RBUF_SIZE)) {
+	free(fr);
+	return NULL;
+    }
+    fr->check_sum = check_sum;
+    fr->msg_len = 0;
+    fr->skipped = 0;
+
+    return fr;
+}
+
+void
+ofix_framer_destroy(ofixFramer fr) {
+    if (NULL != fr) {
+	_ofix_rbuf_cleanup(&fr->rb);
+	free(fr);
+    }
+}
+
+void
+ofix_framer_reset(ofixFramer fr) {
+    fr->rb.rd = 0;
+    fr->rb.wr = 0;
+    fr->msg_len = 0;
+}
+
+void
+ofix_framer_push(ofixErr err, ofixFramer fr, const char *buf, size_t len) {
+    size_t	space;
+    char	*b;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (!_ofix_rbuf_reserve(err, &fr->rb, _ofix_rbuf_len(&fr->rb) + len)) {
+	return;
+    }
+    b = _ofix_rbuf_space(&fr->rb, &space);
+    memcpy(b, buf, len);
+    fr->rb.wr += len;
+}
+
+char*
+ofix_framer_space(ofixFramer fr, size_t *lenp) {
+    char	*b = _ofix_rbuf_space(&fr->rb, lenp);
+
+    if (0 == *lenp && _ofix_rbuf_reserve(NULL, &fr->rb, fr->rb.size * 2)) {
+	b = _ofix_rbuf_space(&fr->rb, lenp);
+    }
+    return b;
+}
+
+void
+ofix_framer_commit(ofixFramer fr, size_t len) {
+    fr->rb.wr += len;
+}
+
+int64_t
+ofix_framer_skipped(ofixFramer fr) {
+    return fr->skipped;
+}
+
+// Returns the length of the message that starts at b from its BeginString
+// and BodyLength fields, 0 if more bytes are needed to tell, or -1 if b is
+// not the start of a message.
+static int
+frame_len(const char *b, size_t len) {
+    const char	*end = b + len;
+    const char	*s;
+    int		body = 0;
+    int		digits = 0;
+    int		total;
+
+    if (len < 5) {
+	return (0 == memcmp(b, "8=FIX", len)) ? 0 : -1;
+    }
+    if (0 != memcmp(b, "8=FIX", 5)) {
+	return -1;
+    }
+    for (s = b + 5; ; s++) {
+	if (end <= s) {
+	    return 0;
+	}
+	if (SOH == *s) {
+	    break;
+	}
+	if (BEGIN_MAX <= s - b) {
+	    return -1;
+	}
+    }
+    s++;
+    if (end < s + 2) {
+	return 0;
+    }
+    if ('9' != *s || '=' != s[1]) {
+	return -1;
+    }
+    for (s += 2; ; s++) {
+	if (end <= s) {
+	    return 0;
+	}
+	if (SOH == *s) {
+	    break;
+	}
+	if (*s < '0' || '9' < *s || 8 < ++digits) {
+	    return -1;
+	}
+	body = body * 10 + (*s - '0');
+    }
+    if (0 == digits || OFIX_FRAMER_MAX_MSG < (total = (int)(s + 1 - b) + body + TRAILER_LEN)) {
+	return -1;
+    }
+    return total;
+}
+
+// Checks that a CheckSum field ends the message, which is what catches a
+// wrong BodyLength, and if asked that the checksum is right.
+static bool
+frame_ok(ofixFramer fr, const char *b, int len) {
+    const char	*t = b + len - TRAILER_LEN;
+
+    if (SOH != t[-1] || '1' != *t || '0' != t[1] || '=' != t[2] ||
+	!isdigit((unsigned char)t[3]) || !isdigit((unsigned char)t[4]) || !isdigit((unsigned char)t[5]) ||
+	SOH != t[6]) {
+	return false;
+    }
+    if (fr->check_sum) {
+	const uint8_t	*u = (const uint8_t*)b;
+	const uint8_t	*end = (const uint8_t*)t;
+	uint8_t		sum = 0;
+
+	for (; u < end; u++) {
+	    sum += *u;
+	}
+	if (sum != (t[3] - '0') * 100 + (t[4] - '0') * 10 + (t[5] - '0')) {
+	    return false;
+	}
+    }
+    return true;
+}
+
+// Skips the bad byte at the read position and anything else up to the next
+// "8=FIX". The last few bytes are kept if there is no match since they may
+// be the start of one.
+static void
+resync(ofixFramer fr) {
+    RBuf	rb = &fr->rb;
+    const char	*b = _ofix_rbuf_data(rb);
+    size_t	len = _ofix_rbuf_len(rb);
+    const char	*s = NULL;
+    size_t	skip = 1;
+
+    if (1 < len && NULL != (s = memmem(b + 1, len - 1, "8=FIX", 5))) {
+	skip = s - b;
+    } else if (4 < len) {
+	skip = len - 4;
+    }
+    rb->rd += skip;
+    fr->skipped += skip;
+    fr->msg_len = 0;
+}
+
+int
+ofix_framer_pull(ofixErr err, ofixFramer fr, ofixFrame frames, int max) {
+    RBuf	rb = &fr->rb;
+    ofixFrame	f = frames;
+    char	*b;
+    size_t	len;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return 0;
+    }
+    while (f - frames < max) {
+	b = _ofix_rbuf_data(rb);
+	len = _ofix_rbuf_len(rb);
+	if (0 == fr->msg_len) {
+	    // whitespace between messages, such as in a store file, is expected
+	    for (; 0 < len && isspace((unsigned char)*b); b++, len--) {
+		rb->rd++;
+	    }
+	    if (0 == len || 0 == (fr->msg_len = frame_len(b, len))) {
+		break;
+	    }
+	    if (0 > fr->msg_len) {
+		resync(fr);
+		continue;
+	    }
+	}
+	if (len < (size_t)fr->msg_len) {
+	    // Growing moves the data so frames already filled must be used
+	    // first.
+	    if (rb->size < (size_t)fr->msg_len && f == frames) {
+		_ofix_rbuf_reserve(err, rb, fr->msg_len);
+	    }
+	    break;
+	}
+	if (!frame_ok(fr, b, fr->msg_len)) {
+	    resync(fr);
+	    continue;
+	}
+	f->str = b;
+	f->len = fr->msg_len;
+	f++;
+	rb->rd += fr->msg_len;
+	fr->msg_len = 0;
+    }
+    return (int)(f - frames);
+}
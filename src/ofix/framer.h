@@ -0,0 +1,85 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_FRAMER_H__
+#define __OFIX_FRAMER_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "err.h"
+
+/**
+ * @file framer.h
+ *
+ * An incremental framer that splits a byte stream, such as a TCP stream or a
+ * store file, into FIX messages. Bytes are pushed in chunks of any size and
+ * complete messages are pulled out as spans that can be handed directly to
+ * ofix_msg_parse(). When the stream is corrupt, the framer skips ahead to
+ * the next "8=FIX" that starts a well formed message. A message is well
+ * formed when the BodyLength puts a "10=nnn" CheckSum field right at the end
+ * of it. Optionally, the checksum value must also match.
+ */
+
+// largest message framed, anything longer is treated as corrupt
+#define OFIX_FRAMER_MAX_MSG	(16 * 1024 * 1024)
+
+typedef struct _ofixFramer	*ofixFramer;
+
+// A framed message. The bytes are in the framer and are valid until the next
+// push, commit, or pull.
+typedef struct _ofixFrame {
+    const char	*str;
+    int		len;
+} *ofixFrame;
+
+/**
+ * Creates a framer.
+ *
+ * @param err pointer to error struct or NULL
+ * @param check_sum if true messages with a bad CheckSum are skipped
+ * @return the new framer or NULL on error
+ */
+extern ofixFramer	ofix_framer_create(ofixErr err, bool check_sum);
+extern void		ofix_framer_destroy(ofixFramer fr);
+// drops any buffered bytes
+extern void		ofix_framer_reset(ofixFramer fr);
+
+/**
+ * Copies __len__ bytes from __buf__ into the framer.
+ *
+ * @param err pointer to error struct or NULL
+ * @param fr framer
+ * @param buf bytes to add
+ * @param len number of bytes in __buf__
+ */
+extern void		ofix_framer_push(ofixErr err, ofixFramer fr, const char *buf, size_t len);
+
+/**
+ * Returns the free space in the framer so a caller can read into it directly,
+ * then call ofix_framer_commit() with the number of bytes read. The space is
+ * never empty.
+ *
+ * @param fr framer
+ * @param lenp set to the size of the space
+ * @return the start of the space
+ */
+extern char*		ofix_framer_space(ofixFramer fr, size_t *lenp);
+extern void		ofix_framer_commit(ofixFramer fr, size_t len);
+
+/**
+ * Fills __frames__ with up to __max__ complete messages.
+ *
+ * @param err pointer to error struct or NULL
+ * @param fr framer
+ * @param frames frames to fill
+ * @param max number of entries in __frames__
+ * @return the number of frames filled, 0 if more bytes are needed
+ */
+extern int		ofix_framer_pull(ofixErr err, ofixFramer fr, ofixFrame frames, int max);
+
+// number of bytes skipped while looking for a message other than the
+// whitespace between messages
+extern int64_t		ofix_framer_skipped(ofixFramer fr);
+
+#endif /* __OFIX_FRAMER_H__ */
@@ -0,0 +1,3036 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <arpa/inet.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "crc.h"
+#include "dtime.h"
+#include "journal.h"
+#include "lz.h"
+#include "private.h"
+
+#define INDEX_INC	65536
+#define INDEX_PERIOD	0.01
+#define MAINTAIN_PERIOD	1.0
+#define INDEX_MAGIC	"ofixjix1"
+#define MARK_MAGIC	"ofixjmk1"
+#define SEG_MAGIC	"ofixjsg4"
+#define ZSEG_MAGIC	"ofixjcz2"
+#define PAGE_LOCS	(4096 / sizeof(struct _JLoc))
+
+// bytes taken by a record holding a message of len bytes
+#define REC_SIZE(len)	(((int64_t)sizeof(struct _JRec) + (len) + 7) & ~(int64_t)7)
+// replication position that orders by segment and then offset
+#define REPL_MARK(seg, pos)	(((int64_t)(seg) << 40) | (pos))
+
+// Direction of a session start record. The record carries the session name
+// and clears the session's indexes when it is written or replayed so a
+// fresh session keeps its session id.
+#define REC_START	'n'
+
+#define FRAME_HELLO	'H'
+#define FRAME_SESSION	'S'
+#define FRAME_RECORD	'R'
+#define FRAME_ACK	'A'
+
+static void	sync_journal(Journal j);
+static void	index_catch_up(Journal j, bool wait);
+static void	index_prune(Journal j);
+static void	index_seed(Journal j);
+static void	maintain(Journal j);
+static void	session_start(ofixErr err, Journal j, int sid);
+static int64_t	now_ns();
+static bool	grow(ofixErr err, void **ap, int64_t *maxp, int64_t cnt, size_t size);
+
+// Reads records from segments whether or not they are compressed. The
+// blocks of a compressed segment are decompressed into the cursor buffer
+// one at a time so a sequential scan decompresses each block once.
+typedef struct _Cursor {
+    JZSeg	z;
+    int32_t	block;
+    char	*buf;
+    int32_t	cap;
+} *Cursor;
+
+static void
+set_sys_err(ofixErr err, ofixErrCode code, const char *what, const char *path) {
+    if (NULL != err) {
+	err->code = code;
+	snprintf(err->msg, sizeof(err->msg), "Failed to %s '%.160s'. %s", what, path, strerror(errno));
+    }
+}
+
+// Copies a NUL terminated id into a fixed size header field, truncating to
+// fit and always leaving room for the terminator.
+static void
+copy_id(char *dst, size_t size, const char *src) {
+    size_t	len = strnlen(src, size - 1);
+
+    memcpy(dst, src, len);
+    dst[len] = '\0';
+}
+
+static void
+index_open(ofixErr err, JIndex index, const char *dir, const char *name, bool reuse) {
+    char	path[1100];
+    struct stat	st;
+    void	*map;
+
+    snprintf(path, sizeof(path), "%s/%s", dir, name);
+    if (0 > (index->fd = open(path, O_RDWR | O_CREAT | (reuse ? 0 : O_TRUNC), 0644))) {
+	set_sys_err(err, OFIX_WRITE_ERR, "open index", path);
+	return;
+    }
+    if (0 != fstat(index->fd, &st)) {
+	set_sys_err(err, OFIX_READ_ERR, "stat index", path);
+	return;
+    }
+    if (0 == st.st_size) {
+	reuse = false;
+	if (0 != ftruncate(index->fd, INDEX_INC * sizeof(struct _JLoc))) {
+	    set_sys_err(err, OFIX_WRITE_ERR, "size index", path);
+	    return;
+	}
+	st.st_size = INDEX_INC * sizeof(struct _JLoc);
+    }
+    // Only what the file holds is mapped, index_fit() maps more as the
+    // index grows.
+    index->size = st.st_size / sizeof(struct _JLoc);
+    map = mmap(NULL, (size_t)index->size * sizeof(struct _JLoc), PROT_READ | PROT_WRITE, MAP_SHARED, index->fd, 0);
+    if (MAP_FAILED == map) {
+	set_sys_err(err, OFIX_MEMORY_ERR, "map index", path);
+	return;
+    }
+    index->head = (JHead)map;
+    index->locs = (JLoc)map;
+    index->cap = index->size;
+    if (reuse) {
+	index->top = index->size - 1;
+	if (0 != memcmp(index->head->magic, INDEX_MAGIC, sizeof(index->head->magic))) {
+	    if (NULL != err) {
+		err->code = OFIX_READ_ERR;
+		snprintf(err->msg, sizeof(err->msg), "'%.160s' is not a journal index.", path);
+	    }
+	}
+	return;
+    }
+    memcpy(index->head->magic, INDEX_MAGIC, sizeof(index->head->magic));
+    index->head->last_seq = 0;
+    // Index files are only synced at checkpoints. The header is synced now
+    // so a new file is always recognized as an index after a crash.
+    if (0 != msync(index->head, sizeof(struct _JHead), MS_SYNC)) {
+	set_sys_err(err, OFIX_WRITE_ERR, "sync index", path);
+    }
+}
+
+static void
+index_close(JIndex index) {
+    if (NULL != index->head) {
+	munmap(index->head, (size_t)index->cap * sizeof(struct _JLoc));
+	index->head = NULL;
+	index->locs = NULL;
+    }
+    if (0 <= index->fd) {
+	close(index->fd);
+	index->fd = -1;
+    }
+}
+
+static void
+seg_open(ofixErr err, Journal j, int64_t size) {
+    char	path[1100];
+    JSeg	seg;
+    JSegHead	head;
+    void	*map;
+
+    if (OFIX_JOURNAL_MAX_SEGS <= j->seg_cnt) {
+	if (NULL != err) {
+	    err->code = OFIX_OVERFLOW_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Journal '%.160s' has reached the segment limit.", j->dir);
+	}
+	return;
+    }
+    seg = j->segs + j->seg_cnt;
+    snprintf(path, sizeof(path), "%s/%06d.seg", j->dir, j->seg_cnt);
+    if (0 > (seg->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644))) {
+	set_sys_err(err, OFIX_WRITE_ERR, "create segment", path);
+	return;
+    }
+    if (0 != ftruncate(seg->fd, size)) {
+	set_sys_err(err, OFIX_WRITE_ERR, "size segment", path);
+	close(seg->fd);
+	return;
+    }
+    if (MAP_FAILED == (map = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, seg->fd, 0))) {
+	set_sys_err(err, OFIX_MEMORY_ERR, "map segment", path);
+	close(seg->fd);
+	return;
+    }
+    seg->base = (char*)map;
+    seg->size = size;
+    head = (JSegHead)map;
+    memcpy(head->magic, SEG_MAGIC, sizeof(head->magic));
+    copy_id(head->id, sizeof(head->id), j->id);
+    head->end = sizeof(struct _JSegHead);
+    head->created = now_ns();
+    seg->live = 0;
+    seg->trimmed = false;
+    __atomic_store_n(&j->seg_cnt, j->seg_cnt + 1, __ATOMIC_RELEASE);
+}
+
+// Returns the highest segment file number in the directory or -1 if there
+// are none.
+static int
+seg_max(const char *dir) {
+    DIR			*d;
+    struct dirent	*de;
+    int			max = -1;
+    int			n;
+    size_t		len;
+
+    if (NULL == (d = opendir(dir))) {
+	return -1;
+    }
+    while (NULL != (de = readdir(d))) {
+	// either a segment or a compressed segment
+	len = strlen(de->d_name);
+	if ((10 == len || 11 == len) && 1 == sscanf(de->d_name, "%6d", &n) &&
+	    0 == strcmp(de->d_name + 6, (10 == len) ? ".seg" : ".segz") && max < n) {
+	    max = n;
+	}
+    }
+    closedir(d);
+
+    return max;
+}
+
+static void
+zseg_free(JZSeg z) {
+    int32_t	i;
+
+    for (i = 0; i < z->block_cnt; i++) {
+	free(z->cache[i]);
+    }
+    free(z->cache);
+    free((void*)z->used);
+    munmap(z->base, z->size);
+    free(z);
+}
+
+int64_t
+ofix_journal_pin(Journal j) {
+    int64_t	e;
+
+    while (true) {
+	e = __atomic_load_n(&j->epoch, __ATOMIC_SEQ_CST);
+	__atomic_fetch_add(&j->pins[e & 1], 1, __ATOMIC_SEQ_CST);
+	// The epoch may have moved on before the pin was counted and then the
+	// limbo it would protect could already be freed.
+	if (e == __atomic_load_n(&j->epoch, __ATOMIC_SEQ_CST)) {
+	    return e;
+	}
+	__atomic_fetch_sub(&j->pins[e & 1], 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+void
+ofix_journal_unpin(Journal j, int64_t pin) {
+    __atomic_fetch_sub(&j->pins[pin & 1], 1, __ATOMIC_RELEASE);
+}
+
+// Puts memory a reader may still be using into the limbo of the current
+// epoch. If the limbo can not grow the memory is leaked rather than freed
+// under a reader.
+static void
+limbo_add(Journal j, char *map, int64_t size, JSeg seg, char *block) {
+    int		e = (int)(j->epoch & 1);
+    JLimbo	l;
+
+    if (!grow(NULL, (void**)&j->limbo[e], &j->limbo_max[e], j->limbo_cnt[e], sizeof(struct _JLimbo))) {
+	return;
+    }
+    l = j->limbo[e] + j->limbo_cnt[e]++;
+    l->map = map;
+    l->size = size;
+    l->seg = seg;
+    l->block = block;
+}
+
+static void
+limbo_free(Journal j, int e) {
+    JLimbo	l;
+    JLimbo	end = j->limbo[e] + j->limbo_cnt[e];
+
+    for (l = j->limbo[e]; l < end; l++) {
+	if (NULL != l->map) {
+	    munmap(l->map, l->size);
+	}
+	if (NULL != l->seg) {
+	    zseg_free(l->seg->z);
+	    __atomic_store_n(&l->seg->z, NULL, __ATOMIC_RELEASE);
+	}
+	free(l->block);
+    }
+    j->limbo_cnt[e] = 0;
+}
+
+// Frees the limbo of the previous epoch once no reader pinned in it is left
+// and then starts a new epoch if anything was retired in the current one.
+// Readers of the previous epoch must be gone before the epoch moves on
+// since they may hold what was retired in the current epoch.
+static void
+limbo_reclaim(Journal j) {
+    int	prev = (int)((j->epoch + 1) & 1);
+
+    if (0 != __atomic_load_n(&j->pins[prev], __ATOMIC_SEQ_CST)) {
+	return;
+    }
+    limbo_free(j, prev);
+    if (0 < j->limbo_cnt[1 - prev]) {
+	__atomic_store_n(&j->epoch, j->epoch + 1, __ATOMIC_SEQ_CST);
+    }
+}
+
+// Sets up a compressed segment from the file mapped at __map__.
+static JZSeg
+zseg_new(ofixErr err, char *map, int64_t size, const char *path) {
+    JZHead	head = (JZHead)map;
+    JZSeg	z;
+
+    if (size < (int64_t)sizeof(struct _JZHead) || 0 != memcmp(head->magic, ZSEG_MAGIC, sizeof(head->magic)) ||
+	0 >= head->block_cnt || size < (int64_t)(sizeof(struct _JZHead) + head->block_cnt * sizeof(struct _JBlock))) {
+	if (NULL != err) {
+	    err->code = OFIX_READ_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "'%s' is not a compressed journal segment.", path);
+	}
+	return NULL;
+    }
+    if (NULL == (z = (JZSeg)calloc(1, sizeof(struct _JZSeg))) ||
+	NULL == (z->cache = (char**)calloc(head->block_cnt, sizeof(char*))) ||
+	NULL == (z->used = (int64_t*)calloc(head->block_cnt, sizeof(int64_t)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for a compressed journal segment.");
+	}
+	if (NULL != z) {
+	    free(z->cache);
+	    free(z);
+	}
+	return NULL;
+    }
+    z->base = map;
+    z->size = size;
+    z->blocks = (JBlock)(map + sizeof(struct _JZHead));
+    z->block_cnt = head->block_cnt;
+
+    return z;
+}
+
+// Maps a compressed segment read only.
+static bool
+zseg_load(ofixErr err, Journal j, const char *path) {
+    struct stat	st;
+    JSeg	seg = j->segs + j->seg_cnt;
+    void	*map;
+
+    if (0 != fstat(seg->fd, &st) || st.st_size < (off_t)sizeof(struct _JZHead)) {
+	close(seg->fd);
+	return false;
+    }
+    if (MAP_FAILED == (map = mmap(NULL, st.st_size, PROT_READ, MAP_SHARED, seg->fd, 0))) {
+	set_sys_err(err, OFIX_MEMORY_ERR, "map segment", path);
+	close(seg->fd);
+	return false;
+    }
+    if (NULL == (seg->z = zseg_new(err, (char*)map, st.st_size, path))) {
+	munmap(map, st.st_size);
+	close(seg->fd);
+	return false;
+    }
+    seg->base = seg->z->base;
+    seg->size = seg->z->size;
+    seg->live = 0;
+    seg->trimmed = true;
+    j->seg_cnt++;
+
+    return true;
+}
+
+// Maps an existing segment. A missing segment was retired and is left
+// unmapped. Returns false if the segment can not be used.
+static bool
+seg_load(ofixErr err, Journal j) {
+    char	path[1100];
+    struct stat	st;
+    JSeg	seg = j->segs + j->seg_cnt;
+    void	*map;
+
+    snprintf(path, sizeof(path), "%s/%06d.seg", j->dir, j->seg_cnt);
+    if (0 > (seg->fd = open(path, O_RDWR))) {
+	snprintf(path, sizeof(path), "%s/%06d.segz", j->dir, j->seg_cnt);
+	if (0 <= (seg->fd = open(path, O_RDONLY))) {
+	    return zseg_load(err, j, path);
+	}
+	seg->base = NULL;
+	j->seg_cnt++;
+	return true;
+    }
+    if (0 != fstat(seg->fd, &st) || st.st_size < (off_t)sizeof(struct _JSegHead)) {
+	close(seg->fd);
+	return false;
+    }
+    if (MAP_FAILED == (map = mmap(NULL, st.st_size, PROT_READ | PROT_WRITE, MAP_SHARED, seg->fd, 0))) {
+	set_sys_err(err, OFIX_MEMORY_ERR, "map segment", path);
+	close(seg->fd);
+	return false;
+    }
+    if (0 != memcmp(((JSegHead)map)->magic, SEG_MAGIC, sizeof(((JSegHead)map)->magic))) {
+	if (NULL != err) {
+	    err->code = OFIX_READ_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "'%.160s' is not a journal segment.", path);
+	}
+	munmap(map, st.st_size);
+	close(seg->fd);
+	return false;
+    }
+    seg->base = (char*)map;
+    seg->size = st.st_size;
+    seg->live = 0;
+    seg->trimmed = false;
+    j->seg_cnt++;
+
+    return true;
+}
+
+static JIndex
+dir_index(Journal j, int sid, IoDir dir) {
+    JIndex	sindex = &j->sindex;
+    JIndex	rindex = &j->rindex;
+
+    if (0 != sid) {
+	if (0 > sid || __atomic_load_n(&j->sess_cnt, __ATOMIC_ACQUIRE) < sid) {
+	    return NULL;
+	}
+	sindex = &j->sessions[sid]->sindex;
+	rindex = &j->sessions[sid]->rindex;
+    }
+    switch (dir) {
+    case OFIX_IODIR_SEND:	return sindex;
+    case OFIX_IODIR_RECV:	return rindex;
+    default:			break;
+    }
+    return NULL;
+}
+
+// Returns the location for __seq__ or NULL if the index does not reach it.
+// Readers other than the writer must hold a pin since the index may be
+// mapped again as it grows.
+static JLoc
+index_loc(JIndex index, int64_t seq) {
+    if (seq < 0 || __atomic_load_n(&index->size, __ATOMIC_ACQUIRE) <= seq) {
+	return NULL;
+    }
+    return __atomic_load_n(&index->locs, __ATOMIC_ACQUIRE) + seq;
+}
+
+static int64_t
+now_ns() {
+    struct timespec	ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    return (int64_t)ts.tv_sec * 1000000000LL + (int64_t)ts.tv_nsec;
+}
+
+static uint32_t
+rec_crc(JRec rec) {
+    uint32_t	crc = ofix_crc32c(0, (char*)rec + sizeof(rec->crc), sizeof(struct _JRec) - sizeof(rec->crc));
+
+    return ofix_crc32c(crc, (char*)rec + sizeof(struct _JRec), rec->len);
+}
+
+// Returns true if a complete, intact record starts at offset __pos__.
+static bool
+rec_valid(JSeg seg, int64_t pos) {
+    JRec	rec = (JRec)(seg->base + pos);
+
+    if (seg->size < pos + (int64_t)sizeof(struct _JRec)) {
+	return false;
+    }
+    if (REC_START == rec->dir) {
+	if (0 >= rec->len || 0 != rec->seq || 0 >= rec->sid || seg->size < pos + REC_SIZE(rec->len)) {
+	    return false;
+	}
+    } else if (0 >= rec->len || 0 >= rec->seq || OFIX_JOURNAL_MAX_SEQ <= rec->seq || 0 > rec->sid ||
+	       (OFIX_IODIR_SEND != rec->dir && OFIX_IODIR_RECV != rec->dir) ||
+	       seg->size < pos + REC_SIZE(rec->len)) {
+	return false;
+    }
+    return rec->crc == rec_crc(rec);
+}
+
+// Returns the index of the block holding offset __pos__ of the original
+// segment.
+static int32_t
+block_find(JZSeg z, int64_t pos) {
+    int32_t	lo = 0;
+    int32_t	hi = z->block_cnt - 1;
+    int32_t	mid;
+
+    while (lo < hi) {
+	mid = (lo + hi + 1) / 2;
+	if (z->blocks[mid].raw_off <= pos) {
+	    lo = mid;
+	} else {
+	    hi = mid - 1;
+	}
+    }
+    return lo;
+}
+
+static bool
+block_load(JZSeg z, int32_t bi, char *dst) {
+    JBlock	b = z->blocks + bi;
+
+    if (b->comp_len == b->raw_len) {
+	memcpy(dst, z->base + b->file_off, b->raw_len);
+	return true;
+    }
+    return b->raw_len == ofix_lz_decompress(z->base + b->file_off, b->comp_len, dst, b->raw_len);
+}
+
+// Returns the record at __pos__ or NULL if a compressed block is corrupt or
+// can not be decompressed.
+static JRec
+cursor_rec(Cursor c, JSeg seg, int64_t pos) {
+    // The base is loaded before the compressed segment. Once set the
+    // compressed segment stays until the segment is retired and freed, so
+    // if it is not set yet the base is still the original mapping.
+    char	*base = __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE);
+    JZSeg	z = __atomic_load_n(&seg->z, __ATOMIC_ACQUIRE);
+    int32_t	bi;
+    JBlock	b;
+
+    if (NULL == base) {
+	return NULL;
+    }
+    if (NULL == z) {
+	return (JRec)(base + pos);
+    }
+    bi = block_find(z, pos);
+    b = z->blocks + bi;
+    if (c->z != z || c->block != bi) {
+	c->z = NULL;
+	if (c->cap < b->raw_len) {
+	    char	*buf = (char*)realloc(c->buf, b->raw_len);
+
+	    if (NULL == buf) {
+		return NULL;
+	    }
+	    c->buf = buf;
+	    c->cap = b->raw_len;
+	}
+	if (!block_load(z, bi, c->buf)) {
+	    return NULL;
+	}
+	c->z = z;
+	c->block = bi;
+    }
+    return (JRec)(c->buf + (pos - b->raw_off));
+}
+
+// Returns the bytes at __pos__ of a compressed segment from the block cache,
+// decompressing the block if it is not already cached.
+static const char*
+block_cached(Journal j, JZSeg z, int64_t pos) {
+    int32_t	bi = block_find(z, pos);
+    JBlock	b = z->blocks + bi;
+    char	*buf;
+
+    z->used[bi] = j->passes;
+    if (NULL == (buf = __atomic_load_n(&z->cache[bi], __ATOMIC_ACQUIRE))) {
+	pthread_mutex_lock(&j->cache_mutex);
+	if (NULL == (buf = z->cache[bi]) && NULL != (buf = (char*)malloc(b->raw_len))) {
+	    if (block_load(z, bi, buf)) {
+		__atomic_store_n(&z->cache[bi], buf, __ATOMIC_RELEASE);
+	    } else {
+		free(buf);
+		buf = NULL;
+	    }
+	}
+	pthread_mutex_unlock(&j->cache_mutex);
+	if (NULL == buf) {
+	    return NULL;
+	}
+    }
+    return buf + (pos - b->raw_off);
+}
+
+// Returns the record at __pos__ for random access reads.
+static JRec
+seg_rec(Journal j, JSeg seg, int64_t pos) {
+    char	*base = __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE);
+    JZSeg	z = __atomic_load_n(&seg->z, __ATOMIC_ACQUIRE);
+
+    if (NULL == base) {
+	return NULL;
+    }
+    if (NULL == z) {
+	return (JRec)(base + pos);
+    }
+    return (JRec)block_cached(j, z, pos);
+}
+
+// Replaces the index mapping with one of __cap__ records. The old mapping
+// goes into limbo since readers may still be using it. Called by the thread
+// that maintains the journal.
+static bool
+index_map(ofixErr err, Journal j, JIndex index, int64_t cap) {
+    void	*map;
+
+    map = mmap(NULL, (size_t)cap * sizeof(struct _JLoc), PROT_READ | PROT_WRITE, MAP_SHARED, index->fd, 0);
+    if (MAP_FAILED == map) {
+	set_sys_err(err, OFIX_MEMORY_ERR, "map index in", j->dir);
+	return false;
+    }
+    limbo_reclaim(j);
+    limbo_add(j, (char*)index->head, index->cap * sizeof(struct _JLoc), NULL, NULL);
+    __atomic_store_n(&index->head, (JHead)map, __ATOMIC_RELEASE);
+    __atomic_store_n(&index->locs, (JLoc)map, __ATOMIC_RELEASE);
+    index->cap = cap;
+
+    return true;
+}
+
+// Grows the index file to hold __seq__. The mapping at least doubles when
+// it has to grow so the retired mappings add up to less than the current
+// one. The size is set last so a reader that sees it also sees the mapping.
+static bool
+index_fit(ofixErr err, Journal j, JIndex index, int64_t seq) {
+    if (index->size <= seq && 0 <= index->fd) {
+	int64_t	size = (seq / INDEX_INC + 1) * INDEX_INC;
+
+	if (index->cap < size) {
+	    int64_t	cap = index->cap * 2;
+
+	    if (cap < size) {
+		cap = size;
+	    }
+	    if (OFIX_JOURNAL_MAX_SEQ < cap) {
+		cap = OFIX_JOURNAL_MAX_SEQ;
+	    }
+	    if (!index_map(err, j, index, cap)) {
+		return false;
+	    }
+	}
+	if (0 != ftruncate(index->fd, size * sizeof(struct _JLoc))) {
+	    set_sys_err(err, OFIX_WRITE_ERR, "grow index in", j->dir);
+	    return false;
+	}
+	__atomic_store_n(&index->size, size, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+// Drops locations in the last segment at or past __end__ and makes sure the
+// last_seq refers to a stored message.
+static void
+index_trim(JIndex index, int si, int64_t end, int64_t last) {
+    JLoc	loc;
+    int64_t	seq;
+
+    for (loc = index->locs + 1; loc < index->locs + index->size; loc++) {
+	if (0 < loc->size && si == loc->seg && end <= loc->start) {
+	    memset(loc, 0, sizeof(struct _JLoc));
+	}
+    }
+    if (0 < last) {
+	index->head->last_seq = last;
+	return;
+    }
+    for (seq = index->head->last_seq; 0 < seq; seq--) {
+	if (seq < index->size && 0 < index->locs[seq].size) {
+	    break;
+	}
+    }
+    index->head->last_seq = seq;
+}
+
+// Drops all the locations in an index. The records no longer keep their
+// segments alive.
+static void
+index_clear(Journal j, JIndex index) {
+    JLoc	end = index->locs + index->top + 1;
+    JLoc	loc;
+
+    for (loc = index->locs + 1; loc < end; loc++) {
+	if (0 < loc->size) {
+	    if (loc->seg < j->seg_cnt) {
+		j->segs[loc->seg].live--;
+	    }
+	    __atomic_store_n(&loc->size, 0, __ATOMIC_RELEASE);
+	    loc->seg = 0;
+	    loc->start = 0;
+	}
+    }
+    if ((int64_t)PAGE_LOCS <= index->top) {
+	// Reads of a released page see zeros, the same as unset locations.
+	madvise(index->locs + PAGE_LOCS, (index->top / PAGE_LOCS) * PAGE_LOCS * sizeof(struct _JLoc),
+		(0 <= index->fd) ? MADV_REMOVE : MADV_DONTNEED);
+    }
+    index->head->last_seq = 0;
+    index->top = 0;
+    index->written = 0;
+    index->dirty = true;
+}
+
+// Starts a session over. Called when a session start record is written or
+// replayed so the clear is ordered with the session's other records.
+static void
+session_reset(Journal j, JSession js) {
+    index_clear(j, &js->sindex);
+    index_clear(j, &js->rindex);
+    if (j->writing) {
+	pthread_mutex_lock(&j->sync_mutex);
+	js->sindex.synced = 0;
+	js->rindex.synced = 0;
+	pthread_mutex_unlock(&j->sync_mutex);
+    }
+}
+
+// Returns the index checkpoint or segment 0 if there is none, in which case
+// the whole journal is replayed.
+static void
+mark_load(Journal j, JMark mark) {
+    char	path[1100];
+    int		fd;
+
+    snprintf(path, sizeof(path), "%s/index.mark", j->dir);
+    if (0 > (fd = open(path, O_RDONLY)) ||
+	sizeof(struct _JMark) != pread(fd, mark, sizeof(struct _JMark), 0) ||
+	0 != memcmp(mark->magic, MARK_MAGIC, sizeof(mark->magic)) ||
+	0 > mark->seg || (int64_t)sizeof(struct _JSegHead) > mark->pos) {
+	mark->seg = 0;
+	mark->pos = sizeof(struct _JSegHead);
+    }
+    if (0 <= fd) {
+	close(fd);
+    }
+}
+
+// Indexes the intact records of segment __si__ from __pos__ on and returns
+// the offset of the first record that is not intact.
+static int64_t
+replay(ofixErr err, Journal j, int si, int64_t pos, int64_t *last) {
+    JSeg	seg = j->segs + si;
+    JRec	rec;
+    JIndex	index;
+    JLoc	loc;
+
+    while (rec_valid(seg, pos)) {
+	rec = (JRec)(seg->base + pos);
+	pos += REC_SIZE(rec->len);
+	if (j->last_ts < rec->ts) {
+	    j->last_ts = rec->ts;
+	}
+	if (REC_START == rec->dir) {
+	    if (rec->sid <= j->sess_cnt) {
+		session_reset(j, j->sessions[rec->sid]);
+	    }
+	    continue;
+	}
+	if (NULL == (index = dir_index(j, rec->sid, (IoDir)rec->dir))) {
+	    continue;
+	}
+	if (!index_fit(err, j, index, rec->seq)) {
+	    break;
+	}
+	loc = index->locs + rec->seq;
+	loc->seg = si;
+	loc->start = (char*)rec - seg->base + sizeof(struct _JRec);
+	loc->size = rec->len;
+	index->dirty = true;
+	if (index->top < rec->seq) {
+	    index->top = rec->seq;
+	}
+	if (0 == rec->sid) {
+	    last[(OFIX_IODIR_SEND == rec->dir) ? 0 : 1] = rec->seq;
+	} else {
+	    index->head->last_seq = rec->seq;
+	}
+    }
+    return pos;
+}
+
+// Replays the records written since the last index checkpoint after a
+// reopen. Index files are only synced at checkpoints so pages written after
+// one may not have made it to disk, and the segment end in the header can
+// not be trusted after a crash either since the mapped pages may have been
+// written back in any order. Every intact record from the checkpoint on is
+// indexed again and the last segment, which is always checked from its
+// start, is truncated at the first torn or corrupt record.
+static void
+recover(ofixErr err, Journal j) {
+    struct _JMark	mark;
+    int			si = j->seg_cnt - 1;
+    JSeg		seg = j->segs + si;
+    int64_t		pos = sizeof(struct _JSegHead);
+    int64_t		last[2] = { 0, 0 };
+    int			i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    mark_load(j, &mark);
+    if (mark.seg < si) {
+	// segments closed since the checkpoint, a crash may have come before
+	// the checkpoint of the last roll was written
+	for (i = mark.seg; i < si; i++) {
+	    if (NULL != j->segs[i].base && NULL == j->segs[i].z) {
+		replay(err, j, i, (i == mark.seg) ? mark.pos : pos, last);
+	    }
+	}
+    }
+    j->mark_seg = (mark.seg < si) ? mark.seg : si;
+    pos = replay(err, j, si, pos, last);
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    index_trim(&j->sindex, si, pos, last[0]);
+    index_trim(&j->rindex, si, pos, last[1]);
+    for (i = 1; i <= j->sess_cnt; i++) {
+	index_trim(&j->sessions[i]->sindex, si, pos, 0);
+	index_trim(&j->sessions[i]->rindex, si, pos, 0);
+    }
+    if (pos < seg->size) {
+	// Shrinking and regrowing the file zeros everything past the end so
+	// stale records are never mistaken for new ones on the next recovery.
+	if (0 != ftruncate(seg->fd, pos) || 0 != ftruncate(seg->fd, seg->size)) {
+	    set_sys_err(err, OFIX_WRITE_ERR, "truncate segment in", j->dir);
+	    return;
+	}
+    }
+    ((JSegHead)seg->base)->end = pos;
+}
+
+// Adds a session with index files named by the session id. If reuse is
+// true the index files left by an earlier open are used as they are.
+static JSession
+session_new(ofixErr err, Journal j, const char *name, bool reuse) {
+    char	file[32];
+    JSession	js;
+    int		sid = j->sess_cnt + 1;
+
+    if (OFIX_JOURNAL_MAX_SESSIONS <= sid) {
+	if (NULL != err) {
+	    err->code = OFIX_OVERFLOW_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Journal '%.160s' has reached the session limit.", j->dir);
+	}
+	return NULL;
+    }
+    if (NULL == (js = (JSession)calloc(1, sizeof(struct _JSession)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for journal session.");
+	}
+	return NULL;
+    }
+    strncpy(js->name, name, sizeof(js->name) - 1);
+    js->sindex.fd = -1;
+    js->rindex.fd = -1;
+    snprintf(file, sizeof(file), "%d.send.idx", sid);
+    index_open(err, &js->sindex, j->dir, file, reuse);
+    snprintf(file, sizeof(file), "%d.recv.idx", sid);
+    index_open(err, &js->rindex, j->dir, file, reuse);
+    if (NULL != err && OFIX_OK != err->code) {
+	index_close(&js->sindex);
+	index_close(&js->rindex);
+	free(js);
+	return NULL;
+    }
+    j->sessions[sid] = js;
+    __atomic_store_n(&j->sess_cnt, sid, __ATOMIC_RELEASE);
+
+    return js;
+}
+
+// Counts the records each segment still has referenced from an index.
+static void
+index_live(Journal j, JIndex index) {
+    JLoc	loc;
+    JLoc	end = index->locs + index->top + 1;
+
+    for (loc = index->locs + 1; loc < end; loc++) {
+	if (0 < loc->size && loc->seg < j->seg_cnt) {
+	    j->segs[loc->seg].live++;
+	}
+    }
+}
+
+// Reads the session names and maps the session index files. The records in
+// the last segment are indexed again by recover().
+static void
+sessions_load(ofixErr err, Journal j) {
+    char	path[1100];
+    char	line[64];
+    FILE	*f;
+
+    snprintf(path, sizeof(path), "%s/sessions", j->dir);
+    if (NULL == (f = fopen(path, "r"))) {
+	return;
+    }
+    while (NULL != fgets(line, sizeof(line), f)) {
+	char	*nl = strchr(line, '\n');
+
+	if (NULL != nl) {
+	    *nl = '\0';
+	}
+	if (NULL == session_new(err, j, line, true)) {
+	    break;
+	}
+    }
+    fclose(f);
+}
+
+static Journal
+journal_new(ofixErr err, const char *dir, const char *id, int64_t seg_size, bool reuse) {
+    Journal	j;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (NULL == dir || NULL == id) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "NULL directory or identifier argument to journal create is not valid.");
+	}
+	return NULL;
+    }
+    if (0 != mkdir(dir, 0755) && EEXIST != errno) {
+	set_sys_err(err, OFIX_WRITE_ERR, "create directory", dir);
+	return NULL;
+    }
+    if (NULL == (j = (Journal)malloc(sizeof(struct _Journal)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for journal.");
+	}
+	return NULL;
+    }
+    memset(j, 0, sizeof(struct _Journal));
+    strncpy(j->dir, dir, sizeof(j->dir) - 1);
+    strncpy(j->id, id, sizeof(j->id) - 1);
+    j->seg_size = (0 < seg_size) ? seg_size : OFIX_JOURNAL_SEG_SIZE;
+    j->sindex.fd = -1;
+    j->rindex.fd = -1;
+    j->repl_sock = -1;
+    pthread_mutex_init(&j->add_mutex, 0);
+    pthread_mutex_init(&j->idx_mutex, 0);
+    pthread_mutex_init(&j->cache_mutex, 0);
+
+    if (!reuse) {
+	char	path[1100];
+	FILE	*f;
+	int	i;
+
+	// Left over segments and sessions would be picked up by a later open.
+	snprintf(path, sizeof(path), "%s/sessions", dir);
+	if (NULL != (f = fopen(path, "r"))) {
+	    char	line[64];
+	    int		sid = 0;
+
+	    while (NULL != fgets(line, sizeof(line), f)) {
+		sid++;
+		snprintf(path, sizeof(path), "%s/%d.send.idx", dir, sid);
+		unlink(path);
+		snprintf(path, sizeof(path), "%s/%d.recv.idx", dir, sid);
+		unlink(path);
+	    }
+	    fclose(f);
+	    snprintf(path, sizeof(path), "%s/sessions", dir);
+	}
+	unlink(path);
+	snprintf(path, sizeof(path), "%s/index.mark", dir);
+	unlink(path);
+	for (i = seg_max(dir); 0 <= i; i--) {
+	    if (0 < i) {
+		snprintf(path, sizeof(path), "%s/%06d.seg", dir, i);
+		unlink(path);
+	    }
+	    snprintf(path, sizeof(path), "%s/%06d.segz", dir, i);
+	    unlink(path);
+	}
+    }
+    index_open(err, &j->sindex, dir, "send.idx", reuse);
+    index_open(err, &j->rindex, dir, "recv.idx", reuse);
+    if (reuse) {
+	int	max = seg_max(dir);
+
+	if (OFIX_JOURNAL_MAX_SEGS <= max) {
+	    max = OFIX_JOURNAL_MAX_SEGS - 1;
+	}
+	while (j->seg_cnt <= max && seg_load(err, j)) {
+	}
+	if (0 < j->seg_cnt && NULL == j->segs[j->seg_cnt - 1].base) {
+	    // the last segment is never retired so start a new one
+	    seg_open(err, j, j->seg_size);
+	}
+	if (0 < j->seg_cnt) {
+	    JSeg	seg;
+	    int		i;
+
+	    sessions_load(err, j);
+	    recover(err, j);
+	    // counted once all the indexes are final
+	    for (seg = j->segs; seg < j->segs + j->seg_cnt; seg++) {
+		seg->live = 0;
+	    }
+	    index_live(j, &j->sindex);
+	    index_live(j, &j->rindex);
+	    for (i = 1; i <= j->sess_cnt; i++) {
+		index_live(j, &j->sessions[i]->sindex);
+		index_live(j, &j->sessions[i]->rindex);
+	    }
+	    index_seed(j);
+	}
+    }
+    if (0 == j->seg_cnt) {
+	seg_open(err, j, j->seg_size);
+    }
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_journal_destroy(j);
+	return NULL;
+    }
+    return j;
+}
+
+Journal
+ofix_journal_create(ofixErr err, const char *dir, const char *id, int64_t seg_size) {
+    return journal_new(err, dir, id, seg_size, false);
+}
+
+Journal
+ofix_journal_open(ofixErr err, const char *dir, const char *id, int64_t seg_size) {
+    return journal_new(err, dir, id, seg_size, true);
+}
+
+void
+ofix_journal_destroy(Journal j) {
+    if (NULL != j) {
+	JSeg	seg;
+	int	i;
+
+	if (j->replicating) {
+	    j->repl_done = true;
+	    pthread_join(j->repl_thread, NULL);
+	    j->replicating = false;
+	    if (0 <= j->repl_sock) {
+		close(j->repl_sock);
+	    }
+	    pthread_mutex_destroy(&j->repl_mutex);
+	    pthread_cond_destroy(&j->repl_cond);
+	}
+	if (j->writing) {
+	    j->done = true;
+	    pthread_join(j->writer, NULL);
+	    j->writing = false;
+	    sync_journal(j);
+	    free(j->slots);
+	    pthread_mutex_destroy(&j->sync_mutex);
+	    pthread_cond_destroy(&j->sync_cond);
+	}
+	// first so retired segments no longer have a compressed segment set
+	limbo_free(j, 0);
+	limbo_free(j, 1);
+	for (seg = j->segs; seg < j->segs + j->seg_cnt; seg++) {
+	    if (NULL != seg->z) {
+		if (seg->base != seg->z->base) {
+		    munmap(seg->base, seg->size);
+		}
+		zseg_free(seg->z);
+		close(seg->fd);
+	    } else if (NULL != seg->base) {
+		munmap(seg->base, seg->size);
+		close(seg->fd);
+	    }
+	}
+	index_close(&j->sindex);
+	index_close(&j->rindex);
+	for (i = 1; i <= j->sess_cnt; i++) {
+	    index_close(&j->sessions[i]->sindex);
+	    index_close(&j->sessions[i]->rindex);
+	    free(j->sessions[i]);
+	}
+	pthread_mutex_destroy(&j->add_mutex);
+	pthread_mutex_destroy(&j->idx_mutex);
+	pthread_mutex_destroy(&j->cache_mutex);
+	free(j->limbo[0]);
+	free(j->limbo[1]);
+	free(j->times);
+	free(j->keys);
+	free(j->buckets);
+	free(j);
+    }
+}
+
+int
+ofix_journal_session(ofixErr err, Journal j, const char *name, bool fresh) {
+    char	path[1100];
+    FILE	*f;
+    int		sid;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return -1;
+    }
+    if (NULL == j || NULL == name || '\0' == *name || NULL != strchr(name, '\n') ||
+	sizeof(((JSession)0)->name) <= strlen(name)) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal session.");
+	}
+	return -1;
+    }
+    pthread_mutex_lock(&j->add_mutex);
+    for (sid = j->sess_cnt; 0 < sid; sid--) {
+	if (0 == strcmp(name, j->sessions[sid]->name)) {
+	    break;
+	}
+    }
+    if (0 < sid) {
+	if (fresh) {
+	    session_start(err, j, sid);
+	}
+	pthread_mutex_unlock(&j->add_mutex);
+
+	return (NULL == err || OFIX_OK == err->code) ? sid : -1;
+    }
+    snprintf(path, sizeof(path), "%s/sessions", j->dir);
+    if (NULL == (f = fopen(path, "a"))) {
+	set_sys_err(err, OFIX_WRITE_ERR, "open", path);
+	pthread_mutex_unlock(&j->add_mutex);
+	return -1;
+    }
+    fprintf(f, "%s\n", name);
+    fflush(f);
+    fdatasync(fileno(f));
+    fclose(f);
+    sid = (NULL == session_new(err, j, name, false)) ? -1 : j->sess_cnt;
+    pthread_mutex_unlock(&j->add_mutex);
+
+    return sid;
+}
+
+int64_t
+ofix_journal_last_seq(Journal j, int sid, IoDir dir) {
+    JIndex	index;
+    int64_t	pin;
+    int64_t	seq;
+
+    if (NULL == j || NULL == (index = dir_index(j, sid, dir))) {
+	return 0;
+    }
+    // pinned since the index may be mapped again as it grows
+    pin = ofix_journal_pin(j);
+    seq = __atomic_load_n(&index->head, __ATOMIC_ACQUIRE)->last_seq;
+    ofix_journal_unpin(j, pin);
+
+    return seq;
+}
+
+// Points the location for the record's seq at the record at __pos__ in
+// segment __si__.
+static void
+index_set(Journal j, JIndex index, int si, int64_t pos, JRec rec) {
+    JLoc	loc = index->locs + rec->seq;
+
+    if (0 < loc->size && loc->seg < j->seg_cnt) {
+	// replaced, the old record no longer keeps its segment alive
+	j->segs[loc->seg].live--;
+    }
+    j->segs[si].live++;
+    index->dirty = true;
+    if (index->top < rec->seq) {
+	index->top = rec->seq;
+    }
+    loc->seg = si;
+    loc->start = pos + sizeof(struct _JRec);
+    // size last, a non-zero size marks the location as set
+    __atomic_store_n(&loc->size, rec->len, __ATOMIC_RELEASE);
+    index->head->last_seq = rec->seq;
+}
+
+// Syncs an index file changed since the last checkpoint.
+static bool
+index_flush(JIndex index) {
+    if (index->dirty) {
+	if (0 != fdatasync(index->fd)) {
+	    return false;
+	}
+	index->dirty = false;
+    }
+    return true;
+}
+
+// Syncs the segments before __si__ and the indexes changed since the last
+// checkpoint and then records that the indexes cover every record before
+// segment __si__. Called when a segment is rolled so the index files are
+// synced once per segment rather than on every commit. If anything fails
+// the earlier checkpoint stays and a reopen replays more records.
+static void
+checkpoint(Journal j, int si) {
+    char		path[1100];
+    struct _JMark	mark;
+    JSeg		seg;
+    int			cnt = __atomic_load_n(&j->sess_cnt, __ATOMIC_ACQUIRE);
+    int			fd;
+    int			i;
+
+    for (seg = j->segs + j->mark_seg; seg < j->segs + si; seg++) {
+	if (0 <= seg->fd && NULL == seg->z && 0 != fdatasync(seg->fd)) {
+	    return;
+	}
+    }
+    if (!index_flush(&j->sindex) || !index_flush(&j->rindex)) {
+	return;
+    }
+    for (i = 1; i <= cnt; i++) {
+	if (!index_flush(&j->sessions[i]->sindex) || !index_flush(&j->sessions[i]->rindex)) {
+	    return;
+	}
+    }
+    memset(&mark, 0, sizeof(mark));
+    memcpy(mark.magic, MARK_MAGIC, sizeof(mark.magic));
+    mark.seg = si;
+    mark.pos = sizeof(struct _JSegHead);
+    snprintf(path, sizeof(path), "%s/index.mark", j->dir);
+    if (0 > (fd = open(path, O_WRONLY | O_CREAT, 0644))) {
+	return;
+    }
+    if (sizeof(mark) == pwrite(fd, &mark, sizeof(mark), 0) && 0 == fdatasync(fd)) {
+	j->mark_seg = si;
+    }
+    close(fd);
+}
+
+static void
+append(ofixErr err, Journal j, int sid, int64_t seq, int64_t ts, IoDir dir, const char *str, int len) {
+    JIndex	index = dir_index(j, sid, dir);
+    int64_t	rsize = REC_SIZE(len);
+    JSeg	seg;
+    JSegHead	head;
+    JRec	rec;
+
+    if (REC_START != dir && !index_fit(err, j, index, seq)) {
+	return;
+    }
+    // Adds are stamped before they are queued so a later stamp can be
+    // written first. Holding the time to the last one written keeps the
+    // times in order for range searches.
+    if (ts < j->last_ts) {
+	ts = j->last_ts;
+    }
+    j->last_ts = ts;
+    seg = j->segs + j->seg_cnt - 1;
+    head = (JSegHead)seg->base;
+    if (seg->size < head->end + rsize ||
+	(0.0 < j->roll_interval && (int64_t)sizeof(struct _JSegHead) < head->end &&
+	 head->created + (int64_t)(j->roll_interval * 1000000000.0) <= ts)) {
+	int64_t	size = j->seg_size;
+
+	if (size < (int64_t)sizeof(struct _JSegHead) + rsize) {
+	    size = sizeof(struct _JSegHead) + rsize;
+	}
+	seg_open(err, j, size);
+	if (NULL != err && OFIX_OK != err->code) {
+	    return;
+	}
+	checkpoint(j, j->seg_cnt - 1);
+	seg = j->segs + j->seg_cnt - 1;
+	head = (JSegHead)seg->base;
+    }
+    rec = (JRec)(seg->base + head->end);
+    rec->len = len;
+    rec->seq = seq;
+    rec->ts = ts;
+    rec->dir = (uint8_t)dir;
+    memset(rec->pad, 0, sizeof(rec->pad));
+    rec->sid = sid;
+    memcpy((char*)rec + sizeof(struct _JRec), str, len);
+    memset((char*)rec + sizeof(struct _JRec) + len, 0, rsize - sizeof(struct _JRec) - len);
+    rec->crc = rec_crc(rec);
+    if (REC_START == dir) {
+	session_reset(j, j->sessions[sid]);
+    } else {
+	index_set(j, index, j->seg_cnt - 1, head->end, rec);
+    }
+    __atomic_store_n(&head->end, head->end + rsize, __ATOMIC_RELEASE);
+}
+
+// Returns the queue position of the entry or -1 on error.
+static int64_t
+enqueue(ofixErr err, Journal j, int sid, int64_t seq, int64_t ts, IoDir dir, const char *str, int len) {
+    int64_t	pos = __atomic_load_n(&j->head, __ATOMIC_RELAXED);
+    JSlot	slot;
+    char	*copy;
+
+    if (NULL == (copy = (char*)malloc(len))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for journal entry.");
+	}
+	return -1;
+    }
+    memcpy(copy, str, len);
+    while (true) {
+	int64_t	diff;
+
+	slot = j->slots + (pos & (OFIX_JOURNAL_QUEUE_SIZE - 1));
+	diff = __atomic_load_n(&slot->turn, __ATOMIC_ACQUIRE) - pos;
+	if (0 == diff) {
+	    if (__atomic_compare_exchange_n(&j->head, &pos, pos + 1, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+		break;
+	    }
+	} else if (0 > diff) {
+	    // full, wait for the writer to catch up
+	    dsleep(0.0001);
+	    pos = __atomic_load_n(&j->head, __ATOMIC_RELAXED);
+	} else {
+	    pos = __atomic_load_n(&j->head, __ATOMIC_RELAXED);
+	}
+    }
+    slot->sid = sid;
+    slot->seq = seq;
+    slot->ts = ts;
+    slot->dir = dir;
+    slot->len = len;
+    slot->str = copy;
+    __atomic_store_n(&slot->turn, pos + 1, __ATOMIC_RELEASE);
+
+    return pos;
+}
+
+// Writes a session start record for a session that is starting over. With a
+// writer thread the record goes through the queue behind any adds already
+// made for the session and the call waits until the writer has applied it.
+// The caller holds the add_mutex.
+static void
+session_start(ofixErr err, Journal j, int sid) {
+    const char	*name = j->sessions[sid]->name;
+    int		len = (int)strlen(name);
+    int64_t	pos;
+
+    if (!j->writing) {
+	append(err, j, sid, 0, now_ns(), (IoDir)REC_START, name, len);
+	return;
+    }
+    if (0 > (pos = enqueue(err, j, sid, 0, now_ns(), (IoDir)REC_START, name, len))) {
+	return;
+    }
+    while (__atomic_load_n(&j->tail, __ATOMIC_ACQUIRE) <= pos) {
+	dsleep(0.0001);
+    }
+    if (NULL != err && OFIX_OK != j->werr.code) {
+	*err = j->werr;
+    }
+}
+
+void
+ofix_journal_add(ofixErr err, Journal j, int sid, int64_t seq, IoDir dir, const char *str, int len) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j || NULL == str || 0 >= len || NULL == dir_index(j, sid, dir)) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal add.");
+	}
+	return;
+    }
+    if (0 >= seq || OFIX_JOURNAL_MAX_SEQ <= seq) {
+	if (NULL != err) {
+	    err->code = OFIX_OVERFLOW_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Sequence number %lld is out of range for the journal.", (long long)seq);
+	}
+	return;
+    }
+    if (j->writing) {
+	if (OFIX_OK != j->werr.code) {
+	    if (NULL != err) {
+		*err = j->werr;
+	    }
+	    return;
+	}
+	enqueue(err, j, sid, seq, now_ns(), dir, str, len);
+    } else {
+	pthread_mutex_lock(&j->add_mutex);
+	append(err, j, sid, seq, now_ns(), dir, str, len);
+	index_catch_up(j, false);
+	pthread_mutex_unlock(&j->add_mutex);
+    }
+}
+
+// Releases the index page holding __seq__ if none of its locations are set.
+static void
+page_release(JIndex index, int64_t seq) {
+    JLoc	page = index->locs + (seq / PAGE_LOCS) * PAGE_LOCS;
+    JLoc	loc;
+
+    if (page == index->locs) {
+	// the first page holds the header
+	return;
+    }
+    for (loc = page; loc < page + PAGE_LOCS; loc++) {
+	if (0 != loc->size) {
+	    return;
+	}
+    }
+    // Reads of a released page see zeros, the same as unset locations.
+    madvise(page, PAGE_LOCS * sizeof(struct _JLoc), (0 <= index->fd) ? MADV_REMOVE : MADV_DONTNEED);
+}
+
+// Drops the index locations that refer to the segment then removes the
+// segment file. The mapping is unmapped once pinned readers are done.
+static void
+seg_retire(Journal j, int si) {
+    char	path[1100];
+    JSeg		seg = j->segs + si;
+    char		*base = seg->base;
+    JZSeg		z = seg->z;
+    int64_t		end = ((JSegHead)base)->end;
+    int64_t		pos;
+    JRec		rec;
+    struct _Cursor	cur = { NULL, 0, NULL, 0 };
+
+    for (pos = sizeof(struct _JSegHead); pos < end; pos += REC_SIZE(rec->len)) {
+	JIndex	index;
+	JLoc	loc;
+
+	if (NULL == (rec = cursor_rec(&cur, seg, pos)) || 0 >= rec->len) {
+	    break;
+	}
+	if (NULL == (index = dir_index(j, rec->sid, (IoDir)rec->dir)) || 0 >= rec->seq || index->size <= rec->seq) {
+	    continue;
+	}
+	loc = index->locs + rec->seq;
+	if (si == loc->seg && pos + (int64_t)sizeof(struct _JRec) == loc->start) {
+	    __atomic_store_n(&loc->size, 0, __ATOMIC_RELEASE);
+	    loc->seg = 0;
+	    loc->start = 0;
+	    page_release(index, rec->seq);
+	}
+    }
+    free(cur.buf);
+    // The compressed segment stays set until it is freed so a reader that
+    // loaded the base first never takes a compressed base for the original.
+    __atomic_store_n(&seg->base, NULL, __ATOMIC_RELEASE);
+    limbo_add(j, (NULL == z || base != z->base) ? base : NULL, seg->size, (NULL == z) ? NULL : seg, NULL);
+    close(seg->fd);
+    seg->fd = -1;
+    seg->live = 0;
+    if (NULL != z) {
+	snprintf(path, sizeof(path), "%s/%06d.segz", j->dir, si);
+	unlink(path);
+    }
+    snprintf(path, sizeof(path), "%s/%06d.seg", j->dir, si);
+    unlink(path);
+}
+
+// Writes a compressed copy of a closed segment in blocks of whole records,
+// switches readers to it, and removes the original file. The original
+// mapping is retired on the next pass.
+static void
+seg_compress(Journal j, int si) {
+    char		path[1100];
+    char		tmp[sizeof(path) + 4];
+    JSeg		seg = j->segs + si;
+    char		*base = seg->base;
+    int64_t		end = ((JSegHead)base)->end;
+    struct _JZHead	head;
+    JBlock		blocks = NULL;
+    int64_t		bmax = 0;
+    int64_t		cnt = 0;
+    int32_t		raw_max = 0;
+    int64_t		pos;
+    int64_t		off;
+    JRec		rec;
+    char		*buf;
+    void		*map;
+    JZSeg		z;
+    int			fd;
+    int64_t		i;
+
+    for (pos = sizeof(struct _JSegHead); pos < end; pos += REC_SIZE(rec->len)) {
+	rec = (JRec)(base + pos);
+	if (0 >= rec->len) {
+	    break;
+	}
+	if (0 == cnt || OFIX_JOURNAL_BLOCK_SIZE < pos + REC_SIZE(rec->len) - blocks[cnt - 1].raw_off) {
+	    if (!grow(NULL, (void**)&blocks, &bmax, cnt, sizeof(struct _JBlock))) {
+		free(blocks);
+		return;
+	    }
+	    blocks[cnt].raw_off = pos;
+	    cnt++;
+	}
+	blocks[cnt - 1].raw_len = (int32_t)(pos + REC_SIZE(rec->len) - blocks[cnt - 1].raw_off);
+	if (raw_max < blocks[cnt - 1].raw_len) {
+	    raw_max = blocks[cnt - 1].raw_len;
+	}
+    }
+    if (0 == cnt || NULL == (buf = (char*)malloc(raw_max))) {
+	free(blocks);
+	return;
+    }
+    memset(&head, 0, sizeof(head));
+    memcpy(head.magic, ZSEG_MAGIC, sizeof(head.magic));
+    head.end = pos;
+    head.created = ((JSegHead)base)->created;
+    head.block_cnt = (int32_t)cnt;
+    copy_id(head.id, sizeof(head.id), ((JSegHead)base)->id);
+
+    snprintf(path, sizeof(path), "%s/%06d.segz", j->dir, si);
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+    if (0 > (fd = open(tmp, O_RDWR | O_CREAT | O_TRUNC, 0644))) {
+	free(blocks);
+	free(buf);
+	return;
+    }
+    off = sizeof(struct _JZHead) + cnt * sizeof(struct _JBlock);
+    for (i = 0; i < cnt; i++) {
+	JBlock	b = blocks + i;
+	int	clen = ofix_lz_compress(base + b->raw_off, b->raw_len, buf, b->raw_len);
+	char	*src = buf;
+
+	if (0 > clen) {
+	    // stored as is if it does not compress
+	    clen = b->raw_len;
+	    src = base + b->raw_off;
+	}
+	b->file_off = off;
+	b->comp_len = clen;
+	if (clen != pwrite(fd, src, clen, off)) {
+	    break;
+	}
+	off += clen;
+    }
+    free(buf);
+    if (i < cnt ||
+	sizeof(head) != pwrite(fd, &head, sizeof(head), 0) ||
+	(ssize_t)(cnt * sizeof(struct _JBlock)) != pwrite(fd, blocks, cnt * sizeof(struct _JBlock), sizeof(head)) ||
+	0 != fdatasync(fd) ||
+	0 != rename(tmp, path)) {
+	free(blocks);
+	close(fd);
+	unlink(tmp);
+	return;
+    }
+    free(blocks);
+    if (MAP_FAILED == (map = mmap(NULL, off, PROT_READ, MAP_SHARED, fd, 0))) {
+	close(fd);
+	unlink(path);
+	return;
+    }
+    if (NULL == (z = zseg_new(NULL, (char*)map, off, path))) {
+	munmap(map, off);
+	close(fd);
+	unlink(path);
+	return;
+    }
+    close(seg->fd);
+    seg->fd = fd;
+    seg->trimmed = true;
+    __atomic_store_n(&seg->z, z, __ATOMIC_RELEASE);
+    snprintf(path, sizeof(path), "%s/%06d.seg", j->dir, si);
+    unlink(path);
+}
+
+// Retires the original mapping of a segment compressed on an earlier pass
+// and decompressed blocks that have not been read for a while.
+static void
+seg_release(Journal j, JSeg seg) {
+    JZSeg	z = seg->z;
+    int32_t	i;
+
+    if (seg->base != z->base) {
+	char	*base = seg->base;
+	int64_t	size = seg->size;
+
+	seg->size = z->size;
+	__atomic_store_n(&seg->base, z->base, __ATOMIC_RELEASE);
+	limbo_add(j, base, size, NULL, NULL);
+    }
+    pthread_mutex_lock(&j->cache_mutex);
+    for (i = 0; i < z->block_cnt; i++) {
+	if (NULL != z->cache[i] && z->used[i] + OFIX_JOURNAL_CACHE_PASSES < j->passes) {
+	    limbo_add(j, NULL, 0, NULL, z->cache[i]);
+	    __atomic_store_n(&z->cache[i], NULL, __ATOMIC_RELEASE);
+	}
+    }
+    pthread_mutex_unlock(&j->cache_mutex);
+}
+
+static void
+maintain(Journal j) {
+    int64_t	now = now_ns();
+    int		last = j->seg_cnt - 1;
+    int		cnt = 0;
+    int		retired = 0;
+    int		si;
+
+    j->passes++;
+    limbo_reclaim(j);
+    for (si = 0; si <= last; si++) {
+	if (NULL != j->segs[si].base) {
+	    cnt++;
+	}
+    }
+    // The last segment is still being written and is never touched.
+    for (si = 0; si < last; si++) {
+	JSeg	seg = j->segs + si;
+	bool	expired = false;
+
+	if (NULL == seg->base) {
+	    continue;
+	}
+	if (0.0 < j->keep_age) {
+	    int	ni = si + 1;
+
+	    // closed when the next segment was created
+	    while (NULL == j->segs[ni].base) {
+		ni++;
+	    }
+	    expired = ((JSegHead)j->segs[ni].base)->created + (int64_t)(j->keep_age * 1000000000.0) <= now;
+	}
+	if (0 >= seg->live || expired || (0 < j->keep_segs && j->keep_segs < cnt)) {
+	    seg_retire(j, si);
+	    cnt--;
+	    retired++;
+	    continue;
+	}
+	if (NULL != seg->z) {
+	    seg_release(j, seg);
+	    continue;
+	}
+	if (j->compress) {
+	    seg_compress(j, si);
+	    continue;
+	}
+	if (!seg->trimmed) {
+	    if (0 != ftruncate(seg->fd, ((JSegHead)seg->base)->end)) {
+		continue;
+	    }
+	    seg->trimmed = true;
+	}
+    }
+    if (0 < retired) {
+	index_prune(j);
+    }
+}
+
+void
+ofix_journal_set_retention(ofixErr err, Journal j, double roll_interval, int keep_segs, double keep_age) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j || 0.0 > roll_interval || 0 > keep_segs || 0.0 > keep_age) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal retention.");
+	}
+	return;
+    }
+    j->roll_interval = roll_interval;
+    j->keep_segs = keep_segs;
+    j->keep_age = keep_age;
+    j->maintaining = true;
+}
+
+void
+ofix_journal_set_compress(ofixErr err, Journal j, bool on) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "NULL journal argument to journal compress.");
+	}
+	return;
+    }
+    j->compress = on;
+    if (on) {
+	j->maintaining = true;
+    }
+}
+
+void
+ofix_journal_maintain(ofixErr err, Journal j) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "NULL journal argument to journal maintain.");
+	}
+	return;
+    }
+    if (j->writing) {
+	// the writer thread takes care of it
+	return;
+    }
+    pthread_mutex_lock(&j->add_mutex);
+    maintain(j);
+    pthread_mutex_unlock(&j->add_mutex);
+}
+
+// Group commit. Only the segments written since the last sync are synced,
+// however many sessions share the journal. The records are framed with a
+// CRC so the indexes are rebuilt from them on a reopen for everything after
+// the last checkpoint.
+static void
+sync_journal(Journal j) {
+    JSeg	seg;
+
+    for (seg = j->segs + j->dirty_seg; seg < j->segs + j->seg_cnt; seg++) {
+	if (0 <= seg->fd && 0 != fdatasync(seg->fd) && OFIX_OK == j->werr.code) {
+	    set_sys_err(&j->werr, OFIX_WRITE_ERR, "sync journal", j->dir);
+	}
+    }
+    j->dirty_seg = j->seg_cnt - 1;
+}
+
+static void
+mark_durable(Journal j) {
+    int	cnt = __atomic_load_n(&j->sess_cnt, __ATOMIC_ACQUIRE);
+    int	i;
+
+    pthread_mutex_lock(&j->sync_mutex);
+    j->sindex.synced = j->sindex.written;
+    j->rindex.synced = j->rindex.written;
+    for (i = 1; i <= cnt; i++) {
+	j->sessions[i]->sindex.synced = j->sessions[i]->sindex.written;
+	j->sessions[i]->rindex.synced = j->sessions[i]->rindex.written;
+    }
+    pthread_cond_broadcast(&j->sync_cond);
+    pthread_mutex_unlock(&j->sync_mutex);
+}
+
+static void*
+writer_loop(void *arg) {
+    Journal	j = (Journal)arg;
+    double	interval = j->sync_n / 1000.0;
+    double	next_sync = dtime() + interval;
+    double	next_index = 0.0;
+    double	next_maintain = 0.0;
+    int64_t	unsynced = 0;
+
+    while (true) {
+	JSlot	slot = j->slots + (j->tail & (OFIX_JOURNAL_QUEUE_SIZE - 1));
+	bool	idle = true;
+	double	now;
+
+	if (__atomic_load_n(&slot->turn, __ATOMIC_ACQUIRE) == j->tail + 1) {
+	    struct _ofixErr	err = OFIX_ERR_INIT;
+	    JIndex		index = dir_index(j, slot->sid, slot->dir);
+
+	    idle = false;
+	    append(&err, j, slot->sid, slot->seq, slot->ts, slot->dir, slot->str, slot->len);
+	    free(slot->str);
+	    if (OFIX_OK != err.code && OFIX_OK == j->werr.code) {
+		j->werr = err;
+	    }
+	    if (NULL != index && index->written < slot->seq) {
+		index->written = slot->seq;
+	    }
+	    __atomic_store_n(&slot->turn, j->tail + OFIX_JOURNAL_QUEUE_SIZE, __ATOMIC_RELEASE);
+	    __atomic_store_n(&j->tail, j->tail + 1, __ATOMIC_RELEASE);
+	    unsynced++;
+	    switch (j->policy) {
+	    case OFIX_SYNC_COUNT:
+		if (j->sync_n <= unsynced) {
+		    sync_journal(j);
+		    mark_durable(j);
+		    unsynced = 0;
+		}
+		break;
+	    case OFIX_SYNC_INTERVAL:
+		break;
+	    case OFIX_SYNC_NONE:
+	    default:
+		// durable as far as this policy goes once the queue is drained
+		if (__atomic_load_n(&j->head, __ATOMIC_ACQUIRE) == j->tail) {
+		    mark_durable(j);
+		    unsynced = 0;
+		}
+		break;
+	    }
+	}
+	// The deadlines are checked after every record as well as when idle
+	// so a queue that never drains still gets its interval syncs, index
+	// updates, and maintenance.
+	now = dtime();
+	if (0 < unsynced &&
+	    ((OFIX_SYNC_INTERVAL == j->policy && next_sync <= now) ||
+	     (OFIX_SYNC_COUNT == j->policy && idle))) {
+	    // A partial count group is synced when the queue goes idle so a
+	    // lone message does not wait forever.
+	    sync_journal(j);
+	    mark_durable(j);
+	    unsynced = 0;
+	}
+	if (OFIX_SYNC_INTERVAL == j->policy && next_sync <= now) {
+	    next_sync = now + interval;
+	}
+	if (idle || next_index <= now) {
+	    index_catch_up(j, false);
+	    next_index = now + INDEX_PERIOD;
+	}
+	if (j->maintaining && next_maintain <= now) {
+	    maintain(j);
+	    next_maintain = now + MAINTAIN_PERIOD;
+	}
+	if (!idle) {
+	    continue;
+	}
+	if (j->done) {
+	    break;
+	}
+	dsleep(0.0001);
+    }
+    return NULL;
+}
+
+void
+ofix_journal_start_writer(ofixErr err, Journal j, ofixSyncPolicy policy, int n) {
+    int64_t	i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j || j->writing || (OFIX_SYNC_NONE != policy && 0 >= n)) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal writer start.");
+	}
+	return;
+    }
+    if (NULL == (j->slots = (JSlot)calloc(OFIX_JOURNAL_QUEUE_SIZE, sizeof(struct _JSlot)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for journal queue.");
+	}
+	return;
+    }
+    for (i = 0; i < OFIX_JOURNAL_QUEUE_SIZE; i++) {
+	j->slots[i].turn = i;
+    }
+    j->policy = policy;
+    j->sync_n = n;
+    j->head = 0;
+    j->tail = 0;
+    j->dirty_seg = j->seg_cnt - 1;
+    j->sindex.written = j->sindex.head->last_seq;
+    j->sindex.synced = j->sindex.written;
+    j->rindex.written = j->rindex.head->last_seq;
+    j->rindex.synced = j->rindex.written;
+    for (i = 1; i <= j->sess_cnt; i++) {
+	JSession	js = j->sessions[i];
+
+	js->sindex.written = js->sindex.head->last_seq;
+	js->sindex.synced = js->sindex.written;
+	js->rindex.written = js->rindex.head->last_seq;
+	js->rindex.synced = js->rindex.written;
+    }
+    j->done = false;
+    ofix_err_clear(&j->werr);
+    pthread_mutex_init(&j->sync_mutex, 0);
+    pthread_cond_init(&j->sync_cond, 0);
+    if (0 != pthread_create(&j->writer, 0, writer_loop, j)) {
+	if (NULL != err) {
+	    err->code = OFIX_THREAD_ERR;
+	    strcpy(err->msg, "Failed to start journal writer thread.");
+	}
+	free(j->slots);
+	j->slots = NULL;
+	return;
+    }
+    j->writing = true;
+}
+
+bool
+ofix_journal_wait_durable(ofixErr err, Journal j, int sid, int64_t seq, IoDir dir, double timeout) {
+    struct timespec	ts;
+    double		giveup = dtime() + timeout;
+    JIndex		index;
+    bool		durable;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    if (NULL == j || NULL == (index = dir_index(j, sid, dir))) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal wait.");
+	}
+	return false;
+    }
+    ts.tv_sec = (time_t)giveup;
+    ts.tv_nsec = (long)((giveup - (double)ts.tv_sec) * 1000000000.0);
+    if (!j->writing) {
+	// Without a writer thread the caller owns syncing.
+	durable = NULL != ofix_journal_get(err, j, sid, seq, dir, NULL);
+    } else {
+	pthread_mutex_lock(&j->sync_mutex);
+	while (index->synced < seq && OFIX_OK == j->werr.code) {
+	    if (0 != pthread_cond_timedwait(&j->sync_cond, &j->sync_mutex, &ts)) {
+		break;
+	    }
+	}
+	durable = seq <= index->synced;
+	pthread_mutex_unlock(&j->sync_mutex);
+	if (!durable && NULL != err && OFIX_OK != j->werr.code) {
+	    *err = j->werr;
+	}
+    }
+    if (durable && j->replicating && j->repl_sync) {
+	int64_t	pin = ofix_journal_pin(j);
+	JLoc	loc = index_loc(index, seq);
+	int64_t	mark = 0;
+
+	if (NULL != loc) {
+	    mark = REPL_MARK(loc->seg, loc->start - sizeof(struct _JRec) + REC_SIZE(loc->size));
+	}
+	ofix_journal_unpin(j, pin);
+
+	pthread_mutex_lock(&j->repl_mutex);
+	while (j->repl_acked < mark) {
+	    if (0 != pthread_cond_timedwait(&j->repl_cond, &j->repl_mutex, &ts)) {
+		break;
+	    }
+	}
+	durable = mark <= j->repl_acked;
+	pthread_mutex_unlock(&j->repl_mutex);
+    }
+    return durable;
+}
+
+// Waits for everything queued before the call to be written so reads see
+// earlier adds.
+static void
+drain(Journal j) {
+    int64_t	target = __atomic_load_n(&j->head, __ATOMIC_ACQUIRE);
+
+    while (__atomic_load_n(&j->tail, __ATOMIC_ACQUIRE) < target && !j->done) {
+	dsleep(0.00005);
+    }
+}
+
+const char*
+ofix_journal_get(ofixErr err, Journal j, int sid, int64_t seq, IoDir dir, int *lenp) {
+    JIndex	index;
+    JLoc	loc;
+    JZSeg	z;
+    const char	*str;
+    char	*base;
+    int64_t	pin;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (NULL == j || 0 >= seq) {
+	return NULL;
+    }
+    // Pinned while the index and segment are looked up so neither is
+    // released between the checks and the read, the caller's pin keeps the
+    // bytes after that.
+    pin = ofix_journal_pin(j);
+    if (OFIX_IODIR_NONE == dir) {
+	index = dir_index(j, sid, OFIX_IODIR_SEND);
+	if (NULL == index || NULL == (loc = index_loc(index, seq)) || 0 == loc->size) {
+	    index = dir_index(j, sid, OFIX_IODIR_RECV);
+	}
+    } else {
+	index = dir_index(j, sid, dir);
+    }
+    loc = (NULL == index) ? NULL : index_loc(index, seq);
+    if ((NULL == loc || 0 == loc->size) && j->writing &&
+	__atomic_load_n(&j->tail, __ATOMIC_ACQUIRE) < __atomic_load_n(&j->head, __ATOMIC_ACQUIRE)) {
+	ofix_journal_unpin(j, pin);
+	drain(j);
+	return ofix_journal_get(err, j, sid, seq, dir, lenp);
+    }
+    str = NULL;
+    if (NULL == loc) {
+	goto DONE;
+    }
+    if (0 == __atomic_load_n(&loc->size, __ATOMIC_ACQUIRE) ||
+	NULL == (base = __atomic_load_n(&j->segs[loc->seg].base, __ATOMIC_ACQUIRE))) {
+	goto DONE;
+    }
+    if (NULL != (z = __atomic_load_n(&j->segs[loc->seg].z, __ATOMIC_ACQUIRE))) {
+	if (NULL == (str = block_cached(j, z, loc->start)) && NULL != err) {
+	    err->code = OFIX_READ_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Corrupt journal segment %d in '%.160s'.", loc->seg, j->dir);
+	}
+    } else {
+	str = base + loc->start;
+    }
+    // A segment retired during the lookup dropped the location first.
+    if (0 == __atomic_load_n(&loc->size, __ATOMIC_ACQUIRE)) {
+	str = NULL;
+    }
+    if (NULL != str && NULL != lenp) {
+	*lenp = loc->size;
+    }
+DONE:
+    ofix_journal_unpin(j, pin);
+
+    return str;
+}
+
+void
+ofix_journal_iterate(ofixErr err, Journal j, int sid, bool (*cb)(const char *str, int len, void *ctx), void *ctx) {
+    JSeg		seg;
+    struct _Cursor	cur = { NULL, 0, NULL, 0 };
+    int64_t		pin;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (j->writing) {
+	drain(j);
+    }
+    pin = ofix_journal_pin(j);
+    for (seg = j->segs; seg < j->segs + j->seg_cnt; seg++) {
+	int64_t	pos = sizeof(struct _JSegHead);
+	char	*base = __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE);
+	int64_t	end;
+	JRec	rec;
+
+	if (NULL == base) {
+	    continue;
+	}
+	end = __atomic_load_n(&((JSegHead)base)->end, __ATOMIC_ACQUIRE);
+	while (pos < end) {
+	    rec = cursor_rec(&cur, seg, pos);
+	    if (NULL == rec && NULL == __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE)) {
+		// retired while iterating
+		break;
+	    }
+	    if (NULL == rec || 0 >= rec->len || end < pos + REC_SIZE(rec->len)) {
+		if (NULL != err) {
+		    err->code = OFIX_READ_ERR;
+		    snprintf(err->msg, sizeof(err->msg), "Corrupt journal segment %d in '%.160s'.", (int)(seg - j->segs), j->dir);
+		}
+		goto DONE;
+	    }
+	    pos += REC_SIZE(rec->len);
+	    if (REC_START == rec->dir || (0 <= sid && sid != rec->sid)) {
+		continue;
+	    }
+	    if (!cb((char*)rec + sizeof(struct _JRec), rec->len, ctx)) {
+		goto DONE;
+	    }
+	}
+    }
+DONE:
+    ofix_journal_unpin(j, pin);
+    free(cur.buf);
+}
+
+// Returns the value of the first __pat__ field, a SOH followed by the tag
+// and '=', in the message.
+static const char*
+field_value(const char *str, int len, const char *pat, int plen, int *vlenp) {
+    const char	*end = str + len;
+    const char	*s = str;
+    const char	*v;
+
+    while (NULL != (s = memchr(s, '\1', end - s)) && s + plen < end) {
+	if (0 == memcmp(s, pat, plen)) {
+	    v = s + plen;
+	    if (NULL == (s = memchr(v, '\1', end - v))) {
+		s = end;
+	    }
+	    *vlenp = (int)(s - v);
+	    return v;
+	}
+	s++;
+    }
+    return NULL;
+}
+
+static uint64_t
+key_hash(int tag, const char *value, int len) {
+    uint64_t	h = 14695981039346656037ULL ^ (uint64_t)tag;
+    const char	*end = value + len;
+
+    for (; value < end; value++) {
+	h = (h ^ (uint8_t)*value) * 1099511628211ULL;
+    }
+    return h;
+}
+
+static bool
+grow(ofixErr err, void **ap, int64_t *maxp, int64_t cnt, size_t size) {
+    if (*maxp <= cnt) {
+	int64_t	max = (0 == *maxp) ? 1024 : *maxp * 2;
+	void	*a;
+
+	if (NULL == (a = realloc(*ap, max * size))) {
+	    if (NULL != err) {
+		err->code = OFIX_MEMORY_ERR;
+		strcpy(err->msg, "Failed to allocate memory for journal index.");
+	    }
+	    return false;
+	}
+	*ap = a;
+	*maxp = max;
+    }
+    return true;
+}
+
+static void
+rehash(Journal j, int64_t cnt) {
+    int64_t	*buckets;
+    JKey	k;
+    int64_t	i;
+
+    if (NULL == (buckets = (int64_t*)malloc(cnt * sizeof(int64_t)))) {
+	return;
+    }
+    memset(buckets, 0xFF, cnt * sizeof(int64_t));
+    for (i = 0, k = j->keys; i < j->key_cnt; i++, k++) {
+	int64_t	*b = buckets + (k->hash & (cnt - 1));
+
+	k->next = *b;
+	*b = i;
+    }
+    free(j->buckets);
+    j->buckets = buckets;
+    j->bucket_cnt = cnt;
+}
+
+static void
+index_rec(Journal j, int si, int64_t pos, JRec rec) {
+    const char	*str = (char*)rec + sizeof(struct _JRec);
+    int		i;
+
+    if (0 == j->irec_cnt % OFIX_JOURNAL_TIME_STEP &&
+	grow(NULL, (void**)&j->times, &j->time_max, j->time_cnt, sizeof(struct _JTime))) {
+	JTime	t = j->times + j->time_cnt++;
+
+	t->ts = rec->ts;
+	t->seg = si;
+	t->pos = pos;
+    }
+    j->irec_cnt++;
+    for (i = 0; i < j->key_tag_cnt; i++) {
+	const char	*v;
+	int		vlen;
+	JKey		k;
+	int64_t		*b;
+
+	if (NULL == (v = field_value(str, rec->len, j->key_pats[i], (int)strlen(j->key_pats[i]), &vlen))) {
+	    continue;
+	}
+	if (!grow(NULL, (void**)&j->keys, &j->key_max, j->key_cnt, sizeof(struct _JKey))) {
+	    continue;
+	}
+	if (j->bucket_cnt <= j->key_cnt) {
+	    rehash(j, (0 == j->bucket_cnt) ? 1024 : j->bucket_cnt * 2);
+	}
+	k = j->keys + j->key_cnt;
+	k->hash = key_hash(j->key_tags[i], v, vlen);
+	k->seg = si;
+	k->pos = pos;
+	b = j->buckets + (k->hash & (j->bucket_cnt - 1));
+	k->next = *b;
+	*b = j->key_cnt++;
+    }
+}
+
+// Drops the time and key entries of retired segments. Entries are added in
+// segment order so retention mostly trims the front. The chains are rebuilt
+// over what is left so finds no longer walk entries for removed records.
+static void
+index_prune(Journal j) {
+    JTime	tend = j->times + j->time_cnt;
+    JTime	tout = j->times;
+    JTime	t;
+    JKey	kend = j->keys + j->key_cnt;
+    JKey	kout = j->keys;
+    JKey	k;
+
+    pthread_mutex_lock(&j->idx_mutex);
+    for (t = j->times; t < tend; t++) {
+	if (NULL != j->segs[t->seg].base) {
+	    *tout++ = *t;
+	}
+    }
+    j->time_cnt = tout - j->times;
+    for (k = j->keys; k < kend; k++) {
+	if (NULL != j->segs[k->seg].base) {
+	    *kout++ = *k;
+	}
+    }
+    if (kout < kend) {
+	j->key_cnt = kout - j->keys;
+	rehash(j, j->bucket_cnt);
+    }
+    pthread_mutex_unlock(&j->idx_mutex);
+}
+
+// Starts the time index of a reopened journal with an entry for the first
+// record of each segment and starts indexing records at the end so the
+// existing records are not read again. Key tags are set after an open and
+// read the existing records for themselves.
+static void
+index_seed(Journal j) {
+    struct _Cursor	cur = { NULL, 0, NULL, 0 };
+    JSeg		seg;
+    JRec		rec;
+
+    for (seg = j->segs; seg < j->segs + j->seg_cnt; seg++) {
+	if (NULL == seg->base ||
+	    NULL == (rec = cursor_rec(&cur, seg, sizeof(struct _JSegHead))) || 0 >= rec->len ||
+	    !grow(NULL, (void**)&j->times, &j->time_max, j->time_cnt, sizeof(struct _JTime))) {
+	    continue;
+	}
+	j->times[j->time_cnt].ts = rec->ts;
+	j->times[j->time_cnt].seg = (int32_t)(seg - j->segs);
+	j->times[j->time_cnt].pos = sizeof(struct _JSegHead);
+	j->time_cnt++;
+    }
+    free(cur.buf);
+    j->iseg = j->seg_cnt - 1;
+    j->ipos = ((JSegHead)j->segs[j->iseg].base)->end;
+}
+
+// Indexes the records written since the last call. The writer does not
+// wait for a query holding the lock, it catches up on a later pass.
+static void
+index_catch_up(Journal j, bool wait) {
+    struct _Cursor	cur = { NULL, 0, NULL, 0 };
+
+    if (wait) {
+	pthread_mutex_lock(&j->idx_mutex);
+    } else if (0 != pthread_mutex_trylock(&j->idx_mutex)) {
+	return;
+    }
+    while (true) {
+	// Load the count before the end so a segment before the last is
+	// known to be complete.
+	int	cnt = __atomic_load_n(&j->seg_cnt, __ATOMIC_ACQUIRE);
+	JSeg	seg = j->segs + j->iseg;
+	int64_t	end = 0;
+
+	if (NULL != seg->base) {
+	    end = __atomic_load_n(&((JSegHead)seg->base)->end, __ATOMIC_ACQUIRE);
+	}
+	if (0 == j->ipos) {
+	    j->ipos = sizeof(struct _JSegHead);
+	}
+	while (j->ipos < end) {
+	    JRec	rec = cursor_rec(&cur, seg, j->ipos);
+
+	    if (NULL == rec || 0 >= rec->len) {
+		break;
+	    }
+	    index_rec(j, j->iseg, j->ipos, rec);
+	    j->ipos += REC_SIZE(rec->len);
+	}
+	if (cnt <= j->iseg + 1) {
+	    break;
+	}
+	j->iseg++;
+	j->ipos = 0;
+    }
+    pthread_mutex_unlock(&j->idx_mutex);
+    free(cur.buf);
+}
+
+// Indexes the records before segment __si__ and offset __end__ by the key
+// pattern __ti__ alone. The keys are collected without the lock so the
+// writer keeps indexing new records, then put in front of the keys already
+// indexed since they are older.
+static void
+index_backfill(ofixErr err, Journal j, int ti, int si, int64_t end) {
+    struct _Cursor	cur = { NULL, 0, NULL, 0 };
+    const char		*pat = j->key_pats[ti];
+    int			plen = (int)strlen(pat);
+    JKey		keys = NULL;
+    int64_t		max = 0;
+    int64_t		cnt = 0;
+    int64_t		bcnt;
+    int64_t		pin = ofix_journal_pin(j);
+    JKey		k;
+    int64_t		i;
+
+    for (i = 0; i <= si; i++) {
+	JSeg	seg = j->segs + i;
+	char	*base = __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE);
+	int64_t	pos = sizeof(struct _JSegHead);
+	int64_t	send;
+	JRec	rec;
+
+	if (NULL == base) {
+	    continue;
+	}
+	send = (i == si) ? end : __atomic_load_n(&((JSegHead)base)->end, __ATOMIC_ACQUIRE);
+	for (; pos < send; pos += REC_SIZE(rec->len)) {
+	    const char	*v;
+	    int		vlen;
+
+	    if (NULL == (rec = cursor_rec(&cur, seg, pos)) || 0 >= rec->len) {
+		break;
+	    }
+	    if (NULL == (v = field_value((char*)rec + sizeof(struct _JRec), rec->len, pat, plen, &vlen))) {
+		continue;
+	    }
+	    if (!grow(err, (void**)&keys, &max, cnt, sizeof(struct _JKey))) {
+		goto DONE;
+	    }
+	    k = keys + cnt++;
+	    k->hash = key_hash(j->key_tags[ti], v, vlen);
+	    k->seg = i;
+	    k->pos = pos;
+	}
+    }
+    if (0 == cnt) {
+	goto DONE;
+    }
+    pthread_mutex_lock(&j->idx_mutex);
+    if (NULL == (k = (JKey)realloc(j->keys, (j->key_cnt + cnt) * sizeof(struct _JKey)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for journal index.");
+	}
+	pthread_mutex_unlock(&j->idx_mutex);
+	goto DONE;
+    }
+    j->keys = k;
+    j->key_max = j->key_cnt + cnt;
+    memmove(k + cnt, k, j->key_cnt * sizeof(struct _JKey));
+    // segments retired during the scan are left out
+    for (i = 0; i < cnt; i++) {
+	if (NULL != j->segs[keys[i].seg].base) {
+	    *k++ = keys[i];
+	}
+    }
+    if (k < j->keys + cnt) {
+	memmove(k, j->keys + cnt, j->key_cnt * sizeof(struct _JKey));
+    }
+    j->key_cnt += k - j->keys;
+    bcnt = (0 == j->bucket_cnt) ? 1024 : j->bucket_cnt;
+    while (bcnt <= j->key_cnt) {
+	bcnt *= 2;
+    }
+    rehash(j, bcnt);
+    pthread_mutex_unlock(&j->idx_mutex);
+DONE:
+    ofix_journal_unpin(j, pin);
+    free(cur.buf);
+    free(keys);
+}
+
+void
+ofix_journal_index_tag(ofixErr err, Journal j, int tag) {
+    int64_t	end;
+    int		si;
+    int		i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j || 0 >= tag) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal index tag.");
+	}
+	return;
+    }
+    pthread_mutex_lock(&j->idx_mutex);
+    for (i = 0; i < j->key_tag_cnt; i++) {
+	if (tag == j->key_tags[i]) {
+	    pthread_mutex_unlock(&j->idx_mutex);
+	    return;
+	}
+    }
+    if (OFIX_JOURNAL_MAX_KEYS <= j->key_tag_cnt) {
+	if (NULL != err) {
+	    err->code = OFIX_OVERFLOW_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "No more than %d tags can be indexed.", OFIX_JOURNAL_MAX_KEYS);
+	}
+	pthread_mutex_unlock(&j->idx_mutex);
+	return;
+    }
+    i = j->key_tag_cnt;
+    j->key_tags[i] = tag;
+    snprintf(j->key_pats[i], sizeof(j->key_pats[0]), "\1%d=", tag);
+    j->key_tag_cnt++;
+    // Records from the current index position on are indexed with the new
+    // tag as they are caught up, only the ones before are read for it.
+    si = j->iseg;
+    end = j->ipos;
+    pthread_mutex_unlock(&j->idx_mutex);
+    index_backfill(err, j, i, si, end);
+}
+
+int
+ofix_journal_find(ofixErr err,
+		  Journal j,
+		  int sid,
+		  int tag,
+		  const char *value,
+		  bool (*cb)(const char *str, int len, void *ctx),
+		  void *ctx) {
+    struct _JKey	*found = NULL;
+    int64_t		fmax = 0;
+    int64_t		fcnt = 0;
+    const char		*pat = NULL;
+    uint64_t		h;
+    int64_t		ki;
+    int			vlen;
+    int			i;
+    int64_t		pin;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return 0;
+    }
+    if (NULL == j || NULL == value || NULL == cb) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal find.");
+	}
+	return 0;
+    }
+    for (i = 0; i < j->key_tag_cnt; i++) {
+	if (tag == j->key_tags[i]) {
+	    pat = j->key_pats[i];
+	    break;
+	}
+    }
+    if (NULL == pat) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Tag %d is not indexed.", tag);
+	}
+	return 0;
+    }
+    pin = ofix_journal_pin(j);
+    index_catch_up(j, true);
+    vlen = (int)strlen(value);
+    h = key_hash(tag, value, vlen);
+    pthread_mutex_lock(&j->idx_mutex);
+    ki = (0 < j->bucket_cnt) ? j->buckets[h & (j->bucket_cnt - 1)] : -1;
+    for (; 0 <= ki; ki = j->keys[ki].next) {
+	JKey		k = j->keys + ki;
+	JRec		rec;
+	const char	*v;
+	int		len;
+
+	if (h != k->hash || NULL == (rec = seg_rec(j, j->segs + k->seg, k->pos))) {
+	    continue;
+	}
+	if ((0 <= sid && sid != rec->sid) ||
+	    NULL == (v = field_value((char*)rec + sizeof(struct _JRec), rec->len, pat, (int)strlen(pat), &len)) ||
+	    len != vlen || 0 != memcmp(v, value, len)) {
+	    continue;
+	}
+	if (!grow(err, (void**)&found, &fmax, fcnt, sizeof(struct _JKey))) {
+	    break;
+	}
+	found[fcnt++] = *k;
+    }
+    pthread_mutex_unlock(&j->idx_mutex);
+    // The chains are newest first. The callbacks are made without the lock
+    // since records never move and the pin keeps them mapped.
+    for (i = (int)fcnt - 1; 0 <= i; i--) {
+	JRec	rec = seg_rec(j, j->segs + found[i].seg, found[i].pos);
+
+	if (NULL != rec && !cb((char*)rec + sizeof(struct _JRec), rec->len, ctx)) {
+	    break;
+	}
+    }
+    ofix_journal_unpin(j, pin);
+    free(found);
+
+    return (int)fcnt;
+}
+
+int
+ofix_journal_time_range(ofixErr err,
+			Journal j,
+			int sid,
+			int64_t start,
+			int64_t end,
+			bool (*cb)(const char *str, int len, void *ctx),
+			void *ctx) {
+    int			si = 0;
+    int64_t		pos = sizeof(struct _JSegHead);
+    int			cnt = 0;
+    bool		more = true;
+    int64_t		lo;
+    int64_t		hi;
+    int64_t		pin;
+    struct _Cursor	cur = { NULL, 0, NULL, 0 };
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return 0;
+    }
+    if (NULL == j || NULL == cb) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal time range.");
+	}
+	return 0;
+    }
+    pin = ofix_journal_pin(j);
+    index_catch_up(j, true);
+    pthread_mutex_lock(&j->idx_mutex);
+    // last entry with a time before the start
+    for (lo = 0, hi = j->time_cnt; lo < hi;) {
+	int64_t	mid = (lo + hi) / 2;
+
+	if (j->times[mid].ts < start) {
+	    lo = mid + 1;
+	} else {
+	    hi = mid;
+	}
+    }
+    if (0 < lo) {
+	si = j->times[lo - 1].seg;
+	pos = j->times[lo - 1].pos;
+    }
+    pthread_mutex_unlock(&j->idx_mutex);
+
+    for (; more && si < __atomic_load_n(&j->seg_cnt, __ATOMIC_ACQUIRE); si++, pos = sizeof(struct _JSegHead)) {
+	JSeg	seg = j->segs + si;
+	char	*base = __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE);
+	int64_t	send;
+	JRec	rec;
+
+	if (NULL == base) {
+	    continue;
+	}
+	send = __atomic_load_n(&((JSegHead)base)->end, __ATOMIC_ACQUIRE);
+	for (; pos < send; pos += REC_SIZE(rec->len)) {
+	    rec = cursor_rec(&cur, seg, pos);
+	    if (NULL == rec && NULL == __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE)) {
+		// retired while reading
+		break;
+	    }
+	    if (NULL == rec || 0 >= rec->len || end < rec->ts) {
+		more = false;
+		break;
+	    }
+	    if (REC_START == rec->dir || rec->ts < start || (0 <= sid && sid != rec->sid)) {
+		continue;
+	    }
+	    cnt++;
+	    if (!cb((char*)rec + sizeof(struct _JRec), rec->len, ctx)) {
+		more = false;
+		break;
+	    }
+	}
+    }
+    ofix_journal_unpin(j, pin);
+    free(cur.buf);
+
+    return cnt;
+}
+
+// Writes all of __len__ bytes, returns false if the connection is lost.
+static bool
+send_all(int sock, const void *buf, size_t len) {
+    const char	*b = (const char*)buf;
+    ssize_t	cnt;
+
+    while (0 < len) {
+	if (0 >= (cnt = send(sock, b, len, MSG_NOSIGNAL))) {
+	    if (0 > cnt && EINTR == errno) {
+		continue;
+	    }
+	    return false;
+	}
+	b += cnt;
+	len -= cnt;
+    }
+    return true;
+}
+
+// Reads all of __len__ bytes, returns false if the connection is lost or
+// replication is stopped.
+static bool
+recv_all(Journal j, int sock, void *buf, size_t len) {
+    struct pollfd	pfd = { sock, POLLIN, 0 };
+    char		*b = (char*)buf;
+    ssize_t		cnt;
+
+    while (0 < len) {
+	if (j->repl_done) {
+	    return false;
+	}
+	if (0 == poll(&pfd, 1, 100)) {
+	    continue;
+	}
+	if (0 >= (cnt = recv(sock, b, len, 0))) {
+	    if (0 > cnt && EINTR == errno) {
+		continue;
+	    }
+	    return false;
+	}
+	b += cnt;
+	len -= cnt;
+    }
+    return true;
+}
+
+static int
+repl_connect(Journal j) {
+    struct sockaddr_in	sout;
+    uint32_t		addr = _ofix_net_addr(NULL, j->repl_host);
+    int			sock;
+    int			on = 1;
+
+    memset(&sout, 0, sizeof(sout));
+    sout.sin_family = AF_INET;
+    sout.sin_port = htons(j->repl_port);
+    sout.sin_addr.s_addr = htonl(addr);
+    if (0 > (sock = socket(AF_INET, SOCK_STREAM, 0))) {
+	return -1;
+    }
+    if (0 != connect(sock, (struct sockaddr*)&sout, sizeof(sout))) {
+	close(sock);
+	return -1;
+    }
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+    return sock;
+}
+
+// Reads the acks that have arrived without waiting for more.
+static bool
+primary_acks(Journal j, int sock, char *buf, int *cntp) {
+    ssize_t	cnt;
+
+    while (0 < (cnt = recv(sock, buf + *cntp, sizeof(struct _JFrame) - *cntp, MSG_DONTWAIT))) {
+	*cntp += (int)cnt;
+	if (sizeof(struct _JFrame) == *cntp) {
+	    JFrame	f = (JFrame)buf;
+
+	    *cntp = 0;
+	    if (FRAME_ACK != f->type) {
+		return false;
+	    }
+	    pthread_mutex_lock(&j->repl_mutex);
+	    j->repl_acked = REPL_MARK(f->seg, f->pos);
+	    pthread_cond_broadcast(&j->repl_cond);
+	    pthread_mutex_unlock(&j->repl_mutex);
+	}
+    }
+    return !(0 == cnt || (0 > cnt && EAGAIN != errno && EWOULDBLOCK != errno && EINTR != errno));
+}
+
+// Sends what the follower is missing and then new records as they are
+// written until the connection is lost or replication is stopped.
+static void
+primary_stream(Journal j, int sock) {
+    struct _JFrame	hello;
+    struct _Cursor	cur = { NULL, 0, NULL, 0 };
+    char		ack[sizeof(struct _JFrame)];
+    int			ack_cnt = 0;
+    char		*out;
+    size_t		out_max = 256 * 1024;
+    size_t		out_cnt = 0;
+    int			si;
+    int64_t		pos;
+    int			sess;
+    int64_t		pin = 0;
+    bool		pinned = false;
+
+    if (!recv_all(j, sock, &hello, sizeof(hello)) || FRAME_HELLO != hello.type ||
+	NULL == (out = (char*)malloc(out_max))) {
+	return;
+    }
+    si = (0 <= hello.seg) ? hello.seg : 0;
+    pos = (int64_t)sizeof(struct _JSegHead) < hello.pos ? hello.pos : (int64_t)sizeof(struct _JSegHead);
+    sess = hello.cnt;
+    while (!j->repl_done) {
+	int	cnt = __atomic_load_n(&j->sess_cnt, __ATOMIC_ACQUIRE);
+	int	seg_cnt;
+	bool	sent = false;
+
+	// sessions go before any of their records
+	for (; sess < cnt; sess++) {
+	    struct _JFrame	f = { FRAME_SESSION, 0, 0, sess + 1, 0 };
+
+	    f.len = (int32_t)strlen(j->sessions[sess + 1]->name);
+	    if (!send_all(sock, &f, sizeof(f)) || !send_all(sock, j->sessions[sess + 1]->name, f.len)) {
+		goto DONE;
+	    }
+	}
+	// Load the count before the end so a segment before the last is known
+	// to be complete. The records are only read while pinned and the
+	// cursor is reset since a compressed segment freed while unpinned may
+	// have its address reused.
+	seg_cnt = __atomic_load_n(&j->seg_cnt, __ATOMIC_ACQUIRE);
+	pin = ofix_journal_pin(j);
+	pinned = true;
+	cur.z = NULL;
+	while (si < seg_cnt) {
+	    JSeg	seg = j->segs + si;
+	    char	*base = __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE);
+	    int64_t	end = 0;
+	    JRec	rec;
+
+	    if (NULL != base) {
+		end = __atomic_load_n(&((JSegHead)base)->end, __ATOMIC_ACQUIRE);
+	    }
+	    for (; pos < end; pos += REC_SIZE(rec->len)) {
+		struct _JFrame	f = { FRAME_RECORD, 0, si, 0, pos };
+
+		if (NULL == (rec = cursor_rec(&cur, seg, pos))) {
+		    if (NULL == __atomic_load_n(&seg->base, __ATOMIC_ACQUIRE)) {
+			// retired while sending
+			break;
+		    }
+		    goto DONE;
+		}
+		if (0 >= rec->len) {
+		    goto DONE;
+		}
+		f.len = (int32_t)sizeof(struct _JRec) + rec->len;
+		if (out_max < out_cnt + sizeof(f) + f.len) {
+		    if (!send_all(sock, out, out_cnt)) {
+			goto DONE;
+		    }
+		    out_cnt = 0;
+		}
+		if (out_max < sizeof(f) + f.len) {
+		    if (!send_all(sock, &f, sizeof(f)) || !send_all(sock, rec, f.len)) {
+			goto DONE;
+		    }
+		} else {
+		    memcpy(out + out_cnt, &f, sizeof(f));
+		    memcpy(out + out_cnt + sizeof(f), rec, f.len);
+		    out_cnt += sizeof(f) + f.len;
+		}
+		sent = true;
+	    }
+	    if (seg_cnt <= si + 1) {
+		break;
+	    }
+	    si++;
+	    pos = sizeof(struct _JSegHead);
+	}
+	if (0 < out_cnt) {
+	    if (!send_all(sock, out, out_cnt)) {
+		break;
+	    }
+	    out_cnt = 0;
+	}
+	ofix_journal_unpin(j, pin);
+	pinned = false;
+	if (!primary_acks(j, sock, ack, &ack_cnt)) {
+	    break;
+	}
+	if (!sent) {
+	    dsleep(0.0001);
+	}
+    }
+DONE:
+    if (pinned) {
+	ofix_journal_unpin(j, pin);
+    }
+    free(cur.buf);
+    free(out);
+}
+
+static void*
+primary_loop(void *arg) {
+    Journal	j = (Journal)arg;
+    int		sock;
+
+    while (!j->repl_done) {
+	if (0 > (sock = repl_connect(j))) {
+	    dsleep(0.1);
+	    continue;
+	}
+	primary_stream(j, sock);
+	close(sock);
+    }
+    return NULL;
+}
+
+void
+ofix_journal_replicate(ofixErr err, Journal j, const char *host, int port, bool sync) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j || NULL == host || sizeof(j->repl_host) <= strlen(host) || 0 >= port || j->replicating) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal replicate.");
+	}
+	return;
+    }
+    strcpy(j->repl_host, host);
+    j->repl_port = port;
+    j->repl_sync = sync;
+    j->repl_done = false;
+    j->repl_acked = 0;
+    pthread_mutex_init(&j->repl_mutex, 0);
+    pthread_cond_init(&j->repl_cond, 0);
+    if (0 != pthread_create(&j->repl_thread, NULL, primary_loop, j)) {
+	if (NULL != err) {
+	    err->code = OFIX_THREAD_ERR;
+	    strcpy(err->msg, "Failed to start journal replication thread.");
+	}
+	pthread_mutex_destroy(&j->repl_mutex);
+	pthread_cond_destroy(&j->repl_cond);
+	return;
+    }
+    j->replicating = true;
+}
+
+// Writes a record from the primary at the same position it has there.
+static void
+follower_apply(ofixErr err, Journal j, int si, int64_t pos, JRec rec) {
+    JIndex	index = dir_index(j, rec->sid, (IoDir)rec->dir);
+    int64_t	rsize = REC_SIZE(rec->len);
+    JSeg	seg;
+    JSegHead	head;
+
+    if ((REC_START == rec->dir) ?
+	(0 >= rec->sid || j->sess_cnt < rec->sid) :
+	(NULL == index || 0 >= rec->seq || !index_fit(err, j, index, rec->seq))) {
+	if (NULL != err && OFIX_OK == err->code) {
+	    err->code = OFIX_READ_ERR;
+	    strcpy(err->msg, "Replicated record is not valid.");
+	}
+	return;
+    }
+    while (j->seg_cnt <= si) {
+	int64_t	size = j->seg_size;
+
+	if (size < (int64_t)sizeof(struct _JSegHead) + rsize) {
+	    size = sizeof(struct _JSegHead) + rsize;
+	}
+	seg_open(err, j, size);
+	if (NULL != err && OFIX_OK != err->code) {
+	    return;
+	}
+	checkpoint(j, j->seg_cnt - 1);
+    }
+    seg = j->segs + si;
+    head = (JSegHead)seg->base;
+    if (si != j->seg_cnt - 1 || pos != head->end || seg->size < pos + rsize) {
+	if (NULL != err) {
+	    err->code = OFIX_WRITE_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Replicated record at %d:%lld does not follow the end of '%.160s'.",
+		     si, (long long)pos, j->dir);
+	}
+	return;
+    }
+    memcpy(seg->base + pos, rec, sizeof(struct _JRec) + rec->len);
+    memset(seg->base + pos + sizeof(struct _JRec) + rec->len, 0, rsize - sizeof(struct _JRec) - rec->len);
+    if (j->last_ts < rec->ts) {
+	j->last_ts = rec->ts;
+    }
+    if (REC_START == rec->dir) {
+	session_reset(j, j->sessions[rec->sid]);
+    } else {
+	index_set(j, index, si, pos, (JRec)(seg->base + pos));
+    }
+    __atomic_store_n(&head->end, pos + rsize, __ATOMIC_RELEASE);
+}
+
+static bool
+follower_ack(Journal j, int sock) {
+    struct _JFrame	f = { FRAME_ACK, 0, 0, 0, 0 };
+
+    sync_journal(j);
+    f.seg = j->seg_cnt - 1;
+    f.pos = ((JSegHead)j->segs[f.seg].base)->end;
+    f.cnt = j->sess_cnt;
+
+    return send_all(sock, &f, sizeof(f));
+}
+
+// Applies frames from the primary until the connection is lost. Whatever
+// has arrived is synced and acknowledged before waiting for more.
+static void
+follower_stream(Journal j, int sock) {
+    struct _JFrame	f = { FRAME_HELLO, 0, 0, 0, 0 };
+    struct pollfd	pfd = { sock, POLLIN, 0 };
+    char		*buf = NULL;
+    int64_t		max = 0;
+    bool		unacked = false;
+
+    f.seg = j->seg_cnt - 1;
+    f.pos = ((JSegHead)j->segs[f.seg].base)->end;
+    f.cnt = j->sess_cnt;
+    if (!send_all(sock, &f, sizeof(f))) {
+	return;
+    }
+    while (!j->repl_done) {
+	struct _ofixErr	err = OFIX_ERR_INIT;
+
+	if (unacked && 0 == poll(&pfd, 1, 0)) {
+	    if (!follower_ack(j, sock)) {
+		break;
+	    }
+	    unacked = false;
+	}
+	// The length comes from the network so it is checked before anything
+	// is allocated. A record must fit in a segment and a session frame
+	// carries only a name.
+	if (!recv_all(j, sock, &f, sizeof(f)) || 0 > f.len ||
+	    (FRAME_SESSION == f.type && (int)sizeof(j->sessions[0]->name) <= f.len) ||
+	    j->seg_size - (int64_t)sizeof(struct _JSegHead) < (int64_t)f.len) {
+	    break;
+	}
+	if (max < (int64_t)f.len + 1) {
+	    char	*b = (char*)realloc(buf, (size_t)f.len + 1);
+
+	    if (NULL == b) {
+		break;
+	    }
+	    buf = b;
+	    max = (int64_t)f.len + 1;
+	}
+	if (!recv_all(j, sock, buf, f.len)) {
+	    break;
+	}
+	buf[f.len] = '\0';
+	switch (f.type) {
+	case FRAME_SESSION:
+	    // Only new sessions are sent. A fresh start of a session comes as
+	    // a record so it is applied in order with the session's messages.
+	    if (f.cnt == j->sess_cnt + 1) {
+		if (f.cnt != ofix_journal_session(&err, j, buf, false) && OFIX_OK == err.code) {
+		    err.code = OFIX_READ_ERR;
+		}
+	    } else if (j->sess_cnt < f.cnt) {
+		err.code = OFIX_READ_ERR;
+	    }
+	    break;
+	case FRAME_RECORD: {
+	    JRec	rec = (JRec)buf;
+
+	    if ((int)sizeof(struct _JRec) > f.len || f.len != (int)sizeof(struct _JRec) + rec->len || rec->crc != rec_crc(rec)) {
+		err.code = OFIX_READ_ERR;
+		break;
+	    }
+	    pthread_mutex_lock(&j->add_mutex);
+	    follower_apply(&err, j, f.seg, f.pos, rec);
+	    pthread_mutex_unlock(&j->add_mutex);
+	    break;
+	}
+	default:
+	    err.code = OFIX_READ_ERR;
+	    break;
+	}
+	if (OFIX_OK != err.code) {
+	    // drop the connection, the primary resumes from the last good record
+	    break;
+	}
+	unacked = true;
+    }
+    free(buf);
+}
+
+static void*
+follower_loop(void *arg) {
+    Journal		j = (Journal)arg;
+    struct pollfd	pfd = { j->repl_sock, POLLIN, 0 };
+    int			sock;
+
+    while (!j->repl_done) {
+	if (0 >= poll(&pfd, 1, 100)) {
+	    continue;
+	}
+	if (0 > (sock = accept(j->repl_sock, NULL, NULL))) {
+	    continue;
+	}
+	follower_stream(j, sock);
+	close(sock);
+    }
+    return NULL;
+}
+
+void
+ofix_journal_follow(ofixErr err, Journal j, const char *host, int port) {
+    struct sockaddr_in	addr;
+    uint32_t		ip = INADDR_LOOPBACK;
+    int			on = 1;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == j || 0 >= port || j->replicating || j->writing) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to journal follow.");
+	}
+	return;
+    }
+    if (NULL != host) {
+	ip = _ofix_net_addr(err, host);
+	if (NULL != err && OFIX_OK != err->code) {
+	    return;
+	}
+    }
+    if (0 > (j->repl_sock = socket(AF_INET, SOCK_STREAM, 0))) {
+	if (NULL != err) {
+	    err->code = OFIX_NETWORK_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to create socket. %s.", strerror(errno));
+	}
+	return;
+    }
+    setsockopt(j->repl_sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on));
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(ip);
+    addr.sin_port = htons(port);
+    if (0 != bind(j->repl_sock, (struct sockaddr*)&addr, sizeof(addr)) || 0 != listen(j->repl_sock, 1)) {
+	if (NULL != err) {
+	    err->code = OFIX_NETWORK_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to listen on port %d. %s.", port, strerror(errno));
+	}
+	close(j->repl_sock);
+	j->repl_sock = -1;
+	return;
+    }
+    j->repl_done = false;
+    pthread_mutex_init(&j->repl_mutex, 0);
+    pthread_cond_init(&j->repl_cond, 0);
+    if (0 != pthread_create(&j->repl_thread, NULL, follower_loop, j)) {
+	if (NULL != err) {
+	    err->code = OFIX_THREAD_ERR;
+	    strcpy(err->msg, "Failed to start journal follower thread.");
+	}
+	pthread_mutex_destroy(&j->repl_mutex);
+	pthread_cond_destroy(&j->repl_cond);
+	close(j->repl_sock);
+	j->repl_sock = -1;
+	return;
+    }
+    j->replicating = true;
+}
@@ -0,0 +1,171 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdint.h>
+#include <string.h>
+
+#include "lz.h"
+
+#define MIN_MATCH	4
+#define MAX_OFFSET	65535
+#define HASH_BITS	12
+
+// Each sequence is a token, literals, and then a match. The token holds the
+// literal count in the high nibble and the match length less MIN_MATCH in
+// the low nibble. A nibble of 15 is followed by bytes that are added until
+// one is less than 255. The match is a two byte little endian offset back
+// from the current position. The last sequence has literals only.
+
+static inline uint32_t
+hash4(const uint8_t *p) {
+    uint32_t	v;
+
+    memcpy(&v, p, sizeof(v));
+
+    return (v * 2654435761U) >> (32 - HASH_BITS);
+}
+
+static uint8_t*
+put_len(uint8_t *d, uint8_t *dend, int len) {
+    for (; 255 <= len; len -= 255) {
+	if (dend <= d) {
+	    return NULL;
+	}
+	*d++ = 255;
+    }
+    if (dend <= d) {
+	return NULL;
+    }
+    *d++ = (uint8_t)len;
+
+    return d;
+}
+
+static uint8_t*
+put_seq(uint8_t *d, uint8_t *dend, const uint8_t *lit, int lcnt, int offset, int mlen) {
+    uint8_t	*token = d++;
+    int		mcode = (0 < mlen) ? mlen - MIN_MATCH : 0;
+
+    if (dend <= token) {
+	return NULL;
+    }
+    *token = (uint8_t)(((15 <= lcnt) ? 15 : lcnt) << 4 | ((15 <= mcode) ? 15 : mcode));
+    if (15 <= lcnt && NULL == (d = put_len(d, dend, lcnt - 15))) {
+	return NULL;
+    }
+    if (dend < d + lcnt) {
+	return NULL;
+    }
+    memcpy(d, lit, lcnt);
+    d += lcnt;
+    if (0 < mlen) {
+	if (dend < d + 2) {
+	    return NULL;
+	}
+	*d++ = (uint8_t)(offset & 0xFF);
+	*d++ = (uint8_t)(offset >> 8);
+	if (15 <= mcode && NULL == (d = put_len(d, dend, mcode - 15))) {
+	    return NULL;
+	}
+    }
+    return d;
+}
+
+int
+ofix_lz_compress(const char *src, int len, char *dst, int cap) {
+    const uint8_t	*s = (const uint8_t*)src;
+    const uint8_t	*end = s + len;
+    const uint8_t	*limit = end - MIN_MATCH;
+    const uint8_t	*lit = s;
+    const uint8_t	*p = s;
+    uint8_t		*d = (uint8_t*)dst;
+    uint8_t		*dend = d + ((cap < len) ? cap : len - 1);
+    int32_t		table[1 << HASH_BITS];
+
+    if (0 >= len || 0 >= cap) {
+	return -1;
+    }
+    memset(table, 0xFF, sizeof(table));
+    while (p <= limit) {
+	uint32_t	h = hash4(p);
+	const uint8_t	*m = (0 <= table[h]) ? s + table[h] : NULL;
+	int		mlen;
+
+	table[h] = (int32_t)(p - s);
+	if (NULL == m || MAX_OFFSET < p - m || 0 != memcmp(m, p, MIN_MATCH)) {
+	    p++;
+	    continue;
+	}
+	for (mlen = MIN_MATCH; p + mlen < end && m[mlen] == p[mlen]; mlen++) {
+	}
+	if (NULL == (d = put_seq(d, dend, lit, (int)(p - lit), (int)(p - m), mlen))) {
+	    return -1;
+	}
+	p += mlen;
+	lit = p;
+    }
+    if (NULL == (d = put_seq(d, dend, lit, (int)(end - lit), 0, 0))) {
+	return -1;
+    }
+    return (int)(d - (uint8_t*)dst);
+}
+
+static const uint8_t*
+get_len(const uint8_t *s, const uint8_t *end, int *lenp) {
+    int	b;
+
+    do {
+	if (end <= s) {
+	    return NULL;
+	}
+	b = *s++;
+	*lenp += b;
+    } while (255 == b);
+
+    return s;
+}
+
+int
+ofix_lz_decompress(const char *src, int len, char *dst, int cap) {
+    const uint8_t	*s = (const uint8_t*)src;
+    const uint8_t	*end = s + len;
+    uint8_t		*d = (uint8_t*)dst;
+    uint8_t		*dend = d + cap;
+
+    while (s < end) {
+	int		token = *s++;
+	int		lcnt = token >> 4;
+	int		mlen = (token & 0x0F) + MIN_MATCH;
+	int		offset;
+	const uint8_t	*m;
+
+	if (15 == lcnt && NULL == (s = get_len(s, end, &lcnt))) {
+	    return -1;
+	}
+	if (end < s + lcnt || dend < d + lcnt) {
+	    return -1;
+	}
+	memcpy(d, s, lcnt);
+	s += lcnt;
+	d += lcnt;
+	if (end <= s) {
+	    break;
+	}
+	if (end < s + 2) {
+	    return -1;
+	}
+	offset = s[0] | (s[1] << 8);
+	s += 2;
+	if (15 == (token & 0x0F) && NULL == (s = get_len(s, end, &mlen))) {
+	    return -1;
+	}
+	m = d - offset;
+	if (0 == offset || m < (uint8_t*)dst || dend < d + mlen) {
+	    return -1;
+	}
+	// byte by byte since the match may overlap what is being written
+	for (; 0 < mlen; mlen--) {
+	    *d++ = *m++;
+	}
+    }
+    return (int)(d - (uint8_t*)dst);
+}
@@ -0,0 +1,31 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#ifndef __OFIX_LZ_H__
+#define __OFIX_LZ_H__
+
+/**
+ * Compresses __len__ bytes with a byte oriented LZ77 codec in the style of
+ * LZ4. Compression is greedy with a single hash probe so it is fast and
+ * still does well on FIX where tags and values repeat from message to
+ * message.
+ *
+ * @param src bytes to compress
+ * @param len number of bytes in __src__
+ * @param dst buffer for the compressed bytes
+ * @param cap size of __dst__
+ * @return compressed size or -1 if the result would not be smaller than __len__ or would not fit
+ */
+extern int	ofix_lz_compress(const char *src, int len, char *dst, int cap);
+
+/**
+ * Decompresses bytes from ofix_lz_compress().
+ *
+ * @param src compressed bytes
+ * @param len number of bytes in __src__
+ * @param dst buffer for the original bytes
+ * @param cap size of __dst__
+ * @return decompressed size or -1 if __src__ is corrupt or __dst__ is too small
+ */
+extern int	ofix_lz_decompress(const char *src, int len, char *dst, int cap);
+
+#endif /* __OFIX_LZ_H__ */
@@ -15,6 +15,7 @@
 #define MSG_CAP_INC		1024
 #define SOH			'\1'
 #define INIT_PRETTY_SIZE	4096
+#define OFIX_GROUP_DEPTH	16
 
 
 typedef struct _Field {
@@ -23,6 +24,19 @@ typedef struct _Field {
     int		vlen;
 } *Field;
 
+// A repeating group found in a message. Entry start field indexes are kept
+// in the message entries array starting at the entries offset.
+typedef struct _Group {
+    ofixGroupSpec	spec;
+    int			field;	// index of the NumInGroup field
+    int			end;	// index of the first field after the group
+    int			num;	// NumInGroup value
+    int			cnt;	// entries found
+    int			entries;
+    int			parent;	// index of the enclosing group or -1
+    int			parent_entry;
+} *Group;
+
 struct _ofixMsg {
     char		*raw;
     Field		cached_field;
@@ -36,6 +50,16 @@ struct _ofixMsg {
     Field		fields;
     bool		append_mode;
     bool		changed;
+    bool		present_valid; // false after a field is removed
+    bool		high_tags; // tags not covered by present are in the message
+    uint64_t		present[OFIX_TAG_BITS_WORDS];
+    bool		groups_valid; // false after fields are added or removed
+    Group		groups;
+    int			group_cnt;
+    int			group_alloc;
+    int			*entries;
+    int			entry_cnt;
+    int			entry_alloc;
 };
 
 extern ofixVersionSpec	ofix_get_spec(ofixErr err, int major, int minor);
@@ -46,10 +70,24 @@ static Field	append(ofixErr err, ofixMsg msg, int tag, bool appMode);
 
 static void	slide_fields(ofixMsg msg, Field f, int dif);
 static Field	get_field(ofixMsg msg, int tag);
+static bool	ensure_groups(ofixErr err, ofixMsg msg);
 
 static struct _ofixTagSpec	begin_string_spec = { 8, OFIX_String, OFIX_Header, 0, 2, "8=", "BeginString" };
 static struct _ofixTagSpec	check_sum_spec = { 10, OFIX_String, OFIX_Trailer, 0, 3, "10=", "CheckSum" };
 
+// Read and written with atomics as any thread may parse while another
+// changes the setting. A parse uses the value it saw when it started.
+static bool	parse_check_enums = false;
+
+static inline void
+mark_present(ofixMsg msg, int tag) {
+    if (0 < tag && tag < OFIX_TAG_BITS_SIZE) {
+	msg->present[tag >> 6] |= 1ULL << (tag & 0x3F);
+    } else {
+	msg->high_tags = true;
+    }
+}
+
 static inline int
 field_end(Field f) {
     return f->vpos + f->vlen;
@@ -127,7 +165,13 @@ slide(ofixErr err, ofixMsg msg, int start, int dist) {
 	return;
     }
     if (msg->raw_len < newEnd) {
-	msg->raw = (char*)realloc(msg->raw, msg->raw_len + MSG_CAP_INC);
+	int	cap = msg->raw_len + MSG_CAP_INC;
+
+	// large values can need more than one increment
+	if (cap < newEnd) {
+	    cap = newEnd + MSG_CAP_INC;
+	}
+	msg->raw = (char*)realloc(msg->raw, cap);
 	if (0 == msg->raw) {
 	    if (NULL != err) {
 		err->code = OFIX_MEMORY_ERR;
@@ -135,7 +179,7 @@ slide(ofixErr err, ofixMsg msg, int start, int dist) {
 	    }
 	    return;
 	}
-	msg->raw_len += MSG_CAP_INC;
+	msg->raw_len = cap;
     }
     if (start < msg->msg_len) {
 	memmove(msg->raw + start + dist, msg->raw + start, msg->msg_len - start);
@@ -202,6 +246,16 @@ alloc_msg(ofixErr err, int field_cnt) {
     msg->msg_len = 0;
     msg->changed = true;
     msg->append_mode = true;
+    msg->present_valid = true;
+    msg->high_tags = false;
+    memset(msg->present, 0, sizeof(msg->present));
+    msg->groups_valid = false;
+    msg->groups = NULL;
+    msg->group_cnt = 0;
+    msg->group_alloc = 0;
+    msg->entries = NULL;
+    msg->entry_cnt = 0;
+    msg->entry_alloc = 0;
     msg->check_sum_field.ref = &check_sum_spec;
     msg->check_sum_field.vpos = 0;
     msg->check_sum_field.vlen = 0;
@@ -284,6 +338,8 @@ append(ofixErr err, ofixMsg msg, int tag, bool appMode) {
     f->ref = ref;
     f->vlen = 0;
     msg->field_cnt++;
+    mark_present(msg, tag);
+    msg->groups_valid = false;
 
     return f;
 }
@@ -320,10 +376,14 @@ update(ofixErr err, ofixMsg msg) {
 	for (; vcnt < 10 && e < blen; vcnt++, e *= 10) {
 	}
 	if (f->vlen < vcnt) {
-	    slide(err, msg, f->vpos + f->vlen, vcnt - f->vlen);
-	    if ((NULL != err && OFIX_OK != err->code) || f->vlen < vcnt) {
+	    int	dif = vcnt - f->vlen;
+
+	    slide(err, msg, f->vpos + f->vlen, dif);
+	    if (NULL != err && OFIX_OK != err->code) {
 		return;
 	    }
+	    f->vlen = vcnt;
+	    slide_fields(msg, f + 1, dif);
 	}
 	b = msg->raw + field_end(f) - 1;
 	for (i = f->vlen; 0 < i; i--, blen /= 10) {
@@ -407,6 +467,7 @@ ofix_msg_create_from_spec(ofixErr err, ofixMsgSpec spec, int field_cnt) {
     }
     *msg->raw = '\0';
     msg->raw_len = MSG_CAP_INC;
+    mark_present(msg, OFIX_CheckSumTAG); // added by update()
     ofix_msg_set_str(err, msg, OFIX_BeginStringTAG, spec->version->id);
     ofix_msg_set_int(err, msg, OFIX_BodyLengthTAG, 999); // force the reserve of digits for bodylength
     ofix_msg_set_str(err, msg, OFIX_MsgTypeTAG, spec->type);
@@ -443,6 +504,129 @@ set_parse_error(ofixErr err, const char *mt, int64_t seq, int tag, ofixReason re
     va_end(ap);
 }
 
+static ofixGroupSpec
+find_group_spec(ofixMsgSpec spec, int num_tag) {
+    ofixGroupSpec	*gp;
+
+    if (NULL != spec && NULL != spec->groups) {
+	for (gp = spec->groups; NULL != *gp; gp++) {
+	    if (num_tag == (*gp)->num_tag) {
+		return *gp;
+	    }
+	}
+    }
+    return NULL;
+}
+
+static int
+field_int(ofixMsg msg, Field f) {
+    const char	*b = msg->raw + f->vpos;
+    const char	*end = b + f->vlen;
+    int		num = 0;
+
+    for (; b < end && '0' <= *b && *b <= '9'; b++) {
+	num = num * 10 + (*b - '0');
+    }
+    return num;
+}
+
+static bool
+open_group(ofixErr err, ofixMsg msg, ofixGroupSpec gs, int fi, int parent) {
+    Group	g;
+    int		num = field_int(msg, msg->fields + fi);
+
+    // Each entry has at least one field so the count can not be more than the
+    // number of fields left in the message.
+    if (msg->field_cnt - fi - 1 < num) {
+	num = msg->field_cnt - fi - 1;
+    }
+    if (msg->group_alloc <= msg->group_cnt) {
+	int	cnt = (0 == msg->group_alloc) ? 4 : msg->group_alloc * 2;
+
+	if (NULL == (g = (Group)realloc(msg->groups, sizeof(struct _Group) * cnt))) {
+	    goto MEM_ERR;
+	}
+	msg->groups = g;
+	msg->group_alloc = cnt;
+    }
+    if (msg->entry_alloc < msg->entry_cnt + num) {
+	int	cnt = msg->entry_cnt + num + 16;
+	int	*e;
+
+	if (NULL == (e = (int*)realloc(msg->entries, sizeof(int) * cnt))) {
+	    goto MEM_ERR;
+	}
+	msg->entries = e;
+	msg->entry_alloc = cnt;
+    }
+    g = msg->groups + msg->group_cnt;
+    g->spec = gs;
+    g->field = fi;
+    g->end = msg->field_cnt;
+    g->num = num;
+    g->cnt = 0;
+    g->entries = msg->entry_cnt;
+    g->parent = parent;
+    g->parent_entry = (0 <= parent) ? msg->groups[parent].cnt - 1 : 0;
+    msg->group_cnt++;
+    msg->entry_cnt += num;
+
+    return true;
+MEM_ERR:
+    if (NULL != err) {
+	err->code = OFIX_MEMORY_ERR;
+	snprintf(err->msg, sizeof(err->msg), "Failed to allocate memory for repeating groups.");
+    }
+    return false;
+}
+
+// Records the repeating groups in the message along with the start of each
+// entry so entries can be reached directly.
+static void
+index_groups(ofixErr err, ofixMsg msg) {
+    int		stack[OFIX_GROUP_DEPTH];
+    int		depth = 0;
+    Field	f;
+    int		i;
+
+    msg->group_cnt = 0;
+    msg->entry_cnt = 0;
+    for (i = 0, f = msg->fields; i < msg->field_cnt; i++, f++) {
+	int		tag = f->ref->tag;
+	ofixGroupSpec	gs;
+
+	while (0 < depth) {
+	    Group	g = msg->groups + stack[depth - 1];
+
+	    if (tag == g->spec->tags->tag) {
+		if (g->cnt < g->num) {
+		    msg->entries[g->entries + g->cnt] = i;
+		}
+		g->cnt++;
+		break;
+	    }
+	    if (0 < g->cnt && ofix_group_spec_has_tag(g->spec, tag)) {
+		break;
+	    }
+	    g->end = i;
+	    depth--;
+	}
+	if (OFIX_NumInGroup == f->ref->type &&
+	    NULL != (gs = find_group_spec(msg->spec, tag))) {
+	    if (OFIX_GROUP_DEPTH <= depth) {
+		set_parse_error(err, msg->spec->type, 0, tag, OFIX_REASON_OTHER,
+				"Repeating groups nested more than %d deep.", OFIX_GROUP_DEPTH);
+		return;
+	    }
+	    if (!open_group(err, msg, gs, i, (0 < depth) ? stack[depth - 1] : -1)) {
+		return;
+	    }
+	    stack[depth++] = msg->group_cnt - 1;
+	}
+    }
+    msg->groups_valid = true;
+}
+
 ofixMsg
 ofix_msg_parse(ofixErr err, const char *str, int len) {
     char		type[8];
@@ -458,6 +642,8 @@ ofix_msg_parse(ofixErr err, const char *str, int len) {
     int			cnt = 0;
     int64_t		seq = 0;
     bool		neg;
+    bool		groups = false;
+    bool		check_enums = __atomic_load_n(&parse_check_enums, __ATOMIC_RELAXED);
 
     if (NULL != err && OFIX_OK != err->code) {
 	return NULL;
@@ -532,6 +718,7 @@ ofix_msg_parse(ofixErr err, const char *str, int len) {
 	    ofix_msg_destroy(msg);
 	    return NULL;
 	}
+	mark_present(msg, tag);
 	f->vpos = b - str;
 	switch (f->ref->type) {
 	case OFIX_Length:
@@ -568,6 +755,8 @@ ofix_msg_parse(ofixErr err, const char *str, int len) {
 	    nextTag = 0;
 	    break;
 	case OFIX_NumInGroup:
+	    groups = true;
+	    // fall through
 	default:
 	    for (; SOH != *b; b++) {
 		if (end <= b) {
@@ -578,6 +767,13 @@ ofix_msg_parse(ofixErr err, const char *str, int len) {
 	    }
 	    f->vlen = (b - str) - f->vpos;
 	    b++;
+	    if (check_enums && NULL != f->ref->enums &&
+		!ofix_tag_spec_check_enum(f->ref, str + f->vpos, f->vlen)) {
+		set_parse_error(err, type, seq, tag, OFIX_REASON_BAD_VALUE,
+				"Value '%.*s' is not valid for tag %d.", f->vlen, str + f->vpos, tag);
+		ofix_msg_destroy(msg);
+		return NULL;
+	    }
 	    if (OFIX_BeginStringTAG == tag) {
 		const char	*vstr = str + f->vpos;
 
@@ -616,10 +812,367 @@ ofix_msg_parse(ofixErr err, const char *str, int len) {
 	f++;
     } while (b < end);
     msg->append_mode = false;
+    if (groups) {
+	index_groups(err, msg);
+	if (NULL != err && OFIX_OK != err->code) {
+	    ofix_msg_destroy(msg);
+	    return NULL;
+	}
+    } else {
+	msg->groups_valid = true;
+    }
     
     return msg;
 }
 
+static void
+set_validate_error(ofixErr err, ofixMsg msg, int tag, ofixReason reason, const char *fmt) {
+    Field	f;
+    int64_t	seq = 0;
+
+    if (NULL != (f = get_tag_field(msg, OFIX_MsgSeqNumTAG))) {
+	seq = (int64_t)strtoll(msg->raw + f->vpos, NULL, 10);
+    }
+    set_parse_error(err, (NULL == msg->spec) ? NULL : msg->spec->type, seq, tag, reason, fmt, tag);
+}
+
+// Checks the required tags and group counts of a message and, if __strict__,
+// that every tag is defined for the message type.
+static void
+validate(ofixErr err, ofixMsg msg, bool strict) {
+    ofixMsgSpec	spec;
+    uint64_t	bits;
+    int		i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    spec = msg->spec;
+    if (NULL == spec) {
+	set_parse_error(err, NULL, 0, OFIX_MsgTypeTAG, OFIX_REASON_MISSING_TAG,
+			"Required tag %d missing.", OFIX_MsgTypeTAG);
+	return;
+    }
+    if (!msg->present_valid) {
+	Field	f;
+
+	memset(msg->present, 0, sizeof(msg->present));
+	msg->high_tags = false;
+	for (i = msg->field_cnt, f = msg->fields; 0 < i; i--, f++) {
+	    mark_present(msg, f->ref->tag);
+	}
+	if (0 != msg->check_sum_field.vpos || msg->changed) {
+	    mark_present(msg, OFIX_CheckSumTAG);
+	}
+	msg->present_valid = true;
+    }
+    for (i = 0; i < OFIX_TAG_BITS_WORDS; i++) {
+	if (0 != (bits = spec->required[i] & ~msg->present[i])) {
+	    set_validate_error(err, msg, i * 64 + __builtin_ctzll(bits), OFIX_REASON_MISSING_TAG,
+			       "Required tag %d missing.");
+	    return;
+	}
+    }
+    for (i = 0; strict && i < OFIX_TAG_BITS_WORDS; i++) {
+	if (0 != (bits = msg->present[i] & ~spec->allowed[i])) {
+	    set_validate_error(err, msg, i * 64 + __builtin_ctzll(bits), OFIX_REASON_WRONG_TAG,
+			       "Tag %d not defined for this message type.");
+	    return;
+	}
+    }
+    if (strict && msg->high_tags) {
+	Field	f;
+
+	for (i = msg->field_cnt, f = msg->fields; 0 < i; i--, f++) {
+	    if (!ofix_msg_spec_tag_allowed(spec, f->ref->tag)) {
+		set_validate_error(err, msg, f->ref->tag, OFIX_REASON_WRONG_TAG,
+				   "Tag %d not defined for this message type.");
+		return;
+	    }
+	}
+    }
+    if (ensure_groups(err, msg)) {
+	Group	g;
+
+	for (i = msg->group_cnt, g = msg->groups; 0 < i; i--, g++) {
+	    if (g->cnt != field_int(msg, msg->fields + g->field)) {
+		set_validate_error(err, msg, g->spec->num_tag, OFIX_REASON_NUM_GROUP,
+				   "Incorrect NumInGroup count for repeating group %d.");
+		return;
+	    }
+	}
+    }
+}
+
+void
+ofix_msg_validate(ofixErr err, ofixMsg msg) {
+    validate(err, msg, true);
+}
+
+void
+ofix_msg_validate_required(ofixErr err, ofixMsg msg) {
+    validate(err, msg, false);
+}
+
+static bool
+ensure_groups(ofixErr err, ofixMsg msg) {
+    if (!msg->groups_valid) {
+	index_groups(err, msg);
+    }
+    return msg->groups_valid;
+}
+
+static bool
+check_cursor(ofixErr err, ofixGroupCursor cursor) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    if (0 > cursor->group || !cursor->msg->groups_valid) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Repeating group cursor is not valid.");
+	}
+	return false;
+    }
+    return true;
+}
+
+static void
+set_group_not_found(ofixErr err, int tag) {
+    if (NULL != err) {
+	err->code = OFIX_NOT_FOUND_ERR;
+	snprintf(err->msg, sizeof(err->msg), "Repeating group %d not found.", tag);
+    }
+}
+
+// Returns the field with the tag in the current entry. Fields in nested
+// groups are skipped.
+static Field
+entry_field(ofixErr err, ofixGroupCursor cursor, int tag) {
+    ofixMsg	msg = cursor->msg;
+    Group	g = msg->groups + cursor->group;
+    int		cnt = ofix_group_count(cursor);
+    int		i = msg->entries[g->entries + cursor->entry];
+    int		end = (cursor->entry + 1 < cnt) ? msg->entries[g->entries + cursor->entry + 1] : g->end;
+    Field	f;
+
+    for (f = msg->fields + i; i < end; i++, f++) {
+	if (tag == f->ref->tag) {
+	    return f;
+	}
+	if (OFIX_NumInGroup == f->ref->type) {
+	    int	gi;
+
+	    for (gi = cursor->group + 1; gi < msg->group_cnt; gi++) {
+		if (i == msg->groups[gi].field) {
+		    i = msg->groups[gi].end - 1;
+		    f = msg->fields + i;
+		    break;
+		}
+	    }
+	}
+    }
+    if (NULL != err) {
+	err->code = OFIX_NOT_FOUND_ERR;
+	snprintf(err->msg, sizeof(err->msg), "Tag %d not found in repeating group %d entry %d.",
+		 tag, g->spec->num_tag, cursor->entry);
+    }
+    return NULL;
+}
+
+void
+ofix_msg_group(ofixErr err, ofixMsg msg, int num_tag, ofixGroupCursor cursor) {
+    Group	g;
+    int		i;
+
+    cursor->msg = msg;
+    cursor->group = -1;
+    cursor->entry = 0;
+    if ((NULL != err && OFIX_OK != err->code) || !ensure_groups(err, msg)) {
+	return;
+    }
+    for (i = 0, g = msg->groups; i < msg->group_cnt; i++, g++) {
+	if (0 > g->parent && num_tag == g->spec->num_tag) {
+	    cursor->group = i;
+	    return;
+	}
+    }
+    set_group_not_found(err, num_tag);
+}
+
+void
+ofix_group_subgroup(ofixErr err, ofixGroupCursor cursor, int num_tag, ofixGroupCursor sub) {
+    ofixMsg	msg = cursor->msg;
+    Group	g;
+    int		i;
+
+    sub->msg = msg;
+    sub->group = -1;
+    sub->entry = 0;
+    if (!check_cursor(err, cursor)) {
+	return;
+    }
+    for (i = cursor->group + 1, g = msg->groups + i; i < msg->group_cnt; i++, g++) {
+	if (cursor->group == g->parent && cursor->entry == g->parent_entry && num_tag == g->spec->num_tag) {
+	    sub->group = i;
+	    return;
+	}
+    }
+    set_group_not_found(err, num_tag);
+}
+
+int
+ofix_group_count(ofixGroupCursor cursor) {
+    Group	g;
+
+    if (0 > cursor->group) {
+	return 0;
+    }
+    g = cursor->msg->groups + cursor->group;
+
+    return (g->cnt < g->num) ? g->cnt : g->num;
+}
+
+void
+ofix_group_entry(ofixErr err, ofixGroupCursor cursor, int entry) {
+    if (!check_cursor(err, cursor)) {
+	return;
+    }
+    if (0 > entry || ofix_group_count(cursor) <= entry) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Entry %d is out of range for repeating group %d.",
+		     entry, cursor->msg->groups[cursor->group].spec->num_tag);
+	}
+	return;
+    }
+    cursor->entry = entry;
+}
+
+const char*
+ofix_group_get(ofixErr err, ofixGroupCursor cursor, int tag, int *lenp) {
+    Field	f;
+
+    if (!check_cursor(err, cursor) || NULL == (f = entry_field(err, cursor, tag))) {
+	if (NULL != lenp) {
+	    *lenp = 0;
+	}
+	return NULL;
+    }
+    if (NULL != lenp) {
+	*lenp = f->vlen;
+    }
+    return cursor->msg->raw + f->vpos;
+}
+
+int64_t
+ofix_group_get_int(ofixErr err, ofixGroupCursor cursor, int tag) {
+    Field	f;
+    const char	*b;
+    const char	*end;
+    int64_t	num = 0;
+    bool	neg = false;
+
+    if (!check_cursor(err, cursor) || NULL == (f = entry_field(err, cursor, tag))) {
+	return 0;
+    }
+    b = cursor->msg->raw + f->vpos;
+    end = b + f->vlen;
+    if (b < end && '-' == *b) {
+	neg = true;
+	b++;
+    }
+    if (end <= b) {
+	goto BAD;
+    }
+    for (; b < end; b++) {
+	if (*b < '0' || '9' < *b) {
+	    goto BAD;
+	}
+	num = num * 10 + (*b - '0');
+    }
+    return neg ? -num : num;
+BAD:
+    set_parse_error(err, cursor->msg->spec->type, 0, tag, OFIX_REASON_BAD_FORMAT,
+		    "'%.*s' for tag %d (%s) can not be parsed as an integer.",
+		    f->vlen, cursor->msg->raw + f->vpos, tag, f->ref->name);
+    return 0;
+}
+
+char
+ofix_group_get_char(ofixErr err, ofixGroupCursor cursor, int tag) {
+    Field	f;
+
+    if (!check_cursor(err, cursor) || NULL == (f = entry_field(err, cursor, tag))) {
+	return '\0';
+    }
+    return *(cursor->msg->raw + f->vpos);
+}
+
+void
+ofix_msg_set_parse_check_enums(bool check) {
+    __atomic_store_n(&parse_check_enums, check, __ATOMIC_RELAXED);
+}
+
+bool
+ofix_msg_check_enum(ofixErr err, ofixMsg msg, int tag) {
+    Field	f = get_tag_field_or_error(err, msg, tag);
+
+    if (NULL == f) {
+	if (NULL != err && OFIX_OK == err->code) {
+	    err->code = OFIX_NOT_FOUND_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Tag %d not found.", tag);
+	}
+	return false;
+    }
+    if (!ofix_tag_spec_check_enum(f->ref, msg->raw + f->vpos, f->vlen)) {
+	set_validate_error(err, msg, tag, OFIX_REASON_BAD_VALUE, "Value of tag %d is not valid.");
+	return false;
+    }
+    return true;
+}
+
+ofixMsg
+ofix_msg_dup(ofixErr err, ofixMsg msg) {
+    ofixMsg	dup;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (NULL == (dup = (ofixMsg)malloc(sizeof(struct _ofixMsg)))) {
+	goto NOMEM;
+    }
+    *dup = *msg;
+    dup->cached_field = NULL;
+    // groups are found again when next needed
+    dup->groups_valid = false;
+    dup->groups = NULL;
+    dup->group_cnt = 0;
+    dup->group_alloc = 0;
+    dup->entries = NULL;
+    dup->entry_cnt = 0;
+    dup->entry_alloc = 0;
+    dup->fields = (Field)malloc(sizeof(struct _Field) * msg->alloc_field_cnt);
+    dup->raw = (char*)malloc(msg->raw_len + 1);
+    if (NULL == dup->fields || NULL == dup->raw) {
+	free(dup->fields);
+	free(dup->raw);
+	free(dup);
+	goto NOMEM;
+    }
+    memcpy(dup->fields, msg->fields, sizeof(struct _Field) * msg->alloc_field_cnt);
+    memcpy(dup->raw, msg->raw, msg->raw_len);
+    dup->raw[msg->raw_len] = '\0';
+
+    return dup;
+NOMEM:
+    if (NULL != err) {
+	err->code = OFIX_MEMORY_ERR;
+	snprintf(err->msg, sizeof(err->msg), "Failed to allocate memory for an ofixMsg.");
+    }
+    return NULL;
+}
+
 void
 ofix_msg_destroy(ofixMsg msg) {
     if (0 != msg->fields) {
@@ -628,6 +1181,8 @@ ofix_msg_destroy(ofixMsg msg) {
     if (0 != msg->raw) {
 	free(msg->raw);
     }
+    free(msg->groups);
+    free(msg->entries);
     free(msg);
 }
 
@@ -1887,6 +2442,9 @@ ofix_msg_remove(ofixErr err, ofixMsg msg, int tag) {
     memmove(f, f + 1, sizeof(struct _Field) * (msg->field_cnt - (f - msg->fields) - 1));
     msg->field_cnt--;
     msg->changed = true;
+    // The tag may still be present in a group so just rebuild on validate.
+    msg->present_valid = false;
+    msg->groups_valid = false;
 }
 
 int
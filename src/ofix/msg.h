@@ -35,6 +35,21 @@ typedef struct _ofixMsgIterator {
     void	*context;
 } *ofixMsgIterator;
 
+/**
+ * The ofixGroupCursor is used to read the entries of a repeating group in a
+ * parsed ofixMsg. Values are read directly from the message without
+ * copying. A cursor is no longer valid once fields are added to or removed
+ * from the message. The members of the structure should not be modified
+ * directly. The only reason they are visible is to allow the structure to be
+ * allocated on the stack by declaring a variable of type struct
+ * _ofixGroupCursor.
+ */
+typedef struct _ofixGroupCursor {
+    ofixMsg	msg;
+    int		group;
+    int		entry;
+} *ofixGroupCursor;
+
 /**
  * Creates a new message of the specified type and version. The field_cnt is
  * used as a hint to preallocate space for fields in the message.
@@ -69,6 +84,59 @@ extern ofixMsg	ofix_msg_create_from_spec(ofixErr err, ofixMsgSpec spec, int fiel
  */
 extern ofixMsg	ofix_msg_parse(ofixErr err, const char *str, int len);
 
+/**
+ * Validates a message against its message specification. All required top
+ * level tags must be present and all tags must be defined for the message
+ * type. Repeating groups must have as many entries as their NumInGroup
+ * count. On failure the err reason is set to __OFIX_REASON_MISSING_TAG__,
+ * __OFIX_REASON_WRONG_TAG__, or __OFIX_REASON_NUM_GROUP__ and the err tag to
+ * the offending tag. Required tags in repeating groups are not checked.
+ *
+ * @param err pointer to error struct or NULL
+ * @param msg the message to validate
+ */
+extern void	ofix_msg_validate(ofixErr err, ofixMsg msg);
+
+/**
+ * Validates a message the same as ofix_msg_validate() except that tags not
+ * defined for the message type, such as user defined tags, are let through.
+ *
+ * @param err pointer to error struct or NULL
+ * @param msg the message to validate
+ */
+extern void	ofix_msg_validate_required(ofixErr err, ofixMsg msg);
+
+/**
+ * Turns enumerated value checking during parsing on or off for all
+ * messages. When on, ofix_msg_parse() fails with a __OFIX_REASON_BAD_VALUE__
+ * reason if a field value is not one of the enumerated values for the tag. It
+ * is off by default.
+ *
+ * @param check true to check enumerated values while parsing
+ */
+extern void	ofix_msg_set_parse_check_enums(bool check);
+
+/**
+ * Returns true if the value of the specified tag is one of the enumerated
+ * values for the tag or if the tag does not have enumerated values. If the
+ * value is not valid the err reason is set to __OFIX_REASON_BAD_VALUE__.
+ *
+ * @param err pointer to error struct or NULL
+ * @param msg the ofixMsg to operate on
+ * @param tag tag to check the value of
+ */
+extern bool	ofix_msg_check_enum(ofixErr err, ofixMsg msg, int tag);
+
+/**
+ * Creates a copy of a message that can be modified and destroyed
+ * independently of the original.
+ *
+ * @param err pointer to error struct or NULL
+ * @param msg the message to copy
+ * @return Returns a new message or NULL on error.
+ */
+extern ofixMsg	ofix_msg_dup(ofixErr err, ofixMsg msg);
+
 /**
  * Destroy a message and free up any memory it was using.
  *
@@ -310,7 +378,75 @@ extern void	ofix_msg_get_yyyymm(ofixErr err, ofixMsg msg, int tag, ofixDate valu
 extern void	ofix_msg_get_yyyymmww(ofixErr err, ofixMsg msg, int tag, ofixDate value);
 
 // TBD multi char and multi string
-// TBD repeating group
+/**
+ * Sets up a cursor on the top level repeating group identified by the
+ * NumInGroup tag. The cursor starts on the first entry. If the group is not
+ * in the message the err.code is set to __OFIX_NOT_FOUND_ERR__.
+ *
+ * @param err pointer to error struct or NULL
+ * @param msg the ofixMsg to operate on
+ * @param num_tag the NumInGroup tag of the group
+ * @param cursor the cursor to set up
+ */
+extern void	ofix_msg_group(ofixErr err, ofixMsg msg, int num_tag, ofixGroupCursor cursor);
+
+/**
+ * Sets up a cursor on a repeating group nested in the current entry of
+ * another cursor.
+ *
+ * @param err pointer to error struct or NULL
+ * @param cursor the cursor on the enclosing group
+ * @param num_tag the NumInGroup tag of the nested group
+ * @param sub the cursor to set up
+ */
+extern void	ofix_group_subgroup(ofixErr err, ofixGroupCursor cursor, int num_tag, ofixGroupCursor sub);
+
+/**
+ * Returns the number of entries in the repeating group.
+ *
+ * @param cursor the cursor on the group
+ */
+extern int	ofix_group_count(ofixGroupCursor cursor);
+
+/**
+ * Moves the cursor to an entry. The entry start positions are recorded when
+ * the message is parsed so any entry can be reached directly.
+ *
+ * @param err pointer to error struct or NULL
+ * @param cursor the cursor on the group
+ * @param entry the index of the entry, starting at 0
+ */
+extern void	ofix_group_entry(ofixErr err, ofixGroupCursor cursor, int entry);
+
+/**
+ * Returns a pointer to the value of a field in the current entry and sets
+ * lenp to the length of the value. The value points into the message and is
+ * not NULL terminated.
+ *
+ * @param err pointer to error struct or NULL
+ * @param cursor the cursor on the group
+ * @param tag the tag that identifies the field
+ * @param lenp pointer to the length to set or NULL
+ */
+extern const char*	ofix_group_get(ofixErr err, ofixGroupCursor cursor, int tag, int *lenp);
+
+/**
+ * Attempts to read an integer value from a field in the current entry.
+ *
+ * @param err pointer to error struct or NULL
+ * @param cursor the cursor on the group
+ * @param tag the tag that identifies the field
+ */
+extern int64_t	ofix_group_get_int(ofixErr err, ofixGroupCursor cursor, int tag);
+
+/**
+ * Attempts to read a character value from a field in the current entry.
+ *
+ * @param err pointer to error struct or NULL
+ * @param cursor the cursor on the group
+ * @param tag the tag that identifies the field
+ */
+extern char	ofix_group_get_char(ofixErr err, ofixGroupCursor cursor, int tag);
 
 /**
  * Attempts to set an integer value on the field identified by a tag.
@@ -1,5 +1,7 @@
 // Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
 
+#include <stdlib.h>
+
 #include "msgspec.h"
 
 int
@@ -18,3 +20,40 @@ ofix_msg_spec_tag_seq(ofixMsgSpec spec, int tag) {
     }
     return 0;
 }
+
+bool
+ofix_msg_spec_tag_allowed(ofixMsgSpec spec, int tag) {
+    if (0 < tag && tag < OFIX_TAG_BITS_SIZE) {
+	return 0 != (spec->allowed[tag >> 6] & (1ULL << (tag & 0x3F)));
+    } else if (0 != ofix_msg_spec_tag_seq(spec, tag)) {
+	return true;
+    } else if (NULL != spec->groups) {
+	ofixGroupSpec	*gp;
+	ofixTagReq	tr;
+
+	for (gp = spec->groups; NULL != *gp; gp++) {
+	    for (tr = (*gp)->tags; 0 != tr->tag; tr++) {
+		if (tag == tr->tag) {
+		    return true;
+		}
+	    }
+	}
+    }
+    return false;
+}
+
+bool
+ofix_group_spec_has_tag(ofixGroupSpec spec, int tag) {
+    if (0 < tag && tag < OFIX_TAG_BITS_SIZE) {
+	return 0 != (spec->members[tag >> 6] & (1ULL << (tag & 0x3F)));
+    } else {
+	ofixTagReq	tr;
+
+	for (tr = spec->tags; 0 != tr->tag; tr++) {
+	    if (tag == tr->tag) {
+		return true;
+	    }
+	}
+    }
+    return false;
+}
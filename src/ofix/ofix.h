@@ -11,7 +11,9 @@
 #include "msg.h"
 #include "tag.h"
 #include "engine.h"
+#include "framer.h"
 #include "session.h"
 #include "versionspec.h"
+#include "typed.h"
 
 #endif /* __OFIX_H__ */
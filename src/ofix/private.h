@@ -5,12 +5,65 @@
 
 #include <pthread.h>
 #include <stdint.h>
+#include <sys/uio.h>
 
 #include "err.h"
+#include "framer.h"
 #include "store.h"
 #include "session.h"
 
 #define LOGOUT_TIMEOUT	2.0
+// initial size of framer buffers
+#define RBUF_SIZE	(64 * 1024)
+
+// A read buffer mapped twice back to back so the data and the free space
+// after it are always contiguous, even across the end of the buffer. Bytes
+// are never moved as messages are consumed. rd and wr count all the bytes
+// consumed and added.
+typedef struct _RBuf {
+    char		*base;
+    size_t		size;	// power of 2 multiple of the page size
+    uint64_t		rd;
+    uint64_t		wr;
+} *RBuf;
+
+extern bool	_ofix_rbuf_init(ofixErr err, RBuf rb, size_t size);
+extern void	_ofix_rbuf_cleanup(RBuf rb);
+// Grows the buffer so it can hold need bytes, keeping the data.
+extern bool	_ofix_rbuf_reserve(ofixErr err, RBuf rb, size_t need);
+
+static inline char*
+_ofix_rbuf_data(RBuf rb) {
+    return rb->base + (rb->rd & (rb->size - 1));
+}
+
+static inline size_t
+_ofix_rbuf_len(RBuf rb) {
+    return (size_t)(rb->wr - rb->rd);
+}
+
+// free space after the data, add what is written there to wr
+static inline char*
+_ofix_rbuf_space(RBuf rb, size_t *lenp) {
+    *lenp = rb->size - _ofix_rbuf_len(rb);
+    return rb->base + (rb->wr & (rb->size - 1));
+}
+
+// A message waiting to be written, the bytes are owned by the queue.
+typedef struct _SendBuf {
+    char		*str;
+    int			len;
+} *SendBuf;
+
+// Sends from threads other than the one reading a session go through a ring
+// of this many slots. The slot turn tells producers and the reader whose
+// turn it is to use the slot.
+#define SUBMIT_RING_SIZE	4096
+
+typedef struct _Submit {
+    volatile int64_t	turn;
+    ofixMsg		msg;
+} *Submit;
 
 struct _ofixSession {
     struct _ofixEngine	*eng; // set to NULL if a client
@@ -22,7 +75,17 @@ struct _ofixSession {
     int64_t		recv_seq; // last recieved sequence number
     char		store_dir[1024];
     Store		store;
+    bool		resume; // open a journal store per target and resume sequence numbers
+    Journal		journal; // engine journal shared by all sessions or NULL
     int			sock;
+    // read state kept between reads so a reactor loop can drive the session
+    ofixFramer		framer;
+    struct _ofixSession	*rnext; // next session on the same reactor loop
+    bool		rarmed; // an io_uring receive is in flight
+    bool		warmed; // the reactor waits for the socket to be writable
+    bool		sarmed; // an io_uring send is in flight
+    int			cancels; // io_uring cancels in flight for the session
+    struct _RingSend	*rsend; // iovecs of the io_uring send, owned by the reactor
     ofixRecvCallback	recv_cb;
     void		*recv_ctx;
     int			heartbeat_interval;
@@ -37,6 +100,32 @@ struct _ofixSession {
     double		logout_sent;
     pthread_t		thread;
     pthread_mutex_t	send_mutex;
+    // outbound queue guarded by send_mutex
+    SendBuf		sendq;
+    int			sendq_head;
+    int			sendq_cnt;
+    int			sendq_cap;
+    int			sendq_off; // bytes of the head entry already written
+    size_t		sendq_bytes;
+    bool		flushing; // a thread or an io_uring send is writing the queue
+    bool		ring_send; // the reactor writes the queue through io_uring
+    volatile bool	send_blocked; // the socket buffer is full, the reader writes the rest
+    int			send_delay; // microseconds sends are held to be coalesced
+    ofixValidate	validate; // checks made on inbound messages
+    double		flush_at; // when held sends must be written, 0.0 if none are held
+    int			wakefd; // eventfd that wakes the thread reading the session or -1
+    int			evfd; // eventfd of the session thread, kept until the session is freed
+    pthread_t		reader; // thread reading the session when wakefd is set
+    // Messages submitted to the reader. Producers claim slots by advancing
+    // submit_tail. Only the reader, or a sender when there is no reader, takes
+    // them off with send_mutex held and assigns sequence numbers.
+    Submit		submits;
+    volatile int64_t	submit_tail;
+    int64_t		submit_head;
+    volatile bool	submit_wake; // the reader has been woken for submits
+    bool		busy_poll; // spin on the socket instead of select()
+    int			busy_cpu; // CPU the spinning thread is pinned to or -1
+    bool		spinning; // the reader is spinning and needs no wake
     ofixLogOn		log_on;
     ofixLog		log;
     void		*log_ctx;
@@ -54,6 +143,41 @@ extern void	_ofix_session_init(ofixErr err,
 extern void	_ofix_session_free(ofixSession session);
 extern void	_ofix_session_start(ofixErr err, ofixSession session, bool wait);
 
+// Used by the reactor to drive a session without a thread of its own. Reads
+// and processes what is available on the socket and returns false if the
+// session should be closed.
+extern void	_ofix_session_open(ofixSession session);
+extern bool	_ofix_session_read(ofixSession session);
+// same as _ofix_session_read() but with bytes already read by the caller
+extern bool	_ofix_session_feed(ofixSession session, const char *buf, int len);
+// sends submitted messages, checks heartbeats, the logout timeout, and held
+// sends
+extern void	_ofix_session_tick(ofixSession session);
+// the next time _ofix_session_tick() has something to do
+extern double	_ofix_session_deadline(ofixSession session);
+// Writes what is queued once the socket is writable again. Returns true if
+// the socket buffer filled up again and the caller should keep waiting.
+extern bool	_ofix_session_writable(ofixSession session);
+// Fills iov with what is queued for an io_uring send and returns the count,
+// 0 if nothing is ready. more is set if not all of the queue fit. The queue
+// is marked as being written until _ofix_session_sent() is called.
+extern int	_ofix_session_queued(ofixSession session, struct iovec *iov, int max, bool *more);
+// Releases what an io_uring send wrote, res being the byte count or a
+// negative errno. Returns true if the socket buffer is full and the caller
+// should wait for it to be writable.
+extern bool	_ofix_session_sent(ofixSession session, int res);
+extern void	_ofix_session_close(ofixSession session);
+
+typedef struct _Reactor	*Reactor;
+
+// If uring is true each loop tries io_uring and falls back to epoll when the
+// kernel does not support it.
+extern Reactor	_ofix_reactor_create(ofixErr err, int threads, bool uring);
+// number of loops using io_uring
+extern int	_ofix_reactor_uring_cnt(Reactor r);
+extern void	_ofix_reactor_add(ofixErr err, Reactor r, ofixSession session);
+extern void	_ofix_reactor_destroy(Reactor r);
+
 extern uint32_t	_ofix_net_addr(ofixErr err, const char *host);
 extern void	_ofix_session_raw_send(ofixErr err, ofixSession session, ofixMsg msg);
 
@@ -0,0 +1,97 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#define _GNU_SOURCE
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include "private.h"
+
+// Maps a memory file twice, back to back, so the bytes at base + size are the
+// same as those at base.
+static bool
+map_ring(ofixErr err, RBuf rb, size_t size) {
+    char	*base = MAP_FAILED;
+    int		fd;
+
+    if (0 <= (fd = memfd_create("ofix-rbuf", MFD_CLOEXEC)) &&
+	0 == ftruncate(fd, (off_t)size) &&
+	MAP_FAILED != (base = mmap(NULL, size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0)) &&
+	MAP_FAILED != mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) &&
+	MAP_FAILED != mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0)) {
+	close(fd);
+	rb->base = base;
+	rb->size = size;
+
+	return true;
+    }
+    if (NULL != err) {
+	err->code = OFIX_MEMORY_ERR;
+	snprintf(err->msg, sizeof(err->msg), "Failed to map a %lu byte read buffer. %s",
+		 (unsigned long)size, strerror(errno));
+    }
+    if (MAP_FAILED != base) {
+	munmap(base, size * 2);
+    }
+    if (0 <= fd) {
+	close(fd);
+    }
+    return false;
+}
+
+bool
+_ofix_rbuf_init(ofixErr err, RBuf rb, size_t size) {
+    size_t	page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t	s = page;
+
+    rb->base = NULL;
+    rb->size = 0;
+    rb->rd = 0;
+    rb->wr = 0;
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    while (s < size) {
+	s *= 2;
+    }
+    return map_ring(err, rb, s);
+}
+
+void
+_ofix_rbuf_cleanup(RBuf rb) {
+    if (NULL != rb->base) {
+	munmap(rb->base, rb->size * 2);
+	rb->base = NULL;
+    }
+}
+
+bool
+_ofix_rbuf_reserve(ofixErr err, RBuf rb, size_t need) {
+    struct _RBuf	nb;
+    size_t		size = rb->size;
+    size_t		len = _ofix_rbuf_len(rb);
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    if (need <= size) {
+	return true;
+    }
+    while (size < need) {
+	size *= 2;
+    }
+    if (!map_ring(err, &nb, size)) {
+	return false;
+    }
+    // the only copy, made once per doubling
+    memcpy(nb.base, _ofix_rbuf_data(rb), len);
+    munmap(rb->base, rb->size * 2);
+    rb->base = nb.base;
+    rb->size = nb.size;
+    rb->rd = 0;
+    rb->wr = len;
+
+    return true;
+}
@@ -0,0 +1,896 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/epoll.h>
+#include <sys/eventfd.h>
+#include <sys/mman.h>
+#include <sys/socket.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <linux/io_uring.h>
+
+#include "dtime.h"
+#include "private.h"
+
+#define MAX_EVENTS	64
+// Longest wait in epoll_wait(). Sessions closed by other threads are noticed
+// within this time.
+#define MAX_WAIT	0.1
+
+// io_uring is used directly through the system calls. Multishot receives
+// need the provided buffer rings of Linux 5.19 or later, older kernels and
+// headers fall back to epoll.
+#if defined(IORING_RECV_MULTISHOT) && defined(__NR_io_uring_setup)
+#define HAVE_URING	1
+#endif
+
+#define RING_ENTRIES	256
+#define BUF_CNT		64	// power of 2
+#define BUF_SIZE	4096
+#define BUF_GROUP	0
+// most queued messages written with one send
+#define SEND_IOV	64
+// longest wait for the operations on sessions to end when the reactor stops
+#define CLOSE_WAIT	1.0
+// user_data of the wake poll. Session operations use the session address,
+// which is at least 8 byte aligned, with the low bits telling what the
+// operation is: none for a receive, WRITE_TAG for a send, SEND_TAG for a
+// poll on the socket being writable, and CANCEL_TAG for a cancel of any of
+// them.
+#define WAKE_DATA	0
+#define WRITE_TAG	1
+#define SEND_TAG	2
+#define CANCEL_TAG	4
+#define OP_TAGS		(WRITE_TAG | SEND_TAG | CANCEL_TAG)
+
+// The message and iovecs of a session's send on the ring. They point at the
+// queued buffers, which are not released until the send completes.
+typedef struct _RingSend {
+    struct msghdr	mh;
+    struct iovec	iov[SEND_IOV];
+} *RingSend;
+
+typedef struct _Ring {
+    int			fd;
+    void		*map;
+    size_t		map_size;
+#ifdef HAVE_URING
+    struct io_uring_sqe	*sqes;
+    size_t		sqes_size;
+    unsigned		*sq_head;
+    unsigned		*sq_tail;
+    unsigned		*sq_array;
+    unsigned		sq_mask;
+    unsigned		sq_entries;
+    unsigned		tail;		// local submission tail
+    int			pending;	// prepared but not submitted
+    bool		starved;	// an entry was not available, retry soon
+    bool		wake_armed;
+    unsigned		*cq_head;
+    unsigned		*cq_tail;
+    unsigned		cq_mask;
+    struct io_uring_cqe	*cqes;
+    // provided receive buffers
+    struct io_uring_buf_ring	*br;
+    size_t		br_size;
+    unsigned short	br_tail;
+    char		*bufs;
+#endif
+    bool		multishot;
+} *Ring;
+
+// Each session belongs to one loop so all of its reads, callbacks, and
+// timers are on the same thread and in the same order as with a thread per
+// session.
+typedef struct _Loop {
+    struct _Reactor	*reactor;
+    pthread_t		thread;
+    bool		started;
+    int			epfd;
+    int			wakefd;
+    Ring		ring;		// NULL when the loop uses epoll
+    ofixSession		sessions;	// only touched by the loop thread
+    ofixSession		adds;		// guarded by mutex
+    pthread_mutex_t	mutex;
+    volatile int	cnt;
+    double		next_tick;
+} *Loop;
+
+struct _Reactor {
+    struct _Loop	*loops;
+    int			loop_cnt;
+    volatile bool	done;
+};
+
+static void	arm_recv(Ring ring, ofixSession s);
+static void	arm_send(Ring ring, ofixSession s);
+static void	arm_write(Ring ring, ofixSession s);
+static void	cancel_recv(Ring ring, ofixSession s);
+
+static void
+wake(Loop loop) {
+    uint64_t	one = 1;
+
+    if (sizeof(one) != write(loop->wakefd, &one, sizeof(one))) {
+	// already signaled if the counter is full
+    }
+}
+
+static void
+take_adds(Loop loop) {
+    struct epoll_event	ev;
+    ofixSession		s;
+    ofixSession		next;
+    uint64_t		v;
+
+    if (sizeof(v) != read(loop->wakefd, &v, sizeof(v))) {
+	// nothing pending
+    }
+    pthread_mutex_lock(&loop->mutex);
+    s = loop->adds;
+    loop->adds = NULL;
+    pthread_mutex_unlock(&loop->mutex);
+
+    for (; NULL != s; s = next) {
+	next = s->rnext;
+	s->rarmed = false;
+	s->warmed = false;
+	s->sarmed = false;
+	s->cancels = 0;
+	// Writes never block the loop. A full socket buffer leaves the rest
+	// queued until the socket is writable again.
+	fcntl(s->sock, F_SETFL, fcntl(s->sock, F_GETFL, 0) | O_NONBLOCK);
+	// sends submitted by other threads or held for coalescing are written
+	// by tick()
+	pthread_mutex_lock(&s->send_mutex);
+	s->reader = pthread_self();
+	__atomic_store_n(&s->wakefd, loop->wakefd, __ATOMIC_SEQ_CST);
+	// the queue is written with sends on the ring instead of sendmsg()
+	s->ring_send = (NULL != loop->ring);
+	pthread_mutex_unlock(&s->send_mutex);
+	if (NULL != loop->ring) {
+	    arm_recv(loop->ring, s);
+	    s->rnext = loop->sessions;
+	    loop->sessions = s;
+	    continue;
+	}
+	memset(&ev, 0, sizeof(ev));
+	ev.events = EPOLLIN | EPOLLRDHUP;
+	ev.data.ptr = s;
+	if (0 != epoll_ctl(loop->epfd, EPOLL_CTL_ADD, s->sock, &ev)) {
+	    s->log(s->log_ctx, OFIX_WARN, "Failed to watch session socket %d. %s", s->sock, strerror(errno));
+	    s->done = true;
+	}
+	s->rnext = loop->sessions;
+	loop->sessions = s;
+    }
+    // new sessions may have timers due sooner
+    loop->next_tick = 0.0;
+}
+
+// Starts or stops waiting for the socket to be writable so queued sends
+// that did not fit in the socket buffer are written.
+static void
+watch_send(Loop loop, ofixSession s, bool on) {
+    struct epoll_event	ev;
+
+    if (NULL != loop->ring) {
+	if (on) {
+	    arm_send(loop->ring, s);
+	}
+	return;
+    }
+    memset(&ev, 0, sizeof(ev));
+    ev.events = EPOLLIN | EPOLLRDHUP | (on ? EPOLLOUT : 0);
+    ev.data.ptr = s;
+    if (0 == epoll_ctl(loop->epfd, EPOLL_CTL_MOD, s->sock, &ev)) {
+	s->warmed = on;
+    }
+}
+
+// Ticks the session timers, closes sessions that are done, and sets the next
+// time a tick is needed.
+static void
+tick(Loop loop, double now) {
+    ofixSession	s;
+    ofixSession	prev = NULL;
+    ofixSession	next;
+    double	due = now + MAX_WAIT;
+    double	d;
+
+    for (s = loop->sessions; NULL != s; s = next) {
+	next = s->rnext;
+	if (!s->done) {
+	    _ofix_session_tick(s);
+	    if (s->send_blocked && !s->warmed) {
+		watch_send(loop, s, true);
+	    }
+	    // a receive that could not be submitted earlier
+	    if (NULL != loop->ring && !s->rarmed && !s->done) {
+		arm_recv(loop->ring, s);
+	    }
+	    // submitted and held sends queued by the tick
+	    if (NULL != loop->ring && !s->done) {
+		arm_write(loop->ring, s);
+	    }
+	}
+	if (s->done && NULL != loop->ring && (s->rarmed || s->warmed || s->sarmed || 0 < s->cancels)) {
+	    // The receive, send, and send poll must end before the session can
+	    // be closed. Cancels are only submitted again once earlier ones
+	    // have completed.
+	    if (0 == s->cancels) {
+		cancel_recv(loop->ring, s);
+	    }
+	    prev = s;
+	    continue;
+	}
+	if (s->done) {
+	    if (NULL == prev) {
+		loop->sessions = next;
+	    } else {
+		prev->rnext = next;
+	    }
+	    if (NULL == loop->ring) {
+		epoll_ctl(loop->epfd, EPOLL_CTL_DEL, s->sock, NULL);
+	    }
+	    __atomic_sub_fetch(&loop->cnt, 1, __ATOMIC_RELAXED);
+	    free(s->rsend);
+	    s->rsend = NULL;
+	    // the session may be freed as soon as it is marked closed
+	    _ofix_session_close(s);
+	    continue;
+	}
+	if ((d = _ofix_session_deadline(s)) < due) {
+	    due = d;
+	}
+	prev = s;
+    }
+    loop->next_tick = due;
+}
+
+static void
+epoll_run(Loop loop) {
+    struct epoll_event	events[MAX_EVENTS];
+    struct epoll_event	*ev;
+    ofixSession		s;
+    double		now;
+    int			timeout;
+    int			cnt;
+
+    while (!loop->reactor->done) {
+	if (loop->next_tick <= (now = dtime())) {
+	    tick(loop, now);
+	}
+	timeout = (int)((loop->next_tick - now) * 1000.0) + 1;
+	if (timeout > (int)(MAX_WAIT * 1000.0)) {
+	    timeout = (int)(MAX_WAIT * 1000.0);
+	}
+	if (0 > (cnt = epoll_wait(loop->epfd, events, MAX_EVENTS, timeout))) {
+	    if (EINTR == errno) {
+		continue;
+	    }
+	    break;
+	}
+	for (ev = events; 0 < cnt; cnt--, ev++) {
+	    if (NULL == (s = (ofixSession)ev->data.ptr)) {
+		take_adds(loop);
+		continue;
+	    }
+	    if (s->done) {
+		continue;
+	    }
+	    if (0 != (ev->events & EPOLLOUT) && !_ofix_session_writable(s)) {
+		watch_send(loop, s, false);
+	    }
+	    if (0 != (ev->events & EPOLLIN)) {
+		// one read per event, the level triggered epoll reports the rest
+		if (!_ofix_session_read(s)) {
+		    loop->next_tick = 0.0;
+		}
+	    } else if (0 != (ev->events & (EPOLLERR | EPOLLHUP | EPOLLRDHUP))) {
+		s->done = true;
+		loop->next_tick = 0.0;
+	    }
+	}
+	if (MAX_WAIT < dtime() - now) {
+	    // a long stretch of reads should not starve the timers
+	    loop->next_tick = 0.0;
+	}
+    }
+}
+
+#ifdef HAVE_URING
+
+static int
+ring_enter(Ring ring, unsigned wait_cnt, double wait) {
+    struct io_uring_getevents_arg	arg;
+    struct __kernel_timespec		ts;
+    int					cnt;
+
+    __atomic_store_n(ring->sq_tail, ring->tail, __ATOMIC_RELEASE);
+    memset(&arg, 0, sizeof(arg));
+    ts.tv_sec = (long long)wait;
+    ts.tv_nsec = (long long)((wait - (double)ts.tv_sec) * 1000000000.0);
+    arg.ts = (uint64_t)(uintptr_t)&ts;
+    cnt = (int)syscall(__NR_io_uring_enter, ring->fd, ring->pending, wait_cnt,
+		       IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg));
+    if (0 < cnt) {
+	ring->pending -= cnt;
+    }
+    return cnt;
+}
+
+// Returns the next free submission entry or NULL if the queue is full and
+// can not be submitted right now, for example when completions must be
+// reaped first. The caller leaves the operation unarmed and it is retried on
+// a later pass.
+static struct io_uring_sqe*
+get_sqe(Ring ring) {
+    struct io_uring_sqe	*sqe;
+    unsigned		i;
+
+    while (ring->sq_entries <= ring->tail - __atomic_load_n(ring->sq_head, __ATOMIC_ACQUIRE)) {
+	// full, submit what is there without waiting
+	if (0 > ring_enter(ring, 0, 0.0) && EINTR != errno) {
+	    ring->starved = true;
+	    return NULL;
+	}
+    }
+    i = ring->tail & ring->sq_mask;
+    sqe = ring->sqes + i;
+    memset(sqe, 0, sizeof(*sqe));
+    ring->sq_array[i] = i;
+    ring->tail++;
+    ring->pending++;
+
+    return sqe;
+}
+
+static void
+arm_recv(Ring ring, ofixSession s) {
+    struct io_uring_sqe	*sqe = get_sqe(ring);
+
+    if (NULL == sqe) {
+	return;
+    }
+    sqe->opcode = IORING_OP_RECV;
+    sqe->fd = s->sock;
+    sqe->flags = IOSQE_BUFFER_SELECT;
+    sqe->buf_group = BUF_GROUP;
+    if (ring->multishot) {
+	sqe->ioprio = IORING_RECV_MULTISHOT;
+    }
+    sqe->user_data = (uint64_t)(uintptr_t)s;
+    s->rarmed = true;
+}
+
+static void
+arm_send(Ring ring, ofixSession s) {
+    struct io_uring_sqe	*sqe = get_sqe(ring);
+
+    if (NULL == sqe) {
+	return;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = s->sock;
+    sqe->poll32_events = POLLOUT;
+    sqe->user_data = (uint64_t)(uintptr_t)s | SEND_TAG;
+    s->warmed = true;
+}
+
+// Writes what the session has queued with a send on the ring. Only one send
+// is in flight for a session at a time so the bytes go out in order. Once a
+// send completes the next one picks up whatever was queued meanwhile.
+static void
+arm_write(Ring ring, ofixSession s) {
+    RingSend		rs = s->rsend;
+    struct io_uring_sqe	*sqe;
+    bool		more = false;
+    int			n;
+
+    if (s->sarmed || s->warmed || s->done) {
+	return;
+    }
+    if (NULL == rs && NULL == (rs = s->rsend = (RingSend)malloc(sizeof(struct _RingSend)))) {
+	return;
+    }
+    if (0 == (n = _ofix_session_queued(s, rs->iov, SEND_IOV, &more))) {
+	return;
+    }
+    if (NULL == (sqe = get_sqe(ring))) {
+	// nothing was written, tried again on the next tick
+	_ofix_session_sent(s, 0);
+	return;
+    }
+    memset(&rs->mh, 0, sizeof(rs->mh));
+    rs->mh.msg_iov = rs->iov;
+    rs->mh.msg_iovlen = n;
+    sqe->opcode = IORING_OP_SENDMSG;
+    sqe->fd = s->sock;
+    sqe->addr = (uint64_t)(uintptr_t)&rs->mh;
+    sqe->len = 1;
+    // let the kernel fill segments if there is more to follow
+    sqe->msg_flags = MSG_NOSIGNAL | (more ? MSG_MORE : 0);
+    sqe->user_data = (uint64_t)(uintptr_t)s | WRITE_TAG;
+    s->sarmed = true;
+}
+
+static void
+cancel_recv(Ring ring, ofixSession s) {
+    struct io_uring_sqe	*sqe;
+
+    if (s->rarmed && NULL != (sqe = get_sqe(ring))) {
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->addr = (uint64_t)(uintptr_t)s;
+	sqe->user_data = (uint64_t)(uintptr_t)s | CANCEL_TAG;
+	s->cancels++;
+    }
+    if (s->warmed && NULL != (sqe = get_sqe(ring))) {
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->addr = (uint64_t)(uintptr_t)s | SEND_TAG;
+	sqe->user_data = (uint64_t)(uintptr_t)s | CANCEL_TAG;
+	s->cancels++;
+    }
+    if (s->sarmed && NULL != (sqe = get_sqe(ring))) {
+	sqe->opcode = IORING_OP_ASYNC_CANCEL;
+	sqe->fd = -1;
+	sqe->addr = (uint64_t)(uintptr_t)s | WRITE_TAG;
+	sqe->user_data = (uint64_t)(uintptr_t)s | CANCEL_TAG;
+	s->cancels++;
+    }
+}
+
+static void
+arm_wake(Loop loop) {
+    struct io_uring_sqe	*sqe = get_sqe(loop->ring);
+
+    if (NULL == sqe) {
+	return;
+    }
+    sqe->opcode = IORING_OP_POLL_ADD;
+    sqe->fd = loop->wakefd;
+    sqe->poll32_events = POLLIN;
+    sqe->user_data = WAKE_DATA;
+    loop->ring->wake_armed = true;
+}
+
+static void
+recycle_buf(Ring ring, int bid) {
+    struct io_uring_buf	*b = &ring->br->bufs[ring->br_tail & (BUF_CNT - 1)];
+
+    b->addr = (uint64_t)(uintptr_t)(ring->bufs + bid * BUF_SIZE);
+    b->len = BUF_SIZE;
+    b->bid = (unsigned short)bid;
+    ring->br_tail++;
+    __atomic_store_n(&ring->br->tail, ring->br_tail, __ATOMIC_RELEASE);
+}
+
+static void
+recv_done(Loop loop, ofixSession s, int res, unsigned flags) {
+    Ring	ring = loop->ring;
+
+    if (0 != (flags & IORING_CQE_F_BUFFER)) {
+	int	bid = (int)(flags >> IORING_CQE_BUFFER_SHIFT);
+
+	if (0 < res && !s->done && !_ofix_session_feed(s, ring->bufs + bid * BUF_SIZE, res)) {
+	    loop->next_tick = 0.0;
+	}
+	recycle_buf(ring, bid);
+    }
+    if (0 != (flags & IORING_CQE_F_MORE)) {
+	return;
+    }
+    // the receive ended, start another unless the session is done
+    s->rarmed = false;
+    if (0 == res) {
+	s->done = true;
+    } else if (-EINVAL == res && ring->multishot) {
+	s->log(s->log_ctx, OFIX_INFO, "Multishot receive not supported, using single receives.");
+	ring->multishot = false;
+    } else if (0 > res && -ENOBUFS != res && -EINTR != res && -EAGAIN != res) {
+	if (-ECANCELED != res && 0.0 >= s->logout_sent) {
+	    s->log(s->log_ctx, OFIX_WARN, "recv error %d - %s", -res, strerror(-res));
+	}
+	s->done = true;
+    }
+    if (s->done) {
+	loop->next_tick = 0.0;
+    } else {
+	arm_recv(ring, s);
+    }
+}
+
+static void
+send_ready(Loop loop, ofixSession s) {
+    s->warmed = false;
+    arm_write(loop->ring, s);
+}
+
+static void
+write_done(Loop loop, ofixSession s, int res) {
+    s->sarmed = false;
+    if (_ofix_session_sent(s, res)) {
+	// the socket buffer is full, the rest is written once it drains
+	if (!s->done) {
+	    arm_send(loop->ring, s);
+	}
+    } else {
+	arm_write(loop->ring, s);
+    }
+}
+
+static void
+reap(Loop loop) {
+    Ring		ring = loop->ring;
+    struct io_uring_cqe	*cqe;
+    unsigned		head = *ring->cq_head;
+    unsigned		tail = __atomic_load_n(ring->cq_tail, __ATOMIC_ACQUIRE);
+    ofixSession		s;
+
+    for (; head != tail; head++) {
+	cqe = ring->cqes + (head & ring->cq_mask);
+	switch (cqe->user_data) {
+	case WAKE_DATA:
+	    ring->wake_armed = false;
+	    take_adds(loop);
+	    arm_wake(loop);
+	    break;
+	default:
+	    s = (ofixSession)(uintptr_t)(cqe->user_data & ~(uint64_t)OP_TAGS);
+	    if (0 != (cqe->user_data & CANCEL_TAG)) {
+		s->cancels--;
+	    } else if (0 != (cqe->user_data & SEND_TAG)) {
+		send_ready(loop, s);
+	    } else if (0 != (cqe->user_data & WRITE_TAG)) {
+		write_done(loop, s, cqe->res);
+	    } else {
+		recv_done(loop, s, cqe->res, cqe->flags);
+		// replies queued by the receive callback
+		arm_write(ring, s);
+	    }
+	    break;
+	}
+    }
+    __atomic_store_n(ring->cq_head, head, __ATOMIC_RELEASE);
+}
+
+static void
+uring_run(Loop loop) {
+    Ring		ring = loop->ring;
+    ofixSession		s;
+    double		now;
+    double		wait;
+    double		give_up;
+
+    while (!loop->reactor->done) {
+	if (!ring->wake_armed) {
+	    arm_wake(loop);
+	}
+	if (ring->starved) {
+	    // whatever could not be armed is retried once completions have
+	    // been reaped
+	    ring->starved = false;
+	    loop->next_tick = 0.0;
+	}
+	if (loop->next_tick <= (now = dtime())) {
+	    tick(loop, now);
+	}
+	if (MAX_WAIT < (wait = loop->next_tick - now)) {
+	    wait = MAX_WAIT;
+	} else if (0.0 > wait) {
+	    wait = 0.0;
+	}
+	// Everything prepared since the last pass is submitted with the same
+	// call that waits for completions.
+	if (0 > ring_enter(ring, 1, wait) && ETIME != errno && EINTR != errno && EBUSY != errno) {
+	    return;
+	}
+	reap(loop);
+	if (MAX_WAIT < dtime() - now) {
+	    loop->next_tick = 0.0;
+	}
+    }
+    // Sends on the ring point into the session send queues so the sessions
+    // are only closed by tick() once the operations on them have ended.
+    take_adds(loop);
+    for (s = loop->sessions; NULL != s; s = s->rnext) {
+	s->done = true;
+    }
+    give_up = dtime() + CLOSE_WAIT;
+    while (NULL != loop->sessions && dtime() < give_up) {
+	tick(loop, dtime());
+	if (0 > ring_enter(ring, 1, MAX_WAIT / 10.0) && ETIME != errno && EINTR != errno && EBUSY != errno) {
+	    break;
+	}
+	reap(loop);
+    }
+}
+
+static void
+ring_destroy(Ring ring) {
+    if (0 <= ring->fd) {
+	// outstanding receives are cancelled by the kernel
+	close(ring->fd);
+    }
+    if (NULL != ring->map) {
+	munmap(ring->map, ring->map_size);
+    }
+    if (NULL != ring->sqes) {
+	munmap(ring->sqes, ring->sqes_size);
+    }
+    if (NULL != ring->br) {
+	munmap(ring->br, ring->br_size);
+    }
+    free(ring->bufs);
+    free(ring);
+}
+
+// Returns NULL if the kernel does not support what is needed.
+static Ring
+ring_create() {
+    struct io_uring_params	p;
+    struct io_uring_buf_reg	reg;
+    Ring			ring;
+    char			*m;
+    size_t			cq_size;
+    int				i;
+
+    if (NULL == (ring = (Ring)calloc(1, sizeof(struct _Ring)))) {
+	return NULL;
+    }
+    memset(&p, 0, sizeof(p));
+    if (0 > (ring->fd = (int)syscall(__NR_io_uring_setup, RING_ENTRIES, &p)) ||
+	0 == (p.features & IORING_FEAT_SINGLE_MMAP) ||
+	0 == (p.features & IORING_FEAT_EXT_ARG)) {
+	goto FAIL;
+    }
+    ring->map_size = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    cq_size = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (ring->map_size < cq_size) {
+	ring->map_size = cq_size;
+    }
+    if (MAP_FAILED == (m = mmap(NULL, ring->map_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+				ring->fd, IORING_OFF_SQ_RING))) {
+	goto FAIL;
+    }
+    ring->map = m;
+    ring->sqes_size = p.sq_entries * sizeof(struct io_uring_sqe);
+    if (MAP_FAILED == (ring->sqes = mmap(NULL, ring->sqes_size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+					 ring->fd, IORING_OFF_SQES))) {
+	ring->sqes = NULL;
+	goto FAIL;
+    }
+    ring->sq_head = (unsigned*)(m + p.sq_off.head);
+    ring->sq_tail = (unsigned*)(m + p.sq_off.tail);
+    ring->sq_array = (unsigned*)(m + p.sq_off.array);
+    ring->sq_mask = *(unsigned*)(m + p.sq_off.ring_mask);
+    ring->sq_entries = p.sq_entries;
+    ring->tail = *ring->sq_tail;
+    ring->cq_head = (unsigned*)(m + p.cq_off.head);
+    ring->cq_tail = (unsigned*)(m + p.cq_off.tail);
+    ring->cq_mask = *(unsigned*)(m + p.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*)(m + p.cq_off.cqes);
+
+    // The buffer ring must be page aligned.
+    ring->br_size = BUF_CNT * sizeof(struct io_uring_buf);
+    if (MAP_FAILED == (ring->br = mmap(NULL, ring->br_size, PROT_READ | PROT_WRITE,
+				       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0))) {
+	ring->br = NULL;
+	goto FAIL;
+    }
+    if (NULL == (ring->bufs = (char*)malloc(BUF_CNT * BUF_SIZE))) {
+	goto FAIL;
+    }
+    memset(&reg, 0, sizeof(reg));
+    reg.ring_addr = (uint64_t)(uintptr_t)ring->br;
+    reg.ring_entries = BUF_CNT;
+    reg.bgid = BUF_GROUP;
+    if (0 != syscall(__NR_io_uring_register, ring->fd, IORING_REGISTER_PBUF_RING, &reg, 1)) {
+	goto FAIL;
+    }
+    for (i = 0; i < BUF_CNT; i++) {
+	recycle_buf(ring, i);
+    }
+    ring->multishot = true;
+
+    return ring;
+FAIL:
+    ring_destroy(ring);
+    return NULL;
+}
+
+#else
+
+static void
+arm_recv(Ring ring, ofixSession s) {
+}
+
+static void
+arm_send(Ring ring, ofixSession s) {
+}
+
+static void
+arm_write(Ring ring, ofixSession s) {
+}
+
+static void
+cancel_recv(Ring ring, ofixSession s) {
+}
+
+static void
+uring_run(Loop loop) {
+}
+
+static void
+ring_destroy(Ring ring) {
+}
+
+static Ring
+ring_create() {
+    return NULL;
+}
+
+#endif
+
+static void*
+loop_run(void *arg) {
+    Loop	loop = (Loop)arg;
+    ofixSession	s;
+
+    if (NULL != loop->ring) {
+	uring_run(loop);
+    } else {
+	epoll_run(loop);
+    }
+    // Close whatever is left. Receives still in flight on a ring are
+    // cancelled when the ring is closed and never seen here again.
+    take_adds(loop);
+    for (s = loop->sessions; NULL != s; s = s->rnext) {
+	s->done = true;
+	s->rarmed = false;
+	s->warmed = false;
+	s->sarmed = false;
+	s->cancels = 0;
+    }
+    tick(loop, dtime());
+
+    return NULL;
+}
+
+Reactor
+_ofix_reactor_create(ofixErr err, int threads, bool uring) {
+    struct epoll_event	ev;
+    Reactor		r;
+    Loop		loop;
+    int			i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (0 >= threads && 0 >= (threads = (int)sysconf(_SC_NPROCESSORS_ONLN))) {
+	threads = 1;
+    }
+    if (NULL == (r = (Reactor)malloc(sizeof(struct _Reactor))) ||
+	NULL == (r->loops = (Loop)calloc(threads, sizeof(struct _Loop)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for reactor.");
+	}
+	free(r);
+	return NULL;
+    }
+    r->loop_cnt = threads;
+    r->done = false;
+    for (i = 0, loop = r->loops; i < threads; i++, loop++) {
+	loop->reactor = r;
+	loop->epfd = -1;
+	loop->wakefd = -1;
+	pthread_mutex_init(&loop->mutex, 0);
+    }
+    for (i = 0, loop = r->loops; i < threads; i++, loop++) {
+	if (0 > (loop->wakefd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC)) ||
+	    ((!uring || NULL == (loop->ring = ring_create())) &&
+	     0 > (loop->epfd = epoll_create1(EPOLL_CLOEXEC)))) {
+	    if (NULL != err) {
+		err->code = OFIX_NETWORK_ERR;
+		snprintf(err->msg, sizeof(err->msg), "Failed to create reactor loop. %s", strerror(errno));
+	    }
+	    break;
+	}
+	if (NULL == loop->ring) {
+	    memset(&ev, 0, sizeof(ev));
+	    ev.events = EPOLLIN;
+	    ev.data.ptr = NULL;
+	    epoll_ctl(loop->epfd, EPOLL_CTL_ADD, loop->wakefd, &ev);
+	}
+	if (0 != pthread_create(&loop->thread, 0, loop_run, loop)) {
+	    if (NULL != err) {
+		err->code = OFIX_THREAD_ERR;
+		strcpy(err->msg, "Failed to start reactor thread.");
+	    }
+	    break;
+	}
+	loop->started = true;
+    }
+    if (i < threads) {
+	_ofix_reactor_destroy(r);
+	return NULL;
+    }
+    return r;
+}
+
+void
+_ofix_reactor_add(ofixErr err, Reactor r, ofixSession session) {
+    Loop	loop = r->loops;
+    Loop	lp;
+    int		i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    for (i = r->loop_cnt, lp = r->loops; 0 < i; i--, lp++) {
+	if (lp->cnt < loop->cnt) {
+	    loop = lp;
+	}
+    }
+    __atomic_add_fetch(&loop->cnt, 1, __ATOMIC_RELAXED);
+    _ofix_session_open(session);
+
+    pthread_mutex_lock(&loop->mutex);
+    session->rnext = loop->adds;
+    loop->adds = session;
+    pthread_mutex_unlock(&loop->mutex);
+    wake(loop);
+}
+
+int
+_ofix_reactor_uring_cnt(Reactor r) {
+    Loop	loop;
+    int		i;
+    int		cnt = 0;
+
+    for (i = r->loop_cnt, loop = r->loops; 0 < i; i--, loop++) {
+	if (NULL != loop->ring) {
+	    cnt++;
+	}
+    }
+    return cnt;
+}
+
+void
+_ofix_reactor_destroy(Reactor r) {
+    Loop	loop;
+    int		i;
+
+    if (NULL == r) {
+	return;
+    }
+    r->done = true;
+    for (i = r->loop_cnt, loop = r->loops; 0 < i; i--, loop++) {
+	if (loop->started) {
+	    wake(loop);
+	    pthread_join(loop->thread, NULL);
+	}
+	if (0 <= loop->epfd) {
+	    close(loop->epfd);
+	}
+	if (0 <= loop->wakefd) {
+	    close(loop->wakefd);
+	}
+	if (NULL != loop->ring) {
+	    ring_destroy(loop->ring);
+	}
+	pthread_mutex_destroy(&loop->mutex);
+    }
+    free(r->loops);
+    free(r);
+}
@@ -1,14 +1,23 @@
 // Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
 
+#define _GNU_SOURCE
 #include <arpa/inet.h>
 #include <ctype.h>
 #include <errno.h>
+#include <fcntl.h>
 #include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <poll.h>
 #include <pthread.h>
+#include <sched.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/eventfd.h>
+#include <sys/socket.h>
 #include <sys/time.h>
+#include <sys/uio.h>
 #include <time.h>
 #include <unistd.h>
 
@@ -22,6 +31,29 @@
 
 #define HEARTBEAT_TOLERANCE	2.0
 #define HEARTBEAT_GIVEUP	2.0
+#define RESEND_BATCH		64
+// messages pulled from the framer at a time
+#define FRAME_BATCH		16
+// most queued messages written with one call
+#define SEND_BATCH		64
+// held sends are written once this much is queued
+#define SEND_FLUSH_BYTES	(16 * 1024)
+// SO_BUSY_POLL microseconds for a spinning session
+#define BUSY_POLL_USEC		50
+// longest wait for a full socket buffer to drain when a session is closed
+#define CLOSE_DRAIN_MS		1000
+
+// Replacement bytes for one resent message. The stored bytes between the
+// pieces are sent as they are.
+typedef struct _Patch {
+    char	head[32];	// BeginString and new BodyLength
+    char	fields[96];	// PossDupFlag, SendingTime and OrigSendingTime
+    char	tail[8];	// CheckSum
+} *Patch;
+
+static void	drop_sends(ofixSession session);
+static void	wake(ofixSession session);
+static void	send_iov(ofixErr err, ofixSession session, struct iovec *iov, int cnt);
 
 static bool
 log_on(void *ctx, ofixLogLevel level) {
@@ -76,21 +108,68 @@ _ofix_session_init(ofixErr err,
     s->heartbeat_interval = 30;
     s->heartbeat_next_send = (double)s->heartbeat_interval + now;
     s->heartbeat_expect_recv = 0.0;
+    s->target_heartbeat_interval = 0;
     *s->store_dir = '\0';
+    s->resume = false;
+    s->journal = NULL;
     s->log_on = log_on;
     s->log = log;
-
+    s->sendq = NULL;
+    s->sendq_head = 0;
+    s->sendq_cnt = 0;
+    s->sendq_cap = 0;
+    s->sendq_off = 0;
+    s->sendq_bytes = 0;
+    s->flushing = false;
+    s->ring_send = false;
+    s->send_blocked = false;
+    s->warmed = false;
+    s->sarmed = false;
+    s->cancels = 0;
+    s->rsend = NULL;
+    s->send_delay = 0;
+    s->validate = OFIX_VALIDATE_NONE;
+    s->flush_at = 0.0;
+    s->wakefd = -1;
+    s->evfd = -1;
+    s->submit_tail = 0;
+    s->submit_head = 0;
+    s->submit_wake = false;
+    s->busy_poll = false;
+    s->busy_cpu = -1;
+    s->spinning = false;
+    if (NULL == (s->submits = (Submit)malloc(sizeof(struct _Submit) * SUBMIT_RING_SIZE))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for session submit ring.");
+	}
+	free(s);
+	return;
+    }
+    for (int i = 0; i < SUBMIT_RING_SIZE; i++) {
+	s->submits[i].turn = i;
+	s->submits[i].msg = NULL;
+    }
+    if (NULL == (s->framer = ofix_framer_create(err, false))) {
+	free(s->submits);
+	free(s);
+	return;
+    }
     if (0 != pthread_mutex_init(&s->send_mutex, 0)) {
 	if (NULL != err) {
 	    err->code = OFIX_MEMORY_ERR;
 	    strcpy(err->msg, "Failed to initialize mutex.");
 	}
+	ofix_framer_destroy(s->framer);
+	free(s->submits);
 	free(s);
 	return;
     }
     if (NULL == store_path) {
 	s->store = NULL;
     } else if (NULL == (s->store = ofix_store_create(err, store_path, sid))) {
+	ofix_framer_destroy(s->framer);
+	free(s->submits);
 	free(s);
 	return;
     }
@@ -124,6 +203,25 @@ _ofix_session_free(ofixSession session) {
 	ofix_store_destroy(session->store);
 	session->store = NULL;
     }
+    ofix_framer_destroy(session->framer);
+    session->framer = NULL;
+    drop_sends(session);
+    free(session->sendq);
+    session->sendq = NULL;
+    // submitted after the reader stopped and never sent
+    for (; session->submit_head < session->submit_tail; session->submit_head++) {
+	Submit	slot = session->submits + (session->submit_head & (SUBMIT_RING_SIZE - 1));
+
+	if (NULL != slot->msg) {
+	    ofix_msg_destroy(slot->msg);
+	}
+    }
+    free(session->submits);
+    session->submits = NULL;
+    if (0 <= session->evfd) {
+	close(session->evfd);
+	session->evfd = -1;
+    }
     free(session->sid);
     free(session->tid);
 }
@@ -144,33 +242,385 @@ reset_target_heartbeat(ofixSession session, double now) {
     session->test_req_sent = false;
 }
 
+// Adds a copy of the bytes in iov to the send queue as one entry. Called
+// with send_mutex held.
+static void
+queue_iov(ofixErr err, ofixSession session, const struct iovec *iov, int cnt) {
+    SendBuf	sb;
+    size_t	len = 0;
+    char	*b;
+    int		i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    for (i = 0; i < cnt; i++) {
+	len += iov[i].iov_len;
+    }
+    if (0 == len) {
+	return;
+    }
+    if (session->sendq_cap <= session->sendq_head + session->sendq_cnt) {
+	if (0 < session->sendq_head) {
+	    memmove(session->sendq, session->sendq + session->sendq_head, session->sendq_cnt * sizeof(struct _SendBuf));
+	    session->sendq_head = 0;
+	}
+	if (session->sendq_cap <= session->sendq_cnt) {
+	    int	cap = (0 == session->sendq_cap) ? SEND_BATCH : session->sendq_cap * 2;
+
+	    if (NULL == (sb = (SendBuf)realloc(session->sendq, cap * sizeof(struct _SendBuf)))) {
+		goto NOMEM;
+	    }
+	    session->sendq = sb;
+	    session->sendq_cap = cap;
+	}
+    }
+    if (NULL == (b = (char*)malloc(len))) {
+	goto NOMEM;
+    }
+    sb = session->sendq + session->sendq_head + session->sendq_cnt;
+    sb->str = b;
+    sb->len = (int)len;
+    for (i = 0; i < cnt; i++) {
+	memcpy(b, iov[i].iov_base, iov[i].iov_len);
+	b += iov[i].iov_len;
+    }
+    session->sendq_cnt++;
+    session->sendq_bytes += len;
+
+    return;
+NOMEM:
+    if (NULL != err) {
+	err->code = OFIX_MEMORY_ERR;
+	strcpy(err->msg, "Failed to allocate memory for send queue.");
+    }
+}
+
+// Releases the cnt bytes that were written from the head of the queue. A
+// partial write leaves an offset into the head entry and the rest is
+// written next time around. Called with send_mutex held.
+static void
+release_sends(ofixSession session, ssize_t cnt) {
+    SendBuf	sb;
+
+    cnt += session->sendq_off;
+    for (sb = session->sendq + session->sendq_head; 0 < session->sendq_cnt && sb->len <= cnt; sb++) {
+	cnt -= sb->len;
+	session->sendq_bytes -= sb->len;
+	free(sb->str);
+	session->sendq_head++;
+	session->sendq_cnt--;
+    }
+    session->sendq_off = (int)cnt;
+    if (0 == session->sendq_cnt) {
+	session->sendq_head = 0;
+	session->sendq_off = 0;
+	session->sendq_bytes = 0;
+    }
+}
+
+// Writes the send queue until it is empty or the socket buffer is full.
+// Called with send_mutex held, which is released while writing. Only one
+// thread writes at a time. Messages queued by other threads in the meantime
+// are written by that thread, so a burst goes out in a few gathered writes
+// instead of one send() each. On a non-blocking socket a full buffer leaves
+// the rest queued and the reader is woken to write it when the socket is
+// writable again.
+static void
+flush_sends(ofixErr err, ofixSession session) {
+    struct iovec	iov[SEND_BATCH];
+    struct msghdr	mh;
+    SendBuf		sb;
+    ssize_t		cnt;
+    int			n;
+    int			flags;
+
+    if (session->ring_send) {
+	// The reactor loop writes the queue with a send on its io_uring once
+	// the queue is no longer held.
+	session->flush_at = 0.0;
+	if (0 < session->sendq_cnt && !pthread_equal(pthread_self(), session->reader)) {
+	    wake(session);
+	}
+	return;
+    }
+    if (session->flushing) {
+	return;
+    }
+    session->flushing = true;
+    session->flush_at = 0.0;
+    while (0 < session->sendq_cnt) {
+	sb = session->sendq + session->sendq_head;
+	for (n = 0; n < session->sendq_cnt && n < SEND_BATCH; n++, sb++) {
+	    iov[n].iov_base = sb->str;
+	    iov[n].iov_len = sb->len;
+	}
+	iov[0].iov_base = (char*)iov[0].iov_base + session->sendq_off;
+	iov[0].iov_len -= session->sendq_off;
+	memset(&mh, 0, sizeof(mh));
+	mh.msg_iov = iov;
+	mh.msg_iovlen = n;
+	// let the kernel fill segments if there is more to follow
+	flags = MSG_NOSIGNAL | ((n < session->sendq_cnt) ? MSG_MORE : 0);
+
+	pthread_mutex_unlock(&session->send_mutex);
+	cnt = sendmsg(session->sock, &mh, flags);
+	pthread_mutex_lock(&session->send_mutex);
+
+	if (0 > cnt) {
+	    if (EINTR == errno) {
+		continue;
+	    }
+	    if (EAGAIN == errno || EWOULDBLOCK == errno) {
+		session->send_blocked = true;
+		wake(session);
+		break;
+	    }
+	    if (NULL != err && OFIX_OK == err->code) {
+		err->code = OFIX_WRITE_ERR;
+		snprintf(err->msg, sizeof(err->msg),
+			 "Failed to send message. error [%d] %s", errno, strerror(errno));
+	    }
+	    // the connection is gone, drop what is queued
+	    cnt = (ssize_t)session->sendq_bytes;
+	}
+	release_sends(session, cnt);
+    }
+    if (0 == session->sendq_cnt) {
+	session->send_blocked = false;
+    }
+    session->flush_at = 0.0;
+    session->flushing = false;
+}
+
+// Drops whatever is still queued, the connection is going away.
+static void
+drop_sends(ofixSession session) {
+    for (; 0 < session->sendq_cnt; session->sendq_cnt--, session->sendq_head++) {
+	free(session->sendq[session->sendq_head].str);
+    }
+    session->sendq_head = 0;
+    session->sendq_off = 0;
+    session->sendq_bytes = 0;
+    session->send_blocked = false;
+}
+
+// Writes held sends if they are due. Called by the thread reading the
+// session.
+static void
+flush_due(ofixSession session, double now) {
+    if (0.0 < session->flush_at && session->flush_at <= now) {
+	pthread_mutex_lock(&session->send_mutex);
+	flush_sends(NULL, session);
+	pthread_mutex_unlock(&session->send_mutex);
+    }
+}
+
+// The eventfd stays open as long as the session or reactor does so it is
+// safe to write to one that was just detached.
+static void
+wake(ofixSession session) {
+    uint64_t	one = 1;
+    int		fd = __atomic_load_n(&session->wakefd, __ATOMIC_ACQUIRE);
+
+    if (__atomic_load_n(&session->spinning, __ATOMIC_ACQUIRE)) {
+	// checks for submits and held sends on every spin
+	return;
+    }
+    if (0 <= fd && sizeof(one) != write(fd, &one, sizeof(one))) {
+	// already signaled if the counter is full
+    }
+}
+
+// Adds msg to the submit ring and returns false if the ring is full. Any
+// number of threads can submit at once, a producer only ever waits on
+// another producer claiming the same slot.
 static bool
-resend(ofixErr err, ofixSession session, int64_t seq) {
-    int		cnt;
-    const char	*str;
-    ofixMsg	msg = ofix_store_get(err, session->store, seq, OFIX_IODIR_SEND);
+submit(ofixSession session, ofixMsg msg) {
+    Submit	slot;
+    int64_t	pos = __atomic_load_n(&session->submit_tail, __ATOMIC_RELAXED);
+    int64_t	dif;
+
+    for (;;) {
+	slot = session->submits + (pos & (SUBMIT_RING_SIZE - 1));
+	dif = __atomic_load_n(&slot->turn, __ATOMIC_ACQUIRE) - pos;
+	if (0 == dif) {
+	    // a failed exchange loads the current tail into pos
+	    if (__atomic_compare_exchange_n(&session->submit_tail, &pos, pos + 1, true,
+					    __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+		break;
+	    }
+	} else if (0 > dif) {
+	    // the reader has not taken the slot from the last time around
+	    return false;
+	} else {
+	    pos = __atomic_load_n(&session->submit_tail, __ATOMIC_RELAXED);
+	}
+    }
+    slot->msg = msg;
+    __atomic_store_n(&slot->turn, pos + 1, __ATOMIC_RELEASE);
+
+    return true;
+}
+
+// Takes the next submitted message or returns NULL if the slot at the head
+// has not been filled yet. Called with send_mutex held.
+static ofixMsg
+take_submit(ofixSession session) {
+    Submit	slot = session->submits + (session->submit_head & (SUBMIT_RING_SIZE - 1));
+    ofixMsg	msg;
+
+    if (session->submit_head + 1 != __atomic_load_n(&slot->turn, __ATOMIC_ACQUIRE)) {
+	return NULL;
+    }
+    msg = slot->msg;
+    slot->msg = NULL;
+    __atomic_store_n(&slot->turn, session->submit_head + SUBMIT_RING_SIZE, __ATOMIC_RELEASE);
+    session->submit_head++;
+
+    return msg;
+}
+
+// Sets the sequence number and SendingTime of msg, queues it to be written,
+// and stores it. Called with send_mutex held so the order on the wire, in
+// the store, and of the sequence numbers is always the same.
+static void
+send_msg(ofixErr err, ofixSession session, ofixMsg msg) {
+    int			cnt;
+    const char		*str;
+    struct timeval	tv;
+    struct timezone	tz;
+    struct _ofixDate	now;
+    int64_t		seq;
 
     if (NULL != err && OFIX_OK != err->code) {
-	return false;
+	return;
     }
-    ofix_msg_set_bool(err, msg, OFIX_PossDupFlagTAG, true);
+    gettimeofday(&tv, &tz);
+    ofix_date_set_timestamp(&now, (uint64_t)tv.tv_sec * 1000000LL + (uint64_t)tv.tv_usec);
+    ofix_msg_set_date(err, msg, OFIX_SendingTimeTAG, &now);
+    if (NULL != (str = ofix_msg_get_str(err, msg, OFIX_MsgTypeTAG)) && '\0' == str[1]) {
+	if ('5' == *str) {
+	    session->logout_sent = dtime();
+	} else if ('4' == *str) {
+	    if (0 < (seq = ofix_msg_get_int(err, msg, OFIX_NewSeqNoTAG))) {
+		session->sent_seq = seq - 2; // ends up as 1 less than new seq
+	    }
+	}
+    }
+    session->sent_seq++;
+    seq = session->sent_seq;
+    ofix_msg_set_int(err, msg, OFIX_MsgSeqNumTAG, seq);
     cnt = ofix_msg_size(err, msg);
-    str = ofix_msg_FIX_str(err, msg);
-    pthread_mutex_lock(&session->send_mutex);
-    if (cnt != send(session->sock, str, cnt, 0)) {
-	if (NULL != err) {
-	    err->code = OFIX_WRITE_ERR;
-	    snprintf(err->msg, sizeof(err->msg),
-		     "Failed to send message. error [%d] %s", errno, strerror(errno));
+    if (NULL != (str = ofix_msg_FIX_str(err, msg))) {
+	struct iovec	iov = { (void*)str, cnt };
+
+	queue_iov(err, session, &iov, 1);
+    }
+    if (NULL != session->store) {
+	ofix_store_add(err, session->store, seq, OFIX_IODIR_SEND, msg);
+    }
+    if (session->log_on(session->log_ctx, OFIX_DEBUG)) {
+	char	*s = ofix_msg_to_str(err, msg);
+
+	session->log(session->log_ctx, OFIX_DEBUG, "Sent %s", s);
+	free(s);
+    }
+    // reset the heartbeat timer
+    session->heartbeat_next_send = (double)session->heartbeat_interval + (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
+}
+
+// Writes the queue now or, with a send delay, holds it for more sends to
+// join. Called with send_mutex held.
+static void
+flush_or_hold(ofixErr err, ofixSession session) {
+    if (0 >= session->send_delay || 0 > session->wakefd || SEND_FLUSH_BYTES <= session->sendq_bytes) {
+	flush_sends(err, session);
+    } else if (0.0 >= session->flush_at) {
+	// Hold the send for more to coalesce with. The reading thread writes
+	// the queue by the deadline if no other send does first.
+	session->flush_at = dtime() + (double)session->send_delay / 1000000.0;
+	wake(session);
+    } else if (session->flush_at <= dtime()) {
+	flush_sends(err, session);
+    }
+}
+
+// Sends the messages submitted by other threads in the order they were
+// submitted. Called with send_mutex held.
+static void
+send_submits(ofixSession session) {
+    ofixMsg	msg;
+
+    __atomic_store_n(&session->submit_wake, false, __ATOMIC_SEQ_CST);
+    while (NULL != (msg = take_submit(session))) {
+	struct _ofixErr	err = OFIX_ERR_INIT;
+
+	send_msg(&err, session, msg);
+	if (OFIX_OK != err.code) {
+	    session->log(session->log_ctx, OFIX_WARN, "error %d sending message - %s", err.code, err.msg);
 	}
+	ofix_msg_destroy(msg);
     }
+}
+
+// Called by the thread reading the session after a wake.
+static void
+take_submits(ofixSession session) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+
+    if (!__atomic_load_n(&session->submit_wake, __ATOMIC_ACQUIRE)) {
+	return;
+    }
+    pthread_mutex_lock(&session->send_mutex);
+    send_submits(session);
+    flush_or_hold(&err, session);
     pthread_mutex_unlock(&session->send_mutex);
+    if (OFIX_OK != err.code) {
+	session->log(session->log_ctx, OFIX_WARN, "[%d] %s", err.code, err.msg);
+    }
+}
+
+// Resends a stored message that could not be patched in place. It is
+// parsed and given PossDupFlag, a new SendingTime, and the original
+// SendingTime as OrigSendingTime unless it already has one from an earlier
+// resend. Returns false if the message could not be read from the store so
+// the caller can fill the gap instead.
+static bool
+resend(ofixErr err, ofixSession session, int64_t seq, ofixDate now) {
+    struct _ofixErr	serr = OFIX_ERR_INIT;
+    ofixMsg		msg;
+    char		*orig;
+    const char		*str;
+    int			cnt;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    if (NULL == (msg = ofix_store_get(&serr, session->store, seq, OFIX_IODIR_SEND))) {
+	session->log(session->log_ctx, OFIX_WARN, "Message %lld can not be resent. %s", (long long)seq, serr.msg);
+	return false;
+    }
+    if (!ofix_msg_tag_exists(msg, OFIX_OrigSendingTimeTAG) &&
+	NULL != (orig = ofix_msg_get_str(NULL, msg, OFIX_SendingTimeTAG))) {
+	ofix_msg_set_str(err, msg, OFIX_OrigSendingTimeTAG, orig);
+	free(orig);
+    }
+    ofix_msg_set_date(err, msg, OFIX_SendingTimeTAG, now);
+    ofix_msg_set_bool(err, msg, OFIX_PossDupFlagTAG, true);
+    cnt = ofix_msg_size(err, msg);
+    if (NULL != (str = ofix_msg_FIX_str(err, msg))) {
+	struct iovec	iov = { (void*)str, cnt };
+
+	send_iov(err, session, &iov, 1);
+    }
     if (session->log_on(session->log_ctx, OFIX_DEBUG)) {
 	char	*s = ofix_msg_to_str(err, msg);
 
 	session->log(session->log_ctx, OFIX_DEBUG, "Resent %s", s);
 	free(s);
     }
+    ofix_msg_destroy(msg);
     session->heartbeat_next_send = (double)session->heartbeat_interval + dtime();
 
     return true;
@@ -340,6 +790,270 @@ handle_test_request(ofixErr err, ofixSession session, ofixMsg msg) {
     free(id);
 }
 
+static int
+byte_sum(const char *s, const char *end) {
+    int	sum = 0;
+
+    for (; s < end; s++) {
+	sum += (uint8_t)*s;
+    }
+    return sum;
+}
+
+// Returns true if the message is a session message that is replaced by a
+// GapFill instead of being resent. Rejects are resent.
+static bool
+gap_fill_type(MsgView v) {
+    const char	*s = v->str;
+    const char	*end = s + v->len;
+
+    for (; s < end - 4; s++) {
+	if ('\001' == *s && '3' == s[1] && '5' == s[2] && '=' == s[3]) {
+	    s += 4;
+	    return (s + 1 < end && '\001' == s[1] && NULL != strchr("0124A5", *s));
+	}
+    }
+    return false;
+}
+
+// Sets up the iovecs to send a stored message with PossDupFlag set, a new
+// SendingTime and OrigSendingTime set to the original SendingTime. The
+// BodyLength and CheckSum are adjusted from the stored values so the body is
+// never copied or summed. Returns false if the stored message can not be
+// patched.
+static bool
+patch_resend(MsgView v, Patch p, struct iovec *iov, const char *now) {
+    const char	*s = v->str;
+    const char	*end = s + v->len;
+    const char	*body;
+    const char	*cs = end - 7;
+    const char	*ts = NULL;
+    const char	*ts_end;
+    const char	*f;
+    int		hlen;
+    int		flen;
+    int		sum;
+
+    for (body = s; body < end && '\001' != *body; body++) {
+    }
+    f = body + 1;
+    if (end <= f + 2 || '9' != *f || '=' != f[1]) {
+	return false;
+    }
+    for (body = f; body < end && '\001' != *body; body++) {
+    }
+    if (cs <= body || 0 != strncmp("10=", cs, 3)) {
+	return false;
+    }
+    for (f = body; f < cs - 4; f++) {
+	if ('\001' != *f) {
+	    continue;
+	}
+	if ('5' == f[1] && '2' == f[2] && '=' == f[3]) {
+	    ts = f + 1;
+	} else if (('4' == f[1] && '3' == f[2] && '=' == f[3]) ||
+		   ('1' == f[1] && '2' == f[2] && '2' == f[3] && '=' == f[4])) {
+	    // already a resend
+	    return false;
+	}
+    }
+    if (NULL == ts) {
+	return false;
+    }
+    for (ts_end = ts; ts_end < cs && '\001' != *ts_end; ts_end++) {
+    }
+    ts_end++;
+    body++;
+    flen = snprintf(p->fields, sizeof(p->fields), "43=Y\00152=%s\001122=%.*s\001",
+		    now, (int)(ts_end - ts - 4), ts + 3);
+    if (sizeof(p->fields) <= flen) {
+	return false;
+    }
+    hlen = snprintf(p->head, sizeof(p->head), "%.*s9=%d\001",
+		    (int)(strchr(s, '\001') - s + 1), s, (int)((cs - body) - (ts_end - ts) + flen));
+    if (sizeof(p->head) <= hlen) {
+	return false;
+    }
+    sum = (cs[3] - '0') * 100 + (cs[4] - '0') * 10 + (cs[5] - '0');
+    sum += byte_sum(p->head, p->head + hlen) + byte_sum(p->fields, p->fields + flen);
+    sum -= byte_sum(s, body) + byte_sum(ts, ts_end);
+    snprintf(p->tail, sizeof(p->tail), "10=%03d\001", ((sum % 256) + 256) % 256);
+
+    iov[0].iov_base = p->head;
+    iov[0].iov_len = hlen;
+    iov[1].iov_base = (void*)body;
+    iov[1].iov_len = ts - body;
+    iov[2].iov_base = p->fields;
+    iov[2].iov_len = flen;
+    iov[3].iov_base = (void*)ts_end;
+    iov[3].iov_len = cs - ts_end;
+    iov[4].iov_base = p->tail;
+    iov[4].iov_len = 7;
+
+    return true;
+}
+
+static ofixMsg
+gap_fill(ofixErr err, ofixSession session, int64_t seq, int64_t new_seq, ofixDate now) {
+    ofixMsg	msg = ofix_session_create_msg(err, session, "4");
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_str(err, msg, OFIX_SenderCompIDTAG, session->sid);
+    ofix_msg_set_str(err, msg, OFIX_TargetCompIDTAG, session->tid);
+    ofix_msg_set_int(err, msg, OFIX_MsgSeqNumTAG, seq);
+    ofix_msg_set_bool(err, msg, OFIX_PossDupFlagTAG, true);
+    ofix_msg_set_date(err, msg, OFIX_SendingTimeTAG, now);
+    ofix_msg_set_bool(err, msg, OFIX_GapFillFlagTAG, true);
+    ofix_msg_set_int(err, msg, OFIX_NewSeqNoTAG, new_seq);
+    ofix_msg_FIX_str(err, msg);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Sends the bytes in iov, which may point into the store. When nothing is
+// queued ahead they are written straight from the caller's buffers and only
+// what the socket did not take is copied to the queue. send_mutex is held
+// while writing so nothing can be queued ahead of that rest.
+static void
+send_iov(ofixErr err, ofixSession session, struct iovec *iov, int cnt) {
+    struct msghdr	mh;
+    ssize_t		n;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    pthread_mutex_lock(&session->send_mutex);
+    if (0 == session->sendq_cnt && !session->flushing && !session->ring_send) {
+	while (0 < cnt) {
+	    memset(&mh, 0, sizeof(mh));
+	    mh.msg_iov = iov;
+	    mh.msg_iovlen = cnt;
+	    if (0 > (n = sendmsg(session->sock, &mh, MSG_NOSIGNAL))) {
+		if (EINTR == errno) {
+		    continue;
+		}
+		if (EAGAIN == errno || EWOULDBLOCK == errno) {
+		    // queued below and written once the socket is writable
+		    break;
+		}
+		if (NULL != err) {
+		    err->code = OFIX_WRITE_ERR;
+		    snprintf(err->msg, sizeof(err->msg),
+			     "Failed to send message. error [%d] %s", errno, strerror(errno));
+		}
+		break;
+	    }
+	    for (; 0 < cnt && iov->iov_len <= (size_t)n; iov++, cnt--) {
+		n -= iov->iov_len;
+	    }
+	    if (0 < cnt) {
+		iov->iov_base = (char*)iov->iov_base + n;
+		iov->iov_len -= n;
+	    }
+	}
+    }
+    queue_iov(err, session, iov, cnt);
+    flush_sends(err, session);
+    pthread_mutex_unlock(&session->send_mutex);
+}
+
+// Resends begin through end from the store in batches with one writev per
+// batch. Runs of session messages and missing messages are collapsed into
+// SequenceReset-GapFill messages.
+static void
+resend_range(ofixErr err, ofixSession session, int64_t begin, int64_t end) {
+    struct _MsgView	views[RESEND_BATCH];
+    struct _Patch	patches[RESEND_BATCH];
+    ofixMsg		gaps[RESEND_BATCH + 1];
+    struct iovec	iov[RESEND_BATCH * 5 + 1];
+    struct timeval	tv;
+    struct timezone	tz;
+    struct _ofixDate	now;
+    char		*now_str;
+    int64_t		gap_start = 0;
+    int64_t		seq;
+    int64_t		pin;
+    int			cnt;
+    int			icnt;
+    int			gcnt;
+    int			i;
+
+    if (0 == end || session->sent_seq < end) {
+	end = session->sent_seq;
+    }
+    gettimeofday(&tv, &tz);
+    ofix_date_set_timestamp(&now, (uint64_t)tv.tv_sec * 1000000LL + (uint64_t)tv.tv_usec);
+    now_str = ofix_date_to_str(&now);
+    for (seq = begin; seq <= end; seq += cnt) {
+	// The views are only used until the batch is sent.
+	pin = ofix_store_pin(session->store);
+	if (0 >= (cnt = ofix_store_get_range(err, session->store, seq, end, OFIX_IODIR_SEND, views, RESEND_BATCH))) {
+	    ofix_store_unpin(session->store, pin);
+	    break;
+	}
+	icnt = 0;
+	gcnt = 0;
+	for (i = 0; i < cnt; i++) {
+	    MsgView	v = views + i;
+
+	    if (NULL == v->str || gap_fill_type(v)) {
+		if (0 == gap_start) {
+		    gap_start = v->seq;
+		}
+		continue;
+	    }
+	    if (0 != gap_start) {
+		if (NULL == (gaps[gcnt] = gap_fill(err, session, gap_start, v->seq, &now))) {
+		    break;
+		}
+		iov[icnt].iov_base = (void*)ofix_msg_FIX_str(err, gaps[gcnt]);
+		iov[icnt].iov_len = ofix_msg_size(err, gaps[gcnt]);
+		icnt++;
+		gcnt++;
+		gap_start = 0;
+	    }
+	    if (patch_resend(v, patches + i, iov + icnt, now_str)) {
+		icnt += 5;
+	    } else {
+		// Send what is ready then fall back to a full re-encode. A
+		// message that can not be read is filled over.
+		send_iov(err, session, iov, icnt);
+		icnt = 0;
+		if (!resend(err, session, v->seq, &now) && OFIX_OK == err->code) {
+		    gap_start = v->seq;
+		}
+	    }
+	}
+	if (seq + cnt > end && 0 != gap_start && OFIX_OK == err->code) {
+	    if (NULL != (gaps[gcnt] = gap_fill(err, session, gap_start, end + 1, &now))) {
+		iov[icnt].iov_base = (void*)ofix_msg_FIX_str(err, gaps[gcnt]);
+		iov[icnt].iov_len = ofix_msg_size(err, gaps[gcnt]);
+		icnt++;
+		gcnt++;
+	    }
+	}
+	send_iov(err, session, iov, icnt);
+	ofix_store_unpin(session->store, pin);
+	for (i = 0; i < gcnt; i++) {
+	    ofix_msg_destroy(gaps[i]);
+	}
+	if (OFIX_OK != err->code) {
+	    break;
+	}
+	if (session->log_on(session->log_ctx, OFIX_DEBUG)) {
+	    session->log(session->log_ctx, OFIX_DEBUG, "Resent %lld through %lld",
+			 (long long)seq, (long long)(seq + cnt - 1));
+	}
+    }
+    free(now_str);
+    session->heartbeat_next_send = (double)session->heartbeat_interval + dtime();
+}
+
 static void
 handle_resend_request(ofixErr err, ofixSession session, ofixMsg msg) {
     int64_t	begin = ofix_msg_get_int(err, msg, OFIX_BeginSeqNoTAG);
@@ -360,19 +1074,10 @@ handle_resend_request(ofixErr err, ofixSession session, ofixMsg msg) {
 	send_reject(err, session, seq, "2", OFIX_EndSeqNoTAG, OFIX_REASON_MISSING_TAG, err->msg);
 	return;
     }
-    if (begin <= end) {
-	for (; begin <= end; begin++) {
-	    if (!resend(err, session, begin)) {
-		break;
-	    }
-	}
-    } else {
-	for (; true; begin++) {
-	    if (!resend(err, session, begin)) {
-		break;
-	    }
-	}
+    if (0 != end && end < begin) {
+	end = 0;
     }
+    resend_range(err, session, begin, end);
 }
 
 static void
@@ -428,6 +1133,29 @@ handle_session_msg(ofixErr err, ofixSession session, const char *mt, ofixMsg msg
     return true;
 }
 
+// Returns true if the message is a logon with credentials the engine
+// accepts. Clients always log on to a known target.
+static bool
+logon_authorized(ofixSession session, const char *mt, ofixMsg msg) {
+    char	*user;
+    char	*password;
+    bool	ok;
+
+    if (NULL == mt || 0 != strcmp("A", mt)) {
+	return false;
+    }
+    if (NULL == session->eng) {
+	return true;
+    }
+    user = ofix_msg_get_str(NULL, msg, OFIX_UsernameTAG);
+    password = ofix_msg_get_str(NULL, msg, OFIX_PasswordTAG);
+    ok = ofix_engine_authorized(session->eng, session->tid, user, password);
+    free(user);
+    free(password);
+
+    return ok;
+}
+
 // If true is returned then do not delete the message.
 static bool
 process_msg(ofixErr err, ofixSession session, ofixMsg msg) {
@@ -453,17 +1181,54 @@ process_msg(ofixErr err, ofixSession session, ofixMsg msg) {
 
 	    return false;
 	}
-	session->tid = strdup(sid);
-	snprintf(path, sizeof(path), "%s/%s-%04d%02d%02d.%02d%02d%02d.fix",
-		 session->store_dir, session->tid,
-		 tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday,
-		 tm->tm_hour, tm->tm_min, tm->tm_sec);
-	session->store = ofix_store_create(err, path, session->tid);
+	if (NULL == session->tid) {
+	    session->tid = strdup(sid);
+	}
+	if (NULL != session->journal) {
+	    // Only registered in the shared journal once the logon is
+	    // authorized so rejected connections do not take session slots.
+	    // Until then nothing is stored.
+	    if (logon_authorized(session, mt, msg)) {
+		session->store = ofix_store_create_shared(err, session->journal, session->tid, session->resume,
+							  session->resume ? &session->sent_seq : NULL,
+							  session->resume ? &session->recv_seq : NULL);
+	    }
+	} else if (session->resume) {
+	    if ((int)sizeof(path) <= snprintf(path, sizeof(path), "%s/%s", session->store_dir, session->tid)) {
+		err->code = OFIX_WRITE_ERR;
+		snprintf(err->msg, sizeof(err->msg), "Store path for '%.64s' is too long.", session->tid);
+		return false;
+	    }
+	    session->store = ofix_store_open(err, path, session->tid, &session->sent_seq, &session->recv_seq);
+	} else {
+	    if ((int)sizeof(path) <= snprintf(path, sizeof(path), "%s/%s-%04d%02d%02d.%02d%02d%02d.fix",
+					      session->store_dir, session->tid,
+					      tm->tm_year + 1900, tm->tm_mon + 1, tm->tm_mday,
+					      tm->tm_hour, tm->tm_min, tm->tm_sec)) {
+		err->code = OFIX_WRITE_ERR;
+		snprintf(err->msg, sizeof(err->msg), "Store path for '%.64s' is too long.", session->tid);
+		return false;
+	    }
+	    session->store = ofix_store_create(err, path, session->tid);
+	}
 	if (OFIX_OK != err->code) {
 	    return false;
 	}
     }
-    ofix_store_add(err, session->store, seq, OFIX_IODIR_RECV, msg);
+    if (NULL != mt && 0 == strcmp("A", mt)) {
+	struct _ofixErr	rerr = OFIX_ERR_INIT;
+
+	if (ofix_msg_get_bool(&rerr, msg, OFIX_ResetSeqNumFlagTAG)) {
+	    // Both sides start over.
+	    session->recv_seq = seq - 1;
+	    if (!session->logon_sent) {
+		session->sent_seq = 0;
+	    }
+	}
+    }
+    if (NULL != session->store) {
+	ofix_store_add(err, session->store, seq, OFIX_IODIR_RECV, msg);
+    }
     if (0.0 < session->logout_sent) {
 	if (0 == strcmp("5", mt)) {
 	    handle_session_msg(err, session, mt, msg, seq);
@@ -547,97 +1312,43 @@ check_heartbeat(ofixSession session) {
     }
 }
 
-static void*
-session_loop(void *arg) {
-    ofixSession		session = (ofixSession)arg;
-    char		buf[4096];
-    char		*b = buf;
-    char		*start = buf;
-    char		*end = buf + sizeof(buf);
-    fd_set		xfds;
-    fd_set		rfds;
-    struct timeval	to;
+// Processes the complete messages in the read buffer. Returns false if the
+// session should be closed.
+static bool
+process_buf(ofixSession session) {
+    struct _ofixFrame	frames[FRAME_BATCH];
+    struct _ofixErr	ferr = OFIX_ERR_INIT;
+    ofixFrame		f;
+    int64_t		skipped = ofix_framer_skipped(session->framer);
     int			cnt;
-    int			sock = session->sock;
-    int			max_sock = session->sock + 1;
-    socklen_t		rlen = 0;
-    ssize_t		rcnt;
-    int			msg_len = 0;
 
-    session->done = false;
-    session->closed = false;
-    while (!session->done) {
-	while (start < b && isspace(*start)) {
-	    start++;
-	}
-	if (b - start < 22 || (0 < msg_len && b - start < msg_len)) {
-	    // Slide to make room before reading.
-	    if (buf < start) {
-		if (0 < b - start) {
-		    memmove(buf, start, b - start);
-		    b -= start - buf;
-		} else {
-		    b = buf;
-		}
-		start = buf;
-	    }
-	    to.tv_sec = 1;
-	    to.tv_usec = 0;
-	    FD_ZERO(&rfds);
-	    FD_ZERO(&xfds);
-	    FD_SET(sock, &rfds);
-	    FD_SET(sock, &xfds);
-	    if (0 < (cnt = select(max_sock, &rfds, 0, &xfds, &to))) {
-		if (FD_ISSET(sock, &xfds)) {
-		    session->done = true;
-		    break;
-		}
-		if (FD_ISSET(sock, &rfds)) {
-		    rlen = 0;
-		    rcnt = recvfrom(session->sock, b, end - b, 0, 0, &rlen);
-		    b += rcnt;
-		}
-	    } else if (0 == cnt) {
-		if (0.0 < session->logout_sent && session->logout_sent < dtime() + LOGOUT_TIMEOUT) {
-		    session->done = true;
-		}
-		check_heartbeat(session);
-		continue;
-	    } else {
-		if (0.0 >= session->logout_sent) {
-		    // Only an error if there was no logout sent.
-		    session->log(session->log_ctx, OFIX_WARN, "select error %d - %s", errno, strerror(errno));
-		}
+    while (!session->done && 0 < (cnt = ofix_framer_pull(&ferr, session->framer, frames, FRAME_BATCH))) {
+	for (f = frames; 0 < cnt && !session->done; cnt--, f++) {
+	    struct _ofixErr	err = OFIX_ERR_INIT;
+	    ofixMsg		msg;
+
+	    if (0.0 < session->logout_sent && session->logout_sent + 1.0 < dtime()) {
 		session->done = true;
 		break;
 	    }
-	}
-	if (0.0 < session->logout_sent && session->logout_sent + 1.0 < dtime()) {
-	    session->done = true;
-	    break;
-	}
-	if (22 <= b - start && 0 == msg_len) {
-	    msg_len = ofix_msg_expected_buf_size(start);
-	    if (0 == msg_len) {
-		*b = '\0';
-		session->log(session->log_ctx, OFIX_WARN,
-			     "Failed to parse message length, aborting '%s'", start);
+	    msg = ofix_msg_parse(&err, f->str, f->len);
+	    switch (session->validate) {
+	    case OFIX_VALIDATE_STRICT:
+		ofix_msg_validate(&err, msg);
 		break;
-	    } else if (sizeof(buf) <= msg_len) {
-		// TBD if msg_len is greater than buf then allocate,exit for now
-		session->log(session->log_ctx, OFIX_ERROR,
-			     "Message length too long. Limit is %lu, aborting '%s'", sizeof(buf) - 1);
-		session->done = true;
+	    case OFIX_VALIDATE_REQUIRED:
+		ofix_msg_validate_required(&err, msg);
+		break;
+	    case OFIX_VALIDATE_NONE:
+	    default:
 		break;
 	    }
-	}
-	if (0 < msg_len && msg_len <= b - start) {
-	    struct _ofixErr	err = OFIX_ERR_INIT;
-	    ofixMsg		msg = ofix_msg_parse(&err, start, msg_len);
-
 	    if (OFIX_OK != err.code) {
 		struct _ofixErr	rerr = OFIX_ERR_INIT;
-		
+
+		if (NULL != msg) {
+		    ofix_msg_destroy(msg);
+		}
 		session->log(session->log_ctx, OFIX_WARN, "Parse error: %s", err.msg);
 		send_reject(&rerr, session, (0 == err.seq ? session->recv_seq + 1: err.seq),
 			    err.msg_type, err.tag, err.reason, err.msg);
@@ -651,20 +1362,360 @@ session_loop(void *arg) {
 		    ofix_msg_destroy(msg);
 		}
 	    }
-	    start += msg_len;
-	    msg_len = 0;
 	    if (OFIX_OK != err.code) {
 		session->log(session->log_ctx, OFIX_WARN, "[%d] %s.", err.code, err.msg);
 		ofix_err_clear(&err);
 	    }
+	    check_heartbeat(session);
+	}
+    }
+    if (skipped != ofix_framer_skipped(session->framer)) {
+	session->log(session->log_ctx, OFIX_WARN, "Skipped %lld bytes that were not a FIX message.",
+		     (long long)(ofix_framer_skipped(session->framer) - skipped));
+    }
+    if (OFIX_OK != ferr.code) {
+	session->log(session->log_ctx, OFIX_ERROR, "[%d] %s", ferr.code, ferr.msg);
+	session->done = true;
+    }
+    return !session->done;
+}
+
+bool
+_ofix_session_read(ofixSession session) {
+    ssize_t	rcnt;
+    size_t	space;
+    char	*b = ofix_framer_space(session->framer, &space);
+
+    rcnt = recv(session->sock, b, space, 0);
+    if (0 >= rcnt) {
+	if (0 > rcnt && (EINTR == errno || EAGAIN == errno)) {
+	    return true;
+	}
+	// closed by the other side or a socket error
+	if (0 > rcnt && 0.0 >= session->logout_sent) {
+	    session->log(session->log_ctx, OFIX_WARN, "recv error %d - %s", errno, strerror(errno));
+	}
+	session->done = true;
+	return false;
+    }
+#ifdef TCP_QUICKACK
+    if (__atomic_load_n(&session->spinning, __ATOMIC_RELAXED)) {
+	int	on = 1;
+
+	// the kernel turns quick acks off again after a while
+	setsockopt(session->sock, IPPROTO_TCP, TCP_QUICKACK, &on, sizeof(on));
+    }
+#endif
+    ofix_framer_commit(session->framer, rcnt);
+    if (!process_buf(session)) {
+	return false;
+    }
+    check_heartbeat(session);
+
+    return !session->done;
+}
+
+bool
+_ofix_session_feed(ofixSession session, const char *buf, int len) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+
+    ofix_framer_push(&err, session->framer, buf, len);
+    if (OFIX_OK != err.code) {
+	session->log(session->log_ctx, OFIX_ERROR, "[%d] %s", err.code, err.msg);
+	session->done = true;
+	return false;
+    }
+    if (!process_buf(session)) {
+	return false;
+    }
+    check_heartbeat(session);
+
+    return !session->done;
+}
+
+void
+_ofix_session_tick(ofixSession session) {
+    take_submits(session);
+    if (0.0 < session->logout_sent && session->logout_sent + 1.0 < dtime()) {
+	session->done = true;
+	return;
+    }
+    check_heartbeat(session);
+    flush_due(session, dtime());
+}
+
+double
+_ofix_session_deadline(ofixSession session) {
+    double	next = session->heartbeat_next_send;
+
+    if (0 >= session->heartbeat_interval) {
+	next = dtime() + (double)HEARTBEAT_GIVEUP;
+    }
+    if (0 < session->target_heartbeat_interval) {
+	double	expect = session->heartbeat_expect_recv;
+
+	if (session->test_req_sent) {
+	    expect += HEARTBEAT_GIVEUP;
+	}
+	if (expect < next) {
+	    next = expect;
+	}
+    }
+    if (0.0 < session->logout_sent && session->logout_sent + 1.0 < next) {
+	next = session->logout_sent + 1.0;
+    }
+    if (0.0 < session->flush_at && session->flush_at < next) {
+	next = session->flush_at;
+    }
+    return next;
+}
+
+bool
+_ofix_session_writable(ofixSession session) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    bool		blocked;
+
+    pthread_mutex_lock(&session->send_mutex);
+    session->send_blocked = false;
+    flush_sends(&err, session);
+    blocked = session->send_blocked;
+    pthread_mutex_unlock(&session->send_mutex);
+    if (OFIX_OK != err.code) {
+	session->log(session->log_ctx, OFIX_WARN, "[%d] %s", err.code, err.msg);
+    }
+    return blocked;
+}
+
+int
+_ofix_session_queued(ofixSession session, struct iovec *iov, int max, bool *more) {
+    SendBuf	sb;
+    int		n = 0;
+
+    // Only the loop thread queues for a ring session so an empty queue
+    // does not need the lock.
+    if (0 == __atomic_load_n(&session->sendq_cnt, __ATOMIC_RELAXED)) {
+	return 0;
+    }
+    pthread_mutex_lock(&session->send_mutex);
+    if (session->ring_send && !session->flushing && 0.0 >= session->flush_at) {
+	sb = session->sendq + session->sendq_head;
+	for (; n < session->sendq_cnt && n < max; n++, sb++) {
+	    iov[n].iov_base = sb->str;
+	    iov[n].iov_len = sb->len;
+	}
+	if (0 < n) {
+	    iov[0].iov_base = (char*)iov[0].iov_base + session->sendq_off;
+	    iov[0].iov_len -= session->sendq_off;
+	    *more = (n < session->sendq_cnt);
+	    session->flushing = true;
+	}
+    }
+    pthread_mutex_unlock(&session->send_mutex);
+
+    return n;
+}
+
+bool
+_ofix_session_sent(ofixSession session, int res) {
+    bool	blocked = false;
+
+    pthread_mutex_lock(&session->send_mutex);
+    session->flushing = false;
+    if (0 <= res) {
+	release_sends(session, res);
+    } else if (-EAGAIN == res || -EWOULDBLOCK == res) {
+	blocked = true;
+    } else if (-EINTR != res && -ECANCELED != res) {
+	session->log(session->log_ctx, OFIX_WARN,
+		     "Failed to send message. error [%d] %s", -res, strerror(-res));
+	// the connection is gone, drop what is queued
+	drop_sends(session);
+    }
+    pthread_mutex_unlock(&session->send_mutex);
+
+    return blocked;
+}
+
+void
+_ofix_session_open(ofixSession session) {
+    ofix_framer_reset(session->framer);
+    session->done = false;
+    session->closed = false;
+}
+
+void
+_ofix_session_close(ofixSession session) {
+    // Anything submitted or held is written before the socket is closed.
+    // Senders that see no reader from here on send on their own thread.
+    // A full socket buffer gets a little time to drain and what is left
+    // after that is dropped so it is not sent on a later connection.
+    pthread_mutex_lock(&session->send_mutex);
+    __atomic_store_n(&session->wakefd, -1, __ATOMIC_SEQ_CST);
+    session->ring_send = false;
+    send_submits(session);
+    flush_sends(NULL, session);
+    if (0 < session->sendq_cnt && 0 < session->sock) {
+	struct pollfd	pfd = { session->sock, POLLOUT, 0 };
+	double		give_up = dtime() + CLOSE_DRAIN_MS / 1000.0;
+
+	while (session->send_blocked && dtime() < give_up && 0 < poll(&pfd, 1, CLOSE_DRAIN_MS / 10)) {
+	    flush_sends(NULL, session);
 	}
-	check_heartbeat(session);
     }
+    if (!session->flushing) {
+	drop_sends(session);
+    }
+    pthread_mutex_unlock(&session->send_mutex);
     if (0 < session->sock) {
 	close(session->sock);
 	session->sock = 0;
     }
     session->closed = true;
+}
+
+// Waits on the socket and the wake eventfd with select().
+static void
+select_loop(ofixSession session) {
+    fd_set		xfds;
+    fd_set		rfds;
+    struct timeval	to;
+    int			cnt;
+    int			sock = session->sock;
+    int			wakefd = session->evfd;
+    int			max_sock = ((sock < wakefd) ? wakefd : sock) + 1;
+    double		wait;
+    uint64_t		v;
+    bool		held;
+
+    while (!session->done) {
+	to.tv_sec = 1;
+	to.tv_usec = 0;
+	if ((held = 0.0 < session->flush_at && (wait = session->flush_at - dtime()) < 1.0)) {
+	    if (0.0 > wait) {
+		wait = 0.0;
+	    }
+	    // woken early only to write held sends
+	    to.tv_sec = 0;
+	    to.tv_usec = (long)(wait * 1000000.0);
+	}
+	FD_ZERO(&rfds);
+	FD_ZERO(&xfds);
+	FD_SET(sock, &rfds);
+	FD_SET(sock, &xfds);
+	if (0 <= wakefd) {
+	    FD_SET(wakefd, &rfds);
+	}
+	if (0 < (cnt = select(max_sock, &rfds, 0, &xfds, &to))) {
+	    if (FD_ISSET(sock, &xfds)) {
+		session->done = true;
+		break;
+	    }
+	    if (0 <= wakefd && FD_ISSET(wakefd, &rfds) && sizeof(v) != read(wakefd, &v, sizeof(v))) {
+		// nothing pending
+	    }
+	    if (FD_ISSET(sock, &rfds) && !_ofix_session_read(session)) {
+		break;
+	    }
+	} else if (0 == cnt) {
+	    if (held) {
+		take_submits(session);
+		flush_due(session, dtime());
+		continue;
+	    }
+	    if (0.0 < session->logout_sent && session->logout_sent < dtime() + LOGOUT_TIMEOUT) {
+		session->done = true;
+	    }
+	    check_heartbeat(session);
+	} else {
+	    if (0.0 >= session->logout_sent) {
+		// Only an error if there was no logout sent.
+		session->log(session->log_ctx, OFIX_WARN, "select error %d - %s", errno, strerror(errno));
+	    }
+	    session->done = true;
+	    break;
+	}
+	take_submits(session);
+	flush_due(session, dtime());
+    }
+}
+
+// Spins on the non-blocking socket so a message is handled as soon as it
+// arrives instead of after a select() wakeup. Submits, held sends, and a send
+// queue left by a full socket buffer are picked up on every spin. Timers are
+// checked when the coarse monotonic clock moves, every few milliseconds,
+// which costs no system call.
+static void
+busy_loop(ofixSession session) {
+    struct timespec	ts;
+    time_t		sec = 0;
+    long		nsec = 0;
+    int			sock = session->sock;
+    int			on = 1;
+
+    if (0 <= session->busy_cpu) {
+	cpu_set_t	cpus;
+	int		e;
+
+	CPU_ZERO(&cpus);
+	CPU_SET(session->busy_cpu, &cpus);
+	if (0 != (e = pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus))) {
+	    session->log(session->log_ctx, OFIX_WARN, "Failed to pin session thread to CPU %d. %s",
+			 session->busy_cpu, strerror(e));
+	}
+    }
+    fcntl(sock, F_SETFL, fcntl(sock, F_GETFL, 0) | O_NONBLOCK);
+    setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+#ifdef SO_BUSY_POLL
+    int	usec = BUSY_POLL_USEC;
+
+    // raising the value past the system default needs CAP_NET_ADMIN
+    if (0 != setsockopt(sock, SOL_SOCKET, SO_BUSY_POLL, &usec, sizeof(usec))) {
+	session->log(session->log_ctx, OFIX_INFO, "SO_BUSY_POLL not set. %s", strerror(errno));
+    }
+#endif
+    __atomic_store_n(&session->spinning, true, __ATOMIC_RELEASE);
+    while (!session->done) {
+	if (!_ofix_session_read(session)) {
+	    break;
+	}
+	take_submits(session);
+	if (0.0 < session->flush_at) {
+	    flush_due(session, dtime());
+	}
+	if (session->send_blocked) {
+	    // the rest of the queue is kept and written once the socket takes it
+	    _ofix_session_writable(session);
+	}
+	clock_gettime(CLOCK_MONOTONIC_COARSE, &ts);
+	if (ts.tv_nsec != nsec || ts.tv_sec != sec) {
+	    sec = ts.tv_sec;
+	    nsec = ts.tv_nsec;
+	    _ofix_session_tick(session);
+	}
+    }
+    __atomic_store_n(&session->spinning, false, __ATOMIC_RELEASE);
+}
+
+static void*
+session_loop(void *arg) {
+    ofixSession		session = (ofixSession)arg;
+
+    _ofix_session_open(session);
+    // kept for reconnects, closed when the session is freed
+    if (0 > session->evfd) {
+	session->evfd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+    }
+    // Without a wake sends are never held or submitted to this thread.
+    pthread_mutex_lock(&session->send_mutex);
+    session->reader = pthread_self();
+    __atomic_store_n(&session->wakefd, session->evfd, __ATOMIC_SEQ_CST);
+    pthread_mutex_unlock(&session->send_mutex);
+    if (session->busy_poll) {
+	busy_loop(session);
+    } else {
+	select_loop(session);
+    }
+    _ofix_session_close(session);
 
     return NULL;
 }
@@ -692,54 +1743,48 @@ _ofix_session_start(ofixErr err, ofixSession session, bool wait) {
 
 void
 ofix_session_send(ofixErr err, ofixSession session, ofixMsg msg) {
-    int			cnt;
-    const char		*str;
-    struct timeval	tv;
-    struct timezone	tz;
-    struct _ofixDate	now;
-    int64_t		seq;
+    ofixMsg	dup;
 
     if (NULL != err && OFIX_OK != err->code) {
 	return;
     }
-    gettimeofday(&tv, &tz);
-    ofix_date_set_timestamp(&now, (uint64_t)tv.tv_sec * 1000000LL + (uint64_t)tv.tv_usec);
-    ofix_msg_set_date(err, msg, OFIX_SendingTimeTAG, &now);
     ofix_msg_set_str(err, msg, OFIX_SenderCompIDTAG, session->sid);
     ofix_msg_set_str(err, msg, OFIX_TargetCompIDTAG, session->tid);
 
-    pthread_mutex_lock(&session->send_mutex);
-    if (NULL != (str = ofix_msg_get_str(err, msg, OFIX_MsgTypeTAG)) && '\0' == str[1]) {
-	if ('5' == *str) {
-	    session->logout_sent = dtime();
-	} else if ('4' == *str) {
-	    if (0 < (seq = ofix_msg_get_int(err, msg, OFIX_NewSeqNoTAG))) {
-		session->sent_seq = seq - 2; // ends up as 1 less than new seq
+    if (0 <= __atomic_load_n(&session->wakefd, __ATOMIC_SEQ_CST) &&
+	!pthread_equal(pthread_self(), session->reader)) {
+	// Hand a copy to the reading thread which numbers, writes, and
+	// stores it. Nothing here waits on send_mutex or a write.
+	if (NULL == (dup = ofix_msg_dup(err, msg))) {
+	    return;
+	}
+	if (!submit(session, dup)) {
+	    ofix_msg_destroy(dup);
+	    if (NULL != err) {
+		err->code = OFIX_OVERFLOW_ERR;
+		strcpy(err->msg, "Session submit ring is full.");
 	    }
+	    return;
 	}
-    }
-    session->sent_seq++;
-    seq = session->sent_seq;
-    ofix_msg_set_int(err, msg, OFIX_MsgSeqNumTAG, seq);
-    cnt = ofix_msg_size(err, msg);
-    str = ofix_msg_FIX_str(err, msg);
-    if (cnt != send(session->sock, str, cnt, 0)) {
-	if (NULL != err) {
-	    err->code = OFIX_WRITE_ERR;
-	    snprintf(err->msg, sizeof(err->msg),
-		     "Failed to send message. error [%d] %s", errno, strerror(errno));
+	if (!__atomic_exchange_n(&session->submit_wake, true, __ATOMIC_SEQ_CST)) {
+	    wake(session);
+	}
+	if (0 > __atomic_load_n(&session->wakefd, __ATOMIC_SEQ_CST)) {
+	    // The reader stopped and may have missed the submit so whatever
+	    // is left in the ring is sent here instead.
+	    pthread_mutex_lock(&session->send_mutex);
+	    send_submits(session);
+	    flush_or_hold(err, session);
+	    pthread_mutex_unlock(&session->send_mutex);
 	}
+	return;
     }
+    pthread_mutex_lock(&session->send_mutex);
+    // anything submitted earlier goes first
+    send_submits(session);
+    send_msg(err, session, msg);
+    flush_or_hold(err, session);
     pthread_mutex_unlock(&session->send_mutex);
-    ofix_store_add(err, session->store, seq, OFIX_IODIR_SEND, msg);
-    if (session->log_on(session->log_ctx, OFIX_DEBUG)) {
-	char	*s = ofix_msg_to_str(err, msg);
-
-	session->log(session->log_ctx, OFIX_DEBUG, "Sent %s", s);
-	free(s);
-    }
-    // reset the heartbeat timer
-    session->heartbeat_next_send = (double)session->heartbeat_interval + (double)tv.tv_sec + (double)tv.tv_usec / 1000000.0;
 }
 
 // only used for testing bad messages
@@ -760,19 +1805,20 @@ _ofix_session_raw_send(ofixErr err, ofixSession session, ofixMsg msg) {
     ofix_msg_set_date(err, msg, OFIX_SendingTimeTAG, &now);
 
     pthread_mutex_lock(&session->send_mutex);
+    send_submits(session);
     seq = ofix_msg_get_int(err, msg, OFIX_MsgSeqNumTAG);
     session->sent_seq = seq;
     cnt = ofix_msg_size(err, msg);
-    str = ofix_msg_FIX_str(err, msg);
-    if (cnt != send(session->sock, str, cnt, 0)) {
-	if (NULL != err) {
-	    err->code = OFIX_WRITE_ERR;
-	    snprintf(err->msg, sizeof(err->msg),
-		     "Failed to send message. error [%d] %s", errno, strerror(errno));
-	}
+    if (NULL != (str = ofix_msg_FIX_str(err, msg))) {
+	struct iovec	iov = { (void*)str, cnt };
+
+	queue_iov(err, session, &iov, 1);
+    }
+    if (NULL != session->store) {
+	ofix_store_add(err, session->store, seq, OFIX_IODIR_SEND, msg);
     }
+    flush_sends(err, session);
     pthread_mutex_unlock(&session->send_mutex);
-    ofix_store_add(err, session->store, seq, OFIX_IODIR_SEND, msg);
 }
 
 ofixMsg
@@ -814,6 +1860,24 @@ ofix_session_logout(ofixErr err, ofixSession session, const char *txt, ...) {
     ofix_session_send(err, session, msg);
 }
 
+void
+ofix_session_set_send_delay(ofixSession session, int usec) {
+    pthread_mutex_lock(&session->send_mutex);
+    session->send_delay = usec;
+    pthread_mutex_unlock(&session->send_mutex);
+}
+
+void
+ofix_session_set_validate(ofixSession session, ofixValidate mode) {
+    session->validate = mode;
+}
+
+void
+ofix_session_set_busy_poll(ofixSession session, bool on, int cpu) {
+    session->busy_poll = on;
+    session->busy_cpu = cpu;
+}
+
 void
 ofix_session_set_heartbeat(ofixSession session, int interval) {
     double	now = dtime();
@@ -22,6 +22,20 @@ struct _ofixEngine;
  */
 typedef struct _ofixSession	*ofixSession;
 
+/**
+ * How inbound messages are checked against their message specification
+ * before they are handed to the receive callback. A message that fails is
+ * rejected.
+ */
+typedef enum {
+    /** no checks, the default */
+    OFIX_VALIDATE_NONE		= 'n',
+    /** required tags and group counts, tags not in the spec are let through */
+    OFIX_VALIDATE_REQUIRED	= 'r',
+    /** also reject tags not defined for the message type */
+    OFIX_VALIDATE_STRICT	= 's',
+} ofixValidate;
+
 /**
  * This type is used for receiving message callbacks.
  */
@@ -50,4 +64,49 @@ extern int64_t	ofix_session_recv_seqnum(ofixSession session);
 extern ofixMsg	ofix_session_create_msg(ofixErr err, ofixSession session, const char *type);
 extern void	ofix_session_set_heartbeat(ofixSession session, int interval);
 
+/**
+ * Sends are written from a queue. By default a send is written at once and
+ * sends made while another thread is writing are gathered into its next
+ * write. With a delay, a send is held up to __usec__ microseconds so that
+ * later sends can go out in the same write. Held sends are written by the
+ * thread reading the session. The wait is as fine as that thread's timer,
+ * one millisecond for an epoll reactor.
+ *
+ * @param session session to set the delay for
+ * @param usec microseconds to hold sends, 0 to write them at once
+ */
+extern void	ofix_session_set_send_delay(ofixSession session, int usec);
+
+/**
+ * Sets how inbound messages are validated. Validation is off by default so
+ * user defined tags and counterparties that add tags reach the receive
+ * callback. __OFIX_VALIDATE_STRICT__ rejects any tag that is not defined for
+ * the message type with __OFIX_REASON_WRONG_TAG__.
+ *
+ * @param session session to set the validation of
+ * @param mode how much to validate
+ */
+extern void	ofix_session_set_validate(ofixSession session, ofixValidate mode);
+
+/**
+ * Experimental. Turns on a busy polling mode for a session with its own
+ * thread, such as a client session. Instead of waiting in select() the
+ * thread spins on a non-blocking socket with SO_BUSY_POLL, TCP_NODELAY, and
+ * TCP_QUICKACK set, and checks heartbeats when the coarse clock moves. Sends
+ * from other threads are picked up on the next spin without a wake. The
+ * thread keeps its core busy all the time it is connected. Takes effect the
+ * next time the session connects. The mode has no effect on sessions run by
+ * an engine reactor.
+ *
+ * The mode is only meant for a session thread pinned to a core reserved for
+ * it. Sharing the core with other threads is slower than select() since the
+ * spin takes the core from them. The latency_benchmark() in test/speed.c can
+ * be used to compare the modes on a given machine.
+ *
+ * @param session session to set the mode of
+ * @param on true to spin on the socket
+ * @param cpu core to pin the session thread to, -1 to leave it unpinned
+ */
+extern void	ofix_session_set_busy_poll(ofixSession session, bool on, int cpu);
+
 #endif /* __OFIX_SESSION_H__ */
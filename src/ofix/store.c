@@ -1,19 +1,28 @@
 // Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
 
+#define _GNU_SOURCE
+#include <errno.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sched.h>
 #include <stdlib.h>
 #include <string.h>
-#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <time.h>
+#include <unistd.h>
 
 #include "store.h"
 #include "engine.h"
-
-#define LOCS_INC	4096
+#include "private.h"
 
 Store
 ofix_store_create(ofixErr err, const char *path, const char *id) {
     char	buf[1024];
+    char	header[256];
     Store	s;
+    void	*map;
+    int		len;
 
     if (NULL != err && OFIX_OK != err->code) {
 	return NULL;
@@ -40,92 +49,365 @@ ofix_store_create(ofixErr err, const char *path, const char *id) {
 	}
 	return NULL;
     }
-    s->sindex.size = LOCS_INC;
-    s->rindex.size = LOCS_INC;
-    if (NULL == (s->sindex.locs = (Loc)malloc(sizeof(struct _Loc) * LOCS_INC))) {
+    memset(s, 0, sizeof(struct _Store));
+    if (0 > (s->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644))) {
 	if (NULL != err) {
-	    err->code = OFIX_MEMORY_ERR;
-	    strcpy(err->msg, "Failed to allocate memory for session store index.");
+	    err->code = OFIX_WRITE_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to create file '%.160s'. %s",
+		     path, strerror(errno));
 	}
 	free(s);
 	return NULL;
     }
-    if (NULL == (s->rindex.locs = (Loc)malloc(sizeof(struct _Loc) * LOCS_INC))) {
+    len = snprintf(header, sizeof(header), "sender: %s\n\n", id);
+    if (len != write(s->fd, header, len)) {
 	if (NULL != err) {
-	    err->code = OFIX_MEMORY_ERR;
-	    strcpy(err->msg, "Failed to allocate memory for session store index.");
+	    err->code = OFIX_WRITE_ERR;
+	    strcpy(err->msg, "Failed to write header.");
 	}
-	free(s->sindex.locs);
+	close(s->fd);
 	free(s);
 	return NULL;
     }
-    if (NULL == (s->file = fopen(path, "w+"))) {
+    s->where = len;
+    s->committed = len;
+    // Readers use the mapping so they never share a file position with the
+    // writer.
+    if (MAP_FAILED == (map = mmap(NULL, OFIX_STORE_MAP_SIZE, PROT_READ, MAP_SHARED, s->fd, 0)) ||
+	0 != pthread_mutex_init(&s->map_mutex, 0)) {
 	if (NULL != err) {
-	    err->code = OFIX_WRITE_ERR;
-	    snprintf(err->msg, sizeof(err->msg), "Failed to create file '%s'. %s",
-		     path, strerror(errno));
+	    err->code = OFIX_MEMORY_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to map file '%.160s'. %s", path, strerror(errno));
+	}
+	if (MAP_FAILED != map) {
+	    munmap(map, OFIX_STORE_MAP_SIZE);
 	}
-	free(s->sindex.locs);
+	close(s->fd);
 	free(s);
 	return NULL;
     }
-    s->where = fprintf(s->file, "sender: %s\n\n", id);
-    if (0 >= s->where) {
+    s->map = (const char*)map;
+    s->map_size = OFIX_STORE_MAP_SIZE;
+
+    return s;
+}
+
+static Store
+journal_store(ofixErr err, const char *dir, const char *id, bool reuse) {
+    Store	s;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (NULL == (s = (Store)malloc(sizeof(struct _Store)))) {
 	if (NULL != err) {
-	    err->code = OFIX_WRITE_ERR;
-	    strcpy(err->msg, "Failed to write header.");
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for session storage.");
 	}
-	free(s->sindex.locs);
+	return NULL;
+    }
+    memset(s, 0, sizeof(struct _Store));
+    s->fd = -1;
+    if (reuse) {
+	s->journal = ofix_journal_open(err, dir, id, 0);
+    } else {
+	s->journal = ofix_journal_create(err, dir, id, 0);
+    }
+    if (NULL == s->journal) {
 	free(s);
 	return NULL;
     }
     return s;
 }
 
+Store
+ofix_store_create_journal(ofixErr err, const char *dir, const char *id) {
+    return journal_store(err, dir, id, false);
+}
+
+Store
+ofix_store_open(ofixErr err, const char *dir, const char *id, int64_t *sent_seq, int64_t *recv_seq) {
+    Store	s = journal_store(err, dir, id, true);
+
+    if (NULL != s) {
+	if (NULL != sent_seq) {
+	    *sent_seq = ofix_journal_last_seq(s->journal, 0, OFIX_IODIR_SEND);
+	}
+	if (NULL != recv_seq) {
+	    *recv_seq = ofix_journal_last_seq(s->journal, 0, OFIX_IODIR_RECV);
+	}
+    }
+    return s;
+}
+
+Store
+ofix_store_create_shared(ofixErr err, Journal journal, const char *name, bool resume, int64_t *sent_seq, int64_t *recv_seq) {
+    Store	s;
+    int		sid;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (NULL == journal) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "NULL journal argument to shared store creation is not valid.");
+	}
+	return NULL;
+    }
+    if (0 > (sid = ofix_journal_session(err, journal, name, !resume))) {
+	return NULL;
+    }
+    if (NULL == (s = (Store)malloc(sizeof(struct _Store)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for session storage.");
+	}
+	return NULL;
+    }
+    memset(s, 0, sizeof(struct _Store));
+    s->fd = -1;
+    s->journal = journal;
+    s->sid = sid;
+    s->shared = true;
+    if (NULL != sent_seq) {
+	*sent_seq = ofix_journal_last_seq(journal, sid, OFIX_IODIR_SEND);
+    }
+    if (NULL != recv_seq) {
+	*recv_seq = ofix_journal_last_seq(journal, sid, OFIX_IODIR_RECV);
+    }
+    return s;
+}
+
 void
 ofix_store_destroy(Store store) {
     if (NULL != store) {
-	if (NULL != store->file) {
-	    fclose(store->file);
+	Loc	*pp;
+
+	if (!store->shared) {
+	    ofix_journal_destroy(store->journal);
+	}
+	if (NULL != store->map) {
+	    StoreMap	old;
+
+	    munmap((void*)store->map, store->map_size);
+	    while (NULL != (old = store->old_maps)) {
+		store->old_maps = old->next;
+		munmap((void*)old->base, old->size);
+		free(old);
+	    }
+	    pthread_mutex_destroy(&store->map_mutex);
+	}
+	if (0 <= store->fd) {
+	    close(store->fd);
 	}
-	if (NULL != store->sindex.locs) {
-	    free(store->sindex.locs);
+	for (pp = store->sindex.pages; pp < store->sindex.pages + OFIX_STORE_MAX_PAGES; pp++) {
+	    free(*pp);
 	}
-	if (NULL != store->rindex.locs) {
-	    free(store->rindex.locs);
+	for (pp = store->rindex.pages; pp < store->rindex.pages + OFIX_STORE_MAX_PAGES; pp++) {
+	    free(*pp);
 	}
 	free(store);
     }
 }
 
+void
+ofix_store_set_durability(ofixErr err, Store store, ofixSyncPolicy policy, int n) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == store || NULL == store->journal) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Durability policies require a journal store.");
+	}
+	return;
+    }
+    if (store->shared) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "The durability policy of a shared journal is set by its owner.");
+	}
+	return;
+    }
+    ofix_journal_start_writer(err, store->journal, policy, n);
+}
+
+bool
+ofix_store_wait_durable(ofixErr err, Store store, int64_t seq, IoDir dir, double timeout) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    if (NULL == store || NULL == store->journal) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Durability policies require a journal store.");
+	}
+	return false;
+    }
+    return ofix_journal_wait_durable(err, store->journal, store->sid, seq, dir, timeout);
+}
+
+static Loc
+index_get(Index index, int64_t seq) {
+    Loc	page;
+    Loc	loc;
+
+    if (0 >= seq || OFIX_STORE_MAX_PAGES * OFIX_STORE_PAGE_SIZE <= seq) {
+	return NULL;
+    }
+    if (NULL == (page = __atomic_load_n(&index->pages[seq / OFIX_STORE_PAGE_SIZE], __ATOMIC_ACQUIRE))) {
+	return NULL;
+    }
+    loc = page + seq % OFIX_STORE_PAGE_SIZE;
+    if (0 == __atomic_load_n(&loc->size, __ATOMIC_ACQUIRE)) {
+	return NULL;
+    }
+    return loc;
+}
+
 static void
 index_add(ofixErr err, Index index, int64_t seq, off_t where, off_t len) {
+    Loc	*pp;
+    Loc	page;
     Loc	loc;
 
-    if (index->size <= seq) {
-	int64_t	new_size = index->size + LOCS_INC;
-	
-	if (new_size - 100 <= seq) {
-	    new_size = seq + LOCS_INC;
+    if (0 >= seq || OFIX_STORE_MAX_PAGES * OFIX_STORE_PAGE_SIZE <= seq) {
+	if (NULL != err) {
+	    err->code = OFIX_OVERFLOW_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Sequence number %lld is out of range for the store.", (long long)seq);
 	}
-	if (NULL == (index->locs = (Loc)realloc(index->locs, sizeof(struct _Loc) * new_size))) {
+	return;
+    }
+    pp = index->pages + seq / OFIX_STORE_PAGE_SIZE;
+    if (NULL == (page = __atomic_load_n(pp, __ATOMIC_ACQUIRE))) {
+	Loc	expect = NULL;
+
+	if (NULL == (page = (Loc)calloc(OFIX_STORE_PAGE_SIZE, sizeof(struct _Loc)))) {
 	    if (NULL != err) {
 		err->code = OFIX_MEMORY_ERR;
 		strcpy(err->msg, "Failed to allocate memory for session store index.");
 	    }
 	    return;
 	}
-	memset(index->locs + index->size, 0, sizeof(struct _Loc) * (new_size - index->size));
+	if (!__atomic_compare_exchange_n(pp, &expect, page, false, __ATOMIC_RELEASE, __ATOMIC_ACQUIRE)) {
+	    // another writer added the page first
+	    free(page);
+	    page = expect;
+	}
     }
-    loc = index->locs + seq;
+    loc = page + seq % OFIX_STORE_PAGE_SIZE;
     loc->start = where;
-    loc->size = len;
+    // size last, a non-zero size marks the location as set
+    __atomic_store_n(&loc->size, len, __ATOMIC_RELEASE);
+}
+
+// Grows the mapping of a file store to cover end. The mapping is extended
+// in place when the address space after it is free. Otherwise a larger
+// mapping is made elsewhere and the old one is kept for readers that are
+// still using it.
+static bool
+map_cover(ofixErr err, Store store, off_t end) {
+    StoreMap	old;
+    void	*m;
+    off_t	size;
+    bool	ok = true;
+
+    if (end <= __atomic_load_n(&store->map_size, __ATOMIC_ACQUIRE)) {
+	return true;
+    }
+    pthread_mutex_lock(&store->map_mutex);
+    for (size = store->map_size; size < end; size *= 2) {
+    }
+    if (size == store->map_size) {
+	// grown by another add
+    } else if (MAP_FAILED != mremap((void*)store->map, store->map_size, size, 0)) {
+	__atomic_store_n(&store->map_size, size, __ATOMIC_RELEASE);
+    } else if (NULL == (old = (StoreMap)malloc(sizeof(struct _StoreMap))) ||
+	       MAP_FAILED == (m = mmap(NULL, size, PROT_READ, MAP_SHARED, store->fd, 0))) {
+	free(old);
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to grow the store mapping. %s", strerror(errno));
+	}
+	ok = false;
+    } else {
+	old->base = store->map;
+	old->size = store->map_size;
+	old->next = store->old_maps;
+	store->old_maps = old;
+	// the mapping is published before the size that says it is big enough
+	__atomic_store_n(&store->map, (const char*)m, __ATOMIC_RELEASE);
+	__atomic_store_n(&store->map_size, size, __ATOMIC_RELEASE);
+    }
+    pthread_mutex_unlock(&store->map_mutex);
+
+    return ok;
+}
+
+// Moves the committed end past every add that has been written, in order.
+// The add that finishes last moves it past the ones that finished before it
+// so no add waits on another.
+static void
+commit_advance(Store store) {
+    Commit	c;
+    off_t	committed;
+    off_t	end;
+
+    while (true) {
+	committed = __atomic_load_n(&store->committed, __ATOMIC_SEQ_CST);
+	for (c = store->commits; c < store->commits + OFIX_STORE_COMMIT_SLOTS; c++) {
+	    if (committed == __atomic_load_n(&c->start, __ATOMIC_SEQ_CST)) {
+		break;
+	    }
+	}
+	// The add at the committed end is still being written or has not
+	// filled in its end yet. It moves the end along when it is done.
+	if (store->commits + OFIX_STORE_COMMIT_SLOTS <= c || 0 == (end = __atomic_load_n(&c->end, __ATOMIC_SEQ_CST))) {
+	    return;
+	}
+	if (__atomic_compare_exchange_n(&store->committed, &committed, end, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+	    __atomic_store_n(&c->end, 0, __ATOMIC_SEQ_CST);
+	    __atomic_store_n(&c->start, 0, __ATOMIC_SEQ_CST);
+	}
+    }
+}
+
+// Marks the bytes from start to end as written and moves the committed end
+// as far as it can go.
+static void
+commit(Store store, off_t start, off_t end) {
+    Commit	c;
+    off_t	expect;
+
+    while (true) {
+	// The add at the committed end needs no slot so it can never be
+	// starved by later adds filling the table.
+	expect = start;
+	if (__atomic_compare_exchange_n(&store->committed, &expect, end, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+	    commit_advance(store);
+	    return;
+	}
+	for (c = store->commits; c < store->commits + OFIX_STORE_COMMIT_SLOTS; c++) {
+	    expect = 0;
+	    if (__atomic_compare_exchange_n(&c->start, &expect, start, false, __ATOMIC_SEQ_CST, __ATOMIC_SEQ_CST)) {
+		__atomic_store_n(&c->end, end, __ATOMIC_SEQ_CST);
+		commit_advance(store);
+		return;
+	    }
+	}
+	// Only with more adds written and waiting than there are slots, until
+	// the earliest add moves the committed end.
+	sched_yield();
+    }
 }
 
 void
 ofix_store_add(ofixErr err, Store store, int64_t seq, IoDir dir, ofixMsg msg) {
     const char*	mstr = NULL;
     off_t	mlen = 0;
+    off_t	where;
+    bool	written = false;
 
     if (NULL != err && OFIX_OK != err->code) {
 	return;
@@ -144,7 +426,7 @@ ofix_store_add(ofixErr err, Store store, int64_t seq, IoDir dir, ofixMsg msg) {
 	}
 	return;
     }
-    if (NULL == store->file) {
+    if (0 > store->fd && NULL == store->journal) {
 	if (NULL != err) {
 	    err->code = OFIX_ARG_ERR;
 	    strcpy(err->msg, "No storage setup for session.");
@@ -156,177 +438,608 @@ ofix_store_add(ofixErr err, Store store, int64_t seq, IoDir dir, ofixMsg msg) {
     if (NULL != err && OFIX_OK != err->code) {
 	return;
     }
-    if (mlen != fwrite(mstr, 1, mlen, store->file) ||
-	1 != fwrite("\n", 1, 1, store->file)) {
-	fclose(store->file);
-	store->file = NULL;
+    if (NULL != store->journal) {
+	ofix_journal_add(err, store->journal, store->sid, seq, dir, mstr, (int)mlen);
+	return;
+    }
+    // Reserve the space first so concurrent adds never write over each other.
+    where = __atomic_fetch_add(&store->where, mlen + 1, __ATOMIC_RELAXED);
+    if (!map_cover(err, store, where + mlen + 1)) {
+	// err already set
+    } else if (mlen != pwrite(store->fd, mstr, mlen, where) ||
+	       1 != pwrite(store->fd, "\n", 1, where + mlen)) {
 	if (NULL != err) {
 	    err->code = OFIX_WRITE_ERR;
 	    strcpy(err->msg, "Failed to store message.");
 	}
+    } else {
+	written = true;
+    }
+    // The committed end is only moved past this add once the earlier adds
+    // are written too, so iterating never sees a gap. A failed add is
+    // committed as well so it does not hold up the ones after it.
+    commit(store, where, where + mlen + 1);
+    if (!written) {
 	return;
     }
+    // The bytes are written and mapped so the message can be read before
+    // the committed end reaches it.
     switch (dir) {
     case OFIX_IODIR_SEND:
-	index_add(err, &store->sindex, seq, store->where, mlen);
+	index_add(err, &store->sindex, seq, where, mlen);
 	break;
     case OFIX_IODIR_RECV:
-	index_add(err, &store->rindex, seq, store->where, mlen);
+	index_add(err, &store->rindex, seq, where, mlen);
 	break;
     default:
 	// error
 	break;
     }
-    store->where += mlen + 1;
 }
 
 ofixMsg
 ofix_store_get(ofixErr err, Store store, int64_t seq, IoDir dir) {
-    ofixMsg	msg = NULL;
     Loc		loc = NULL;
-    char	buf[4096];
-    char	*mstr = buf;
-    
+
+    if (NULL == store) {
+	return NULL;
+    }
+    if (NULL != store->journal) {
+	const char	*str;
+	int		len;
+	ofixMsg		msg = NULL;
+	int64_t		pin = ofix_journal_pin(store->journal);
+
+	// The parse copies the bytes so the pin is only held while parsing.
+	if (NULL != (str = ofix_journal_get(err, store->journal, store->sid, seq, dir, &len))) {
+	    msg = ofix_msg_parse(err, str, len);
+	}
+	ofix_journal_unpin(store->journal, pin);
+
+	return msg;
+    }
     switch (dir) {
     case OFIX_IODIR_SEND:
-	if (seq < store->sindex.size) {
-	    loc = store->sindex.locs + seq;
-	}
+	loc = index_get(&store->sindex, seq);
 	break;
     case OFIX_IODIR_RECV:
-	if (seq < store->rindex.size) {
-	    loc = store->rindex.locs + seq;
-	}
+	loc = index_get(&store->rindex, seq);
 	break;
     default:
-	if (seq < store->sindex.size) {
-	    loc = store->sindex.locs + seq;
-	} else if (seq < store->rindex.size) {
-	    loc = store->rindex.locs + seq;
+	if (NULL == (loc = index_get(&store->sindex, seq))) {
+	    loc = index_get(&store->rindex, seq);
 	}
 	break;
     }
-    if (NULL == loc || 0 == loc->start || 0 == loc->size) {
+    if (NULL == loc) {
 	return NULL;
     }
-    if (0 != fseek(store->file, loc->start, SEEK_SET)) {
-	if (NULL != err) {
-	    err->code = OFIX_READ_ERR;
-	    snprintf(err->msg, sizeof(err->msg), "Failed to find message. %s", strerror(errno));
+    return ofix_msg_parse(err, __atomic_load_n(&store->map, __ATOMIC_ACQUIRE) + loc->start, loc->size);
+}
+
+int
+ofix_store_get_range(ofixErr err, Store store, int64_t first, int64_t last, IoDir dir, MsgView views, int max) {
+    Index	index;
+    MsgView	v;
+    Loc		loc;
+    int		cnt;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return 0;
+    }
+    if (NULL == store || NULL == views || first > last) {
+	return 0;
+    }
+    cnt = (last - first + 1 < max) ? (int)(last - first + 1) : max;
+    if (NULL != store->journal) {
+	for (v = views; v < views + cnt; v++) {
+	    v->seq = first + (v - views);
+	    v->str = ofix_journal_get(err, store->journal, store->sid, v->seq, dir, &v->len);
 	}
-	return NULL;
+	return cnt;
     }
-    if (sizeof(buf) <= loc->size) {
-	if (NULL == (mstr = (char*)malloc(loc->size + 1))) {
-	    if (NULL != err) {
-		err->code = OFIX_MEMORY_ERR;
-		strcpy(err->msg, "Failed to allocate memory for message.");
-	    }
-	    return NULL;
+    index = (OFIX_IODIR_RECV == dir) ? &store->rindex : &store->sindex;
+    for (v = views; v < views + cnt; v++) {
+	v->seq = first + (v - views);
+	if (NULL == (loc = index_get(index, v->seq))) {
+	    v->str = NULL;
+	    v->len = 0;
+	} else {
+	    v->str = __atomic_load_n(&store->map, __ATOMIC_ACQUIRE) + loc->start;
+	    v->len = (int)loc->size;
 	}
     }
-    if (loc->size != fread(mstr, 1, loc->size, store->file)) {
-	if (NULL != err) {
-	    err->code = OFIX_READ_ERR;
-	    snprintf(err->msg, sizeof(err->msg), "Failed to read message. %s", strerror(errno));
+    return cnt;
+}
+
+int64_t
+ofix_store_pin(Store store) {
+    if (NULL == store || NULL == store->journal) {
+	return 0;
+    }
+    return ofix_journal_pin(store->journal);
+}
+
+void
+ofix_store_unpin(Store store, int64_t pin) {
+    if (NULL != store && NULL != store->journal) {
+	ofix_journal_unpin(store->journal, pin);
+    }
+}
+
+struct _JIterCtx {
+    ofixErr	err;
+    bool	(*cb)(ofixMsg msg, void *ctx);
+    void	*ctx;
+};
+
+static bool
+journal_iterate_cb(const char *str, int len, void *ctx) {
+    struct _JIterCtx	*jc = (struct _JIterCtx*)ctx;
+    ofixMsg		msg;
+
+    if (NULL == (msg = ofix_msg_parse(jc->err, str, len))) {
+	return false;
+    }
+    if (jc->cb(msg, jc->ctx)) {
+	ofix_msg_destroy(msg);
+    }
+    return true;
+}
+
+// Walks the mapped file store up to the committed end. Bytes past it may
+// still be in flight from other adds and are never read.
+static void
+map_iterate(ofixErr err, Store store, bool (*cb)(ofixMsg msg, void *ctx), void *ctx) {
+    off_t	committed = __atomic_load_n(&store->committed, __ATOMIC_ACQUIRE);
+    // loaded after the committed end so it covers it
+    const char	*b = __atomic_load_n(&store->map, __ATOMIC_ACQUIRE);
+    const char	*end = b + committed;
+    ofixMsg	msg;
+    int		len;
+
+    if (NULL == (b = strstr(b, "\n\n"))) {
+	return;
+    }
+    for (b += 2; b + 22 <= end; b += len + 1) {
+	if (0 >= (len = ofix_msg_expected_buf_size(b)) || end < b + len) {
+	    break;
+	}
+	if (NULL == (msg = ofix_msg_parse(err, b, len))) {
+	    return;
+	}
+	if (cb(msg, ctx)) {
+	    ofix_msg_destroy(msg);
 	}
-	return NULL;
     }
-    msg = ofix_msg_parse(err, mstr, loc->size);
-    if (0 != fseek(store->file, store->where, SEEK_SET)) {
+}
+
+void
+ofix_store_iterate(ofixErr err, Store store, bool (*cb)(ofixMsg msg, void *ctx), void *ctx) {
+    if (NULL != store->journal) {
+	struct _JIterCtx	jc = { err, cb, ctx };
+
+	ofix_journal_iterate(err, store->journal, store->sid, journal_iterate_cb, &jc);
+	return;
+    }
+    map_iterate(err, store, cb, ctx);
+}
+
+static bool
+journal_only(ofixErr err, Store store) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return false;
+    }
+    if (NULL == store || NULL == store->journal) {
 	if (NULL != err) {
-	    err->code = OFIX_READ_ERR;
-	    snprintf(err->msg, sizeof(err->msg), "Failed to reset storage. %s", strerror(errno));
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Secondary indexes require a journal store.");
 	}
+	return false;
+    }
+    return true;
+}
+
+void
+ofix_store_set_retention(ofixErr err, Store store, double roll_interval, int keep_segs, double keep_age) {
+    if (!journal_only(err, store)) {
+	return;
     }
-    if (buf != mstr) {
-	free(mstr);
+    if (store->shared) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "The retention policy of a shared journal is set by its owner.");
+	}
+	return;
     }
-    return msg;
+    ofix_journal_set_retention(err, store->journal, roll_interval, keep_segs, keep_age);
 }
 
 void
-ofix_store_iterate(ofixErr err, Store store, bool (*cb)(ofixMsg msg, void *ctx), void *ctx) {
-    if (0 != fseek(store->file, 0, SEEK_SET)) {
+ofix_store_set_compress(ofixErr err, Store store, bool on) {
+    if (!journal_only(err, store)) {
+	return;
+    }
+    if (store->shared) {
 	if (NULL != err) {
-	    err->code = OFIX_READ_ERR;
-	    snprintf(err->msg, sizeof(err->msg), "Failed to read storage. %s", strerror(errno));
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Compression of a shared journal is set by its owner.");
 	}
 	return;
     }
-    ofix_store_fiterate(err, store->file, cb, ctx);
-    if (0 != fseek(store->file, store->where, SEEK_SET)) {
+    ofix_journal_set_compress(err, store->journal, on);
+}
+
+void
+ofix_store_replicate(ofixErr err, Store store, const char *host, int port, bool sync) {
+    if (!journal_only(err, store)) {
+	return;
+    }
+    if (store->shared) {
 	if (NULL != err) {
-	    err->code = OFIX_READ_ERR;
-	    snprintf(err->msg, sizeof(err->msg), "Failed to reset storage. %s", strerror(errno));
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Replication of a shared journal is set by its owner.");
 	}
+	return;
     }
+    ofix_journal_replicate(err, store->journal, host, port, sync);
+}
+
+void
+ofix_store_index_tag(ofixErr err, Store store, int tag) {
+    if (journal_only(err, store)) {
+	ofix_journal_index_tag(err, store->journal, tag);
+    }
+}
+
+int
+ofix_store_find(ofixErr err, Store store, int tag, const char *value, bool (*cb)(ofixMsg msg, void *ctx), void *ctx) {
+    struct _JIterCtx	jc = { err, cb, ctx };
+
+    if (!journal_only(err, store)) {
+	return 0;
+    }
+    return ofix_journal_find(err, store->journal, store->sid, tag, value, journal_iterate_cb, &jc);
+}
+
+int
+ofix_store_time_range(ofixErr err, Store store, int64_t start, int64_t end, bool (*cb)(ofixMsg msg, void *ctx), void *ctx) {
+    struct _JIterCtx	jc = { err, cb, ctx };
+
+    if (!journal_only(err, store)) {
+	return 0;
+    }
+    return ofix_journal_time_range(err, store->journal, store->sid, start, end, journal_iterate_cb, &jc);
 }
 
 void
 ofix_store_fiterate(ofixErr err, FILE *f, bool (*cb)(ofixMsg msg, void *ctx), void *ctx) {
-    ofixMsg	msg;
-    char	buf[4096];
-    char	*b;
-    char	*end = buf;
-    size_t	cnt;
-    int		rcnt = 0;
-
-    for (b = buf; 2 > rcnt; b++) {
-	if (end <= b) {
-	    if (0 == (cnt = fread(buf, 1, sizeof(buf), f))) {
-		// short
-		return;
+    struct _ofixFrame	frames[16];
+    ofixFramer		fr;
+    ofixFrame		fp;
+    ofixMsg		msg;
+    char		*b;
+    size_t		space;
+    size_t		cnt;
+    int			fcnt;
+
+    // The header that ends with a blank line is skipped by the framer along
+    // with the newline after each message.
+    if (NULL == (fr = ofix_framer_create(err, false))) {
+	return;
+    }
+    while (true) {
+	b = ofix_framer_space(fr, &space);
+	if (0 == (cnt = fread(b, 1, space, f))) {
+	    break;
+	}
+	ofix_framer_commit(fr, cnt);
+	while (0 < (fcnt = ofix_framer_pull(err, fr, frames, sizeof(frames) / sizeof(*frames)))) {
+	    for (fp = frames; 0 < fcnt; fcnt--, fp++) {
+		if (NULL == (msg = ofix_msg_parse(err, fp->str, fp->len))) {
+		    goto DONE;
+		}
+		if (cb(msg, ctx)) {
+		    ofix_msg_destroy(msg);
+		}
 	    }
-	    b = buf;
-	    end = buf + cnt;
 	}
-	if ('\n' == *b) {
-	    rcnt++;
-	} else {
-	    rcnt = 0;
+	if (NULL != err && OFIX_OK != err->code) {
+	    break;
 	}
     }
-    while (true) {
-	// need at least 22 bytes to read the expected message length
-	if (22 > end - b) {
-	    cnt = end - b;
-	    memmove(buf, b, cnt);
-	    end = buf + cnt;
-	    b = buf;
-	    if (0 == (cnt = fread(end, 1, sizeof(buf) - cnt, f))) {
-		return;
-	    }
-	    end += cnt;
-	}
-	cnt = ofix_msg_expected_buf_size(b);
-	if (end - b < cnt + 1) {
-	    // If the buf is not big enough then error out for now.
-	    if (sizeof(buf) < cnt + 1) {
-		if (NULL != err) {
-		    err->code = OFIX_OVERFLOW_ERR;
-		    strcpy(err->msg, "Not enough space to read message.");
-		}
-		return;
+DONE:
+    ofix_framer_destroy(fr);
+}
+
+// A range of a store file parsed by one worker. With ordered delivery the
+// parsed messages are held until the caller's thread reaches the chunk.
+typedef struct _Chunk {
+    const char		*start;
+    const char		*end;
+    ofixMsg		*msgs;
+    int			cnt;
+    int			max;
+    bool		ready;
+} *Chunk;
+
+typedef struct _Replay {
+    Chunk		chunks;
+    int			chunk_cnt;
+    int			next;		// next chunk to parse
+    int			delivered;	// chunks delivered in order
+    int			window;		// chunks parsed ahead of delivery
+    bool		ordered;
+    bool		(*cb)(ofixMsg msg, void *ctx);
+    void		*ctx;
+    pthread_mutex_t	mutex;
+    pthread_cond_t	cond;
+    struct _ofixErr	err;
+    volatile bool	failed;
+} *Replay;
+
+// Returns the first message start at or after b. A message start is an
+// "8=FIX" at the start of a line with a BodyLength that leads to a CheckSum
+// field and the newline written after each stored message.
+static const char*
+msg_start(const char *b, const char *end) {
+    const char	*nl;
+    int		len;
+
+    for (b--; b < end && NULL != (nl = (const char*)memchr(b, '\n', end - b)); ) {
+	b = nl + 1;
+	if (end < b + 22 || 0 != strncmp(b, "8=FIX", 5)) {
+	    continue;
+	}
+	len = ofix_msg_expected_buf_size(b);
+	if (0 < len && b + len < end && '\n' == b[len] && 0 == strncmp(b + len - 7, "10=", 3)) {
+	    return b;
+	}
+    }
+    return end;
+}
+
+static void
+replay_fail(Replay r, ofixErr err) {
+    pthread_mutex_lock(&r->mutex);
+    if (!r->failed) {
+	r->err = *err;
+	r->failed = true;
+    }
+    pthread_cond_broadcast(&r->cond);
+    pthread_mutex_unlock(&r->mutex);
+}
+
+static void
+replay_chunk(Replay r, Chunk c) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    const char		*b;
+    ofixMsg		msg;
+    int			len;
+
+    for (b = c->start; b + 22 <= c->end; b += len + 1) {
+	// a message still being written at the end has no valid BodyLength
+	if (0 >= (len = ofix_msg_expected_buf_size(b)) || c->end < b + len) {
+	    break;
+	}
+	if (NULL == (msg = ofix_msg_parse(&err, b, len))) {
+	    replay_fail(r, &err);
+	    break;
+	}
+	if (!r->ordered) {
+	    if (r->cb(msg, r->ctx)) {
+		ofix_msg_destroy(msg);
 	    }
-	    if (sizeof(buf) < (b - buf) + cnt + 1) {
-		rcnt = end - b;
-		memmove(buf, b, rcnt);
-		end = buf + rcnt;
-		b = buf;
+	    continue;
+	}
+	if (c->max <= c->cnt) {
+	    int		max = (0 == c->max) ? 1024 : c->max * 2;
+	    ofixMsg	*msgs = (ofixMsg*)realloc(c->msgs, max * sizeof(ofixMsg));
+
+	    if (NULL == msgs) {
+		err.code = OFIX_MEMORY_ERR;
+		strcpy(err.msg, "Failed to allocate memory for replay.");
+		ofix_msg_destroy(msg);
+		replay_fail(r, &err);
+		break;
 	    }
-	    if (0 == (rcnt = fread(end, 1, sizeof(buf) - (end - buf), f))) {
-		return;
+	    c->msgs = msgs;
+	    c->max = max;
+	}
+	c->msgs[c->cnt++] = msg;
+    }
+}
+
+static void*
+replay_loop(void *arg) {
+    Replay	r = (Replay)arg;
+    Chunk	c;
+
+    while (true) {
+	pthread_mutex_lock(&r->mutex);
+	if (r->failed || r->chunk_cnt <= r->next) {
+	    pthread_mutex_unlock(&r->mutex);
+	    break;
+	}
+	c = r->chunks + r->next++;
+	// Parsed messages are held until delivered so stay within a window
+	// of the delivered chunks.
+	while (r->ordered && !r->failed && r->delivered + r->window <= c - r->chunks) {
+	    pthread_cond_wait(&r->cond, &r->mutex);
+	}
+	pthread_mutex_unlock(&r->mutex);
+	if (!r->failed) {
+	    replay_chunk(r, c);
+	}
+	pthread_mutex_lock(&r->mutex);
+	c->ready = true;
+	pthread_cond_broadcast(&r->cond);
+	pthread_mutex_unlock(&r->mutex);
+    }
+    return NULL;
+}
+
+// Makes the callbacks for each chunk in order as the workers finish them.
+static void
+replay_deliver(Replay r) {
+    Chunk	c;
+    int		i;
+
+    for (c = r->chunks; c < r->chunks + r->chunk_cnt; c++) {
+	pthread_mutex_lock(&r->mutex);
+	// A chunk not taken by a worker before a failure is never parsed.
+	while (!c->ready && !(r->failed && r->next <= c - r->chunks)) {
+	    pthread_cond_wait(&r->cond, &r->mutex);
+	}
+	pthread_mutex_unlock(&r->mutex);
+	if (!c->ready || r->failed) {
+	    break;
+	}
+	for (i = 0; i < c->cnt; i++) {
+	    if (r->cb(c->msgs[i], r->ctx)) {
+		ofix_msg_destroy(c->msgs[i]);
 	    }
-	    end += rcnt;
 	}
-	if (NULL == (msg = ofix_msg_parse(err, b, cnt))) {
-	    return;
+	free(c->msgs);
+	c->msgs = NULL;
+	c->cnt = 0;
+	pthread_mutex_lock(&r->mutex);
+	r->delivered++;
+	pthread_cond_broadcast(&r->cond);
+	pthread_mutex_unlock(&r->mutex);
+    }
+    // let waiting workers finish if delivery stopped early
+    pthread_mutex_lock(&r->mutex);
+    r->delivered = r->chunk_cnt;
+    pthread_cond_broadcast(&r->cond);
+    pthread_mutex_unlock(&r->mutex);
+}
+
+void
+ofix_store_piterate(ofixErr err,
+		    const char *path,
+		    int threads,
+		    bool ordered,
+		    bool (*cb)(ofixMsg msg, void *ctx),
+		    void *ctx) {
+    struct _Replay	r;
+    struct stat		st;
+    pthread_t		*workers;
+    const char		*map;
+    const char		*b;
+    const char		*end;
+    int			fd;
+    int			started;
+    int			i;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    if (NULL == path || NULL == cb) {
+	if (NULL != err) {
+	    err->code = OFIX_ARG_ERR;
+	    strcpy(err->msg, "Invalid argument to store parallel iterate.");
 	}
-	if (cb(msg, ctx)) {
-	    ofix_msg_destroy(msg);
+	return;
+    }
+    if (0 >= threads && 0 >= (threads = (int)sysconf(_SC_NPROCESSORS_ONLN))) {
+	threads = 1;
+    }
+    if (0 > (fd = open(path, O_RDONLY))) {
+	if (NULL != err) {
+	    err->code = OFIX_READ_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to open file '%s'. %s", path, strerror(errno));
+	}
+	return;
+    }
+    if (0 != fstat(fd, &st) || 0 == st.st_size) {
+	close(fd);
+	return;
+    }
+    map = (const char*)mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (MAP_FAILED == map) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to map file '%s'. %s", path, strerror(errno));
+	}
+	return;
+    }
+    // each worker reads its range front to back
+    madvise((void*)map, st.st_size, MADV_SEQUENTIAL);
+    end = map + st.st_size;
+    for (b = map; b + 1 < end && ('\n' != *b || '\n' != b[1]); b++) {
+    }
+    if (end <= b + 1) {
+	munmap((void*)map, st.st_size);
+	return;
+    }
+    b += 2;
+
+    memset(&r, 0, sizeof(r));
+    r.ordered = ordered;
+    r.cb = cb;
+    r.ctx = ctx;
+    r.window = threads * 2;
+    // Several chunks per thread so uneven chunks still balance.
+    r.chunk_cnt = (int)((end - b) / OFIX_STORE_CHUNK_SIZE) + 1;
+    if (r.chunk_cnt < threads * 4) {
+	r.chunk_cnt = threads * 4;
+    }
+    r.chunks = (Chunk)calloc(r.chunk_cnt, sizeof(struct _Chunk));
+    workers = (pthread_t*)calloc(threads, sizeof(pthread_t));
+    if (NULL == r.chunks || NULL == workers) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    strcpy(err->msg, "Failed to allocate memory for replay.");
 	}
-	b += cnt;
-	b++; // past \n
+	free(r.chunks);
+	free(workers);
+	munmap((void*)map, st.st_size);
+	return;
+    }
+    for (i = 0; i < r.chunk_cnt; i++) {
+	r.chunks[i].start = b;
+	if (i == r.chunk_cnt - 1) {
+	    b = end;
+	} else if (b < map + (int64_t)st.st_size * (i + 1) / r.chunk_cnt) {
+	    b = msg_start(map + (int64_t)st.st_size * (i + 1) / r.chunk_cnt, end);
+	}
+	r.chunks[i].end = b;
+    }
+    pthread_mutex_init(&r.mutex, 0);
+    pthread_cond_init(&r.cond, 0);
+    for (started = 0; started < threads; started++) {
+	if (0 != pthread_create(workers + started, NULL, replay_loop, &r)) {
+	    break;
+	}
+    }
+    if (0 == started) {
+	// no threads to be had so parse on this one
+	r.window = r.chunk_cnt;
+	replay_loop(&r);
+    }
+    if (ordered) {
+	replay_deliver(&r);
+    }
+    for (i = 0; i < started; i++) {
+	pthread_join(workers[i], NULL);
+    }
+    for (i = 0; i < r.chunk_cnt; i++) {
+	Chunk	c = r.chunks + i;
+	int	k;
+
+	for (k = 0; k < c->cnt; k++) {
+	    ofix_msg_destroy(c->msgs[k]);
+	}
+	free(c->msgs);
+    }
+    if (r.failed && NULL != err) {
+	*err = r.err;
     }
+    pthread_mutex_destroy(&r.mutex);
+    pthread_cond_destroy(&r.cond);
+    free(r.chunks);
+    free(workers);
+    munmap((void*)map, st.st_size);
 }
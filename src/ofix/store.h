@@ -3,40 +3,166 @@
 #ifndef __OFIX_STORE_H__
 #define __OFIX_STORE_H__
 
+#include <pthread.h>
 #include <stdio.h>
 #include <stdint.h>
+#include <sys/types.h>
 
 #include "err.h"
 #include "iodir.h"
+#include "journal.h"
 #include "msg.h"
 #include "role.h"
 
+#define OFIX_STORE_PAGE_SIZE	4096
+#define OFIX_STORE_MAX_PAGES	4096
+// Initial size of the read only mapping of a file store. The mapping is
+// doubled as the file grows.
+#define OFIX_STORE_MAP_SIZE	(4 * 1024 * 1024)
+// adds that can be written but not yet committed at once
+#define OFIX_STORE_COMMIT_SLOTS	64
+// target size of the ranges of a store file parsed by each replay worker
+#define OFIX_STORE_CHUNK_SIZE	(4 * 1024 * 1024)
+
 // location of message in store
 typedef struct _Loc {
     off_t	start;
     off_t	size;
 } *Loc;
 
+// Pages of locations are allocated as needed and never move so readers can
+// use them while the writer adds more.
 typedef struct _Index {
-    int64_t	size;
-    Loc		locs;
+    Loc		pages[OFIX_STORE_MAX_PAGES];
 } *Index;
 
+// A mapping of a file store that was replaced by a larger one at another
+// address. It is kept until the store is destroyed since readers may still
+// be using it.
+typedef struct _StoreMap {
+    const char		*base;
+    off_t		size;
+    struct _StoreMap	*next;
+} *StoreMap;
+
+// An add that has been written and is waiting for the adds before it to
+// finish so the committed end can be moved past it. A start of 0 marks a
+// free slot.
+typedef struct _Commit {
+    volatile off_t	start;
+    volatile off_t	end;
+} *Commit;
+
+// stored bytes of a message, str is NULL if there is no message for seq
+typedef struct _MsgView {
+    int64_t	seq;
+    const char	*str;
+    int		len;
+} *MsgView;
+
 typedef struct _Store {
-    FILE		*file;
-    off_t		where;
+    int			fd;
+    const char		*map;		// newest mapping of the file
+    volatile off_t	map_size;	// bytes covered by map
+    StoreMap		old_maps;
+    pthread_mutex_t	map_mutex;	// held while the mapping is grown
+    volatile off_t	where;		// end of the space reserved by writers
+    volatile off_t	committed;	// end of the bytes written, in order
+    struct _Commit	commits[OFIX_STORE_COMMIT_SLOTS];
     struct _Index	sindex;
     struct _Index	rindex;
+    Journal		journal;
+    int			sid;	// session id in a shared journal
+    bool		shared;	// journal is owned by the engine
 } *Store;
 
 extern Store		ofix_store_create(ofixErr err, const char *path, const char *id);
+// messages are kept in a memory mapped journal in the dir directory
+extern Store		ofix_store_create_journal(ofixErr err, const char *dir, const char *id);
+// reopens the journal in dir, sets the last stored send and recv sequence numbers
+extern Store		ofix_store_open(ofixErr err, const char *dir, const char *id, int64_t *sent_seq, int64_t *recv_seq);
+// Uses the session name in a journal shared by many sessions. If resume is
+// false the session starts with no stored messages. The journal is not
+// destroyed with the store.
+extern Store		ofix_store_create_shared(ofixErr err,
+						 Journal journal,
+						 const char *name,
+						 bool resume,
+						 int64_t *sent_seq,
+						 int64_t *recv_seq);
 extern void		ofix_store_destroy(Store store);
 
+// journal stores only, starts a writer thread that syncs per the policy
+extern void		ofix_store_set_durability(ofixErr err, Store store, ofixSyncPolicy policy, int n);
+extern bool		ofix_store_wait_durable(ofixErr err, Store store, int64_t seq, IoDir dir, double timeout);
+
 extern void		ofix_store_add(ofixErr err, Store store, int64_t seq, IoDir dir, ofixMsg msg);
 extern ofixMsg		ofix_store_get(ofixErr err, Store store, int64_t seq, IoDir dir);
 
+// Fills views with the stored bytes for first through last, at most max, and
+// returns the number filled. Views point into the mapped store. For a file
+// store they remain valid until the store is destroyed. For a journal store
+// they remain valid only while a pin from ofix_store_pin() taken before the
+// call is held, since journal maintenance releases closed segments.
+extern int		ofix_store_get_range(ofixErr err,
+					     Store store,
+					     int64_t first,
+					     int64_t last,
+					     IoDir dir,
+					     MsgView views,
+					     int max);
+
+// Pins a journal store so views stay valid until ofix_store_unpin() is called
+// with the returned token. A file store is never released so both are no-ops.
+extern int64_t		ofix_store_pin(Store store);
+extern void		ofix_store_unpin(Store store, int64_t pin);
+
 // if cb returns true then msg is destroyed after callback
 extern void		ofix_store_iterate(ofixErr err, Store store, bool (*cb)(ofixMsg msg, void *ctx), void *ctx);
 extern void		ofix_store_fiterate(ofixErr err, FILE *f, bool (*cb)(ofixMsg msg, void *ctx), void *ctx);
+// Replays a store file by parsing ranges of it on threads workers, 0 for
+// one per core. If ordered the callbacks are made on the calling thread in
+// file order, otherwise on the workers as messages are parsed so cb must be
+// thread safe.
+extern void		ofix_store_piterate(ofixErr err,
+					    const char *path,
+					    int threads,
+					    bool ordered,
+					    bool (*cb)(ofixMsg msg, void *ctx),
+					    void *ctx);
+
+// Journal stores only. Rolls segments by time as well as size and keeps at
+// most keep_segs segments no older than keep_age seconds, 0 for no limit.
+extern void		ofix_store_set_retention(ofixErr err,
+						 Store store,
+						 double roll_interval,
+						 int keep_segs,
+						 double keep_age);
+// Journal stores only. Compresses closed segments, see
+// ofix_journal_set_compress().
+extern void		ofix_store_set_compress(ofixErr err, Store store, bool on);
+// Journal stores only. Streams the journal to a follower, see
+// ofix_journal_replicate().
+extern void		ofix_store_replicate(ofixErr err, Store store, const char *host, int port, bool sync);
+
+// Journal stores only. Indexes messages by the value of tag so
+// ofix_store_find() does not have to scan the store.
+extern void		ofix_store_index_tag(ofixErr err, Store store, int tag);
+// Calls cb with each message with value for the indexed tag and returns the
+// number found. If cb returns true then msg is destroyed after callback.
+extern int		ofix_store_find(ofixErr err,
+					Store store,
+					int tag,
+					const char *value,
+					bool (*cb)(ofixMsg msg, void *ctx),
+					void *ctx);
+// Calls cb with each message sent or received from start through end,
+// nanoseconds since the epoch, and returns the number found.
+extern int		ofix_store_time_range(ofixErr err,
+					      Store store,
+					      int64_t start,
+					      int64_t end,
+					      bool (*cb)(ofixMsg msg, void *ctx),
+					      void *ctx);
 
 #endif /* __OFIX_STORE_H__ */
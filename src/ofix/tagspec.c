@@ -1,5 +1,7 @@
 // Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
 
+#include <string.h>
+
 #include "tagspec.h"
 
 const char *ofix_tag_spec_type_str(ofixTagSpec spec) {
@@ -35,3 +37,56 @@ const char *ofix_tag_spec_type_str(ofixTagSpec spec) {
     return "UnknownType";
 }
 
+
+static bool
+check_value(ofixEnumSpec es, const char *value, int len) {
+    if (NULL == es->values) {
+	uint8_t	c = (uint8_t)*value;
+
+	return 1 == len && 0 != ((es->chars[c >> 6] >> (c & 0x3F)) & 1ULL);
+    } else {
+	int	lo = 0;
+	int	hi = es->cnt - 1;
+
+	while (lo <= hi) {
+	    int		mid = (lo + hi) / 2;
+	    const char	*v = es->values[mid];
+	    int		vlen = strlen(v);
+	    int		cmp = memcmp(v, value, (vlen < len) ? vlen : len);
+
+	    if (0 == cmp) {
+		cmp = vlen - len;
+	    }
+	    if (0 == cmp) {
+		return true;
+	    } else if (cmp < 0) {
+		lo = mid + 1;
+	    } else {
+		hi = mid - 1;
+	    }
+	}
+    }
+    return false;
+}
+
+bool
+ofix_tag_spec_check_enum(ofixTagSpec spec, const char *value, int len) {
+    if (NULL == spec->enums) {
+	return true;
+    }
+    if (OFIX_MultipleValueString == spec->type) {
+	const char	*end = value + len;
+	const char	*sp;
+
+	for (; value < end; value = sp + 1) {
+	    if (NULL == (sp = (const char*)memchr(value, ' ', end - value))) {
+		sp = end;
+	    }
+	    if (!check_value(spec->enums, value, sp - value)) {
+		return false;
+	    }
+	}
+	return true;
+    }
+    return check_value(spec->enums, value, len);
+}
@@ -3,6 +3,9 @@
 #ifndef __OFIX_TAGSPEC_H__
 #define __OFIX_TAGSPEC_H__
 
+#include <stdbool.h>
+#include <stdint.h>
+
 /**
  * The tag type is denoted by one of these values.
  */
@@ -44,6 +47,17 @@ typedef enum {
     OFIX_Trailer	// A Trailer tag
 } ofixTagWhere;
 
+/**
+ * The valid values for a tag with enumerated values. When all values are a
+ * single character they are kept in the 256 bit chars bitmap. Otherwise the
+ * values are in a sorted array of strings.
+ */
+typedef struct _ofixEnumSpec {
+    uint64_t		chars[4];
+    int			cnt;
+    const char		**values;
+} *ofixEnumSpec;
+
 typedef struct _ofixTagSpec {
     int			tag;
     ofixTagType		type;
@@ -52,8 +66,21 @@ typedef struct _ofixTagSpec {
     int			tag_byte_len;
     char		*tag_bytes;
     char		*name;
+    ofixEnumSpec	enums; // NULL if not an enumerated tag
 } *ofixTagSpec;
 
 extern const char*	ofix_tag_spec_type_str(ofixTagSpec spec);
 
+/**
+ * Checks a value against the enumerated values of a tag. Tags without
+ * enumerated values accept any value. MultipleValueString values are checked
+ * one space separated value at a time.
+ *
+ * @param spec the tag specification to check against
+ * @param value the value to check, not necessarily NULL terminated
+ * @param len the length of the value
+ * @return true if the value is valid for the tag
+ */
+extern bool		ofix_tag_spec_check_enum(ofixTagSpec spec, const char *value, int len);
+
 #endif /* __OFIX_TAGSPEC_H__ */
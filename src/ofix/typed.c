@@ -0,0 +1,301 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "typed.h"
+
+#define SOH	'\1'
+
+static const int64_t	pow10s[] = {
+    1LL,
+    10LL,
+    100LL,
+    1000LL,
+    10000LL,
+    100000LL,
+    1000000LL,
+    10000000LL,
+    100000000LL,
+    1000000000LL,
+    10000000000LL,
+    100000000000LL,
+    1000000000000LL,
+    10000000000000LL,
+    100000000000000LL,
+    1000000000000000LL,
+    10000000000000000LL,
+    100000000000000000LL,
+    1000000000000000000LL,
+};
+
+static void
+set_format_error(ofixErr err, ofixTypedScan scan, int tag, const char *kind) {
+    char	buf[64];
+    int		len = scan->vlen;
+
+    if (NULL == err) {
+	return;
+    }
+    if ((int)sizeof(buf) - 1 < len) {
+	len = sizeof(buf) - 1;
+    }
+    memcpy(buf, scan->value, len);
+    buf[len] = '\0';
+    err->code = OFIX_PARSE_ERR;
+    err->reason = OFIX_REASON_BAD_FORMAT;
+    err->tag = tag;
+    snprintf(err->msg, sizeof(err->msg), "'%s' for tag %d can not be parsed as %s.", buf, tag, kind);
+}
+
+static bool
+group_has(const struct _ofixTypedGroup *g, int tag) {
+    const int	*t;
+
+    for (t = g->members; 0 != *t; t++) {
+	if (tag == *t) {
+	    return true;
+	}
+    }
+    return false;
+}
+
+// Closes the groups __tag__ is not part of, flags whether it is in a group,
+// and opens the group it is the count of, if any.
+static void
+scope(ofixTypedScan scan, int tag) {
+    const struct _ofixTypedGroup	*g;
+    int					parent;
+    int					i;
+
+    while (0 < scan->depth) {
+	g = scan->groups + scan->stack[scan->depth - 1];
+	if (tag == *g->members) {
+	    scan->entries[scan->depth - 1]++;
+	    break;
+	}
+	if (0 < scan->entries[scan->depth - 1] && group_has(g, tag)) {
+	    break;
+	}
+	scan->depth--;
+    }
+    scan->in_group = (0 < scan->depth);
+    parent = (0 < scan->depth) ? scan->stack[scan->depth - 1] : -1;
+    for (i = 0, g = scan->groups; i < scan->group_cnt; i++, g++) {
+	if (tag == g->num_tag && parent == g->parent) {
+	    if (scan->depth < OFIX_TYPED_GROUP_DEPTH) {
+		scan->stack[scan->depth] = i;
+		scan->entries[scan->depth] = 0;
+		scan->depth++;
+	    }
+	    break;
+	}
+    }
+}
+
+int
+ofix_typed_scan_next(ofixErr err, ofixTypedScan scan) {
+    const char	*b = scan->cur;
+    int		tag = 0;
+
+    if ((NULL != err && OFIX_OK != err->code) || scan->end <= b) {
+	return 0;
+    }
+    for (; b < scan->end && '0' <= *b && *b <= '9'; b++) {
+	tag = tag * 10 + (*b - '0');
+    }
+    if (scan->end <= b || '=' != *b || 0 == tag) {
+	if (NULL != err) {
+	    err->code = OFIX_PARSE_ERR;
+	    err->reason = OFIX_REASON_INVALID_TAG;
+	    snprintf(err->msg, sizeof(err->msg), "Invalid tag at position %ld.", (long)(b - scan->cur));
+	}
+	return 0;
+    }
+    b++; // past =
+    scan->value = b;
+    if (0 != scan->data_tag && tag == scan->data_tag) {
+	if (scan->end < b + scan->data_len) {
+	    if (NULL != err) {
+		err->code = OFIX_PARSE_ERR;
+		err->reason = OFIX_REASON_OTHER;
+		err->tag = tag;
+		strcpy(err->msg, "Unexpected end of message.");
+	    }
+	    return 0;
+	}
+	b += scan->data_len;
+	scan->data_tag = 0;
+	scan->data_len = 0;
+    } else {
+	const char	*soh = (const char*)memchr(b, SOH, scan->end - b);
+
+	if (NULL == soh) {
+	    if (NULL != err) {
+		err->code = OFIX_PARSE_ERR;
+		err->reason = OFIX_REASON_OTHER;
+		err->tag = tag;
+		strcpy(err->msg, "Unexpected end of message.");
+	    }
+	    return 0;
+	}
+	b = soh;
+    }
+    scan->vlen = (int)(b - scan->value);
+    scan->cur = b + 1;
+    if (0 < scan->group_cnt) {
+	scope(scan, tag);
+    }
+    return tag;
+}
+
+int64_t
+ofix_typed_scan_length(ofixErr err, ofixTypedScan scan, int data_tag) {
+    int64_t	len = ofix_typed_int(err, scan, 0);
+
+    if (NULL == err || OFIX_OK == err->code) {
+	scan->data_tag = data_tag;
+	scan->data_len = len;
+    }
+    return len;
+}
+
+int64_t
+ofix_typed_int(ofixErr err, ofixTypedScan scan, int tag) {
+    const char	*b = scan->value;
+    const char	*end = b + scan->vlen;
+    int64_t	num = 0;
+    bool	neg = false;
+
+    if (b < end && '-' == *b) {
+	neg = true;
+	b++;
+    }
+    if (end <= b) {
+	set_format_error(err, scan, tag, "an integer");
+	return 0;
+    }
+    for (; b < end; b++) {
+	if (*b < '0' || '9' < *b) {
+	    set_format_error(err, scan, tag, "an integer");
+	    return 0;
+	}
+	num = num * 10 + (*b - '0');
+    }
+    return neg ? -num : num;
+}
+
+void
+ofix_typed_decimal(ofixErr err, ofixTypedScan scan, int tag, ofixDecimal value) {
+    const char	*b = scan->value;
+    const char	*end = b + scan->vlen;
+    int64_t	num = 0;
+    int		scale = -1;
+    int		digits = 0;
+    bool	neg = false;
+
+    value->mantissa = 0;
+    value->scale = 0;
+    if (b < end && '-' == *b) {
+	neg = true;
+	b++;
+    }
+    for (; b < end; b++) {
+	if ('.' == *b) {
+	    if (0 <= scale) {
+		break;
+	    }
+	    scale = 0;
+	} else if ('0' <= *b && *b <= '9') {
+	    num = num * 10 + (*b - '0');
+	    digits++;
+	    if (0 <= scale) {
+		scale++;
+	    }
+	} else {
+	    break;
+	}
+    }
+    if (b != end || 0 == digits || 18 < digits) {
+	set_format_error(err, scan, tag, "a decimal");
+	return;
+    }
+    value->mantissa = neg ? -num : num;
+    value->scale = (0 < scale) ? scale : 0;
+}
+
+void
+ofix_typed_date(ofixErr err, ofixTypedScan scan, int tag, ofixDateType type, ofixDate value) {
+    if (!ofix_date_parse(value, type, scan->value, scan->vlen)) {
+	set_format_error(err, scan, tag, "a date or time");
+    }
+}
+
+double
+ofix_decimal_to_double(ofixDecimal value) {
+    if (0 >= value->scale) {
+	return (double)value->mantissa;
+    }
+    if ((int)(sizeof(pow10s) / sizeof(*pow10s)) <= value->scale) {
+	return 0.0;
+    }
+    return (double)value->mantissa / (double)pow10s[value->scale];
+}
+
+int
+ofix_decimal_to_str(ofixDecimal value, char *buf) {
+    char	tmp[32];
+    char	*t = tmp + sizeof(tmp);
+    char	*b = buf;
+    uint64_t	num;
+    int		scale = value->scale;
+    int		i;
+
+    if (value->mantissa < 0) {
+	*b++ = '-';
+	num = (uint64_t)-value->mantissa;
+    } else {
+	num = (uint64_t)value->mantissa;
+    }
+    // Fill backwards so the fraction digits come out first.
+    for (i = 0; 0 < num || i <= scale; i++) {
+	if (0 < scale && i == scale) {
+	    *--t = '.';
+	}
+	*--t = '0' + (char)(num % 10);
+	num /= 10;
+    }
+    memcpy(b, t, tmp + sizeof(tmp) - t);
+    b += tmp + sizeof(tmp) - t;
+    *b = '\0';
+
+    return (int)(b - buf);
+}
+
+void
+ofix_typed_set_int(ofixErr err, ofixMsg msg, int tag, int64_t value) {
+    char	buf[32];
+    int		len;
+
+    len = snprintf(buf, sizeof(buf), "%lld", (long long)value);
+    ofix_msg_set_data_only(err, msg, tag, buf, len);
+}
+
+void
+ofix_typed_set_decimal(ofixErr err, ofixMsg msg, int tag, ofixDecimal value) {
+    char	buf[32];
+    int		len = ofix_decimal_to_str(value, buf);
+
+    ofix_msg_set_data_only(err, msg, tag, buf, len);
+}
+
+void
+ofix_typed_set_char(ofixErr err, ofixMsg msg, int tag, char value) {
+    ofix_msg_set_data_only(err, msg, tag, &value, 1);
+}
+
+void
+ofix_typed_set_view(ofixErr err, ofixMsg msg, int tag, ofixStrView value) {
+    ofix_msg_set_data_only(err, msg, tag, value->str, value->len);
+}
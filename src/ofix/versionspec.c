@@ -1,5 +1,6 @@
 // Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
 
+#include <string.h>
 #include <strings.h>
 #include <stdio.h>
 #include <stdlib.h>
@@ -10,12 +11,42 @@ extern ofixVersionSpec	ofix_get_spec(ofixErr err, int major, int minor);
 
 static ofixTagSpec	create_dummy_tag_spec(int tag);
 
-static ofixTagSpec	*unknown_tags = 0;
-static int		unknown_tags_len = 0;
+// Unknown tags below OFIX_TAG_TABLE_SIZE share specs across all versions and
+// are filled in when the versions are prepared so the tag tables are never
+// written to after ofix_init().
+static struct _ofixTagSpec	unknown_table[OFIX_TAG_TABLE_SIZE];
+static char			unknown_bytes[OFIX_TAG_TABLE_SIZE][8];
+
+// Unknown tags above the table size are created on demand and published
+// with a compare and swap into an open addressed table so lookups never
+// lock. Slots are only ever filled, never emptied, until the specs are
+// destroyed.
+#define UNKNOWN_HIGH_SIZE	16384
+
+static ofixTagSpec	unknown_high[UNKNOWN_HIGH_SIZE];
+
+static ofixTagSpec
+unknown_table_spec(int tag) {
+    ofixTagSpec	spec = &unknown_table[tag];
+
+    if (0 == spec->tag) {
+	spec->tag = tag;
+	spec->type = OFIX_UnknownType;
+	spec->where = OFIX_Body;
+	spec->related_tag = 0;
+	spec->tag_byte_len = snprintf(unknown_bytes[tag], sizeof(unknown_bytes[tag]), "%d=", tag);
+	spec->tag_bytes = unknown_bytes[tag];
+	spec->name = "Unknown";
+	spec->enums = NULL;
+    }
+    return spec;
+}
+
+static int
+tag_spec_cmp(const void *a, const void *b) {
+    return (*(ofixTagSpec*)a)->tag - (*(ofixTagSpec*)b)->tag;
+}
 
-/**
- * 
- */
 void
 ofix_version_spec_prepare(ofixErr err, ofixVersionSpec spec) {
     ofixTagSpec	ts;
@@ -40,28 +71,55 @@ ofix_version_spec_prepare(ofixErr err, ofixVersionSpec spec) {
 	    spec->tag_table[ts->tag] = ts;
 	}
     }
+    for (i = 1, tsp = spec->tag_table + 1; i < OFIX_TAG_TABLE_SIZE; i++, tsp++) {
+	if (NULL == *tsp) {
+	    *tsp = unknown_table_spec(i);
+	}
+    }
+    spec->high_cnt = 0;
+    for (ts = spec->tags; 0 != ts->tag; ts++) {
+	if (OFIX_TAG_TABLE_SIZE <= ts->tag) {
+	    spec->high_cnt++;
+	}
+    }
+    free(spec->high_tags);
+    if (NULL == (spec->high_tags = (ofixTagSpec*)malloc(sizeof(ofixTagSpec) * (spec->high_cnt + 1)))) {
+	if (NULL != err) {
+	    err->code = OFIX_MEMORY_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "Failed to allocate memory for a tag table.");
+	}
+	spec->high_cnt = 0;
+	return;
+    }
+    tsp = spec->high_tags;
+    for (ts = spec->tags; 0 != ts->tag; ts++) {
+	if (OFIX_TAG_TABLE_SIZE <= ts->tag) {
+	    *tsp++ = ts;
+	}
+    }
+    qsort(spec->high_tags, spec->high_cnt, sizeof(ofixTagSpec), tag_spec_cmp);
     spec->ready = true;
 }
 
 void
 ofix_version_spec_destroy(ofixVersionSpec spec) {
+    int	i;
+
     if (NULL == spec || !spec->ready) {
 	// not initialized
 	return;
     }
     // delete any memory created, assume static for everything code generated
-    if (NULL != unknown_tags) {
-	ofixTagSpec	*ts;
-	int		i;
-
-	for (i = unknown_tags_len, ts = unknown_tags; 0 < i; i--, ts++) {
-	    free((*ts)->tag_bytes);
-	    free(*ts);
-	    *ts = 0;
+    free(spec->high_tags);
+    spec->high_tags = NULL;
+    spec->high_cnt = 0;
+    for (i = 0; i < UNKNOWN_HIGH_SIZE; i++) {
+	ofixTagSpec	ts = __atomic_exchange_n(&unknown_high[i], NULL, __ATOMIC_ACQ_REL);
+
+	if (NULL != ts) {
+	    free(ts->tag_bytes);
+	    free(ts);
 	}
-	free(unknown_tags);
-	unknown_tags = NULL;
-	unknown_tags_len = 0;
     }
 }
 
@@ -128,73 +186,99 @@ create_dummy_tag_spec(int tag) {
     ofixTagSpec	spec;
     char	buf[16];
 
-    unknown_tags_len++;
-    if (NULL == (unknown_tags = (ofixTagSpec*)realloc(unknown_tags, sizeof(ofixTagSpec) * unknown_tags_len)) ||
-	NULL == (spec = (ofixTagSpec)malloc(sizeof(struct _ofixTagSpec)))) {
+    if (NULL == (spec = (ofixTagSpec)malloc(sizeof(struct _ofixTagSpec)))) {
 	return NULL;
     }
-    unknown_tags[unknown_tags_len - 1] = spec;
     spec->tag = tag;
     spec->type = OFIX_UnknownType;
     spec->where = OFIX_Body;
     spec->related_tag = 0;
     sprintf(buf, "%d=", tag);
     if (NULL == (spec->tag_bytes = strdup(buf))) {
-	spec->tag_bytes = "0=";
+	free(spec);
+	return NULL;
     }
     spec->tag_byte_len = strlen(spec->tag_bytes);
     spec->name = "Unknown";
+    spec->enums = NULL;
 
     return spec;
 }
 
-ofixTagSpec
-ofix_version_spec_get_tag_spec(ofixErr err, ofixVersionSpec vspec, int tag, bool create) {
-    ofixTagSpec	spec = NULL;
+// Returns the spec for an unknown tag above the table, creating it if
+// __create__ is true. A lost race to fill a slot with the same tag takes the
+// winner's spec.
+static ofixTagSpec
+unknown_high_spec(ofixErr err, int tag, bool create) {
+    ofixTagSpec		spec = NULL;
+    ofixTagSpec		ts;
+    unsigned int	i = ((unsigned int)tag * 2654435761U) & (UNKNOWN_HIGH_SIZE - 1);
+    int			cnt;
 
-    if (NULL != err && OFIX_OK != err->code) {
-	return NULL;
-    }
-    if (0 < tag && tag < OFIX_TAG_TABLE_SIZE) {
-	spec = vspec->tag_table[tag];
-	if (NULL == spec) {
-	    if (NULL == (spec = create_dummy_tag_spec(tag))) {
+    for (cnt = UNKNOWN_HIGH_SIZE; 0 < cnt; cnt--, i = (i + 1) & (UNKNOWN_HIGH_SIZE - 1)) {
+	if (NULL == (ts = __atomic_load_n(&unknown_high[i], __ATOMIC_ACQUIRE))) {
+	    if (!create) {
+		break;
+	    }
+	    if (NULL == spec && NULL == (spec = create_dummy_tag_spec(tag))) {
 		if (NULL != err) {
 		    err->code = OFIX_MEMORY_ERR;
 		    snprintf(err->msg, sizeof(err->msg), "Failed to allocate memory for a TagSpec.");
 		}
 		return NULL;
 	    }
-	    vspec->tag_table[tag] = spec;
-	}
-    } else {
-	ofixTagSpec	ts;
-	ofixTagSpec	*tsp;
-	int		i;
-
-	for (ts = vspec->tags; 0 != ts->tag; ts++) {
-	    if (tag == ts->tag) {
-		return ts;
+	    if (__atomic_compare_exchange_n(&unknown_high[i], &ts, spec, false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)) {
+		return spec;
 	    }
+	    // ts is now what was put in the slot first
 	}
-	for (tsp = unknown_tags, i = unknown_tags_len; 0 < i; i--, tsp++) {
-	    if (tag == (*tsp)->tag) {
-		return *tsp;
+	if (tag == ts->tag) {
+	    if (NULL != spec) {
+		free(spec->tag_bytes);
+		free(spec);
 	    }
+	    return ts;
 	}
-	if (create) {
-	    if (NULL == (spec = create_dummy_tag_spec(tag))) {
-		if (NULL != err) {
-		    err->code = OFIX_MEMORY_ERR;
-		    snprintf(err->msg, sizeof(err->msg), "Failed to allocate memory for a TagSpec.");
-		}
-	    }
+    }
+    if (NULL != spec) {
+	free(spec->tag_bytes);
+	free(spec);
+	if (NULL != err) {
+	    err->code = OFIX_OVERFLOW_ERR;
+	    snprintf(err->msg, sizeof(err->msg), "No more than %d unknown tags above %d can be used.",
+		     UNKNOWN_HIGH_SIZE, OFIX_TAG_TABLE_SIZE);
+	}
+    }
+    return NULL;
+}
+
+ofixTagSpec
+ofix_version_spec_get_tag_spec(ofixErr err, ofixVersionSpec vspec, int tag, bool create) {
+    ofixTagSpec	spec = NULL;
+    int		lo;
+    int		hi;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return NULL;
+    }
+    if (0 < tag && tag < OFIX_TAG_TABLE_SIZE) {
+	return vspec->tag_table[tag];
+    }
+    for (lo = 0, hi = vspec->high_cnt; lo < hi;) {
+	int	mid = (lo + hi) / 2;
+
+	if (vspec->high_tags[mid]->tag < tag) {
+	    lo = mid + 1;
 	} else {
-	    if (NULL != err) {
-		err->code = OFIX_NOT_FOUND_ERR;
-		snprintf(err->msg, sizeof(err->msg), "Tag %d not found in %d.%d.", tag, vspec->major, vspec->minor);
-	    }
+	    hi = mid;
 	}
     }
+    if (lo < vspec->high_cnt && tag == vspec->high_tags[lo]->tag) {
+	return vspec->high_tags[lo];
+    }
+    if (NULL == (spec = unknown_high_spec(err, tag, create)) && !create && NULL != err) {
+	err->code = OFIX_NOT_FOUND_ERR;
+	snprintf(err->msg, sizeof(err->msg), "Tag %d not found in %d.%d.", tag, vspec->major, vspec->minor);
+    }
     return spec;
 }
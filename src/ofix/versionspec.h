@@ -18,9 +18,22 @@ struct _ofixVersionSpec {
     bool	ready;
     ofixTagSpec	tags;
     ofixTagSpec	tag_table[OFIX_TAG_TABLE_SIZE];
+    ofixTagSpec	*high_tags; // tags above the table sorted for a binary search
+    int		high_cnt;
     ofixMsgSpec	msgs[];
 };
 
+/**
+ * Prepares the tag tables of all the FIX versions. It is safe to call from
+ * multiple threads and only the first call does any work. After it returns the
+ * version specs are never modified so lookups from any thread need no
+ * locking. Calling it before starting any sessions is recommended but not
+ * required as the first spec lookup will call it if needed.
+ *
+ * @param err pointer to error struct or NULL
+ */
+extern void		ofix_init(ofixErr err);
+
 extern void		ofix_version_spec_prepare(ofixErr err, ofixVersionSpec spec);
 extern void		ofix_version_spec_destroy(ofixVersionSpec spec);
 
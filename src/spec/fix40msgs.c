@@ -0,0 +1,7274 @@
+
+// This file is auto-generated from ref/FIX40.xml and should not be modified.
+
+#include <string.h>
+
+#include "fix40msgs.h"
+
+// Heartbeat [0]
+
+void
+fix40_decode_Heartbeat(ofixErr err, fix40Heartbeat m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Heartbeat));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_OrigSendingTime);
+	    break;
+	case 112: // TestReqID
+	    ofix_typed_view(&scan, &m->TestReqID);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_TestReqID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Heartbeat_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Heartbeat_msg(ofixErr err, fix40Heartbeat m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Heartbeat(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Heartbeat(ofixErr err, fix40Heartbeat m) {
+    ofixMsg	msg = ofix_msg_create(err, "0", 4, 0, 22);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_TestReqID)) {
+	ofix_typed_set_view(err, msg, 112, &m->TestReqID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Heartbeat_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// TestRequest [1]
+
+void
+fix40_decode_TestRequest(ofixErr err, fix40TestRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40TestRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_OrigSendingTime);
+	    break;
+	case 112: // TestReqID
+	    ofix_typed_view(&scan, &m->TestReqID);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_TestReqID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_TestRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_TestRequest_msg(ofixErr err, fix40TestRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_TestRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_TestRequest(ofixErr err, fix40TestRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "1", 4, 0, 22);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_TestRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_TestReqID)) {
+	ofix_typed_set_view(err, msg, 112, &m->TestReqID);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_TestRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ResendRequest [2]
+
+void
+fix40_decode_ResendRequest(ofixErr err, fix40ResendRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40ResendRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_OrigSendingTime);
+	    break;
+	case 7: // BeginSeqNo
+	    m->BeginSeqNo = ofix_typed_int(err, &scan, 7);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_BeginSeqNo);
+	    break;
+	case 16: // EndSeqNo
+	    m->EndSeqNo = ofix_typed_int(err, &scan, 16);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_EndSeqNo);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_ResendRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_ResendRequest_msg(ofixErr err, fix40ResendRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_ResendRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_ResendRequest(ofixErr err, fix40ResendRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "2", 4, 0, 23);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_BeginSeqNo)) {
+	ofix_typed_set_int(err, msg, 7, m->BeginSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_EndSeqNo)) {
+	ofix_typed_set_int(err, msg, 16, m->EndSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_ResendRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Reject [3]
+
+void
+fix40_decode_Reject(ofixErr err, fix40Reject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Reject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Reject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Reject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Reject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Reject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Reject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Reject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Reject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Reject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Reject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Reject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Reject_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Reject_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Reject_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Reject_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Reject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Reject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Reject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Reject_OrigSendingTime);
+	    break;
+	case 45: // RefSeqNum
+	    m->RefSeqNum = ofix_typed_int(err, &scan, 45);
+	    ofix_typed_mark(m->present, FIX40_Reject_RefSeqNum);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_Reject_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Reject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Reject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Reject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Reject_msg(ofixErr err, fix40Reject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Reject(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Reject(ofixErr err, fix40Reject m) {
+    ofixMsg	msg = ofix_msg_create(err, "3", 4, 0, 23);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Reject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_RefSeqNum)) {
+	ofix_typed_set_int(err, msg, 45, m->RefSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Reject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SequenceReset [4]
+
+void
+fix40_decode_SequenceReset(ofixErr err, fix40SequenceReset m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40SequenceReset));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_OrigSendingTime);
+	    break;
+	case 123: // GapFillFlag
+	    ofix_typed_view(&scan, &m->GapFillFlag);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_GapFillFlag);
+	    break;
+	case 36: // NewSeqNo
+	    m->NewSeqNo = ofix_typed_int(err, &scan, 36);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_NewSeqNo);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_SequenceReset_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_SequenceReset_msg(ofixErr err, fix40SequenceReset m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_SequenceReset(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_SequenceReset(ofixErr err, fix40SequenceReset m) {
+    ofixMsg	msg = ofix_msg_create(err, "4", 4, 0, 23);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_GapFillFlag)) {
+	ofix_typed_set_view(err, msg, 123, &m->GapFillFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_NewSeqNo)) {
+	ofix_typed_set_int(err, msg, 36, m->NewSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_SequenceReset_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Logout [5]
+
+void
+fix40_decode_Logout(ofixErr err, fix40Logout m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Logout));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Logout_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Logout_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Logout_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Logout_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Logout_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Logout_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Logout_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Logout_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Logout_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Logout_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Logout_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Logout_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Logout_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Logout_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Logout_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Logout_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Logout_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Logout_OrigSendingTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_Logout_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Logout_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Logout_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Logout_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Logout_msg(ofixErr err, fix40Logout m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Logout(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Logout(ofixErr err, fix40Logout m) {
+    ofixMsg	msg = ofix_msg_create(err, "5", 4, 0, 22);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Logout_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logout_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// IndicationofInterest [6]
+
+void
+fix40_decode_IndicationofInterest(ofixErr err, fix40IndicationofInterest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40IndicationofInterest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_OrigSendingTime);
+	    break;
+	case 23: // IOIid
+	    m->IOIid = ofix_typed_int(err, &scan, 23);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOIid);
+	    break;
+	case 28: // IOITransType
+	    ofix_typed_view(&scan, &m->IOITransType);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOITransType);
+	    break;
+	case 26: // IOIRefID
+	    m->IOIRefID = ofix_typed_int(err, &scan, 26);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOIRefID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_Side);
+	    break;
+	case 27: // IOIShares
+	    ofix_typed_view(&scan, &m->IOIShares);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOIShares);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_Price);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_Currency);
+	    break;
+	case 62: // ValidUntilTime
+	    ofix_typed_date(err, &scan, 62, OFIX_TIME, &m->ValidUntilTime);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_ValidUntilTime);
+	    break;
+	case 25: // IOIQltyInd
+	    ofix_typed_view(&scan, &m->IOIQltyInd);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOIQltyInd);
+	    break;
+	case 24: // IOIOthSvc
+	    ofix_typed_view(&scan, &m->IOIOthSvc);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOIOthSvc);
+	    break;
+	case 130: // IOINaturalFlag
+	    ofix_typed_view(&scan, &m->IOINaturalFlag);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOINaturalFlag);
+	    break;
+	case 104: // IOIQualifier
+	    ofix_typed_view(&scan, &m->IOIQualifier);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_IOIQualifier);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_IndicationofInterest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_IndicationofInterest_msg(ofixErr err, fix40IndicationofInterest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_IndicationofInterest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_IndicationofInterest(ofixErr err, fix40IndicationofInterest m) {
+    ofixMsg	msg = ofix_msg_create(err, "6", 4, 0, 40);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOIid)) {
+	ofix_typed_set_int(err, msg, 23, m->IOIid);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOITransType)) {
+	ofix_typed_set_view(err, msg, 28, &m->IOITransType);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOIRefID)) {
+	ofix_typed_set_int(err, msg, 26, m->IOIRefID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOIShares)) {
+	ofix_typed_set_view(err, msg, 27, &m->IOIShares);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_ValidUntilTime)) {
+	ofix_msg_set_date(err, msg, 62, &m->ValidUntilTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOIQltyInd)) {
+	ofix_typed_set_view(err, msg, 25, &m->IOIQltyInd);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOIOthSvc)) {
+	ofix_typed_set_view(err, msg, 24, &m->IOIOthSvc);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOINaturalFlag)) {
+	ofix_typed_set_view(err, msg, 130, &m->IOINaturalFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_IOIQualifier)) {
+	ofix_typed_set_view(err, msg, 104, &m->IOIQualifier);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_IndicationofInterest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Advertisement [7]
+
+void
+fix40_decode_Advertisement(ofixErr err, fix40Advertisement m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Advertisement));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_OrigSendingTime);
+	    break;
+	case 2: // AdvId
+	    m->AdvId = ofix_typed_int(err, &scan, 2);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_AdvId);
+	    break;
+	case 5: // AdvTransType
+	    ofix_typed_view(&scan, &m->AdvTransType);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_AdvTransType);
+	    break;
+	case 3: // AdvRefID
+	    m->AdvRefID = ofix_typed_int(err, &scan, 3);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_AdvRefID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SecurityDesc);
+	    break;
+	case 4: // AdvSide
+	    ofix_typed_view(&scan, &m->AdvSide);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_AdvSide);
+	    break;
+	case 53: // Shares
+	    m->Shares = ofix_typed_int(err, &scan, 53);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_Shares);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_Price);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_Currency);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_TransactTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Advertisement_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Advertisement_msg(ofixErr err, fix40Advertisement m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Advertisement(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Advertisement(ofixErr err, fix40Advertisement m) {
+    ofixMsg	msg = ofix_msg_create(err, "7", 4, 0, 36);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_AdvId)) {
+	ofix_typed_set_int(err, msg, 2, m->AdvId);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_AdvTransType)) {
+	ofix_typed_set_view(err, msg, 5, &m->AdvTransType);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_AdvRefID)) {
+	ofix_typed_set_int(err, msg, 3, m->AdvRefID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_AdvSide)) {
+	ofix_typed_set_view(err, msg, 4, &m->AdvSide);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_Shares)) {
+	ofix_typed_set_int(err, msg, 53, m->Shares);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Advertisement_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ExecutionReport [8]
+
+static const int	ExecutionReportGroup136[] = { 137, 138, 139, 0 };
+
+static const struct _ofixTypedGroup	ExecutionReportGroups[] = {
+    { 136, -1, ExecutionReportGroup136 }, // NoMiscFees
+};
+
+void
+fix40_decode_ExecutionReport(ofixErr err, fix40ExecutionReport m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40ExecutionReport));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, ExecutionReportGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ExecBroker);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ListID);
+	    break;
+	case 17: // ExecID
+	    m->ExecID = ofix_typed_int(err, &scan, 17);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ExecID);
+	    break;
+	case 20: // ExecTransType
+	    ofix_typed_view(&scan, &m->ExecTransType);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ExecTransType);
+	    break;
+	case 19: // ExecRefID
+	    m->ExecRefID = ofix_typed_int(err, &scan, 19);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ExecRefID);
+	    break;
+	case 39: // OrdStatus
+	    ofix_typed_view(&scan, &m->OrdStatus);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OrdStatus);
+	    break;
+	case 103: // OrdRejReason
+	    m->OrdRejReason = ofix_typed_int(err, &scan, 103);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OrdRejReason);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_FutSettDate);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_StopPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Currency);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ExpireTime);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ExecInst);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Rule80A);
+	    break;
+	case 32: // LastShares
+	    m->LastShares = ofix_typed_int(err, &scan, 32);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_LastShares);
+	    break;
+	case 31: // LastPx
+	    ofix_typed_decimal(err, &scan, 31, &m->LastPx);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_LastPx);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_LastMkt);
+	    break;
+	case 29: // LastCapacity
+	    ofix_typed_view(&scan, &m->LastCapacity);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_LastCapacity);
+	    break;
+	case 14: // CumQty
+	    m->CumQty = ofix_typed_int(err, &scan, 14);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_CumQty);
+	    break;
+	case 6: // AvgPx
+	    ofix_typed_decimal(err, &scan, 6, &m->AvgPx);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_AvgPx);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_TransactTime);
+	    break;
+	case 113: // ReportToExch
+	    ofix_typed_view(&scan, &m->ReportToExch);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_ReportToExch);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_CommType);
+	    break;
+	case 136: // NoMiscFees
+	    m->NoMiscFees = ofix_typed_int(err, &scan, 136);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_NoMiscFees);
+	    break;
+	case 118: // NetMoney
+	    ofix_typed_decimal(err, &scan, 118, &m->NetMoney);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_NetMoney);
+	    break;
+	case 119: // SettlCurrAmt
+	    ofix_typed_decimal(err, &scan, 119, &m->SettlCurrAmt);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SettlCurrAmt);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_ExecutionReport_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_ExecutionReport_msg(ofixErr err, fix40ExecutionReport m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_ExecutionReport(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_ExecutionReport(ofixErr err, fix40ExecutionReport m) {
+    ofixMsg	msg = ofix_msg_create(err, "8", 4, 0, 66);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ExecID)) {
+	ofix_typed_set_int(err, msg, 17, m->ExecID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ExecTransType)) {
+	ofix_typed_set_view(err, msg, 20, &m->ExecTransType);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ExecRefID)) {
+	ofix_typed_set_int(err, msg, 19, m->ExecRefID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OrdStatus)) {
+	ofix_typed_set_view(err, msg, 39, &m->OrdStatus);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OrdRejReason)) {
+	ofix_typed_set_int(err, msg, 103, m->OrdRejReason);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_LastShares)) {
+	ofix_typed_set_int(err, msg, 32, m->LastShares);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_LastPx)) {
+	ofix_typed_set_decimal(err, msg, 31, &m->LastPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_LastCapacity)) {
+	ofix_typed_set_view(err, msg, 29, &m->LastCapacity);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_CumQty)) {
+	ofix_typed_set_int(err, msg, 14, m->CumQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_AvgPx)) {
+	ofix_typed_set_decimal(err, msg, 6, &m->AvgPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_ReportToExch)) {
+	ofix_typed_set_view(err, msg, 113, &m->ReportToExch);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_NoMiscFees)) {
+	ofix_typed_set_int(err, msg, 136, m->NoMiscFees);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_NetMoney)) {
+	ofix_typed_set_decimal(err, msg, 118, &m->NetMoney);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SettlCurrAmt)) {
+	ofix_typed_set_decimal(err, msg, 119, &m->SettlCurrAmt);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_ExecutionReport_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelReject [9]
+
+void
+fix40_decode_OrderCancelReject(ofixErr err, fix40OrderCancelReject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40OrderCancelReject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_ExecBroker);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_ListID);
+	    break;
+	case 102: // CxlRejReason
+	    m->CxlRejReason = ofix_typed_int(err, &scan, 102);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_CxlRejReason);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_OrderCancelReject_msg(ofixErr err, fix40OrderCancelReject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_OrderCancelReject(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_OrderCancelReject(ofixErr err, fix40OrderCancelReject m) {
+    ofixMsg	msg = ofix_msg_create(err, "9", 4, 0, 28);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_CxlRejReason)) {
+	ofix_typed_set_int(err, msg, 102, m->CxlRejReason);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Logon [A]
+
+void
+fix40_decode_Logon(ofixErr err, fix40Logon m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Logon));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Logon_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Logon_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Logon_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Logon_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Logon_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Logon_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Logon_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Logon_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Logon_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Logon_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Logon_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Logon_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Logon_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Logon_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Logon_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Logon_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Logon_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Logon_OrigSendingTime);
+	    break;
+	case 98: // EncryptMethod
+	    m->EncryptMethod = ofix_typed_int(err, &scan, 98);
+	    ofix_typed_mark(m->present, FIX40_Logon_EncryptMethod);
+	    break;
+	case 108: // HeartBtInt
+	    m->HeartBtInt = ofix_typed_int(err, &scan, 108);
+	    ofix_typed_mark(m->present, FIX40_Logon_HeartBtInt);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX40_Logon_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX40_Logon_RawData);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Logon_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Logon_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Logon_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Logon_msg(ofixErr err, fix40Logon m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Logon(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Logon(ofixErr err, fix40Logon m) {
+    ofixMsg	msg = ofix_msg_create(err, "A", 4, 0, 25);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Logon_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_EncryptMethod)) {
+	ofix_typed_set_int(err, msg, 98, m->EncryptMethod);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_HeartBtInt)) {
+	ofix_typed_set_int(err, msg, 108, m->HeartBtInt);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Logon_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// News [B]
+
+static const int	NewsGroup33[] = { 58, 0 };
+
+static const struct _ofixTypedGroup	NewsGroups[] = {
+    { 33, -1, NewsGroup33 }, // LinesOfText
+};
+
+void
+fix40_decode_News(ofixErr err, fix40News m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40News));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, NewsGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_News_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_News_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_News_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_News_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_News_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_News_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_News_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_News_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_News_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_News_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_News_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_News_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_News_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_News_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_News_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_News_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_News_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_News_OrigSendingTime);
+	    break;
+	case 42: // OrigTime
+	    ofix_typed_date(err, &scan, 42, OFIX_TIME, &m->OrigTime);
+	    ofix_typed_mark(m->present, FIX40_News_OrigTime);
+	    break;
+	case 61: // Urgency
+	    ofix_typed_view(&scan, &m->Urgency);
+	    ofix_typed_mark(m->present, FIX40_News_Urgency);
+	    break;
+	case 46: // RelatdSym
+	    ofix_typed_view(&scan, &m->RelatdSym);
+	    ofix_typed_mark(m->present, FIX40_News_RelatdSym);
+	    break;
+	case 33: // LinesOfText
+	    m->LinesOfText = ofix_typed_int(err, &scan, 33);
+	    ofix_typed_mark(m->present, FIX40_News_LinesOfText);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX40_News_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX40_News_RawData);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_News_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_News_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_News_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_News_msg(ofixErr err, fix40News m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_News(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_News(ofixErr err, fix40News m) {
+    ofixMsg	msg = ofix_msg_create(err, "B", 4, 0, 27);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_News_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_OrigTime)) {
+	ofix_msg_set_date(err, msg, 42, &m->OrigTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_Urgency)) {
+	ofix_typed_set_view(err, msg, 61, &m->Urgency);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_RelatdSym)) {
+	ofix_typed_set_view(err, msg, 46, &m->RelatdSym);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_LinesOfText)) {
+	ofix_typed_set_int(err, msg, 33, m->LinesOfText);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_News_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Email [C]
+
+static const int	EmailGroup33[] = { 58, 0 };
+
+static const struct _ofixTypedGroup	EmailGroups[] = {
+    { 33, -1, EmailGroup33 }, // LinesOfText
+};
+
+void
+fix40_decode_Email(ofixErr err, fix40Email m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Email));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, EmailGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Email_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Email_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Email_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Email_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Email_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Email_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Email_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Email_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Email_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Email_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Email_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Email_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Email_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Email_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Email_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Email_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Email_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Email_OrigSendingTime);
+	    break;
+	case 94: // EmailType
+	    ofix_typed_view(&scan, &m->EmailType);
+	    ofix_typed_mark(m->present, FIX40_Email_EmailType);
+	    break;
+	case 42: // OrigTime
+	    ofix_typed_date(err, &scan, 42, OFIX_TIME, &m->OrigTime);
+	    ofix_typed_mark(m->present, FIX40_Email_OrigTime);
+	    break;
+	case 46: // RelatdSym
+	    ofix_typed_view(&scan, &m->RelatdSym);
+	    ofix_typed_mark(m->present, FIX40_Email_RelatdSym);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX40_Email_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_Email_ClOrdID);
+	    break;
+	case 33: // LinesOfText
+	    m->LinesOfText = ofix_typed_int(err, &scan, 33);
+	    ofix_typed_mark(m->present, FIX40_Email_LinesOfText);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX40_Email_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX40_Email_RawData);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Email_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Email_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Email_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Email_msg(ofixErr err, fix40Email m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Email(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Email(ofixErr err, fix40Email m) {
+    ofixMsg	msg = ofix_msg_create(err, "C", 4, 0, 29);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Email_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_EmailType)) {
+	ofix_typed_set_view(err, msg, 94, &m->EmailType);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_OrigTime)) {
+	ofix_msg_set_date(err, msg, 42, &m->OrigTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_RelatdSym)) {
+	ofix_typed_set_view(err, msg, 46, &m->RelatdSym);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_LinesOfText)) {
+	ofix_typed_set_int(err, msg, 33, m->LinesOfText);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Email_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// NewOrderSingle [D]
+
+void
+fix40_decode_NewOrderSingle(ofixErr err, fix40NewOrderSingle m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40NewOrderSingle));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_OrigSendingTime);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ExecBroker);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    ofix_typed_view(&scan, &m->HandlInst);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ExecInst);
+	    break;
+	case 110: // MinQty
+	    m->MinQty = ofix_typed_int(err, &scan, 110);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    m->MaxFloor = ofix_typed_int(err, &scan, 111);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ExDestination);
+	    break;
+	case 81: // ProcessCode
+	    ofix_typed_view(&scan, &m->ProcessCode);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ProcessCode);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SecurityDesc);
+	    break;
+	case 140: // PrevClosePx
+	    ofix_typed_decimal(err, &scan, 140, &m->PrevClosePx);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_PrevClosePx);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Side);
+	    break;
+	case 114: // LocateReqd
+	    ofix_typed_view(&scan, &m->LocateReqd);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_LocateReqd);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_OrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_StopPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Currency);
+	    break;
+	case 23: // IOIid
+	    m->IOIid = ofix_typed_int(err, &scan, 23);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_IOIid);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_QuoteID);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ExpireTime);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_CommType);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    ofix_typed_view(&scan, &m->ForexReq);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_NewOrderSingle_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_NewOrderSingle_msg(ofixErr err, fix40NewOrderSingle m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_NewOrderSingle(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_NewOrderSingle(ofixErr err, fix40NewOrderSingle m) {
+    ofixMsg	msg = ofix_msg_create(err, "D", 4, 0, 57);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_HandlInst)) {
+	ofix_typed_set_view(err, msg, 21, &m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_MinQty)) {
+	ofix_typed_set_int(err, msg, 110, m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_MaxFloor)) {
+	ofix_typed_set_int(err, msg, 111, m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ProcessCode)) {
+	ofix_typed_set_view(err, msg, 81, &m->ProcessCode);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_PrevClosePx)) {
+	ofix_typed_set_decimal(err, msg, 140, &m->PrevClosePx);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_LocateReqd)) {
+	ofix_typed_set_view(err, msg, 114, &m->LocateReqd);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_IOIid)) {
+	ofix_typed_set_int(err, msg, 23, m->IOIid);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_ForexReq)) {
+	ofix_typed_set_view(err, msg, 121, &m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderSingle_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// NewOrderList [E]
+
+void
+fix40_decode_NewOrderList(ofixErr err, fix40NewOrderList m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40NewOrderList));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_WaveNo);
+	    break;
+	case 67: // ListSeqNo
+	    m->ListSeqNo = ofix_typed_int(err, &scan, 67);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ListSeqNo);
+	    break;
+	case 68: // ListNoOrds
+	    m->ListNoOrds = ofix_typed_int(err, &scan, 68);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ListNoOrds);
+	    break;
+	case 69: // ListExecInst
+	    ofix_typed_view(&scan, &m->ListExecInst);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ListExecInst);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ExecBroker);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    ofix_typed_view(&scan, &m->HandlInst);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ExecInst);
+	    break;
+	case 110: // MinQty
+	    m->MinQty = ofix_typed_int(err, &scan, 110);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    m->MaxFloor = ofix_typed_int(err, &scan, 111);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ExDestination);
+	    break;
+	case 81: // ProcessCode
+	    ofix_typed_view(&scan, &m->ProcessCode);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ProcessCode);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SecurityDesc);
+	    break;
+	case 140: // PrevClosePx
+	    ofix_typed_decimal(err, &scan, 140, &m->PrevClosePx);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_PrevClosePx);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Side);
+	    break;
+	case 114: // LocateReqd
+	    ofix_typed_view(&scan, &m->LocateReqd);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_LocateReqd);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_OrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_StopPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Currency);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ExpireTime);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_CommType);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    ofix_typed_view(&scan, &m->ForexReq);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_NewOrderList_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_NewOrderList_msg(ofixErr err, fix40NewOrderList m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_NewOrderList(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_NewOrderList(ofixErr err, fix40NewOrderList m) {
+    ofixMsg	msg = ofix_msg_create(err, "E", 4, 0, 60);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ListSeqNo)) {
+	ofix_typed_set_int(err, msg, 67, m->ListSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ListNoOrds)) {
+	ofix_typed_set_int(err, msg, 68, m->ListNoOrds);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ListExecInst)) {
+	ofix_typed_set_view(err, msg, 69, &m->ListExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_HandlInst)) {
+	ofix_typed_set_view(err, msg, 21, &m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_MinQty)) {
+	ofix_typed_set_int(err, msg, 110, m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_MaxFloor)) {
+	ofix_typed_set_int(err, msg, 111, m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ProcessCode)) {
+	ofix_typed_set_view(err, msg, 81, &m->ProcessCode);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_PrevClosePx)) {
+	ofix_typed_set_decimal(err, msg, 140, &m->PrevClosePx);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_LocateReqd)) {
+	ofix_typed_set_view(err, msg, 114, &m->LocateReqd);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_ForexReq)) {
+	ofix_typed_set_view(err, msg, 121, &m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_NewOrderList_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelRequest [F]
+
+void
+fix40_decode_OrderCancelRequest(ofixErr err, fix40OrderCancelRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40OrderCancelRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_OrigSendingTime);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_OrigClOrdID);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_ClOrdID);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_ListID);
+	    break;
+	case 125: // CxlType
+	    ofix_typed_view(&scan, &m->CxlType);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_CxlType);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_ExecBroker);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_OrderQty);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_OrderCancelRequest_msg(ofixErr err, fix40OrderCancelRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_OrderCancelRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_OrderCancelRequest(ofixErr err, fix40OrderCancelRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "F", 4, 0, 37);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_CxlType)) {
+	ofix_typed_set_view(err, msg, 125, &m->CxlType);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelReplaceRequest [G]
+
+void
+fix40_decode_OrderCancelReplaceRequest(ofixErr err, fix40OrderCancelReplaceRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40OrderCancelReplaceRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_OrderID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ExecBroker);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_OrigClOrdID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ClOrdID);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ListID);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    ofix_typed_view(&scan, &m->HandlInst);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ExecInst);
+	    break;
+	case 110: // MinQty
+	    m->MinQty = ofix_typed_int(err, &scan, 110);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    m->MaxFloor = ofix_typed_int(err, &scan, 111);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ExDestination);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_OrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_StopPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Currency);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ExpireTime);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_CommType);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    ofix_typed_view(&scan, &m->ForexReq);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_OrderCancelReplaceRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix40OrderCancelReplaceRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_OrderCancelReplaceRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_OrderCancelReplaceRequest(ofixErr err, fix40OrderCancelReplaceRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "G", 4, 0, 55);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_HandlInst)) {
+	ofix_typed_set_view(err, msg, 21, &m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_MinQty)) {
+	ofix_typed_set_int(err, msg, 110, m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_MaxFloor)) {
+	ofix_typed_set_int(err, msg, 111, m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_ForexReq)) {
+	ofix_typed_set_view(err, msg, 121, &m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderCancelReplaceRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderStatusRequest [H]
+
+void
+fix40_decode_OrderStatusRequest(ofixErr err, fix40OrderStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40OrderStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_ExecBroker);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SymbolSfx);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_Side);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_OrderStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_OrderStatusRequest_msg(ofixErr err, fix40OrderStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_OrderStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_OrderStatusRequest(ofixErr err, fix40OrderStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "H", 4, 0, 30);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_OrderStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Allocation [J]
+
+static const int	AllocationGroup73[] = { 11, 37, 66, 105, 0 };
+static const int	AllocationGroup124[] = { 17, 32, 31, 30, 0 };
+static const int	AllocationGroup136[] = { 137, 138, 139, 0 };
+static const int	AllocationGroup78[] = { 79, 80, 81, 76, 109, 12, 13, 85, 0 };
+static const int	AllocationGroup85[] = { 92, 86, 0 };
+
+static const struct _ofixTypedGroup	AllocationGroups[] = {
+    { 73, -1, AllocationGroup73 }, // NoOrders
+    { 124, -1, AllocationGroup124 }, // NoExecs
+    { 136, -1, AllocationGroup136 }, // NoMiscFees
+    { 78, -1, AllocationGroup78 }, // NoAllocs
+    { 85, 3, AllocationGroup85 }, // NoDlvyInst
+};
+
+void
+fix40_decode_Allocation(ofixErr err, fix40Allocation m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Allocation));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, AllocationGroups, 5);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Allocation_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Allocation_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Allocation_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Allocation_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Allocation_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Allocation_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Allocation_OrigSendingTime);
+	    break;
+	case 70: // AllocID
+	    m->AllocID = ofix_typed_int(err, &scan, 70);
+	    ofix_typed_mark(m->present, FIX40_Allocation_AllocID);
+	    break;
+	case 71: // AllocTransType
+	    ofix_typed_view(&scan, &m->AllocTransType);
+	    ofix_typed_mark(m->present, FIX40_Allocation_AllocTransType);
+	    break;
+	case 72: // RefAllocID
+	    m->RefAllocID = ofix_typed_int(err, &scan, 72);
+	    ofix_typed_mark(m->present, FIX40_Allocation_RefAllocID);
+	    break;
+	case 73: // NoOrders
+	    m->NoOrders = ofix_typed_int(err, &scan, 73);
+	    ofix_typed_mark(m->present, FIX40_Allocation_NoOrders);
+	    break;
+	case 124: // NoExecs
+	    m->NoExecs = ofix_typed_int(err, &scan, 124);
+	    ofix_typed_mark(m->present, FIX40_Allocation_NoExecs);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_Allocation_Side);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_Allocation_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_Allocation_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_Allocation_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SecurityDesc);
+	    break;
+	case 53: // Shares
+	    m->Shares = ofix_typed_int(err, &scan, 53);
+	    ofix_typed_mark(m->present, FIX40_Allocation_Shares);
+	    break;
+	case 6: // AvgPx
+	    ofix_typed_decimal(err, &scan, 6, &m->AvgPx);
+	    ofix_typed_mark(m->present, FIX40_Allocation_AvgPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX40_Allocation_Currency);
+	    break;
+	case 74: // AvgPrxPrecision
+	    m->AvgPrxPrecision = ofix_typed_int(err, &scan, 74);
+	    ofix_typed_mark(m->present, FIX40_Allocation_AvgPrxPrecision);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX40_Allocation_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX40_Allocation_TransactTime);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX40_Allocation_FutSettDate);
+	    break;
+	case 118: // NetMoney
+	    ofix_typed_decimal(err, &scan, 118, &m->NetMoney);
+	    ofix_typed_mark(m->present, FIX40_Allocation_NetMoney);
+	    break;
+	case 136: // NoMiscFees
+	    m->NoMiscFees = ofix_typed_int(err, &scan, 136);
+	    ofix_typed_mark(m->present, FIX40_Allocation_NoMiscFees);
+	    break;
+	case 119: // SettlCurrAmt
+	    ofix_typed_decimal(err, &scan, 119, &m->SettlCurrAmt);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SettlCurrAmt);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SettlCurrency);
+	    break;
+	case 77: // OpenClose
+	    ofix_typed_view(&scan, &m->OpenClose);
+	    ofix_typed_mark(m->present, FIX40_Allocation_OpenClose);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_Allocation_Text);
+	    break;
+	case 78: // NoAllocs
+	    m->NoAllocs = ofix_typed_int(err, &scan, 78);
+	    ofix_typed_mark(m->present, FIX40_Allocation_NoAllocs);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Allocation_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Allocation_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Allocation_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Allocation_msg(ofixErr err, fix40Allocation m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Allocation(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Allocation(ofixErr err, fix40Allocation m) {
+    ofixMsg	msg = ofix_msg_create(err, "J", 4, 0, 48);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Allocation_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_AllocID)) {
+	ofix_typed_set_int(err, msg, 70, m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_AllocTransType)) {
+	ofix_typed_set_view(err, msg, 71, &m->AllocTransType);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_RefAllocID)) {
+	ofix_typed_set_int(err, msg, 72, m->RefAllocID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_NoOrders)) {
+	ofix_typed_set_int(err, msg, 73, m->NoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_NoExecs)) {
+	ofix_typed_set_int(err, msg, 124, m->NoExecs);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_Shares)) {
+	ofix_typed_set_int(err, msg, 53, m->Shares);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_AvgPx)) {
+	ofix_typed_set_decimal(err, msg, 6, &m->AvgPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_AvgPrxPrecision)) {
+	ofix_typed_set_int(err, msg, 74, m->AvgPrxPrecision);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_NetMoney)) {
+	ofix_typed_set_decimal(err, msg, 118, &m->NetMoney);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_NoMiscFees)) {
+	ofix_typed_set_int(err, msg, 136, m->NoMiscFees);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SettlCurrAmt)) {
+	ofix_typed_set_decimal(err, msg, 119, &m->SettlCurrAmt);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_OpenClose)) {
+	ofix_typed_set_view(err, msg, 77, &m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_NoAllocs)) {
+	ofix_typed_set_int(err, msg, 78, m->NoAllocs);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Allocation_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListCancelRequest [K]
+
+void
+fix40_decode_ListCancelRequest(ofixErr err, fix40ListCancelRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40ListCancelRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_WaveNo);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_ListCancelRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_ListCancelRequest_msg(ofixErr err, fix40ListCancelRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_ListCancelRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_ListCancelRequest(ofixErr err, fix40ListCancelRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "K", 4, 0, 24);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListCancelRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListExecute [L]
+
+void
+fix40_decode_ListExecute(ofixErr err, fix40ListExecute m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40ListExecute));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_WaveNo);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_ListExecute_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_ListExecute_msg(ofixErr err, fix40ListExecute m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_ListExecute(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_ListExecute(ofixErr err, fix40ListExecute m) {
+    ofixMsg	msg = ofix_msg_create(err, "L", 4, 0, 24);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_ListExecute_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListExecute_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListStatusRequest [M]
+
+void
+fix40_decode_ListStatusRequest(ofixErr err, fix40ListStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40ListStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_WaveNo);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_ListStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_ListStatusRequest_msg(ofixErr err, fix40ListStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_ListStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_ListStatusRequest(ofixErr err, fix40ListStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "M", 4, 0, 24);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListStatus [N]
+
+static const int	ListStatusGroup73[] = { 11, 14, 84, 6, 0 };
+
+static const struct _ofixTypedGroup	ListStatusGroups[] = {
+    { 73, -1, ListStatusGroup73 }, // NoOrders
+};
+
+void
+fix40_decode_ListStatus(ofixErr err, fix40ListStatus m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40ListStatus));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, ListStatusGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_WaveNo);
+	    break;
+	case 82: // NoRpts
+	    m->NoRpts = ofix_typed_int(err, &scan, 82);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_NoRpts);
+	    break;
+	case 83: // RptSeq
+	    m->RptSeq = ofix_typed_int(err, &scan, 83);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_RptSeq);
+	    break;
+	case 73: // NoOrders
+	    m->NoOrders = ofix_typed_int(err, &scan, 73);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_NoOrders);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_ListStatus_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_ListStatus_msg(ofixErr err, fix40ListStatus m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_ListStatus(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_ListStatus(ofixErr err, fix40ListStatus m) {
+    ofixMsg	msg = ofix_msg_create(err, "N", 4, 0, 26);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_ListStatus_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_NoRpts)) {
+	ofix_typed_set_int(err, msg, 82, m->NoRpts);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_RptSeq)) {
+	ofix_typed_set_int(err, msg, 83, m->RptSeq);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_NoOrders)) {
+	ofix_typed_set_int(err, msg, 73, m->NoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_ListStatus_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// AllocationACK [P]
+
+void
+fix40_decode_AllocationACK(ofixErr err, fix40AllocationACK m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40AllocationACK));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_OrigSendingTime);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_ExecBroker);
+	    break;
+	case 70: // AllocID
+	    m->AllocID = ofix_typed_int(err, &scan, 70);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_AllocID);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_TransactTime);
+	    break;
+	case 87: // AllocStatus
+	    m->AllocStatus = ofix_typed_int(err, &scan, 87);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_AllocStatus);
+	    break;
+	case 88: // AllocRejCode
+	    m->AllocRejCode = ofix_typed_int(err, &scan, 88);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_AllocRejCode);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_AllocationACK_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_AllocationACK_msg(ofixErr err, fix40AllocationACK m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_AllocationACK(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_AllocationACK(ofixErr err, fix40AllocationACK m) {
+    ofixMsg	msg = ofix_msg_create(err, "P", 4, 0, 29);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_AllocID)) {
+	ofix_typed_set_int(err, msg, 70, m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_AllocStatus)) {
+	ofix_typed_set_int(err, msg, 87, m->AllocStatus);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_AllocRejCode)) {
+	ofix_typed_set_int(err, msg, 88, m->AllocRejCode);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_AllocationACK_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// DontKnowTrade [Q]
+
+void
+fix40_decode_DontKnowTrade(ofixErr err, fix40DontKnowTrade m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40DontKnowTrade));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_OrderID);
+	    break;
+	case 17: // ExecID
+	    m->ExecID = ofix_typed_int(err, &scan, 17);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_ExecID);
+	    break;
+	case 127: // DKReason
+	    ofix_typed_view(&scan, &m->DKReason);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_DKReason);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_Symbol);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_OrderQty);
+	    break;
+	case 32: // LastShares
+	    m->LastShares = ofix_typed_int(err, &scan, 32);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_LastShares);
+	    break;
+	case 31: // LastPx
+	    ofix_typed_decimal(err, &scan, 31, &m->LastPx);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_LastPx);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_DontKnowTrade_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_DontKnowTrade_msg(ofixErr err, fix40DontKnowTrade m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_DontKnowTrade(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_DontKnowTrade(ofixErr err, fix40DontKnowTrade m) {
+    ofixMsg	msg = ofix_msg_create(err, "Q", 4, 0, 30);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_ExecID)) {
+	ofix_typed_set_int(err, msg, 17, m->ExecID);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_DKReason)) {
+	ofix_typed_set_view(err, msg, 127, &m->DKReason);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_LastShares)) {
+	ofix_typed_set_int(err, msg, 32, m->LastShares);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_LastPx)) {
+	ofix_typed_set_decimal(err, msg, 31, &m->LastPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_DontKnowTrade_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// QuoteRequest [R]
+
+void
+fix40_decode_QuoteRequest(ofixErr err, fix40QuoteRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40QuoteRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_OrigSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_QuoteReqID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SecurityDesc);
+	    break;
+	case 140: // PrevClosePx
+	    ofix_typed_decimal(err, &scan, 140, &m->PrevClosePx);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_PrevClosePx);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_OrderQty);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_QuoteRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_QuoteRequest_msg(ofixErr err, fix40QuoteRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_QuoteRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_QuoteRequest(ofixErr err, fix40QuoteRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "R", 4, 0, 31);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_PrevClosePx)) {
+	ofix_typed_set_decimal(err, msg, 140, &m->PrevClosePx);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_QuoteRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Quote [S]
+
+void
+fix40_decode_Quote(ofixErr err, fix40Quote m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix40Quote));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX40_Quote_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX40_Quote_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX40_Quote_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX40_Quote_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX40_Quote_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX40_Quote_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX40_Quote_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX40_Quote_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX40_Quote_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX40_Quote_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX40_Quote_SenderSubID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX40_Quote_TargetSubID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX40_Quote_OnBehalfOfSubID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX40_Quote_DeliverToSubID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX40_Quote_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX40_Quote_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX40_Quote_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX40_Quote_OrigSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX40_Quote_QuoteReqID);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX40_Quote_QuoteID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX40_Quote_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX40_Quote_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX40_Quote_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX40_Quote_IDSource);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX40_Quote_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX40_Quote_SecurityDesc);
+	    break;
+	case 132: // BidPx
+	    ofix_typed_decimal(err, &scan, 132, &m->BidPx);
+	    ofix_typed_mark(m->present, FIX40_Quote_BidPx);
+	    break;
+	case 133: // OfferPx
+	    ofix_typed_decimal(err, &scan, 133, &m->OfferPx);
+	    ofix_typed_mark(m->present, FIX40_Quote_OfferPx);
+	    break;
+	case 134: // BidSize
+	    m->BidSize = ofix_typed_int(err, &scan, 134);
+	    ofix_typed_mark(m->present, FIX40_Quote_BidSize);
+	    break;
+	case 135: // OfferSize
+	    m->OfferSize = ofix_typed_int(err, &scan, 135);
+	    ofix_typed_mark(m->present, FIX40_Quote_OfferSize);
+	    break;
+	case 62: // ValidUntilTime
+	    ofix_typed_date(err, &scan, 62, OFIX_TIME, &m->ValidUntilTime);
+	    ofix_typed_mark(m->present, FIX40_Quote_ValidUntilTime);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX40_Quote_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX40_Quote_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX40_Quote_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix40_decode_Quote_msg(ofixErr err, fix40Quote m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix40_decode_Quote(err, m, raw, len);
+}
+
+ofixMsg
+fix40_encode_Quote(ofixErr err, fix40Quote m) {
+    ofixMsg	msg = ofix_msg_create(err, "S", 4, 0, 34);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX40_Quote_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_BidPx)) {
+	ofix_typed_set_decimal(err, msg, 132, &m->BidPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_OfferPx)) {
+	ofix_typed_set_decimal(err, msg, 133, &m->OfferPx);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_BidSize)) {
+	ofix_typed_set_int(err, msg, 134, m->BidSize);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_OfferSize)) {
+	ofix_typed_set_int(err, msg, 135, m->OfferSize);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_ValidUntilTime)) {
+	ofix_msg_set_date(err, msg, 62, &m->ValidUntilTime);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX40_Quote_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
@@ -0,0 +1,9523 @@
+
+// This file is auto-generated from ref/FIX41.xml and should not be modified.
+
+#include <string.h>
+
+#include "fix41msgs.h"
+
+// Heartbeat [0]
+
+void
+fix41_decode_Heartbeat(ofixErr err, fix41Heartbeat m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Heartbeat));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_OrigSendingTime);
+	    break;
+	case 112: // TestReqID
+	    ofix_typed_view(&scan, &m->TestReqID);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_TestReqID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Heartbeat_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Heartbeat_msg(ofixErr err, fix41Heartbeat m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Heartbeat(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Heartbeat(ofixErr err, fix41Heartbeat m) {
+    ofixMsg	msg = ofix_msg_create(err, "0", 4, 1, 26);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_TestReqID)) {
+	ofix_typed_set_view(err, msg, 112, &m->TestReqID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Heartbeat_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// TestRequest [1]
+
+void
+fix41_decode_TestRequest(ofixErr err, fix41TestRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41TestRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_OrigSendingTime);
+	    break;
+	case 112: // TestReqID
+	    ofix_typed_view(&scan, &m->TestReqID);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_TestReqID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_TestRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_TestRequest_msg(ofixErr err, fix41TestRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_TestRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_TestRequest(ofixErr err, fix41TestRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "1", 4, 1, 26);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_TestRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_TestReqID)) {
+	ofix_typed_set_view(err, msg, 112, &m->TestReqID);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_TestRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ResendRequest [2]
+
+void
+fix41_decode_ResendRequest(ofixErr err, fix41ResendRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41ResendRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_OrigSendingTime);
+	    break;
+	case 7: // BeginSeqNo
+	    m->BeginSeqNo = ofix_typed_int(err, &scan, 7);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_BeginSeqNo);
+	    break;
+	case 16: // EndSeqNo
+	    m->EndSeqNo = ofix_typed_int(err, &scan, 16);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_EndSeqNo);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_ResendRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_ResendRequest_msg(ofixErr err, fix41ResendRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_ResendRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_ResendRequest(ofixErr err, fix41ResendRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "2", 4, 1, 27);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_BeginSeqNo)) {
+	ofix_typed_set_int(err, msg, 7, m->BeginSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_EndSeqNo)) {
+	ofix_typed_set_int(err, msg, 16, m->EndSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_ResendRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Reject [3]
+
+void
+fix41_decode_Reject(ofixErr err, fix41Reject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Reject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Reject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Reject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Reject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Reject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Reject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Reject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Reject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Reject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Reject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Reject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Reject_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Reject_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Reject_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Reject_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Reject_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Reject_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Reject_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Reject_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Reject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Reject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Reject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Reject_OrigSendingTime);
+	    break;
+	case 45: // RefSeqNum
+	    m->RefSeqNum = ofix_typed_int(err, &scan, 45);
+	    ofix_typed_mark(m->present, FIX41_Reject_RefSeqNum);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_Reject_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Reject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Reject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Reject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Reject_msg(ofixErr err, fix41Reject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Reject(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Reject(ofixErr err, fix41Reject m) {
+    ofixMsg	msg = ofix_msg_create(err, "3", 4, 1, 27);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Reject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_RefSeqNum)) {
+	ofix_typed_set_int(err, msg, 45, m->RefSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Reject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SequenceReset [4]
+
+void
+fix41_decode_SequenceReset(ofixErr err, fix41SequenceReset m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41SequenceReset));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_OrigSendingTime);
+	    break;
+	case 123: // GapFillFlag
+	    ofix_typed_view(&scan, &m->GapFillFlag);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_GapFillFlag);
+	    break;
+	case 36: // NewSeqNo
+	    m->NewSeqNo = ofix_typed_int(err, &scan, 36);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_NewSeqNo);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_SequenceReset_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_SequenceReset_msg(ofixErr err, fix41SequenceReset m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_SequenceReset(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_SequenceReset(ofixErr err, fix41SequenceReset m) {
+    ofixMsg	msg = ofix_msg_create(err, "4", 4, 1, 27);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_GapFillFlag)) {
+	ofix_typed_set_view(err, msg, 123, &m->GapFillFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_NewSeqNo)) {
+	ofix_typed_set_int(err, msg, 36, m->NewSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_SequenceReset_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Logout [5]
+
+void
+fix41_decode_Logout(ofixErr err, fix41Logout m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Logout));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Logout_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Logout_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Logout_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Logout_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Logout_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Logout_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Logout_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Logout_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Logout_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Logout_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Logout_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logout_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Logout_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logout_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Logout_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logout_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Logout_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logout_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Logout_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Logout_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Logout_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Logout_OrigSendingTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_Logout_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Logout_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Logout_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Logout_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Logout_msg(ofixErr err, fix41Logout m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Logout(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Logout(ofixErr err, fix41Logout m) {
+    ofixMsg	msg = ofix_msg_create(err, "5", 4, 1, 26);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Logout_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logout_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// IndicationofInterest [6]
+
+static const int	IndicationofInterestGroup199[] = { 104, 0 };
+
+static const struct _ofixTypedGroup	IndicationofInterestGroups[] = {
+    { 199, -1, IndicationofInterestGroup199 }, // NoIOIQualifiers
+};
+
+void
+fix41_decode_IndicationofInterest(ofixErr err, fix41IndicationofInterest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41IndicationofInterest));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, IndicationofInterestGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_OrigSendingTime);
+	    break;
+	case 23: // IOIid
+	    ofix_typed_view(&scan, &m->IOIid);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IOIid);
+	    break;
+	case 28: // IOITransType
+	    ofix_typed_view(&scan, &m->IOITransType);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IOITransType);
+	    break;
+	case 26: // IOIRefID
+	    ofix_typed_view(&scan, &m->IOIRefID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IOIRefID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_Side);
+	    break;
+	case 27: // IOIShares
+	    ofix_typed_view(&scan, &m->IOIShares);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IOIShares);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_Price);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_Currency);
+	    break;
+	case 62: // ValidUntilTime
+	    ofix_typed_date(err, &scan, 62, OFIX_TIME, &m->ValidUntilTime);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_ValidUntilTime);
+	    break;
+	case 25: // IOIQltyInd
+	    ofix_typed_view(&scan, &m->IOIQltyInd);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IOIQltyInd);
+	    break;
+	case 24: // IOIOthSvc
+	    ofix_typed_view(&scan, &m->IOIOthSvc);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IOIOthSvc);
+	    break;
+	case 130: // IOINaturalFlag
+	    ofix_typed_view(&scan, &m->IOINaturalFlag);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_IOINaturalFlag);
+	    break;
+	case 199: // NoIOIQualifiers
+	    m->NoIOIQualifiers = ofix_typed_int(err, &scan, 199);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_NoIOIQualifiers);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_Text);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_TransactTime);
+	    break;
+	case 149: // URLLink
+	    ofix_typed_view(&scan, &m->URLLink);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_URLLink);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_IndicationofInterest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_IndicationofInterest_msg(ofixErr err, fix41IndicationofInterest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_IndicationofInterest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_IndicationofInterest(ofixErr err, fix41IndicationofInterest m) {
+    ofixMsg	msg = ofix_msg_create(err, "6", 4, 1, 53);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IOIid)) {
+	ofix_typed_set_view(err, msg, 23, &m->IOIid);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IOITransType)) {
+	ofix_typed_set_view(err, msg, 28, &m->IOITransType);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IOIRefID)) {
+	ofix_typed_set_view(err, msg, 26, &m->IOIRefID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IOIShares)) {
+	ofix_typed_set_view(err, msg, 27, &m->IOIShares);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_ValidUntilTime)) {
+	ofix_msg_set_date(err, msg, 62, &m->ValidUntilTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IOIQltyInd)) {
+	ofix_typed_set_view(err, msg, 25, &m->IOIQltyInd);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IOIOthSvc)) {
+	ofix_typed_set_view(err, msg, 24, &m->IOIOthSvc);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_IOINaturalFlag)) {
+	ofix_typed_set_view(err, msg, 130, &m->IOINaturalFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_NoIOIQualifiers)) {
+	ofix_typed_set_int(err, msg, 199, m->NoIOIQualifiers);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_URLLink)) {
+	ofix_typed_set_view(err, msg, 149, &m->URLLink);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_IndicationofInterest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Advertisement [7]
+
+void
+fix41_decode_Advertisement(ofixErr err, fix41Advertisement m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Advertisement));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_OrigSendingTime);
+	    break;
+	case 2: // AdvId
+	    ofix_typed_view(&scan, &m->AdvId);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_AdvId);
+	    break;
+	case 5: // AdvTransType
+	    ofix_typed_view(&scan, &m->AdvTransType);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_AdvTransType);
+	    break;
+	case 3: // AdvRefID
+	    ofix_typed_view(&scan, &m->AdvRefID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_AdvRefID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SecurityDesc);
+	    break;
+	case 4: // AdvSide
+	    ofix_typed_view(&scan, &m->AdvSide);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_AdvSide);
+	    break;
+	case 53: // Shares
+	    m->Shares = ofix_typed_int(err, &scan, 53);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_Shares);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_Price);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_Currency);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_TransactTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_Text);
+	    break;
+	case 149: // URLLink
+	    ofix_typed_view(&scan, &m->URLLink);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_URLLink);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_LastMkt);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Advertisement_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Advertisement_msg(ofixErr err, fix41Advertisement m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Advertisement(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Advertisement(ofixErr err, fix41Advertisement m) {
+    ofixMsg	msg = ofix_msg_create(err, "7", 4, 1, 50);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_AdvId)) {
+	ofix_typed_set_view(err, msg, 2, &m->AdvId);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_AdvTransType)) {
+	ofix_typed_set_view(err, msg, 5, &m->AdvTransType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_AdvRefID)) {
+	ofix_typed_set_view(err, msg, 3, &m->AdvRefID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_AdvSide)) {
+	ofix_typed_set_view(err, msg, 4, &m->AdvSide);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_Shares)) {
+	ofix_typed_set_int(err, msg, 53, m->Shares);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_URLLink)) {
+	ofix_typed_set_view(err, msg, 149, &m->URLLink);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Advertisement_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ExecutionReport [8]
+
+void
+fix41_decode_ExecutionReport(ofixErr err, fix41ExecutionReport m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41ExecutionReport));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OrderID);
+	    break;
+	case 198: // SecondaryOrderID
+	    ofix_typed_view(&scan, &m->SecondaryOrderID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SecondaryOrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ClOrdID);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OrigClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ExecBroker);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ListID);
+	    break;
+	case 17: // ExecID
+	    ofix_typed_view(&scan, &m->ExecID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ExecID);
+	    break;
+	case 20: // ExecTransType
+	    ofix_typed_view(&scan, &m->ExecTransType);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ExecTransType);
+	    break;
+	case 19: // ExecRefID
+	    ofix_typed_view(&scan, &m->ExecRefID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ExecRefID);
+	    break;
+	case 150: // ExecType
+	    ofix_typed_view(&scan, &m->ExecType);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ExecType);
+	    break;
+	case 39: // OrdStatus
+	    ofix_typed_view(&scan, &m->OrdStatus);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OrdStatus);
+	    break;
+	case 103: // OrdRejReason
+	    m->OrdRejReason = ofix_typed_int(err, &scan, 103);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OrdRejReason);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_FutSettDate);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_StopPx);
+	    break;
+	case 211: // PegDifference
+	    ofix_typed_decimal(err, &scan, 211, &m->PegDifference);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_PegDifference);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Currency);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ExpireTime);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ExecInst);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Rule80A);
+	    break;
+	case 32: // LastShares
+	    m->LastShares = ofix_typed_int(err, &scan, 32);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_LastShares);
+	    break;
+	case 31: // LastPx
+	    ofix_typed_decimal(err, &scan, 31, &m->LastPx);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_LastPx);
+	    break;
+	case 194: // LastSpotRate
+	    ofix_typed_decimal(err, &scan, 194, &m->LastSpotRate);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_LastSpotRate);
+	    break;
+	case 195: // LastForwardPoints
+	    ofix_typed_decimal(err, &scan, 195, &m->LastForwardPoints);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_LastForwardPoints);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_LastMkt);
+	    break;
+	case 29: // LastCapacity
+	    ofix_typed_view(&scan, &m->LastCapacity);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_LastCapacity);
+	    break;
+	case 151: // LeavesQty
+	    m->LeavesQty = ofix_typed_int(err, &scan, 151);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_LeavesQty);
+	    break;
+	case 14: // CumQty
+	    m->CumQty = ofix_typed_int(err, &scan, 14);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_CumQty);
+	    break;
+	case 6: // AvgPx
+	    ofix_typed_decimal(err, &scan, 6, &m->AvgPx);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_AvgPx);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_TransactTime);
+	    break;
+	case 113: // ReportToExch
+	    ofix_typed_view(&scan, &m->ReportToExch);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_ReportToExch);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_CommType);
+	    break;
+	case 119: // SettlCurrAmt
+	    ofix_typed_decimal(err, &scan, 119, &m->SettlCurrAmt);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SettlCurrAmt);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_ExecutionReport_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_ExecutionReport_msg(ofixErr err, fix41ExecutionReport m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_ExecutionReport(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_ExecutionReport(ofixErr err, fix41ExecutionReport m) {
+    ofixMsg	msg = ofix_msg_create(err, "8", 4, 1, 82);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SecondaryOrderID)) {
+	ofix_typed_set_view(err, msg, 198, &m->SecondaryOrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ExecID)) {
+	ofix_typed_set_view(err, msg, 17, &m->ExecID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ExecTransType)) {
+	ofix_typed_set_view(err, msg, 20, &m->ExecTransType);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ExecRefID)) {
+	ofix_typed_set_view(err, msg, 19, &m->ExecRefID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ExecType)) {
+	ofix_typed_set_view(err, msg, 150, &m->ExecType);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OrdStatus)) {
+	ofix_typed_set_view(err, msg, 39, &m->OrdStatus);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OrdRejReason)) {
+	ofix_typed_set_int(err, msg, 103, m->OrdRejReason);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_PegDifference)) {
+	ofix_typed_set_decimal(err, msg, 211, &m->PegDifference);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_LastShares)) {
+	ofix_typed_set_int(err, msg, 32, m->LastShares);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_LastPx)) {
+	ofix_typed_set_decimal(err, msg, 31, &m->LastPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_LastSpotRate)) {
+	ofix_typed_set_decimal(err, msg, 194, &m->LastSpotRate);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_LastForwardPoints)) {
+	ofix_typed_set_decimal(err, msg, 195, &m->LastForwardPoints);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_LastCapacity)) {
+	ofix_typed_set_view(err, msg, 29, &m->LastCapacity);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_LeavesQty)) {
+	ofix_typed_set_int(err, msg, 151, m->LeavesQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_CumQty)) {
+	ofix_typed_set_int(err, msg, 14, m->CumQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_AvgPx)) {
+	ofix_typed_set_decimal(err, msg, 6, &m->AvgPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_ReportToExch)) {
+	ofix_typed_set_view(err, msg, 113, &m->ReportToExch);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SettlCurrAmt)) {
+	ofix_typed_set_decimal(err, msg, 119, &m->SettlCurrAmt);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_ExecutionReport_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelReject [9]
+
+void
+fix41_decode_OrderCancelReject(ofixErr err, fix41OrderCancelReject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41OrderCancelReject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_OrderID);
+	    break;
+	case 198: // SecondaryOrderID
+	    ofix_typed_view(&scan, &m->SecondaryOrderID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SecondaryOrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_ClOrdID);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_OrigClOrdID);
+	    break;
+	case 39: // OrdStatus
+	    ofix_typed_view(&scan, &m->OrdStatus);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_OrdStatus);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_ExecBroker);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_ListID);
+	    break;
+	case 102: // CxlRejReason
+	    m->CxlRejReason = ofix_typed_int(err, &scan, 102);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_CxlRejReason);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_OrderCancelReject_msg(ofixErr err, fix41OrderCancelReject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_OrderCancelReject(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_OrderCancelReject(ofixErr err, fix41OrderCancelReject m) {
+    ofixMsg	msg = ofix_msg_create(err, "9", 4, 1, 35);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SecondaryOrderID)) {
+	ofix_typed_set_view(err, msg, 198, &m->SecondaryOrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_OrdStatus)) {
+	ofix_typed_set_view(err, msg, 39, &m->OrdStatus);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_CxlRejReason)) {
+	ofix_typed_set_int(err, msg, 102, m->CxlRejReason);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Logon [A]
+
+void
+fix41_decode_Logon(ofixErr err, fix41Logon m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Logon));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Logon_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Logon_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Logon_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Logon_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Logon_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Logon_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Logon_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Logon_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Logon_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Logon_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Logon_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logon_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Logon_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logon_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Logon_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logon_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Logon_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Logon_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Logon_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Logon_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Logon_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Logon_OrigSendingTime);
+	    break;
+	case 98: // EncryptMethod
+	    m->EncryptMethod = ofix_typed_int(err, &scan, 98);
+	    ofix_typed_mark(m->present, FIX41_Logon_EncryptMethod);
+	    break;
+	case 108: // HeartBtInt
+	    m->HeartBtInt = ofix_typed_int(err, &scan, 108);
+	    ofix_typed_mark(m->present, FIX41_Logon_HeartBtInt);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX41_Logon_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX41_Logon_RawData);
+	    break;
+	case 141: // ResetSeqNumFlag
+	    ofix_typed_view(&scan, &m->ResetSeqNumFlag);
+	    ofix_typed_mark(m->present, FIX41_Logon_ResetSeqNumFlag);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Logon_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Logon_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Logon_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Logon_msg(ofixErr err, fix41Logon m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Logon(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Logon(ofixErr err, fix41Logon m) {
+    ofixMsg	msg = ofix_msg_create(err, "A", 4, 1, 30);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Logon_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_EncryptMethod)) {
+	ofix_typed_set_int(err, msg, 98, m->EncryptMethod);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_HeartBtInt)) {
+	ofix_typed_set_int(err, msg, 108, m->HeartBtInt);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_ResetSeqNumFlag)) {
+	ofix_typed_set_view(err, msg, 141, &m->ResetSeqNumFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Logon_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// News [B]
+
+static const int	NewsGroup146[] = { 46, 65, 48, 22, 167, 200, 205, 201, 202, 206, 207, 106, 107, 0 };
+static const int	NewsGroup33[] = { 58, 0 };
+
+static const struct _ofixTypedGroup	NewsGroups[] = {
+    { 146, -1, NewsGroup146 }, // NoRelatedSym
+    { 33, -1, NewsGroup33 }, // LinesOfText
+};
+
+void
+fix41_decode_News(ofixErr err, fix41News m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41News));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, NewsGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_News_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_News_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_News_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_News_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_News_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_News_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_News_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_News_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_News_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_News_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_News_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_News_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_News_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_News_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_News_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_News_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_News_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_News_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_News_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_News_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_News_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_News_OrigSendingTime);
+	    break;
+	case 42: // OrigTime
+	    ofix_typed_date(err, &scan, 42, OFIX_TIME, &m->OrigTime);
+	    ofix_typed_mark(m->present, FIX41_News_OrigTime);
+	    break;
+	case 61: // Urgency
+	    ofix_typed_view(&scan, &m->Urgency);
+	    ofix_typed_mark(m->present, FIX41_News_Urgency);
+	    break;
+	case 148: // Headline
+	    ofix_typed_view(&scan, &m->Headline);
+	    ofix_typed_mark(m->present, FIX41_News_Headline);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX41_News_NoRelatedSym);
+	    break;
+	case 33: // LinesOfText
+	    m->LinesOfText = ofix_typed_int(err, &scan, 33);
+	    ofix_typed_mark(m->present, FIX41_News_LinesOfText);
+	    break;
+	case 149: // URLLink
+	    ofix_typed_view(&scan, &m->URLLink);
+	    ofix_typed_mark(m->present, FIX41_News_URLLink);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX41_News_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX41_News_RawData);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_News_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_News_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_News_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_News_msg(ofixErr err, fix41News m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_News(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_News(ofixErr err, fix41News m) {
+    ofixMsg	msg = ofix_msg_create(err, "B", 4, 1, 33);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_News_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_OrigTime)) {
+	ofix_msg_set_date(err, msg, 42, &m->OrigTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_Urgency)) {
+	ofix_typed_set_view(err, msg, 61, &m->Urgency);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_Headline)) {
+	ofix_typed_set_view(err, msg, 148, &m->Headline);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_LinesOfText)) {
+	ofix_typed_set_int(err, msg, 33, m->LinesOfText);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_URLLink)) {
+	ofix_typed_set_view(err, msg, 149, &m->URLLink);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_News_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Email [C]
+
+static const int	EmailGroup146[] = { 46, 65, 48, 22, 167, 200, 205, 201, 202, 206, 207, 106, 107, 0 };
+static const int	EmailGroup33[] = { 58, 0 };
+
+static const struct _ofixTypedGroup	EmailGroups[] = {
+    { 146, -1, EmailGroup146 }, // NoRelatedSym
+    { 33, -1, EmailGroup33 }, // LinesOfText
+};
+
+void
+fix41_decode_Email(ofixErr err, fix41Email m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Email));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, EmailGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Email_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Email_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Email_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Email_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Email_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Email_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Email_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Email_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Email_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Email_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Email_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Email_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Email_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Email_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Email_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Email_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Email_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Email_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Email_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Email_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Email_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Email_OrigSendingTime);
+	    break;
+	case 164: // EmailThreadID
+	    ofix_typed_view(&scan, &m->EmailThreadID);
+	    ofix_typed_mark(m->present, FIX41_Email_EmailThreadID);
+	    break;
+	case 94: // EmailType
+	    ofix_typed_view(&scan, &m->EmailType);
+	    ofix_typed_mark(m->present, FIX41_Email_EmailType);
+	    break;
+	case 42: // OrigTime
+	    ofix_typed_date(err, &scan, 42, OFIX_TIME, &m->OrigTime);
+	    ofix_typed_mark(m->present, FIX41_Email_OrigTime);
+	    break;
+	case 147: // Subject
+	    ofix_typed_view(&scan, &m->Subject);
+	    ofix_typed_mark(m->present, FIX41_Email_Subject);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX41_Email_NoRelatedSym);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX41_Email_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_Email_ClOrdID);
+	    break;
+	case 33: // LinesOfText
+	    m->LinesOfText = ofix_typed_int(err, &scan, 33);
+	    ofix_typed_mark(m->present, FIX41_Email_LinesOfText);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX41_Email_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX41_Email_RawData);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Email_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Email_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Email_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Email_msg(ofixErr err, fix41Email m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Email(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Email(ofixErr err, fix41Email m) {
+    ofixMsg	msg = ofix_msg_create(err, "C", 4, 1, 35);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Email_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_EmailThreadID)) {
+	ofix_typed_set_view(err, msg, 164, &m->EmailThreadID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_EmailType)) {
+	ofix_typed_set_view(err, msg, 94, &m->EmailType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_OrigTime)) {
+	ofix_msg_set_date(err, msg, 42, &m->OrigTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_Subject)) {
+	ofix_typed_set_view(err, msg, 147, &m->Subject);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_LinesOfText)) {
+	ofix_typed_set_int(err, msg, 33, m->LinesOfText);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Email_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// NewOrderSingle [D]
+
+void
+fix41_decode_NewOrderSingle(ofixErr err, fix41NewOrderSingle m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41NewOrderSingle));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OrigSendingTime);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ExecBroker);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    ofix_typed_view(&scan, &m->HandlInst);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ExecInst);
+	    break;
+	case 110: // MinQty
+	    m->MinQty = ofix_typed_int(err, &scan, 110);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    m->MaxFloor = ofix_typed_int(err, &scan, 111);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ExDestination);
+	    break;
+	case 81: // ProcessCode
+	    ofix_typed_view(&scan, &m->ProcessCode);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ProcessCode);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SecurityDesc);
+	    break;
+	case 140: // PrevClosePx
+	    ofix_typed_decimal(err, &scan, 140, &m->PrevClosePx);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_PrevClosePx);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Side);
+	    break;
+	case 114: // LocateReqd
+	    ofix_typed_view(&scan, &m->LocateReqd);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_LocateReqd);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_CashOrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_StopPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Currency);
+	    break;
+	case 23: // IOIid
+	    ofix_typed_view(&scan, &m->IOIid);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_IOIid);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_QuoteID);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ExpireTime);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_CommType);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    ofix_typed_view(&scan, &m->ForexReq);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Text);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_date(err, &scan, 193, OFIX_DATEONLY, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OrderQty2);
+	    break;
+	case 77: // OpenClose
+	    ofix_typed_view(&scan, &m->OpenClose);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_OpenClose);
+	    break;
+	case 203: // CoveredOrUncovered
+	    m->CoveredOrUncovered = ofix_typed_int(err, &scan, 203);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_CoveredOrUncovered);
+	    break;
+	case 204: // CustomerOrFirm
+	    m->CustomerOrFirm = ofix_typed_int(err, &scan, 204);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_CustomerOrFirm);
+	    break;
+	case 210: // MaxShow
+	    m->MaxShow = ofix_typed_int(err, &scan, 210);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_MaxShow);
+	    break;
+	case 211: // PegDifference
+	    ofix_typed_decimal(err, &scan, 211, &m->PegDifference);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_PegDifference);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_NewOrderSingle_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_NewOrderSingle_msg(ofixErr err, fix41NewOrderSingle m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_NewOrderSingle(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_NewOrderSingle(ofixErr err, fix41NewOrderSingle m) {
+    ofixMsg	msg = ofix_msg_create(err, "D", 4, 1, 76);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_HandlInst)) {
+	ofix_typed_set_view(err, msg, 21, &m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_MinQty)) {
+	ofix_typed_set_int(err, msg, 110, m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_MaxFloor)) {
+	ofix_typed_set_int(err, msg, 111, m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ProcessCode)) {
+	ofix_typed_set_view(err, msg, 81, &m->ProcessCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_PrevClosePx)) {
+	ofix_typed_set_decimal(err, msg, 140, &m->PrevClosePx);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_LocateReqd)) {
+	ofix_typed_set_view(err, msg, 114, &m->LocateReqd);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_IOIid)) {
+	ofix_typed_set_view(err, msg, 23, &m->IOIid);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_ForexReq)) {
+	ofix_typed_set_view(err, msg, 121, &m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_FutSettDate2)) {
+	ofix_msg_set_date(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_OpenClose)) {
+	ofix_typed_set_view(err, msg, 77, &m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_CoveredOrUncovered)) {
+	ofix_typed_set_int(err, msg, 203, m->CoveredOrUncovered);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_CustomerOrFirm)) {
+	ofix_typed_set_int(err, msg, 204, m->CustomerOrFirm);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_MaxShow)) {
+	ofix_typed_set_int(err, msg, 210, m->MaxShow);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_PegDifference)) {
+	ofix_typed_set_decimal(err, msg, 211, &m->PegDifference);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderSingle_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// NewOrderList [E]
+
+void
+fix41_decode_NewOrderList(ofixErr err, fix41NewOrderList m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41NewOrderList));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_WaveNo);
+	    break;
+	case 67: // ListSeqNo
+	    m->ListSeqNo = ofix_typed_int(err, &scan, 67);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ListSeqNo);
+	    break;
+	case 68: // ListNoOrds
+	    m->ListNoOrds = ofix_typed_int(err, &scan, 68);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ListNoOrds);
+	    break;
+	case 69: // ListExecInst
+	    ofix_typed_view(&scan, &m->ListExecInst);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ListExecInst);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ExecBroker);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    ofix_typed_view(&scan, &m->HandlInst);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ExecInst);
+	    break;
+	case 110: // MinQty
+	    m->MinQty = ofix_typed_int(err, &scan, 110);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    m->MaxFloor = ofix_typed_int(err, &scan, 111);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ExDestination);
+	    break;
+	case 81: // ProcessCode
+	    ofix_typed_view(&scan, &m->ProcessCode);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ProcessCode);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SecurityDesc);
+	    break;
+	case 140: // PrevClosePx
+	    ofix_typed_decimal(err, &scan, 140, &m->PrevClosePx);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_PrevClosePx);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Side);
+	    break;
+	case 114: // LocateReqd
+	    ofix_typed_view(&scan, &m->LocateReqd);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_LocateReqd);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_StopPx);
+	    break;
+	case 211: // PegDifference
+	    ofix_typed_decimal(err, &scan, 211, &m->PegDifference);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_PegDifference);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Currency);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ExpireTime);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_CommType);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    ofix_typed_view(&scan, &m->ForexReq);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Text);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_date(err, &scan, 193, OFIX_DATEONLY, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OrderQty2);
+	    break;
+	case 77: // OpenClose
+	    ofix_typed_view(&scan, &m->OpenClose);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_OpenClose);
+	    break;
+	case 203: // CoveredOrUncovered
+	    m->CoveredOrUncovered = ofix_typed_int(err, &scan, 203);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_CoveredOrUncovered);
+	    break;
+	case 204: // CustomerOrFirm
+	    m->CustomerOrFirm = ofix_typed_int(err, &scan, 204);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_CustomerOrFirm);
+	    break;
+	case 210: // MaxShow
+	    m->MaxShow = ofix_typed_int(err, &scan, 210);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_MaxShow);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_NewOrderList_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_NewOrderList_msg(ofixErr err, fix41NewOrderList m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_NewOrderList(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_NewOrderList(ofixErr err, fix41NewOrderList m) {
+    ofixMsg	msg = ofix_msg_create(err, "E", 4, 1, 78);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ListSeqNo)) {
+	ofix_typed_set_int(err, msg, 67, m->ListSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ListNoOrds)) {
+	ofix_typed_set_int(err, msg, 68, m->ListNoOrds);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ListExecInst)) {
+	ofix_typed_set_view(err, msg, 69, &m->ListExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_HandlInst)) {
+	ofix_typed_set_view(err, msg, 21, &m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_MinQty)) {
+	ofix_typed_set_int(err, msg, 110, m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_MaxFloor)) {
+	ofix_typed_set_int(err, msg, 111, m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ProcessCode)) {
+	ofix_typed_set_view(err, msg, 81, &m->ProcessCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_PrevClosePx)) {
+	ofix_typed_set_decimal(err, msg, 140, &m->PrevClosePx);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_LocateReqd)) {
+	ofix_typed_set_view(err, msg, 114, &m->LocateReqd);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_PegDifference)) {
+	ofix_typed_set_decimal(err, msg, 211, &m->PegDifference);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_ForexReq)) {
+	ofix_typed_set_view(err, msg, 121, &m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_FutSettDate2)) {
+	ofix_msg_set_date(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_OpenClose)) {
+	ofix_typed_set_view(err, msg, 77, &m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_CoveredOrUncovered)) {
+	ofix_typed_set_int(err, msg, 203, m->CoveredOrUncovered);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_CustomerOrFirm)) {
+	ofix_typed_set_int(err, msg, 204, m->CustomerOrFirm);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_MaxShow)) {
+	ofix_typed_set_int(err, msg, 210, m->MaxShow);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_NewOrderList_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelRequest [F]
+
+void
+fix41_decode_OrderCancelRequest(ofixErr err, fix41OrderCancelRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41OrderCancelRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OrigSendingTime);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OrigClOrdID);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_ClOrdID);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_ListID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_ExecBroker);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_CashOrderQty);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_OrderCancelRequest_msg(ofixErr err, fix41OrderCancelRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_OrderCancelRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_OrderCancelRequest(ofixErr err, fix41OrderCancelRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "F", 4, 1, 48);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelReplaceRequest [G]
+
+void
+fix41_decode_OrderCancelReplaceRequest(ofixErr err, fix41OrderCancelReplaceRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41OrderCancelReplaceRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OrderID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ExecBroker);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OrigClOrdID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ClOrdID);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ListID);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    ofix_typed_view(&scan, &m->HandlInst);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ExecInst);
+	    break;
+	case 110: // MinQty
+	    m->MinQty = ofix_typed_int(err, &scan, 110);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    m->MaxFloor = ofix_typed_int(err, &scan, 111);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ExDestination);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_CashOrderQty);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_StopPx);
+	    break;
+	case 211: // PegDifference
+	    ofix_typed_decimal(err, &scan, 211, &m->PegDifference);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_PegDifference);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Currency);
+	    break;
+	case 59: // TimeInForce
+	    ofix_typed_view(&scan, &m->TimeInForce);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_TimeInForce);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIME, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ExpireTime);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Commission);
+	    break;
+	case 13: // CommType
+	    ofix_typed_view(&scan, &m->CommType);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_CommType);
+	    break;
+	case 47: // Rule80A
+	    ofix_typed_view(&scan, &m->Rule80A);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    ofix_typed_view(&scan, &m->ForexReq);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Text);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_date(err, &scan, 193, OFIX_DATEONLY, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OrderQty2);
+	    break;
+	case 77: // OpenClose
+	    ofix_typed_view(&scan, &m->OpenClose);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_OpenClose);
+	    break;
+	case 203: // CoveredOrUncovered
+	    m->CoveredOrUncovered = ofix_typed_int(err, &scan, 203);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_CoveredOrUncovered);
+	    break;
+	case 204: // CustomerOrFirm
+	    m->CustomerOrFirm = ofix_typed_int(err, &scan, 204);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_CustomerOrFirm);
+	    break;
+	case 210: // MaxShow
+	    m->MaxShow = ofix_typed_int(err, &scan, 210);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_MaxShow);
+	    break;
+	case 114: // LocateReqd
+	    ofix_typed_view(&scan, &m->LocateReqd);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_LocateReqd);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_OrderCancelReplaceRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix41OrderCancelReplaceRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_OrderCancelReplaceRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_OrderCancelReplaceRequest(ofixErr err, fix41OrderCancelReplaceRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "G", 4, 1, 75);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_HandlInst)) {
+	ofix_typed_set_view(err, msg, 21, &m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_MinQty)) {
+	ofix_typed_set_int(err, msg, 110, m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_MaxFloor)) {
+	ofix_typed_set_int(err, msg, 111, m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_PegDifference)) {
+	ofix_typed_set_decimal(err, msg, 211, &m->PegDifference);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_TimeInForce)) {
+	ofix_typed_set_view(err, msg, 59, &m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_CommType)) {
+	ofix_typed_set_view(err, msg, 13, &m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Rule80A)) {
+	ofix_typed_set_view(err, msg, 47, &m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_ForexReq)) {
+	ofix_typed_set_view(err, msg, 121, &m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_FutSettDate2)) {
+	ofix_msg_set_date(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_OpenClose)) {
+	ofix_typed_set_view(err, msg, 77, &m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_CoveredOrUncovered)) {
+	ofix_typed_set_int(err, msg, 203, m->CoveredOrUncovered);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_CustomerOrFirm)) {
+	ofix_typed_set_int(err, msg, 204, m->CustomerOrFirm);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_MaxShow)) {
+	ofix_typed_set_int(err, msg, 210, m->MaxShow);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_LocateReqd)) {
+	ofix_typed_set_view(err, msg, 114, &m->LocateReqd);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderCancelReplaceRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderStatusRequest [H]
+
+void
+fix41_decode_OrderStatusRequest(ofixErr err, fix41OrderStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41OrderStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_ExecBroker);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_Side);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_OrderStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_OrderStatusRequest_msg(ofixErr err, fix41OrderStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_OrderStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_OrderStatusRequest(ofixErr err, fix41OrderStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "H", 4, 1, 43);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_OrderStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Allocation [J]
+
+static const int	AllocationGroup73[] = { 11, 37, 198, 66, 105, 0 };
+static const int	AllocationGroup124[] = { 32, 17, 31, 29, 0 };
+static const int	AllocationGroup78[] = { 79, 80, 81, 92, 208, 209, 161, 76, 109, 12, 13, 153, 154, 119, 120, 155, 156, 159, 160, 136, 0 };
+static const int	AllocationGroup136[] = { 137, 138, 139, 0 };
+
+static const struct _ofixTypedGroup	AllocationGroups[] = {
+    { 73, -1, AllocationGroup73 }, // NoOrders
+    { 124, -1, AllocationGroup124 }, // NoExecs
+    { 78, -1, AllocationGroup78 }, // NoAllocs
+    { 136, 2, AllocationGroup136 }, // NoMiscFees
+};
+
+void
+fix41_decode_Allocation(ofixErr err, fix41Allocation m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Allocation));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, AllocationGroups, 4);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Allocation_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Allocation_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Allocation_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Allocation_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Allocation_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Allocation_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Allocation_OrigSendingTime);
+	    break;
+	case 70: // AllocID
+	    ofix_typed_view(&scan, &m->AllocID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_AllocID);
+	    break;
+	case 71: // AllocTransType
+	    ofix_typed_view(&scan, &m->AllocTransType);
+	    ofix_typed_mark(m->present, FIX41_Allocation_AllocTransType);
+	    break;
+	case 72: // RefAllocID
+	    ofix_typed_view(&scan, &m->RefAllocID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_RefAllocID);
+	    break;
+	case 196: // AllocLinkID
+	    ofix_typed_view(&scan, &m->AllocLinkID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_AllocLinkID);
+	    break;
+	case 197: // AllocLinkType
+	    m->AllocLinkType = ofix_typed_int(err, &scan, 197);
+	    ofix_typed_mark(m->present, FIX41_Allocation_AllocLinkType);
+	    break;
+	case 73: // NoOrders
+	    m->NoOrders = ofix_typed_int(err, &scan, 73);
+	    ofix_typed_mark(m->present, FIX41_Allocation_NoOrders);
+	    break;
+	case 124: // NoExecs
+	    m->NoExecs = ofix_typed_int(err, &scan, 124);
+	    ofix_typed_mark(m->present, FIX41_Allocation_NoExecs);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_Allocation_Side);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_Allocation_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_Allocation_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_Allocation_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_Allocation_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_Allocation_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_Allocation_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_Allocation_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_Allocation_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SecurityDesc);
+	    break;
+	case 53: // Shares
+	    m->Shares = ofix_typed_int(err, &scan, 53);
+	    ofix_typed_mark(m->present, FIX41_Allocation_Shares);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX41_Allocation_LastMkt);
+	    break;
+	case 6: // AvgPx
+	    ofix_typed_decimal(err, &scan, 6, &m->AvgPx);
+	    ofix_typed_mark(m->present, FIX41_Allocation_AvgPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX41_Allocation_Currency);
+	    break;
+	case 74: // AvgPrxPrecision
+	    m->AvgPrxPrecision = ofix_typed_int(err, &scan, 74);
+	    ofix_typed_mark(m->present, FIX41_Allocation_AvgPrxPrecision);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX41_Allocation_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX41_Allocation_TransactTime);
+	    break;
+	case 63: // SettlmntTyp
+	    ofix_typed_view(&scan, &m->SettlmntTyp);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX41_Allocation_FutSettDate);
+	    break;
+	case 118: // NetMoney
+	    ofix_typed_decimal(err, &scan, 118, &m->NetMoney);
+	    ofix_typed_mark(m->present, FIX41_Allocation_NetMoney);
+	    break;
+	case 77: // OpenClose
+	    ofix_typed_view(&scan, &m->OpenClose);
+	    ofix_typed_mark(m->present, FIX41_Allocation_OpenClose);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_Allocation_Text);
+	    break;
+	case 157: // NumDaysInterest
+	    m->NumDaysInterest = ofix_typed_int(err, &scan, 157);
+	    ofix_typed_mark(m->present, FIX41_Allocation_NumDaysInterest);
+	    break;
+	case 158: // AccruedInterestRate
+	    ofix_typed_decimal(err, &scan, 158, &m->AccruedInterestRate);
+	    ofix_typed_mark(m->present, FIX41_Allocation_AccruedInterestRate);
+	    break;
+	case 78: // NoAllocs
+	    m->NoAllocs = ofix_typed_int(err, &scan, 78);
+	    ofix_typed_mark(m->present, FIX41_Allocation_NoAllocs);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Allocation_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Allocation_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Allocation_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Allocation_msg(ofixErr err, fix41Allocation m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Allocation(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Allocation(ofixErr err, fix41Allocation m) {
+    ofixMsg	msg = ofix_msg_create(err, "J", 4, 1, 61);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Allocation_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_AllocID)) {
+	ofix_typed_set_view(err, msg, 70, &m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_AllocTransType)) {
+	ofix_typed_set_view(err, msg, 71, &m->AllocTransType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_RefAllocID)) {
+	ofix_typed_set_view(err, msg, 72, &m->RefAllocID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_AllocLinkID)) {
+	ofix_typed_set_view(err, msg, 196, &m->AllocLinkID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_AllocLinkType)) {
+	ofix_typed_set_int(err, msg, 197, m->AllocLinkType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_NoOrders)) {
+	ofix_typed_set_int(err, msg, 73, m->NoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_NoExecs)) {
+	ofix_typed_set_int(err, msg, 124, m->NoExecs);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_Shares)) {
+	ofix_typed_set_int(err, msg, 53, m->Shares);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_AvgPx)) {
+	ofix_typed_set_decimal(err, msg, 6, &m->AvgPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_AvgPrxPrecision)) {
+	ofix_typed_set_int(err, msg, 74, m->AvgPrxPrecision);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SettlmntTyp)) {
+	ofix_typed_set_view(err, msg, 63, &m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_NetMoney)) {
+	ofix_typed_set_decimal(err, msg, 118, &m->NetMoney);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_OpenClose)) {
+	ofix_typed_set_view(err, msg, 77, &m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_NumDaysInterest)) {
+	ofix_typed_set_int(err, msg, 157, m->NumDaysInterest);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_AccruedInterestRate)) {
+	ofix_typed_set_decimal(err, msg, 158, &m->AccruedInterestRate);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_NoAllocs)) {
+	ofix_typed_set_int(err, msg, 78, m->NoAllocs);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Allocation_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListCancelRequest [K]
+
+void
+fix41_decode_ListCancelRequest(ofixErr err, fix41ListCancelRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41ListCancelRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_WaveNo);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_ListCancelRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_ListCancelRequest_msg(ofixErr err, fix41ListCancelRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_ListCancelRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_ListCancelRequest(ofixErr err, fix41ListCancelRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "K", 4, 1, 28);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListCancelRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListExecute [L]
+
+void
+fix41_decode_ListExecute(ofixErr err, fix41ListExecute m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41ListExecute));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_WaveNo);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_ListExecute_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_ListExecute_msg(ofixErr err, fix41ListExecute m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_ListExecute(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_ListExecute(ofixErr err, fix41ListExecute m) {
+    ofixMsg	msg = ofix_msg_create(err, "L", 4, 1, 28);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_ListExecute_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListExecute_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListStatusRequest [M]
+
+void
+fix41_decode_ListStatusRequest(ofixErr err, fix41ListStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41ListStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_WaveNo);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_ListStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_ListStatusRequest_msg(ofixErr err, fix41ListStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_ListStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_ListStatusRequest(ofixErr err, fix41ListStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "M", 4, 1, 28);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListStatus [N]
+
+static const int	ListStatusGroup73[] = { 11, 14, 151, 84, 6, 0 };
+
+static const struct _ofixTypedGroup	ListStatusGroups[] = {
+    { 73, -1, ListStatusGroup73 }, // NoOrders
+};
+
+void
+fix41_decode_ListStatus(ofixErr err, fix41ListStatus m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41ListStatus));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, ListStatusGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_OrigSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_ListID);
+	    break;
+	case 105: // WaveNo
+	    ofix_typed_view(&scan, &m->WaveNo);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_WaveNo);
+	    break;
+	case 82: // NoRpts
+	    m->NoRpts = ofix_typed_int(err, &scan, 82);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_NoRpts);
+	    break;
+	case 83: // RptSeq
+	    m->RptSeq = ofix_typed_int(err, &scan, 83);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_RptSeq);
+	    break;
+	case 73: // NoOrders
+	    m->NoOrders = ofix_typed_int(err, &scan, 73);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_NoOrders);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_ListStatus_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_ListStatus_msg(ofixErr err, fix41ListStatus m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_ListStatus(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_ListStatus(ofixErr err, fix41ListStatus m) {
+    ofixMsg	msg = ofix_msg_create(err, "N", 4, 1, 30);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_ListStatus_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_WaveNo)) {
+	ofix_typed_set_view(err, msg, 105, &m->WaveNo);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_NoRpts)) {
+	ofix_typed_set_int(err, msg, 82, m->NoRpts);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_RptSeq)) {
+	ofix_typed_set_int(err, msg, 83, m->RptSeq);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_NoOrders)) {
+	ofix_typed_set_int(err, msg, 73, m->NoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_ListStatus_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// AllocationACK [P]
+
+void
+fix41_decode_AllocationACK(ofixErr err, fix41AllocationACK m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41AllocationACK));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_OrigSendingTime);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_ExecBroker);
+	    break;
+	case 70: // AllocID
+	    ofix_typed_view(&scan, &m->AllocID);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_AllocID);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_TransactTime);
+	    break;
+	case 87: // AllocStatus
+	    m->AllocStatus = ofix_typed_int(err, &scan, 87);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_AllocStatus);
+	    break;
+	case 88: // AllocRejCode
+	    m->AllocRejCode = ofix_typed_int(err, &scan, 88);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_AllocRejCode);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_AllocationACK_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_AllocationACK_msg(ofixErr err, fix41AllocationACK m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_AllocationACK(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_AllocationACK(ofixErr err, fix41AllocationACK m) {
+    ofixMsg	msg = ofix_msg_create(err, "P", 4, 1, 33);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_AllocID)) {
+	ofix_typed_set_view(err, msg, 70, &m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_AllocStatus)) {
+	ofix_typed_set_int(err, msg, 87, m->AllocStatus);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_AllocRejCode)) {
+	ofix_typed_set_int(err, msg, 88, m->AllocRejCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_AllocationACK_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// DontKnowTrade [Q]
+
+void
+fix41_decode_DontKnowTrade(ofixErr err, fix41DontKnowTrade m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41DontKnowTrade));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_OrigSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_OrderID);
+	    break;
+	case 17: // ExecID
+	    ofix_typed_view(&scan, &m->ExecID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_ExecID);
+	    break;
+	case 127: // DKReason
+	    ofix_typed_view(&scan, &m->DKReason);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_DKReason);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SecurityDesc);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_CashOrderQty);
+	    break;
+	case 32: // LastShares
+	    m->LastShares = ofix_typed_int(err, &scan, 32);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_LastShares);
+	    break;
+	case 31: // LastPx
+	    ofix_typed_decimal(err, &scan, 31, &m->LastPx);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_LastPx);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_Text);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_DontKnowTrade_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_DontKnowTrade_msg(ofixErr err, fix41DontKnowTrade m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_DontKnowTrade(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_DontKnowTrade(ofixErr err, fix41DontKnowTrade m) {
+    ofixMsg	msg = ofix_msg_create(err, "Q", 4, 1, 47);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_ExecID)) {
+	ofix_typed_set_view(err, msg, 17, &m->ExecID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_DKReason)) {
+	ofix_typed_set_view(err, msg, 127, &m->DKReason);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_LastShares)) {
+	ofix_typed_set_int(err, msg, 32, m->LastShares);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_LastPx)) {
+	ofix_typed_set_decimal(err, msg, 31, &m->LastPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_DontKnowTrade_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// QuoteRequest [R]
+
+void
+fix41_decode_QuoteRequest(ofixErr err, fix41QuoteRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41QuoteRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OrigSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_QuoteReqID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SecurityDesc);
+	    break;
+	case 140: // PrevClosePx
+	    ofix_typed_decimal(err, &scan, 140, &m->PrevClosePx);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_PrevClosePx);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_Side);
+	    break;
+	case 38: // OrderQty
+	    m->OrderQty = ofix_typed_int(err, &scan, 38);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OrderQty);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_FutSettDate);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OrdType);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_date(err, &scan, 193, OFIX_DATEONLY, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_OrderQty2);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_QuoteRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_QuoteRequest_msg(ofixErr err, fix41QuoteRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_QuoteRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_QuoteRequest(ofixErr err, fix41QuoteRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "R", 4, 1, 46);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_PrevClosePx)) {
+	ofix_typed_set_decimal(err, msg, 140, &m->PrevClosePx);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OrderQty)) {
+	ofix_typed_set_int(err, msg, 38, m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_FutSettDate2)) {
+	ofix_msg_set_date(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_QuoteRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Quote [S]
+
+void
+fix41_decode_Quote(ofixErr err, fix41Quote m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41Quote));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_Quote_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_Quote_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_Quote_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_Quote_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_Quote_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_Quote_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_Quote_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_Quote_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_Quote_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_Quote_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_Quote_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_Quote_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_Quote_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_Quote_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_Quote_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_Quote_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_Quote_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_Quote_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_Quote_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_Quote_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_Quote_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_Quote_OrigSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX41_Quote_QuoteReqID);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX41_Quote_QuoteID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX41_Quote_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX41_Quote_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX41_Quote_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX41_Quote_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_Quote_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX41_Quote_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX41_Quote_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX41_Quote_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX41_Quote_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    ofix_typed_view(&scan, &m->OptAttribute);
+	    ofix_typed_mark(m->present, FIX41_Quote_OptAttribute);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX41_Quote_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX41_Quote_Issuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX41_Quote_SecurityDesc);
+	    break;
+	case 132: // BidPx
+	    ofix_typed_decimal(err, &scan, 132, &m->BidPx);
+	    ofix_typed_mark(m->present, FIX41_Quote_BidPx);
+	    break;
+	case 133: // OfferPx
+	    ofix_typed_decimal(err, &scan, 133, &m->OfferPx);
+	    ofix_typed_mark(m->present, FIX41_Quote_OfferPx);
+	    break;
+	case 134: // BidSize
+	    m->BidSize = ofix_typed_int(err, &scan, 134);
+	    ofix_typed_mark(m->present, FIX41_Quote_BidSize);
+	    break;
+	case 135: // OfferSize
+	    m->OfferSize = ofix_typed_int(err, &scan, 135);
+	    ofix_typed_mark(m->present, FIX41_Quote_OfferSize);
+	    break;
+	case 62: // ValidUntilTime
+	    ofix_typed_date(err, &scan, 62, OFIX_TIME, &m->ValidUntilTime);
+	    ofix_typed_mark(m->present, FIX41_Quote_ValidUntilTime);
+	    break;
+	case 188: // BidSpotRate
+	    ofix_typed_decimal(err, &scan, 188, &m->BidSpotRate);
+	    ofix_typed_mark(m->present, FIX41_Quote_BidSpotRate);
+	    break;
+	case 190: // OfferSpotRate
+	    ofix_typed_decimal(err, &scan, 190, &m->OfferSpotRate);
+	    ofix_typed_mark(m->present, FIX41_Quote_OfferSpotRate);
+	    break;
+	case 189: // BidForwardPoints
+	    ofix_typed_decimal(err, &scan, 189, &m->BidForwardPoints);
+	    ofix_typed_mark(m->present, FIX41_Quote_BidForwardPoints);
+	    break;
+	case 191: // OfferForwardPoints
+	    ofix_typed_decimal(err, &scan, 191, &m->OfferForwardPoints);
+	    ofix_typed_mark(m->present, FIX41_Quote_OfferForwardPoints);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX41_Quote_TransactTime);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_date(err, &scan, 64, OFIX_DATEONLY, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX41_Quote_FutSettDate);
+	    break;
+	case 40: // OrdType
+	    ofix_typed_view(&scan, &m->OrdType);
+	    ofix_typed_mark(m->present, FIX41_Quote_OrdType);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_date(err, &scan, 193, OFIX_DATEONLY, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX41_Quote_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX41_Quote_OrderQty2);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_Quote_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_Quote_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_Quote_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_Quote_msg(ofixErr err, fix41Quote m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_Quote(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_Quote(ofixErr err, fix41Quote m) {
+    ofixMsg	msg = ofix_msg_create(err, "S", 4, 1, 54);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_Quote_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OptAttribute)) {
+	ofix_typed_set_view(err, msg, 206, &m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_BidPx)) {
+	ofix_typed_set_decimal(err, msg, 132, &m->BidPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OfferPx)) {
+	ofix_typed_set_decimal(err, msg, 133, &m->OfferPx);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_BidSize)) {
+	ofix_typed_set_int(err, msg, 134, m->BidSize);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OfferSize)) {
+	ofix_typed_set_int(err, msg, 135, m->OfferSize);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_ValidUntilTime)) {
+	ofix_msg_set_date(err, msg, 62, &m->ValidUntilTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_BidSpotRate)) {
+	ofix_typed_set_decimal(err, msg, 188, &m->BidSpotRate);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OfferSpotRate)) {
+	ofix_typed_set_decimal(err, msg, 190, &m->OfferSpotRate);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_BidForwardPoints)) {
+	ofix_typed_set_decimal(err, msg, 189, &m->BidForwardPoints);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OfferForwardPoints)) {
+	ofix_typed_set_decimal(err, msg, 191, &m->OfferForwardPoints);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_FutSettDate)) {
+	ofix_msg_set_date(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OrdType)) {
+	ofix_typed_set_view(err, msg, 40, &m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_FutSettDate2)) {
+	ofix_msg_set_date(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_Quote_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SettlementInstructions [T]
+
+void
+fix41_decode_SettlementInstructions(ofixErr err, fix41SettlementInstructions m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix41SettlementInstructions));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    ofix_typed_view(&scan, &m->PossDupFlag);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    ofix_typed_view(&scan, &m->PossResend);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIME, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIME, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_OrigSendingTime);
+	    break;
+	case 162: // SettlInstID
+	    ofix_typed_view(&scan, &m->SettlInstID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlInstID);
+	    break;
+	case 163: // SettlInstTransType
+	    ofix_typed_view(&scan, &m->SettlInstTransType);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlInstTransType);
+	    break;
+	case 160: // SettlInstMode
+	    ofix_typed_view(&scan, &m->SettlInstMode);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlInstMode);
+	    break;
+	case 165: // SettlInstSource
+	    ofix_typed_view(&scan, &m->SettlInstSource);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlInstSource);
+	    break;
+	case 79: // AllocAccount
+	    ofix_typed_view(&scan, &m->AllocAccount);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_AllocAccount);
+	    break;
+	case 166: // SettlLocation
+	    ofix_typed_view(&scan, &m->SettlLocation);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlLocation);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_date(err, &scan, 75, OFIX_DATEONLY, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_TradeDate);
+	    break;
+	case 70: // AllocID
+	    ofix_typed_view(&scan, &m->AllocID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_AllocID);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_LastMkt);
+	    break;
+	case 54: // Side
+	    ofix_typed_view(&scan, &m->Side);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_Side);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecurityType);
+	    break;
+	case 168: // EffectiveTime
+	    ofix_typed_date(err, &scan, 168, OFIX_TIME, &m->EffectiveTime);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_EffectiveTime);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIME, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_TransactTime);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_ExecBroker);
+	    break;
+	case 169: // StandInstDbType
+	    m->StandInstDbType = ofix_typed_int(err, &scan, 169);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_StandInstDbType);
+	    break;
+	case 170: // StandInstDbName
+	    ofix_typed_view(&scan, &m->StandInstDbName);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_StandInstDbName);
+	    break;
+	case 171: // StandInstDbID
+	    ofix_typed_view(&scan, &m->StandInstDbID);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_StandInstDbID);
+	    break;
+	case 172: // SettlDeliveryType
+	    m->SettlDeliveryType = ofix_typed_int(err, &scan, 172);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlDeliveryType);
+	    break;
+	case 173: // SettlDepositoryCode
+	    ofix_typed_view(&scan, &m->SettlDepositoryCode);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlDepositoryCode);
+	    break;
+	case 174: // SettlBrkrCode
+	    ofix_typed_view(&scan, &m->SettlBrkrCode);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlBrkrCode);
+	    break;
+	case 175: // SettlInstCode
+	    ofix_typed_view(&scan, &m->SettlInstCode);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SettlInstCode);
+	    break;
+	case 176: // SecuritySettlAgentName
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentName);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecuritySettlAgentName);
+	    break;
+	case 177: // SecuritySettlAgentCode
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentCode);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecuritySettlAgentCode);
+	    break;
+	case 178: // SecuritySettlAgentAcctNum
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentAcctNum);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecuritySettlAgentAcctNum);
+	    break;
+	case 179: // SecuritySettlAgentAcctName
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentAcctName);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecuritySettlAgentAcctName);
+	    break;
+	case 180: // SecuritySettlAgentContactName
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentContactName);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecuritySettlAgentContactName);
+	    break;
+	case 181: // SecuritySettlAgentContactPhone
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentContactPhone);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SecuritySettlAgentContactPhone);
+	    break;
+	case 182: // CashSettlAgentName
+	    ofix_typed_view(&scan, &m->CashSettlAgentName);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_CashSettlAgentName);
+	    break;
+	case 183: // CashSettlAgentCode
+	    ofix_typed_view(&scan, &m->CashSettlAgentCode);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_CashSettlAgentCode);
+	    break;
+	case 184: // CashSettlAgentAcctNum
+	    ofix_typed_view(&scan, &m->CashSettlAgentAcctNum);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_CashSettlAgentAcctNum);
+	    break;
+	case 185: // CashSettlAgentAcctName
+	    ofix_typed_view(&scan, &m->CashSettlAgentAcctName);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_CashSettlAgentAcctName);
+	    break;
+	case 186: // CashSettlAgentContactName
+	    ofix_typed_view(&scan, &m->CashSettlAgentContactName);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_CashSettlAgentContactName);
+	    break;
+	case 187: // CashSettlAgentContactPhone
+	    ofix_typed_view(&scan, &m->CashSettlAgentContactPhone);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_CashSettlAgentContactPhone);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX41_SettlementInstructions_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix41_decode_SettlementInstructions_msg(ofixErr err, fix41SettlementInstructions m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix41_decode_SettlementInstructions(err, m, raw, len);
+}
+
+ofixMsg
+fix41_encode_SettlementInstructions(ofixErr err, fix41SettlementInstructions m) {
+    ofixMsg	msg = ofix_msg_create(err, "T", 4, 1, 59);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_PossDupFlag)) {
+	ofix_typed_set_view(err, msg, 43, &m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_PossResend)) {
+	ofix_typed_set_view(err, msg, 97, &m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlInstID)) {
+	ofix_typed_set_view(err, msg, 162, &m->SettlInstID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlInstTransType)) {
+	ofix_typed_set_view(err, msg, 163, &m->SettlInstTransType);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlInstMode)) {
+	ofix_typed_set_view(err, msg, 160, &m->SettlInstMode);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlInstSource)) {
+	ofix_typed_set_view(err, msg, 165, &m->SettlInstSource);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_AllocAccount)) {
+	ofix_typed_set_view(err, msg, 79, &m->AllocAccount);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlLocation)) {
+	ofix_typed_set_view(err, msg, 166, &m->SettlLocation);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_TradeDate)) {
+	ofix_msg_set_date(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_AllocID)) {
+	ofix_typed_set_view(err, msg, 70, &m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_Side)) {
+	ofix_typed_set_view(err, msg, 54, &m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_EffectiveTime)) {
+	ofix_msg_set_date(err, msg, 168, &m->EffectiveTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_StandInstDbType)) {
+	ofix_typed_set_int(err, msg, 169, m->StandInstDbType);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_StandInstDbName)) {
+	ofix_typed_set_view(err, msg, 170, &m->StandInstDbName);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_StandInstDbID)) {
+	ofix_typed_set_view(err, msg, 171, &m->StandInstDbID);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlDeliveryType)) {
+	ofix_typed_set_int(err, msg, 172, m->SettlDeliveryType);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlDepositoryCode)) {
+	ofix_typed_set_view(err, msg, 173, &m->SettlDepositoryCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlBrkrCode)) {
+	ofix_typed_set_view(err, msg, 174, &m->SettlBrkrCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SettlInstCode)) {
+	ofix_typed_set_view(err, msg, 175, &m->SettlInstCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecuritySettlAgentName)) {
+	ofix_typed_set_view(err, msg, 176, &m->SecuritySettlAgentName);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecuritySettlAgentCode)) {
+	ofix_typed_set_view(err, msg, 177, &m->SecuritySettlAgentCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecuritySettlAgentAcctNum)) {
+	ofix_typed_set_view(err, msg, 178, &m->SecuritySettlAgentAcctNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecuritySettlAgentAcctName)) {
+	ofix_typed_set_view(err, msg, 179, &m->SecuritySettlAgentAcctName);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecuritySettlAgentContactName)) {
+	ofix_typed_set_view(err, msg, 180, &m->SecuritySettlAgentContactName);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SecuritySettlAgentContactPhone)) {
+	ofix_typed_set_view(err, msg, 181, &m->SecuritySettlAgentContactPhone);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_CashSettlAgentName)) {
+	ofix_typed_set_view(err, msg, 182, &m->CashSettlAgentName);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_CashSettlAgentCode)) {
+	ofix_typed_set_view(err, msg, 183, &m->CashSettlAgentCode);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_CashSettlAgentAcctNum)) {
+	ofix_typed_set_view(err, msg, 184, &m->CashSettlAgentAcctNum);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_CashSettlAgentAcctName)) {
+	ofix_typed_set_view(err, msg, 185, &m->CashSettlAgentAcctName);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_CashSettlAgentContactName)) {
+	ofix_typed_set_view(err, msg, 186, &m->CashSettlAgentContactName);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_CashSettlAgentContactPhone)) {
+	ofix_typed_set_view(err, msg, 187, &m->CashSettlAgentContactPhone);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX41_SettlementInstructions_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
@@ -0,0 +1,17723 @@
+
+// This file is auto-generated from ref/FIX42.xml and should not be modified.
+
+#include <string.h>
+
+#include "fix42msgs.h"
+
+// Heartbeat [0]
+
+void
+fix42_decode_Heartbeat(ofixErr err, fix42Heartbeat m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Heartbeat));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_OnBehalfOfSendingTime);
+	    break;
+	case 112: // TestReqID
+	    ofix_typed_view(&scan, &m->TestReqID);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_TestReqID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Heartbeat_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Heartbeat_msg(ofixErr err, fix42Heartbeat m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Heartbeat(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Heartbeat(ofixErr err, fix42Heartbeat m) {
+    ofixMsg	msg = ofix_msg_create(err, "0", 4, 2, 31);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_TestReqID)) {
+	ofix_typed_set_view(err, msg, 112, &m->TestReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Heartbeat_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// TestRequest [1]
+
+void
+fix42_decode_TestRequest(ofixErr err, fix42TestRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42TestRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_OnBehalfOfSendingTime);
+	    break;
+	case 112: // TestReqID
+	    ofix_typed_view(&scan, &m->TestReqID);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_TestReqID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_TestRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_TestRequest_msg(ofixErr err, fix42TestRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_TestRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_TestRequest(ofixErr err, fix42TestRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "1", 4, 2, 31);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_TestRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_TestReqID)) {
+	ofix_typed_set_view(err, msg, 112, &m->TestReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_TestRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ResendRequest [2]
+
+void
+fix42_decode_ResendRequest(ofixErr err, fix42ResendRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42ResendRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_OnBehalfOfSendingTime);
+	    break;
+	case 7: // BeginSeqNo
+	    m->BeginSeqNo = ofix_typed_int(err, &scan, 7);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_BeginSeqNo);
+	    break;
+	case 16: // EndSeqNo
+	    m->EndSeqNo = ofix_typed_int(err, &scan, 16);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_EndSeqNo);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_ResendRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_ResendRequest_msg(ofixErr err, fix42ResendRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_ResendRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_ResendRequest(ofixErr err, fix42ResendRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "2", 4, 2, 32);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_BeginSeqNo)) {
+	ofix_typed_set_int(err, msg, 7, m->BeginSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_EndSeqNo)) {
+	ofix_typed_set_int(err, msg, 16, m->EndSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_ResendRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Reject [3]
+
+void
+fix42_decode_Reject(ofixErr err, fix42Reject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Reject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Reject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Reject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Reject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Reject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Reject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Reject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Reject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Reject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Reject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Reject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Reject_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Reject_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Reject_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Reject_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Reject_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Reject_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Reject_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Reject_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Reject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Reject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Reject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Reject_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Reject_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Reject_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Reject_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Reject_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Reject_OnBehalfOfSendingTime);
+	    break;
+	case 45: // RefSeqNum
+	    m->RefSeqNum = ofix_typed_int(err, &scan, 45);
+	    ofix_typed_mark(m->present, FIX42_Reject_RefSeqNum);
+	    break;
+	case 371: // RefTagID
+	    m->RefTagID = ofix_typed_int(err, &scan, 371);
+	    ofix_typed_mark(m->present, FIX42_Reject_RefTagID);
+	    break;
+	case 372: // RefMsgType
+	    ofix_typed_view(&scan, &m->RefMsgType);
+	    ofix_typed_mark(m->present, FIX42_Reject_RefMsgType);
+	    break;
+	case 373: // SessionRejectReason
+	    m->SessionRejectReason = ofix_typed_int(err, &scan, 373);
+	    ofix_typed_mark(m->present, FIX42_Reject_SessionRejectReason);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_Reject_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_Reject_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_Reject_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Reject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Reject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Reject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Reject_msg(ofixErr err, fix42Reject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Reject(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Reject(ofixErr err, fix42Reject m) {
+    ofixMsg	msg = ofix_msg_create(err, "3", 4, 2, 37);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Reject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_RefSeqNum)) {
+	ofix_typed_set_int(err, msg, 45, m->RefSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_RefTagID)) {
+	ofix_typed_set_int(err, msg, 371, m->RefTagID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_RefMsgType)) {
+	ofix_typed_set_view(err, msg, 372, &m->RefMsgType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_SessionRejectReason)) {
+	ofix_typed_set_int(err, msg, 373, m->SessionRejectReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Reject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SequenceReset [4]
+
+void
+fix42_decode_SequenceReset(ofixErr err, fix42SequenceReset m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42SequenceReset));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_OnBehalfOfSendingTime);
+	    break;
+	case 123: // GapFillFlag
+	    m->GapFillFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_GapFillFlag);
+	    break;
+	case 36: // NewSeqNo
+	    m->NewSeqNo = ofix_typed_int(err, &scan, 36);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_NewSeqNo);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_SequenceReset_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_SequenceReset_msg(ofixErr err, fix42SequenceReset m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_SequenceReset(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_SequenceReset(ofixErr err, fix42SequenceReset m) {
+    ofixMsg	msg = ofix_msg_create(err, "4", 4, 2, 32);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_GapFillFlag)) {
+	ofix_typed_set_char(err, msg, 123, m->GapFillFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_NewSeqNo)) {
+	ofix_typed_set_int(err, msg, 36, m->NewSeqNo);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_SequenceReset_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Logout [5]
+
+void
+fix42_decode_Logout(ofixErr err, fix42Logout m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Logout));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Logout_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Logout_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Logout_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Logout_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Logout_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Logout_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Logout_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Logout_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Logout_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Logout_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Logout_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logout_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Logout_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logout_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Logout_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logout_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Logout_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logout_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Logout_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Logout_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Logout_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Logout_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Logout_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Logout_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Logout_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Logout_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Logout_OnBehalfOfSendingTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_Logout_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_Logout_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_Logout_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Logout_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Logout_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Logout_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Logout_msg(ofixErr err, fix42Logout m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Logout(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Logout(ofixErr err, fix42Logout m) {
+    ofixMsg	msg = ofix_msg_create(err, "5", 4, 2, 33);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Logout_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logout_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// IndicationofInterest [6]
+
+static const int	IndicationofInterestGroup199[] = { 104, 0 };
+static const int	IndicationofInterestGroup215[] = { 216, 217, 0 };
+
+static const struct _ofixTypedGroup	IndicationofInterestGroups[] = {
+    { 199, -1, IndicationofInterestGroup199 }, // NoIOIQualifiers
+    { 215, -1, IndicationofInterestGroup215 }, // NoRoutingIDs
+};
+
+void
+fix42_decode_IndicationofInterest(ofixErr err, fix42IndicationofInterest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42IndicationofInterest));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, IndicationofInterestGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_OnBehalfOfSendingTime);
+	    break;
+	case 23: // IOIid
+	    ofix_typed_view(&scan, &m->IOIid);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_IOIid);
+	    break;
+	case 28: // IOITransType
+	    m->IOITransType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_IOITransType);
+	    break;
+	case 26: // IOIRefID
+	    ofix_typed_view(&scan, &m->IOIRefID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_IOIRefID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_EncodedSecurityDesc);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Side);
+	    break;
+	case 27: // IOIShares
+	    ofix_typed_view(&scan, &m->IOIShares);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_IOIShares);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Price);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Currency);
+	    break;
+	case 62: // ValidUntilTime
+	    ofix_typed_date(err, &scan, 62, OFIX_TIMESTAMP, &m->ValidUntilTime);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_ValidUntilTime);
+	    break;
+	case 25: // IOIQltyInd
+	    m->IOIQltyInd = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_IOIQltyInd);
+	    break;
+	case 130: // IOINaturalFlag
+	    m->IOINaturalFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_IOINaturalFlag);
+	    break;
+	case 199: // NoIOIQualifiers
+	    m->NoIOIQualifiers = ofix_typed_int(err, &scan, 199);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_NoIOIQualifiers);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_EncodedText);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_TransactTime);
+	    break;
+	case 149: // URLLink
+	    ofix_typed_view(&scan, &m->URLLink);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_URLLink);
+	    break;
+	case 215: // NoRoutingIDs
+	    m->NoRoutingIDs = ofix_typed_int(err, &scan, 215);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_NoRoutingIDs);
+	    break;
+	case 218: // SpreadToBenchmark
+	    ofix_typed_decimal(err, &scan, 218, &m->SpreadToBenchmark);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SpreadToBenchmark);
+	    break;
+	case 219: // Benchmark
+	    m->Benchmark = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Benchmark);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_IndicationofInterest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_IndicationofInterest_msg(ofixErr err, fix42IndicationofInterest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_IndicationofInterest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_IndicationofInterest(ofixErr err, fix42IndicationofInterest m) {
+    ofixMsg	msg = ofix_msg_create(err, "6", 4, 2, 68);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_IOIid)) {
+	ofix_typed_set_view(err, msg, 23, &m->IOIid);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_IOITransType)) {
+	ofix_typed_set_char(err, msg, 28, m->IOITransType);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_IOIRefID)) {
+	ofix_typed_set_view(err, msg, 26, &m->IOIRefID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_IOIShares)) {
+	ofix_typed_set_view(err, msg, 27, &m->IOIShares);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_ValidUntilTime)) {
+	ofix_msg_set_date(err, msg, 62, &m->ValidUntilTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_IOIQltyInd)) {
+	ofix_typed_set_char(err, msg, 25, m->IOIQltyInd);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_IOINaturalFlag)) {
+	ofix_typed_set_char(err, msg, 130, m->IOINaturalFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_NoIOIQualifiers)) {
+	ofix_typed_set_int(err, msg, 199, m->NoIOIQualifiers);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_URLLink)) {
+	ofix_typed_set_view(err, msg, 149, &m->URLLink);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_NoRoutingIDs)) {
+	ofix_typed_set_int(err, msg, 215, m->NoRoutingIDs);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SpreadToBenchmark)) {
+	ofix_typed_set_decimal(err, msg, 218, &m->SpreadToBenchmark);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Benchmark)) {
+	ofix_typed_set_char(err, msg, 219, m->Benchmark);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_IndicationofInterest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Advertisement [7]
+
+void
+fix42_decode_Advertisement(ofixErr err, fix42Advertisement m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Advertisement));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_OnBehalfOfSendingTime);
+	    break;
+	case 2: // AdvId
+	    ofix_typed_view(&scan, &m->AdvId);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_AdvId);
+	    break;
+	case 5: // AdvTransType
+	    ofix_typed_view(&scan, &m->AdvTransType);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_AdvTransType);
+	    break;
+	case 3: // AdvRefID
+	    ofix_typed_view(&scan, &m->AdvRefID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_AdvRefID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_EncodedSecurityDesc);
+	    break;
+	case 4: // AdvSide
+	    m->AdvSide = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_AdvSide);
+	    break;
+	case 53: // Shares
+	    ofix_typed_decimal(err, &scan, 53, &m->Shares);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_Shares);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_Price);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_Currency);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_view(&scan, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_TransactTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_EncodedText);
+	    break;
+	case 149: // URLLink
+	    ofix_typed_view(&scan, &m->URLLink);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_URLLink);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_LastMkt);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_TradingSessionID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Advertisement_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Advertisement_msg(ofixErr err, fix42Advertisement m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Advertisement(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Advertisement(ofixErr err, fix42Advertisement m) {
+    ofixMsg	msg = ofix_msg_create(err, "7", 4, 2, 64);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_AdvId)) {
+	ofix_typed_set_view(err, msg, 2, &m->AdvId);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_AdvTransType)) {
+	ofix_typed_set_view(err, msg, 5, &m->AdvTransType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_AdvRefID)) {
+	ofix_typed_set_view(err, msg, 3, &m->AdvRefID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_AdvSide)) {
+	ofix_typed_set_char(err, msg, 4, m->AdvSide);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_Shares)) {
+	ofix_typed_set_decimal(err, msg, 53, &m->Shares);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_TradeDate)) {
+	ofix_typed_set_view(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_URLLink)) {
+	ofix_typed_set_view(err, msg, 149, &m->URLLink);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Advertisement_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ExecutionReport [8]
+
+static const int	ExecutionReportGroup382[] = { 375, 337, 437, 438, 0 };
+
+static const struct _ofixTypedGroup	ExecutionReportGroups[] = {
+    { 382, -1, ExecutionReportGroup382 }, // NoContraBrokers
+};
+
+void
+fix42_decode_ExecutionReport(ofixErr err, fix42ExecutionReport m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42ExecutionReport));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, ExecutionReportGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OnBehalfOfSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrderID);
+	    break;
+	case 198: // SecondaryOrderID
+	    ofix_typed_view(&scan, &m->SecondaryOrderID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SecondaryOrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ClOrdID);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrigClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExecBroker);
+	    break;
+	case 382: // NoContraBrokers
+	    m->NoContraBrokers = ofix_typed_int(err, &scan, 382);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_NoContraBrokers);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ListID);
+	    break;
+	case 17: // ExecID
+	    ofix_typed_view(&scan, &m->ExecID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExecID);
+	    break;
+	case 20: // ExecTransType
+	    m->ExecTransType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExecTransType);
+	    break;
+	case 19: // ExecRefID
+	    ofix_typed_view(&scan, &m->ExecRefID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExecRefID);
+	    break;
+	case 150: // ExecType
+	    m->ExecType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExecType);
+	    break;
+	case 39: // OrdStatus
+	    m->OrdStatus = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrdStatus);
+	    break;
+	case 103: // OrdRejReason
+	    m->OrdRejReason = ofix_typed_int(err, &scan, 103);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrdRejReason);
+	    break;
+	case 378: // ExecRestatementReason
+	    m->ExecRestatementReason = ofix_typed_int(err, &scan, 378);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExecRestatementReason);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Account);
+	    break;
+	case 63: // SettlmntTyp
+	    m->SettlmntTyp = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_view(&scan, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_FutSettDate);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_EncodedSecurityDesc);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Side);
+	    break;
+	case 38: // OrderQty
+	    ofix_typed_decimal(err, &scan, 38, &m->OrderQty);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_CashOrderQty);
+	    break;
+	case 40: // OrdType
+	    m->OrdType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_StopPx);
+	    break;
+	case 211: // PegDifference
+	    ofix_typed_decimal(err, &scan, 211, &m->PegDifference);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_PegDifference);
+	    break;
+	case 388: // DiscretionInst
+	    m->DiscretionInst = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DiscretionInst);
+	    break;
+	case 389: // DiscretionOffset
+	    ofix_typed_decimal(err, &scan, 389, &m->DiscretionOffset);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DiscretionOffset);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Currency);
+	    break;
+	case 376: // ComplianceID
+	    ofix_typed_view(&scan, &m->ComplianceID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ComplianceID);
+	    break;
+	case 377: // SolicitedFlag
+	    m->SolicitedFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SolicitedFlag);
+	    break;
+	case 59: // TimeInForce
+	    m->TimeInForce = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_TimeInForce);
+	    break;
+	case 168: // EffectiveTime
+	    ofix_typed_date(err, &scan, 168, OFIX_TIMESTAMP, &m->EffectiveTime);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_EffectiveTime);
+	    break;
+	case 432: // ExpireDate
+	    ofix_typed_view(&scan, &m->ExpireDate);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExpireDate);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIMESTAMP, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExpireTime);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ExecInst);
+	    break;
+	case 47: // Rule80A
+	    m->Rule80A = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Rule80A);
+	    break;
+	case 32: // LastShares
+	    ofix_typed_decimal(err, &scan, 32, &m->LastShares);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LastShares);
+	    break;
+	case 31: // LastPx
+	    ofix_typed_decimal(err, &scan, 31, &m->LastPx);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LastPx);
+	    break;
+	case 194: // LastSpotRate
+	    ofix_typed_decimal(err, &scan, 194, &m->LastSpotRate);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LastSpotRate);
+	    break;
+	case 195: // LastForwardPoints
+	    ofix_typed_decimal(err, &scan, 195, &m->LastForwardPoints);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LastForwardPoints);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LastMkt);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_TradingSessionID);
+	    break;
+	case 29: // LastCapacity
+	    m->LastCapacity = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LastCapacity);
+	    break;
+	case 151: // LeavesQty
+	    ofix_typed_decimal(err, &scan, 151, &m->LeavesQty);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_LeavesQty);
+	    break;
+	case 14: // CumQty
+	    ofix_typed_decimal(err, &scan, 14, &m->CumQty);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_CumQty);
+	    break;
+	case 6: // AvgPx
+	    ofix_typed_decimal(err, &scan, 6, &m->AvgPx);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_AvgPx);
+	    break;
+	case 424: // DayOrderQty
+	    ofix_typed_decimal(err, &scan, 424, &m->DayOrderQty);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DayOrderQty);
+	    break;
+	case 425: // DayCumQty
+	    ofix_typed_decimal(err, &scan, 425, &m->DayCumQty);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DayCumQty);
+	    break;
+	case 426: // DayAvgPx
+	    ofix_typed_decimal(err, &scan, 426, &m->DayAvgPx);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_DayAvgPx);
+	    break;
+	case 427: // GTBookingInst
+	    m->GTBookingInst = ofix_typed_int(err, &scan, 427);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_GTBookingInst);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_view(&scan, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_TransactTime);
+	    break;
+	case 113: // ReportToExch
+	    m->ReportToExch = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ReportToExch);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Commission);
+	    break;
+	case 13: // CommType
+	    m->CommType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_CommType);
+	    break;
+	case 381: // GrossTradeAmt
+	    ofix_typed_decimal(err, &scan, 381, &m->GrossTradeAmt);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_GrossTradeAmt);
+	    break;
+	case 119: // SettlCurrAmt
+	    ofix_typed_decimal(err, &scan, 119, &m->SettlCurrAmt);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SettlCurrAmt);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SettlCurrency);
+	    break;
+	case 155: // SettlCurrFxRate
+	    ofix_typed_decimal(err, &scan, 155, &m->SettlCurrFxRate);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SettlCurrFxRate);
+	    break;
+	case 156: // SettlCurrFxRateCalc
+	    m->SettlCurrFxRateCalc = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SettlCurrFxRateCalc);
+	    break;
+	case 21: // HandlInst
+	    m->HandlInst = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_HandlInst);
+	    break;
+	case 110: // MinQty
+	    ofix_typed_decimal(err, &scan, 110, &m->MinQty);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    ofix_typed_decimal(err, &scan, 111, &m->MaxFloor);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MaxFloor);
+	    break;
+	case 77: // OpenClose
+	    m->OpenClose = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OpenClose);
+	    break;
+	case 210: // MaxShow
+	    ofix_typed_decimal(err, &scan, 210, &m->MaxShow);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MaxShow);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_EncodedText);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_view(&scan, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_OrderQty2);
+	    break;
+	case 439: // ClearingFirm
+	    ofix_typed_view(&scan, &m->ClearingFirm);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ClearingFirm);
+	    break;
+	case 440: // ClearingAccount
+	    ofix_typed_view(&scan, &m->ClearingAccount);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_ClearingAccount);
+	    break;
+	case 442: // MultiLegReportingType
+	    m->MultiLegReportingType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_MultiLegReportingType);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_ExecutionReport_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_ExecutionReport_msg(ofixErr err, fix42ExecutionReport m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_ExecutionReport(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_ExecutionReport(ofixErr err, fix42ExecutionReport m) {
+    ofixMsg	msg = ofix_msg_create(err, "8", 4, 2, 122);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SecondaryOrderID)) {
+	ofix_typed_set_view(err, msg, 198, &m->SecondaryOrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_NoContraBrokers)) {
+	ofix_typed_set_int(err, msg, 382, m->NoContraBrokers);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExecID)) {
+	ofix_typed_set_view(err, msg, 17, &m->ExecID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExecTransType)) {
+	ofix_typed_set_char(err, msg, 20, m->ExecTransType);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExecRefID)) {
+	ofix_typed_set_view(err, msg, 19, &m->ExecRefID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExecType)) {
+	ofix_typed_set_char(err, msg, 150, m->ExecType);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrdStatus)) {
+	ofix_typed_set_char(err, msg, 39, m->OrdStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrdRejReason)) {
+	ofix_typed_set_int(err, msg, 103, m->OrdRejReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExecRestatementReason)) {
+	ofix_typed_set_int(err, msg, 378, m->ExecRestatementReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SettlmntTyp)) {
+	ofix_typed_set_char(err, msg, 63, m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_FutSettDate)) {
+	ofix_typed_set_view(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrderQty)) {
+	ofix_typed_set_decimal(err, msg, 38, &m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrdType)) {
+	ofix_typed_set_char(err, msg, 40, m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_PegDifference)) {
+	ofix_typed_set_decimal(err, msg, 211, &m->PegDifference);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DiscretionInst)) {
+	ofix_typed_set_char(err, msg, 388, m->DiscretionInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DiscretionOffset)) {
+	ofix_typed_set_decimal(err, msg, 389, &m->DiscretionOffset);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ComplianceID)) {
+	ofix_typed_set_view(err, msg, 376, &m->ComplianceID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SolicitedFlag)) {
+	ofix_typed_set_char(err, msg, 377, m->SolicitedFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_TimeInForce)) {
+	ofix_typed_set_char(err, msg, 59, m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_EffectiveTime)) {
+	ofix_msg_set_date(err, msg, 168, &m->EffectiveTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExpireDate)) {
+	ofix_typed_set_view(err, msg, 432, &m->ExpireDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Rule80A)) {
+	ofix_typed_set_char(err, msg, 47, m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LastShares)) {
+	ofix_typed_set_decimal(err, msg, 32, &m->LastShares);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LastPx)) {
+	ofix_typed_set_decimal(err, msg, 31, &m->LastPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LastSpotRate)) {
+	ofix_typed_set_decimal(err, msg, 194, &m->LastSpotRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LastForwardPoints)) {
+	ofix_typed_set_decimal(err, msg, 195, &m->LastForwardPoints);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LastCapacity)) {
+	ofix_typed_set_char(err, msg, 29, m->LastCapacity);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_LeavesQty)) {
+	ofix_typed_set_decimal(err, msg, 151, &m->LeavesQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_CumQty)) {
+	ofix_typed_set_decimal(err, msg, 14, &m->CumQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_AvgPx)) {
+	ofix_typed_set_decimal(err, msg, 6, &m->AvgPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DayOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 424, &m->DayOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DayCumQty)) {
+	ofix_typed_set_decimal(err, msg, 425, &m->DayCumQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_DayAvgPx)) {
+	ofix_typed_set_decimal(err, msg, 426, &m->DayAvgPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_GTBookingInst)) {
+	ofix_typed_set_int(err, msg, 427, m->GTBookingInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_TradeDate)) {
+	ofix_typed_set_view(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ReportToExch)) {
+	ofix_typed_set_char(err, msg, 113, m->ReportToExch);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_CommType)) {
+	ofix_typed_set_char(err, msg, 13, m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_GrossTradeAmt)) {
+	ofix_typed_set_decimal(err, msg, 381, &m->GrossTradeAmt);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SettlCurrAmt)) {
+	ofix_typed_set_decimal(err, msg, 119, &m->SettlCurrAmt);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SettlCurrFxRate)) {
+	ofix_typed_set_decimal(err, msg, 155, &m->SettlCurrFxRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SettlCurrFxRateCalc)) {
+	ofix_typed_set_char(err, msg, 156, m->SettlCurrFxRateCalc);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_HandlInst)) {
+	ofix_typed_set_char(err, msg, 21, m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MinQty)) {
+	ofix_typed_set_decimal(err, msg, 110, &m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MaxFloor)) {
+	ofix_typed_set_decimal(err, msg, 111, &m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OpenClose)) {
+	ofix_typed_set_char(err, msg, 77, m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MaxShow)) {
+	ofix_typed_set_decimal(err, msg, 210, &m->MaxShow);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_FutSettDate2)) {
+	ofix_typed_set_view(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ClearingFirm)) {
+	ofix_typed_set_view(err, msg, 439, &m->ClearingFirm);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_ClearingAccount)) {
+	ofix_typed_set_view(err, msg, 440, &m->ClearingAccount);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_MultiLegReportingType)) {
+	ofix_typed_set_char(err, msg, 442, m->MultiLegReportingType);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_ExecutionReport_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelReject [9]
+
+void
+fix42_decode_OrderCancelReject(ofixErr err, fix42OrderCancelReject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42OrderCancelReject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OnBehalfOfSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OrderID);
+	    break;
+	case 198: // SecondaryOrderID
+	    ofix_typed_view(&scan, &m->SecondaryOrderID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SecondaryOrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_ClOrdID);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OrigClOrdID);
+	    break;
+	case 39: // OrdStatus
+	    m->OrdStatus = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_OrdStatus);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_ExecBroker);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_ListID);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_Account);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_TransactTime);
+	    break;
+	case 434: // CxlRejResponseTo
+	    m->CxlRejResponseTo = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_CxlRejResponseTo);
+	    break;
+	case 102: // CxlRejReason
+	    m->CxlRejReason = ofix_typed_int(err, &scan, 102);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_CxlRejReason);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_OrderCancelReject_msg(ofixErr err, fix42OrderCancelReject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_OrderCancelReject(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_OrderCancelReject(ofixErr err, fix42OrderCancelReject m) {
+    ofixMsg	msg = ofix_msg_create(err, "9", 4, 2, 45);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SecondaryOrderID)) {
+	ofix_typed_set_view(err, msg, 198, &m->SecondaryOrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_OrdStatus)) {
+	ofix_typed_set_char(err, msg, 39, m->OrdStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_CxlRejResponseTo)) {
+	ofix_typed_set_char(err, msg, 434, m->CxlRejResponseTo);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_CxlRejReason)) {
+	ofix_typed_set_int(err, msg, 102, m->CxlRejReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Logon [A]
+
+static const int	LogonGroup384[] = { 372, 385, 0 };
+
+static const struct _ofixTypedGroup	LogonGroups[] = {
+    { 384, -1, LogonGroup384 }, // NoMsgTypes
+};
+
+void
+fix42_decode_Logon(ofixErr err, fix42Logon m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Logon));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, LogonGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Logon_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Logon_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Logon_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Logon_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Logon_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Logon_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Logon_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Logon_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Logon_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Logon_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Logon_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logon_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Logon_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logon_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Logon_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logon_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Logon_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Logon_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Logon_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Logon_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Logon_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Logon_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Logon_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Logon_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Logon_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Logon_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Logon_OnBehalfOfSendingTime);
+	    break;
+	case 98: // EncryptMethod
+	    m->EncryptMethod = ofix_typed_int(err, &scan, 98);
+	    ofix_typed_mark(m->present, FIX42_Logon_EncryptMethod);
+	    break;
+	case 108: // HeartBtInt
+	    m->HeartBtInt = ofix_typed_int(err, &scan, 108);
+	    ofix_typed_mark(m->present, FIX42_Logon_HeartBtInt);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX42_Logon_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX42_Logon_RawData);
+	    break;
+	case 141: // ResetSeqNumFlag
+	    m->ResetSeqNumFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Logon_ResetSeqNumFlag);
+	    break;
+	case 383: // MaxMessageSize
+	    m->MaxMessageSize = ofix_typed_int(err, &scan, 383);
+	    ofix_typed_mark(m->present, FIX42_Logon_MaxMessageSize);
+	    break;
+	case 384: // NoMsgTypes
+	    m->NoMsgTypes = ofix_typed_int(err, &scan, 384);
+	    ofix_typed_mark(m->present, FIX42_Logon_NoMsgTypes);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Logon_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Logon_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Logon_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Logon_msg(ofixErr err, fix42Logon m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Logon(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Logon(ofixErr err, fix42Logon m) {
+    ofixMsg	msg = ofix_msg_create(err, "A", 4, 2, 37);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Logon_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_EncryptMethod)) {
+	ofix_typed_set_int(err, msg, 98, m->EncryptMethod);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_HeartBtInt)) {
+	ofix_typed_set_int(err, msg, 108, m->HeartBtInt);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_ResetSeqNumFlag)) {
+	ofix_typed_set_char(err, msg, 141, m->ResetSeqNumFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_MaxMessageSize)) {
+	ofix_typed_set_int(err, msg, 383, m->MaxMessageSize);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_NoMsgTypes)) {
+	ofix_typed_set_int(err, msg, 384, m->NoMsgTypes);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Logon_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// News [B]
+
+static const int	NewsGroup215[] = { 216, 217, 0 };
+static const int	NewsGroup146[] = { 46, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 0 };
+static const int	NewsGroup33[] = { 58, 354, 355, 0 };
+
+static const struct _ofixTypedGroup	NewsGroups[] = {
+    { 215, -1, NewsGroup215 }, // NoRoutingIDs
+    { 146, -1, NewsGroup146 }, // NoRelatedSym
+    { 33, -1, NewsGroup33 }, // LinesOfText
+};
+
+void
+fix42_decode_News(ofixErr err, fix42News m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42News));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, NewsGroups, 3);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_News_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_News_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_News_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_News_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_News_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_News_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_News_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_News_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_News_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_News_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_News_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_News_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_News_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_News_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_News_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_News_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_News_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_News_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_News_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_News_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_News_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_News_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_News_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_News_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_News_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_News_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_News_OnBehalfOfSendingTime);
+	    break;
+	case 42: // OrigTime
+	    ofix_typed_date(err, &scan, 42, OFIX_TIMESTAMP, &m->OrigTime);
+	    ofix_typed_mark(m->present, FIX42_News_OrigTime);
+	    break;
+	case 61: // Urgency
+	    m->Urgency = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_News_Urgency);
+	    break;
+	case 148: // Headline
+	    ofix_typed_view(&scan, &m->Headline);
+	    ofix_typed_mark(m->present, FIX42_News_Headline);
+	    break;
+	case 358: // EncodedHeadlineLen
+	    m->EncodedHeadlineLen = ofix_typed_int(err, &scan, 358);
+	    ofix_typed_mark(m->present, FIX42_News_EncodedHeadlineLen);
+	    break;
+	case 359: // EncodedHeadline
+	    ofix_typed_view(&scan, &m->EncodedHeadline);
+	    ofix_typed_mark(m->present, FIX42_News_EncodedHeadline);
+	    break;
+	case 215: // NoRoutingIDs
+	    m->NoRoutingIDs = ofix_typed_int(err, &scan, 215);
+	    ofix_typed_mark(m->present, FIX42_News_NoRoutingIDs);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX42_News_NoRelatedSym);
+	    break;
+	case 33: // LinesOfText
+	    m->LinesOfText = ofix_typed_int(err, &scan, 33);
+	    ofix_typed_mark(m->present, FIX42_News_LinesOfText);
+	    break;
+	case 149: // URLLink
+	    ofix_typed_view(&scan, &m->URLLink);
+	    ofix_typed_mark(m->present, FIX42_News_URLLink);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX42_News_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX42_News_RawData);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_News_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_News_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_News_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_News_msg(ofixErr err, fix42News m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_News(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_News(ofixErr err, fix42News m) {
+    ofixMsg	msg = ofix_msg_create(err, "B", 4, 2, 41);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_News_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_OrigTime)) {
+	ofix_msg_set_date(err, msg, 42, &m->OrigTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_Urgency)) {
+	ofix_typed_set_char(err, msg, 61, m->Urgency);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_Headline)) {
+	ofix_typed_set_view(err, msg, 148, &m->Headline);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_EncodedHeadlineLen)) {
+	ofix_typed_set_int(err, msg, 358, m->EncodedHeadlineLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_EncodedHeadline)) {
+	ofix_typed_set_view(err, msg, 359, &m->EncodedHeadline);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_NoRoutingIDs)) {
+	ofix_typed_set_int(err, msg, 215, m->NoRoutingIDs);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_LinesOfText)) {
+	ofix_typed_set_int(err, msg, 33, m->LinesOfText);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_URLLink)) {
+	ofix_typed_set_view(err, msg, 149, &m->URLLink);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_News_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Email [C]
+
+static const int	EmailGroup215[] = { 216, 217, 0 };
+static const int	EmailGroup146[] = { 46, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 0 };
+static const int	EmailGroup33[] = { 58, 354, 355, 0 };
+
+static const struct _ofixTypedGroup	EmailGroups[] = {
+    { 215, -1, EmailGroup215 }, // NoRoutingIDs
+    { 146, -1, EmailGroup146 }, // NoRelatedSym
+    { 33, -1, EmailGroup33 }, // LinesOfText
+};
+
+void
+fix42_decode_Email(ofixErr err, fix42Email m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Email));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, EmailGroups, 3);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Email_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Email_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Email_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Email_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Email_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Email_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Email_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Email_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Email_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Email_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Email_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Email_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Email_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Email_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Email_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Email_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Email_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Email_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Email_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Email_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Email_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Email_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Email_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Email_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Email_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Email_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Email_OnBehalfOfSendingTime);
+	    break;
+	case 164: // EmailThreadID
+	    ofix_typed_view(&scan, &m->EmailThreadID);
+	    ofix_typed_mark(m->present, FIX42_Email_EmailThreadID);
+	    break;
+	case 94: // EmailType
+	    m->EmailType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Email_EmailType);
+	    break;
+	case 42: // OrigTime
+	    ofix_typed_date(err, &scan, 42, OFIX_TIMESTAMP, &m->OrigTime);
+	    ofix_typed_mark(m->present, FIX42_Email_OrigTime);
+	    break;
+	case 147: // Subject
+	    ofix_typed_view(&scan, &m->Subject);
+	    ofix_typed_mark(m->present, FIX42_Email_Subject);
+	    break;
+	case 356: // EncodedSubjectLen
+	    m->EncodedSubjectLen = ofix_typed_int(err, &scan, 356);
+	    ofix_typed_mark(m->present, FIX42_Email_EncodedSubjectLen);
+	    break;
+	case 357: // EncodedSubject
+	    ofix_typed_view(&scan, &m->EncodedSubject);
+	    ofix_typed_mark(m->present, FIX42_Email_EncodedSubject);
+	    break;
+	case 215: // NoRoutingIDs
+	    m->NoRoutingIDs = ofix_typed_int(err, &scan, 215);
+	    ofix_typed_mark(m->present, FIX42_Email_NoRoutingIDs);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX42_Email_NoRelatedSym);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX42_Email_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX42_Email_ClOrdID);
+	    break;
+	case 33: // LinesOfText
+	    m->LinesOfText = ofix_typed_int(err, &scan, 33);
+	    ofix_typed_mark(m->present, FIX42_Email_LinesOfText);
+	    break;
+	case 95: // RawDataLength
+	    m->RawDataLength = ofix_typed_int(err, &scan, 95);
+	    ofix_typed_mark(m->present, FIX42_Email_RawDataLength);
+	    break;
+	case 96: // RawData
+	    ofix_typed_view(&scan, &m->RawData);
+	    ofix_typed_mark(m->present, FIX42_Email_RawData);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Email_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Email_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Email_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Email_msg(ofixErr err, fix42Email m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Email(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Email(ofixErr err, fix42Email m) {
+    ofixMsg	msg = ofix_msg_create(err, "C", 4, 2, 43);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Email_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_EmailThreadID)) {
+	ofix_typed_set_view(err, msg, 164, &m->EmailThreadID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_EmailType)) {
+	ofix_typed_set_char(err, msg, 94, m->EmailType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_OrigTime)) {
+	ofix_msg_set_date(err, msg, 42, &m->OrigTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_Subject)) {
+	ofix_typed_set_view(err, msg, 147, &m->Subject);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_EncodedSubjectLen)) {
+	ofix_typed_set_int(err, msg, 356, m->EncodedSubjectLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_EncodedSubject)) {
+	ofix_typed_set_view(err, msg, 357, &m->EncodedSubject);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_NoRoutingIDs)) {
+	ofix_typed_set_int(err, msg, 215, m->NoRoutingIDs);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_LinesOfText)) {
+	ofix_typed_set_int(err, msg, 33, m->LinesOfText);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_RawDataLength)) {
+	ofix_typed_set_int(err, msg, 95, m->RawDataLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_RawData)) {
+	ofix_typed_set_view(err, msg, 96, &m->RawData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Email_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// NewOrderSingle [D]
+
+static const int	NewOrderSingleGroup78[] = { 79, 80, 0 };
+static const int	NewOrderSingleGroup386[] = { 336, 0 };
+
+static const struct _ofixTypedGroup	NewOrderSingleGroups[] = {
+    { 78, -1, NewOrderSingleGroup78 }, // NoAllocs
+    { 386, -1, NewOrderSingleGroup386 }, // NoTradingSessions
+};
+
+void
+fix42_decode_NewOrderSingle(ofixErr err, fix42NewOrderSingle m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42NewOrderSingle));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, NewOrderSingleGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OnBehalfOfSendingTime);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ExecBroker);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Account);
+	    break;
+	case 78: // NoAllocs
+	    m->NoAllocs = ofix_typed_int(err, &scan, 78);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_NoAllocs);
+	    break;
+	case 63: // SettlmntTyp
+	    m->SettlmntTyp = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_view(&scan, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    m->HandlInst = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ExecInst);
+	    break;
+	case 110: // MinQty
+	    ofix_typed_decimal(err, &scan, 110, &m->MinQty);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    ofix_typed_decimal(err, &scan, 111, &m->MaxFloor);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ExDestination);
+	    break;
+	case 386: // NoTradingSessions
+	    m->NoTradingSessions = ofix_typed_int(err, &scan, 386);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_NoTradingSessions);
+	    break;
+	case 81: // ProcessCode
+	    m->ProcessCode = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ProcessCode);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_EncodedSecurityDesc);
+	    break;
+	case 140: // PrevClosePx
+	    ofix_typed_decimal(err, &scan, 140, &m->PrevClosePx);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_PrevClosePx);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Side);
+	    break;
+	case 114: // LocateReqd
+	    m->LocateReqd = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_LocateReqd);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_TransactTime);
+	    break;
+	case 38: // OrderQty
+	    ofix_typed_decimal(err, &scan, 38, &m->OrderQty);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_CashOrderQty);
+	    break;
+	case 40: // OrdType
+	    m->OrdType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_StopPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Currency);
+	    break;
+	case 376: // ComplianceID
+	    ofix_typed_view(&scan, &m->ComplianceID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ComplianceID);
+	    break;
+	case 377: // SolicitedFlag
+	    m->SolicitedFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SolicitedFlag);
+	    break;
+	case 23: // IOIid
+	    ofix_typed_view(&scan, &m->IOIid);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_IOIid);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_QuoteID);
+	    break;
+	case 59: // TimeInForce
+	    m->TimeInForce = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_TimeInForce);
+	    break;
+	case 168: // EffectiveTime
+	    ofix_typed_date(err, &scan, 168, OFIX_TIMESTAMP, &m->EffectiveTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_EffectiveTime);
+	    break;
+	case 432: // ExpireDate
+	    ofix_typed_view(&scan, &m->ExpireDate);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ExpireDate);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIMESTAMP, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ExpireTime);
+	    break;
+	case 427: // GTBookingInst
+	    m->GTBookingInst = ofix_typed_int(err, &scan, 427);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_GTBookingInst);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Commission);
+	    break;
+	case 13: // CommType
+	    m->CommType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_CommType);
+	    break;
+	case 47: // Rule80A
+	    m->Rule80A = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    m->ForexReq = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_EncodedText);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_view(&scan, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OrderQty2);
+	    break;
+	case 77: // OpenClose
+	    m->OpenClose = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_OpenClose);
+	    break;
+	case 203: // CoveredOrUncovered
+	    m->CoveredOrUncovered = ofix_typed_int(err, &scan, 203);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_CoveredOrUncovered);
+	    break;
+	case 204: // CustomerOrFirm
+	    m->CustomerOrFirm = ofix_typed_int(err, &scan, 204);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_CustomerOrFirm);
+	    break;
+	case 210: // MaxShow
+	    ofix_typed_decimal(err, &scan, 210, &m->MaxShow);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_MaxShow);
+	    break;
+	case 211: // PegDifference
+	    ofix_typed_decimal(err, &scan, 211, &m->PegDifference);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_PegDifference);
+	    break;
+	case 388: // DiscretionInst
+	    m->DiscretionInst = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_DiscretionInst);
+	    break;
+	case 389: // DiscretionOffset
+	    ofix_typed_decimal(err, &scan, 389, &m->DiscretionOffset);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_DiscretionOffset);
+	    break;
+	case 439: // ClearingFirm
+	    ofix_typed_view(&scan, &m->ClearingFirm);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ClearingFirm);
+	    break;
+	case 440: // ClearingAccount
+	    ofix_typed_view(&scan, &m->ClearingAccount);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_ClearingAccount);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_NewOrderSingle_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_NewOrderSingle_msg(ofixErr err, fix42NewOrderSingle m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_NewOrderSingle(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_NewOrderSingle(ofixErr err, fix42NewOrderSingle m) {
+    ofixMsg	msg = ofix_msg_create(err, "D", 4, 2, 101);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_NoAllocs)) {
+	ofix_typed_set_int(err, msg, 78, m->NoAllocs);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SettlmntTyp)) {
+	ofix_typed_set_char(err, msg, 63, m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_FutSettDate)) {
+	ofix_typed_set_view(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_HandlInst)) {
+	ofix_typed_set_char(err, msg, 21, m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_MinQty)) {
+	ofix_typed_set_decimal(err, msg, 110, &m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_MaxFloor)) {
+	ofix_typed_set_decimal(err, msg, 111, &m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_NoTradingSessions)) {
+	ofix_typed_set_int(err, msg, 386, m->NoTradingSessions);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ProcessCode)) {
+	ofix_typed_set_char(err, msg, 81, m->ProcessCode);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_PrevClosePx)) {
+	ofix_typed_set_decimal(err, msg, 140, &m->PrevClosePx);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_LocateReqd)) {
+	ofix_typed_set_char(err, msg, 114, m->LocateReqd);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OrderQty)) {
+	ofix_typed_set_decimal(err, msg, 38, &m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OrdType)) {
+	ofix_typed_set_char(err, msg, 40, m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ComplianceID)) {
+	ofix_typed_set_view(err, msg, 376, &m->ComplianceID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SolicitedFlag)) {
+	ofix_typed_set_char(err, msg, 377, m->SolicitedFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_IOIid)) {
+	ofix_typed_set_view(err, msg, 23, &m->IOIid);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_TimeInForce)) {
+	ofix_typed_set_char(err, msg, 59, m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_EffectiveTime)) {
+	ofix_msg_set_date(err, msg, 168, &m->EffectiveTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ExpireDate)) {
+	ofix_typed_set_view(err, msg, 432, &m->ExpireDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_GTBookingInst)) {
+	ofix_typed_set_int(err, msg, 427, m->GTBookingInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_CommType)) {
+	ofix_typed_set_char(err, msg, 13, m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Rule80A)) {
+	ofix_typed_set_char(err, msg, 47, m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ForexReq)) {
+	ofix_typed_set_char(err, msg, 121, m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_FutSettDate2)) {
+	ofix_typed_set_view(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_OpenClose)) {
+	ofix_typed_set_char(err, msg, 77, m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_CoveredOrUncovered)) {
+	ofix_typed_set_int(err, msg, 203, m->CoveredOrUncovered);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_CustomerOrFirm)) {
+	ofix_typed_set_int(err, msg, 204, m->CustomerOrFirm);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_MaxShow)) {
+	ofix_typed_set_decimal(err, msg, 210, &m->MaxShow);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_PegDifference)) {
+	ofix_typed_set_decimal(err, msg, 211, &m->PegDifference);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_DiscretionInst)) {
+	ofix_typed_set_char(err, msg, 388, m->DiscretionInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_DiscretionOffset)) {
+	ofix_typed_set_decimal(err, msg, 389, &m->DiscretionOffset);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ClearingFirm)) {
+	ofix_typed_set_view(err, msg, 439, &m->ClearingFirm);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_ClearingAccount)) {
+	ofix_typed_set_view(err, msg, 440, &m->ClearingAccount);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderSingle_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// NewOrderList [E]
+
+static const int	NewOrderListGroup73[] = { 11, 67, 160, 109, 76, 1, 78, 63, 64, 21, 18, 110, 111, 100, 386, 81, 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 140, 54, 401, 114, 60, 38, 152, 40, 44, 99, 15, 376, 377, 23, 117, 59, 168, 432, 126, 427, 12, 13, 47, 121, 120, 58, 354, 355, 193, 192, 77, 203, 204, 210, 211, 388, 389, 439, 440, 0 };
+static const int	NewOrderListGroup78[] = { 79, 80, 0 };
+static const int	NewOrderListGroup386[] = { 336, 0 };
+
+static const struct _ofixTypedGroup	NewOrderListGroups[] = {
+    { 73, -1, NewOrderListGroup73 }, // NoOrders
+    { 78, 0, NewOrderListGroup78 }, // NoAllocs
+    { 386, 0, NewOrderListGroup386 }, // NoTradingSessions
+};
+
+void
+fix42_decode_NewOrderList(ofixErr err, fix42NewOrderList m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42NewOrderList));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, NewOrderListGroups, 3);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_OnBehalfOfSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_ListID);
+	    break;
+	case 390: // BidID
+	    ofix_typed_view(&scan, &m->BidID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_BidID);
+	    break;
+	case 391: // ClientBidID
+	    ofix_typed_view(&scan, &m->ClientBidID);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_ClientBidID);
+	    break;
+	case 414: // ProgRptReqs
+	    m->ProgRptReqs = ofix_typed_int(err, &scan, 414);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_ProgRptReqs);
+	    break;
+	case 394: // BidType
+	    m->BidType = ofix_typed_int(err, &scan, 394);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_BidType);
+	    break;
+	case 415: // ProgPeriodInterval
+	    m->ProgPeriodInterval = ofix_typed_int(err, &scan, 415);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_ProgPeriodInterval);
+	    break;
+	case 433: // ListExecInstType
+	    m->ListExecInstType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_ListExecInstType);
+	    break;
+	case 69: // ListExecInst
+	    ofix_typed_view(&scan, &m->ListExecInst);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_ListExecInst);
+	    break;
+	case 352: // EncodedListExecInstLen
+	    m->EncodedListExecInstLen = ofix_typed_int(err, &scan, 352);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_EncodedListExecInstLen);
+	    break;
+	case 353: // EncodedListExecInst
+	    ofix_typed_view(&scan, &m->EncodedListExecInst);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_EncodedListExecInst);
+	    break;
+	case 68: // TotNoOrders
+	    m->TotNoOrders = ofix_typed_int(err, &scan, 68);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_TotNoOrders);
+	    break;
+	case 73: // NoOrders
+	    m->NoOrders = ofix_typed_int(err, &scan, 73);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_NoOrders);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_NewOrderList_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_NewOrderList_msg(ofixErr err, fix42NewOrderList m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_NewOrderList(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_NewOrderList(ofixErr err, fix42NewOrderList m) {
+    ofixMsg	msg = ofix_msg_create(err, "E", 4, 2, 42);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_BidID)) {
+	ofix_typed_set_view(err, msg, 390, &m->BidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_ClientBidID)) {
+	ofix_typed_set_view(err, msg, 391, &m->ClientBidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_ProgRptReqs)) {
+	ofix_typed_set_int(err, msg, 414, m->ProgRptReqs);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_BidType)) {
+	ofix_typed_set_int(err, msg, 394, m->BidType);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_ProgPeriodInterval)) {
+	ofix_typed_set_int(err, msg, 415, m->ProgPeriodInterval);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_ListExecInstType)) {
+	ofix_typed_set_char(err, msg, 433, m->ListExecInstType);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_ListExecInst)) {
+	ofix_typed_set_view(err, msg, 69, &m->ListExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_EncodedListExecInstLen)) {
+	ofix_typed_set_int(err, msg, 352, m->EncodedListExecInstLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_EncodedListExecInst)) {
+	ofix_typed_set_view(err, msg, 353, &m->EncodedListExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_TotNoOrders)) {
+	ofix_typed_set_int(err, msg, 68, m->TotNoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_NoOrders)) {
+	ofix_typed_set_int(err, msg, 73, m->NoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_NewOrderList_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelRequest [F]
+
+void
+fix42_decode_OrderCancelRequest(ofixErr err, fix42OrderCancelRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42OrderCancelRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OnBehalfOfSendingTime);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OrigClOrdID);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_ClOrdID);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_ListID);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_Account);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_ExecBroker);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_EncodedSecurityDesc);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_Side);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_TransactTime);
+	    break;
+	case 38: // OrderQty
+	    ofix_typed_decimal(err, &scan, 38, &m->OrderQty);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_CashOrderQty);
+	    break;
+	case 376: // ComplianceID
+	    ofix_typed_view(&scan, &m->ComplianceID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_ComplianceID);
+	    break;
+	case 377: // SolicitedFlag
+	    m->SolicitedFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SolicitedFlag);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_OrderCancelRequest_msg(ofixErr err, fix42OrderCancelRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_OrderCancelRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_OrderCancelRequest(ofixErr err, fix42OrderCancelRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "F", 4, 2, 65);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_OrderQty)) {
+	ofix_typed_set_decimal(err, msg, 38, &m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_ComplianceID)) {
+	ofix_typed_set_view(err, msg, 376, &m->ComplianceID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SolicitedFlag)) {
+	ofix_typed_set_char(err, msg, 377, m->SolicitedFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderCancelReplaceRequest [G]
+
+static const int	OrderCancelReplaceRequestGroup78[] = { 79, 80, 0 };
+static const int	OrderCancelReplaceRequestGroup386[] = { 336, 0 };
+
+static const struct _ofixTypedGroup	OrderCancelReplaceRequestGroups[] = {
+    { 78, -1, OrderCancelReplaceRequestGroup78 }, // NoAllocs
+    { 386, -1, OrderCancelReplaceRequestGroup386 }, // NoTradingSessions
+};
+
+void
+fix42_decode_OrderCancelReplaceRequest(ofixErr err, fix42OrderCancelReplaceRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42OrderCancelReplaceRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, OrderCancelReplaceRequestGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OrderID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ExecBroker);
+	    break;
+	case 41: // OrigClOrdID
+	    ofix_typed_view(&scan, &m->OrigClOrdID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OrigClOrdID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ClOrdID);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ListID);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Account);
+	    break;
+	case 78: // NoAllocs
+	    m->NoAllocs = ofix_typed_int(err, &scan, 78);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_NoAllocs);
+	    break;
+	case 63: // SettlmntTyp
+	    m->SettlmntTyp = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_view(&scan, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_FutSettDate);
+	    break;
+	case 21: // HandlInst
+	    m->HandlInst = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_HandlInst);
+	    break;
+	case 18: // ExecInst
+	    ofix_typed_view(&scan, &m->ExecInst);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ExecInst);
+	    break;
+	case 110: // MinQty
+	    ofix_typed_decimal(err, &scan, 110, &m->MinQty);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MinQty);
+	    break;
+	case 111: // MaxFloor
+	    ofix_typed_decimal(err, &scan, 111, &m->MaxFloor);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MaxFloor);
+	    break;
+	case 100: // ExDestination
+	    ofix_typed_view(&scan, &m->ExDestination);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ExDestination);
+	    break;
+	case 386: // NoTradingSessions
+	    m->NoTradingSessions = ofix_typed_int(err, &scan, 386);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_NoTradingSessions);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_EncodedSecurityDesc);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Side);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_TransactTime);
+	    break;
+	case 38: // OrderQty
+	    ofix_typed_decimal(err, &scan, 38, &m->OrderQty);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_CashOrderQty);
+	    break;
+	case 40: // OrdType
+	    m->OrdType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OrdType);
+	    break;
+	case 44: // Price
+	    ofix_typed_decimal(err, &scan, 44, &m->Price);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Price);
+	    break;
+	case 99: // StopPx
+	    ofix_typed_decimal(err, &scan, 99, &m->StopPx);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_StopPx);
+	    break;
+	case 211: // PegDifference
+	    ofix_typed_decimal(err, &scan, 211, &m->PegDifference);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_PegDifference);
+	    break;
+	case 388: // DiscretionInst
+	    m->DiscretionInst = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_DiscretionInst);
+	    break;
+	case 389: // DiscretionOffset
+	    ofix_typed_decimal(err, &scan, 389, &m->DiscretionOffset);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_DiscretionOffset);
+	    break;
+	case 376: // ComplianceID
+	    ofix_typed_view(&scan, &m->ComplianceID);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ComplianceID);
+	    break;
+	case 377: // SolicitedFlag
+	    m->SolicitedFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SolicitedFlag);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Currency);
+	    break;
+	case 59: // TimeInForce
+	    m->TimeInForce = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_TimeInForce);
+	    break;
+	case 168: // EffectiveTime
+	    ofix_typed_date(err, &scan, 168, OFIX_TIMESTAMP, &m->EffectiveTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_EffectiveTime);
+	    break;
+	case 432: // ExpireDate
+	    ofix_typed_view(&scan, &m->ExpireDate);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ExpireDate);
+	    break;
+	case 126: // ExpireTime
+	    ofix_typed_date(err, &scan, 126, OFIX_TIMESTAMP, &m->ExpireTime);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ExpireTime);
+	    break;
+	case 427: // GTBookingInst
+	    m->GTBookingInst = ofix_typed_int(err, &scan, 427);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_GTBookingInst);
+	    break;
+	case 12: // Commission
+	    ofix_typed_decimal(err, &scan, 12, &m->Commission);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Commission);
+	    break;
+	case 13: // CommType
+	    m->CommType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_CommType);
+	    break;
+	case 47: // Rule80A
+	    m->Rule80A = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Rule80A);
+	    break;
+	case 121: // ForexReq
+	    m->ForexReq = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ForexReq);
+	    break;
+	case 120: // SettlCurrency
+	    ofix_typed_view(&scan, &m->SettlCurrency);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SettlCurrency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_EncodedText);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_view(&scan, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OrderQty2);
+	    break;
+	case 77: // OpenClose
+	    m->OpenClose = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_OpenClose);
+	    break;
+	case 203: // CoveredOrUncovered
+	    m->CoveredOrUncovered = ofix_typed_int(err, &scan, 203);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_CoveredOrUncovered);
+	    break;
+	case 204: // CustomerOrFirm
+	    m->CustomerOrFirm = ofix_typed_int(err, &scan, 204);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_CustomerOrFirm);
+	    break;
+	case 210: // MaxShow
+	    ofix_typed_decimal(err, &scan, 210, &m->MaxShow);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_MaxShow);
+	    break;
+	case 114: // LocateReqd
+	    m->LocateReqd = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_LocateReqd);
+	    break;
+	case 439: // ClearingFirm
+	    ofix_typed_view(&scan, &m->ClearingFirm);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ClearingFirm);
+	    break;
+	case 440: // ClearingAccount
+	    ofix_typed_view(&scan, &m->ClearingAccount);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_ClearingAccount);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_OrderCancelReplaceRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix42OrderCancelReplaceRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_OrderCancelReplaceRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_OrderCancelReplaceRequest(ofixErr err, fix42OrderCancelReplaceRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "G", 4, 2, 100);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OrigClOrdID)) {
+	ofix_typed_set_view(err, msg, 41, &m->OrigClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_NoAllocs)) {
+	ofix_typed_set_int(err, msg, 78, m->NoAllocs);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SettlmntTyp)) {
+	ofix_typed_set_char(err, msg, 63, m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_FutSettDate)) {
+	ofix_typed_set_view(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_HandlInst)) {
+	ofix_typed_set_char(err, msg, 21, m->HandlInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ExecInst)) {
+	ofix_typed_set_view(err, msg, 18, &m->ExecInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_MinQty)) {
+	ofix_typed_set_decimal(err, msg, 110, &m->MinQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_MaxFloor)) {
+	ofix_typed_set_decimal(err, msg, 111, &m->MaxFloor);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ExDestination)) {
+	ofix_typed_set_view(err, msg, 100, &m->ExDestination);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_NoTradingSessions)) {
+	ofix_typed_set_int(err, msg, 386, m->NoTradingSessions);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OrderQty)) {
+	ofix_typed_set_decimal(err, msg, 38, &m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OrdType)) {
+	ofix_typed_set_char(err, msg, 40, m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Price)) {
+	ofix_typed_set_decimal(err, msg, 44, &m->Price);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_StopPx)) {
+	ofix_typed_set_decimal(err, msg, 99, &m->StopPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_PegDifference)) {
+	ofix_typed_set_decimal(err, msg, 211, &m->PegDifference);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_DiscretionInst)) {
+	ofix_typed_set_char(err, msg, 388, m->DiscretionInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_DiscretionOffset)) {
+	ofix_typed_set_decimal(err, msg, 389, &m->DiscretionOffset);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ComplianceID)) {
+	ofix_typed_set_view(err, msg, 376, &m->ComplianceID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SolicitedFlag)) {
+	ofix_typed_set_char(err, msg, 377, m->SolicitedFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_TimeInForce)) {
+	ofix_typed_set_char(err, msg, 59, m->TimeInForce);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_EffectiveTime)) {
+	ofix_msg_set_date(err, msg, 168, &m->EffectiveTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ExpireDate)) {
+	ofix_typed_set_view(err, msg, 432, &m->ExpireDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ExpireTime)) {
+	ofix_msg_set_date(err, msg, 126, &m->ExpireTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_GTBookingInst)) {
+	ofix_typed_set_int(err, msg, 427, m->GTBookingInst);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Commission)) {
+	ofix_typed_set_decimal(err, msg, 12, &m->Commission);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_CommType)) {
+	ofix_typed_set_char(err, msg, 13, m->CommType);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Rule80A)) {
+	ofix_typed_set_char(err, msg, 47, m->Rule80A);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ForexReq)) {
+	ofix_typed_set_char(err, msg, 121, m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SettlCurrency)) {
+	ofix_typed_set_view(err, msg, 120, &m->SettlCurrency);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_FutSettDate2)) {
+	ofix_typed_set_view(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_OpenClose)) {
+	ofix_typed_set_char(err, msg, 77, m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_CoveredOrUncovered)) {
+	ofix_typed_set_int(err, msg, 203, m->CoveredOrUncovered);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_CustomerOrFirm)) {
+	ofix_typed_set_int(err, msg, 204, m->CustomerOrFirm);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_MaxShow)) {
+	ofix_typed_set_decimal(err, msg, 210, &m->MaxShow);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_LocateReqd)) {
+	ofix_typed_set_char(err, msg, 114, m->LocateReqd);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ClearingFirm)) {
+	ofix_typed_set_view(err, msg, 439, &m->ClearingFirm);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_ClearingAccount)) {
+	ofix_typed_set_view(err, msg, 440, &m->ClearingAccount);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderCancelReplaceRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// OrderStatusRequest [H]
+
+void
+fix42_decode_OrderStatusRequest(ofixErr err, fix42OrderStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42OrderStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_OnBehalfOfSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_OrderID);
+	    break;
+	case 11: // ClOrdID
+	    ofix_typed_view(&scan, &m->ClOrdID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_ClOrdID);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_ClientID);
+	    break;
+	case 1: // Account
+	    ofix_typed_view(&scan, &m->Account);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_Account);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_ExecBroker);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_EncodedSecurityDesc);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_Side);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_OrderStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_OrderStatusRequest_msg(ofixErr err, fix42OrderStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_OrderStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_OrderStatusRequest(ofixErr err, fix42OrderStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "H", 4, 2, 55);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_ClOrdID)) {
+	ofix_typed_set_view(err, msg, 11, &m->ClOrdID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_Account)) {
+	ofix_typed_set_view(err, msg, 1, &m->Account);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_OrderStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Allocation [J]
+
+static const int	AllocationGroup73[] = { 11, 37, 198, 66, 105, 0 };
+static const int	AllocationGroup124[] = { 32, 17, 31, 29, 0 };
+static const int	AllocationGroup78[] = { 79, 366, 80, 81, 92, 208, 209, 161, 360, 361, 76, 109, 12, 13, 153, 154, 119, 120, 155, 156, 159, 160, 136, 0 };
+static const int	AllocationGroup136[] = { 137, 138, 139, 0 };
+
+static const struct _ofixTypedGroup	AllocationGroups[] = {
+    { 73, -1, AllocationGroup73 }, // NoOrders
+    { 124, -1, AllocationGroup124 }, // NoExecs
+    { 78, -1, AllocationGroup78 }, // NoAllocs
+    { 136, 2, AllocationGroup136 }, // NoMiscFees
+};
+
+void
+fix42_decode_Allocation(ofixErr err, fix42Allocation m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Allocation));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, AllocationGroups, 4);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Allocation_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Allocation_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Allocation_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Allocation_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Allocation_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Allocation_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Allocation_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Allocation_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Allocation_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Allocation_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Allocation_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Allocation_OnBehalfOfSendingTime);
+	    break;
+	case 70: // AllocID
+	    ofix_typed_view(&scan, &m->AllocID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_AllocID);
+	    break;
+	case 71: // AllocTransType
+	    m->AllocTransType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Allocation_AllocTransType);
+	    break;
+	case 72: // RefAllocID
+	    ofix_typed_view(&scan, &m->RefAllocID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_RefAllocID);
+	    break;
+	case 196: // AllocLinkID
+	    ofix_typed_view(&scan, &m->AllocLinkID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_AllocLinkID);
+	    break;
+	case 197: // AllocLinkType
+	    m->AllocLinkType = ofix_typed_int(err, &scan, 197);
+	    ofix_typed_mark(m->present, FIX42_Allocation_AllocLinkType);
+	    break;
+	case 73: // NoOrders
+	    m->NoOrders = ofix_typed_int(err, &scan, 73);
+	    ofix_typed_mark(m->present, FIX42_Allocation_NoOrders);
+	    break;
+	case 124: // NoExecs
+	    m->NoExecs = ofix_typed_int(err, &scan, 124);
+	    ofix_typed_mark(m->present, FIX42_Allocation_NoExecs);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Allocation_Side);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_Allocation_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_Allocation_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_Allocation_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_Allocation_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_Allocation_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_Allocation_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Allocation_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_Allocation_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_Allocation_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_Allocation_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_Allocation_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_Allocation_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_Allocation_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_Allocation_EncodedSecurityDesc);
+	    break;
+	case 53: // Shares
+	    ofix_typed_decimal(err, &scan, 53, &m->Shares);
+	    ofix_typed_mark(m->present, FIX42_Allocation_Shares);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX42_Allocation_LastMkt);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_Allocation_TradingSessionID);
+	    break;
+	case 6: // AvgPx
+	    ofix_typed_decimal(err, &scan, 6, &m->AvgPx);
+	    ofix_typed_mark(m->present, FIX42_Allocation_AvgPx);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_Allocation_Currency);
+	    break;
+	case 74: // AvgPrxPrecision
+	    m->AvgPrxPrecision = ofix_typed_int(err, &scan, 74);
+	    ofix_typed_mark(m->present, FIX42_Allocation_AvgPrxPrecision);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_view(&scan, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX42_Allocation_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_Allocation_TransactTime);
+	    break;
+	case 63: // SettlmntTyp
+	    m->SettlmntTyp = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SettlmntTyp);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_view(&scan, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX42_Allocation_FutSettDate);
+	    break;
+	case 381: // GrossTradeAmt
+	    ofix_typed_decimal(err, &scan, 381, &m->GrossTradeAmt);
+	    ofix_typed_mark(m->present, FIX42_Allocation_GrossTradeAmt);
+	    break;
+	case 118: // NetMoney
+	    ofix_typed_decimal(err, &scan, 118, &m->NetMoney);
+	    ofix_typed_mark(m->present, FIX42_Allocation_NetMoney);
+	    break;
+	case 77: // OpenClose
+	    m->OpenClose = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Allocation_OpenClose);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_Allocation_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_Allocation_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_Allocation_EncodedText);
+	    break;
+	case 157: // NumDaysInterest
+	    m->NumDaysInterest = ofix_typed_int(err, &scan, 157);
+	    ofix_typed_mark(m->present, FIX42_Allocation_NumDaysInterest);
+	    break;
+	case 158: // AccruedInterestRate
+	    ofix_typed_decimal(err, &scan, 158, &m->AccruedInterestRate);
+	    ofix_typed_mark(m->present, FIX42_Allocation_AccruedInterestRate);
+	    break;
+	case 78: // NoAllocs
+	    m->NoAllocs = ofix_typed_int(err, &scan, 78);
+	    ofix_typed_mark(m->present, FIX42_Allocation_NoAllocs);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Allocation_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Allocation_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Allocation_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Allocation_msg(ofixErr err, fix42Allocation m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Allocation(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Allocation(ofixErr err, fix42Allocation m) {
+    ofixMsg	msg = ofix_msg_create(err, "J", 4, 2, 76);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Allocation_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_AllocID)) {
+	ofix_typed_set_view(err, msg, 70, &m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_AllocTransType)) {
+	ofix_typed_set_char(err, msg, 71, m->AllocTransType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_RefAllocID)) {
+	ofix_typed_set_view(err, msg, 72, &m->RefAllocID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_AllocLinkID)) {
+	ofix_typed_set_view(err, msg, 196, &m->AllocLinkID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_AllocLinkType)) {
+	ofix_typed_set_int(err, msg, 197, m->AllocLinkType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_NoOrders)) {
+	ofix_typed_set_int(err, msg, 73, m->NoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_NoExecs)) {
+	ofix_typed_set_int(err, msg, 124, m->NoExecs);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_Shares)) {
+	ofix_typed_set_decimal(err, msg, 53, &m->Shares);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_AvgPx)) {
+	ofix_typed_set_decimal(err, msg, 6, &m->AvgPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_AvgPrxPrecision)) {
+	ofix_typed_set_int(err, msg, 74, m->AvgPrxPrecision);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_TradeDate)) {
+	ofix_typed_set_view(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SettlmntTyp)) {
+	ofix_typed_set_char(err, msg, 63, m->SettlmntTyp);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_FutSettDate)) {
+	ofix_typed_set_view(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_GrossTradeAmt)) {
+	ofix_typed_set_decimal(err, msg, 381, &m->GrossTradeAmt);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_NetMoney)) {
+	ofix_typed_set_decimal(err, msg, 118, &m->NetMoney);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_OpenClose)) {
+	ofix_typed_set_char(err, msg, 77, m->OpenClose);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_NumDaysInterest)) {
+	ofix_typed_set_int(err, msg, 157, m->NumDaysInterest);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_AccruedInterestRate)) {
+	ofix_typed_set_decimal(err, msg, 158, &m->AccruedInterestRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_NoAllocs)) {
+	ofix_typed_set_int(err, msg, 78, m->NoAllocs);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Allocation_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListCancelRequest [K]
+
+void
+fix42_decode_ListCancelRequest(ofixErr err, fix42ListCancelRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42ListCancelRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_OnBehalfOfSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_ListID);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_TransactTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_ListCancelRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_ListCancelRequest_msg(ofixErr err, fix42ListCancelRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_ListCancelRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_ListCancelRequest(ofixErr err, fix42ListCancelRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "K", 4, 2, 35);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListCancelRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListExecute [L]
+
+void
+fix42_decode_ListExecute(ofixErr err, fix42ListExecute m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42ListExecute));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_OnBehalfOfSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_ListID);
+	    break;
+	case 391: // ClientBidID
+	    ofix_typed_view(&scan, &m->ClientBidID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_ClientBidID);
+	    break;
+	case 390: // BidID
+	    ofix_typed_view(&scan, &m->BidID);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_BidID);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_TransactTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_ListExecute_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_ListExecute_msg(ofixErr err, fix42ListExecute m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_ListExecute(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_ListExecute(ofixErr err, fix42ListExecute m) {
+    ofixMsg	msg = ofix_msg_create(err, "L", 4, 2, 37);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_ListExecute_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_ClientBidID)) {
+	ofix_typed_set_view(err, msg, 391, &m->ClientBidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_BidID)) {
+	ofix_typed_set_view(err, msg, 390, &m->BidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListExecute_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListStatusRequest [M]
+
+void
+fix42_decode_ListStatusRequest(ofixErr err, fix42ListStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42ListStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_OnBehalfOfSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_ListID);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_ListStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_ListStatusRequest_msg(ofixErr err, fix42ListStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_ListStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_ListStatusRequest(ofixErr err, fix42ListStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "M", 4, 2, 34);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListStatus [N]
+
+static const int	ListStatusGroup73[] = { 11, 14, 39, 151, 84, 6, 103, 58, 354, 355, 0 };
+
+static const struct _ofixTypedGroup	ListStatusGroups[] = {
+    { 73, -1, ListStatusGroup73 }, // NoOrders
+};
+
+void
+fix42_decode_ListStatus(ofixErr err, fix42ListStatus m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42ListStatus));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, ListStatusGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_OnBehalfOfSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_ListID);
+	    break;
+	case 429: // ListStatusType
+	    m->ListStatusType = ofix_typed_int(err, &scan, 429);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_ListStatusType);
+	    break;
+	case 82: // NoRpts
+	    m->NoRpts = ofix_typed_int(err, &scan, 82);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_NoRpts);
+	    break;
+	case 431: // ListOrderStatus
+	    m->ListOrderStatus = ofix_typed_int(err, &scan, 431);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_ListOrderStatus);
+	    break;
+	case 83: // RptSeq
+	    m->RptSeq = ofix_typed_int(err, &scan, 83);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_RptSeq);
+	    break;
+	case 444: // ListStatusText
+	    ofix_typed_view(&scan, &m->ListStatusText);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_ListStatusText);
+	    break;
+	case 445: // EncodedListStatusTextLen
+	    m->EncodedListStatusTextLen = ofix_typed_int(err, &scan, 445);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_EncodedListStatusTextLen);
+	    break;
+	case 446: // EncodedListStatusText
+	    ofix_typed_view(&scan, &m->EncodedListStatusText);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_EncodedListStatusText);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_TransactTime);
+	    break;
+	case 68: // TotNoOrders
+	    m->TotNoOrders = ofix_typed_int(err, &scan, 68);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_TotNoOrders);
+	    break;
+	case 73: // NoOrders
+	    m->NoOrders = ofix_typed_int(err, &scan, 73);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_NoOrders);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_ListStatus_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_ListStatus_msg(ofixErr err, fix42ListStatus m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_ListStatus(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_ListStatus(ofixErr err, fix42ListStatus m) {
+    ofixMsg	msg = ofix_msg_create(err, "N", 4, 2, 41);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_ListStatus_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_ListStatusType)) {
+	ofix_typed_set_int(err, msg, 429, m->ListStatusType);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_NoRpts)) {
+	ofix_typed_set_int(err, msg, 82, m->NoRpts);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_ListOrderStatus)) {
+	ofix_typed_set_int(err, msg, 431, m->ListOrderStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_RptSeq)) {
+	ofix_typed_set_int(err, msg, 83, m->RptSeq);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_ListStatusText)) {
+	ofix_typed_set_view(err, msg, 444, &m->ListStatusText);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_EncodedListStatusTextLen)) {
+	ofix_typed_set_int(err, msg, 445, m->EncodedListStatusTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_EncodedListStatusText)) {
+	ofix_typed_set_view(err, msg, 446, &m->EncodedListStatusText);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_TotNoOrders)) {
+	ofix_typed_set_int(err, msg, 68, m->TotNoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_NoOrders)) {
+	ofix_typed_set_int(err, msg, 73, m->NoOrders);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStatus_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// AllocationACK [P]
+
+void
+fix42_decode_AllocationACK(ofixErr err, fix42AllocationACK m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42AllocationACK));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_OnBehalfOfSendingTime);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_ExecBroker);
+	    break;
+	case 70: // AllocID
+	    ofix_typed_view(&scan, &m->AllocID);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_AllocID);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_view(&scan, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_TradeDate);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_TransactTime);
+	    break;
+	case 87: // AllocStatus
+	    m->AllocStatus = ofix_typed_int(err, &scan, 87);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_AllocStatus);
+	    break;
+	case 88: // AllocRejCode
+	    m->AllocRejCode = ofix_typed_int(err, &scan, 88);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_AllocRejCode);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_AllocationACK_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_AllocationACK_msg(ofixErr err, fix42AllocationACK m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_AllocationACK(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_AllocationACK(ofixErr err, fix42AllocationACK m) {
+    ofixMsg	msg = ofix_msg_create(err, "P", 4, 2, 40);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_AllocID)) {
+	ofix_typed_set_view(err, msg, 70, &m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_TradeDate)) {
+	ofix_typed_set_view(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_AllocStatus)) {
+	ofix_typed_set_int(err, msg, 87, m->AllocStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_AllocRejCode)) {
+	ofix_typed_set_int(err, msg, 88, m->AllocRejCode);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_AllocationACK_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// DontKnowTrade [Q]
+
+void
+fix42_decode_DontKnowTrade(ofixErr err, fix42DontKnowTrade m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42DontKnowTrade));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OnBehalfOfSendingTime);
+	    break;
+	case 37: // OrderID
+	    ofix_typed_view(&scan, &m->OrderID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OrderID);
+	    break;
+	case 17: // ExecID
+	    ofix_typed_view(&scan, &m->ExecID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_ExecID);
+	    break;
+	case 127: // DKReason
+	    m->DKReason = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_DKReason);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_EncodedSecurityDesc);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_Side);
+	    break;
+	case 38: // OrderQty
+	    ofix_typed_decimal(err, &scan, 38, &m->OrderQty);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_OrderQty);
+	    break;
+	case 152: // CashOrderQty
+	    ofix_typed_decimal(err, &scan, 152, &m->CashOrderQty);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_CashOrderQty);
+	    break;
+	case 32: // LastShares
+	    ofix_typed_decimal(err, &scan, 32, &m->LastShares);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_LastShares);
+	    break;
+	case 31: // LastPx
+	    ofix_typed_decimal(err, &scan, 31, &m->LastPx);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_LastPx);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_DontKnowTrade_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_DontKnowTrade_msg(ofixErr err, fix42DontKnowTrade m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_DontKnowTrade(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_DontKnowTrade(ofixErr err, fix42DontKnowTrade m) {
+    ofixMsg	msg = ofix_msg_create(err, "Q", 4, 2, 60);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OrderID)) {
+	ofix_typed_set_view(err, msg, 37, &m->OrderID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_ExecID)) {
+	ofix_typed_set_view(err, msg, 17, &m->ExecID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_DKReason)) {
+	ofix_typed_set_char(err, msg, 127, m->DKReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_OrderQty)) {
+	ofix_typed_set_decimal(err, msg, 38, &m->OrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_CashOrderQty)) {
+	ofix_typed_set_decimal(err, msg, 152, &m->CashOrderQty);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_LastShares)) {
+	ofix_typed_set_decimal(err, msg, 32, &m->LastShares);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_LastPx)) {
+	ofix_typed_set_decimal(err, msg, 31, &m->LastPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_DontKnowTrade_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// QuoteRequest [R]
+
+static const int	QuoteRequestGroup146[] = { 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 140, 303, 336, 54, 38, 64, 40, 193, 192, 126, 60, 15, 0 };
+
+static const struct _ofixTypedGroup	QuoteRequestGroups[] = {
+    { 146, -1, QuoteRequestGroup146 }, // NoRelatedSym
+};
+
+void
+fix42_decode_QuoteRequest(ofixErr err, fix42QuoteRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42QuoteRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, QuoteRequestGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_OnBehalfOfSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_QuoteReqID);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_NoRelatedSym);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_QuoteRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_QuoteRequest_msg(ofixErr err, fix42QuoteRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_QuoteRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_QuoteRequest(ofixErr err, fix42QuoteRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "R", 4, 2, 32);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// Quote [S]
+
+void
+fix42_decode_Quote(ofixErr err, fix42Quote m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42Quote));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_Quote_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_Quote_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_Quote_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_Quote_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_Quote_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_Quote_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_Quote_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_Quote_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_Quote_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_Quote_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_Quote_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_Quote_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_Quote_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_Quote_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_Quote_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_Quote_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_Quote_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_Quote_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Quote_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Quote_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_Quote_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Quote_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_Quote_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_Quote_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_Quote_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_Quote_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_Quote_OnBehalfOfSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX42_Quote_QuoteReqID);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX42_Quote_QuoteID);
+	    break;
+	case 301: // QuoteResponseLevel
+	    m->QuoteResponseLevel = ofix_typed_int(err, &scan, 301);
+	    ofix_typed_mark(m->present, FIX42_Quote_QuoteResponseLevel);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_Quote_TradingSessionID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_Quote_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_Quote_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_Quote_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_Quote_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_Quote_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_Quote_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_Quote_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_Quote_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_Quote_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Quote_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_Quote_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_Quote_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_Quote_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_Quote_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_Quote_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_Quote_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_Quote_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_Quote_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_Quote_EncodedSecurityDesc);
+	    break;
+	case 132: // BidPx
+	    ofix_typed_decimal(err, &scan, 132, &m->BidPx);
+	    ofix_typed_mark(m->present, FIX42_Quote_BidPx);
+	    break;
+	case 133: // OfferPx
+	    ofix_typed_decimal(err, &scan, 133, &m->OfferPx);
+	    ofix_typed_mark(m->present, FIX42_Quote_OfferPx);
+	    break;
+	case 134: // BidSize
+	    ofix_typed_decimal(err, &scan, 134, &m->BidSize);
+	    ofix_typed_mark(m->present, FIX42_Quote_BidSize);
+	    break;
+	case 135: // OfferSize
+	    ofix_typed_decimal(err, &scan, 135, &m->OfferSize);
+	    ofix_typed_mark(m->present, FIX42_Quote_OfferSize);
+	    break;
+	case 62: // ValidUntilTime
+	    ofix_typed_date(err, &scan, 62, OFIX_TIMESTAMP, &m->ValidUntilTime);
+	    ofix_typed_mark(m->present, FIX42_Quote_ValidUntilTime);
+	    break;
+	case 188: // BidSpotRate
+	    ofix_typed_decimal(err, &scan, 188, &m->BidSpotRate);
+	    ofix_typed_mark(m->present, FIX42_Quote_BidSpotRate);
+	    break;
+	case 190: // OfferSpotRate
+	    ofix_typed_decimal(err, &scan, 190, &m->OfferSpotRate);
+	    ofix_typed_mark(m->present, FIX42_Quote_OfferSpotRate);
+	    break;
+	case 189: // BidForwardPoints
+	    ofix_typed_decimal(err, &scan, 189, &m->BidForwardPoints);
+	    ofix_typed_mark(m->present, FIX42_Quote_BidForwardPoints);
+	    break;
+	case 191: // OfferForwardPoints
+	    ofix_typed_decimal(err, &scan, 191, &m->OfferForwardPoints);
+	    ofix_typed_mark(m->present, FIX42_Quote_OfferForwardPoints);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_Quote_TransactTime);
+	    break;
+	case 64: // FutSettDate
+	    ofix_typed_view(&scan, &m->FutSettDate);
+	    ofix_typed_mark(m->present, FIX42_Quote_FutSettDate);
+	    break;
+	case 40: // OrdType
+	    m->OrdType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_Quote_OrdType);
+	    break;
+	case 193: // FutSettDate2
+	    ofix_typed_view(&scan, &m->FutSettDate2);
+	    ofix_typed_mark(m->present, FIX42_Quote_FutSettDate2);
+	    break;
+	case 192: // OrderQty2
+	    ofix_typed_decimal(err, &scan, 192, &m->OrderQty2);
+	    ofix_typed_mark(m->present, FIX42_Quote_OrderQty2);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_Quote_Currency);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_Quote_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_Quote_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_Quote_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_Quote_msg(ofixErr err, fix42Quote m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_Quote(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_Quote(ofixErr err, fix42Quote m) {
+    ofixMsg	msg = ofix_msg_create(err, "S", 4, 2, 68);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_Quote_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_QuoteResponseLevel)) {
+	ofix_typed_set_int(err, msg, 301, m->QuoteResponseLevel);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_BidPx)) {
+	ofix_typed_set_decimal(err, msg, 132, &m->BidPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OfferPx)) {
+	ofix_typed_set_decimal(err, msg, 133, &m->OfferPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_BidSize)) {
+	ofix_typed_set_decimal(err, msg, 134, &m->BidSize);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OfferSize)) {
+	ofix_typed_set_decimal(err, msg, 135, &m->OfferSize);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_ValidUntilTime)) {
+	ofix_msg_set_date(err, msg, 62, &m->ValidUntilTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_BidSpotRate)) {
+	ofix_typed_set_decimal(err, msg, 188, &m->BidSpotRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OfferSpotRate)) {
+	ofix_typed_set_decimal(err, msg, 190, &m->OfferSpotRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_BidForwardPoints)) {
+	ofix_typed_set_decimal(err, msg, 189, &m->BidForwardPoints);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OfferForwardPoints)) {
+	ofix_typed_set_decimal(err, msg, 191, &m->OfferForwardPoints);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_FutSettDate)) {
+	ofix_typed_set_view(err, msg, 64, &m->FutSettDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OrdType)) {
+	ofix_typed_set_char(err, msg, 40, m->OrdType);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_FutSettDate2)) {
+	ofix_typed_set_view(err, msg, 193, &m->FutSettDate2);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_OrderQty2)) {
+	ofix_typed_set_decimal(err, msg, 192, &m->OrderQty2);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_Quote_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SettlementInstructions [T]
+
+void
+fix42_decode_SettlementInstructions(ofixErr err, fix42SettlementInstructions m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42SettlementInstructions));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_OnBehalfOfSendingTime);
+	    break;
+	case 162: // SettlInstID
+	    ofix_typed_view(&scan, &m->SettlInstID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlInstID);
+	    break;
+	case 163: // SettlInstTransType
+	    m->SettlInstTransType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlInstTransType);
+	    break;
+	case 214: // SettlInstRefID
+	    ofix_typed_view(&scan, &m->SettlInstRefID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlInstRefID);
+	    break;
+	case 160: // SettlInstMode
+	    m->SettlInstMode = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlInstMode);
+	    break;
+	case 165: // SettlInstSource
+	    m->SettlInstSource = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlInstSource);
+	    break;
+	case 79: // AllocAccount
+	    ofix_typed_view(&scan, &m->AllocAccount);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_AllocAccount);
+	    break;
+	case 166: // SettlLocation
+	    ofix_typed_view(&scan, &m->SettlLocation);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlLocation);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_view(&scan, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_TradeDate);
+	    break;
+	case 70: // AllocID
+	    ofix_typed_view(&scan, &m->AllocID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_AllocID);
+	    break;
+	case 30: // LastMkt
+	    ofix_typed_view(&scan, &m->LastMkt);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_LastMkt);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_TradingSessionID);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_Side);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecurityType);
+	    break;
+	case 168: // EffectiveTime
+	    ofix_typed_date(err, &scan, 168, OFIX_TIMESTAMP, &m->EffectiveTime);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_EffectiveTime);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_TransactTime);
+	    break;
+	case 109: // ClientID
+	    ofix_typed_view(&scan, &m->ClientID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_ClientID);
+	    break;
+	case 76: // ExecBroker
+	    ofix_typed_view(&scan, &m->ExecBroker);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_ExecBroker);
+	    break;
+	case 169: // StandInstDbType
+	    m->StandInstDbType = ofix_typed_int(err, &scan, 169);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_StandInstDbType);
+	    break;
+	case 170: // StandInstDbName
+	    ofix_typed_view(&scan, &m->StandInstDbName);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_StandInstDbName);
+	    break;
+	case 171: // StandInstDbID
+	    ofix_typed_view(&scan, &m->StandInstDbID);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_StandInstDbID);
+	    break;
+	case 172: // SettlDeliveryType
+	    m->SettlDeliveryType = ofix_typed_int(err, &scan, 172);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlDeliveryType);
+	    break;
+	case 173: // SettlDepositoryCode
+	    ofix_typed_view(&scan, &m->SettlDepositoryCode);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlDepositoryCode);
+	    break;
+	case 174: // SettlBrkrCode
+	    ofix_typed_view(&scan, &m->SettlBrkrCode);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlBrkrCode);
+	    break;
+	case 175: // SettlInstCode
+	    ofix_typed_view(&scan, &m->SettlInstCode);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SettlInstCode);
+	    break;
+	case 176: // SecuritySettlAgentName
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentName);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecuritySettlAgentName);
+	    break;
+	case 177: // SecuritySettlAgentCode
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentCode);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecuritySettlAgentCode);
+	    break;
+	case 178: // SecuritySettlAgentAcctNum
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentAcctNum);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecuritySettlAgentAcctNum);
+	    break;
+	case 179: // SecuritySettlAgentAcctName
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentAcctName);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecuritySettlAgentAcctName);
+	    break;
+	case 180: // SecuritySettlAgentContactName
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentContactName);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecuritySettlAgentContactName);
+	    break;
+	case 181: // SecuritySettlAgentContactPhone
+	    ofix_typed_view(&scan, &m->SecuritySettlAgentContactPhone);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SecuritySettlAgentContactPhone);
+	    break;
+	case 182: // CashSettlAgentName
+	    ofix_typed_view(&scan, &m->CashSettlAgentName);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_CashSettlAgentName);
+	    break;
+	case 183: // CashSettlAgentCode
+	    ofix_typed_view(&scan, &m->CashSettlAgentCode);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_CashSettlAgentCode);
+	    break;
+	case 184: // CashSettlAgentAcctNum
+	    ofix_typed_view(&scan, &m->CashSettlAgentAcctNum);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_CashSettlAgentAcctNum);
+	    break;
+	case 185: // CashSettlAgentAcctName
+	    ofix_typed_view(&scan, &m->CashSettlAgentAcctName);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_CashSettlAgentAcctName);
+	    break;
+	case 186: // CashSettlAgentContactName
+	    ofix_typed_view(&scan, &m->CashSettlAgentContactName);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_CashSettlAgentContactName);
+	    break;
+	case 187: // CashSettlAgentContactPhone
+	    ofix_typed_view(&scan, &m->CashSettlAgentContactPhone);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_CashSettlAgentContactPhone);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_SettlementInstructions_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_SettlementInstructions_msg(ofixErr err, fix42SettlementInstructions m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_SettlementInstructions(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_SettlementInstructions(ofixErr err, fix42SettlementInstructions m) {
+    ofixMsg	msg = ofix_msg_create(err, "T", 4, 2, 66);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlInstID)) {
+	ofix_typed_set_view(err, msg, 162, &m->SettlInstID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlInstTransType)) {
+	ofix_typed_set_char(err, msg, 163, m->SettlInstTransType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlInstRefID)) {
+	ofix_typed_set_view(err, msg, 214, &m->SettlInstRefID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlInstMode)) {
+	ofix_typed_set_char(err, msg, 160, m->SettlInstMode);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlInstSource)) {
+	ofix_typed_set_char(err, msg, 165, m->SettlInstSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_AllocAccount)) {
+	ofix_typed_set_view(err, msg, 79, &m->AllocAccount);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlLocation)) {
+	ofix_typed_set_view(err, msg, 166, &m->SettlLocation);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_TradeDate)) {
+	ofix_typed_set_view(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_AllocID)) {
+	ofix_typed_set_view(err, msg, 70, &m->AllocID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_LastMkt)) {
+	ofix_typed_set_view(err, msg, 30, &m->LastMkt);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_EffectiveTime)) {
+	ofix_msg_set_date(err, msg, 168, &m->EffectiveTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_ClientID)) {
+	ofix_typed_set_view(err, msg, 109, &m->ClientID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_ExecBroker)) {
+	ofix_typed_set_view(err, msg, 76, &m->ExecBroker);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_StandInstDbType)) {
+	ofix_typed_set_int(err, msg, 169, m->StandInstDbType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_StandInstDbName)) {
+	ofix_typed_set_view(err, msg, 170, &m->StandInstDbName);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_StandInstDbID)) {
+	ofix_typed_set_view(err, msg, 171, &m->StandInstDbID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlDeliveryType)) {
+	ofix_typed_set_int(err, msg, 172, m->SettlDeliveryType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlDepositoryCode)) {
+	ofix_typed_set_view(err, msg, 173, &m->SettlDepositoryCode);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlBrkrCode)) {
+	ofix_typed_set_view(err, msg, 174, &m->SettlBrkrCode);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SettlInstCode)) {
+	ofix_typed_set_view(err, msg, 175, &m->SettlInstCode);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecuritySettlAgentName)) {
+	ofix_typed_set_view(err, msg, 176, &m->SecuritySettlAgentName);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecuritySettlAgentCode)) {
+	ofix_typed_set_view(err, msg, 177, &m->SecuritySettlAgentCode);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecuritySettlAgentAcctNum)) {
+	ofix_typed_set_view(err, msg, 178, &m->SecuritySettlAgentAcctNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecuritySettlAgentAcctName)) {
+	ofix_typed_set_view(err, msg, 179, &m->SecuritySettlAgentAcctName);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecuritySettlAgentContactName)) {
+	ofix_typed_set_view(err, msg, 180, &m->SecuritySettlAgentContactName);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SecuritySettlAgentContactPhone)) {
+	ofix_typed_set_view(err, msg, 181, &m->SecuritySettlAgentContactPhone);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_CashSettlAgentName)) {
+	ofix_typed_set_view(err, msg, 182, &m->CashSettlAgentName);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_CashSettlAgentCode)) {
+	ofix_typed_set_view(err, msg, 183, &m->CashSettlAgentCode);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_CashSettlAgentAcctNum)) {
+	ofix_typed_set_view(err, msg, 184, &m->CashSettlAgentAcctNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_CashSettlAgentAcctName)) {
+	ofix_typed_set_view(err, msg, 185, &m->CashSettlAgentAcctName);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_CashSettlAgentContactName)) {
+	ofix_typed_set_view(err, msg, 186, &m->CashSettlAgentContactName);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_CashSettlAgentContactPhone)) {
+	ofix_typed_set_view(err, msg, 187, &m->CashSettlAgentContactPhone);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_SettlementInstructions_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// MarketDataRequest [V]
+
+static const int	MarketDataRequestGroup267[] = { 269, 0 };
+static const int	MarketDataRequestGroup146[] = { 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 336, 0 };
+
+static const struct _ofixTypedGroup	MarketDataRequestGroups[] = {
+    { 267, -1, MarketDataRequestGroup267 }, // NoMDEntryTypes
+    { 146, -1, MarketDataRequestGroup146 }, // NoRelatedSym
+};
+
+void
+fix42_decode_MarketDataRequest(ofixErr err, fix42MarketDataRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42MarketDataRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, MarketDataRequestGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_OnBehalfOfSendingTime);
+	    break;
+	case 262: // MDReqID
+	    ofix_typed_view(&scan, &m->MDReqID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_MDReqID);
+	    break;
+	case 263: // SubscriptionRequestType
+	    m->SubscriptionRequestType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SubscriptionRequestType);
+	    break;
+	case 264: // MarketDepth
+	    m->MarketDepth = ofix_typed_int(err, &scan, 264);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_MarketDepth);
+	    break;
+	case 265: // MDUpdateType
+	    m->MDUpdateType = ofix_typed_int(err, &scan, 265);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_MDUpdateType);
+	    break;
+	case 266: // AggregatedBook
+	    m->AggregatedBook = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_AggregatedBook);
+	    break;
+	case 267: // NoMDEntryTypes
+	    m->NoMDEntryTypes = ofix_typed_int(err, &scan, 267);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_NoMDEntryTypes);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_NoRelatedSym);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_MarketDataRequest_msg(ofixErr err, fix42MarketDataRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_MarketDataRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_MarketDataRequest(ofixErr err, fix42MarketDataRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "V", 4, 2, 37);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_MDReqID)) {
+	ofix_typed_set_view(err, msg, 262, &m->MDReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SubscriptionRequestType)) {
+	ofix_typed_set_char(err, msg, 263, m->SubscriptionRequestType);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_MarketDepth)) {
+	ofix_typed_set_int(err, msg, 264, m->MarketDepth);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_MDUpdateType)) {
+	ofix_typed_set_int(err, msg, 265, m->MDUpdateType);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_AggregatedBook)) {
+	ofix_typed_set_char(err, msg, 266, m->AggregatedBook);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_NoMDEntryTypes)) {
+	ofix_typed_set_int(err, msg, 267, m->NoMDEntryTypes);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// MarketDataSnapshotFullRefresh [W]
+
+static const int	MarketDataSnapshotFullRefreshGroup268[] = { 269, 270, 15, 271, 272, 273, 274, 275, 336, 276, 277, 282, 283, 284, 286, 59, 432, 126, 110, 18, 287, 37, 299, 288, 289, 346, 290, 58, 354, 355, 0 };
+
+static const struct _ofixTypedGroup	MarketDataSnapshotFullRefreshGroups[] = {
+    { 268, -1, MarketDataSnapshotFullRefreshGroup268 }, // NoMDEntries
+};
+
+void
+fix42_decode_MarketDataSnapshotFullRefresh(ofixErr err, fix42MarketDataSnapshotFullRefresh m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42MarketDataSnapshotFullRefresh));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, MarketDataSnapshotFullRefreshGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfSendingTime);
+	    break;
+	case 262: // MDReqID
+	    ofix_typed_view(&scan, &m->MDReqID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_MDReqID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedSecurityDesc);
+	    break;
+	case 291: // FinancialStatus
+	    m->FinancialStatus = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_FinancialStatus);
+	    break;
+	case 292: // CorporateAction
+	    m->CorporateAction = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_CorporateAction);
+	    break;
+	case 387: // TotalVolumeTraded
+	    ofix_typed_decimal(err, &scan, 387, &m->TotalVolumeTraded);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_TotalVolumeTraded);
+	    break;
+	case 268: // NoMDEntries
+	    m->NoMDEntries = ofix_typed_int(err, &scan, 268);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_NoMDEntries);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_MarketDataSnapshotFullRefresh_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_MarketDataSnapshotFullRefresh_msg(ofixErr err, fix42MarketDataSnapshotFullRefresh m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_MarketDataSnapshotFullRefresh(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_MarketDataSnapshotFullRefresh(ofixErr err, fix42MarketDataSnapshotFullRefresh m) {
+    ofixMsg	msg = ofix_msg_create(err, "W", 4, 2, 54);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_MDReqID)) {
+	ofix_typed_set_view(err, msg, 262, &m->MDReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_FinancialStatus)) {
+	ofix_typed_set_char(err, msg, 291, m->FinancialStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_CorporateAction)) {
+	ofix_typed_set_char(err, msg, 292, m->CorporateAction);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_TotalVolumeTraded)) {
+	ofix_typed_set_decimal(err, msg, 387, &m->TotalVolumeTraded);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_NoMDEntries)) {
+	ofix_typed_set_int(err, msg, 268, m->NoMDEntries);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataSnapshotFullRefresh_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// MarketDataIncrementalRefresh [X]
+
+static const int	MarketDataIncrementalRefreshGroup268[] = { 279, 285, 269, 278, 280, 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 291, 292, 270, 15, 271, 272, 273, 274, 275, 336, 276, 277, 282, 283, 284, 286, 59, 432, 126, 110, 18, 287, 37, 299, 288, 289, 346, 290, 387, 58, 354, 355, 0 };
+
+static const struct _ofixTypedGroup	MarketDataIncrementalRefreshGroups[] = {
+    { 268, -1, MarketDataIncrementalRefreshGroup268 }, // NoMDEntries
+};
+
+void
+fix42_decode_MarketDataIncrementalRefresh(ofixErr err, fix42MarketDataIncrementalRefresh m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42MarketDataIncrementalRefresh));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, MarketDataIncrementalRefreshGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfSendingTime);
+	    break;
+	case 262: // MDReqID
+	    ofix_typed_view(&scan, &m->MDReqID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_MDReqID);
+	    break;
+	case 268: // NoMDEntries
+	    m->NoMDEntries = ofix_typed_int(err, &scan, 268);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_NoMDEntries);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_MarketDataIncrementalRefresh_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_MarketDataIncrementalRefresh_msg(ofixErr err, fix42MarketDataIncrementalRefresh m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_MarketDataIncrementalRefresh(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_MarketDataIncrementalRefresh(ofixErr err, fix42MarketDataIncrementalRefresh m) {
+    ofixMsg	msg = ofix_msg_create(err, "X", 4, 2, 32);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_MDReqID)) {
+	ofix_typed_set_view(err, msg, 262, &m->MDReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_NoMDEntries)) {
+	ofix_typed_set_int(err, msg, 268, m->NoMDEntries);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataIncrementalRefresh_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// MarketDataRequestReject [Y]
+
+void
+fix42_decode_MarketDataRequestReject(ofixErr err, fix42MarketDataRequestReject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42MarketDataRequestReject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_OnBehalfOfSendingTime);
+	    break;
+	case 262: // MDReqID
+	    ofix_typed_view(&scan, &m->MDReqID);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_MDReqID);
+	    break;
+	case 281: // MDReqRejReason
+	    m->MDReqRejReason = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_MDReqRejReason);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_MarketDataRequestReject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_MarketDataRequestReject_msg(ofixErr err, fix42MarketDataRequestReject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_MarketDataRequestReject(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_MarketDataRequestReject(ofixErr err, fix42MarketDataRequestReject m) {
+    ofixMsg	msg = ofix_msg_create(err, "Y", 4, 2, 35);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_MDReqID)) {
+	ofix_typed_set_view(err, msg, 262, &m->MDReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_MDReqRejReason)) {
+	ofix_typed_set_char(err, msg, 281, m->MDReqRejReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_MarketDataRequestReject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// QuoteCancel [Z]
+
+static const int	QuoteCancelGroup295[] = { 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 311, 0 };
+
+static const struct _ofixTypedGroup	QuoteCancelGroups[] = {
+    { 295, -1, QuoteCancelGroup295 }, // NoQuoteEntries
+};
+
+void
+fix42_decode_QuoteCancel(ofixErr err, fix42QuoteCancel m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42QuoteCancel));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, QuoteCancelGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_OnBehalfOfSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_QuoteReqID);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_QuoteID);
+	    break;
+	case 298: // QuoteCancelType
+	    m->QuoteCancelType = ofix_typed_int(err, &scan, 298);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_QuoteCancelType);
+	    break;
+	case 301: // QuoteResponseLevel
+	    m->QuoteResponseLevel = ofix_typed_int(err, &scan, 301);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_QuoteResponseLevel);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_TradingSessionID);
+	    break;
+	case 295: // NoQuoteEntries
+	    m->NoQuoteEntries = ofix_typed_int(err, &scan, 295);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_NoQuoteEntries);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_QuoteCancel_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_QuoteCancel_msg(ofixErr err, fix42QuoteCancel m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_QuoteCancel(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_QuoteCancel(ofixErr err, fix42QuoteCancel m) {
+    ofixMsg	msg = ofix_msg_create(err, "Z", 4, 2, 36);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_QuoteCancelType)) {
+	ofix_typed_set_int(err, msg, 298, m->QuoteCancelType);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_QuoteResponseLevel)) {
+	ofix_typed_set_int(err, msg, 301, m->QuoteResponseLevel);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_NoQuoteEntries)) {
+	ofix_typed_set_int(err, msg, 295, m->NoQuoteEntries);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteCancel_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// QuoteStatusRequest [a]
+
+void
+fix42_decode_QuoteStatusRequest(ofixErr err, fix42QuoteStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42QuoteStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_OnBehalfOfSendingTime);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_QuoteID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_EncodedSecurityDesc);
+	    break;
+	case 54: // Side
+	    m->Side = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_Side);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_TradingSessionID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_QuoteStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_QuoteStatusRequest_msg(ofixErr err, fix42QuoteStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_QuoteStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_QuoteStatusRequest(ofixErr err, fix42QuoteStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "a", 4, 2, 52);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_Side)) {
+	ofix_typed_set_char(err, msg, 54, m->Side);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// QuoteAcknowledgement [b]
+
+static const int	QuoteAcknowledgementGroup296[] = { 302, 311, 312, 309, 305, 310, 313, 314, 315, 316, 317, 436, 435, 308, 306, 362, 363, 307, 364, 365, 304, 295, 0 };
+static const int	QuoteAcknowledgementGroup295[] = { 299, 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 368, 0 };
+
+static const struct _ofixTypedGroup	QuoteAcknowledgementGroups[] = {
+    { 296, -1, QuoteAcknowledgementGroup296 }, // NoQuoteSets
+    { 295, 0, QuoteAcknowledgementGroup295 }, // NoQuoteEntries
+};
+
+void
+fix42_decode_QuoteAcknowledgement(ofixErr err, fix42QuoteAcknowledgement m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42QuoteAcknowledgement));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, QuoteAcknowledgementGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_QuoteReqID);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_QuoteID);
+	    break;
+	case 297: // QuoteAckStatus
+	    m->QuoteAckStatus = ofix_typed_int(err, &scan, 297);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_QuoteAckStatus);
+	    break;
+	case 300: // QuoteRejectReason
+	    m->QuoteRejectReason = ofix_typed_int(err, &scan, 300);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_QuoteRejectReason);
+	    break;
+	case 301: // QuoteResponseLevel
+	    m->QuoteResponseLevel = ofix_typed_int(err, &scan, 301);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_QuoteResponseLevel);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_TradingSessionID);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_Text);
+	    break;
+	case 296: // NoQuoteSets
+	    m->NoQuoteSets = ofix_typed_int(err, &scan, 296);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_NoQuoteSets);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_QuoteAcknowledgement_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_QuoteAcknowledgement_msg(ofixErr err, fix42QuoteAcknowledgement m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_QuoteAcknowledgement(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_QuoteAcknowledgement(ofixErr err, fix42QuoteAcknowledgement m) {
+    ofixMsg	msg = ofix_msg_create(err, "b", 4, 2, 38);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_QuoteAckStatus)) {
+	ofix_typed_set_int(err, msg, 297, m->QuoteAckStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_QuoteRejectReason)) {
+	ofix_typed_set_int(err, msg, 300, m->QuoteRejectReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_QuoteResponseLevel)) {
+	ofix_typed_set_int(err, msg, 301, m->QuoteResponseLevel);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_NoQuoteSets)) {
+	ofix_typed_set_int(err, msg, 296, m->NoQuoteSets);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_QuoteAcknowledgement_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SecurityDefinitionRequest [c]
+
+static const int	SecurityDefinitionRequestGroup146[] = { 311, 312, 309, 305, 310, 313, 314, 315, 316, 317, 436, 435, 308, 306, 362, 363, 307, 364, 365, 319, 54, 318, 0 };
+
+static const struct _ofixTypedGroup	SecurityDefinitionRequestGroups[] = {
+    { 146, -1, SecurityDefinitionRequestGroup146 }, // NoRelatedSym
+};
+
+void
+fix42_decode_SecurityDefinitionRequest(ofixErr err, fix42SecurityDefinitionRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42SecurityDefinitionRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, SecurityDefinitionRequestGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfSendingTime);
+	    break;
+	case 320: // SecurityReqID
+	    ofix_typed_view(&scan, &m->SecurityReqID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecurityReqID);
+	    break;
+	case 321: // SecurityRequestType
+	    m->SecurityRequestType = ofix_typed_int(err, &scan, 321);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecurityRequestType);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_EncodedSecurityDesc);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_Currency);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_EncodedText);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_TradingSessionID);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_NoRelatedSym);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinitionRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_SecurityDefinitionRequest_msg(ofixErr err, fix42SecurityDefinitionRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_SecurityDefinitionRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_SecurityDefinitionRequest(ofixErr err, fix42SecurityDefinitionRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "c", 4, 2, 57);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecurityReqID)) {
+	ofix_typed_set_view(err, msg, 320, &m->SecurityReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecurityRequestType)) {
+	ofix_typed_set_int(err, msg, 321, m->SecurityRequestType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinitionRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SecurityDefinition [d]
+
+static const int	SecurityDefinitionGroup146[] = { 311, 312, 309, 305, 310, 313, 314, 315, 316, 317, 436, 435, 308, 306, 362, 363, 307, 364, 365, 319, 54, 318, 0 };
+
+static const struct _ofixTypedGroup	SecurityDefinitionGroups[] = {
+    { 146, -1, SecurityDefinitionGroup146 }, // NoRelatedSym
+};
+
+void
+fix42_decode_SecurityDefinition(ofixErr err, fix42SecurityDefinition m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42SecurityDefinition));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, SecurityDefinitionGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_OnBehalfOfSendingTime);
+	    break;
+	case 320: // SecurityReqID
+	    ofix_typed_view(&scan, &m->SecurityReqID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecurityReqID);
+	    break;
+	case 322: // SecurityResponseID
+	    ofix_typed_view(&scan, &m->SecurityResponseID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecurityResponseID);
+	    break;
+	case 323: // SecurityResponseType
+	    m->SecurityResponseType = ofix_typed_int(err, &scan, 323);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecurityResponseType);
+	    break;
+	case 393: // TotalNumSecurities
+	    m->TotalNumSecurities = ofix_typed_int(err, &scan, 393);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_TotalNumSecurities);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_EncodedSecurityDesc);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_Currency);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_TradingSessionID);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_EncodedText);
+	    break;
+	case 146: // NoRelatedSym
+	    m->NoRelatedSym = ofix_typed_int(err, &scan, 146);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_NoRelatedSym);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_SecurityDefinition_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_SecurityDefinition_msg(ofixErr err, fix42SecurityDefinition m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_SecurityDefinition(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_SecurityDefinition(ofixErr err, fix42SecurityDefinition m) {
+    ofixMsg	msg = ofix_msg_create(err, "d", 4, 2, 59);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecurityReqID)) {
+	ofix_typed_set_view(err, msg, 320, &m->SecurityReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecurityResponseID)) {
+	ofix_typed_set_view(err, msg, 322, &m->SecurityResponseID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecurityResponseType)) {
+	ofix_typed_set_int(err, msg, 323, m->SecurityResponseType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_TotalNumSecurities)) {
+	ofix_typed_set_int(err, msg, 393, m->TotalNumSecurities);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_NoRelatedSym)) {
+	ofix_typed_set_int(err, msg, 146, m->NoRelatedSym);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityDefinition_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SecurityStatusRequest [e]
+
+void
+fix42_decode_SecurityStatusRequest(ofixErr err, fix42SecurityStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42SecurityStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_OnBehalfOfSendingTime);
+	    break;
+	case 324: // SecurityStatusReqID
+	    ofix_typed_view(&scan, &m->SecurityStatusReqID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SecurityStatusReqID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_EncodedSecurityDesc);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_Currency);
+	    break;
+	case 263: // SubscriptionRequestType
+	    m->SubscriptionRequestType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SubscriptionRequestType);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_TradingSessionID);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_SecurityStatusRequest_msg(ofixErr err, fix42SecurityStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_SecurityStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_SecurityStatusRequest(ofixErr err, fix42SecurityStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "e", 4, 2, 53);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SecurityStatusReqID)) {
+	ofix_typed_set_view(err, msg, 324, &m->SecurityStatusReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SubscriptionRequestType)) {
+	ofix_typed_set_char(err, msg, 263, m->SubscriptionRequestType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// SecurityStatus [f]
+
+void
+fix42_decode_SecurityStatus(ofixErr err, fix42SecurityStatus m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42SecurityStatus));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_OnBehalfOfSendingTime);
+	    break;
+	case 324: // SecurityStatusReqID
+	    ofix_typed_view(&scan, &m->SecurityStatusReqID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecurityStatusReqID);
+	    break;
+	case 55: // Symbol
+	    ofix_typed_view(&scan, &m->Symbol);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_Symbol);
+	    break;
+	case 65: // SymbolSfx
+	    ofix_typed_view(&scan, &m->SymbolSfx);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SymbolSfx);
+	    break;
+	case 48: // SecurityID
+	    ofix_typed_view(&scan, &m->SecurityID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecurityID);
+	    break;
+	case 22: // IDSource
+	    ofix_typed_view(&scan, &m->IDSource);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_IDSource);
+	    break;
+	case 167: // SecurityType
+	    ofix_typed_view(&scan, &m->SecurityType);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecurityType);
+	    break;
+	case 200: // MaturityMonthYear
+	    ofix_typed_view(&scan, &m->MaturityMonthYear);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_MaturityMonthYear);
+	    break;
+	case 205: // MaturityDay
+	    m->MaturityDay = ofix_typed_int(err, &scan, 205);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_MaturityDay);
+	    break;
+	case 201: // PutOrCall
+	    m->PutOrCall = ofix_typed_int(err, &scan, 201);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_PutOrCall);
+	    break;
+	case 202: // StrikePrice
+	    ofix_typed_decimal(err, &scan, 202, &m->StrikePrice);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_StrikePrice);
+	    break;
+	case 206: // OptAttribute
+	    m->OptAttribute = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_OptAttribute);
+	    break;
+	case 231: // ContractMultiplier
+	    ofix_typed_decimal(err, &scan, 231, &m->ContractMultiplier);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_ContractMultiplier);
+	    break;
+	case 223: // CouponRate
+	    ofix_typed_decimal(err, &scan, 223, &m->CouponRate);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_CouponRate);
+	    break;
+	case 207: // SecurityExchange
+	    ofix_typed_view(&scan, &m->SecurityExchange);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecurityExchange);
+	    break;
+	case 106: // Issuer
+	    ofix_typed_view(&scan, &m->Issuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_Issuer);
+	    break;
+	case 348: // EncodedIssuerLen
+	    m->EncodedIssuerLen = ofix_typed_int(err, &scan, 348);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_EncodedIssuerLen);
+	    break;
+	case 349: // EncodedIssuer
+	    ofix_typed_view(&scan, &m->EncodedIssuer);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_EncodedIssuer);
+	    break;
+	case 107: // SecurityDesc
+	    ofix_typed_view(&scan, &m->SecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecurityDesc);
+	    break;
+	case 350: // EncodedSecurityDescLen
+	    m->EncodedSecurityDescLen = ofix_typed_int(err, &scan, 350);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_EncodedSecurityDescLen);
+	    break;
+	case 351: // EncodedSecurityDesc
+	    ofix_typed_view(&scan, &m->EncodedSecurityDesc);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_EncodedSecurityDesc);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_Currency);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_TradingSessionID);
+	    break;
+	case 325: // UnsolicitedIndicator
+	    m->UnsolicitedIndicator = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_UnsolicitedIndicator);
+	    break;
+	case 326: // SecurityTradingStatus
+	    m->SecurityTradingStatus = ofix_typed_int(err, &scan, 326);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SecurityTradingStatus);
+	    break;
+	case 291: // FinancialStatus
+	    m->FinancialStatus = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_FinancialStatus);
+	    break;
+	case 292: // CorporateAction
+	    m->CorporateAction = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_CorporateAction);
+	    break;
+	case 327: // HaltReason
+	    m->HaltReason = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_HaltReason);
+	    break;
+	case 328: // InViewOfCommon
+	    m->InViewOfCommon = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_InViewOfCommon);
+	    break;
+	case 329: // DueToRelated
+	    m->DueToRelated = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_DueToRelated);
+	    break;
+	case 330: // BuyVolume
+	    ofix_typed_decimal(err, &scan, 330, &m->BuyVolume);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_BuyVolume);
+	    break;
+	case 331: // SellVolume
+	    ofix_typed_decimal(err, &scan, 331, &m->SellVolume);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SellVolume);
+	    break;
+	case 332: // HighPx
+	    ofix_typed_decimal(err, &scan, 332, &m->HighPx);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_HighPx);
+	    break;
+	case 333: // LowPx
+	    ofix_typed_decimal(err, &scan, 333, &m->LowPx);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_LowPx);
+	    break;
+	case 31: // LastPx
+	    ofix_typed_decimal(err, &scan, 31, &m->LastPx);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_LastPx);
+	    break;
+	case 60: // TransactTime
+	    ofix_typed_date(err, &scan, 60, OFIX_TIMESTAMP, &m->TransactTime);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_TransactTime);
+	    break;
+	case 334: // Adjustment
+	    m->Adjustment = ofix_typed_int(err, &scan, 334);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_Adjustment);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_SecurityStatus_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_SecurityStatus_msg(ofixErr err, fix42SecurityStatus m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_SecurityStatus(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_SecurityStatus(ofixErr err, fix42SecurityStatus m) {
+    ofixMsg	msg = ofix_msg_create(err, "f", 4, 2, 66);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecurityStatusReqID)) {
+	ofix_typed_set_view(err, msg, 324, &m->SecurityStatusReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_Symbol)) {
+	ofix_typed_set_view(err, msg, 55, &m->Symbol);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SymbolSfx)) {
+	ofix_typed_set_view(err, msg, 65, &m->SymbolSfx);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecurityID)) {
+	ofix_typed_set_view(err, msg, 48, &m->SecurityID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_IDSource)) {
+	ofix_typed_set_view(err, msg, 22, &m->IDSource);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecurityType)) {
+	ofix_typed_set_view(err, msg, 167, &m->SecurityType);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_MaturityMonthYear)) {
+	ofix_typed_set_view(err, msg, 200, &m->MaturityMonthYear);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_MaturityDay)) {
+	ofix_typed_set_int(err, msg, 205, m->MaturityDay);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_PutOrCall)) {
+	ofix_typed_set_int(err, msg, 201, m->PutOrCall);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_StrikePrice)) {
+	ofix_typed_set_decimal(err, msg, 202, &m->StrikePrice);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_OptAttribute)) {
+	ofix_typed_set_char(err, msg, 206, m->OptAttribute);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_ContractMultiplier)) {
+	ofix_typed_set_decimal(err, msg, 231, &m->ContractMultiplier);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_CouponRate)) {
+	ofix_typed_set_decimal(err, msg, 223, &m->CouponRate);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecurityExchange)) {
+	ofix_typed_set_view(err, msg, 207, &m->SecurityExchange);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_Issuer)) {
+	ofix_typed_set_view(err, msg, 106, &m->Issuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_EncodedIssuerLen)) {
+	ofix_typed_set_int(err, msg, 348, m->EncodedIssuerLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_EncodedIssuer)) {
+	ofix_typed_set_view(err, msg, 349, &m->EncodedIssuer);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecurityDesc)) {
+	ofix_typed_set_view(err, msg, 107, &m->SecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_EncodedSecurityDescLen)) {
+	ofix_typed_set_int(err, msg, 350, m->EncodedSecurityDescLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_EncodedSecurityDesc)) {
+	ofix_typed_set_view(err, msg, 351, &m->EncodedSecurityDesc);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_UnsolicitedIndicator)) {
+	ofix_typed_set_char(err, msg, 325, m->UnsolicitedIndicator);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SecurityTradingStatus)) {
+	ofix_typed_set_int(err, msg, 326, m->SecurityTradingStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_FinancialStatus)) {
+	ofix_typed_set_char(err, msg, 291, m->FinancialStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_CorporateAction)) {
+	ofix_typed_set_char(err, msg, 292, m->CorporateAction);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_HaltReason)) {
+	ofix_typed_set_char(err, msg, 327, m->HaltReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_InViewOfCommon)) {
+	ofix_typed_set_char(err, msg, 328, m->InViewOfCommon);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_DueToRelated)) {
+	ofix_typed_set_char(err, msg, 329, m->DueToRelated);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_BuyVolume)) {
+	ofix_typed_set_decimal(err, msg, 330, &m->BuyVolume);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SellVolume)) {
+	ofix_typed_set_decimal(err, msg, 331, &m->SellVolume);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_HighPx)) {
+	ofix_typed_set_decimal(err, msg, 332, &m->HighPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_LowPx)) {
+	ofix_typed_set_decimal(err, msg, 333, &m->LowPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_LastPx)) {
+	ofix_typed_set_decimal(err, msg, 31, &m->LastPx);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_TransactTime)) {
+	ofix_msg_set_date(err, msg, 60, &m->TransactTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_Adjustment)) {
+	ofix_typed_set_int(err, msg, 334, m->Adjustment);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_SecurityStatus_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// TradingSessionStatusRequest [g]
+
+void
+fix42_decode_TradingSessionStatusRequest(ofixErr err, fix42TradingSessionStatusRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42TradingSessionStatusRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfSendingTime);
+	    break;
+	case 335: // TradSesReqID
+	    ofix_typed_view(&scan, &m->TradSesReqID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_TradSesReqID);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_TradingSessionID);
+	    break;
+	case 338: // TradSesMethod
+	    m->TradSesMethod = ofix_typed_int(err, &scan, 338);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_TradSesMethod);
+	    break;
+	case 339: // TradSesMode
+	    m->TradSesMode = ofix_typed_int(err, &scan, 339);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_TradSesMode);
+	    break;
+	case 263: // SubscriptionRequestType
+	    m->SubscriptionRequestType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SubscriptionRequestType);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatusRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_TradingSessionStatusRequest_msg(ofixErr err, fix42TradingSessionStatusRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_TradingSessionStatusRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_TradingSessionStatusRequest(ofixErr err, fix42TradingSessionStatusRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "g", 4, 2, 35);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_TradSesReqID)) {
+	ofix_typed_set_view(err, msg, 335, &m->TradSesReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_TradSesMethod)) {
+	ofix_typed_set_int(err, msg, 338, m->TradSesMethod);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_TradSesMode)) {
+	ofix_typed_set_int(err, msg, 339, m->TradSesMode);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SubscriptionRequestType)) {
+	ofix_typed_set_char(err, msg, 263, m->SubscriptionRequestType);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatusRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// TradingSessionStatus [h]
+
+void
+fix42_decode_TradingSessionStatus(ofixErr err, fix42TradingSessionStatus m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42TradingSessionStatus));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_OnBehalfOfSendingTime);
+	    break;
+	case 335: // TradSesReqID
+	    ofix_typed_view(&scan, &m->TradSesReqID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesReqID);
+	    break;
+	case 336: // TradingSessionID
+	    ofix_typed_view(&scan, &m->TradingSessionID);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradingSessionID);
+	    break;
+	case 338: // TradSesMethod
+	    m->TradSesMethod = ofix_typed_int(err, &scan, 338);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesMethod);
+	    break;
+	case 339: // TradSesMode
+	    m->TradSesMode = ofix_typed_int(err, &scan, 339);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesMode);
+	    break;
+	case 325: // UnsolicitedIndicator
+	    m->UnsolicitedIndicator = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_UnsolicitedIndicator);
+	    break;
+	case 340: // TradSesStatus
+	    m->TradSesStatus = ofix_typed_int(err, &scan, 340);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesStatus);
+	    break;
+	case 341: // TradSesStartTime
+	    ofix_typed_date(err, &scan, 341, OFIX_TIMESTAMP, &m->TradSesStartTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesStartTime);
+	    break;
+	case 342: // TradSesOpenTime
+	    ofix_typed_date(err, &scan, 342, OFIX_TIMESTAMP, &m->TradSesOpenTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesOpenTime);
+	    break;
+	case 343: // TradSesPreCloseTime
+	    ofix_typed_date(err, &scan, 343, OFIX_TIMESTAMP, &m->TradSesPreCloseTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesPreCloseTime);
+	    break;
+	case 344: // TradSesCloseTime
+	    ofix_typed_date(err, &scan, 344, OFIX_TIMESTAMP, &m->TradSesCloseTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesCloseTime);
+	    break;
+	case 345: // TradSesEndTime
+	    ofix_typed_date(err, &scan, 345, OFIX_TIMESTAMP, &m->TradSesEndTime);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TradSesEndTime);
+	    break;
+	case 387: // TotalVolumeTraded
+	    ofix_typed_decimal(err, &scan, 387, &m->TotalVolumeTraded);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_TotalVolumeTraded);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_TradingSessionStatus_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_TradingSessionStatus_msg(ofixErr err, fix42TradingSessionStatus m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_TradingSessionStatus(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_TradingSessionStatus(ofixErr err, fix42TradingSessionStatus m) {
+    ofixMsg	msg = ofix_msg_create(err, "h", 4, 2, 45);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesReqID)) {
+	ofix_typed_set_view(err, msg, 335, &m->TradSesReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradingSessionID)) {
+	ofix_typed_set_view(err, msg, 336, &m->TradingSessionID);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesMethod)) {
+	ofix_typed_set_int(err, msg, 338, m->TradSesMethod);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesMode)) {
+	ofix_typed_set_int(err, msg, 339, m->TradSesMode);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_UnsolicitedIndicator)) {
+	ofix_typed_set_char(err, msg, 325, m->UnsolicitedIndicator);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesStatus)) {
+	ofix_typed_set_int(err, msg, 340, m->TradSesStatus);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesStartTime)) {
+	ofix_msg_set_date(err, msg, 341, &m->TradSesStartTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesOpenTime)) {
+	ofix_msg_set_date(err, msg, 342, &m->TradSesOpenTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesPreCloseTime)) {
+	ofix_msg_set_date(err, msg, 343, &m->TradSesPreCloseTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesCloseTime)) {
+	ofix_msg_set_date(err, msg, 344, &m->TradSesCloseTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TradSesEndTime)) {
+	ofix_msg_set_date(err, msg, 345, &m->TradSesEndTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_TotalVolumeTraded)) {
+	ofix_typed_set_decimal(err, msg, 387, &m->TotalVolumeTraded);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_TradingSessionStatus_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// MassQuote [i]
+
+static const int	MassQuoteGroup296[] = { 302, 311, 312, 309, 305, 310, 313, 314, 315, 316, 317, 436, 435, 308, 306, 362, 363, 307, 364, 365, 367, 304, 295, 0 };
+static const int	MassQuoteGroup295[] = { 299, 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 132, 133, 134, 135, 62, 188, 190, 189, 191, 60, 336, 64, 40, 193, 192, 15, 0 };
+
+static const struct _ofixTypedGroup	MassQuoteGroups[] = {
+    { 296, -1, MassQuoteGroup296 }, // NoQuoteSets
+    { 295, 0, MassQuoteGroup295 }, // NoQuoteEntries
+};
+
+void
+fix42_decode_MassQuote(ofixErr err, fix42MassQuote m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42MassQuote));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, MassQuoteGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_OnBehalfOfSendingTime);
+	    break;
+	case 131: // QuoteReqID
+	    ofix_typed_view(&scan, &m->QuoteReqID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_QuoteReqID);
+	    break;
+	case 117: // QuoteID
+	    ofix_typed_view(&scan, &m->QuoteID);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_QuoteID);
+	    break;
+	case 301: // QuoteResponseLevel
+	    m->QuoteResponseLevel = ofix_typed_int(err, &scan, 301);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_QuoteResponseLevel);
+	    break;
+	case 293: // DefBidSize
+	    ofix_typed_decimal(err, &scan, 293, &m->DefBidSize);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_DefBidSize);
+	    break;
+	case 294: // DefOfferSize
+	    ofix_typed_decimal(err, &scan, 294, &m->DefOfferSize);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_DefOfferSize);
+	    break;
+	case 296: // NoQuoteSets
+	    m->NoQuoteSets = ofix_typed_int(err, &scan, 296);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_NoQuoteSets);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_MassQuote_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_MassQuote_msg(ofixErr err, fix42MassQuote m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_MassQuote(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_MassQuote(ofixErr err, fix42MassQuote m) {
+    ofixMsg	msg = ofix_msg_create(err, "i", 4, 2, 36);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_MassQuote_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_QuoteReqID)) {
+	ofix_typed_set_view(err, msg, 131, &m->QuoteReqID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_QuoteID)) {
+	ofix_typed_set_view(err, msg, 117, &m->QuoteID);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_QuoteResponseLevel)) {
+	ofix_typed_set_int(err, msg, 301, m->QuoteResponseLevel);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_DefBidSize)) {
+	ofix_typed_set_decimal(err, msg, 293, &m->DefBidSize);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_DefOfferSize)) {
+	ofix_typed_set_decimal(err, msg, 294, &m->DefOfferSize);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_NoQuoteSets)) {
+	ofix_typed_set_int(err, msg, 296, m->NoQuoteSets);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_MassQuote_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// BusinessMessageReject [j]
+
+void
+fix42_decode_BusinessMessageReject(ofixErr err, fix42BusinessMessageReject m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42BusinessMessageReject));
+    ofix_typed_scan_init(&scan, raw, len);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_OnBehalfOfSendingTime);
+	    break;
+	case 45: // RefSeqNum
+	    m->RefSeqNum = ofix_typed_int(err, &scan, 45);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_RefSeqNum);
+	    break;
+	case 372: // RefMsgType
+	    ofix_typed_view(&scan, &m->RefMsgType);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_RefMsgType);
+	    break;
+	case 379: // BusinessRejectRefID
+	    ofix_typed_view(&scan, &m->BusinessRejectRefID);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_BusinessRejectRefID);
+	    break;
+	case 380: // BusinessRejectReason
+	    m->BusinessRejectReason = ofix_typed_int(err, &scan, 380);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_BusinessRejectReason);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_BusinessMessageReject_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_BusinessMessageReject_msg(ofixErr err, fix42BusinessMessageReject m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_BusinessMessageReject(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_BusinessMessageReject(ofixErr err, fix42BusinessMessageReject m) {
+    ofixMsg	msg = ofix_msg_create(err, "j", 4, 2, 37);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_RefSeqNum)) {
+	ofix_typed_set_int(err, msg, 45, m->RefSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_RefMsgType)) {
+	ofix_typed_set_view(err, msg, 372, &m->RefMsgType);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_BusinessRejectRefID)) {
+	ofix_typed_set_view(err, msg, 379, &m->BusinessRejectRefID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_BusinessRejectReason)) {
+	ofix_typed_set_int(err, msg, 380, m->BusinessRejectReason);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_BusinessMessageReject_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// BidRequest [k]
+
+static const int	BidRequestGroup398[] = { 399, 400, 401, 404, 441, 402, 403, 405, 406, 407, 408, 0 };
+static const int	BidRequestGroup420[] = { 66, 54, 336, 430, 63, 64, 1, 0 };
+
+static const struct _ofixTypedGroup	BidRequestGroups[] = {
+    { 398, -1, BidRequestGroup398 }, // NoBidDescriptors
+    { 420, -1, BidRequestGroup420 }, // NoBidComponents
+};
+
+void
+fix42_decode_BidRequest(ofixErr err, fix42BidRequest m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42BidRequest));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, BidRequestGroups, 2);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_OnBehalfOfSendingTime);
+	    break;
+	case 390: // BidID
+	    ofix_typed_view(&scan, &m->BidID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_BidID);
+	    break;
+	case 391: // ClientBidID
+	    ofix_typed_view(&scan, &m->ClientBidID);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_ClientBidID);
+	    break;
+	case 374: // BidRequestTransType
+	    m->BidRequestTransType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_BidRequestTransType);
+	    break;
+	case 392: // ListName
+	    ofix_typed_view(&scan, &m->ListName);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_ListName);
+	    break;
+	case 393: // TotalNumSecurities
+	    m->TotalNumSecurities = ofix_typed_int(err, &scan, 393);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_TotalNumSecurities);
+	    break;
+	case 394: // BidType
+	    m->BidType = ofix_typed_int(err, &scan, 394);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_BidType);
+	    break;
+	case 395: // NumTickets
+	    m->NumTickets = ofix_typed_int(err, &scan, 395);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_NumTickets);
+	    break;
+	case 15: // Currency
+	    ofix_typed_view(&scan, &m->Currency);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_Currency);
+	    break;
+	case 396: // SideValue1
+	    ofix_typed_decimal(err, &scan, 396, &m->SideValue1);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SideValue1);
+	    break;
+	case 397: // SideValue2
+	    ofix_typed_decimal(err, &scan, 397, &m->SideValue2);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SideValue2);
+	    break;
+	case 398: // NoBidDescriptors
+	    m->NoBidDescriptors = ofix_typed_int(err, &scan, 398);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_NoBidDescriptors);
+	    break;
+	case 420: // NoBidComponents
+	    m->NoBidComponents = ofix_typed_int(err, &scan, 420);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_NoBidComponents);
+	    break;
+	case 409: // LiquidityIndType
+	    m->LiquidityIndType = ofix_typed_int(err, &scan, 409);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_LiquidityIndType);
+	    break;
+	case 410: // WtAverageLiquidity
+	    ofix_typed_decimal(err, &scan, 410, &m->WtAverageLiquidity);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_WtAverageLiquidity);
+	    break;
+	case 411: // ExchangeForPhysical
+	    m->ExchangeForPhysical = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_ExchangeForPhysical);
+	    break;
+	case 412: // OutMainCntryUIndex
+	    ofix_typed_decimal(err, &scan, 412, &m->OutMainCntryUIndex);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_OutMainCntryUIndex);
+	    break;
+	case 413: // CrossPercent
+	    ofix_typed_decimal(err, &scan, 413, &m->CrossPercent);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_CrossPercent);
+	    break;
+	case 414: // ProgRptReqs
+	    m->ProgRptReqs = ofix_typed_int(err, &scan, 414);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_ProgRptReqs);
+	    break;
+	case 415: // ProgPeriodInterval
+	    m->ProgPeriodInterval = ofix_typed_int(err, &scan, 415);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_ProgPeriodInterval);
+	    break;
+	case 416: // IncTaxInd
+	    m->IncTaxInd = ofix_typed_int(err, &scan, 416);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_IncTaxInd);
+	    break;
+	case 121: // ForexReq
+	    m->ForexReq = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_ForexReq);
+	    break;
+	case 417: // NumBidders
+	    m->NumBidders = ofix_typed_int(err, &scan, 417);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_NumBidders);
+	    break;
+	case 75: // TradeDate
+	    ofix_typed_view(&scan, &m->TradeDate);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_TradeDate);
+	    break;
+	case 418: // TradeType
+	    m->TradeType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_TradeType);
+	    break;
+	case 419: // BasisPxType
+	    m->BasisPxType = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_BasisPxType);
+	    break;
+	case 443: // StrikeTime
+	    ofix_typed_date(err, &scan, 443, OFIX_TIMESTAMP, &m->StrikeTime);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_StrikeTime);
+	    break;
+	case 58: // Text
+	    ofix_typed_view(&scan, &m->Text);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_Text);
+	    break;
+	case 354: // EncodedTextLen
+	    m->EncodedTextLen = ofix_typed_int(err, &scan, 354);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_EncodedTextLen);
+	    break;
+	case 355: // EncodedText
+	    ofix_typed_view(&scan, &m->EncodedText);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_EncodedText);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_BidRequest_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_BidRequest_msg(ofixErr err, fix42BidRequest m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_BidRequest(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_BidRequest(ofixErr err, fix42BidRequest m) {
+    ofixMsg	msg = ofix_msg_create(err, "k", 4, 2, 59);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_BidID)) {
+	ofix_typed_set_view(err, msg, 390, &m->BidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_ClientBidID)) {
+	ofix_typed_set_view(err, msg, 391, &m->ClientBidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_BidRequestTransType)) {
+	ofix_typed_set_char(err, msg, 374, m->BidRequestTransType);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_ListName)) {
+	ofix_typed_set_view(err, msg, 392, &m->ListName);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_TotalNumSecurities)) {
+	ofix_typed_set_int(err, msg, 393, m->TotalNumSecurities);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_BidType)) {
+	ofix_typed_set_int(err, msg, 394, m->BidType);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_NumTickets)) {
+	ofix_typed_set_int(err, msg, 395, m->NumTickets);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_Currency)) {
+	ofix_typed_set_view(err, msg, 15, &m->Currency);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SideValue1)) {
+	ofix_typed_set_decimal(err, msg, 396, &m->SideValue1);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SideValue2)) {
+	ofix_typed_set_decimal(err, msg, 397, &m->SideValue2);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_NoBidDescriptors)) {
+	ofix_typed_set_int(err, msg, 398, m->NoBidDescriptors);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_NoBidComponents)) {
+	ofix_typed_set_int(err, msg, 420, m->NoBidComponents);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_LiquidityIndType)) {
+	ofix_typed_set_int(err, msg, 409, m->LiquidityIndType);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_WtAverageLiquidity)) {
+	ofix_typed_set_decimal(err, msg, 410, &m->WtAverageLiquidity);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_ExchangeForPhysical)) {
+	ofix_typed_set_char(err, msg, 411, m->ExchangeForPhysical);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_OutMainCntryUIndex)) {
+	ofix_typed_set_decimal(err, msg, 412, &m->OutMainCntryUIndex);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_CrossPercent)) {
+	ofix_typed_set_decimal(err, msg, 413, &m->CrossPercent);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_ProgRptReqs)) {
+	ofix_typed_set_int(err, msg, 414, m->ProgRptReqs);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_ProgPeriodInterval)) {
+	ofix_typed_set_int(err, msg, 415, m->ProgPeriodInterval);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_IncTaxInd)) {
+	ofix_typed_set_int(err, msg, 416, m->IncTaxInd);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_ForexReq)) {
+	ofix_typed_set_char(err, msg, 121, m->ForexReq);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_NumBidders)) {
+	ofix_typed_set_int(err, msg, 417, m->NumBidders);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_TradeDate)) {
+	ofix_typed_set_view(err, msg, 75, &m->TradeDate);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_TradeType)) {
+	ofix_typed_set_char(err, msg, 418, m->TradeType);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_BasisPxType)) {
+	ofix_typed_set_char(err, msg, 419, m->BasisPxType);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_StrikeTime)) {
+	ofix_msg_set_date(err, msg, 443, &m->StrikeTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_Text)) {
+	ofix_typed_set_view(err, msg, 58, &m->Text);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_EncodedTextLen)) {
+	ofix_typed_set_int(err, msg, 354, m->EncodedTextLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_EncodedText)) {
+	ofix_typed_set_view(err, msg, 355, &m->EncodedText);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidRequest_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// BidResponse [l]
+
+static const int	BidResponseGroup420[] = { 12, 13, 66, 421, 54, 44, 423, 406, 430, 63, 64, 336, 58, 354, 355, 0 };
+
+static const struct _ofixTypedGroup	BidResponseGroups[] = {
+    { 420, -1, BidResponseGroup420 }, // NoBidComponents
+};
+
+void
+fix42_decode_BidResponse(ofixErr err, fix42BidResponse m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42BidResponse));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, BidResponseGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_OnBehalfOfSendingTime);
+	    break;
+	case 390: // BidID
+	    ofix_typed_view(&scan, &m->BidID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_BidID);
+	    break;
+	case 391: // ClientBidID
+	    ofix_typed_view(&scan, &m->ClientBidID);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_ClientBidID);
+	    break;
+	case 420: // NoBidComponents
+	    m->NoBidComponents = ofix_typed_int(err, &scan, 420);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_NoBidComponents);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_BidResponse_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_BidResponse_msg(ofixErr err, fix42BidResponse m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_BidResponse(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_BidResponse(ofixErr err, fix42BidResponse m) {
+    ofixMsg	msg = ofix_msg_create(err, "l", 4, 2, 33);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_BidResponse_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_BidID)) {
+	ofix_typed_set_view(err, msg, 390, &m->BidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_ClientBidID)) {
+	ofix_typed_set_view(err, msg, 391, &m->ClientBidID);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_NoBidComponents)) {
+	ofix_typed_set_int(err, msg, 420, m->NoBidComponents);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_BidResponse_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
+
+// ListStrikePrice [m]
+
+static const int	ListStrikePriceGroup428[] = { 55, 65, 48, 22, 167, 200, 205, 201, 202, 206, 231, 223, 207, 106, 348, 349, 107, 350, 351, 140, 11, 54, 44, 15, 58, 354, 355, 0 };
+
+static const struct _ofixTypedGroup	ListStrikePriceGroups[] = {
+    { 428, -1, ListStrikePriceGroup428 }, // NoStrikes
+};
+
+void
+fix42_decode_ListStrikePrice(ofixErr err, fix42ListStrikePrice m, const char *raw, int len) {
+    struct _ofixTypedScan	scan;
+    int				tag;
+
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    memset(m, 0, sizeof(struct _fix42ListStrikePrice));
+    ofix_typed_scan_init(&scan, raw, len);
+    ofix_typed_scan_groups(&scan, ListStrikePriceGroups, 1);
+    while (0 < (tag = ofix_typed_scan_next(err, &scan))) {
+	if (scan.in_group) {
+	    continue;
+	}
+	switch (tag) {
+	case 8: // BeginString
+	    ofix_typed_view(&scan, &m->BeginString);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_BeginString);
+	    break;
+	case 9: // BodyLength
+	    m->BodyLength = ofix_typed_int(err, &scan, 9);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_BodyLength);
+	    break;
+	case 35: // MsgType
+	    ofix_typed_view(&scan, &m->MsgType);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_MsgType);
+	    break;
+	case 49: // SenderCompID
+	    ofix_typed_view(&scan, &m->SenderCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_SenderCompID);
+	    break;
+	case 56: // TargetCompID
+	    ofix_typed_view(&scan, &m->TargetCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_TargetCompID);
+	    break;
+	case 115: // OnBehalfOfCompID
+	    ofix_typed_view(&scan, &m->OnBehalfOfCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_OnBehalfOfCompID);
+	    break;
+	case 128: // DeliverToCompID
+	    ofix_typed_view(&scan, &m->DeliverToCompID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_DeliverToCompID);
+	    break;
+	case 90: // SecureDataLen
+	    m->SecureDataLen = ofix_typed_int(err, &scan, 90);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_SecureDataLen);
+	    break;
+	case 91: // SecureData
+	    ofix_typed_view(&scan, &m->SecureData);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_SecureData);
+	    break;
+	case 34: // MsgSeqNum
+	    m->MsgSeqNum = ofix_typed_int(err, &scan, 34);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_MsgSeqNum);
+	    break;
+	case 50: // SenderSubID
+	    ofix_typed_view(&scan, &m->SenderSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_SenderSubID);
+	    break;
+	case 142: // SenderLocationID
+	    ofix_typed_view(&scan, &m->SenderLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_SenderLocationID);
+	    break;
+	case 57: // TargetSubID
+	    ofix_typed_view(&scan, &m->TargetSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_TargetSubID);
+	    break;
+	case 143: // TargetLocationID
+	    ofix_typed_view(&scan, &m->TargetLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_TargetLocationID);
+	    break;
+	case 116: // OnBehalfOfSubID
+	    ofix_typed_view(&scan, &m->OnBehalfOfSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_OnBehalfOfSubID);
+	    break;
+	case 144: // OnBehalfOfLocationID
+	    ofix_typed_view(&scan, &m->OnBehalfOfLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_OnBehalfOfLocationID);
+	    break;
+	case 129: // DeliverToSubID
+	    ofix_typed_view(&scan, &m->DeliverToSubID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_DeliverToSubID);
+	    break;
+	case 145: // DeliverToLocationID
+	    ofix_typed_view(&scan, &m->DeliverToLocationID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_DeliverToLocationID);
+	    break;
+	case 43: // PossDupFlag
+	    m->PossDupFlag = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_PossDupFlag);
+	    break;
+	case 97: // PossResend
+	    m->PossResend = ofix_typed_char(&scan);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_PossResend);
+	    break;
+	case 52: // SendingTime
+	    ofix_typed_date(err, &scan, 52, OFIX_TIMESTAMP, &m->SendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_SendingTime);
+	    break;
+	case 122: // OrigSendingTime
+	    ofix_typed_date(err, &scan, 122, OFIX_TIMESTAMP, &m->OrigSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_OrigSendingTime);
+	    break;
+	case 212: // XmlDataLen
+	    m->XmlDataLen = ofix_typed_int(err, &scan, 212);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_XmlDataLen);
+	    break;
+	case 213: // XmlData
+	    ofix_typed_view(&scan, &m->XmlData);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_XmlData);
+	    break;
+	case 347: // MessageEncoding
+	    ofix_typed_view(&scan, &m->MessageEncoding);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_MessageEncoding);
+	    break;
+	case 369: // LastMsgSeqNumProcessed
+	    m->LastMsgSeqNumProcessed = ofix_typed_int(err, &scan, 369);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_LastMsgSeqNumProcessed);
+	    break;
+	case 370: // OnBehalfOfSendingTime
+	    ofix_typed_date(err, &scan, 370, OFIX_TIMESTAMP, &m->OnBehalfOfSendingTime);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_OnBehalfOfSendingTime);
+	    break;
+	case 66: // ListID
+	    ofix_typed_view(&scan, &m->ListID);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_ListID);
+	    break;
+	case 422: // TotNoStrikes
+	    m->TotNoStrikes = ofix_typed_int(err, &scan, 422);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_TotNoStrikes);
+	    break;
+	case 428: // NoStrikes
+	    m->NoStrikes = ofix_typed_int(err, &scan, 428);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_NoStrikes);
+	    break;
+	case 93: // SignatureLength
+	    m->SignatureLength = ofix_typed_int(err, &scan, 93);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_SignatureLength);
+	    break;
+	case 89: // Signature
+	    ofix_typed_view(&scan, &m->Signature);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_Signature);
+	    break;
+	case 10: // CheckSum
+	    ofix_typed_view(&scan, &m->CheckSum);
+	    ofix_typed_mark(m->present, FIX42_ListStrikePrice_CheckSum);
+	    break;
+	default:
+	    break;
+	}
+    }
+}
+
+void
+fix42_decode_ListStrikePrice_msg(ofixErr err, fix42ListStrikePrice m, ofixMsg msg) {
+    int		len = ofix_msg_size(err, msg);
+    const char	*raw = ofix_msg_FIX_str(err, msg);
+
+    if (NULL == raw) {
+	return;
+    }
+    fix42_decode_ListStrikePrice(err, m, raw, len);
+}
+
+ofixMsg
+fix42_encode_ListStrikePrice(ofixErr err, fix42ListStrikePrice m) {
+    ofixMsg	msg = ofix_msg_create(err, "m", 4, 2, 33);
+
+    if (NULL == msg) {
+	return NULL;
+    }
+    ofix_msg_set_append_mode(msg, true);
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_SenderCompID)) {
+	ofix_typed_set_view(err, msg, 49, &m->SenderCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_TargetCompID)) {
+	ofix_typed_set_view(err, msg, 56, &m->TargetCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_OnBehalfOfCompID)) {
+	ofix_typed_set_view(err, msg, 115, &m->OnBehalfOfCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_DeliverToCompID)) {
+	ofix_typed_set_view(err, msg, 128, &m->DeliverToCompID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_SecureDataLen)) {
+	ofix_typed_set_int(err, msg, 90, m->SecureDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_SecureData)) {
+	ofix_typed_set_view(err, msg, 91, &m->SecureData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_MsgSeqNum)) {
+	ofix_typed_set_int(err, msg, 34, m->MsgSeqNum);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_SenderSubID)) {
+	ofix_typed_set_view(err, msg, 50, &m->SenderSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_SenderLocationID)) {
+	ofix_typed_set_view(err, msg, 142, &m->SenderLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_TargetSubID)) {
+	ofix_typed_set_view(err, msg, 57, &m->TargetSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_TargetLocationID)) {
+	ofix_typed_set_view(err, msg, 143, &m->TargetLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_OnBehalfOfSubID)) {
+	ofix_typed_set_view(err, msg, 116, &m->OnBehalfOfSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_OnBehalfOfLocationID)) {
+	ofix_typed_set_view(err, msg, 144, &m->OnBehalfOfLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_DeliverToSubID)) {
+	ofix_typed_set_view(err, msg, 129, &m->DeliverToSubID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_DeliverToLocationID)) {
+	ofix_typed_set_view(err, msg, 145, &m->DeliverToLocationID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_PossDupFlag)) {
+	ofix_typed_set_char(err, msg, 43, m->PossDupFlag);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_PossResend)) {
+	ofix_typed_set_char(err, msg, 97, m->PossResend);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_SendingTime)) {
+	ofix_msg_set_date(err, msg, 52, &m->SendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_OrigSendingTime)) {
+	ofix_msg_set_date(err, msg, 122, &m->OrigSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_XmlDataLen)) {
+	ofix_typed_set_int(err, msg, 212, m->XmlDataLen);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_XmlData)) {
+	ofix_typed_set_view(err, msg, 213, &m->XmlData);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_MessageEncoding)) {
+	ofix_typed_set_view(err, msg, 347, &m->MessageEncoding);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_LastMsgSeqNumProcessed)) {
+	ofix_typed_set_int(err, msg, 369, m->LastMsgSeqNumProcessed);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_OnBehalfOfSendingTime)) {
+	ofix_msg_set_date(err, msg, 370, &m->OnBehalfOfSendingTime);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_ListID)) {
+	ofix_typed_set_view(err, msg, 66, &m->ListID);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_TotNoStrikes)) {
+	ofix_typed_set_int(err, msg, 422, m->TotNoStrikes);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_NoStrikes)) {
+	ofix_typed_set_int(err, msg, 428, m->NoStrikes);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_SignatureLength)) {
+	ofix_typed_set_int(err, msg, 93, m->SignatureLength);
+    }
+    if (ofix_typed_has(m->present, FIX42_ListStrikePrice_Signature)) {
+	ofix_typed_set_view(err, msg, 89, &m->Signature);
+    }
+    ofix_msg_set_append_mode(msg, false);
+    if (NULL != err && OFIX_OK != err->code) {
+	ofix_msg_destroy(msg);
+	return NULL;
+    }
+    return msg;
+}
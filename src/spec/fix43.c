@@ -8,13 +8,146 @@
 
 extern struct _ofixVersionSpec	fix43Spec;
 
+// ----- Enums -----
+static struct _ofixEnumSpec	enum4 = { { 0x0000000000000000ULL, 0x0000000001180004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AdvSide
+static struct _ofixEnumSpec	enum5 = { { 0x0000000000000000ULL, 0x0000000000044008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AdvTransType
+static struct _ofixEnumSpec	enum13 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CommType
+static struct _ofixEnumSpec	enum18 = { { 0x03ff000000000000ULL, 0x0000000003fffffeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecInst
+static struct _ofixEnumSpec	enum20 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecTransType
+static struct _ofixEnumSpec	enum21 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // HandlInst
+static struct _ofixEnumSpec	enum22 = { { 0x03fe000000000000ULL, 0x00000000000000feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityIDSource
+static struct _ofixEnumSpec	enum25 = { { 0x0000000000000000ULL, 0x0000000000003100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IOIQltyInd
+static struct _ofixEnumSpec	enum28 = { { 0x0000000000000000ULL, 0x0000000000044008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IOITransType
+static struct _ofixEnumSpec	enum29 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // LastCapacity
+static const char	*enum35_values[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "A", "AA", "AB", "AC", "AD", "AE", "AF", "AG", "AH", "AI", "B", "C", "D", "E", "F", "G", "H", "J", "K", "L", "M", "N", "P", "Q", "R", "S", "T", "V", "W", "X", "Y", "Z", "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z" };
+static struct _ofixEnumSpec	enum35 = { { 0, 0, 0, 0 }, 68, enum35_values }; // MsgType
+static struct _ofixEnumSpec	enum39 = { { 0x03ff000000000000ULL, 0x000000000000003eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrdStatus
+static struct _ofixEnumSpec	enum40 = { { 0x03fe000000000000ULL, 0x0000000000013ffeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrdType
+static struct _ofixEnumSpec	enum47 = { { 0x0000000000000000ULL, 0x0000000007bdff7eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Rule80A
+static struct _ofixEnumSpec	enum54 = { { 0x03fe000000000000ULL, 0x000000000000000eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Side
+static struct _ofixEnumSpec	enum59 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TimeInForce
+static struct _ofixEnumSpec	enum61 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Urgency
+static struct _ofixEnumSpec	enum63 = { { 0x03ff000000000000ULL, 0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlmntTyp
+static struct _ofixEnumSpec	enum71 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocTransType
+static struct _ofixEnumSpec	enum81 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ProcessCode
+static struct _ofixEnumSpec	enum87 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocStatus
+static struct _ofixEnumSpec	enum88 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocRejCode
+static struct _ofixEnumSpec	enum94 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // EmailType
+static struct _ofixEnumSpec	enum98 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // EncryptMethod
+static struct _ofixEnumSpec	enum102 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CxlRejReason
+static const char	*enum103_values[] = { "0", "1", "10", "11", "12", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum103 = { { 0, 0, 0, 0 }, 13, enum103_values }; // OrdRejReason
+static struct _ofixEnumSpec	enum104 = { { 0x0000000000000000ULL, 0x0000000007dfb21eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IOIQualifier
+static struct _ofixEnumSpec	enum127 = { { 0x0000000000000000ULL, 0x000000000400003eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DKReason
+static struct _ofixEnumSpec	enum139 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MiscFeeType
+static struct _ofixEnumSpec	enum150 = { { 0x03ff000000000000ULL, 0x00000000000003feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecType
+static struct _ofixEnumSpec	enum160 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlInstMode
+static struct _ofixEnumSpec	enum163 = { { 0x0000000000000000ULL, 0x0000000000044008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlInstTransType
+static struct _ofixEnumSpec	enum165 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlInstSource
+static const char	*enum166_values[] = { "CED", "DTC", "EUR", "FED", "PED", "PTC" };
+static struct _ofixEnumSpec	enum166 = { { 0, 0, 0, 0 }, 6, enum166_values }; // SettlLocation
+static const char	*enum167_values[] = { "?", "ABS", "AMENDED", "AN", "BA", "BN", "BOX", "BRADY", "BRIDGE", "CB", "CD", "CL", "CMBS", "CMO", "COFO", "COFP", "CORP", "CP", "CPP", "CS", "DEFLTED", "DINP", "DP", "DUAL", "FOR", "GO", "IET", "LOFC", "LQN", "MATURED", "MBS", "MF", "MIO", "MLEG", "MPO", "MPP", "MPT", "MT", "MTN", "NONE", "ONITE", "PN", "POOL", "PS", "PZFJ", "RAN", "REPLACD", "RETIRED", "REV", "RP", "RVLV", "RVLVTRM", "RVRP", "SPCLA", "SPCLO", "SPCLT", "STN", "STRUCT", "SWING", "TAN", "TAXA", "TBOND", "TCAL", "TD", "TECP", "TERM", "TINT", "TIPS", "TPRN", "TRAN", "UST", "USTB", "VRDN", "WAR", "WITHDRN", "XCN", "XLINKD", "YANK" };
+static struct _ofixEnumSpec	enum167 = { { 0, 0, 0, 0 }, 78, enum167_values }; // SecurityType
+static struct _ofixEnumSpec	enum169 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // StandInstDbType
+static struct _ofixEnumSpec	enum197 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocLinkType
+static struct _ofixEnumSpec	enum201 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PutOrCall
+static struct _ofixEnumSpec	enum203 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CoveredOrUncovered
+static struct _ofixEnumSpec	enum204 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CustomerOrFirm
+static struct _ofixEnumSpec	enum209 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocHandlInst
+static struct _ofixEnumSpec	enum216 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // RoutingType
+static struct _ofixEnumSpec	enum219 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Benchmark
+static const char	*enum235_values[] = { "AFTERTAX", "ANNUAL", "ATISSUE", "AVGLIFE", "AVGMATURITY", "BOOK", "CALL", "CHANGE", "CLOSE", "COMPOUND", "CURRENT", "GOVTEQUIV", "GROSS", "INFLATION", "INVERSEFLOATER", "LASTCLOSE", "LASTMONTH", "LASTQUARTER", "LASTYEAR", "LONGAVGLIFE", "LONGEST", "MARK", "MATURITY", "NEXTREFUND", "OPENAVG", "PREVCLOSE", "PROCEEDS", "PUT", "SEMIANNUAL", "SHORTAVGLIFE", "SHORTEST", "SIMPLE", "TAXEQUIV", "TENDER", "TRUE", "WORST" };
+static struct _ofixEnumSpec	enum235 = { { 0, 0, 0, 0 }, 36, enum235_values }; // YieldType
+static struct _ofixEnumSpec	enum263 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SubscriptionRequestType
+static struct _ofixEnumSpec	enum265 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDUpdateType
+static struct _ofixEnumSpec	enum269 = { { 0x03ff000000000000ULL, 0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDEntryType
+static struct _ofixEnumSpec	enum274 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TickDirection
+static struct _ofixEnumSpec	enum276 = { { 0x0000000000000000ULL, 0x00000000000003feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteCondition
+static struct _ofixEnumSpec	enum277 = { { 0x0000000000000000ULL, 0x0000000000077ffeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeCondition
+static struct _ofixEnumSpec	enum279 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDUpdateAction
+static struct _ofixEnumSpec	enum281 = { { 0x03ff000000000000ULL, 0x000000000000000eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDReqRejReason
+static struct _ofixEnumSpec	enum285 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DeleteReason
+static struct _ofixEnumSpec	enum286 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OpenCloseSettleFlag
+static struct _ofixEnumSpec	enum291 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // FinancialStatus
+static struct _ofixEnumSpec	enum292 = { { 0x0000000000000000ULL, 0x000000000000003eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CorporateAction
+static const char	*enum297_values[] = { "0", "1", "10", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum297 = { { 0, 0, 0, 0 }, 11, enum297_values }; // QuoteStatus
+static struct _ofixEnumSpec	enum303 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteRequestType
+static struct _ofixEnumSpec	enum321 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityRequestType
+static struct _ofixEnumSpec	enum323 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityResponseType
+static const char	*enum326_values[] = { "1", "10", "11", "12", "13", "14", "15", "16", "17", "18", "19", "2", "20", "21", "22", "23", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum326 = { { 0, 0, 0, 0 }, 23, enum326_values }; // SecurityTradingStatus
+static struct _ofixEnumSpec	enum327 = { { 0x0000000000000000ULL, 0x0000000001012230ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // HaltReason
+static struct _ofixEnumSpec	enum334 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Adjustment
+static struct _ofixEnumSpec	enum338 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesMethod
+static struct _ofixEnumSpec	enum339 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesMode
+static struct _ofixEnumSpec	enum340 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesStatus
+static struct _ofixEnumSpec	enum368 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteEntryRejectReason
+static const char	*enum373_values[] = { "0", "1", "10", "11", "12", "13", "14", "15", "16", "17", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum373 = { { 0, 0, 0, 0 }, 18, enum373_values }; // SessionRejectReason
+static struct _ofixEnumSpec	enum374 = { { 0x0000000000000000ULL, 0x0000000000004008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BidRequestTransType
+static struct _ofixEnumSpec	enum378 = { { 0x01ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecRestatementReason
+static struct _ofixEnumSpec	enum380 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BusinessRejectReason
+static struct _ofixEnumSpec	enum385 = { { 0x0000000000000000ULL, 0x00000000000c0000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MsgDirection
+static struct _ofixEnumSpec	enum388 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DiscretionInst
+static struct _ofixEnumSpec	enum394 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BidType
+static struct _ofixEnumSpec	enum399 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BidDescriptorType
+static struct _ofixEnumSpec	enum401 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SideValueInd
+static struct _ofixEnumSpec	enum409 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // LiquidityIndType
+static struct _ofixEnumSpec	enum414 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ProgRptReqs
+static struct _ofixEnumSpec	enum416 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IncTaxInd
+static struct _ofixEnumSpec	enum419 = { { 0x03fc000000000000ULL, 0x000000000400001eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BasisPxType
+static struct _ofixEnumSpec	enum423 = { { 0x01fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PriceType
+static struct _ofixEnumSpec	enum427 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // GTBookingInst
+static struct _ofixEnumSpec	enum429 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ListStatusType
+static struct _ofixEnumSpec	enum430 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // NetGrossInd
+static struct _ofixEnumSpec	enum431 = { { 0x00fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ListOrderStatus
+static struct _ofixEnumSpec	enum433 = { { 0x003e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ListExecInstType
+static struct _ofixEnumSpec	enum434 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CxlRejResponseTo
+static struct _ofixEnumSpec	enum447 = { { 0x03fe000000000000ULL, 0x000000000000007eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PartyIDSource
+static const char	*enum452_values[] = { "1", "10", "11", "12", "13", "14", "15", "16", "17", "18", "19", "2", "20", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum452 = { { 0, 0, 0, 0 }, 20, enum452_values }; // PartyRole
+static const char	*enum460_values[] = { "1", "10", "11", "12", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum460 = { { 0, 0, 0, 0 }, 12, enum460_values }; // Product
+static struct _ofixEnumSpec	enum465 = { { 0x01fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuantityType
+static struct _ofixEnumSpec	enum481 = { { 0x000e000000000000ULL, 0x0000000002004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MoneyLaunderingStatus
+static struct _ofixEnumSpec	enum487 = { { 0x0000000000000000ULL, 0x0000000000044008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeReportTransType
+static struct _ofixEnumSpec	enum514 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // RegistTransType
+static const char	*enum522_values[] = { "1", "10", "11", "12", "13", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum522 = { { 0, 0, 0, 0 }, 13, enum522_values }; // OwnerType
+static struct _ofixEnumSpec	enum528 = { { 0x0000000000000000ULL, 0x0000000000850282ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrderCapacity
+static struct _ofixEnumSpec	enum529 = { { 0x03fe000000000000ULL, 0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrderRestrictions
+static struct _ofixEnumSpec	enum530 = { { 0x00fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MassCancelRequestType
+static struct _ofixEnumSpec	enum531 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MassCancelResponse
+static struct _ofixEnumSpec	enum537 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteType
+static const char	*enum543_values[] = { "Code", "ZZ" };
+static struct _ofixEnumSpec	enum543 = { { 0, 0, 0, 0 }, 2, enum543_values }; // InstrRegistry
+static struct _ofixEnumSpec	enum544 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CashMargin
+static struct _ofixEnumSpec	enum546 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Scope
+static struct _ofixEnumSpec	enum549 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CrossType
+static struct _ofixEnumSpec	enum552 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // NoSides
+static struct _ofixEnumSpec	enum559 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityListRequestType
+static struct _ofixEnumSpec	enum560 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityRequestResult
+static struct _ofixEnumSpec	enum567 = { { 0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesStatusRejReason
+static struct _ofixEnumSpec	enum569 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeRequestType
+static struct _ofixEnumSpec	enum573 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MatchStatus
+static const char	*enum574_values[] = { "A1", "A2", "A3", "A4", "A5", "AQ", "M1", "M2", "M3", "M4", "M5", "M6", "MT", "S5" };
+static struct _ofixEnumSpec	enum574 = { { 0, 0, 0, 0 }, 14, enum574_values }; // MatchType
+static const char	*enum577_values[] = { "0", "1", "10", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum577 = { { 0, 0, 0, 0 }, 11, enum577_values }; // ClearingInstruction
+static struct _ofixEnumSpec	enum581 = { { 0x01de000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AccountType
+static struct _ofixEnumSpec	enum585 = { { 0x01fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MassStatusReqType
+static struct _ofixEnumSpec	enum626 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocType
+static struct _ofixEnumSpec	enum638 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PriorityIndicator
+static struct _ofixEnumSpec	enum653 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecDefStatus
+
 // ----- Tags -----
 static struct _ofixTagSpec	tags[] = {
     { 1, OFIX_String, OFIX_Body, 0, 2, "1=", "Account" },
     { 2, OFIX_String, OFIX_Body, 0, 2, "2=", "AdvId" },
     { 3, OFIX_String, OFIX_Body, 0, 2, "3=", "AdvRefID" },
-    { 4, OFIX_Char, OFIX_Body, 0, 2, "4=", "AdvSide" },
-    { 5, OFIX_String, OFIX_Body, 0, 2, "5=", "AdvTransType" },
+    { 4, OFIX_Char, OFIX_Body, 0, 2, "4=", "AdvSide", &enum4 },
+    { 5, OFIX_String, OFIX_Body, 0, 2, "5=", "AdvTransType", &enum5 },
     { 6, OFIX_Price, OFIX_Body, 0, 2, "6=", "AvgPx" },
     { 7, OFIX_SeqNum, OFIX_Body, 0, 2, "7=", "BeginSeqNo" },
     { 8, OFIX_String, OFIX_Header, 0, 2, "8=", "BeginString" },
@@ -22,56 +155,56 @@ static struct _ofixTagSpec	tags[] = {
     { 10, OFIX_String, OFIX_Trailer, 0, 3, "10=", "CheckSum" },
     { 11, OFIX_String, OFIX_Body, 0, 3, "11=", "ClOrdID" },
     { 12, OFIX_Amt, OFIX_Body, 0, 3, "12=", "Commission" },
-    { 13, OFIX_Char, OFIX_Body, 0, 3, "13=", "CommType" },
+    { 13, OFIX_Char, OFIX_Body, 0, 3, "13=", "CommType", &enum13 },
     { 14, OFIX_Qty, OFIX_Body, 0, 3, "14=", "CumQty" },
     { 15, OFIX_Currency, OFIX_Body, 0, 3, "15=", "Currency" },
     { 16, OFIX_SeqNum, OFIX_Body, 0, 3, "16=", "EndSeqNo" },
     { 17, OFIX_String, OFIX_Body, 0, 3, "17=", "ExecID" },
-    { 18, OFIX_MultipleValueString, OFIX_Body, 0, 3, "18=", "ExecInst" },
+    { 18, OFIX_MultipleValueString, OFIX_Body, 0, 3, "18=", "ExecInst", &enum18 },
     { 19, OFIX_String, OFIX_Body, 0, 3, "19=", "ExecRefID" },
-    { 20, OFIX_Char, OFIX_Body, 0, 3, "20=", "ExecTransType" },
-    { 21, OFIX_Char, OFIX_Body, 0, 3, "21=", "HandlInst" },
-    { 22, OFIX_String, OFIX_Body, 0, 3, "22=", "SecurityIDSource" },
+    { 20, OFIX_Char, OFIX_Body, 0, 3, "20=", "ExecTransType", &enum20 },
+    { 21, OFIX_Char, OFIX_Body, 0, 3, "21=", "HandlInst", &enum21 },
+    { 22, OFIX_String, OFIX_Body, 0, 3, "22=", "SecurityIDSource", &enum22 },
     { 23, OFIX_String, OFIX_Body, 0, 3, "23=", "IOIid" },
-    { 25, OFIX_Char, OFIX_Body, 0, 3, "25=", "IOIQltyInd" },
+    { 25, OFIX_Char, OFIX_Body, 0, 3, "25=", "IOIQltyInd", &enum25 },
     { 26, OFIX_String, OFIX_Body, 0, 3, "26=", "IOIRefID" },
     { 27, OFIX_String, OFIX_Body, 0, 3, "27=", "IOIQty" },
-    { 28, OFIX_Char, OFIX_Body, 0, 3, "28=", "IOITransType" },
-    { 29, OFIX_Char, OFIX_Body, 0, 3, "29=", "LastCapacity" },
+    { 28, OFIX_Char, OFIX_Body, 0, 3, "28=", "IOITransType", &enum28 },
+    { 29, OFIX_Char, OFIX_Body, 0, 3, "29=", "LastCapacity", &enum29 },
     { 30, OFIX_Exchange, OFIX_Body, 0, 3, "30=", "LastMkt" },
     { 31, OFIX_Price, OFIX_Body, 0, 3, "31=", "LastPx" },
     { 32, OFIX_Qty, OFIX_Body, 0, 3, "32=", "LastQty" },
     { 33, OFIX_NumInGroup, OFIX_Body, 0, 3, "33=", "LinesOfText" },
     { 34, OFIX_SeqNum, OFIX_Header, 0, 3, "34=", "MsgSeqNum" },
-    { 35, OFIX_String, OFIX_Header, 0, 3, "35=", "MsgType" },
+    { 35, OFIX_String, OFIX_Header, 0, 3, "35=", "MsgType", &enum35 },
     { 36, OFIX_SeqNum, OFIX_Body, 0, 3, "36=", "NewSeqNo" },
     { 37, OFIX_String, OFIX_Body, 0, 3, "37=", "OrderID" },
     { 38, OFIX_Qty, OFIX_Body, 0, 3, "38=", "OrderQty" },
-    { 39, OFIX_Char, OFIX_Body, 0, 3, "39=", "OrdStatus" },
-    { 40, OFIX_Char, OFIX_Body, 0, 3, "40=", "OrdType" },
+    { 39, OFIX_Char, OFIX_Body, 0, 3, "39=", "OrdStatus", &enum39 },
+    { 40, OFIX_Char, OFIX_Body, 0, 3, "40=", "OrdType", &enum40 },
     { 41, OFIX_String, OFIX_Body, 0, 3, "41=", "OrigClOrdID" },
     { 42, OFIX_UTCTimestamp, OFIX_Body, 0, 3, "42=", "OrigTime" },
     { 43, OFIX_Boolean, OFIX_Header, 0, 3, "43=", "PossDupFlag" },
     { 44, OFIX_Price, OFIX_Body, 0, 3, "44=", "Price" },
     { 45, OFIX_SeqNum, OFIX_Body, 0, 3, "45=", "RefSeqNum" },
     { 46, OFIX_String, OFIX_Body, 0, 3, "46=", "RelatdSym" },
-    { 47, OFIX_Char, OFIX_Body, 0, 3, "47=", "Rule80A" },
+    { 47, OFIX_Char, OFIX_Body, 0, 3, "47=", "Rule80A", &enum47 },
     { 48, OFIX_String, OFIX_Body, 0, 3, "48=", "SecurityID" },
     { 49, OFIX_String, OFIX_Header, 0, 3, "49=", "SenderCompID" },
     { 50, OFIX_String, OFIX_Header, 0, 3, "50=", "SenderSubID" },
     { 51, OFIX_LocalMktDate, OFIX_Body, 0, 3, "51=", "SendingDate" },
     { 52, OFIX_UTCTimestamp, OFIX_Header, 0, 3, "52=", "SendingTime" },
     { 53, OFIX_Qty, OFIX_Body, 0, 3, "53=", "Quantity" },
-    { 54, OFIX_Char, OFIX_Body, 0, 3, "54=", "Side" },
+    { 54, OFIX_Char, OFIX_Body, 0, 3, "54=", "Side", &enum54 },
     { 55, OFIX_String, OFIX_Body, 0, 3, "55=", "Symbol" },
     { 56, OFIX_String, OFIX_Header, 0, 3, "56=", "TargetCompID" },
     { 57, OFIX_String, OFIX_Header, 0, 3, "57=", "TargetSubID" },
     { 58, OFIX_String, OFIX_Body, 0, 3, "58=", "Text" },
-    { 59, OFIX_Char, OFIX_Body, 0, 3, "59=", "TimeInForce" },
+    { 59, OFIX_Char, OFIX_Body, 0, 3, "59=", "TimeInForce", &enum59 },
     { 60, OFIX_UTCTimestamp, OFIX_Body, 0, 3, "60=", "TransactTime" },
-    { 61, OFIX_Char, OFIX_Body, 0, 3, "61=", "Urgency" },
+    { 61, OFIX_Char, OFIX_Body, 0, 3, "61=", "Urgency", &enum61 },
     { 62, OFIX_UTCTimestamp, OFIX_Body, 0, 3, "62=", "ValidUntilTime" },
-    { 63, OFIX_Char, OFIX_Body, 0, 3, "63=", "SettlmntTyp" },
+    { 63, OFIX_Char, OFIX_Body, 0, 3, "63=", "SettlmntTyp", &enum63 },
     { 64, OFIX_LocalMktDate, OFIX_Body, 0, 3, "64=", "FutSettDate" },
     { 65, OFIX_String, OFIX_Body, 0, 3, "65=", "SymbolSfx" },
     { 66, OFIX_String, OFIX_Body, 0, 3, "66=", "ListID" },
@@ -79,7 +212,7 @@ static struct _ofixTagSpec	tags[] = {
     { 68, OFIX_Int, OFIX_Body, 0, 3, "68=", "TotNoOrders" },
     { 69, OFIX_String, OFIX_Body, 0, 3, "69=", "ListExecInst" },
     { 70, OFIX_String, OFIX_Body, 0, 3, "70=", "AllocID" },
-    { 71, OFIX_Char, OFIX_Body, 0, 3, "71=", "AllocTransType" },
+    { 71, OFIX_Char, OFIX_Body, 0, 3, "71=", "AllocTransType", &enum71 },
     { 72, OFIX_String, OFIX_Body, 0, 3, "72=", "RefAllocID" },
     { 73, OFIX_NumInGroup, OFIX_Body, 0, 3, "73=", "NoOrders" },
     { 74, OFIX_Int, OFIX_Body, 0, 3, "74=", "AvgPrxPrecision" },
@@ -89,29 +222,29 @@ static struct _ofixTagSpec	tags[] = {
     { 78, OFIX_NumInGroup, OFIX_Body, 0, 3, "78=", "NoAllocs" },
     { 79, OFIX_String, OFIX_Body, 0, 3, "79=", "AllocAccount" },
     { 80, OFIX_Qty, OFIX_Body, 0, 3, "80=", "AllocQty" },
-    { 81, OFIX_Char, OFIX_Body, 0, 3, "81=", "ProcessCode" },
+    { 81, OFIX_Char, OFIX_Body, 0, 3, "81=", "ProcessCode", &enum81 },
     { 82, OFIX_NumInGroup, OFIX_Body, 0, 3, "82=", "NoRpts" },
     { 83, OFIX_Int, OFIX_Body, 0, 3, "83=", "RptSeq" },
     { 84, OFIX_Qty, OFIX_Body, 0, 3, "84=", "CxlQty" },
     { 85, OFIX_Int, OFIX_Body, 0, 3, "85=", "NoDlvyInst" },
     { 86, OFIX_String, OFIX_Body, 0, 3, "86=", "DlvyInst" },
-    { 87, OFIX_Int, OFIX_Body, 0, 3, "87=", "AllocStatus" },
-    { 88, OFIX_Int, OFIX_Body, 0, 3, "88=", "AllocRejCode" },
+    { 87, OFIX_Int, OFIX_Body, 0, 3, "87=", "AllocStatus", &enum87 },
+    { 88, OFIX_Int, OFIX_Body, 0, 3, "88=", "AllocRejCode", &enum88 },
     { 89, OFIX_Data, OFIX_Trailer, 93, 3, "89=", "Signature" },
     { 90, OFIX_Length, OFIX_Header, 91, 3, "90=", "SecureDataLen" },
     { 91, OFIX_Data, OFIX_Header, 90, 3, "91=", "SecureData" },
     { 92, OFIX_String, OFIX_Body, 0, 3, "92=", "BrokerOfCredit" },
     { 93, OFIX_Length, OFIX_Trailer, 89, 3, "93=", "SignatureLength" },
-    { 94, OFIX_Char, OFIX_Body, 0, 3, "94=", "EmailType" },
+    { 94, OFIX_Char, OFIX_Body, 0, 3, "94=", "EmailType", &enum94 },
     { 95, OFIX_Length, OFIX_Body, 96, 3, "95=", "RawDataLength" },
     { 96, OFIX_Data, OFIX_Body, 95, 3, "96=", "RawData" },
     { 97, OFIX_Boolean, OFIX_Header, 0, 3, "97=", "PossResend" },
-    { 98, OFIX_Int, OFIX_Body, 0, 3, "98=", "EncryptMethod" },
+    { 98, OFIX_Int, OFIX_Body, 0, 3, "98=", "EncryptMethod", &enum98 },
     { 99, OFIX_Price, OFIX_Body, 0, 3, "99=", "StopPx" },
     { 100, OFIX_Exchange, OFIX_Body, 0, 4, "100=", "ExDestination" },
-    { 102, OFIX_Int, OFIX_Body, 0, 4, "102=", "CxlRejReason" },
-    { 103, OFIX_Int, OFIX_Body, 0, 4, "103=", "OrdRejReason" },
-    { 104, OFIX_Char, OFIX_Body, 0, 4, "104=", "IOIQualifier" },
+    { 102, OFIX_Int, OFIX_Body, 0, 4, "102=", "CxlRejReason", &enum102 },
+    { 103, OFIX_Int, OFIX_Body, 0, 4, "103=", "OrdRejReason", &enum103 },
+    { 104, OFIX_Char, OFIX_Body, 0, 4, "104=", "IOIQualifier", &enum104 },
     { 105, OFIX_String, OFIX_Body, 0, 4, "105=", "WaveNo" },
     { 106, OFIX_String, OFIX_Body, 0, 4, "106=", "Issuer" },
     { 107, OFIX_String, OFIX_Body, 0, 4, "107=", "SecurityDesc" },
@@ -134,7 +267,7 @@ static struct _ofixTagSpec	tags[] = {
     { 124, OFIX_NumInGroup, OFIX_Body, 0, 4, "124=", "NoExecs" },
     { 125, OFIX_Char, OFIX_Body, 0, 4, "125=", "CxlType" },
     { 126, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "126=", "ExpireTime" },
-    { 127, OFIX_Char, OFIX_Body, 0, 4, "127=", "DKReason" },
+    { 127, OFIX_Char, OFIX_Body, 0, 4, "127=", "DKReason", &enum127 },
     { 128, OFIX_String, OFIX_Header, 0, 4, "128=", "DeliverToCompID" },
     { 129, OFIX_String, OFIX_Header, 0, 4, "129=", "DeliverToSubID" },
     { 130, OFIX_Boolean, OFIX_Body, 0, 4, "130=", "IOINaturalFlag" },
@@ -146,7 +279,7 @@ static struct _ofixTagSpec	tags[] = {
     { 136, OFIX_NumInGroup, OFIX_Body, 0, 4, "136=", "NoMiscFees" },
     { 137, OFIX_Amt, OFIX_Body, 0, 4, "137=", "MiscFeeAmt" },
     { 138, OFIX_Currency, OFIX_Body, 0, 4, "138=", "MiscFeeCurr" },
-    { 139, OFIX_Char, OFIX_Body, 0, 4, "139=", "MiscFeeType" },
+    { 139, OFIX_Char, OFIX_Body, 0, 4, "139=", "MiscFeeType", &enum139 },
     { 140, OFIX_Price, OFIX_Body, 0, 4, "140=", "PrevClosePx" },
     { 141, OFIX_Boolean, OFIX_Body, 0, 4, "141=", "ResetSeqNumFlag" },
     { 142, OFIX_String, OFIX_Header, 0, 4, "142=", "SenderLocationID" },
@@ -157,7 +290,7 @@ static struct _ofixTagSpec	tags[] = {
     { 147, OFIX_String, OFIX_Body, 0, 4, "147=", "Subject" },
     { 148, OFIX_String, OFIX_Body, 0, 4, "148=", "Headline" },
     { 149, OFIX_String, OFIX_Body, 0, 4, "149=", "URLLink" },
-    { 150, OFIX_Char, OFIX_Body, 0, 4, "150=", "ExecType" },
+    { 150, OFIX_Char, OFIX_Body, 0, 4, "150=", "ExecType", &enum150 },
     { 151, OFIX_Qty, OFIX_Body, 0, 4, "151=", "LeavesQty" },
     { 152, OFIX_Qty, OFIX_Body, 0, 4, "152=", "CashOrderQty" },
     { 153, OFIX_Price, OFIX_Body, 0, 4, "153=", "AllocAvgPx" },
@@ -167,16 +300,16 @@ static struct _ofixTagSpec	tags[] = {
     { 157, OFIX_Int, OFIX_Body, 0, 4, "157=", "NumDaysInterest" },
     { 158, OFIX_Percentage, OFIX_Body, 0, 4, "158=", "AccruedInterestRate" },
     { 159, OFIX_Amt, OFIX_Body, 0, 4, "159=", "AccruedInterestAmt" },
-    { 160, OFIX_Char, OFIX_Body, 0, 4, "160=", "SettlInstMode" },
+    { 160, OFIX_Char, OFIX_Body, 0, 4, "160=", "SettlInstMode", &enum160 },
     { 161, OFIX_String, OFIX_Body, 0, 4, "161=", "AllocText" },
     { 162, OFIX_String, OFIX_Body, 0, 4, "162=", "SettlInstID" },
-    { 163, OFIX_Char, OFIX_Body, 0, 4, "163=", "SettlInstTransType" },
+    { 163, OFIX_Char, OFIX_Body, 0, 4, "163=", "SettlInstTransType", &enum163 },
     { 164, OFIX_String, OFIX_Body, 0, 4, "164=", "EmailThreadID" },
-    { 165, OFIX_Char, OFIX_Body, 0, 4, "165=", "SettlInstSource" },
-    { 166, OFIX_String, OFIX_Body, 0, 4, "166=", "SettlLocation" },
-    { 167, OFIX_String, OFIX_Body, 0, 4, "167=", "SecurityType" },
+    { 165, OFIX_Char, OFIX_Body, 0, 4, "165=", "SettlInstSource", &enum165 },
+    { 166, OFIX_String, OFIX_Body, 0, 4, "166=", "SettlLocation", &enum166 },
+    { 167, OFIX_String, OFIX_Body, 0, 4, "167=", "SecurityType", &enum167 },
     { 168, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "168=", "EffectiveTime" },
-    { 169, OFIX_Int, OFIX_Body, 0, 4, "169=", "StandInstDbType" },
+    { 169, OFIX_Int, OFIX_Body, 0, 4, "169=", "StandInstDbType", &enum169 },
     { 170, OFIX_String, OFIX_Body, 0, 4, "170=", "StandInstDbName" },
     { 171, OFIX_String, OFIX_Body, 0, 4, "171=", "StandInstDbID" },
     { 172, OFIX_Int, OFIX_Body, 0, 4, "172=", "SettlDeliveryType" },
@@ -204,29 +337,29 @@ static struct _ofixTagSpec	tags[] = {
     { 194, OFIX_Price, OFIX_Body, 0, 4, "194=", "LastSpotRate" },
     { 195, OFIX_PriceOffset, OFIX_Body, 0, 4, "195=", "LastForwardPoints" },
     { 196, OFIX_String, OFIX_Body, 0, 4, "196=", "AllocLinkID" },
-    { 197, OFIX_Int, OFIX_Body, 0, 4, "197=", "AllocLinkType" },
+    { 197, OFIX_Int, OFIX_Body, 0, 4, "197=", "AllocLinkType", &enum197 },
     { 198, OFIX_String, OFIX_Body, 0, 4, "198=", "SecondaryOrderID" },
     { 199, OFIX_NumInGroup, OFIX_Body, 0, 4, "199=", "NoIOIQualifiers" },
     { 200, OFIX_MonthYear, OFIX_Body, 0, 4, "200=", "MaturityMonthYear" },
-    { 201, OFIX_Int, OFIX_Body, 0, 4, "201=", "PutOrCall" },
+    { 201, OFIX_Int, OFIX_Body, 0, 4, "201=", "PutOrCall", &enum201 },
     { 202, OFIX_Price, OFIX_Body, 0, 4, "202=", "StrikePrice" },
-    { 203, OFIX_Int, OFIX_Body, 0, 4, "203=", "CoveredOrUncovered" },
-    { 204, OFIX_Int, OFIX_Body, 0, 4, "204=", "CustomerOrFirm" },
+    { 203, OFIX_Int, OFIX_Body, 0, 4, "203=", "CoveredOrUncovered", &enum203 },
+    { 204, OFIX_Int, OFIX_Body, 0, 4, "204=", "CustomerOrFirm", &enum204 },
     { 205, OFIX_DayOfMonth, OFIX_Body, 0, 4, "205=", "MaturityDay" },
     { 206, OFIX_Char, OFIX_Body, 0, 4, "206=", "OptAttribute" },
     { 207, OFIX_Exchange, OFIX_Body, 0, 4, "207=", "SecurityExchange" },
     { 208, OFIX_Boolean, OFIX_Body, 0, 4, "208=", "NotifyBrokerOfCredit" },
-    { 209, OFIX_Int, OFIX_Body, 0, 4, "209=", "AllocHandlInst" },
+    { 209, OFIX_Int, OFIX_Body, 0, 4, "209=", "AllocHandlInst", &enum209 },
     { 210, OFIX_Qty, OFIX_Body, 0, 4, "210=", "MaxShow" },
     { 211, OFIX_PriceOffset, OFIX_Body, 0, 4, "211=", "PegDifference" },
     { 212, OFIX_Length, OFIX_Header, 213, 4, "212=", "XmlDataLen" },
     { 213, OFIX_Data, OFIX_Header, 212, 4, "213=", "XmlData" },
     { 214, OFIX_String, OFIX_Body, 0, 4, "214=", "SettlInstRefID" },
     { 215, OFIX_NumInGroup, OFIX_Body, 0, 4, "215=", "NoRoutingIDs" },
-    { 216, OFIX_Int, OFIX_Body, 0, 4, "216=", "RoutingType" },
+    { 216, OFIX_Int, OFIX_Body, 0, 4, "216=", "RoutingType", &enum216 },
     { 217, OFIX_String, OFIX_Body, 0, 4, "217=", "RoutingID" },
     { 218, OFIX_PriceOffset, OFIX_Body, 0, 4, "218=", "Spread" },
-    { 219, OFIX_Char, OFIX_Body, 0, 4, "219=", "Benchmark" },
+    { 219, OFIX_Char, OFIX_Body, 0, 4, "219=", "Benchmark", &enum219 },
     { 220, OFIX_Currency, OFIX_Body, 0, 4, "220=", "BenchmarkCurveCurrency" },
     { 221, OFIX_String, OFIX_Body, 0, 4, "221=", "BenchmarkCurveName" },
     { 222, OFIX_String, OFIX_Body, 0, 4, "222=", "BenchmarkCurvePoint" },
@@ -242,7 +375,7 @@ static struct _ofixTagSpec	tags[] = {
     { 232, OFIX_NumInGroup, OFIX_Body, 0, 4, "232=", "NoStipulations" },
     { 233, OFIX_String, OFIX_Body, 0, 4, "233=", "StipulationType" },
     { 234, OFIX_String, OFIX_Body, 0, 4, "234=", "StipulationValue" },
-    { 235, OFIX_String, OFIX_Body, 0, 4, "235=", "YieldType" },
+    { 235, OFIX_String, OFIX_Body, 0, 4, "235=", "YieldType", &enum235 },
     { 236, OFIX_Percentage, OFIX_Body, 0, 4, "236=", "Yield" },
     { 237, OFIX_Amt, OFIX_Body, 0, 4, "237=", "TotalTakedown" },
     { 238, OFIX_Amt, OFIX_Body, 0, 4, "238=", "Concession" },
@@ -269,47 +402,47 @@ static struct _ofixTagSpec	tags[] = {
     { 259, OFIX_UTCDateOnly, OFIX_Body, 0, 4, "259=", "BasisFeatureDate" },
     { 260, OFIX_Price, OFIX_Body, 0, 4, "260=", "BasisFeaturePrice" },
     { 262, OFIX_String, OFIX_Body, 0, 4, "262=", "MDReqID" },
-    { 263, OFIX_Char, OFIX_Body, 0, 4, "263=", "SubscriptionRequestType" },
+    { 263, OFIX_Char, OFIX_Body, 0, 4, "263=", "SubscriptionRequestType", &enum263 },
     { 264, OFIX_Int, OFIX_Body, 0, 4, "264=", "MarketDepth" },
-    { 265, OFIX_Int, OFIX_Body, 0, 4, "265=", "MDUpdateType" },
+    { 265, OFIX_Int, OFIX_Body, 0, 4, "265=", "MDUpdateType", &enum265 },
     { 266, OFIX_Boolean, OFIX_Body, 0, 4, "266=", "AggregatedBook" },
     { 267, OFIX_NumInGroup, OFIX_Body, 0, 4, "267=", "NoMDEntryTypes" },
     { 268, OFIX_NumInGroup, OFIX_Body, 0, 4, "268=", "NoMDEntries" },
-    { 269, OFIX_Char, OFIX_Body, 0, 4, "269=", "MDEntryType" },
+    { 269, OFIX_Char, OFIX_Body, 0, 4, "269=", "MDEntryType", &enum269 },
     { 270, OFIX_Price, OFIX_Body, 0, 4, "270=", "MDEntryPx" },
     { 271, OFIX_Qty, OFIX_Body, 0, 4, "271=", "MDEntrySize" },
     { 272, OFIX_UTCDateOnly, OFIX_Body, 0, 4, "272=", "MDEntryDate" },
     { 273, OFIX_UTCTimeOnly, OFIX_Body, 0, 4, "273=", "MDEntryTime" },
-    { 274, OFIX_Char, OFIX_Body, 0, 4, "274=", "TickDirection" },
+    { 274, OFIX_Char, OFIX_Body, 0, 4, "274=", "TickDirection", &enum274 },
     { 275, OFIX_Exchange, OFIX_Body, 0, 4, "275=", "MDMkt" },
-    { 276, OFIX_MultipleValueString, OFIX_Body, 0, 4, "276=", "QuoteCondition" },
-    { 277, OFIX_MultipleValueString, OFIX_Body, 0, 4, "277=", "TradeCondition" },
+    { 276, OFIX_MultipleValueString, OFIX_Body, 0, 4, "276=", "QuoteCondition", &enum276 },
+    { 277, OFIX_MultipleValueString, OFIX_Body, 0, 4, "277=", "TradeCondition", &enum277 },
     { 278, OFIX_String, OFIX_Body, 0, 4, "278=", "MDEntryID" },
-    { 279, OFIX_Char, OFIX_Body, 0, 4, "279=", "MDUpdateAction" },
+    { 279, OFIX_Char, OFIX_Body, 0, 4, "279=", "MDUpdateAction", &enum279 },
     { 280, OFIX_String, OFIX_Body, 0, 4, "280=", "MDEntryRefID" },
-    { 281, OFIX_Char, OFIX_Body, 0, 4, "281=", "MDReqRejReason" },
+    { 281, OFIX_Char, OFIX_Body, 0, 4, "281=", "MDReqRejReason", &enum281 },
     { 282, OFIX_String, OFIX_Body, 0, 4, "282=", "MDEntryOriginator" },
     { 283, OFIX_String, OFIX_Body, 0, 4, "283=", "LocationID" },
     { 284, OFIX_String, OFIX_Body, 0, 4, "284=", "DeskID" },
-    { 285, OFIX_Char, OFIX_Body, 0, 4, "285=", "DeleteReason" },
-    { 286, OFIX_MultipleValueString, OFIX_Body, 0, 4, "286=", "OpenCloseSettleFlag" },
+    { 285, OFIX_Char, OFIX_Body, 0, 4, "285=", "DeleteReason", &enum285 },
+    { 286, OFIX_MultipleValueString, OFIX_Body, 0, 4, "286=", "OpenCloseSettleFlag", &enum286 },
     { 287, OFIX_Int, OFIX_Body, 0, 4, "287=", "SellerDays" },
     { 288, OFIX_String, OFIX_Body, 0, 4, "288=", "MDEntryBuyer" },
     { 289, OFIX_String, OFIX_Body, 0, 4, "289=", "MDEntrySeller" },
     { 290, OFIX_Int, OFIX_Body, 0, 4, "290=", "MDEntryPositionNo" },
-    { 291, OFIX_MultipleValueString, OFIX_Body, 0, 4, "291=", "FinancialStatus" },
-    { 292, OFIX_MultipleValueString, OFIX_Body, 0, 4, "292=", "CorporateAction" },
+    { 291, OFIX_MultipleValueString, OFIX_Body, 0, 4, "291=", "FinancialStatus", &enum291 },
+    { 292, OFIX_MultipleValueString, OFIX_Body, 0, 4, "292=", "CorporateAction", &enum292 },
     { 293, OFIX_Qty, OFIX_Body, 0, 4, "293=", "DefBidSize" },
     { 294, OFIX_Qty, OFIX_Body, 0, 4, "294=", "DefOfferSize" },
     { 295, OFIX_NumInGroup, OFIX_Body, 0, 4, "295=", "NoQuoteEntries" },
     { 296, OFIX_NumInGroup, OFIX_Body, 0, 4, "296=", "NoQuoteSets" },
-    { 297, OFIX_Int, OFIX_Body, 0, 4, "297=", "QuoteStatus" },
+    { 297, OFIX_Int, OFIX_Body, 0, 4, "297=", "QuoteStatus", &enum297 },
     { 298, OFIX_Int, OFIX_Body, 0, 4, "298=", "QuoteCancelType" },
     { 299, OFIX_String, OFIX_Body, 0, 4, "299=", "QuoteEntryID" },
     { 300, OFIX_Int, OFIX_Body, 0, 4, "300=", "QuoteRejectReason" },
     { 301, OFIX_Int, OFIX_Body, 0, 4, "301=", "QuoteResponseLevel" },
     { 302, OFIX_String, OFIX_Body, 0, 4, "302=", "QuoteSetID" },
-    { 303, OFIX_Int, OFIX_Body, 0, 4, "303=", "QuoteRequestType" },
+    { 303, OFIX_Int, OFIX_Body, 0, 4, "303=", "QuoteRequestType", &enum303 },
     { 304, OFIX_Int, OFIX_Body, 0, 4, "304=", "TotQuoteEntries" },
     { 305, OFIX_String, OFIX_Body, 0, 4, "305=", "UnderlyingSecurityIDSource" },
     { 306, OFIX_String, OFIX_Body, 0, 4, "306=", "UnderlyingIssuer" },
@@ -327,26 +460,26 @@ static struct _ofixTagSpec	tags[] = {
     { 318, OFIX_Currency, OFIX_Body, 0, 4, "318=", "UnderlyingCurrency" },
     { 319, OFIX_Qty, OFIX_Body, 0, 4, "319=", "RatioQty" },
     { 320, OFIX_String, OFIX_Body, 0, 4, "320=", "SecurityReqID" },
-    { 321, OFIX_Int, OFIX_Body, 0, 4, "321=", "SecurityRequestType" },
+    { 321, OFIX_Int, OFIX_Body, 0, 4, "321=", "SecurityRequestType", &enum321 },
     { 322, OFIX_String, OFIX_Body, 0, 4, "322=", "SecurityResponseID" },
-    { 323, OFIX_Int, OFIX_Body, 0, 4, "323=", "SecurityResponseType" },
+    { 323, OFIX_Int, OFIX_Body, 0, 4, "323=", "SecurityResponseType", &enum323 },
     { 324, OFIX_String, OFIX_Body, 0, 4, "324=", "SecurityStatusReqID" },
     { 325, OFIX_Boolean, OFIX_Body, 0, 4, "325=", "UnsolicitedIndicator" },
-    { 326, OFIX_Int, OFIX_Body, 0, 4, "326=", "SecurityTradingStatus" },
-    { 327, OFIX_Char, OFIX_Body, 0, 4, "327=", "HaltReason" },
+    { 326, OFIX_Int, OFIX_Body, 0, 4, "326=", "SecurityTradingStatus", &enum326 },
+    { 327, OFIX_Char, OFIX_Body, 0, 4, "327=", "HaltReason", &enum327 },
     { 328, OFIX_Boolean, OFIX_Body, 0, 4, "328=", "InViewOfCommon" },
     { 329, OFIX_Boolean, OFIX_Body, 0, 4, "329=", "DueToRelated" },
     { 330, OFIX_Qty, OFIX_Body, 0, 4, "330=", "BuyVolume" },
     { 331, OFIX_Qty, OFIX_Body, 0, 4, "331=", "SellVolume" },
     { 332, OFIX_Price, OFIX_Body, 0, 4, "332=", "HighPx" },
     { 333, OFIX_Price, OFIX_Body, 0, 4, "333=", "LowPx" },
-    { 334, OFIX_Int, OFIX_Body, 0, 4, "334=", "Adjustment" },
+    { 334, OFIX_Int, OFIX_Body, 0, 4, "334=", "Adjustment", &enum334 },
     { 335, OFIX_String, OFIX_Body, 0, 4, "335=", "TradSesReqID" },
     { 336, OFIX_String, OFIX_Body, 0, 4, "336=", "TradingSessionID" },
     { 337, OFIX_String, OFIX_Body, 0, 4, "337=", "ContraTrader" },
-    { 338, OFIX_Int, OFIX_Body, 0, 4, "338=", "TradSesMethod" },
-    { 339, OFIX_Int, OFIX_Body, 0, 4, "339=", "TradSesMode" },
-    { 340, OFIX_Int, OFIX_Body, 0, 4, "340=", "TradSesStatus" },
+    { 338, OFIX_Int, OFIX_Body, 0, 4, "338=", "TradSesMethod", &enum338 },
+    { 339, OFIX_Int, OFIX_Body, 0, 4, "339=", "TradSesMode", &enum339 },
+    { 340, OFIX_Int, OFIX_Body, 0, 4, "340=", "TradSesStatus", &enum340 },
     { 341, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "341=", "TradSesStartTime" },
     { 342, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "342=", "TradSesOpenTime" },
     { 343, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "343=", "TradSesPreCloseTime" },
@@ -374,40 +507,40 @@ static struct _ofixTagSpec	tags[] = {
     { 365, OFIX_Data, OFIX_Body, 364, 4, "365=", "EncodedUnderlyingSecurityDesc" },
     { 366, OFIX_Price, OFIX_Body, 0, 4, "366=", "AllocPrice" },
     { 367, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "367=", "QuoteSetValidUntilTime" },
-    { 368, OFIX_Int, OFIX_Body, 0, 4, "368=", "QuoteEntryRejectReason" },
+    { 368, OFIX_Int, OFIX_Body, 0, 4, "368=", "QuoteEntryRejectReason", &enum368 },
     { 369, OFIX_SeqNum, OFIX_Header, 0, 4, "369=", "LastMsgSeqNumProcessed" },
     { 370, OFIX_UTCTimestamp, OFIX_Header, 0, 4, "370=", "OnBehalfOfSendingTime" },
     { 371, OFIX_Int, OFIX_Body, 0, 4, "371=", "RefTagID" },
     { 372, OFIX_String, OFIX_Body, 0, 4, "372=", "RefMsgType" },
-    { 373, OFIX_Int, OFIX_Body, 0, 4, "373=", "SessionRejectReason" },
-    { 374, OFIX_Char, OFIX_Body, 0, 4, "374=", "BidRequestTransType" },
+    { 373, OFIX_Int, OFIX_Body, 0, 4, "373=", "SessionRejectReason", &enum373 },
+    { 374, OFIX_Char, OFIX_Body, 0, 4, "374=", "BidRequestTransType", &enum374 },
     { 375, OFIX_String, OFIX_Body, 0, 4, "375=", "ContraBroker" },
     { 376, OFIX_String, OFIX_Body, 0, 4, "376=", "ComplianceID" },
     { 377, OFIX_Boolean, OFIX_Body, 0, 4, "377=", "SolicitedFlag" },
-    { 378, OFIX_Int, OFIX_Body, 0, 4, "378=", "ExecRestatementReason" },
+    { 378, OFIX_Int, OFIX_Body, 0, 4, "378=", "ExecRestatementReason", &enum378 },
     { 379, OFIX_String, OFIX_Body, 0, 4, "379=", "BusinessRejectRefID" },
-    { 380, OFIX_Int, OFIX_Body, 0, 4, "380=", "BusinessRejectReason" },
+    { 380, OFIX_Int, OFIX_Body, 0, 4, "380=", "BusinessRejectReason", &enum380 },
     { 381, OFIX_Amt, OFIX_Body, 0, 4, "381=", "GrossTradeAmt" },
     { 382, OFIX_NumInGroup, OFIX_Body, 0, 4, "382=", "NoContraBrokers" },
     { 383, OFIX_Length, OFIX_Body, 0, 4, "383=", "MaxMessageSize" },
     { 384, OFIX_NumInGroup, OFIX_Body, 0, 4, "384=", "NoMsgTypes" },
-    { 385, OFIX_Char, OFIX_Body, 0, 4, "385=", "MsgDirection" },
+    { 385, OFIX_Char, OFIX_Body, 0, 4, "385=", "MsgDirection", &enum385 },
     { 386, OFIX_NumInGroup, OFIX_Body, 0, 4, "386=", "NoTradingSessions" },
     { 387, OFIX_Qty, OFIX_Body, 0, 4, "387=", "TotalVolumeTraded" },
-    { 388, OFIX_Char, OFIX_Body, 0, 4, "388=", "DiscretionInst" },
+    { 388, OFIX_Char, OFIX_Body, 0, 4, "388=", "DiscretionInst", &enum388 },
     { 389, OFIX_PriceOffset, OFIX_Body, 0, 4, "389=", "DiscretionOffset" },
     { 390, OFIX_String, OFIX_Body, 0, 4, "390=", "BidID" },
     { 391, OFIX_String, OFIX_Body, 0, 4, "391=", "ClientBidID" },
     { 392, OFIX_String, OFIX_Body, 0, 4, "392=", "ListName" },
     { 393, OFIX_Int, OFIX_Body, 0, 4, "393=", "TotalNumSecurities" },
-    { 394, OFIX_Int, OFIX_Body, 0, 4, "394=", "BidType" },
+    { 394, OFIX_Int, OFIX_Body, 0, 4, "394=", "BidType", &enum394 },
     { 395, OFIX_Int, OFIX_Body, 0, 4, "395=", "NumTickets" },
     { 396, OFIX_Amt, OFIX_Body, 0, 4, "396=", "SideValue1" },
     { 397, OFIX_Amt, OFIX_Body, 0, 4, "397=", "SideValue2" },
     { 398, OFIX_NumInGroup, OFIX_Body, 0, 4, "398=", "NoBidDescriptors" },
-    { 399, OFIX_Int, OFIX_Body, 0, 4, "399=", "BidDescriptorType" },
+    { 399, OFIX_Int, OFIX_Body, 0, 4, "399=", "BidDescriptorType", &enum399 },
     { 400, OFIX_String, OFIX_Body, 0, 4, "400=", "BidDescriptor" },
-    { 401, OFIX_Int, OFIX_Body, 0, 4, "401=", "SideValueInd" },
+    { 401, OFIX_Int, OFIX_Body, 0, 4, "401=", "SideValueInd", &enum401 },
     { 402, OFIX_Percentage, OFIX_Body, 0, 4, "402=", "LiquidityPctLow" },
     { 403, OFIX_Percentage, OFIX_Body, 0, 4, "403=", "LiquidityPctHigh" },
     { 404, OFIX_Amt, OFIX_Body, 0, 4, "404=", "LiquidityValue" },
@@ -415,32 +548,32 @@ static struct _ofixTagSpec	tags[] = {
     { 406, OFIX_Amt, OFIX_Body, 0, 4, "406=", "FairValue" },
     { 407, OFIX_Percentage, OFIX_Body, 0, 4, "407=", "OutsideIndexPct" },
     { 408, OFIX_Amt, OFIX_Body, 0, 4, "408=", "ValueOfFutures" },
-    { 409, OFIX_Int, OFIX_Body, 0, 4, "409=", "LiquidityIndType" },
+    { 409, OFIX_Int, OFIX_Body, 0, 4, "409=", "LiquidityIndType", &enum409 },
     { 410, OFIX_Percentage, OFIX_Body, 0, 4, "410=", "WtAverageLiquidity" },
     { 411, OFIX_Boolean, OFIX_Body, 0, 4, "411=", "ExchangeForPhysical" },
     { 412, OFIX_Amt, OFIX_Body, 0, 4, "412=", "OutMainCntryUIndex" },
     { 413, OFIX_Percentage, OFIX_Body, 0, 4, "413=", "CrossPercent" },
-    { 414, OFIX_Int, OFIX_Body, 0, 4, "414=", "ProgRptReqs" },
+    { 414, OFIX_Int, OFIX_Body, 0, 4, "414=", "ProgRptReqs", &enum414 },
     { 415, OFIX_Int, OFIX_Body, 0, 4, "415=", "ProgPeriodInterval" },
-    { 416, OFIX_Int, OFIX_Body, 0, 4, "416=", "IncTaxInd" },
+    { 416, OFIX_Int, OFIX_Body, 0, 4, "416=", "IncTaxInd", &enum416 },
     { 417, OFIX_Int, OFIX_Body, 0, 4, "417=", "NumBidders" },
     { 418, OFIX_Char, OFIX_Body, 0, 4, "418=", "TradeType" },
-    { 419, OFIX_Char, OFIX_Body, 0, 4, "419=", "BasisPxType" },
+    { 419, OFIX_Char, OFIX_Body, 0, 4, "419=", "BasisPxType", &enum419 },
     { 420, OFIX_NumInGroup, OFIX_Body, 0, 4, "420=", "NoBidComponents" },
     { 421, OFIX_Country, OFIX_Body, 0, 4, "421=", "Country" },
     { 422, OFIX_Int, OFIX_Body, 0, 4, "422=", "TotNoStrikes" },
-    { 423, OFIX_Int, OFIX_Body, 0, 4, "423=", "PriceType" },
+    { 423, OFIX_Int, OFIX_Body, 0, 4, "423=", "PriceType", &enum423 },
     { 424, OFIX_Qty, OFIX_Body, 0, 4, "424=", "DayOrderQty" },
     { 425, OFIX_Qty, OFIX_Body, 0, 4, "425=", "DayCumQty" },
     { 426, OFIX_Price, OFIX_Body, 0, 4, "426=", "DayAvgPx" },
-    { 427, OFIX_Int, OFIX_Body, 0, 4, "427=", "GTBookingInst" },
+    { 427, OFIX_Int, OFIX_Body, 0, 4, "427=", "GTBookingInst", &enum427 },
     { 428, OFIX_NumInGroup, OFIX_Body, 0, 4, "428=", "NoStrikes" },
-    { 429, OFIX_Int, OFIX_Body, 0, 4, "429=", "ListStatusType" },
-    { 430, OFIX_Int, OFIX_Body, 0, 4, "430=", "NetGrossInd" },
-    { 431, OFIX_Int, OFIX_Body, 0, 4, "431=", "ListOrderStatus" },
+    { 429, OFIX_Int, OFIX_Body, 0, 4, "429=", "ListStatusType", &enum429 },
+    { 430, OFIX_Int, OFIX_Body, 0, 4, "430=", "NetGrossInd", &enum430 },
+    { 431, OFIX_Int, OFIX_Body, 0, 4, "431=", "ListOrderStatus", &enum431 },
     { 432, OFIX_LocalMktDate, OFIX_Body, 0, 4, "432=", "ExpireDate" },
-    { 433, OFIX_Char, OFIX_Body, 0, 4, "433=", "ListExecInstType" },
-    { 434, OFIX_Char, OFIX_Body, 0, 4, "434=", "CxlRejResponseTo" },
+    { 433, OFIX_Char, OFIX_Body, 0, 4, "433=", "ListExecInstType", &enum433 },
+    { 434, OFIX_Char, OFIX_Body, 0, 4, "434=", "CxlRejResponseTo", &enum434 },
     { 435, OFIX_Percentage, OFIX_Body, 0, 4, "435=", "UnderlyingCouponRate" },
     { 436, OFIX_Float, OFIX_Body, 0, 4, "436=", "UnderlyingContractMultiplier" },
     { 437, OFIX_Qty, OFIX_Body, 0, 4, "437=", "ContraTradeQty" },
@@ -453,12 +586,12 @@ static struct _ofixTagSpec	tags[] = {
     { 444, OFIX_String, OFIX_Body, 0, 4, "444=", "ListStatusText" },
     { 445, OFIX_Length, OFIX_Body, 446, 4, "445=", "EncodedListStatusTextLen" },
     { 446, OFIX_Data, OFIX_Body, 445, 4, "446=", "EncodedListStatusText" },
-    { 447, OFIX_Char, OFIX_Body, 0, 4, "447=", "PartyIDSource" },
+    { 447, OFIX_Char, OFIX_Body, 0, 4, "447=", "PartyIDSource", &enum447 },
     { 448, OFIX_String, OFIX_Body, 0, 4, "448=", "PartyID" },
     { 449, OFIX_UTCDateOnly, OFIX_Body, 0, 4, "449=", "TotalVolumeTradedDate" },
     { 450, OFIX_UTCTimeOnly, OFIX_Body, 0, 4, "450=", "TotalVolumeTradedTime" },
     { 451, OFIX_PriceOffset, OFIX_Body, 0, 4, "451=", "NetChgPrevDay" },
-    { 452, OFIX_Int, OFIX_Body, 0, 4, "452=", "PartyRole" },
+    { 452, OFIX_Int, OFIX_Body, 0, 4, "452=", "PartyRole", &enum452 },
     { 453, OFIX_NumInGroup, OFIX_Body, 0, 4, "453=", "NoPartyIDs" },
     { 454, OFIX_NumInGroup, OFIX_Body, 0, 4, "454=", "NoSecurityAltID" },
     { 455, OFIX_String, OFIX_Body, 0, 4, "455=", "SecurityAltID" },
@@ -466,12 +599,12 @@ static struct _ofixTagSpec	tags[] = {
     { 457, OFIX_NumInGroup, OFIX_Body, 0, 4, "457=", "NoUnderlyingSecurityAltID" },
     { 458, OFIX_String, OFIX_Body, 0, 4, "458=", "UnderlyingSecurityAltID" },
     { 459, OFIX_String, OFIX_Body, 0, 4, "459=", "UnderlyingSecurityAltIDSource" },
-    { 460, OFIX_Int, OFIX_Body, 0, 4, "460=", "Product" },
+    { 460, OFIX_Int, OFIX_Body, 0, 4, "460=", "Product", &enum460 },
     { 461, OFIX_String, OFIX_Body, 0, 4, "461=", "CFICode" },
     { 462, OFIX_Int, OFIX_Body, 0, 4, "462=", "UnderlyingProduct" },
     { 463, OFIX_String, OFIX_Body, 0, 4, "463=", "UnderlyingCFICode" },
     { 464, OFIX_Boolean, OFIX_Body, 0, 4, "464=", "TestMessageIndicator" },
-    { 465, OFIX_Int, OFIX_Body, 0, 4, "465=", "QuantityType" },
+    { 465, OFIX_Int, OFIX_Body, 0, 4, "465=", "QuantityType", &enum465 },
     { 466, OFIX_String, OFIX_Body, 0, 4, "466=", "BookingRefID" },
     { 467, OFIX_String, OFIX_Body, 0, 4, "467=", "IndividualAllocID" },
     { 468, OFIX_Char, OFIX_Body, 0, 4, "468=", "RoundingDirection" },
@@ -487,13 +620,13 @@ static struct _ofixTagSpec	tags[] = {
     { 478, OFIX_Currency, OFIX_Body, 0, 4, "478=", "CashDistribCurr" },
     { 479, OFIX_Currency, OFIX_Body, 0, 4, "479=", "CommCurrency" },
     { 480, OFIX_Char, OFIX_Body, 0, 4, "480=", "CancellationRights" },
-    { 481, OFIX_Char, OFIX_Body, 0, 4, "481=", "MoneyLaunderingStatus" },
+    { 481, OFIX_Char, OFIX_Body, 0, 4, "481=", "MoneyLaunderingStatus", &enum481 },
     { 482, OFIX_String, OFIX_Body, 0, 4, "482=", "MailingInst" },
     { 483, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "483=", "TransBkdTime" },
     { 484, OFIX_Char, OFIX_Body, 0, 4, "484=", "ExecPriceType" },
     { 485, OFIX_Float, OFIX_Body, 0, 4, "485=", "ExecPriceAdjustment" },
     { 486, OFIX_LocalMktDate, OFIX_Body, 0, 4, "486=", "DateOfBirth" },
-    { 487, OFIX_Char, OFIX_Body, 0, 4, "487=", "TradeReportTransType" },
+    { 487, OFIX_Char, OFIX_Body, 0, 4, "487=", "TradeReportTransType", &enum487 },
     { 488, OFIX_String, OFIX_Body, 0, 4, "488=", "CardHolderName" },
     { 489, OFIX_String, OFIX_Body, 0, 4, "489=", "CardNumber" },
     { 490, OFIX_LocalMktDate, OFIX_Body, 0, 4, "490=", "CardExpDate" },
@@ -520,7 +653,7 @@ static struct _ofixTagSpec	tags[] = {
     { 511, OFIX_String, OFIX_Body, 0, 4, "511=", "RegistEmail" },
     { 512, OFIX_Percentage, OFIX_Body, 0, 4, "512=", "DistribPercentage" },
     { 513, OFIX_String, OFIX_Body, 0, 4, "513=", "RegistID" },
-    { 514, OFIX_Char, OFIX_Body, 0, 4, "514=", "RegistTransType" },
+    { 514, OFIX_Char, OFIX_Body, 0, 4, "514=", "RegistTransType", &enum514 },
     { 515, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "515=", "ExecValuationPoint" },
     { 516, OFIX_Percentage, OFIX_Body, 0, 4, "516=", "OrderPercent" },
     { 517, OFIX_Char, OFIX_Body, 0, 4, "517=", "OwnershipType" },
@@ -528,70 +661,70 @@ static struct _ofixTagSpec	tags[] = {
     { 519, OFIX_Int, OFIX_Body, 0, 4, "519=", "ContAmtType" },
     { 520, OFIX_Float, OFIX_Body, 0, 4, "520=", "ContAmtValue" },
     { 521, OFIX_Currency, OFIX_Body, 0, 4, "521=", "ContAmtCurr" },
-    { 522, OFIX_Int, OFIX_Body, 0, 4, "522=", "OwnerType" },
+    { 522, OFIX_Int, OFIX_Body, 0, 4, "522=", "OwnerType", &enum522 },
     { 523, OFIX_String, OFIX_Body, 0, 4, "523=", "PartySubID" },
     { 524, OFIX_String, OFIX_Body, 0, 4, "524=", "NestedPartyID" },
     { 525, OFIX_Char, OFIX_Body, 0, 4, "525=", "NestedPartyIDSource" },
     { 526, OFIX_String, OFIX_Body, 0, 4, "526=", "SecondaryClOrdID" },
     { 527, OFIX_String, OFIX_Body, 0, 4, "527=", "SecondaryExecID" },
-    { 528, OFIX_Char, OFIX_Body, 0, 4, "528=", "OrderCapacity" },
-    { 529, OFIX_MultipleValueString, OFIX_Body, 0, 4, "529=", "OrderRestrictions" },
-    { 530, OFIX_Char, OFIX_Body, 0, 4, "530=", "MassCancelRequestType" },
-    { 531, OFIX_Char, OFIX_Body, 0, 4, "531=", "MassCancelResponse" },
+    { 528, OFIX_Char, OFIX_Body, 0, 4, "528=", "OrderCapacity", &enum528 },
+    { 529, OFIX_MultipleValueString, OFIX_Body, 0, 4, "529=", "OrderRestrictions", &enum529 },
+    { 530, OFIX_Char, OFIX_Body, 0, 4, "530=", "MassCancelRequestType", &enum530 },
+    { 531, OFIX_Char, OFIX_Body, 0, 4, "531=", "MassCancelResponse", &enum531 },
     { 532, OFIX_Char, OFIX_Body, 0, 4, "532=", "MassCancelRejectReason" },
     { 533, OFIX_Int, OFIX_Body, 0, 4, "533=", "TotalAffectedOrders" },
     { 534, OFIX_Int, OFIX_Body, 0, 4, "534=", "NoAffectedOrders" },
     { 535, OFIX_String, OFIX_Body, 0, 4, "535=", "AffectedOrderID" },
     { 536, OFIX_String, OFIX_Body, 0, 4, "536=", "AffectedSecondaryOrderID" },
-    { 537, OFIX_Int, OFIX_Body, 0, 4, "537=", "QuoteType" },
+    { 537, OFIX_Int, OFIX_Body, 0, 4, "537=", "QuoteType", &enum537 },
     { 538, OFIX_Int, OFIX_Body, 0, 4, "538=", "NestedPartyRole" },
     { 539, OFIX_NumInGroup, OFIX_Body, 0, 4, "539=", "NoNestedPartyIDs" },
     { 540, OFIX_Amt, OFIX_Body, 0, 4, "540=", "TotalAccruedInterestAmt" },
     { 541, OFIX_LocalMktDate, OFIX_Body, 0, 4, "541=", "MaturityDate" },
     { 542, OFIX_LocalMktDate, OFIX_Body, 0, 4, "542=", "UnderlyingMaturityDate" },
-    { 543, OFIX_String, OFIX_Body, 0, 4, "543=", "InstrRegistry" },
-    { 544, OFIX_Char, OFIX_Body, 0, 4, "544=", "CashMargin" },
+    { 543, OFIX_String, OFIX_Body, 0, 4, "543=", "InstrRegistry", &enum543 },
+    { 544, OFIX_Char, OFIX_Body, 0, 4, "544=", "CashMargin", &enum544 },
     { 545, OFIX_String, OFIX_Body, 0, 4, "545=", "NestedPartySubID" },
-    { 546, OFIX_MultipleValueString, OFIX_Body, 0, 4, "546=", "Scope" },
+    { 546, OFIX_MultipleValueString, OFIX_Body, 0, 4, "546=", "Scope", &enum546 },
     { 547, OFIX_Boolean, OFIX_Body, 0, 4, "547=", "MDImplicitDelete" },
     { 548, OFIX_String, OFIX_Body, 0, 4, "548=", "CrossID" },
-    { 549, OFIX_Int, OFIX_Body, 0, 4, "549=", "CrossType" },
+    { 549, OFIX_Int, OFIX_Body, 0, 4, "549=", "CrossType", &enum549 },
     { 550, OFIX_Int, OFIX_Body, 0, 4, "550=", "CrossPrioritization" },
     { 551, OFIX_String, OFIX_Body, 0, 4, "551=", "OrigCrossID" },
-    { 552, OFIX_NumInGroup, OFIX_Body, 0, 4, "552=", "NoSides" },
+    { 552, OFIX_NumInGroup, OFIX_Body, 0, 4, "552=", "NoSides", &enum552 },
     { 553, OFIX_String, OFIX_Body, 0, 4, "553=", "Username" },
     { 554, OFIX_String, OFIX_Body, 0, 4, "554=", "Password" },
     { 555, OFIX_NumInGroup, OFIX_Body, 0, 4, "555=", "NoLegs" },
     { 556, OFIX_Currency, OFIX_Body, 0, 4, "556=", "LegCurrency" },
     { 557, OFIX_Int, OFIX_Body, 0, 4, "557=", "TotalNumSecurityTypes" },
     { 558, OFIX_NumInGroup, OFIX_Body, 0, 4, "558=", "NoSecurityTypes" },
-    { 559, OFIX_Int, OFIX_Body, 0, 4, "559=", "SecurityListRequestType" },
-    { 560, OFIX_Int, OFIX_Body, 0, 4, "560=", "SecurityRequestResult" },
+    { 559, OFIX_Int, OFIX_Body, 0, 4, "559=", "SecurityListRequestType", &enum559 },
+    { 560, OFIX_Int, OFIX_Body, 0, 4, "560=", "SecurityRequestResult", &enum560 },
     { 561, OFIX_Qty, OFIX_Body, 0, 4, "561=", "RoundLot" },
     { 562, OFIX_Qty, OFIX_Body, 0, 4, "562=", "MinTradeVol" },
     { 563, OFIX_Int, OFIX_Body, 0, 4, "563=", "MultiLegRptTypeReq" },
     { 564, OFIX_Char, OFIX_Body, 0, 4, "564=", "LegPositionEffect" },
     { 565, OFIX_Int, OFIX_Body, 0, 4, "565=", "LegCoveredOrUncovered" },
     { 566, OFIX_Price, OFIX_Body, 0, 4, "566=", "LegPrice" },
-    { 567, OFIX_Int, OFIX_Body, 0, 4, "567=", "TradSesStatusRejReason" },
+    { 567, OFIX_Int, OFIX_Body, 0, 4, "567=", "TradSesStatusRejReason", &enum567 },
     { 568, OFIX_String, OFIX_Body, 0, 4, "568=", "TradeRequestID" },
-    { 569, OFIX_Int, OFIX_Body, 0, 4, "569=", "TradeRequestType" },
+    { 569, OFIX_Int, OFIX_Body, 0, 4, "569=", "TradeRequestType", &enum569 },
     { 570, OFIX_Boolean, OFIX_Body, 0, 4, "570=", "PreviouslyReported" },
     { 571, OFIX_String, OFIX_Body, 0, 4, "571=", "TradeReportID" },
     { 572, OFIX_String, OFIX_Body, 0, 4, "572=", "TradeReportRefID" },
-    { 573, OFIX_Char, OFIX_Body, 0, 4, "573=", "MatchStatus" },
-    { 574, OFIX_String, OFIX_Body, 0, 4, "574=", "MatchType" },
+    { 573, OFIX_Char, OFIX_Body, 0, 4, "573=", "MatchStatus", &enum573 },
+    { 574, OFIX_String, OFIX_Body, 0, 4, "574=", "MatchType", &enum574 },
     { 575, OFIX_Boolean, OFIX_Body, 0, 4, "575=", "OddLot" },
     { 576, OFIX_Int, OFIX_Body, 0, 4, "576=", "NoClearingInstructions" },
-    { 577, OFIX_Int, OFIX_Body, 0, 4, "577=", "ClearingInstruction" },
+    { 577, OFIX_Int, OFIX_Body, 0, 4, "577=", "ClearingInstruction", &enum577 },
     { 578, OFIX_String, OFIX_Body, 0, 4, "578=", "TradeInputSource" },
     { 579, OFIX_String, OFIX_Body, 0, 4, "579=", "TradeInputDevice" },
     { 580, OFIX_Int, OFIX_Body, 0, 4, "580=", "NoDates" },
-    { 581, OFIX_Int, OFIX_Body, 0, 4, "581=", "AccountType" },
+    { 581, OFIX_Int, OFIX_Body, 0, 4, "581=", "AccountType", &enum581 },
     { 582, OFIX_Int, OFIX_Body, 0, 4, "582=", "CustOrderCapacity" },
     { 583, OFIX_String, OFIX_Body, 0, 4, "583=", "ClOrdLinkID" },
     { 584, OFIX_String, OFIX_Body, 0, 4, "584=", "MassStatusReqID" },
-    { 585, OFIX_Int, OFIX_Body, 0, 4, "585=", "MassStatusReqType" },
+    { 585, OFIX_Int, OFIX_Body, 0, 4, "585=", "MassStatusReqType", &enum585 },
     { 586, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "586=", "OrigOrdModTime" },
     { 587, OFIX_Char, OFIX_Body, 0, 4, "587=", "LegSettlmntTyp" },
     { 588, OFIX_LocalMktDate, OFIX_Body, 0, 4, "588=", "LegFutSettDate" },
@@ -632,7 +765,7 @@ static struct _ofixTagSpec	tags[] = {
     { 623, OFIX_Float, OFIX_Body, 0, 4, "623=", "LegRatioQty" },
     { 624, OFIX_Char, OFIX_Body, 0, 4, "624=", "LegSide" },
     { 625, OFIX_String, OFIX_Body, 0, 4, "625=", "TradingSessionSubID" },
-    { 626, OFIX_Int, OFIX_Body, 0, 4, "626=", "AllocType" },
+    { 626, OFIX_Int, OFIX_Body, 0, 4, "626=", "AllocType", &enum626 },
     { 627, OFIX_NumInGroup, OFIX_Header, 0, 4, "627=", "NoHops" },
     { 628, OFIX_String, OFIX_Header, 0, 4, "628=", "HopCompID" },
     { 629, OFIX_UTCTimestamp, OFIX_Header, 0, 4, "629=", "HopSendingTime" },
@@ -644,7 +777,7 @@ static struct _ofixTagSpec	tags[] = {
     { 635, OFIX_String, OFIX_Body, 0, 4, "635=", "ClearingFeeIndicator" },
     { 636, OFIX_Boolean, OFIX_Body, 0, 4, "636=", "WorkingIndicator" },
     { 637, OFIX_Price, OFIX_Body, 0, 4, "637=", "LegLastPx" },
-    { 638, OFIX_Int, OFIX_Body, 0, 4, "638=", "PriorityIndicator" },
+    { 638, OFIX_Int, OFIX_Body, 0, 4, "638=", "PriorityIndicator", &enum638 },
     { 639, OFIX_PriceOffset, OFIX_Body, 0, 4, "639=", "PriceImprovement" },
     { 640, OFIX_Price, OFIX_Body, 0, 4, "640=", "Price2" },
     { 641, OFIX_PriceOffset, OFIX_Body, 0, 4, "641=", "LastForwardPoints2" },
@@ -659,7 +792,7 @@ static struct _ofixTagSpec	tags[] = {
     { 650, OFIX_Boolean, OFIX_Body, 0, 4, "650=", "LegalConfirm" },
     { 651, OFIX_Price, OFIX_Body, 0, 4, "651=", "UnderlyingLastPx" },
     { 652, OFIX_Qty, OFIX_Body, 0, 4, "652=", "UnderlyingLastQty" },
-    { 653, OFIX_Int, OFIX_Body, 0, 4, "653=", "SecDefStatus" },
+    { 653, OFIX_Int, OFIX_Body, 0, 4, "653=", "SecDefStatus", &enum653 },
     { 654, OFIX_String, OFIX_Body, 0, 4, "654=", "LegRefID" },
     { 655, OFIX_String, OFIX_Body, 0, 4, "655=", "ContraLegRefID" },
     { 656, OFIX_Float, OFIX_Body, 0, 4, "656=", "SettlCurrBidFxRate" },
@@ -674,6 +807,7 @@ static struct _ofixTagSpec	tags[] = {
 
 static struct _ofixGroupSpec	HeartbeatGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -693,6 +827,8 @@ static struct _ofixMsgSpec	Heartbeat = {
     "0", // type
     "Heartbeat", // name
     {0,0,0,0,0,0,0,0,1,2,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,8,9,0,30,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041900022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     HeartbeatGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -735,6 +871,7 @@ static struct _ofixMsgSpec	Heartbeat = {
 
 static struct _ofixGroupSpec	TestRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -754,6 +891,8 @@ static struct _ofixMsgSpec	TestRequest = {
     "1", // type
     "TestRequest", // name
     {0,0,0,0,0,0,0,0,1,2,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,8,9,0,30,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041900022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TestRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -796,6 +935,7 @@ static struct _ofixMsgSpec	TestRequest = {
 
 static struct _ofixGroupSpec	ResendRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -815,6 +955,8 @@ static struct _ofixMsgSpec	ResendRequest = {
     "2", // type
     "ResendRequest", // name
     {0,0,0,0,0,0,0,29,1,2,33,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,9,0,31,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00010780ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00010780ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ResendRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -858,6 +1000,7 @@ static struct _ofixMsgSpec	ResendRequest = {
 
 static struct _ofixGroupSpec	RejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -877,6 +1020,8 @@ static struct _ofixMsgSpec	Reject = {
     "3", // type
     "Reject", // name
     {0,0,0,0,0,0,0,0,1,2,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,29,0,0,0,4,11,0,21,0,0,0,5,13,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,8,9,0,36,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,30,31,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112200c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716280c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x003e000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     RejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -925,6 +1070,7 @@ static struct _ofixMsgSpec	Reject = {
 
 static struct _ofixGroupSpec	SequenceResetGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -944,6 +1090,8 @@ static struct _ofixMsgSpec	SequenceReset = {
     "4", // type
     "SequenceReset", // name
     {0,0,0,0,0,0,0,0,1,2,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,30,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,9,0,31,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,29,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112001c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316081c00000700ULL,0x0c1800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SequenceResetGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -987,6 +1135,7 @@ static struct _ofixMsgSpec	SequenceReset = {
 
 static struct _ofixGroupSpec	LogoutGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1006,6 +1155,8 @@ static struct _ofixMsgSpec	Logout = {
     "5", // type
     "Logout", // name
     {0,0,0,0,0,0,0,0,1,2,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,8,9,0,32,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     LogoutGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1050,6 +1201,7 @@ static struct _ofixMsgSpec	Logout = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1060,6 +1212,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup627 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -1069,6 +1222,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup454 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup199 = {
     199, // NoIOIQualifiers
+    {0x0000000000000000ULL,0x0000010000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 104, false }, // IOIQualifier
 	{ 0, false }
@@ -1077,6 +1231,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup199 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup215 = {
     215, // NoRoutingIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000003000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 216, false }, // RoutingType
 	{ 217, false }, // RoutingID
@@ -1098,6 +1253,8 @@ static struct _ofixMsgSpec	IndicationOfInterest = {
     "6", // type
     "IndicationOfInterest", // name
     {0,0,0,0,0,0,0,0,1,2,88,0,0,0,0,70,0,0,0,0,0,0,35,29,0,72,31,67,30,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,69,0,0,0,34,4,11,0,21,0,65,32,5,13,75,0,78,0,71,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,8,9,0,86,0,0,0,20,0,0,0,0,0,0,0,0,59,62,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,73,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,40,0,54,0,0,0,55,58,0,0,0,0,23,24,0,80,0,0,81,85,82,83,84,57,42,43,45,46,47,0,0,56,0,0,0,0,0,0,0,44,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,60,61,63,64,0,0,76,77,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,37,38,0,0,0,66,0,0,0,0,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d2000c18800700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x57d7180c1ec08700ULL,0x04180d022e000002ULL,0x000000800023c007ULL,0x8001809fffb0c580ULL,0x0000000000000000ULL,0x0006000cf8000000ULL,0x0000008000000000ULL,0x0000000001c231c0ULL,0x00000000a0000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     IndicationOfInterestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1196,6 +1353,7 @@ static struct _ofixMsgSpec	IndicationOfInterest = {
 
 static struct _ofixGroupSpec	AdvertisementGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1206,6 +1364,7 @@ static struct _ofixGroupSpec	AdvertisementGroup627 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -1225,6 +1384,8 @@ static struct _ofixMsgSpec	Advertisement = {
     "7", // type
     "Advertisement", // name
     {0,0,29,31,65,30,0,0,1,2,80,0,0,0,0,68,0,0,0,0,0,0,35,0,0,0,0,0,0,0,75,0,0,0,10,3,0,0,0,0,0,0,0,19,67,0,0,0,34,4,11,0,21,66,0,32,5,13,71,0,70,0,0,0,0,33,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,79,8,9,0,78,0,0,0,20,0,0,0,0,0,0,0,0,59,62,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,54,0,0,0,55,58,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,57,42,43,45,46,47,0,0,56,0,0,0,0,0,0,0,44,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,25,60,61,63,64,0,0,72,73,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,37,38,0,0,0,0,0,0,0,0,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01b2000c00000734ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17b7180c4040873cULL,0x04180c022e000802ULL,0x000000800023c003ULL,0x8001809f8030c500ULL,0x0000000000000000ULL,0x0006000cf8010000ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00000000a0000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     AdvertisementGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1315,6 +1476,7 @@ static struct _ofixMsgSpec	Advertisement = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1325,6 +1487,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup627 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -1336,6 +1499,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup453 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup382 = {
     382, // NoContraBrokers
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0080000000020000ULL,0x0060000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000008000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 375, false }, // ContraBroker
 	{ 337, false }, // ContraTrader
@@ -1348,6 +1512,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup382 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -1357,6 +1522,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup454 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -1366,6 +1532,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup232 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup518 = {
     518, // NoContAmts
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000380ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 519, false }, // ContAmtType
 	{ 520, false }, // ContAmtValue
@@ -1376,8 +1543,9 @@ static struct _ofixGroupSpec	ExecutionReportGroup518 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000008000000ULL,0x2001ffff9ff01800ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 600, true }, // LegSymbol
+	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
 	{ 602, false }, // LegSecurityID
 	{ 603, false }, // LegSecurityIDSource
@@ -1426,6 +1594,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup555 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -1435,6 +1604,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup604 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -1463,6 +1633,8 @@ static struct _ofixMsgSpec	ExecutionReport = {
     "8", // type
     "ExecutionReport", // name
     {0,50,0,0,0,0,131,0,1,2,190,33,139,140,130,107,0,43,114,44,0,164,62,0,0,0,0,0,0,128,125,121,119,0,10,3,0,29,95,46,100,34,0,19,102,0,0,118,61,4,11,0,21,0,92,59,5,13,169,110,137,0,0,55,56,60,39,0,0,0,0,0,0,0,0,136,0,167,0,0,0,0,0,0,0,0,0,0,0,189,8,9,0,188,0,0,0,20,0,103,0,0,0,48,0,0,86,89,0,0,165,166,0,138,0,6,15,0,159,160,161,0,22,0,0,0,113,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,45,129,96,0,0,162,163,150,152,153,0,0,0,0,0,0,0,66,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,173,172,123,124,0,0,30,0,67,0,81,0,0,0,82,85,0,0,168,104,23,24,0,0,0,0,143,0,144,145,146,84,69,70,72,73,74,37,151,83,93,0,0,147,148,158,157,71,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,154,155,156,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,0,0,0,25,87,88,90,91,0,0,170,171,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,108,109,49,0,0,149,38,0,0,0,0,0,105,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,101,132,133,134,135,0,0,0,0,112,0,0,0,0,0,0,0,0,0,175,0,0,0,0,0,0,0,0,0,0,36,63,0,0,0,0,0,64,65,0,0,0,94,0,0,98,99,77,78,79,0,0,0,0,0,0,141,176,177,0,180,182,183,0,0,0,0,0,0,0,0,179,0,0,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,178,0,181,97,0,186,0,0,0,0,0,0,0,31,32,115,116,0,0,0,0,0,0,0,0,0,0,0,68,0,76,57,0,0,0,40,42,0,41,0,0,0,187,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,117,35,0,0,0,0,0,52,53,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,28,0,0,0,0,0,0,0,58,47,0,184,185,0,174,0,0,0,0,0,0,0,0,0,122,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d200ac00024740ULL,0x0000000000000000ULL,0x0000000000c00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd79bede06eff42ULL,0x45dacc8a2e002807ULL,0x00000180f9c3c003ULL,0xff01fffff43cc54fULL,0x000000000000001eULL,0x6786000cf8030000ULL,0x84610f8000000030ULL,0x0002403b81f231f1ULL,0x007008b3ac03fbdaULL,0xf87bfffffff0f8e0ULL,0x000000000000d802ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ExecutionReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1663,6 +1835,7 @@ static struct _ofixMsgSpec	ExecutionReport = {
 
 static struct _ofixGroupSpec	OrderCancelRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1682,6 +1855,8 @@ static struct _ofixMsgSpec	OrderCancelReject = {
     "9", // type
     "OrderCancelReject", // name
     {0,39,0,0,0,0,0,0,1,2,50,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,29,0,35,0,34,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,45,0,42,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,8,9,0,48,0,0,0,20,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,46,47,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,33,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x011202ac00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17160aac00000f02ULL,0x041800422e000004ULL,0x000000000003c003ULL,0x0000002000300040ULL,0x0000000000000000ULL,0x0006000c08000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x10780000000004a0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderCancelRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1742,6 +1917,7 @@ static struct _ofixMsgSpec	OrderCancelReject = {
 
 static struct _ofixGroupSpec	LogonGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1752,6 +1928,7 @@ static struct _ofixGroupSpec	LogonGroup627 = {
 
 static struct _ofixGroupSpec	LogonGroup384 = {
     384, // NoMsgTypes
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 372, false }, // RefMsgType
 	{ 385, false }, // MsgDirection
@@ -1771,6 +1948,8 @@ static struct _ofixMsgSpec	Logon = {
     "A", // type
     "Logon", // name
     {0,0,0,0,0,0,0,0,1,2,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,8,9,0,39,0,31,32,20,29,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,33,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000100400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x04181007ae000000ULL,0x000000000003e003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x8016000008000000ULL,0x0000000000000003ULL,0x0000000000010000ULL,0x0000060000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     LogonGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1822,6 +2001,7 @@ static struct _ofixMsgSpec	Logon = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1832,6 +2012,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup627 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -1841,8 +2022,9 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup457 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup146 = {
     146, // NoRelatedSym
+    {0x0481000000408000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x0000000cf0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000800a0000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -1888,6 +2070,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup146 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -1897,8 +2080,9 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup454 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 600, true }, // LegSymbol
+	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
 	{ 602, false }, // LegSecurityID
 	{ 603, false }, // LegSecurityIDSource
@@ -1940,6 +2124,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup555 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -1963,6 +2148,8 @@ static struct _ofixMsgSpec	DerivativeSecurityList = {
     "AA", // type
     "DerivativeSecurityList", // name
     {0,0,0,0,0,0,0,0,1,2,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,8,9,0,68,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,43,44,45,46,47,53,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,60,63,59,34,39,32,33,40,0,54,55,56,0,0,29,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,62,64,65,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,51,52,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800007c003ULL,0xffff809f8030c500ULL,0x3bfe000000000003ULL,0x00063c0cf8010005ULL,0x0018000000000200ULL,0x0000000001c0ffc0ULL,0x00011800e0000000ULL,0x007bffffffff0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     DerivativeSecurityListGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1996,7 +2183,7 @@ static struct _ofixMsgSpec	DerivativeSecurityList = {
 	{ 320, true }, // SecurityReqID
 	{ 322, true }, // SecurityResponseID
 	{ 560, true }, // SecurityRequestResult
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -2043,6 +2230,7 @@ static struct _ofixMsgSpec	DerivativeSecurityList = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2053,6 +2241,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -2064,6 +2253,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 467, false }, // IndividualAllocID
@@ -2074,6 +2264,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -2083,6 +2274,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -2092,8 +2284,9 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000008000000ULL,0x0001ffff9ff01800ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 600, true }, // LegSymbol
+	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
 	{ 602, false }, // LegSecurityID
 	{ 603, false }, // LegSecurityIDSource
@@ -2141,6 +2334,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup555 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -2150,6 +2344,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup604 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -2177,6 +2372,8 @@ static struct _ofixMsgSpec	NewOrderMultileg = {
     "AB", // type
     "NewOrderMultileg", // name
     {0,33,0,0,0,0,0,0,1,2,134,29,108,109,0,98,0,0,44,0,0,43,54,101,0,0,0,0,0,0,0,0,0,0,10,3,0,0,89,0,94,0,0,19,96,0,0,0,53,4,11,0,21,0,50,51,5,13,117,103,87,0,0,39,40,52,0,0,0,0,0,0,0,0,0,0,0,120,38,0,0,49,0,0,0,0,0,0,0,133,8,9,0,132,0,0,0,20,0,97,47,0,0,0,0,0,78,81,0,0,45,46,0,0,86,6,15,102,131,0,116,115,22,0,0,0,106,0,7,17,0,0,0,0,0,0,0,0,0,0,84,0,12,14,16,18,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,0,73,121,0,0,74,77,0,0,122,123,23,24,0,0,0,0,0,0,0,0,0,76,61,62,64,65,66,0,0,75,0,0,0,0,0,0,0,63,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,79,80,82,83,0,0,118,119,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,99,100,0,0,0,0,0,0,0,0,48,0,124,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,107,0,0,0,0,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,55,0,0,0,0,0,56,57,0,0,0,88,0,0,92,93,69,70,71,0,0,0,0,0,0,110,126,127,0,0,0,0,0,0,0,0,0,0,0,0,129,0,0,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,128,0,0,91,0,0,0,0,0,0,0,0,0,30,0,112,113,0,0,0,0,0,0,0,0,0,0,0,60,0,68,41,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,114,31,0,0,0,0,0,35,36,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2010c00200f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7194c00e4bf02ULL,0x477ccc1a2e03e003ULL,0x000001800103d003ULL,0xff01809f803ccd00ULL,0x0000000000000002ULL,0x0306000cf8010000ULL,0x8001088000000034ULL,0x0002400381fa31f1ULL,0x00780803ac037812ULL,0x087bfffffff0f8e0ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     NewOrderMultilegGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2321,6 +2518,7 @@ static struct _ofixMsgSpec	NewOrderMultileg = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2331,6 +2529,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup627 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -2342,6 +2541,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup453 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 467, false }, // IndividualAllocID
@@ -2352,6 +2552,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup78 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -2361,6 +2562,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup386 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -2370,8 +2572,9 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup454 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000008000000ULL,0x0001ffff9ff01800ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 600, true }, // LegSymbol
+	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
 	{ 602, false }, // LegSecurityID
 	{ 603, false }, // LegSecurityIDSource
@@ -2419,6 +2622,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup555 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -2428,6 +2632,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup604 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -2455,6 +2660,8 @@ static struct _ofixMsgSpec	MultilegOrderCancelReplaceRequest = {
     "AC", // type
     "MultilegOrderCancelReplaceRequest", // name
     {0,36,0,0,0,0,0,0,1,2,137,31,111,112,0,101,0,0,47,0,0,46,57,104,0,0,0,0,0,0,0,0,0,0,10,3,0,29,92,0,97,30,0,19,99,0,0,0,56,4,11,0,21,0,53,54,5,13,120,106,90,0,0,42,43,55,0,0,0,0,0,0,0,0,0,0,0,123,41,0,0,52,0,0,0,0,0,0,0,136,8,9,0,135,0,0,0,20,0,100,50,0,0,0,0,0,81,84,0,0,48,49,0,0,89,6,15,105,134,0,119,118,22,0,0,0,109,0,7,17,0,0,0,0,0,0,0,0,0,0,87,0,12,14,16,18,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,76,124,0,0,77,80,0,0,125,126,23,24,0,0,0,0,0,0,0,0,0,79,64,65,67,68,69,0,0,78,0,0,0,0,0,0,0,66,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,82,83,85,86,0,0,121,122,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,102,103,0,0,0,0,0,0,0,0,51,0,127,128,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,0,110,0,0,0,0,108,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,58,0,0,0,0,0,59,60,0,0,0,91,0,0,95,96,72,73,74,0,0,0,0,0,0,113,129,130,0,0,0,0,0,0,0,0,0,0,0,0,132,0,0,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,94,0,0,0,0,0,0,0,0,0,32,0,115,116,0,0,0,0,0,0,0,0,0,0,0,63,0,71,44,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,117,33,0,0,34,0,0,38,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2030c00200f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd71b6c00e4bf02ULL,0x477ccc1a2e03e003ULL,0x000001800103d003ULL,0xff01809f803ccd00ULL,0x0000000000000002ULL,0x0306000cf8010000ULL,0x8001088000000034ULL,0x0002400381fa31f1ULL,0x00780803ac037812ULL,0x087bfffffff0fce0ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MultilegOrderCancelReplaceRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2602,6 +2809,7 @@ static struct _ofixMsgSpec	MultilegOrderCancelReplaceRequest = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2612,6 +2820,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup627 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -2623,6 +2832,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup453 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -2632,6 +2842,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup454 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup580 = {
     580, // NoDates
+    {0x1000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 75, false }, // TradeDate
 	{ 60, false }, // TransactTime
@@ -2653,6 +2864,8 @@ static struct _ofixMsgSpec	TradeCaptureReportRequest = {
     "AD", // type
     "TradeCaptureReportRequest", // name
     {0,0,0,0,0,0,0,0,1,2,79,34,0,0,0,0,0,32,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,10,3,0,33,0,0,0,0,0,19,0,0,0,0,39,4,11,0,21,0,71,37,5,13,72,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,8,9,0,77,0,0,0,20,0,0,0,0,0,0,0,0,64,67,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,59,0,0,0,60,63,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,62,47,48,50,51,52,0,0,61,0,0,0,0,0,0,0,49,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,65,66,68,69,0,0,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,41,0,0,0,0,0,42,43,0,0,0,0,0,0,0,0,55,56,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,0,0,35,0,0,0,0,75,76,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d7082c00420f00ULL,0x04180c022e000802ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000000000000080ULL,0x0006000cf8000000ULL,0x8000000000000000ULL,0x0000000001c031f1ULL,0x23000000a0000800ULL,0x007800000000001cULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TradeCaptureReportRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2691,7 +2904,7 @@ static struct _ofixMsgSpec	TradeCaptureReportRequest = {
 	{ 11, false }, // ClOrdID
 	{ 573, false }, // MatchStatus
 	{ 453, false }, // NoPartyIDs
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -2742,6 +2955,7 @@ static struct _ofixMsgSpec	TradeCaptureReportRequest = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2752,6 +2966,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup627 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -2761,6 +2976,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup454 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup552 = {
     552, // NoSides
+    {0x044000200000b802ULL,0x01c0000000022000ULL,0x00000000f8000100ULL,0x0000604000000040ULL,0x0000000000000000ULL,0x2300000c00010000ULL,0x0400000000000000ULL,0x0002000880000020ULL,0x8000000000030040ULL,0x080200000000006dULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 37, true }, // OrderID
@@ -2813,6 +3029,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup552 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -2824,6 +3041,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup453 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup576 = {
     576, // NoClearingInstructions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 577, false }, // ClearingInstruction
 	{ 0, false }
@@ -2832,6 +3050,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup576 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup518 = {
     518, // NoContAmts
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000380ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 519, false }, // ContAmtType
 	{ 520, false }, // ContAmtValue
@@ -2842,6 +3061,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup518 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -2867,6 +3087,8 @@ static struct _ofixMsgSpec	TradeCaptureReport = {
     "AE", // type
     "TradeCaptureReport", // name
     {0,0,0,0,0,0,0,0,1,2,90,0,0,0,0,0,0,34,0,0,0,0,41,0,0,0,0,0,0,0,80,77,76,0,10,3,0,0,71,0,0,0,0,19,0,0,0,0,40,4,11,0,21,0,0,38,5,13,0,0,82,0,0,83,84,39,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,89,8,9,0,88,0,0,0,20,0,0,0,0,0,0,0,0,65,68,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,32,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,79,0,0,0,0,46,0,60,0,0,0,61,64,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,63,48,49,51,52,53,0,0,62,0,0,0,0,0,0,0,50,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,66,67,69,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,43,44,0,0,0,0,0,0,74,75,56,57,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,55,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,37,29,33,85,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192000d80000700ULL,0x0000000000000800ULL,0x0000000000400000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0c00010000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97d7086dc042bf02ULL,0x05d80c022e022803ULL,0x00000080f943cf03ULL,0x8001e0df8030c54cULL,0x0000000000000000ULL,0x2706000cf8010000ULL,0x8400000000000000ULL,0x0002008881f031f1ULL,0xfd000100a0038bd0ULL,0x087a00000000006fULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TradeCaptureReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2967,6 +3189,7 @@ static struct _ofixMsgSpec	TradeCaptureReport = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2977,6 +3200,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -2988,6 +3212,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -2997,6 +3222,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup454 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -3018,6 +3244,8 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
     "AF", // type
     "OrderMassStatusRequest", // name
     {0,32,0,0,0,0,0,0,1,2,105,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,37,4,11,0,21,0,102,35,5,13,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,8,9,0,103,0,0,0,20,0,0,0,0,0,0,0,0,62,65,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,58,61,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,60,45,46,48,49,50,0,0,59,0,0,0,0,0,0,0,47,56,78,79,80,81,82,83,89,0,0,0,0,0,0,0,51,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,96,99,95,70,75,68,69,76,0,90,91,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,25,63,64,66,67,0,0,0,0,0,0,0,0,0,0,97,98,100,101,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,39,0,0,72,0,0,40,41,73,74,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,77,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,0,0,0,0,0,86,87,88,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000300ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x03d7080c00400702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x80ff809f8030c500ULL,0x3bfe000000000001ULL,0x00063c00f8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00000000e0000800ULL,0x007a0000000f0300ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderMassStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3054,7 +3282,7 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
 	{ 1, false }, // Account
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -3087,7 +3315,7 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
 	{ 107, false }, // SecurityDesc
 	{ 350, false }, // EncodedSecurityDescLen
 	{ 351, false }, // EncodedSecurityDesc
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -3133,6 +3361,7 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3143,6 +3372,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup627 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup146 = {
     146, // NoRelatedSym
+    {0x90c1114000408000ULL,0x40000c0000000003ULL,0x0000008001001000ULL,0x800199bff400c503ULL,0x0000800000000000ULL,0x00000000f0010000ULL,0x0000008000000000ULL,0x0000000001c23040ULL,0x00000000a2000000ULL,0x0002000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -3211,6 +3441,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup146 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3220,6 +3451,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup454 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -3241,6 +3473,8 @@ static struct _ofixMsgSpec	QuoteRequestReject = {
     "AG", // type
     "QuoteRequestReject", // name
     {0,0,0,0,0,0,0,0,1,2,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,8,9,0,36,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,29,0,0,0,0,0,0,0,0,0,0,12,14,16,18,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040008ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97d7194c00408700ULL,0x44180c022e000003ULL,0x000000800107d00bULL,0x80019fbff430c503ULL,0x0000800000000000ULL,0x0006000cf8010000ULL,0x0000008000000000ULL,0x0000000001c231c0ULL,0x00000000a2000000ULL,0x007a000000000000ULL,0x0000000000040011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     QuoteRequestRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3289,6 +3523,7 @@ static struct _ofixMsgSpec	QuoteRequestReject = {
 
 static struct _ofixGroupSpec	RFQRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3299,6 +3534,7 @@ static struct _ofixGroupSpec	RFQRequestGroup627 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000001000ULL,0x8001809f8000c500ULL,0x0000800000000000ULL,0x00000000f0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a2000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -3344,6 +3580,7 @@ static struct _ofixGroupSpec	RFQRequestGroup146 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3364,6 +3601,8 @@ static struct _ofixMsgSpec	RFQRequest = {
     "AH", // type
     "RFQRequest", // name
     {0,0,0,0,0,0,0,0,1,2,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,8,9,0,32,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000010ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400700ULL,0x04180c022e000002ULL,0x000000800007d003ULL,0x8001809f8030c500ULL,0x0000800000000080ULL,0x00060000f8010000ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00000000a2000000ULL,0x007a000000000000ULL,0x0000000000000010ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     RFQRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3408,6 +3647,7 @@ static struct _ofixMsgSpec	RFQRequest = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3418,6 +3658,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup627 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -3429,6 +3670,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup453 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3449,6 +3691,8 @@ static struct _ofixMsgSpec	QuoteStatusReport = {
     "AI", // type
     "QuoteStatusReport", // name
     {0,34,0,0,0,0,0,0,1,2,106,0,100,99,0,95,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,90,0,0,19,0,0,0,0,40,4,11,0,21,0,0,38,5,13,0,0,88,0,79,0,89,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,8,9,0,104,0,0,0,20,0,0,102,0,0,0,0,0,65,68,0,0,0,0,0,0,0,6,15,31,0,0,0,0,22,0,0,0,0,0,7,17,0,30,71,72,76,78,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,82,81,83,92,91,0,0,0,0,0,0,46,0,60,0,0,0,61,64,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,63,48,49,51,52,53,0,0,62,0,0,0,0,0,0,0,50,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,25,66,67,69,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,42,0,0,0,0,0,43,44,0,0,0,0,0,0,0,0,56,57,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,47,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,28,0,0,0,84,85,86,87,0,0,0,0,0,0,0,93,94,0,73,74,75,77,29,0,0,0,0,0,0,96,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x5397090c0040b702ULL,0x04380c122e000003ULL,0xf00000801003c0fbULL,0x8001809f8030c503ULL,0x0000020000000000ULL,0x00060000f8010000ULL,0x8000000000000000ULL,0x0000000001c031f1ULL,0x00000000a2000800ULL,0x07fa000000000060ULL,0x00000000000303ecULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     QuoteStatusReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3565,6 +3809,7 @@ static struct _ofixMsgSpec	QuoteStatusReport = {
 
 static struct _ofixGroupSpec	NewsGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3575,6 +3820,7 @@ static struct _ofixGroupSpec	NewsGroup627 = {
 
 static struct _ofixGroupSpec	NewsGroup215 = {
     215, // NoRoutingIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000003000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 216, false }, // RoutingType
 	{ 217, false }, // RoutingID
@@ -3584,8 +3830,9 @@ static struct _ofixGroupSpec	NewsGroup215 = {
 
 static struct _ofixGroupSpec	NewsGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -3624,6 +3871,7 @@ static struct _ofixGroupSpec	NewsGroup146 = {
 
 static struct _ofixGroupSpec	NewsGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3633,6 +3881,7 @@ static struct _ofixGroupSpec	NewsGroup454 = {
 
 static struct _ofixGroupSpec	NewsGroup33 = {
     33, // LinesOfText
+    {0x0400000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 58, true }, // Text
 	{ 354, false }, // EncodedTextLen
@@ -3656,6 +3905,8 @@ static struct _ofixMsgSpec	News = {
     "B", // type
     "News", // name
     {0,0,0,0,0,0,0,0,1,2,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,10,3,0,0,0,0,0,0,29,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,8,9,0,40,0,38,39,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,35,0,31,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,32,33,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000e00000700ULL,0x0000000000000000ULL,0x0000000000100000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x27970c0e00400700ULL,0x04180c03ae000002ULL,0x000000800037c003ULL,0x8001809f83b0c500ULL,0x0000000000000000ULL,0x000600ccf8000000ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00000000a0000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     NewsGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3708,6 +3959,7 @@ static struct _ofixMsgSpec	News = {
 
 static struct _ofixGroupSpec	EmailGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3718,6 +3970,7 @@ static struct _ofixGroupSpec	EmailGroup627 = {
 
 static struct _ofixGroupSpec	EmailGroup215 = {
     215, // NoRoutingIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000003000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 216, false }, // RoutingType
 	{ 217, false }, // RoutingID
@@ -3727,8 +3980,9 @@ static struct _ofixGroupSpec	EmailGroup215 = {
 
 static struct _ofixGroupSpec	EmailGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -3767,6 +4021,7 @@ static struct _ofixGroupSpec	EmailGroup146 = {
 
 static struct _ofixGroupSpec	EmailGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3776,6 +4031,7 @@ static struct _ofixGroupSpec	EmailGroup454 = {
 
 static struct _ofixGroupSpec	EmailGroup33 = {
     33, // LinesOfText
+    {0x0400000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 58, true }, // Text
 	{ 354, false }, // EncodedTextLen
@@ -3799,6 +4055,8 @@ static struct _ofixMsgSpec	Email = {
     "C", // type
     "Email", // name
     {0,0,0,0,0,0,0,0,1,2,44,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,10,3,0,37,0,0,0,0,31,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,8,9,0,42,30,40,41,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,36,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000e00000700ULL,0x0000000040000000ULL,0x0000001000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x07970c2e00400f00ULL,0x04180c03ee000002ULL,0x00000090000fc003ULL,0x8001809f83b0c500ULL,0x0000000000000000ULL,0x0006003cf8000000ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00000000a0000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     EmailGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3853,6 +4111,7 @@ static struct _ofixMsgSpec	Email = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3863,6 +4122,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -3874,6 +4134,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 467, false }, // IndividualAllocID
@@ -3885,6 +4146,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -3896,6 +4158,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup539 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -3905,6 +4168,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3914,6 +4178,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -3938,6 +4203,8 @@ static struct _ofixMsgSpec	NewOrderSingle = {
     "D", // type
     "NewOrderSingle", // name
     {0,34,0,0,0,0,0,0,1,2,146,29,115,116,0,105,0,0,45,0,0,44,54,108,0,0,0,0,0,0,0,0,0,0,10,3,0,0,90,0,95,0,0,19,97,0,0,122,53,4,11,0,21,0,85,51,5,13,125,110,87,0,0,40,41,52,0,0,0,0,0,0,0,0,0,0,0,131,39,0,0,50,0,0,0,0,0,0,0,145,8,9,0,144,0,0,0,20,0,98,48,0,0,0,0,0,78,81,0,0,46,47,0,0,86,6,15,109,143,0,124,123,22,0,0,0,113,0,7,17,0,0,0,0,0,0,0,0,0,0,84,0,12,14,16,18,0,0,0,0,0,0,91,0,0,0,0,0,141,142,0,0,0,0,0,0,0,58,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,128,0,0,0,0,0,0,59,0,73,132,0,0,74,77,0,0,133,134,23,24,0,0,0,0,99,0,100,101,102,76,61,62,64,65,66,33,0,75,88,0,0,103,104,0,0,63,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,79,80,82,83,0,0,126,127,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,106,107,0,0,0,0,0,0,0,0,49,0,135,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,114,0,0,0,0,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,55,0,0,0,0,0,56,57,0,0,0,89,0,0,93,94,69,70,71,0,0,0,0,0,0,117,137,138,0,0,0,0,0,0,0,0,0,0,0,0,140,0,0,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,0,0,92,0,0,0,0,0,0,0,0,0,30,0,119,120,0,0,0,0,0,0,0,0,0,0,0,60,0,68,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,121,31,0,0,0,0,0,36,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,43,0,0,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2010c00200f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7994c00e4bf02ULL,0x477ccc1a2e03e003ULL,0x00000180c103d003ULL,0x80019fbff43ccd03ULL,0x0000000000000000ULL,0x0306000cf8010000ULL,0x8001088000000034ULL,0x0002400381fa31f1ULL,0x00000003ac037812ULL,0x087a00000000e0e0ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     NewOrderSingleGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4094,6 +4361,7 @@ static struct _ofixMsgSpec	NewOrderSingle = {
 
 static struct _ofixGroupSpec	NewOrderListGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -4104,6 +4372,7 @@ static struct _ofixGroupSpec	NewOrderListGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup73 = {
     73, // NoOrders
+    {0x9cc1914000e4b802ULL,0x4364cc180002600bULL,0x00000181c1001000ULL,0x800199bff40ccd03ULL,0x0000000000000000ULL,0x0300000cf0000000ULL,0x0001088000020034ULL,0x0002400081f23060ULL,0x00000001a0034010ULL,0x080000000000e0e0ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, true }, // ClOrdID
 	{ 526, false }, // SecondaryClOrdID
@@ -4226,6 +4495,7 @@ static struct _ofixGroupSpec	NewOrderListGroup73 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -4237,6 +4507,7 @@ static struct _ofixGroupSpec	NewOrderListGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 467, false }, // IndividualAllocID
@@ -4248,6 +4519,7 @@ static struct _ofixGroupSpec	NewOrderListGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -4259,6 +4531,7 @@ static struct _ofixGroupSpec	NewOrderListGroup539 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -4268,6 +4541,7 @@ static struct _ofixGroupSpec	NewOrderListGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -4277,6 +4551,7 @@ static struct _ofixGroupSpec	NewOrderListGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -4302,6 +4577,8 @@ static struct _ofixMsgSpec	NewOrderList = {
     "E", // type
     "NewOrderList", // name
     {0,0,0,0,0,0,0,0,1,2,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,29,0,42,39,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,8,9,0,44,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,40,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,31,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000214ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000400ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7994c00e4bf02ULL,0x477ccc1a2e03e23fULL,0x00000181c103d003ULL,0x80019fbff43ccd03ULL,0x0000000000000000ULL,0x0306000ff8010000ULL,0x80030880c00204f4ULL,0x0002400381fa31f1ULL,0x00000003ac037812ULL,0x087a00000000e0e0ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     NewOrderListGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4358,6 +4635,7 @@ static struct _ofixMsgSpec	NewOrderList = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -4368,6 +4646,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -4379,6 +4658,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -4399,6 +4679,8 @@ static struct _ofixMsgSpec	OrderCancelRequest = {
     "F", // type
     "OrderCancelRequest", // name
     {0,36,0,0,0,0,0,0,1,2,85,31,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,10,3,0,30,74,0,0,29,0,19,0,0,0,0,41,4,11,0,21,0,72,39,5,13,80,0,73,0,0,0,0,40,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,8,9,0,83,0,0,0,20,0,0,0,0,0,0,0,0,66,69,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,61,0,0,0,62,65,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,64,49,50,52,53,54,0,0,63,0,0,0,0,0,0,0,51,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,67,68,70,71,0,0,81,82,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,43,0,0,0,0,0,44,45,0,0,0,0,0,0,77,78,57,58,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,33,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2020c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d70a6c00400f02ULL,0x04180c022e000006ULL,0x000000800103c003ULL,0x8001809f8030c500ULL,0x0000000000000000ULL,0x0106000cf8000000ULL,0x8000000000000000ULL,0x0000000001f031f1ULL,0x00000000a0004810ULL,0x00780000000004a0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4494,6 +4776,7 @@ static struct _ofixMsgSpec	OrderCancelRequest = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -4504,6 +4787,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -4515,6 +4799,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 467, false }, // IndividualAllocID
@@ -4526,6 +4811,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup78 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -4537,6 +4823,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup539 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -4546,6 +4833,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup386 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -4569,6 +4857,8 @@ static struct _ofixMsgSpec	OrderCancelReplaceRequest = {
     "G", // type
     "OrderCancelReplaceRequest", // name
     {0,38,0,0,0,0,0,0,1,2,145,33,116,117,0,110,0,0,49,0,0,48,57,0,0,0,0,0,0,0,0,0,0,0,10,3,0,29,90,0,95,32,0,19,97,0,0,123,56,4,11,0,21,0,87,54,5,13,126,111,88,0,0,44,45,55,36,0,0,0,0,0,0,0,0,0,0,132,43,0,0,0,0,0,0,0,0,0,0,144,8,9,0,143,0,0,0,20,0,98,52,0,0,0,0,0,81,84,0,0,50,51,0,0,135,6,15,0,142,0,125,124,22,0,0,0,114,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,91,0,0,0,0,0,140,141,0,0,0,0,0,0,0,61,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,130,129,0,0,0,0,0,0,62,0,76,133,0,0,77,80,0,0,134,105,23,24,0,0,0,0,99,0,100,101,102,79,64,65,67,68,69,31,0,78,0,0,0,103,104,0,0,66,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,82,83,85,86,0,0,127,128,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,108,109,0,0,0,0,0,0,0,0,53,0,106,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,115,0,0,0,0,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,58,0,0,0,0,0,59,60,0,0,0,89,0,0,93,94,72,73,74,0,0,0,0,0,0,118,136,137,0,0,0,0,0,0,0,0,0,0,0,0,139,0,0,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,0,0,92,0,0,0,0,0,0,0,0,0,34,0,120,121,0,0,0,0,0,0,0,0,0,0,0,63,0,71,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,122,35,0,0,37,0,0,40,41,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,47,0,0,0,0,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2030c00200f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd79b6c0064bf02ULL,0x475ccc1a2e01e007ULL,0x00000180c103c003ULL,0x800198bff43ccd03ULL,0x0000000000000000ULL,0x0306000cf8010000ULL,0x8001088000000034ULL,0x0002400381fa31f1ULL,0x00000003ac037812ULL,0x087a00000000e4e0ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderCancelReplaceRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4724,6 +5014,7 @@ static struct _ofixMsgSpec	OrderCancelReplaceRequest = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -4734,6 +5025,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -4745,6 +5037,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -4765,6 +5058,8 @@ static struct _ofixMsgSpec	OrderStatusRequest = {
     "H", // type
     "OrderStatusRequest", // name
     {0,34,0,0,0,0,0,0,1,2,71,30,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,10,3,0,29,0,0,0,0,0,19,0,0,0,0,37,4,11,0,21,0,68,35,5,13,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,8,9,0,69,0,0,0,20,0,0,0,0,0,0,0,0,62,65,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,58,61,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,60,45,46,48,49,50,0,0,59,0,0,0,0,0,0,0,47,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,63,64,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,39,0,0,0,0,0,40,41,0,0,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d2000c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x03d7082c00400f02ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000000000000000ULL,0x00060000f8000000ULL,0x8000000000000000ULL,0x0000000001c031f1ULL,0x00000000a0004800ULL,0x0078000000000080ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4846,6 +5141,7 @@ static struct _ofixMsgSpec	OrderStatusRequest = {
 
 static struct _ofixGroupSpec	AllocationGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -4856,6 +5152,7 @@ static struct _ofixGroupSpec	AllocationGroup627 = {
 
 static struct _ofixGroupSpec	AllocationGroup73 = {
     73, // NoOrders
+    {0x0000002000000800ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, true }, // ClOrdID
 	{ 37, false }, // OrderID
@@ -4868,6 +5165,7 @@ static struct _ofixGroupSpec	AllocationGroup73 = {
 
 static struct _ofixGroupSpec	AllocationGroup124 = {
     124, // NoExecs
+    {0x00000001a0020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000008000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 32, false }, // LastQty
 	{ 17, false }, // ExecID
@@ -4880,6 +5178,7 @@ static struct _ofixGroupSpec	AllocationGroup124 = {
 
 static struct _ofixGroupSpec	AllocationGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -4889,6 +5188,7 @@ static struct _ofixGroupSpec	AllocationGroup454 = {
 
 static struct _ofixGroupSpec	AllocationGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -4900,6 +5200,7 @@ static struct _ofixGroupSpec	AllocationGroup453 = {
 
 static struct _ofixGroupSpec	AllocationGroup78 = {
     78, // NoAllocs
+    {0x0000000000003000ULL,0x0180000000038000ULL,0x000000039e000100ULL,0x0000000000030000ULL,0x0000000000000000ULL,0x0000430000000000ULL,0x0000000000000000ULL,0x0002000080080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, true }, // AllocAccount
 	{ 366, false }, // AllocPrice
@@ -4931,6 +5232,7 @@ static struct _ofixGroupSpec	AllocationGroup78 = {
 
 static struct _ofixGroupSpec	AllocationGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -4942,6 +5244,7 @@ static struct _ofixGroupSpec	AllocationGroup539 = {
 
 static struct _ofixGroupSpec	AllocationGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -4968,6 +5271,8 @@ static struct _ofixMsgSpec	Allocation = {
     "J", // type
     "Allocation", // name
     {0,0,0,0,0,0,78,0,1,2,101,0,0,0,0,79,0,0,0,0,0,0,42,0,0,0,0,0,0,0,73,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,41,4,11,0,21,72,38,39,5,13,91,0,83,0,0,84,85,40,0,0,0,0,29,30,32,36,80,82,0,90,98,0,0,0,0,0,0,0,0,0,0,100,8,9,0,99,0,0,0,20,0,0,0,0,0,0,0,0,66,69,0,0,0,0,0,0,0,6,15,0,89,0,0,0,22,0,37,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,94,95,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,34,0,0,47,0,61,0,0,0,62,65,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,64,49,50,52,53,54,74,0,63,0,0,0,0,0,88,87,51,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,25,67,68,70,71,0,0,92,93,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,43,0,0,0,0,0,44,45,0,0,0,0,35,0,0,0,57,58,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,48,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,31,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01f2000c00000740ULL,0x0000000000004ac0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97f7082de042bf40ULL,0x15d80c022e03efc7ULL,0x00000083fe03cf03ULL,0x8001e0bf8033c570ULL,0x0000000000000000ULL,0x2006430cf8010000ULL,0x8000008000000000ULL,0x0002000081cc31f1ULL,0x00000002bc00f800ULL,0x007e000000000000ULL,0x0000000000000400ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     AllocationGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5079,6 +5384,7 @@ static struct _ofixMsgSpec	Allocation = {
 
 static struct _ofixGroupSpec	ListCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5098,6 +5404,8 @@ static struct _ofixMsgSpec	ListCancelRequest = {
     "K", // type
     "ListCancelRequest", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,32,0,30,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022e000004ULL,0x000000000003c003ULL,0x0000002000300000ULL,0x0000000000000000ULL,0x0006000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5145,6 +5453,7 @@ static struct _ofixMsgSpec	ListCancelRequest = {
 
 static struct _ofixGroupSpec	ListExecuteGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5164,6 +5473,8 @@ static struct _ofixMsgSpec	ListExecute = {
     "L", // type
     "ListExecute", // name
     {0,0,0,0,0,0,0,0,1,2,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,33,0,32,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,8,9,0,36,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022e000004ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c08000000ULL,0x00000000000000c0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListExecuteGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5212,6 +5523,7 @@ static struct _ofixMsgSpec	ListExecute = {
 
 static struct _ofixGroupSpec	ListStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5231,6 +5543,8 @@ static struct _ofixMsgSpec	ListStatusRequest = {
     "M", // type
     "ListStatusRequest", // name
     {0,0,0,0,0,0,0,0,1,2,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,30,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,8,9,0,33,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,31,32,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000004ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5276,6 +5590,7 @@ static struct _ofixMsgSpec	ListStatusRequest = {
 
 static struct _ofixGroupSpec	ListStatusGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5286,6 +5601,7 @@ static struct _ofixGroupSpec	ListStatusGroup627 = {
 
 static struct _ofixGroupSpec	ListStatusGroup73 = {
     73, // NoOrders
+    {0x0400008000004840ULL,0x0000008000100000ULL,0x0000000000800000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x1000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, true }, // ClOrdID
 	{ 526, false }, // SecondaryClOrdID
@@ -5315,6 +5631,8 @@ static struct _ofixMsgSpec	ListStatus = {
     "N", // type
     "ListStatus", // name
     {0,0,0,0,0,0,0,0,1,2,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,37,0,0,0,0,0,29,0,38,0,0,0,0,39,0,0,0,0,0,0,0,0,31,33,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,32,0,0,0,0,0,0,0,0,0,0,0,0,34,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x00000000000c0214ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000a00000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716088c00004f40ULL,0x041800822e1c0214ULL,0x000000000083c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c08000000ULL,0x7000a00000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x1078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListStatusGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5367,6 +5685,7 @@ static struct _ofixMsgSpec	ListStatus = {
 
 static struct _ofixGroupSpec	AllocationACKGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5377,6 +5696,7 @@ static struct _ofixGroupSpec	AllocationACKGroup627 = {
 
 static struct _ofixGroupSpec	AllocationACKGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -5398,6 +5718,8 @@ static struct _ofixMsgSpec	AllocationACK = {
     "P", // type
     "AllocationACK", // name
     {0,0,0,0,0,0,0,0,1,2,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,35,0,32,0,0,0,0,0,0,0,0,0,30,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,33,34,40,8,9,0,39,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,36,37,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000800840ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022f800840ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c08000000ULL,0x8000000000000000ULL,0x0000000000000031ULL,0x0000000000000800ULL,0x0078000000000000ULL,0x0000000000000400ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     AllocationACKGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5449,6 +5771,7 @@ static struct _ofixMsgSpec	AllocationACK = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5459,6 +5782,7 @@ static struct _ofixGroupSpec	DontKnowTradeGroup627 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -5478,6 +5802,8 @@ static struct _ofixMsgSpec	DontKnowTrade = {
     "Q", // type
     "DontKnowTrade", // name
     {0,0,0,0,0,0,0,0,1,2,78,0,0,0,0,0,0,30,0,0,0,0,35,0,0,0,0,0,0,0,0,72,71,0,10,3,0,29,66,0,0,0,0,19,0,0,0,0,34,4,11,0,21,0,65,32,5,13,73,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,8,9,0,76,0,0,0,20,0,0,0,0,0,0,0,0,59,62,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,31,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,54,0,0,0,55,58,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,57,42,43,45,46,47,0,0,56,0,0,0,0,0,0,0,44,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,60,61,63,64,0,0,74,75,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,37,38,0,0,0,0,0,0,69,70,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d2002c00020700ULL,0x8000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x07d7086d80420700ULL,0x84180c022e000002ULL,0x000000800103c003ULL,0x8001809f8030c500ULL,0x0000000000000000ULL,0x0006000cf8000000ULL,0x0000000000000000ULL,0x0000000001f031c0ULL,0x00000000a0000010ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     DontKnowTradeGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5566,6 +5892,7 @@ static struct _ofixMsgSpec	DontKnowTrade = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5576,6 +5903,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup627 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup146 = {
     146, // NoRelatedSym
+    {0x90c1114000408000ULL,0x40000c0000000003ULL,0x0000008001001000ULL,0x800199bff400c503ULL,0x0000800000000000ULL,0x00000000f0010000ULL,0x0000008000000000ULL,0x0000000001c23040ULL,0x00000000a2000000ULL,0x0002000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -5644,6 +5972,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup146 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -5653,6 +5982,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup454 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -5674,6 +6004,8 @@ static struct _ofixMsgSpec	QuoteRequest = {
     "R", // type
     "QuoteRequest", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,29,0,0,0,0,0,0,0,0,0,0,12,14,16,18,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040008ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97d7194c00408700ULL,0x44180c022e000003ULL,0x000000800107d00bULL,0x80019fbff430c503ULL,0x0000800000000000ULL,0x0006000cf8010000ULL,0x0000008000000000ULL,0x0000000001c231c0ULL,0x00000000a2000000ULL,0x007a000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     QuoteRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5721,6 +6053,7 @@ static struct _ofixMsgSpec	QuoteRequest = {
 
 static struct _ofixGroupSpec	QuoteGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5731,6 +6064,7 @@ static struct _ofixGroupSpec	QuoteGroup627 = {
 
 static struct _ofixGroupSpec	QuoteGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -5742,6 +6076,7 @@ static struct _ofixGroupSpec	QuoteGroup453 = {
 
 static struct _ofixGroupSpec	QuoteGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -5762,6 +6097,8 @@ static struct _ofixMsgSpec	Quote = {
     "S", // type
     "Quote", // name
     {0,34,0,0,0,0,0,0,1,2,109,0,101,100,0,96,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,91,0,0,19,0,0,0,0,40,4,11,0,21,0,0,38,5,13,104,0,88,0,79,89,90,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,8,9,0,107,0,0,0,20,0,0,103,0,0,0,0,0,65,68,0,0,0,0,0,0,0,6,15,30,0,0,0,0,22,0,0,0,0,0,7,17,0,29,71,72,76,78,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,82,81,83,93,92,0,0,0,0,0,0,46,0,60,0,0,0,61,64,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,63,48,49,51,52,53,0,0,62,0,0,0,0,0,0,0,50,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,25,66,67,69,70,0,0,105,106,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,42,0,0,0,0,0,43,44,0,0,0,0,0,0,0,0,56,57,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,47,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,28,0,0,0,84,85,86,87,0,0,0,0,0,0,0,94,95,0,73,74,75,77,0,0,0,0,0,0,0,97,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0xd797090c0040b702ULL,0x04380c122e000003ULL,0xf00000801003c0fbULL,0x8001809f8030c503ULL,0x0000200000000000ULL,0x0006000cf8010000ULL,0x8000000000000000ULL,0x0000000001c031f1ULL,0x00000000a2000800ULL,0x07fa000000000060ULL,0x00000000000301ecULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     QuoteGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5881,6 +6218,7 @@ static struct _ofixMsgSpec	Quote = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5891,6 +6229,7 @@ static struct _ofixGroupSpec	SettlementInstructionsGroup627 = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -5912,6 +6251,8 @@ static struct _ofixMsgSpec	SettlementInstructions = {
     "T", // type
     "SettlementInstructions", // name
     {0,0,0,0,0,0,0,0,1,2,77,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,42,0,5,13,0,0,45,0,0,0,0,0,0,0,0,0,38,0,0,0,0,37,0,0,0,34,0,0,0,0,0,0,0,0,0,76,8,9,0,75,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,29,30,0,33,0,43,44,47,48,49,50,51,52,53,54,55,56,57,58,59,60,61,62,63,64,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,68,69,71,72,66,0,0,0,0,0,0,0,0,0,0,70,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000008000ULL,0x0000002d00000000ULL,0x0000000000400000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1356080c40000f00ULL,0x041800022e008840ULL,0x0fffffad0003c003ULL,0x0000000000700000ULL,0x0000000000000000ULL,0x0006000008010000ULL,0x8000000000000000ULL,0x03801f0010080031ULL,0x0000000000000800ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SettlementInstructionsGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5999,6 +6340,7 @@ static struct _ofixMsgSpec	SettlementInstructions = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6009,6 +6351,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup627 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup267 = {
     267, // NoMDEntryTypes
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000002000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 269, true }, // MDEntryType
 	{ 0, false }
@@ -6017,6 +6360,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup267 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -6057,6 +6401,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup146 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6066,6 +6411,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup454 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -6088,6 +6434,8 @@ static struct _ofixMsgSpec	MarketDataRequest = {
     "V", // type
     "MarketDataRequest", // name
     {0,0,0,0,0,0,0,0,1,2,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,31,32,33,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x00000000000009c0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400700ULL,0x04180c022e000002ULL,0x000000800007c003ULL,0x8001809f8030c500ULL,0x0000000040002fc0ULL,0x00060000f8010000ULL,0x0000000000000004ULL,0x0000000001c031c0ULL,0x0000000ca0000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6140,6 +6488,7 @@ static struct _ofixMsgSpec	MarketDataRequest = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6150,6 +6499,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup627 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6159,6 +6509,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup454 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup268 = {
     268, // NoMDEntries
+    {0x0c00002000048000ULL,0x4000400000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00000807dc3fe000ULL,0x0000000c04010000ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 269, true }, // MDEntryType
 	{ 270, false }, // MDEntryPx
@@ -6209,6 +6560,8 @@ static struct _ofixMsgSpec	MarketDataSnapshotFullRefresh = {
     "W", // type
     "MarketDataSnapshotFullRefresh", // name
     {0,0,0,0,0,0,0,0,1,2,72,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,32,4,11,0,21,0,0,30,5,13,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,8,9,0,70,0,0,0,20,0,0,0,0,0,0,0,0,57,60,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,52,0,0,0,53,56,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,55,40,41,43,44,45,0,0,54,0,0,0,0,0,0,0,42,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,29,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,58,59,61,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,67,68,0,0,34,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000001000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0f97082c00448700ULL,0x44184c022e000002ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000081fdc3ff040ULL,0x0006000cfc010000ULL,0x0001000000000008ULL,0x0000000001c031ceULL,0x00000004a0000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataSnapshotFullRefreshGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6291,6 +6644,7 @@ static struct _ofixMsgSpec	MarketDataSnapshotFullRefresh = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6301,13 +6655,14 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup627 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup268 = {
     268, // NoMDEntries
+    {0x0c81002000448000ULL,0x40004c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000081ffdffe000ULL,0x0000000cf4010000ULL,0x0001000000000008ULL,0x0000000001c0304eULL,0x00000004a0000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 279, true }, // MDUpdateAction
 	{ 285, false }, // DeleteReason
 	{ 269, false }, // MDEntryType
 	{ 278, false }, // MDEntryID
 	{ 280, false }, // MDEntryRefID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -6383,6 +6738,7 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup268 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6403,6 +6759,8 @@ static struct _ofixMsgSpec	MarketDataIncrementalRefresh = {
     "X", // type
     "MarketDataIncrementalRefresh", // name
     {0,0,0,0,0,0,0,0,1,2,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,9,0,31,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000001000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0f97082c00448700ULL,0x44184c022e000002ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000081ffdfff040ULL,0x0006000cfc010000ULL,0x0001000000000008ULL,0x0000000001c031ceULL,0x00000004a0000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataIncrementalRefreshGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6446,6 +6804,7 @@ static struct _ofixMsgSpec	MarketDataIncrementalRefresh = {
 
 static struct _ofixGroupSpec	MarketDataRequestRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6465,6 +6824,8 @@ static struct _ofixMsgSpec	MarketDataRequestReject = {
     "Y", // type
     "MarketDataRequestReject", // name
     {0,0,0,0,0,0,0,0,1,2,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,8,9,0,34,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,32,33,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000002000040ULL,0x0006000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataRequestRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6511,6 +6872,7 @@ static struct _ofixMsgSpec	MarketDataRequestReject = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6521,6 +6883,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup627 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -6532,8 +6895,9 @@ static struct _ofixGroupSpec	QuoteCancelGroup453 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup295 = {
     295, // NoQuoteEntries
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -6572,6 +6936,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup295 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6593,6 +6958,8 @@ static struct _ofixMsgSpec	QuoteCancel = {
     "Z", // type
     "QuoteCancel", // name
     {0,34,0,0,0,0,0,0,1,2,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,8,9,0,39,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,30,0,0,0,0,22,0,0,0,0,0,7,17,0,29,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,31,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000040000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400702ULL,0x04380c022e000002ULL,0x000000800003c00bULL,0x8001809f8030c500ULL,0x0000248000000000ULL,0x00060000f8010000ULL,0x8000000000000000ULL,0x0000000001c031f1ULL,0x00000000a0000800ULL,0x007a000000000020ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     QuoteCancelGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6644,6 +7011,7 @@ static struct _ofixMsgSpec	QuoteCancel = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6654,6 +7022,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6663,6 +7032,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup454 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -6685,6 +7055,8 @@ static struct _ofixMsgSpec	QuoteStatusRequest = {
     "a", // type
     "QuoteStatusRequest", // name
     {0,65,0,0,0,0,0,0,1,2,72,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,33,4,11,0,21,0,0,31,5,13,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,8,9,0,70,0,0,0,20,0,0,0,0,0,0,0,0,58,61,0,0,0,0,0,0,0,6,15,30,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,53,0,0,0,54,57,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,56,41,42,44,45,46,0,0,55,0,0,0,0,0,0,0,43,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,25,59,60,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,35,0,0,0,0,0,36,37,0,0,0,0,0,0,0,0,49,50,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400702ULL,0x04380c022e000002ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000000000000080ULL,0x00060000f8010000ULL,0x8000000000000000ULL,0x0000000001c031f1ULL,0x00000000a0000800ULL,0x007a000000000020ULL,0x0000000000000200ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     QuoteStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6767,6 +7139,7 @@ static struct _ofixMsgSpec	QuoteStatusRequest = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6777,6 +7150,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup627 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -6788,9 +7162,10 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup453 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup296 = {
     296, // NoQuoteSets
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x3bff408000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 302, false }, // QuoteSetID
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -6832,6 +7207,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup296 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -6841,9 +7217,10 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup457 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup295 = {
     295, // NoQuoteEntries
+    {0x5081010000408000ULL,0x00000c0000000003ULL,0xf0000080000000f0ULL,0x8001809f8000c503ULL,0x0000080000000000ULL,0x00010000f0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0782000000000000ULL,0x000000000000000cULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 299, false }, // QuoteEntryID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -6906,6 +7283,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup295 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6929,6 +7307,8 @@ static struct _ofixMsgSpec	MassQuoteAcknowledgement = {
     "b", // type
     "MassQuoteAcknowledgement", // name
     {0,36,0,0,0,0,0,0,1,2,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,30,0,0,0,0,22,0,0,0,0,0,7,17,0,29,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,31,0,0,32,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000020000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x5797090c00408702ULL,0x04380c022e000003ULL,0xf00000800003c0fbULL,0x80ff809f8030c503ULL,0x3bff7b8000000001ULL,0x00073c00f8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00000000e2000800ULL,0x07fa0000000f0020ULL,0x000000000000000cULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MassQuoteAcknowledgementGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6981,6 +7361,7 @@ static struct _ofixMsgSpec	MassQuoteAcknowledgement = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6991,6 +7372,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup627 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7000,8 +7382,9 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup454 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 600, true }, // LegSymbol
+	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
 	{ 602, false }, // LegSecurityID
 	{ 603, false }, // LegSecurityIDSource
@@ -7043,6 +7426,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup555 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -7064,6 +7448,8 @@ static struct _ofixMsgSpec	SecurityDefinitionRequest = {
     "c", // type
     "SecurityDefinitionRequest", // name
     {0,0,0,0,0,0,0,0,1,2,74,0,0,0,0,64,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,33,4,11,0,21,0,0,31,5,13,65,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,8,9,0,72,0,0,0,20,0,0,0,0,0,0,0,0,58,61,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,53,0,0,0,54,57,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,56,41,42,44,45,46,0,0,55,0,0,0,0,0,0,0,43,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,25,59,60,62,63,0,0,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,36,37,0,0,0,0,0,0,0,0,49,50,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,48,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000003ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xff01809f8030c500ULL,0x0000000000000082ULL,0x0006000cf8010003ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00001800a0000000ULL,0x007bfffffff00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityDefinitionRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7096,7 +7482,7 @@ static struct _ofixMsgSpec	SecurityDefinitionRequest = {
 	{ 627, false }, // NoHops
 	{ 320, true }, // SecurityReqID
 	{ 321, true }, // SecurityRequestType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -7148,6 +7534,7 @@ static struct _ofixMsgSpec	SecurityDefinitionRequest = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7158,6 +7545,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup627 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7167,8 +7555,9 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup454 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 600, true }, // LegSymbol
+	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
 	{ 602, false }, // LegSecurityID
 	{ 603, false }, // LegSecurityIDSource
@@ -7210,6 +7599,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup555 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -7231,6 +7621,8 @@ static struct _ofixMsgSpec	SecurityDefinition = {
     "d", // type
     "SecurityDefinition", // name
     {0,0,0,0,0,0,0,0,1,2,76,0,0,0,0,65,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,34,4,11,0,21,0,0,32,5,13,68,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,8,9,0,74,0,0,0,20,0,0,0,0,0,0,0,0,59,62,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,54,0,0,0,55,58,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,57,42,43,45,46,47,0,0,56,0,0,0,0,0,0,0,44,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,25,60,61,63,64,0,0,69,70,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,37,38,0,0,0,0,0,0,0,0,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,49,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,72,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000dULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xff01809f8030c500ULL,0x0000000000000002ULL,0x0006000cf801000dULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00061800a0000000ULL,0x007bfffffff00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityDefinitionGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7264,7 +7656,7 @@ static struct _ofixMsgSpec	SecurityDefinition = {
 	{ 320, true }, // SecurityReqID
 	{ 322, true }, // SecurityResponseID
 	{ 323, true }, // SecurityResponseType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -7317,6 +7709,7 @@ static struct _ofixMsgSpec	SecurityDefinition = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7327,6 +7720,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7346,6 +7740,8 @@ static struct _ofixMsgSpec	SecurityStatusRequest = {
     "e", // type
     "SecurityStatusRequest", // name
     {0,0,0,0,0,0,0,0,1,2,69,0,0,0,0,63,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,32,4,11,0,21,0,0,30,5,13,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,8,9,0,67,0,0,0,20,0,0,0,0,0,0,0,0,57,60,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,52,0,0,0,53,56,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,55,40,41,43,44,45,0,0,54,0,0,0,0,0,0,0,42,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,25,58,59,61,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000080ULL,0x0000000000000010ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000000000000080ULL,0x00060000f8010010ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00000000a0000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7425,6 +7821,7 @@ static struct _ofixMsgSpec	SecurityStatusRequest = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7435,6 +7832,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup627 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7454,6 +7852,8 @@ static struct _ofixMsgSpec	SecurityStatus = {
     "f", // type
     "SecurityStatus", // name
     {0,0,0,0,0,0,0,0,1,2,85,0,0,0,0,63,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,77,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,32,4,11,0,21,0,0,30,5,13,80,0,78,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,8,9,0,83,0,0,0,20,0,0,0,0,0,0,0,0,57,60,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,52,0,0,0,53,56,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,55,40,41,43,44,45,0,0,54,0,0,0,0,0,0,0,42,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,66,67,70,71,72,73,74,75,76,79,0,64,0,0,0,0,0,0,0,0,0,0,25,58,59,61,62,0,0,81,82,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1797080c80408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000001800000000ULL,0x0006000cf8017ff0ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00000000a0000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityStatusGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7549,6 +7949,7 @@ static struct _ofixMsgSpec	SecurityStatus = {
 
 static struct _ofixGroupSpec	TradingSessionStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7568,6 +7969,8 @@ static struct _ofixMsgSpec	TradingSessionStatusRequest = {
     "g", // type
     "TradingSessionStatusRequest", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,32,33,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000080ULL,0x0000000000008000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000080ULL,0x00060000080d8000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TradingSessionStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7615,6 +8018,7 @@ static struct _ofixMsgSpec	TradingSessionStatusRequest = {
 
 static struct _ofixGroupSpec	TradingSessionStatusGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7634,6 +8038,8 @@ static struct _ofixMsgSpec	TradingSessionStatus = {
     "h", // type
     "TradingSessionStatus", // name
     {0,0,0,0,0,0,0,0,1,2,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,8,9,0,46,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,29,30,0,32,33,35,37,38,39,40,41,0,25,0,0,0,0,0,0,44,45,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000110000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c0bfd8020ULL,0x0000000000000008ULL,0x0000000000000000ULL,0x0080000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TradingSessionStatusGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7692,6 +8098,7 @@ static struct _ofixMsgSpec	TradingSessionStatus = {
 
 static struct _ofixGroupSpec	MassQuoteGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7702,6 +8109,7 @@ static struct _ofixGroupSpec	MassQuoteGroup627 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -7713,9 +8121,10 @@ static struct _ofixGroupSpec	MassQuoteGroup453 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup296 = {
     296, // NoQuoteSets
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x3bff408000000001ULL,0x0000bc0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 302, true }, // QuoteSetID
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -7758,6 +8167,7 @@ static struct _ofixGroupSpec	MassQuoteGroup296 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -7767,9 +8177,10 @@ static struct _ofixGroupSpec	MassQuoteGroup457 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup295 = {
     295, // NoQuoteEntries
+    {0x5081010000408000ULL,0x00000c0000000003ULL,0xf0000080000000f0ULL,0x8001809f8000c503ULL,0x0000080000000000ULL,0x00000000f0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0782000000000000ULL,0x000000000000000cULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 299, true }, // QuoteEntryID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -7831,6 +8242,7 @@ static struct _ofixGroupSpec	MassQuoteGroup295 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7854,6 +8266,8 @@ static struct _ofixMsgSpec	MassQuote = {
     "i", // type
     "MassQuote", // name
     {0,34,0,0,0,0,0,0,1,2,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,8,9,0,39,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,30,0,0,0,0,22,0,0,0,0,0,7,17,0,29,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,37,0,38,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000010000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x5397090c00408702ULL,0x04380c022e000003ULL,0xf00000800003c0fbULL,0x80ff809f8030c503ULL,0x3bff69e000000001ULL,0x0006bc00f8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00000000e2000800ULL,0x07fa0000000f0020ULL,0x000000000000000cULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MassQuoteGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7905,6 +8319,7 @@ static struct _ofixMsgSpec	MassQuote = {
 
 static struct _ofixGroupSpec	BusinessMessageRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7924,6 +8339,8 @@ static struct _ofixMsgSpec	BusinessMessageReject = {
     "j", // type
     "BusinessMessageReject", // name
     {0,0,0,0,0,0,0,0,1,2,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,29,0,0,0,4,11,0,21,0,0,0,5,13,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,8,9,0,36,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,30,0,0,0,0,0,0,31,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1010000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716280c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x1816000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     BusinessMessageRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7972,6 +8389,7 @@ static struct _ofixMsgSpec	BusinessMessageReject = {
 
 static struct _ofixGroupSpec	BidRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7982,6 +8400,7 @@ static struct _ofixGroupSpec	BidRequestGroup627 = {
 
 static struct _ofixGroupSpec	BidRequestGroup398 = {
     398, // NoBidDescriptors
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0200000001ff8000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 399, false }, // BidDescriptorType
 	{ 400, false }, // BidDescriptor
@@ -8000,6 +8419,7 @@ static struct _ofixGroupSpec	BidRequestGroup398 = {
 
 static struct _ofixGroupSpec	BidRequestGroup420 = {
     420, // NoBidComponents
+    {0x8040000000000002ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000400000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 66, false }, // ListID
 	{ 54, false }, // Side
@@ -8026,6 +8446,8 @@ static struct _ofixMsgSpec	BidRequest = {
     "k", // type
     "BidRequest", // name
     {0,0,0,0,0,0,0,0,1,2,60,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,59,8,9,0,58,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,49,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,56,57,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,32,33,34,35,37,38,39,0,0,0,0,0,0,0,0,0,0,41,42,43,44,45,46,47,48,50,52,53,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0040000000000000ULL,0x0000000c00000680ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x8756080c00008702ULL,0x061800022e000805ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0046000c08010000ULL,0x0a00401fffffffc0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     BidRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8096,6 +8518,7 @@ static struct _ofixMsgSpec	BidRequest = {
 
 static struct _ofixGroupSpec	BidResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8106,6 +8529,7 @@ static struct _ofixGroupSpec	BidResponseGroup627 = {
 
 static struct _ofixGroupSpec	BidResponseGroup420 = {
     420, // NoBidComponents
+    {0x8440100000003000ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00010000ULL,0x000040a000400000ULL,0x0002000080000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 12, false }, // Commission
 	{ 13, false }, // CommType
@@ -8141,6 +8565,8 @@ static struct _ofixMsgSpec	BidResponse = {
     "l", // type
     "BidResponse", // name
     {0,0,0,0,0,0,0,0,1,2,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,8,9,0,32,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x8756180c00003700ULL,0x041800022e000005ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c08010000ULL,0x000040b0004000c0ULL,0x0002000080000000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     BidResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8185,6 +8611,7 @@ static struct _ofixMsgSpec	BidResponse = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8195,6 +8622,7 @@ static struct _ofixGroupSpec	ListStrikePriceGroup627 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup428 = {
     428, // NoStrikes
+    {0x04c1100000408800ULL,0x00000c0000000002ULL,0x0000008000001000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x0000000cf0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -8244,6 +8672,7 @@ static struct _ofixGroupSpec	ListStrikePriceGroup428 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -8264,6 +8693,8 @@ static struct _ofixMsgSpec	ListStrikePrice = {
     "m", // type
     "ListStrikePrice", // name
     {0,0,0,0,0,0,0,0,1,2,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,8,9,0,32,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000104000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x07d7180c00408f00ULL,0x04180c022e000006ULL,0x000000800003d003ULL,0x8001809f8030c500ULL,0x0000000000000000ULL,0x0006000cf8000000ULL,0x0000104000000000ULL,0x0000000001c031c0ULL,0x00000000a0004000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListStrikePriceGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8308,6 +8739,7 @@ static struct _ofixMsgSpec	ListStrikePrice = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8318,6 +8750,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup627 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -8329,6 +8762,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup453 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup473 = {
     473, // NoRegistDtls
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0xa00000440c000000ULL,0x0000000008000400ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 509, false }, // RegistDetls
 	{ 511, false }, // RegistEmail
@@ -8344,6 +8778,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup473 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -8355,6 +8790,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup539 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup510 = {
     510, // NoDistribInsts
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x007c000060000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 477, false }, // DistribPaymentMethod
 	{ 512, false }, // DistribPercentage
@@ -8383,6 +8819,8 @@ static struct _ofixMsgSpec	RegistrationInstructions = {
     "o", // type
     "RegistrationInstructions", // name
     {0,34,0,0,0,0,0,0,1,2,42,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,36,0,0,0,0,0,0,0,0,0,0,0,0,31,0,39,0,0,29,30,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1000000000000000ULL,0x0000000000000006ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000f02ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000008000000ULL,0x8000000000000000ULL,0xf07ca0446e000031ULL,0x000000020c003c27ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     RegistrationInstructionsGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8435,6 +8873,7 @@ static struct _ofixMsgSpec	RegistrationInstructions = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8445,6 +8884,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup627 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -8466,6 +8906,8 @@ static struct _ofixMsgSpec	RegistrationInstructionsResponse = {
     "p", // type
     "RegistrationInstructionsResponse", // name
     {0,34,0,0,0,0,0,0,1,2,40,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,8,9,0,38,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,35,36,31,0,0,0,0,29,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1400000000000000ULL,0x0000000000000006ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000f02ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000008000000ULL,0x8000000000000000ULL,0x1c01000000000031ULL,0x0000000000000806ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     RegistrationInstructionsResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8516,6 +8958,7 @@ static struct _ofixMsgSpec	RegistrationInstructionsResponse = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8526,6 +8969,7 @@ static struct _ofixGroupSpec	OrderMassCancelRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -8535,6 +8979,7 @@ static struct _ofixGroupSpec	OrderMassCancelRequestGroup454 = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -8555,6 +9000,8 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
     "q", // type
     "OrderMassCancelRequest", // name
     {0,0,0,0,0,0,0,0,1,2,108,29,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,36,4,11,0,21,0,101,34,5,13,103,0,102,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,8,9,0,106,0,0,0,20,0,0,0,0,0,0,0,0,61,64,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,56,0,0,0,57,60,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,59,44,45,47,48,49,0,0,58,0,0,0,0,0,0,0,46,55,77,78,79,80,81,82,88,0,0,0,0,0,0,0,50,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,95,98,94,69,74,67,68,75,0,89,90,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,25,62,63,65,66,0,0,104,105,0,0,0,0,0,0,96,97,99,100,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,71,0,0,39,40,72,73,0,0,0,0,0,0,52,53,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,31,0,0,0,0,0,0,0,0,0,0,43,76,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,86,87,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d7080c00400f00ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x80ff809f8030c500ULL,0x3bfe000000000001ULL,0x00063c0cf8010000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00000000e0044000ULL,0x007a0000000f0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderMassCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8590,7 +9037,7 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
 	{ 530, true }, // MassCancelRequestType
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -8623,7 +9070,7 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
 	{ 107, false }, // SecurityDesc
 	{ 350, false }, // EncodedSecurityDescLen
 	{ 351, false }, // EncodedSecurityDesc
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -8673,6 +9120,7 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8683,6 +9131,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup627 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup534 = {
     534, // NoAffectedOrders
+    {0x0000020000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000001800000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 41, false }, // OrigClOrdID
 	{ 535, false }, // AffectedOrderID
@@ -8693,6 +9142,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup534 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -8702,6 +9152,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup454 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -8723,6 +9174,8 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
     "r", // type
     "OrderMassCancelReport", // name
     {0,0,0,0,0,0,0,0,1,2,114,29,0,0,0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,10,3,0,31,0,0,0,0,0,19,0,0,0,0,42,4,11,0,21,0,107,40,5,13,109,0,108,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,113,8,9,0,112,0,0,0,20,0,0,0,0,0,0,0,0,67,70,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,48,0,62,0,0,0,63,66,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,65,50,51,53,54,55,0,0,64,0,0,0,0,0,0,0,52,61,83,84,85,86,87,88,94,0,0,0,0,0,0,0,56,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,101,104,100,75,80,73,74,81,0,95,96,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,25,68,69,71,72,0,0,110,111,0,0,0,0,0,0,102,103,105,106,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,77,0,0,45,46,78,79,0,0,0,0,0,0,58,59,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,33,34,35,36,37,0,0,0,0,0,0,49,82,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,92,93,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112002c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00000000000c0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d70a2c00400f00ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x80ff809f8030c540ULL,0x3bfe000000000001ULL,0x00063c0cf8010000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00000000e1fc4000ULL,0x007a0000000f0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderMassCancelReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8764,7 +9217,7 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
 	{ 534, false }, // NoAffectedOrders
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -8797,7 +9250,7 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
 	{ 107, false }, // SecurityDesc
 	{ 350, false }, // EncodedSecurityDescLen
 	{ 351, false }, // EncodedSecurityDesc
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -8847,6 +9300,7 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8857,6 +9311,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup552 = {
     552, // NoSides
+    {0x0440004000003802ULL,0x0300000000006000ULL,0x0000000001000000ULL,0x0000002000000800ULL,0x0000000000000000ULL,0x0200000c00000000ULL,0x0000000000000000ULL,0x0002000080320020ULL,0x0000000100034010ULL,0x080000000000e0e0ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 11, true }, // ClOrdID
@@ -8900,6 +9355,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup552 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -8911,6 +9367,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 467, false }, // IndividualAllocID
@@ -8922,6 +9379,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -8933,6 +9391,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup539 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -8942,6 +9401,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -8951,6 +9411,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -8976,6 +9437,8 @@ static struct _ofixMsgSpec	NewOrderCross = {
     "s", // type
     "NewOrderCross", // name
     {0,0,0,0,0,0,0,0,1,2,111,0,0,0,0,89,0,0,69,0,0,68,36,91,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,79,0,0,19,81,0,0,0,35,4,11,0,21,0,0,33,5,13,0,93,77,0,0,66,67,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,110,8,9,0,109,0,0,0,20,0,82,72,0,0,0,0,0,60,63,0,0,70,71,0,0,76,6,15,92,108,0,0,0,22,0,0,0,96,0,7,17,0,0,0,0,0,0,0,0,0,0,75,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,106,107,0,0,0,0,0,0,0,40,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,55,0,0,0,56,59,0,0,98,99,23,24,0,0,0,0,83,0,84,85,86,58,43,44,46,47,48,0,0,57,78,0,0,87,88,0,0,45,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,61,62,64,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,73,0,100,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,0,97,0,0,0,0,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,38,39,0,0,0,0,0,0,0,0,51,52,53,0,0,0,0,0,0,0,102,103,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,50,0,0,0,0,29,30,31,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192010c00200700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000017000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7194c00e4bf02ULL,0x477ccc1a2e03e003ULL,0x00000180c103d003ULL,0x80019fbff43ccd00ULL,0x0000000000000000ULL,0x0306000cf8010000ULL,0x8001088000000034ULL,0x0002400381fa31f1ULL,0x00000173ac037812ULL,0x087a00000000e0e0ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     NewOrderCrossGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9097,6 +9560,7 @@ static struct _ofixMsgSpec	NewOrderCross = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9107,6 +9571,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup627 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup552 = {
     552, // NoSides
+    {0x0440024000003802ULL,0x0300000000006000ULL,0x0000000001000000ULL,0x0000002000000800ULL,0x0000000000000000ULL,0x0200000c00000000ULL,0x0000000000000000ULL,0x0002000080320020ULL,0x0000000100034010ULL,0x080000000000e4e0ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 41, false }, // OrigClOrdID
@@ -9152,6 +9617,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup552 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -9163,6 +9629,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup453 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 467, false }, // IndividualAllocID
@@ -9174,6 +9641,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup78 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000204003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -9185,6 +9653,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup539 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -9194,6 +9663,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup454 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -9203,6 +9673,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup386 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -9228,6 +9699,8 @@ static struct _ofixMsgSpec	CrossOrderCancelReplaceRequest = {
     "t", // type
     "CrossOrderCancelReplaceRequest", // name
     {0,0,0,0,0,0,0,0,1,2,113,0,0,0,0,91,0,0,71,0,0,70,38,93,0,0,0,0,0,0,0,0,0,0,10,3,0,29,0,0,81,0,0,19,83,0,0,0,37,4,11,0,21,0,0,35,5,13,0,95,79,0,0,68,69,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,112,8,9,0,111,0,0,0,20,0,84,74,0,0,0,0,0,62,65,0,0,72,73,0,0,78,6,15,94,110,0,0,0,22,0,0,0,98,0,7,17,0,0,0,0,0,0,0,0,0,0,77,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,108,109,0,0,0,0,0,0,0,42,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,58,61,0,0,100,101,23,24,0,0,0,0,85,0,86,87,88,60,45,46,48,49,50,0,0,59,80,0,0,89,90,0,0,47,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,63,64,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,92,0,0,0,0,0,0,0,0,0,75,0,102,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,0,0,99,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,40,41,0,0,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,104,105,0,0,0,0,0,0,0,0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,52,0,0,0,0,30,32,33,31,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192010c00200700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000001f000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd71b6c00e4bf02ULL,0x477ccc1a2e03e003ULL,0x00000180c103d003ULL,0x80019fbff43ccd00ULL,0x0000000000000000ULL,0x0306000cf8010000ULL,0x8001088000000034ULL,0x0002400381fa31f1ULL,0x000001f3ac037812ULL,0x087a00000000e4e0ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     CrossOrderCancelReplaceRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9351,6 +9824,7 @@ static struct _ofixMsgSpec	CrossOrderCancelReplaceRequest = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9361,6 +9835,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup627 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup552 = {
     552, // NoSides
+    {0x0440024000000800ULL,0x0000000000000000ULL,0x0000000001000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0100000c00000000ULL,0x0000000000000000ULL,0x0000000000300020ULL,0x0000000000004010ULL,0x0000000000000480ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 41, false }, // OrigClOrdID
@@ -9385,6 +9860,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup552 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -9396,6 +9872,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup453 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -9417,6 +9894,8 @@ static struct _ofixMsgSpec	CrossOrderCancelRequest = {
     "u", // type
     "CrossOrderCancelRequest", // name
     {0,0,0,0,0,0,0,0,1,2,71,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,10,3,0,29,0,0,0,0,0,19,0,0,0,0,37,4,11,0,21,0,0,35,5,13,0,0,68,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,8,9,0,69,0,0,0,20,0,0,0,0,0,0,0,0,62,65,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,58,61,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,60,45,46,48,49,50,0,0,59,0,0,0,0,0,0,0,47,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,63,64,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,40,41,0,0,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,52,0,0,0,0,30,32,33,31,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000001f000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d70a6c00400f00ULL,0x04180c022e000002ULL,0x000000800103c003ULL,0x800180bf8030c500ULL,0x0000000000000000ULL,0x0106000cf8000000ULL,0x8000000000000000ULL,0x0000000001f031f1ULL,0x000001f0a0004810ULL,0x0078000000000480ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     CrossOrderCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9498,6 +9977,7 @@ static struct _ofixMsgSpec	CrossOrderCancelRequest = {
 
 static struct _ofixGroupSpec	SecurityTypeRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9517,6 +9997,8 @@ static struct _ofixMsgSpec	SecurityTypeRequest = {
     "v", // type
     "SecurityTypeRequest", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,31,32,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0006000c08010001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityTypeRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9564,6 +10046,7 @@ static struct _ofixMsgSpec	SecurityTypeRequest = {
 
 static struct _ofixGroupSpec	SecurityTypesGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9574,6 +10057,7 @@ static struct _ofixGroupSpec	SecurityTypesGroup627 = {
 
 static struct _ofixGroupSpec	SecurityTypesGroup558 = {
     558, // NoSecurityTypes
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 167, false }, // SecurityType
 	{ 460, false }, // Product
@@ -9594,6 +10078,8 @@ static struct _ofixMsgSpec	SecurityTypes = {
     "w", // type
     "SecurityTypes", // name
     {0,0,0,0,0,0,0,0,1,2,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000dULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000800003c003ULL,0x0000000000300000ULL,0x0000000000000080ULL,0x0006000c0801000dULL,0x0000000000000000ULL,0x0000000000003000ULL,0x0000600000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityTypesGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9646,6 +10132,7 @@ static struct _ofixMsgSpec	SecurityTypes = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9656,6 +10143,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup627 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -9675,6 +10163,8 @@ static struct _ofixMsgSpec	SecurityListRequest = {
     "x", // type
     "SecurityListRequest", // name
     {0,0,0,0,0,0,0,0,1,2,73,0,0,0,0,64,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,33,4,11,0,21,0,0,31,5,13,65,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,8,9,0,71,0,0,0,20,0,0,0,0,0,0,0,0,58,61,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,53,0,0,0,54,57,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,56,41,42,44,45,46,0,0,55,0,0,0,0,0,0,0,43,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,25,59,60,62,63,0,0,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,36,37,0,0,0,0,0,0,0,0,49,50,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000800000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x8001809f8030c500ULL,0x0000000000000080ULL,0x0006000cf8010001ULL,0x0000000000000000ULL,0x0000000001c031c0ULL,0x00008000a0000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityListRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9707,7 +10197,7 @@ static struct _ofixMsgSpec	SecurityListRequest = {
 	{ 627, false }, // NoHops
 	{ 320, true }, // SecurityReqID
 	{ 559, true }, // SecurityListRequestType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -9758,6 +10248,7 @@ static struct _ofixMsgSpec	SecurityListRequest = {
 
 static struct _ofixGroupSpec	SecurityListGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9768,8 +10259,9 @@ static struct _ofixGroupSpec	SecurityListGroup627 = {
 
 static struct _ofixGroupSpec	SecurityListGroup146 = {
     146, // NoRelatedSym
+    {0x0481000000408000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x0000000cf0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00060800a0000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -9817,6 +10309,7 @@ static struct _ofixGroupSpec	SecurityListGroup146 = {
 
 static struct _ofixGroupSpec	SecurityListGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -9826,8 +10319,9 @@ static struct _ofixGroupSpec	SecurityListGroup454 = {
 
 static struct _ofixGroupSpec	SecurityListGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 600, true }, // LegSymbol
+	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
 	{ 602, false }, // LegSecurityID
 	{ 603, false }, // LegSecurityIDSource
@@ -9869,6 +10363,7 @@ static struct _ofixGroupSpec	SecurityListGroup555 = {
 
 static struct _ofixGroupSpec	SecurityListGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -9891,6 +10386,8 @@ static struct _ofixMsgSpec	SecurityList = {
     "y", // type
     "SecurityList", // name
     {0,0,0,0,0,0,0,0,1,2,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,8,9,0,34,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800007c003ULL,0xff01809f8030c500ULL,0x0000000000000002ULL,0x0006000cf8010005ULL,0x0000000000000200ULL,0x0000000001c031c0ULL,0x00071800a0000000ULL,0x007bfffffff00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityListGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9937,6 +10434,7 @@ static struct _ofixMsgSpec	SecurityList = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9947,6 +10445,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup627 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -9966,6 +10465,8 @@ static struct _ofixMsgSpec	DerivativeSecurityListRequest = {
     "z", // type
     "DerivativeSecurityListRequest", // name
     {0,0,0,0,0,0,0,0,1,2,74,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,8,9,0,72,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,42,43,44,45,46,52,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,59,62,58,33,38,31,32,39,0,53,54,55,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,67,68,0,0,0,0,0,0,60,61,63,64,0,0,0,26,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,36,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,50,51,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000800000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00008700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x00fe000000300000ULL,0x3bfe000000000081ULL,0x00063c0c08010001ULL,0x0018000000000000ULL,0x000000000000ce00ULL,0x0000800040000000ULL,0x007a0000000f0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     DerivativeSecurityListRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9998,7 +10499,7 @@ static struct _ofixMsgSpec	DerivativeSecurityListRequest = {
 	{ 627, false }, // NoHops
 	{ 320, true }, // SecurityReqID
 	{ 559, true }, // SecurityListRequestType
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -10056,6 +10557,8 @@ struct _ofixVersionSpec	fix43Spec = {
     false, // ready
     tags, // tags
     { 0 }, // tagTable
+    0, // highTags
+    0, // highCnt
     {
 	&Heartbeat,
 	&TestRequest,
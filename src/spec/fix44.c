@@ -8,13 +8,259 @@
 
 extern struct _ofixVersionSpec	fix44Spec;
 
+// ----- Enums -----
+static struct _ofixEnumSpec	enum4 = { { 0x0000000000000000ULL, 0x0000000001180004ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AdvSide
+static struct _ofixEnumSpec	enum5 = { { 0x0000000000000000ULL, 0x0000000000044008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AdvTransType
+static struct _ofixEnumSpec	enum13 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CommType
+static struct _ofixEnumSpec	enum18 = { { 0x03ff000000000000ULL, 0x0000003e07fffffeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecInst
+static struct _ofixEnumSpec	enum21 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // HandlInst
+static struct _ofixEnumSpec	enum22 = { { 0x03fe000000000000ULL, 0x00000000000007feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityIDSource
+static struct _ofixEnumSpec	enum25 = { { 0x0000000000000000ULL, 0x0000000000003100ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IOIQltyInd
+static struct _ofixEnumSpec	enum28 = { { 0x0000000000000000ULL, 0x0000000000044008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IOITransType
+static struct _ofixEnumSpec	enum29 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // LastCapacity
+static const char	*enum35_values[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "A", "AA", "AB", "AC", "AD", "AE", "AF", "AG", "AH", "AI", "AJ", "AK", "AL", "AM", "AN", "AO", "AP", "AQ", "AR", "AS", "AT", "AU", "AV", "AW", "AX", "AY", "AZ", "B", "BA", "BB", "BC", "BD", "BE", "BF", "BG", "BH", "C", "D", "E", "F", "G", "H", "J", "K", "L", "M", "N", "P", "Q", "R", "S", "T", "V", "W", "X", "Y", "Z", "a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p", "q", "r", "s", "t", "u", "v", "w", "x", "y", "z" };
+static struct _ofixEnumSpec	enum35 = { { 0, 0, 0, 0 }, 93, enum35_values }; // MsgType
+static struct _ofixEnumSpec	enum39 = { { 0x03ff000000000000ULL, 0x000000000000003eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrdStatus
+static struct _ofixEnumSpec	enum40 = { { 0x03fe000000000000ULL, 0x0000000000013ffeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrdType
+static struct _ofixEnumSpec	enum54 = { { 0x03fe000000000000ULL, 0x00000000000000feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Side
+static struct _ofixEnumSpec	enum59 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TimeInForce
+static struct _ofixEnumSpec	enum61 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Urgency
+static struct _ofixEnumSpec	enum63 = { { 0x03ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlType
+static const char	*enum65_values[] = { "CD", "WI" };
+static struct _ofixEnumSpec	enum65 = { { 0, 0, 0, 0 }, 2, enum65_values }; // SymbolSfx
+static struct _ofixEnumSpec	enum71 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocTransType
+static struct _ofixEnumSpec	enum77 = { { 0x0000000000000000ULL, 0x0000000000048048ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PositionEffect
+static struct _ofixEnumSpec	enum81 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ProcessCode
+static struct _ofixEnumSpec	enum87 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocStatus
+static const char	*enum88_values[] = { "0", "1", "10", "11", "12", "13", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum88 = { { 0, 0, 0, 0 }, 14, enum88_values }; // AllocRejCode
+static struct _ofixEnumSpec	enum94 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // EmailType
+static struct _ofixEnumSpec	enum98 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // EncryptMethod
+static const char	*enum102_values[] = { "0", "1", "2", "3", "4", "5", "6", "99" };
+static struct _ofixEnumSpec	enum102 = { { 0, 0, 0, 0 }, 8, enum102_values }; // CxlRejReason
+static const char	*enum103_values[] = { "0", "1", "10", "11", "12", "13", "14", "15", "2", "3", "4", "5", "6", "7", "8", "9", "99" };
+static struct _ofixEnumSpec	enum103 = { { 0, 0, 0, 0 }, 17, enum103_values }; // OrdRejReason
+static struct _ofixEnumSpec	enum104 = { { 0x0000000000000000ULL, 0x0000000007dfb21eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IOIQualifier
+static struct _ofixEnumSpec	enum127 = { { 0x0000000000000000ULL, 0x000000000400007eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DKReason
+static struct _ofixEnumSpec	enum139 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MiscFeeType
+static struct _ofixEnumSpec	enum150 = { { 0x03ff000000000000ULL, 0x00000000000003feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecType
+static struct _ofixEnumSpec	enum156 = { { 0x0000000000000000ULL, 0x0000000000002010ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlCurrFxRateCalc
+static struct _ofixEnumSpec	enum160 = { { 0x0033000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlInstMode
+static struct _ofixEnumSpec	enum163 = { { 0x0000000000000000ULL, 0x0000000000144008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlInstTransType
+static struct _ofixEnumSpec	enum165 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlInstSource
+static const char	*enum167_values[] = { "?", "ABS", "AMENDED", "AN", "BA", "BN", "BOX", "BRADY", "BRIDGE", "BUYSELL", "CB", "CD", "CL", "CMBS", "CMO", "COFO", "COFP", "CORP", "CP", "CPP", "CS", "DEFLTED", "DINP", "DN", "DUAL", "EUCD", "EUCORP", "EUCP", "EUSOV", "EUSUPRA", "FAC", "FADN", "FOR", "FORWARD", "FUT", "GO", "IET", "LOFC", "LQN", "MATURED", "MBS", "MF", "MIO", "MLEG", "MPO", "MPP", "MPT", "MT", "MTN", "NONE", "ONITE", "OPT", "PEF", "PFAND", "PN", "PS", "PZFJ", "RAN", "REPLACD", "REPO", "RETIRED", "REV", "RVLV", "RVLVTRM", "SECLOAN", "SECPLEDGE", "SPCLA", "SPCLO", "SPCLT", "STN", "STRUCT", "SUPRA", "SWING", "TAN", "TAXA", "TBA", "TBILL", "TBOND", "TCAL", "TD", "TECP", "TERM", "TINT", "TIPS", "TNOTE", "TPRN", "TRAN", "VRDN", "WAR", "WITHDRN", "XCN", "XLINKD", "YANK", "YCD" };
+static struct _ofixEnumSpec	enum167 = { { 0, 0, 0, 0 }, 94, enum167_values }; // SecurityType
+static struct _ofixEnumSpec	enum169 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // StandInstDbType
+static struct _ofixEnumSpec	enum172 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlDeliveryType
+static struct _ofixEnumSpec	enum197 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocLinkType
+static struct _ofixEnumSpec	enum203 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CoveredOrUncovered
+static struct _ofixEnumSpec	enum209 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocHandlInst
+static struct _ofixEnumSpec	enum216 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // RoutingType
+static const char	*enum221_values[] = { "EONIA", "EUREPO", "Euribor", "FutureSWAP", "LIBID", "LIBOR", "MuniAAA", "OTHER", "Pfandbriefe", "SONIA", "SWAP", "Treasury" };
+static struct _ofixEnumSpec	enum221 = { { 0, 0, 0, 0 }, 12, enum221_values }; // BenchmarkCurveName
+static const char	*enum233_values[] = { "ABS", "AMT", "AUTOREINV", "BANKQUAL", "BGNCON", "COUPON", "CPP", "CPR", "CPY", "CURRENCY", "CUSTOMDATE", "GEOG", "HAIRCUT", "HEP", "INSURED", "ISSUE", "ISSUER", "ISSUESIZE", "LOOKBACK", "LOT", "LOTVAR", "MAT", "MATURITY", "MAXSUBS", "MHP", "MINDNOM", "MININCR", "MINQTY", "MPR", "PAYFREQ", "PIECES", "PMAX", "PPC", "PPL", "PPM", "PPT", "PRICE", "PRICEFREQ", "PROD", "PROTECT", "PSA", "PURPOSE", "PXSOURCE", "RATING", "RESTRICTED", "SECTOR", "SECTYPE", "SMM", "STRUCT", "SUBSFREQ", "SUBSLEFT", "TEXT", "TRDVAR", "WAC", "WAL", "WALA", "WAM", "WHOLE", "YIELD" };
+static struct _ofixEnumSpec	enum233 = { { 0, 0, 0, 0 }, 59, enum233_values }; // StipulationType
+static const char	*enum234_values[] = { "CB", "CC", "CD", "CP", "CR", "CS", "GD", "SP", "TR", "XB", "XC", "XD", "XP", "XR" };
+static struct _ofixEnumSpec	enum234 = { { 0, 0, 0, 0 }, 14, enum234_values }; // StipulationValue
+static const char	*enum235_values[] = { "AFTERTAX", "ANNUAL", "ATISSUE", "AVGMATURITY", "BOOK", "CALL", "CHANGE", "CLOSE", "COMPOUND", "CURRENT", "GOVTEQUIV", "GROSS", "INFLATION", "INVERSEFLOATER", "LASTCLOSE", "LASTMONTH", "LASTQUARTER", "LASTYEAR", "LONGAVGLIFE", "MARK", "MATURITY", "NEXTREFUND", "OPENAVG", "PREVCLOSE", "PROCEEDS", "PUT", "SEMIANNUAL", "SHORTAVGLIFE", "SIMPLE", "TAXEQUIV", "TENDER", "TRUE", "VALUE1_32", "WORST" };
+static struct _ofixEnumSpec	enum235 = { { 0, 0, 0, 0 }, 34, enum235_values }; // YieldType
+static struct _ofixEnumSpec	enum263 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SubscriptionRequestType
+static struct _ofixEnumSpec	enum265 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDUpdateType
+static struct _ofixEnumSpec	enum269 = { { 0x03ff000000000000ULL, 0x000000000000000eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDEntryType
+static struct _ofixEnumSpec	enum274 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TickDirection
+static struct _ofixEnumSpec	enum276 = { { 0x0000000000000000ULL, 0x00000000000003feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteCondition
+static struct _ofixEnumSpec	enum277 = { { 0x0000000000000000ULL, 0x0000000000077ffeULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeCondition
+static struct _ofixEnumSpec	enum279 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDUpdateAction
+static struct _ofixEnumSpec	enum281 = { { 0x03ff000000000000ULL, 0x000000000000000eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MDReqRejReason
+static struct _ofixEnumSpec	enum285 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DeleteReason
+static struct _ofixEnumSpec	enum286 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OpenCloseSettlFlag
+static struct _ofixEnumSpec	enum291 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // FinancialStatus
+static struct _ofixEnumSpec	enum292 = { { 0x0000000000000000ULL, 0x000000000000003eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CorporateAction
+static const char	*enum297_values[] = { "0", "1", "10", "11", "12", "13", "14", "15", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum297 = { { 0, 0, 0, 0 }, 16, enum297_values }; // QuoteStatus
+static struct _ofixEnumSpec	enum298 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteCancelType
+static struct _ofixEnumSpec	enum300 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteRejectReason
+static struct _ofixEnumSpec	enum301 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteResponseLevel
+static struct _ofixEnumSpec	enum303 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteRequestType
+static struct _ofixEnumSpec	enum321 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityRequestType
+static struct _ofixEnumSpec	enum323 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityResponseType
+static const char	*enum326_values[] = { "1", "10", "11", "12", "13", "14", "15", "16", "17", "18", "19", "2", "20", "21", "22", "23", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum326 = { { 0, 0, 0, 0 }, 23, enum326_values }; // SecurityTradingStatus
+static struct _ofixEnumSpec	enum327 = { { 0x0000000000000000ULL, 0x0000000001012230ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // HaltReason
+static struct _ofixEnumSpec	enum334 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Adjustment
+static struct _ofixEnumSpec	enum338 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesMethod
+static struct _ofixEnumSpec	enum339 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesMode
+static struct _ofixEnumSpec	enum340 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesStatus
+static const char	*enum347_values[] = { "EUC-JP", "ISO-2022-JP", "SHIFT_JIS", "UTF-8" };
+static struct _ofixEnumSpec	enum347 = { { 0, 0, 0, 0 }, 4, enum347_values }; // MessageEncoding
+static struct _ofixEnumSpec	enum368 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteEntryRejectReason
+static const char	*enum373_values[] = { "0", "1", "10", "11", "12", "13", "14", "15", "16", "17", "2", "3", "4", "5", "6", "7", "8", "9", "99" };
+static struct _ofixEnumSpec	enum373 = { { 0, 0, 0, 0 }, 19, enum373_values }; // SessionRejectReason
+static struct _ofixEnumSpec	enum374 = { { 0x0000000000000000ULL, 0x0000000000004008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BidRequestTransType
+static struct _ofixEnumSpec	enum378 = { { 0x03ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecRestatementReason
+static struct _ofixEnumSpec	enum380 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BusinessRejectReason
+static struct _ofixEnumSpec	enum385 = { { 0x0000000000000000ULL, 0x00000000000c0000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MsgDirection
+static struct _ofixEnumSpec	enum388 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DiscretionInst
+static struct _ofixEnumSpec	enum394 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BidType
+static struct _ofixEnumSpec	enum399 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BidDescriptorType
+static struct _ofixEnumSpec	enum401 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SideValueInd
+static struct _ofixEnumSpec	enum409 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // LiquidityIndType
+static struct _ofixEnumSpec	enum414 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ProgRptReqs
+static struct _ofixEnumSpec	enum416 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // IncTaxInd
+static struct _ofixEnumSpec	enum418 = { { 0x0000000000000000ULL, 0x0000000000040482ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BidTradeType
+static struct _ofixEnumSpec	enum419 = { { 0x03fc000000000000ULL, 0x000000000400001eULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BasisPxType
+static struct _ofixEnumSpec	enum423 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PriceType
+static struct _ofixEnumSpec	enum427 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // GTBookingInst
+static struct _ofixEnumSpec	enum429 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ListStatusType
+static struct _ofixEnumSpec	enum430 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // NetGrossInd
+static struct _ofixEnumSpec	enum431 = { { 0x00fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ListOrderStatus
+static struct _ofixEnumSpec	enum433 = { { 0x003e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ListExecInstType
+static struct _ofixEnumSpec	enum434 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CxlRejResponseTo
+static struct _ofixEnumSpec	enum442 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MultiLegReportingType
+static struct _ofixEnumSpec	enum447 = { { 0x03fe000000000000ULL, 0x00000000000003feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PartyIDSource
+static const char	*enum452_values[] = { "1", "10", "11", "12", "13", "14", "15", "16", "17", "18", "19", "2", "20", "21", "22", "24", "25", "26", "27", "28", "29", "3", "30", "31", "32", "33", "34", "35", "36", "37", "38", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum452 = { { 0, 0, 0, 0 }, 37, enum452_values }; // PartyRole
+static const char	*enum460_values[] = { "1", "10", "11", "12", "13", "2", "3", "4", "5", "6", "7", "8", "9" };
+static struct _ofixEnumSpec	enum460 = { { 0, 0, 0, 0 }, 13, enum460_values }; // Product
+static struct _ofixEnumSpec	enum465 = { { 0x01fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuantityType
+static struct _ofixEnumSpec	enum468 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // RoundingDirection
+static struct _ofixEnumSpec	enum477 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DistribPaymentMethod
+static struct _ofixEnumSpec	enum480 = { { 0x0000000000000000ULL, 0x000000000000e000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CancellationRights
+static struct _ofixEnumSpec	enum481 = { { 0x000e000000000000ULL, 0x0000000002004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MoneyLaunderingStatus
+static struct _ofixEnumSpec	enum484 = { { 0x0000000000000000ULL, 0x00000000000b803cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExecPriceType
+static struct _ofixEnumSpec	enum487 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeReportTransType
+static struct _ofixEnumSpec	enum492 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PaymentMethod
+static const char	*enum495_values[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "999" };
+static struct _ofixEnumSpec	enum495 = { { 0, 0, 0, 0 }, 11, enum495_values }; // TaxAdvantageType
+static struct _ofixEnumSpec	enum497 = { { 0x0000000000000000ULL, 0x0000000002004000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // FundRenewWaiv
+static struct _ofixEnumSpec	enum506 = { { 0x0000000000000000ULL, 0x0000000000044102ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // RegistStatus
+static const char	*enum507_values[] = { "1", "10", "11", "12", "13", "14", "15", "16", "17", "18", "2", "3", "4", "5", "6", "7", "8", "9", "99" };
+static struct _ofixEnumSpec	enum507 = { { 0, 0, 0, 0 }, 19, enum507_values }; // RegistRejReasonCode
+static struct _ofixEnumSpec	enum514 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // RegistTransType
+static struct _ofixEnumSpec	enum517 = { { 0x0004000000000000ULL, 0x0000000000100400ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OwnershipType
+static struct _ofixEnumSpec	enum519 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ContAmtType
+static struct _ofixEnumSpec	enum522 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OwnerType
+static struct _ofixEnumSpec	enum528 = { { 0x0000000000000000ULL, 0x0000000000850282ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrderCapacity
+static struct _ofixEnumSpec	enum529 = { { 0x03fe000000000000ULL, 0x0000000000000002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // OrderRestrictions
+static struct _ofixEnumSpec	enum530 = { { 0x00fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MassCancelRequestType
+static struct _ofixEnumSpec	enum531 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MassCancelResponse
+static struct _ofixEnumSpec	enum532 = { { 0x007f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MassCancelRejectReason
+static struct _ofixEnumSpec	enum537 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteType
+static struct _ofixEnumSpec	enum544 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CashMargin
+static struct _ofixEnumSpec	enum546 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // Scope
+static struct _ofixEnumSpec	enum549 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CrossType
+static struct _ofixEnumSpec	enum550 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CrossPrioritization
+static struct _ofixEnumSpec	enum552 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // NoSides
+static struct _ofixEnumSpec	enum559 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityListRequestType
+static struct _ofixEnumSpec	enum560 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SecurityRequestResult
+static struct _ofixEnumSpec	enum563 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MultiLegRptTypeReq
+static struct _ofixEnumSpec	enum567 = { { 0x0002000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradSesStatusRejReason
+static struct _ofixEnumSpec	enum569 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeRequestType
+static struct _ofixEnumSpec	enum573 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MatchStatus
+static struct _ofixEnumSpec	enum577 = { { 0x03ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ClearingInstruction
+static struct _ofixEnumSpec	enum581 = { { 0x01de000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AccountType
+static struct _ofixEnumSpec	enum582 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CustOrderCapacity
+static struct _ofixEnumSpec	enum585 = { { 0x01fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MassStatusReqType
+static struct _ofixEnumSpec	enum589 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DayBookingInst
+static struct _ofixEnumSpec	enum590 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BookingUnit
+static struct _ofixEnumSpec	enum591 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PreallocMethod
+static struct _ofixEnumSpec	enum626 = { { 0x01a6000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocType
+static struct _ofixEnumSpec	enum635 = { { 0x0000000000000000ULL, 0x000000000000336cULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ClearingFeeIndicator
+static struct _ofixEnumSpec	enum638 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PriorityIndicator
+static const char	*enum658_values[] = { "1", "10", "2", "3", "4", "5", "6", "7", "8", "9", "99" };
+static struct _ofixEnumSpec	enum658 = { { 0, 0, 0, 0 }, 11, enum658_values }; // QuoteRequestRejectReason
+static struct _ofixEnumSpec	enum660 = { { 0x003e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AcctIDSource
+static struct _ofixEnumSpec	enum665 = { { 0x003e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ConfirmStatus
+static struct _ofixEnumSpec	enum666 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ConfirmTransType
+static struct _ofixEnumSpec	enum668 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DeliveryForm
+static struct _ofixEnumSpec	enum690 = { { 0x0036000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // LegSwapType
+static struct _ofixEnumSpec	enum692 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuotePriceType
+static struct _ofixEnumSpec	enum694 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QuoteRespType
+static const char	*enum703_values[] = { "ALC", "AS", "ASF", "DLV", "ETR", "EX", "FIN", "IAS", "IES", "PA", "PIT", "SOD", "SPL", "TA", "TOT", "TQ", "TRF", "TX", "XM" };
+static struct _ofixEnumSpec	enum703 = { { 0, 0, 0, 0 }, 19, enum703_values }; // PosType
+static struct _ofixEnumSpec	enum706 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PosQtyStatus
+static const char	*enum707_values[] = { "CASH", "CRES", "FMTM", "IMTM", "PREM", "SMTM", "TVAR", "VADJ" };
+static struct _ofixEnumSpec	enum707 = { { 0, 0, 0, 0 }, 8, enum707_values }; // PosAmtType
+static struct _ofixEnumSpec	enum709 = { { 0x003e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PosTransType
+static struct _ofixEnumSpec	enum712 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PosMaintAction
+static struct _ofixEnumSpec	enum718 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AdjustmentType
+static struct _ofixEnumSpec	enum722 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PosMaintStatus
+static struct _ofixEnumSpec	enum723 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PosMaintResult
+static struct _ofixEnumSpec	enum724 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PosReqType
+static struct _ofixEnumSpec	enum725 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ResponseTransportType
+static const char	*enum728_values[] = { "0", "1", "2", "3", "4", "99" };
+static struct _ofixEnumSpec	enum728 = { { 0, 0, 0, 0 }, 6, enum728_values }; // PosReqResult
+static struct _ofixEnumSpec	enum729 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PosReqStatus
+static struct _ofixEnumSpec	enum731 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlPriceType
+static struct _ofixEnumSpec	enum744 = { { 0x0000000000000000ULL, 0x0000000000050000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AssignmentMethod
+static struct _ofixEnumSpec	enum747 = { { 0x0000000000000000ULL, 0x0000000000002002ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExerciseMethod
+static struct _ofixEnumSpec	enum749 = { { 0x033f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeRequestResult
+static struct _ofixEnumSpec	enum750 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeRequestStatus
+static struct _ofixEnumSpec	enum751 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeReportRejectReason
+static struct _ofixEnumSpec	enum752 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SideMultiLegReportingType
+static struct _ofixEnumSpec	enum761 = { { 0x03fe000000000000ULL, 0x00000000000007feULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BenchmarkSecurityIDSource
+static struct _ofixEnumSpec	enum770 = { { 0x003e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TrdRegTimestampType
+static struct _ofixEnumSpec	enum773 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ConfirmType
+static struct _ofixEnumSpec	enum774 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ConfirmRejReason
+static struct _ofixEnumSpec	enum775 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // BookingType
+static struct _ofixEnumSpec	enum780 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocSettlInstType
+static struct _ofixEnumSpec	enum787 = { { 0x0000000000000000ULL, 0x0000000000080008ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DlvyInstType
+static struct _ofixEnumSpec	enum788 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TerminationType
+static struct _ofixEnumSpec	enum792 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // SettlInstReqRejCode
+static struct _ofixEnumSpec	enum794 = { { 0x0138000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocReportType
+static struct _ofixEnumSpec	enum796 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocCancReplaceReason
+static struct _ofixEnumSpec	enum798 = { { 0x01de000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocAccountType
+static struct _ofixEnumSpec	enum808 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocIntermedReqType
+static struct _ofixEnumSpec	enum814 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ApplQueueResolution
+static struct _ofixEnumSpec	enum815 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ApplQueueAction
+static struct _ofixEnumSpec	enum819 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AvgPxIndicator
+static struct _ofixEnumSpec	enum826 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeAllocIndicator
+static struct _ofixEnumSpec	enum827 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ExpirationCycle
+static struct _ofixEnumSpec	enum828 = { { 0x03ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TrdType
+static struct _ofixEnumSpec	enum835 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PegMoveType
+static struct _ofixEnumSpec	enum836 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PegOffsetType
+static struct _ofixEnumSpec	enum837 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PegLimitType
+static struct _ofixEnumSpec	enum838 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PegRoundDirection
+static struct _ofixEnumSpec	enum840 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // PegScope
+static struct _ofixEnumSpec	enum841 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DiscretionMoveType
+static struct _ofixEnumSpec	enum842 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DiscretionOffsetType
+static struct _ofixEnumSpec	enum843 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DiscretionLimitType
+static struct _ofixEnumSpec	enum844 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DiscretionRoundDirection
+static struct _ofixEnumSpec	enum846 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DiscretionScope
+static struct _ofixEnumSpec	enum851 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // LastLiquidityInd
+static struct _ofixEnumSpec	enum853 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // ShortSaleReason
+static struct _ofixEnumSpec	enum854 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // QtyType
+static struct _ofixEnumSpec	enum856 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TradeReportType
+static struct _ofixEnumSpec	enum857 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AllocNoOrdersType
+static struct _ofixEnumSpec	enum865 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // EventType
+static struct _ofixEnumSpec	enum871 = { { 0x03fe000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // InstrAttribType
+static struct _ofixEnumSpec	enum891 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // MiscFeeBasis
+static struct _ofixEnumSpec	enum895 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollAsgnReason
+static struct _ofixEnumSpec	enum896 = { { 0x00ff000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollInquiryQualifier
+static struct _ofixEnumSpec	enum903 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollAsgnTransType
+static struct _ofixEnumSpec	enum905 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollAsgnRespType
+static struct _ofixEnumSpec	enum906 = { { 0x003f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollAsgnRejectReason
+static struct _ofixEnumSpec	enum910 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollStatus
+static struct _ofixEnumSpec	enum919 = { { 0x000f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // DeliveryType
+static struct _ofixEnumSpec	enum924 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // UserRequestType
+static struct _ofixEnumSpec	enum926 = { { 0x007e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // UserStatus
+static struct _ofixEnumSpec	enum928 = { { 0x001e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // StatusValue
+static struct _ofixEnumSpec	enum935 = { { 0x0116000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // NetworkRequestType
+static struct _ofixEnumSpec	enum937 = { { 0x0006000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // NetworkStatusResponseType
+static struct _ofixEnumSpec	enum939 = { { 0x0003000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // TrdRptStatus
+static struct _ofixEnumSpec	enum940 = { { 0x000e000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // AffirmStatus
+static struct _ofixEnumSpec	enum944 = { { 0x0007000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollAction
+static struct _ofixEnumSpec	enum945 = { { 0x001f000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL, 0x0000000000000000ULL }, 0, 0 }; // CollInquiryStatus
+static const char	*enum946_values[] = { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "99" };
+static struct _ofixEnumSpec	enum946 = { { 0, 0, 0, 0 }, 11, enum946_values }; // CollInquiryResult
+
 // ----- Tags -----
 static struct _ofixTagSpec	tags[] = {
     { 1, OFIX_String, OFIX_Body, 0, 2, "1=", "Account" },
     { 2, OFIX_String, OFIX_Body, 0, 2, "2=", "AdvId" },
     { 3, OFIX_String, OFIX_Body, 0, 2, "3=", "AdvRefID" },
-    { 4, OFIX_Char, OFIX_Body, 0, 2, "4=", "AdvSide" },
-    { 5, OFIX_String, OFIX_Body, 0, 2, "5=", "AdvTransType" },
+    { 4, OFIX_Char, OFIX_Body, 0, 2, "4=", "AdvSide", &enum4 },
+    { 5, OFIX_String, OFIX_Body, 0, 2, "5=", "AdvTransType", &enum5 },
     { 6, OFIX_Price, OFIX_Body, 0, 2, "6=", "AvgPx" },
     { 7, OFIX_SeqNum, OFIX_Body, 0, 2, "7=", "BeginSeqNo" },
     { 8, OFIX_String, OFIX_Header, 0, 2, "8=", "BeginString" },
@@ -22,32 +268,32 @@ static struct _ofixTagSpec	tags[] = {
     { 10, OFIX_String, OFIX_Trailer, 0, 3, "10=", "CheckSum" },
     { 11, OFIX_String, OFIX_Body, 0, 3, "11=", "ClOrdID" },
     { 12, OFIX_Amt, OFIX_Body, 0, 3, "12=", "Commission" },
-    { 13, OFIX_Char, OFIX_Body, 0, 3, "13=", "CommType" },
+    { 13, OFIX_Char, OFIX_Body, 0, 3, "13=", "CommType", &enum13 },
     { 14, OFIX_Qty, OFIX_Body, 0, 3, "14=", "CumQty" },
     { 15, OFIX_Currency, OFIX_Body, 0, 3, "15=", "Currency" },
     { 16, OFIX_SeqNum, OFIX_Body, 0, 3, "16=", "EndSeqNo" },
     { 17, OFIX_String, OFIX_Body, 0, 3, "17=", "ExecID" },
-    { 18, OFIX_MultipleValueString, OFIX_Body, 0, 3, "18=", "ExecInst" },
+    { 18, OFIX_MultipleValueString, OFIX_Body, 0, 3, "18=", "ExecInst", &enum18 },
     { 19, OFIX_String, OFIX_Body, 0, 3, "19=", "ExecRefID" },
-    { 21, OFIX_Char, OFIX_Body, 0, 3, "21=", "HandlInst" },
-    { 22, OFIX_String, OFIX_Body, 0, 3, "22=", "SecurityIDSource" },
+    { 21, OFIX_Char, OFIX_Body, 0, 3, "21=", "HandlInst", &enum21 },
+    { 22, OFIX_String, OFIX_Body, 0, 3, "22=", "SecurityIDSource", &enum22 },
     { 23, OFIX_String, OFIX_Body, 0, 3, "23=", "IOIid" },
-    { 25, OFIX_Char, OFIX_Body, 0, 3, "25=", "IOIQltyInd" },
+    { 25, OFIX_Char, OFIX_Body, 0, 3, "25=", "IOIQltyInd", &enum25 },
     { 26, OFIX_String, OFIX_Body, 0, 3, "26=", "IOIRefID" },
     { 27, OFIX_String, OFIX_Body, 0, 3, "27=", "IOIQty" },
-    { 28, OFIX_Char, OFIX_Body, 0, 3, "28=", "IOITransType" },
-    { 29, OFIX_Char, OFIX_Body, 0, 3, "29=", "LastCapacity" },
+    { 28, OFIX_Char, OFIX_Body, 0, 3, "28=", "IOITransType", &enum28 },
+    { 29, OFIX_Char, OFIX_Body, 0, 3, "29=", "LastCapacity", &enum29 },
     { 30, OFIX_Exchange, OFIX_Body, 0, 3, "30=", "LastMkt" },
     { 31, OFIX_Price, OFIX_Body, 0, 3, "31=", "LastPx" },
     { 32, OFIX_Qty, OFIX_Body, 0, 3, "32=", "LastQty" },
     { 33, OFIX_NumInGroup, OFIX_Body, 0, 3, "33=", "LinesOfText" },
     { 34, OFIX_SeqNum, OFIX_Header, 0, 3, "34=", "MsgSeqNum" },
-    { 35, OFIX_String, OFIX_Header, 0, 3, "35=", "MsgType" },
+    { 35, OFIX_String, OFIX_Header, 0, 3, "35=", "MsgType", &enum35 },
     { 36, OFIX_SeqNum, OFIX_Body, 0, 3, "36=", "NewSeqNo" },
     { 37, OFIX_String, OFIX_Body, 0, 3, "37=", "OrderID" },
     { 38, OFIX_Qty, OFIX_Body, 0, 3, "38=", "OrderQty" },
-    { 39, OFIX_Char, OFIX_Body, 0, 3, "39=", "OrdStatus" },
-    { 40, OFIX_Char, OFIX_Body, 0, 3, "40=", "OrdType" },
+    { 39, OFIX_Char, OFIX_Body, 0, 3, "39=", "OrdStatus", &enum39 },
+    { 40, OFIX_Char, OFIX_Body, 0, 3, "40=", "OrdType", &enum40 },
     { 41, OFIX_String, OFIX_Body, 0, 3, "41=", "OrigClOrdID" },
     { 42, OFIX_UTCTimestamp, OFIX_Body, 0, 3, "42=", "OrigTime" },
     { 43, OFIX_Boolean, OFIX_Header, 0, 3, "43=", "PossDupFlag" },
@@ -58,53 +304,53 @@ static struct _ofixTagSpec	tags[] = {
     { 50, OFIX_String, OFIX_Header, 0, 3, "50=", "SenderSubID" },
     { 52, OFIX_UTCTimestamp, OFIX_Header, 0, 3, "52=", "SendingTime" },
     { 53, OFIX_Qty, OFIX_Body, 0, 3, "53=", "Quantity" },
-    { 54, OFIX_Char, OFIX_Body, 0, 3, "54=", "Side" },
+    { 54, OFIX_Char, OFIX_Body, 0, 3, "54=", "Side", &enum54 },
     { 55, OFIX_String, OFIX_Body, 0, 3, "55=", "Symbol" },
     { 56, OFIX_String, OFIX_Header, 0, 3, "56=", "TargetCompID" },
     { 57, OFIX_String, OFIX_Header, 0, 3, "57=", "TargetSubID" },
     { 58, OFIX_String, OFIX_Body, 0, 3, "58=", "Text" },
-    { 59, OFIX_Char, OFIX_Body, 0, 3, "59=", "TimeInForce" },
+    { 59, OFIX_Char, OFIX_Body, 0, 3, "59=", "TimeInForce", &enum59 },
     { 60, OFIX_UTCTimestamp, OFIX_Body, 0, 3, "60=", "TransactTime" },
-    { 61, OFIX_Char, OFIX_Body, 0, 3, "61=", "Urgency" },
+    { 61, OFIX_Char, OFIX_Body, 0, 3, "61=", "Urgency", &enum61 },
     { 62, OFIX_UTCTimestamp, OFIX_Body, 0, 3, "62=", "ValidUntilTime" },
-    { 63, OFIX_Char, OFIX_Body, 0, 3, "63=", "SettlType" },
+    { 63, OFIX_Char, OFIX_Body, 0, 3, "63=", "SettlType", &enum63 },
     { 64, OFIX_LocalMktDate, OFIX_Body, 0, 3, "64=", "SettlDate" },
-    { 65, OFIX_String, OFIX_Body, 0, 3, "65=", "SymbolSfx" },
+    { 65, OFIX_String, OFIX_Body, 0, 3, "65=", "SymbolSfx", &enum65 },
     { 66, OFIX_String, OFIX_Body, 0, 3, "66=", "ListID" },
     { 67, OFIX_Int, OFIX_Body, 0, 3, "67=", "ListSeqNo" },
     { 68, OFIX_Int, OFIX_Body, 0, 3, "68=", "TotNoOrders" },
     { 69, OFIX_String, OFIX_Body, 0, 3, "69=", "ListExecInst" },
     { 70, OFIX_String, OFIX_Body, 0, 3, "70=", "AllocID" },
-    { 71, OFIX_Char, OFIX_Body, 0, 3, "71=", "AllocTransType" },
+    { 71, OFIX_Char, OFIX_Body, 0, 3, "71=", "AllocTransType", &enum71 },
     { 72, OFIX_String, OFIX_Body, 0, 3, "72=", "RefAllocID" },
     { 73, OFIX_NumInGroup, OFIX_Body, 0, 3, "73=", "NoOrders" },
     { 74, OFIX_Int, OFIX_Body, 0, 3, "74=", "AvgPxPrecision" },
     { 75, OFIX_LocalMktDate, OFIX_Body, 0, 3, "75=", "TradeDate" },
-    { 77, OFIX_Char, OFIX_Body, 0, 3, "77=", "PositionEffect" },
+    { 77, OFIX_Char, OFIX_Body, 0, 3, "77=", "PositionEffect", &enum77 },
     { 78, OFIX_NumInGroup, OFIX_Body, 0, 3, "78=", "NoAllocs" },
     { 79, OFIX_String, OFIX_Body, 0, 3, "79=", "AllocAccount" },
     { 80, OFIX_Qty, OFIX_Body, 0, 3, "80=", "AllocQty" },
-    { 81, OFIX_Char, OFIX_Body, 0, 3, "81=", "ProcessCode" },
+    { 81, OFIX_Char, OFIX_Body, 0, 3, "81=", "ProcessCode", &enum81 },
     { 82, OFIX_NumInGroup, OFIX_Body, 0, 3, "82=", "NoRpts" },
     { 83, OFIX_Int, OFIX_Body, 0, 3, "83=", "RptSeq" },
     { 84, OFIX_Qty, OFIX_Body, 0, 3, "84=", "CxlQty" },
     { 85, OFIX_NumInGroup, OFIX_Body, 0, 3, "85=", "NoDlvyInst" },
-    { 87, OFIX_Int, OFIX_Body, 0, 3, "87=", "AllocStatus" },
-    { 88, OFIX_Int, OFIX_Body, 0, 3, "88=", "AllocRejCode" },
+    { 87, OFIX_Int, OFIX_Body, 0, 3, "87=", "AllocStatus", &enum87 },
+    { 88, OFIX_Int, OFIX_Body, 0, 3, "88=", "AllocRejCode", &enum88 },
     { 89, OFIX_Data, OFIX_Trailer, 93, 3, "89=", "Signature" },
     { 90, OFIX_Length, OFIX_Header, 91, 3, "90=", "SecureDataLen" },
     { 91, OFIX_Data, OFIX_Header, 90, 3, "91=", "SecureData" },
     { 93, OFIX_Length, OFIX_Trailer, 89, 3, "93=", "SignatureLength" },
-    { 94, OFIX_Char, OFIX_Body, 0, 3, "94=", "EmailType" },
+    { 94, OFIX_Char, OFIX_Body, 0, 3, "94=", "EmailType", &enum94 },
     { 95, OFIX_Length, OFIX_Body, 96, 3, "95=", "RawDataLength" },
     { 96, OFIX_Data, OFIX_Body, 95, 3, "96=", "RawData" },
     { 97, OFIX_Boolean, OFIX_Header, 0, 3, "97=", "PossResend" },
-    { 98, OFIX_Int, OFIX_Body, 0, 3, "98=", "EncryptMethod" },
+    { 98, OFIX_Int, OFIX_Body, 0, 3, "98=", "EncryptMethod", &enum98 },
     { 99, OFIX_Price, OFIX_Body, 0, 3, "99=", "StopPx" },
     { 100, OFIX_Exchange, OFIX_Body, 0, 4, "100=", "ExDestination" },
-    { 102, OFIX_Int, OFIX_Body, 0, 4, "102=", "CxlRejReason" },
-    { 103, OFIX_Int, OFIX_Body, 0, 4, "103=", "OrdRejReason" },
-    { 104, OFIX_Char, OFIX_Body, 0, 4, "104=", "IOIQualifier" },
+    { 102, OFIX_Int, OFIX_Body, 0, 4, "102=", "CxlRejReason", &enum102 },
+    { 103, OFIX_Int, OFIX_Body, 0, 4, "103=", "OrdRejReason", &enum103 },
+    { 104, OFIX_Char, OFIX_Body, 0, 4, "104=", "IOIQualifier", &enum104 },
     { 105, OFIX_String, OFIX_Body, 0, 4, "105=", "WaveNo" },
     { 106, OFIX_String, OFIX_Body, 0, 4, "106=", "Issuer" },
     { 107, OFIX_String, OFIX_Body, 0, 4, "107=", "SecurityDesc" },
@@ -125,7 +371,7 @@ static struct _ofixTagSpec	tags[] = {
     { 123, OFIX_Boolean, OFIX_Body, 0, 4, "123=", "GapFillFlag" },
     { 124, OFIX_NumInGroup, OFIX_Body, 0, 4, "124=", "NoExecs" },
     { 126, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "126=", "ExpireTime" },
-    { 127, OFIX_Char, OFIX_Body, 0, 4, "127=", "DKReason" },
+    { 127, OFIX_Char, OFIX_Body, 0, 4, "127=", "DKReason", &enum127 },
     { 128, OFIX_String, OFIX_Header, 0, 4, "128=", "DeliverToCompID" },
     { 129, OFIX_String, OFIX_Header, 0, 4, "129=", "DeliverToSubID" },
     { 130, OFIX_Boolean, OFIX_Body, 0, 4, "130=", "IOINaturalFlag" },
@@ -137,7 +383,7 @@ static struct _ofixTagSpec	tags[] = {
     { 136, OFIX_NumInGroup, OFIX_Body, 0, 4, "136=", "NoMiscFees" },
     { 137, OFIX_Amt, OFIX_Body, 0, 4, "137=", "MiscFeeAmt" },
     { 138, OFIX_Currency, OFIX_Body, 0, 4, "138=", "MiscFeeCurr" },
-    { 139, OFIX_Char, OFIX_Body, 0, 4, "139=", "MiscFeeType" },
+    { 139, OFIX_Char, OFIX_Body, 0, 4, "139=", "MiscFeeType", &enum139 },
     { 140, OFIX_Price, OFIX_Body, 0, 4, "140=", "PrevClosePx" },
     { 141, OFIX_Boolean, OFIX_Body, 0, 4, "141=", "ResetSeqNumFlag" },
     { 142, OFIX_String, OFIX_Header, 0, 4, "142=", "SenderLocationID" },
@@ -148,28 +394,28 @@ static struct _ofixTagSpec	tags[] = {
     { 147, OFIX_String, OFIX_Body, 0, 4, "147=", "Subject" },
     { 148, OFIX_String, OFIX_Body, 0, 4, "148=", "Headline" },
     { 149, OFIX_String, OFIX_Body, 0, 4, "149=", "URLLink" },
-    { 150, OFIX_Char, OFIX_Body, 0, 4, "150=", "ExecType" },
+    { 150, OFIX_Char, OFIX_Body, 0, 4, "150=", "ExecType", &enum150 },
     { 151, OFIX_Qty, OFIX_Body, 0, 4, "151=", "LeavesQty" },
     { 152, OFIX_Qty, OFIX_Body, 0, 4, "152=", "CashOrderQty" },
     { 153, OFIX_Price, OFIX_Body, 0, 4, "153=", "AllocAvgPx" },
     { 154, OFIX_Amt, OFIX_Body, 0, 4, "154=", "AllocNetMoney" },
     { 155, OFIX_Float, OFIX_Body, 0, 4, "155=", "SettlCurrFxRate" },
-    { 156, OFIX_Char, OFIX_Body, 0, 4, "156=", "SettlCurrFxRateCalc" },
+    { 156, OFIX_Char, OFIX_Body, 0, 4, "156=", "SettlCurrFxRateCalc", &enum156 },
     { 157, OFIX_Int, OFIX_Body, 0, 4, "157=", "NumDaysInterest" },
     { 158, OFIX_Percentage, OFIX_Body, 0, 4, "158=", "AccruedInterestRate" },
     { 159, OFIX_Amt, OFIX_Body, 0, 4, "159=", "AccruedInterestAmt" },
-    { 160, OFIX_Char, OFIX_Body, 0, 4, "160=", "SettlInstMode" },
+    { 160, OFIX_Char, OFIX_Body, 0, 4, "160=", "SettlInstMode", &enum160 },
     { 161, OFIX_String, OFIX_Body, 0, 4, "161=", "AllocText" },
     { 162, OFIX_String, OFIX_Body, 0, 4, "162=", "SettlInstID" },
-    { 163, OFIX_Char, OFIX_Body, 0, 4, "163=", "SettlInstTransType" },
+    { 163, OFIX_Char, OFIX_Body, 0, 4, "163=", "SettlInstTransType", &enum163 },
     { 164, OFIX_String, OFIX_Body, 0, 4, "164=", "EmailThreadID" },
-    { 165, OFIX_Char, OFIX_Body, 0, 4, "165=", "SettlInstSource" },
-    { 167, OFIX_String, OFIX_Body, 0, 4, "167=", "SecurityType" },
+    { 165, OFIX_Char, OFIX_Body, 0, 4, "165=", "SettlInstSource", &enum165 },
+    { 167, OFIX_String, OFIX_Body, 0, 4, "167=", "SecurityType", &enum167 },
     { 168, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "168=", "EffectiveTime" },
-    { 169, OFIX_Int, OFIX_Body, 0, 4, "169=", "StandInstDbType" },
+    { 169, OFIX_Int, OFIX_Body, 0, 4, "169=", "StandInstDbType", &enum169 },
     { 170, OFIX_String, OFIX_Body, 0, 4, "170=", "StandInstDbName" },
     { 171, OFIX_String, OFIX_Body, 0, 4, "171=", "StandInstDbID" },
-    { 172, OFIX_Int, OFIX_Body, 0, 4, "172=", "SettlDeliveryType" },
+    { 172, OFIX_Int, OFIX_Body, 0, 4, "172=", "SettlDeliveryType", &enum172 },
     { 188, OFIX_Price, OFIX_Body, 0, 4, "188=", "BidSpotRate" },
     { 189, OFIX_PriceOffset, OFIX_Body, 0, 4, "189=", "BidForwardPoints" },
     { 190, OFIX_Price, OFIX_Body, 0, 4, "190=", "OfferSpotRate" },
@@ -179,27 +425,27 @@ static struct _ofixTagSpec	tags[] = {
     { 194, OFIX_Price, OFIX_Body, 0, 4, "194=", "LastSpotRate" },
     { 195, OFIX_PriceOffset, OFIX_Body, 0, 4, "195=", "LastForwardPoints" },
     { 196, OFIX_String, OFIX_Body, 0, 4, "196=", "AllocLinkID" },
-    { 197, OFIX_Int, OFIX_Body, 0, 4, "197=", "AllocLinkType" },
+    { 197, OFIX_Int, OFIX_Body, 0, 4, "197=", "AllocLinkType", &enum197 },
     { 198, OFIX_String, OFIX_Body, 0, 4, "198=", "SecondaryOrderID" },
     { 199, OFIX_NumInGroup, OFIX_Body, 0, 4, "199=", "NoIOIQualifiers" },
     { 200, OFIX_MonthYear, OFIX_Body, 0, 4, "200=", "MaturityMonthYear" },
     { 202, OFIX_Price, OFIX_Body, 0, 4, "202=", "StrikePrice" },
-    { 203, OFIX_Int, OFIX_Body, 0, 4, "203=", "CoveredOrUncovered" },
+    { 203, OFIX_Int, OFIX_Body, 0, 4, "203=", "CoveredOrUncovered", &enum203 },
     { 206, OFIX_Char, OFIX_Body, 0, 4, "206=", "OptAttribute" },
     { 207, OFIX_Exchange, OFIX_Body, 0, 4, "207=", "SecurityExchange" },
     { 208, OFIX_Boolean, OFIX_Body, 0, 4, "208=", "NotifyBrokerOfCredit" },
-    { 209, OFIX_Int, OFIX_Body, 0, 4, "209=", "AllocHandlInst" },
+    { 209, OFIX_Int, OFIX_Body, 0, 4, "209=", "AllocHandlInst", &enum209 },
     { 210, OFIX_Qty, OFIX_Body, 0, 4, "210=", "MaxShow" },
     { 211, OFIX_Float, OFIX_Body, 0, 4, "211=", "PegOffsetValue" },
     { 212, OFIX_Length, OFIX_Header, 213, 4, "212=", "XmlDataLen" },
     { 213, OFIX_Data, OFIX_Header, 212, 4, "213=", "XmlData" },
     { 214, OFIX_String, OFIX_Body, 0, 4, "214=", "SettlInstRefID" },
     { 215, OFIX_NumInGroup, OFIX_Body, 0, 4, "215=", "NoRoutingIDs" },
-    { 216, OFIX_Int, OFIX_Body, 0, 4, "216=", "RoutingType" },
+    { 216, OFIX_Int, OFIX_Body, 0, 4, "216=", "RoutingType", &enum216 },
     { 217, OFIX_String, OFIX_Body, 0, 4, "217=", "RoutingID" },
     { 218, OFIX_PriceOffset, OFIX_Body, 0, 4, "218=", "Spread" },
     { 220, OFIX_Currency, OFIX_Body, 0, 4, "220=", "BenchmarkCurveCurrency" },
-    { 221, OFIX_String, OFIX_Body, 0, 4, "221=", "BenchmarkCurveName" },
+    { 221, OFIX_String, OFIX_Body, 0, 4, "221=", "BenchmarkCurveName", &enum221 },
     { 222, OFIX_String, OFIX_Body, 0, 4, "222=", "BenchmarkCurvePoint" },
     { 223, OFIX_Percentage, OFIX_Body, 0, 4, "223=", "CouponRate" },
     { 224, OFIX_LocalMktDate, OFIX_Body, 0, 4, "224=", "CouponPaymentDate" },
@@ -211,9 +457,9 @@ static struct _ofixTagSpec	tags[] = {
     { 230, OFIX_LocalMktDate, OFIX_Body, 0, 4, "230=", "ExDate" },
     { 231, OFIX_Float, OFIX_Body, 0, 4, "231=", "ContractMultiplier" },
     { 232, OFIX_NumInGroup, OFIX_Body, 0, 4, "232=", "NoStipulations" },
-    { 233, OFIX_String, OFIX_Body, 0, 4, "233=", "StipulationType" },
-    { 234, OFIX_String, OFIX_Body, 0, 4, "234=", "StipulationValue" },
-    { 235, OFIX_String, OFIX_Body, 0, 4, "235=", "YieldType" },
+    { 233, OFIX_String, OFIX_Body, 0, 4, "233=", "StipulationType", &enum233 },
+    { 234, OFIX_String, OFIX_Body, 0, 4, "234=", "StipulationValue", &enum234 },
+    { 235, OFIX_String, OFIX_Body, 0, 4, "235=", "YieldType", &enum235 },
     { 236, OFIX_Percentage, OFIX_Body, 0, 4, "236=", "Yield" },
     { 237, OFIX_Amt, OFIX_Body, 0, 4, "237=", "TotalTakedown" },
     { 238, OFIX_Amt, OFIX_Body, 0, 4, "238=", "Concession" },
@@ -240,47 +486,47 @@ static struct _ofixTagSpec	tags[] = {
     { 259, OFIX_LocalMktDate, OFIX_Body, 0, 4, "259=", "BasisFeatureDate" },
     { 260, OFIX_Price, OFIX_Body, 0, 4, "260=", "BasisFeaturePrice" },
     { 262, OFIX_String, OFIX_Body, 0, 4, "262=", "MDReqID" },
-    { 263, OFIX_Char, OFIX_Body, 0, 4, "263=", "SubscriptionRequestType" },
+    { 263, OFIX_Char, OFIX_Body, 0, 4, "263=", "SubscriptionRequestType", &enum263 },
     { 264, OFIX_Int, OFIX_Body, 0, 4, "264=", "MarketDepth" },
-    { 265, OFIX_Int, OFIX_Body, 0, 4, "265=", "MDUpdateType" },
+    { 265, OFIX_Int, OFIX_Body, 0, 4, "265=", "MDUpdateType", &enum265 },
     { 266, OFIX_Boolean, OFIX_Body, 0, 4, "266=", "AggregatedBook" },
     { 267, OFIX_NumInGroup, OFIX_Body, 0, 4, "267=", "NoMDEntryTypes" },
     { 268, OFIX_NumInGroup, OFIX_Body, 0, 4, "268=", "NoMDEntries" },
-    { 269, OFIX_Char, OFIX_Body, 0, 4, "269=", "MDEntryType" },
+    { 269, OFIX_Char, OFIX_Body, 0, 4, "269=", "MDEntryType", &enum269 },
     { 270, OFIX_Price, OFIX_Body, 0, 4, "270=", "MDEntryPx" },
     { 271, OFIX_Qty, OFIX_Body, 0, 4, "271=", "MDEntrySize" },
     { 272, OFIX_UTCDateOnly, OFIX_Body, 0, 4, "272=", "MDEntryDate" },
     { 273, OFIX_UTCTimeOnly, OFIX_Body, 0, 4, "273=", "MDEntryTime" },
-    { 274, OFIX_Char, OFIX_Body, 0, 4, "274=", "TickDirection" },
+    { 274, OFIX_Char, OFIX_Body, 0, 4, "274=", "TickDirection", &enum274 },
     { 275, OFIX_Exchange, OFIX_Body, 0, 4, "275=", "MDMkt" },
-    { 276, OFIX_MultipleValueString, OFIX_Body, 0, 4, "276=", "QuoteCondition" },
-    { 277, OFIX_MultipleValueString, OFIX_Body, 0, 4, "277=", "TradeCondition" },
+    { 276, OFIX_MultipleValueString, OFIX_Body, 0, 4, "276=", "QuoteCondition", &enum276 },
+    { 277, OFIX_MultipleValueString, OFIX_Body, 0, 4, "277=", "TradeCondition", &enum277 },
     { 278, OFIX_String, OFIX_Body, 0, 4, "278=", "MDEntryID" },
-    { 279, OFIX_Char, OFIX_Body, 0, 4, "279=", "MDUpdateAction" },
+    { 279, OFIX_Char, OFIX_Body, 0, 4, "279=", "MDUpdateAction", &enum279 },
     { 280, OFIX_String, OFIX_Body, 0, 4, "280=", "MDEntryRefID" },
-    { 281, OFIX_Char, OFIX_Body, 0, 4, "281=", "MDReqRejReason" },
+    { 281, OFIX_Char, OFIX_Body, 0, 4, "281=", "MDReqRejReason", &enum281 },
     { 282, OFIX_String, OFIX_Body, 0, 4, "282=", "MDEntryOriginator" },
     { 283, OFIX_String, OFIX_Body, 0, 4, "283=", "LocationID" },
     { 284, OFIX_String, OFIX_Body, 0, 4, "284=", "DeskID" },
-    { 285, OFIX_Char, OFIX_Body, 0, 4, "285=", "DeleteReason" },
-    { 286, OFIX_MultipleValueString, OFIX_Body, 0, 4, "286=", "OpenCloseSettlFlag" },
+    { 285, OFIX_Char, OFIX_Body, 0, 4, "285=", "DeleteReason", &enum285 },
+    { 286, OFIX_MultipleValueString, OFIX_Body, 0, 4, "286=", "OpenCloseSettlFlag", &enum286 },
     { 287, OFIX_Int, OFIX_Body, 0, 4, "287=", "SellerDays" },
     { 288, OFIX_String, OFIX_Body, 0, 4, "288=", "MDEntryBuyer" },
     { 289, OFIX_String, OFIX_Body, 0, 4, "289=", "MDEntrySeller" },
     { 290, OFIX_Int, OFIX_Body, 0, 4, "290=", "MDEntryPositionNo" },
-    { 291, OFIX_MultipleValueString, OFIX_Body, 0, 4, "291=", "FinancialStatus" },
-    { 292, OFIX_MultipleValueString, OFIX_Body, 0, 4, "292=", "CorporateAction" },
+    { 291, OFIX_MultipleValueString, OFIX_Body, 0, 4, "291=", "FinancialStatus", &enum291 },
+    { 292, OFIX_MultipleValueString, OFIX_Body, 0, 4, "292=", "CorporateAction", &enum292 },
     { 293, OFIX_Qty, OFIX_Body, 0, 4, "293=", "DefBidSize" },
     { 294, OFIX_Qty, OFIX_Body, 0, 4, "294=", "DefOfferSize" },
     { 295, OFIX_NumInGroup, OFIX_Body, 0, 4, "295=", "NoQuoteEntries" },
     { 296, OFIX_NumInGroup, OFIX_Body, 0, 4, "296=", "NoQuoteSets" },
-    { 297, OFIX_Int, OFIX_Body, 0, 4, "297=", "QuoteStatus" },
-    { 298, OFIX_Int, OFIX_Body, 0, 4, "298=", "QuoteCancelType" },
+    { 297, OFIX_Int, OFIX_Body, 0, 4, "297=", "QuoteStatus", &enum297 },
+    { 298, OFIX_Int, OFIX_Body, 0, 4, "298=", "QuoteCancelType", &enum298 },
     { 299, OFIX_String, OFIX_Body, 0, 4, "299=", "QuoteEntryID" },
-    { 300, OFIX_Int, OFIX_Body, 0, 4, "300=", "QuoteRejectReason" },
-    { 301, OFIX_Int, OFIX_Body, 0, 4, "301=", "QuoteResponseLevel" },
+    { 300, OFIX_Int, OFIX_Body, 0, 4, "300=", "QuoteRejectReason", &enum300 },
+    { 301, OFIX_Int, OFIX_Body, 0, 4, "301=", "QuoteResponseLevel", &enum301 },
     { 302, OFIX_String, OFIX_Body, 0, 4, "302=", "QuoteSetID" },
-    { 303, OFIX_Int, OFIX_Body, 0, 4, "303=", "QuoteRequestType" },
+    { 303, OFIX_Int, OFIX_Body, 0, 4, "303=", "QuoteRequestType", &enum303 },
     { 304, OFIX_Int, OFIX_Body, 0, 4, "304=", "TotNoQuoteEntries" },
     { 305, OFIX_String, OFIX_Body, 0, 4, "305=", "UnderlyingSecurityIDSource" },
     { 306, OFIX_String, OFIX_Body, 0, 4, "306=", "UnderlyingIssuer" },
@@ -295,33 +541,33 @@ static struct _ofixTagSpec	tags[] = {
     { 317, OFIX_Char, OFIX_Body, 0, 4, "317=", "UnderlyingOptAttribute" },
     { 318, OFIX_Currency, OFIX_Body, 0, 4, "318=", "UnderlyingCurrency" },
     { 320, OFIX_String, OFIX_Body, 0, 4, "320=", "SecurityReqID" },
-    { 321, OFIX_Int, OFIX_Body, 0, 4, "321=", "SecurityRequestType" },
+    { 321, OFIX_Int, OFIX_Body, 0, 4, "321=", "SecurityRequestType", &enum321 },
     { 322, OFIX_String, OFIX_Body, 0, 4, "322=", "SecurityResponseID" },
-    { 323, OFIX_Int, OFIX_Body, 0, 4, "323=", "SecurityResponseType" },
+    { 323, OFIX_Int, OFIX_Body, 0, 4, "323=", "SecurityResponseType", &enum323 },
     { 324, OFIX_String, OFIX_Body, 0, 4, "324=", "SecurityStatusReqID" },
     { 325, OFIX_Boolean, OFIX_Body, 0, 4, "325=", "UnsolicitedIndicator" },
-    { 326, OFIX_Int, OFIX_Body, 0, 4, "326=", "SecurityTradingStatus" },
-    { 327, OFIX_Char, OFIX_Body, 0, 4, "327=", "HaltReason" },
+    { 326, OFIX_Int, OFIX_Body, 0, 4, "326=", "SecurityTradingStatus", &enum326 },
+    { 327, OFIX_Char, OFIX_Body, 0, 4, "327=", "HaltReason", &enum327 },
     { 328, OFIX_Boolean, OFIX_Body, 0, 4, "328=", "InViewOfCommon" },
     { 329, OFIX_Boolean, OFIX_Body, 0, 4, "329=", "DueToRelated" },
     { 330, OFIX_Qty, OFIX_Body, 0, 4, "330=", "BuyVolume" },
     { 331, OFIX_Qty, OFIX_Body, 0, 4, "331=", "SellVolume" },
     { 332, OFIX_Price, OFIX_Body, 0, 4, "332=", "HighPx" },
     { 333, OFIX_Price, OFIX_Body, 0, 4, "333=", "LowPx" },
-    { 334, OFIX_Int, OFIX_Body, 0, 4, "334=", "Adjustment" },
+    { 334, OFIX_Int, OFIX_Body, 0, 4, "334=", "Adjustment", &enum334 },
     { 335, OFIX_String, OFIX_Body, 0, 4, "335=", "TradSesReqID" },
     { 336, OFIX_String, OFIX_Body, 0, 4, "336=", "TradingSessionID" },
     { 337, OFIX_String, OFIX_Body, 0, 4, "337=", "ContraTrader" },
-    { 338, OFIX_Int, OFIX_Body, 0, 4, "338=", "TradSesMethod" },
-    { 339, OFIX_Int, OFIX_Body, 0, 4, "339=", "TradSesMode" },
-    { 340, OFIX_Int, OFIX_Body, 0, 4, "340=", "TradSesStatus" },
+    { 338, OFIX_Int, OFIX_Body, 0, 4, "338=", "TradSesMethod", &enum338 },
+    { 339, OFIX_Int, OFIX_Body, 0, 4, "339=", "TradSesMode", &enum339 },
+    { 340, OFIX_Int, OFIX_Body, 0, 4, "340=", "TradSesStatus", &enum340 },
     { 341, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "341=", "TradSesStartTime" },
     { 342, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "342=", "TradSesOpenTime" },
     { 343, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "343=", "TradSesPreCloseTime" },
     { 344, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "344=", "TradSesCloseTime" },
     { 345, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "345=", "TradSesEndTime" },
     { 346, OFIX_Int, OFIX_Body, 0, 4, "346=", "NumberOfOrders" },
-    { 347, OFIX_String, OFIX_Header, 0, 4, "347=", "MessageEncoding" },
+    { 347, OFIX_String, OFIX_Header, 0, 4, "347=", "MessageEncoding", &enum347 },
     { 348, OFIX_Length, OFIX_Body, 349, 4, "348=", "EncodedIssuerLen" },
     { 349, OFIX_Data, OFIX_Body, 348, 4, "349=", "EncodedIssuer" },
     { 350, OFIX_Length, OFIX_Body, 351, 4, "350=", "EncodedSecurityDescLen" },
@@ -342,39 +588,39 @@ static struct _ofixTagSpec	tags[] = {
     { 365, OFIX_Data, OFIX_Body, 364, 4, "365=", "EncodedUnderlyingSecurityDesc" },
     { 366, OFIX_Price, OFIX_Body, 0, 4, "366=", "AllocPrice" },
     { 367, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "367=", "QuoteSetValidUntilTime" },
-    { 368, OFIX_Int, OFIX_Body, 0, 4, "368=", "QuoteEntryRejectReason" },
+    { 368, OFIX_Int, OFIX_Body, 0, 4, "368=", "QuoteEntryRejectReason", &enum368 },
     { 369, OFIX_SeqNum, OFIX_Header, 0, 4, "369=", "LastMsgSeqNumProcessed" },
     { 371, OFIX_Int, OFIX_Body, 0, 4, "371=", "RefTagID" },
     { 372, OFIX_String, OFIX_Body, 0, 4, "372=", "RefMsgType" },
-    { 373, OFIX_Int, OFIX_Body, 0, 4, "373=", "SessionRejectReason" },
-    { 374, OFIX_Char, OFIX_Body, 0, 4, "374=", "BidRequestTransType" },
+    { 373, OFIX_Int, OFIX_Body, 0, 4, "373=", "SessionRejectReason", &enum373 },
+    { 374, OFIX_Char, OFIX_Body, 0, 4, "374=", "BidRequestTransType", &enum374 },
     { 375, OFIX_String, OFIX_Body, 0, 4, "375=", "ContraBroker" },
     { 376, OFIX_String, OFIX_Body, 0, 4, "376=", "ComplianceID" },
     { 377, OFIX_Boolean, OFIX_Body, 0, 4, "377=", "SolicitedFlag" },
-    { 378, OFIX_Int, OFIX_Body, 0, 4, "378=", "ExecRestatementReason" },
+    { 378, OFIX_Int, OFIX_Body, 0, 4, "378=", "ExecRestatementReason", &enum378 },
     { 379, OFIX_String, OFIX_Body, 0, 4, "379=", "BusinessRejectRefID" },
-    { 380, OFIX_Int, OFIX_Body, 0, 4, "380=", "BusinessRejectReason" },
+    { 380, OFIX_Int, OFIX_Body, 0, 4, "380=", "BusinessRejectReason", &enum380 },
     { 381, OFIX_Amt, OFIX_Body, 0, 4, "381=", "GrossTradeAmt" },
     { 382, OFIX_NumInGroup, OFIX_Body, 0, 4, "382=", "NoContraBrokers" },
     { 383, OFIX_Length, OFIX_Body, 0, 4, "383=", "MaxMessageSize" },
     { 384, OFIX_NumInGroup, OFIX_Body, 0, 4, "384=", "NoMsgTypes" },
-    { 385, OFIX_Char, OFIX_Body, 0, 4, "385=", "MsgDirection" },
+    { 385, OFIX_Char, OFIX_Body, 0, 4, "385=", "MsgDirection", &enum385 },
     { 386, OFIX_NumInGroup, OFIX_Body, 0, 4, "386=", "NoTradingSessions" },
     { 387, OFIX_Qty, OFIX_Body, 0, 4, "387=", "TotalVolumeTraded" },
-    { 388, OFIX_Char, OFIX_Body, 0, 4, "388=", "DiscretionInst" },
+    { 388, OFIX_Char, OFIX_Body, 0, 4, "388=", "DiscretionInst", &enum388 },
     { 389, OFIX_Float, OFIX_Body, 0, 4, "389=", "DiscretionOffsetValue" },
     { 390, OFIX_String, OFIX_Body, 0, 4, "390=", "BidID" },
     { 391, OFIX_String, OFIX_Body, 0, 4, "391=", "ClientBidID" },
     { 392, OFIX_String, OFIX_Body, 0, 4, "392=", "ListName" },
     { 393, OFIX_Int, OFIX_Body, 0, 4, "393=", "TotNoRelatedSym" },
-    { 394, OFIX_Int, OFIX_Body, 0, 4, "394=", "BidType" },
+    { 394, OFIX_Int, OFIX_Body, 0, 4, "394=", "BidType", &enum394 },
     { 395, OFIX_Int, OFIX_Body, 0, 4, "395=", "NumTickets" },
     { 396, OFIX_Amt, OFIX_Body, 0, 4, "396=", "SideValue1" },
     { 397, OFIX_Amt, OFIX_Body, 0, 4, "397=", "SideValue2" },
     { 398, OFIX_NumInGroup, OFIX_Body, 0, 4, "398=", "NoBidDescriptors" },
-    { 399, OFIX_Int, OFIX_Body, 0, 4, "399=", "BidDescriptorType" },
+    { 399, OFIX_Int, OFIX_Body, 0, 4, "399=", "BidDescriptorType", &enum399 },
     { 400, OFIX_String, OFIX_Body, 0, 4, "400=", "BidDescriptor" },
-    { 401, OFIX_Int, OFIX_Body, 0, 4, "401=", "SideValueInd" },
+    { 401, OFIX_Int, OFIX_Body, 0, 4, "401=", "SideValueInd", &enum401 },
     { 402, OFIX_Percentage, OFIX_Body, 0, 4, "402=", "LiquidityPctLow" },
     { 403, OFIX_Percentage, OFIX_Body, 0, 4, "403=", "LiquidityPctHigh" },
     { 404, OFIX_Amt, OFIX_Body, 0, 4, "404=", "LiquidityValue" },
@@ -382,46 +628,46 @@ static struct _ofixTagSpec	tags[] = {
     { 406, OFIX_Amt, OFIX_Body, 0, 4, "406=", "FairValue" },
     { 407, OFIX_Percentage, OFIX_Body, 0, 4, "407=", "OutsideIndexPct" },
     { 408, OFIX_Amt, OFIX_Body, 0, 4, "408=", "ValueOfFutures" },
-    { 409, OFIX_Int, OFIX_Body, 0, 4, "409=", "LiquidityIndType" },
+    { 409, OFIX_Int, OFIX_Body, 0, 4, "409=", "LiquidityIndType", &enum409 },
     { 410, OFIX_Percentage, OFIX_Body, 0, 4, "410=", "WtAverageLiquidity" },
     { 411, OFIX_Boolean, OFIX_Body, 0, 4, "411=", "ExchangeForPhysical" },
     { 412, OFIX_Amt, OFIX_Body, 0, 4, "412=", "OutMainCntryUIndex" },
     { 413, OFIX_Percentage, OFIX_Body, 0, 4, "413=", "CrossPercent" },
-    { 414, OFIX_Int, OFIX_Body, 0, 4, "414=", "ProgRptReqs" },
+    { 414, OFIX_Int, OFIX_Body, 0, 4, "414=", "ProgRptReqs", &enum414 },
     { 415, OFIX_Int, OFIX_Body, 0, 4, "415=", "ProgPeriodInterval" },
-    { 416, OFIX_Int, OFIX_Body, 0, 4, "416=", "IncTaxInd" },
+    { 416, OFIX_Int, OFIX_Body, 0, 4, "416=", "IncTaxInd", &enum416 },
     { 417, OFIX_Int, OFIX_Body, 0, 4, "417=", "NumBidders" },
-    { 418, OFIX_Char, OFIX_Body, 0, 4, "418=", "BidTradeType" },
-    { 419, OFIX_Char, OFIX_Body, 0, 4, "419=", "BasisPxType" },
+    { 418, OFIX_Char, OFIX_Body, 0, 4, "418=", "BidTradeType", &enum418 },
+    { 419, OFIX_Char, OFIX_Body, 0, 4, "419=", "BasisPxType", &enum419 },
     { 420, OFIX_NumInGroup, OFIX_Body, 0, 4, "420=", "NoBidComponents" },
     { 421, OFIX_Country, OFIX_Body, 0, 4, "421=", "Country" },
     { 422, OFIX_Int, OFIX_Body, 0, 4, "422=", "TotNoStrikes" },
-    { 423, OFIX_Int, OFIX_Body, 0, 4, "423=", "PriceType" },
+    { 423, OFIX_Int, OFIX_Body, 0, 4, "423=", "PriceType", &enum423 },
     { 424, OFIX_Qty, OFIX_Body, 0, 4, "424=", "DayOrderQty" },
     { 425, OFIX_Qty, OFIX_Body, 0, 4, "425=", "DayCumQty" },
     { 426, OFIX_Price, OFIX_Body, 0, 4, "426=", "DayAvgPx" },
-    { 427, OFIX_Int, OFIX_Body, 0, 4, "427=", "GTBookingInst" },
+    { 427, OFIX_Int, OFIX_Body, 0, 4, "427=", "GTBookingInst", &enum427 },
     { 428, OFIX_NumInGroup, OFIX_Body, 0, 4, "428=", "NoStrikes" },
-    { 429, OFIX_Int, OFIX_Body, 0, 4, "429=", "ListStatusType" },
-    { 430, OFIX_Int, OFIX_Body, 0, 4, "430=", "NetGrossInd" },
-    { 431, OFIX_Int, OFIX_Body, 0, 4, "431=", "ListOrderStatus" },
+    { 429, OFIX_Int, OFIX_Body, 0, 4, "429=", "ListStatusType", &enum429 },
+    { 430, OFIX_Int, OFIX_Body, 0, 4, "430=", "NetGrossInd", &enum430 },
+    { 431, OFIX_Int, OFIX_Body, 0, 4, "431=", "ListOrderStatus", &enum431 },
     { 432, OFIX_LocalMktDate, OFIX_Body, 0, 4, "432=", "ExpireDate" },
-    { 433, OFIX_Char, OFIX_Body, 0, 4, "433=", "ListExecInstType" },
-    { 434, OFIX_Char, OFIX_Body, 0, 4, "434=", "CxlRejResponseTo" },
+    { 433, OFIX_Char, OFIX_Body, 0, 4, "433=", "ListExecInstType", &enum433 },
+    { 434, OFIX_Char, OFIX_Body, 0, 4, "434=", "CxlRejResponseTo", &enum434 },
     { 435, OFIX_Percentage, OFIX_Body, 0, 4, "435=", "UnderlyingCouponRate" },
     { 436, OFIX_Float, OFIX_Body, 0, 4, "436=", "UnderlyingContractMultiplier" },
     { 437, OFIX_Qty, OFIX_Body, 0, 4, "437=", "ContraTradeQty" },
     { 438, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "438=", "ContraTradeTime" },
     { 441, OFIX_Int, OFIX_Body, 0, 4, "441=", "LiquidityNumSecurities" },
-    { 442, OFIX_Char, OFIX_Body, 0, 4, "442=", "MultiLegReportingType" },
+    { 442, OFIX_Char, OFIX_Body, 0, 4, "442=", "MultiLegReportingType", &enum442 },
     { 443, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "443=", "StrikeTime" },
     { 444, OFIX_String, OFIX_Body, 0, 4, "444=", "ListStatusText" },
     { 445, OFIX_Length, OFIX_Body, 446, 4, "445=", "EncodedListStatusTextLen" },
     { 446, OFIX_Data, OFIX_Body, 445, 4, "446=", "EncodedListStatusText" },
-    { 447, OFIX_Char, OFIX_Body, 0, 4, "447=", "PartyIDSource" },
+    { 447, OFIX_Char, OFIX_Body, 0, 4, "447=", "PartyIDSource", &enum447 },
     { 448, OFIX_String, OFIX_Body, 0, 4, "448=", "PartyID" },
     { 451, OFIX_PriceOffset, OFIX_Body, 0, 4, "451=", "NetChgPrevDay" },
-    { 452, OFIX_Int, OFIX_Body, 0, 4, "452=", "PartyRole" },
+    { 452, OFIX_Int, OFIX_Body, 0, 4, "452=", "PartyRole", &enum452 },
     { 453, OFIX_NumInGroup, OFIX_Body, 0, 4, "453=", "NoPartyIDs" },
     { 454, OFIX_NumInGroup, OFIX_Body, 0, 4, "454=", "NoSecurityAltID" },
     { 455, OFIX_String, OFIX_Body, 0, 4, "455=", "SecurityAltID" },
@@ -429,15 +675,15 @@ static struct _ofixTagSpec	tags[] = {
     { 457, OFIX_NumInGroup, OFIX_Body, 0, 4, "457=", "NoUnderlyingSecurityAltID" },
     { 458, OFIX_String, OFIX_Body, 0, 4, "458=", "UnderlyingSecurityAltID" },
     { 459, OFIX_String, OFIX_Body, 0, 4, "459=", "UnderlyingSecurityAltIDSource" },
-    { 460, OFIX_Int, OFIX_Body, 0, 4, "460=", "Product" },
+    { 460, OFIX_Int, OFIX_Body, 0, 4, "460=", "Product", &enum460 },
     { 461, OFIX_String, OFIX_Body, 0, 4, "461=", "CFICode" },
     { 462, OFIX_Int, OFIX_Body, 0, 4, "462=", "UnderlyingProduct" },
     { 463, OFIX_String, OFIX_Body, 0, 4, "463=", "UnderlyingCFICode" },
     { 464, OFIX_Boolean, OFIX_Body, 0, 4, "464=", "TestMessageIndicator" },
-    { 465, OFIX_Int, OFIX_Body, 0, 4, "465=", "QuantityType" },
+    { 465, OFIX_Int, OFIX_Body, 0, 4, "465=", "QuantityType", &enum465 },
     { 466, OFIX_String, OFIX_Body, 0, 4, "466=", "BookingRefID" },
     { 467, OFIX_String, OFIX_Body, 0, 4, "467=", "IndividualAllocID" },
-    { 468, OFIX_Char, OFIX_Body, 0, 4, "468=", "RoundingDirection" },
+    { 468, OFIX_Char, OFIX_Body, 0, 4, "468=", "RoundingDirection", &enum468 },
     { 469, OFIX_Float, OFIX_Body, 0, 4, "469=", "RoundingModulus" },
     { 470, OFIX_Country, OFIX_Body, 0, 4, "470=", "CountryOfIssue" },
     { 471, OFIX_String, OFIX_Body, 0, 4, "471=", "StateOrProvinceOfIssue" },
@@ -446,27 +692,27 @@ static struct _ofixTagSpec	tags[] = {
     { 474, OFIX_String, OFIX_Body, 0, 4, "474=", "MailingDtls" },
     { 475, OFIX_Country, OFIX_Body, 0, 4, "475=", "InvestorCountryOfResidence" },
     { 476, OFIX_String, OFIX_Body, 0, 4, "476=", "PaymentRef" },
-    { 477, OFIX_Int, OFIX_Body, 0, 4, "477=", "DistribPaymentMethod" },
+    { 477, OFIX_Int, OFIX_Body, 0, 4, "477=", "DistribPaymentMethod", &enum477 },
     { 478, OFIX_Currency, OFIX_Body, 0, 4, "478=", "CashDistribCurr" },
     { 479, OFIX_Currency, OFIX_Body, 0, 4, "479=", "CommCurrency" },
-    { 480, OFIX_Char, OFIX_Body, 0, 4, "480=", "CancellationRights" },
-    { 481, OFIX_Char, OFIX_Body, 0, 4, "481=", "MoneyLaunderingStatus" },
+    { 480, OFIX_Char, OFIX_Body, 0, 4, "480=", "CancellationRights", &enum480 },
+    { 481, OFIX_Char, OFIX_Body, 0, 4, "481=", "MoneyLaunderingStatus", &enum481 },
     { 482, OFIX_String, OFIX_Body, 0, 4, "482=", "MailingInst" },
     { 483, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "483=", "TransBkdTime" },
-    { 484, OFIX_Char, OFIX_Body, 0, 4, "484=", "ExecPriceType" },
+    { 484, OFIX_Char, OFIX_Body, 0, 4, "484=", "ExecPriceType", &enum484 },
     { 485, OFIX_Float, OFIX_Body, 0, 4, "485=", "ExecPriceAdjustment" },
     { 486, OFIX_LocalMktDate, OFIX_Body, 0, 4, "486=", "DateOfBirth" },
-    { 487, OFIX_Int, OFIX_Body, 0, 4, "487=", "TradeReportTransType" },
+    { 487, OFIX_Int, OFIX_Body, 0, 4, "487=", "TradeReportTransType", &enum487 },
     { 488, OFIX_String, OFIX_Body, 0, 4, "488=", "CardHolderName" },
     { 489, OFIX_String, OFIX_Body, 0, 4, "489=", "CardNumber" },
     { 490, OFIX_LocalMktDate, OFIX_Body, 0, 4, "490=", "CardExpDate" },
     { 491, OFIX_String, OFIX_Body, 0, 4, "491=", "CardIssNum" },
-    { 492, OFIX_Int, OFIX_Body, 0, 4, "492=", "PaymentMethod" },
+    { 492, OFIX_Int, OFIX_Body, 0, 4, "492=", "PaymentMethod", &enum492 },
     { 493, OFIX_String, OFIX_Body, 0, 4, "493=", "RegistAcctType" },
     { 494, OFIX_String, OFIX_Body, 0, 4, "494=", "Designation" },
-    { 495, OFIX_Int, OFIX_Body, 0, 4, "495=", "TaxAdvantageType" },
+    { 495, OFIX_Int, OFIX_Body, 0, 4, "495=", "TaxAdvantageType", &enum495 },
     { 496, OFIX_String, OFIX_Body, 0, 4, "496=", "RegistRejReasonText" },
-    { 497, OFIX_Char, OFIX_Body, 0, 4, "497=", "FundRenewWaiv" },
+    { 497, OFIX_Char, OFIX_Body, 0, 4, "497=", "FundRenewWaiv", &enum497 },
     { 498, OFIX_String, OFIX_Body, 0, 4, "498=", "CashDistribAgentName" },
     { 499, OFIX_String, OFIX_Body, 0, 4, "499=", "CashDistribAgentCode" },
     { 500, OFIX_String, OFIX_Body, 0, 4, "500=", "CashDistribAgentAcctNumber" },
@@ -475,92 +721,92 @@ static struct _ofixTagSpec	tags[] = {
     { 503, OFIX_LocalMktDate, OFIX_Body, 0, 4, "503=", "CardStartDate" },
     { 504, OFIX_LocalMktDate, OFIX_Body, 0, 4, "504=", "PaymentDate" },
     { 505, OFIX_String, OFIX_Body, 0, 4, "505=", "PaymentRemitterID" },
-    { 506, OFIX_Char, OFIX_Body, 0, 4, "506=", "RegistStatus" },
-    { 507, OFIX_Int, OFIX_Body, 0, 4, "507=", "RegistRejReasonCode" },
+    { 506, OFIX_Char, OFIX_Body, 0, 4, "506=", "RegistStatus", &enum506 },
+    { 507, OFIX_Int, OFIX_Body, 0, 4, "507=", "RegistRejReasonCode", &enum507 },
     { 508, OFIX_String, OFIX_Body, 0, 4, "508=", "RegistRefID" },
     { 509, OFIX_String, OFIX_Body, 0, 4, "509=", "RegistDtls" },
     { 510, OFIX_NumInGroup, OFIX_Body, 0, 4, "510=", "NoDistribInsts" },
     { 511, OFIX_String, OFIX_Body, 0, 4, "511=", "RegistEmail" },
     { 512, OFIX_Percentage, OFIX_Body, 0, 4, "512=", "DistribPercentage" },
     { 513, OFIX_String, OFIX_Body, 0, 4, "513=", "RegistID" },
-    { 514, OFIX_Char, OFIX_Body, 0, 4, "514=", "RegistTransType" },
+    { 514, OFIX_Char, OFIX_Body, 0, 4, "514=", "RegistTransType", &enum514 },
     { 515, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "515=", "ExecValuationPoint" },
     { 516, OFIX_Percentage, OFIX_Body, 0, 4, "516=", "OrderPercent" },
-    { 517, OFIX_Char, OFIX_Body, 0, 4, "517=", "OwnershipType" },
+    { 517, OFIX_Char, OFIX_Body, 0, 4, "517=", "OwnershipType", &enum517 },
     { 518, OFIX_NumInGroup, OFIX_Body, 0, 4, "518=", "NoContAmts" },
-    { 519, OFIX_Int, OFIX_Body, 0, 4, "519=", "ContAmtType" },
+    { 519, OFIX_Int, OFIX_Body, 0, 4, "519=", "ContAmtType", &enum519 },
     { 520, OFIX_Float, OFIX_Body, 0, 4, "520=", "ContAmtValue" },
     { 521, OFIX_Currency, OFIX_Body, 0, 4, "521=", "ContAmtCurr" },
-    { 522, OFIX_Int, OFIX_Body, 0, 4, "522=", "OwnerType" },
+    { 522, OFIX_Int, OFIX_Body, 0, 4, "522=", "OwnerType", &enum522 },
     { 523, OFIX_String, OFIX_Body, 0, 4, "523=", "PartySubID" },
     { 524, OFIX_String, OFIX_Body, 0, 4, "524=", "NestedPartyID" },
     { 525, OFIX_Char, OFIX_Body, 0, 4, "525=", "NestedPartyIDSource" },
     { 526, OFIX_String, OFIX_Body, 0, 4, "526=", "SecondaryClOrdID" },
     { 527, OFIX_String, OFIX_Body, 0, 4, "527=", "SecondaryExecID" },
-    { 528, OFIX_Char, OFIX_Body, 0, 4, "528=", "OrderCapacity" },
-    { 529, OFIX_MultipleValueString, OFIX_Body, 0, 4, "529=", "OrderRestrictions" },
-    { 530, OFIX_Char, OFIX_Body, 0, 4, "530=", "MassCancelRequestType" },
-    { 531, OFIX_Char, OFIX_Body, 0, 4, "531=", "MassCancelResponse" },
-    { 532, OFIX_Char, OFIX_Body, 0, 4, "532=", "MassCancelRejectReason" },
+    { 528, OFIX_Char, OFIX_Body, 0, 4, "528=", "OrderCapacity", &enum528 },
+    { 529, OFIX_MultipleValueString, OFIX_Body, 0, 4, "529=", "OrderRestrictions", &enum529 },
+    { 530, OFIX_Char, OFIX_Body, 0, 4, "530=", "MassCancelRequestType", &enum530 },
+    { 531, OFIX_Char, OFIX_Body, 0, 4, "531=", "MassCancelResponse", &enum531 },
+    { 532, OFIX_Char, OFIX_Body, 0, 4, "532=", "MassCancelRejectReason", &enum532 },
     { 533, OFIX_Int, OFIX_Body, 0, 4, "533=", "TotalAffectedOrders" },
     { 534, OFIX_Int, OFIX_Body, 0, 4, "534=", "NoAffectedOrders" },
     { 535, OFIX_String, OFIX_Body, 0, 4, "535=", "AffectedOrderID" },
     { 536, OFIX_String, OFIX_Body, 0, 4, "536=", "AffectedSecondaryOrderID" },
-    { 537, OFIX_Int, OFIX_Body, 0, 4, "537=", "QuoteType" },
+    { 537, OFIX_Int, OFIX_Body, 0, 4, "537=", "QuoteType", &enum537 },
     { 538, OFIX_Int, OFIX_Body, 0, 4, "538=", "NestedPartyRole" },
     { 539, OFIX_NumInGroup, OFIX_Body, 0, 4, "539=", "NoNestedPartyIDs" },
     { 540, OFIX_Amt, OFIX_Body, 0, 4, "540=", "TotalAccruedInterestAmt" },
     { 541, OFIX_LocalMktDate, OFIX_Body, 0, 4, "541=", "MaturityDate" },
     { 542, OFIX_LocalMktDate, OFIX_Body, 0, 4, "542=", "UnderlyingMaturityDate" },
     { 543, OFIX_String, OFIX_Body, 0, 4, "543=", "InstrRegistry" },
-    { 544, OFIX_Char, OFIX_Body, 0, 4, "544=", "CashMargin" },
+    { 544, OFIX_Char, OFIX_Body, 0, 4, "544=", "CashMargin", &enum544 },
     { 545, OFIX_String, OFIX_Body, 0, 4, "545=", "NestedPartySubID" },
-    { 546, OFIX_MultipleValueString, OFIX_Body, 0, 4, "546=", "Scope" },
+    { 546, OFIX_MultipleValueString, OFIX_Body, 0, 4, "546=", "Scope", &enum546 },
     { 547, OFIX_Boolean, OFIX_Body, 0, 4, "547=", "MDImplicitDelete" },
     { 548, OFIX_String, OFIX_Body, 0, 4, "548=", "CrossID" },
-    { 549, OFIX_Int, OFIX_Body, 0, 4, "549=", "CrossType" },
-    { 550, OFIX_Int, OFIX_Body, 0, 4, "550=", "CrossPrioritization" },
+    { 549, OFIX_Int, OFIX_Body, 0, 4, "549=", "CrossType", &enum549 },
+    { 550, OFIX_Int, OFIX_Body, 0, 4, "550=", "CrossPrioritization", &enum550 },
     { 551, OFIX_String, OFIX_Body, 0, 4, "551=", "OrigCrossID" },
-    { 552, OFIX_NumInGroup, OFIX_Body, 0, 4, "552=", "NoSides" },
+    { 552, OFIX_NumInGroup, OFIX_Body, 0, 4, "552=", "NoSides", &enum552 },
     { 553, OFIX_String, OFIX_Body, 0, 4, "553=", "Username" },
     { 554, OFIX_String, OFIX_Body, 0, 4, "554=", "Password" },
     { 555, OFIX_NumInGroup, OFIX_Body, 0, 4, "555=", "NoLegs" },
     { 556, OFIX_Currency, OFIX_Body, 0, 4, "556=", "LegCurrency" },
     { 557, OFIX_Int, OFIX_Body, 0, 4, "557=", "TotNoSecurityTypes" },
     { 558, OFIX_NumInGroup, OFIX_Body, 0, 4, "558=", "NoSecurityTypes" },
-    { 559, OFIX_Int, OFIX_Body, 0, 4, "559=", "SecurityListRequestType" },
-    { 560, OFIX_Int, OFIX_Body, 0, 4, "560=", "SecurityRequestResult" },
+    { 559, OFIX_Int, OFIX_Body, 0, 4, "559=", "SecurityListRequestType", &enum559 },
+    { 560, OFIX_Int, OFIX_Body, 0, 4, "560=", "SecurityRequestResult", &enum560 },
     { 561, OFIX_Qty, OFIX_Body, 0, 4, "561=", "RoundLot" },
     { 562, OFIX_Qty, OFIX_Body, 0, 4, "562=", "MinTradeVol" },
-    { 563, OFIX_Int, OFIX_Body, 0, 4, "563=", "MultiLegRptTypeReq" },
+    { 563, OFIX_Int, OFIX_Body, 0, 4, "563=", "MultiLegRptTypeReq", &enum563 },
     { 564, OFIX_Char, OFIX_Body, 0, 4, "564=", "LegPositionEffect" },
     { 565, OFIX_Int, OFIX_Body, 0, 4, "565=", "LegCoveredOrUncovered" },
     { 566, OFIX_Price, OFIX_Body, 0, 4, "566=", "LegPrice" },
-    { 567, OFIX_Int, OFIX_Body, 0, 4, "567=", "TradSesStatusRejReason" },
+    { 567, OFIX_Int, OFIX_Body, 0, 4, "567=", "TradSesStatusRejReason", &enum567 },
     { 568, OFIX_String, OFIX_Body, 0, 4, "568=", "TradeRequestID" },
-    { 569, OFIX_Int, OFIX_Body, 0, 4, "569=", "TradeRequestType" },
+    { 569, OFIX_Int, OFIX_Body, 0, 4, "569=", "TradeRequestType", &enum569 },
     { 570, OFIX_Boolean, OFIX_Body, 0, 4, "570=", "PreviouslyReported" },
     { 571, OFIX_String, OFIX_Body, 0, 4, "571=", "TradeReportID" },
     { 572, OFIX_String, OFIX_Body, 0, 4, "572=", "TradeReportRefID" },
-    { 573, OFIX_Char, OFIX_Body, 0, 4, "573=", "MatchStatus" },
+    { 573, OFIX_Char, OFIX_Body, 0, 4, "573=", "MatchStatus", &enum573 },
     { 574, OFIX_String, OFIX_Body, 0, 4, "574=", "MatchType" },
     { 575, OFIX_Boolean, OFIX_Body, 0, 4, "575=", "OddLot" },
     { 576, OFIX_Int, OFIX_Body, 0, 4, "576=", "NoClearingInstructions" },
-    { 577, OFIX_Int, OFIX_Body, 0, 4, "577=", "ClearingInstruction" },
+    { 577, OFIX_Int, OFIX_Body, 0, 4, "577=", "ClearingInstruction", &enum577 },
     { 578, OFIX_String, OFIX_Body, 0, 4, "578=", "TradeInputSource" },
     { 579, OFIX_String, OFIX_Body, 0, 4, "579=", "TradeInputDevice" },
     { 580, OFIX_Int, OFIX_Body, 0, 4, "580=", "NoDates" },
-    { 581, OFIX_Int, OFIX_Body, 0, 4, "581=", "AccountType" },
-    { 582, OFIX_Int, OFIX_Body, 0, 4, "582=", "CustOrderCapacity" },
+    { 581, OFIX_Int, OFIX_Body, 0, 4, "581=", "AccountType", &enum581 },
+    { 582, OFIX_Int, OFIX_Body, 0, 4, "582=", "CustOrderCapacity", &enum582 },
     { 583, OFIX_String, OFIX_Body, 0, 4, "583=", "ClOrdLinkID" },
     { 584, OFIX_String, OFIX_Body, 0, 4, "584=", "MassStatusReqID" },
-    { 585, OFIX_Int, OFIX_Body, 0, 4, "585=", "MassStatusReqType" },
+    { 585, OFIX_Int, OFIX_Body, 0, 4, "585=", "MassStatusReqType", &enum585 },
     { 586, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "586=", "OrigOrdModTime" },
     { 587, OFIX_Char, OFIX_Body, 0, 4, "587=", "LegSettlType" },
     { 588, OFIX_LocalMktDate, OFIX_Body, 0, 4, "588=", "LegSettlDate" },
-    { 589, OFIX_Char, OFIX_Body, 0, 4, "589=", "DayBookingInst" },
-    { 590, OFIX_Char, OFIX_Body, 0, 4, "590=", "BookingUnit" },
-    { 591, OFIX_Char, OFIX_Body, 0, 4, "591=", "PreallocMethod" },
+    { 589, OFIX_Char, OFIX_Body, 0, 4, "589=", "DayBookingInst", &enum589 },
+    { 590, OFIX_Char, OFIX_Body, 0, 4, "590=", "BookingUnit", &enum590 },
+    { 591, OFIX_Char, OFIX_Body, 0, 4, "591=", "PreallocMethod", &enum591 },
     { 592, OFIX_Country, OFIX_Body, 0, 4, "592=", "UnderlyingCountryOfIssue" },
     { 593, OFIX_String, OFIX_Body, 0, 4, "593=", "UnderlyingStateOrProvinceOfIssue" },
     { 594, OFIX_String, OFIX_Body, 0, 4, "594=", "UnderlyingLocaleOfIssue" },
@@ -595,7 +841,7 @@ static struct _ofixTagSpec	tags[] = {
     { 623, OFIX_Float, OFIX_Body, 0, 4, "623=", "LegRatioQty" },
     { 624, OFIX_Char, OFIX_Body, 0, 4, "624=", "LegSide" },
     { 625, OFIX_String, OFIX_Body, 0, 4, "625=", "TradingSessionSubID" },
-    { 626, OFIX_Int, OFIX_Body, 0, 4, "626=", "AllocType" },
+    { 626, OFIX_Int, OFIX_Body, 0, 4, "626=", "AllocType", &enum626 },
     { 627, OFIX_NumInGroup, OFIX_Header, 0, 4, "627=", "NoHops" },
     { 628, OFIX_String, OFIX_Header, 0, 4, "628=", "HopCompID" },
     { 629, OFIX_UTCTimestamp, OFIX_Header, 0, 4, "629=", "HopSendingTime" },
@@ -604,10 +850,10 @@ static struct _ofixTagSpec	tags[] = {
     { 632, OFIX_Percentage, OFIX_Body, 0, 4, "632=", "BidYield" },
     { 633, OFIX_Percentage, OFIX_Body, 0, 4, "633=", "MidYield" },
     { 634, OFIX_Percentage, OFIX_Body, 0, 4, "634=", "OfferYield" },
-    { 635, OFIX_String, OFIX_Body, 0, 4, "635=", "ClearingFeeIndicator" },
+    { 635, OFIX_String, OFIX_Body, 0, 4, "635=", "ClearingFeeIndicator", &enum635 },
     { 636, OFIX_Boolean, OFIX_Body, 0, 4, "636=", "WorkingIndicator" },
     { 637, OFIX_Price, OFIX_Body, 0, 4, "637=", "LegLastPx" },
-    { 638, OFIX_Int, OFIX_Body, 0, 4, "638=", "PriorityIndicator" },
+    { 638, OFIX_Int, OFIX_Body, 0, 4, "638=", "PriorityIndicator", &enum638 },
     { 639, OFIX_PriceOffset, OFIX_Body, 0, 4, "639=", "PriceImprovement" },
     { 640, OFIX_Price, OFIX_Body, 0, 4, "640=", "Price2" },
     { 641, OFIX_PriceOffset, OFIX_Body, 0, 4, "641=", "LastForwardPoints2" },
@@ -626,17 +872,17 @@ static struct _ofixTagSpec	tags[] = {
     { 655, OFIX_String, OFIX_Body, 0, 4, "655=", "ContraLegRefID" },
     { 656, OFIX_Float, OFIX_Body, 0, 4, "656=", "SettlCurrBidFxRate" },
     { 657, OFIX_Float, OFIX_Body, 0, 4, "657=", "SettlCurrOfferFxRate" },
-    { 658, OFIX_Int, OFIX_Body, 0, 4, "658=", "QuoteRequestRejectReason" },
+    { 658, OFIX_Int, OFIX_Body, 0, 4, "658=", "QuoteRequestRejectReason", &enum658 },
     { 659, OFIX_String, OFIX_Body, 0, 4, "659=", "SideComplianceID" },
-    { 660, OFIX_Int, OFIX_Body, 0, 4, "660=", "AcctIDSource" },
+    { 660, OFIX_Int, OFIX_Body, 0, 4, "660=", "AcctIDSource", &enum660 },
     { 661, OFIX_Int, OFIX_Body, 0, 4, "661=", "AllocAcctIDSource" },
     { 662, OFIX_Price, OFIX_Body, 0, 4, "662=", "BenchmarkPrice" },
     { 663, OFIX_Int, OFIX_Body, 0, 4, "663=", "BenchmarkPriceType" },
     { 664, OFIX_String, OFIX_Body, 0, 4, "664=", "ConfirmID" },
-    { 665, OFIX_Int, OFIX_Body, 0, 4, "665=", "ConfirmStatus" },
-    { 666, OFIX_Int, OFIX_Body, 0, 4, "666=", "ConfirmTransType" },
+    { 665, OFIX_Int, OFIX_Body, 0, 4, "665=", "ConfirmStatus", &enum665 },
+    { 666, OFIX_Int, OFIX_Body, 0, 4, "666=", "ConfirmTransType", &enum666 },
     { 667, OFIX_MonthYear, OFIX_Body, 0, 4, "667=", "ContractSettlMonth" },
-    { 668, OFIX_Int, OFIX_Body, 0, 4, "668=", "DeliveryForm" },
+    { 668, OFIX_Int, OFIX_Body, 0, 4, "668=", "DeliveryForm", &enum668 },
     { 669, OFIX_Price, OFIX_Body, 0, 4, "669=", "LastParPx" },
     { 670, OFIX_NumInGroup, OFIX_Body, 0, 4, "670=", "NoLegAllocs" },
     { 671, OFIX_String, OFIX_Body, 0, 4, "671=", "LegAllocAccount" },
@@ -658,11 +904,11 @@ static struct _ofixTagSpec	tags[] = {
     { 687, OFIX_Qty, OFIX_Body, 0, 4, "687=", "LegQty" },
     { 688, OFIX_String, OFIX_Body, 0, 4, "688=", "LegStipulationType" },
     { 689, OFIX_String, OFIX_Body, 0, 4, "689=", "LegStipulationValue" },
-    { 690, OFIX_Int, OFIX_Body, 0, 4, "690=", "LegSwapType" },
+    { 690, OFIX_Int, OFIX_Body, 0, 4, "690=", "LegSwapType", &enum690 },
     { 691, OFIX_String, OFIX_Body, 0, 4, "691=", "Pool" },
-    { 692, OFIX_Int, OFIX_Body, 0, 4, "692=", "QuotePriceType" },
+    { 692, OFIX_Int, OFIX_Body, 0, 4, "692=", "QuotePriceType", &enum692 },
     { 693, OFIX_String, OFIX_Body, 0, 4, "693=", "QuoteRespID" },
-    { 694, OFIX_Int, OFIX_Body, 0, 4, "694=", "QuoteRespType" },
+    { 694, OFIX_Int, OFIX_Body, 0, 4, "694=", "QuoteRespType", &enum694 },
     { 695, OFIX_Char, OFIX_Body, 0, 4, "695=", "QuoteQualifier" },
     { 696, OFIX_LocalMktDate, OFIX_Body, 0, 4, "696=", "YieldRedemptionDate" },
     { 697, OFIX_Price, OFIX_Body, 0, 4, "697=", "YieldRedemptionPrice" },
@@ -671,35 +917,35 @@ static struct _ofixTagSpec	tags[] = {
     { 700, OFIX_Boolean, OFIX_Body, 0, 4, "700=", "ReversalIndicator" },
     { 701, OFIX_LocalMktDate, OFIX_Body, 0, 4, "701=", "YieldCalcDate" },
     { 702, OFIX_NumInGroup, OFIX_Body, 0, 4, "702=", "NoPositions" },
-    { 703, OFIX_String, OFIX_Body, 0, 4, "703=", "PosType" },
+    { 703, OFIX_String, OFIX_Body, 0, 4, "703=", "PosType", &enum703 },
     { 704, OFIX_Qty, OFIX_Body, 0, 4, "704=", "LongQty" },
     { 705, OFIX_Qty, OFIX_Body, 0, 4, "705=", "ShortQty" },
-    { 706, OFIX_Int, OFIX_Body, 0, 4, "706=", "PosQtyStatus" },
-    { 707, OFIX_String, OFIX_Body, 0, 4, "707=", "PosAmtType" },
+    { 706, OFIX_Int, OFIX_Body, 0, 4, "706=", "PosQtyStatus", &enum706 },
+    { 707, OFIX_String, OFIX_Body, 0, 4, "707=", "PosAmtType", &enum707 },
     { 708, OFIX_Amt, OFIX_Body, 0, 4, "708=", "PosAmt" },
-    { 709, OFIX_Int, OFIX_Body, 0, 4, "709=", "PosTransType" },
+    { 709, OFIX_Int, OFIX_Body, 0, 4, "709=", "PosTransType", &enum709 },
     { 710, OFIX_String, OFIX_Body, 0, 4, "710=", "PosReqID" },
     { 711, OFIX_NumInGroup, OFIX_Body, 0, 4, "711=", "NoUnderlyings" },
-    { 712, OFIX_Int, OFIX_Body, 0, 4, "712=", "PosMaintAction" },
+    { 712, OFIX_Int, OFIX_Body, 0, 4, "712=", "PosMaintAction", &enum712 },
     { 713, OFIX_String, OFIX_Body, 0, 4, "713=", "OrigPosReqRefID" },
     { 714, OFIX_String, OFIX_Body, 0, 4, "714=", "PosMaintRptRefID" },
     { 715, OFIX_LocalMktDate, OFIX_Body, 0, 4, "715=", "ClearingBusinessDate" },
     { 716, OFIX_String, OFIX_Body, 0, 4, "716=", "SettlSessID" },
     { 717, OFIX_String, OFIX_Body, 0, 4, "717=", "SettlSessSubID" },
-    { 718, OFIX_Int, OFIX_Body, 0, 4, "718=", "AdjustmentType" },
+    { 718, OFIX_Int, OFIX_Body, 0, 4, "718=", "AdjustmentType", &enum718 },
     { 719, OFIX_Boolean, OFIX_Body, 0, 4, "719=", "ContraryInstructionIndicator" },
     { 720, OFIX_Boolean, OFIX_Body, 0, 4, "720=", "PriorSpreadIndicator" },
     { 721, OFIX_String, OFIX_Body, 0, 4, "721=", "PosMaintRptID" },
-    { 722, OFIX_Int, OFIX_Body, 0, 4, "722=", "PosMaintStatus" },
-    { 723, OFIX_Int, OFIX_Body, 0, 4, "723=", "PosMaintResult" },
-    { 724, OFIX_Int, OFIX_Body, 0, 4, "724=", "PosReqType" },
-    { 725, OFIX_Int, OFIX_Body, 0, 4, "725=", "ResponseTransportType" },
+    { 722, OFIX_Int, OFIX_Body, 0, 4, "722=", "PosMaintStatus", &enum722 },
+    { 723, OFIX_Int, OFIX_Body, 0, 4, "723=", "PosMaintResult", &enum723 },
+    { 724, OFIX_Int, OFIX_Body, 0, 4, "724=", "PosReqType", &enum724 },
+    { 725, OFIX_Int, OFIX_Body, 0, 4, "725=", "ResponseTransportType", &enum725 },
     { 726, OFIX_String, OFIX_Body, 0, 4, "726=", "ResponseDestination" },
     { 727, OFIX_Int, OFIX_Body, 0, 4, "727=", "TotalNumPosReports" },
-    { 728, OFIX_Int, OFIX_Body, 0, 4, "728=", "PosReqResult" },
-    { 729, OFIX_Int, OFIX_Body, 0, 4, "729=", "PosReqStatus" },
+    { 728, OFIX_Int, OFIX_Body, 0, 4, "728=", "PosReqResult", &enum728 },
+    { 729, OFIX_Int, OFIX_Body, 0, 4, "729=", "PosReqStatus", &enum729 },
     { 730, OFIX_Price, OFIX_Body, 0, 4, "730=", "SettlPrice" },
-    { 731, OFIX_Int, OFIX_Body, 0, 4, "731=", "SettlPriceType" },
+    { 731, OFIX_Int, OFIX_Body, 0, 4, "731=", "SettlPriceType", &enum731 },
     { 732, OFIX_Price, OFIX_Body, 0, 4, "732=", "UnderlyingSettlPrice" },
     { 733, OFIX_Int, OFIX_Body, 0, 4, "733=", "UnderlyingSettlPriceType" },
     { 734, OFIX_Price, OFIX_Body, 0, 4, "734=", "PriorSettlPrice" },
@@ -712,15 +958,15 @@ static struct _ofixTagSpec	tags[] = {
     { 741, OFIX_Amt, OFIX_Body, 0, 4, "741=", "AllocInterestAtMaturity" },
     { 742, OFIX_Amt, OFIX_Body, 0, 4, "742=", "AllocAccruedInterestAmt" },
     { 743, OFIX_LocalMktDate, OFIX_Body, 0, 4, "743=", "DeliveryDate" },
-    { 744, OFIX_Char, OFIX_Body, 0, 4, "744=", "AssignmentMethod" },
+    { 744, OFIX_Char, OFIX_Body, 0, 4, "744=", "AssignmentMethod", &enum744 },
     { 745, OFIX_Qty, OFIX_Body, 0, 4, "745=", "AssignmentUnit" },
     { 746, OFIX_Amt, OFIX_Body, 0, 4, "746=", "OpenInterest" },
-    { 747, OFIX_Char, OFIX_Body, 0, 4, "747=", "ExerciseMethod" },
+    { 747, OFIX_Char, OFIX_Body, 0, 4, "747=", "ExerciseMethod", &enum747 },
     { 748, OFIX_Int, OFIX_Body, 0, 4, "748=", "TotNumTradeReports" },
-    { 749, OFIX_Int, OFIX_Body, 0, 4, "749=", "TradeRequestResult" },
-    { 750, OFIX_Int, OFIX_Body, 0, 4, "750=", "TradeRequestStatus" },
-    { 751, OFIX_Int, OFIX_Body, 0, 4, "751=", "TradeReportRejectReason" },
-    { 752, OFIX_Int, OFIX_Body, 0, 4, "752=", "SideMultiLegReportingType" },
+    { 749, OFIX_Int, OFIX_Body, 0, 4, "749=", "TradeRequestResult", &enum749 },
+    { 750, OFIX_Int, OFIX_Body, 0, 4, "750=", "TradeRequestStatus", &enum750 },
+    { 751, OFIX_Int, OFIX_Body, 0, 4, "751=", "TradeReportRejectReason", &enum751 },
+    { 752, OFIX_Int, OFIX_Body, 0, 4, "752=", "SideMultiLegReportingType", &enum752 },
     { 753, OFIX_NumInGroup, OFIX_Body, 0, 4, "753=", "NoPosAmt" },
     { 754, OFIX_Boolean, OFIX_Body, 0, 4, "754=", "AutoAcceptIndicator" },
     { 755, OFIX_String, OFIX_Body, 0, 4, "755=", "AllocReportID" },
@@ -729,7 +975,7 @@ static struct _ofixTagSpec	tags[] = {
     { 758, OFIX_Char, OFIX_Body, 0, 4, "758=", "Nested2PartyIDSource" },
     { 759, OFIX_Int, OFIX_Body, 0, 4, "759=", "Nested2PartyRole" },
     { 760, OFIX_String, OFIX_Body, 0, 4, "760=", "Nested2PartySubID" },
-    { 761, OFIX_String, OFIX_Body, 0, 4, "761=", "BenchmarkSecurityIDSource" },
+    { 761, OFIX_String, OFIX_Body, 0, 4, "761=", "BenchmarkSecurityIDSource", &enum761 },
     { 762, OFIX_String, OFIX_Body, 0, 4, "762=", "SecuritySubType" },
     { 763, OFIX_String, OFIX_Body, 0, 4, "763=", "UnderlyingSecuritySubType" },
     { 764, OFIX_String, OFIX_Body, 0, 4, "764=", "LegSecuritySubType" },
@@ -738,35 +984,35 @@ static struct _ofixTagSpec	tags[] = {
     { 767, OFIX_Currency, OFIX_Body, 0, 4, "767=", "AllowableOneSidednessCurr" },
     { 768, OFIX_NumInGroup, OFIX_Body, 0, 4, "768=", "NoTrdRegTimestamps" },
     { 769, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "769=", "TrdRegTimestamp" },
-    { 770, OFIX_Int, OFIX_Body, 0, 4, "770=", "TrdRegTimestampType" },
+    { 770, OFIX_Int, OFIX_Body, 0, 4, "770=", "TrdRegTimestampType", &enum770 },
     { 771, OFIX_String, OFIX_Body, 0, 4, "771=", "TrdRegTimestampOrigin" },
     { 772, OFIX_String, OFIX_Body, 0, 4, "772=", "ConfirmRefID" },
-    { 773, OFIX_Int, OFIX_Body, 0, 4, "773=", "ConfirmType" },
-    { 774, OFIX_Int, OFIX_Body, 0, 4, "774=", "ConfirmRejReason" },
-    { 775, OFIX_Int, OFIX_Body, 0, 4, "775=", "BookingType" },
+    { 773, OFIX_Int, OFIX_Body, 0, 4, "773=", "ConfirmType", &enum773 },
+    { 774, OFIX_Int, OFIX_Body, 0, 4, "774=", "ConfirmRejReason", &enum774 },
+    { 775, OFIX_Int, OFIX_Body, 0, 4, "775=", "BookingType", &enum775 },
     { 776, OFIX_Int, OFIX_Body, 0, 4, "776=", "IndividualAllocRejCode" },
     { 777, OFIX_String, OFIX_Body, 0, 4, "777=", "SettlInstMsgID" },
     { 778, OFIX_NumInGroup, OFIX_Body, 0, 4, "778=", "NoSettlInst" },
     { 779, OFIX_UTCTimestamp, OFIX_Body, 0, 4, "779=", "LastUpdateTime" },
-    { 780, OFIX_Int, OFIX_Body, 0, 4, "780=", "AllocSettlInstType" },
+    { 780, OFIX_Int, OFIX_Body, 0, 4, "780=", "AllocSettlInstType", &enum780 },
     { 781, OFIX_NumInGroup, OFIX_Body, 0, 4, "781=", "NoSettlPartyIDs" },
     { 782, OFIX_String, OFIX_Body, 0, 4, "782=", "SettlPartyID" },
     { 783, OFIX_Char, OFIX_Body, 0, 4, "783=", "SettlPartyIDSource" },
     { 784, OFIX_Int, OFIX_Body, 0, 4, "784=", "SettlPartyRole" },
     { 785, OFIX_String, OFIX_Body, 0, 4, "785=", "SettlPartySubID" },
     { 786, OFIX_Int, OFIX_Body, 0, 4, "786=", "SettlPartySubIDType" },
-    { 787, OFIX_Char, OFIX_Body, 0, 4, "787=", "DlvyInstType" },
-    { 788, OFIX_Int, OFIX_Body, 0, 4, "788=", "TerminationType" },
+    { 787, OFIX_Char, OFIX_Body, 0, 4, "787=", "DlvyInstType", &enum787 },
+    { 788, OFIX_Int, OFIX_Body, 0, 4, "788=", "TerminationType", &enum788 },
     { 789, OFIX_SeqNum, OFIX_Body, 0, 4, "789=", "NextExpectedMsgSeqNum" },
     { 790, OFIX_String, OFIX_Body, 0, 4, "790=", "OrdStatusReqID" },
     { 791, OFIX_String, OFIX_Body, 0, 4, "791=", "SettlInstReqID" },
-    { 792, OFIX_Int, OFIX_Body, 0, 4, "792=", "SettlInstReqRejCode" },
+    { 792, OFIX_Int, OFIX_Body, 0, 4, "792=", "SettlInstReqRejCode", &enum792 },
     { 793, OFIX_String, OFIX_Body, 0, 4, "793=", "SecondaryAllocID" },
-    { 794, OFIX_Int, OFIX_Body, 0, 4, "794=", "AllocReportType" },
+    { 794, OFIX_Int, OFIX_Body, 0, 4, "794=", "AllocReportType", &enum794 },
     { 795, OFIX_String, OFIX_Body, 0, 4, "795=", "AllocReportRefID" },
-    { 796, OFIX_Int, OFIX_Body, 0, 4, "796=", "AllocCancReplaceReason" },
+    { 796, OFIX_Int, OFIX_Body, 0, 4, "796=", "AllocCancReplaceReason", &enum796 },
     { 797, OFIX_Boolean, OFIX_Body, 0, 4, "797=", "CopyMsgIndicator" },
-    { 798, OFIX_Int, OFIX_Body, 0, 4, "798=", "AllocAccountType" },
+    { 798, OFIX_Int, OFIX_Body, 0, 4, "798=", "AllocAccountType", &enum798 },
     { 799, OFIX_Price, OFIX_Body, 0, 4, "799=", "OrderAvgPx" },
     { 800, OFIX_Qty, OFIX_Body, 0, 4, "800=", "OrderBookingQty" },
     { 801, OFIX_NumInGroup, OFIX_Body, 0, 4, "801=", "NoSettlPartySubIDs" },
@@ -776,55 +1022,55 @@ static struct _ofixTagSpec	tags[] = {
     { 805, OFIX_Int, OFIX_Body, 0, 4, "805=", "NestedPartySubIDType" },
     { 806, OFIX_NumInGroup, OFIX_Body, 0, 4, "806=", "NoNested2PartySubIDs" },
     { 807, OFIX_Int, OFIX_Body, 0, 4, "807=", "Nested2PartySubIDType" },
-    { 808, OFIX_Int, OFIX_Body, 0, 4, "808=", "AllocIntermedReqType" },
+    { 808, OFIX_Int, OFIX_Body, 0, 4, "808=", "AllocIntermedReqType", &enum808 },
     { 810, OFIX_Price, OFIX_Body, 0, 4, "810=", "UnderlyingPx" },
     { 811, OFIX_Float, OFIX_Body, 0, 4, "811=", "PriceDelta" },
     { 812, OFIX_Int, OFIX_Body, 0, 4, "812=", "ApplQueueMax" },
     { 813, OFIX_Int, OFIX_Body, 0, 4, "813=", "ApplQueueDepth" },
-    { 814, OFIX_Int, OFIX_Body, 0, 4, "814=", "ApplQueueResolution" },
-    { 815, OFIX_Int, OFIX_Body, 0, 4, "815=", "ApplQueueAction" },
+    { 814, OFIX_Int, OFIX_Body, 0, 4, "814=", "ApplQueueResolution", &enum814 },
+    { 815, OFIX_Int, OFIX_Body, 0, 4, "815=", "ApplQueueAction", &enum815 },
     { 816, OFIX_NumInGroup, OFIX_Body, 0, 4, "816=", "NoAltMDSource" },
     { 817, OFIX_String, OFIX_Body, 0, 4, "817=", "AltMDSourceID" },
     { 818, OFIX_String, OFIX_Body, 0, 4, "818=", "SecondaryTradeReportID" },
-    { 819, OFIX_Int, OFIX_Body, 0, 4, "819=", "AvgPxIndicator" },
+    { 819, OFIX_Int, OFIX_Body, 0, 4, "819=", "AvgPxIndicator", &enum819 },
     { 820, OFIX_String, OFIX_Body, 0, 4, "820=", "TradeLinkID" },
     { 821, OFIX_String, OFIX_Body, 0, 4, "821=", "OrderInputDevice" },
     { 822, OFIX_String, OFIX_Body, 0, 4, "822=", "UnderlyingTradingSessionID" },
     { 823, OFIX_String, OFIX_Body, 0, 4, "823=", "UnderlyingTradingSessionSubID" },
     { 824, OFIX_String, OFIX_Body, 0, 4, "824=", "TradeLegRefID" },
     { 825, OFIX_String, OFIX_Body, 0, 4, "825=", "ExchangeRule" },
-    { 826, OFIX_Int, OFIX_Body, 0, 4, "826=", "TradeAllocIndicator" },
-    { 827, OFIX_Int, OFIX_Body, 0, 4, "827=", "ExpirationCycle" },
-    { 828, OFIX_Int, OFIX_Body, 0, 4, "828=", "TrdType" },
+    { 826, OFIX_Int, OFIX_Body, 0, 4, "826=", "TradeAllocIndicator", &enum826 },
+    { 827, OFIX_Int, OFIX_Body, 0, 4, "827=", "ExpirationCycle", &enum827 },
+    { 828, OFIX_Int, OFIX_Body, 0, 4, "828=", "TrdType", &enum828 },
     { 829, OFIX_Int, OFIX_Body, 0, 4, "829=", "TrdSubType" },
     { 830, OFIX_String, OFIX_Body, 0, 4, "830=", "TransferReason" },
     { 831, OFIX_String, OFIX_Body, 0, 4, "831=", "AsgnReqID" },
     { 832, OFIX_Int, OFIX_Body, 0, 4, "832=", "TotNumAssignmentReports" },
     { 833, OFIX_String, OFIX_Body, 0, 4, "833=", "AsgnRptID" },
     { 834, OFIX_PriceOffset, OFIX_Body, 0, 4, "834=", "ThresholdAmount" },
-    { 835, OFIX_Int, OFIX_Body, 0, 4, "835=", "PegMoveType" },
-    { 836, OFIX_Int, OFIX_Body, 0, 4, "836=", "PegOffsetType" },
-    { 837, OFIX_Int, OFIX_Body, 0, 4, "837=", "PegLimitType" },
-    { 838, OFIX_Int, OFIX_Body, 0, 4, "838=", "PegRoundDirection" },
+    { 835, OFIX_Int, OFIX_Body, 0, 4, "835=", "PegMoveType", &enum835 },
+    { 836, OFIX_Int, OFIX_Body, 0, 4, "836=", "PegOffsetType", &enum836 },
+    { 837, OFIX_Int, OFIX_Body, 0, 4, "837=", "PegLimitType", &enum837 },
+    { 838, OFIX_Int, OFIX_Body, 0, 4, "838=", "PegRoundDirection", &enum838 },
     { 839, OFIX_Price, OFIX_Body, 0, 4, "839=", "PeggedPrice" },
-    { 840, OFIX_Int, OFIX_Body, 0, 4, "840=", "PegScope" },
-    { 841, OFIX_Int, OFIX_Body, 0, 4, "841=", "DiscretionMoveType" },
-    { 842, OFIX_Int, OFIX_Body, 0, 4, "842=", "DiscretionOffsetType" },
-    { 843, OFIX_Int, OFIX_Body, 0, 4, "843=", "DiscretionLimitType" },
-    { 844, OFIX_Int, OFIX_Body, 0, 4, "844=", "DiscretionRoundDirection" },
+    { 840, OFIX_Int, OFIX_Body, 0, 4, "840=", "PegScope", &enum840 },
+    { 841, OFIX_Int, OFIX_Body, 0, 4, "841=", "DiscretionMoveType", &enum841 },
+    { 842, OFIX_Int, OFIX_Body, 0, 4, "842=", "DiscretionOffsetType", &enum842 },
+    { 843, OFIX_Int, OFIX_Body, 0, 4, "843=", "DiscretionLimitType", &enum843 },
+    { 844, OFIX_Int, OFIX_Body, 0, 4, "844=", "DiscretionRoundDirection", &enum844 },
     { 845, OFIX_Price, OFIX_Body, 0, 4, "845=", "DiscretionPrice" },
-    { 846, OFIX_Int, OFIX_Body, 0, 4, "846=", "DiscretionScope" },
+    { 846, OFIX_Int, OFIX_Body, 0, 4, "846=", "DiscretionScope", &enum846 },
     { 847, OFIX_Int, OFIX_Body, 0, 4, "847=", "TargetStrategy" },
     { 848, OFIX_String, OFIX_Body, 0, 4, "848=", "TargetStrategyParameters" },
     { 849, OFIX_Percentage, OFIX_Body, 0, 4, "849=", "ParticipationRate" },
     { 850, OFIX_Float, OFIX_Body, 0, 4, "850=", "TargetStrategyPerformance" },
-    { 851, OFIX_Int, OFIX_Body, 0, 4, "851=", "LastLiquidityInd" },
+    { 851, OFIX_Int, OFIX_Body, 0, 4, "851=", "LastLiquidityInd", &enum851 },
     { 852, OFIX_Boolean, OFIX_Body, 0, 4, "852=", "PublishTrdIndicator" },
-    { 853, OFIX_Int, OFIX_Body, 0, 4, "853=", "ShortSaleReason" },
-    { 854, OFIX_Int, OFIX_Body, 0, 4, "854=", "QtyType" },
+    { 853, OFIX_Int, OFIX_Body, 0, 4, "853=", "ShortSaleReason", &enum853 },
+    { 854, OFIX_Int, OFIX_Body, 0, 4, "854=", "QtyType", &enum854 },
     { 855, OFIX_Int, OFIX_Body, 0, 4, "855=", "SecondaryTrdType" },
-    { 856, OFIX_Int, OFIX_Body, 0, 4, "856=", "TradeReportType" },
-    { 857, OFIX_Int, OFIX_Body, 0, 4, "857=", "AllocNoOrdersType" },
+    { 856, OFIX_Int, OFIX_Body, 0, 4, "856=", "TradeReportType", &enum856 },
+    { 857, OFIX_Int, OFIX_Body, 0, 4, "857=", "AllocNoOrdersType", &enum857 },
     { 858, OFIX_Amt, OFIX_Body, 0, 4, "858=", "SharedCommission" },
     { 859, OFIX_String, OFIX_Body, 0, 4, "859=", "ConfirmReqID" },
     { 860, OFIX_Price, OFIX_Body, 0, 4, "860=", "AvgParPx" },
@@ -832,13 +1078,13 @@ static struct _ofixTagSpec	tags[] = {
     { 862, OFIX_NumInGroup, OFIX_Body, 0, 4, "862=", "NoCapacities" },
     { 863, OFIX_Qty, OFIX_Body, 0, 4, "863=", "OrderCapacityQty" },
     { 864, OFIX_NumInGroup, OFIX_Body, 0, 4, "864=", "NoEvents" },
-    { 865, OFIX_Int, OFIX_Body, 0, 4, "865=", "EventType" },
+    { 865, OFIX_Int, OFIX_Body, 0, 4, "865=", "EventType", &enum865 },
     { 866, OFIX_LocalMktDate, OFIX_Body, 0, 4, "866=", "EventDate" },
     { 867, OFIX_Price, OFIX_Body, 0, 4, "867=", "EventPx" },
     { 868, OFIX_String, OFIX_Body, 0, 4, "868=", "EventText" },
     { 869, OFIX_Percentage, OFIX_Body, 0, 4, "869=", "PctAtRisk" },
     { 870, OFIX_NumInGroup, OFIX_Body, 0, 4, "870=", "NoInstrAttrib" },
-    { 871, OFIX_Int, OFIX_Body, 0, 4, "871=", "InstrAttribType" },
+    { 871, OFIX_Int, OFIX_Body, 0, 4, "871=", "InstrAttribType", &enum871 },
     { 872, OFIX_String, OFIX_Body, 0, 4, "872=", "InstrAttribValue" },
     { 873, OFIX_LocalMktDate, OFIX_Body, 0, 4, "873=", "DatedDate" },
     { 874, OFIX_LocalMktDate, OFIX_Body, 0, 4, "874=", "InterestAccrualDate" },
@@ -858,26 +1104,26 @@ static struct _ofixTagSpec	tags[] = {
     { 888, OFIX_String, OFIX_Body, 0, 4, "888=", "UnderlyingStipType" },
     { 889, OFIX_String, OFIX_Body, 0, 4, "889=", "UnderlyingStipValue" },
     { 890, OFIX_Amt, OFIX_Body, 0, 4, "890=", "MaturityNetMoney" },
-    { 891, OFIX_Int, OFIX_Body, 0, 4, "891=", "MiscFeeBasis" },
+    { 891, OFIX_Int, OFIX_Body, 0, 4, "891=", "MiscFeeBasis", &enum891 },
     { 892, OFIX_Int, OFIX_Body, 0, 4, "892=", "TotNoAllocs" },
     { 893, OFIX_Boolean, OFIX_Body, 0, 4, "893=", "LastFragment" },
     { 894, OFIX_String, OFIX_Body, 0, 4, "894=", "CollReqID" },
-    { 895, OFIX_Int, OFIX_Body, 0, 4, "895=", "CollAsgnReason" },
-    { 896, OFIX_Int, OFIX_Body, 0, 4, "896=", "CollInquiryQualifier" },
+    { 895, OFIX_Int, OFIX_Body, 0, 4, "895=", "CollAsgnReason", &enum895 },
+    { 896, OFIX_Int, OFIX_Body, 0, 4, "896=", "CollInquiryQualifier", &enum896 },
     { 897, OFIX_NumInGroup, OFIX_Body, 0, 4, "897=", "NoTrades" },
     { 898, OFIX_Percentage, OFIX_Body, 0, 4, "898=", "MarginRatio" },
     { 899, OFIX_Amt, OFIX_Body, 0, 4, "899=", "MarginExcess" },
     { 900, OFIX_Amt, OFIX_Body, 0, 4, "900=", "TotalNetValue" },
     { 901, OFIX_Amt, OFIX_Body, 0, 4, "901=", "CashOutstanding" },
     { 902, OFIX_String, OFIX_Body, 0, 4, "902=", "CollAsgnID" },
-    { 903, OFIX_Int, OFIX_Body, 0, 4, "903=", "CollAsgnTransType" },
+    { 903, OFIX_Int, OFIX_Body, 0, 4, "903=", "CollAsgnTransType", &enum903 },
     { 904, OFIX_String, OFIX_Body, 0, 4, "904=", "CollRespID" },
-    { 905, OFIX_Int, OFIX_Body, 0, 4, "905=", "CollAsgnRespType" },
-    { 906, OFIX_Int, OFIX_Body, 0, 4, "906=", "CollAsgnRejectReason" },
+    { 905, OFIX_Int, OFIX_Body, 0, 4, "905=", "CollAsgnRespType", &enum905 },
+    { 906, OFIX_Int, OFIX_Body, 0, 4, "906=", "CollAsgnRejectReason", &enum906 },
     { 907, OFIX_String, OFIX_Body, 0, 4, "907=", "CollAsgnRefID" },
     { 908, OFIX_String, OFIX_Body, 0, 4, "908=", "CollRptID" },
     { 909, OFIX_String, OFIX_Body, 0, 4, "909=", "CollInquiryID" },
-    { 910, OFIX_Int, OFIX_Body, 0, 4, "910=", "CollStatus" },
+    { 910, OFIX_Int, OFIX_Body, 0, 4, "910=", "CollStatus", &enum910 },
     { 911, OFIX_Int, OFIX_Body, 0, 4, "911=", "TotNumReports" },
     { 912, OFIX_Boolean, OFIX_Body, 0, 4, "912=", "LastRptRequested" },
     { 913, OFIX_String, OFIX_Body, 0, 4, "913=", "AgreementDesc" },
@@ -886,34 +1132,34 @@ static struct _ofixTagSpec	tags[] = {
     { 916, OFIX_LocalMktDate, OFIX_Body, 0, 4, "916=", "StartDate" },
     { 917, OFIX_LocalMktDate, OFIX_Body, 0, 4, "917=", "EndDate" },
     { 918, OFIX_Currency, OFIX_Body, 0, 4, "918=", "AgreementCurrency" },
-    { 919, OFIX_Int, OFIX_Body, 0, 4, "919=", "DeliveryType" },
+    { 919, OFIX_Int, OFIX_Body, 0, 4, "919=", "DeliveryType", &enum919 },
     { 920, OFIX_Amt, OFIX_Body, 0, 4, "920=", "EndAccruedInterestAmt" },
     { 921, OFIX_Amt, OFIX_Body, 0, 4, "921=", "StartCash" },
     { 922, OFIX_Amt, OFIX_Body, 0, 4, "922=", "EndCash" },
     { 923, OFIX_String, OFIX_Body, 0, 4, "923=", "UserRequestID" },
-    { 924, OFIX_Int, OFIX_Body, 0, 4, "924=", "UserRequestType" },
+    { 924, OFIX_Int, OFIX_Body, 0, 4, "924=", "UserRequestType", &enum924 },
     { 925, OFIX_String, OFIX_Body, 0, 4, "925=", "NewPassword" },
-    { 926, OFIX_Int, OFIX_Body, 0, 4, "926=", "UserStatus" },
+    { 926, OFIX_Int, OFIX_Body, 0, 4, "926=", "UserStatus", &enum926 },
     { 927, OFIX_String, OFIX_Body, 0, 4, "927=", "UserStatusText" },
-    { 928, OFIX_Int, OFIX_Body, 0, 4, "928=", "StatusValue" },
+    { 928, OFIX_Int, OFIX_Body, 0, 4, "928=", "StatusValue", &enum928 },
     { 929, OFIX_String, OFIX_Body, 0, 4, "929=", "StatusText" },
     { 930, OFIX_String, OFIX_Body, 0, 4, "930=", "RefCompID" },
     { 931, OFIX_String, OFIX_Body, 0, 4, "931=", "RefSubID" },
     { 932, OFIX_String, OFIX_Body, 0, 4, "932=", "NetworkResponseID" },
     { 933, OFIX_String, OFIX_Body, 0, 4, "933=", "NetworkRequestID" },
     { 934, OFIX_String, OFIX_Body, 0, 4, "934=", "LastNetworkResponseID" },
-    { 935, OFIX_Int, OFIX_Body, 0, 4, "935=", "NetworkRequestType" },
+    { 935, OFIX_Int, OFIX_Body, 0, 4, "935=", "NetworkRequestType", &enum935 },
     { 936, OFIX_NumInGroup, OFIX_Body, 0, 4, "936=", "NoCompIDs" },
-    { 937, OFIX_Int, OFIX_Body, 0, 4, "937=", "NetworkStatusResponseType" },
+    { 937, OFIX_Int, OFIX_Body, 0, 4, "937=", "NetworkStatusResponseType", &enum937 },
     { 938, OFIX_NumInGroup, OFIX_Body, 0, 4, "938=", "NoCollInquiryQualifier" },
-    { 939, OFIX_Int, OFIX_Body, 0, 4, "939=", "TrdRptStatus" },
-    { 940, OFIX_Int, OFIX_Body, 0, 4, "940=", "AffirmStatus" },
+    { 939, OFIX_Int, OFIX_Body, 0, 4, "939=", "TrdRptStatus", &enum939 },
+    { 940, OFIX_Int, OFIX_Body, 0, 4, "940=", "AffirmStatus", &enum940 },
     { 941, OFIX_Currency, OFIX_Body, 0, 4, "941=", "UnderlyingStrikeCurrency" },
     { 942, OFIX_Currency, OFIX_Body, 0, 4, "942=", "LegStrikeCurrency" },
     { 943, OFIX_String, OFIX_Body, 0, 4, "943=", "TimeBracket" },
-    { 944, OFIX_Int, OFIX_Body, 0, 4, "944=", "CollAction" },
-    { 945, OFIX_Int, OFIX_Body, 0, 4, "945=", "CollInquiryStatus" },
-    { 946, OFIX_Int, OFIX_Body, 0, 4, "946=", "CollInquiryResult" },
+    { 944, OFIX_Int, OFIX_Body, 0, 4, "944=", "CollAction", &enum944 },
+    { 945, OFIX_Int, OFIX_Body, 0, 4, "945=", "CollInquiryStatus", &enum945 },
+    { 946, OFIX_Int, OFIX_Body, 0, 4, "946=", "CollInquiryResult", &enum946 },
     { 947, OFIX_Currency, OFIX_Body, 0, 4, "947=", "StrikeCurrency" },
     { 948, OFIX_NumInGroup, OFIX_Body, 0, 4, "948=", "NoNested3PartyIDs" },
     { 949, OFIX_String, OFIX_Body, 0, 4, "949=", "Nested3PartyID" },
@@ -932,6 +1178,7 @@ static struct _ofixTagSpec	tags[] = {
 
 static struct _ofixGroupSpec	HeartbeatGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -951,6 +1198,8 @@ static struct _ofixMsgSpec	Heartbeat = {
     "0", // type
     "Heartbeat", // name
     {0,0,0,0,0,0,0,0,1,2,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,8,9,0,29,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041900022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     HeartbeatGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -992,6 +1241,7 @@ static struct _ofixMsgSpec	Heartbeat = {
 
 static struct _ofixGroupSpec	TestRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1011,6 +1261,8 @@ static struct _ofixMsgSpec	TestRequest = {
     "1", // type
     "TestRequest", // name
     {0,0,0,0,0,0,0,0,1,2,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,8,9,0,29,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041900022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TestRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1052,6 +1304,7 @@ static struct _ofixMsgSpec	TestRequest = {
 
 static struct _ofixGroupSpec	ResendRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1071,6 +1324,8 @@ static struct _ofixMsgSpec	ResendRequest = {
     "2", // type
     "ResendRequest", // name
     {0,0,0,0,0,0,0,28,1,2,32,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,8,9,0,30,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00010780ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00010780ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ResendRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1113,6 +1368,7 @@ static struct _ofixMsgSpec	ResendRequest = {
 
 static struct _ofixGroupSpec	RejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1132,6 +1388,8 @@ static struct _ofixMsgSpec	Reject = {
     "3", // type
     "Reject", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,28,0,0,0,4,11,0,21,0,0,0,5,13,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,29,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112200c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716280c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x003a000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     RejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1179,6 +1437,7 @@ static struct _ofixMsgSpec	Reject = {
 
 static struct _ofixGroupSpec	SequenceResetGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1198,6 +1457,8 @@ static struct _ofixMsgSpec	SequenceReset = {
     "4", // type
     "SequenceReset", // name
     {0,0,0,0,0,0,0,0,1,2,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,29,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,8,9,0,30,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,28,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112001c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316081c00000700ULL,0x0c1800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SequenceResetGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1240,6 +1501,7 @@ static struct _ofixMsgSpec	SequenceReset = {
 
 static struct _ofixGroupSpec	LogoutGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1259,6 +1521,8 @@ static struct _ofixMsgSpec	Logout = {
     "5", // type
     "Logout", // name
     {0,0,0,0,0,0,0,0,1,2,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,9,0,31,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,29,30,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     LogoutGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1302,6 +1566,7 @@ static struct _ofixMsgSpec	Logout = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1312,6 +1577,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup627 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -1321,6 +1587,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup454 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -1332,8 +1599,9 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup864 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -1385,6 +1653,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup711 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -1394,6 +1663,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup457 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -1403,6 +1673,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup887 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -1412,6 +1683,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup232 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x00000c0000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -1463,6 +1735,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup555 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -1472,6 +1745,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup604 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -1481,6 +1755,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup683 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup199 = {
     199, // NoIOIQualifiers
+    {0x0000000000000000ULL,0x0000010000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 104, false }, // IOIQualifier
 	{ 0, false }
@@ -1489,6 +1764,7 @@ static struct _ofixGroupSpec	IndicationOfInterestGroup199 = {
 
 static struct _ofixGroupSpec	IndicationOfInterestGroup215 = {
     215, // NoRoutingIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000003000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 216, false }, // RoutingType
 	{ 217, false }, // RoutingID
@@ -1518,6 +1794,8 @@ static struct _ofixMsgSpec	IndicationOfInterest = {
     "6", // type
     "IndicationOfInterest", // name
     {0,0,0,0,0,0,0,0,1,2,122,0,0,0,0,91,0,0,0,0,0,0,34,28,0,97,30,90,29,0,0,0,0,0,10,3,0,0,85,0,0,0,0,19,95,0,0,0,33,4,11,0,21,0,83,31,5,13,100,0,103,0,96,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,8,9,0,120,0,0,0,20,0,0,0,0,0,0,0,0,60,63,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,98,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,104,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,40,0,54,0,0,0,56,59,0,0,0,0,23,24,0,105,0,0,106,0,107,108,109,58,42,43,45,46,47,0,0,57,92,0,0,114,115,0,0,44,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,61,62,64,65,0,0,101,102,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,36,37,0,0,0,0,0,0,88,89,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,49,0,0,0,0,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,110,111,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,117,118,119,112,0,116,0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,113,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,71,72,68,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,74,75,78,79,76,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d2000c18800700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x57d7184c1ec08700ULL,0x04180d022e000002ULL,0x000000800123c007ULL,0xffff9f9ff7b0c580ULL,0x73fe000000000003ULL,0x00023c0cf8000000ULL,0x0018008000000000ULL,0x0000000001f0ffc0ULL,0x00001800e0000010ULL,0x0079ffffffff0000ULL,0x2f0b0c0008c00000ULL,0x1e00001800000080ULL,0x0000040000100000ULL,0x03fcfe1f00400000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     IndicationOfInterestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1650,6 +1928,7 @@ static struct _ofixMsgSpec	IndicationOfInterest = {
 
 static struct _ofixGroupSpec	AdvertisementGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1660,6 +1939,7 @@ static struct _ofixGroupSpec	AdvertisementGroup627 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -1669,6 +1949,7 @@ static struct _ofixGroupSpec	AdvertisementGroup454 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -1680,6 +1961,7 @@ static struct _ofixGroupSpec	AdvertisementGroup864 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -1729,6 +2011,7 @@ static struct _ofixGroupSpec	AdvertisementGroup555 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -1738,6 +2021,7 @@ static struct _ofixGroupSpec	AdvertisementGroup604 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 311, true }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
@@ -1791,6 +2075,7 @@ static struct _ofixGroupSpec	AdvertisementGroup711 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -1800,6 +2085,7 @@ static struct _ofixGroupSpec	AdvertisementGroup457 = {
 
 static struct _ofixGroupSpec	AdvertisementGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -1825,6 +2111,8 @@ static struct _ofixMsgSpec	Advertisement = {
     "7", // type
     "Advertisement", // name
     {0,0,28,30,75,29,0,0,1,2,91,0,0,0,0,79,0,0,0,0,0,0,34,0,0,0,0,0,0,0,86,0,0,0,10,3,0,0,0,0,0,0,0,19,78,0,0,0,33,4,11,0,21,76,0,31,5,13,82,0,81,0,0,0,0,32,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,90,8,9,0,89,0,0,0,20,0,0,0,0,0,0,0,0,60,63,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,54,0,0,0,56,59,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,58,42,43,45,46,47,0,0,57,0,0,0,0,0,0,0,44,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,25,61,62,64,65,0,0,83,84,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,36,37,0,0,0,0,0,0,0,0,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,49,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,71,72,68,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01b2000c00000734ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17b7180c4040873cULL,0x04180c022e000802ULL,0x000000800023c003ULL,0xffff809f8030c500ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00001800e0000000ULL,0x007bffffffff0000ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x0000040000000000ULL,0x03fcfe1f00400000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     AdvertisementGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -1926,6 +2214,7 @@ static struct _ofixMsgSpec	Advertisement = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -1936,6 +2225,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup627 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -1947,6 +2237,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup453 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -1956,6 +2247,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup802 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup382 = {
     382, // NoContraBrokers
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0080000000020000ULL,0x0060000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000008000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 375, false }, // ContraBroker
 	{ 337, false }, // ContraTrader
@@ -1968,6 +2260,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup382 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -1977,6 +2270,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup454 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -1988,8 +2282,9 @@ static struct _ofixGroupSpec	ExecutionReportGroup864 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -2041,6 +2336,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup711 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -2050,6 +2346,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup457 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -2059,6 +2356,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup887 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -2068,6 +2366,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup232 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup518 = {
     518, // NoContAmts
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000380ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 519, false }, // ContAmtType
 	{ 520, false }, // ContAmtValue
@@ -2078,6 +2377,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup518 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070100008000000ULL,0x2001ffff9ff01800ULL,0x0004880000004000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -2138,6 +2438,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup555 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -2147,6 +2448,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup604 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -2156,6 +2458,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup683 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -2167,6 +2470,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup539 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -2176,6 +2480,7 @@ static struct _ofixGroupSpec	ExecutionReportGroup804 = {
 
 static struct _ofixGroupSpec	ExecutionReportGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -2212,6 +2517,8 @@ static struct _ofixMsgSpec	ExecutionReport = {
     "8", // type
     "ExecutionReport", // name
     {0,54,0,0,0,0,172,0,1,2,247,32,180,181,171,147,0,47,154,48,0,217,67,0,0,0,0,0,0,169,165,160,158,0,10,3,0,28,119,50,124,33,0,19,126,0,0,0,66,4,11,0,21,0,116,64,5,13,223,150,178,0,0,60,61,65,43,0,0,0,0,0,0,0,0,177,0,220,0,0,0,0,0,0,0,0,0,0,0,246,8,9,0,245,0,0,0,20,0,127,0,0,0,52,0,0,93,96,0,0,218,219,0,179,0,6,15,0,212,213,214,0,22,0,0,0,153,0,7,17,0,0,0,0,0,0,244,0,0,0,0,0,12,14,16,18,0,0,0,0,49,170,120,0,0,215,216,199,201,202,0,0,0,0,0,0,0,71,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,227,226,163,164,0,0,29,0,73,0,87,0,0,0,89,92,0,0,221,128,23,24,0,0,0,0,184,0,185,186,187,91,75,76,78,79,80,41,200,90,117,0,0,192,193,211,210,77,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,207,208,209,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,0,0,0,0,0,0,0,0,0,0,25,94,95,97,98,0,0,224,225,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,148,149,53,0,0,198,42,0,0,0,0,0,134,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,173,174,175,176,0,0,0,0,152,0,0,0,0,0,0,0,0,0,229,0,0,0,0,0,0,0,0,0,0,40,68,0,0,0,0,0,69,70,0,0,0,0,0,0,122,123,83,84,85,0,0,0,0,0,0,182,230,231,0,234,236,237,0,0,0,0,0,0,0,0,233,0,0,183,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,232,0,235,121,0,241,0,0,0,0,0,0,0,30,31,155,156,0,0,0,0,0,0,0,0,0,0,0,74,0,82,62,0,0,0,44,46,0,45,0,0,0,242,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,157,34,37,0,0,0,0,57,58,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,167,0,27,0,0,0,0,0,0,0,63,51,0,238,239,0,228,0,0,0,0,0,0,0,0,0,161,159,0,0,0,0,0,0,0,55,0,188,189,0,0,0,100,0,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,35,0,0,195,196,197,190,0,194,0,0,0,0,0,0,0,0,0,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,203,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,191,72,0,0,0,0,0,0,0,0,0,0,0,0,222,0,0,0,0,0,0,0,0,0,0,0,0,110,0,36,0,0,0,0,0,0,243,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,129,130,131,132,141,133,136,137,138,139,142,140,143,144,145,146,240,0,0,118,0,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,104,105,101,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,0,0,0,0,38,39,106,107,108,111,112,109,113,204,205,206,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d200ac00024740ULL,0x0000000000000000ULL,0x0000000000c00000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd71bede06eff42ULL,0x45dacc8a2e002807ULL,0x00000180f9c3cf03ULL,0xfffffffff43cc54fULL,0x73fe00000000001fULL,0x67823c0cf8030000ULL,0x84790f8000000030ULL,0x0002403b81f0fff1ULL,0x007018b3ec03fbdaULL,0xf87bfffffffff9e0ULL,0x2f2f880028d0d802ULL,0x1e00001c00000080ULL,0x0000043c20500080ULL,0x0bfcfe1f004ffff8ULL,0x1808e00007ff8004ULL,0x0000000000000000ULL}, // allowed
     ExecutionReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2469,6 +2776,7 @@ static struct _ofixMsgSpec	ExecutionReport = {
 
 static struct _ofixGroupSpec	OrderCancelRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2488,6 +2796,8 @@ static struct _ofixMsgSpec	OrderCancelReject = {
     "9", // type
     "OrderCancelReject", // name
     {0,38,0,0,0,0,0,0,1,2,51,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,28,0,34,0,33,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,46,0,43,0,0,0,0,0,37,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,50,8,9,0,49,0,0,0,20,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,47,48,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,32,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x011202ac00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17160aac00000f02ULL,0x041800422e000804ULL,0x000000000003c003ULL,0x0000002000300040ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x10780000000004a0ULL,0x0000000000100000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     OrderCancelRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2549,6 +2859,7 @@ static struct _ofixMsgSpec	OrderCancelReject = {
 
 static struct _ofixGroupSpec	LogonGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2559,6 +2870,7 @@ static struct _ofixGroupSpec	LogonGroup627 = {
 
 static struct _ofixGroupSpec	LogonGroup384 = {
     384, // NoMsgTypes
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 372, false }, // RefMsgType
 	{ 385, false }, // MsgDirection
@@ -2578,6 +2890,8 @@ static struct _ofixMsgSpec	Logon = {
     "A", // type
     "Logon", // name
     {0,0,0,0,0,0,0,0,1,2,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,8,9,0,39,0,30,31,20,28,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,32,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000100400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x04181007ae000000ULL,0x000000000003e003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x8012000008000000ULL,0x0000000000000003ULL,0x0000000000010000ULL,0x0000060000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     LogonGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2629,6 +2943,7 @@ static struct _ofixMsgSpec	Logon = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2639,6 +2954,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup627 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -2648,6 +2964,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup457 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -2657,8 +2974,9 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup887 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup146 = {
     146, // NoRelatedSym
+    {0x0481000000408000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x0000000cf0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000800a0000000ULL,0x0002000000000000ULL,0x0008000018000000ULL,0x0400000000000000ULL,0x0800000000000000ULL,0x00001e6100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -2717,6 +3035,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup146 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -2726,6 +3045,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup454 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -2737,6 +3057,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup864 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -2746,6 +3067,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup870 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -2795,6 +3117,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListGroup555 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -2821,6 +3144,8 @@ static struct _ofixMsgSpec	DerivativeSecurityList = {
     "AA", // type
     "DerivativeSecurityList", // name
     {0,0,0,0,0,0,0,0,1,2,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,8,9,0,80,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,43,44,45,46,47,53,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,60,63,59,33,38,31,32,40,0,0,54,56,68,0,28,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,62,64,65,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,36,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,51,52,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,67,69,0,0,71,72,73,74,75,76,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800007c003ULL,0xffff809f8030c500ULL,0x73fe000000000003ULL,0x00023c0cf8010005ULL,0x0018000000000200ULL,0x0000000001c0ffc0ULL,0x00011800e0000000ULL,0x007bffffffff0000ULL,0x0008000018000000ULL,0x1c00001800000000ULL,0x0800040000000000ULL,0x23fcffff00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     DerivativeSecurityListGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -2853,7 +3178,7 @@ static struct _ofixMsgSpec	DerivativeSecurityList = {
 	{ 320, true }, // SecurityReqID
 	{ 322, true }, // SecurityResponseID
 	{ 560, true }, // SecurityRequestResult
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -2913,6 +3238,7 @@ static struct _ofixMsgSpec	DerivativeSecurityList = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -2923,6 +3249,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -2934,6 +3261,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -2943,6 +3271,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup802 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -2956,6 +3285,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup948 = {
     948, // NoNested3PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x01e0000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 949, false }, // Nested3PartyID
 	{ 950, false }, // Nested3PartyIDSource
@@ -2967,6 +3297,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup948 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup952 = {
     952, // NoNested3PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0600000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 953, false }, // Nested3PartySubID
 	{ 954, false }, // Nested3PartySubIDType
@@ -2976,6 +3307,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup952 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -2985,6 +3317,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -2994,6 +3327,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -3005,8 +3339,9 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup864 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -3058,6 +3393,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup711 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -3067,6 +3403,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup457 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -3076,6 +3413,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup887 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070100008000000ULL,0x0001ffff9ff01800ULL,0x0004880040004000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -3136,6 +3474,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup555 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -3145,6 +3484,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup604 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -3154,6 +3494,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup683 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup670 = {
     670, // NoLegAllocs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000f80000000ULL,0x0010000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 671, false }, // LegAllocAccount
 	{ 672, false }, // LegIndividualAllocID
@@ -3167,6 +3508,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup670 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -3178,6 +3520,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup756 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -3187,6 +3530,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup806 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -3198,6 +3542,7 @@ static struct _ofixGroupSpec	NewOrderMultilegGroup539 = {
 
 static struct _ofixGroupSpec	NewOrderMultilegGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -3235,6 +3580,8 @@ static struct _ofixMsgSpec	NewOrderMultileg = {
     "AB", // type
     "NewOrderMultileg", // name
     {0,34,0,0,0,0,0,0,1,2,160,28,121,122,0,111,0,0,47,0,0,46,57,114,0,0,0,0,0,0,0,0,0,0,10,3,0,0,102,0,107,0,0,19,109,0,0,0,56,4,11,0,21,0,53,54,5,13,131,116,100,0,0,42,43,55,0,0,0,0,40,0,0,0,0,33,0,134,41,0,0,52,0,0,0,0,0,0,0,159,8,9,0,158,0,0,0,20,0,110,50,0,0,0,0,0,83,86,0,0,48,49,0,0,99,6,15,115,0,0,129,128,22,0,0,0,119,0,7,17,0,0,0,0,0,0,0,0,0,0,97,0,12,14,16,18,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,77,135,0,0,79,82,0,0,136,137,23,24,0,0,0,0,0,0,0,0,0,81,65,66,68,69,70,32,0,80,0,0,0,0,0,0,0,67,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,84,85,87,88,0,0,132,133,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,112,113,0,0,0,0,0,0,0,0,51,0,143,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,0,0,0,120,0,0,0,0,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,58,0,0,0,0,0,59,60,0,0,0,0,0,0,105,106,73,74,75,0,0,0,0,0,0,123,153,154,0,0,0,0,0,0,0,0,0,0,0,0,156,0,0,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,0,0,104,0,0,0,0,0,0,0,0,0,29,0,125,126,0,0,0,0,0,0,0,0,0,0,0,64,0,72,44,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,0,0,0,157,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,127,30,0,0,0,0,0,37,38,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,139,140,141,0,142,145,146,147,148,0,149,150,151,152,0,0,0,0,101,0,0,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,94,95,91,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2010c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000080000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7194c00e4bf02ULL,0x473ccc1a2e03e843ULL,0x000001800103d003ULL,0xffff80bf803ccd00ULL,0x73fe000000000003ULL,0x03023c0cf8010000ULL,0x8019088000000034ULL,0x0002400381f8fff1ULL,0x00781803ec037812ULL,0x087bfffffffff8e0ULL,0x000f880fc8304000ULL,0x1df0001900000080ULL,0x000004fc00000080ULL,0x03fcfe1f0043df78ULL,0x1ff8600000000000ULL,0x0000000000000000ULL}, // allowed
     NewOrderMultilegGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3405,6 +3752,7 @@ static struct _ofixMsgSpec	NewOrderMultileg = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3415,6 +3763,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup627 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -3426,6 +3775,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup453 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -3435,6 +3785,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup802 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -3448,6 +3799,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup78 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup948 = {
     948, // NoNested3PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x01e0000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 949, false }, // Nested3PartyID
 	{ 950, false }, // Nested3PartyIDSource
@@ -3459,6 +3811,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup948 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup952 = {
     952, // NoNested3PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0600000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 953, false }, // Nested3PartySubID
 	{ 954, false }, // Nested3PartySubIDType
@@ -3468,6 +3821,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup952 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -3477,6 +3831,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup386 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3486,6 +3841,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup454 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -3497,8 +3853,9 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup864 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -3550,6 +3907,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup711 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -3559,6 +3917,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup457 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -3568,6 +3927,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup887 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070100008000000ULL,0x0001ffff9ff01800ULL,0x0004880040004000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -3628,6 +3988,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup555 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -3637,6 +3998,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup604 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -3646,6 +4008,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup683 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup670 = {
     670, // NoLegAllocs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000f80000000ULL,0x0010000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 671, false }, // LegAllocAccount
 	{ 672, false }, // LegIndividualAllocID
@@ -3659,6 +4022,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup670 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -3670,6 +4034,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup756 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -3679,6 +4044,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup806 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -3690,6 +4056,7 @@ static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup539 = {
 
 static struct _ofixGroupSpec	MultilegOrderCancelReplaceRequestGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -3727,6 +4094,8 @@ static struct _ofixMsgSpec	MultilegOrderCancelReplaceRequest = {
     "AC", // type
     "MultilegOrderCancelReplaceRequest", // name
     {0,37,0,0,0,0,0,0,1,2,163,30,124,125,0,114,0,0,50,0,0,49,60,117,0,0,0,0,0,0,0,0,0,0,10,3,0,28,105,0,110,29,0,19,112,0,0,0,59,4,11,0,21,0,56,57,5,13,134,119,103,0,0,45,46,58,0,0,0,0,43,0,0,0,0,36,0,137,44,0,0,55,0,0,0,0,0,0,0,162,8,9,0,161,0,0,0,20,0,113,53,0,0,0,0,0,86,89,0,0,51,52,0,0,102,6,15,118,0,0,132,131,22,0,0,0,122,0,7,17,0,0,0,0,0,0,0,0,0,0,100,0,12,14,16,18,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,80,138,0,0,82,85,0,0,139,140,23,24,0,0,0,0,0,0,0,0,0,84,68,69,71,72,73,35,0,83,0,0,0,0,0,0,0,70,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,87,88,90,91,0,0,135,136,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,115,116,0,0,0,0,0,0,0,0,54,0,146,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,123,0,0,0,0,121,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,61,0,0,0,0,0,62,63,0,0,0,0,0,0,108,109,76,77,78,0,0,0,0,0,0,126,156,157,0,0,0,0,0,0,0,0,0,0,0,0,159,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,0,0,107,0,0,0,0,0,0,0,0,0,31,0,128,129,0,0,0,0,0,0,0,0,0,0,0,67,0,75,47,0,0,0,0,0,0,0,0,0,0,101,0,0,0,0,0,0,0,160,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,130,32,0,0,33,0,0,40,41,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,141,142,143,144,0,145,148,149,150,151,0,152,153,154,155,0,0,0,0,104,0,0,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,97,98,94,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2030c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000080000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd71b6c00e4bf02ULL,0x473ccc1a2e03e843ULL,0x000001800103d003ULL,0xffff80bf803ccd00ULL,0x73fe000000000003ULL,0x03023c0cf8010000ULL,0x8019088000000034ULL,0x0002400381f8fff1ULL,0x00781803ec037812ULL,0x087bfffffffffce0ULL,0x000f880fc8304000ULL,0x1df0001900000080ULL,0x000004fc00000080ULL,0x03fcfe1f0043df78ULL,0x1ff8600000000000ULL,0x0000000000000000ULL}, // allowed
     MultilegOrderCancelReplaceRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -3900,6 +4269,7 @@ static struct _ofixMsgSpec	MultilegOrderCancelReplaceRequest = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -3910,6 +4280,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup627 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -3921,6 +4292,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup453 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -3930,6 +4302,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup802 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -3939,6 +4312,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup454 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -3950,6 +4324,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup864 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -3959,8 +4334,9 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup870 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -4012,6 +4388,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup711 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -4021,6 +4398,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup457 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -4030,6 +4408,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup887 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -4079,6 +4458,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup555 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -4088,6 +4468,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestGroup604 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestGroup580 = {
     580, // NoDates
+    {0x1000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 75, false }, // TradeDate
 	{ 60, false }, // TransactTime
@@ -4117,6 +4498,8 @@ static struct _ofixMsgSpec	TradeCaptureReportRequest = {
     "AD", // type
     "TradeCaptureReportRequest", // name
     {0,0,0,0,0,0,0,0,1,2,117,36,0,0,0,0,0,33,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,10,3,0,35,0,0,0,0,0,19,0,0,0,0,47,4,11,0,21,0,106,45,5,13,112,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,8,9,0,115,0,0,0,20,0,0,0,0,0,0,0,0,74,77,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,68,0,0,0,70,73,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,72,56,57,59,60,61,0,0,71,0,0,0,0,0,0,0,58,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,0,0,25,75,76,78,79,0,0,113,114,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,0,44,49,0,0,0,0,0,50,51,0,0,0,0,0,0,0,0,64,65,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,63,0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,31,0,37,0,0,0,0,108,109,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,0,102,0,0,0,0,0,0,0,0,0,110,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,42,0,0,0,0,0,0,0,38,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,84,0,0,0,0,88,89,0,0,85,86,82,83,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,91,92,95,96,93,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d7082c00420f00ULL,0x04180c022e000802ULL,0x000000800043c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c0cf8010000ULL,0x8418000000000000ULL,0x0000000001c0fff1ULL,0x2b001800e0000800ULL,0x007bffffffff001cULL,0x0008000018000000ULL,0x1c00001800600880ULL,0x7014040c00100000ULL,0x03fdffff00800000ULL,0x1808e00000fe0004ULL,0x0000000000000000ULL}, // allowed
     TradeCaptureReportRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4163,7 +4546,7 @@ static struct _ofixMsgSpec	TradeCaptureReportRequest = {
 	{ 820, false }, // TradeLinkID
 	{ 880, false }, // TrdMatchID
 	{ 453, false }, // NoPartyIDs
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -4244,6 +4627,7 @@ static struct _ofixMsgSpec	TradeCaptureReportRequest = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -4254,6 +4638,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup627 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -4263,6 +4648,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup454 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -4274,8 +4660,9 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup864 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -4327,6 +4714,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup711 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -4336,6 +4724,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup457 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -4345,6 +4734,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup887 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup753 = {
     753, // NoPosAmt
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000018ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 707, true }, // PosAmtType
 	{ 708, true }, // PosAmt
@@ -4354,6 +4744,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup753 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070100008000000ULL,0x2001ffff9ff01800ULL,0x0004880000004000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -4414,6 +4805,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup555 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -4423,6 +4815,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup604 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -4432,6 +4825,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup683 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -4443,6 +4837,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup539 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -4452,6 +4847,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup804 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -4462,6 +4858,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup768 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup552 = {
     552, // NoSides
+    {0x044001200004b802ULL,0x01c0000000026044ULL,0x00000000f8000100ULL,0x0000614000000040ULL,0x0000000000000000ULL,0x2300000c00010000ULL,0x0000000000000000ULL,0x0002000880000020ULL,0x8000000000034040ULL,0x080200000000806dULL,0x0000000000100000ULL,0x0001000400000000ULL,0x0620000000000000ULL,0x0000000000000000ULL,0x0000800007000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 37, true }, // OrderID
@@ -4531,6 +4928,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup552 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -4542,6 +4940,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup453 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -4551,6 +4950,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup802 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup576 = {
     576, // NoClearingInstructions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 577, false }, // ClearingInstruction
 	{ 0, false }
@@ -4559,6 +4959,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup576 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup518 = {
     518, // NoContAmts
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000380ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 519, false }, // ContAmtType
 	{ 520, false }, // ContAmtValue
@@ -4569,6 +4970,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup518 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -4578,6 +4980,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup232 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -4589,6 +4992,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup136 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0010000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -4602,6 +5006,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup78 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -4613,6 +5018,7 @@ static struct _ofixGroupSpec	TradeCaptureReportGroup756 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -4653,6 +5059,8 @@ static struct _ofixMsgSpec	TradeCaptureReport = {
     "AE", // type
     "TradeCaptureReport", // name
     {0,0,0,0,0,0,126,0,1,2,152,0,0,0,0,0,0,46,0,0,0,0,55,0,0,0,0,0,0,0,123,119,118,0,10,3,0,0,103,47,0,0,0,19,0,0,0,0,54,4,11,0,21,0,0,52,5,13,0,0,140,0,0,142,143,53,0,0,0,0,0,0,0,0,0,124,0,0,0,0,0,0,0,0,0,0,0,0,0,151,8,9,0,150,0,0,0,20,0,0,0,0,0,0,0,0,81,84,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,36,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,122,0,0,0,0,61,0,75,0,0,0,77,80,0,0,0,0,23,24,0,0,0,0,127,0,128,129,130,79,63,64,66,67,68,0,0,78,0,0,0,109,110,0,0,65,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,82,83,85,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,57,58,0,0,0,0,0,0,106,107,71,72,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,70,0,0,0,0,0,0,0,0,146,0,0,139,0,0,0,0,0,0,0,0,0,0,0,0,31,0,50,28,41,144,145,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,132,0,0,0,88,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,112,113,114,133,0,111,0,0,0,0,0,0,0,0,0,115,0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,136,0,0,0,0,0,0,0,134,60,0,0,0,0,0,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,135,44,0,116,117,138,0,0,0,32,33,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,149,108,34,30,0,0,0,0,0,0,0,91,0,0,0,0,0,0,0,0,92,93,89,90,0,0,0,45,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,38,94,95,96,99,100,97,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192000d80000700ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0c00010000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97d709edc046bf42ULL,0x05d80c022e03e847ULL,0x00000080f943cf03ULL,0xffffffdff430c54cULL,0x73fe000000000083ULL,0x27023c0cf8010020ULL,0x8418008000000000ULL,0x0002008881f8fff1ULL,0xfd701902ec03fbd0ULL,0x287bffffffff986fULL,0x2f0f880028f04000ULL,0x1ff3101d00000898ULL,0x77fc04fc2010000fULL,0x0bfffe1f01f00000ULL,0x1808e00007ff0004ULL,0x0000000000000000ULL}, // allowed
     TradeCaptureReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4790,12 +5198,12 @@ static struct _ofixMsgSpec	TradeCaptureReport = {
 	{ 699, false }, // BenchmarkSecurityID
 	{ 761, false }, // BenchmarkSecurityIDSource
 	{ 819, false }, // AvgPxIndicator
-	{ 753, true }, // NoPosAmt
+	{ 753, false }, // NoPosAmt
 	{ 442, false }, // MultiLegReportingType
 	{ 824, false }, // TradeLegRefID
 	{ 555, false }, // NoLegs
 	{ 60, true }, // TransactTime
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 63, false }, // SettlType
 	{ 64, false }, // SettlDate
 	{ 573, false }, // MatchStatus
@@ -4815,6 +5223,7 @@ static struct _ofixMsgSpec	TradeCaptureReport = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -4825,6 +5234,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -4836,6 +5246,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -4845,6 +5256,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup802 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -4854,6 +5266,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup454 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -4865,6 +5278,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup864 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -4874,6 +5288,7 @@ static struct _ofixGroupSpec	OrderMassStatusRequestGroup457 = {
 
 static struct _ofixGroupSpec	OrderMassStatusRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -4898,6 +5313,8 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
     "AF", // type
     "OrderMassStatusRequest", // name
     {0,31,0,0,0,0,0,0,1,2,126,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,37,4,11,0,21,0,123,35,5,13,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,8,9,0,124,0,0,0,20,0,0,0,0,0,0,0,0,64,67,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,58,0,0,0,60,63,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,62,46,47,49,50,51,0,0,61,0,0,0,0,0,0,0,48,57,88,89,90,91,92,93,99,0,0,0,0,0,0,0,52,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,106,109,105,79,84,77,78,86,0,0,100,102,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,25,65,66,68,69,0,0,0,0,0,0,0,0,0,0,107,108,110,111,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,39,0,0,81,0,0,40,41,82,83,0,0,0,0,0,0,54,55,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,87,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,0,0,0,0,0,96,97,98,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,75,76,72,73,112,113,115,0,0,117,118,119,120,121,122,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,101,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000300ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x03d7080c00400702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x80ff809f8030c500ULL,0x73fe000000000001ULL,0x00023c00f8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00000000e0000800ULL,0x007a0000000f0300ULL,0x0008000008100000ULL,0x0c00000000000000ULL,0x0000040c00000000ULL,0x03fcfe1f00000000ULL,0x0008200000000000ULL,0x0000000000000000ULL}, // allowed
     OrderMassStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -4934,7 +5351,7 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
 	{ 660, false }, // AcctIDSource
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -4976,7 +5393,7 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
 	{ 864, false }, // NoEvents
 	{ 873, false }, // DatedDate
 	{ 874, false }, // InterestAccrualDate
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -5034,6 +5451,7 @@ static struct _ofixMsgSpec	OrderMassStatusRequest = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5044,6 +5462,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup627 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup146 = {
     146, // NoRelatedSym
+    {0x80c1004000408002ULL,0x00000c0000000003ULL,0x0000008001001000ULL,0x800181bf8000c503ULL,0x0000800000000000ULL,0x00000000f0010000ULL,0x0000000000000000ULL,0x0000000001f03040ULL,0x00000800a2000010ULL,0x0002000000000020ULL,0x0008000008100000ULL,0x0400000000000080ULL,0x0000000000100000ULL,0x00001e0100400000ULL,0x0008000000fe0004ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -5126,6 +5545,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup146 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -5135,6 +5555,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup454 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -5146,8 +5567,9 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup864 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -5199,6 +5621,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup711 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -5208,6 +5631,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup457 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -5217,6 +5641,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup887 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -5226,6 +5651,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup232 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100008000000ULL,0x0001ffff9ff01800ULL,0x000489f000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -5286,6 +5712,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup555 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -5295,6 +5722,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup604 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -5304,6 +5732,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup683 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -5315,6 +5744,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup539 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -5324,6 +5754,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup804 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup735 = {
     735, // NoQuoteQualifiers
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0080000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 695, false }, // QuoteQualifier
 	{ 0, false }
@@ -5332,6 +5763,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup735 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -5343,6 +5775,7 @@ static struct _ofixGroupSpec	QuoteRequestRejectGroup453 = {
 
 static struct _ofixGroupSpec	QuoteRequestRejectGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -5376,6 +5809,8 @@ static struct _ofixMsgSpec	QuoteRequestReject = {
     "AG", // type
     "QuoteRequestReject", // name
     {0,0,0,0,0,0,0,0,1,2,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,34,0,0,19,46,0,0,0,0,4,11,0,21,0,0,0,5,13,55,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,8,9,0,58,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,35,0,7,17,0,28,0,0,0,0,0,0,0,0,0,0,12,14,16,18,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,37,0,38,39,40,0,0,0,0,0,0,0,0,0,0,0,0,48,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,56,57,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,41,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,51,52,53,43,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040008ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97d7194c00408702ULL,0x44180c022e000003ULL,0x000000800107d00bULL,0xffff9fbff430c503ULL,0x73fe800000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001f0fff1ULL,0x00001802ee003810ULL,0x007bffffffff1820ULL,0x2f9f89f008d40011ULL,0x1e00001880000080ULL,0x0000043c00100000ULL,0x03fcfe1f00400000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     QuoteRequestRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5446,6 +5881,7 @@ static struct _ofixMsgSpec	QuoteRequestReject = {
 
 static struct _ofixGroupSpec	RFQRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5456,6 +5892,7 @@ static struct _ofixGroupSpec	RFQRequestGroup627 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000001000ULL,0x8001809f8000c500ULL,0x0000800000000000ULL,0x00000000f0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000800a2000000ULL,0x0002000000000000ULL,0x0008000008000000ULL,0x0400000000000080ULL,0x0000000000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -5512,6 +5949,7 @@ static struct _ofixGroupSpec	RFQRequestGroup146 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -5521,6 +5959,7 @@ static struct _ofixGroupSpec	RFQRequestGroup454 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -5532,8 +5971,9 @@ static struct _ofixGroupSpec	RFQRequestGroup864 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -5585,6 +6025,7 @@ static struct _ofixGroupSpec	RFQRequestGroup711 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -5594,6 +6035,7 @@ static struct _ofixGroupSpec	RFQRequestGroup457 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -5603,6 +6045,7 @@ static struct _ofixGroupSpec	RFQRequestGroup887 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -5652,6 +6095,7 @@ static struct _ofixGroupSpec	RFQRequestGroup555 = {
 
 static struct _ofixGroupSpec	RFQRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -5678,6 +6122,8 @@ static struct _ofixMsgSpec	RFQRequest = {
     "AH", // type
     "RFQRequest", // name
     {0,0,0,0,0,0,0,0,1,2,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,9,0,31,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000010ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400700ULL,0x04180c022e000002ULL,0x000000800007d003ULL,0xffff809f8030c500ULL,0x73fe800000000083ULL,0x00023c00f8010000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00001800e2000000ULL,0x007bffffffff0000ULL,0x0008000008000010ULL,0x1c00001800000080ULL,0x0000040000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     RFQRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -5721,6 +6167,7 @@ static struct _ofixMsgSpec	RFQRequest = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -5731,6 +6178,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup627 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -5742,6 +6190,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup453 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -5751,6 +6200,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup802 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -5760,6 +6210,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup454 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -5771,8 +6222,9 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup864 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -5824,6 +6276,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup711 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -5833,6 +6286,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup457 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -5842,6 +6296,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup887 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -5851,6 +6306,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup232 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100008000000ULL,0x0001ffff9ff01800ULL,0x0004880000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -5906,6 +6362,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup555 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -5915,6 +6372,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup604 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -5924,6 +6382,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup683 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -5935,6 +6394,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup539 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -5944,6 +6404,7 @@ static struct _ofixGroupSpec	QuoteStatusReportGroup804 = {
 
 static struct _ofixGroupSpec	QuoteStatusReportGroup735 = {
     735, // NoQuoteQualifiers
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0080000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 695, false }, // QuoteQualifier
 	{ 0, false }
@@ -5975,6 +6436,8 @@ static struct _ofixMsgSpec	QuoteStatusReport = {
     "AI", // type
     "QuoteStatusReport", // name
     {0,100,0,0,0,0,0,0,1,2,156,0,147,146,0,98,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,89,0,140,0,0,19,106,0,0,0,38,4,11,0,21,0,88,36,5,13,151,0,139,0,130,94,95,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,8,9,0,154,0,0,0,20,0,0,149,0,0,0,0,0,65,68,0,0,0,0,0,0,0,6,15,30,0,0,0,0,22,0,0,0,105,0,7,17,0,29,122,123,127,129,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,90,0,0,0,145,0,0,0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,133,132,134,97,96,0,0,0,0,0,0,45,0,59,0,0,0,61,64,0,0,0,0,23,24,0,0,0,0,108,0,109,110,111,63,47,48,50,51,52,0,0,62,99,0,0,116,117,0,0,49,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,25,66,67,69,70,0,0,152,153,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,40,0,0,0,0,0,41,42,0,0,0,0,0,0,92,93,55,56,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,46,0,54,0,0,0,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,27,0,0,0,135,136,137,138,0,0,0,0,0,0,0,141,142,0,124,125,126,128,28,0,0,0,0,0,0,143,144,0,0,101,0,112,113,0,0,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,31,0,0,119,120,121,114,0,118,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,115,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,76,77,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,79,80,83,84,81,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0xd7d7194c0040b702ULL,0x44380c122e000003ULL,0xf00000801103c0fbULL,0xffff9f9ff430c503ULL,0x73fe020000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001f0fff1ULL,0x00001802ee003810ULL,0x07fbffffffff1860ULL,0x2faf880008d303ecULL,0x1e00001880000080ULL,0x0000043c00100000ULL,0x03fcfe1f00000000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     QuoteStatusReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6141,6 +6604,7 @@ static struct _ofixMsgSpec	QuoteStatusReport = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6151,6 +6615,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup627 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup735 = {
     735, // NoQuoteQualifiers
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0080000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 695, false }, // QuoteQualifier
 	{ 0, false }
@@ -6159,6 +6624,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup735 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -6170,6 +6636,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup453 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -6179,6 +6646,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup802 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6188,6 +6656,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup454 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -6199,8 +6668,9 @@ static struct _ofixGroupSpec	QuoteResponseGroup864 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -6252,6 +6722,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup711 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -6261,6 +6732,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup457 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -6270,6 +6742,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup887 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -6279,6 +6752,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup232 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100008000000ULL,0x0001ffff9ff01800ULL,0x0004dbf000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -6342,6 +6816,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup555 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -6351,6 +6826,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup604 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -6360,6 +6836,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup683 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -6371,6 +6848,7 @@ static struct _ofixGroupSpec	QuoteResponseGroup539 = {
 
 static struct _ofixGroupSpec	QuoteResponseGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -6403,6 +6881,8 @@ static struct _ofixMsgSpec	QuoteResponse = {
     "AJ", // type
     "QuoteResponse", // name
     {0,103,0,0,0,0,0,0,1,2,156,31,131,132,0,101,0,0,0,0,0,0,42,33,0,0,0,0,0,0,0,0,0,0,10,3,0,0,92,0,125,0,0,19,138,0,0,0,41,4,11,0,21,0,91,39,5,13,135,0,124,0,115,97,98,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,8,9,0,154,0,0,0,20,0,0,134,0,0,0,0,0,68,71,0,0,0,0,0,0,0,6,15,29,0,0,0,0,22,0,0,0,0,0,7,17,0,0,107,108,112,114,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,93,0,0,0,130,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,118,117,119,100,99,0,0,0,0,0,0,48,0,62,0,0,0,64,67,0,0,0,0,23,24,0,0,0,0,140,0,141,142,143,66,50,51,53,54,55,0,0,65,102,0,0,148,149,0,0,52,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,25,69,70,72,73,0,0,136,137,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,43,0,0,0,0,0,44,45,0,0,0,0,0,0,95,96,58,59,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,34,0,0,0,49,0,57,0,0,0,0,0,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,133,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,27,0,0,0,120,121,122,123,0,0,0,0,0,0,0,126,127,0,109,110,111,113,0,0,0,0,0,0,0,128,129,0,0,104,0,144,145,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,28,30,0,151,152,153,146,0,150,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,79,80,76,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,82,83,86,87,84,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0060000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0xd7d7194c00c0bf02ULL,0x04380c122e000003ULL,0xf00000801103c0f3ULL,0xffff9f9ff430c503ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001f0fff1ULL,0x00001802ee013810ULL,0x07fbffffffff1860ULL,0x2fefdbf008d301ecULL,0x1e00001880000080ULL,0x0000043c00100000ULL,0x03fcfe1f00000000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     QuoteResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6569,6 +7049,7 @@ static struct _ofixMsgSpec	QuoteResponse = {
 
 static struct _ofixGroupSpec	ConfirmationGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -6579,6 +7060,7 @@ static struct _ofixGroupSpec	ConfirmationGroup627 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -6590,6 +7072,7 @@ static struct _ofixGroupSpec	ConfirmationGroup453 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -6599,6 +7082,7 @@ static struct _ofixGroupSpec	ConfirmationGroup802 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup73 = {
     73, // NoOrders
+    {0x0000006000000800ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000180000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, false }, // ClOrdID
 	{ 37, false }, // OrderID
@@ -6615,6 +7099,7 @@ static struct _ofixGroupSpec	ConfirmationGroup73 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -6626,6 +7111,7 @@ static struct _ofixGroupSpec	ConfirmationGroup756 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -6635,6 +7121,7 @@ static struct _ofixGroupSpec	ConfirmationGroup806 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -6645,6 +7132,7 @@ static struct _ofixGroupSpec	ConfirmationGroup768 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -6654,6 +7142,7 @@ static struct _ofixGroupSpec	ConfirmationGroup454 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -6665,6 +7154,7 @@ static struct _ofixGroupSpec	ConfirmationGroup864 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -6674,8 +7164,9 @@ static struct _ofixGroupSpec	ConfirmationGroup870 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -6727,6 +7218,7 @@ static struct _ofixGroupSpec	ConfirmationGroup711 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -6736,6 +7228,7 @@ static struct _ofixGroupSpec	ConfirmationGroup457 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -6745,6 +7238,7 @@ static struct _ofixGroupSpec	ConfirmationGroup887 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -6794,6 +7288,7 @@ static struct _ofixGroupSpec	ConfirmationGroup555 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -6803,6 +7298,7 @@ static struct _ofixGroupSpec	ConfirmationGroup604 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup862 = {
     862, // NoCapacities
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000030000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000080000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 528, true }, // OrderCapacity
 	{ 529, false }, // OrderRestrictions
@@ -6813,6 +7309,7 @@ static struct _ofixGroupSpec	ConfirmationGroup862 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup85 = {
     85, // NoDlvyInst
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000082000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 165, false }, // SettlInstSource
 	{ 787, false }, // DlvyInstType
@@ -6823,6 +7320,7 @@ static struct _ofixGroupSpec	ConfirmationGroup85 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup781 = {
     781, // NoSettlPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000020001c000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 782, false }, // SettlPartyID
 	{ 783, false }, // SettlPartyIDSource
@@ -6834,6 +7332,7 @@ static struct _ofixGroupSpec	ConfirmationGroup781 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup801 = {
     801, // NoSettlPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000060000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 785, false }, // SettlPartySubID
 	{ 786, false }, // SettlPartySubIDType
@@ -6843,6 +7342,7 @@ static struct _ofixGroupSpec	ConfirmationGroup801 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -6852,6 +7352,7 @@ static struct _ofixGroupSpec	ConfirmationGroup232 = {
 
 static struct _ofixGroupSpec	ConfirmationGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -6892,6 +7393,8 @@ static struct _ofixMsgSpec	Confirmation = {
     "AK", // type
     "Confirmation", // name
     {0,0,0,0,0,0,115,0,1,2,165,0,156,157,0,109,0,0,0,0,0,0,47,0,0,0,0,0,0,0,110,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,46,4,11,0,21,0,108,44,5,13,128,0,41,0,0,149,150,45,0,0,0,0,38,0,0,37,116,42,0,0,0,112,106,131,0,0,0,155,0,0,0,164,8,9,0,163,0,0,0,20,0,0,0,0,0,0,0,0,73,76,0,0,0,0,0,0,0,6,15,0,143,145,146,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,162,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,147,148,133,135,136,0,0,0,0,0,0,0,51,0,152,153,154,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,67,0,0,0,69,72,0,0,0,0,23,24,0,0,0,0,119,0,120,121,122,71,55,56,58,59,60,0,134,70,161,0,0,100,101,142,141,57,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,74,75,77,78,0,0,129,130,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,48,0,0,0,0,0,49,50,0,0,0,0,0,40,0,0,63,64,65,0,0,0,0,0,0,158,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,62,0,0,0,0,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,113,123,124,28,35,31,80,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,0,0,0,103,104,105,125,0,102,0,0,0,0,0,0,0,0,0,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,126,52,0,0,0,0,0,43,0,0,0,29,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,93,0,0,0,0,39,0,0,0,33,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,0,0,0,160,30,118,127,111,0,83,0,0,0,0,87,88,0,0,84,85,81,82,0,0,0,0,0,0,0,0,0,0,0,0,0,144,0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,90,91,94,95,92,96,138,139,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2000c00000740ULL,0x0040000000018800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x2000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000080000000000ULL,0x0000000000000000ULL,0x0000000007000000ULL,0x0000000000000080ULL,0x0000000000000020ULL,0x0000000040000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97d7086c4040bf40ULL,0x05d80c022e238e47ULL,0x00001ea0f803cf03ULL,0xffffffdff430c540ULL,0x73fe000000000003ULL,0x20023c0cf8000000ULL,0x8018008000000000ULL,0x0002000081c8fff1ULL,0x00001800e0034800ULL,0x0079ffffffff0000ULL,0x2f0800001fe00400ULL,0x1ff0001c00000080ULL,0x000004cfe21fe03fULL,0x0ffcfffffc400000ULL,0x1808600007fe0004ULL,0x0000000000000000ULL}, // allowed
     ConfirmationGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -6936,7 +7439,7 @@ static struct _ofixMsgSpec	Confirmation = {
 	{ 467, false }, // IndividualAllocID
 	{ 60, true }, // TransactTime
 	{ 75, true }, // TradeDate
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
@@ -7067,6 +7570,7 @@ static struct _ofixMsgSpec	Confirmation = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7077,6 +7581,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup627 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -7088,6 +7593,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup453 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -7097,6 +7603,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup802 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7106,6 +7613,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup454 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -7117,6 +7625,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup864 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -7166,6 +7675,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup555 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -7175,8 +7685,9 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup604 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -7228,6 +7739,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup711 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -7237,6 +7749,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup457 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -7246,6 +7759,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup887 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -7255,6 +7769,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup386 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup702 = {
     702, // NoPositions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000007ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 703, false }, // PosType
 	{ 704, false }, // LongQty
@@ -7267,6 +7782,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup702 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -7278,6 +7794,7 @@ static struct _ofixGroupSpec	PositionMaintenanceRequestGroup539 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceRequestGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -7309,6 +7826,8 @@ static struct _ofixMsgSpec	PositionMaintenanceRequest = {
     "AL", // type
     "PositionMaintenanceRequest", // name
     {0,37,0,0,0,0,0,0,1,2,97,0,0,0,0,82,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,42,4,11,0,21,0,0,40,5,13,92,0,86,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,96,8,9,0,95,0,0,0,20,0,0,0,0,0,0,0,0,69,72,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,63,0,0,0,65,68,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,67,51,52,54,55,56,0,0,66,0,0,0,0,0,0,0,53,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,70,71,73,74,0,0,93,94,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,44,0,0,0,0,0,45,46,0,0,0,0,0,0,0,0,59,60,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,58,0,0,0,0,0,0,0,0,0,0,0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,29,28,84,30,31,32,33,34,35,88,89,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,0,80,81,77,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192000c00000702ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000020ULL,0x4000000000000000ULL,0x0000000000000960ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1797080c00408702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x8018000000000004ULL,0x0000000001c0fff1ULL,0x00001802ec003800ULL,0x007bffffffff0020ULL,0xc008000008100000ULL,0x1c0000180001ffe7ULL,0x0000043c00000000ULL,0x03fcfe1f00000004ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     PositionMaintenanceRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7416,6 +7935,7 @@ static struct _ofixMsgSpec	PositionMaintenanceRequest = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7426,6 +7946,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup627 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -7437,6 +7958,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup453 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -7446,6 +7968,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup802 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7455,6 +7978,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup454 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -7466,6 +7990,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup864 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -7515,6 +8040,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup555 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -7524,8 +8050,9 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup604 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -7577,6 +8104,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup711 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -7586,6 +8114,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup457 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -7595,6 +8124,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup887 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -7604,6 +8134,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup386 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup702 = {
     702, // NoPositions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000007ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 703, false }, // PosType
 	{ 704, false }, // LongQty
@@ -7616,6 +8147,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup702 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -7627,6 +8159,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup539 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -7636,6 +8169,7 @@ static struct _ofixGroupSpec	PositionMaintenanceReportGroup804 = {
 
 static struct _ofixGroupSpec	PositionMaintenanceReportGroup753 = {
     753, // NoPosAmt
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000018ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 707, true }, // PosAmtType
 	{ 708, true }, // PosAmt
@@ -7668,6 +8202,8 @@ static struct _ofixMsgSpec	PositionMaintenanceReport = {
     "AM", // type
     "PositionMaintenanceReport", // name
     {0,39,0,0,0,0,0,0,1,2,98,0,0,0,0,84,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,44,4,11,0,21,0,0,42,5,13,93,0,88,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,8,9,0,96,0,0,0,20,0,0,0,0,0,0,0,0,71,74,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,65,0,0,0,67,70,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,69,53,54,56,57,58,0,0,68,0,0,0,0,0,0,0,55,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,72,73,75,76,0,0,94,95,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,46,0,0,0,0,0,47,48,0,0,0,0,0,0,0,0,61,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,60,0,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,89,0,0,0,0,0,0,29,30,86,31,32,0,35,36,37,91,0,0,28,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,82,83,79,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192000c00000702ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000020ULL,0x4000000000000000ULL,0x0002000000060b20ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1797080c00408702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x8018000000000004ULL,0x0000000001c0fff1ULL,0x00001802ec003800ULL,0x007bffffffff0020ULL,0xc008000008100000ULL,0x1c020018000e7bffULL,0x0000043c00000000ULL,0x03fcfe1f00000004ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     PositionMaintenanceReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -7776,6 +8312,7 @@ static struct _ofixMsgSpec	PositionMaintenanceReport = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -7786,6 +8323,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup627 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -7797,6 +8335,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup453 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -7806,6 +8345,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup802 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -7815,6 +8355,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup454 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -7826,6 +8367,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup864 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -7875,6 +8417,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup555 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -7884,8 +8427,9 @@ static struct _ofixGroupSpec	RequestForPositionsGroup604 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -7937,6 +8481,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup711 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -7946,6 +8491,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup457 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -7955,6 +8501,7 @@ static struct _ofixGroupSpec	RequestForPositionsGroup887 = {
 
 static struct _ofixGroupSpec	RequestForPositionsGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -7983,6 +8530,8 @@ static struct _ofixMsgSpec	RequestForPositions = {
     "AN", // type
     "RequestForPositions", // name
     {0,33,0,0,0,0,0,0,1,2,93,0,0,0,0,78,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,38,4,11,0,21,0,0,36,5,13,88,0,85,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,8,9,0,91,0,0,0,20,0,0,0,0,0,0,0,0,65,68,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,59,0,0,0,61,64,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,63,47,48,50,51,52,0,0,62,0,0,0,0,0,0,0,49,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,66,67,69,70,0,0,89,90,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,40,0,0,0,0,0,41,42,0,0,0,0,0,0,0,0,55,56,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,54,0,0,0,0,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,80,0,0,0,81,82,83,0,0,0,0,0,0,29,86,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,76,77,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000702ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000020ULL,0x0000000000000000ULL,0x0000000000100840ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1797080c00408702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c0cf8010000ULL,0x8018000000000004ULL,0x0000000001c0fff1ULL,0x20001800e0000800ULL,0x007bffffffff0020ULL,0x0008000008100000ULL,0x1c000018007038c0ULL,0x0000040c00000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     RequestForPositionsGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8020,7 +8569,7 @@ static struct _ofixMsgSpec	RequestForPositions = {
 	{ 1, true }, // Account
 	{ 660, false }, // AcctIDSource
 	{ 581, true }, // AccountType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -8086,6 +8635,7 @@ static struct _ofixMsgSpec	RequestForPositions = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8096,6 +8646,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup627 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -8107,6 +8658,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup453 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -8116,6 +8668,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup802 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -8125,6 +8678,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup454 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -8136,6 +8690,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup864 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -8185,6 +8740,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup555 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -8194,8 +8750,9 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup604 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -8247,6 +8804,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup711 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -8256,6 +8814,7 @@ static struct _ofixGroupSpec	RequestForPositionsAckGroup457 = {
 
 static struct _ofixGroupSpec	RequestForPositionsAckGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -8283,6 +8842,8 @@ static struct _ofixMsgSpec	RequestForPositionsAck = {
     "AO", // type
     "RequestForPositionsAck", // name
     {0,35,0,0,0,0,0,0,1,2,90,0,0,0,0,80,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,40,4,11,0,21,0,0,38,5,13,85,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,8,9,0,88,0,0,0,20,0,0,0,0,0,0,0,0,67,70,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,61,0,0,0,63,66,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,65,49,50,52,53,54,0,0,64,0,0,0,0,0,0,0,51,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,68,69,71,72,0,0,86,87,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,42,0,0,0,0,0,43,44,0,0,0,0,0,0,0,0,57,58,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,56,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,82,0,0,0,0,0,0,0,0,0,28,0,0,0,83,84,30,32,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,78,79,75,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000702ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000020ULL,0x0000000000000000ULL,0x0000000003020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000003ULL,0x00023c0cf8000020ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00001800e0000800ULL,0x0079ffffffff0020ULL,0x0008000008100000ULL,0x1c00001803e200c0ULL,0x0000040c00000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     RequestForPositionsAckGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8322,7 +8883,7 @@ static struct _ofixMsgSpec	RequestForPositionsAck = {
 	{ 1, true }, // Account
 	{ 660, false }, // AcctIDSource
 	{ 581, true }, // AccountType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -8383,6 +8944,7 @@ static struct _ofixMsgSpec	RequestForPositionsAck = {
 
 static struct _ofixGroupSpec	PositionReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8393,6 +8955,7 @@ static struct _ofixGroupSpec	PositionReportGroup627 = {
 
 static struct _ofixGroupSpec	PositionReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -8404,6 +8967,7 @@ static struct _ofixGroupSpec	PositionReportGroup453 = {
 
 static struct _ofixGroupSpec	PositionReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -8413,6 +8977,7 @@ static struct _ofixGroupSpec	PositionReportGroup802 = {
 
 static struct _ofixGroupSpec	PositionReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -8422,6 +8987,7 @@ static struct _ofixGroupSpec	PositionReportGroup454 = {
 
 static struct _ofixGroupSpec	PositionReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -8433,6 +8999,7 @@ static struct _ofixGroupSpec	PositionReportGroup864 = {
 
 static struct _ofixGroupSpec	PositionReportGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -8482,6 +9049,7 @@ static struct _ofixGroupSpec	PositionReportGroup555 = {
 
 static struct _ofixGroupSpec	PositionReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -8491,8 +9059,9 @@ static struct _ofixGroupSpec	PositionReportGroup604 = {
 
 static struct _ofixGroupSpec	PositionReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000030000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -8546,6 +9115,7 @@ static struct _ofixGroupSpec	PositionReportGroup711 = {
 
 static struct _ofixGroupSpec	PositionReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -8555,6 +9125,7 @@ static struct _ofixGroupSpec	PositionReportGroup457 = {
 
 static struct _ofixGroupSpec	PositionReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -8564,6 +9135,7 @@ static struct _ofixGroupSpec	PositionReportGroup887 = {
 
 static struct _ofixGroupSpec	PositionReportGroup702 = {
     702, // NoPositions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000007ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 703, false }, // PosType
 	{ 704, false }, // LongQty
@@ -8576,6 +9148,7 @@ static struct _ofixGroupSpec	PositionReportGroup702 = {
 
 static struct _ofixGroupSpec	PositionReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -8587,6 +9160,7 @@ static struct _ofixGroupSpec	PositionReportGroup539 = {
 
 static struct _ofixGroupSpec	PositionReportGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -8596,6 +9170,7 @@ static struct _ofixGroupSpec	PositionReportGroup804 = {
 
 static struct _ofixGroupSpec	PositionReportGroup753 = {
     753, // NoPosAmt
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000018ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 707, true }, // PosAmtType
 	{ 708, true }, // PosAmt
@@ -8627,6 +9202,8 @@ static struct _ofixMsgSpec	PositionReport = {
     "AP", // type
     "PositionReport", // name
     {0,39,0,0,0,0,0,0,1,2,99,0,0,0,0,84,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,44,4,11,0,21,0,0,42,5,13,94,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,8,9,0,97,0,0,0,20,0,0,0,0,0,0,0,0,71,74,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,65,0,0,0,67,70,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,69,53,54,56,57,58,0,0,68,0,0,0,0,0,0,0,55,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,59,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,72,73,75,76,0,0,95,96,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,46,0,0,0,0,0,47,48,0,0,0,0,0,0,0,0,61,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,60,0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,29,89,0,0,0,35,36,37,0,0,0,28,0,0,30,0,0,32,34,0,85,86,0,0,87,0,0,0,0,0,0,0,0,93,0,0,0,0,0,0,0,0,0,91,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,82,83,79,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000702ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000020ULL,0x4000000000000000ULL,0x000200004d020800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c0cf8000020ULL,0x8018000000000000ULL,0x0400000001c0fff1ULL,0x00001802ec003800ULL,0x0079ffffffff0020ULL,0xc008000008100000ULL,0x1c0200987d9238dfULL,0x0000043c00000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     PositionReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8670,7 +9247,7 @@ static struct _ofixMsgSpec	PositionReport = {
 	{ 1, true }, // Account
 	{ 660, false }, // AcctIDSource
 	{ 581, true }, // AccountType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -8736,6 +9313,7 @@ static struct _ofixMsgSpec	PositionReport = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -8746,6 +9324,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup627 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -8755,6 +9334,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup454 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -8766,8 +9346,9 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup864 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -8819,6 +9400,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup711 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -8828,6 +9410,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup457 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -8837,6 +9420,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup887 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -8886,6 +9470,7 @@ static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup555 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportRequestAckGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -8911,6 +9496,8 @@ static struct _ofixMsgSpec	TradeCaptureReportRequestAck = {
     "AQ", // type
     "TradeCaptureReportRequestAck", // name
     {0,0,0,0,0,0,0,0,1,2,86,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,36,4,11,0,21,0,0,34,5,13,81,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,8,9,0,84,0,0,0,20,0,0,0,0,0,0,0,0,63,66,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,59,62,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,61,45,46,48,49,50,0,0,60,0,0,0,0,0,0,0,47,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,64,65,67,68,0,0,82,83,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,39,40,0,0,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,52,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,79,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,32,33,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,74,75,71,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000600000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00400700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c0cf8000000ULL,0x0418000000000000ULL,0x0000000001c0ffc0ULL,0x03001800e0000000ULL,0x0079ffffffff0000ULL,0x0008000008000000ULL,0x1c00701800600080ULL,0x0000040000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     TradeCaptureReportRequestAckGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -8946,7 +9533,7 @@ static struct _ofixMsgSpec	TradeCaptureReportRequestAck = {
 	{ 748, false }, // TotNumTradeReports
 	{ 749, true }, // TradeRequestResult
 	{ 750, true }, // TradeRequestStatus
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -9007,6 +9594,7 @@ static struct _ofixMsgSpec	TradeCaptureReportRequestAck = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9017,6 +9605,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup627 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -9026,6 +9615,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup454 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -9037,6 +9627,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup864 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -9047,6 +9638,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup768 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070100008000000ULL,0x2001ffff9ff01800ULL,0x0004880000004000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -9107,6 +9699,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup555 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -9116,6 +9709,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup604 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -9125,6 +9719,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup683 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -9136,6 +9731,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup539 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -9145,6 +9741,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup804 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0010000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -9158,6 +9755,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup78 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -9169,6 +9767,7 @@ static struct _ofixGroupSpec	TradeCaptureReportAckGroup756 = {
 
 static struct _ofixGroupSpec	TradeCaptureReportAckGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -9198,6 +9797,8 @@ static struct _ofixMsgSpec	TradeCaptureReportAck = {
     "AR", // type
     "TradeCaptureReportAck", // name
     {0,100,0,0,0,0,0,0,1,2,108,0,0,0,0,0,0,44,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,48,4,11,0,21,0,0,46,5,13,92,0,88,0,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,103,105,0,0,0,0,0,0,0,0,0,0,107,8,9,0,106,0,0,0,20,0,0,0,0,0,0,0,0,75,78,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,69,0,0,0,71,74,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,73,57,58,60,61,62,0,0,72,0,0,0,0,0,0,0,59,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,76,77,79,80,0,0,93,94,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,51,52,0,0,0,0,0,0,0,0,65,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,97,98,0,0,0,0,0,0,0,0,0,0,0,56,0,64,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,36,0,0,0,0,0,0,0,0,102,99,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,96,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,101,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,42,0,0,0,0,0,0,0,31,32,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,30,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,86,87,83,84,0,0,0,43,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000400000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1797080c00420702ULL,0x04180c022e01e002ULL,0x000000800043c003ULL,0xff01809f8030c500ULL,0x0000000000000082ULL,0x0002000cf8000000ULL,0x0000000000000000ULL,0x0000008001c831c0ULL,0x18701802ac03b000ULL,0x2879fffffff09860ULL,0x000f880008304000ULL,0x15f0801900600000ULL,0x701400f00000000fULL,0x00031e1f01800000ULL,0x1808480000000000ULL,0x0000000000000000ULL}, // allowed
     TradeCaptureReportAckGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9288,7 +9889,7 @@ static struct _ofixMsgSpec	TradeCaptureReportAck = {
 	{ 873, false }, // DatedDate
 	{ 874, false }, // InterestAccrualDate
 	{ 60, false }, // TransactTime
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 725, false }, // ResponseTransportType
 	{ 726, false }, // ResponseDestination
 	{ 58, false }, // Text
@@ -9316,6 +9917,7 @@ static struct _ofixMsgSpec	TradeCaptureReportAck = {
 
 static struct _ofixGroupSpec	AllocationReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9326,6 +9928,7 @@ static struct _ofixGroupSpec	AllocationReportGroup627 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup73 = {
     73, // NoOrders
+    {0x0000006000000800ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000180000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, false }, // ClOrdID
 	{ 37, false }, // OrderID
@@ -9342,6 +9945,7 @@ static struct _ofixGroupSpec	AllocationReportGroup73 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -9353,6 +9957,7 @@ static struct _ofixGroupSpec	AllocationReportGroup756 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -9362,6 +9967,7 @@ static struct _ofixGroupSpec	AllocationReportGroup806 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup124 = {
     124, // NoExecs
+    {0x00000001a0020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000008000ULL,0x0000000000000000ULL,0x0000000020000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 32, false }, // LastQty
 	{ 17, false }, // ExecID
@@ -9375,6 +9981,7 @@ static struct _ofixGroupSpec	AllocationReportGroup124 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -9384,6 +9991,7 @@ static struct _ofixGroupSpec	AllocationReportGroup454 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -9395,6 +10003,7 @@ static struct _ofixGroupSpec	AllocationReportGroup864 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -9404,8 +10013,9 @@ static struct _ofixGroupSpec	AllocationReportGroup870 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -9457,6 +10067,7 @@ static struct _ofixGroupSpec	AllocationReportGroup711 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -9466,6 +10077,7 @@ static struct _ofixGroupSpec	AllocationReportGroup457 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -9475,6 +10087,7 @@ static struct _ofixGroupSpec	AllocationReportGroup887 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -9524,6 +10137,7 @@ static struct _ofixGroupSpec	AllocationReportGroup555 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -9533,6 +10147,7 @@ static struct _ofixGroupSpec	AllocationReportGroup604 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -9544,6 +10159,7 @@ static struct _ofixGroupSpec	AllocationReportGroup453 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -9553,6 +10169,7 @@ static struct _ofixGroupSpec	AllocationReportGroup802 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -9562,6 +10179,7 @@ static struct _ofixGroupSpec	AllocationReportGroup232 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup78 = {
     78, // NoAllocs
+    {0x0000000000003000ULL,0x0180000000238000ULL,0x00001e021e000100ULL,0x0000000000030000ULL,0x0000000000000000ULL,0x0000430000000000ULL,0x0000000000000000ULL,0x0002000080080000ULL,0x2000000008000000ULL,0x0800000000000001ULL,0x0000000000200000ULL,0x0000006300000000ULL,0x0000000000001000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, true }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -9605,6 +10223,7 @@ static struct _ofixGroupSpec	AllocationReportGroup78 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -9616,6 +10235,7 @@ static struct _ofixGroupSpec	AllocationReportGroup539 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -9625,6 +10245,7 @@ static struct _ofixGroupSpec	AllocationReportGroup804 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -9636,6 +10257,7 @@ static struct _ofixGroupSpec	AllocationReportGroup136 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup576 = {
     576, // NoClearingInstructions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 577, false }, // ClearingInstruction
 	{ 0, false }
@@ -9644,6 +10266,7 @@ static struct _ofixGroupSpec	AllocationReportGroup576 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup85 = {
     85, // NoDlvyInst
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000082000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 165, false }, // SettlInstSource
 	{ 787, false }, // DlvyInstType
@@ -9654,6 +10277,7 @@ static struct _ofixGroupSpec	AllocationReportGroup85 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup781 = {
     781, // NoSettlPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000020001c000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 782, false }, // SettlPartyID
 	{ 783, false }, // SettlPartyIDSource
@@ -9665,6 +10289,7 @@ static struct _ofixGroupSpec	AllocationReportGroup781 = {
 
 static struct _ofixGroupSpec	AllocationReportGroup801 = {
     801, // NoSettlPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000060000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 785, false }, // SettlPartySubID
 	{ 786, false }, // SettlPartySubIDType
@@ -9706,6 +10331,8 @@ static struct _ofixMsgSpec	AllocationReport = {
     "AS", // type
     "AllocationReport", // name
     {0,0,0,0,0,0,112,0,1,2,160,0,0,0,0,122,0,0,0,0,0,0,52,0,0,0,0,0,0,0,107,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,51,4,11,0,21,105,48,49,5,13,136,0,126,0,0,127,128,50,0,0,0,0,29,30,37,43,123,125,0,134,157,0,0,0,0,0,0,0,0,35,36,159,8,9,0,158,0,0,0,20,0,0,0,0,0,0,0,0,78,81,0,0,0,0,0,0,0,6,15,0,133,0,0,0,22,0,44,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,139,140,141,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,40,0,0,58,0,72,0,0,0,74,77,0,0,0,0,23,24,0,0,0,0,114,0,115,116,117,76,60,61,63,64,65,108,0,75,148,0,0,149,150,132,131,62,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,109,0,0,0,0,0,0,0,0,0,0,25,79,80,82,83,0,0,137,138,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,130,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,111,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,53,0,0,0,0,0,54,55,0,0,0,0,41,0,0,0,68,69,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,142,59,0,67,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,110,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,118,119,0,0,0,85,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,152,153,154,120,46,151,0,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,28,0,0,0,0,0,121,57,0,0,0,0,0,0,0,0,0,0,0,0,129,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,33,34,31,32,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,0,42,0,0,113,0,0,0,88,0,0,0,0,92,93,0,0,89,90,86,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,155,156,0,0,0,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,95,96,99,100,97,101,144,145,146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01f2000c00000740ULL,0x0000000000804880ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0008000000000000ULL,0x0000000004000000ULL,0x0000000002000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97f7086de042bf40ULL,0x15d80c022fa3efc7ULL,0x00001ea2fe03cf03ULL,0xffffffbff433c570ULL,0x73fe000000000003ULL,0x20027f0cf8010000ULL,0x8018008000000000ULL,0x0002000081ccfff1ULL,0x64001802fc00f800ULL,0x087bffffffff0003ULL,0x3f08000038e00400ULL,0x1ffc007f00000080ULL,0x000005ff9e1ff080ULL,0x3bfcffff12400000ULL,0x1808600007fe0004ULL,0x0000000000000000ULL}, // allowed
     AllocationReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9876,6 +10503,7 @@ static struct _ofixMsgSpec	AllocationReport = {
 
 static struct _ofixGroupSpec	AllocationReportAckGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -9886,6 +10514,7 @@ static struct _ofixGroupSpec	AllocationReportAckGroup627 = {
 
 static struct _ofixGroupSpec	AllocationReportAckGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -9897,6 +10526,7 @@ static struct _ofixGroupSpec	AllocationReportAckGroup453 = {
 
 static struct _ofixGroupSpec	AllocationReportAckGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -9906,6 +10536,7 @@ static struct _ofixGroupSpec	AllocationReportAckGroup802 = {
 
 static struct _ofixGroupSpec	AllocationReportAckGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000008000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000430000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000000000000ULL,0x0000000000000100ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -9933,6 +10564,8 @@ static struct _ofixMsgSpec	AllocationReportAck = {
     "AT", // type
     "AllocationReportAck", // name
     {0,0,0,0,0,0,0,0,1,2,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,41,0,33,0,0,0,0,0,0,0,0,0,29,0,0,0,0,32,0,0,44,0,0,0,0,0,0,0,0,34,35,46,8,9,0,45,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,42,43,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,36,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000800040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0008000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022f80c840ULL,0x000000820003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002430c08000000ULL,0x8000000000000000ULL,0x0000000000081031ULL,0x2000000000000800ULL,0x0078000000000000ULL,0x0000000000200000ULL,0x0008000000000000ULL,0x0000010c06000100ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     AllocationReportAckGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -9990,6 +10623,7 @@ static struct _ofixMsgSpec	AllocationReportAck = {
 
 static struct _ofixGroupSpec	ConfirmationAckGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -10009,6 +10643,8 @@ static struct _ofixMsgSpec	ConfirmationAck = {
     "AU", // type
     "ConfirmationAck", // name
     {0,0,0,0,0,0,0,0,1,2,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,34,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,38,8,9,0,37,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000001000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022e000800ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x2000000000000000ULL,0x0078000000000000ULL,0x0000000001000000ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0000000000000000ULL}, // allowed
     ConfirmationAckGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -10058,6 +10694,7 @@ static struct _ofixMsgSpec	ConfirmationAck = {
 
 static struct _ofixGroupSpec	SettlementInstructionRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -10068,6 +10705,7 @@ static struct _ofixGroupSpec	SettlementInstructionRequestGroup627 = {
 
 static struct _ofixGroupSpec	SettlementInstructionRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -10079,6 +10717,7 @@ static struct _ofixGroupSpec	SettlementInstructionRequestGroup453 = {
 
 static struct _ofixGroupSpec	SettlementInstructionRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -10099,6 +10738,8 @@ static struct _ofixMsgSpec	SettlementInstructionRequest = {
     "AV", // type
     "SettlementInstructionRequest", // name
     {0,0,0,0,0,0,0,0,1,2,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,33,0,5,13,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,44,8,9,0,43,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,38,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,37,40,41,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,34,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000800000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1356080c00000700ULL,0x441800022e008000ULL,0x00000f800003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x8000000000000000ULL,0x0000000000003031ULL,0x0000000000000800ULL,0x0078000000000000ULL,0x0000000000200000ULL,0x0000000000000000ULL,0x0000000c00800800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SettlementInstructionRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -10154,6 +10795,7 @@ static struct _ofixMsgSpec	SettlementInstructionRequest = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -10164,6 +10806,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup627 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -10175,6 +10818,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup453 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -10184,6 +10828,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup802 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -10193,6 +10838,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup454 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -10204,6 +10850,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup864 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -10213,8 +10860,9 @@ static struct _ofixGroupSpec	AssignmentReportGroup604 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -10266,6 +10914,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup711 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -10275,6 +10924,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup457 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -10284,6 +10934,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup887 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup702 = {
     702, // NoPositions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000007ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 703, false }, // PosType
 	{ 704, false }, // LongQty
@@ -10296,6 +10947,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup702 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -10307,6 +10959,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup539 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -10316,6 +10969,7 @@ static struct _ofixGroupSpec	AssignmentReportGroup804 = {
 
 static struct _ofixGroupSpec	AssignmentReportGroup753 = {
     753, // NoPosAmt
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000018ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 707, true }, // PosAmtType
 	{ 708, true }, // PosAmt
@@ -10346,6 +11000,8 @@ static struct _ofixMsgSpec	AssignmentReport = {
     "AW", // type
     "AssignmentReport", // name
     {0,32,0,0,0,0,0,0,1,2,140,0,0,0,0,76,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,36,4,11,0,21,0,0,34,5,13,135,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,8,9,0,138,0,0,0,20,0,0,0,0,0,0,0,0,63,66,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,59,62,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,61,45,46,48,49,50,0,0,60,0,0,0,0,0,0,0,47,56,0,0,0,0,0,0,0,89,90,91,92,93,94,100,51,0,95,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,64,65,67,68,0,0,136,137,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,38,0,0,0,0,0,39,40,0,0,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,52,0,0,0,0,0,0,0,0,0,0,0,77,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,98,99,96,78,79,80,81,82,0,0,83,84,85,87,88,101,103,104,105,106,107,108,109,110,111,112,113,114,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,121,0,0,0,0,0,0,0,0,120,0,0,0,134,132,133,0,0,0,0,0,0,0,0,0,0,0,0,124,125,126,0,0,0,0,0,0,117,116,0,0,0,128,129,130,131,0,0,0,0,0,122,0,0,0,0,0,0,0,0,42,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,28,123,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,74,75,71,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,0,0,58,0,0,0,0,0,0,0,118,119,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000020ULL,0x4000000000000000ULL,0x00020d001c003800ULL,0x0000000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408702ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000003ULL,0x00023c0cf8000000ULL,0x8019000000000000ULL,0x0000000001c0fff1ULL,0x00001802ec003800ULL,0x0079ffffffff0020ULL,0xc008000008000000ULL,0x1c020f181c00389fULL,0x0000043c00000000ULL,0x03fcfe1f00000007ULL,0x1808600000010000ULL,0x0000000000000000ULL}, // allowed
     AssignmentReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -10381,7 +11037,7 @@ static struct _ofixMsgSpec	AssignmentReport = {
 	{ 453, false }, // NoPartyIDs
 	{ 1, false }, // Account
 	{ 581, true }, // AccountType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -10496,6 +11152,7 @@ static struct _ofixMsgSpec	AssignmentReport = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -10506,6 +11163,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup627 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -10517,6 +11175,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup453 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -10526,6 +11185,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup802 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup124 = {
     124, // NoExecs
+    {0x0000000000020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 17, false }, // ExecID
 	{ 0, false }
@@ -10534,6 +11194,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup124 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup897 = {
     897, // NoTrades
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 571, false }, // TradeReportID
 	{ 818, false }, // SecondaryTradeReportID
@@ -10543,6 +11204,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup897 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -10552,6 +11214,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup454 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -10563,6 +11226,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup864 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -10572,8 +11236,9 @@ static struct _ofixGroupSpec	CollateralRequestGroup604 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0001200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -10626,6 +11291,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup711 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -10635,6 +11301,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup457 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -10644,6 +11311,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup887 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -10654,6 +11322,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup768 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -10665,6 +11334,7 @@ static struct _ofixGroupSpec	CollateralRequestGroup136 = {
 
 static struct _ofixGroupSpec	CollateralRequestGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -10696,6 +11366,8 @@ static struct _ofixMsgSpec	CollateralRequest = {
     "AX", // type
     "CollateralRequest", // name
     {0,33,0,0,0,0,0,0,1,2,171,35,0,0,0,95,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,10,3,0,36,0,0,0,0,0,19,146,0,0,0,43,4,11,0,21,93,144,41,5,13,166,0,30,0,0,0,92,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,170,8,9,0,169,0,0,0,20,0,0,0,0,0,0,0,0,70,73,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,39,0,31,0,7,17,0,0,0,0,0,0,145,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,50,0,64,0,0,0,66,69,0,0,0,0,23,24,0,0,0,0,152,0,153,154,155,68,52,53,55,56,57,0,0,67,160,0,0,0,0,0,0,54,63,0,0,0,0,0,0,0,108,109,110,111,112,113,119,58,0,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,25,71,72,74,75,0,0,167,168,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,45,0,0,0,0,0,46,47,0,0,0,0,0,0,0,0,60,61,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,59,0,0,0,0,0,0,0,0,0,0,0,96,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,116,117,118,115,97,98,99,100,101,0,0,102,103,104,106,107,120,122,123,124,125,126,127,128,129,130,131,132,133,162,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,157,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,158,0,0,0,0,0,0,0,0,0,0,0,139,0,0,0,165,163,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,136,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,49,0,105,0,0,0,143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,81,82,78,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,40,91,140,141,142,0,0,0,0,0,0,0,0,0,0,0,83,84,85,88,89,86,90,149,150,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,121,0,0,0,0,65,0,0,0,0,0,0,0,137,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0xc000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17f7182c00428f02ULL,0x54180c022e000003ULL,0x000000808003cf03ULL,0xffff879ff430c540ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001c0fff1ULL,0x08001800e0004800ULL,0x007bffffffff0020ULL,0x0808000008c00000ULL,0x1e00001800003880ULL,0x0004040c0010000fULL,0xcbfcfe1f00400000ULL,0x1809600007fe003eULL,0x0000000000000000ULL}, // allowed
     CollateralRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -10738,7 +11410,7 @@ static struct _ofixMsgSpec	CollateralRequest = {
 	{ 526, false }, // SecondaryClOrdID
 	{ 124, false }, // NoExecs
 	{ 897, false }, // NoTrades
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -10840,7 +11512,7 @@ static struct _ofixMsgSpec	CollateralRequest = {
 	{ 899, false }, // MarginExcess
 	{ 900, false }, // TotalNetValue
 	{ 901, false }, // CashOutstanding
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 54, false }, // Side
 	{ 136, false }, // NoMiscFees
 	{ 44, false }, // Price
@@ -10877,6 +11549,7 @@ static struct _ofixMsgSpec	CollateralRequest = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -10887,6 +11560,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup627 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -10898,6 +11572,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup453 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -10907,6 +11582,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup802 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup124 = {
     124, // NoExecs
+    {0x0000000000020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 17, false }, // ExecID
 	{ 0, false }
@@ -10915,6 +11591,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup124 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup897 = {
     897, // NoTrades
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 571, false }, // TradeReportID
 	{ 818, false }, // SecondaryTradeReportID
@@ -10924,6 +11601,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup897 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -10933,6 +11611,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup454 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -10944,6 +11623,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup864 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -10953,8 +11633,9 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup604 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0001200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -11007,6 +11688,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup711 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -11016,6 +11698,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup457 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -11025,6 +11708,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup887 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -11035,6 +11719,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup768 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -11046,6 +11731,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup136 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -11055,6 +11741,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup232 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup85 = {
     85, // NoDlvyInst
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000082000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 165, false }, // SettlInstSource
 	{ 787, false }, // DlvyInstType
@@ -11065,6 +11752,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup85 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup781 = {
     781, // NoSettlPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000020001c000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 782, false }, // SettlPartyID
 	{ 783, false }, // SettlPartyIDSource
@@ -11076,6 +11764,7 @@ static struct _ofixGroupSpec	CollateralAssignmentGroup781 = {
 
 static struct _ofixGroupSpec	CollateralAssignmentGroup801 = {
     801, // NoSettlPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000060000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 785, false }, // SettlPartySubID
 	{ 786, false }, // SettlPartySubIDType
@@ -11110,6 +11799,8 @@ static struct _ofixMsgSpec	CollateralAssignment = {
     "AY", // type
     "CollateralAssignment", // name
     {0,36,0,0,0,0,0,0,1,2,179,38,0,0,0,98,0,0,0,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,10,3,0,39,0,0,0,0,0,19,149,0,0,0,46,4,11,0,21,96,147,44,5,13,174,0,33,0,0,0,95,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,168,0,0,0,178,8,9,0,177,0,0,0,20,0,0,0,0,0,0,0,0,73,76,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,42,0,34,0,7,17,0,0,0,0,0,0,148,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,51,0,165,166,167,164,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,53,0,67,0,0,0,69,72,0,0,0,0,23,24,0,0,0,0,155,0,156,157,158,71,55,56,58,59,60,0,0,70,163,0,0,0,0,0,0,57,66,0,0,0,0,0,0,0,111,112,113,114,115,116,122,61,0,117,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,169,0,0,0,0,0,0,0,0,0,0,25,74,75,77,78,0,0,175,176,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,150,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,48,0,0,0,0,0,49,50,0,0,0,0,0,0,0,0,63,64,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,62,0,0,0,0,0,0,0,0,0,0,0,99,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,119,120,121,118,100,101,102,103,104,0,0,105,106,107,109,110,123,125,126,127,128,129,130,131,132,133,134,135,136,170,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,160,0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,161,0,0,0,0,0,0,0,0,0,0,0,142,0,0,0,173,171,172,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,162,52,0,108,0,0,0,146,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,0,0,0,0,0,0,0,0,0,83,0,0,0,0,0,0,0,0,84,85,81,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,43,94,143,144,145,28,31,0,0,0,32,0,0,0,0,0,86,87,88,91,92,89,93,152,153,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,124,0,0,0,0,68,0,0,0,0,0,0,0,140,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x00000000000000c0ULL,0x0000000000000000ULL}, // required
+    {0x17f7182c00428f02ULL,0x54180c022e200003ULL,0x00001ea08003cf03ULL,0xffff879ff430c540ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001c0fff1ULL,0x08001800e0004800ULL,0x007bffffffff0020ULL,0x0808000008c00000ULL,0x1e00001800003880ULL,0x0004040e001fe00fULL,0xcbfcfe1f00400000ULL,0x1809600007fe08feULL,0x0000000000000000ULL}, // allowed
     CollateralAssignmentGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -11155,7 +11846,7 @@ static struct _ofixMsgSpec	CollateralAssignment = {
 	{ 526, false }, // SecondaryClOrdID
 	{ 124, false }, // NoExecs
 	{ 897, false }, // NoTrades
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -11257,7 +11948,7 @@ static struct _ofixMsgSpec	CollateralAssignment = {
 	{ 899, false }, // MarginExcess
 	{ 900, false }, // TotalNetValue
 	{ 901, false }, // CashOutstanding
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 54, false }, // Side
 	{ 136, false }, // NoMiscFees
 	{ 44, false }, // Price
@@ -11299,6 +11990,7 @@ static struct _ofixMsgSpec	CollateralAssignment = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -11309,6 +12001,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup627 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -11320,6 +12013,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup453 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -11329,6 +12023,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup802 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup124 = {
     124, // NoExecs
+    {0x0000000000020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 17, false }, // ExecID
 	{ 0, false }
@@ -11337,6 +12032,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup124 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup897 = {
     897, // NoTrades
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 571, false }, // TradeReportID
 	{ 818, false }, // SecondaryTradeReportID
@@ -11346,6 +12042,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup897 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -11355,6 +12052,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup454 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -11366,6 +12064,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup864 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -11375,8 +12074,9 @@ static struct _ofixGroupSpec	CollateralResponseGroup604 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0001200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -11429,6 +12129,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup711 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -11438,6 +12139,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup457 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -11447,6 +12149,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup887 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -11457,6 +12160,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup768 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -11468,6 +12172,7 @@ static struct _ofixGroupSpec	CollateralResponseGroup136 = {
 
 static struct _ofixGroupSpec	CollateralResponseGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -11499,6 +12204,8 @@ static struct _ofixMsgSpec	CollateralResponse = {
     "AZ", // type
     "CollateralResponse", // name
     {0,37,0,0,0,0,0,0,1,2,170,39,0,0,0,99,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,10,3,0,40,0,0,0,0,0,19,150,0,0,0,47,4,11,0,21,97,148,45,5,13,165,0,35,0,0,0,96,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,169,8,9,0,168,0,0,0,20,0,0,0,0,0,0,0,0,74,77,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,43,0,0,0,7,17,0,0,0,0,0,0,149,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,152,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,54,0,68,0,0,0,70,73,0,0,0,0,23,24,0,0,0,0,156,0,157,158,159,72,56,57,59,60,61,0,0,71,164,0,0,0,0,0,0,58,67,0,0,0,0,0,0,0,112,113,114,115,116,117,123,62,0,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,75,76,78,79,0,0,166,167,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,49,0,0,0,0,0,50,51,0,0,0,0,0,0,0,0,64,65,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,63,0,0,0,0,0,0,0,0,0,0,0,100,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,121,122,119,101,102,103,104,105,0,0,106,107,108,110,111,124,126,127,128,129,130,131,132,133,134,135,136,137,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,161,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,162,0,0,0,0,0,0,0,0,0,0,0,143,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,163,53,0,109,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,85,86,82,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,31,0,44,95,144,145,146,29,32,28,33,34,0,0,0,0,0,0,87,88,89,92,93,90,94,153,154,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,125,0,0,0,0,69,0,0,0,0,0,0,0,141,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000340ULL,0x0000000000000000ULL}, // required
+    {0x17f7182c00428f02ULL,0x14180c022e000003ULL,0x000000808003cf03ULL,0xffff879ff430c540ULL,0x73fe000000000003ULL,0x00023c0cf8000000ULL,0x8018008000000000ULL,0x0000000001c0fff1ULL,0x08001800e0004800ULL,0x0079ffffffff0020ULL,0x0808000008c00000ULL,0x1e00001800000080ULL,0x0004040c0010000fULL,0xcbfcfe1f00400000ULL,0x1809600007fe07feULL,0x0000000000000000ULL}, // allowed
     CollateralResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -11545,7 +12252,7 @@ static struct _ofixMsgSpec	CollateralResponse = {
 	{ 526, false }, // SecondaryClOrdID
 	{ 124, false }, // NoExecs
 	{ 897, false }, // NoTrades
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -11647,7 +12354,7 @@ static struct _ofixMsgSpec	CollateralResponse = {
 	{ 899, false }, // MarginExcess
 	{ 900, false }, // TotalNetValue
 	{ 901, false }, // CashOutstanding
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 54, false }, // Side
 	{ 136, false }, // NoMiscFees
 	{ 44, false }, // Price
@@ -11679,6 +12386,7 @@ static struct _ofixMsgSpec	CollateralResponse = {
 
 static struct _ofixGroupSpec	NewsGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -11689,6 +12397,7 @@ static struct _ofixGroupSpec	NewsGroup627 = {
 
 static struct _ofixGroupSpec	NewsGroup215 = {
     215, // NoRoutingIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000003000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 216, false }, // RoutingType
 	{ 217, false }, // RoutingID
@@ -11698,8 +12407,9 @@ static struct _ofixGroupSpec	NewsGroup215 = {
 
 static struct _ofixGroupSpec	NewsGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0000000000000000ULL,0x0008000008000000ULL,0x0400000000000000ULL,0x0000000000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -11747,6 +12457,7 @@ static struct _ofixGroupSpec	NewsGroup146 = {
 
 static struct _ofixGroupSpec	NewsGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -11756,6 +12467,7 @@ static struct _ofixGroupSpec	NewsGroup454 = {
 
 static struct _ofixGroupSpec	NewsGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -11767,6 +12479,7 @@ static struct _ofixGroupSpec	NewsGroup864 = {
 
 static struct _ofixGroupSpec	NewsGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -11816,6 +12529,7 @@ static struct _ofixGroupSpec	NewsGroup555 = {
 
 static struct _ofixGroupSpec	NewsGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -11825,8 +12539,9 @@ static struct _ofixGroupSpec	NewsGroup604 = {
 
 static struct _ofixGroupSpec	NewsGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -11878,6 +12593,7 @@ static struct _ofixGroupSpec	NewsGroup711 = {
 
 static struct _ofixGroupSpec	NewsGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -11887,6 +12603,7 @@ static struct _ofixGroupSpec	NewsGroup457 = {
 
 static struct _ofixGroupSpec	NewsGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -11896,6 +12613,7 @@ static struct _ofixGroupSpec	NewsGroup887 = {
 
 static struct _ofixGroupSpec	NewsGroup33 = {
     33, // LinesOfText
+    {0x0400000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 58, true }, // Text
 	{ 354, false }, // EncodedTextLen
@@ -11925,6 +12643,8 @@ static struct _ofixMsgSpec	News = {
     "B", // type
     "News", // name
     {0,0,0,0,0,0,0,0,1,2,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,10,3,0,0,0,0,0,0,28,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,8,9,0,41,0,39,40,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,34,0,30,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,31,32,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000e00000700ULL,0x0000000000000000ULL,0x0000000000100000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x27970c0e00400700ULL,0x04180c03ae000002ULL,0x000000800037c003ULL,0xffff809f83b0c500ULL,0x73fe000000000003ULL,0x00023cccf8000000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00001800e0000000ULL,0x0079ffffffff0000ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x0000040000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     NewsGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -11978,6 +12698,7 @@ static struct _ofixMsgSpec	News = {
 
 static struct _ofixGroupSpec	CollateralReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -11988,6 +12709,7 @@ static struct _ofixGroupSpec	CollateralReportGroup627 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -11999,6 +12721,7 @@ static struct _ofixGroupSpec	CollateralReportGroup453 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -12008,6 +12731,7 @@ static struct _ofixGroupSpec	CollateralReportGroup802 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup124 = {
     124, // NoExecs
+    {0x0000000000020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 17, false }, // ExecID
 	{ 0, false }
@@ -12016,6 +12740,7 @@ static struct _ofixGroupSpec	CollateralReportGroup124 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup897 = {
     897, // NoTrades
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 571, false }, // TradeReportID
 	{ 818, false }, // SecondaryTradeReportID
@@ -12025,6 +12750,7 @@ static struct _ofixGroupSpec	CollateralReportGroup897 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -12034,6 +12760,7 @@ static struct _ofixGroupSpec	CollateralReportGroup454 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -12045,6 +12772,7 @@ static struct _ofixGroupSpec	CollateralReportGroup864 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -12054,8 +12782,9 @@ static struct _ofixGroupSpec	CollateralReportGroup604 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -12107,6 +12836,7 @@ static struct _ofixGroupSpec	CollateralReportGroup711 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -12116,6 +12846,7 @@ static struct _ofixGroupSpec	CollateralReportGroup457 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -12125,6 +12856,7 @@ static struct _ofixGroupSpec	CollateralReportGroup887 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -12135,6 +12867,7 @@ static struct _ofixGroupSpec	CollateralReportGroup768 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -12146,6 +12879,7 @@ static struct _ofixGroupSpec	CollateralReportGroup136 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -12155,6 +12889,7 @@ static struct _ofixGroupSpec	CollateralReportGroup232 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup85 = {
     85, // NoDlvyInst
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000082000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 165, false }, // SettlInstSource
 	{ 787, false }, // DlvyInstType
@@ -12165,6 +12900,7 @@ static struct _ofixGroupSpec	CollateralReportGroup85 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup781 = {
     781, // NoSettlPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000020001c000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 782, false }, // SettlPartyID
 	{ 783, false }, // SettlPartyIDSource
@@ -12176,6 +12912,7 @@ static struct _ofixGroupSpec	CollateralReportGroup781 = {
 
 static struct _ofixGroupSpec	CollateralReportGroup801 = {
     801, // NoSettlPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000060000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 785, false }, // SettlPartySubID
 	{ 786, false }, // SettlPartySubIDType
@@ -12210,6 +12947,8 @@ static struct _ofixMsgSpec	CollateralReport = {
     "BA", // type
     "CollateralReport", // name
     {0,34,0,0,0,0,0,0,1,2,177,36,0,0,0,96,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,10,3,0,37,0,0,0,0,0,19,147,0,0,0,44,4,11,0,21,94,145,42,5,13,172,0,0,0,0,0,93,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,0,0,0,176,8,9,0,175,0,0,0,20,0,0,0,0,0,0,0,0,71,74,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,40,0,0,0,7,17,0,0,0,0,0,0,146,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,149,0,0,0,0,0,0,0,49,0,163,164,165,162,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,51,0,65,0,0,0,67,70,0,0,0,0,23,24,0,0,0,0,153,0,154,155,156,69,53,54,56,57,58,0,0,68,161,0,0,0,0,0,0,55,64,0,0,0,0,0,0,0,109,110,111,112,113,114,120,59,0,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,167,0,0,0,0,0,0,0,0,0,0,25,72,73,75,76,0,0,173,174,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,46,0,0,0,0,0,47,48,0,0,0,0,0,0,0,0,61,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,60,0,0,0,0,0,0,0,0,0,0,0,97,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,118,119,116,98,99,100,101,102,0,0,103,104,105,107,108,121,123,124,125,126,127,128,129,130,131,132,133,134,168,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,157,158,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,159,0,0,0,0,0,0,0,0,0,0,0,140,0,0,0,171,169,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,160,50,0,106,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,82,83,79,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,92,141,142,143,0,0,0,0,0,0,28,29,30,31,32,84,85,86,89,90,87,91,150,151,152,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,122,0,0,0,0,66,0,0,0,0,0,0,0,138,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000005000ULL,0x0000000000000000ULL}, // required
+    {0x07f7182c00428f02ULL,0x14180c022e200003ULL,0x00001ea08003cf03ULL,0xffff879ff430c540ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001c0fff1ULL,0x08001800e0004800ULL,0x007bffffffff0020ULL,0x0808000008c00000ULL,0x1e00001800003880ULL,0x0004040e001fe00fULL,0x0bfcfe1f00400000ULL,0x1808600007fff03eULL,0x0000000000000000ULL}, // allowed
     CollateralReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -12253,7 +12992,7 @@ static struct _ofixMsgSpec	CollateralReport = {
 	{ 526, false }, // SecondaryClOrdID
 	{ 124, false }, // NoExecs
 	{ 897, false }, // NoTrades
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -12355,7 +13094,7 @@ static struct _ofixMsgSpec	CollateralReport = {
 	{ 899, false }, // MarginExcess
 	{ 900, false }, // TotalNetValue
 	{ 901, false }, // CashOutstanding
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 54, false }, // Side
 	{ 136, false }, // NoMiscFees
 	{ 44, false }, // Price
@@ -12397,6 +13136,7 @@ static struct _ofixMsgSpec	CollateralReport = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -12407,6 +13147,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup627 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup938 = {
     938, // NoCollInquiryQualifier
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL}, // members
     {
 	{ 896, false }, // CollInquiryQualifier
 	{ 0, false }
@@ -12415,6 +13156,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup938 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -12426,6 +13168,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup453 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -12435,6 +13178,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup802 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup124 = {
     124, // NoExecs
+    {0x0000000000020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 17, false }, // ExecID
 	{ 0, false }
@@ -12443,6 +13187,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup124 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup897 = {
     897, // NoTrades
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 571, false }, // TradeReportID
 	{ 818, false }, // SecondaryTradeReportID
@@ -12452,6 +13197,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup897 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -12461,6 +13207,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup454 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -12472,6 +13219,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup864 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -12481,8 +13229,9 @@ static struct _ofixGroupSpec	CollateralInquiryGroup604 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -12534,6 +13283,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup711 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -12543,6 +13293,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup457 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -12552,6 +13303,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup887 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup768 = {
     768, // NoTrdRegTimestamps
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000eULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 769, false }, // TrdRegTimestamp
 	{ 770, false }, // TrdRegTimestampType
@@ -12562,6 +13314,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup768 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -12571,6 +13324,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup232 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup85 = {
     85, // NoDlvyInst
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000082000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 165, false }, // SettlInstSource
 	{ 787, false }, // DlvyInstType
@@ -12581,6 +13335,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup85 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup781 = {
     781, // NoSettlPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000020001c000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 782, false }, // SettlPartyID
 	{ 783, false }, // SettlPartyIDSource
@@ -12592,6 +13347,7 @@ static struct _ofixGroupSpec	CollateralInquiryGroup781 = {
 
 static struct _ofixGroupSpec	CollateralInquiryGroup801 = {
     801, // NoSettlPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000060000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 785, false }, // SettlPartySubID
 	{ 786, false }, // SettlPartySubIDType
@@ -12626,6 +13382,8 @@ static struct _ofixMsgSpec	CollateralInquiry = {
     "BB", // type
     "CollateralInquiry", // name
     {0,34,0,0,0,0,0,0,1,2,176,36,0,0,0,96,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,10,3,0,37,0,0,0,0,0,19,146,0,0,0,44,4,11,0,21,94,145,42,5,13,171,0,0,0,0,0,93,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,165,0,0,0,175,8,9,0,174,0,0,0,20,0,0,0,0,0,0,0,0,71,74,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,40,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,148,0,0,0,0,0,0,0,49,0,162,163,164,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,51,0,65,0,0,0,67,70,0,0,0,0,23,24,0,0,0,0,152,0,153,154,155,69,53,54,56,57,58,0,0,68,160,0,0,0,0,0,0,55,64,0,0,0,0,0,0,0,109,110,111,112,113,114,120,59,0,115,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,166,0,0,0,0,0,0,0,0,0,0,25,72,73,75,76,0,0,172,173,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,46,0,0,0,0,0,47,48,0,0,0,0,0,0,0,0,61,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,60,0,0,0,0,0,0,0,0,0,0,0,97,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,118,119,116,98,99,100,101,102,0,0,103,104,105,107,108,121,123,124,125,126,127,128,129,130,131,132,133,134,167,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,156,157,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,158,0,0,0,0,0,0,0,0,0,0,0,140,0,0,0,170,168,169,0,0,0,0,0,0,0,31,32,0,0,0,0,0,0,0,0,0,0,0,0,137,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,159,50,0,106,0,0,0,144,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,82,83,79,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,92,141,142,143,0,0,0,0,0,0,0,28,0,0,0,84,85,86,89,90,87,91,149,150,151,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,122,0,0,0,0,66,0,0,0,0,0,0,0,138,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x07f7182c00428f02ULL,0x14180c022e200003ULL,0x00001ea08003c003ULL,0xffff879ff430c540ULL,0x73fe000000000083ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001c0fff1ULL,0x08001800e0004800ULL,0x007bffffffff0020ULL,0x0808000008c00000ULL,0x1e00001800603880ULL,0x0004040e001fe00fULL,0x03fcfe1f00400000ULL,0x1808640007fe203fULL,0x0000000000000000ULL}, // allowed
     CollateralInquiryGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -12669,7 +13427,7 @@ static struct _ofixMsgSpec	CollateralInquiry = {
 	{ 526, false }, // SecondaryClOrdID
 	{ 124, false }, // NoExecs
 	{ 897, false }, // NoTrades
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -12771,7 +13529,7 @@ static struct _ofixMsgSpec	CollateralInquiry = {
 	{ 899, false }, // MarginExcess
 	{ 900, false }, // TotalNetValue
 	{ 901, false }, // CashOutstanding
-	{ 768, true }, // NoTrdRegTimestamps
+	{ 768, false }, // NoTrdRegTimestamps
 	{ 54, false }, // Side
 	{ 44, false }, // Price
 	{ 423, false }, // PriceType
@@ -12812,6 +13570,7 @@ static struct _ofixMsgSpec	CollateralInquiry = {
 
 static struct _ofixGroupSpec	NetworkStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -12822,6 +13581,7 @@ static struct _ofixGroupSpec	NetworkStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	NetworkStatusRequestGroup936 = {
     936, // NoCompIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000018000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 930, false }, // RefCompID
 	{ 931, false }, // RefSubID
@@ -12843,6 +13603,8 @@ static struct _ofixMsgSpec	NetworkStatusRequest = {
     "BC", // type
     "NetworkStatusRequest", // name
     {0,0,0,0,0,0,0,0,1,2,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,9,0,31,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,28,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000a000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000018000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000001ac00000000ULL,0x0000000000000000ULL}, // allowed
     NetworkStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -12886,6 +13648,7 @@ static struct _ofixMsgSpec	NetworkStatusRequest = {
 
 static struct _ofixGroupSpec	NetworkStatusResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -12896,6 +13659,7 @@ static struct _ofixGroupSpec	NetworkStatusResponseGroup627 = {
 
 static struct _ofixGroupSpec	NetworkStatusResponseGroup936 = {
     936, // NoCompIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000018000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000f00000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 930, false }, // RefCompID
 	{ 931, false }, // RefSubID
@@ -12919,6 +13683,8 @@ static struct _ofixMsgSpec	NetworkStatusResponse = {
     "BD", // type
     "NetworkStatusResponse", // name
     {0,0,0,0,0,0,0,0,1,2,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,8,9,0,33,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,29,31,0,32,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000030000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000018000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000037f00000000ULL,0x0000000000000000ULL}, // allowed
     NetworkStatusResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -12964,6 +13730,7 @@ static struct _ofixMsgSpec	NetworkStatusResponse = {
 
 static struct _ofixGroupSpec	UserRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -12983,6 +13750,8 @@ static struct _ofixMsgSpec	UserRequest = {
     "BE", // type
     "UserRequest", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,33,34,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000020000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000018000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x04180003ae000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000038000000ULL,0x0000000000000000ULL}, // allowed
     UserRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -13030,6 +13799,7 @@ static struct _ofixMsgSpec	UserRequest = {
 
 static struct _ofixGroupSpec	UserResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -13049,6 +13819,8 @@ static struct _ofixMsgSpec	UserResponse = {
     "BF", // type
     "UserResponse", // name
     {0,0,0,0,0,0,0,0,1,2,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,8,9,0,32,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000020000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000008000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000020000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00000000c8000000ULL,0x0000000000000000ULL}, // allowed
     UserResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -13093,6 +13865,7 @@ static struct _ofixMsgSpec	UserResponse = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -13103,6 +13876,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup627 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup938 = {
     938, // NoCollInquiryQualifier
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL}, // members
     {
 	{ 896, false }, // CollInquiryQualifier
 	{ 0, false }
@@ -13111,6 +13885,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup938 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -13122,6 +13897,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup453 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -13131,6 +13907,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup802 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup124 = {
     124, // NoExecs
+    {0x0000000000020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 17, false }, // ExecID
 	{ 0, false }
@@ -13139,6 +13916,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup124 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup897 = {
     897, // NoTrades
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 571, false }, // TradeReportID
 	{ 818, false }, // SecondaryTradeReportID
@@ -13148,6 +13926,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup897 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -13157,6 +13936,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup454 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -13168,6 +13948,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup864 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -13177,8 +13958,9 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup604 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -13230,6 +14012,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup711 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -13239,6 +14022,7 @@ static struct _ofixGroupSpec	CollateralInquiryAckGroup457 = {
 
 static struct _ofixGroupSpec	CollateralInquiryAckGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -13268,6 +14052,8 @@ static struct _ofixMsgSpec	CollateralInquiryAck = {
     "BG", // type
     "CollateralInquiryAck", // name
     {0,34,0,0,0,0,0,0,1,2,153,36,0,0,0,96,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,10,3,0,37,0,0,0,0,0,19,0,0,0,0,44,4,11,0,21,94,0,42,5,13,148,0,0,0,0,0,93,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,152,8,9,0,151,0,0,0,20,0,0,0,0,0,0,0,0,71,74,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,40,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,51,0,65,0,0,0,67,70,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,69,53,54,56,57,58,0,0,68,0,0,0,0,0,0,0,55,64,0,0,0,0,0,0,0,109,110,111,112,113,114,120,59,0,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,141,0,0,0,0,0,0,0,0,0,0,25,72,73,75,76,0,0,149,150,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,46,0,0,0,0,0,47,48,0,0,0,0,0,0,0,0,61,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,52,0,60,0,0,0,0,0,0,0,0,0,0,0,97,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,118,119,116,98,99,100,101,102,0,0,103,104,105,107,108,121,123,124,125,126,127,128,129,130,131,132,133,134,142,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,140,0,0,0,145,143,144,0,0,0,0,0,0,0,146,147,0,0,0,0,0,0,0,0,0,0,0,0,137,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,82,83,79,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,92,0,0,0,0,0,0,0,0,0,0,28,0,32,0,84,85,86,89,90,87,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,122,0,0,29,30,66,0,0,0,0,0,0,0,138,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000002000ULL,0x0000000000000000ULL}, // required
+    {0x07b7082c00428f02ULL,0x14180c022e000003ULL,0x000000800003c003ULL,0xffff809f8030c540ULL,0x73fe000000000003ULL,0x00023c0cf8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x08001800e0004800ULL,0x007bffffffff0020ULL,0x0008000008000000ULL,0x1c00001800603880ULL,0x0004040c00100000ULL,0x03fcfe1f00400000ULL,0x180e640000fea007ULL,0x0000000000000000ULL}, // allowed
     CollateralInquiryAckGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -13311,7 +14097,7 @@ static struct _ofixMsgSpec	CollateralInquiryAck = {
 	{ 526, false }, // SecondaryClOrdID
 	{ 124, false }, // NoExecs
 	{ 897, false }, // NoTrades
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -13431,6 +14217,7 @@ static struct _ofixMsgSpec	CollateralInquiryAck = {
 
 static struct _ofixGroupSpec	ConfirmationRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -13441,6 +14228,7 @@ static struct _ofixGroupSpec	ConfirmationRequestGroup627 = {
 
 static struct _ofixGroupSpec	ConfirmationRequestGroup73 = {
     73, // NoOrders
+    {0x0000006000000800ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000180000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, false }, // ClOrdID
 	{ 37, false }, // OrderID
@@ -13457,6 +14245,7 @@ static struct _ofixGroupSpec	ConfirmationRequestGroup73 = {
 
 static struct _ofixGroupSpec	ConfirmationRequestGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -13468,6 +14257,7 @@ static struct _ofixGroupSpec	ConfirmationRequestGroup756 = {
 
 static struct _ofixGroupSpec	ConfirmationRequestGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -13489,6 +14279,8 @@ static struct _ofixMsgSpec	ConfirmationRequest = {
     "BH", // type
     "ConfirmationRequest", // name
     {0,0,0,0,0,0,0,0,1,2,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,38,0,34,0,0,0,0,0,0,0,0,0,31,0,0,30,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,42,8,9,0,41,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000020ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716086c00000f00ULL,0x041800022e008244ULL,0x000000000003c003ULL,0x0000000000300040ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000004000ULL,0x0078000000000000ULL,0x0000000000200000ULL,0x01f0000000000000ULL,0x000000c1c2000020ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ConfirmationRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -13542,6 +14334,7 @@ static struct _ofixMsgSpec	ConfirmationRequest = {
 
 static struct _ofixGroupSpec	EmailGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -13552,6 +14345,7 @@ static struct _ofixGroupSpec	EmailGroup627 = {
 
 static struct _ofixGroupSpec	EmailGroup215 = {
     215, // NoRoutingIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000003000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 216, false }, // RoutingType
 	{ 217, false }, // RoutingID
@@ -13561,8 +14355,9 @@ static struct _ofixGroupSpec	EmailGroup215 = {
 
 static struct _ofixGroupSpec	EmailGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0000000000000000ULL,0x0008000008000000ULL,0x0400000000000000ULL,0x0000000000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -13610,6 +14405,7 @@ static struct _ofixGroupSpec	EmailGroup146 = {
 
 static struct _ofixGroupSpec	EmailGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -13619,6 +14415,7 @@ static struct _ofixGroupSpec	EmailGroup454 = {
 
 static struct _ofixGroupSpec	EmailGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -13630,8 +14427,9 @@ static struct _ofixGroupSpec	EmailGroup864 = {
 
 static struct _ofixGroupSpec	EmailGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -13683,6 +14481,7 @@ static struct _ofixGroupSpec	EmailGroup711 = {
 
 static struct _ofixGroupSpec	EmailGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -13692,6 +14491,7 @@ static struct _ofixGroupSpec	EmailGroup457 = {
 
 static struct _ofixGroupSpec	EmailGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -13701,6 +14501,7 @@ static struct _ofixGroupSpec	EmailGroup887 = {
 
 static struct _ofixGroupSpec	EmailGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -13750,6 +14551,7 @@ static struct _ofixGroupSpec	EmailGroup555 = {
 
 static struct _ofixGroupSpec	EmailGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -13759,6 +14561,7 @@ static struct _ofixGroupSpec	EmailGroup604 = {
 
 static struct _ofixGroupSpec	EmailGroup33 = {
     33, // LinesOfText
+    {0x0400000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 58, true }, // Text
 	{ 354, false }, // EncodedTextLen
@@ -13788,6 +14591,8 @@ static struct _ofixMsgSpec	Email = {
     "C", // type
     "Email", // name
     {0,0,0,0,0,0,0,0,1,2,45,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,10,3,0,38,0,0,0,0,30,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,8,9,0,43,29,41,42,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,35,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,32,33,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000e00000700ULL,0x0000000040000000ULL,0x0000001000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x07970c2e00400f00ULL,0x04180c03ee000002ULL,0x00000090000fc003ULL,0xffff809f83b0c500ULL,0x73fe000000000003ULL,0x00023c3cf8000000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00001800e0000000ULL,0x0079ffffffff0000ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x0000040000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     EmailGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -13843,6 +14648,7 @@ static struct _ofixMsgSpec	Email = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -13853,6 +14659,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -13864,6 +14671,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -13873,6 +14681,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup802 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -13886,6 +14695,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -13897,6 +14707,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup539 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -13906,6 +14717,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup804 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -13915,6 +14727,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -13924,6 +14737,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -13935,8 +14749,9 @@ static struct _ofixGroupSpec	NewOrderSingleGroup864 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -13988,6 +14803,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup711 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -13997,6 +14813,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup457 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -14006,6 +14823,7 @@ static struct _ofixGroupSpec	NewOrderSingleGroup887 = {
 
 static struct _ofixGroupSpec	NewOrderSingleGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -14036,6 +14854,8 @@ static struct _ofixMsgSpec	NewOrderSingle = {
     "D", // type
     "NewOrderSingle", // name
     {0,34,0,0,0,0,0,0,1,2,185,28,144,145,0,134,0,0,47,0,0,46,56,137,0,0,0,0,0,0,0,0,0,0,10,3,0,0,111,0,116,0,0,19,118,0,0,0,55,4,11,0,21,0,106,53,5,13,154,139,108,0,0,42,43,54,0,0,0,0,40,0,0,0,0,33,0,160,41,0,0,52,0,0,0,0,0,0,0,184,8,9,0,183,0,0,0,20,0,119,50,0,0,0,0,0,82,85,0,0,48,49,0,0,107,6,15,138,0,0,152,151,22,0,0,0,142,0,7,17,0,0,0,0,0,0,0,0,0,0,105,0,12,14,16,18,0,0,0,0,0,0,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,140,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,158,157,0,0,0,0,0,0,62,0,76,161,0,0,78,81,0,0,162,163,23,24,0,0,0,0,120,0,121,122,123,80,64,65,67,68,69,32,0,79,109,0,0,128,129,0,0,66,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,83,84,86,87,0,0,155,156,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,135,136,0,0,0,0,0,0,0,0,51,0,169,170,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,0,0,0,143,0,0,0,0,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,57,0,0,0,0,0,58,59,0,0,0,0,0,0,114,115,72,73,74,0,0,0,0,0,0,146,179,180,0,0,0,0,0,0,0,0,0,0,0,0,182,0,0,147,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,181,0,0,113,0,0,0,0,0,0,0,0,0,29,0,148,149,0,0,0,0,0,0,0,0,0,0,0,63,0,71,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,150,30,0,0,0,0,0,37,38,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,45,0,0,0,0,159,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,124,125,0,0,0,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,0,0,0,131,132,133,126,0,130,0,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,61,0,0,0,0,0,0,0,0,0,0,0,0,153,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,164,165,166,167,0,168,171,172,173,174,0,175,176,177,178,0,0,0,0,110,0,0,0,0,0,0,0,0,0,92,0,0,0,0,0,0,0,0,93,94,90,91,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,96,97,100,101,98,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2010c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7194c00e4bf02ULL,0x473ccc1a2e03e843ULL,0x000001800103d003ULL,0x80ff9fbff43ccd03ULL,0x73fe000000000001ULL,0x03023c0cf8010000ULL,0x8019088000000034ULL,0x0002400381f8fff1ULL,0x00000003ec037812ULL,0x087a0000000fe0e0ULL,0x2f08000008f00001ULL,0x0e00000100000080ULL,0x0000043c00100080ULL,0x03fcfe1f0043df78ULL,0x0008200000fe0004ULL,0x0000000000000000ULL}, // allowed
     NewOrderSingleGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -14231,6 +15051,7 @@ static struct _ofixMsgSpec	NewOrderSingle = {
 
 static struct _ofixGroupSpec	NewOrderListGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -14241,6 +15062,7 @@ static struct _ofixGroupSpec	NewOrderListGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup73 = {
     73, // NoOrders
+    {0x9cc1114000e4b802ULL,0x4324cc180002684bULL,0x0000018101001000ULL,0x800199bff40ccd03ULL,0x0000000000000000ULL,0x0300000cf0000000ULL,0x0001088000020034ULL,0x0002400081f03060ULL,0x00000001a0034010ULL,0x080000000000e0e0ULL,0x2f08000008d00001ULL,0x0600000000000080ULL,0x0000000000000080ULL,0x00001e010043df78ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, true }, // ClOrdID
 	{ 526, false }, // SecondaryClOrdID
@@ -14394,6 +15216,7 @@ static struct _ofixGroupSpec	NewOrderListGroup73 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -14405,6 +15228,7 @@ static struct _ofixGroupSpec	NewOrderListGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -14414,6 +15238,7 @@ static struct _ofixGroupSpec	NewOrderListGroup802 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -14427,6 +15252,7 @@ static struct _ofixGroupSpec	NewOrderListGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -14438,6 +15264,7 @@ static struct _ofixGroupSpec	NewOrderListGroup539 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -14447,6 +15274,7 @@ static struct _ofixGroupSpec	NewOrderListGroup804 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -14456,6 +15284,7 @@ static struct _ofixGroupSpec	NewOrderListGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -14465,6 +15294,7 @@ static struct _ofixGroupSpec	NewOrderListGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -14476,8 +15306,9 @@ static struct _ofixGroupSpec	NewOrderListGroup864 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -14529,6 +15360,7 @@ static struct _ofixGroupSpec	NewOrderListGroup711 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -14538,6 +15370,7 @@ static struct _ofixGroupSpec	NewOrderListGroup457 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -14547,6 +15380,7 @@ static struct _ofixGroupSpec	NewOrderListGroup887 = {
 
 static struct _ofixGroupSpec	NewOrderListGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -14578,6 +15412,8 @@ static struct _ofixMsgSpec	NewOrderList = {
     "E", // type
     "NewOrderList", // name
     {0,0,0,0,0,0,0,0,1,2,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,28,0,44,38,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,8,9,0,47,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,30,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,42,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000214ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000400ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7194c00e4bf02ULL,0x473ccc1a2e03ea7fULL,0x000001810103d003ULL,0x80ff9fbff43ccd03ULL,0x73fe000000000001ULL,0x03023c0ff8010000ULL,0x801b0880c00204f4ULL,0x0002400381f8fff1ULL,0x00000003ec037812ULL,0x087a0000000fe0e0ULL,0x2f08000008f00001ULL,0xee00000100000080ULL,0x0000043c00000080ULL,0x23fcfe1f0043df78ULL,0x0008200000000000ULL,0x0000000000000000ULL}, // allowed
     NewOrderListGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -14637,6 +15473,7 @@ static struct _ofixMsgSpec	NewOrderList = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -14647,6 +15484,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -14658,6 +15496,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -14667,6 +15506,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup802 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -14676,6 +15516,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup454 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -14687,8 +15528,9 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup864 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -14740,6 +15582,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup711 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -14749,6 +15592,7 @@ static struct _ofixGroupSpec	OrderCancelRequestGroup457 = {
 
 static struct _ofixGroupSpec	OrderCancelRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -14774,6 +15618,8 @@ static struct _ofixMsgSpec	OrderCancelRequest = {
     "F", // type
     "OrderCancelRequest", // name
     {0,35,0,0,0,0,0,0,1,2,104,30,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,10,3,0,29,93,0,0,28,0,19,0,0,0,0,41,4,11,0,21,0,91,39,5,13,99,0,92,0,0,0,0,40,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,8,9,0,102,0,0,0,20,0,0,0,0,0,0,0,0,68,71,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,62,0,0,0,64,67,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,66,50,51,53,54,55,0,0,65,0,0,0,0,0,0,0,52,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,69,70,72,73,0,0,100,101,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,43,0,0,0,0,0,44,45,0,0,0,0,0,0,96,97,58,59,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,32,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,79,80,76,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,82,83,86,87,84,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2020c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d70a6c00400f02ULL,0x04180c022e000006ULL,0x000000800103c003ULL,0x80ff809f8030c500ULL,0x73fe000000000001ULL,0x01023c0cf8000000ULL,0x8018000000000000ULL,0x0000000001f0fff1ULL,0x00000000e0004810ULL,0x00780000000f04a0ULL,0x0008000008100000ULL,0x0c00000000000080ULL,0x0000040c00100000ULL,0x03fcfe1f00000000ULL,0x0008200000fe0004ULL,0x0000000000000000ULL}, // allowed
     OrderCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -14888,6 +15734,7 @@ static struct _ofixMsgSpec	OrderCancelRequest = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -14898,6 +15745,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -14909,6 +15757,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -14918,6 +15767,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup802 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -14931,6 +15781,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup78 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -14942,6 +15793,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup539 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -14951,6 +15803,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup804 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -14960,6 +15813,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup386 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -14969,6 +15823,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup454 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -14980,8 +15835,9 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup864 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -15033,6 +15889,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup711 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -15042,6 +15899,7 @@ static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup457 = {
 
 static struct _ofixGroupSpec	OrderCancelReplaceRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -15071,6 +15929,8 @@ static struct _ofixMsgSpec	OrderCancelReplaceRequest = {
     "G", // type
     "OrderCancelReplaceRequest", // name
     {0,38,0,0,0,0,0,0,1,2,184,33,158,159,0,152,0,0,51,0,0,50,59,0,0,0,0,0,0,0,0,0,0,0,10,3,0,28,111,0,116,32,0,19,118,0,0,0,58,4,11,0,21,0,108,56,5,13,168,153,109,0,0,46,47,57,36,0,0,0,44,0,0,0,0,31,0,174,45,0,0,0,0,0,0,0,0,0,0,183,8,9,0,182,0,0,0,20,0,119,54,0,0,0,0,0,85,88,0,0,52,53,0,0,177,6,15,0,0,0,166,165,22,0,0,0,156,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,63,154,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,172,171,0,0,0,0,0,0,65,0,79,175,0,0,81,84,0,0,176,134,23,24,0,0,0,0,120,0,121,122,123,83,67,68,70,71,72,30,0,82,0,0,0,128,129,0,0,69,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,86,87,89,90,0,0,169,170,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,150,151,0,0,0,0,0,0,0,0,55,0,140,141,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,117,0,0,0,157,0,0,0,0,155,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,60,0,0,0,0,0,61,62,0,0,0,0,0,0,114,115,75,76,77,0,0,0,0,0,0,160,178,179,0,0,0,0,0,0,0,0,0,0,0,0,181,0,0,161,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,180,0,0,113,0,0,0,0,0,0,0,0,0,34,0,162,163,0,0,0,0,0,0,0,0,0,0,0,66,0,74,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,164,35,0,0,37,0,0,41,42,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,49,0,0,0,0,173,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,124,125,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,0,0,0,0,131,132,133,126,0,130,0,0,0,0,0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,64,0,0,0,0,0,0,0,0,0,0,0,0,167,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,136,137,138,0,139,142,143,144,145,0,146,147,148,149,0,0,0,0,110,0,0,0,0,0,0,0,0,0,95,0,0,0,0,0,0,0,0,96,97,93,94,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,0,0,0,0,0,0,0,0,0,0,0,0,0,0,98,99,100,103,104,101,105,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x11d2030c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd71b6c0064bf02ULL,0x471ccc1a2e01e847ULL,0x000001800103c003ULL,0x80ff98bff43ccd03ULL,0x73fe000000000001ULL,0x03023c0cf8010000ULL,0x8019088000000034ULL,0x0002400381f8fff1ULL,0x00000003ec037812ULL,0x087a0000000fe4e0ULL,0x2f08000008f00001ULL,0x0e00000100000080ULL,0x0000043c00100080ULL,0x03fcfe1f0043df78ULL,0x0008200000fe0004ULL,0x0000000000000000ULL}, // allowed
     OrderCancelReplaceRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -15265,6 +16125,7 @@ static struct _ofixMsgSpec	OrderCancelReplaceRequest = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -15275,6 +16136,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -15286,6 +16148,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup453 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -15295,6 +16158,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup802 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -15304,6 +16168,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup454 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -15315,8 +16180,9 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup864 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -15368,6 +16234,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup711 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -15377,6 +16244,7 @@ static struct _ofixGroupSpec	OrderStatusRequestGroup457 = {
 
 static struct _ofixGroupSpec	OrderStatusRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -15402,6 +16270,8 @@ static struct _ofixMsgSpec	OrderStatusRequest = {
     "H", // type
     "OrderStatusRequest", // name
     {0,34,0,0,0,0,0,0,1,2,91,29,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,10,3,0,28,0,0,0,0,0,19,0,0,0,0,38,4,11,0,21,0,88,36,5,13,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,8,9,0,89,0,0,0,20,0,0,0,0,0,0,0,0,65,68,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,45,0,59,0,0,0,61,64,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,63,47,48,50,51,52,0,0,62,0,0,0,0,0,0,0,49,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,66,67,69,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,40,0,0,0,0,0,41,42,0,0,0,0,0,0,0,0,55,56,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,76,77,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,79,80,83,84,81,85,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d2000c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x03d7082c00400f02ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x80ff809f8030c500ULL,0x73fe000000000001ULL,0x00023c00f8000000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00000000e0004800ULL,0x00780000000f0080ULL,0x0008000008100000ULL,0x0c00000000000080ULL,0x0000040c00500000ULL,0x03fcfe1f00000000ULL,0x0008200000fe0004ULL,0x0000000000000000ULL}, // allowed
     OrderStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -15503,6 +16373,7 @@ static struct _ofixMsgSpec	OrderStatusRequest = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -15513,6 +16384,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup627 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup73 = {
     73, // NoOrders
+    {0x0000006000000800ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0010000000000000ULL,0x0000000180000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, false }, // ClOrdID
 	{ 37, false }, // OrderID
@@ -15529,6 +16401,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup73 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup756 = {
     756, // NoNested2PartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00e0000000000000ULL,0x0000004000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 757, false }, // Nested2PartyID
 	{ 758, false }, // Nested2PartyIDSource
@@ -15540,6 +16413,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup756 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup806 = {
     806, // NoNested2PartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0100000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 760, false }, // Nested2PartySubID
 	{ 807, false }, // Nested2PartySubIDType
@@ -15549,6 +16423,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup806 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup124 = {
     124, // NoExecs
+    {0x00000001a0020000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000008000ULL,0x0000000000000000ULL,0x0000000020000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 32, false }, // LastQty
 	{ 17, false }, // ExecID
@@ -15562,6 +16437,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup124 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -15571,6 +16447,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup454 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -15582,6 +16459,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup864 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -15591,8 +16469,9 @@ static struct _ofixGroupSpec	AllocationInstructionGroup870 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -15644,6 +16523,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup711 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -15653,6 +16533,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup457 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -15662,6 +16543,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup887 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -15711,6 +16593,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup555 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -15720,6 +16603,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup604 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -15731,6 +16615,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup453 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -15740,6 +16625,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup802 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -15749,6 +16635,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup232 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup78 = {
     78, // NoAllocs
+    {0x0000000000003000ULL,0x0180000000238000ULL,0x00001e039e000100ULL,0x0000000000030000ULL,0x0000000000000000ULL,0x0000430000000000ULL,0x0000000000000000ULL,0x0002000080080000ULL,0x2000000008000000ULL,0x0800000000000003ULL,0x0000000000200000ULL,0x0000006300000000ULL,0x0000000000001000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, true }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -15795,6 +16682,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup78 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -15806,6 +16694,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup539 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -15815,6 +16704,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup804 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup136 = {
     136, // NoMiscFees
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000e00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 137, false }, // MiscFeeAmt
 	{ 138, false }, // MiscFeeCurr
@@ -15826,6 +16716,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup136 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup85 = {
     85, // NoDlvyInst
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000082000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 165, false }, // SettlInstSource
 	{ 787, false }, // DlvyInstType
@@ -15836,6 +16727,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup85 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup781 = {
     781, // NoSettlPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000020001c000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 782, false }, // SettlPartyID
 	{ 783, false }, // SettlPartyIDSource
@@ -15847,6 +16739,7 @@ static struct _ofixGroupSpec	AllocationInstructionGroup781 = {
 
 static struct _ofixGroupSpec	AllocationInstructionGroup801 = {
     801, // NoSettlPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000060000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 785, false }, // SettlPartySubID
 	{ 786, false }, // SettlPartySubIDType
@@ -15887,6 +16780,8 @@ static struct _ofixMsgSpec	AllocationInstruction = {
     "J", // type
     "AllocationInstruction", // name
     {0,0,0,0,0,0,108,0,1,2,156,0,0,0,0,118,0,0,0,0,0,0,48,0,0,0,0,0,0,0,103,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,47,4,11,0,21,101,44,45,5,13,132,0,122,0,0,123,124,46,0,0,0,0,28,29,32,39,119,121,0,130,153,0,0,0,0,0,0,0,0,0,0,155,8,9,0,154,0,0,0,20,0,0,0,0,0,0,0,0,74,77,0,0,0,0,0,0,0,6,15,0,129,0,0,0,22,0,40,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,135,136,137,0,0,0,0,0,0,0,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,36,0,0,54,0,68,0,0,0,70,73,0,0,0,0,23,24,0,0,0,0,110,0,111,112,113,72,56,57,59,60,61,104,0,71,144,0,0,145,146,128,127,58,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,62,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0,0,0,0,0,0,25,75,76,78,79,0,0,133,134,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,49,0,0,0,0,0,50,51,0,0,0,0,37,0,0,0,64,65,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,138,55,0,63,0,0,0,0,0,0,0,0,0,0,0,100,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,106,30,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,143,0,0,0,0,0,0,0,0,0,0,0,114,115,0,0,0,81,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,0,0,148,149,150,116,42,147,0,0,0,0,0,0,0,0,0,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,139,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,131,0,0,0,0,0,0,117,53,0,0,0,0,0,0,0,0,0,0,0,0,125,0,0,0,0,0,0,0,0,0,0,0,0,94,0,0,0,0,31,0,0,33,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,0,0,38,0,0,109,0,0,0,84,0,0,0,0,88,89,0,0,85,86,82,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,151,152,0,0,0,0,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,91,92,95,96,93,97,140,141,142,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01f2000c00000740ULL,0x00000000000048c0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0004000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000002000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x97f7086de042bf40ULL,0x15d80c022e23efc7ULL,0x00001ea3fe03cf03ULL,0xffffffbff433c570ULL,0x73fe000000000003ULL,0x20027f0cf8010000ULL,0x8018008000000000ULL,0x0002000081ccfff1ULL,0x64001802fc00f800ULL,0x087fffffffff0003ULL,0x3f08000038e00400ULL,0x1ff4007f00000080ULL,0x000005ff921ff080ULL,0x3bfcffff12400000ULL,0x1808600007fe0004ULL,0x0000000000000000ULL}, // allowed
     AllocationInstructionGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -16053,6 +16948,7 @@ static struct _ofixMsgSpec	AllocationInstruction = {
 
 static struct _ofixGroupSpec	ListCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -16072,6 +16968,8 @@ static struct _ofixMsgSpec	ListCancelRequest = {
     "K", // type
     "ListCancelRequest", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,32,0,29,0,0,0,0,0,28,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022e000804ULL,0x000000000003c003ULL,0x0000002000300000ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -16119,6 +17017,7 @@ static struct _ofixMsgSpec	ListCancelRequest = {
 
 static struct _ofixGroupSpec	ListExecuteGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -16138,6 +17037,8 @@ static struct _ofixMsgSpec	ListExecute = {
     "L", // type
     "ListExecute", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,32,0,31,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022e000004ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x00000000000000c0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListExecuteGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -16185,6 +17086,7 @@ static struct _ofixMsgSpec	ListExecute = {
 
 static struct _ofixGroupSpec	ListStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -16204,6 +17106,8 @@ static struct _ofixMsgSpec	ListStatusRequest = {
     "M", // type
     "ListStatusRequest", // name
     {0,0,0,0,0,0,0,0,1,2,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,29,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,8,9,0,32,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000004ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -16248,6 +17152,7 @@ static struct _ofixMsgSpec	ListStatusRequest = {
 
 static struct _ofixGroupSpec	ListStatusGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -16258,6 +17163,7 @@ static struct _ofixGroupSpec	ListStatusGroup627 = {
 
 static struct _ofixGroupSpec	ListStatusGroup73 = {
     73, // NoOrders
+    {0x0400008000004840ULL,0x0000008000100000ULL,0x0000000000800000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x1000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 11, true }, // ClOrdID
 	{ 526, false }, // SecondaryClOrdID
@@ -16287,6 +17193,8 @@ static struct _ofixMsgSpec	ListStatus = {
     "N", // type
     "ListStatus", // name
     {0,0,0,0,0,0,0,0,1,2,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,36,0,0,0,0,0,28,0,37,0,0,0,0,39,0,0,0,0,0,0,0,0,30,32,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,31,0,0,0,0,0,0,0,0,0,0,0,0,33,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x00000000000c0214ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000a00000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716088c00004f40ULL,0x041800822e1c0214ULL,0x000000000083c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x7000a00000000000ULL,0x0000000000000000ULL,0x0000000000004000ULL,0x1078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x2000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     ListStatusGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -16339,6 +17247,7 @@ static struct _ofixMsgSpec	ListStatus = {
 
 static struct _ofixGroupSpec	AllocationInstructionAckGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -16349,6 +17258,7 @@ static struct _ofixGroupSpec	AllocationInstructionAckGroup627 = {
 
 static struct _ofixGroupSpec	AllocationInstructionAckGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -16360,6 +17270,7 @@ static struct _ofixGroupSpec	AllocationInstructionAckGroup453 = {
 
 static struct _ofixGroupSpec	AllocationInstructionAckGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -16369,6 +17280,7 @@ static struct _ofixGroupSpec	AllocationInstructionAckGroup802 = {
 
 static struct _ofixGroupSpec	AllocationInstructionAckGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000008000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000430000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000000000000ULL,0x0000000000000100ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -16396,6 +17308,8 @@ static struct _ofixMsgSpec	AllocationInstructionAck = {
     "P", // type
     "AllocationInstructionAck", // name
     {0,0,0,0,0,0,0,0,1,2,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,40,0,32,0,0,0,0,0,0,0,0,0,28,0,0,0,0,31,0,0,43,0,0,0,0,0,0,0,0,33,34,45,8,9,0,44,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,41,42,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000800040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1716080c00000700ULL,0x041800022f80c840ULL,0x000000820003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002430c08000000ULL,0x8000000000000000ULL,0x0000000000081031ULL,0x2000000000000800ULL,0x007c000000000000ULL,0x0000000000200000ULL,0x0000000000000000ULL,0x0000010c02000100ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     AllocationInstructionAckGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -16452,6 +17366,7 @@ static struct _ofixMsgSpec	AllocationInstructionAck = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -16462,6 +17377,7 @@ static struct _ofixGroupSpec	DontKnowTradeGroup627 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -16471,6 +17387,7 @@ static struct _ofixGroupSpec	DontKnowTradeGroup454 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -16482,8 +17399,9 @@ static struct _ofixGroupSpec	DontKnowTradeGroup864 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -16535,6 +17453,7 @@ static struct _ofixGroupSpec	DontKnowTradeGroup711 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -16544,6 +17463,7 @@ static struct _ofixGroupSpec	DontKnowTradeGroup457 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -16553,6 +17473,7 @@ static struct _ofixGroupSpec	DontKnowTradeGroup887 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -16602,6 +17523,7 @@ static struct _ofixGroupSpec	DontKnowTradeGroup555 = {
 
 static struct _ofixGroupSpec	DontKnowTradeGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -16627,6 +17549,8 @@ static struct _ofixMsgSpec	DontKnowTrade = {
     "Q", // type
     "DontKnowTrade", // name
     {0,0,0,0,0,0,0,0,1,2,89,0,0,0,0,0,0,30,0,0,0,0,35,0,0,0,0,0,0,0,0,83,82,0,10,3,0,28,77,0,0,0,0,19,0,0,0,0,34,4,11,0,21,0,76,32,5,13,84,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,8,9,0,87,0,0,0,20,0,0,0,0,0,0,0,0,61,64,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,31,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,41,0,55,0,0,0,57,60,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,59,43,44,46,47,48,0,0,58,0,0,0,0,0,0,0,45,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,62,63,65,66,0,0,85,86,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,37,38,0,0,0,0,0,0,80,81,51,52,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,50,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,72,73,69,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x01d2002c00020700ULL,0x8000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x07d7086d80420700ULL,0x84180c022e000002ULL,0x000000800103c003ULL,0xffff809f8030c540ULL,0x73fe000000000003ULL,0x00023c0cf8000000ULL,0x0018000000000000ULL,0x0000000001f0ffc0ULL,0x00001800e0000010ULL,0x0079ffffffff0000ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x0000040000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     DontKnowTradeGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -16726,6 +17650,7 @@ static struct _ofixMsgSpec	DontKnowTrade = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -16736,6 +17661,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup627 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup146 = {
     146, // NoRelatedSym
+    {0xd0c1114000408002ULL,0x40000c0000000003ULL,0x0000008001001000ULL,0x800199bff400c503ULL,0x0000800000000000ULL,0x00000000f0010000ULL,0x0000008000000000ULL,0x0000000001f03060ULL,0x00000800a2000010ULL,0x0002000000000020ULL,0x2f18000008d00001ULL,0x0600000080000080ULL,0x0000000000100000ULL,0x00001e0100400000ULL,0x0008000000fe0004ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -16842,6 +17768,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup146 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -16851,6 +17778,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup454 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -16862,8 +17790,9 @@ static struct _ofixGroupSpec	QuoteRequestGroup864 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -16915,6 +17844,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup711 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -16924,6 +17854,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup457 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -16933,6 +17864,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup887 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -16942,6 +17874,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup232 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100008000000ULL,0x0001ffff9ff01800ULL,0x000489f000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -17002,6 +17935,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup555 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -17011,6 +17945,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup604 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -17020,6 +17955,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup683 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -17031,6 +17967,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup539 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -17040,6 +17977,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup804 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup735 = {
     735, // NoQuoteQualifiers
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0080000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 695, false }, // QuoteQualifier
 	{ 0, false }
@@ -17048,6 +17986,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup735 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -17059,6 +17998,7 @@ static struct _ofixGroupSpec	QuoteRequestGroup453 = {
 
 static struct _ofixGroupSpec	QuoteRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -17092,6 +18032,8 @@ static struct _ofixMsgSpec	QuoteRequest = {
     "R", // type
     "QuoteRequest", // name
     {0,0,0,0,0,0,0,0,1,2,38,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,8,9,0,36,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,28,0,0,0,0,0,0,0,0,0,0,12,14,16,18,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040008ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0xd7d7194c00408f02ULL,0x44180c022e000003ULL,0x000000800107d00bULL,0xffff9fbff430c503ULL,0x73fe800000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001f0fff1ULL,0x00001802ee013810ULL,0x007bffffffff1820ULL,0x2f9f89f008d00011ULL,0x1e00001880000080ULL,0x0000043c00100000ULL,0x03fcfe1f00400000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     QuoteRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -17140,6 +18082,7 @@ static struct _ofixMsgSpec	QuoteRequest = {
 
 static struct _ofixGroupSpec	QuoteGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -17150,6 +18093,7 @@ static struct _ofixGroupSpec	QuoteGroup627 = {
 
 static struct _ofixGroupSpec	QuoteGroup735 = {
     735, // NoQuoteQualifiers
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0080000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 695, false }, // QuoteQualifier
 	{ 0, false }
@@ -17158,6 +18102,7 @@ static struct _ofixGroupSpec	QuoteGroup735 = {
 
 static struct _ofixGroupSpec	QuoteGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -17169,6 +18114,7 @@ static struct _ofixGroupSpec	QuoteGroup453 = {
 
 static struct _ofixGroupSpec	QuoteGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -17178,6 +18124,7 @@ static struct _ofixGroupSpec	QuoteGroup802 = {
 
 static struct _ofixGroupSpec	QuoteGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -17187,6 +18134,7 @@ static struct _ofixGroupSpec	QuoteGroup454 = {
 
 static struct _ofixGroupSpec	QuoteGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -17198,8 +18146,9 @@ static struct _ofixGroupSpec	QuoteGroup864 = {
 
 static struct _ofixGroupSpec	QuoteGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -17251,6 +18200,7 @@ static struct _ofixGroupSpec	QuoteGroup711 = {
 
 static struct _ofixGroupSpec	QuoteGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -17260,6 +18210,7 @@ static struct _ofixGroupSpec	QuoteGroup457 = {
 
 static struct _ofixGroupSpec	QuoteGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -17269,6 +18220,7 @@ static struct _ofixGroupSpec	QuoteGroup887 = {
 
 static struct _ofixGroupSpec	QuoteGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -17278,6 +18230,7 @@ static struct _ofixGroupSpec	QuoteGroup232 = {
 
 static struct _ofixGroupSpec	QuoteGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100008000000ULL,0x0001ffff9ff01800ULL,0x0004dbf000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -17341,6 +18294,7 @@ static struct _ofixGroupSpec	QuoteGroup555 = {
 
 static struct _ofixGroupSpec	QuoteGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -17350,6 +18304,7 @@ static struct _ofixGroupSpec	QuoteGroup604 = {
 
 static struct _ofixGroupSpec	QuoteGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -17359,6 +18314,7 @@ static struct _ofixGroupSpec	QuoteGroup683 = {
 
 static struct _ofixGroupSpec	QuoteGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -17370,6 +18326,7 @@ static struct _ofixGroupSpec	QuoteGroup539 = {
 
 static struct _ofixGroupSpec	QuoteGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -17402,6 +18359,8 @@ static struct _ofixMsgSpec	Quote = {
     "S", // type
     "Quote", // name
     {0,101,0,0,0,0,0,0,1,2,154,0,130,129,0,99,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,90,0,123,0,0,19,0,0,0,0,39,4,11,0,21,0,89,37,5,13,149,0,122,0,113,95,96,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,153,8,9,0,152,0,0,0,20,0,0,132,0,0,0,0,0,66,69,0,0,0,0,0,0,0,6,15,29,0,0,0,0,22,0,0,0,0,0,7,17,0,28,105,106,110,112,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,91,0,0,0,128,0,0,0,0,0,0,0,0,0,0,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,116,115,117,98,97,0,0,0,0,0,0,46,0,60,0,0,0,62,65,0,0,0,0,23,24,0,0,0,0,135,0,136,137,138,64,48,49,51,52,53,0,0,63,100,0,0,143,144,0,0,50,59,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,25,67,68,70,71,0,0,150,151,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,41,0,0,0,0,0,42,43,0,0,0,0,0,0,93,94,56,57,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,133,0,0,0,0,0,0,0,0,31,0,0,0,47,0,55,0,0,0,0,0,0,0,0,0,0,0,104,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,103,131,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,27,0,0,0,118,119,120,121,0,0,0,0,0,0,0,124,125,0,107,108,109,111,0,0,0,0,0,0,0,126,127,0,0,102,0,139,140,0,0,0,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,0,30,0,0,146,147,148,141,0,145,0,0,0,0,0,0,0,0,0,88,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,142,45,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,77,78,74,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,80,81,84,85,82,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,61,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0xd7d7094c0040b702ULL,0x04380c122e000003ULL,0xf00000801103c0fbULL,0xffff9f9ff430c503ULL,0x73fe200000000003ULL,0x00023c0cf8010000ULL,0x8018008000000000ULL,0x0000000001f0fff1ULL,0x00001802ee013810ULL,0x07fbffffffff1860ULL,0x2fafdbf008d301ecULL,0x1e00001880000080ULL,0x0000043c00100000ULL,0x03fcfe1f00000000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     QuoteGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -17566,6 +18525,7 @@ static struct _ofixMsgSpec	Quote = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -17576,6 +18536,7 @@ static struct _ofixGroupSpec	SettlementInstructionsGroup627 = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup778 = {
     778, // NoSettlInst
+    {0x0040000000000000ULL,0x4000000000200000ULL,0x00001f8c00000000ULL,0x0000000000400000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x03801f0010003020ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 162, false }, // SettlInstID
 	{ 163, false }, // SettlInstTransType
@@ -17608,6 +18569,7 @@ static struct _ofixGroupSpec	SettlementInstructionsGroup778 = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -17619,6 +18581,7 @@ static struct _ofixGroupSpec	SettlementInstructionsGroup453 = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -17628,6 +18591,7 @@ static struct _ofixGroupSpec	SettlementInstructionsGroup802 = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup85 = {
     85, // NoDlvyInst
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000082000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 165, false }, // SettlInstSource
 	{ 787, false }, // DlvyInstType
@@ -17638,6 +18602,7 @@ static struct _ofixGroupSpec	SettlementInstructionsGroup85 = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup781 = {
     781, // NoSettlPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000020001c000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 782, false }, // SettlPartyID
 	{ 783, false }, // SettlPartyIDSource
@@ -17649,6 +18614,7 @@ static struct _ofixGroupSpec	SettlementInstructionsGroup781 = {
 
 static struct _ofixGroupSpec	SettlementInstructionsGroup801 = {
     801, // NoSettlPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000060000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 785, false }, // SettlPartySubID
 	{ 786, false }, // SettlPartySubIDType
@@ -17673,6 +18639,8 @@ static struct _ofixMsgSpec	SettlementInstructions = {
     "T", // type
     "SettlementInstructions", // name
     {0,0,0,0,0,0,0,0,1,2,41,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,32,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,8,9,0,39,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,38,0,0,0,0,0,0,0,0,0,0,0,0,29,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000700ULL,0x0000000000000000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000200ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1756080c00000f00ULL,0x441800022e200000ULL,0x00001fad0003c003ULL,0x0000000000700000ULL,0x0000000000000000ULL,0x0002000c08000000ULL,0x8000000000000000ULL,0x03801f0010003031ULL,0x0000000000000800ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000e018fee00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SettlementInstructionsGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -17724,6 +18692,7 @@ static struct _ofixMsgSpec	SettlementInstructions = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -17734,6 +18703,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup627 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup267 = {
     267, // NoMDEntryTypes
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000002000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 269, true }, // MDEntryType
 	{ 0, false }
@@ -17742,6 +18712,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup267 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup146 = {
     146, // NoRelatedSym
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000800a0000000ULL,0x0000000000000000ULL,0x0008000008000000ULL,0x0400000000000080ULL,0x0000000000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -17793,6 +18764,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup146 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -17802,6 +18774,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup454 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -17813,8 +18786,9 @@ static struct _ofixGroupSpec	MarketDataRequestGroup864 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -17866,6 +18840,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup711 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -17875,6 +18850,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup457 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -17884,6 +18860,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup887 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -17933,6 +18910,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup555 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -17942,6 +18920,7 @@ static struct _ofixGroupSpec	MarketDataRequestGroup604 = {
 
 static struct _ofixGroupSpec	MarketDataRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -17970,6 +18949,8 @@ static struct _ofixMsgSpec	MarketDataRequest = {
     "V", // type
     "MarketDataRequest", // name
     {0,0,0,0,0,0,0,0,1,2,43,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,8,9,0,41,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,30,31,32,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x00000000000009c0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400700ULL,0x04180c022e000002ULL,0x000000800007c003ULL,0xffff809f8030c500ULL,0x73fe000040002fc3ULL,0x00023c00f8010000ULL,0x0018000000000004ULL,0x0000000001c0ffc0ULL,0x0000180ce0000000ULL,0x007bffffffff0000ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x0000940000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -18023,6 +19004,7 @@ static struct _ofixMsgSpec	MarketDataRequest = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -18033,6 +19015,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup627 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -18042,6 +19025,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup454 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -18053,8 +19037,9 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup864 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -18106,6 +19091,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup711 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -18115,6 +19101,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup457 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -18124,6 +19111,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup887 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -18173,6 +19161,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup555 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -18182,6 +19171,7 @@ static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup604 = {
 
 static struct _ofixGroupSpec	MarketDataSnapshotFullRefreshGroup268 = {
     268, // NoMDEntries
+    {0x0c00002000048000ULL,0x4000400000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00000807dc3fe000ULL,0x0000000c04010000ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000080000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 269, true }, // MDEntryType
 	{ 270, false }, // MDEntryPx
@@ -18239,6 +19229,8 @@ static struct _ofixMsgSpec	MarketDataSnapshotFullRefresh = {
     "W", // type
     "MarketDataSnapshotFullRefresh", // name
     {0,0,0,0,0,0,0,0,1,2,81,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,31,4,11,0,21,0,0,29,5,13,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,8,9,0,79,0,0,0,20,0,0,0,0,0,0,0,0,58,61,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,52,0,0,0,54,57,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,56,40,41,43,44,45,0,0,55,0,0,0,0,0,0,0,42,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,28,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,59,60,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,33,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,47,0,0,0,0,0,0,0,0,0,0,0,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,77,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,69,70,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000001000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0f97082c00448700ULL,0x44184c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe081fdc3ff043ULL,0x00023c0cfc010000ULL,0x0019000000000000ULL,0x0000000001c0ffc8ULL,0x00001804e0000000ULL,0x007bffffffff0000ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x00006c0000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataSnapshotFullRefreshGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -18330,6 +19322,7 @@ static struct _ofixMsgSpec	MarketDataSnapshotFullRefresh = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -18340,13 +19333,14 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup627 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup268 = {
     268, // NoMDEntries
+    {0x0c81002000448000ULL,0x40004c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000081ffdffe000ULL,0x0000000cf4010000ULL,0x0001000000000000ULL,0x0000000001c03048ULL,0x00000804a0000000ULL,0x0002000000000000ULL,0x0008000008000000ULL,0x0400000000000080ULL,0x0000080000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 279, true }, // MDUpdateAction
 	{ 285, false }, // DeleteReason
 	{ 269, false }, // MDEntryType
 	{ 278, false }, // MDEntryID
 	{ 280, false }, // MDEntryRefID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -18431,6 +19425,7 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup268 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -18440,6 +19435,7 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup454 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -18451,8 +19447,9 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup864 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -18504,6 +19501,7 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup711 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -18513,6 +19511,7 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup457 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -18522,6 +19521,7 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup887 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -18571,6 +19571,7 @@ static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup555 = {
 
 static struct _ofixGroupSpec	MarketDataIncrementalRefreshGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -18597,6 +19598,8 @@ static struct _ofixMsgSpec	MarketDataIncrementalRefresh = {
     "X", // type
     "MarketDataIncrementalRefresh", // name
     {0,0,0,0,0,0,0,0,1,2,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,8,9,0,32,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000001000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0f97082c00448700ULL,0x44184c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe081ffdfff043ULL,0x00023c0cfc010000ULL,0x0019000000000000ULL,0x0000000001c0ffc8ULL,0x00001804e0000000ULL,0x007bffffffff0000ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x00006c0000000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataIncrementalRefreshGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -18641,6 +19644,7 @@ static struct _ofixMsgSpec	MarketDataIncrementalRefresh = {
 
 static struct _ofixGroupSpec	MarketDataRequestRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -18651,6 +19655,7 @@ static struct _ofixGroupSpec	MarketDataRequestRejectGroup627 = {
 
 static struct _ofixGroupSpec	MarketDataRequestRejectGroup816 = {
     816, // NoAltMDSource
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 817, false }, // AltMDSourceID
 	{ 0, false }
@@ -18669,6 +19674,8 @@ static struct _ofixMsgSpec	MarketDataRequestReject = {
     "Y", // type
     "MarketDataRequestReject", // name
     {0,0,0,0,0,0,0,0,1,2,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,8,9,0,34,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,32,33,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000040ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000002000040ULL,0x0002000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     MarketDataRequestRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -18715,6 +19722,7 @@ static struct _ofixMsgSpec	MarketDataRequestReject = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -18725,6 +19733,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup627 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -18736,6 +19745,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup453 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -18745,8 +19755,9 @@ static struct _ofixGroupSpec	QuoteCancelGroup802 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup295 = {
     295, // NoQuoteEntries
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000800a0000000ULL,0x0000000000000000ULL,0x0008000008000000ULL,0x0400000000000080ULL,0x0000000000100000ULL,0x00001e0100000000ULL,0x0008000000fe0004ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -18805,6 +19816,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup295 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -18814,6 +19826,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup454 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -18825,8 +19838,9 @@ static struct _ofixGroupSpec	QuoteCancelGroup864 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -18878,6 +19892,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup711 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -18887,6 +19902,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup457 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -18896,6 +19912,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup887 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -18945,6 +19962,7 @@ static struct _ofixGroupSpec	QuoteCancelGroup555 = {
 
 static struct _ofixGroupSpec	QuoteCancelGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -18973,6 +19991,8 @@ static struct _ofixMsgSpec	QuoteCancel = {
     "Z", // type
     "QuoteCancel", // name
     {0,33,0,0,0,0,0,0,1,2,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,8,9,0,39,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,29,0,0,0,0,22,0,0,0,0,0,7,17,0,28,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,30,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000040000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400702ULL,0x04380c022e000002ULL,0x000000800003c00bULL,0xffff809f8030c500ULL,0x73fe248000000003ULL,0x00023c00f8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00001800e0000800ULL,0x007bffffffff0020ULL,0x0008000008100000ULL,0x1c00001800000080ULL,0x0000040c00100000ULL,0x03fcfe1f00000000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     QuoteCancelGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -19024,6 +20044,7 @@ static struct _ofixMsgSpec	QuoteCancel = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -19034,6 +20055,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -19043,6 +20065,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup454 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -19054,8 +20077,9 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup864 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -19107,6 +20131,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup711 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -19116,6 +20141,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup457 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -19125,6 +20151,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup887 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -19174,6 +20201,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup555 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -19183,6 +20211,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup604 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -19194,6 +20223,7 @@ static struct _ofixGroupSpec	QuoteStatusRequestGroup453 = {
 
 static struct _ofixGroupSpec	QuoteStatusRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -19221,6 +20251,8 @@ static struct _ofixMsgSpec	QuoteStatusRequest = {
     "a", // type
     "QuoteStatusRequest", // name
     {0,84,0,0,0,0,0,0,1,2,92,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,32,4,11,0,21,0,0,30,5,13,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,8,9,0,90,0,0,0,20,0,0,0,0,0,0,0,0,59,62,0,0,0,0,0,0,0,6,15,29,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,53,0,0,0,55,58,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,57,41,42,44,45,46,0,0,56,0,0,0,0,0,0,0,43,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,87,0,0,0,0,0,0,0,0,0,0,25,60,61,63,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,34,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,49,50,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,48,0,0,0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,85,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,70,71,67,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,73,74,77,78,75,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00400702ULL,0x04380c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c00f8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00001800e0000800ULL,0x007bffffffff0020ULL,0x0008000008100200ULL,0x1c00001800000080ULL,0x0000040c00100000ULL,0x03fcfe1f00000000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     QuoteStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -19323,6 +20355,7 @@ static struct _ofixMsgSpec	QuoteStatusRequest = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -19333,6 +20366,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup627 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -19344,6 +20378,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup453 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -19353,9 +20388,10 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup802 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup296 = {
     296, // NoQuoteSets
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73ff408000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x20fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 302, false }, // QuoteSetID
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -19410,6 +20446,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup296 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -19419,6 +20456,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup457 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -19428,9 +20466,10 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup887 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup295 = {
     295, // NoQuoteEntries
+    {0x5081010000408000ULL,0x00000c0000000003ULL,0xf0000080000000f0ULL,0x8001809f8000c503ULL,0x0000080000000000ULL,0x00010000f0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000800a0000000ULL,0x0782000000000000ULL,0x000800000800000cULL,0x0400000000000000ULL,0x0000000000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 299, false }, // QuoteEntryID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -19503,6 +20542,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup295 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -19512,6 +20552,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup454 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -19523,6 +20564,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup864 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -19572,6 +20614,7 @@ static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup555 = {
 
 static struct _ofixGroupSpec	MassQuoteAcknowledgementGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -19600,6 +20643,8 @@ static struct _ofixMsgSpec	MassQuoteAcknowledgement = {
     "b", // type
     "MassQuoteAcknowledgement", // name
     {0,35,0,0,0,0,0,0,1,2,44,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,8,9,0,42,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,29,0,0,0,0,22,0,0,0,0,0,7,17,0,28,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,30,0,0,31,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,39,40,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000020000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x5797090c00408702ULL,0x04380c022e000003ULL,0xf00000800003c0fbULL,0xffff809f8030c503ULL,0x73ff7b8000000003ULL,0x00033c0cf8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00001800e2000800ULL,0x07fbffffffff0020ULL,0x000800000810000cULL,0x1c00001800000000ULL,0x0000040c00000000ULL,0x23fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     MassQuoteAcknowledgementGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -19654,6 +20699,7 @@ static struct _ofixMsgSpec	MassQuoteAcknowledgement = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -19664,6 +20710,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup627 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -19673,6 +20720,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup454 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -19684,6 +20732,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup864 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -19693,8 +20742,9 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup870 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -19746,6 +20796,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup711 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -19755,6 +20806,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup457 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -19764,6 +20816,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup887 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -19813,6 +20866,7 @@ static struct _ofixGroupSpec	SecurityDefinitionRequestGroup555 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -19839,6 +20893,8 @@ static struct _ofixMsgSpec	SecurityDefinitionRequest = {
     "c", // type
     "SecurityDefinitionRequest", // name
     {0,0,0,0,0,0,0,0,1,2,87,0,0,0,0,76,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,32,4,11,0,21,0,0,30,5,13,77,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,8,9,0,85,0,0,0,20,0,0,0,0,0,0,0,0,59,62,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,53,0,0,0,55,58,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,57,41,42,44,45,46,0,0,56,0,0,0,0,0,0,0,43,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,0,0,0,0,0,0,0,0,0,0,25,60,61,63,64,0,0,78,79,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,49,50,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,48,0,0,0,0,0,0,0,0,0,0,0,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,73,74,0,0,70,71,67,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000003ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c0cf8010003ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00001800e0000000ULL,0x007bffffffff0000ULL,0x0008000018000000ULL,0x1c00001800000080ULL,0x0800040000000000ULL,0x03fcffff00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityDefinitionRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -19870,7 +20926,7 @@ static struct _ofixMsgSpec	SecurityDefinitionRequest = {
 	{ 627, false }, // NoHops
 	{ 320, true }, // SecurityReqID
 	{ 321, true }, // SecurityRequestType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -19936,6 +20992,7 @@ static struct _ofixMsgSpec	SecurityDefinitionRequest = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -19946,6 +21003,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup627 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -19955,6 +21013,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup454 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -19966,6 +21025,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup864 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -19975,8 +21035,9 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup870 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -20028,6 +21089,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup711 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -20037,6 +21099,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup457 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -20046,6 +21109,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup887 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -20095,6 +21159,7 @@ static struct _ofixGroupSpec	SecurityDefinitionGroup555 = {
 
 static struct _ofixGroupSpec	SecurityDefinitionGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -20121,6 +21186,8 @@ static struct _ofixMsgSpec	SecurityDefinition = {
     "d", // type
     "SecurityDefinition", // name
     {0,0,0,0,0,0,0,0,1,2,89,0,0,0,0,77,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,33,4,11,0,21,0,0,31,5,13,80,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,88,8,9,0,87,0,0,0,20,0,0,0,0,0,0,0,0,60,63,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,54,0,0,0,56,59,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,58,42,43,45,46,47,0,0,57,0,0,0,0,0,0,0,44,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,29,30,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,25,61,62,64,65,0,0,81,82,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,36,37,0,0,0,0,0,0,0,0,50,51,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,49,0,0,0,0,0,0,0,0,0,0,0,83,0,0,0,0,0,85,86,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,73,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,74,75,0,0,71,72,68,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000dULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000003ULL,0x00023c0cf801000dULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00061800e0000000ULL,0x007bffffffff0000ULL,0x0008000018000000ULL,0x1c00001800000080ULL,0x0800040000000000ULL,0x03fcffff00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityDefinitionGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -20153,7 +21220,7 @@ static struct _ofixMsgSpec	SecurityDefinition = {
 	{ 320, true }, // SecurityReqID
 	{ 322, true }, // SecurityResponseID
 	{ 323, true }, // SecurityResponseType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -20220,6 +21287,7 @@ static struct _ofixMsgSpec	SecurityDefinition = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -20230,6 +21298,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup627 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -20239,6 +21308,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup454 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -20250,6 +21320,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup864 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -20259,8 +21330,9 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup870 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -20312,6 +21384,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup711 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -20321,6 +21394,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup457 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -20330,6 +21404,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup887 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -20379,6 +21454,7 @@ static struct _ofixGroupSpec	SecurityStatusRequestGroup555 = {
 
 static struct _ofixGroupSpec	SecurityStatusRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -20405,6 +21481,8 @@ static struct _ofixMsgSpec	SecurityStatusRequest = {
     "e", // type
     "SecurityStatusRequest", // name
     {0,0,0,0,0,0,0,0,1,2,82,0,0,0,0,76,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,31,4,11,0,21,0,0,29,5,13,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,8,9,0,80,0,0,0,20,0,0,0,0,0,0,0,0,58,61,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,52,0,0,0,54,57,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,56,40,41,43,44,45,0,0,55,0,0,0,0,0,0,0,42,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,0,0,25,59,60,62,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,47,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,72,73,0,0,69,70,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000080ULL,0x0000000000000010ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0397080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c00f8010010ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00001800e0000000ULL,0x007bffffffff0000ULL,0x0008000018000000ULL,0x1c00001800000080ULL,0x0000040000000000ULL,0x03fcffff00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -20497,6 +21575,7 @@ static struct _ofixMsgSpec	SecurityStatusRequest = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -20507,6 +21586,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup627 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -20516,6 +21596,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup454 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -20527,6 +21608,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup864 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -20536,8 +21618,9 @@ static struct _ofixGroupSpec	SecurityStatusGroup870 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -20589,6 +21672,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup711 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -20598,6 +21682,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup457 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -20607,6 +21692,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup887 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -20656,6 +21742,7 @@ static struct _ofixGroupSpec	SecurityStatusGroup555 = {
 
 static struct _ofixGroupSpec	SecurityStatusGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -20682,6 +21769,8 @@ static struct _ofixMsgSpec	SecurityStatus = {
     "f", // type
     "SecurityStatus", // name
     {0,0,0,0,0,0,0,0,1,2,98,0,0,0,0,76,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,90,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,31,4,11,0,21,0,0,29,5,13,93,0,91,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,8,9,0,96,0,0,0,20,0,0,0,0,0,0,0,0,58,61,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,52,0,0,0,54,57,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,56,40,41,43,44,45,0,0,55,0,0,0,0,0,0,0,42,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,79,80,83,84,85,86,87,88,89,92,0,77,0,0,0,0,0,0,0,0,0,0,25,59,60,62,63,0,0,94,95,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,34,35,0,0,0,0,0,0,0,0,48,49,50,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,47,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,71,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,64,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,72,73,0,0,69,70,66,67,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x1797080c80408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe001800000003ULL,0x00023c0cf8017ff0ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00001800e0000000ULL,0x007bffffffff0000ULL,0x0008000018000000ULL,0x1c00001800000080ULL,0x0000040000000000ULL,0x03fcffff00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityStatusGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -20790,6 +21879,7 @@ static struct _ofixMsgSpec	SecurityStatus = {
 
 static struct _ofixGroupSpec	TradingSessionStatusRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -20809,6 +21899,8 @@ static struct _ofixMsgSpec	TradingSessionStatusRequest = {
     "g", // type
     "TradingSessionStatusRequest", // name
     {0,0,0,0,0,0,0,0,1,2,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,8,9,0,34,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,31,32,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000080ULL,0x0000000000008000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000080ULL,0x00020000080d8000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TradingSessionStatusRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -20855,6 +21947,7 @@ static struct _ofixMsgSpec	TradingSessionStatusRequest = {
 
 static struct _ofixGroupSpec	TradingSessionStatusGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -20874,6 +21967,8 @@ static struct _ofixMsgSpec	TradingSessionStatus = {
     "h", // type
     "TradingSessionStatus", // name
     {0,0,0,0,0,0,0,0,1,2,47,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,8,9,0,45,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,28,29,0,31,32,34,36,37,38,39,40,0,25,0,0,0,0,0,0,43,44,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000110000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c0bfd8020ULL,0x0000000000000008ULL,0x0000000000000000ULL,0x0080000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     TradingSessionStatusGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -20931,6 +22026,7 @@ static struct _ofixMsgSpec	TradingSessionStatus = {
 
 static struct _ofixGroupSpec	MassQuoteGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -20941,6 +22037,7 @@ static struct _ofixGroupSpec	MassQuoteGroup627 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -20952,6 +22049,7 @@ static struct _ofixGroupSpec	MassQuoteGroup453 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -20961,9 +22059,10 @@ static struct _ofixGroupSpec	MassQuoteGroup802 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup296 = {
     296, // NoQuoteSets
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73ff408000000001ULL,0x0000bc0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x20fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 302, true }, // QuoteSetID
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -21019,6 +22118,7 @@ static struct _ofixGroupSpec	MassQuoteGroup296 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -21028,6 +22128,7 @@ static struct _ofixGroupSpec	MassQuoteGroup457 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -21037,9 +22138,10 @@ static struct _ofixGroupSpec	MassQuoteGroup887 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup295 = {
     295, // NoQuoteEntries
+    {0x5081010000408000ULL,0x00000c0000000003ULL,0xf0000080000000f0ULL,0x8001809f8000c503ULL,0x0000080000000000ULL,0x00000000f0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000800a0000000ULL,0x0782000000000000ULL,0x000800000800000cULL,0x0400000000000000ULL,0x0000000000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 299, true }, // QuoteEntryID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -21111,6 +22213,7 @@ static struct _ofixGroupSpec	MassQuoteGroup295 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -21120,6 +22223,7 @@ static struct _ofixGroupSpec	MassQuoteGroup454 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -21131,6 +22235,7 @@ static struct _ofixGroupSpec	MassQuoteGroup864 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -21180,6 +22285,7 @@ static struct _ofixGroupSpec	MassQuoteGroup555 = {
 
 static struct _ofixGroupSpec	MassQuoteGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -21208,6 +22314,8 @@ static struct _ofixMsgSpec	MassQuote = {
     "i", // type
     "MassQuote", // name
     {0,33,0,0,0,0,0,0,1,2,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,8,9,0,39,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,29,0,0,0,0,22,0,0,0,0,0,7,17,0,28,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,37,0,38,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0020000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000010000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x5397090c00408702ULL,0x04380c022e000003ULL,0xf00000800003c0fbULL,0xffff809f8030c503ULL,0x73ff69e000000003ULL,0x0002bc00f8010000ULL,0x8018000000000000ULL,0x0000000001c0fff1ULL,0x00001800e2000800ULL,0x07fbffffffff0020ULL,0x000800000810000cULL,0x1c00001800000000ULL,0x0000040c00000000ULL,0x23fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     MassQuoteGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -21259,6 +22367,7 @@ static struct _ofixMsgSpec	MassQuote = {
 
 static struct _ofixGroupSpec	BusinessMessageRejectGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -21278,6 +22387,8 @@ static struct _ofixMsgSpec	BusinessMessageReject = {
     "j", // type
     "BusinessMessageReject", // name
     {0,0,0,0,0,0,0,0,1,2,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,28,0,0,0,4,11,0,21,0,0,0,5,13,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,8,9,0,35,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,33,34,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,29,0,0,0,0,0,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1010000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716280c00000700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x1812000c08000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0078000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     BusinessMessageRejectGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -21325,6 +22436,7 @@ static struct _ofixMsgSpec	BusinessMessageReject = {
 
 static struct _ofixGroupSpec	BidRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -21335,6 +22447,7 @@ static struct _ofixGroupSpec	BidRequestGroup627 = {
 
 static struct _ofixGroupSpec	BidRequestGroup398 = {
     398, // NoBidDescriptors
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0200000001ff8000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 399, false }, // BidDescriptorType
 	{ 400, false }, // BidDescriptor
@@ -21353,6 +22466,7 @@ static struct _ofixGroupSpec	BidRequestGroup398 = {
 
 static struct _ofixGroupSpec	BidRequestGroup420 = {
     420, // NoBidComponents
+    {0x8040000000000002ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000400000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000100000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 66, false }, // ListID
 	{ 54, false }, // Side
@@ -21380,6 +22494,8 @@ static struct _ofixMsgSpec	BidRequest = {
     "k", // type
     "BidRequest", // name
     {0,0,0,0,0,0,0,0,1,2,59,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,50,0,0,0,0,0,0,0,0,0,0,0,0,0,58,8,9,0,57,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,48,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,55,56,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,31,32,33,34,36,37,38,0,0,0,0,0,0,0,0,0,0,40,41,42,43,44,45,46,47,49,51,52,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,53,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0040000000000000ULL,0x0000000c00000680ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x8756080c00008702ULL,0x061800022e000805ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0042000c08010000ULL,0x0a00401fffffffc0ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000100000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     BidRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -21449,6 +22565,7 @@ static struct _ofixMsgSpec	BidRequest = {
 
 static struct _ofixGroupSpec	BidResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -21459,6 +22576,7 @@ static struct _ofixGroupSpec	BidResponseGroup627 = {
 
 static struct _ofixGroupSpec	BidResponseGroup420 = {
     420, // NoBidComponents
+    {0x8440100000003000ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000c00010000ULL,0x000040a000400000ULL,0x0002000080000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 12, false }, // Commission
 	{ 13, false }, // CommType
@@ -21494,6 +22612,8 @@ static struct _ofixMsgSpec	BidResponse = {
     "l", // type
     "BidResponse", // name
     {0,0,0,0,0,0,0,0,1,2,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,8,9,0,31,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x8756180c00003700ULL,0x041800022e000005ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c08010000ULL,0x000040b0004000c0ULL,0x0002000080000000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     BidResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -21537,6 +22657,7 @@ static struct _ofixMsgSpec	BidResponse = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -21547,6 +22668,7 @@ static struct _ofixGroupSpec	ListStrikePriceGroup627 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup428 = {
     428, // NoStrikes
+    {0x0081000000400000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001809f8000c500ULL,0x0000000000000000ULL,0x00000000f0000000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00000000a0000000ULL,0x0000000000000000ULL,0x0008000008000000ULL,0x0400000000000000ULL,0x0000000000000000ULL,0x00001e0100000000ULL,0x0008000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 55, true }, // Symbol
 	{ 65, false }, // SymbolSfx
@@ -21596,6 +22718,7 @@ static struct _ofixGroupSpec	ListStrikePriceGroup428 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -21605,6 +22728,7 @@ static struct _ofixGroupSpec	ListStrikePriceGroup454 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -21616,8 +22740,9 @@ static struct _ofixGroupSpec	ListStrikePriceGroup864 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup711 = {
     711, // NoUnderlyings
+    {0x0440100000008800ULL,0x0000000000000000ULL,0x0000000000001000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0c00000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040004000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -21678,6 +22803,7 @@ static struct _ofixGroupSpec	ListStrikePriceGroup711 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -21687,6 +22813,7 @@ static struct _ofixGroupSpec	ListStrikePriceGroup457 = {
 
 static struct _ofixGroupSpec	ListStrikePriceGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -21711,6 +22838,8 @@ static struct _ofixMsgSpec	ListStrikePrice = {
     "m", // type
     "ListStrikePrice", // name
     {0,0,0,0,0,0,0,0,1,2,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,8,9,0,33,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000004ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000104000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x07d7180c00408f00ULL,0x04180c022e000006ULL,0x000000800003d003ULL,0x80ff809f8030c500ULL,0x73fe000000000001ULL,0x00023c0cf8000000ULL,0x0018104000000000ULL,0x0000000001c0ffc0ULL,0x00000000e0004000ULL,0x00780000000f0000ULL,0x0008000008000000ULL,0x0c00000000000080ULL,0x0000040000000000ULL,0x23fcfe1f00000000ULL,0x0008200000000000ULL,0x0000000000000000ULL}, // allowed
     ListStrikePriceGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -21756,6 +22885,7 @@ static struct _ofixMsgSpec	ListStrikePrice = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -21766,6 +22896,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup627 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -21777,6 +22908,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup453 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -21786,6 +22918,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup802 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup473 = {
     473, // NoRegistDtls
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0xa00000440c000000ULL,0x0000000008000400ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 509, false }, // RegistDtls
 	{ 511, false }, // RegistEmail
@@ -21801,6 +22934,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup473 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -21812,6 +22946,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup539 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -21821,6 +22956,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsGroup804 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsGroup510 = {
     510, // NoDistribInsts
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x007c000060000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 477, false }, // DistribPaymentMethod
 	{ 512, false }, // DistribPercentage
@@ -21851,6 +22987,8 @@ static struct _ofixMsgSpec	RegistrationInstructions = {
     "o", // type
     "RegistrationInstructions", // name
     {0,33,0,0,0,0,0,0,1,2,42,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,36,0,0,0,0,0,0,0,0,0,0,0,0,30,0,39,0,0,28,29,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1000000000000000ULL,0x0000000000000006ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000f02ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x8000000000000000ULL,0xf07ca0446e000031ULL,0x000000020c003c27ULL,0x0078000000000000ULL,0x0000000000100000ULL,0x0000000000000000ULL,0x0000003c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     RegistrationInstructionsGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -21903,6 +23041,7 @@ static struct _ofixMsgSpec	RegistrationInstructions = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -21913,6 +23052,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup627 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -21924,6 +23064,7 @@ static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup453 = {
 
 static struct _ofixGroupSpec	RegistrationInstructionsResponseGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -21944,6 +23085,8 @@ static struct _ofixMsgSpec	RegistrationInstructionsResponse = {
     "p", // type
     "RegistrationInstructionsResponse", // name
     {0,33,0,0,0,0,0,0,1,2,40,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,8,9,0,38,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,35,36,30,0,0,0,0,28,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1400000000000000ULL,0x0000000000000006ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0316080c00000f02ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000008000000ULL,0x8000000000000000ULL,0x1c01000000000031ULL,0x0000000000000806ULL,0x0078000000000000ULL,0x0000000000100000ULL,0x0000000000000000ULL,0x0000000c00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     RegistrationInstructionsResponseGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -21994,6 +23137,7 @@ static struct _ofixMsgSpec	RegistrationInstructionsResponse = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -22004,6 +23148,7 @@ static struct _ofixGroupSpec	OrderMassCancelRequestGroup627 = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -22013,6 +23158,7 @@ static struct _ofixGroupSpec	OrderMassCancelRequestGroup454 = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -22024,6 +23170,7 @@ static struct _ofixGroupSpec	OrderMassCancelRequestGroup864 = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -22033,6 +23180,7 @@ static struct _ofixGroupSpec	OrderMassCancelRequestGroup457 = {
 
 static struct _ofixGroupSpec	OrderMassCancelRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -22055,6 +23203,8 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
     "q", // type
     "OrderMassCancelRequest", // name
     {0,0,0,0,0,0,0,0,1,2,128,28,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,35,4,11,0,21,0,121,33,5,13,123,0,122,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,127,8,9,0,126,0,0,0,20,0,0,0,0,0,0,0,0,62,65,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,56,0,0,0,58,61,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,60,44,45,47,48,49,0,0,59,0,0,0,0,0,0,0,46,55,86,87,88,89,90,91,97,0,0,0,0,0,0,0,50,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,104,107,103,77,82,75,76,84,0,0,98,100,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,25,63,64,66,67,0,0,124,125,0,0,0,0,0,0,105,106,108,109,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,101,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,79,0,0,38,39,80,81,0,0,0,0,0,0,52,53,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,30,0,0,0,0,0,0,0,0,0,0,43,85,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,95,96,93,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,72,0,0,0,0,0,0,0,0,73,74,70,71,110,111,113,0,0,115,116,117,118,119,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,0,0,0,0,0,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1112000c00000f00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000040000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d7080c00400f00ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x80ff809f8030c500ULL,0x73fe000000000001ULL,0x00023c0cf8010000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00000000e0044000ULL,0x007a0000000f0000ULL,0x0008000008000000ULL,0x0c00000000000000ULL,0x0000040000000000ULL,0x03fcfe1f00000000ULL,0x0008200000000000ULL,0x0000000000000000ULL}, // allowed
     OrderMassCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -22089,7 +23239,7 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
 	{ 530, true }, // MassCancelRequestType
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -22131,7 +23281,7 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
 	{ 864, false }, // NoEvents
 	{ 873, false }, // DatedDate
 	{ 874, false }, // InterestAccrualDate
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -22193,6 +23343,7 @@ static struct _ofixMsgSpec	OrderMassCancelRequest = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -22203,6 +23354,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup627 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup534 = {
     534, // NoAffectedOrders
+    {0x0000020000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000001800000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 41, false }, // OrigClOrdID
 	{ 535, false }, // AffectedOrderID
@@ -22213,6 +23365,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup534 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -22222,6 +23375,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup454 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -22233,6 +23387,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup864 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -22242,6 +23397,7 @@ static struct _ofixGroupSpec	OrderMassCancelReportGroup457 = {
 
 static struct _ofixGroupSpec	OrderMassCancelReportGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -22265,6 +23421,8 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
     "r", // type
     "OrderMassCancelReport", // name
     {0,0,0,0,0,0,0,0,1,2,134,28,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,10,3,0,30,0,0,0,0,0,19,0,0,0,0,41,4,11,0,21,0,127,39,5,13,129,0,128,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,133,8,9,0,132,0,0,0,20,0,0,0,0,0,0,0,0,68,71,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,46,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,48,0,62,0,0,0,64,67,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,66,50,51,53,54,55,0,0,65,0,0,0,0,0,0,0,52,61,92,93,94,95,96,97,103,0,0,0,0,0,0,0,56,98,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,110,113,109,83,88,81,82,90,0,0,104,106,118,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,25,69,70,72,73,0,0,130,131,0,0,0,0,0,0,111,112,114,115,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,108,107,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,0,85,0,0,44,45,86,87,0,0,0,0,0,0,58,59,60,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,32,33,34,35,36,0,0,0,0,0,0,49,91,57,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,101,102,99,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,89,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,78,0,0,0,0,0,0,0,0,79,80,76,77,116,117,119,0,0,121,122,123,124,125,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,105,0,0,0,0,0,63,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112002c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00000000000c0000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d70a2c00400f00ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0x80ff809f8030c540ULL,0x73fe000000000001ULL,0x00023c0cf8010000ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00000000e1fc4000ULL,0x007a0000000f0000ULL,0x0008000008000000ULL,0x0c00000000000000ULL,0x0000040000000000ULL,0x03fcfe1f00000000ULL,0x0008200000000000ULL,0x0000000000000000ULL}, // allowed
     OrderMassCancelReportGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -22305,7 +23463,7 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
 	{ 534, false }, // NoAffectedOrders
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -22347,7 +23505,7 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
 	{ 864, false }, // NoEvents
 	{ 873, false }, // DatedDate
 	{ 874, false }, // InterestAccrualDate
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -22409,6 +23567,7 @@ static struct _ofixMsgSpec	OrderMassCancelReport = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -22419,6 +23578,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup627 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup552 = {
     552, // NoSides
+    {0x0440004000003802ULL,0x0300000000006840ULL,0x0000000001000000ULL,0x0000002000000800ULL,0x0000000000000000ULL,0x0200000c00000000ULL,0x0000000000000000ULL,0x0002000080300020ULL,0x0000000100034010ULL,0x080000000000e0e0ULL,0x0000000000180000ULL,0x0000000000000000ULL,0x0000000000000080ULL,0x0000000000400000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 11, true }, // ClOrdID
@@ -22466,6 +23626,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup552 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -22477,6 +23638,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup453 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -22486,6 +23648,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup802 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -22499,6 +23662,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup78 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -22510,6 +23674,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup539 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -22519,6 +23684,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup804 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -22528,6 +23694,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup454 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -22539,8 +23706,9 @@ static struct _ofixGroupSpec	NewOrderCrossGroup864 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -22592,6 +23760,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup711 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -22601,6 +23770,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup457 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -22610,6 +23780,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup887 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -22659,6 +23830,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup555 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -22668,6 +23840,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup604 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -22677,6 +23850,7 @@ static struct _ofixGroupSpec	NewOrderCrossGroup386 = {
 
 static struct _ofixGroupSpec	NewOrderCrossGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -22710,6 +23884,8 @@ static struct _ofixMsgSpec	NewOrderCross = {
     "s", // type
     "NewOrderCross", // name
     {0,0,0,0,0,0,0,0,1,2,139,0,0,0,0,107,0,0,79,0,0,78,35,109,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,89,0,0,19,91,0,0,0,34,4,11,0,21,0,0,32,5,13,0,111,87,0,0,76,77,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,138,8,9,0,137,0,0,0,20,0,92,82,0,0,0,0,0,61,64,0,0,80,81,0,0,86,6,15,110,0,0,0,0,22,0,0,0,114,0,7,17,0,0,0,0,0,0,0,0,0,0,85,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,112,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,55,0,0,0,57,60,0,0,116,117,23,24,0,0,0,0,93,0,94,95,96,59,43,44,46,47,48,0,0,58,88,0,0,101,102,0,0,45,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,62,63,65,66,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,108,0,0,0,0,0,0,0,0,0,83,0,123,124,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,115,0,0,0,0,113,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,37,38,0,0,0,0,0,0,0,0,51,52,53,0,0,0,0,0,0,0,133,134,0,0,0,0,0,0,0,0,0,0,0,0,136,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,135,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,50,0,0,0,0,28,29,30,0,31,0,0,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,97,98,0,0,0,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,67,0,0,0,0,104,105,106,99,0,103,0,0,0,0,0,0,0,0,0,74,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,100,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,118,119,120,121,0,122,125,126,127,128,0,129,130,131,132,0,0,0,0,0,0,0,0,0,0,0,0,0,0,71,0,0,0,0,0,0,0,0,72,73,69,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192010c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000017000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd7194c00e4bf02ULL,0x473ccc1a2e03e843ULL,0x000001800103d003ULL,0xffff9fbff43ccd00ULL,0x73fe000000000003ULL,0x03023c0cf8010000ULL,0x8019088000000034ULL,0x0002400381f8fff1ULL,0x00001973ec037812ULL,0x087bffffffffe0e0ULL,0x2f08000008f80000ULL,0x1e00001900000080ULL,0x0000043c00000080ULL,0x03fcfe1f0043df78ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     NewOrderCrossGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -22859,6 +24035,7 @@ static struct _ofixMsgSpec	NewOrderCross = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -22869,6 +24046,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup627 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup552 = {
     552, // NoSides
+    {0x0440024000003802ULL,0x0300000000006840ULL,0x0000000001000000ULL,0x0000002000000800ULL,0x0000000000000000ULL,0x0200000c00000000ULL,0x0000000000000000ULL,0x0002000080300020ULL,0x0000000100034010ULL,0x080000000000e4e0ULL,0x0000000000180000ULL,0x0000000000000000ULL,0x0000000000000080ULL,0x0000000000400000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 41, true }, // OrigClOrdID
@@ -22918,6 +24096,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup552 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -22929,6 +24108,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup453 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -22938,6 +24118,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup802 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup78 = {
     78, // NoAllocs
+    {0x0000000000000000ULL,0x0000000000018000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000080000ULL,0x0000000008000000ULL,0x0000000000000000ULL,0x0000000000200000ULL,0x0000000100000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 79, false }, // AllocAccount
 	{ 661, false }, // AllocAcctIDSource
@@ -22951,6 +24132,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup78 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup539 = {
     539, // NoNestedPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000004003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 524, false }, // NestedPartyID
 	{ 525, false }, // NestedPartyIDSource
@@ -22962,6 +24144,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup539 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup804 = {
     804, // NoNestedPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000200000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 545, false }, // NestedPartySubID
 	{ 805, false }, // NestedPartySubIDType
@@ -22971,6 +24154,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup804 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -22980,6 +24164,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup454 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -22991,8 +24176,9 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup864 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -23044,6 +24230,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup711 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -23053,6 +24240,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup457 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -23062,6 +24250,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup887 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -23111,6 +24300,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup555 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -23120,6 +24310,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup604 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup386 = {
     386, // NoTradingSessions
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000010000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0002000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 336, false }, // TradingSessionID
 	{ 625, false }, // TradingSessionSubID
@@ -23129,6 +24320,7 @@ static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup386 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelReplaceRequestGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -23162,6 +24354,8 @@ static struct _ofixMsgSpec	CrossOrderCancelReplaceRequest = {
     "t", // type
     "CrossOrderCancelReplaceRequest", // name
     {0,0,0,0,0,0,0,0,1,2,141,0,0,0,0,109,0,0,81,0,0,80,37,111,0,0,0,0,0,0,0,0,0,0,10,3,0,28,0,0,91,0,0,19,93,0,0,0,36,4,11,0,21,0,0,34,5,13,0,113,89,0,0,78,79,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,86,0,0,0,0,0,0,0,140,8,9,0,139,0,0,0,20,0,94,84,0,0,0,0,0,63,66,0,0,82,83,0,0,88,6,15,112,0,0,0,0,22,0,0,0,116,0,7,17,0,0,0,0,0,0,0,0,0,0,87,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,114,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,59,62,0,0,118,119,23,24,0,0,0,0,95,0,96,97,98,61,45,46,48,49,50,0,0,60,90,0,0,103,104,0,0,47,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,64,65,67,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,110,0,0,0,0,0,0,0,0,0,85,0,125,126,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,92,0,0,0,117,0,0,0,0,115,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,39,40,0,0,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,135,136,0,0,0,0,0,0,0,0,0,0,0,0,138,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,137,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,52,0,0,0,0,29,31,32,30,33,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,99,100,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,106,107,108,101,0,105,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,102,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,120,121,122,123,0,124,127,128,129,130,0,131,132,133,134,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,74,75,71,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192010c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000001f000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x9fd71b6c00e4bf02ULL,0x473ccc1a2e03e843ULL,0x000001800103d003ULL,0xffff9fbff43ccd00ULL,0x73fe000000000003ULL,0x03023c0cf8010000ULL,0x8019088000000034ULL,0x0002400381f8fff1ULL,0x000019f3ec037812ULL,0x087bffffffffe4e0ULL,0x2f08000008f80000ULL,0x1e00001900000080ULL,0x0000043c00000080ULL,0x03fcfe1f0043df78ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     CrossOrderCancelReplaceRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -23313,6 +24507,7 @@ static struct _ofixMsgSpec	CrossOrderCancelReplaceRequest = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -23323,6 +24518,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup627 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup552 = {
     552, // NoSides
+    {0x0440024000000800ULL,0x0000000000000800ULL,0x0000000001000000ULL,0x0000002000000000ULL,0x0000000000000000ULL,0x0100000c00000000ULL,0x0000000000000000ULL,0x0000000000300020ULL,0x0000000000004010ULL,0x0000000000000480ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 54, true }, // Side
 	{ 41, true }, // OrigClOrdID
@@ -23348,6 +24544,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup552 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup453 = {
     453, // NoPartyIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x8000000000000000ULL,0x0000000000000011ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000400000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 448, false }, // PartyID
 	{ 447, false }, // PartyIDSource
@@ -23359,6 +24556,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup453 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup802 = {
     802, // NoPartySubIDs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000800ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 523, false }, // PartySubID
 	{ 803, false }, // PartySubIDType
@@ -23368,6 +24566,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup802 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -23377,6 +24576,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup454 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -23388,8 +24588,9 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup864 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -23441,6 +24642,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup711 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -23450,6 +24652,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup457 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -23459,6 +24662,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup887 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -23508,6 +24712,7 @@ static struct _ofixGroupSpec	CrossOrderCancelRequestGroup555 = {
 
 static struct _ofixGroupSpec	CrossOrderCancelRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -23536,6 +24741,8 @@ static struct _ofixMsgSpec	CrossOrderCancelRequest = {
     "u", // type
     "CrossOrderCancelRequest", // name
     {0,0,0,0,0,0,0,0,1,2,81,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,10,3,0,28,0,0,0,0,0,19,0,0,0,0,36,4,11,0,21,0,0,34,5,13,0,0,78,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,80,8,9,0,79,0,0,0,20,0,0,0,0,0,0,0,0,63,66,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,43,0,57,0,0,0,59,62,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,61,45,46,48,49,50,0,0,60,0,0,0,0,0,0,0,47,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,64,65,67,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,39,40,0,0,0,0,0,0,0,0,53,54,55,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,44,0,52,0,0,0,0,29,31,32,30,33,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,70,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,73,0,0,0,0,0,0,0,0,74,75,71,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,58,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x1192000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000001f000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x17d70a6c00400f00ULL,0x04180c022e000802ULL,0x000000800103c003ULL,0xffff80bf8030c500ULL,0x73fe000000000003ULL,0x01023c0cf8000000ULL,0x8018000000000000ULL,0x0000000001f0fff1ULL,0x000019f0e0004810ULL,0x0079ffffffff0480ULL,0x0008000008000000ULL,0x1c00001800000080ULL,0x0000040c00000000ULL,0x03fcfe1f00000000ULL,0x1808600000000000ULL,0x0000000000000000ULL}, // allowed
     CrossOrderCancelRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -23627,6 +24834,7 @@ static struct _ofixMsgSpec	CrossOrderCancelRequest = {
 
 static struct _ofixGroupSpec	SecurityTypeRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -23646,6 +24854,8 @@ static struct _ofixMsgSpec	SecurityTypeRequest = {
     "v", // type
     "SecurityTypeRequest", // name
     {0,0,0,0,0,0,0,0,1,2,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,8,9,0,37,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,30,31,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000800003c003ULL,0x0000000000300000ULL,0x0000000000000000ULL,0x0002000c08010001ULL,0x0000000000000000ULL,0x0000000000001000ULL,0x0000000000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0400000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityTypeRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -23695,6 +24905,7 @@ static struct _ofixMsgSpec	SecurityTypeRequest = {
 
 static struct _ofixGroupSpec	SecurityTypesGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -23705,6 +24916,7 @@ static struct _ofixGroupSpec	SecurityTypesGroup627 = {
 
 static struct _ofixGroupSpec	SecurityTypesGroup558 = {
     558, // NoSecurityTypes
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000008000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000003000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0400000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 167, false }, // SecurityType
 	{ 762, false }, // SecuritySubType
@@ -23726,6 +24938,8 @@ static struct _ofixMsgSpec	SecurityTypes = {
     "w", // type
     "SecurityTypes", // name
     {0,0,0,0,0,0,0,0,1,2,42,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,34,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,8,9,0,40,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,29,30,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x000000000000000dULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00000700ULL,0x041800022e000000ULL,0x000000800003c003ULL,0x0000000000300000ULL,0x0000000000000080ULL,0x0002000c0801000dULL,0x0000000000000000ULL,0x0000000000003000ULL,0x0000600000000000ULL,0x007a000000000000ULL,0x0000000000000000ULL,0x0400000000000000ULL,0x0000000000000000ULL,0x2000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // allowed
     SecurityTypesGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -23778,6 +24992,7 @@ static struct _ofixMsgSpec	SecurityTypes = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -23788,6 +25003,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup627 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -23797,6 +25013,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup454 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -23808,6 +25025,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup864 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -23817,8 +25035,9 @@ static struct _ofixGroupSpec	SecurityListRequestGroup870 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -23870,6 +25089,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup711 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -23879,6 +25099,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup457 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -23888,6 +25109,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup887 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00000ULL,0x0000000000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -23937,6 +25159,7 @@ static struct _ofixGroupSpec	SecurityListRequestGroup555 = {
 
 static struct _ofixGroupSpec	SecurityListRequestGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -23963,6 +25186,8 @@ static struct _ofixMsgSpec	SecurityListRequest = {
     "x", // type
     "SecurityListRequest", // name
     {0,0,0,0,0,0,0,0,1,2,95,0,0,0,0,86,0,0,0,0,0,0,33,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,32,4,11,0,21,0,0,30,5,13,87,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,94,8,9,0,93,0,0,0,20,0,0,0,0,0,0,0,0,59,62,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,37,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,39,0,53,0,0,0,55,58,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,57,41,42,44,45,46,0,0,56,0,0,0,0,0,0,0,43,52,0,0,0,0,0,0,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,0,92,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,90,0,0,0,0,0,0,0,0,0,0,25,60,61,63,64,0,0,88,89,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,0,35,36,0,0,0,0,0,0,0,0,49,50,51,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,48,0,0,0,0,0,0,0,0,0,0,0,85,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,91,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,66,72,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,84,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,79,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,73,74,0,0,70,71,67,68,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,75,76,77,80,81,78,82,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000800000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800003c003ULL,0xffff809f8030c500ULL,0x73fe000000000083ULL,0x00023c0cf8010001ULL,0x0018000000000000ULL,0x0000000001c0ffc0ULL,0x00009800e0000000ULL,0x007bffffffff0000ULL,0x0008000018000000ULL,0x1c00001800000080ULL,0x0000040000100000ULL,0x03fcffff00000000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     SecurityListRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -23994,7 +25219,7 @@ static struct _ofixMsgSpec	SecurityListRequest = {
 	{ 627, false }, // NoHops
 	{ 320, true }, // SecurityReqID
 	{ 559, true }, // SecurityListRequestType
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -24068,6 +25293,7 @@ static struct _ofixMsgSpec	SecurityListRequest = {
 
 static struct _ofixGroupSpec	SecurityListGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -24078,8 +25304,9 @@ static struct _ofixGroupSpec	SecurityListGroup627 = {
 
 static struct _ofixGroupSpec	SecurityListGroup146 = {
     146, // NoRelatedSym
+    {0x0481000000408000ULL,0x00000c0000000002ULL,0x0000008000000000ULL,0x8001999ff400c500ULL,0x0000000000000000ULL,0x0000000cf0010000ULL,0x0000000000000000ULL,0x0000000001c03040ULL,0x00060800a0000000ULL,0x0002000000000000ULL,0x2f08000018c00000ULL,0x0600000000000080ULL,0x0800000000100000ULL,0x00001e6100000000ULL,0x0008000000fe0004ULL,0x0000000000000000ULL}, // members
     {
-	{ 55, true }, // Symbol
+	{ 55, false }, // Symbol
 	{ 65, false }, // SymbolSfx
 	{ 48, false }, // SecurityID
 	{ 22, false }, // SecurityIDSource
@@ -24165,6 +25392,7 @@ static struct _ofixGroupSpec	SecurityListGroup146 = {
 
 static struct _ofixGroupSpec	SecurityListGroup454 = {
     454, // NoSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000180ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 455, false }, // SecurityAltID
 	{ 456, false }, // SecurityAltIDSource
@@ -24174,6 +25402,7 @@ static struct _ofixGroupSpec	SecurityListGroup454 = {
 
 static struct _ofixGroupSpec	SecurityListGroup864 = {
     864, // NoEvents
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000001e00000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 865, false }, // EventType
 	{ 866, false }, // EventDate
@@ -24185,6 +25414,7 @@ static struct _ofixGroupSpec	SecurityListGroup864 = {
 
 static struct _ofixGroupSpec	SecurityListGroup870 = {
     870, // NoInstrAttrib
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000018000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 871, false }, // InstrAttribType
 	{ 872, false }, // InstrAttribValue
@@ -24194,8 +25424,9 @@ static struct _ofixGroupSpec	SecurityListGroup870 = {
 
 static struct _ofixGroupSpec	SecurityListGroup711 = {
     711, // NoUnderlyings
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x00fe000000000000ULL,0x73fe000000000001ULL,0x00003c0000000000ULL,0x0018000000000000ULL,0x000000000000c200ULL,0x0000000040000000ULL,0x00000000000f0000ULL,0x0000000000000000ULL,0x0800000000000000ULL,0x0000040000000000ULL,0x00fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // members
     {
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -24247,6 +25478,7 @@ static struct _ofixGroupSpec	SecurityListGroup711 = {
 
 static struct _ofixGroupSpec	SecurityListGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -24256,6 +25488,7 @@ static struct _ofixGroupSpec	SecurityListGroup457 = {
 
 static struct _ofixGroupSpec	SecurityListGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -24265,6 +25498,7 @@ static struct _ofixGroupSpec	SecurityListGroup887 = {
 
 static struct _ofixGroupSpec	SecurityListGroup232 = {
     232, // NoStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000060000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 233, false }, // StipulationType
 	{ 234, false }, // StipulationValue
@@ -24274,6 +25508,7 @@ static struct _ofixGroupSpec	SecurityListGroup232 = {
 
 static struct _ofixGroupSpec	SecurityListGroup555 = {
     555, // NoLegs
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x7f00000000000000ULL,0x0000000000000002ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000100000000000ULL,0x0001ffff9ff00800ULL,0x000409f000000000ULL,0x1000001800000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x1800400000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 600, false }, // LegSymbol
 	{ 601, false }, // LegSymbolSfx
@@ -24331,6 +25566,7 @@ static struct _ofixGroupSpec	SecurityListGroup555 = {
 
 static struct _ofixGroupSpec	SecurityListGroup604 = {
     604, // NoLegSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000060000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 605, false }, // LegSecurityAltID
 	{ 606, false }, // LegSecurityAltIDSource
@@ -24340,6 +25576,7 @@ static struct _ofixGroupSpec	SecurityListGroup604 = {
 
 static struct _ofixGroupSpec	SecurityListGroup683 = {
     683, // NoLegStipulations
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0003000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 688, false }, // LegStipulationType
 	{ 689, false }, // LegStipulationValue
@@ -24369,6 +25606,8 @@ static struct _ofixMsgSpec	SecurityList = {
     "y", // type
     "SecurityList", // name
     {0,0,0,0,0,0,0,0,1,2,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,35,8,9,0,34,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,33,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,28,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,31,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,30,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,32,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000005ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0001000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0797080c00408700ULL,0x04180c022e000002ULL,0x000000800007c003ULL,0xffff9f9ff430c500ULL,0x73fe000000000003ULL,0x00023c0cf8010005ULL,0x0018000000000200ULL,0x0000000001c0ffc0ULL,0x00071800e0000000ULL,0x007bffffffff0800ULL,0x2f0f09f018c00000ULL,0x1e00001800000080ULL,0x0800040000100000ULL,0x23fcffff00000000ULL,0x1808600000fe0004ULL,0x0000000000000000ULL}, // allowed
     SecurityListGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -24415,6 +25654,7 @@ static struct _ofixMsgSpec	SecurityList = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup627 = {
     627, // NoHops
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0070000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 628, false }, // HopCompID
 	{ 629, false }, // HopSendingTime
@@ -24425,6 +25665,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup627 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup457 = {
     457, // NoUnderlyingSecurityAltID
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000c00ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 458, false }, // UnderlyingSecurityAltID
 	{ 459, false }, // UnderlyingSecurityAltIDSource
@@ -24434,6 +25675,7 @@ static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup457 = {
 
 static struct _ofixGroupSpec	DerivativeSecurityListRequestGroup887 = {
     887, // NoUnderlyingStips
+    {0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0300000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // members
     {
 	{ 888, false }, // UnderlyingStipType
 	{ 889, false }, // UnderlyingStipValue
@@ -24454,6 +25696,8 @@ static struct _ofixMsgSpec	DerivativeSecurityListRequest = {
     "z", // type
     "DerivativeSecurityListRequest", // name
     {0,0,0,0,0,0,0,0,1,2,86,0,0,0,0,77,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,10,3,0,0,0,0,0,0,0,19,0,0,0,0,0,4,11,0,21,0,0,0,5,13,78,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,85,8,9,0,84,0,0,0,20,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,6,15,0,0,0,0,0,22,0,0,0,0,0,7,17,0,0,0,0,0,0,0,0,0,0,0,0,12,14,16,18,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,23,24,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,41,42,43,44,45,46,52,0,0,0,0,0,0,0,0,47,0,0,0,0,0,0,83,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,33,59,62,58,32,37,30,31,39,0,0,53,55,67,0,28,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,81,0,0,0,0,0,0,0,0,0,0,25,0,0,0,0,0,0,79,80,0,0,0,0,0,0,60,61,63,64,0,0,0,26,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,57,56,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,34,0,0,0,0,35,36,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,40,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,29,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,49,50,51,48,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,82,0,27,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,76,38,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,69,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,65,66,68,0,0,70,71,72,73,74,75,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,54,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0},
+    {0x0112000c00000700ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000001ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000800000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL,0x0000000000000000ULL}, // required
+    {0x0716080c00008700ULL,0x041800022e000000ULL,0x000000000003c003ULL,0x00fe000000300000ULL,0x73fe000000000081ULL,0x00023c0c08010001ULL,0x0018000000000000ULL,0x000000000000ce00ULL,0x0000800040000000ULL,0x007a0000000f0000ULL,0x0000000000000000ULL,0x0c00000000000000ULL,0x0000040000000000ULL,0x03fce00000000000ULL,0x0000200000000000ULL,0x0000000000000000ULL}, // allowed
     DerivativeSecurityListRequestGroups, // groups
     {
 	{ 8, true }, // BeginString
@@ -24485,7 +25729,7 @@ static struct _ofixMsgSpec	DerivativeSecurityListRequest = {
 	{ 627, false }, // NoHops
 	{ 320, true }, // SecurityReqID
 	{ 559, true }, // SecurityListRequestType
-	{ 311, true }, // UnderlyingSymbol
+	{ 311, false }, // UnderlyingSymbol
 	{ 312, false }, // UnderlyingSymbolSfx
 	{ 309, false }, // UnderlyingSecurityID
 	{ 305, false }, // UnderlyingSecurityIDSource
@@ -24556,6 +25800,8 @@ struct _ofixVersionSpec	fix44Spec = {
     false, // ready
     tags, // tags
     { 0 }, // tagTable
+    0, // highTags
+    0, // highCnt
     {
 	&Heartbeat,
 	&TestRequest,
@@ -0,0 +1,16760 @@
+
+// This file is auto-generated from ref/FIX44.xml and should not be modified.
+
+#ifndef __OFIX_FIX44MSGS_H__
+#define __OFIX_FIX44MSGS_H__
+
+#include <stdint.h>
+
+#include "ofix/err.h"
+#include "ofix/msg.h"
+#include "ofix/date.h"
+#include "ofix/typed.h"
+
+// Heartbeat [0]
+enum {
+    FIX44_Heartbeat_BeginString = 0,
+    FIX44_Heartbeat_BodyLength = 1,
+    FIX44_Heartbeat_MsgType = 2,
+    FIX44_Heartbeat_SenderCompID = 3,
+    FIX44_Heartbeat_TargetCompID = 4,
+    FIX44_Heartbeat_OnBehalfOfCompID = 5,
+    FIX44_Heartbeat_DeliverToCompID = 6,
+    FIX44_Heartbeat_SecureDataLen = 7,
+    FIX44_Heartbeat_SecureData = 8,
+    FIX44_Heartbeat_MsgSeqNum = 9,
+    FIX44_Heartbeat_SenderSubID = 10,
+    FIX44_Heartbeat_SenderLocationID = 11,
+    FIX44_Heartbeat_TargetSubID = 12,
+    FIX44_Heartbeat_TargetLocationID = 13,
+    FIX44_Heartbeat_OnBehalfOfSubID = 14,
+    FIX44_Heartbeat_OnBehalfOfLocationID = 15,
+    FIX44_Heartbeat_DeliverToSubID = 16,
+    FIX44_Heartbeat_DeliverToLocationID = 17,
+    FIX44_Heartbeat_PossDupFlag = 18,
+    FIX44_Heartbeat_PossResend = 19,
+    FIX44_Heartbeat_SendingTime = 20,
+    FIX44_Heartbeat_OrigSendingTime = 21,
+    FIX44_Heartbeat_XmlDataLen = 22,
+    FIX44_Heartbeat_XmlData = 23,
+    FIX44_Heartbeat_MessageEncoding = 24,
+    FIX44_Heartbeat_LastMsgSeqNumProcessed = 25,
+    FIX44_Heartbeat_NoHops = 26,
+    FIX44_Heartbeat_TestReqID = 27,
+    FIX44_Heartbeat_SignatureLength = 28,
+    FIX44_Heartbeat_Signature = 29,
+    FIX44_Heartbeat_CheckSum = 30,
+};
+
+typedef struct _fix44Heartbeat {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Heartbeat;
+
+extern void	fix44_decode_Heartbeat(ofixErr err, fix44Heartbeat m, const char *raw, int len);
+extern void	fix44_decode_Heartbeat_msg(ofixErr err, fix44Heartbeat m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Heartbeat(ofixErr err, fix44Heartbeat m);
+
+// TestRequest [1]
+enum {
+    FIX44_TestRequest_BeginString = 0,
+    FIX44_TestRequest_BodyLength = 1,
+    FIX44_TestRequest_MsgType = 2,
+    FIX44_TestRequest_SenderCompID = 3,
+    FIX44_TestRequest_TargetCompID = 4,
+    FIX44_TestRequest_OnBehalfOfCompID = 5,
+    FIX44_TestRequest_DeliverToCompID = 6,
+    FIX44_TestRequest_SecureDataLen = 7,
+    FIX44_TestRequest_SecureData = 8,
+    FIX44_TestRequest_MsgSeqNum = 9,
+    FIX44_TestRequest_SenderSubID = 10,
+    FIX44_TestRequest_SenderLocationID = 11,
+    FIX44_TestRequest_TargetSubID = 12,
+    FIX44_TestRequest_TargetLocationID = 13,
+    FIX44_TestRequest_OnBehalfOfSubID = 14,
+    FIX44_TestRequest_OnBehalfOfLocationID = 15,
+    FIX44_TestRequest_DeliverToSubID = 16,
+    FIX44_TestRequest_DeliverToLocationID = 17,
+    FIX44_TestRequest_PossDupFlag = 18,
+    FIX44_TestRequest_PossResend = 19,
+    FIX44_TestRequest_SendingTime = 20,
+    FIX44_TestRequest_OrigSendingTime = 21,
+    FIX44_TestRequest_XmlDataLen = 22,
+    FIX44_TestRequest_XmlData = 23,
+    FIX44_TestRequest_MessageEncoding = 24,
+    FIX44_TestRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_TestRequest_NoHops = 26,
+    FIX44_TestRequest_TestReqID = 27,
+    FIX44_TestRequest_SignatureLength = 28,
+    FIX44_TestRequest_Signature = 29,
+    FIX44_TestRequest_CheckSum = 30,
+};
+
+typedef struct _fix44TestRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TestReqID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44TestRequest;
+
+extern void	fix44_decode_TestRequest(ofixErr err, fix44TestRequest m, const char *raw, int len);
+extern void	fix44_decode_TestRequest_msg(ofixErr err, fix44TestRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_TestRequest(ofixErr err, fix44TestRequest m);
+
+// ResendRequest [2]
+enum {
+    FIX44_ResendRequest_BeginString = 0,
+    FIX44_ResendRequest_BodyLength = 1,
+    FIX44_ResendRequest_MsgType = 2,
+    FIX44_ResendRequest_SenderCompID = 3,
+    FIX44_ResendRequest_TargetCompID = 4,
+    FIX44_ResendRequest_OnBehalfOfCompID = 5,
+    FIX44_ResendRequest_DeliverToCompID = 6,
+    FIX44_ResendRequest_SecureDataLen = 7,
+    FIX44_ResendRequest_SecureData = 8,
+    FIX44_ResendRequest_MsgSeqNum = 9,
+    FIX44_ResendRequest_SenderSubID = 10,
+    FIX44_ResendRequest_SenderLocationID = 11,
+    FIX44_ResendRequest_TargetSubID = 12,
+    FIX44_ResendRequest_TargetLocationID = 13,
+    FIX44_ResendRequest_OnBehalfOfSubID = 14,
+    FIX44_ResendRequest_OnBehalfOfLocationID = 15,
+    FIX44_ResendRequest_DeliverToSubID = 16,
+    FIX44_ResendRequest_DeliverToLocationID = 17,
+    FIX44_ResendRequest_PossDupFlag = 18,
+    FIX44_ResendRequest_PossResend = 19,
+    FIX44_ResendRequest_SendingTime = 20,
+    FIX44_ResendRequest_OrigSendingTime = 21,
+    FIX44_ResendRequest_XmlDataLen = 22,
+    FIX44_ResendRequest_XmlData = 23,
+    FIX44_ResendRequest_MessageEncoding = 24,
+    FIX44_ResendRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_ResendRequest_NoHops = 26,
+    FIX44_ResendRequest_BeginSeqNo = 27,
+    FIX44_ResendRequest_EndSeqNo = 28,
+    FIX44_ResendRequest_SignatureLength = 29,
+    FIX44_ResendRequest_Signature = 30,
+    FIX44_ResendRequest_CheckSum = 31,
+};
+
+typedef struct _fix44ResendRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    int64_t	BeginSeqNo;
+    int64_t	EndSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ResendRequest;
+
+extern void	fix44_decode_ResendRequest(ofixErr err, fix44ResendRequest m, const char *raw, int len);
+extern void	fix44_decode_ResendRequest_msg(ofixErr err, fix44ResendRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ResendRequest(ofixErr err, fix44ResendRequest m);
+
+// Reject [3]
+enum {
+    FIX44_Reject_BeginString = 0,
+    FIX44_Reject_BodyLength = 1,
+    FIX44_Reject_MsgType = 2,
+    FIX44_Reject_SenderCompID = 3,
+    FIX44_Reject_TargetCompID = 4,
+    FIX44_Reject_OnBehalfOfCompID = 5,
+    FIX44_Reject_DeliverToCompID = 6,
+    FIX44_Reject_SecureDataLen = 7,
+    FIX44_Reject_SecureData = 8,
+    FIX44_Reject_MsgSeqNum = 9,
+    FIX44_Reject_SenderSubID = 10,
+    FIX44_Reject_SenderLocationID = 11,
+    FIX44_Reject_TargetSubID = 12,
+    FIX44_Reject_TargetLocationID = 13,
+    FIX44_Reject_OnBehalfOfSubID = 14,
+    FIX44_Reject_OnBehalfOfLocationID = 15,
+    FIX44_Reject_DeliverToSubID = 16,
+    FIX44_Reject_DeliverToLocationID = 17,
+    FIX44_Reject_PossDupFlag = 18,
+    FIX44_Reject_PossResend = 19,
+    FIX44_Reject_SendingTime = 20,
+    FIX44_Reject_OrigSendingTime = 21,
+    FIX44_Reject_XmlDataLen = 22,
+    FIX44_Reject_XmlData = 23,
+    FIX44_Reject_MessageEncoding = 24,
+    FIX44_Reject_LastMsgSeqNumProcessed = 25,
+    FIX44_Reject_NoHops = 26,
+    FIX44_Reject_RefSeqNum = 27,
+    FIX44_Reject_RefTagID = 28,
+    FIX44_Reject_RefMsgType = 29,
+    FIX44_Reject_SessionRejectReason = 30,
+    FIX44_Reject_Text = 31,
+    FIX44_Reject_EncodedTextLen = 32,
+    FIX44_Reject_EncodedText = 33,
+    FIX44_Reject_SignatureLength = 34,
+    FIX44_Reject_Signature = 35,
+    FIX44_Reject_CheckSum = 36,
+};
+
+typedef struct _fix44Reject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    int64_t	RefSeqNum;
+    int64_t	RefTagID;
+    struct _ofixStrView	RefMsgType;
+    int64_t	SessionRejectReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Reject;
+
+extern void	fix44_decode_Reject(ofixErr err, fix44Reject m, const char *raw, int len);
+extern void	fix44_decode_Reject_msg(ofixErr err, fix44Reject m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Reject(ofixErr err, fix44Reject m);
+
+// SequenceReset [4]
+enum {
+    FIX44_SequenceReset_BeginString = 0,
+    FIX44_SequenceReset_BodyLength = 1,
+    FIX44_SequenceReset_MsgType = 2,
+    FIX44_SequenceReset_SenderCompID = 3,
+    FIX44_SequenceReset_TargetCompID = 4,
+    FIX44_SequenceReset_OnBehalfOfCompID = 5,
+    FIX44_SequenceReset_DeliverToCompID = 6,
+    FIX44_SequenceReset_SecureDataLen = 7,
+    FIX44_SequenceReset_SecureData = 8,
+    FIX44_SequenceReset_MsgSeqNum = 9,
+    FIX44_SequenceReset_SenderSubID = 10,
+    FIX44_SequenceReset_SenderLocationID = 11,
+    FIX44_SequenceReset_TargetSubID = 12,
+    FIX44_SequenceReset_TargetLocationID = 13,
+    FIX44_SequenceReset_OnBehalfOfSubID = 14,
+    FIX44_SequenceReset_OnBehalfOfLocationID = 15,
+    FIX44_SequenceReset_DeliverToSubID = 16,
+    FIX44_SequenceReset_DeliverToLocationID = 17,
+    FIX44_SequenceReset_PossDupFlag = 18,
+    FIX44_SequenceReset_PossResend = 19,
+    FIX44_SequenceReset_SendingTime = 20,
+    FIX44_SequenceReset_OrigSendingTime = 21,
+    FIX44_SequenceReset_XmlDataLen = 22,
+    FIX44_SequenceReset_XmlData = 23,
+    FIX44_SequenceReset_MessageEncoding = 24,
+    FIX44_SequenceReset_LastMsgSeqNumProcessed = 25,
+    FIX44_SequenceReset_NoHops = 26,
+    FIX44_SequenceReset_GapFillFlag = 27,
+    FIX44_SequenceReset_NewSeqNo = 28,
+    FIX44_SequenceReset_SignatureLength = 29,
+    FIX44_SequenceReset_Signature = 30,
+    FIX44_SequenceReset_CheckSum = 31,
+};
+
+typedef struct _fix44SequenceReset {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    char	GapFillFlag;
+    int64_t	NewSeqNo;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SequenceReset;
+
+extern void	fix44_decode_SequenceReset(ofixErr err, fix44SequenceReset m, const char *raw, int len);
+extern void	fix44_decode_SequenceReset_msg(ofixErr err, fix44SequenceReset m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SequenceReset(ofixErr err, fix44SequenceReset m);
+
+// Logout [5]
+enum {
+    FIX44_Logout_BeginString = 0,
+    FIX44_Logout_BodyLength = 1,
+    FIX44_Logout_MsgType = 2,
+    FIX44_Logout_SenderCompID = 3,
+    FIX44_Logout_TargetCompID = 4,
+    FIX44_Logout_OnBehalfOfCompID = 5,
+    FIX44_Logout_DeliverToCompID = 6,
+    FIX44_Logout_SecureDataLen = 7,
+    FIX44_Logout_SecureData = 8,
+    FIX44_Logout_MsgSeqNum = 9,
+    FIX44_Logout_SenderSubID = 10,
+    FIX44_Logout_SenderLocationID = 11,
+    FIX44_Logout_TargetSubID = 12,
+    FIX44_Logout_TargetLocationID = 13,
+    FIX44_Logout_OnBehalfOfSubID = 14,
+    FIX44_Logout_OnBehalfOfLocationID = 15,
+    FIX44_Logout_DeliverToSubID = 16,
+    FIX44_Logout_DeliverToLocationID = 17,
+    FIX44_Logout_PossDupFlag = 18,
+    FIX44_Logout_PossResend = 19,
+    FIX44_Logout_SendingTime = 20,
+    FIX44_Logout_OrigSendingTime = 21,
+    FIX44_Logout_XmlDataLen = 22,
+    FIX44_Logout_XmlData = 23,
+    FIX44_Logout_MessageEncoding = 24,
+    FIX44_Logout_LastMsgSeqNumProcessed = 25,
+    FIX44_Logout_NoHops = 26,
+    FIX44_Logout_Text = 27,
+    FIX44_Logout_EncodedTextLen = 28,
+    FIX44_Logout_EncodedText = 29,
+    FIX44_Logout_SignatureLength = 30,
+    FIX44_Logout_Signature = 31,
+    FIX44_Logout_CheckSum = 32,
+};
+
+typedef struct _fix44Logout {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Logout;
+
+extern void	fix44_decode_Logout(ofixErr err, fix44Logout m, const char *raw, int len);
+extern void	fix44_decode_Logout_msg(ofixErr err, fix44Logout m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Logout(ofixErr err, fix44Logout m);
+
+// IndicationOfInterest [6]
+enum {
+    FIX44_IndicationOfInterest_BeginString = 0,
+    FIX44_IndicationOfInterest_BodyLength = 1,
+    FIX44_IndicationOfInterest_MsgType = 2,
+    FIX44_IndicationOfInterest_SenderCompID = 3,
+    FIX44_IndicationOfInterest_TargetCompID = 4,
+    FIX44_IndicationOfInterest_OnBehalfOfCompID = 5,
+    FIX44_IndicationOfInterest_DeliverToCompID = 6,
+    FIX44_IndicationOfInterest_SecureDataLen = 7,
+    FIX44_IndicationOfInterest_SecureData = 8,
+    FIX44_IndicationOfInterest_MsgSeqNum = 9,
+    FIX44_IndicationOfInterest_SenderSubID = 10,
+    FIX44_IndicationOfInterest_SenderLocationID = 11,
+    FIX44_IndicationOfInterest_TargetSubID = 12,
+    FIX44_IndicationOfInterest_TargetLocationID = 13,
+    FIX44_IndicationOfInterest_OnBehalfOfSubID = 14,
+    FIX44_IndicationOfInterest_OnBehalfOfLocationID = 15,
+    FIX44_IndicationOfInterest_DeliverToSubID = 16,
+    FIX44_IndicationOfInterest_DeliverToLocationID = 17,
+    FIX44_IndicationOfInterest_PossDupFlag = 18,
+    FIX44_IndicationOfInterest_PossResend = 19,
+    FIX44_IndicationOfInterest_SendingTime = 20,
+    FIX44_IndicationOfInterest_OrigSendingTime = 21,
+    FIX44_IndicationOfInterest_XmlDataLen = 22,
+    FIX44_IndicationOfInterest_XmlData = 23,
+    FIX44_IndicationOfInterest_MessageEncoding = 24,
+    FIX44_IndicationOfInterest_LastMsgSeqNumProcessed = 25,
+    FIX44_IndicationOfInterest_NoHops = 26,
+    FIX44_IndicationOfInterest_IOIid = 27,
+    FIX44_IndicationOfInterest_IOITransType = 28,
+    FIX44_IndicationOfInterest_IOIRefID = 29,
+    FIX44_IndicationOfInterest_Symbol = 30,
+    FIX44_IndicationOfInterest_SymbolSfx = 31,
+    FIX44_IndicationOfInterest_SecurityID = 32,
+    FIX44_IndicationOfInterest_SecurityIDSource = 33,
+    FIX44_IndicationOfInterest_NoSecurityAltID = 34,
+    FIX44_IndicationOfInterest_Product = 35,
+    FIX44_IndicationOfInterest_CFICode = 36,
+    FIX44_IndicationOfInterest_SecurityType = 37,
+    FIX44_IndicationOfInterest_SecuritySubType = 38,
+    FIX44_IndicationOfInterest_MaturityMonthYear = 39,
+    FIX44_IndicationOfInterest_MaturityDate = 40,
+    FIX44_IndicationOfInterest_CouponPaymentDate = 41,
+    FIX44_IndicationOfInterest_IssueDate = 42,
+    FIX44_IndicationOfInterest_RepoCollateralSecurityType = 43,
+    FIX44_IndicationOfInterest_RepurchaseTerm = 44,
+    FIX44_IndicationOfInterest_RepurchaseRate = 45,
+    FIX44_IndicationOfInterest_Factor = 46,
+    FIX44_IndicationOfInterest_CreditRating = 47,
+    FIX44_IndicationOfInterest_InstrRegistry = 48,
+    FIX44_IndicationOfInterest_CountryOfIssue = 49,
+    FIX44_IndicationOfInterest_StateOrProvinceOfIssue = 50,
+    FIX44_IndicationOfInterest_LocaleOfIssue = 51,
+    FIX44_IndicationOfInterest_RedemptionDate = 52,
+    FIX44_IndicationOfInterest_StrikePrice = 53,
+    FIX44_IndicationOfInterest_StrikeCurrency = 54,
+    FIX44_IndicationOfInterest_OptAttribute = 55,
+    FIX44_IndicationOfInterest_ContractMultiplier = 56,
+    FIX44_IndicationOfInterest_CouponRate = 57,
+    FIX44_IndicationOfInterest_SecurityExchange = 58,
+    FIX44_IndicationOfInterest_Issuer = 59,
+    FIX44_IndicationOfInterest_EncodedIssuerLen = 60,
+    FIX44_IndicationOfInterest_EncodedIssuer = 61,
+    FIX44_IndicationOfInterest_SecurityDesc = 62,
+    FIX44_IndicationOfInterest_EncodedSecurityDescLen = 63,
+    FIX44_IndicationOfInterest_EncodedSecurityDesc = 64,
+    FIX44_IndicationOfInterest_Pool = 65,
+    FIX44_IndicationOfInterest_ContractSettlMonth = 66,
+    FIX44_IndicationOfInterest_CPProgram = 67,
+    FIX44_IndicationOfInterest_CPRegType = 68,
+    FIX44_IndicationOfInterest_NoEvents = 69,
+    FIX44_IndicationOfInterest_DatedDate = 70,
+    FIX44_IndicationOfInterest_InterestAccrualDate = 71,
+    FIX44_IndicationOfInterest_AgreementDesc = 72,
+    FIX44_IndicationOfInterest_AgreementID = 73,
+    FIX44_IndicationOfInterest_AgreementDate = 74,
+    FIX44_IndicationOfInterest_AgreementCurrency = 75,
+    FIX44_IndicationOfInterest_TerminationType = 76,
+    FIX44_IndicationOfInterest_StartDate = 77,
+    FIX44_IndicationOfInterest_EndDate = 78,
+    FIX44_IndicationOfInterest_DeliveryType = 79,
+    FIX44_IndicationOfInterest_MarginRatio = 80,
+    FIX44_IndicationOfInterest_NoUnderlyings = 81,
+    FIX44_IndicationOfInterest_Side = 82,
+    FIX44_IndicationOfInterest_QtyType = 83,
+    FIX44_IndicationOfInterest_OrderQty = 84,
+    FIX44_IndicationOfInterest_CashOrderQty = 85,
+    FIX44_IndicationOfInterest_OrderPercent = 86,
+    FIX44_IndicationOfInterest_RoundingDirection = 87,
+    FIX44_IndicationOfInterest_RoundingModulus = 88,
+    FIX44_IndicationOfInterest_IOIQty = 89,
+    FIX44_IndicationOfInterest_Currency = 90,
+    FIX44_IndicationOfInterest_NoStipulations = 91,
+    FIX44_IndicationOfInterest_NoLegs = 92,
+    FIX44_IndicationOfInterest_PriceType = 93,
+    FIX44_IndicationOfInterest_Price = 94,
+    FIX44_IndicationOfInterest_ValidUntilTime = 95,
+    FIX44_IndicationOfInterest_IOIQltyInd = 96,
+    FIX44_IndicationOfInterest_IOINaturalFlag = 97,
+    FIX44_IndicationOfInterest_NoIOIQualifiers = 98,
+    FIX44_IndicationOfInterest_Text = 99,
+    FIX44_IndicationOfInterest_EncodedTextLen = 100,
+    FIX44_IndicationOfInterest_EncodedText = 101,
+    FIX44_IndicationOfInterest_TransactTime = 102,
+    FIX44_IndicationOfInterest_URLLink = 103,
+    FIX44_IndicationOfInterest_NoRoutingIDs = 104,
+    FIX44_IndicationOfInterest_Spread = 105,
+    FIX44_IndicationOfInterest_BenchmarkCurveCurrency = 106,
+    FIX44_IndicationOfInterest_BenchmarkCurveName = 107,
+    FIX44_IndicationOfInterest_BenchmarkCurvePoint = 108,
+    FIX44_IndicationOfInterest_BenchmarkPrice = 109,
+    FIX44_IndicationOfInterest_BenchmarkPriceType = 110,
+    FIX44_IndicationOfInterest_BenchmarkSecurityID = 111,
+    FIX44_IndicationOfInterest_BenchmarkSecurityIDSource = 112,
+    FIX44_IndicationOfInterest_YieldType = 113,
+    FIX44_IndicationOfInterest_Yield = 114,
+    FIX44_IndicationOfInterest_YieldCalcDate = 115,
+    FIX44_IndicationOfInterest_YieldRedemptionDate = 116,
+    FIX44_IndicationOfInterest_YieldRedemptionPrice = 117,
+    FIX44_IndicationOfInterest_YieldRedemptionPriceType = 118,
+    FIX44_IndicationOfInterest_SignatureLength = 119,
+    FIX44_IndicationOfInterest_Signature = 120,
+    FIX44_IndicationOfInterest_CheckSum = 121,
+};
+
+typedef struct _fix44IndicationOfInterest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	IOIid;
+    char	IOITransType;
+    struct _ofixStrView	IOIRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    int64_t	QtyType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    struct _ofixStrView	IOIQty;
+    struct _ofixStrView	Currency;
+    int64_t	NoStipulations;
+    int64_t	NoLegs;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDate	ValidUntilTime;
+    char	IOIQltyInd;
+    char	IOINaturalFlag;
+    int64_t	NoIOIQualifiers;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	URLLink;
+    int64_t	NoRoutingIDs;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44IndicationOfInterest;
+
+extern void	fix44_decode_IndicationOfInterest(ofixErr err, fix44IndicationOfInterest m, const char *raw, int len);
+extern void	fix44_decode_IndicationOfInterest_msg(ofixErr err, fix44IndicationOfInterest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_IndicationOfInterest(ofixErr err, fix44IndicationOfInterest m);
+
+// Advertisement [7]
+enum {
+    FIX44_Advertisement_BeginString = 0,
+    FIX44_Advertisement_BodyLength = 1,
+    FIX44_Advertisement_MsgType = 2,
+    FIX44_Advertisement_SenderCompID = 3,
+    FIX44_Advertisement_TargetCompID = 4,
+    FIX44_Advertisement_OnBehalfOfCompID = 5,
+    FIX44_Advertisement_DeliverToCompID = 6,
+    FIX44_Advertisement_SecureDataLen = 7,
+    FIX44_Advertisement_SecureData = 8,
+    FIX44_Advertisement_MsgSeqNum = 9,
+    FIX44_Advertisement_SenderSubID = 10,
+    FIX44_Advertisement_SenderLocationID = 11,
+    FIX44_Advertisement_TargetSubID = 12,
+    FIX44_Advertisement_TargetLocationID = 13,
+    FIX44_Advertisement_OnBehalfOfSubID = 14,
+    FIX44_Advertisement_OnBehalfOfLocationID = 15,
+    FIX44_Advertisement_DeliverToSubID = 16,
+    FIX44_Advertisement_DeliverToLocationID = 17,
+    FIX44_Advertisement_PossDupFlag = 18,
+    FIX44_Advertisement_PossResend = 19,
+    FIX44_Advertisement_SendingTime = 20,
+    FIX44_Advertisement_OrigSendingTime = 21,
+    FIX44_Advertisement_XmlDataLen = 22,
+    FIX44_Advertisement_XmlData = 23,
+    FIX44_Advertisement_MessageEncoding = 24,
+    FIX44_Advertisement_LastMsgSeqNumProcessed = 25,
+    FIX44_Advertisement_NoHops = 26,
+    FIX44_Advertisement_AdvId = 27,
+    FIX44_Advertisement_AdvTransType = 28,
+    FIX44_Advertisement_AdvRefID = 29,
+    FIX44_Advertisement_Symbol = 30,
+    FIX44_Advertisement_SymbolSfx = 31,
+    FIX44_Advertisement_SecurityID = 32,
+    FIX44_Advertisement_SecurityIDSource = 33,
+    FIX44_Advertisement_NoSecurityAltID = 34,
+    FIX44_Advertisement_Product = 35,
+    FIX44_Advertisement_CFICode = 36,
+    FIX44_Advertisement_SecurityType = 37,
+    FIX44_Advertisement_SecuritySubType = 38,
+    FIX44_Advertisement_MaturityMonthYear = 39,
+    FIX44_Advertisement_MaturityDate = 40,
+    FIX44_Advertisement_CouponPaymentDate = 41,
+    FIX44_Advertisement_IssueDate = 42,
+    FIX44_Advertisement_RepoCollateralSecurityType = 43,
+    FIX44_Advertisement_RepurchaseTerm = 44,
+    FIX44_Advertisement_RepurchaseRate = 45,
+    FIX44_Advertisement_Factor = 46,
+    FIX44_Advertisement_CreditRating = 47,
+    FIX44_Advertisement_InstrRegistry = 48,
+    FIX44_Advertisement_CountryOfIssue = 49,
+    FIX44_Advertisement_StateOrProvinceOfIssue = 50,
+    FIX44_Advertisement_LocaleOfIssue = 51,
+    FIX44_Advertisement_RedemptionDate = 52,
+    FIX44_Advertisement_StrikePrice = 53,
+    FIX44_Advertisement_StrikeCurrency = 54,
+    FIX44_Advertisement_OptAttribute = 55,
+    FIX44_Advertisement_ContractMultiplier = 56,
+    FIX44_Advertisement_CouponRate = 57,
+    FIX44_Advertisement_SecurityExchange = 58,
+    FIX44_Advertisement_Issuer = 59,
+    FIX44_Advertisement_EncodedIssuerLen = 60,
+    FIX44_Advertisement_EncodedIssuer = 61,
+    FIX44_Advertisement_SecurityDesc = 62,
+    FIX44_Advertisement_EncodedSecurityDescLen = 63,
+    FIX44_Advertisement_EncodedSecurityDesc = 64,
+    FIX44_Advertisement_Pool = 65,
+    FIX44_Advertisement_ContractSettlMonth = 66,
+    FIX44_Advertisement_CPProgram = 67,
+    FIX44_Advertisement_CPRegType = 68,
+    FIX44_Advertisement_NoEvents = 69,
+    FIX44_Advertisement_DatedDate = 70,
+    FIX44_Advertisement_InterestAccrualDate = 71,
+    FIX44_Advertisement_NoLegs = 72,
+    FIX44_Advertisement_NoUnderlyings = 73,
+    FIX44_Advertisement_AdvSide = 74,
+    FIX44_Advertisement_Quantity = 75,
+    FIX44_Advertisement_QtyType = 76,
+    FIX44_Advertisement_Price = 77,
+    FIX44_Advertisement_Currency = 78,
+    FIX44_Advertisement_TradeDate = 79,
+    FIX44_Advertisement_TransactTime = 80,
+    FIX44_Advertisement_Text = 81,
+    FIX44_Advertisement_EncodedTextLen = 82,
+    FIX44_Advertisement_EncodedText = 83,
+    FIX44_Advertisement_URLLink = 84,
+    FIX44_Advertisement_LastMkt = 85,
+    FIX44_Advertisement_TradingSessionID = 86,
+    FIX44_Advertisement_TradingSessionSubID = 87,
+    FIX44_Advertisement_SignatureLength = 88,
+    FIX44_Advertisement_Signature = 89,
+    FIX44_Advertisement_CheckSum = 90,
+};
+
+typedef struct _fix44Advertisement {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	AdvId;
+    struct _ofixStrView	AdvTransType;
+    struct _ofixStrView	AdvRefID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoLegs;
+    int64_t	NoUnderlyings;
+    char	AdvSide;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixDecimal	Price;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	URLLink;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Advertisement;
+
+extern void	fix44_decode_Advertisement(ofixErr err, fix44Advertisement m, const char *raw, int len);
+extern void	fix44_decode_Advertisement_msg(ofixErr err, fix44Advertisement m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Advertisement(ofixErr err, fix44Advertisement m);
+
+// ExecutionReport [8]
+enum {
+    FIX44_ExecutionReport_BeginString = 0,
+    FIX44_ExecutionReport_BodyLength = 1,
+    FIX44_ExecutionReport_MsgType = 2,
+    FIX44_ExecutionReport_SenderCompID = 3,
+    FIX44_ExecutionReport_TargetCompID = 4,
+    FIX44_ExecutionReport_OnBehalfOfCompID = 5,
+    FIX44_ExecutionReport_DeliverToCompID = 6,
+    FIX44_ExecutionReport_SecureDataLen = 7,
+    FIX44_ExecutionReport_SecureData = 8,
+    FIX44_ExecutionReport_MsgSeqNum = 9,
+    FIX44_ExecutionReport_SenderSubID = 10,
+    FIX44_ExecutionReport_SenderLocationID = 11,
+    FIX44_ExecutionReport_TargetSubID = 12,
+    FIX44_ExecutionReport_TargetLocationID = 13,
+    FIX44_ExecutionReport_OnBehalfOfSubID = 14,
+    FIX44_ExecutionReport_OnBehalfOfLocationID = 15,
+    FIX44_ExecutionReport_DeliverToSubID = 16,
+    FIX44_ExecutionReport_DeliverToLocationID = 17,
+    FIX44_ExecutionReport_PossDupFlag = 18,
+    FIX44_ExecutionReport_PossResend = 19,
+    FIX44_ExecutionReport_SendingTime = 20,
+    FIX44_ExecutionReport_OrigSendingTime = 21,
+    FIX44_ExecutionReport_XmlDataLen = 22,
+    FIX44_ExecutionReport_XmlData = 23,
+    FIX44_ExecutionReport_MessageEncoding = 24,
+    FIX44_ExecutionReport_LastMsgSeqNumProcessed = 25,
+    FIX44_ExecutionReport_NoHops = 26,
+    FIX44_ExecutionReport_OrderID = 27,
+    FIX44_ExecutionReport_SecondaryOrderID = 28,
+    FIX44_ExecutionReport_SecondaryClOrdID = 29,
+    FIX44_ExecutionReport_SecondaryExecID = 30,
+    FIX44_ExecutionReport_ClOrdID = 31,
+    FIX44_ExecutionReport_OrigClOrdID = 32,
+    FIX44_ExecutionReport_ClOrdLinkID = 33,
+    FIX44_ExecutionReport_QuoteRespID = 34,
+    FIX44_ExecutionReport_OrdStatusReqID = 35,
+    FIX44_ExecutionReport_MassStatusReqID = 36,
+    FIX44_ExecutionReport_TotNumReports = 37,
+    FIX44_ExecutionReport_LastRptRequested = 38,
+    FIX44_ExecutionReport_NoPartyIDs = 39,
+    FIX44_ExecutionReport_TradeOriginationDate = 40,
+    FIX44_ExecutionReport_NoContraBrokers = 41,
+    FIX44_ExecutionReport_ListID = 42,
+    FIX44_ExecutionReport_CrossID = 43,
+    FIX44_ExecutionReport_OrigCrossID = 44,
+    FIX44_ExecutionReport_CrossType = 45,
+    FIX44_ExecutionReport_ExecID = 46,
+    FIX44_ExecutionReport_ExecRefID = 47,
+    FIX44_ExecutionReport_ExecType = 48,
+    FIX44_ExecutionReport_OrdStatus = 49,
+    FIX44_ExecutionReport_WorkingIndicator = 50,
+    FIX44_ExecutionReport_OrdRejReason = 51,
+    FIX44_ExecutionReport_ExecRestatementReason = 52,
+    FIX44_ExecutionReport_Account = 53,
+    FIX44_ExecutionReport_AcctIDSource = 54,
+    FIX44_ExecutionReport_AccountType = 55,
+    FIX44_ExecutionReport_DayBookingInst = 56,
+    FIX44_ExecutionReport_BookingUnit = 57,
+    FIX44_ExecutionReport_PreallocMethod = 58,
+    FIX44_ExecutionReport_SettlType = 59,
+    FIX44_ExecutionReport_SettlDate = 60,
+    FIX44_ExecutionReport_CashMargin = 61,
+    FIX44_ExecutionReport_ClearingFeeIndicator = 62,
+    FIX44_ExecutionReport_Symbol = 63,
+    FIX44_ExecutionReport_SymbolSfx = 64,
+    FIX44_ExecutionReport_SecurityID = 65,
+    FIX44_ExecutionReport_SecurityIDSource = 66,
+    FIX44_ExecutionReport_NoSecurityAltID = 67,
+    FIX44_ExecutionReport_Product = 68,
+    FIX44_ExecutionReport_CFICode = 69,
+    FIX44_ExecutionReport_SecurityType = 70,
+    FIX44_ExecutionReport_SecuritySubType = 71,
+    FIX44_ExecutionReport_MaturityMonthYear = 72,
+    FIX44_ExecutionReport_MaturityDate = 73,
+    FIX44_ExecutionReport_CouponPaymentDate = 74,
+    FIX44_ExecutionReport_IssueDate = 75,
+    FIX44_ExecutionReport_RepoCollateralSecurityType = 76,
+    FIX44_ExecutionReport_RepurchaseTerm = 77,
+    FIX44_ExecutionReport_RepurchaseRate = 78,
+    FIX44_ExecutionReport_Factor = 79,
+    FIX44_ExecutionReport_CreditRating = 80,
+    FIX44_ExecutionReport_InstrRegistry = 81,
+    FIX44_ExecutionReport_CountryOfIssue = 82,
+    FIX44_ExecutionReport_StateOrProvinceOfIssue = 83,
+    FIX44_ExecutionReport_LocaleOfIssue = 84,
+    FIX44_ExecutionReport_RedemptionDate = 85,
+    FIX44_ExecutionReport_StrikePrice = 86,
+    FIX44_ExecutionReport_StrikeCurrency = 87,
+    FIX44_ExecutionReport_OptAttribute = 88,
+    FIX44_ExecutionReport_ContractMultiplier = 89,
+    FIX44_ExecutionReport_CouponRate = 90,
+    FIX44_ExecutionReport_SecurityExchange = 91,
+    FIX44_ExecutionReport_Issuer = 92,
+    FIX44_ExecutionReport_EncodedIssuerLen = 93,
+    FIX44_ExecutionReport_EncodedIssuer = 94,
+    FIX44_ExecutionReport_SecurityDesc = 95,
+    FIX44_ExecutionReport_EncodedSecurityDescLen = 96,
+    FIX44_ExecutionReport_EncodedSecurityDesc = 97,
+    FIX44_ExecutionReport_Pool = 98,
+    FIX44_ExecutionReport_ContractSettlMonth = 99,
+    FIX44_ExecutionReport_CPProgram = 100,
+    FIX44_ExecutionReport_CPRegType = 101,
+    FIX44_ExecutionReport_NoEvents = 102,
+    FIX44_ExecutionReport_DatedDate = 103,
+    FIX44_ExecutionReport_InterestAccrualDate = 104,
+    FIX44_ExecutionReport_AgreementDesc = 105,
+    FIX44_ExecutionReport_AgreementID = 106,
+    FIX44_ExecutionReport_AgreementDate = 107,
+    FIX44_ExecutionReport_AgreementCurrency = 108,
+    FIX44_ExecutionReport_TerminationType = 109,
+    FIX44_ExecutionReport_StartDate = 110,
+    FIX44_ExecutionReport_EndDate = 111,
+    FIX44_ExecutionReport_DeliveryType = 112,
+    FIX44_ExecutionReport_MarginRatio = 113,
+    FIX44_ExecutionReport_NoUnderlyings = 114,
+    FIX44_ExecutionReport_Side = 115,
+    FIX44_ExecutionReport_NoStipulations = 116,
+    FIX44_ExecutionReport_QtyType = 117,
+    FIX44_ExecutionReport_OrderQty = 118,
+    FIX44_ExecutionReport_CashOrderQty = 119,
+    FIX44_ExecutionReport_OrderPercent = 120,
+    FIX44_ExecutionReport_RoundingDirection = 121,
+    FIX44_ExecutionReport_RoundingModulus = 122,
+    FIX44_ExecutionReport_OrdType = 123,
+    FIX44_ExecutionReport_PriceType = 124,
+    FIX44_ExecutionReport_Price = 125,
+    FIX44_ExecutionReport_StopPx = 126,
+    FIX44_ExecutionReport_PegOffsetValue = 127,
+    FIX44_ExecutionReport_PegMoveType = 128,
+    FIX44_ExecutionReport_PegOffsetType = 129,
+    FIX44_ExecutionReport_PegLimitType = 130,
+    FIX44_ExecutionReport_PegRoundDirection = 131,
+    FIX44_ExecutionReport_PegScope = 132,
+    FIX44_ExecutionReport_DiscretionInst = 133,
+    FIX44_ExecutionReport_DiscretionOffsetValue = 134,
+    FIX44_ExecutionReport_DiscretionMoveType = 135,
+    FIX44_ExecutionReport_DiscretionOffsetType = 136,
+    FIX44_ExecutionReport_DiscretionLimitType = 137,
+    FIX44_ExecutionReport_DiscretionRoundDirection = 138,
+    FIX44_ExecutionReport_DiscretionScope = 139,
+    FIX44_ExecutionReport_PeggedPrice = 140,
+    FIX44_ExecutionReport_DiscretionPrice = 141,
+    FIX44_ExecutionReport_TargetStrategy = 142,
+    FIX44_ExecutionReport_TargetStrategyParameters = 143,
+    FIX44_ExecutionReport_ParticipationRate = 144,
+    FIX44_ExecutionReport_TargetStrategyPerformance = 145,
+    FIX44_ExecutionReport_Currency = 146,
+    FIX44_ExecutionReport_ComplianceID = 147,
+    FIX44_ExecutionReport_SolicitedFlag = 148,
+    FIX44_ExecutionReport_TimeInForce = 149,
+    FIX44_ExecutionReport_EffectiveTime = 150,
+    FIX44_ExecutionReport_ExpireDate = 151,
+    FIX44_ExecutionReport_ExpireTime = 152,
+    FIX44_ExecutionReport_ExecInst = 153,
+    FIX44_ExecutionReport_OrderCapacity = 154,
+    FIX44_ExecutionReport_OrderRestrictions = 155,
+    FIX44_ExecutionReport_CustOrderCapacity = 156,
+    FIX44_ExecutionReport_LastQty = 157,
+    FIX44_ExecutionReport_UnderlyingLastQty = 158,
+    FIX44_ExecutionReport_LastPx = 159,
+    FIX44_ExecutionReport_UnderlyingLastPx = 160,
+    FIX44_ExecutionReport_LastParPx = 161,
+    FIX44_ExecutionReport_LastSpotRate = 162,
+    FIX44_ExecutionReport_LastForwardPoints = 163,
+    FIX44_ExecutionReport_LastMkt = 164,
+    FIX44_ExecutionReport_TradingSessionID = 165,
+    FIX44_ExecutionReport_TradingSessionSubID = 166,
+    FIX44_ExecutionReport_TimeBracket = 167,
+    FIX44_ExecutionReport_LastCapacity = 168,
+    FIX44_ExecutionReport_LeavesQty = 169,
+    FIX44_ExecutionReport_CumQty = 170,
+    FIX44_ExecutionReport_AvgPx = 171,
+    FIX44_ExecutionReport_DayOrderQty = 172,
+    FIX44_ExecutionReport_DayCumQty = 173,
+    FIX44_ExecutionReport_DayAvgPx = 174,
+    FIX44_ExecutionReport_GTBookingInst = 175,
+    FIX44_ExecutionReport_TradeDate = 176,
+    FIX44_ExecutionReport_TransactTime = 177,
+    FIX44_ExecutionReport_ReportToExch = 178,
+    FIX44_ExecutionReport_Commission = 179,
+    FIX44_ExecutionReport_CommType = 180,
+    FIX44_ExecutionReport_CommCurrency = 181,
+    FIX44_ExecutionReport_FundRenewWaiv = 182,
+    FIX44_ExecutionReport_Spread = 183,
+    FIX44_ExecutionReport_BenchmarkCurveCurrency = 184,
+    FIX44_ExecutionReport_BenchmarkCurveName = 185,
+    FIX44_ExecutionReport_BenchmarkCurvePoint = 186,
+    FIX44_ExecutionReport_BenchmarkPrice = 187,
+    FIX44_ExecutionReport_BenchmarkPriceType = 188,
+    FIX44_ExecutionReport_BenchmarkSecurityID = 189,
+    FIX44_ExecutionReport_BenchmarkSecurityIDSource = 190,
+    FIX44_ExecutionReport_YieldType = 191,
+    FIX44_ExecutionReport_Yield = 192,
+    FIX44_ExecutionReport_YieldCalcDate = 193,
+    FIX44_ExecutionReport_YieldRedemptionDate = 194,
+    FIX44_ExecutionReport_YieldRedemptionPrice = 195,
+    FIX44_ExecutionReport_YieldRedemptionPriceType = 196,
+    FIX44_ExecutionReport_GrossTradeAmt = 197,
+    FIX44_ExecutionReport_NumDaysInterest = 198,
+    FIX44_ExecutionReport_ExDate = 199,
+    FIX44_ExecutionReport_AccruedInterestRate = 200,
+    FIX44_ExecutionReport_AccruedInterestAmt = 201,
+    FIX44_ExecutionReport_InterestAtMaturity = 202,
+    FIX44_ExecutionReport_EndAccruedInterestAmt = 203,
+    FIX44_ExecutionReport_StartCash = 204,
+    FIX44_ExecutionReport_EndCash = 205,
+    FIX44_ExecutionReport_TradedFlatSwitch = 206,
+    FIX44_ExecutionReport_BasisFeatureDate = 207,
+    FIX44_ExecutionReport_BasisFeaturePrice = 208,
+    FIX44_ExecutionReport_Concession = 209,
+    FIX44_ExecutionReport_TotalTakedown = 210,
+    FIX44_ExecutionReport_NetMoney = 211,
+    FIX44_ExecutionReport_SettlCurrAmt = 212,
+    FIX44_ExecutionReport_SettlCurrency = 213,
+    FIX44_ExecutionReport_SettlCurrFxRate = 214,
+    FIX44_ExecutionReport_SettlCurrFxRateCalc = 215,
+    FIX44_ExecutionReport_HandlInst = 216,
+    FIX44_ExecutionReport_MinQty = 217,
+    FIX44_ExecutionReport_MaxFloor = 218,
+    FIX44_ExecutionReport_PositionEffect = 219,
+    FIX44_ExecutionReport_MaxShow = 220,
+    FIX44_ExecutionReport_BookingType = 221,
+    FIX44_ExecutionReport_Text = 222,
+    FIX44_ExecutionReport_EncodedTextLen = 223,
+    FIX44_ExecutionReport_EncodedText = 224,
+    FIX44_ExecutionReport_SettlDate2 = 225,
+    FIX44_ExecutionReport_OrderQty2 = 226,
+    FIX44_ExecutionReport_LastForwardPoints2 = 227,
+    FIX44_ExecutionReport_MultiLegReportingType = 228,
+    FIX44_ExecutionReport_CancellationRights = 229,
+    FIX44_ExecutionReport_MoneyLaunderingStatus = 230,
+    FIX44_ExecutionReport_RegistID = 231,
+    FIX44_ExecutionReport_Designation = 232,
+    FIX44_ExecutionReport_TransBkdTime = 233,
+    FIX44_ExecutionReport_ExecValuationPoint = 234,
+    FIX44_ExecutionReport_ExecPriceType = 235,
+    FIX44_ExecutionReport_ExecPriceAdjustment = 236,
+    FIX44_ExecutionReport_PriorityIndicator = 237,
+    FIX44_ExecutionReport_PriceImprovement = 238,
+    FIX44_ExecutionReport_LastLiquidityInd = 239,
+    FIX44_ExecutionReport_NoContAmts = 240,
+    FIX44_ExecutionReport_NoLegs = 241,
+    FIX44_ExecutionReport_CopyMsgIndicator = 242,
+    FIX44_ExecutionReport_NoMiscFees = 243,
+    FIX44_ExecutionReport_SignatureLength = 244,
+    FIX44_ExecutionReport_Signature = 245,
+    FIX44_ExecutionReport_CheckSum = 246,
+};
+
+typedef struct _fix44ExecutionReport {
+    uint64_t	present[4];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	SecondaryExecID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixStrView	QuoteRespID;
+    struct _ofixStrView	OrdStatusReqID;
+    struct _ofixStrView	MassStatusReqID;
+    int64_t	TotNumReports;
+    char	LastRptRequested;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeOriginationDate;
+    int64_t	NoContraBrokers;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	CrossID;
+    struct _ofixStrView	OrigCrossID;
+    int64_t	CrossType;
+    struct _ofixStrView	ExecID;
+    struct _ofixStrView	ExecRefID;
+    char	ExecType;
+    char	OrdStatus;
+    char	WorkingIndicator;
+    int64_t	OrdRejReason;
+    int64_t	ExecRestatementReason;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    int64_t	NoStipulations;
+    int64_t	QtyType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	PegOffsetValue;
+    int64_t	PegMoveType;
+    int64_t	PegOffsetType;
+    int64_t	PegLimitType;
+    int64_t	PegRoundDirection;
+    int64_t	PegScope;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffsetValue;
+    int64_t	DiscretionMoveType;
+    int64_t	DiscretionOffsetType;
+    int64_t	DiscretionLimitType;
+    int64_t	DiscretionRoundDirection;
+    int64_t	DiscretionScope;
+    struct _ofixDecimal	PeggedPrice;
+    struct _ofixDecimal	DiscretionPrice;
+    int64_t	TargetStrategy;
+    struct _ofixStrView	TargetStrategyParameters;
+    struct _ofixDecimal	ParticipationRate;
+    struct _ofixDecimal	TargetStrategyPerformance;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    struct _ofixStrView	ExecInst;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    struct _ofixDecimal	LastQty;
+    struct _ofixDecimal	UnderlyingLastQty;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDecimal	UnderlyingLastPx;
+    struct _ofixDecimal	LastParPx;
+    struct _ofixDecimal	LastSpotRate;
+    struct _ofixDecimal	LastForwardPoints;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	TimeBracket;
+    char	LastCapacity;
+    struct _ofixDecimal	LeavesQty;
+    struct _ofixDecimal	CumQty;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDecimal	DayOrderQty;
+    struct _ofixDecimal	DayCumQty;
+    struct _ofixDecimal	DayAvgPx;
+    int64_t	GTBookingInst;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	ReportToExch;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixDecimal	GrossTradeAmt;
+    int64_t	NumDaysInterest;
+    struct _ofixStrView	ExDate;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	InterestAtMaturity;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    char	TradedFlatSwitch;
+    struct _ofixStrView	BasisFeatureDate;
+    struct _ofixDecimal	BasisFeaturePrice;
+    struct _ofixDecimal	Concession;
+    struct _ofixDecimal	TotalTakedown;
+    struct _ofixDecimal	NetMoney;
+    struct _ofixDecimal	SettlCurrAmt;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixDecimal	SettlCurrFxRate;
+    char	SettlCurrFxRateCalc;
+    char	HandlInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    char	PositionEffect;
+    struct _ofixDecimal	MaxShow;
+    int64_t	BookingType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	SettlDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	LastForwardPoints2;
+    char	MultiLegReportingType;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    struct _ofixDate	TransBkdTime;
+    struct _ofixDate	ExecValuationPoint;
+    char	ExecPriceType;
+    struct _ofixDecimal	ExecPriceAdjustment;
+    int64_t	PriorityIndicator;
+    struct _ofixDecimal	PriceImprovement;
+    int64_t	LastLiquidityInd;
+    int64_t	NoContAmts;
+    int64_t	NoLegs;
+    char	CopyMsgIndicator;
+    int64_t	NoMiscFees;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ExecutionReport;
+
+extern void	fix44_decode_ExecutionReport(ofixErr err, fix44ExecutionReport m, const char *raw, int len);
+extern void	fix44_decode_ExecutionReport_msg(ofixErr err, fix44ExecutionReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ExecutionReport(ofixErr err, fix44ExecutionReport m);
+
+// OrderCancelReject [9]
+enum {
+    FIX44_OrderCancelReject_BeginString = 0,
+    FIX44_OrderCancelReject_BodyLength = 1,
+    FIX44_OrderCancelReject_MsgType = 2,
+    FIX44_OrderCancelReject_SenderCompID = 3,
+    FIX44_OrderCancelReject_TargetCompID = 4,
+    FIX44_OrderCancelReject_OnBehalfOfCompID = 5,
+    FIX44_OrderCancelReject_DeliverToCompID = 6,
+    FIX44_OrderCancelReject_SecureDataLen = 7,
+    FIX44_OrderCancelReject_SecureData = 8,
+    FIX44_OrderCancelReject_MsgSeqNum = 9,
+    FIX44_OrderCancelReject_SenderSubID = 10,
+    FIX44_OrderCancelReject_SenderLocationID = 11,
+    FIX44_OrderCancelReject_TargetSubID = 12,
+    FIX44_OrderCancelReject_TargetLocationID = 13,
+    FIX44_OrderCancelReject_OnBehalfOfSubID = 14,
+    FIX44_OrderCancelReject_OnBehalfOfLocationID = 15,
+    FIX44_OrderCancelReject_DeliverToSubID = 16,
+    FIX44_OrderCancelReject_DeliverToLocationID = 17,
+    FIX44_OrderCancelReject_PossDupFlag = 18,
+    FIX44_OrderCancelReject_PossResend = 19,
+    FIX44_OrderCancelReject_SendingTime = 20,
+    FIX44_OrderCancelReject_OrigSendingTime = 21,
+    FIX44_OrderCancelReject_XmlDataLen = 22,
+    FIX44_OrderCancelReject_XmlData = 23,
+    FIX44_OrderCancelReject_MessageEncoding = 24,
+    FIX44_OrderCancelReject_LastMsgSeqNumProcessed = 25,
+    FIX44_OrderCancelReject_NoHops = 26,
+    FIX44_OrderCancelReject_OrderID = 27,
+    FIX44_OrderCancelReject_SecondaryOrderID = 28,
+    FIX44_OrderCancelReject_SecondaryClOrdID = 29,
+    FIX44_OrderCancelReject_ClOrdID = 30,
+    FIX44_OrderCancelReject_ClOrdLinkID = 31,
+    FIX44_OrderCancelReject_OrigClOrdID = 32,
+    FIX44_OrderCancelReject_OrdStatus = 33,
+    FIX44_OrderCancelReject_WorkingIndicator = 34,
+    FIX44_OrderCancelReject_OrigOrdModTime = 35,
+    FIX44_OrderCancelReject_ListID = 36,
+    FIX44_OrderCancelReject_Account = 37,
+    FIX44_OrderCancelReject_AcctIDSource = 38,
+    FIX44_OrderCancelReject_AccountType = 39,
+    FIX44_OrderCancelReject_TradeOriginationDate = 40,
+    FIX44_OrderCancelReject_TradeDate = 41,
+    FIX44_OrderCancelReject_TransactTime = 42,
+    FIX44_OrderCancelReject_CxlRejResponseTo = 43,
+    FIX44_OrderCancelReject_CxlRejReason = 44,
+    FIX44_OrderCancelReject_Text = 45,
+    FIX44_OrderCancelReject_EncodedTextLen = 46,
+    FIX44_OrderCancelReject_EncodedText = 47,
+    FIX44_OrderCancelReject_SignatureLength = 48,
+    FIX44_OrderCancelReject_Signature = 49,
+    FIX44_OrderCancelReject_CheckSum = 50,
+};
+
+typedef struct _fix44OrderCancelReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixStrView	OrigClOrdID;
+    char	OrdStatus;
+    char	WorkingIndicator;
+    struct _ofixDate	OrigOrdModTime;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	CxlRejResponseTo;
+    int64_t	CxlRejReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44OrderCancelReject;
+
+extern void	fix44_decode_OrderCancelReject(ofixErr err, fix44OrderCancelReject m, const char *raw, int len);
+extern void	fix44_decode_OrderCancelReject_msg(ofixErr err, fix44OrderCancelReject m, ofixMsg msg);
+extern ofixMsg	fix44_encode_OrderCancelReject(ofixErr err, fix44OrderCancelReject m);
+
+// Logon [A]
+enum {
+    FIX44_Logon_BeginString = 0,
+    FIX44_Logon_BodyLength = 1,
+    FIX44_Logon_MsgType = 2,
+    FIX44_Logon_SenderCompID = 3,
+    FIX44_Logon_TargetCompID = 4,
+    FIX44_Logon_OnBehalfOfCompID = 5,
+    FIX44_Logon_DeliverToCompID = 6,
+    FIX44_Logon_SecureDataLen = 7,
+    FIX44_Logon_SecureData = 8,
+    FIX44_Logon_MsgSeqNum = 9,
+    FIX44_Logon_SenderSubID = 10,
+    FIX44_Logon_SenderLocationID = 11,
+    FIX44_Logon_TargetSubID = 12,
+    FIX44_Logon_TargetLocationID = 13,
+    FIX44_Logon_OnBehalfOfSubID = 14,
+    FIX44_Logon_OnBehalfOfLocationID = 15,
+    FIX44_Logon_DeliverToSubID = 16,
+    FIX44_Logon_DeliverToLocationID = 17,
+    FIX44_Logon_PossDupFlag = 18,
+    FIX44_Logon_PossResend = 19,
+    FIX44_Logon_SendingTime = 20,
+    FIX44_Logon_OrigSendingTime = 21,
+    FIX44_Logon_XmlDataLen = 22,
+    FIX44_Logon_XmlData = 23,
+    FIX44_Logon_MessageEncoding = 24,
+    FIX44_Logon_LastMsgSeqNumProcessed = 25,
+    FIX44_Logon_NoHops = 26,
+    FIX44_Logon_EncryptMethod = 27,
+    FIX44_Logon_HeartBtInt = 28,
+    FIX44_Logon_RawDataLength = 29,
+    FIX44_Logon_RawData = 30,
+    FIX44_Logon_ResetSeqNumFlag = 31,
+    FIX44_Logon_NextExpectedMsgSeqNum = 32,
+    FIX44_Logon_MaxMessageSize = 33,
+    FIX44_Logon_NoMsgTypes = 34,
+    FIX44_Logon_TestMessageIndicator = 35,
+    FIX44_Logon_Username = 36,
+    FIX44_Logon_Password = 37,
+    FIX44_Logon_SignatureLength = 38,
+    FIX44_Logon_Signature = 39,
+    FIX44_Logon_CheckSum = 40,
+};
+
+typedef struct _fix44Logon {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    int64_t	EncryptMethod;
+    int64_t	HeartBtInt;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    char	ResetSeqNumFlag;
+    int64_t	NextExpectedMsgSeqNum;
+    int64_t	MaxMessageSize;
+    int64_t	NoMsgTypes;
+    char	TestMessageIndicator;
+    struct _ofixStrView	Username;
+    struct _ofixStrView	Password;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Logon;
+
+extern void	fix44_decode_Logon(ofixErr err, fix44Logon m, const char *raw, int len);
+extern void	fix44_decode_Logon_msg(ofixErr err, fix44Logon m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Logon(ofixErr err, fix44Logon m);
+
+// DerivativeSecurityList [AA]
+enum {
+    FIX44_DerivativeSecurityList_BeginString = 0,
+    FIX44_DerivativeSecurityList_BodyLength = 1,
+    FIX44_DerivativeSecurityList_MsgType = 2,
+    FIX44_DerivativeSecurityList_SenderCompID = 3,
+    FIX44_DerivativeSecurityList_TargetCompID = 4,
+    FIX44_DerivativeSecurityList_OnBehalfOfCompID = 5,
+    FIX44_DerivativeSecurityList_DeliverToCompID = 6,
+    FIX44_DerivativeSecurityList_SecureDataLen = 7,
+    FIX44_DerivativeSecurityList_SecureData = 8,
+    FIX44_DerivativeSecurityList_MsgSeqNum = 9,
+    FIX44_DerivativeSecurityList_SenderSubID = 10,
+    FIX44_DerivativeSecurityList_SenderLocationID = 11,
+    FIX44_DerivativeSecurityList_TargetSubID = 12,
+    FIX44_DerivativeSecurityList_TargetLocationID = 13,
+    FIX44_DerivativeSecurityList_OnBehalfOfSubID = 14,
+    FIX44_DerivativeSecurityList_OnBehalfOfLocationID = 15,
+    FIX44_DerivativeSecurityList_DeliverToSubID = 16,
+    FIX44_DerivativeSecurityList_DeliverToLocationID = 17,
+    FIX44_DerivativeSecurityList_PossDupFlag = 18,
+    FIX44_DerivativeSecurityList_PossResend = 19,
+    FIX44_DerivativeSecurityList_SendingTime = 20,
+    FIX44_DerivativeSecurityList_OrigSendingTime = 21,
+    FIX44_DerivativeSecurityList_XmlDataLen = 22,
+    FIX44_DerivativeSecurityList_XmlData = 23,
+    FIX44_DerivativeSecurityList_MessageEncoding = 24,
+    FIX44_DerivativeSecurityList_LastMsgSeqNumProcessed = 25,
+    FIX44_DerivativeSecurityList_NoHops = 26,
+    FIX44_DerivativeSecurityList_SecurityReqID = 27,
+    FIX44_DerivativeSecurityList_SecurityResponseID = 28,
+    FIX44_DerivativeSecurityList_SecurityRequestResult = 29,
+    FIX44_DerivativeSecurityList_UnderlyingSymbol = 30,
+    FIX44_DerivativeSecurityList_UnderlyingSymbolSfx = 31,
+    FIX44_DerivativeSecurityList_UnderlyingSecurityID = 32,
+    FIX44_DerivativeSecurityList_UnderlyingSecurityIDSource = 33,
+    FIX44_DerivativeSecurityList_NoUnderlyingSecurityAltID = 34,
+    FIX44_DerivativeSecurityList_UnderlyingProduct = 35,
+    FIX44_DerivativeSecurityList_UnderlyingCFICode = 36,
+    FIX44_DerivativeSecurityList_UnderlyingSecurityType = 37,
+    FIX44_DerivativeSecurityList_UnderlyingSecuritySubType = 38,
+    FIX44_DerivativeSecurityList_UnderlyingMaturityMonthYear = 39,
+    FIX44_DerivativeSecurityList_UnderlyingMaturityDate = 40,
+    FIX44_DerivativeSecurityList_UnderlyingCouponPaymentDate = 41,
+    FIX44_DerivativeSecurityList_UnderlyingIssueDate = 42,
+    FIX44_DerivativeSecurityList_UnderlyingRepoCollateralSecurityType = 43,
+    FIX44_DerivativeSecurityList_UnderlyingRepurchaseTerm = 44,
+    FIX44_DerivativeSecurityList_UnderlyingRepurchaseRate = 45,
+    FIX44_DerivativeSecurityList_UnderlyingFactor = 46,
+    FIX44_DerivativeSecurityList_UnderlyingCreditRating = 47,
+    FIX44_DerivativeSecurityList_UnderlyingInstrRegistry = 48,
+    FIX44_DerivativeSecurityList_UnderlyingCountryOfIssue = 49,
+    FIX44_DerivativeSecurityList_UnderlyingStateOrProvinceOfIssue = 50,
+    FIX44_DerivativeSecurityList_UnderlyingLocaleOfIssue = 51,
+    FIX44_DerivativeSecurityList_UnderlyingRedemptionDate = 52,
+    FIX44_DerivativeSecurityList_UnderlyingStrikePrice = 53,
+    FIX44_DerivativeSecurityList_UnderlyingStrikeCurrency = 54,
+    FIX44_DerivativeSecurityList_UnderlyingOptAttribute = 55,
+    FIX44_DerivativeSecurityList_UnderlyingContractMultiplier = 56,
+    FIX44_DerivativeSecurityList_UnderlyingCouponRate = 57,
+    FIX44_DerivativeSecurityList_UnderlyingSecurityExchange = 58,
+    FIX44_DerivativeSecurityList_UnderlyingIssuer = 59,
+    FIX44_DerivativeSecurityList_EncodedUnderlyingIssuerLen = 60,
+    FIX44_DerivativeSecurityList_EncodedUnderlyingIssuer = 61,
+    FIX44_DerivativeSecurityList_UnderlyingSecurityDesc = 62,
+    FIX44_DerivativeSecurityList_EncodedUnderlyingSecurityDescLen = 63,
+    FIX44_DerivativeSecurityList_EncodedUnderlyingSecurityDesc = 64,
+    FIX44_DerivativeSecurityList_UnderlyingCPProgram = 65,
+    FIX44_DerivativeSecurityList_UnderlyingCPRegType = 66,
+    FIX44_DerivativeSecurityList_UnderlyingCurrency = 67,
+    FIX44_DerivativeSecurityList_UnderlyingQty = 68,
+    FIX44_DerivativeSecurityList_UnderlyingPx = 69,
+    FIX44_DerivativeSecurityList_UnderlyingDirtyPrice = 70,
+    FIX44_DerivativeSecurityList_UnderlyingEndPrice = 71,
+    FIX44_DerivativeSecurityList_UnderlyingStartValue = 72,
+    FIX44_DerivativeSecurityList_UnderlyingCurrentValue = 73,
+    FIX44_DerivativeSecurityList_UnderlyingEndValue = 74,
+    FIX44_DerivativeSecurityList_NoUnderlyingStips = 75,
+    FIX44_DerivativeSecurityList_TotNoRelatedSym = 76,
+    FIX44_DerivativeSecurityList_LastFragment = 77,
+    FIX44_DerivativeSecurityList_NoRelatedSym = 78,
+    FIX44_DerivativeSecurityList_SignatureLength = 79,
+    FIX44_DerivativeSecurityList_Signature = 80,
+    FIX44_DerivativeSecurityList_CheckSum = 81,
+};
+
+typedef struct _fix44DerivativeSecurityList {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityRequestResult;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingSecuritySubType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixStrView	UnderlyingCouponPaymentDate;
+    struct _ofixStrView	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixStrView	UnderlyingRedemptionDate;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    struct _ofixStrView	UnderlyingStrikeCurrency;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    struct _ofixStrView	UnderlyingCPProgram;
+    struct _ofixStrView	UnderlyingCPRegType;
+    struct _ofixStrView	UnderlyingCurrency;
+    struct _ofixDecimal	UnderlyingQty;
+    struct _ofixDecimal	UnderlyingPx;
+    struct _ofixDecimal	UnderlyingDirtyPrice;
+    struct _ofixDecimal	UnderlyingEndPrice;
+    struct _ofixDecimal	UnderlyingStartValue;
+    struct _ofixDecimal	UnderlyingCurrentValue;
+    struct _ofixDecimal	UnderlyingEndValue;
+    int64_t	NoUnderlyingStips;
+    int64_t	TotNoRelatedSym;
+    char	LastFragment;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44DerivativeSecurityList;
+
+extern void	fix44_decode_DerivativeSecurityList(ofixErr err, fix44DerivativeSecurityList m, const char *raw, int len);
+extern void	fix44_decode_DerivativeSecurityList_msg(ofixErr err, fix44DerivativeSecurityList m, ofixMsg msg);
+extern ofixMsg	fix44_encode_DerivativeSecurityList(ofixErr err, fix44DerivativeSecurityList m);
+
+// NewOrderMultileg [AB]
+enum {
+    FIX44_NewOrderMultileg_BeginString = 0,
+    FIX44_NewOrderMultileg_BodyLength = 1,
+    FIX44_NewOrderMultileg_MsgType = 2,
+    FIX44_NewOrderMultileg_SenderCompID = 3,
+    FIX44_NewOrderMultileg_TargetCompID = 4,
+    FIX44_NewOrderMultileg_OnBehalfOfCompID = 5,
+    FIX44_NewOrderMultileg_DeliverToCompID = 6,
+    FIX44_NewOrderMultileg_SecureDataLen = 7,
+    FIX44_NewOrderMultileg_SecureData = 8,
+    FIX44_NewOrderMultileg_MsgSeqNum = 9,
+    FIX44_NewOrderMultileg_SenderSubID = 10,
+    FIX44_NewOrderMultileg_SenderLocationID = 11,
+    FIX44_NewOrderMultileg_TargetSubID = 12,
+    FIX44_NewOrderMultileg_TargetLocationID = 13,
+    FIX44_NewOrderMultileg_OnBehalfOfSubID = 14,
+    FIX44_NewOrderMultileg_OnBehalfOfLocationID = 15,
+    FIX44_NewOrderMultileg_DeliverToSubID = 16,
+    FIX44_NewOrderMultileg_DeliverToLocationID = 17,
+    FIX44_NewOrderMultileg_PossDupFlag = 18,
+    FIX44_NewOrderMultileg_PossResend = 19,
+    FIX44_NewOrderMultileg_SendingTime = 20,
+    FIX44_NewOrderMultileg_OrigSendingTime = 21,
+    FIX44_NewOrderMultileg_XmlDataLen = 22,
+    FIX44_NewOrderMultileg_XmlData = 23,
+    FIX44_NewOrderMultileg_MessageEncoding = 24,
+    FIX44_NewOrderMultileg_LastMsgSeqNumProcessed = 25,
+    FIX44_NewOrderMultileg_NoHops = 26,
+    FIX44_NewOrderMultileg_ClOrdID = 27,
+    FIX44_NewOrderMultileg_SecondaryClOrdID = 28,
+    FIX44_NewOrderMultileg_ClOrdLinkID = 29,
+    FIX44_NewOrderMultileg_NoPartyIDs = 30,
+    FIX44_NewOrderMultileg_TradeOriginationDate = 31,
+    FIX44_NewOrderMultileg_TradeDate = 32,
+    FIX44_NewOrderMultileg_Account = 33,
+    FIX44_NewOrderMultileg_AcctIDSource = 34,
+    FIX44_NewOrderMultileg_AccountType = 35,
+    FIX44_NewOrderMultileg_DayBookingInst = 36,
+    FIX44_NewOrderMultileg_BookingUnit = 37,
+    FIX44_NewOrderMultileg_PreallocMethod = 38,
+    FIX44_NewOrderMultileg_AllocID = 39,
+    FIX44_NewOrderMultileg_NoAllocs = 40,
+    FIX44_NewOrderMultileg_SettlType = 41,
+    FIX44_NewOrderMultileg_SettlDate = 42,
+    FIX44_NewOrderMultileg_CashMargin = 43,
+    FIX44_NewOrderMultileg_ClearingFeeIndicator = 44,
+    FIX44_NewOrderMultileg_HandlInst = 45,
+    FIX44_NewOrderMultileg_ExecInst = 46,
+    FIX44_NewOrderMultileg_MinQty = 47,
+    FIX44_NewOrderMultileg_MaxFloor = 48,
+    FIX44_NewOrderMultileg_ExDestination = 49,
+    FIX44_NewOrderMultileg_NoTradingSessions = 50,
+    FIX44_NewOrderMultileg_ProcessCode = 51,
+    FIX44_NewOrderMultileg_Side = 52,
+    FIX44_NewOrderMultileg_Symbol = 53,
+    FIX44_NewOrderMultileg_SymbolSfx = 54,
+    FIX44_NewOrderMultileg_SecurityID = 55,
+    FIX44_NewOrderMultileg_SecurityIDSource = 56,
+    FIX44_NewOrderMultileg_NoSecurityAltID = 57,
+    FIX44_NewOrderMultileg_Product = 58,
+    FIX44_NewOrderMultileg_CFICode = 59,
+    FIX44_NewOrderMultileg_SecurityType = 60,
+    FIX44_NewOrderMultileg_SecuritySubType = 61,
+    FIX44_NewOrderMultileg_MaturityMonthYear = 62,
+    FIX44_NewOrderMultileg_MaturityDate = 63,
+    FIX44_NewOrderMultileg_CouponPaymentDate = 64,
+    FIX44_NewOrderMultileg_IssueDate = 65,
+    FIX44_NewOrderMultileg_RepoCollateralSecurityType = 66,
+    FIX44_NewOrderMultileg_RepurchaseTerm = 67,
+    FIX44_NewOrderMultileg_RepurchaseRate = 68,
+    FIX44_NewOrderMultileg_Factor = 69,
+    FIX44_NewOrderMultileg_CreditRating = 70,
+    FIX44_NewOrderMultileg_InstrRegistry = 71,
+    FIX44_NewOrderMultileg_CountryOfIssue = 72,
+    FIX44_NewOrderMultileg_StateOrProvinceOfIssue = 73,
+    FIX44_NewOrderMultileg_LocaleOfIssue = 74,
+    FIX44_NewOrderMultileg_RedemptionDate = 75,
+    FIX44_NewOrderMultileg_StrikePrice = 76,
+    FIX44_NewOrderMultileg_StrikeCurrency = 77,
+    FIX44_NewOrderMultileg_OptAttribute = 78,
+    FIX44_NewOrderMultileg_ContractMultiplier = 79,
+    FIX44_NewOrderMultileg_CouponRate = 80,
+    FIX44_NewOrderMultileg_SecurityExchange = 81,
+    FIX44_NewOrderMultileg_Issuer = 82,
+    FIX44_NewOrderMultileg_EncodedIssuerLen = 83,
+    FIX44_NewOrderMultileg_EncodedIssuer = 84,
+    FIX44_NewOrderMultileg_SecurityDesc = 85,
+    FIX44_NewOrderMultileg_EncodedSecurityDescLen = 86,
+    FIX44_NewOrderMultileg_EncodedSecurityDesc = 87,
+    FIX44_NewOrderMultileg_Pool = 88,
+    FIX44_NewOrderMultileg_ContractSettlMonth = 89,
+    FIX44_NewOrderMultileg_CPProgram = 90,
+    FIX44_NewOrderMultileg_CPRegType = 91,
+    FIX44_NewOrderMultileg_NoEvents = 92,
+    FIX44_NewOrderMultileg_DatedDate = 93,
+    FIX44_NewOrderMultileg_InterestAccrualDate = 94,
+    FIX44_NewOrderMultileg_NoUnderlyings = 95,
+    FIX44_NewOrderMultileg_PrevClosePx = 96,
+    FIX44_NewOrderMultileg_NoLegs = 97,
+    FIX44_NewOrderMultileg_LocateReqd = 98,
+    FIX44_NewOrderMultileg_TransactTime = 99,
+    FIX44_NewOrderMultileg_QtyType = 100,
+    FIX44_NewOrderMultileg_OrderQty = 101,
+    FIX44_NewOrderMultileg_CashOrderQty = 102,
+    FIX44_NewOrderMultileg_OrderPercent = 103,
+    FIX44_NewOrderMultileg_RoundingDirection = 104,
+    FIX44_NewOrderMultileg_RoundingModulus = 105,
+    FIX44_NewOrderMultileg_OrdType = 106,
+    FIX44_NewOrderMultileg_PriceType = 107,
+    FIX44_NewOrderMultileg_Price = 108,
+    FIX44_NewOrderMultileg_StopPx = 109,
+    FIX44_NewOrderMultileg_Currency = 110,
+    FIX44_NewOrderMultileg_ComplianceID = 111,
+    FIX44_NewOrderMultileg_SolicitedFlag = 112,
+    FIX44_NewOrderMultileg_IOIid = 113,
+    FIX44_NewOrderMultileg_QuoteID = 114,
+    FIX44_NewOrderMultileg_TimeInForce = 115,
+    FIX44_NewOrderMultileg_EffectiveTime = 116,
+    FIX44_NewOrderMultileg_ExpireDate = 117,
+    FIX44_NewOrderMultileg_ExpireTime = 118,
+    FIX44_NewOrderMultileg_GTBookingInst = 119,
+    FIX44_NewOrderMultileg_Commission = 120,
+    FIX44_NewOrderMultileg_CommType = 121,
+    FIX44_NewOrderMultileg_CommCurrency = 122,
+    FIX44_NewOrderMultileg_FundRenewWaiv = 123,
+    FIX44_NewOrderMultileg_OrderCapacity = 124,
+    FIX44_NewOrderMultileg_OrderRestrictions = 125,
+    FIX44_NewOrderMultileg_CustOrderCapacity = 126,
+    FIX44_NewOrderMultileg_ForexReq = 127,
+    FIX44_NewOrderMultileg_SettlCurrency = 128,
+    FIX44_NewOrderMultileg_BookingType = 129,
+    FIX44_NewOrderMultileg_Text = 130,
+    FIX44_NewOrderMultileg_EncodedTextLen = 131,
+    FIX44_NewOrderMultileg_EncodedText = 132,
+    FIX44_NewOrderMultileg_PositionEffect = 133,
+    FIX44_NewOrderMultileg_CoveredOrUncovered = 134,
+    FIX44_NewOrderMultileg_MaxShow = 135,
+    FIX44_NewOrderMultileg_PegOffsetValue = 136,
+    FIX44_NewOrderMultileg_PegMoveType = 137,
+    FIX44_NewOrderMultileg_PegOffsetType = 138,
+    FIX44_NewOrderMultileg_PegLimitType = 139,
+    FIX44_NewOrderMultileg_PegRoundDirection = 140,
+    FIX44_NewOrderMultileg_PegScope = 141,
+    FIX44_NewOrderMultileg_DiscretionInst = 142,
+    FIX44_NewOrderMultileg_DiscretionOffsetValue = 143,
+    FIX44_NewOrderMultileg_DiscretionMoveType = 144,
+    FIX44_NewOrderMultileg_DiscretionOffsetType = 145,
+    FIX44_NewOrderMultileg_DiscretionLimitType = 146,
+    FIX44_NewOrderMultileg_DiscretionRoundDirection = 147,
+    FIX44_NewOrderMultileg_DiscretionScope = 148,
+    FIX44_NewOrderMultileg_TargetStrategy = 149,
+    FIX44_NewOrderMultileg_TargetStrategyParameters = 150,
+    FIX44_NewOrderMultileg_ParticipationRate = 151,
+    FIX44_NewOrderMultileg_CancellationRights = 152,
+    FIX44_NewOrderMultileg_MoneyLaunderingStatus = 153,
+    FIX44_NewOrderMultileg_RegistID = 154,
+    FIX44_NewOrderMultileg_Designation = 155,
+    FIX44_NewOrderMultileg_MultiLegRptTypeReq = 156,
+    FIX44_NewOrderMultileg_SignatureLength = 157,
+    FIX44_NewOrderMultileg_Signature = 158,
+    FIX44_NewOrderMultileg_CheckSum = 159,
+};
+
+typedef struct _fix44NewOrderMultileg {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    struct _ofixStrView	AllocID;
+    int64_t	NoAllocs;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	PrevClosePx;
+    int64_t	NoLegs;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	QtyType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    int64_t	BookingType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegOffsetValue;
+    int64_t	PegMoveType;
+    int64_t	PegOffsetType;
+    int64_t	PegLimitType;
+    int64_t	PegRoundDirection;
+    int64_t	PegScope;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffsetValue;
+    int64_t	DiscretionMoveType;
+    int64_t	DiscretionOffsetType;
+    int64_t	DiscretionLimitType;
+    int64_t	DiscretionRoundDirection;
+    int64_t	DiscretionScope;
+    int64_t	TargetStrategy;
+    struct _ofixStrView	TargetStrategyParameters;
+    struct _ofixDecimal	ParticipationRate;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	MultiLegRptTypeReq;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44NewOrderMultileg;
+
+extern void	fix44_decode_NewOrderMultileg(ofixErr err, fix44NewOrderMultileg m, const char *raw, int len);
+extern void	fix44_decode_NewOrderMultileg_msg(ofixErr err, fix44NewOrderMultileg m, ofixMsg msg);
+extern ofixMsg	fix44_encode_NewOrderMultileg(ofixErr err, fix44NewOrderMultileg m);
+
+// MultilegOrderCancelReplaceRequest [AC]
+enum {
+    FIX44_MultilegOrderCancelReplaceRequest_BeginString = 0,
+    FIX44_MultilegOrderCancelReplaceRequest_BodyLength = 1,
+    FIX44_MultilegOrderCancelReplaceRequest_MsgType = 2,
+    FIX44_MultilegOrderCancelReplaceRequest_SenderCompID = 3,
+    FIX44_MultilegOrderCancelReplaceRequest_TargetCompID = 4,
+    FIX44_MultilegOrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX44_MultilegOrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX44_MultilegOrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX44_MultilegOrderCancelReplaceRequest_SecureData = 8,
+    FIX44_MultilegOrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX44_MultilegOrderCancelReplaceRequest_SenderSubID = 10,
+    FIX44_MultilegOrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX44_MultilegOrderCancelReplaceRequest_TargetSubID = 12,
+    FIX44_MultilegOrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX44_MultilegOrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX44_MultilegOrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX44_MultilegOrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX44_MultilegOrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX44_MultilegOrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX44_MultilegOrderCancelReplaceRequest_PossResend = 19,
+    FIX44_MultilegOrderCancelReplaceRequest_SendingTime = 20,
+    FIX44_MultilegOrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX44_MultilegOrderCancelReplaceRequest_XmlDataLen = 22,
+    FIX44_MultilegOrderCancelReplaceRequest_XmlData = 23,
+    FIX44_MultilegOrderCancelReplaceRequest_MessageEncoding = 24,
+    FIX44_MultilegOrderCancelReplaceRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_MultilegOrderCancelReplaceRequest_NoHops = 26,
+    FIX44_MultilegOrderCancelReplaceRequest_OrderID = 27,
+    FIX44_MultilegOrderCancelReplaceRequest_OrigClOrdID = 28,
+    FIX44_MultilegOrderCancelReplaceRequest_ClOrdID = 29,
+    FIX44_MultilegOrderCancelReplaceRequest_SecondaryClOrdID = 30,
+    FIX44_MultilegOrderCancelReplaceRequest_ClOrdLinkID = 31,
+    FIX44_MultilegOrderCancelReplaceRequest_OrigOrdModTime = 32,
+    FIX44_MultilegOrderCancelReplaceRequest_NoPartyIDs = 33,
+    FIX44_MultilegOrderCancelReplaceRequest_TradeOriginationDate = 34,
+    FIX44_MultilegOrderCancelReplaceRequest_TradeDate = 35,
+    FIX44_MultilegOrderCancelReplaceRequest_Account = 36,
+    FIX44_MultilegOrderCancelReplaceRequest_AcctIDSource = 37,
+    FIX44_MultilegOrderCancelReplaceRequest_AccountType = 38,
+    FIX44_MultilegOrderCancelReplaceRequest_DayBookingInst = 39,
+    FIX44_MultilegOrderCancelReplaceRequest_BookingUnit = 40,
+    FIX44_MultilegOrderCancelReplaceRequest_PreallocMethod = 41,
+    FIX44_MultilegOrderCancelReplaceRequest_AllocID = 42,
+    FIX44_MultilegOrderCancelReplaceRequest_NoAllocs = 43,
+    FIX44_MultilegOrderCancelReplaceRequest_SettlType = 44,
+    FIX44_MultilegOrderCancelReplaceRequest_SettlDate = 45,
+    FIX44_MultilegOrderCancelReplaceRequest_CashMargin = 46,
+    FIX44_MultilegOrderCancelReplaceRequest_ClearingFeeIndicator = 47,
+    FIX44_MultilegOrderCancelReplaceRequest_HandlInst = 48,
+    FIX44_MultilegOrderCancelReplaceRequest_ExecInst = 49,
+    FIX44_MultilegOrderCancelReplaceRequest_MinQty = 50,
+    FIX44_MultilegOrderCancelReplaceRequest_MaxFloor = 51,
+    FIX44_MultilegOrderCancelReplaceRequest_ExDestination = 52,
+    FIX44_MultilegOrderCancelReplaceRequest_NoTradingSessions = 53,
+    FIX44_MultilegOrderCancelReplaceRequest_ProcessCode = 54,
+    FIX44_MultilegOrderCancelReplaceRequest_Side = 55,
+    FIX44_MultilegOrderCancelReplaceRequest_Symbol = 56,
+    FIX44_MultilegOrderCancelReplaceRequest_SymbolSfx = 57,
+    FIX44_MultilegOrderCancelReplaceRequest_SecurityID = 58,
+    FIX44_MultilegOrderCancelReplaceRequest_SecurityIDSource = 59,
+    FIX44_MultilegOrderCancelReplaceRequest_NoSecurityAltID = 60,
+    FIX44_MultilegOrderCancelReplaceRequest_Product = 61,
+    FIX44_MultilegOrderCancelReplaceRequest_CFICode = 62,
+    FIX44_MultilegOrderCancelReplaceRequest_SecurityType = 63,
+    FIX44_MultilegOrderCancelReplaceRequest_SecuritySubType = 64,
+    FIX44_MultilegOrderCancelReplaceRequest_MaturityMonthYear = 65,
+    FIX44_MultilegOrderCancelReplaceRequest_MaturityDate = 66,
+    FIX44_MultilegOrderCancelReplaceRequest_CouponPaymentDate = 67,
+    FIX44_MultilegOrderCancelReplaceRequest_IssueDate = 68,
+    FIX44_MultilegOrderCancelReplaceRequest_RepoCollateralSecurityType = 69,
+    FIX44_MultilegOrderCancelReplaceRequest_RepurchaseTerm = 70,
+    FIX44_MultilegOrderCancelReplaceRequest_RepurchaseRate = 71,
+    FIX44_MultilegOrderCancelReplaceRequest_Factor = 72,
+    FIX44_MultilegOrderCancelReplaceRequest_CreditRating = 73,
+    FIX44_MultilegOrderCancelReplaceRequest_InstrRegistry = 74,
+    FIX44_MultilegOrderCancelReplaceRequest_CountryOfIssue = 75,
+    FIX44_MultilegOrderCancelReplaceRequest_StateOrProvinceOfIssue = 76,
+    FIX44_MultilegOrderCancelReplaceRequest_LocaleOfIssue = 77,
+    FIX44_MultilegOrderCancelReplaceRequest_RedemptionDate = 78,
+    FIX44_MultilegOrderCancelReplaceRequest_StrikePrice = 79,
+    FIX44_MultilegOrderCancelReplaceRequest_StrikeCurrency = 80,
+    FIX44_MultilegOrderCancelReplaceRequest_OptAttribute = 81,
+    FIX44_MultilegOrderCancelReplaceRequest_ContractMultiplier = 82,
+    FIX44_MultilegOrderCancelReplaceRequest_CouponRate = 83,
+    FIX44_MultilegOrderCancelReplaceRequest_SecurityExchange = 84,
+    FIX44_MultilegOrderCancelReplaceRequest_Issuer = 85,
+    FIX44_MultilegOrderCancelReplaceRequest_EncodedIssuerLen = 86,
+    FIX44_MultilegOrderCancelReplaceRequest_EncodedIssuer = 87,
+    FIX44_MultilegOrderCancelReplaceRequest_SecurityDesc = 88,
+    FIX44_MultilegOrderCancelReplaceRequest_EncodedSecurityDescLen = 89,
+    FIX44_MultilegOrderCancelReplaceRequest_EncodedSecurityDesc = 90,
+    FIX44_MultilegOrderCancelReplaceRequest_Pool = 91,
+    FIX44_MultilegOrderCancelReplaceRequest_ContractSettlMonth = 92,
+    FIX44_MultilegOrderCancelReplaceRequest_CPProgram = 93,
+    FIX44_MultilegOrderCancelReplaceRequest_CPRegType = 94,
+    FIX44_MultilegOrderCancelReplaceRequest_NoEvents = 95,
+    FIX44_MultilegOrderCancelReplaceRequest_DatedDate = 96,
+    FIX44_MultilegOrderCancelReplaceRequest_InterestAccrualDate = 97,
+    FIX44_MultilegOrderCancelReplaceRequest_NoUnderlyings = 98,
+    FIX44_MultilegOrderCancelReplaceRequest_PrevClosePx = 99,
+    FIX44_MultilegOrderCancelReplaceRequest_NoLegs = 100,
+    FIX44_MultilegOrderCancelReplaceRequest_LocateReqd = 101,
+    FIX44_MultilegOrderCancelReplaceRequest_TransactTime = 102,
+    FIX44_MultilegOrderCancelReplaceRequest_QtyType = 103,
+    FIX44_MultilegOrderCancelReplaceRequest_OrderQty = 104,
+    FIX44_MultilegOrderCancelReplaceRequest_CashOrderQty = 105,
+    FIX44_MultilegOrderCancelReplaceRequest_OrderPercent = 106,
+    FIX44_MultilegOrderCancelReplaceRequest_RoundingDirection = 107,
+    FIX44_MultilegOrderCancelReplaceRequest_RoundingModulus = 108,
+    FIX44_MultilegOrderCancelReplaceRequest_OrdType = 109,
+    FIX44_MultilegOrderCancelReplaceRequest_PriceType = 110,
+    FIX44_MultilegOrderCancelReplaceRequest_Price = 111,
+    FIX44_MultilegOrderCancelReplaceRequest_StopPx = 112,
+    FIX44_MultilegOrderCancelReplaceRequest_Currency = 113,
+    FIX44_MultilegOrderCancelReplaceRequest_ComplianceID = 114,
+    FIX44_MultilegOrderCancelReplaceRequest_SolicitedFlag = 115,
+    FIX44_MultilegOrderCancelReplaceRequest_IOIid = 116,
+    FIX44_MultilegOrderCancelReplaceRequest_QuoteID = 117,
+    FIX44_MultilegOrderCancelReplaceRequest_TimeInForce = 118,
+    FIX44_MultilegOrderCancelReplaceRequest_EffectiveTime = 119,
+    FIX44_MultilegOrderCancelReplaceRequest_ExpireDate = 120,
+    FIX44_MultilegOrderCancelReplaceRequest_ExpireTime = 121,
+    FIX44_MultilegOrderCancelReplaceRequest_GTBookingInst = 122,
+    FIX44_MultilegOrderCancelReplaceRequest_Commission = 123,
+    FIX44_MultilegOrderCancelReplaceRequest_CommType = 124,
+    FIX44_MultilegOrderCancelReplaceRequest_CommCurrency = 125,
+    FIX44_MultilegOrderCancelReplaceRequest_FundRenewWaiv = 126,
+    FIX44_MultilegOrderCancelReplaceRequest_OrderCapacity = 127,
+    FIX44_MultilegOrderCancelReplaceRequest_OrderRestrictions = 128,
+    FIX44_MultilegOrderCancelReplaceRequest_CustOrderCapacity = 129,
+    FIX44_MultilegOrderCancelReplaceRequest_ForexReq = 130,
+    FIX44_MultilegOrderCancelReplaceRequest_SettlCurrency = 131,
+    FIX44_MultilegOrderCancelReplaceRequest_BookingType = 132,
+    FIX44_MultilegOrderCancelReplaceRequest_Text = 133,
+    FIX44_MultilegOrderCancelReplaceRequest_EncodedTextLen = 134,
+    FIX44_MultilegOrderCancelReplaceRequest_EncodedText = 135,
+    FIX44_MultilegOrderCancelReplaceRequest_PositionEffect = 136,
+    FIX44_MultilegOrderCancelReplaceRequest_CoveredOrUncovered = 137,
+    FIX44_MultilegOrderCancelReplaceRequest_MaxShow = 138,
+    FIX44_MultilegOrderCancelReplaceRequest_PegOffsetValue = 139,
+    FIX44_MultilegOrderCancelReplaceRequest_PegMoveType = 140,
+    FIX44_MultilegOrderCancelReplaceRequest_PegOffsetType = 141,
+    FIX44_MultilegOrderCancelReplaceRequest_PegLimitType = 142,
+    FIX44_MultilegOrderCancelReplaceRequest_PegRoundDirection = 143,
+    FIX44_MultilegOrderCancelReplaceRequest_PegScope = 144,
+    FIX44_MultilegOrderCancelReplaceRequest_DiscretionInst = 145,
+    FIX44_MultilegOrderCancelReplaceRequest_DiscretionOffsetValue = 146,
+    FIX44_MultilegOrderCancelReplaceRequest_DiscretionMoveType = 147,
+    FIX44_MultilegOrderCancelReplaceRequest_DiscretionOffsetType = 148,
+    FIX44_MultilegOrderCancelReplaceRequest_DiscretionLimitType = 149,
+    FIX44_MultilegOrderCancelReplaceRequest_DiscretionRoundDirection = 150,
+    FIX44_MultilegOrderCancelReplaceRequest_DiscretionScope = 151,
+    FIX44_MultilegOrderCancelReplaceRequest_TargetStrategy = 152,
+    FIX44_MultilegOrderCancelReplaceRequest_TargetStrategyParameters = 153,
+    FIX44_MultilegOrderCancelReplaceRequest_ParticipationRate = 154,
+    FIX44_MultilegOrderCancelReplaceRequest_CancellationRights = 155,
+    FIX44_MultilegOrderCancelReplaceRequest_MoneyLaunderingStatus = 156,
+    FIX44_MultilegOrderCancelReplaceRequest_RegistID = 157,
+    FIX44_MultilegOrderCancelReplaceRequest_Designation = 158,
+    FIX44_MultilegOrderCancelReplaceRequest_MultiLegRptTypeReq = 159,
+    FIX44_MultilegOrderCancelReplaceRequest_SignatureLength = 160,
+    FIX44_MultilegOrderCancelReplaceRequest_Signature = 161,
+    FIX44_MultilegOrderCancelReplaceRequest_CheckSum = 162,
+};
+
+typedef struct _fix44MultilegOrderCancelReplaceRequest {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixDate	OrigOrdModTime;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    struct _ofixStrView	AllocID;
+    int64_t	NoAllocs;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	PrevClosePx;
+    int64_t	NoLegs;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	QtyType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    int64_t	BookingType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegOffsetValue;
+    int64_t	PegMoveType;
+    int64_t	PegOffsetType;
+    int64_t	PegLimitType;
+    int64_t	PegRoundDirection;
+    int64_t	PegScope;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffsetValue;
+    int64_t	DiscretionMoveType;
+    int64_t	DiscretionOffsetType;
+    int64_t	DiscretionLimitType;
+    int64_t	DiscretionRoundDirection;
+    int64_t	DiscretionScope;
+    int64_t	TargetStrategy;
+    struct _ofixStrView	TargetStrategyParameters;
+    struct _ofixDecimal	ParticipationRate;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	MultiLegRptTypeReq;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44MultilegOrderCancelReplaceRequest;
+
+extern void	fix44_decode_MultilegOrderCancelReplaceRequest(ofixErr err, fix44MultilegOrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix44_decode_MultilegOrderCancelReplaceRequest_msg(ofixErr err, fix44MultilegOrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_MultilegOrderCancelReplaceRequest(ofixErr err, fix44MultilegOrderCancelReplaceRequest m);
+
+// TradeCaptureReportRequest [AD]
+enum {
+    FIX44_TradeCaptureReportRequest_BeginString = 0,
+    FIX44_TradeCaptureReportRequest_BodyLength = 1,
+    FIX44_TradeCaptureReportRequest_MsgType = 2,
+    FIX44_TradeCaptureReportRequest_SenderCompID = 3,
+    FIX44_TradeCaptureReportRequest_TargetCompID = 4,
+    FIX44_TradeCaptureReportRequest_OnBehalfOfCompID = 5,
+    FIX44_TradeCaptureReportRequest_DeliverToCompID = 6,
+    FIX44_TradeCaptureReportRequest_SecureDataLen = 7,
+    FIX44_TradeCaptureReportRequest_SecureData = 8,
+    FIX44_TradeCaptureReportRequest_MsgSeqNum = 9,
+    FIX44_TradeCaptureReportRequest_SenderSubID = 10,
+    FIX44_TradeCaptureReportRequest_SenderLocationID = 11,
+    FIX44_TradeCaptureReportRequest_TargetSubID = 12,
+    FIX44_TradeCaptureReportRequest_TargetLocationID = 13,
+    FIX44_TradeCaptureReportRequest_OnBehalfOfSubID = 14,
+    FIX44_TradeCaptureReportRequest_OnBehalfOfLocationID = 15,
+    FIX44_TradeCaptureReportRequest_DeliverToSubID = 16,
+    FIX44_TradeCaptureReportRequest_DeliverToLocationID = 17,
+    FIX44_TradeCaptureReportRequest_PossDupFlag = 18,
+    FIX44_TradeCaptureReportRequest_PossResend = 19,
+    FIX44_TradeCaptureReportRequest_SendingTime = 20,
+    FIX44_TradeCaptureReportRequest_OrigSendingTime = 21,
+    FIX44_TradeCaptureReportRequest_XmlDataLen = 22,
+    FIX44_TradeCaptureReportRequest_XmlData = 23,
+    FIX44_TradeCaptureReportRequest_MessageEncoding = 24,
+    FIX44_TradeCaptureReportRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_TradeCaptureReportRequest_NoHops = 26,
+    FIX44_TradeCaptureReportRequest_TradeRequestID = 27,
+    FIX44_TradeCaptureReportRequest_TradeRequestType = 28,
+    FIX44_TradeCaptureReportRequest_SubscriptionRequestType = 29,
+    FIX44_TradeCaptureReportRequest_TradeReportID = 30,
+    FIX44_TradeCaptureReportRequest_SecondaryTradeReportID = 31,
+    FIX44_TradeCaptureReportRequest_ExecID = 32,
+    FIX44_TradeCaptureReportRequest_ExecType = 33,
+    FIX44_TradeCaptureReportRequest_OrderID = 34,
+    FIX44_TradeCaptureReportRequest_ClOrdID = 35,
+    FIX44_TradeCaptureReportRequest_MatchStatus = 36,
+    FIX44_TradeCaptureReportRequest_TrdType = 37,
+    FIX44_TradeCaptureReportRequest_TrdSubType = 38,
+    FIX44_TradeCaptureReportRequest_TransferReason = 39,
+    FIX44_TradeCaptureReportRequest_SecondaryTrdType = 40,
+    FIX44_TradeCaptureReportRequest_TradeLinkID = 41,
+    FIX44_TradeCaptureReportRequest_TrdMatchID = 42,
+    FIX44_TradeCaptureReportRequest_NoPartyIDs = 43,
+    FIX44_TradeCaptureReportRequest_Symbol = 44,
+    FIX44_TradeCaptureReportRequest_SymbolSfx = 45,
+    FIX44_TradeCaptureReportRequest_SecurityID = 46,
+    FIX44_TradeCaptureReportRequest_SecurityIDSource = 47,
+    FIX44_TradeCaptureReportRequest_NoSecurityAltID = 48,
+    FIX44_TradeCaptureReportRequest_Product = 49,
+    FIX44_TradeCaptureReportRequest_CFICode = 50,
+    FIX44_TradeCaptureReportRequest_SecurityType = 51,
+    FIX44_TradeCaptureReportRequest_SecuritySubType = 52,
+    FIX44_TradeCaptureReportRequest_MaturityMonthYear = 53,
+    FIX44_TradeCaptureReportRequest_MaturityDate = 54,
+    FIX44_TradeCaptureReportRequest_CouponPaymentDate = 55,
+    FIX44_TradeCaptureReportRequest_IssueDate = 56,
+    FIX44_TradeCaptureReportRequest_RepoCollateralSecurityType = 57,
+    FIX44_TradeCaptureReportRequest_RepurchaseTerm = 58,
+    FIX44_TradeCaptureReportRequest_RepurchaseRate = 59,
+    FIX44_TradeCaptureReportRequest_Factor = 60,
+    FIX44_TradeCaptureReportRequest_CreditRating = 61,
+    FIX44_TradeCaptureReportRequest_InstrRegistry = 62,
+    FIX44_TradeCaptureReportRequest_CountryOfIssue = 63,
+    FIX44_TradeCaptureReportRequest_StateOrProvinceOfIssue = 64,
+    FIX44_TradeCaptureReportRequest_LocaleOfIssue = 65,
+    FIX44_TradeCaptureReportRequest_RedemptionDate = 66,
+    FIX44_TradeCaptureReportRequest_StrikePrice = 67,
+    FIX44_TradeCaptureReportRequest_StrikeCurrency = 68,
+    FIX44_TradeCaptureReportRequest_OptAttribute = 69,
+    FIX44_TradeCaptureReportRequest_ContractMultiplier = 70,
+    FIX44_TradeCaptureReportRequest_CouponRate = 71,
+    FIX44_TradeCaptureReportRequest_SecurityExchange = 72,
+    FIX44_TradeCaptureReportRequest_Issuer = 73,
+    FIX44_TradeCaptureReportRequest_EncodedIssuerLen = 74,
+    FIX44_TradeCaptureReportRequest_EncodedIssuer = 75,
+    FIX44_TradeCaptureReportRequest_SecurityDesc = 76,
+    FIX44_TradeCaptureReportRequest_EncodedSecurityDescLen = 77,
+    FIX44_TradeCaptureReportRequest_EncodedSecurityDesc = 78,
+    FIX44_TradeCaptureReportRequest_Pool = 79,
+    FIX44_TradeCaptureReportRequest_ContractSettlMonth = 80,
+    FIX44_TradeCaptureReportRequest_CPProgram = 81,
+    FIX44_TradeCaptureReportRequest_CPRegType = 82,
+    FIX44_TradeCaptureReportRequest_NoEvents = 83,
+    FIX44_TradeCaptureReportRequest_DatedDate = 84,
+    FIX44_TradeCaptureReportRequest_InterestAccrualDate = 85,
+    FIX44_TradeCaptureReportRequest_DeliveryForm = 86,
+    FIX44_TradeCaptureReportRequest_PctAtRisk = 87,
+    FIX44_TradeCaptureReportRequest_NoInstrAttrib = 88,
+    FIX44_TradeCaptureReportRequest_AgreementDesc = 89,
+    FIX44_TradeCaptureReportRequest_AgreementID = 90,
+    FIX44_TradeCaptureReportRequest_AgreementDate = 91,
+    FIX44_TradeCaptureReportRequest_AgreementCurrency = 92,
+    FIX44_TradeCaptureReportRequest_TerminationType = 93,
+    FIX44_TradeCaptureReportRequest_StartDate = 94,
+    FIX44_TradeCaptureReportRequest_EndDate = 95,
+    FIX44_TradeCaptureReportRequest_DeliveryType = 96,
+    FIX44_TradeCaptureReportRequest_MarginRatio = 97,
+    FIX44_TradeCaptureReportRequest_NoUnderlyings = 98,
+    FIX44_TradeCaptureReportRequest_NoLegs = 99,
+    FIX44_TradeCaptureReportRequest_NoDates = 100,
+    FIX44_TradeCaptureReportRequest_ClearingBusinessDate = 101,
+    FIX44_TradeCaptureReportRequest_TradingSessionID = 102,
+    FIX44_TradeCaptureReportRequest_TradingSessionSubID = 103,
+    FIX44_TradeCaptureReportRequest_TimeBracket = 104,
+    FIX44_TradeCaptureReportRequest_Side = 105,
+    FIX44_TradeCaptureReportRequest_MultiLegReportingType = 106,
+    FIX44_TradeCaptureReportRequest_TradeInputSource = 107,
+    FIX44_TradeCaptureReportRequest_TradeInputDevice = 108,
+    FIX44_TradeCaptureReportRequest_ResponseTransportType = 109,
+    FIX44_TradeCaptureReportRequest_ResponseDestination = 110,
+    FIX44_TradeCaptureReportRequest_Text = 111,
+    FIX44_TradeCaptureReportRequest_EncodedTextLen = 112,
+    FIX44_TradeCaptureReportRequest_EncodedText = 113,
+    FIX44_TradeCaptureReportRequest_SignatureLength = 114,
+    FIX44_TradeCaptureReportRequest_Signature = 115,
+    FIX44_TradeCaptureReportRequest_CheckSum = 116,
+};
+
+typedef struct _fix44TradeCaptureReportRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TradeRequestID;
+    int64_t	TradeRequestType;
+    char	SubscriptionRequestType;
+    struct _ofixStrView	TradeReportID;
+    struct _ofixStrView	SecondaryTradeReportID;
+    struct _ofixStrView	ExecID;
+    char	ExecType;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    char	MatchStatus;
+    int64_t	TrdType;
+    int64_t	TrdSubType;
+    struct _ofixStrView	TransferReason;
+    int64_t	SecondaryTrdType;
+    struct _ofixStrView	TradeLinkID;
+    struct _ofixStrView	TrdMatchID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    int64_t	NoDates;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	TimeBracket;
+    char	Side;
+    char	MultiLegReportingType;
+    struct _ofixStrView	TradeInputSource;
+    struct _ofixStrView	TradeInputDevice;
+    int64_t	ResponseTransportType;
+    struct _ofixStrView	ResponseDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44TradeCaptureReportRequest;
+
+extern void	fix44_decode_TradeCaptureReportRequest(ofixErr err, fix44TradeCaptureReportRequest m, const char *raw, int len);
+extern void	fix44_decode_TradeCaptureReportRequest_msg(ofixErr err, fix44TradeCaptureReportRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_TradeCaptureReportRequest(ofixErr err, fix44TradeCaptureReportRequest m);
+
+// TradeCaptureReport [AE]
+enum {
+    FIX44_TradeCaptureReport_BeginString = 0,
+    FIX44_TradeCaptureReport_BodyLength = 1,
+    FIX44_TradeCaptureReport_MsgType = 2,
+    FIX44_TradeCaptureReport_SenderCompID = 3,
+    FIX44_TradeCaptureReport_TargetCompID = 4,
+    FIX44_TradeCaptureReport_OnBehalfOfCompID = 5,
+    FIX44_TradeCaptureReport_DeliverToCompID = 6,
+    FIX44_TradeCaptureReport_SecureDataLen = 7,
+    FIX44_TradeCaptureReport_SecureData = 8,
+    FIX44_TradeCaptureReport_MsgSeqNum = 9,
+    FIX44_TradeCaptureReport_SenderSubID = 10,
+    FIX44_TradeCaptureReport_SenderLocationID = 11,
+    FIX44_TradeCaptureReport_TargetSubID = 12,
+    FIX44_TradeCaptureReport_TargetLocationID = 13,
+    FIX44_TradeCaptureReport_OnBehalfOfSubID = 14,
+    FIX44_TradeCaptureReport_OnBehalfOfLocationID = 15,
+    FIX44_TradeCaptureReport_DeliverToSubID = 16,
+    FIX44_TradeCaptureReport_DeliverToLocationID = 17,
+    FIX44_TradeCaptureReport_PossDupFlag = 18,
+    FIX44_TradeCaptureReport_PossResend = 19,
+    FIX44_TradeCaptureReport_SendingTime = 20,
+    FIX44_TradeCaptureReport_OrigSendingTime = 21,
+    FIX44_TradeCaptureReport_XmlDataLen = 22,
+    FIX44_TradeCaptureReport_XmlData = 23,
+    FIX44_TradeCaptureReport_MessageEncoding = 24,
+    FIX44_TradeCaptureReport_LastMsgSeqNumProcessed = 25,
+    FIX44_TradeCaptureReport_NoHops = 26,
+    FIX44_TradeCaptureReport_TradeReportID = 27,
+    FIX44_TradeCaptureReport_TradeReportTransType = 28,
+    FIX44_TradeCaptureReport_TradeReportType = 29,
+    FIX44_TradeCaptureReport_TradeRequestID = 30,
+    FIX44_TradeCaptureReport_TrdType = 31,
+    FIX44_TradeCaptureReport_TrdSubType = 32,
+    FIX44_TradeCaptureReport_SecondaryTrdType = 33,
+    FIX44_TradeCaptureReport_TransferReason = 34,
+    FIX44_TradeCaptureReport_ExecType = 35,
+    FIX44_TradeCaptureReport_TotNumTradeReports = 36,
+    FIX44_TradeCaptureReport_LastRptRequested = 37,
+    FIX44_TradeCaptureReport_UnsolicitedIndicator = 38,
+    FIX44_TradeCaptureReport_SubscriptionRequestType = 39,
+    FIX44_TradeCaptureReport_TradeReportRefID = 40,
+    FIX44_TradeCaptureReport_SecondaryTradeReportRefID = 41,
+    FIX44_TradeCaptureReport_SecondaryTradeReportID = 42,
+    FIX44_TradeCaptureReport_TradeLinkID = 43,
+    FIX44_TradeCaptureReport_TrdMatchID = 44,
+    FIX44_TradeCaptureReport_ExecID = 45,
+    FIX44_TradeCaptureReport_OrdStatus = 46,
+    FIX44_TradeCaptureReport_SecondaryExecID = 47,
+    FIX44_TradeCaptureReport_ExecRestatementReason = 48,
+    FIX44_TradeCaptureReport_PreviouslyReported = 49,
+    FIX44_TradeCaptureReport_PriceType = 50,
+    FIX44_TradeCaptureReport_Symbol = 51,
+    FIX44_TradeCaptureReport_SymbolSfx = 52,
+    FIX44_TradeCaptureReport_SecurityID = 53,
+    FIX44_TradeCaptureReport_SecurityIDSource = 54,
+    FIX44_TradeCaptureReport_NoSecurityAltID = 55,
+    FIX44_TradeCaptureReport_Product = 56,
+    FIX44_TradeCaptureReport_CFICode = 57,
+    FIX44_TradeCaptureReport_SecurityType = 58,
+    FIX44_TradeCaptureReport_SecuritySubType = 59,
+    FIX44_TradeCaptureReport_MaturityMonthYear = 60,
+    FIX44_TradeCaptureReport_MaturityDate = 61,
+    FIX44_TradeCaptureReport_CouponPaymentDate = 62,
+    FIX44_TradeCaptureReport_IssueDate = 63,
+    FIX44_TradeCaptureReport_RepoCollateralSecurityType = 64,
+    FIX44_TradeCaptureReport_RepurchaseTerm = 65,
+    FIX44_TradeCaptureReport_RepurchaseRate = 66,
+    FIX44_TradeCaptureReport_Factor = 67,
+    FIX44_TradeCaptureReport_CreditRating = 68,
+    FIX44_TradeCaptureReport_InstrRegistry = 69,
+    FIX44_TradeCaptureReport_CountryOfIssue = 70,
+    FIX44_TradeCaptureReport_StateOrProvinceOfIssue = 71,
+    FIX44_TradeCaptureReport_LocaleOfIssue = 72,
+    FIX44_TradeCaptureReport_RedemptionDate = 73,
+    FIX44_TradeCaptureReport_StrikePrice = 74,
+    FIX44_TradeCaptureReport_StrikeCurrency = 75,
+    FIX44_TradeCaptureReport_OptAttribute = 76,
+    FIX44_TradeCaptureReport_ContractMultiplier = 77,
+    FIX44_TradeCaptureReport_CouponRate = 78,
+    FIX44_TradeCaptureReport_SecurityExchange = 79,
+    FIX44_TradeCaptureReport_Issuer = 80,
+    FIX44_TradeCaptureReport_EncodedIssuerLen = 81,
+    FIX44_TradeCaptureReport_EncodedIssuer = 82,
+    FIX44_TradeCaptureReport_SecurityDesc = 83,
+    FIX44_TradeCaptureReport_EncodedSecurityDescLen = 84,
+    FIX44_TradeCaptureReport_EncodedSecurityDesc = 85,
+    FIX44_TradeCaptureReport_Pool = 86,
+    FIX44_TradeCaptureReport_ContractSettlMonth = 87,
+    FIX44_TradeCaptureReport_CPProgram = 88,
+    FIX44_TradeCaptureReport_CPRegType = 89,
+    FIX44_TradeCaptureReport_NoEvents = 90,
+    FIX44_TradeCaptureReport_DatedDate = 91,
+    FIX44_TradeCaptureReport_InterestAccrualDate = 92,
+    FIX44_TradeCaptureReport_AgreementDesc = 93,
+    FIX44_TradeCaptureReport_AgreementID = 94,
+    FIX44_TradeCaptureReport_AgreementDate = 95,
+    FIX44_TradeCaptureReport_AgreementCurrency = 96,
+    FIX44_TradeCaptureReport_TerminationType = 97,
+    FIX44_TradeCaptureReport_StartDate = 98,
+    FIX44_TradeCaptureReport_EndDate = 99,
+    FIX44_TradeCaptureReport_DeliveryType = 100,
+    FIX44_TradeCaptureReport_MarginRatio = 101,
+    FIX44_TradeCaptureReport_OrderQty = 102,
+    FIX44_TradeCaptureReport_CashOrderQty = 103,
+    FIX44_TradeCaptureReport_OrderPercent = 104,
+    FIX44_TradeCaptureReport_RoundingDirection = 105,
+    FIX44_TradeCaptureReport_RoundingModulus = 106,
+    FIX44_TradeCaptureReport_QtyType = 107,
+    FIX44_TradeCaptureReport_YieldType = 108,
+    FIX44_TradeCaptureReport_Yield = 109,
+    FIX44_TradeCaptureReport_YieldCalcDate = 110,
+    FIX44_TradeCaptureReport_YieldRedemptionDate = 111,
+    FIX44_TradeCaptureReport_YieldRedemptionPrice = 112,
+    FIX44_TradeCaptureReport_YieldRedemptionPriceType = 113,
+    FIX44_TradeCaptureReport_NoUnderlyings = 114,
+    FIX44_TradeCaptureReport_UnderlyingTradingSessionID = 115,
+    FIX44_TradeCaptureReport_UnderlyingTradingSessionSubID = 116,
+    FIX44_TradeCaptureReport_LastQty = 117,
+    FIX44_TradeCaptureReport_LastPx = 118,
+    FIX44_TradeCaptureReport_LastParPx = 119,
+    FIX44_TradeCaptureReport_LastSpotRate = 120,
+    FIX44_TradeCaptureReport_LastForwardPoints = 121,
+    FIX44_TradeCaptureReport_LastMkt = 122,
+    FIX44_TradeCaptureReport_TradeDate = 123,
+    FIX44_TradeCaptureReport_ClearingBusinessDate = 124,
+    FIX44_TradeCaptureReport_AvgPx = 125,
+    FIX44_TradeCaptureReport_Spread = 126,
+    FIX44_TradeCaptureReport_BenchmarkCurveCurrency = 127,
+    FIX44_TradeCaptureReport_BenchmarkCurveName = 128,
+    FIX44_TradeCaptureReport_BenchmarkCurvePoint = 129,
+    FIX44_TradeCaptureReport_BenchmarkPrice = 130,
+    FIX44_TradeCaptureReport_BenchmarkPriceType = 131,
+    FIX44_TradeCaptureReport_BenchmarkSecurityID = 132,
+    FIX44_TradeCaptureReport_BenchmarkSecurityIDSource = 133,
+    FIX44_TradeCaptureReport_AvgPxIndicator = 134,
+    FIX44_TradeCaptureReport_NoPosAmt = 135,
+    FIX44_TradeCaptureReport_MultiLegReportingType = 136,
+    FIX44_TradeCaptureReport_TradeLegRefID = 137,
+    FIX44_TradeCaptureReport_NoLegs = 138,
+    FIX44_TradeCaptureReport_TransactTime = 139,
+    FIX44_TradeCaptureReport_NoTrdRegTimestamps = 140,
+    FIX44_TradeCaptureReport_SettlType = 141,
+    FIX44_TradeCaptureReport_SettlDate = 142,
+    FIX44_TradeCaptureReport_MatchStatus = 143,
+    FIX44_TradeCaptureReport_MatchType = 144,
+    FIX44_TradeCaptureReport_NoSides = 145,
+    FIX44_TradeCaptureReport_CopyMsgIndicator = 146,
+    FIX44_TradeCaptureReport_PublishTrdIndicator = 147,
+    FIX44_TradeCaptureReport_ShortSaleReason = 148,
+    FIX44_TradeCaptureReport_SignatureLength = 149,
+    FIX44_TradeCaptureReport_Signature = 150,
+    FIX44_TradeCaptureReport_CheckSum = 151,
+};
+
+typedef struct _fix44TradeCaptureReport {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TradeReportID;
+    int64_t	TradeReportTransType;
+    int64_t	TradeReportType;
+    struct _ofixStrView	TradeRequestID;
+    int64_t	TrdType;
+    int64_t	TrdSubType;
+    int64_t	SecondaryTrdType;
+    struct _ofixStrView	TransferReason;
+    char	ExecType;
+    int64_t	TotNumTradeReports;
+    char	LastRptRequested;
+    char	UnsolicitedIndicator;
+    char	SubscriptionRequestType;
+    struct _ofixStrView	TradeReportRefID;
+    struct _ofixStrView	SecondaryTradeReportRefID;
+    struct _ofixStrView	SecondaryTradeReportID;
+    struct _ofixStrView	TradeLinkID;
+    struct _ofixStrView	TrdMatchID;
+    struct _ofixStrView	ExecID;
+    char	OrdStatus;
+    struct _ofixStrView	SecondaryExecID;
+    int64_t	ExecRestatementReason;
+    char	PreviouslyReported;
+    int64_t	PriceType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    int64_t	QtyType;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    int64_t	NoUnderlyings;
+    struct _ofixStrView	UnderlyingTradingSessionID;
+    struct _ofixStrView	UnderlyingTradingSessionSubID;
+    struct _ofixDecimal	LastQty;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDecimal	LastParPx;
+    struct _ofixDecimal	LastSpotRate;
+    struct _ofixDecimal	LastForwardPoints;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    int64_t	AvgPxIndicator;
+    int64_t	NoPosAmt;
+    char	MultiLegReportingType;
+    struct _ofixStrView	TradeLegRefID;
+    int64_t	NoLegs;
+    struct _ofixDate	TransactTime;
+    int64_t	NoTrdRegTimestamps;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	MatchStatus;
+    struct _ofixStrView	MatchType;
+    int64_t	NoSides;
+    char	CopyMsgIndicator;
+    char	PublishTrdIndicator;
+    int64_t	ShortSaleReason;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44TradeCaptureReport;
+
+extern void	fix44_decode_TradeCaptureReport(ofixErr err, fix44TradeCaptureReport m, const char *raw, int len);
+extern void	fix44_decode_TradeCaptureReport_msg(ofixErr err, fix44TradeCaptureReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_TradeCaptureReport(ofixErr err, fix44TradeCaptureReport m);
+
+// OrderMassStatusRequest [AF]
+enum {
+    FIX44_OrderMassStatusRequest_BeginString = 0,
+    FIX44_OrderMassStatusRequest_BodyLength = 1,
+    FIX44_OrderMassStatusRequest_MsgType = 2,
+    FIX44_OrderMassStatusRequest_SenderCompID = 3,
+    FIX44_OrderMassStatusRequest_TargetCompID = 4,
+    FIX44_OrderMassStatusRequest_OnBehalfOfCompID = 5,
+    FIX44_OrderMassStatusRequest_DeliverToCompID = 6,
+    FIX44_OrderMassStatusRequest_SecureDataLen = 7,
+    FIX44_OrderMassStatusRequest_SecureData = 8,
+    FIX44_OrderMassStatusRequest_MsgSeqNum = 9,
+    FIX44_OrderMassStatusRequest_SenderSubID = 10,
+    FIX44_OrderMassStatusRequest_SenderLocationID = 11,
+    FIX44_OrderMassStatusRequest_TargetSubID = 12,
+    FIX44_OrderMassStatusRequest_TargetLocationID = 13,
+    FIX44_OrderMassStatusRequest_OnBehalfOfSubID = 14,
+    FIX44_OrderMassStatusRequest_OnBehalfOfLocationID = 15,
+    FIX44_OrderMassStatusRequest_DeliverToSubID = 16,
+    FIX44_OrderMassStatusRequest_DeliverToLocationID = 17,
+    FIX44_OrderMassStatusRequest_PossDupFlag = 18,
+    FIX44_OrderMassStatusRequest_PossResend = 19,
+    FIX44_OrderMassStatusRequest_SendingTime = 20,
+    FIX44_OrderMassStatusRequest_OrigSendingTime = 21,
+    FIX44_OrderMassStatusRequest_XmlDataLen = 22,
+    FIX44_OrderMassStatusRequest_XmlData = 23,
+    FIX44_OrderMassStatusRequest_MessageEncoding = 24,
+    FIX44_OrderMassStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_OrderMassStatusRequest_NoHops = 26,
+    FIX44_OrderMassStatusRequest_MassStatusReqID = 27,
+    FIX44_OrderMassStatusRequest_MassStatusReqType = 28,
+    FIX44_OrderMassStatusRequest_NoPartyIDs = 29,
+    FIX44_OrderMassStatusRequest_Account = 30,
+    FIX44_OrderMassStatusRequest_AcctIDSource = 31,
+    FIX44_OrderMassStatusRequest_TradingSessionID = 32,
+    FIX44_OrderMassStatusRequest_TradingSessionSubID = 33,
+    FIX44_OrderMassStatusRequest_Symbol = 34,
+    FIX44_OrderMassStatusRequest_SymbolSfx = 35,
+    FIX44_OrderMassStatusRequest_SecurityID = 36,
+    FIX44_OrderMassStatusRequest_SecurityIDSource = 37,
+    FIX44_OrderMassStatusRequest_NoSecurityAltID = 38,
+    FIX44_OrderMassStatusRequest_Product = 39,
+    FIX44_OrderMassStatusRequest_CFICode = 40,
+    FIX44_OrderMassStatusRequest_SecurityType = 41,
+    FIX44_OrderMassStatusRequest_SecuritySubType = 42,
+    FIX44_OrderMassStatusRequest_MaturityMonthYear = 43,
+    FIX44_OrderMassStatusRequest_MaturityDate = 44,
+    FIX44_OrderMassStatusRequest_CouponPaymentDate = 45,
+    FIX44_OrderMassStatusRequest_IssueDate = 46,
+    FIX44_OrderMassStatusRequest_RepoCollateralSecurityType = 47,
+    FIX44_OrderMassStatusRequest_RepurchaseTerm = 48,
+    FIX44_OrderMassStatusRequest_RepurchaseRate = 49,
+    FIX44_OrderMassStatusRequest_Factor = 50,
+    FIX44_OrderMassStatusRequest_CreditRating = 51,
+    FIX44_OrderMassStatusRequest_InstrRegistry = 52,
+    FIX44_OrderMassStatusRequest_CountryOfIssue = 53,
+    FIX44_OrderMassStatusRequest_StateOrProvinceOfIssue = 54,
+    FIX44_OrderMassStatusRequest_LocaleOfIssue = 55,
+    FIX44_OrderMassStatusRequest_RedemptionDate = 56,
+    FIX44_OrderMassStatusRequest_StrikePrice = 57,
+    FIX44_OrderMassStatusRequest_StrikeCurrency = 58,
+    FIX44_OrderMassStatusRequest_OptAttribute = 59,
+    FIX44_OrderMassStatusRequest_ContractMultiplier = 60,
+    FIX44_OrderMassStatusRequest_CouponRate = 61,
+    FIX44_OrderMassStatusRequest_SecurityExchange = 62,
+    FIX44_OrderMassStatusRequest_Issuer = 63,
+    FIX44_OrderMassStatusRequest_EncodedIssuerLen = 64,
+    FIX44_OrderMassStatusRequest_EncodedIssuer = 65,
+    FIX44_OrderMassStatusRequest_SecurityDesc = 66,
+    FIX44_OrderMassStatusRequest_EncodedSecurityDescLen = 67,
+    FIX44_OrderMassStatusRequest_EncodedSecurityDesc = 68,
+    FIX44_OrderMassStatusRequest_Pool = 69,
+    FIX44_OrderMassStatusRequest_ContractSettlMonth = 70,
+    FIX44_OrderMassStatusRequest_CPProgram = 71,
+    FIX44_OrderMassStatusRequest_CPRegType = 72,
+    FIX44_OrderMassStatusRequest_NoEvents = 73,
+    FIX44_OrderMassStatusRequest_DatedDate = 74,
+    FIX44_OrderMassStatusRequest_InterestAccrualDate = 75,
+    FIX44_OrderMassStatusRequest_UnderlyingSymbol = 76,
+    FIX44_OrderMassStatusRequest_UnderlyingSymbolSfx = 77,
+    FIX44_OrderMassStatusRequest_UnderlyingSecurityID = 78,
+    FIX44_OrderMassStatusRequest_UnderlyingSecurityIDSource = 79,
+    FIX44_OrderMassStatusRequest_NoUnderlyingSecurityAltID = 80,
+    FIX44_OrderMassStatusRequest_UnderlyingProduct = 81,
+    FIX44_OrderMassStatusRequest_UnderlyingCFICode = 82,
+    FIX44_OrderMassStatusRequest_UnderlyingSecurityType = 83,
+    FIX44_OrderMassStatusRequest_UnderlyingSecuritySubType = 84,
+    FIX44_OrderMassStatusRequest_UnderlyingMaturityMonthYear = 85,
+    FIX44_OrderMassStatusRequest_UnderlyingMaturityDate = 86,
+    FIX44_OrderMassStatusRequest_UnderlyingCouponPaymentDate = 87,
+    FIX44_OrderMassStatusRequest_UnderlyingIssueDate = 88,
+    FIX44_OrderMassStatusRequest_UnderlyingRepoCollateralSecurityType = 89,
+    FIX44_OrderMassStatusRequest_UnderlyingRepurchaseTerm = 90,
+    FIX44_OrderMassStatusRequest_UnderlyingRepurchaseRate = 91,
+    FIX44_OrderMassStatusRequest_UnderlyingFactor = 92,
+    FIX44_OrderMassStatusRequest_UnderlyingCreditRating = 93,
+    FIX44_OrderMassStatusRequest_UnderlyingInstrRegistry = 94,
+    FIX44_OrderMassStatusRequest_UnderlyingCountryOfIssue = 95,
+    FIX44_OrderMassStatusRequest_UnderlyingStateOrProvinceOfIssue = 96,
+    FIX44_OrderMassStatusRequest_UnderlyingLocaleOfIssue = 97,
+    FIX44_OrderMassStatusRequest_UnderlyingRedemptionDate = 98,
+    FIX44_OrderMassStatusRequest_UnderlyingStrikePrice = 99,
+    FIX44_OrderMassStatusRequest_UnderlyingStrikeCurrency = 100,
+    FIX44_OrderMassStatusRequest_UnderlyingOptAttribute = 101,
+    FIX44_OrderMassStatusRequest_UnderlyingContractMultiplier = 102,
+    FIX44_OrderMassStatusRequest_UnderlyingCouponRate = 103,
+    FIX44_OrderMassStatusRequest_UnderlyingSecurityExchange = 104,
+    FIX44_OrderMassStatusRequest_UnderlyingIssuer = 105,
+    FIX44_OrderMassStatusRequest_EncodedUnderlyingIssuerLen = 106,
+    FIX44_OrderMassStatusRequest_EncodedUnderlyingIssuer = 107,
+    FIX44_OrderMassStatusRequest_UnderlyingSecurityDesc = 108,
+    FIX44_OrderMassStatusRequest_EncodedUnderlyingSecurityDescLen = 109,
+    FIX44_OrderMassStatusRequest_EncodedUnderlyingSecurityDesc = 110,
+    FIX44_OrderMassStatusRequest_UnderlyingCPProgram = 111,
+    FIX44_OrderMassStatusRequest_UnderlyingCPRegType = 112,
+    FIX44_OrderMassStatusRequest_UnderlyingCurrency = 113,
+    FIX44_OrderMassStatusRequest_UnderlyingQty = 114,
+    FIX44_OrderMassStatusRequest_UnderlyingPx = 115,
+    FIX44_OrderMassStatusRequest_UnderlyingDirtyPrice = 116,
+    FIX44_OrderMassStatusRequest_UnderlyingEndPrice = 117,
+    FIX44_OrderMassStatusRequest_UnderlyingStartValue = 118,
+    FIX44_OrderMassStatusRequest_UnderlyingCurrentValue = 119,
+    FIX44_OrderMassStatusRequest_UnderlyingEndValue = 120,
+    FIX44_OrderMassStatusRequest_NoUnderlyingStips = 121,
+    FIX44_OrderMassStatusRequest_Side = 122,
+    FIX44_OrderMassStatusRequest_SignatureLength = 123,
+    FIX44_OrderMassStatusRequest_Signature = 124,
+    FIX44_OrderMassStatusRequest_CheckSum = 125,
+};
+
+typedef struct _fix44OrderMassStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	MassStatusReqID;
+    int64_t	MassStatusReqType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingSecuritySubType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixStrView	UnderlyingCouponPaymentDate;
+    struct _ofixStrView	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixStrView	UnderlyingRedemptionDate;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    struct _ofixStrView	UnderlyingStrikeCurrency;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    struct _ofixStrView	UnderlyingCPProgram;
+    struct _ofixStrView	UnderlyingCPRegType;
+    struct _ofixStrView	UnderlyingCurrency;
+    struct _ofixDecimal	UnderlyingQty;
+    struct _ofixDecimal	UnderlyingPx;
+    struct _ofixDecimal	UnderlyingDirtyPrice;
+    struct _ofixDecimal	UnderlyingEndPrice;
+    struct _ofixDecimal	UnderlyingStartValue;
+    struct _ofixDecimal	UnderlyingCurrentValue;
+    struct _ofixDecimal	UnderlyingEndValue;
+    int64_t	NoUnderlyingStips;
+    char	Side;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44OrderMassStatusRequest;
+
+extern void	fix44_decode_OrderMassStatusRequest(ofixErr err, fix44OrderMassStatusRequest m, const char *raw, int len);
+extern void	fix44_decode_OrderMassStatusRequest_msg(ofixErr err, fix44OrderMassStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_OrderMassStatusRequest(ofixErr err, fix44OrderMassStatusRequest m);
+
+// QuoteRequestReject [AG]
+enum {
+    FIX44_QuoteRequestReject_BeginString = 0,
+    FIX44_QuoteRequestReject_BodyLength = 1,
+    FIX44_QuoteRequestReject_MsgType = 2,
+    FIX44_QuoteRequestReject_SenderCompID = 3,
+    FIX44_QuoteRequestReject_TargetCompID = 4,
+    FIX44_QuoteRequestReject_OnBehalfOfCompID = 5,
+    FIX44_QuoteRequestReject_DeliverToCompID = 6,
+    FIX44_QuoteRequestReject_SecureDataLen = 7,
+    FIX44_QuoteRequestReject_SecureData = 8,
+    FIX44_QuoteRequestReject_MsgSeqNum = 9,
+    FIX44_QuoteRequestReject_SenderSubID = 10,
+    FIX44_QuoteRequestReject_SenderLocationID = 11,
+    FIX44_QuoteRequestReject_TargetSubID = 12,
+    FIX44_QuoteRequestReject_TargetLocationID = 13,
+    FIX44_QuoteRequestReject_OnBehalfOfSubID = 14,
+    FIX44_QuoteRequestReject_OnBehalfOfLocationID = 15,
+    FIX44_QuoteRequestReject_DeliverToSubID = 16,
+    FIX44_QuoteRequestReject_DeliverToLocationID = 17,
+    FIX44_QuoteRequestReject_PossDupFlag = 18,
+    FIX44_QuoteRequestReject_PossResend = 19,
+    FIX44_QuoteRequestReject_SendingTime = 20,
+    FIX44_QuoteRequestReject_OrigSendingTime = 21,
+    FIX44_QuoteRequestReject_XmlDataLen = 22,
+    FIX44_QuoteRequestReject_XmlData = 23,
+    FIX44_QuoteRequestReject_MessageEncoding = 24,
+    FIX44_QuoteRequestReject_LastMsgSeqNumProcessed = 25,
+    FIX44_QuoteRequestReject_NoHops = 26,
+    FIX44_QuoteRequestReject_QuoteReqID = 27,
+    FIX44_QuoteRequestReject_RFQReqID = 28,
+    FIX44_QuoteRequestReject_QuoteRequestRejectReason = 29,
+    FIX44_QuoteRequestReject_NoRelatedSym = 30,
+    FIX44_QuoteRequestReject_NoQuoteQualifiers = 31,
+    FIX44_QuoteRequestReject_QuotePriceType = 32,
+    FIX44_QuoteRequestReject_OrdType = 33,
+    FIX44_QuoteRequestReject_ExpireTime = 34,
+    FIX44_QuoteRequestReject_TransactTime = 35,
+    FIX44_QuoteRequestReject_Spread = 36,
+    FIX44_QuoteRequestReject_BenchmarkCurveCurrency = 37,
+    FIX44_QuoteRequestReject_BenchmarkCurveName = 38,
+    FIX44_QuoteRequestReject_BenchmarkCurvePoint = 39,
+    FIX44_QuoteRequestReject_BenchmarkPrice = 40,
+    FIX44_QuoteRequestReject_BenchmarkPriceType = 41,
+    FIX44_QuoteRequestReject_BenchmarkSecurityID = 42,
+    FIX44_QuoteRequestReject_BenchmarkSecurityIDSource = 43,
+    FIX44_QuoteRequestReject_PriceType = 44,
+    FIX44_QuoteRequestReject_Price = 45,
+    FIX44_QuoteRequestReject_Price2 = 46,
+    FIX44_QuoteRequestReject_YieldType = 47,
+    FIX44_QuoteRequestReject_Yield = 48,
+    FIX44_QuoteRequestReject_YieldCalcDate = 49,
+    FIX44_QuoteRequestReject_YieldRedemptionDate = 50,
+    FIX44_QuoteRequestReject_YieldRedemptionPrice = 51,
+    FIX44_QuoteRequestReject_YieldRedemptionPriceType = 52,
+    FIX44_QuoteRequestReject_NoPartyIDs = 53,
+    FIX44_QuoteRequestReject_Text = 54,
+    FIX44_QuoteRequestReject_EncodedTextLen = 55,
+    FIX44_QuoteRequestReject_EncodedText = 56,
+    FIX44_QuoteRequestReject_SignatureLength = 57,
+    FIX44_QuoteRequestReject_Signature = 58,
+    FIX44_QuoteRequestReject_CheckSum = 59,
+};
+
+typedef struct _fix44QuoteRequestReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	RFQReqID;
+    int64_t	QuoteRequestRejectReason;
+    int64_t	NoRelatedSym;
+    int64_t	NoQuoteQualifiers;
+    int64_t	QuotePriceType;
+    char	OrdType;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDate	TransactTime;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	Price2;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44QuoteRequestReject;
+
+extern void	fix44_decode_QuoteRequestReject(ofixErr err, fix44QuoteRequestReject m, const char *raw, int len);
+extern void	fix44_decode_QuoteRequestReject_msg(ofixErr err, fix44QuoteRequestReject m, ofixMsg msg);
+extern ofixMsg	fix44_encode_QuoteRequestReject(ofixErr err, fix44QuoteRequestReject m);
+
+// RFQRequest [AH]
+enum {
+    FIX44_RFQRequest_BeginString = 0,
+    FIX44_RFQRequest_BodyLength = 1,
+    FIX44_RFQRequest_MsgType = 2,
+    FIX44_RFQRequest_SenderCompID = 3,
+    FIX44_RFQRequest_TargetCompID = 4,
+    FIX44_RFQRequest_OnBehalfOfCompID = 5,
+    FIX44_RFQRequest_DeliverToCompID = 6,
+    FIX44_RFQRequest_SecureDataLen = 7,
+    FIX44_RFQRequest_SecureData = 8,
+    FIX44_RFQRequest_MsgSeqNum = 9,
+    FIX44_RFQRequest_SenderSubID = 10,
+    FIX44_RFQRequest_SenderLocationID = 11,
+    FIX44_RFQRequest_TargetSubID = 12,
+    FIX44_RFQRequest_TargetLocationID = 13,
+    FIX44_RFQRequest_OnBehalfOfSubID = 14,
+    FIX44_RFQRequest_OnBehalfOfLocationID = 15,
+    FIX44_RFQRequest_DeliverToSubID = 16,
+    FIX44_RFQRequest_DeliverToLocationID = 17,
+    FIX44_RFQRequest_PossDupFlag = 18,
+    FIX44_RFQRequest_PossResend = 19,
+    FIX44_RFQRequest_SendingTime = 20,
+    FIX44_RFQRequest_OrigSendingTime = 21,
+    FIX44_RFQRequest_XmlDataLen = 22,
+    FIX44_RFQRequest_XmlData = 23,
+    FIX44_RFQRequest_MessageEncoding = 24,
+    FIX44_RFQRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_RFQRequest_NoHops = 26,
+    FIX44_RFQRequest_RFQReqID = 27,
+    FIX44_RFQRequest_NoRelatedSym = 28,
+    FIX44_RFQRequest_SubscriptionRequestType = 29,
+    FIX44_RFQRequest_SignatureLength = 30,
+    FIX44_RFQRequest_Signature = 31,
+    FIX44_RFQRequest_CheckSum = 32,
+};
+
+typedef struct _fix44RFQRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	RFQReqID;
+    int64_t	NoRelatedSym;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44RFQRequest;
+
+extern void	fix44_decode_RFQRequest(ofixErr err, fix44RFQRequest m, const char *raw, int len);
+extern void	fix44_decode_RFQRequest_msg(ofixErr err, fix44RFQRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_RFQRequest(ofixErr err, fix44RFQRequest m);
+
+// QuoteStatusReport [AI]
+enum {
+    FIX44_QuoteStatusReport_BeginString = 0,
+    FIX44_QuoteStatusReport_BodyLength = 1,
+    FIX44_QuoteStatusReport_MsgType = 2,
+    FIX44_QuoteStatusReport_SenderCompID = 3,
+    FIX44_QuoteStatusReport_TargetCompID = 4,
+    FIX44_QuoteStatusReport_OnBehalfOfCompID = 5,
+    FIX44_QuoteStatusReport_DeliverToCompID = 6,
+    FIX44_QuoteStatusReport_SecureDataLen = 7,
+    FIX44_QuoteStatusReport_SecureData = 8,
+    FIX44_QuoteStatusReport_MsgSeqNum = 9,
+    FIX44_QuoteStatusReport_SenderSubID = 10,
+    FIX44_QuoteStatusReport_SenderLocationID = 11,
+    FIX44_QuoteStatusReport_TargetSubID = 12,
+    FIX44_QuoteStatusReport_TargetLocationID = 13,
+    FIX44_QuoteStatusReport_OnBehalfOfSubID = 14,
+    FIX44_QuoteStatusReport_OnBehalfOfLocationID = 15,
+    FIX44_QuoteStatusReport_DeliverToSubID = 16,
+    FIX44_QuoteStatusReport_DeliverToLocationID = 17,
+    FIX44_QuoteStatusReport_PossDupFlag = 18,
+    FIX44_QuoteStatusReport_PossResend = 19,
+    FIX44_QuoteStatusReport_SendingTime = 20,
+    FIX44_QuoteStatusReport_OrigSendingTime = 21,
+    FIX44_QuoteStatusReport_XmlDataLen = 22,
+    FIX44_QuoteStatusReport_XmlData = 23,
+    FIX44_QuoteStatusReport_MessageEncoding = 24,
+    FIX44_QuoteStatusReport_LastMsgSeqNumProcessed = 25,
+    FIX44_QuoteStatusReport_NoHops = 26,
+    FIX44_QuoteStatusReport_QuoteStatusReqID = 27,
+    FIX44_QuoteStatusReport_QuoteReqID = 28,
+    FIX44_QuoteStatusReport_QuoteID = 29,
+    FIX44_QuoteStatusReport_QuoteRespID = 30,
+    FIX44_QuoteStatusReport_QuoteType = 31,
+    FIX44_QuoteStatusReport_NoPartyIDs = 32,
+    FIX44_QuoteStatusReport_TradingSessionID = 33,
+    FIX44_QuoteStatusReport_TradingSessionSubID = 34,
+    FIX44_QuoteStatusReport_Symbol = 35,
+    FIX44_QuoteStatusReport_SymbolSfx = 36,
+    FIX44_QuoteStatusReport_SecurityID = 37,
+    FIX44_QuoteStatusReport_SecurityIDSource = 38,
+    FIX44_QuoteStatusReport_NoSecurityAltID = 39,
+    FIX44_QuoteStatusReport_Product = 40,
+    FIX44_QuoteStatusReport_CFICode = 41,
+    FIX44_QuoteStatusReport_SecurityType = 42,
+    FIX44_QuoteStatusReport_SecuritySubType = 43,
+    FIX44_QuoteStatusReport_MaturityMonthYear = 44,
+    FIX44_QuoteStatusReport_MaturityDate = 45,
+    FIX44_QuoteStatusReport_CouponPaymentDate = 46,
+    FIX44_QuoteStatusReport_IssueDate = 47,
+    FIX44_QuoteStatusReport_RepoCollateralSecurityType = 48,
+    FIX44_QuoteStatusReport_RepurchaseTerm = 49,
+    FIX44_QuoteStatusReport_RepurchaseRate = 50,
+    FIX44_QuoteStatusReport_Factor = 51,
+    FIX44_QuoteStatusReport_CreditRating = 52,
+    FIX44_QuoteStatusReport_InstrRegistry = 53,
+    FIX44_QuoteStatusReport_CountryOfIssue = 54,
+    FIX44_QuoteStatusReport_StateOrProvinceOfIssue = 55,
+    FIX44_QuoteStatusReport_LocaleOfIssue = 56,
+    FIX44_QuoteStatusReport_RedemptionDate = 57,
+    FIX44_QuoteStatusReport_StrikePrice = 58,
+    FIX44_QuoteStatusReport_StrikeCurrency = 59,
+    FIX44_QuoteStatusReport_OptAttribute = 60,
+    FIX44_QuoteStatusReport_ContractMultiplier = 61,
+    FIX44_QuoteStatusReport_CouponRate = 62,
+    FIX44_QuoteStatusReport_SecurityExchange = 63,
+    FIX44_QuoteStatusReport_Issuer = 64,
+    FIX44_QuoteStatusReport_EncodedIssuerLen = 65,
+    FIX44_QuoteStatusReport_EncodedIssuer = 66,
+    FIX44_QuoteStatusReport_SecurityDesc = 67,
+    FIX44_QuoteStatusReport_EncodedSecurityDescLen = 68,
+    FIX44_QuoteStatusReport_EncodedSecurityDesc = 69,
+    FIX44_QuoteStatusReport_Pool = 70,
+    FIX44_QuoteStatusReport_ContractSettlMonth = 71,
+    FIX44_QuoteStatusReport_CPProgram = 72,
+    FIX44_QuoteStatusReport_CPRegType = 73,
+    FIX44_QuoteStatusReport_NoEvents = 74,
+    FIX44_QuoteStatusReport_DatedDate = 75,
+    FIX44_QuoteStatusReport_InterestAccrualDate = 76,
+    FIX44_QuoteStatusReport_AgreementDesc = 77,
+    FIX44_QuoteStatusReport_AgreementID = 78,
+    FIX44_QuoteStatusReport_AgreementDate = 79,
+    FIX44_QuoteStatusReport_AgreementCurrency = 80,
+    FIX44_QuoteStatusReport_TerminationType = 81,
+    FIX44_QuoteStatusReport_StartDate = 82,
+    FIX44_QuoteStatusReport_EndDate = 83,
+    FIX44_QuoteStatusReport_DeliveryType = 84,
+    FIX44_QuoteStatusReport_MarginRatio = 85,
+    FIX44_QuoteStatusReport_NoUnderlyings = 86,
+    FIX44_QuoteStatusReport_Side = 87,
+    FIX44_QuoteStatusReport_OrderQty = 88,
+    FIX44_QuoteStatusReport_CashOrderQty = 89,
+    FIX44_QuoteStatusReport_OrderPercent = 90,
+    FIX44_QuoteStatusReport_RoundingDirection = 91,
+    FIX44_QuoteStatusReport_RoundingModulus = 92,
+    FIX44_QuoteStatusReport_SettlType = 93,
+    FIX44_QuoteStatusReport_SettlDate = 94,
+    FIX44_QuoteStatusReport_SettlDate2 = 95,
+    FIX44_QuoteStatusReport_OrderQty2 = 96,
+    FIX44_QuoteStatusReport_Currency = 97,
+    FIX44_QuoteStatusReport_NoStipulations = 98,
+    FIX44_QuoteStatusReport_Account = 99,
+    FIX44_QuoteStatusReport_AcctIDSource = 100,
+    FIX44_QuoteStatusReport_AccountType = 101,
+    FIX44_QuoteStatusReport_NoLegs = 102,
+    FIX44_QuoteStatusReport_NoQuoteQualifiers = 103,
+    FIX44_QuoteStatusReport_ExpireTime = 104,
+    FIX44_QuoteStatusReport_Price = 105,
+    FIX44_QuoteStatusReport_PriceType = 106,
+    FIX44_QuoteStatusReport_Spread = 107,
+    FIX44_QuoteStatusReport_BenchmarkCurveCurrency = 108,
+    FIX44_QuoteStatusReport_BenchmarkCurveName = 109,
+    FIX44_QuoteStatusReport_BenchmarkCurvePoint = 110,
+    FIX44_QuoteStatusReport_BenchmarkPrice = 111,
+    FIX44_QuoteStatusReport_BenchmarkPriceType = 112,
+    FIX44_QuoteStatusReport_BenchmarkSecurityID = 113,
+    FIX44_QuoteStatusReport_BenchmarkSecurityIDSource = 114,
+    FIX44_QuoteStatusReport_YieldType = 115,
+    FIX44_QuoteStatusReport_Yield = 116,
+    FIX44_QuoteStatusReport_YieldCalcDate = 117,
+    FIX44_QuoteStatusReport_YieldRedemptionDate = 118,
+    FIX44_QuoteStatusReport_YieldRedemptionPrice = 119,
+    FIX44_QuoteStatusReport_YieldRedemptionPriceType = 120,
+    FIX44_QuoteStatusReport_BidPx = 121,
+    FIX44_QuoteStatusReport_OfferPx = 122,
+    FIX44_QuoteStatusReport_MktBidPx = 123,
+    FIX44_QuoteStatusReport_MktOfferPx = 124,
+    FIX44_QuoteStatusReport_MinBidSize = 125,
+    FIX44_QuoteStatusReport_BidSize = 126,
+    FIX44_QuoteStatusReport_MinOfferSize = 127,
+    FIX44_QuoteStatusReport_OfferSize = 128,
+    FIX44_QuoteStatusReport_ValidUntilTime = 129,
+    FIX44_QuoteStatusReport_BidSpotRate = 130,
+    FIX44_QuoteStatusReport_OfferSpotRate = 131,
+    FIX44_QuoteStatusReport_BidForwardPoints = 132,
+    FIX44_QuoteStatusReport_OfferForwardPoints = 133,
+    FIX44_QuoteStatusReport_MidPx = 134,
+    FIX44_QuoteStatusReport_BidYield = 135,
+    FIX44_QuoteStatusReport_MidYield = 136,
+    FIX44_QuoteStatusReport_OfferYield = 137,
+    FIX44_QuoteStatusReport_TransactTime = 138,
+    FIX44_QuoteStatusReport_OrdType = 139,
+    FIX44_QuoteStatusReport_BidForwardPoints2 = 140,
+    FIX44_QuoteStatusReport_OfferForwardPoints2 = 141,
+    FIX44_QuoteStatusReport_SettlCurrBidFxRate = 142,
+    FIX44_QuoteStatusReport_SettlCurrOfferFxRate = 143,
+    FIX44_QuoteStatusReport_SettlCurrFxRateCalc = 144,
+    FIX44_QuoteStatusReport_CommType = 145,
+    FIX44_QuoteStatusReport_Commission = 146,
+    FIX44_QuoteStatusReport_CustOrderCapacity = 147,
+    FIX44_QuoteStatusReport_ExDestination = 148,
+    FIX44_QuoteStatusReport_QuoteStatus = 149,
+    FIX44_QuoteStatusReport_Text = 150,
+    FIX44_QuoteStatusReport_EncodedTextLen = 151,
+    FIX44_QuoteStatusReport_EncodedText = 152,
+    FIX44_QuoteStatusReport_SignatureLength = 153,
+    FIX44_QuoteStatusReport_Signature = 154,
+    FIX44_QuoteStatusReport_CheckSum = 155,
+};
+
+typedef struct _fix44QuoteStatusReport {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteStatusReqID;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	QuoteRespID;
+    int64_t	QuoteType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    struct _ofixStrView	SettlDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	Currency;
+    int64_t	NoStipulations;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    int64_t	NoLegs;
+    int64_t	NoQuoteQualifiers;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDecimal	Price;
+    int64_t	PriceType;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    struct _ofixDecimal	MktBidPx;
+    struct _ofixDecimal	MktOfferPx;
+    struct _ofixDecimal	MinBidSize;
+    struct _ofixDecimal	BidSize;
+    struct _ofixDecimal	MinOfferSize;
+    struct _ofixDecimal	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixDecimal	BidSpotRate;
+    struct _ofixDecimal	OfferSpotRate;
+    struct _ofixDecimal	BidForwardPoints;
+    struct _ofixDecimal	OfferForwardPoints;
+    struct _ofixDecimal	MidPx;
+    struct _ofixDecimal	BidYield;
+    struct _ofixDecimal	MidYield;
+    struct _ofixDecimal	OfferYield;
+    struct _ofixDate	TransactTime;
+    char	OrdType;
+    struct _ofixDecimal	BidForwardPoints2;
+    struct _ofixDecimal	OfferForwardPoints2;
+    struct _ofixDecimal	SettlCurrBidFxRate;
+    struct _ofixDecimal	SettlCurrOfferFxRate;
+    char	SettlCurrFxRateCalc;
+    char	CommType;
+    struct _ofixDecimal	Commission;
+    int64_t	CustOrderCapacity;
+    struct _ofixStrView	ExDestination;
+    int64_t	QuoteStatus;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44QuoteStatusReport;
+
+extern void	fix44_decode_QuoteStatusReport(ofixErr err, fix44QuoteStatusReport m, const char *raw, int len);
+extern void	fix44_decode_QuoteStatusReport_msg(ofixErr err, fix44QuoteStatusReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_QuoteStatusReport(ofixErr err, fix44QuoteStatusReport m);
+
+// QuoteResponse [AJ]
+enum {
+    FIX44_QuoteResponse_BeginString = 0,
+    FIX44_QuoteResponse_BodyLength = 1,
+    FIX44_QuoteResponse_MsgType = 2,
+    FIX44_QuoteResponse_SenderCompID = 3,
+    FIX44_QuoteResponse_TargetCompID = 4,
+    FIX44_QuoteResponse_OnBehalfOfCompID = 5,
+    FIX44_QuoteResponse_DeliverToCompID = 6,
+    FIX44_QuoteResponse_SecureDataLen = 7,
+    FIX44_QuoteResponse_SecureData = 8,
+    FIX44_QuoteResponse_MsgSeqNum = 9,
+    FIX44_QuoteResponse_SenderSubID = 10,
+    FIX44_QuoteResponse_SenderLocationID = 11,
+    FIX44_QuoteResponse_TargetSubID = 12,
+    FIX44_QuoteResponse_TargetLocationID = 13,
+    FIX44_QuoteResponse_OnBehalfOfSubID = 14,
+    FIX44_QuoteResponse_OnBehalfOfLocationID = 15,
+    FIX44_QuoteResponse_DeliverToSubID = 16,
+    FIX44_QuoteResponse_DeliverToLocationID = 17,
+    FIX44_QuoteResponse_PossDupFlag = 18,
+    FIX44_QuoteResponse_PossResend = 19,
+    FIX44_QuoteResponse_SendingTime = 20,
+    FIX44_QuoteResponse_OrigSendingTime = 21,
+    FIX44_QuoteResponse_XmlDataLen = 22,
+    FIX44_QuoteResponse_XmlData = 23,
+    FIX44_QuoteResponse_MessageEncoding = 24,
+    FIX44_QuoteResponse_LastMsgSeqNumProcessed = 25,
+    FIX44_QuoteResponse_NoHops = 26,
+    FIX44_QuoteResponse_QuoteRespID = 27,
+    FIX44_QuoteResponse_QuoteID = 28,
+    FIX44_QuoteResponse_QuoteRespType = 29,
+    FIX44_QuoteResponse_ClOrdID = 30,
+    FIX44_QuoteResponse_OrderCapacity = 31,
+    FIX44_QuoteResponse_IOIid = 32,
+    FIX44_QuoteResponse_QuoteType = 33,
+    FIX44_QuoteResponse_NoQuoteQualifiers = 34,
+    FIX44_QuoteResponse_NoPartyIDs = 35,
+    FIX44_QuoteResponse_TradingSessionID = 36,
+    FIX44_QuoteResponse_TradingSessionSubID = 37,
+    FIX44_QuoteResponse_Symbol = 38,
+    FIX44_QuoteResponse_SymbolSfx = 39,
+    FIX44_QuoteResponse_SecurityID = 40,
+    FIX44_QuoteResponse_SecurityIDSource = 41,
+    FIX44_QuoteResponse_NoSecurityAltID = 42,
+    FIX44_QuoteResponse_Product = 43,
+    FIX44_QuoteResponse_CFICode = 44,
+    FIX44_QuoteResponse_SecurityType = 45,
+    FIX44_QuoteResponse_SecuritySubType = 46,
+    FIX44_QuoteResponse_MaturityMonthYear = 47,
+    FIX44_QuoteResponse_MaturityDate = 48,
+    FIX44_QuoteResponse_CouponPaymentDate = 49,
+    FIX44_QuoteResponse_IssueDate = 50,
+    FIX44_QuoteResponse_RepoCollateralSecurityType = 51,
+    FIX44_QuoteResponse_RepurchaseTerm = 52,
+    FIX44_QuoteResponse_RepurchaseRate = 53,
+    FIX44_QuoteResponse_Factor = 54,
+    FIX44_QuoteResponse_CreditRating = 55,
+    FIX44_QuoteResponse_InstrRegistry = 56,
+    FIX44_QuoteResponse_CountryOfIssue = 57,
+    FIX44_QuoteResponse_StateOrProvinceOfIssue = 58,
+    FIX44_QuoteResponse_LocaleOfIssue = 59,
+    FIX44_QuoteResponse_RedemptionDate = 60,
+    FIX44_QuoteResponse_StrikePrice = 61,
+    FIX44_QuoteResponse_StrikeCurrency = 62,
+    FIX44_QuoteResponse_OptAttribute = 63,
+    FIX44_QuoteResponse_ContractMultiplier = 64,
+    FIX44_QuoteResponse_CouponRate = 65,
+    FIX44_QuoteResponse_SecurityExchange = 66,
+    FIX44_QuoteResponse_Issuer = 67,
+    FIX44_QuoteResponse_EncodedIssuerLen = 68,
+    FIX44_QuoteResponse_EncodedIssuer = 69,
+    FIX44_QuoteResponse_SecurityDesc = 70,
+    FIX44_QuoteResponse_EncodedSecurityDescLen = 71,
+    FIX44_QuoteResponse_EncodedSecurityDesc = 72,
+    FIX44_QuoteResponse_Pool = 73,
+    FIX44_QuoteResponse_ContractSettlMonth = 74,
+    FIX44_QuoteResponse_CPProgram = 75,
+    FIX44_QuoteResponse_CPRegType = 76,
+    FIX44_QuoteResponse_NoEvents = 77,
+    FIX44_QuoteResponse_DatedDate = 78,
+    FIX44_QuoteResponse_InterestAccrualDate = 79,
+    FIX44_QuoteResponse_AgreementDesc = 80,
+    FIX44_QuoteResponse_AgreementID = 81,
+    FIX44_QuoteResponse_AgreementDate = 82,
+    FIX44_QuoteResponse_AgreementCurrency = 83,
+    FIX44_QuoteResponse_TerminationType = 84,
+    FIX44_QuoteResponse_StartDate = 85,
+    FIX44_QuoteResponse_EndDate = 86,
+    FIX44_QuoteResponse_DeliveryType = 87,
+    FIX44_QuoteResponse_MarginRatio = 88,
+    FIX44_QuoteResponse_NoUnderlyings = 89,
+    FIX44_QuoteResponse_Side = 90,
+    FIX44_QuoteResponse_OrderQty = 91,
+    FIX44_QuoteResponse_CashOrderQty = 92,
+    FIX44_QuoteResponse_OrderPercent = 93,
+    FIX44_QuoteResponse_RoundingDirection = 94,
+    FIX44_QuoteResponse_RoundingModulus = 95,
+    FIX44_QuoteResponse_SettlType = 96,
+    FIX44_QuoteResponse_SettlDate = 97,
+    FIX44_QuoteResponse_SettlDate2 = 98,
+    FIX44_QuoteResponse_OrderQty2 = 99,
+    FIX44_QuoteResponse_Currency = 100,
+    FIX44_QuoteResponse_NoStipulations = 101,
+    FIX44_QuoteResponse_Account = 102,
+    FIX44_QuoteResponse_AcctIDSource = 103,
+    FIX44_QuoteResponse_AccountType = 104,
+    FIX44_QuoteResponse_NoLegs = 105,
+    FIX44_QuoteResponse_BidPx = 106,
+    FIX44_QuoteResponse_OfferPx = 107,
+    FIX44_QuoteResponse_MktBidPx = 108,
+    FIX44_QuoteResponse_MktOfferPx = 109,
+    FIX44_QuoteResponse_MinBidSize = 110,
+    FIX44_QuoteResponse_BidSize = 111,
+    FIX44_QuoteResponse_MinOfferSize = 112,
+    FIX44_QuoteResponse_OfferSize = 113,
+    FIX44_QuoteResponse_ValidUntilTime = 114,
+    FIX44_QuoteResponse_BidSpotRate = 115,
+    FIX44_QuoteResponse_OfferSpotRate = 116,
+    FIX44_QuoteResponse_BidForwardPoints = 117,
+    FIX44_QuoteResponse_OfferForwardPoints = 118,
+    FIX44_QuoteResponse_MidPx = 119,
+    FIX44_QuoteResponse_BidYield = 120,
+    FIX44_QuoteResponse_MidYield = 121,
+    FIX44_QuoteResponse_OfferYield = 122,
+    FIX44_QuoteResponse_TransactTime = 123,
+    FIX44_QuoteResponse_OrdType = 124,
+    FIX44_QuoteResponse_BidForwardPoints2 = 125,
+    FIX44_QuoteResponse_OfferForwardPoints2 = 126,
+    FIX44_QuoteResponse_SettlCurrBidFxRate = 127,
+    FIX44_QuoteResponse_SettlCurrOfferFxRate = 128,
+    FIX44_QuoteResponse_SettlCurrFxRateCalc = 129,
+    FIX44_QuoteResponse_Commission = 130,
+    FIX44_QuoteResponse_CommType = 131,
+    FIX44_QuoteResponse_CustOrderCapacity = 132,
+    FIX44_QuoteResponse_ExDestination = 133,
+    FIX44_QuoteResponse_Text = 134,
+    FIX44_QuoteResponse_EncodedTextLen = 135,
+    FIX44_QuoteResponse_EncodedText = 136,
+    FIX44_QuoteResponse_Price = 137,
+    FIX44_QuoteResponse_PriceType = 138,
+    FIX44_QuoteResponse_Spread = 139,
+    FIX44_QuoteResponse_BenchmarkCurveCurrency = 140,
+    FIX44_QuoteResponse_BenchmarkCurveName = 141,
+    FIX44_QuoteResponse_BenchmarkCurvePoint = 142,
+    FIX44_QuoteResponse_BenchmarkPrice = 143,
+    FIX44_QuoteResponse_BenchmarkPriceType = 144,
+    FIX44_QuoteResponse_BenchmarkSecurityID = 145,
+    FIX44_QuoteResponse_BenchmarkSecurityIDSource = 146,
+    FIX44_QuoteResponse_YieldType = 147,
+    FIX44_QuoteResponse_Yield = 148,
+    FIX44_QuoteResponse_YieldCalcDate = 149,
+    FIX44_QuoteResponse_YieldRedemptionDate = 150,
+    FIX44_QuoteResponse_YieldRedemptionPrice = 151,
+    FIX44_QuoteResponse_YieldRedemptionPriceType = 152,
+    FIX44_QuoteResponse_SignatureLength = 153,
+    FIX44_QuoteResponse_Signature = 154,
+    FIX44_QuoteResponse_CheckSum = 155,
+};
+
+typedef struct _fix44QuoteResponse {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteRespID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteRespType;
+    struct _ofixStrView	ClOrdID;
+    char	OrderCapacity;
+    struct _ofixStrView	IOIid;
+    int64_t	QuoteType;
+    int64_t	NoQuoteQualifiers;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    struct _ofixStrView	SettlDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	Currency;
+    int64_t	NoStipulations;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    int64_t	NoLegs;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    struct _ofixDecimal	MktBidPx;
+    struct _ofixDecimal	MktOfferPx;
+    struct _ofixDecimal	MinBidSize;
+    struct _ofixDecimal	BidSize;
+    struct _ofixDecimal	MinOfferSize;
+    struct _ofixDecimal	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixDecimal	BidSpotRate;
+    struct _ofixDecimal	OfferSpotRate;
+    struct _ofixDecimal	BidForwardPoints;
+    struct _ofixDecimal	OfferForwardPoints;
+    struct _ofixDecimal	MidPx;
+    struct _ofixDecimal	BidYield;
+    struct _ofixDecimal	MidYield;
+    struct _ofixDecimal	OfferYield;
+    struct _ofixDate	TransactTime;
+    char	OrdType;
+    struct _ofixDecimal	BidForwardPoints2;
+    struct _ofixDecimal	OfferForwardPoints2;
+    struct _ofixDecimal	SettlCurrBidFxRate;
+    struct _ofixDecimal	SettlCurrOfferFxRate;
+    char	SettlCurrFxRateCalc;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    int64_t	CustOrderCapacity;
+    struct _ofixStrView	ExDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixDecimal	Price;
+    int64_t	PriceType;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44QuoteResponse;
+
+extern void	fix44_decode_QuoteResponse(ofixErr err, fix44QuoteResponse m, const char *raw, int len);
+extern void	fix44_decode_QuoteResponse_msg(ofixErr err, fix44QuoteResponse m, ofixMsg msg);
+extern ofixMsg	fix44_encode_QuoteResponse(ofixErr err, fix44QuoteResponse m);
+
+// Confirmation [AK]
+enum {
+    FIX44_Confirmation_BeginString = 0,
+    FIX44_Confirmation_BodyLength = 1,
+    FIX44_Confirmation_MsgType = 2,
+    FIX44_Confirmation_SenderCompID = 3,
+    FIX44_Confirmation_TargetCompID = 4,
+    FIX44_Confirmation_OnBehalfOfCompID = 5,
+    FIX44_Confirmation_DeliverToCompID = 6,
+    FIX44_Confirmation_SecureDataLen = 7,
+    FIX44_Confirmation_SecureData = 8,
+    FIX44_Confirmation_MsgSeqNum = 9,
+    FIX44_Confirmation_SenderSubID = 10,
+    FIX44_Confirmation_SenderLocationID = 11,
+    FIX44_Confirmation_TargetSubID = 12,
+    FIX44_Confirmation_TargetLocationID = 13,
+    FIX44_Confirmation_OnBehalfOfSubID = 14,
+    FIX44_Confirmation_OnBehalfOfLocationID = 15,
+    FIX44_Confirmation_DeliverToSubID = 16,
+    FIX44_Confirmation_DeliverToLocationID = 17,
+    FIX44_Confirmation_PossDupFlag = 18,
+    FIX44_Confirmation_PossResend = 19,
+    FIX44_Confirmation_SendingTime = 20,
+    FIX44_Confirmation_OrigSendingTime = 21,
+    FIX44_Confirmation_XmlDataLen = 22,
+    FIX44_Confirmation_XmlData = 23,
+    FIX44_Confirmation_MessageEncoding = 24,
+    FIX44_Confirmation_LastMsgSeqNumProcessed = 25,
+    FIX44_Confirmation_NoHops = 26,
+    FIX44_Confirmation_ConfirmID = 27,
+    FIX44_Confirmation_ConfirmRefID = 28,
+    FIX44_Confirmation_ConfirmReqID = 29,
+    FIX44_Confirmation_ConfirmTransType = 30,
+    FIX44_Confirmation_ConfirmType = 31,
+    FIX44_Confirmation_CopyMsgIndicator = 32,
+    FIX44_Confirmation_LegalConfirm = 33,
+    FIX44_Confirmation_ConfirmStatus = 34,
+    FIX44_Confirmation_NoPartyIDs = 35,
+    FIX44_Confirmation_NoOrders = 36,
+    FIX44_Confirmation_AllocID = 37,
+    FIX44_Confirmation_SecondaryAllocID = 38,
+    FIX44_Confirmation_IndividualAllocID = 39,
+    FIX44_Confirmation_TransactTime = 40,
+    FIX44_Confirmation_TradeDate = 41,
+    FIX44_Confirmation_NoTrdRegTimestamps = 42,
+    FIX44_Confirmation_Symbol = 43,
+    FIX44_Confirmation_SymbolSfx = 44,
+    FIX44_Confirmation_SecurityID = 45,
+    FIX44_Confirmation_SecurityIDSource = 46,
+    FIX44_Confirmation_NoSecurityAltID = 47,
+    FIX44_Confirmation_Product = 48,
+    FIX44_Confirmation_CFICode = 49,
+    FIX44_Confirmation_SecurityType = 50,
+    FIX44_Confirmation_SecuritySubType = 51,
+    FIX44_Confirmation_MaturityMonthYear = 52,
+    FIX44_Confirmation_MaturityDate = 53,
+    FIX44_Confirmation_CouponPaymentDate = 54,
+    FIX44_Confirmation_IssueDate = 55,
+    FIX44_Confirmation_RepoCollateralSecurityType = 56,
+    FIX44_Confirmation_RepurchaseTerm = 57,
+    FIX44_Confirmation_RepurchaseRate = 58,
+    FIX44_Confirmation_Factor = 59,
+    FIX44_Confirmation_CreditRating = 60,
+    FIX44_Confirmation_InstrRegistry = 61,
+    FIX44_Confirmation_CountryOfIssue = 62,
+    FIX44_Confirmation_StateOrProvinceOfIssue = 63,
+    FIX44_Confirmation_LocaleOfIssue = 64,
+    FIX44_Confirmation_RedemptionDate = 65,
+    FIX44_Confirmation_StrikePrice = 66,
+    FIX44_Confirmation_StrikeCurrency = 67,
+    FIX44_Confirmation_OptAttribute = 68,
+    FIX44_Confirmation_ContractMultiplier = 69,
+    FIX44_Confirmation_CouponRate = 70,
+    FIX44_Confirmation_SecurityExchange = 71,
+    FIX44_Confirmation_Issuer = 72,
+    FIX44_Confirmation_EncodedIssuerLen = 73,
+    FIX44_Confirmation_EncodedIssuer = 74,
+    FIX44_Confirmation_SecurityDesc = 75,
+    FIX44_Confirmation_EncodedSecurityDescLen = 76,
+    FIX44_Confirmation_EncodedSecurityDesc = 77,
+    FIX44_Confirmation_Pool = 78,
+    FIX44_Confirmation_ContractSettlMonth = 79,
+    FIX44_Confirmation_CPProgram = 80,
+    FIX44_Confirmation_CPRegType = 81,
+    FIX44_Confirmation_NoEvents = 82,
+    FIX44_Confirmation_DatedDate = 83,
+    FIX44_Confirmation_InterestAccrualDate = 84,
+    FIX44_Confirmation_DeliveryForm = 85,
+    FIX44_Confirmation_PctAtRisk = 86,
+    FIX44_Confirmation_NoInstrAttrib = 87,
+    FIX44_Confirmation_AgreementDesc = 88,
+    FIX44_Confirmation_AgreementID = 89,
+    FIX44_Confirmation_AgreementDate = 90,
+    FIX44_Confirmation_AgreementCurrency = 91,
+    FIX44_Confirmation_TerminationType = 92,
+    FIX44_Confirmation_StartDate = 93,
+    FIX44_Confirmation_EndDate = 94,
+    FIX44_Confirmation_DeliveryType = 95,
+    FIX44_Confirmation_MarginRatio = 96,
+    FIX44_Confirmation_NoUnderlyings = 97,
+    FIX44_Confirmation_NoLegs = 98,
+    FIX44_Confirmation_YieldType = 99,
+    FIX44_Confirmation_Yield = 100,
+    FIX44_Confirmation_YieldCalcDate = 101,
+    FIX44_Confirmation_YieldRedemptionDate = 102,
+    FIX44_Confirmation_YieldRedemptionPrice = 103,
+    FIX44_Confirmation_YieldRedemptionPriceType = 104,
+    FIX44_Confirmation_AllocQty = 105,
+    FIX44_Confirmation_QtyType = 106,
+    FIX44_Confirmation_Side = 107,
+    FIX44_Confirmation_Currency = 108,
+    FIX44_Confirmation_LastMkt = 109,
+    FIX44_Confirmation_NoCapacities = 110,
+    FIX44_Confirmation_AllocAccount = 111,
+    FIX44_Confirmation_AllocAcctIDSource = 112,
+    FIX44_Confirmation_AllocAccountType = 113,
+    FIX44_Confirmation_AvgPx = 114,
+    FIX44_Confirmation_AvgPxPrecision = 115,
+    FIX44_Confirmation_PriceType = 116,
+    FIX44_Confirmation_AvgParPx = 117,
+    FIX44_Confirmation_Spread = 118,
+    FIX44_Confirmation_BenchmarkCurveCurrency = 119,
+    FIX44_Confirmation_BenchmarkCurveName = 120,
+    FIX44_Confirmation_BenchmarkCurvePoint = 121,
+    FIX44_Confirmation_BenchmarkPrice = 122,
+    FIX44_Confirmation_BenchmarkPriceType = 123,
+    FIX44_Confirmation_BenchmarkSecurityID = 124,
+    FIX44_Confirmation_BenchmarkSecurityIDSource = 125,
+    FIX44_Confirmation_ReportedPx = 126,
+    FIX44_Confirmation_Text = 127,
+    FIX44_Confirmation_EncodedTextLen = 128,
+    FIX44_Confirmation_EncodedText = 129,
+    FIX44_Confirmation_ProcessCode = 130,
+    FIX44_Confirmation_GrossTradeAmt = 131,
+    FIX44_Confirmation_NumDaysInterest = 132,
+    FIX44_Confirmation_ExDate = 133,
+    FIX44_Confirmation_AccruedInterestRate = 134,
+    FIX44_Confirmation_AccruedInterestAmt = 135,
+    FIX44_Confirmation_InterestAtMaturity = 136,
+    FIX44_Confirmation_EndAccruedInterestAmt = 137,
+    FIX44_Confirmation_StartCash = 138,
+    FIX44_Confirmation_EndCash = 139,
+    FIX44_Confirmation_Concession = 140,
+    FIX44_Confirmation_TotalTakedown = 141,
+    FIX44_Confirmation_NetMoney = 142,
+    FIX44_Confirmation_MaturityNetMoney = 143,
+    FIX44_Confirmation_SettlCurrAmt = 144,
+    FIX44_Confirmation_SettlCurrency = 145,
+    FIX44_Confirmation_SettlCurrFxRate = 146,
+    FIX44_Confirmation_SettlCurrFxRateCalc = 147,
+    FIX44_Confirmation_SettlType = 148,
+    FIX44_Confirmation_SettlDate = 149,
+    FIX44_Confirmation_SettlDeliveryType = 150,
+    FIX44_Confirmation_StandInstDbType = 151,
+    FIX44_Confirmation_StandInstDbName = 152,
+    FIX44_Confirmation_StandInstDbID = 153,
+    FIX44_Confirmation_NoDlvyInst = 154,
+    FIX44_Confirmation_Commission = 155,
+    FIX44_Confirmation_CommType = 156,
+    FIX44_Confirmation_CommCurrency = 157,
+    FIX44_Confirmation_FundRenewWaiv = 158,
+    FIX44_Confirmation_SharedCommission = 159,
+    FIX44_Confirmation_NoStipulations = 160,
+    FIX44_Confirmation_NoMiscFees = 161,
+    FIX44_Confirmation_SignatureLength = 162,
+    FIX44_Confirmation_Signature = 163,
+    FIX44_Confirmation_CheckSum = 164,
+};
+
+typedef struct _fix44Confirmation {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ConfirmID;
+    struct _ofixStrView	ConfirmRefID;
+    struct _ofixStrView	ConfirmReqID;
+    int64_t	ConfirmTransType;
+    int64_t	ConfirmType;
+    char	CopyMsgIndicator;
+    char	LegalConfirm;
+    int64_t	ConfirmStatus;
+    int64_t	NoPartyIDs;
+    int64_t	NoOrders;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	SecondaryAllocID;
+    struct _ofixStrView	IndividualAllocID;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	TradeDate;
+    int64_t	NoTrdRegTimestamps;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixDecimal	AllocQty;
+    int64_t	QtyType;
+    char	Side;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	LastMkt;
+    int64_t	NoCapacities;
+    struct _ofixStrView	AllocAccount;
+    int64_t	AllocAcctIDSource;
+    int64_t	AllocAccountType;
+    struct _ofixDecimal	AvgPx;
+    int64_t	AvgPxPrecision;
+    int64_t	PriceType;
+    struct _ofixDecimal	AvgParPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixDecimal	ReportedPx;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    char	ProcessCode;
+    struct _ofixDecimal	GrossTradeAmt;
+    int64_t	NumDaysInterest;
+    struct _ofixStrView	ExDate;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	InterestAtMaturity;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    struct _ofixDecimal	Concession;
+    struct _ofixDecimal	TotalTakedown;
+    struct _ofixDecimal	NetMoney;
+    struct _ofixDecimal	MaturityNetMoney;
+    struct _ofixDecimal	SettlCurrAmt;
+    struct _ofixStrView	SettlCurrency;
+    struct _ofixDecimal	SettlCurrFxRate;
+    char	SettlCurrFxRateCalc;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    int64_t	SettlDeliveryType;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	NoDlvyInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    struct _ofixDecimal	SharedCommission;
+    int64_t	NoStipulations;
+    int64_t	NoMiscFees;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Confirmation;
+
+extern void	fix44_decode_Confirmation(ofixErr err, fix44Confirmation m, const char *raw, int len);
+extern void	fix44_decode_Confirmation_msg(ofixErr err, fix44Confirmation m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Confirmation(ofixErr err, fix44Confirmation m);
+
+// PositionMaintenanceRequest [AL]
+enum {
+    FIX44_PositionMaintenanceRequest_BeginString = 0,
+    FIX44_PositionMaintenanceRequest_BodyLength = 1,
+    FIX44_PositionMaintenanceRequest_MsgType = 2,
+    FIX44_PositionMaintenanceRequest_SenderCompID = 3,
+    FIX44_PositionMaintenanceRequest_TargetCompID = 4,
+    FIX44_PositionMaintenanceRequest_OnBehalfOfCompID = 5,
+    FIX44_PositionMaintenanceRequest_DeliverToCompID = 6,
+    FIX44_PositionMaintenanceRequest_SecureDataLen = 7,
+    FIX44_PositionMaintenanceRequest_SecureData = 8,
+    FIX44_PositionMaintenanceRequest_MsgSeqNum = 9,
+    FIX44_PositionMaintenanceRequest_SenderSubID = 10,
+    FIX44_PositionMaintenanceRequest_SenderLocationID = 11,
+    FIX44_PositionMaintenanceRequest_TargetSubID = 12,
+    FIX44_PositionMaintenanceRequest_TargetLocationID = 13,
+    FIX44_PositionMaintenanceRequest_OnBehalfOfSubID = 14,
+    FIX44_PositionMaintenanceRequest_OnBehalfOfLocationID = 15,
+    FIX44_PositionMaintenanceRequest_DeliverToSubID = 16,
+    FIX44_PositionMaintenanceRequest_DeliverToLocationID = 17,
+    FIX44_PositionMaintenanceRequest_PossDupFlag = 18,
+    FIX44_PositionMaintenanceRequest_PossResend = 19,
+    FIX44_PositionMaintenanceRequest_SendingTime = 20,
+    FIX44_PositionMaintenanceRequest_OrigSendingTime = 21,
+    FIX44_PositionMaintenanceRequest_XmlDataLen = 22,
+    FIX44_PositionMaintenanceRequest_XmlData = 23,
+    FIX44_PositionMaintenanceRequest_MessageEncoding = 24,
+    FIX44_PositionMaintenanceRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_PositionMaintenanceRequest_NoHops = 26,
+    FIX44_PositionMaintenanceRequest_PosReqID = 27,
+    FIX44_PositionMaintenanceRequest_PosTransType = 28,
+    FIX44_PositionMaintenanceRequest_PosMaintAction = 29,
+    FIX44_PositionMaintenanceRequest_OrigPosReqRefID = 30,
+    FIX44_PositionMaintenanceRequest_PosMaintRptRefID = 31,
+    FIX44_PositionMaintenanceRequest_ClearingBusinessDate = 32,
+    FIX44_PositionMaintenanceRequest_SettlSessID = 33,
+    FIX44_PositionMaintenanceRequest_SettlSessSubID = 34,
+    FIX44_PositionMaintenanceRequest_NoPartyIDs = 35,
+    FIX44_PositionMaintenanceRequest_Account = 36,
+    FIX44_PositionMaintenanceRequest_AcctIDSource = 37,
+    FIX44_PositionMaintenanceRequest_AccountType = 38,
+    FIX44_PositionMaintenanceRequest_Symbol = 39,
+    FIX44_PositionMaintenanceRequest_SymbolSfx = 40,
+    FIX44_PositionMaintenanceRequest_SecurityID = 41,
+    FIX44_PositionMaintenanceRequest_SecurityIDSource = 42,
+    FIX44_PositionMaintenanceRequest_NoSecurityAltID = 43,
+    FIX44_PositionMaintenanceRequest_Product = 44,
+    FIX44_PositionMaintenanceRequest_CFICode = 45,
+    FIX44_PositionMaintenanceRequest_SecurityType = 46,
+    FIX44_PositionMaintenanceRequest_SecuritySubType = 47,
+    FIX44_PositionMaintenanceRequest_MaturityMonthYear = 48,
+    FIX44_PositionMaintenanceRequest_MaturityDate = 49,
+    FIX44_PositionMaintenanceRequest_CouponPaymentDate = 50,
+    FIX44_PositionMaintenanceRequest_IssueDate = 51,
+    FIX44_PositionMaintenanceRequest_RepoCollateralSecurityType = 52,
+    FIX44_PositionMaintenanceRequest_RepurchaseTerm = 53,
+    FIX44_PositionMaintenanceRequest_RepurchaseRate = 54,
+    FIX44_PositionMaintenanceRequest_Factor = 55,
+    FIX44_PositionMaintenanceRequest_CreditRating = 56,
+    FIX44_PositionMaintenanceRequest_InstrRegistry = 57,
+    FIX44_PositionMaintenanceRequest_CountryOfIssue = 58,
+    FIX44_PositionMaintenanceRequest_StateOrProvinceOfIssue = 59,
+    FIX44_PositionMaintenanceRequest_LocaleOfIssue = 60,
+    FIX44_PositionMaintenanceRequest_RedemptionDate = 61,
+    FIX44_PositionMaintenanceRequest_StrikePrice = 62,
+    FIX44_PositionMaintenanceRequest_StrikeCurrency = 63,
+    FIX44_PositionMaintenanceRequest_OptAttribute = 64,
+    FIX44_PositionMaintenanceRequest_ContractMultiplier = 65,
+    FIX44_PositionMaintenanceRequest_CouponRate = 66,
+    FIX44_PositionMaintenanceRequest_SecurityExchange = 67,
+    FIX44_PositionMaintenanceRequest_Issuer = 68,
+    FIX44_PositionMaintenanceRequest_EncodedIssuerLen = 69,
+    FIX44_PositionMaintenanceRequest_EncodedIssuer = 70,
+    FIX44_PositionMaintenanceRequest_SecurityDesc = 71,
+    FIX44_PositionMaintenanceRequest_EncodedSecurityDescLen = 72,
+    FIX44_PositionMaintenanceRequest_EncodedSecurityDesc = 73,
+    FIX44_PositionMaintenanceRequest_Pool = 74,
+    FIX44_PositionMaintenanceRequest_ContractSettlMonth = 75,
+    FIX44_PositionMaintenanceRequest_CPProgram = 76,
+    FIX44_PositionMaintenanceRequest_CPRegType = 77,
+    FIX44_PositionMaintenanceRequest_NoEvents = 78,
+    FIX44_PositionMaintenanceRequest_DatedDate = 79,
+    FIX44_PositionMaintenanceRequest_InterestAccrualDate = 80,
+    FIX44_PositionMaintenanceRequest_Currency = 81,
+    FIX44_PositionMaintenanceRequest_NoLegs = 82,
+    FIX44_PositionMaintenanceRequest_NoUnderlyings = 83,
+    FIX44_PositionMaintenanceRequest_NoTradingSessions = 84,
+    FIX44_PositionMaintenanceRequest_TransactTime = 85,
+    FIX44_PositionMaintenanceRequest_NoPositions = 86,
+    FIX44_PositionMaintenanceRequest_AdjustmentType = 87,
+    FIX44_PositionMaintenanceRequest_ContraryInstructionIndicator = 88,
+    FIX44_PositionMaintenanceRequest_PriorSpreadIndicator = 89,
+    FIX44_PositionMaintenanceRequest_ThresholdAmount = 90,
+    FIX44_PositionMaintenanceRequest_Text = 91,
+    FIX44_PositionMaintenanceRequest_EncodedTextLen = 92,
+    FIX44_PositionMaintenanceRequest_EncodedText = 93,
+    FIX44_PositionMaintenanceRequest_SignatureLength = 94,
+    FIX44_PositionMaintenanceRequest_Signature = 95,
+    FIX44_PositionMaintenanceRequest_CheckSum = 96,
+};
+
+typedef struct _fix44PositionMaintenanceRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	PosReqID;
+    int64_t	PosTransType;
+    int64_t	PosMaintAction;
+    struct _ofixStrView	OrigPosReqRefID;
+    struct _ofixStrView	PosMaintRptRefID;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    int64_t	NoUnderlyings;
+    int64_t	NoTradingSessions;
+    struct _ofixDate	TransactTime;
+    int64_t	NoPositions;
+    int64_t	AdjustmentType;
+    char	ContraryInstructionIndicator;
+    char	PriorSpreadIndicator;
+    struct _ofixDecimal	ThresholdAmount;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44PositionMaintenanceRequest;
+
+extern void	fix44_decode_PositionMaintenanceRequest(ofixErr err, fix44PositionMaintenanceRequest m, const char *raw, int len);
+extern void	fix44_decode_PositionMaintenanceRequest_msg(ofixErr err, fix44PositionMaintenanceRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_PositionMaintenanceRequest(ofixErr err, fix44PositionMaintenanceRequest m);
+
+// PositionMaintenanceReport [AM]
+enum {
+    FIX44_PositionMaintenanceReport_BeginString = 0,
+    FIX44_PositionMaintenanceReport_BodyLength = 1,
+    FIX44_PositionMaintenanceReport_MsgType = 2,
+    FIX44_PositionMaintenanceReport_SenderCompID = 3,
+    FIX44_PositionMaintenanceReport_TargetCompID = 4,
+    FIX44_PositionMaintenanceReport_OnBehalfOfCompID = 5,
+    FIX44_PositionMaintenanceReport_DeliverToCompID = 6,
+    FIX44_PositionMaintenanceReport_SecureDataLen = 7,
+    FIX44_PositionMaintenanceReport_SecureData = 8,
+    FIX44_PositionMaintenanceReport_MsgSeqNum = 9,
+    FIX44_PositionMaintenanceReport_SenderSubID = 10,
+    FIX44_PositionMaintenanceReport_SenderLocationID = 11,
+    FIX44_PositionMaintenanceReport_TargetSubID = 12,
+    FIX44_PositionMaintenanceReport_TargetLocationID = 13,
+    FIX44_PositionMaintenanceReport_OnBehalfOfSubID = 14,
+    FIX44_PositionMaintenanceReport_OnBehalfOfLocationID = 15,
+    FIX44_PositionMaintenanceReport_DeliverToSubID = 16,
+    FIX44_PositionMaintenanceReport_DeliverToLocationID = 17,
+    FIX44_PositionMaintenanceReport_PossDupFlag = 18,
+    FIX44_PositionMaintenanceReport_PossResend = 19,
+    FIX44_PositionMaintenanceReport_SendingTime = 20,
+    FIX44_PositionMaintenanceReport_OrigSendingTime = 21,
+    FIX44_PositionMaintenanceReport_XmlDataLen = 22,
+    FIX44_PositionMaintenanceReport_XmlData = 23,
+    FIX44_PositionMaintenanceReport_MessageEncoding = 24,
+    FIX44_PositionMaintenanceReport_LastMsgSeqNumProcessed = 25,
+    FIX44_PositionMaintenanceReport_NoHops = 26,
+    FIX44_PositionMaintenanceReport_PosMaintRptID = 27,
+    FIX44_PositionMaintenanceReport_PosTransType = 28,
+    FIX44_PositionMaintenanceReport_PosReqID = 29,
+    FIX44_PositionMaintenanceReport_PosMaintAction = 30,
+    FIX44_PositionMaintenanceReport_OrigPosReqRefID = 31,
+    FIX44_PositionMaintenanceReport_PosMaintStatus = 32,
+    FIX44_PositionMaintenanceReport_PosMaintResult = 33,
+    FIX44_PositionMaintenanceReport_ClearingBusinessDate = 34,
+    FIX44_PositionMaintenanceReport_SettlSessID = 35,
+    FIX44_PositionMaintenanceReport_SettlSessSubID = 36,
+    FIX44_PositionMaintenanceReport_NoPartyIDs = 37,
+    FIX44_PositionMaintenanceReport_Account = 38,
+    FIX44_PositionMaintenanceReport_AcctIDSource = 39,
+    FIX44_PositionMaintenanceReport_AccountType = 40,
+    FIX44_PositionMaintenanceReport_Symbol = 41,
+    FIX44_PositionMaintenanceReport_SymbolSfx = 42,
+    FIX44_PositionMaintenanceReport_SecurityID = 43,
+    FIX44_PositionMaintenanceReport_SecurityIDSource = 44,
+    FIX44_PositionMaintenanceReport_NoSecurityAltID = 45,
+    FIX44_PositionMaintenanceReport_Product = 46,
+    FIX44_PositionMaintenanceReport_CFICode = 47,
+    FIX44_PositionMaintenanceReport_SecurityType = 48,
+    FIX44_PositionMaintenanceReport_SecuritySubType = 49,
+    FIX44_PositionMaintenanceReport_MaturityMonthYear = 50,
+    FIX44_PositionMaintenanceReport_MaturityDate = 51,
+    FIX44_PositionMaintenanceReport_CouponPaymentDate = 52,
+    FIX44_PositionMaintenanceReport_IssueDate = 53,
+    FIX44_PositionMaintenanceReport_RepoCollateralSecurityType = 54,
+    FIX44_PositionMaintenanceReport_RepurchaseTerm = 55,
+    FIX44_PositionMaintenanceReport_RepurchaseRate = 56,
+    FIX44_PositionMaintenanceReport_Factor = 57,
+    FIX44_PositionMaintenanceReport_CreditRating = 58,
+    FIX44_PositionMaintenanceReport_InstrRegistry = 59,
+    FIX44_PositionMaintenanceReport_CountryOfIssue = 60,
+    FIX44_PositionMaintenanceReport_StateOrProvinceOfIssue = 61,
+    FIX44_PositionMaintenanceReport_LocaleOfIssue = 62,
+    FIX44_PositionMaintenanceReport_RedemptionDate = 63,
+    FIX44_PositionMaintenanceReport_StrikePrice = 64,
+    FIX44_PositionMaintenanceReport_StrikeCurrency = 65,
+    FIX44_PositionMaintenanceReport_OptAttribute = 66,
+    FIX44_PositionMaintenanceReport_ContractMultiplier = 67,
+    FIX44_PositionMaintenanceReport_CouponRate = 68,
+    FIX44_PositionMaintenanceReport_SecurityExchange = 69,
+    FIX44_PositionMaintenanceReport_Issuer = 70,
+    FIX44_PositionMaintenanceReport_EncodedIssuerLen = 71,
+    FIX44_PositionMaintenanceReport_EncodedIssuer = 72,
+    FIX44_PositionMaintenanceReport_SecurityDesc = 73,
+    FIX44_PositionMaintenanceReport_EncodedSecurityDescLen = 74,
+    FIX44_PositionMaintenanceReport_EncodedSecurityDesc = 75,
+    FIX44_PositionMaintenanceReport_Pool = 76,
+    FIX44_PositionMaintenanceReport_ContractSettlMonth = 77,
+    FIX44_PositionMaintenanceReport_CPProgram = 78,
+    FIX44_PositionMaintenanceReport_CPRegType = 79,
+    FIX44_PositionMaintenanceReport_NoEvents = 80,
+    FIX44_PositionMaintenanceReport_DatedDate = 81,
+    FIX44_PositionMaintenanceReport_InterestAccrualDate = 82,
+    FIX44_PositionMaintenanceReport_Currency = 83,
+    FIX44_PositionMaintenanceReport_NoLegs = 84,
+    FIX44_PositionMaintenanceReport_NoUnderlyings = 85,
+    FIX44_PositionMaintenanceReport_NoTradingSessions = 86,
+    FIX44_PositionMaintenanceReport_TransactTime = 87,
+    FIX44_PositionMaintenanceReport_NoPositions = 88,
+    FIX44_PositionMaintenanceReport_NoPosAmt = 89,
+    FIX44_PositionMaintenanceReport_AdjustmentType = 90,
+    FIX44_PositionMaintenanceReport_ThresholdAmount = 91,
+    FIX44_PositionMaintenanceReport_Text = 92,
+    FIX44_PositionMaintenanceReport_EncodedTextLen = 93,
+    FIX44_PositionMaintenanceReport_EncodedText = 94,
+    FIX44_PositionMaintenanceReport_SignatureLength = 95,
+    FIX44_PositionMaintenanceReport_Signature = 96,
+    FIX44_PositionMaintenanceReport_CheckSum = 97,
+};
+
+typedef struct _fix44PositionMaintenanceReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	PosMaintRptID;
+    int64_t	PosTransType;
+    struct _ofixStrView	PosReqID;
+    int64_t	PosMaintAction;
+    struct _ofixStrView	OrigPosReqRefID;
+    int64_t	PosMaintStatus;
+    int64_t	PosMaintResult;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    int64_t	NoUnderlyings;
+    int64_t	NoTradingSessions;
+    struct _ofixDate	TransactTime;
+    int64_t	NoPositions;
+    int64_t	NoPosAmt;
+    int64_t	AdjustmentType;
+    struct _ofixDecimal	ThresholdAmount;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44PositionMaintenanceReport;
+
+extern void	fix44_decode_PositionMaintenanceReport(ofixErr err, fix44PositionMaintenanceReport m, const char *raw, int len);
+extern void	fix44_decode_PositionMaintenanceReport_msg(ofixErr err, fix44PositionMaintenanceReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_PositionMaintenanceReport(ofixErr err, fix44PositionMaintenanceReport m);
+
+// RequestForPositions [AN]
+enum {
+    FIX44_RequestForPositions_BeginString = 0,
+    FIX44_RequestForPositions_BodyLength = 1,
+    FIX44_RequestForPositions_MsgType = 2,
+    FIX44_RequestForPositions_SenderCompID = 3,
+    FIX44_RequestForPositions_TargetCompID = 4,
+    FIX44_RequestForPositions_OnBehalfOfCompID = 5,
+    FIX44_RequestForPositions_DeliverToCompID = 6,
+    FIX44_RequestForPositions_SecureDataLen = 7,
+    FIX44_RequestForPositions_SecureData = 8,
+    FIX44_RequestForPositions_MsgSeqNum = 9,
+    FIX44_RequestForPositions_SenderSubID = 10,
+    FIX44_RequestForPositions_SenderLocationID = 11,
+    FIX44_RequestForPositions_TargetSubID = 12,
+    FIX44_RequestForPositions_TargetLocationID = 13,
+    FIX44_RequestForPositions_OnBehalfOfSubID = 14,
+    FIX44_RequestForPositions_OnBehalfOfLocationID = 15,
+    FIX44_RequestForPositions_DeliverToSubID = 16,
+    FIX44_RequestForPositions_DeliverToLocationID = 17,
+    FIX44_RequestForPositions_PossDupFlag = 18,
+    FIX44_RequestForPositions_PossResend = 19,
+    FIX44_RequestForPositions_SendingTime = 20,
+    FIX44_RequestForPositions_OrigSendingTime = 21,
+    FIX44_RequestForPositions_XmlDataLen = 22,
+    FIX44_RequestForPositions_XmlData = 23,
+    FIX44_RequestForPositions_MessageEncoding = 24,
+    FIX44_RequestForPositions_LastMsgSeqNumProcessed = 25,
+    FIX44_RequestForPositions_NoHops = 26,
+    FIX44_RequestForPositions_PosReqID = 27,
+    FIX44_RequestForPositions_PosReqType = 28,
+    FIX44_RequestForPositions_MatchStatus = 29,
+    FIX44_RequestForPositions_SubscriptionRequestType = 30,
+    FIX44_RequestForPositions_NoPartyIDs = 31,
+    FIX44_RequestForPositions_Account = 32,
+    FIX44_RequestForPositions_AcctIDSource = 33,
+    FIX44_RequestForPositions_AccountType = 34,
+    FIX44_RequestForPositions_Symbol = 35,
+    FIX44_RequestForPositions_SymbolSfx = 36,
+    FIX44_RequestForPositions_SecurityID = 37,
+    FIX44_RequestForPositions_SecurityIDSource = 38,
+    FIX44_RequestForPositions_NoSecurityAltID = 39,
+    FIX44_RequestForPositions_Product = 40,
+    FIX44_RequestForPositions_CFICode = 41,
+    FIX44_RequestForPositions_SecurityType = 42,
+    FIX44_RequestForPositions_SecuritySubType = 43,
+    FIX44_RequestForPositions_MaturityMonthYear = 44,
+    FIX44_RequestForPositions_MaturityDate = 45,
+    FIX44_RequestForPositions_CouponPaymentDate = 46,
+    FIX44_RequestForPositions_IssueDate = 47,
+    FIX44_RequestForPositions_RepoCollateralSecurityType = 48,
+    FIX44_RequestForPositions_RepurchaseTerm = 49,
+    FIX44_RequestForPositions_RepurchaseRate = 50,
+    FIX44_RequestForPositions_Factor = 51,
+    FIX44_RequestForPositions_CreditRating = 52,
+    FIX44_RequestForPositions_InstrRegistry = 53,
+    FIX44_RequestForPositions_CountryOfIssue = 54,
+    FIX44_RequestForPositions_StateOrProvinceOfIssue = 55,
+    FIX44_RequestForPositions_LocaleOfIssue = 56,
+    FIX44_RequestForPositions_RedemptionDate = 57,
+    FIX44_RequestForPositions_StrikePrice = 58,
+    FIX44_RequestForPositions_StrikeCurrency = 59,
+    FIX44_RequestForPositions_OptAttribute = 60,
+    FIX44_RequestForPositions_ContractMultiplier = 61,
+    FIX44_RequestForPositions_CouponRate = 62,
+    FIX44_RequestForPositions_SecurityExchange = 63,
+    FIX44_RequestForPositions_Issuer = 64,
+    FIX44_RequestForPositions_EncodedIssuerLen = 65,
+    FIX44_RequestForPositions_EncodedIssuer = 66,
+    FIX44_RequestForPositions_SecurityDesc = 67,
+    FIX44_RequestForPositions_EncodedSecurityDescLen = 68,
+    FIX44_RequestForPositions_EncodedSecurityDesc = 69,
+    FIX44_RequestForPositions_Pool = 70,
+    FIX44_RequestForPositions_ContractSettlMonth = 71,
+    FIX44_RequestForPositions_CPProgram = 72,
+    FIX44_RequestForPositions_CPRegType = 73,
+    FIX44_RequestForPositions_NoEvents = 74,
+    FIX44_RequestForPositions_DatedDate = 75,
+    FIX44_RequestForPositions_InterestAccrualDate = 76,
+    FIX44_RequestForPositions_Currency = 77,
+    FIX44_RequestForPositions_NoLegs = 78,
+    FIX44_RequestForPositions_NoUnderlyings = 79,
+    FIX44_RequestForPositions_ClearingBusinessDate = 80,
+    FIX44_RequestForPositions_SettlSessID = 81,
+    FIX44_RequestForPositions_SettlSessSubID = 82,
+    FIX44_RequestForPositions_NoTradingSessions = 83,
+    FIX44_RequestForPositions_TransactTime = 84,
+    FIX44_RequestForPositions_ResponseTransportType = 85,
+    FIX44_RequestForPositions_ResponseDestination = 86,
+    FIX44_RequestForPositions_Text = 87,
+    FIX44_RequestForPositions_EncodedTextLen = 88,
+    FIX44_RequestForPositions_EncodedText = 89,
+    FIX44_RequestForPositions_SignatureLength = 90,
+    FIX44_RequestForPositions_Signature = 91,
+    FIX44_RequestForPositions_CheckSum = 92,
+};
+
+typedef struct _fix44RequestForPositions {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	PosReqID;
+    int64_t	PosReqType;
+    char	MatchStatus;
+    char	SubscriptionRequestType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    int64_t	NoUnderlyings;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    int64_t	NoTradingSessions;
+    struct _ofixDate	TransactTime;
+    int64_t	ResponseTransportType;
+    struct _ofixStrView	ResponseDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44RequestForPositions;
+
+extern void	fix44_decode_RequestForPositions(ofixErr err, fix44RequestForPositions m, const char *raw, int len);
+extern void	fix44_decode_RequestForPositions_msg(ofixErr err, fix44RequestForPositions m, ofixMsg msg);
+extern ofixMsg	fix44_encode_RequestForPositions(ofixErr err, fix44RequestForPositions m);
+
+// RequestForPositionsAck [AO]
+enum {
+    FIX44_RequestForPositionsAck_BeginString = 0,
+    FIX44_RequestForPositionsAck_BodyLength = 1,
+    FIX44_RequestForPositionsAck_MsgType = 2,
+    FIX44_RequestForPositionsAck_SenderCompID = 3,
+    FIX44_RequestForPositionsAck_TargetCompID = 4,
+    FIX44_RequestForPositionsAck_OnBehalfOfCompID = 5,
+    FIX44_RequestForPositionsAck_DeliverToCompID = 6,
+    FIX44_RequestForPositionsAck_SecureDataLen = 7,
+    FIX44_RequestForPositionsAck_SecureData = 8,
+    FIX44_RequestForPositionsAck_MsgSeqNum = 9,
+    FIX44_RequestForPositionsAck_SenderSubID = 10,
+    FIX44_RequestForPositionsAck_SenderLocationID = 11,
+    FIX44_RequestForPositionsAck_TargetSubID = 12,
+    FIX44_RequestForPositionsAck_TargetLocationID = 13,
+    FIX44_RequestForPositionsAck_OnBehalfOfSubID = 14,
+    FIX44_RequestForPositionsAck_OnBehalfOfLocationID = 15,
+    FIX44_RequestForPositionsAck_DeliverToSubID = 16,
+    FIX44_RequestForPositionsAck_DeliverToLocationID = 17,
+    FIX44_RequestForPositionsAck_PossDupFlag = 18,
+    FIX44_RequestForPositionsAck_PossResend = 19,
+    FIX44_RequestForPositionsAck_SendingTime = 20,
+    FIX44_RequestForPositionsAck_OrigSendingTime = 21,
+    FIX44_RequestForPositionsAck_XmlDataLen = 22,
+    FIX44_RequestForPositionsAck_XmlData = 23,
+    FIX44_RequestForPositionsAck_MessageEncoding = 24,
+    FIX44_RequestForPositionsAck_LastMsgSeqNumProcessed = 25,
+    FIX44_RequestForPositionsAck_NoHops = 26,
+    FIX44_RequestForPositionsAck_PosMaintRptID = 27,
+    FIX44_RequestForPositionsAck_PosReqID = 28,
+    FIX44_RequestForPositionsAck_TotalNumPosReports = 29,
+    FIX44_RequestForPositionsAck_UnsolicitedIndicator = 30,
+    FIX44_RequestForPositionsAck_PosReqResult = 31,
+    FIX44_RequestForPositionsAck_PosReqStatus = 32,
+    FIX44_RequestForPositionsAck_NoPartyIDs = 33,
+    FIX44_RequestForPositionsAck_Account = 34,
+    FIX44_RequestForPositionsAck_AcctIDSource = 35,
+    FIX44_RequestForPositionsAck_AccountType = 36,
+    FIX44_RequestForPositionsAck_Symbol = 37,
+    FIX44_RequestForPositionsAck_SymbolSfx = 38,
+    FIX44_RequestForPositionsAck_SecurityID = 39,
+    FIX44_RequestForPositionsAck_SecurityIDSource = 40,
+    FIX44_RequestForPositionsAck_NoSecurityAltID = 41,
+    FIX44_RequestForPositionsAck_Product = 42,
+    FIX44_RequestForPositionsAck_CFICode = 43,
+    FIX44_RequestForPositionsAck_SecurityType = 44,
+    FIX44_RequestForPositionsAck_SecuritySubType = 45,
+    FIX44_RequestForPositionsAck_MaturityMonthYear = 46,
+    FIX44_RequestForPositionsAck_MaturityDate = 47,
+    FIX44_RequestForPositionsAck_CouponPaymentDate = 48,
+    FIX44_RequestForPositionsAck_IssueDate = 49,
+    FIX44_RequestForPositionsAck_RepoCollateralSecurityType = 50,
+    FIX44_RequestForPositionsAck_RepurchaseTerm = 51,
+    FIX44_RequestForPositionsAck_RepurchaseRate = 52,
+    FIX44_RequestForPositionsAck_Factor = 53,
+    FIX44_RequestForPositionsAck_CreditRating = 54,
+    FIX44_RequestForPositionsAck_InstrRegistry = 55,
+    FIX44_RequestForPositionsAck_CountryOfIssue = 56,
+    FIX44_RequestForPositionsAck_StateOrProvinceOfIssue = 57,
+    FIX44_RequestForPositionsAck_LocaleOfIssue = 58,
+    FIX44_RequestForPositionsAck_RedemptionDate = 59,
+    FIX44_RequestForPositionsAck_StrikePrice = 60,
+    FIX44_RequestForPositionsAck_StrikeCurrency = 61,
+    FIX44_RequestForPositionsAck_OptAttribute = 62,
+    FIX44_RequestForPositionsAck_ContractMultiplier = 63,
+    FIX44_RequestForPositionsAck_CouponRate = 64,
+    FIX44_RequestForPositionsAck_SecurityExchange = 65,
+    FIX44_RequestForPositionsAck_Issuer = 66,
+    FIX44_RequestForPositionsAck_EncodedIssuerLen = 67,
+    FIX44_RequestForPositionsAck_EncodedIssuer = 68,
+    FIX44_RequestForPositionsAck_SecurityDesc = 69,
+    FIX44_RequestForPositionsAck_EncodedSecurityDescLen = 70,
+    FIX44_RequestForPositionsAck_EncodedSecurityDesc = 71,
+    FIX44_RequestForPositionsAck_Pool = 72,
+    FIX44_RequestForPositionsAck_ContractSettlMonth = 73,
+    FIX44_RequestForPositionsAck_CPProgram = 74,
+    FIX44_RequestForPositionsAck_CPRegType = 75,
+    FIX44_RequestForPositionsAck_NoEvents = 76,
+    FIX44_RequestForPositionsAck_DatedDate = 77,
+    FIX44_RequestForPositionsAck_InterestAccrualDate = 78,
+    FIX44_RequestForPositionsAck_Currency = 79,
+    FIX44_RequestForPositionsAck_NoLegs = 80,
+    FIX44_RequestForPositionsAck_NoUnderlyings = 81,
+    FIX44_RequestForPositionsAck_ResponseTransportType = 82,
+    FIX44_RequestForPositionsAck_ResponseDestination = 83,
+    FIX44_RequestForPositionsAck_Text = 84,
+    FIX44_RequestForPositionsAck_EncodedTextLen = 85,
+    FIX44_RequestForPositionsAck_EncodedText = 86,
+    FIX44_RequestForPositionsAck_SignatureLength = 87,
+    FIX44_RequestForPositionsAck_Signature = 88,
+    FIX44_RequestForPositionsAck_CheckSum = 89,
+};
+
+typedef struct _fix44RequestForPositionsAck {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	PosMaintRptID;
+    struct _ofixStrView	PosReqID;
+    int64_t	TotalNumPosReports;
+    char	UnsolicitedIndicator;
+    int64_t	PosReqResult;
+    int64_t	PosReqStatus;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    int64_t	NoUnderlyings;
+    int64_t	ResponseTransportType;
+    struct _ofixStrView	ResponseDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44RequestForPositionsAck;
+
+extern void	fix44_decode_RequestForPositionsAck(ofixErr err, fix44RequestForPositionsAck m, const char *raw, int len);
+extern void	fix44_decode_RequestForPositionsAck_msg(ofixErr err, fix44RequestForPositionsAck m, ofixMsg msg);
+extern ofixMsg	fix44_encode_RequestForPositionsAck(ofixErr err, fix44RequestForPositionsAck m);
+
+// PositionReport [AP]
+enum {
+    FIX44_PositionReport_BeginString = 0,
+    FIX44_PositionReport_BodyLength = 1,
+    FIX44_PositionReport_MsgType = 2,
+    FIX44_PositionReport_SenderCompID = 3,
+    FIX44_PositionReport_TargetCompID = 4,
+    FIX44_PositionReport_OnBehalfOfCompID = 5,
+    FIX44_PositionReport_DeliverToCompID = 6,
+    FIX44_PositionReport_SecureDataLen = 7,
+    FIX44_PositionReport_SecureData = 8,
+    FIX44_PositionReport_MsgSeqNum = 9,
+    FIX44_PositionReport_SenderSubID = 10,
+    FIX44_PositionReport_SenderLocationID = 11,
+    FIX44_PositionReport_TargetSubID = 12,
+    FIX44_PositionReport_TargetLocationID = 13,
+    FIX44_PositionReport_OnBehalfOfSubID = 14,
+    FIX44_PositionReport_OnBehalfOfLocationID = 15,
+    FIX44_PositionReport_DeliverToSubID = 16,
+    FIX44_PositionReport_DeliverToLocationID = 17,
+    FIX44_PositionReport_PossDupFlag = 18,
+    FIX44_PositionReport_PossResend = 19,
+    FIX44_PositionReport_SendingTime = 20,
+    FIX44_PositionReport_OrigSendingTime = 21,
+    FIX44_PositionReport_XmlDataLen = 22,
+    FIX44_PositionReport_XmlData = 23,
+    FIX44_PositionReport_MessageEncoding = 24,
+    FIX44_PositionReport_LastMsgSeqNumProcessed = 25,
+    FIX44_PositionReport_NoHops = 26,
+    FIX44_PositionReport_PosMaintRptID = 27,
+    FIX44_PositionReport_PosReqID = 28,
+    FIX44_PositionReport_PosReqType = 29,
+    FIX44_PositionReport_SubscriptionRequestType = 30,
+    FIX44_PositionReport_TotalNumPosReports = 31,
+    FIX44_PositionReport_UnsolicitedIndicator = 32,
+    FIX44_PositionReport_PosReqResult = 33,
+    FIX44_PositionReport_ClearingBusinessDate = 34,
+    FIX44_PositionReport_SettlSessID = 35,
+    FIX44_PositionReport_SettlSessSubID = 36,
+    FIX44_PositionReport_NoPartyIDs = 37,
+    FIX44_PositionReport_Account = 38,
+    FIX44_PositionReport_AcctIDSource = 39,
+    FIX44_PositionReport_AccountType = 40,
+    FIX44_PositionReport_Symbol = 41,
+    FIX44_PositionReport_SymbolSfx = 42,
+    FIX44_PositionReport_SecurityID = 43,
+    FIX44_PositionReport_SecurityIDSource = 44,
+    FIX44_PositionReport_NoSecurityAltID = 45,
+    FIX44_PositionReport_Product = 46,
+    FIX44_PositionReport_CFICode = 47,
+    FIX44_PositionReport_SecurityType = 48,
+    FIX44_PositionReport_SecuritySubType = 49,
+    FIX44_PositionReport_MaturityMonthYear = 50,
+    FIX44_PositionReport_MaturityDate = 51,
+    FIX44_PositionReport_CouponPaymentDate = 52,
+    FIX44_PositionReport_IssueDate = 53,
+    FIX44_PositionReport_RepoCollateralSecurityType = 54,
+    FIX44_PositionReport_RepurchaseTerm = 55,
+    FIX44_PositionReport_RepurchaseRate = 56,
+    FIX44_PositionReport_Factor = 57,
+    FIX44_PositionReport_CreditRating = 58,
+    FIX44_PositionReport_InstrRegistry = 59,
+    FIX44_PositionReport_CountryOfIssue = 60,
+    FIX44_PositionReport_StateOrProvinceOfIssue = 61,
+    FIX44_PositionReport_LocaleOfIssue = 62,
+    FIX44_PositionReport_RedemptionDate = 63,
+    FIX44_PositionReport_StrikePrice = 64,
+    FIX44_PositionReport_StrikeCurrency = 65,
+    FIX44_PositionReport_OptAttribute = 66,
+    FIX44_PositionReport_ContractMultiplier = 67,
+    FIX44_PositionReport_CouponRate = 68,
+    FIX44_PositionReport_SecurityExchange = 69,
+    FIX44_PositionReport_Issuer = 70,
+    FIX44_PositionReport_EncodedIssuerLen = 71,
+    FIX44_PositionReport_EncodedIssuer = 72,
+    FIX44_PositionReport_SecurityDesc = 73,
+    FIX44_PositionReport_EncodedSecurityDescLen = 74,
+    FIX44_PositionReport_EncodedSecurityDesc = 75,
+    FIX44_PositionReport_Pool = 76,
+    FIX44_PositionReport_ContractSettlMonth = 77,
+    FIX44_PositionReport_CPProgram = 78,
+    FIX44_PositionReport_CPRegType = 79,
+    FIX44_PositionReport_NoEvents = 80,
+    FIX44_PositionReport_DatedDate = 81,
+    FIX44_PositionReport_InterestAccrualDate = 82,
+    FIX44_PositionReport_Currency = 83,
+    FIX44_PositionReport_SettlPrice = 84,
+    FIX44_PositionReport_SettlPriceType = 85,
+    FIX44_PositionReport_PriorSettlPrice = 86,
+    FIX44_PositionReport_NoLegs = 87,
+    FIX44_PositionReport_NoUnderlyings = 88,
+    FIX44_PositionReport_NoPositions = 89,
+    FIX44_PositionReport_NoPosAmt = 90,
+    FIX44_PositionReport_RegistStatus = 91,
+    FIX44_PositionReport_DeliveryDate = 92,
+    FIX44_PositionReport_Text = 93,
+    FIX44_PositionReport_EncodedTextLen = 94,
+    FIX44_PositionReport_EncodedText = 95,
+    FIX44_PositionReport_SignatureLength = 96,
+    FIX44_PositionReport_Signature = 97,
+    FIX44_PositionReport_CheckSum = 98,
+};
+
+typedef struct _fix44PositionReport {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	PosMaintRptID;
+    struct _ofixStrView	PosReqID;
+    int64_t	PosReqType;
+    char	SubscriptionRequestType;
+    int64_t	TotalNumPosReports;
+    char	UnsolicitedIndicator;
+    int64_t	PosReqResult;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	Currency;
+    struct _ofixDecimal	SettlPrice;
+    int64_t	SettlPriceType;
+    struct _ofixDecimal	PriorSettlPrice;
+    int64_t	NoLegs;
+    int64_t	NoUnderlyings;
+    int64_t	NoPositions;
+    int64_t	NoPosAmt;
+    char	RegistStatus;
+    struct _ofixStrView	DeliveryDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44PositionReport;
+
+extern void	fix44_decode_PositionReport(ofixErr err, fix44PositionReport m, const char *raw, int len);
+extern void	fix44_decode_PositionReport_msg(ofixErr err, fix44PositionReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_PositionReport(ofixErr err, fix44PositionReport m);
+
+// TradeCaptureReportRequestAck [AQ]
+enum {
+    FIX44_TradeCaptureReportRequestAck_BeginString = 0,
+    FIX44_TradeCaptureReportRequestAck_BodyLength = 1,
+    FIX44_TradeCaptureReportRequestAck_MsgType = 2,
+    FIX44_TradeCaptureReportRequestAck_SenderCompID = 3,
+    FIX44_TradeCaptureReportRequestAck_TargetCompID = 4,
+    FIX44_TradeCaptureReportRequestAck_OnBehalfOfCompID = 5,
+    FIX44_TradeCaptureReportRequestAck_DeliverToCompID = 6,
+    FIX44_TradeCaptureReportRequestAck_SecureDataLen = 7,
+    FIX44_TradeCaptureReportRequestAck_SecureData = 8,
+    FIX44_TradeCaptureReportRequestAck_MsgSeqNum = 9,
+    FIX44_TradeCaptureReportRequestAck_SenderSubID = 10,
+    FIX44_TradeCaptureReportRequestAck_SenderLocationID = 11,
+    FIX44_TradeCaptureReportRequestAck_TargetSubID = 12,
+    FIX44_TradeCaptureReportRequestAck_TargetLocationID = 13,
+    FIX44_TradeCaptureReportRequestAck_OnBehalfOfSubID = 14,
+    FIX44_TradeCaptureReportRequestAck_OnBehalfOfLocationID = 15,
+    FIX44_TradeCaptureReportRequestAck_DeliverToSubID = 16,
+    FIX44_TradeCaptureReportRequestAck_DeliverToLocationID = 17,
+    FIX44_TradeCaptureReportRequestAck_PossDupFlag = 18,
+    FIX44_TradeCaptureReportRequestAck_PossResend = 19,
+    FIX44_TradeCaptureReportRequestAck_SendingTime = 20,
+    FIX44_TradeCaptureReportRequestAck_OrigSendingTime = 21,
+    FIX44_TradeCaptureReportRequestAck_XmlDataLen = 22,
+    FIX44_TradeCaptureReportRequestAck_XmlData = 23,
+    FIX44_TradeCaptureReportRequestAck_MessageEncoding = 24,
+    FIX44_TradeCaptureReportRequestAck_LastMsgSeqNumProcessed = 25,
+    FIX44_TradeCaptureReportRequestAck_NoHops = 26,
+    FIX44_TradeCaptureReportRequestAck_TradeRequestID = 27,
+    FIX44_TradeCaptureReportRequestAck_TradeRequestType = 28,
+    FIX44_TradeCaptureReportRequestAck_SubscriptionRequestType = 29,
+    FIX44_TradeCaptureReportRequestAck_TotNumTradeReports = 30,
+    FIX44_TradeCaptureReportRequestAck_TradeRequestResult = 31,
+    FIX44_TradeCaptureReportRequestAck_TradeRequestStatus = 32,
+    FIX44_TradeCaptureReportRequestAck_Symbol = 33,
+    FIX44_TradeCaptureReportRequestAck_SymbolSfx = 34,
+    FIX44_TradeCaptureReportRequestAck_SecurityID = 35,
+    FIX44_TradeCaptureReportRequestAck_SecurityIDSource = 36,
+    FIX44_TradeCaptureReportRequestAck_NoSecurityAltID = 37,
+    FIX44_TradeCaptureReportRequestAck_Product = 38,
+    FIX44_TradeCaptureReportRequestAck_CFICode = 39,
+    FIX44_TradeCaptureReportRequestAck_SecurityType = 40,
+    FIX44_TradeCaptureReportRequestAck_SecuritySubType = 41,
+    FIX44_TradeCaptureReportRequestAck_MaturityMonthYear = 42,
+    FIX44_TradeCaptureReportRequestAck_MaturityDate = 43,
+    FIX44_TradeCaptureReportRequestAck_CouponPaymentDate = 44,
+    FIX44_TradeCaptureReportRequestAck_IssueDate = 45,
+    FIX44_TradeCaptureReportRequestAck_RepoCollateralSecurityType = 46,
+    FIX44_TradeCaptureReportRequestAck_RepurchaseTerm = 47,
+    FIX44_TradeCaptureReportRequestAck_RepurchaseRate = 48,
+    FIX44_TradeCaptureReportRequestAck_Factor = 49,
+    FIX44_TradeCaptureReportRequestAck_CreditRating = 50,
+    FIX44_TradeCaptureReportRequestAck_InstrRegistry = 51,
+    FIX44_TradeCaptureReportRequestAck_CountryOfIssue = 52,
+    FIX44_TradeCaptureReportRequestAck_StateOrProvinceOfIssue = 53,
+    FIX44_TradeCaptureReportRequestAck_LocaleOfIssue = 54,
+    FIX44_TradeCaptureReportRequestAck_RedemptionDate = 55,
+    FIX44_TradeCaptureReportRequestAck_StrikePrice = 56,
+    FIX44_TradeCaptureReportRequestAck_StrikeCurrency = 57,
+    FIX44_TradeCaptureReportRequestAck_OptAttribute = 58,
+    FIX44_TradeCaptureReportRequestAck_ContractMultiplier = 59,
+    FIX44_TradeCaptureReportRequestAck_CouponRate = 60,
+    FIX44_TradeCaptureReportRequestAck_SecurityExchange = 61,
+    FIX44_TradeCaptureReportRequestAck_Issuer = 62,
+    FIX44_TradeCaptureReportRequestAck_EncodedIssuerLen = 63,
+    FIX44_TradeCaptureReportRequestAck_EncodedIssuer = 64,
+    FIX44_TradeCaptureReportRequestAck_SecurityDesc = 65,
+    FIX44_TradeCaptureReportRequestAck_EncodedSecurityDescLen = 66,
+    FIX44_TradeCaptureReportRequestAck_EncodedSecurityDesc = 67,
+    FIX44_TradeCaptureReportRequestAck_Pool = 68,
+    FIX44_TradeCaptureReportRequestAck_ContractSettlMonth = 69,
+    FIX44_TradeCaptureReportRequestAck_CPProgram = 70,
+    FIX44_TradeCaptureReportRequestAck_CPRegType = 71,
+    FIX44_TradeCaptureReportRequestAck_NoEvents = 72,
+    FIX44_TradeCaptureReportRequestAck_DatedDate = 73,
+    FIX44_TradeCaptureReportRequestAck_InterestAccrualDate = 74,
+    FIX44_TradeCaptureReportRequestAck_NoUnderlyings = 75,
+    FIX44_TradeCaptureReportRequestAck_NoLegs = 76,
+    FIX44_TradeCaptureReportRequestAck_MultiLegReportingType = 77,
+    FIX44_TradeCaptureReportRequestAck_ResponseTransportType = 78,
+    FIX44_TradeCaptureReportRequestAck_ResponseDestination = 79,
+    FIX44_TradeCaptureReportRequestAck_Text = 80,
+    FIX44_TradeCaptureReportRequestAck_EncodedTextLen = 81,
+    FIX44_TradeCaptureReportRequestAck_EncodedText = 82,
+    FIX44_TradeCaptureReportRequestAck_SignatureLength = 83,
+    FIX44_TradeCaptureReportRequestAck_Signature = 84,
+    FIX44_TradeCaptureReportRequestAck_CheckSum = 85,
+};
+
+typedef struct _fix44TradeCaptureReportRequestAck {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TradeRequestID;
+    int64_t	TradeRequestType;
+    char	SubscriptionRequestType;
+    int64_t	TotNumTradeReports;
+    int64_t	TradeRequestResult;
+    int64_t	TradeRequestStatus;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    char	MultiLegReportingType;
+    int64_t	ResponseTransportType;
+    struct _ofixStrView	ResponseDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44TradeCaptureReportRequestAck;
+
+extern void	fix44_decode_TradeCaptureReportRequestAck(ofixErr err, fix44TradeCaptureReportRequestAck m, const char *raw, int len);
+extern void	fix44_decode_TradeCaptureReportRequestAck_msg(ofixErr err, fix44TradeCaptureReportRequestAck m, ofixMsg msg);
+extern ofixMsg	fix44_encode_TradeCaptureReportRequestAck(ofixErr err, fix44TradeCaptureReportRequestAck m);
+
+// TradeCaptureReportAck [AR]
+enum {
+    FIX44_TradeCaptureReportAck_BeginString = 0,
+    FIX44_TradeCaptureReportAck_BodyLength = 1,
+    FIX44_TradeCaptureReportAck_MsgType = 2,
+    FIX44_TradeCaptureReportAck_SenderCompID = 3,
+    FIX44_TradeCaptureReportAck_TargetCompID = 4,
+    FIX44_TradeCaptureReportAck_OnBehalfOfCompID = 5,
+    FIX44_TradeCaptureReportAck_DeliverToCompID = 6,
+    FIX44_TradeCaptureReportAck_SecureDataLen = 7,
+    FIX44_TradeCaptureReportAck_SecureData = 8,
+    FIX44_TradeCaptureReportAck_MsgSeqNum = 9,
+    FIX44_TradeCaptureReportAck_SenderSubID = 10,
+    FIX44_TradeCaptureReportAck_SenderLocationID = 11,
+    FIX44_TradeCaptureReportAck_TargetSubID = 12,
+    FIX44_TradeCaptureReportAck_TargetLocationID = 13,
+    FIX44_TradeCaptureReportAck_OnBehalfOfSubID = 14,
+    FIX44_TradeCaptureReportAck_OnBehalfOfLocationID = 15,
+    FIX44_TradeCaptureReportAck_DeliverToSubID = 16,
+    FIX44_TradeCaptureReportAck_DeliverToLocationID = 17,
+    FIX44_TradeCaptureReportAck_PossDupFlag = 18,
+    FIX44_TradeCaptureReportAck_PossResend = 19,
+    FIX44_TradeCaptureReportAck_SendingTime = 20,
+    FIX44_TradeCaptureReportAck_OrigSendingTime = 21,
+    FIX44_TradeCaptureReportAck_XmlDataLen = 22,
+    FIX44_TradeCaptureReportAck_XmlData = 23,
+    FIX44_TradeCaptureReportAck_MessageEncoding = 24,
+    FIX44_TradeCaptureReportAck_LastMsgSeqNumProcessed = 25,
+    FIX44_TradeCaptureReportAck_NoHops = 26,
+    FIX44_TradeCaptureReportAck_TradeReportID = 27,
+    FIX44_TradeCaptureReportAck_TradeReportTransType = 28,
+    FIX44_TradeCaptureReportAck_TradeReportType = 29,
+    FIX44_TradeCaptureReportAck_TrdType = 30,
+    FIX44_TradeCaptureReportAck_TrdSubType = 31,
+    FIX44_TradeCaptureReportAck_SecondaryTrdType = 32,
+    FIX44_TradeCaptureReportAck_TransferReason = 33,
+    FIX44_TradeCaptureReportAck_ExecType = 34,
+    FIX44_TradeCaptureReportAck_TradeReportRefID = 35,
+    FIX44_TradeCaptureReportAck_SecondaryTradeReportRefID = 36,
+    FIX44_TradeCaptureReportAck_TrdRptStatus = 37,
+    FIX44_TradeCaptureReportAck_TradeReportRejectReason = 38,
+    FIX44_TradeCaptureReportAck_SecondaryTradeReportID = 39,
+    FIX44_TradeCaptureReportAck_SubscriptionRequestType = 40,
+    FIX44_TradeCaptureReportAck_TradeLinkID = 41,
+    FIX44_TradeCaptureReportAck_TrdMatchID = 42,
+    FIX44_TradeCaptureReportAck_ExecID = 43,
+    FIX44_TradeCaptureReportAck_SecondaryExecID = 44,
+    FIX44_TradeCaptureReportAck_Symbol = 45,
+    FIX44_TradeCaptureReportAck_SymbolSfx = 46,
+    FIX44_TradeCaptureReportAck_SecurityID = 47,
+    FIX44_TradeCaptureReportAck_SecurityIDSource = 48,
+    FIX44_TradeCaptureReportAck_NoSecurityAltID = 49,
+    FIX44_TradeCaptureReportAck_Product = 50,
+    FIX44_TradeCaptureReportAck_CFICode = 51,
+    FIX44_TradeCaptureReportAck_SecurityType = 52,
+    FIX44_TradeCaptureReportAck_SecuritySubType = 53,
+    FIX44_TradeCaptureReportAck_MaturityMonthYear = 54,
+    FIX44_TradeCaptureReportAck_MaturityDate = 55,
+    FIX44_TradeCaptureReportAck_CouponPaymentDate = 56,
+    FIX44_TradeCaptureReportAck_IssueDate = 57,
+    FIX44_TradeCaptureReportAck_RepoCollateralSecurityType = 58,
+    FIX44_TradeCaptureReportAck_RepurchaseTerm = 59,
+    FIX44_TradeCaptureReportAck_RepurchaseRate = 60,
+    FIX44_TradeCaptureReportAck_Factor = 61,
+    FIX44_TradeCaptureReportAck_CreditRating = 62,
+    FIX44_TradeCaptureReportAck_InstrRegistry = 63,
+    FIX44_TradeCaptureReportAck_CountryOfIssue = 64,
+    FIX44_TradeCaptureReportAck_StateOrProvinceOfIssue = 65,
+    FIX44_TradeCaptureReportAck_LocaleOfIssue = 66,
+    FIX44_TradeCaptureReportAck_RedemptionDate = 67,
+    FIX44_TradeCaptureReportAck_StrikePrice = 68,
+    FIX44_TradeCaptureReportAck_StrikeCurrency = 69,
+    FIX44_TradeCaptureReportAck_OptAttribute = 70,
+    FIX44_TradeCaptureReportAck_ContractMultiplier = 71,
+    FIX44_TradeCaptureReportAck_CouponRate = 72,
+    FIX44_TradeCaptureReportAck_SecurityExchange = 73,
+    FIX44_TradeCaptureReportAck_Issuer = 74,
+    FIX44_TradeCaptureReportAck_EncodedIssuerLen = 75,
+    FIX44_TradeCaptureReportAck_EncodedIssuer = 76,
+    FIX44_TradeCaptureReportAck_SecurityDesc = 77,
+    FIX44_TradeCaptureReportAck_EncodedSecurityDescLen = 78,
+    FIX44_TradeCaptureReportAck_EncodedSecurityDesc = 79,
+    FIX44_TradeCaptureReportAck_Pool = 80,
+    FIX44_TradeCaptureReportAck_ContractSettlMonth = 81,
+    FIX44_TradeCaptureReportAck_CPProgram = 82,
+    FIX44_TradeCaptureReportAck_CPRegType = 83,
+    FIX44_TradeCaptureReportAck_NoEvents = 84,
+    FIX44_TradeCaptureReportAck_DatedDate = 85,
+    FIX44_TradeCaptureReportAck_InterestAccrualDate = 86,
+    FIX44_TradeCaptureReportAck_TransactTime = 87,
+    FIX44_TradeCaptureReportAck_NoTrdRegTimestamps = 88,
+    FIX44_TradeCaptureReportAck_ResponseTransportType = 89,
+    FIX44_TradeCaptureReportAck_ResponseDestination = 90,
+    FIX44_TradeCaptureReportAck_Text = 91,
+    FIX44_TradeCaptureReportAck_EncodedTextLen = 92,
+    FIX44_TradeCaptureReportAck_EncodedText = 93,
+    FIX44_TradeCaptureReportAck_NoLegs = 94,
+    FIX44_TradeCaptureReportAck_ClearingFeeIndicator = 95,
+    FIX44_TradeCaptureReportAck_OrderCapacity = 96,
+    FIX44_TradeCaptureReportAck_OrderRestrictions = 97,
+    FIX44_TradeCaptureReportAck_CustOrderCapacity = 98,
+    FIX44_TradeCaptureReportAck_Account = 99,
+    FIX44_TradeCaptureReportAck_AcctIDSource = 100,
+    FIX44_TradeCaptureReportAck_AccountType = 101,
+    FIX44_TradeCaptureReportAck_PositionEffect = 102,
+    FIX44_TradeCaptureReportAck_PreallocMethod = 103,
+    FIX44_TradeCaptureReportAck_NoAllocs = 104,
+    FIX44_TradeCaptureReportAck_SignatureLength = 105,
+    FIX44_TradeCaptureReportAck_Signature = 106,
+    FIX44_TradeCaptureReportAck_CheckSum = 107,
+};
+
+typedef struct _fix44TradeCaptureReportAck {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TradeReportID;
+    int64_t	TradeReportTransType;
+    int64_t	TradeReportType;
+    int64_t	TrdType;
+    int64_t	TrdSubType;
+    int64_t	SecondaryTrdType;
+    struct _ofixStrView	TransferReason;
+    char	ExecType;
+    struct _ofixStrView	TradeReportRefID;
+    struct _ofixStrView	SecondaryTradeReportRefID;
+    int64_t	TrdRptStatus;
+    int64_t	TradeReportRejectReason;
+    struct _ofixStrView	SecondaryTradeReportID;
+    char	SubscriptionRequestType;
+    struct _ofixStrView	TradeLinkID;
+    struct _ofixStrView	TrdMatchID;
+    struct _ofixStrView	ExecID;
+    struct _ofixStrView	SecondaryExecID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixDate	TransactTime;
+    int64_t	NoTrdRegTimestamps;
+    int64_t	ResponseTransportType;
+    struct _ofixStrView	ResponseDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NoLegs;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    char	PositionEffect;
+    char	PreallocMethod;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44TradeCaptureReportAck;
+
+extern void	fix44_decode_TradeCaptureReportAck(ofixErr err, fix44TradeCaptureReportAck m, const char *raw, int len);
+extern void	fix44_decode_TradeCaptureReportAck_msg(ofixErr err, fix44TradeCaptureReportAck m, ofixMsg msg);
+extern ofixMsg	fix44_encode_TradeCaptureReportAck(ofixErr err, fix44TradeCaptureReportAck m);
+
+// AllocationReport [AS]
+enum {
+    FIX44_AllocationReport_BeginString = 0,
+    FIX44_AllocationReport_BodyLength = 1,
+    FIX44_AllocationReport_MsgType = 2,
+    FIX44_AllocationReport_SenderCompID = 3,
+    FIX44_AllocationReport_TargetCompID = 4,
+    FIX44_AllocationReport_OnBehalfOfCompID = 5,
+    FIX44_AllocationReport_DeliverToCompID = 6,
+    FIX44_AllocationReport_SecureDataLen = 7,
+    FIX44_AllocationReport_SecureData = 8,
+    FIX44_AllocationReport_MsgSeqNum = 9,
+    FIX44_AllocationReport_SenderSubID = 10,
+    FIX44_AllocationReport_SenderLocationID = 11,
+    FIX44_AllocationReport_TargetSubID = 12,
+    FIX44_AllocationReport_TargetLocationID = 13,
+    FIX44_AllocationReport_OnBehalfOfSubID = 14,
+    FIX44_AllocationReport_OnBehalfOfLocationID = 15,
+    FIX44_AllocationReport_DeliverToSubID = 16,
+    FIX44_AllocationReport_DeliverToLocationID = 17,
+    FIX44_AllocationReport_PossDupFlag = 18,
+    FIX44_AllocationReport_PossResend = 19,
+    FIX44_AllocationReport_SendingTime = 20,
+    FIX44_AllocationReport_OrigSendingTime = 21,
+    FIX44_AllocationReport_XmlDataLen = 22,
+    FIX44_AllocationReport_XmlData = 23,
+    FIX44_AllocationReport_MessageEncoding = 24,
+    FIX44_AllocationReport_LastMsgSeqNumProcessed = 25,
+    FIX44_AllocationReport_NoHops = 26,
+    FIX44_AllocationReport_AllocReportID = 27,
+    FIX44_AllocationReport_AllocID = 28,
+    FIX44_AllocationReport_AllocTransType = 29,
+    FIX44_AllocationReport_AllocReportRefID = 30,
+    FIX44_AllocationReport_AllocCancReplaceReason = 31,
+    FIX44_AllocationReport_SecondaryAllocID = 32,
+    FIX44_AllocationReport_AllocReportType = 33,
+    FIX44_AllocationReport_AllocStatus = 34,
+    FIX44_AllocationReport_AllocRejCode = 35,
+    FIX44_AllocationReport_RefAllocID = 36,
+    FIX44_AllocationReport_AllocIntermedReqType = 37,
+    FIX44_AllocationReport_AllocLinkID = 38,
+    FIX44_AllocationReport_AllocLinkType = 39,
+    FIX44_AllocationReport_BookingRefID = 40,
+    FIX44_AllocationReport_AllocNoOrdersType = 41,
+    FIX44_AllocationReport_NoOrders = 42,
+    FIX44_AllocationReport_NoExecs = 43,
+    FIX44_AllocationReport_PreviouslyReported = 44,
+    FIX44_AllocationReport_ReversalIndicator = 45,
+    FIX44_AllocationReport_MatchType = 46,
+    FIX44_AllocationReport_Side = 47,
+    FIX44_AllocationReport_Symbol = 48,
+    FIX44_AllocationReport_SymbolSfx = 49,
+    FIX44_AllocationReport_SecurityID = 50,
+    FIX44_AllocationReport_SecurityIDSource = 51,
+    FIX44_AllocationReport_NoSecurityAltID = 52,
+    FIX44_AllocationReport_Product = 53,
+    FIX44_AllocationReport_CFICode = 54,
+    FIX44_AllocationReport_SecurityType = 55,
+    FIX44_AllocationReport_SecuritySubType = 56,
+    FIX44_AllocationReport_MaturityMonthYear = 57,
+    FIX44_AllocationReport_MaturityDate = 58,
+    FIX44_AllocationReport_CouponPaymentDate = 59,
+    FIX44_AllocationReport_IssueDate = 60,
+    FIX44_AllocationReport_RepoCollateralSecurityType = 61,
+    FIX44_AllocationReport_RepurchaseTerm = 62,
+    FIX44_AllocationReport_RepurchaseRate = 63,
+    FIX44_AllocationReport_Factor = 64,
+    FIX44_AllocationReport_CreditRating = 65,
+    FIX44_AllocationReport_InstrRegistry = 66,
+    FIX44_AllocationReport_CountryOfIssue = 67,
+    FIX44_AllocationReport_StateOrProvinceOfIssue = 68,
+    FIX44_AllocationReport_LocaleOfIssue = 69,
+    FIX44_AllocationReport_RedemptionDate = 70,
+    FIX44_AllocationReport_StrikePrice = 71,
+    FIX44_AllocationReport_StrikeCurrency = 72,
+    FIX44_AllocationReport_OptAttribute = 73,
+    FIX44_AllocationReport_ContractMultiplier = 74,
+    FIX44_AllocationReport_CouponRate = 75,
+    FIX44_AllocationReport_SecurityExchange = 76,
+    FIX44_AllocationReport_Issuer = 77,
+    FIX44_AllocationReport_EncodedIssuerLen = 78,
+    FIX44_AllocationReport_EncodedIssuer = 79,
+    FIX44_AllocationReport_SecurityDesc = 80,
+    FIX44_AllocationReport_EncodedSecurityDescLen = 81,
+    FIX44_AllocationReport_EncodedSecurityDesc = 82,
+    FIX44_AllocationReport_Pool = 83,
+    FIX44_AllocationReport_ContractSettlMonth = 84,
+    FIX44_AllocationReport_CPProgram = 85,
+    FIX44_AllocationReport_CPRegType = 86,
+    FIX44_AllocationReport_NoEvents = 87,
+    FIX44_AllocationReport_DatedDate = 88,
+    FIX44_AllocationReport_InterestAccrualDate = 89,
+    FIX44_AllocationReport_DeliveryForm = 90,
+    FIX44_AllocationReport_PctAtRisk = 91,
+    FIX44_AllocationReport_NoInstrAttrib = 92,
+    FIX44_AllocationReport_AgreementDesc = 93,
+    FIX44_AllocationReport_AgreementID = 94,
+    FIX44_AllocationReport_AgreementDate = 95,
+    FIX44_AllocationReport_AgreementCurrency = 96,
+    FIX44_AllocationReport_TerminationType = 97,
+    FIX44_AllocationReport_StartDate = 98,
+    FIX44_AllocationReport_EndDate = 99,
+    FIX44_AllocationReport_DeliveryType = 100,
+    FIX44_AllocationReport_MarginRatio = 101,
+    FIX44_AllocationReport_NoUnderlyings = 102,
+    FIX44_AllocationReport_NoLegs = 103,
+    FIX44_AllocationReport_Quantity = 104,
+    FIX44_AllocationReport_QtyType = 105,
+    FIX44_AllocationReport_LastMkt = 106,
+    FIX44_AllocationReport_TradeOriginationDate = 107,
+    FIX44_AllocationReport_TradingSessionID = 108,
+    FIX44_AllocationReport_TradingSessionSubID = 109,
+    FIX44_AllocationReport_PriceType = 110,
+    FIX44_AllocationReport_AvgPx = 111,
+    FIX44_AllocationReport_AvgParPx = 112,
+    FIX44_AllocationReport_Spread = 113,
+    FIX44_AllocationReport_BenchmarkCurveCurrency = 114,
+    FIX44_AllocationReport_BenchmarkCurveName = 115,
+    FIX44_AllocationReport_BenchmarkCurvePoint = 116,
+    FIX44_AllocationReport_BenchmarkPrice = 117,
+    FIX44_AllocationReport_BenchmarkPriceType = 118,
+    FIX44_AllocationReport_BenchmarkSecurityID = 119,
+    FIX44_AllocationReport_BenchmarkSecurityIDSource = 120,
+    FIX44_AllocationReport_Currency = 121,
+    FIX44_AllocationReport_AvgPxPrecision = 122,
+    FIX44_AllocationReport_NoPartyIDs = 123,
+    FIX44_AllocationReport_TradeDate = 124,
+    FIX44_AllocationReport_TransactTime = 125,
+    FIX44_AllocationReport_SettlType = 126,
+    FIX44_AllocationReport_SettlDate = 127,
+    FIX44_AllocationReport_BookingType = 128,
+    FIX44_AllocationReport_GrossTradeAmt = 129,
+    FIX44_AllocationReport_Concession = 130,
+    FIX44_AllocationReport_TotalTakedown = 131,
+    FIX44_AllocationReport_NetMoney = 132,
+    FIX44_AllocationReport_PositionEffect = 133,
+    FIX44_AllocationReport_AutoAcceptIndicator = 134,
+    FIX44_AllocationReport_Text = 135,
+    FIX44_AllocationReport_EncodedTextLen = 136,
+    FIX44_AllocationReport_EncodedText = 137,
+    FIX44_AllocationReport_NumDaysInterest = 138,
+    FIX44_AllocationReport_AccruedInterestRate = 139,
+    FIX44_AllocationReport_AccruedInterestAmt = 140,
+    FIX44_AllocationReport_TotalAccruedInterestAmt = 141,
+    FIX44_AllocationReport_InterestAtMaturity = 142,
+    FIX44_AllocationReport_EndAccruedInterestAmt = 143,
+    FIX44_AllocationReport_StartCash = 144,
+    FIX44_AllocationReport_EndCash = 145,
+    FIX44_AllocationReport_LegalConfirm = 146,
+    FIX44_AllocationReport_NoStipulations = 147,
+    FIX44_AllocationReport_YieldType = 148,
+    FIX44_AllocationReport_Yield = 149,
+    FIX44_AllocationReport_YieldCalcDate = 150,
+    FIX44_AllocationReport_YieldRedemptionDate = 151,
+    FIX44_AllocationReport_YieldRedemptionPrice = 152,
+    FIX44_AllocationReport_YieldRedemptionPriceType = 153,
+    FIX44_AllocationReport_TotNoAllocs = 154,
+    FIX44_AllocationReport_LastFragment = 155,
+    FIX44_AllocationReport_NoAllocs = 156,
+    FIX44_AllocationReport_SignatureLength = 157,
+    FIX44_AllocationReport_Signature = 158,
+    FIX44_AllocationReport_CheckSum = 159,
+};
+
+typedef struct _fix44AllocationReport {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	AllocReportID;
+    struct _ofixStrView	AllocID;
+    char	AllocTransType;
+    struct _ofixStrView	AllocReportRefID;
+    int64_t	AllocCancReplaceReason;
+    struct _ofixStrView	SecondaryAllocID;
+    int64_t	AllocReportType;
+    int64_t	AllocStatus;
+    int64_t	AllocRejCode;
+    struct _ofixStrView	RefAllocID;
+    int64_t	AllocIntermedReqType;
+    struct _ofixStrView	AllocLinkID;
+    int64_t	AllocLinkType;
+    struct _ofixStrView	BookingRefID;
+    int64_t	AllocNoOrdersType;
+    int64_t	NoOrders;
+    int64_t	NoExecs;
+    char	PreviouslyReported;
+    char	ReversalIndicator;
+    struct _ofixStrView	MatchType;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	PriceType;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDecimal	AvgParPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	Currency;
+    int64_t	AvgPxPrecision;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    int64_t	BookingType;
+    struct _ofixDecimal	GrossTradeAmt;
+    struct _ofixDecimal	Concession;
+    struct _ofixDecimal	TotalTakedown;
+    struct _ofixDecimal	NetMoney;
+    char	PositionEffect;
+    char	AutoAcceptIndicator;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NumDaysInterest;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	TotalAccruedInterestAmt;
+    struct _ofixDecimal	InterestAtMaturity;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    char	LegalConfirm;
+    int64_t	NoStipulations;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    int64_t	TotNoAllocs;
+    char	LastFragment;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44AllocationReport;
+
+extern void	fix44_decode_AllocationReport(ofixErr err, fix44AllocationReport m, const char *raw, int len);
+extern void	fix44_decode_AllocationReport_msg(ofixErr err, fix44AllocationReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_AllocationReport(ofixErr err, fix44AllocationReport m);
+
+// AllocationReportAck [AT]
+enum {
+    FIX44_AllocationReportAck_BeginString = 0,
+    FIX44_AllocationReportAck_BodyLength = 1,
+    FIX44_AllocationReportAck_MsgType = 2,
+    FIX44_AllocationReportAck_SenderCompID = 3,
+    FIX44_AllocationReportAck_TargetCompID = 4,
+    FIX44_AllocationReportAck_OnBehalfOfCompID = 5,
+    FIX44_AllocationReportAck_DeliverToCompID = 6,
+    FIX44_AllocationReportAck_SecureDataLen = 7,
+    FIX44_AllocationReportAck_SecureData = 8,
+    FIX44_AllocationReportAck_MsgSeqNum = 9,
+    FIX44_AllocationReportAck_SenderSubID = 10,
+    FIX44_AllocationReportAck_SenderLocationID = 11,
+    FIX44_AllocationReportAck_TargetSubID = 12,
+    FIX44_AllocationReportAck_TargetLocationID = 13,
+    FIX44_AllocationReportAck_OnBehalfOfSubID = 14,
+    FIX44_AllocationReportAck_OnBehalfOfLocationID = 15,
+    FIX44_AllocationReportAck_DeliverToSubID = 16,
+    FIX44_AllocationReportAck_DeliverToLocationID = 17,
+    FIX44_AllocationReportAck_PossDupFlag = 18,
+    FIX44_AllocationReportAck_PossResend = 19,
+    FIX44_AllocationReportAck_SendingTime = 20,
+    FIX44_AllocationReportAck_OrigSendingTime = 21,
+    FIX44_AllocationReportAck_XmlDataLen = 22,
+    FIX44_AllocationReportAck_XmlData = 23,
+    FIX44_AllocationReportAck_MessageEncoding = 24,
+    FIX44_AllocationReportAck_LastMsgSeqNumProcessed = 25,
+    FIX44_AllocationReportAck_NoHops = 26,
+    FIX44_AllocationReportAck_AllocReportID = 27,
+    FIX44_AllocationReportAck_AllocID = 28,
+    FIX44_AllocationReportAck_NoPartyIDs = 29,
+    FIX44_AllocationReportAck_SecondaryAllocID = 30,
+    FIX44_AllocationReportAck_TradeDate = 31,
+    FIX44_AllocationReportAck_TransactTime = 32,
+    FIX44_AllocationReportAck_AllocStatus = 33,
+    FIX44_AllocationReportAck_AllocRejCode = 34,
+    FIX44_AllocationReportAck_AllocReportType = 35,
+    FIX44_AllocationReportAck_AllocIntermedReqType = 36,
+    FIX44_AllocationReportAck_MatchStatus = 37,
+    FIX44_AllocationReportAck_Product = 38,
+    FIX44_AllocationReportAck_SecurityType = 39,
+    FIX44_AllocationReportAck_Text = 40,
+    FIX44_AllocationReportAck_EncodedTextLen = 41,
+    FIX44_AllocationReportAck_EncodedText = 42,
+    FIX44_AllocationReportAck_NoAllocs = 43,
+    FIX44_AllocationReportAck_SignatureLength = 44,
+    FIX44_AllocationReportAck_Signature = 45,
+    FIX44_AllocationReportAck_CheckSum = 46,
+};
+
+typedef struct _fix44AllocationReportAck {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	AllocReportID;
+    struct _ofixStrView	AllocID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	SecondaryAllocID;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    int64_t	AllocStatus;
+    int64_t	AllocRejCode;
+    int64_t	AllocReportType;
+    int64_t	AllocIntermedReqType;
+    char	MatchStatus;
+    int64_t	Product;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44AllocationReportAck;
+
+extern void	fix44_decode_AllocationReportAck(ofixErr err, fix44AllocationReportAck m, const char *raw, int len);
+extern void	fix44_decode_AllocationReportAck_msg(ofixErr err, fix44AllocationReportAck m, ofixMsg msg);
+extern ofixMsg	fix44_encode_AllocationReportAck(ofixErr err, fix44AllocationReportAck m);
+
+// ConfirmationAck [AU]
+enum {
+    FIX44_ConfirmationAck_BeginString = 0,
+    FIX44_ConfirmationAck_BodyLength = 1,
+    FIX44_ConfirmationAck_MsgType = 2,
+    FIX44_ConfirmationAck_SenderCompID = 3,
+    FIX44_ConfirmationAck_TargetCompID = 4,
+    FIX44_ConfirmationAck_OnBehalfOfCompID = 5,
+    FIX44_ConfirmationAck_DeliverToCompID = 6,
+    FIX44_ConfirmationAck_SecureDataLen = 7,
+    FIX44_ConfirmationAck_SecureData = 8,
+    FIX44_ConfirmationAck_MsgSeqNum = 9,
+    FIX44_ConfirmationAck_SenderSubID = 10,
+    FIX44_ConfirmationAck_SenderLocationID = 11,
+    FIX44_ConfirmationAck_TargetSubID = 12,
+    FIX44_ConfirmationAck_TargetLocationID = 13,
+    FIX44_ConfirmationAck_OnBehalfOfSubID = 14,
+    FIX44_ConfirmationAck_OnBehalfOfLocationID = 15,
+    FIX44_ConfirmationAck_DeliverToSubID = 16,
+    FIX44_ConfirmationAck_DeliverToLocationID = 17,
+    FIX44_ConfirmationAck_PossDupFlag = 18,
+    FIX44_ConfirmationAck_PossResend = 19,
+    FIX44_ConfirmationAck_SendingTime = 20,
+    FIX44_ConfirmationAck_OrigSendingTime = 21,
+    FIX44_ConfirmationAck_XmlDataLen = 22,
+    FIX44_ConfirmationAck_XmlData = 23,
+    FIX44_ConfirmationAck_MessageEncoding = 24,
+    FIX44_ConfirmationAck_LastMsgSeqNumProcessed = 25,
+    FIX44_ConfirmationAck_NoHops = 26,
+    FIX44_ConfirmationAck_ConfirmID = 27,
+    FIX44_ConfirmationAck_TradeDate = 28,
+    FIX44_ConfirmationAck_TransactTime = 29,
+    FIX44_ConfirmationAck_AffirmStatus = 30,
+    FIX44_ConfirmationAck_ConfirmRejReason = 31,
+    FIX44_ConfirmationAck_MatchStatus = 32,
+    FIX44_ConfirmationAck_Text = 33,
+    FIX44_ConfirmationAck_EncodedTextLen = 34,
+    FIX44_ConfirmationAck_EncodedText = 35,
+    FIX44_ConfirmationAck_SignatureLength = 36,
+    FIX44_ConfirmationAck_Signature = 37,
+    FIX44_ConfirmationAck_CheckSum = 38,
+};
+
+typedef struct _fix44ConfirmationAck {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ConfirmID;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    int64_t	AffirmStatus;
+    int64_t	ConfirmRejReason;
+    char	MatchStatus;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ConfirmationAck;
+
+extern void	fix44_decode_ConfirmationAck(ofixErr err, fix44ConfirmationAck m, const char *raw, int len);
+extern void	fix44_decode_ConfirmationAck_msg(ofixErr err, fix44ConfirmationAck m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ConfirmationAck(ofixErr err, fix44ConfirmationAck m);
+
+// SettlementInstructionRequest [AV]
+enum {
+    FIX44_SettlementInstructionRequest_BeginString = 0,
+    FIX44_SettlementInstructionRequest_BodyLength = 1,
+    FIX44_SettlementInstructionRequest_MsgType = 2,
+    FIX44_SettlementInstructionRequest_SenderCompID = 3,
+    FIX44_SettlementInstructionRequest_TargetCompID = 4,
+    FIX44_SettlementInstructionRequest_OnBehalfOfCompID = 5,
+    FIX44_SettlementInstructionRequest_DeliverToCompID = 6,
+    FIX44_SettlementInstructionRequest_SecureDataLen = 7,
+    FIX44_SettlementInstructionRequest_SecureData = 8,
+    FIX44_SettlementInstructionRequest_MsgSeqNum = 9,
+    FIX44_SettlementInstructionRequest_SenderSubID = 10,
+    FIX44_SettlementInstructionRequest_SenderLocationID = 11,
+    FIX44_SettlementInstructionRequest_TargetSubID = 12,
+    FIX44_SettlementInstructionRequest_TargetLocationID = 13,
+    FIX44_SettlementInstructionRequest_OnBehalfOfSubID = 14,
+    FIX44_SettlementInstructionRequest_OnBehalfOfLocationID = 15,
+    FIX44_SettlementInstructionRequest_DeliverToSubID = 16,
+    FIX44_SettlementInstructionRequest_DeliverToLocationID = 17,
+    FIX44_SettlementInstructionRequest_PossDupFlag = 18,
+    FIX44_SettlementInstructionRequest_PossResend = 19,
+    FIX44_SettlementInstructionRequest_SendingTime = 20,
+    FIX44_SettlementInstructionRequest_OrigSendingTime = 21,
+    FIX44_SettlementInstructionRequest_XmlDataLen = 22,
+    FIX44_SettlementInstructionRequest_XmlData = 23,
+    FIX44_SettlementInstructionRequest_MessageEncoding = 24,
+    FIX44_SettlementInstructionRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_SettlementInstructionRequest_NoHops = 26,
+    FIX44_SettlementInstructionRequest_SettlInstReqID = 27,
+    FIX44_SettlementInstructionRequest_TransactTime = 28,
+    FIX44_SettlementInstructionRequest_NoPartyIDs = 29,
+    FIX44_SettlementInstructionRequest_AllocAccount = 30,
+    FIX44_SettlementInstructionRequest_AllocAcctIDSource = 31,
+    FIX44_SettlementInstructionRequest_Side = 32,
+    FIX44_SettlementInstructionRequest_Product = 33,
+    FIX44_SettlementInstructionRequest_SecurityType = 34,
+    FIX44_SettlementInstructionRequest_CFICode = 35,
+    FIX44_SettlementInstructionRequest_EffectiveTime = 36,
+    FIX44_SettlementInstructionRequest_ExpireTime = 37,
+    FIX44_SettlementInstructionRequest_LastUpdateTime = 38,
+    FIX44_SettlementInstructionRequest_StandInstDbType = 39,
+    FIX44_SettlementInstructionRequest_StandInstDbName = 40,
+    FIX44_SettlementInstructionRequest_StandInstDbID = 41,
+    FIX44_SettlementInstructionRequest_SignatureLength = 42,
+    FIX44_SettlementInstructionRequest_Signature = 43,
+    FIX44_SettlementInstructionRequest_CheckSum = 44,
+};
+
+typedef struct _fix44SettlementInstructionRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SettlInstReqID;
+    struct _ofixDate	TransactTime;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	AllocAccount;
+    int64_t	AllocAcctIDSource;
+    char	Side;
+    int64_t	Product;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	CFICode;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixDate	ExpireTime;
+    struct _ofixDate	LastUpdateTime;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SettlementInstructionRequest;
+
+extern void	fix44_decode_SettlementInstructionRequest(ofixErr err, fix44SettlementInstructionRequest m, const char *raw, int len);
+extern void	fix44_decode_SettlementInstructionRequest_msg(ofixErr err, fix44SettlementInstructionRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SettlementInstructionRequest(ofixErr err, fix44SettlementInstructionRequest m);
+
+// AssignmentReport [AW]
+enum {
+    FIX44_AssignmentReport_BeginString = 0,
+    FIX44_AssignmentReport_BodyLength = 1,
+    FIX44_AssignmentReport_MsgType = 2,
+    FIX44_AssignmentReport_SenderCompID = 3,
+    FIX44_AssignmentReport_TargetCompID = 4,
+    FIX44_AssignmentReport_OnBehalfOfCompID = 5,
+    FIX44_AssignmentReport_DeliverToCompID = 6,
+    FIX44_AssignmentReport_SecureDataLen = 7,
+    FIX44_AssignmentReport_SecureData = 8,
+    FIX44_AssignmentReport_MsgSeqNum = 9,
+    FIX44_AssignmentReport_SenderSubID = 10,
+    FIX44_AssignmentReport_SenderLocationID = 11,
+    FIX44_AssignmentReport_TargetSubID = 12,
+    FIX44_AssignmentReport_TargetLocationID = 13,
+    FIX44_AssignmentReport_OnBehalfOfSubID = 14,
+    FIX44_AssignmentReport_OnBehalfOfLocationID = 15,
+    FIX44_AssignmentReport_DeliverToSubID = 16,
+    FIX44_AssignmentReport_DeliverToLocationID = 17,
+    FIX44_AssignmentReport_PossDupFlag = 18,
+    FIX44_AssignmentReport_PossResend = 19,
+    FIX44_AssignmentReport_SendingTime = 20,
+    FIX44_AssignmentReport_OrigSendingTime = 21,
+    FIX44_AssignmentReport_XmlDataLen = 22,
+    FIX44_AssignmentReport_XmlData = 23,
+    FIX44_AssignmentReport_MessageEncoding = 24,
+    FIX44_AssignmentReport_LastMsgSeqNumProcessed = 25,
+    FIX44_AssignmentReport_NoHops = 26,
+    FIX44_AssignmentReport_AsgnRptID = 27,
+    FIX44_AssignmentReport_TotNumAssignmentReports = 28,
+    FIX44_AssignmentReport_LastRptRequested = 29,
+    FIX44_AssignmentReport_NoPartyIDs = 30,
+    FIX44_AssignmentReport_Account = 31,
+    FIX44_AssignmentReport_AccountType = 32,
+    FIX44_AssignmentReport_Symbol = 33,
+    FIX44_AssignmentReport_SymbolSfx = 34,
+    FIX44_AssignmentReport_SecurityID = 35,
+    FIX44_AssignmentReport_SecurityIDSource = 36,
+    FIX44_AssignmentReport_NoSecurityAltID = 37,
+    FIX44_AssignmentReport_Product = 38,
+    FIX44_AssignmentReport_CFICode = 39,
+    FIX44_AssignmentReport_SecurityType = 40,
+    FIX44_AssignmentReport_SecuritySubType = 41,
+    FIX44_AssignmentReport_MaturityMonthYear = 42,
+    FIX44_AssignmentReport_MaturityDate = 43,
+    FIX44_AssignmentReport_CouponPaymentDate = 44,
+    FIX44_AssignmentReport_IssueDate = 45,
+    FIX44_AssignmentReport_RepoCollateralSecurityType = 46,
+    FIX44_AssignmentReport_RepurchaseTerm = 47,
+    FIX44_AssignmentReport_RepurchaseRate = 48,
+    FIX44_AssignmentReport_Factor = 49,
+    FIX44_AssignmentReport_CreditRating = 50,
+    FIX44_AssignmentReport_InstrRegistry = 51,
+    FIX44_AssignmentReport_CountryOfIssue = 52,
+    FIX44_AssignmentReport_StateOrProvinceOfIssue = 53,
+    FIX44_AssignmentReport_LocaleOfIssue = 54,
+    FIX44_AssignmentReport_RedemptionDate = 55,
+    FIX44_AssignmentReport_StrikePrice = 56,
+    FIX44_AssignmentReport_StrikeCurrency = 57,
+    FIX44_AssignmentReport_OptAttribute = 58,
+    FIX44_AssignmentReport_ContractMultiplier = 59,
+    FIX44_AssignmentReport_CouponRate = 60,
+    FIX44_AssignmentReport_SecurityExchange = 61,
+    FIX44_AssignmentReport_Issuer = 62,
+    FIX44_AssignmentReport_EncodedIssuerLen = 63,
+    FIX44_AssignmentReport_EncodedIssuer = 64,
+    FIX44_AssignmentReport_SecurityDesc = 65,
+    FIX44_AssignmentReport_EncodedSecurityDescLen = 66,
+    FIX44_AssignmentReport_EncodedSecurityDesc = 67,
+    FIX44_AssignmentReport_Pool = 68,
+    FIX44_AssignmentReport_ContractSettlMonth = 69,
+    FIX44_AssignmentReport_CPProgram = 70,
+    FIX44_AssignmentReport_CPRegType = 71,
+    FIX44_AssignmentReport_NoEvents = 72,
+    FIX44_AssignmentReport_DatedDate = 73,
+    FIX44_AssignmentReport_InterestAccrualDate = 74,
+    FIX44_AssignmentReport_Currency = 75,
+    FIX44_AssignmentReport_NoLegs = 76,
+    FIX44_AssignmentReport_LegSymbol = 77,
+    FIX44_AssignmentReport_LegSymbolSfx = 78,
+    FIX44_AssignmentReport_LegSecurityID = 79,
+    FIX44_AssignmentReport_LegSecurityIDSource = 80,
+    FIX44_AssignmentReport_NoLegSecurityAltID = 81,
+    FIX44_AssignmentReport_LegProduct = 82,
+    FIX44_AssignmentReport_LegCFICode = 83,
+    FIX44_AssignmentReport_LegSecurityType = 84,
+    FIX44_AssignmentReport_LegSecuritySubType = 85,
+    FIX44_AssignmentReport_LegMaturityMonthYear = 86,
+    FIX44_AssignmentReport_LegMaturityDate = 87,
+    FIX44_AssignmentReport_LegCouponPaymentDate = 88,
+    FIX44_AssignmentReport_LegIssueDate = 89,
+    FIX44_AssignmentReport_LegRepoCollateralSecurityType = 90,
+    FIX44_AssignmentReport_LegRepurchaseTerm = 91,
+    FIX44_AssignmentReport_LegRepurchaseRate = 92,
+    FIX44_AssignmentReport_LegFactor = 93,
+    FIX44_AssignmentReport_LegCreditRating = 94,
+    FIX44_AssignmentReport_LegInstrRegistry = 95,
+    FIX44_AssignmentReport_LegCountryOfIssue = 96,
+    FIX44_AssignmentReport_LegStateOrProvinceOfIssue = 97,
+    FIX44_AssignmentReport_LegLocaleOfIssue = 98,
+    FIX44_AssignmentReport_LegRedemptionDate = 99,
+    FIX44_AssignmentReport_LegStrikePrice = 100,
+    FIX44_AssignmentReport_LegStrikeCurrency = 101,
+    FIX44_AssignmentReport_LegOptAttribute = 102,
+    FIX44_AssignmentReport_LegContractMultiplier = 103,
+    FIX44_AssignmentReport_LegCouponRate = 104,
+    FIX44_AssignmentReport_LegSecurityExchange = 105,
+    FIX44_AssignmentReport_LegIssuer = 106,
+    FIX44_AssignmentReport_EncodedLegIssuerLen = 107,
+    FIX44_AssignmentReport_EncodedLegIssuer = 108,
+    FIX44_AssignmentReport_LegSecurityDesc = 109,
+    FIX44_AssignmentReport_EncodedLegSecurityDescLen = 110,
+    FIX44_AssignmentReport_EncodedLegSecurityDesc = 111,
+    FIX44_AssignmentReport_LegRatioQty = 112,
+    FIX44_AssignmentReport_LegSide = 113,
+    FIX44_AssignmentReport_LegCurrency = 114,
+    FIX44_AssignmentReport_LegPool = 115,
+    FIX44_AssignmentReport_LegDatedDate = 116,
+    FIX44_AssignmentReport_LegContractSettlMonth = 117,
+    FIX44_AssignmentReport_LegInterestAccrualDate = 118,
+    FIX44_AssignmentReport_NoUnderlyings = 119,
+    FIX44_AssignmentReport_NoPositions = 120,
+    FIX44_AssignmentReport_NoPosAmt = 121,
+    FIX44_AssignmentReport_ThresholdAmount = 122,
+    FIX44_AssignmentReport_SettlPrice = 123,
+    FIX44_AssignmentReport_SettlPriceType = 124,
+    FIX44_AssignmentReport_UnderlyingSettlPrice = 125,
+    FIX44_AssignmentReport_ExpireDate = 126,
+    FIX44_AssignmentReport_AssignmentMethod = 127,
+    FIX44_AssignmentReport_AssignmentUnit = 128,
+    FIX44_AssignmentReport_OpenInterest = 129,
+    FIX44_AssignmentReport_ExerciseMethod = 130,
+    FIX44_AssignmentReport_SettlSessID = 131,
+    FIX44_AssignmentReport_SettlSessSubID = 132,
+    FIX44_AssignmentReport_ClearingBusinessDate = 133,
+    FIX44_AssignmentReport_Text = 134,
+    FIX44_AssignmentReport_EncodedTextLen = 135,
+    FIX44_AssignmentReport_EncodedText = 136,
+    FIX44_AssignmentReport_SignatureLength = 137,
+    FIX44_AssignmentReport_Signature = 138,
+    FIX44_AssignmentReport_CheckSum = 139,
+};
+
+typedef struct _fix44AssignmentReport {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	AsgnRptID;
+    int64_t	TotNumAssignmentReports;
+    char	LastRptRequested;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    struct _ofixStrView	LegSymbol;
+    struct _ofixStrView	LegSymbolSfx;
+    struct _ofixStrView	LegSecurityID;
+    struct _ofixStrView	LegSecurityIDSource;
+    struct _ofixStrView	NoLegSecurityAltID;
+    int64_t	LegProduct;
+    struct _ofixStrView	LegCFICode;
+    struct _ofixStrView	LegSecurityType;
+    struct _ofixStrView	LegSecuritySubType;
+    struct _ofixStrView	LegMaturityMonthYear;
+    struct _ofixStrView	LegMaturityDate;
+    struct _ofixStrView	LegCouponPaymentDate;
+    struct _ofixStrView	LegIssueDate;
+    int64_t	LegRepoCollateralSecurityType;
+    int64_t	LegRepurchaseTerm;
+    struct _ofixDecimal	LegRepurchaseRate;
+    struct _ofixDecimal	LegFactor;
+    struct _ofixStrView	LegCreditRating;
+    struct _ofixStrView	LegInstrRegistry;
+    struct _ofixStrView	LegCountryOfIssue;
+    struct _ofixStrView	LegStateOrProvinceOfIssue;
+    struct _ofixStrView	LegLocaleOfIssue;
+    struct _ofixStrView	LegRedemptionDate;
+    struct _ofixDecimal	LegStrikePrice;
+    struct _ofixStrView	LegStrikeCurrency;
+    char	LegOptAttribute;
+    struct _ofixDecimal	LegContractMultiplier;
+    struct _ofixDecimal	LegCouponRate;
+    struct _ofixStrView	LegSecurityExchange;
+    struct _ofixStrView	LegIssuer;
+    int64_t	EncodedLegIssuerLen;
+    struct _ofixStrView	EncodedLegIssuer;
+    struct _ofixStrView	LegSecurityDesc;
+    int64_t	EncodedLegSecurityDescLen;
+    struct _ofixStrView	EncodedLegSecurityDesc;
+    struct _ofixDecimal	LegRatioQty;
+    char	LegSide;
+    struct _ofixStrView	LegCurrency;
+    struct _ofixStrView	LegPool;
+    struct _ofixStrView	LegDatedDate;
+    struct _ofixStrView	LegContractSettlMonth;
+    struct _ofixStrView	LegInterestAccrualDate;
+    int64_t	NoUnderlyings;
+    int64_t	NoPositions;
+    int64_t	NoPosAmt;
+    struct _ofixDecimal	ThresholdAmount;
+    struct _ofixDecimal	SettlPrice;
+    int64_t	SettlPriceType;
+    struct _ofixDecimal	UnderlyingSettlPrice;
+    struct _ofixStrView	ExpireDate;
+    char	AssignmentMethod;
+    struct _ofixDecimal	AssignmentUnit;
+    struct _ofixDecimal	OpenInterest;
+    char	ExerciseMethod;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44AssignmentReport;
+
+extern void	fix44_decode_AssignmentReport(ofixErr err, fix44AssignmentReport m, const char *raw, int len);
+extern void	fix44_decode_AssignmentReport_msg(ofixErr err, fix44AssignmentReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_AssignmentReport(ofixErr err, fix44AssignmentReport m);
+
+// CollateralRequest [AX]
+enum {
+    FIX44_CollateralRequest_BeginString = 0,
+    FIX44_CollateralRequest_BodyLength = 1,
+    FIX44_CollateralRequest_MsgType = 2,
+    FIX44_CollateralRequest_SenderCompID = 3,
+    FIX44_CollateralRequest_TargetCompID = 4,
+    FIX44_CollateralRequest_OnBehalfOfCompID = 5,
+    FIX44_CollateralRequest_DeliverToCompID = 6,
+    FIX44_CollateralRequest_SecureDataLen = 7,
+    FIX44_CollateralRequest_SecureData = 8,
+    FIX44_CollateralRequest_MsgSeqNum = 9,
+    FIX44_CollateralRequest_SenderSubID = 10,
+    FIX44_CollateralRequest_SenderLocationID = 11,
+    FIX44_CollateralRequest_TargetSubID = 12,
+    FIX44_CollateralRequest_TargetLocationID = 13,
+    FIX44_CollateralRequest_OnBehalfOfSubID = 14,
+    FIX44_CollateralRequest_OnBehalfOfLocationID = 15,
+    FIX44_CollateralRequest_DeliverToSubID = 16,
+    FIX44_CollateralRequest_DeliverToLocationID = 17,
+    FIX44_CollateralRequest_PossDupFlag = 18,
+    FIX44_CollateralRequest_PossResend = 19,
+    FIX44_CollateralRequest_SendingTime = 20,
+    FIX44_CollateralRequest_OrigSendingTime = 21,
+    FIX44_CollateralRequest_XmlDataLen = 22,
+    FIX44_CollateralRequest_XmlData = 23,
+    FIX44_CollateralRequest_MessageEncoding = 24,
+    FIX44_CollateralRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_CollateralRequest_NoHops = 26,
+    FIX44_CollateralRequest_CollReqID = 27,
+    FIX44_CollateralRequest_CollAsgnReason = 28,
+    FIX44_CollateralRequest_TransactTime = 29,
+    FIX44_CollateralRequest_ExpireTime = 30,
+    FIX44_CollateralRequest_NoPartyIDs = 31,
+    FIX44_CollateralRequest_Account = 32,
+    FIX44_CollateralRequest_AccountType = 33,
+    FIX44_CollateralRequest_ClOrdID = 34,
+    FIX44_CollateralRequest_OrderID = 35,
+    FIX44_CollateralRequest_SecondaryOrderID = 36,
+    FIX44_CollateralRequest_SecondaryClOrdID = 37,
+    FIX44_CollateralRequest_NoExecs = 38,
+    FIX44_CollateralRequest_NoTrades = 39,
+    FIX44_CollateralRequest_Symbol = 40,
+    FIX44_CollateralRequest_SymbolSfx = 41,
+    FIX44_CollateralRequest_SecurityID = 42,
+    FIX44_CollateralRequest_SecurityIDSource = 43,
+    FIX44_CollateralRequest_NoSecurityAltID = 44,
+    FIX44_CollateralRequest_Product = 45,
+    FIX44_CollateralRequest_CFICode = 46,
+    FIX44_CollateralRequest_SecurityType = 47,
+    FIX44_CollateralRequest_SecuritySubType = 48,
+    FIX44_CollateralRequest_MaturityMonthYear = 49,
+    FIX44_CollateralRequest_MaturityDate = 50,
+    FIX44_CollateralRequest_CouponPaymentDate = 51,
+    FIX44_CollateralRequest_IssueDate = 52,
+    FIX44_CollateralRequest_RepoCollateralSecurityType = 53,
+    FIX44_CollateralRequest_RepurchaseTerm = 54,
+    FIX44_CollateralRequest_RepurchaseRate = 55,
+    FIX44_CollateralRequest_Factor = 56,
+    FIX44_CollateralRequest_CreditRating = 57,
+    FIX44_CollateralRequest_InstrRegistry = 58,
+    FIX44_CollateralRequest_CountryOfIssue = 59,
+    FIX44_CollateralRequest_StateOrProvinceOfIssue = 60,
+    FIX44_CollateralRequest_LocaleOfIssue = 61,
+    FIX44_CollateralRequest_RedemptionDate = 62,
+    FIX44_CollateralRequest_StrikePrice = 63,
+    FIX44_CollateralRequest_StrikeCurrency = 64,
+    FIX44_CollateralRequest_OptAttribute = 65,
+    FIX44_CollateralRequest_ContractMultiplier = 66,
+    FIX44_CollateralRequest_CouponRate = 67,
+    FIX44_CollateralRequest_SecurityExchange = 68,
+    FIX44_CollateralRequest_Issuer = 69,
+    FIX44_CollateralRequest_EncodedIssuerLen = 70,
+    FIX44_CollateralRequest_EncodedIssuer = 71,
+    FIX44_CollateralRequest_SecurityDesc = 72,
+    FIX44_CollateralRequest_EncodedSecurityDescLen = 73,
+    FIX44_CollateralRequest_EncodedSecurityDesc = 74,
+    FIX44_CollateralRequest_Pool = 75,
+    FIX44_CollateralRequest_ContractSettlMonth = 76,
+    FIX44_CollateralRequest_CPProgram = 77,
+    FIX44_CollateralRequest_CPRegType = 78,
+    FIX44_CollateralRequest_NoEvents = 79,
+    FIX44_CollateralRequest_DatedDate = 80,
+    FIX44_CollateralRequest_InterestAccrualDate = 81,
+    FIX44_CollateralRequest_AgreementDesc = 82,
+    FIX44_CollateralRequest_AgreementID = 83,
+    FIX44_CollateralRequest_AgreementDate = 84,
+    FIX44_CollateralRequest_AgreementCurrency = 85,
+    FIX44_CollateralRequest_TerminationType = 86,
+    FIX44_CollateralRequest_StartDate = 87,
+    FIX44_CollateralRequest_EndDate = 88,
+    FIX44_CollateralRequest_DeliveryType = 89,
+    FIX44_CollateralRequest_MarginRatio = 90,
+    FIX44_CollateralRequest_SettlDate = 91,
+    FIX44_CollateralRequest_Quantity = 92,
+    FIX44_CollateralRequest_QtyType = 93,
+    FIX44_CollateralRequest_Currency = 94,
+    FIX44_CollateralRequest_NoLegs = 95,
+    FIX44_CollateralRequest_LegSymbol = 96,
+    FIX44_CollateralRequest_LegSymbolSfx = 97,
+    FIX44_CollateralRequest_LegSecurityID = 98,
+    FIX44_CollateralRequest_LegSecurityIDSource = 99,
+    FIX44_CollateralRequest_NoLegSecurityAltID = 100,
+    FIX44_CollateralRequest_LegProduct = 101,
+    FIX44_CollateralRequest_LegCFICode = 102,
+    FIX44_CollateralRequest_LegSecurityType = 103,
+    FIX44_CollateralRequest_LegSecuritySubType = 104,
+    FIX44_CollateralRequest_LegMaturityMonthYear = 105,
+    FIX44_CollateralRequest_LegMaturityDate = 106,
+    FIX44_CollateralRequest_LegCouponPaymentDate = 107,
+    FIX44_CollateralRequest_LegIssueDate = 108,
+    FIX44_CollateralRequest_LegRepoCollateralSecurityType = 109,
+    FIX44_CollateralRequest_LegRepurchaseTerm = 110,
+    FIX44_CollateralRequest_LegRepurchaseRate = 111,
+    FIX44_CollateralRequest_LegFactor = 112,
+    FIX44_CollateralRequest_LegCreditRating = 113,
+    FIX44_CollateralRequest_LegInstrRegistry = 114,
+    FIX44_CollateralRequest_LegCountryOfIssue = 115,
+    FIX44_CollateralRequest_LegStateOrProvinceOfIssue = 116,
+    FIX44_CollateralRequest_LegLocaleOfIssue = 117,
+    FIX44_CollateralRequest_LegRedemptionDate = 118,
+    FIX44_CollateralRequest_LegStrikePrice = 119,
+    FIX44_CollateralRequest_LegStrikeCurrency = 120,
+    FIX44_CollateralRequest_LegOptAttribute = 121,
+    FIX44_CollateralRequest_LegContractMultiplier = 122,
+    FIX44_CollateralRequest_LegCouponRate = 123,
+    FIX44_CollateralRequest_LegSecurityExchange = 124,
+    FIX44_CollateralRequest_LegIssuer = 125,
+    FIX44_CollateralRequest_EncodedLegIssuerLen = 126,
+    FIX44_CollateralRequest_EncodedLegIssuer = 127,
+    FIX44_CollateralRequest_LegSecurityDesc = 128,
+    FIX44_CollateralRequest_EncodedLegSecurityDescLen = 129,
+    FIX44_CollateralRequest_EncodedLegSecurityDesc = 130,
+    FIX44_CollateralRequest_LegRatioQty = 131,
+    FIX44_CollateralRequest_LegSide = 132,
+    FIX44_CollateralRequest_LegCurrency = 133,
+    FIX44_CollateralRequest_LegPool = 134,
+    FIX44_CollateralRequest_LegDatedDate = 135,
+    FIX44_CollateralRequest_LegContractSettlMonth = 136,
+    FIX44_CollateralRequest_LegInterestAccrualDate = 137,
+    FIX44_CollateralRequest_NoUnderlyings = 138,
+    FIX44_CollateralRequest_MarginExcess = 139,
+    FIX44_CollateralRequest_TotalNetValue = 140,
+    FIX44_CollateralRequest_CashOutstanding = 141,
+    FIX44_CollateralRequest_NoTrdRegTimestamps = 142,
+    FIX44_CollateralRequest_Side = 143,
+    FIX44_CollateralRequest_NoMiscFees = 144,
+    FIX44_CollateralRequest_Price = 145,
+    FIX44_CollateralRequest_PriceType = 146,
+    FIX44_CollateralRequest_AccruedInterestAmt = 147,
+    FIX44_CollateralRequest_EndAccruedInterestAmt = 148,
+    FIX44_CollateralRequest_StartCash = 149,
+    FIX44_CollateralRequest_EndCash = 150,
+    FIX44_CollateralRequest_Spread = 151,
+    FIX44_CollateralRequest_BenchmarkCurveCurrency = 152,
+    FIX44_CollateralRequest_BenchmarkCurveName = 153,
+    FIX44_CollateralRequest_BenchmarkCurvePoint = 154,
+    FIX44_CollateralRequest_BenchmarkPrice = 155,
+    FIX44_CollateralRequest_BenchmarkPriceType = 156,
+    FIX44_CollateralRequest_BenchmarkSecurityID = 157,
+    FIX44_CollateralRequest_BenchmarkSecurityIDSource = 158,
+    FIX44_CollateralRequest_NoStipulations = 159,
+    FIX44_CollateralRequest_TradingSessionID = 160,
+    FIX44_CollateralRequest_TradingSessionSubID = 161,
+    FIX44_CollateralRequest_SettlSessID = 162,
+    FIX44_CollateralRequest_SettlSessSubID = 163,
+    FIX44_CollateralRequest_ClearingBusinessDate = 164,
+    FIX44_CollateralRequest_Text = 165,
+    FIX44_CollateralRequest_EncodedTextLen = 166,
+    FIX44_CollateralRequest_EncodedText = 167,
+    FIX44_CollateralRequest_SignatureLength = 168,
+    FIX44_CollateralRequest_Signature = 169,
+    FIX44_CollateralRequest_CheckSum = 170,
+};
+
+typedef struct _fix44CollateralRequest {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	CollReqID;
+    int64_t	CollAsgnReason;
+    struct _ofixDate	TransactTime;
+    struct _ofixDate	ExpireTime;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    int64_t	NoExecs;
+    int64_t	NoTrades;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    struct _ofixStrView	SettlDate;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    struct _ofixStrView	LegSymbol;
+    struct _ofixStrView	LegSymbolSfx;
+    struct _ofixStrView	LegSecurityID;
+    struct _ofixStrView	LegSecurityIDSource;
+    struct _ofixStrView	NoLegSecurityAltID;
+    int64_t	LegProduct;
+    struct _ofixStrView	LegCFICode;
+    struct _ofixStrView	LegSecurityType;
+    struct _ofixStrView	LegSecuritySubType;
+    struct _ofixStrView	LegMaturityMonthYear;
+    struct _ofixStrView	LegMaturityDate;
+    struct _ofixStrView	LegCouponPaymentDate;
+    struct _ofixStrView	LegIssueDate;
+    int64_t	LegRepoCollateralSecurityType;
+    int64_t	LegRepurchaseTerm;
+    struct _ofixDecimal	LegRepurchaseRate;
+    struct _ofixDecimal	LegFactor;
+    struct _ofixStrView	LegCreditRating;
+    struct _ofixStrView	LegInstrRegistry;
+    struct _ofixStrView	LegCountryOfIssue;
+    struct _ofixStrView	LegStateOrProvinceOfIssue;
+    struct _ofixStrView	LegLocaleOfIssue;
+    struct _ofixStrView	LegRedemptionDate;
+    struct _ofixDecimal	LegStrikePrice;
+    struct _ofixStrView	LegStrikeCurrency;
+    char	LegOptAttribute;
+    struct _ofixDecimal	LegContractMultiplier;
+    struct _ofixDecimal	LegCouponRate;
+    struct _ofixStrView	LegSecurityExchange;
+    struct _ofixStrView	LegIssuer;
+    int64_t	EncodedLegIssuerLen;
+    struct _ofixStrView	EncodedLegIssuer;
+    struct _ofixStrView	LegSecurityDesc;
+    int64_t	EncodedLegSecurityDescLen;
+    struct _ofixStrView	EncodedLegSecurityDesc;
+    struct _ofixDecimal	LegRatioQty;
+    char	LegSide;
+    struct _ofixStrView	LegCurrency;
+    struct _ofixStrView	LegPool;
+    struct _ofixStrView	LegDatedDate;
+    struct _ofixStrView	LegContractSettlMonth;
+    struct _ofixStrView	LegInterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	MarginExcess;
+    struct _ofixDecimal	TotalNetValue;
+    struct _ofixDecimal	CashOutstanding;
+    int64_t	NoTrdRegTimestamps;
+    char	Side;
+    int64_t	NoMiscFees;
+    struct _ofixDecimal	Price;
+    int64_t	PriceType;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    int64_t	NoStipulations;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CollateralRequest;
+
+extern void	fix44_decode_CollateralRequest(ofixErr err, fix44CollateralRequest m, const char *raw, int len);
+extern void	fix44_decode_CollateralRequest_msg(ofixErr err, fix44CollateralRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CollateralRequest(ofixErr err, fix44CollateralRequest m);
+
+// CollateralAssignment [AY]
+enum {
+    FIX44_CollateralAssignment_BeginString = 0,
+    FIX44_CollateralAssignment_BodyLength = 1,
+    FIX44_CollateralAssignment_MsgType = 2,
+    FIX44_CollateralAssignment_SenderCompID = 3,
+    FIX44_CollateralAssignment_TargetCompID = 4,
+    FIX44_CollateralAssignment_OnBehalfOfCompID = 5,
+    FIX44_CollateralAssignment_DeliverToCompID = 6,
+    FIX44_CollateralAssignment_SecureDataLen = 7,
+    FIX44_CollateralAssignment_SecureData = 8,
+    FIX44_CollateralAssignment_MsgSeqNum = 9,
+    FIX44_CollateralAssignment_SenderSubID = 10,
+    FIX44_CollateralAssignment_SenderLocationID = 11,
+    FIX44_CollateralAssignment_TargetSubID = 12,
+    FIX44_CollateralAssignment_TargetLocationID = 13,
+    FIX44_CollateralAssignment_OnBehalfOfSubID = 14,
+    FIX44_CollateralAssignment_OnBehalfOfLocationID = 15,
+    FIX44_CollateralAssignment_DeliverToSubID = 16,
+    FIX44_CollateralAssignment_DeliverToLocationID = 17,
+    FIX44_CollateralAssignment_PossDupFlag = 18,
+    FIX44_CollateralAssignment_PossResend = 19,
+    FIX44_CollateralAssignment_SendingTime = 20,
+    FIX44_CollateralAssignment_OrigSendingTime = 21,
+    FIX44_CollateralAssignment_XmlDataLen = 22,
+    FIX44_CollateralAssignment_XmlData = 23,
+    FIX44_CollateralAssignment_MessageEncoding = 24,
+    FIX44_CollateralAssignment_LastMsgSeqNumProcessed = 25,
+    FIX44_CollateralAssignment_NoHops = 26,
+    FIX44_CollateralAssignment_CollAsgnID = 27,
+    FIX44_CollateralAssignment_CollReqID = 28,
+    FIX44_CollateralAssignment_CollAsgnReason = 29,
+    FIX44_CollateralAssignment_CollAsgnTransType = 30,
+    FIX44_CollateralAssignment_CollAsgnRefID = 31,
+    FIX44_CollateralAssignment_TransactTime = 32,
+    FIX44_CollateralAssignment_ExpireTime = 33,
+    FIX44_CollateralAssignment_NoPartyIDs = 34,
+    FIX44_CollateralAssignment_Account = 35,
+    FIX44_CollateralAssignment_AccountType = 36,
+    FIX44_CollateralAssignment_ClOrdID = 37,
+    FIX44_CollateralAssignment_OrderID = 38,
+    FIX44_CollateralAssignment_SecondaryOrderID = 39,
+    FIX44_CollateralAssignment_SecondaryClOrdID = 40,
+    FIX44_CollateralAssignment_NoExecs = 41,
+    FIX44_CollateralAssignment_NoTrades = 42,
+    FIX44_CollateralAssignment_Symbol = 43,
+    FIX44_CollateralAssignment_SymbolSfx = 44,
+    FIX44_CollateralAssignment_SecurityID = 45,
+    FIX44_CollateralAssignment_SecurityIDSource = 46,
+    FIX44_CollateralAssignment_NoSecurityAltID = 47,
+    FIX44_CollateralAssignment_Product = 48,
+    FIX44_CollateralAssignment_CFICode = 49,
+    FIX44_CollateralAssignment_SecurityType = 50,
+    FIX44_CollateralAssignment_SecuritySubType = 51,
+    FIX44_CollateralAssignment_MaturityMonthYear = 52,
+    FIX44_CollateralAssignment_MaturityDate = 53,
+    FIX44_CollateralAssignment_CouponPaymentDate = 54,
+    FIX44_CollateralAssignment_IssueDate = 55,
+    FIX44_CollateralAssignment_RepoCollateralSecurityType = 56,
+    FIX44_CollateralAssignment_RepurchaseTerm = 57,
+    FIX44_CollateralAssignment_RepurchaseRate = 58,
+    FIX44_CollateralAssignment_Factor = 59,
+    FIX44_CollateralAssignment_CreditRating = 60,
+    FIX44_CollateralAssignment_InstrRegistry = 61,
+    FIX44_CollateralAssignment_CountryOfIssue = 62,
+    FIX44_CollateralAssignment_StateOrProvinceOfIssue = 63,
+    FIX44_CollateralAssignment_LocaleOfIssue = 64,
+    FIX44_CollateralAssignment_RedemptionDate = 65,
+    FIX44_CollateralAssignment_StrikePrice = 66,
+    FIX44_CollateralAssignment_StrikeCurrency = 67,
+    FIX44_CollateralAssignment_OptAttribute = 68,
+    FIX44_CollateralAssignment_ContractMultiplier = 69,
+    FIX44_CollateralAssignment_CouponRate = 70,
+    FIX44_CollateralAssignment_SecurityExchange = 71,
+    FIX44_CollateralAssignment_Issuer = 72,
+    FIX44_CollateralAssignment_EncodedIssuerLen = 73,
+    FIX44_CollateralAssignment_EncodedIssuer = 74,
+    FIX44_CollateralAssignment_SecurityDesc = 75,
+    FIX44_CollateralAssignment_EncodedSecurityDescLen = 76,
+    FIX44_CollateralAssignment_EncodedSecurityDesc = 77,
+    FIX44_CollateralAssignment_Pool = 78,
+    FIX44_CollateralAssignment_ContractSettlMonth = 79,
+    FIX44_CollateralAssignment_CPProgram = 80,
+    FIX44_CollateralAssignment_CPRegType = 81,
+    FIX44_CollateralAssignment_NoEvents = 82,
+    FIX44_CollateralAssignment_DatedDate = 83,
+    FIX44_CollateralAssignment_InterestAccrualDate = 84,
+    FIX44_CollateralAssignment_AgreementDesc = 85,
+    FIX44_CollateralAssignment_AgreementID = 86,
+    FIX44_CollateralAssignment_AgreementDate = 87,
+    FIX44_CollateralAssignment_AgreementCurrency = 88,
+    FIX44_CollateralAssignment_TerminationType = 89,
+    FIX44_CollateralAssignment_StartDate = 90,
+    FIX44_CollateralAssignment_EndDate = 91,
+    FIX44_CollateralAssignment_DeliveryType = 92,
+    FIX44_CollateralAssignment_MarginRatio = 93,
+    FIX44_CollateralAssignment_SettlDate = 94,
+    FIX44_CollateralAssignment_Quantity = 95,
+    FIX44_CollateralAssignment_QtyType = 96,
+    FIX44_CollateralAssignment_Currency = 97,
+    FIX44_CollateralAssignment_NoLegs = 98,
+    FIX44_CollateralAssignment_LegSymbol = 99,
+    FIX44_CollateralAssignment_LegSymbolSfx = 100,
+    FIX44_CollateralAssignment_LegSecurityID = 101,
+    FIX44_CollateralAssignment_LegSecurityIDSource = 102,
+    FIX44_CollateralAssignment_NoLegSecurityAltID = 103,
+    FIX44_CollateralAssignment_LegProduct = 104,
+    FIX44_CollateralAssignment_LegCFICode = 105,
+    FIX44_CollateralAssignment_LegSecurityType = 106,
+    FIX44_CollateralAssignment_LegSecuritySubType = 107,
+    FIX44_CollateralAssignment_LegMaturityMonthYear = 108,
+    FIX44_CollateralAssignment_LegMaturityDate = 109,
+    FIX44_CollateralAssignment_LegCouponPaymentDate = 110,
+    FIX44_CollateralAssignment_LegIssueDate = 111,
+    FIX44_CollateralAssignment_LegRepoCollateralSecurityType = 112,
+    FIX44_CollateralAssignment_LegRepurchaseTerm = 113,
+    FIX44_CollateralAssignment_LegRepurchaseRate = 114,
+    FIX44_CollateralAssignment_LegFactor = 115,
+    FIX44_CollateralAssignment_LegCreditRating = 116,
+    FIX44_CollateralAssignment_LegInstrRegistry = 117,
+    FIX44_CollateralAssignment_LegCountryOfIssue = 118,
+    FIX44_CollateralAssignment_LegStateOrProvinceOfIssue = 119,
+    FIX44_CollateralAssignment_LegLocaleOfIssue = 120,
+    FIX44_CollateralAssignment_LegRedemptionDate = 121,
+    FIX44_CollateralAssignment_LegStrikePrice = 122,
+    FIX44_CollateralAssignment_LegStrikeCurrency = 123,
+    FIX44_CollateralAssignment_LegOptAttribute = 124,
+    FIX44_CollateralAssignment_LegContractMultiplier = 125,
+    FIX44_CollateralAssignment_LegCouponRate = 126,
+    FIX44_CollateralAssignment_LegSecurityExchange = 127,
+    FIX44_CollateralAssignment_LegIssuer = 128,
+    FIX44_CollateralAssignment_EncodedLegIssuerLen = 129,
+    FIX44_CollateralAssignment_EncodedLegIssuer = 130,
+    FIX44_CollateralAssignment_LegSecurityDesc = 131,
+    FIX44_CollateralAssignment_EncodedLegSecurityDescLen = 132,
+    FIX44_CollateralAssignment_EncodedLegSecurityDesc = 133,
+    FIX44_CollateralAssignment_LegRatioQty = 134,
+    FIX44_CollateralAssignment_LegSide = 135,
+    FIX44_CollateralAssignment_LegCurrency = 136,
+    FIX44_CollateralAssignment_LegPool = 137,
+    FIX44_CollateralAssignment_LegDatedDate = 138,
+    FIX44_CollateralAssignment_LegContractSettlMonth = 139,
+    FIX44_CollateralAssignment_LegInterestAccrualDate = 140,
+    FIX44_CollateralAssignment_NoUnderlyings = 141,
+    FIX44_CollateralAssignment_MarginExcess = 142,
+    FIX44_CollateralAssignment_TotalNetValue = 143,
+    FIX44_CollateralAssignment_CashOutstanding = 144,
+    FIX44_CollateralAssignment_NoTrdRegTimestamps = 145,
+    FIX44_CollateralAssignment_Side = 146,
+    FIX44_CollateralAssignment_NoMiscFees = 147,
+    FIX44_CollateralAssignment_Price = 148,
+    FIX44_CollateralAssignment_PriceType = 149,
+    FIX44_CollateralAssignment_AccruedInterestAmt = 150,
+    FIX44_CollateralAssignment_EndAccruedInterestAmt = 151,
+    FIX44_CollateralAssignment_StartCash = 152,
+    FIX44_CollateralAssignment_EndCash = 153,
+    FIX44_CollateralAssignment_Spread = 154,
+    FIX44_CollateralAssignment_BenchmarkCurveCurrency = 155,
+    FIX44_CollateralAssignment_BenchmarkCurveName = 156,
+    FIX44_CollateralAssignment_BenchmarkCurvePoint = 157,
+    FIX44_CollateralAssignment_BenchmarkPrice = 158,
+    FIX44_CollateralAssignment_BenchmarkPriceType = 159,
+    FIX44_CollateralAssignment_BenchmarkSecurityID = 160,
+    FIX44_CollateralAssignment_BenchmarkSecurityIDSource = 161,
+    FIX44_CollateralAssignment_NoStipulations = 162,
+    FIX44_CollateralAssignment_SettlDeliveryType = 163,
+    FIX44_CollateralAssignment_StandInstDbType = 164,
+    FIX44_CollateralAssignment_StandInstDbName = 165,
+    FIX44_CollateralAssignment_StandInstDbID = 166,
+    FIX44_CollateralAssignment_NoDlvyInst = 167,
+    FIX44_CollateralAssignment_TradingSessionID = 168,
+    FIX44_CollateralAssignment_TradingSessionSubID = 169,
+    FIX44_CollateralAssignment_SettlSessID = 170,
+    FIX44_CollateralAssignment_SettlSessSubID = 171,
+    FIX44_CollateralAssignment_ClearingBusinessDate = 172,
+    FIX44_CollateralAssignment_Text = 173,
+    FIX44_CollateralAssignment_EncodedTextLen = 174,
+    FIX44_CollateralAssignment_EncodedText = 175,
+    FIX44_CollateralAssignment_SignatureLength = 176,
+    FIX44_CollateralAssignment_Signature = 177,
+    FIX44_CollateralAssignment_CheckSum = 178,
+};
+
+typedef struct _fix44CollateralAssignment {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	CollAsgnID;
+    struct _ofixStrView	CollReqID;
+    int64_t	CollAsgnReason;
+    int64_t	CollAsgnTransType;
+    struct _ofixStrView	CollAsgnRefID;
+    struct _ofixDate	TransactTime;
+    struct _ofixDate	ExpireTime;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    int64_t	NoExecs;
+    int64_t	NoTrades;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    struct _ofixStrView	SettlDate;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    struct _ofixStrView	LegSymbol;
+    struct _ofixStrView	LegSymbolSfx;
+    struct _ofixStrView	LegSecurityID;
+    struct _ofixStrView	LegSecurityIDSource;
+    struct _ofixStrView	NoLegSecurityAltID;
+    int64_t	LegProduct;
+    struct _ofixStrView	LegCFICode;
+    struct _ofixStrView	LegSecurityType;
+    struct _ofixStrView	LegSecuritySubType;
+    struct _ofixStrView	LegMaturityMonthYear;
+    struct _ofixStrView	LegMaturityDate;
+    struct _ofixStrView	LegCouponPaymentDate;
+    struct _ofixStrView	LegIssueDate;
+    int64_t	LegRepoCollateralSecurityType;
+    int64_t	LegRepurchaseTerm;
+    struct _ofixDecimal	LegRepurchaseRate;
+    struct _ofixDecimal	LegFactor;
+    struct _ofixStrView	LegCreditRating;
+    struct _ofixStrView	LegInstrRegistry;
+    struct _ofixStrView	LegCountryOfIssue;
+    struct _ofixStrView	LegStateOrProvinceOfIssue;
+    struct _ofixStrView	LegLocaleOfIssue;
+    struct _ofixStrView	LegRedemptionDate;
+    struct _ofixDecimal	LegStrikePrice;
+    struct _ofixStrView	LegStrikeCurrency;
+    char	LegOptAttribute;
+    struct _ofixDecimal	LegContractMultiplier;
+    struct _ofixDecimal	LegCouponRate;
+    struct _ofixStrView	LegSecurityExchange;
+    struct _ofixStrView	LegIssuer;
+    int64_t	EncodedLegIssuerLen;
+    struct _ofixStrView	EncodedLegIssuer;
+    struct _ofixStrView	LegSecurityDesc;
+    int64_t	EncodedLegSecurityDescLen;
+    struct _ofixStrView	EncodedLegSecurityDesc;
+    struct _ofixDecimal	LegRatioQty;
+    char	LegSide;
+    struct _ofixStrView	LegCurrency;
+    struct _ofixStrView	LegPool;
+    struct _ofixStrView	LegDatedDate;
+    struct _ofixStrView	LegContractSettlMonth;
+    struct _ofixStrView	LegInterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	MarginExcess;
+    struct _ofixDecimal	TotalNetValue;
+    struct _ofixDecimal	CashOutstanding;
+    int64_t	NoTrdRegTimestamps;
+    char	Side;
+    int64_t	NoMiscFees;
+    struct _ofixDecimal	Price;
+    int64_t	PriceType;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    int64_t	NoStipulations;
+    int64_t	SettlDeliveryType;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	NoDlvyInst;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CollateralAssignment;
+
+extern void	fix44_decode_CollateralAssignment(ofixErr err, fix44CollateralAssignment m, const char *raw, int len);
+extern void	fix44_decode_CollateralAssignment_msg(ofixErr err, fix44CollateralAssignment m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CollateralAssignment(ofixErr err, fix44CollateralAssignment m);
+
+// CollateralResponse [AZ]
+enum {
+    FIX44_CollateralResponse_BeginString = 0,
+    FIX44_CollateralResponse_BodyLength = 1,
+    FIX44_CollateralResponse_MsgType = 2,
+    FIX44_CollateralResponse_SenderCompID = 3,
+    FIX44_CollateralResponse_TargetCompID = 4,
+    FIX44_CollateralResponse_OnBehalfOfCompID = 5,
+    FIX44_CollateralResponse_DeliverToCompID = 6,
+    FIX44_CollateralResponse_SecureDataLen = 7,
+    FIX44_CollateralResponse_SecureData = 8,
+    FIX44_CollateralResponse_MsgSeqNum = 9,
+    FIX44_CollateralResponse_SenderSubID = 10,
+    FIX44_CollateralResponse_SenderLocationID = 11,
+    FIX44_CollateralResponse_TargetSubID = 12,
+    FIX44_CollateralResponse_TargetLocationID = 13,
+    FIX44_CollateralResponse_OnBehalfOfSubID = 14,
+    FIX44_CollateralResponse_OnBehalfOfLocationID = 15,
+    FIX44_CollateralResponse_DeliverToSubID = 16,
+    FIX44_CollateralResponse_DeliverToLocationID = 17,
+    FIX44_CollateralResponse_PossDupFlag = 18,
+    FIX44_CollateralResponse_PossResend = 19,
+    FIX44_CollateralResponse_SendingTime = 20,
+    FIX44_CollateralResponse_OrigSendingTime = 21,
+    FIX44_CollateralResponse_XmlDataLen = 22,
+    FIX44_CollateralResponse_XmlData = 23,
+    FIX44_CollateralResponse_MessageEncoding = 24,
+    FIX44_CollateralResponse_LastMsgSeqNumProcessed = 25,
+    FIX44_CollateralResponse_NoHops = 26,
+    FIX44_CollateralResponse_CollRespID = 27,
+    FIX44_CollateralResponse_CollAsgnID = 28,
+    FIX44_CollateralResponse_CollReqID = 29,
+    FIX44_CollateralResponse_CollAsgnReason = 30,
+    FIX44_CollateralResponse_CollAsgnTransType = 31,
+    FIX44_CollateralResponse_CollAsgnRespType = 32,
+    FIX44_CollateralResponse_CollAsgnRejectReason = 33,
+    FIX44_CollateralResponse_TransactTime = 34,
+    FIX44_CollateralResponse_NoPartyIDs = 35,
+    FIX44_CollateralResponse_Account = 36,
+    FIX44_CollateralResponse_AccountType = 37,
+    FIX44_CollateralResponse_ClOrdID = 38,
+    FIX44_CollateralResponse_OrderID = 39,
+    FIX44_CollateralResponse_SecondaryOrderID = 40,
+    FIX44_CollateralResponse_SecondaryClOrdID = 41,
+    FIX44_CollateralResponse_NoExecs = 42,
+    FIX44_CollateralResponse_NoTrades = 43,
+    FIX44_CollateralResponse_Symbol = 44,
+    FIX44_CollateralResponse_SymbolSfx = 45,
+    FIX44_CollateralResponse_SecurityID = 46,
+    FIX44_CollateralResponse_SecurityIDSource = 47,
+    FIX44_CollateralResponse_NoSecurityAltID = 48,
+    FIX44_CollateralResponse_Product = 49,
+    FIX44_CollateralResponse_CFICode = 50,
+    FIX44_CollateralResponse_SecurityType = 51,
+    FIX44_CollateralResponse_SecuritySubType = 52,
+    FIX44_CollateralResponse_MaturityMonthYear = 53,
+    FIX44_CollateralResponse_MaturityDate = 54,
+    FIX44_CollateralResponse_CouponPaymentDate = 55,
+    FIX44_CollateralResponse_IssueDate = 56,
+    FIX44_CollateralResponse_RepoCollateralSecurityType = 57,
+    FIX44_CollateralResponse_RepurchaseTerm = 58,
+    FIX44_CollateralResponse_RepurchaseRate = 59,
+    FIX44_CollateralResponse_Factor = 60,
+    FIX44_CollateralResponse_CreditRating = 61,
+    FIX44_CollateralResponse_InstrRegistry = 62,
+    FIX44_CollateralResponse_CountryOfIssue = 63,
+    FIX44_CollateralResponse_StateOrProvinceOfIssue = 64,
+    FIX44_CollateralResponse_LocaleOfIssue = 65,
+    FIX44_CollateralResponse_RedemptionDate = 66,
+    FIX44_CollateralResponse_StrikePrice = 67,
+    FIX44_CollateralResponse_StrikeCurrency = 68,
+    FIX44_CollateralResponse_OptAttribute = 69,
+    FIX44_CollateralResponse_ContractMultiplier = 70,
+    FIX44_CollateralResponse_CouponRate = 71,
+    FIX44_CollateralResponse_SecurityExchange = 72,
+    FIX44_CollateralResponse_Issuer = 73,
+    FIX44_CollateralResponse_EncodedIssuerLen = 74,
+    FIX44_CollateralResponse_EncodedIssuer = 75,
+    FIX44_CollateralResponse_SecurityDesc = 76,
+    FIX44_CollateralResponse_EncodedSecurityDescLen = 77,
+    FIX44_CollateralResponse_EncodedSecurityDesc = 78,
+    FIX44_CollateralResponse_Pool = 79,
+    FIX44_CollateralResponse_ContractSettlMonth = 80,
+    FIX44_CollateralResponse_CPProgram = 81,
+    FIX44_CollateralResponse_CPRegType = 82,
+    FIX44_CollateralResponse_NoEvents = 83,
+    FIX44_CollateralResponse_DatedDate = 84,
+    FIX44_CollateralResponse_InterestAccrualDate = 85,
+    FIX44_CollateralResponse_AgreementDesc = 86,
+    FIX44_CollateralResponse_AgreementID = 87,
+    FIX44_CollateralResponse_AgreementDate = 88,
+    FIX44_CollateralResponse_AgreementCurrency = 89,
+    FIX44_CollateralResponse_TerminationType = 90,
+    FIX44_CollateralResponse_StartDate = 91,
+    FIX44_CollateralResponse_EndDate = 92,
+    FIX44_CollateralResponse_DeliveryType = 93,
+    FIX44_CollateralResponse_MarginRatio = 94,
+    FIX44_CollateralResponse_SettlDate = 95,
+    FIX44_CollateralResponse_Quantity = 96,
+    FIX44_CollateralResponse_QtyType = 97,
+    FIX44_CollateralResponse_Currency = 98,
+    FIX44_CollateralResponse_NoLegs = 99,
+    FIX44_CollateralResponse_LegSymbol = 100,
+    FIX44_CollateralResponse_LegSymbolSfx = 101,
+    FIX44_CollateralResponse_LegSecurityID = 102,
+    FIX44_CollateralResponse_LegSecurityIDSource = 103,
+    FIX44_CollateralResponse_NoLegSecurityAltID = 104,
+    FIX44_CollateralResponse_LegProduct = 105,
+    FIX44_CollateralResponse_LegCFICode = 106,
+    FIX44_CollateralResponse_LegSecurityType = 107,
+    FIX44_CollateralResponse_LegSecuritySubType = 108,
+    FIX44_CollateralResponse_LegMaturityMonthYear = 109,
+    FIX44_CollateralResponse_LegMaturityDate = 110,
+    FIX44_CollateralResponse_LegCouponPaymentDate = 111,
+    FIX44_CollateralResponse_LegIssueDate = 112,
+    FIX44_CollateralResponse_LegRepoCollateralSecurityType = 113,
+    FIX44_CollateralResponse_LegRepurchaseTerm = 114,
+    FIX44_CollateralResponse_LegRepurchaseRate = 115,
+    FIX44_CollateralResponse_LegFactor = 116,
+    FIX44_CollateralResponse_LegCreditRating = 117,
+    FIX44_CollateralResponse_LegInstrRegistry = 118,
+    FIX44_CollateralResponse_LegCountryOfIssue = 119,
+    FIX44_CollateralResponse_LegStateOrProvinceOfIssue = 120,
+    FIX44_CollateralResponse_LegLocaleOfIssue = 121,
+    FIX44_CollateralResponse_LegRedemptionDate = 122,
+    FIX44_CollateralResponse_LegStrikePrice = 123,
+    FIX44_CollateralResponse_LegStrikeCurrency = 124,
+    FIX44_CollateralResponse_LegOptAttribute = 125,
+    FIX44_CollateralResponse_LegContractMultiplier = 126,
+    FIX44_CollateralResponse_LegCouponRate = 127,
+    FIX44_CollateralResponse_LegSecurityExchange = 128,
+    FIX44_CollateralResponse_LegIssuer = 129,
+    FIX44_CollateralResponse_EncodedLegIssuerLen = 130,
+    FIX44_CollateralResponse_EncodedLegIssuer = 131,
+    FIX44_CollateralResponse_LegSecurityDesc = 132,
+    FIX44_CollateralResponse_EncodedLegSecurityDescLen = 133,
+    FIX44_CollateralResponse_EncodedLegSecurityDesc = 134,
+    FIX44_CollateralResponse_LegRatioQty = 135,
+    FIX44_CollateralResponse_LegSide = 136,
+    FIX44_CollateralResponse_LegCurrency = 137,
+    FIX44_CollateralResponse_LegPool = 138,
+    FIX44_CollateralResponse_LegDatedDate = 139,
+    FIX44_CollateralResponse_LegContractSettlMonth = 140,
+    FIX44_CollateralResponse_LegInterestAccrualDate = 141,
+    FIX44_CollateralResponse_NoUnderlyings = 142,
+    FIX44_CollateralResponse_MarginExcess = 143,
+    FIX44_CollateralResponse_TotalNetValue = 144,
+    FIX44_CollateralResponse_CashOutstanding = 145,
+    FIX44_CollateralResponse_NoTrdRegTimestamps = 146,
+    FIX44_CollateralResponse_Side = 147,
+    FIX44_CollateralResponse_NoMiscFees = 148,
+    FIX44_CollateralResponse_Price = 149,
+    FIX44_CollateralResponse_PriceType = 150,
+    FIX44_CollateralResponse_AccruedInterestAmt = 151,
+    FIX44_CollateralResponse_EndAccruedInterestAmt = 152,
+    FIX44_CollateralResponse_StartCash = 153,
+    FIX44_CollateralResponse_EndCash = 154,
+    FIX44_CollateralResponse_Spread = 155,
+    FIX44_CollateralResponse_BenchmarkCurveCurrency = 156,
+    FIX44_CollateralResponse_BenchmarkCurveName = 157,
+    FIX44_CollateralResponse_BenchmarkCurvePoint = 158,
+    FIX44_CollateralResponse_BenchmarkPrice = 159,
+    FIX44_CollateralResponse_BenchmarkPriceType = 160,
+    FIX44_CollateralResponse_BenchmarkSecurityID = 161,
+    FIX44_CollateralResponse_BenchmarkSecurityIDSource = 162,
+    FIX44_CollateralResponse_NoStipulations = 163,
+    FIX44_CollateralResponse_Text = 164,
+    FIX44_CollateralResponse_EncodedTextLen = 165,
+    FIX44_CollateralResponse_EncodedText = 166,
+    FIX44_CollateralResponse_SignatureLength = 167,
+    FIX44_CollateralResponse_Signature = 168,
+    FIX44_CollateralResponse_CheckSum = 169,
+};
+
+typedef struct _fix44CollateralResponse {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	CollRespID;
+    struct _ofixStrView	CollAsgnID;
+    struct _ofixStrView	CollReqID;
+    int64_t	CollAsgnReason;
+    int64_t	CollAsgnTransType;
+    int64_t	CollAsgnRespType;
+    int64_t	CollAsgnRejectReason;
+    struct _ofixDate	TransactTime;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    int64_t	NoExecs;
+    int64_t	NoTrades;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    struct _ofixStrView	SettlDate;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    struct _ofixStrView	LegSymbol;
+    struct _ofixStrView	LegSymbolSfx;
+    struct _ofixStrView	LegSecurityID;
+    struct _ofixStrView	LegSecurityIDSource;
+    struct _ofixStrView	NoLegSecurityAltID;
+    int64_t	LegProduct;
+    struct _ofixStrView	LegCFICode;
+    struct _ofixStrView	LegSecurityType;
+    struct _ofixStrView	LegSecuritySubType;
+    struct _ofixStrView	LegMaturityMonthYear;
+    struct _ofixStrView	LegMaturityDate;
+    struct _ofixStrView	LegCouponPaymentDate;
+    struct _ofixStrView	LegIssueDate;
+    int64_t	LegRepoCollateralSecurityType;
+    int64_t	LegRepurchaseTerm;
+    struct _ofixDecimal	LegRepurchaseRate;
+    struct _ofixDecimal	LegFactor;
+    struct _ofixStrView	LegCreditRating;
+    struct _ofixStrView	LegInstrRegistry;
+    struct _ofixStrView	LegCountryOfIssue;
+    struct _ofixStrView	LegStateOrProvinceOfIssue;
+    struct _ofixStrView	LegLocaleOfIssue;
+    struct _ofixStrView	LegRedemptionDate;
+    struct _ofixDecimal	LegStrikePrice;
+    struct _ofixStrView	LegStrikeCurrency;
+    char	LegOptAttribute;
+    struct _ofixDecimal	LegContractMultiplier;
+    struct _ofixDecimal	LegCouponRate;
+    struct _ofixStrView	LegSecurityExchange;
+    struct _ofixStrView	LegIssuer;
+    int64_t	EncodedLegIssuerLen;
+    struct _ofixStrView	EncodedLegIssuer;
+    struct _ofixStrView	LegSecurityDesc;
+    int64_t	EncodedLegSecurityDescLen;
+    struct _ofixStrView	EncodedLegSecurityDesc;
+    struct _ofixDecimal	LegRatioQty;
+    char	LegSide;
+    struct _ofixStrView	LegCurrency;
+    struct _ofixStrView	LegPool;
+    struct _ofixStrView	LegDatedDate;
+    struct _ofixStrView	LegContractSettlMonth;
+    struct _ofixStrView	LegInterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	MarginExcess;
+    struct _ofixDecimal	TotalNetValue;
+    struct _ofixDecimal	CashOutstanding;
+    int64_t	NoTrdRegTimestamps;
+    char	Side;
+    int64_t	NoMiscFees;
+    struct _ofixDecimal	Price;
+    int64_t	PriceType;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    int64_t	NoStipulations;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CollateralResponse;
+
+extern void	fix44_decode_CollateralResponse(ofixErr err, fix44CollateralResponse m, const char *raw, int len);
+extern void	fix44_decode_CollateralResponse_msg(ofixErr err, fix44CollateralResponse m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CollateralResponse(ofixErr err, fix44CollateralResponse m);
+
+// News [B]
+enum {
+    FIX44_News_BeginString = 0,
+    FIX44_News_BodyLength = 1,
+    FIX44_News_MsgType = 2,
+    FIX44_News_SenderCompID = 3,
+    FIX44_News_TargetCompID = 4,
+    FIX44_News_OnBehalfOfCompID = 5,
+    FIX44_News_DeliverToCompID = 6,
+    FIX44_News_SecureDataLen = 7,
+    FIX44_News_SecureData = 8,
+    FIX44_News_MsgSeqNum = 9,
+    FIX44_News_SenderSubID = 10,
+    FIX44_News_SenderLocationID = 11,
+    FIX44_News_TargetSubID = 12,
+    FIX44_News_TargetLocationID = 13,
+    FIX44_News_OnBehalfOfSubID = 14,
+    FIX44_News_OnBehalfOfLocationID = 15,
+    FIX44_News_DeliverToSubID = 16,
+    FIX44_News_DeliverToLocationID = 17,
+    FIX44_News_PossDupFlag = 18,
+    FIX44_News_PossResend = 19,
+    FIX44_News_SendingTime = 20,
+    FIX44_News_OrigSendingTime = 21,
+    FIX44_News_XmlDataLen = 22,
+    FIX44_News_XmlData = 23,
+    FIX44_News_MessageEncoding = 24,
+    FIX44_News_LastMsgSeqNumProcessed = 25,
+    FIX44_News_NoHops = 26,
+    FIX44_News_OrigTime = 27,
+    FIX44_News_Urgency = 28,
+    FIX44_News_Headline = 29,
+    FIX44_News_EncodedHeadlineLen = 30,
+    FIX44_News_EncodedHeadline = 31,
+    FIX44_News_NoRoutingIDs = 32,
+    FIX44_News_NoRelatedSym = 33,
+    FIX44_News_NoLegs = 34,
+    FIX44_News_NoUnderlyings = 35,
+    FIX44_News_LinesOfText = 36,
+    FIX44_News_URLLink = 37,
+    FIX44_News_RawDataLength = 38,
+    FIX44_News_RawData = 39,
+    FIX44_News_SignatureLength = 40,
+    FIX44_News_Signature = 41,
+    FIX44_News_CheckSum = 42,
+};
+
+typedef struct _fix44News {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixDate	OrigTime;
+    char	Urgency;
+    struct _ofixStrView	Headline;
+    int64_t	EncodedHeadlineLen;
+    struct _ofixStrView	EncodedHeadline;
+    int64_t	NoRoutingIDs;
+    int64_t	NoRelatedSym;
+    int64_t	NoLegs;
+    int64_t	NoUnderlyings;
+    int64_t	LinesOfText;
+    struct _ofixStrView	URLLink;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44News;
+
+extern void	fix44_decode_News(ofixErr err, fix44News m, const char *raw, int len);
+extern void	fix44_decode_News_msg(ofixErr err, fix44News m, ofixMsg msg);
+extern ofixMsg	fix44_encode_News(ofixErr err, fix44News m);
+
+// CollateralReport [BA]
+enum {
+    FIX44_CollateralReport_BeginString = 0,
+    FIX44_CollateralReport_BodyLength = 1,
+    FIX44_CollateralReport_MsgType = 2,
+    FIX44_CollateralReport_SenderCompID = 3,
+    FIX44_CollateralReport_TargetCompID = 4,
+    FIX44_CollateralReport_OnBehalfOfCompID = 5,
+    FIX44_CollateralReport_DeliverToCompID = 6,
+    FIX44_CollateralReport_SecureDataLen = 7,
+    FIX44_CollateralReport_SecureData = 8,
+    FIX44_CollateralReport_MsgSeqNum = 9,
+    FIX44_CollateralReport_SenderSubID = 10,
+    FIX44_CollateralReport_SenderLocationID = 11,
+    FIX44_CollateralReport_TargetSubID = 12,
+    FIX44_CollateralReport_TargetLocationID = 13,
+    FIX44_CollateralReport_OnBehalfOfSubID = 14,
+    FIX44_CollateralReport_OnBehalfOfLocationID = 15,
+    FIX44_CollateralReport_DeliverToSubID = 16,
+    FIX44_CollateralReport_DeliverToLocationID = 17,
+    FIX44_CollateralReport_PossDupFlag = 18,
+    FIX44_CollateralReport_PossResend = 19,
+    FIX44_CollateralReport_SendingTime = 20,
+    FIX44_CollateralReport_OrigSendingTime = 21,
+    FIX44_CollateralReport_XmlDataLen = 22,
+    FIX44_CollateralReport_XmlData = 23,
+    FIX44_CollateralReport_MessageEncoding = 24,
+    FIX44_CollateralReport_LastMsgSeqNumProcessed = 25,
+    FIX44_CollateralReport_NoHops = 26,
+    FIX44_CollateralReport_CollRptID = 27,
+    FIX44_CollateralReport_CollInquiryID = 28,
+    FIX44_CollateralReport_CollStatus = 29,
+    FIX44_CollateralReport_TotNumReports = 30,
+    FIX44_CollateralReport_LastRptRequested = 31,
+    FIX44_CollateralReport_NoPartyIDs = 32,
+    FIX44_CollateralReport_Account = 33,
+    FIX44_CollateralReport_AccountType = 34,
+    FIX44_CollateralReport_ClOrdID = 35,
+    FIX44_CollateralReport_OrderID = 36,
+    FIX44_CollateralReport_SecondaryOrderID = 37,
+    FIX44_CollateralReport_SecondaryClOrdID = 38,
+    FIX44_CollateralReport_NoExecs = 39,
+    FIX44_CollateralReport_NoTrades = 40,
+    FIX44_CollateralReport_Symbol = 41,
+    FIX44_CollateralReport_SymbolSfx = 42,
+    FIX44_CollateralReport_SecurityID = 43,
+    FIX44_CollateralReport_SecurityIDSource = 44,
+    FIX44_CollateralReport_NoSecurityAltID = 45,
+    FIX44_CollateralReport_Product = 46,
+    FIX44_CollateralReport_CFICode = 47,
+    FIX44_CollateralReport_SecurityType = 48,
+    FIX44_CollateralReport_SecuritySubType = 49,
+    FIX44_CollateralReport_MaturityMonthYear = 50,
+    FIX44_CollateralReport_MaturityDate = 51,
+    FIX44_CollateralReport_CouponPaymentDate = 52,
+    FIX44_CollateralReport_IssueDate = 53,
+    FIX44_CollateralReport_RepoCollateralSecurityType = 54,
+    FIX44_CollateralReport_RepurchaseTerm = 55,
+    FIX44_CollateralReport_RepurchaseRate = 56,
+    FIX44_CollateralReport_Factor = 57,
+    FIX44_CollateralReport_CreditRating = 58,
+    FIX44_CollateralReport_InstrRegistry = 59,
+    FIX44_CollateralReport_CountryOfIssue = 60,
+    FIX44_CollateralReport_StateOrProvinceOfIssue = 61,
+    FIX44_CollateralReport_LocaleOfIssue = 62,
+    FIX44_CollateralReport_RedemptionDate = 63,
+    FIX44_CollateralReport_StrikePrice = 64,
+    FIX44_CollateralReport_StrikeCurrency = 65,
+    FIX44_CollateralReport_OptAttribute = 66,
+    FIX44_CollateralReport_ContractMultiplier = 67,
+    FIX44_CollateralReport_CouponRate = 68,
+    FIX44_CollateralReport_SecurityExchange = 69,
+    FIX44_CollateralReport_Issuer = 70,
+    FIX44_CollateralReport_EncodedIssuerLen = 71,
+    FIX44_CollateralReport_EncodedIssuer = 72,
+    FIX44_CollateralReport_SecurityDesc = 73,
+    FIX44_CollateralReport_EncodedSecurityDescLen = 74,
+    FIX44_CollateralReport_EncodedSecurityDesc = 75,
+    FIX44_CollateralReport_Pool = 76,
+    FIX44_CollateralReport_ContractSettlMonth = 77,
+    FIX44_CollateralReport_CPProgram = 78,
+    FIX44_CollateralReport_CPRegType = 79,
+    FIX44_CollateralReport_NoEvents = 80,
+    FIX44_CollateralReport_DatedDate = 81,
+    FIX44_CollateralReport_InterestAccrualDate = 82,
+    FIX44_CollateralReport_AgreementDesc = 83,
+    FIX44_CollateralReport_AgreementID = 84,
+    FIX44_CollateralReport_AgreementDate = 85,
+    FIX44_CollateralReport_AgreementCurrency = 86,
+    FIX44_CollateralReport_TerminationType = 87,
+    FIX44_CollateralReport_StartDate = 88,
+    FIX44_CollateralReport_EndDate = 89,
+    FIX44_CollateralReport_DeliveryType = 90,
+    FIX44_CollateralReport_MarginRatio = 91,
+    FIX44_CollateralReport_SettlDate = 92,
+    FIX44_CollateralReport_Quantity = 93,
+    FIX44_CollateralReport_QtyType = 94,
+    FIX44_CollateralReport_Currency = 95,
+    FIX44_CollateralReport_NoLegs = 96,
+    FIX44_CollateralReport_LegSymbol = 97,
+    FIX44_CollateralReport_LegSymbolSfx = 98,
+    FIX44_CollateralReport_LegSecurityID = 99,
+    FIX44_CollateralReport_LegSecurityIDSource = 100,
+    FIX44_CollateralReport_NoLegSecurityAltID = 101,
+    FIX44_CollateralReport_LegProduct = 102,
+    FIX44_CollateralReport_LegCFICode = 103,
+    FIX44_CollateralReport_LegSecurityType = 104,
+    FIX44_CollateralReport_LegSecuritySubType = 105,
+    FIX44_CollateralReport_LegMaturityMonthYear = 106,
+    FIX44_CollateralReport_LegMaturityDate = 107,
+    FIX44_CollateralReport_LegCouponPaymentDate = 108,
+    FIX44_CollateralReport_LegIssueDate = 109,
+    FIX44_CollateralReport_LegRepoCollateralSecurityType = 110,
+    FIX44_CollateralReport_LegRepurchaseTerm = 111,
+    FIX44_CollateralReport_LegRepurchaseRate = 112,
+    FIX44_CollateralReport_LegFactor = 113,
+    FIX44_CollateralReport_LegCreditRating = 114,
+    FIX44_CollateralReport_LegInstrRegistry = 115,
+    FIX44_CollateralReport_LegCountryOfIssue = 116,
+    FIX44_CollateralReport_LegStateOrProvinceOfIssue = 117,
+    FIX44_CollateralReport_LegLocaleOfIssue = 118,
+    FIX44_CollateralReport_LegRedemptionDate = 119,
+    FIX44_CollateralReport_LegStrikePrice = 120,
+    FIX44_CollateralReport_LegStrikeCurrency = 121,
+    FIX44_CollateralReport_LegOptAttribute = 122,
+    FIX44_CollateralReport_LegContractMultiplier = 123,
+    FIX44_CollateralReport_LegCouponRate = 124,
+    FIX44_CollateralReport_LegSecurityExchange = 125,
+    FIX44_CollateralReport_LegIssuer = 126,
+    FIX44_CollateralReport_EncodedLegIssuerLen = 127,
+    FIX44_CollateralReport_EncodedLegIssuer = 128,
+    FIX44_CollateralReport_LegSecurityDesc = 129,
+    FIX44_CollateralReport_EncodedLegSecurityDescLen = 130,
+    FIX44_CollateralReport_EncodedLegSecurityDesc = 131,
+    FIX44_CollateralReport_LegRatioQty = 132,
+    FIX44_CollateralReport_LegSide = 133,
+    FIX44_CollateralReport_LegCurrency = 134,
+    FIX44_CollateralReport_LegPool = 135,
+    FIX44_CollateralReport_LegDatedDate = 136,
+    FIX44_CollateralReport_LegContractSettlMonth = 137,
+    FIX44_CollateralReport_LegInterestAccrualDate = 138,
+    FIX44_CollateralReport_NoUnderlyings = 139,
+    FIX44_CollateralReport_MarginExcess = 140,
+    FIX44_CollateralReport_TotalNetValue = 141,
+    FIX44_CollateralReport_CashOutstanding = 142,
+    FIX44_CollateralReport_NoTrdRegTimestamps = 143,
+    FIX44_CollateralReport_Side = 144,
+    FIX44_CollateralReport_NoMiscFees = 145,
+    FIX44_CollateralReport_Price = 146,
+    FIX44_CollateralReport_PriceType = 147,
+    FIX44_CollateralReport_AccruedInterestAmt = 148,
+    FIX44_CollateralReport_EndAccruedInterestAmt = 149,
+    FIX44_CollateralReport_StartCash = 150,
+    FIX44_CollateralReport_EndCash = 151,
+    FIX44_CollateralReport_Spread = 152,
+    FIX44_CollateralReport_BenchmarkCurveCurrency = 153,
+    FIX44_CollateralReport_BenchmarkCurveName = 154,
+    FIX44_CollateralReport_BenchmarkCurvePoint = 155,
+    FIX44_CollateralReport_BenchmarkPrice = 156,
+    FIX44_CollateralReport_BenchmarkPriceType = 157,
+    FIX44_CollateralReport_BenchmarkSecurityID = 158,
+    FIX44_CollateralReport_BenchmarkSecurityIDSource = 159,
+    FIX44_CollateralReport_NoStipulations = 160,
+    FIX44_CollateralReport_SettlDeliveryType = 161,
+    FIX44_CollateralReport_StandInstDbType = 162,
+    FIX44_CollateralReport_StandInstDbName = 163,
+    FIX44_CollateralReport_StandInstDbID = 164,
+    FIX44_CollateralReport_NoDlvyInst = 165,
+    FIX44_CollateralReport_TradingSessionID = 166,
+    FIX44_CollateralReport_TradingSessionSubID = 167,
+    FIX44_CollateralReport_SettlSessID = 168,
+    FIX44_CollateralReport_SettlSessSubID = 169,
+    FIX44_CollateralReport_ClearingBusinessDate = 170,
+    FIX44_CollateralReport_Text = 171,
+    FIX44_CollateralReport_EncodedTextLen = 172,
+    FIX44_CollateralReport_EncodedText = 173,
+    FIX44_CollateralReport_SignatureLength = 174,
+    FIX44_CollateralReport_Signature = 175,
+    FIX44_CollateralReport_CheckSum = 176,
+};
+
+typedef struct _fix44CollateralReport {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	CollRptID;
+    struct _ofixStrView	CollInquiryID;
+    int64_t	CollStatus;
+    int64_t	TotNumReports;
+    char	LastRptRequested;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    int64_t	NoExecs;
+    int64_t	NoTrades;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    struct _ofixStrView	SettlDate;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    struct _ofixStrView	LegSymbol;
+    struct _ofixStrView	LegSymbolSfx;
+    struct _ofixStrView	LegSecurityID;
+    struct _ofixStrView	LegSecurityIDSource;
+    struct _ofixStrView	NoLegSecurityAltID;
+    int64_t	LegProduct;
+    struct _ofixStrView	LegCFICode;
+    struct _ofixStrView	LegSecurityType;
+    struct _ofixStrView	LegSecuritySubType;
+    struct _ofixStrView	LegMaturityMonthYear;
+    struct _ofixStrView	LegMaturityDate;
+    struct _ofixStrView	LegCouponPaymentDate;
+    struct _ofixStrView	LegIssueDate;
+    int64_t	LegRepoCollateralSecurityType;
+    int64_t	LegRepurchaseTerm;
+    struct _ofixDecimal	LegRepurchaseRate;
+    struct _ofixDecimal	LegFactor;
+    struct _ofixStrView	LegCreditRating;
+    struct _ofixStrView	LegInstrRegistry;
+    struct _ofixStrView	LegCountryOfIssue;
+    struct _ofixStrView	LegStateOrProvinceOfIssue;
+    struct _ofixStrView	LegLocaleOfIssue;
+    struct _ofixStrView	LegRedemptionDate;
+    struct _ofixDecimal	LegStrikePrice;
+    struct _ofixStrView	LegStrikeCurrency;
+    char	LegOptAttribute;
+    struct _ofixDecimal	LegContractMultiplier;
+    struct _ofixDecimal	LegCouponRate;
+    struct _ofixStrView	LegSecurityExchange;
+    struct _ofixStrView	LegIssuer;
+    int64_t	EncodedLegIssuerLen;
+    struct _ofixStrView	EncodedLegIssuer;
+    struct _ofixStrView	LegSecurityDesc;
+    int64_t	EncodedLegSecurityDescLen;
+    struct _ofixStrView	EncodedLegSecurityDesc;
+    struct _ofixDecimal	LegRatioQty;
+    char	LegSide;
+    struct _ofixStrView	LegCurrency;
+    struct _ofixStrView	LegPool;
+    struct _ofixStrView	LegDatedDate;
+    struct _ofixStrView	LegContractSettlMonth;
+    struct _ofixStrView	LegInterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	MarginExcess;
+    struct _ofixDecimal	TotalNetValue;
+    struct _ofixDecimal	CashOutstanding;
+    int64_t	NoTrdRegTimestamps;
+    char	Side;
+    int64_t	NoMiscFees;
+    struct _ofixDecimal	Price;
+    int64_t	PriceType;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    int64_t	NoStipulations;
+    int64_t	SettlDeliveryType;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	NoDlvyInst;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CollateralReport;
+
+extern void	fix44_decode_CollateralReport(ofixErr err, fix44CollateralReport m, const char *raw, int len);
+extern void	fix44_decode_CollateralReport_msg(ofixErr err, fix44CollateralReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CollateralReport(ofixErr err, fix44CollateralReport m);
+
+// CollateralInquiry [BB]
+enum {
+    FIX44_CollateralInquiry_BeginString = 0,
+    FIX44_CollateralInquiry_BodyLength = 1,
+    FIX44_CollateralInquiry_MsgType = 2,
+    FIX44_CollateralInquiry_SenderCompID = 3,
+    FIX44_CollateralInquiry_TargetCompID = 4,
+    FIX44_CollateralInquiry_OnBehalfOfCompID = 5,
+    FIX44_CollateralInquiry_DeliverToCompID = 6,
+    FIX44_CollateralInquiry_SecureDataLen = 7,
+    FIX44_CollateralInquiry_SecureData = 8,
+    FIX44_CollateralInquiry_MsgSeqNum = 9,
+    FIX44_CollateralInquiry_SenderSubID = 10,
+    FIX44_CollateralInquiry_SenderLocationID = 11,
+    FIX44_CollateralInquiry_TargetSubID = 12,
+    FIX44_CollateralInquiry_TargetLocationID = 13,
+    FIX44_CollateralInquiry_OnBehalfOfSubID = 14,
+    FIX44_CollateralInquiry_OnBehalfOfLocationID = 15,
+    FIX44_CollateralInquiry_DeliverToSubID = 16,
+    FIX44_CollateralInquiry_DeliverToLocationID = 17,
+    FIX44_CollateralInquiry_PossDupFlag = 18,
+    FIX44_CollateralInquiry_PossResend = 19,
+    FIX44_CollateralInquiry_SendingTime = 20,
+    FIX44_CollateralInquiry_OrigSendingTime = 21,
+    FIX44_CollateralInquiry_XmlDataLen = 22,
+    FIX44_CollateralInquiry_XmlData = 23,
+    FIX44_CollateralInquiry_MessageEncoding = 24,
+    FIX44_CollateralInquiry_LastMsgSeqNumProcessed = 25,
+    FIX44_CollateralInquiry_NoHops = 26,
+    FIX44_CollateralInquiry_CollInquiryID = 27,
+    FIX44_CollateralInquiry_NoCollInquiryQualifier = 28,
+    FIX44_CollateralInquiry_SubscriptionRequestType = 29,
+    FIX44_CollateralInquiry_ResponseTransportType = 30,
+    FIX44_CollateralInquiry_ResponseDestination = 31,
+    FIX44_CollateralInquiry_NoPartyIDs = 32,
+    FIX44_CollateralInquiry_Account = 33,
+    FIX44_CollateralInquiry_AccountType = 34,
+    FIX44_CollateralInquiry_ClOrdID = 35,
+    FIX44_CollateralInquiry_OrderID = 36,
+    FIX44_CollateralInquiry_SecondaryOrderID = 37,
+    FIX44_CollateralInquiry_SecondaryClOrdID = 38,
+    FIX44_CollateralInquiry_NoExecs = 39,
+    FIX44_CollateralInquiry_NoTrades = 40,
+    FIX44_CollateralInquiry_Symbol = 41,
+    FIX44_CollateralInquiry_SymbolSfx = 42,
+    FIX44_CollateralInquiry_SecurityID = 43,
+    FIX44_CollateralInquiry_SecurityIDSource = 44,
+    FIX44_CollateralInquiry_NoSecurityAltID = 45,
+    FIX44_CollateralInquiry_Product = 46,
+    FIX44_CollateralInquiry_CFICode = 47,
+    FIX44_CollateralInquiry_SecurityType = 48,
+    FIX44_CollateralInquiry_SecuritySubType = 49,
+    FIX44_CollateralInquiry_MaturityMonthYear = 50,
+    FIX44_CollateralInquiry_MaturityDate = 51,
+    FIX44_CollateralInquiry_CouponPaymentDate = 52,
+    FIX44_CollateralInquiry_IssueDate = 53,
+    FIX44_CollateralInquiry_RepoCollateralSecurityType = 54,
+    FIX44_CollateralInquiry_RepurchaseTerm = 55,
+    FIX44_CollateralInquiry_RepurchaseRate = 56,
+    FIX44_CollateralInquiry_Factor = 57,
+    FIX44_CollateralInquiry_CreditRating = 58,
+    FIX44_CollateralInquiry_InstrRegistry = 59,
+    FIX44_CollateralInquiry_CountryOfIssue = 60,
+    FIX44_CollateralInquiry_StateOrProvinceOfIssue = 61,
+    FIX44_CollateralInquiry_LocaleOfIssue = 62,
+    FIX44_CollateralInquiry_RedemptionDate = 63,
+    FIX44_CollateralInquiry_StrikePrice = 64,
+    FIX44_CollateralInquiry_StrikeCurrency = 65,
+    FIX44_CollateralInquiry_OptAttribute = 66,
+    FIX44_CollateralInquiry_ContractMultiplier = 67,
+    FIX44_CollateralInquiry_CouponRate = 68,
+    FIX44_CollateralInquiry_SecurityExchange = 69,
+    FIX44_CollateralInquiry_Issuer = 70,
+    FIX44_CollateralInquiry_EncodedIssuerLen = 71,
+    FIX44_CollateralInquiry_EncodedIssuer = 72,
+    FIX44_CollateralInquiry_SecurityDesc = 73,
+    FIX44_CollateralInquiry_EncodedSecurityDescLen = 74,
+    FIX44_CollateralInquiry_EncodedSecurityDesc = 75,
+    FIX44_CollateralInquiry_Pool = 76,
+    FIX44_CollateralInquiry_ContractSettlMonth = 77,
+    FIX44_CollateralInquiry_CPProgram = 78,
+    FIX44_CollateralInquiry_CPRegType = 79,
+    FIX44_CollateralInquiry_NoEvents = 80,
+    FIX44_CollateralInquiry_DatedDate = 81,
+    FIX44_CollateralInquiry_InterestAccrualDate = 82,
+    FIX44_CollateralInquiry_AgreementDesc = 83,
+    FIX44_CollateralInquiry_AgreementID = 84,
+    FIX44_CollateralInquiry_AgreementDate = 85,
+    FIX44_CollateralInquiry_AgreementCurrency = 86,
+    FIX44_CollateralInquiry_TerminationType = 87,
+    FIX44_CollateralInquiry_StartDate = 88,
+    FIX44_CollateralInquiry_EndDate = 89,
+    FIX44_CollateralInquiry_DeliveryType = 90,
+    FIX44_CollateralInquiry_MarginRatio = 91,
+    FIX44_CollateralInquiry_SettlDate = 92,
+    FIX44_CollateralInquiry_Quantity = 93,
+    FIX44_CollateralInquiry_QtyType = 94,
+    FIX44_CollateralInquiry_Currency = 95,
+    FIX44_CollateralInquiry_NoLegs = 96,
+    FIX44_CollateralInquiry_LegSymbol = 97,
+    FIX44_CollateralInquiry_LegSymbolSfx = 98,
+    FIX44_CollateralInquiry_LegSecurityID = 99,
+    FIX44_CollateralInquiry_LegSecurityIDSource = 100,
+    FIX44_CollateralInquiry_NoLegSecurityAltID = 101,
+    FIX44_CollateralInquiry_LegProduct = 102,
+    FIX44_CollateralInquiry_LegCFICode = 103,
+    FIX44_CollateralInquiry_LegSecurityType = 104,
+    FIX44_CollateralInquiry_LegSecuritySubType = 105,
+    FIX44_CollateralInquiry_LegMaturityMonthYear = 106,
+    FIX44_CollateralInquiry_LegMaturityDate = 107,
+    FIX44_CollateralInquiry_LegCouponPaymentDate = 108,
+    FIX44_CollateralInquiry_LegIssueDate = 109,
+    FIX44_CollateralInquiry_LegRepoCollateralSecurityType = 110,
+    FIX44_CollateralInquiry_LegRepurchaseTerm = 111,
+    FIX44_CollateralInquiry_LegRepurchaseRate = 112,
+    FIX44_CollateralInquiry_LegFactor = 113,
+    FIX44_CollateralInquiry_LegCreditRating = 114,
+    FIX44_CollateralInquiry_LegInstrRegistry = 115,
+    FIX44_CollateralInquiry_LegCountryOfIssue = 116,
+    FIX44_CollateralInquiry_LegStateOrProvinceOfIssue = 117,
+    FIX44_CollateralInquiry_LegLocaleOfIssue = 118,
+    FIX44_CollateralInquiry_LegRedemptionDate = 119,
+    FIX44_CollateralInquiry_LegStrikePrice = 120,
+    FIX44_CollateralInquiry_LegStrikeCurrency = 121,
+    FIX44_CollateralInquiry_LegOptAttribute = 122,
+    FIX44_CollateralInquiry_LegContractMultiplier = 123,
+    FIX44_CollateralInquiry_LegCouponRate = 124,
+    FIX44_CollateralInquiry_LegSecurityExchange = 125,
+    FIX44_CollateralInquiry_LegIssuer = 126,
+    FIX44_CollateralInquiry_EncodedLegIssuerLen = 127,
+    FIX44_CollateralInquiry_EncodedLegIssuer = 128,
+    FIX44_CollateralInquiry_LegSecurityDesc = 129,
+    FIX44_CollateralInquiry_EncodedLegSecurityDescLen = 130,
+    FIX44_CollateralInquiry_EncodedLegSecurityDesc = 131,
+    FIX44_CollateralInquiry_LegRatioQty = 132,
+    FIX44_CollateralInquiry_LegSide = 133,
+    FIX44_CollateralInquiry_LegCurrency = 134,
+    FIX44_CollateralInquiry_LegPool = 135,
+    FIX44_CollateralInquiry_LegDatedDate = 136,
+    FIX44_CollateralInquiry_LegContractSettlMonth = 137,
+    FIX44_CollateralInquiry_LegInterestAccrualDate = 138,
+    FIX44_CollateralInquiry_NoUnderlyings = 139,
+    FIX44_CollateralInquiry_MarginExcess = 140,
+    FIX44_CollateralInquiry_TotalNetValue = 141,
+    FIX44_CollateralInquiry_CashOutstanding = 142,
+    FIX44_CollateralInquiry_NoTrdRegTimestamps = 143,
+    FIX44_CollateralInquiry_Side = 144,
+    FIX44_CollateralInquiry_Price = 145,
+    FIX44_CollateralInquiry_PriceType = 146,
+    FIX44_CollateralInquiry_AccruedInterestAmt = 147,
+    FIX44_CollateralInquiry_EndAccruedInterestAmt = 148,
+    FIX44_CollateralInquiry_StartCash = 149,
+    FIX44_CollateralInquiry_EndCash = 150,
+    FIX44_CollateralInquiry_Spread = 151,
+    FIX44_CollateralInquiry_BenchmarkCurveCurrency = 152,
+    FIX44_CollateralInquiry_BenchmarkCurveName = 153,
+    FIX44_CollateralInquiry_BenchmarkCurvePoint = 154,
+    FIX44_CollateralInquiry_BenchmarkPrice = 155,
+    FIX44_CollateralInquiry_BenchmarkPriceType = 156,
+    FIX44_CollateralInquiry_BenchmarkSecurityID = 157,
+    FIX44_CollateralInquiry_BenchmarkSecurityIDSource = 158,
+    FIX44_CollateralInquiry_NoStipulations = 159,
+    FIX44_CollateralInquiry_SettlDeliveryType = 160,
+    FIX44_CollateralInquiry_StandInstDbType = 161,
+    FIX44_CollateralInquiry_StandInstDbName = 162,
+    FIX44_CollateralInquiry_StandInstDbID = 163,
+    FIX44_CollateralInquiry_NoDlvyInst = 164,
+    FIX44_CollateralInquiry_TradingSessionID = 165,
+    FIX44_CollateralInquiry_TradingSessionSubID = 166,
+    FIX44_CollateralInquiry_SettlSessID = 167,
+    FIX44_CollateralInquiry_SettlSessSubID = 168,
+    FIX44_CollateralInquiry_ClearingBusinessDate = 169,
+    FIX44_CollateralInquiry_Text = 170,
+    FIX44_CollateralInquiry_EncodedTextLen = 171,
+    FIX44_CollateralInquiry_EncodedText = 172,
+    FIX44_CollateralInquiry_SignatureLength = 173,
+    FIX44_CollateralInquiry_Signature = 174,
+    FIX44_CollateralInquiry_CheckSum = 175,
+};
+
+typedef struct _fix44CollateralInquiry {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	CollInquiryID;
+    int64_t	NoCollInquiryQualifier;
+    char	SubscriptionRequestType;
+    int64_t	ResponseTransportType;
+    struct _ofixStrView	ResponseDestination;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    int64_t	NoExecs;
+    int64_t	NoTrades;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    struct _ofixStrView	SettlDate;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    struct _ofixStrView	LegSymbol;
+    struct _ofixStrView	LegSymbolSfx;
+    struct _ofixStrView	LegSecurityID;
+    struct _ofixStrView	LegSecurityIDSource;
+    struct _ofixStrView	NoLegSecurityAltID;
+    int64_t	LegProduct;
+    struct _ofixStrView	LegCFICode;
+    struct _ofixStrView	LegSecurityType;
+    struct _ofixStrView	LegSecuritySubType;
+    struct _ofixStrView	LegMaturityMonthYear;
+    struct _ofixStrView	LegMaturityDate;
+    struct _ofixStrView	LegCouponPaymentDate;
+    struct _ofixStrView	LegIssueDate;
+    int64_t	LegRepoCollateralSecurityType;
+    int64_t	LegRepurchaseTerm;
+    struct _ofixDecimal	LegRepurchaseRate;
+    struct _ofixDecimal	LegFactor;
+    struct _ofixStrView	LegCreditRating;
+    struct _ofixStrView	LegInstrRegistry;
+    struct _ofixStrView	LegCountryOfIssue;
+    struct _ofixStrView	LegStateOrProvinceOfIssue;
+    struct _ofixStrView	LegLocaleOfIssue;
+    struct _ofixStrView	LegRedemptionDate;
+    struct _ofixDecimal	LegStrikePrice;
+    struct _ofixStrView	LegStrikeCurrency;
+    char	LegOptAttribute;
+    struct _ofixDecimal	LegContractMultiplier;
+    struct _ofixDecimal	LegCouponRate;
+    struct _ofixStrView	LegSecurityExchange;
+    struct _ofixStrView	LegIssuer;
+    int64_t	EncodedLegIssuerLen;
+    struct _ofixStrView	EncodedLegIssuer;
+    struct _ofixStrView	LegSecurityDesc;
+    int64_t	EncodedLegSecurityDescLen;
+    struct _ofixStrView	EncodedLegSecurityDesc;
+    struct _ofixDecimal	LegRatioQty;
+    char	LegSide;
+    struct _ofixStrView	LegCurrency;
+    struct _ofixStrView	LegPool;
+    struct _ofixStrView	LegDatedDate;
+    struct _ofixStrView	LegContractSettlMonth;
+    struct _ofixStrView	LegInterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	MarginExcess;
+    struct _ofixDecimal	TotalNetValue;
+    struct _ofixDecimal	CashOutstanding;
+    int64_t	NoTrdRegTimestamps;
+    char	Side;
+    struct _ofixDecimal	Price;
+    int64_t	PriceType;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    int64_t	NoStipulations;
+    int64_t	SettlDeliveryType;
+    int64_t	StandInstDbType;
+    struct _ofixStrView	StandInstDbName;
+    struct _ofixStrView	StandInstDbID;
+    int64_t	NoDlvyInst;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    struct _ofixStrView	ClearingBusinessDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CollateralInquiry;
+
+extern void	fix44_decode_CollateralInquiry(ofixErr err, fix44CollateralInquiry m, const char *raw, int len);
+extern void	fix44_decode_CollateralInquiry_msg(ofixErr err, fix44CollateralInquiry m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CollateralInquiry(ofixErr err, fix44CollateralInquiry m);
+
+// NetworkStatusRequest [BC]
+enum {
+    FIX44_NetworkStatusRequest_BeginString = 0,
+    FIX44_NetworkStatusRequest_BodyLength = 1,
+    FIX44_NetworkStatusRequest_MsgType = 2,
+    FIX44_NetworkStatusRequest_SenderCompID = 3,
+    FIX44_NetworkStatusRequest_TargetCompID = 4,
+    FIX44_NetworkStatusRequest_OnBehalfOfCompID = 5,
+    FIX44_NetworkStatusRequest_DeliverToCompID = 6,
+    FIX44_NetworkStatusRequest_SecureDataLen = 7,
+    FIX44_NetworkStatusRequest_SecureData = 8,
+    FIX44_NetworkStatusRequest_MsgSeqNum = 9,
+    FIX44_NetworkStatusRequest_SenderSubID = 10,
+    FIX44_NetworkStatusRequest_SenderLocationID = 11,
+    FIX44_NetworkStatusRequest_TargetSubID = 12,
+    FIX44_NetworkStatusRequest_TargetLocationID = 13,
+    FIX44_NetworkStatusRequest_OnBehalfOfSubID = 14,
+    FIX44_NetworkStatusRequest_OnBehalfOfLocationID = 15,
+    FIX44_NetworkStatusRequest_DeliverToSubID = 16,
+    FIX44_NetworkStatusRequest_DeliverToLocationID = 17,
+    FIX44_NetworkStatusRequest_PossDupFlag = 18,
+    FIX44_NetworkStatusRequest_PossResend = 19,
+    FIX44_NetworkStatusRequest_SendingTime = 20,
+    FIX44_NetworkStatusRequest_OrigSendingTime = 21,
+    FIX44_NetworkStatusRequest_XmlDataLen = 22,
+    FIX44_NetworkStatusRequest_XmlData = 23,
+    FIX44_NetworkStatusRequest_MessageEncoding = 24,
+    FIX44_NetworkStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_NetworkStatusRequest_NoHops = 26,
+    FIX44_NetworkStatusRequest_NetworkRequestType = 27,
+    FIX44_NetworkStatusRequest_NetworkRequestID = 28,
+    FIX44_NetworkStatusRequest_NoCompIDs = 29,
+    FIX44_NetworkStatusRequest_SignatureLength = 30,
+    FIX44_NetworkStatusRequest_Signature = 31,
+    FIX44_NetworkStatusRequest_CheckSum = 32,
+};
+
+typedef struct _fix44NetworkStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    int64_t	NetworkRequestType;
+    struct _ofixStrView	NetworkRequestID;
+    int64_t	NoCompIDs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44NetworkStatusRequest;
+
+extern void	fix44_decode_NetworkStatusRequest(ofixErr err, fix44NetworkStatusRequest m, const char *raw, int len);
+extern void	fix44_decode_NetworkStatusRequest_msg(ofixErr err, fix44NetworkStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_NetworkStatusRequest(ofixErr err, fix44NetworkStatusRequest m);
+
+// NetworkStatusResponse [BD]
+enum {
+    FIX44_NetworkStatusResponse_BeginString = 0,
+    FIX44_NetworkStatusResponse_BodyLength = 1,
+    FIX44_NetworkStatusResponse_MsgType = 2,
+    FIX44_NetworkStatusResponse_SenderCompID = 3,
+    FIX44_NetworkStatusResponse_TargetCompID = 4,
+    FIX44_NetworkStatusResponse_OnBehalfOfCompID = 5,
+    FIX44_NetworkStatusResponse_DeliverToCompID = 6,
+    FIX44_NetworkStatusResponse_SecureDataLen = 7,
+    FIX44_NetworkStatusResponse_SecureData = 8,
+    FIX44_NetworkStatusResponse_MsgSeqNum = 9,
+    FIX44_NetworkStatusResponse_SenderSubID = 10,
+    FIX44_NetworkStatusResponse_SenderLocationID = 11,
+    FIX44_NetworkStatusResponse_TargetSubID = 12,
+    FIX44_NetworkStatusResponse_TargetLocationID = 13,
+    FIX44_NetworkStatusResponse_OnBehalfOfSubID = 14,
+    FIX44_NetworkStatusResponse_OnBehalfOfLocationID = 15,
+    FIX44_NetworkStatusResponse_DeliverToSubID = 16,
+    FIX44_NetworkStatusResponse_DeliverToLocationID = 17,
+    FIX44_NetworkStatusResponse_PossDupFlag = 18,
+    FIX44_NetworkStatusResponse_PossResend = 19,
+    FIX44_NetworkStatusResponse_SendingTime = 20,
+    FIX44_NetworkStatusResponse_OrigSendingTime = 21,
+    FIX44_NetworkStatusResponse_XmlDataLen = 22,
+    FIX44_NetworkStatusResponse_XmlData = 23,
+    FIX44_NetworkStatusResponse_MessageEncoding = 24,
+    FIX44_NetworkStatusResponse_LastMsgSeqNumProcessed = 25,
+    FIX44_NetworkStatusResponse_NoHops = 26,
+    FIX44_NetworkStatusResponse_NetworkStatusResponseType = 27,
+    FIX44_NetworkStatusResponse_NetworkRequestID = 28,
+    FIX44_NetworkStatusResponse_NetworkResponseID = 29,
+    FIX44_NetworkStatusResponse_LastNetworkResponseID = 30,
+    FIX44_NetworkStatusResponse_NoCompIDs = 31,
+    FIX44_NetworkStatusResponse_SignatureLength = 32,
+    FIX44_NetworkStatusResponse_Signature = 33,
+    FIX44_NetworkStatusResponse_CheckSum = 34,
+};
+
+typedef struct _fix44NetworkStatusResponse {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    int64_t	NetworkStatusResponseType;
+    struct _ofixStrView	NetworkRequestID;
+    struct _ofixStrView	NetworkResponseID;
+    struct _ofixStrView	LastNetworkResponseID;
+    int64_t	NoCompIDs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44NetworkStatusResponse;
+
+extern void	fix44_decode_NetworkStatusResponse(ofixErr err, fix44NetworkStatusResponse m, const char *raw, int len);
+extern void	fix44_decode_NetworkStatusResponse_msg(ofixErr err, fix44NetworkStatusResponse m, ofixMsg msg);
+extern ofixMsg	fix44_encode_NetworkStatusResponse(ofixErr err, fix44NetworkStatusResponse m);
+
+// UserRequest [BE]
+enum {
+    FIX44_UserRequest_BeginString = 0,
+    FIX44_UserRequest_BodyLength = 1,
+    FIX44_UserRequest_MsgType = 2,
+    FIX44_UserRequest_SenderCompID = 3,
+    FIX44_UserRequest_TargetCompID = 4,
+    FIX44_UserRequest_OnBehalfOfCompID = 5,
+    FIX44_UserRequest_DeliverToCompID = 6,
+    FIX44_UserRequest_SecureDataLen = 7,
+    FIX44_UserRequest_SecureData = 8,
+    FIX44_UserRequest_MsgSeqNum = 9,
+    FIX44_UserRequest_SenderSubID = 10,
+    FIX44_UserRequest_SenderLocationID = 11,
+    FIX44_UserRequest_TargetSubID = 12,
+    FIX44_UserRequest_TargetLocationID = 13,
+    FIX44_UserRequest_OnBehalfOfSubID = 14,
+    FIX44_UserRequest_OnBehalfOfLocationID = 15,
+    FIX44_UserRequest_DeliverToSubID = 16,
+    FIX44_UserRequest_DeliverToLocationID = 17,
+    FIX44_UserRequest_PossDupFlag = 18,
+    FIX44_UserRequest_PossResend = 19,
+    FIX44_UserRequest_SendingTime = 20,
+    FIX44_UserRequest_OrigSendingTime = 21,
+    FIX44_UserRequest_XmlDataLen = 22,
+    FIX44_UserRequest_XmlData = 23,
+    FIX44_UserRequest_MessageEncoding = 24,
+    FIX44_UserRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_UserRequest_NoHops = 26,
+    FIX44_UserRequest_UserRequestID = 27,
+    FIX44_UserRequest_UserRequestType = 28,
+    FIX44_UserRequest_Username = 29,
+    FIX44_UserRequest_Password = 30,
+    FIX44_UserRequest_NewPassword = 31,
+    FIX44_UserRequest_RawDataLength = 32,
+    FIX44_UserRequest_RawData = 33,
+    FIX44_UserRequest_SignatureLength = 34,
+    FIX44_UserRequest_Signature = 35,
+    FIX44_UserRequest_CheckSum = 36,
+};
+
+typedef struct _fix44UserRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	UserRequestID;
+    int64_t	UserRequestType;
+    struct _ofixStrView	Username;
+    struct _ofixStrView	Password;
+    struct _ofixStrView	NewPassword;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44UserRequest;
+
+extern void	fix44_decode_UserRequest(ofixErr err, fix44UserRequest m, const char *raw, int len);
+extern void	fix44_decode_UserRequest_msg(ofixErr err, fix44UserRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_UserRequest(ofixErr err, fix44UserRequest m);
+
+// UserResponse [BF]
+enum {
+    FIX44_UserResponse_BeginString = 0,
+    FIX44_UserResponse_BodyLength = 1,
+    FIX44_UserResponse_MsgType = 2,
+    FIX44_UserResponse_SenderCompID = 3,
+    FIX44_UserResponse_TargetCompID = 4,
+    FIX44_UserResponse_OnBehalfOfCompID = 5,
+    FIX44_UserResponse_DeliverToCompID = 6,
+    FIX44_UserResponse_SecureDataLen = 7,
+    FIX44_UserResponse_SecureData = 8,
+    FIX44_UserResponse_MsgSeqNum = 9,
+    FIX44_UserResponse_SenderSubID = 10,
+    FIX44_UserResponse_SenderLocationID = 11,
+    FIX44_UserResponse_TargetSubID = 12,
+    FIX44_UserResponse_TargetLocationID = 13,
+    FIX44_UserResponse_OnBehalfOfSubID = 14,
+    FIX44_UserResponse_OnBehalfOfLocationID = 15,
+    FIX44_UserResponse_DeliverToSubID = 16,
+    FIX44_UserResponse_DeliverToLocationID = 17,
+    FIX44_UserResponse_PossDupFlag = 18,
+    FIX44_UserResponse_PossResend = 19,
+    FIX44_UserResponse_SendingTime = 20,
+    FIX44_UserResponse_OrigSendingTime = 21,
+    FIX44_UserResponse_XmlDataLen = 22,
+    FIX44_UserResponse_XmlData = 23,
+    FIX44_UserResponse_MessageEncoding = 24,
+    FIX44_UserResponse_LastMsgSeqNumProcessed = 25,
+    FIX44_UserResponse_NoHops = 26,
+    FIX44_UserResponse_UserRequestID = 27,
+    FIX44_UserResponse_Username = 28,
+    FIX44_UserResponse_UserStatus = 29,
+    FIX44_UserResponse_UserStatusText = 30,
+    FIX44_UserResponse_SignatureLength = 31,
+    FIX44_UserResponse_Signature = 32,
+    FIX44_UserResponse_CheckSum = 33,
+};
+
+typedef struct _fix44UserResponse {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	UserRequestID;
+    struct _ofixStrView	Username;
+    int64_t	UserStatus;
+    struct _ofixStrView	UserStatusText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44UserResponse;
+
+extern void	fix44_decode_UserResponse(ofixErr err, fix44UserResponse m, const char *raw, int len);
+extern void	fix44_decode_UserResponse_msg(ofixErr err, fix44UserResponse m, ofixMsg msg);
+extern ofixMsg	fix44_encode_UserResponse(ofixErr err, fix44UserResponse m);
+
+// CollateralInquiryAck [BG]
+enum {
+    FIX44_CollateralInquiryAck_BeginString = 0,
+    FIX44_CollateralInquiryAck_BodyLength = 1,
+    FIX44_CollateralInquiryAck_MsgType = 2,
+    FIX44_CollateralInquiryAck_SenderCompID = 3,
+    FIX44_CollateralInquiryAck_TargetCompID = 4,
+    FIX44_CollateralInquiryAck_OnBehalfOfCompID = 5,
+    FIX44_CollateralInquiryAck_DeliverToCompID = 6,
+    FIX44_CollateralInquiryAck_SecureDataLen = 7,
+    FIX44_CollateralInquiryAck_SecureData = 8,
+    FIX44_CollateralInquiryAck_MsgSeqNum = 9,
+    FIX44_CollateralInquiryAck_SenderSubID = 10,
+    FIX44_CollateralInquiryAck_SenderLocationID = 11,
+    FIX44_CollateralInquiryAck_TargetSubID = 12,
+    FIX44_CollateralInquiryAck_TargetLocationID = 13,
+    FIX44_CollateralInquiryAck_OnBehalfOfSubID = 14,
+    FIX44_CollateralInquiryAck_OnBehalfOfLocationID = 15,
+    FIX44_CollateralInquiryAck_DeliverToSubID = 16,
+    FIX44_CollateralInquiryAck_DeliverToLocationID = 17,
+    FIX44_CollateralInquiryAck_PossDupFlag = 18,
+    FIX44_CollateralInquiryAck_PossResend = 19,
+    FIX44_CollateralInquiryAck_SendingTime = 20,
+    FIX44_CollateralInquiryAck_OrigSendingTime = 21,
+    FIX44_CollateralInquiryAck_XmlDataLen = 22,
+    FIX44_CollateralInquiryAck_XmlData = 23,
+    FIX44_CollateralInquiryAck_MessageEncoding = 24,
+    FIX44_CollateralInquiryAck_LastMsgSeqNumProcessed = 25,
+    FIX44_CollateralInquiryAck_NoHops = 26,
+    FIX44_CollateralInquiryAck_CollInquiryID = 27,
+    FIX44_CollateralInquiryAck_CollInquiryStatus = 28,
+    FIX44_CollateralInquiryAck_CollInquiryResult = 29,
+    FIX44_CollateralInquiryAck_NoCollInquiryQualifier = 30,
+    FIX44_CollateralInquiryAck_TotNumReports = 31,
+    FIX44_CollateralInquiryAck_NoPartyIDs = 32,
+    FIX44_CollateralInquiryAck_Account = 33,
+    FIX44_CollateralInquiryAck_AccountType = 34,
+    FIX44_CollateralInquiryAck_ClOrdID = 35,
+    FIX44_CollateralInquiryAck_OrderID = 36,
+    FIX44_CollateralInquiryAck_SecondaryOrderID = 37,
+    FIX44_CollateralInquiryAck_SecondaryClOrdID = 38,
+    FIX44_CollateralInquiryAck_NoExecs = 39,
+    FIX44_CollateralInquiryAck_NoTrades = 40,
+    FIX44_CollateralInquiryAck_Symbol = 41,
+    FIX44_CollateralInquiryAck_SymbolSfx = 42,
+    FIX44_CollateralInquiryAck_SecurityID = 43,
+    FIX44_CollateralInquiryAck_SecurityIDSource = 44,
+    FIX44_CollateralInquiryAck_NoSecurityAltID = 45,
+    FIX44_CollateralInquiryAck_Product = 46,
+    FIX44_CollateralInquiryAck_CFICode = 47,
+    FIX44_CollateralInquiryAck_SecurityType = 48,
+    FIX44_CollateralInquiryAck_SecuritySubType = 49,
+    FIX44_CollateralInquiryAck_MaturityMonthYear = 50,
+    FIX44_CollateralInquiryAck_MaturityDate = 51,
+    FIX44_CollateralInquiryAck_CouponPaymentDate = 52,
+    FIX44_CollateralInquiryAck_IssueDate = 53,
+    FIX44_CollateralInquiryAck_RepoCollateralSecurityType = 54,
+    FIX44_CollateralInquiryAck_RepurchaseTerm = 55,
+    FIX44_CollateralInquiryAck_RepurchaseRate = 56,
+    FIX44_CollateralInquiryAck_Factor = 57,
+    FIX44_CollateralInquiryAck_CreditRating = 58,
+    FIX44_CollateralInquiryAck_InstrRegistry = 59,
+    FIX44_CollateralInquiryAck_CountryOfIssue = 60,
+    FIX44_CollateralInquiryAck_StateOrProvinceOfIssue = 61,
+    FIX44_CollateralInquiryAck_LocaleOfIssue = 62,
+    FIX44_CollateralInquiryAck_RedemptionDate = 63,
+    FIX44_CollateralInquiryAck_StrikePrice = 64,
+    FIX44_CollateralInquiryAck_StrikeCurrency = 65,
+    FIX44_CollateralInquiryAck_OptAttribute = 66,
+    FIX44_CollateralInquiryAck_ContractMultiplier = 67,
+    FIX44_CollateralInquiryAck_CouponRate = 68,
+    FIX44_CollateralInquiryAck_SecurityExchange = 69,
+    FIX44_CollateralInquiryAck_Issuer = 70,
+    FIX44_CollateralInquiryAck_EncodedIssuerLen = 71,
+    FIX44_CollateralInquiryAck_EncodedIssuer = 72,
+    FIX44_CollateralInquiryAck_SecurityDesc = 73,
+    FIX44_CollateralInquiryAck_EncodedSecurityDescLen = 74,
+    FIX44_CollateralInquiryAck_EncodedSecurityDesc = 75,
+    FIX44_CollateralInquiryAck_Pool = 76,
+    FIX44_CollateralInquiryAck_ContractSettlMonth = 77,
+    FIX44_CollateralInquiryAck_CPProgram = 78,
+    FIX44_CollateralInquiryAck_CPRegType = 79,
+    FIX44_CollateralInquiryAck_NoEvents = 80,
+    FIX44_CollateralInquiryAck_DatedDate = 81,
+    FIX44_CollateralInquiryAck_InterestAccrualDate = 82,
+    FIX44_CollateralInquiryAck_AgreementDesc = 83,
+    FIX44_CollateralInquiryAck_AgreementID = 84,
+    FIX44_CollateralInquiryAck_AgreementDate = 85,
+    FIX44_CollateralInquiryAck_AgreementCurrency = 86,
+    FIX44_CollateralInquiryAck_TerminationType = 87,
+    FIX44_CollateralInquiryAck_StartDate = 88,
+    FIX44_CollateralInquiryAck_EndDate = 89,
+    FIX44_CollateralInquiryAck_DeliveryType = 90,
+    FIX44_CollateralInquiryAck_MarginRatio = 91,
+    FIX44_CollateralInquiryAck_SettlDate = 92,
+    FIX44_CollateralInquiryAck_Quantity = 93,
+    FIX44_CollateralInquiryAck_QtyType = 94,
+    FIX44_CollateralInquiryAck_Currency = 95,
+    FIX44_CollateralInquiryAck_NoLegs = 96,
+    FIX44_CollateralInquiryAck_LegSymbol = 97,
+    FIX44_CollateralInquiryAck_LegSymbolSfx = 98,
+    FIX44_CollateralInquiryAck_LegSecurityID = 99,
+    FIX44_CollateralInquiryAck_LegSecurityIDSource = 100,
+    FIX44_CollateralInquiryAck_NoLegSecurityAltID = 101,
+    FIX44_CollateralInquiryAck_LegProduct = 102,
+    FIX44_CollateralInquiryAck_LegCFICode = 103,
+    FIX44_CollateralInquiryAck_LegSecurityType = 104,
+    FIX44_CollateralInquiryAck_LegSecuritySubType = 105,
+    FIX44_CollateralInquiryAck_LegMaturityMonthYear = 106,
+    FIX44_CollateralInquiryAck_LegMaturityDate = 107,
+    FIX44_CollateralInquiryAck_LegCouponPaymentDate = 108,
+    FIX44_CollateralInquiryAck_LegIssueDate = 109,
+    FIX44_CollateralInquiryAck_LegRepoCollateralSecurityType = 110,
+    FIX44_CollateralInquiryAck_LegRepurchaseTerm = 111,
+    FIX44_CollateralInquiryAck_LegRepurchaseRate = 112,
+    FIX44_CollateralInquiryAck_LegFactor = 113,
+    FIX44_CollateralInquiryAck_LegCreditRating = 114,
+    FIX44_CollateralInquiryAck_LegInstrRegistry = 115,
+    FIX44_CollateralInquiryAck_LegCountryOfIssue = 116,
+    FIX44_CollateralInquiryAck_LegStateOrProvinceOfIssue = 117,
+    FIX44_CollateralInquiryAck_LegLocaleOfIssue = 118,
+    FIX44_CollateralInquiryAck_LegRedemptionDate = 119,
+    FIX44_CollateralInquiryAck_LegStrikePrice = 120,
+    FIX44_CollateralInquiryAck_LegStrikeCurrency = 121,
+    FIX44_CollateralInquiryAck_LegOptAttribute = 122,
+    FIX44_CollateralInquiryAck_LegContractMultiplier = 123,
+    FIX44_CollateralInquiryAck_LegCouponRate = 124,
+    FIX44_CollateralInquiryAck_LegSecurityExchange = 125,
+    FIX44_CollateralInquiryAck_LegIssuer = 126,
+    FIX44_CollateralInquiryAck_EncodedLegIssuerLen = 127,
+    FIX44_CollateralInquiryAck_EncodedLegIssuer = 128,
+    FIX44_CollateralInquiryAck_LegSecurityDesc = 129,
+    FIX44_CollateralInquiryAck_EncodedLegSecurityDescLen = 130,
+    FIX44_CollateralInquiryAck_EncodedLegSecurityDesc = 131,
+    FIX44_CollateralInquiryAck_LegRatioQty = 132,
+    FIX44_CollateralInquiryAck_LegSide = 133,
+    FIX44_CollateralInquiryAck_LegCurrency = 134,
+    FIX44_CollateralInquiryAck_LegPool = 135,
+    FIX44_CollateralInquiryAck_LegDatedDate = 136,
+    FIX44_CollateralInquiryAck_LegContractSettlMonth = 137,
+    FIX44_CollateralInquiryAck_LegInterestAccrualDate = 138,
+    FIX44_CollateralInquiryAck_NoUnderlyings = 139,
+    FIX44_CollateralInquiryAck_TradingSessionID = 140,
+    FIX44_CollateralInquiryAck_TradingSessionSubID = 141,
+    FIX44_CollateralInquiryAck_SettlSessID = 142,
+    FIX44_CollateralInquiryAck_SettlSessSubID = 143,
+    FIX44_CollateralInquiryAck_ClearingBusinessDate = 144,
+    FIX44_CollateralInquiryAck_ResponseTransportType = 145,
+    FIX44_CollateralInquiryAck_ResponseDestination = 146,
+    FIX44_CollateralInquiryAck_Text = 147,
+    FIX44_CollateralInquiryAck_EncodedTextLen = 148,
+    FIX44_CollateralInquiryAck_EncodedText = 149,
+    FIX44_CollateralInquiryAck_SignatureLength = 150,
+    FIX44_CollateralInquiryAck_Signature = 151,
+    FIX44_CollateralInquiryAck_CheckSum = 152,
+};
+
+typedef struct _fix44CollateralInquiryAck {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	CollInquiryID;
+    int64_t	CollInquiryStatus;
+    int64_t	CollInquiryResult;
+    int64_t	NoCollInquiryQualifier;
+    int64_t	TotNumReports;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AccountType;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	SecondaryClOrdID;
+    int64_t	NoExecs;
+    int64_t	NoTrades;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    struct _ofixStrView	SettlDate;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	Currency;
+    int64_t	NoLegs;
+    struct _ofixStrView	LegSymbol;
+    struct _ofixStrView	LegSymbolSfx;
+    struct _ofixStrView	LegSecurityID;
+    struct _ofixStrView	LegSecurityIDSource;
+    struct _ofixStrView	NoLegSecurityAltID;
+    int64_t	LegProduct;
+    struct _ofixStrView	LegCFICode;
+    struct _ofixStrView	LegSecurityType;
+    struct _ofixStrView	LegSecuritySubType;
+    struct _ofixStrView	LegMaturityMonthYear;
+    struct _ofixStrView	LegMaturityDate;
+    struct _ofixStrView	LegCouponPaymentDate;
+    struct _ofixStrView	LegIssueDate;
+    int64_t	LegRepoCollateralSecurityType;
+    int64_t	LegRepurchaseTerm;
+    struct _ofixDecimal	LegRepurchaseRate;
+    struct _ofixDecimal	LegFactor;
+    struct _ofixStrView	LegCreditRating;
+    struct _ofixStrView	LegInstrRegistry;
+    struct _ofixStrView	LegCountryOfIssue;
+    struct _ofixStrView	LegStateOrProvinceOfIssue;
+    struct _ofixStrView	LegLocaleOfIssue;
+    struct _ofixStrView	LegRedemptionDate;
+    struct _ofixDecimal	LegStrikePrice;
+    struct _ofixStrView	LegStrikeCurrency;
+    char	LegOptAttribute;
+    struct _ofixDecimal	LegContractMultiplier;
+    struct _ofixDecimal	LegCouponRate;
+    struct _ofixStrView	LegSecurityExchange;
+    struct _ofixStrView	LegIssuer;
+    int64_t	EncodedLegIssuerLen;
+    struct _ofixStrView	EncodedLegIssuer;
+    struct _ofixStrView	LegSecurityDesc;
+    int64_t	EncodedLegSecurityDescLen;
+    struct _ofixStrView	EncodedLegSecurityDesc;
+    struct _ofixDecimal	LegRatioQty;
+    char	LegSide;
+    struct _ofixStrView	LegCurrency;
+    struct _ofixStrView	LegPool;
+    struct _ofixStrView	LegDatedDate;
+    struct _ofixStrView	LegContractSettlMonth;
+    struct _ofixStrView	LegInterestAccrualDate;
+    int64_t	NoUnderlyings;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	SettlSessID;
+    struct _ofixStrView	SettlSessSubID;
+    struct _ofixStrView	ClearingBusinessDate;
+    int64_t	ResponseTransportType;
+    struct _ofixStrView	ResponseDestination;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CollateralInquiryAck;
+
+extern void	fix44_decode_CollateralInquiryAck(ofixErr err, fix44CollateralInquiryAck m, const char *raw, int len);
+extern void	fix44_decode_CollateralInquiryAck_msg(ofixErr err, fix44CollateralInquiryAck m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CollateralInquiryAck(ofixErr err, fix44CollateralInquiryAck m);
+
+// ConfirmationRequest [BH]
+enum {
+    FIX44_ConfirmationRequest_BeginString = 0,
+    FIX44_ConfirmationRequest_BodyLength = 1,
+    FIX44_ConfirmationRequest_MsgType = 2,
+    FIX44_ConfirmationRequest_SenderCompID = 3,
+    FIX44_ConfirmationRequest_TargetCompID = 4,
+    FIX44_ConfirmationRequest_OnBehalfOfCompID = 5,
+    FIX44_ConfirmationRequest_DeliverToCompID = 6,
+    FIX44_ConfirmationRequest_SecureDataLen = 7,
+    FIX44_ConfirmationRequest_SecureData = 8,
+    FIX44_ConfirmationRequest_MsgSeqNum = 9,
+    FIX44_ConfirmationRequest_SenderSubID = 10,
+    FIX44_ConfirmationRequest_SenderLocationID = 11,
+    FIX44_ConfirmationRequest_TargetSubID = 12,
+    FIX44_ConfirmationRequest_TargetLocationID = 13,
+    FIX44_ConfirmationRequest_OnBehalfOfSubID = 14,
+    FIX44_ConfirmationRequest_OnBehalfOfLocationID = 15,
+    FIX44_ConfirmationRequest_DeliverToSubID = 16,
+    FIX44_ConfirmationRequest_DeliverToLocationID = 17,
+    FIX44_ConfirmationRequest_PossDupFlag = 18,
+    FIX44_ConfirmationRequest_PossResend = 19,
+    FIX44_ConfirmationRequest_SendingTime = 20,
+    FIX44_ConfirmationRequest_OrigSendingTime = 21,
+    FIX44_ConfirmationRequest_XmlDataLen = 22,
+    FIX44_ConfirmationRequest_XmlData = 23,
+    FIX44_ConfirmationRequest_MessageEncoding = 24,
+    FIX44_ConfirmationRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_ConfirmationRequest_NoHops = 26,
+    FIX44_ConfirmationRequest_ConfirmReqID = 27,
+    FIX44_ConfirmationRequest_ConfirmType = 28,
+    FIX44_ConfirmationRequest_NoOrders = 29,
+    FIX44_ConfirmationRequest_AllocID = 30,
+    FIX44_ConfirmationRequest_SecondaryAllocID = 31,
+    FIX44_ConfirmationRequest_IndividualAllocID = 32,
+    FIX44_ConfirmationRequest_TransactTime = 33,
+    FIX44_ConfirmationRequest_AllocAccount = 34,
+    FIX44_ConfirmationRequest_AllocAcctIDSource = 35,
+    FIX44_ConfirmationRequest_AllocAccountType = 36,
+    FIX44_ConfirmationRequest_Text = 37,
+    FIX44_ConfirmationRequest_EncodedTextLen = 38,
+    FIX44_ConfirmationRequest_EncodedText = 39,
+    FIX44_ConfirmationRequest_SignatureLength = 40,
+    FIX44_ConfirmationRequest_Signature = 41,
+    FIX44_ConfirmationRequest_CheckSum = 42,
+};
+
+typedef struct _fix44ConfirmationRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ConfirmReqID;
+    int64_t	ConfirmType;
+    int64_t	NoOrders;
+    struct _ofixStrView	AllocID;
+    struct _ofixStrView	SecondaryAllocID;
+    struct _ofixStrView	IndividualAllocID;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	AllocAccount;
+    int64_t	AllocAcctIDSource;
+    int64_t	AllocAccountType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ConfirmationRequest;
+
+extern void	fix44_decode_ConfirmationRequest(ofixErr err, fix44ConfirmationRequest m, const char *raw, int len);
+extern void	fix44_decode_ConfirmationRequest_msg(ofixErr err, fix44ConfirmationRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ConfirmationRequest(ofixErr err, fix44ConfirmationRequest m);
+
+// Email [C]
+enum {
+    FIX44_Email_BeginString = 0,
+    FIX44_Email_BodyLength = 1,
+    FIX44_Email_MsgType = 2,
+    FIX44_Email_SenderCompID = 3,
+    FIX44_Email_TargetCompID = 4,
+    FIX44_Email_OnBehalfOfCompID = 5,
+    FIX44_Email_DeliverToCompID = 6,
+    FIX44_Email_SecureDataLen = 7,
+    FIX44_Email_SecureData = 8,
+    FIX44_Email_MsgSeqNum = 9,
+    FIX44_Email_SenderSubID = 10,
+    FIX44_Email_SenderLocationID = 11,
+    FIX44_Email_TargetSubID = 12,
+    FIX44_Email_TargetLocationID = 13,
+    FIX44_Email_OnBehalfOfSubID = 14,
+    FIX44_Email_OnBehalfOfLocationID = 15,
+    FIX44_Email_DeliverToSubID = 16,
+    FIX44_Email_DeliverToLocationID = 17,
+    FIX44_Email_PossDupFlag = 18,
+    FIX44_Email_PossResend = 19,
+    FIX44_Email_SendingTime = 20,
+    FIX44_Email_OrigSendingTime = 21,
+    FIX44_Email_XmlDataLen = 22,
+    FIX44_Email_XmlData = 23,
+    FIX44_Email_MessageEncoding = 24,
+    FIX44_Email_LastMsgSeqNumProcessed = 25,
+    FIX44_Email_NoHops = 26,
+    FIX44_Email_EmailThreadID = 27,
+    FIX44_Email_EmailType = 28,
+    FIX44_Email_OrigTime = 29,
+    FIX44_Email_Subject = 30,
+    FIX44_Email_EncodedSubjectLen = 31,
+    FIX44_Email_EncodedSubject = 32,
+    FIX44_Email_NoRoutingIDs = 33,
+    FIX44_Email_NoRelatedSym = 34,
+    FIX44_Email_NoUnderlyings = 35,
+    FIX44_Email_NoLegs = 36,
+    FIX44_Email_OrderID = 37,
+    FIX44_Email_ClOrdID = 38,
+    FIX44_Email_LinesOfText = 39,
+    FIX44_Email_RawDataLength = 40,
+    FIX44_Email_RawData = 41,
+    FIX44_Email_SignatureLength = 42,
+    FIX44_Email_Signature = 43,
+    FIX44_Email_CheckSum = 44,
+};
+
+typedef struct _fix44Email {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	EmailThreadID;
+    char	EmailType;
+    struct _ofixDate	OrigTime;
+    struct _ofixStrView	Subject;
+    int64_t	EncodedSubjectLen;
+    struct _ofixStrView	EncodedSubject;
+    int64_t	NoRoutingIDs;
+    int64_t	NoRelatedSym;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	LinesOfText;
+    int64_t	RawDataLength;
+    struct _ofixStrView	RawData;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Email;
+
+extern void	fix44_decode_Email(ofixErr err, fix44Email m, const char *raw, int len);
+extern void	fix44_decode_Email_msg(ofixErr err, fix44Email m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Email(ofixErr err, fix44Email m);
+
+// NewOrderSingle [D]
+enum {
+    FIX44_NewOrderSingle_BeginString = 0,
+    FIX44_NewOrderSingle_BodyLength = 1,
+    FIX44_NewOrderSingle_MsgType = 2,
+    FIX44_NewOrderSingle_SenderCompID = 3,
+    FIX44_NewOrderSingle_TargetCompID = 4,
+    FIX44_NewOrderSingle_OnBehalfOfCompID = 5,
+    FIX44_NewOrderSingle_DeliverToCompID = 6,
+    FIX44_NewOrderSingle_SecureDataLen = 7,
+    FIX44_NewOrderSingle_SecureData = 8,
+    FIX44_NewOrderSingle_MsgSeqNum = 9,
+    FIX44_NewOrderSingle_SenderSubID = 10,
+    FIX44_NewOrderSingle_SenderLocationID = 11,
+    FIX44_NewOrderSingle_TargetSubID = 12,
+    FIX44_NewOrderSingle_TargetLocationID = 13,
+    FIX44_NewOrderSingle_OnBehalfOfSubID = 14,
+    FIX44_NewOrderSingle_OnBehalfOfLocationID = 15,
+    FIX44_NewOrderSingle_DeliverToSubID = 16,
+    FIX44_NewOrderSingle_DeliverToLocationID = 17,
+    FIX44_NewOrderSingle_PossDupFlag = 18,
+    FIX44_NewOrderSingle_PossResend = 19,
+    FIX44_NewOrderSingle_SendingTime = 20,
+    FIX44_NewOrderSingle_OrigSendingTime = 21,
+    FIX44_NewOrderSingle_XmlDataLen = 22,
+    FIX44_NewOrderSingle_XmlData = 23,
+    FIX44_NewOrderSingle_MessageEncoding = 24,
+    FIX44_NewOrderSingle_LastMsgSeqNumProcessed = 25,
+    FIX44_NewOrderSingle_NoHops = 26,
+    FIX44_NewOrderSingle_ClOrdID = 27,
+    FIX44_NewOrderSingle_SecondaryClOrdID = 28,
+    FIX44_NewOrderSingle_ClOrdLinkID = 29,
+    FIX44_NewOrderSingle_NoPartyIDs = 30,
+    FIX44_NewOrderSingle_TradeOriginationDate = 31,
+    FIX44_NewOrderSingle_TradeDate = 32,
+    FIX44_NewOrderSingle_Account = 33,
+    FIX44_NewOrderSingle_AcctIDSource = 34,
+    FIX44_NewOrderSingle_AccountType = 35,
+    FIX44_NewOrderSingle_DayBookingInst = 36,
+    FIX44_NewOrderSingle_BookingUnit = 37,
+    FIX44_NewOrderSingle_PreallocMethod = 38,
+    FIX44_NewOrderSingle_AllocID = 39,
+    FIX44_NewOrderSingle_NoAllocs = 40,
+    FIX44_NewOrderSingle_SettlType = 41,
+    FIX44_NewOrderSingle_SettlDate = 42,
+    FIX44_NewOrderSingle_CashMargin = 43,
+    FIX44_NewOrderSingle_ClearingFeeIndicator = 44,
+    FIX44_NewOrderSingle_HandlInst = 45,
+    FIX44_NewOrderSingle_ExecInst = 46,
+    FIX44_NewOrderSingle_MinQty = 47,
+    FIX44_NewOrderSingle_MaxFloor = 48,
+    FIX44_NewOrderSingle_ExDestination = 49,
+    FIX44_NewOrderSingle_NoTradingSessions = 50,
+    FIX44_NewOrderSingle_ProcessCode = 51,
+    FIX44_NewOrderSingle_Symbol = 52,
+    FIX44_NewOrderSingle_SymbolSfx = 53,
+    FIX44_NewOrderSingle_SecurityID = 54,
+    FIX44_NewOrderSingle_SecurityIDSource = 55,
+    FIX44_NewOrderSingle_NoSecurityAltID = 56,
+    FIX44_NewOrderSingle_Product = 57,
+    FIX44_NewOrderSingle_CFICode = 58,
+    FIX44_NewOrderSingle_SecurityType = 59,
+    FIX44_NewOrderSingle_SecuritySubType = 60,
+    FIX44_NewOrderSingle_MaturityMonthYear = 61,
+    FIX44_NewOrderSingle_MaturityDate = 62,
+    FIX44_NewOrderSingle_CouponPaymentDate = 63,
+    FIX44_NewOrderSingle_IssueDate = 64,
+    FIX44_NewOrderSingle_RepoCollateralSecurityType = 65,
+    FIX44_NewOrderSingle_RepurchaseTerm = 66,
+    FIX44_NewOrderSingle_RepurchaseRate = 67,
+    FIX44_NewOrderSingle_Factor = 68,
+    FIX44_NewOrderSingle_CreditRating = 69,
+    FIX44_NewOrderSingle_InstrRegistry = 70,
+    FIX44_NewOrderSingle_CountryOfIssue = 71,
+    FIX44_NewOrderSingle_StateOrProvinceOfIssue = 72,
+    FIX44_NewOrderSingle_LocaleOfIssue = 73,
+    FIX44_NewOrderSingle_RedemptionDate = 74,
+    FIX44_NewOrderSingle_StrikePrice = 75,
+    FIX44_NewOrderSingle_StrikeCurrency = 76,
+    FIX44_NewOrderSingle_OptAttribute = 77,
+    FIX44_NewOrderSingle_ContractMultiplier = 78,
+    FIX44_NewOrderSingle_CouponRate = 79,
+    FIX44_NewOrderSingle_SecurityExchange = 80,
+    FIX44_NewOrderSingle_Issuer = 81,
+    FIX44_NewOrderSingle_EncodedIssuerLen = 82,
+    FIX44_NewOrderSingle_EncodedIssuer = 83,
+    FIX44_NewOrderSingle_SecurityDesc = 84,
+    FIX44_NewOrderSingle_EncodedSecurityDescLen = 85,
+    FIX44_NewOrderSingle_EncodedSecurityDesc = 86,
+    FIX44_NewOrderSingle_Pool = 87,
+    FIX44_NewOrderSingle_ContractSettlMonth = 88,
+    FIX44_NewOrderSingle_CPProgram = 89,
+    FIX44_NewOrderSingle_CPRegType = 90,
+    FIX44_NewOrderSingle_NoEvents = 91,
+    FIX44_NewOrderSingle_DatedDate = 92,
+    FIX44_NewOrderSingle_InterestAccrualDate = 93,
+    FIX44_NewOrderSingle_AgreementDesc = 94,
+    FIX44_NewOrderSingle_AgreementID = 95,
+    FIX44_NewOrderSingle_AgreementDate = 96,
+    FIX44_NewOrderSingle_AgreementCurrency = 97,
+    FIX44_NewOrderSingle_TerminationType = 98,
+    FIX44_NewOrderSingle_StartDate = 99,
+    FIX44_NewOrderSingle_EndDate = 100,
+    FIX44_NewOrderSingle_DeliveryType = 101,
+    FIX44_NewOrderSingle_MarginRatio = 102,
+    FIX44_NewOrderSingle_NoUnderlyings = 103,
+    FIX44_NewOrderSingle_PrevClosePx = 104,
+    FIX44_NewOrderSingle_Side = 105,
+    FIX44_NewOrderSingle_LocateReqd = 106,
+    FIX44_NewOrderSingle_TransactTime = 107,
+    FIX44_NewOrderSingle_NoStipulations = 108,
+    FIX44_NewOrderSingle_QtyType = 109,
+    FIX44_NewOrderSingle_OrderQty = 110,
+    FIX44_NewOrderSingle_CashOrderQty = 111,
+    FIX44_NewOrderSingle_OrderPercent = 112,
+    FIX44_NewOrderSingle_RoundingDirection = 113,
+    FIX44_NewOrderSingle_RoundingModulus = 114,
+    FIX44_NewOrderSingle_OrdType = 115,
+    FIX44_NewOrderSingle_PriceType = 116,
+    FIX44_NewOrderSingle_Price = 117,
+    FIX44_NewOrderSingle_StopPx = 118,
+    FIX44_NewOrderSingle_Spread = 119,
+    FIX44_NewOrderSingle_BenchmarkCurveCurrency = 120,
+    FIX44_NewOrderSingle_BenchmarkCurveName = 121,
+    FIX44_NewOrderSingle_BenchmarkCurvePoint = 122,
+    FIX44_NewOrderSingle_BenchmarkPrice = 123,
+    FIX44_NewOrderSingle_BenchmarkPriceType = 124,
+    FIX44_NewOrderSingle_BenchmarkSecurityID = 125,
+    FIX44_NewOrderSingle_BenchmarkSecurityIDSource = 126,
+    FIX44_NewOrderSingle_YieldType = 127,
+    FIX44_NewOrderSingle_Yield = 128,
+    FIX44_NewOrderSingle_YieldCalcDate = 129,
+    FIX44_NewOrderSingle_YieldRedemptionDate = 130,
+    FIX44_NewOrderSingle_YieldRedemptionPrice = 131,
+    FIX44_NewOrderSingle_YieldRedemptionPriceType = 132,
+    FIX44_NewOrderSingle_Currency = 133,
+    FIX44_NewOrderSingle_ComplianceID = 134,
+    FIX44_NewOrderSingle_SolicitedFlag = 135,
+    FIX44_NewOrderSingle_IOIid = 136,
+    FIX44_NewOrderSingle_QuoteID = 137,
+    FIX44_NewOrderSingle_TimeInForce = 138,
+    FIX44_NewOrderSingle_EffectiveTime = 139,
+    FIX44_NewOrderSingle_ExpireDate = 140,
+    FIX44_NewOrderSingle_ExpireTime = 141,
+    FIX44_NewOrderSingle_GTBookingInst = 142,
+    FIX44_NewOrderSingle_Commission = 143,
+    FIX44_NewOrderSingle_CommType = 144,
+    FIX44_NewOrderSingle_CommCurrency = 145,
+    FIX44_NewOrderSingle_FundRenewWaiv = 146,
+    FIX44_NewOrderSingle_OrderCapacity = 147,
+    FIX44_NewOrderSingle_OrderRestrictions = 148,
+    FIX44_NewOrderSingle_CustOrderCapacity = 149,
+    FIX44_NewOrderSingle_ForexReq = 150,
+    FIX44_NewOrderSingle_SettlCurrency = 151,
+    FIX44_NewOrderSingle_BookingType = 152,
+    FIX44_NewOrderSingle_Text = 153,
+    FIX44_NewOrderSingle_EncodedTextLen = 154,
+    FIX44_NewOrderSingle_EncodedText = 155,
+    FIX44_NewOrderSingle_SettlDate2 = 156,
+    FIX44_NewOrderSingle_OrderQty2 = 157,
+    FIX44_NewOrderSingle_Price2 = 158,
+    FIX44_NewOrderSingle_PositionEffect = 159,
+    FIX44_NewOrderSingle_CoveredOrUncovered = 160,
+    FIX44_NewOrderSingle_MaxShow = 161,
+    FIX44_NewOrderSingle_PegOffsetValue = 162,
+    FIX44_NewOrderSingle_PegMoveType = 163,
+    FIX44_NewOrderSingle_PegOffsetType = 164,
+    FIX44_NewOrderSingle_PegLimitType = 165,
+    FIX44_NewOrderSingle_PegRoundDirection = 166,
+    FIX44_NewOrderSingle_PegScope = 167,
+    FIX44_NewOrderSingle_DiscretionInst = 168,
+    FIX44_NewOrderSingle_DiscretionOffsetValue = 169,
+    FIX44_NewOrderSingle_DiscretionMoveType = 170,
+    FIX44_NewOrderSingle_DiscretionOffsetType = 171,
+    FIX44_NewOrderSingle_DiscretionLimitType = 172,
+    FIX44_NewOrderSingle_DiscretionRoundDirection = 173,
+    FIX44_NewOrderSingle_DiscretionScope = 174,
+    FIX44_NewOrderSingle_TargetStrategy = 175,
+    FIX44_NewOrderSingle_TargetStrategyParameters = 176,
+    FIX44_NewOrderSingle_ParticipationRate = 177,
+    FIX44_NewOrderSingle_CancellationRights = 178,
+    FIX44_NewOrderSingle_MoneyLaunderingStatus = 179,
+    FIX44_NewOrderSingle_RegistID = 180,
+    FIX44_NewOrderSingle_Designation = 181,
+    FIX44_NewOrderSingle_SignatureLength = 182,
+    FIX44_NewOrderSingle_Signature = 183,
+    FIX44_NewOrderSingle_CheckSum = 184,
+};
+
+typedef struct _fix44NewOrderSingle {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    struct _ofixStrView	AllocID;
+    int64_t	NoAllocs;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    struct _ofixDecimal	PrevClosePx;
+    char	Side;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	NoStipulations;
+    int64_t	QtyType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    int64_t	BookingType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	SettlDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	Price2;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegOffsetValue;
+    int64_t	PegMoveType;
+    int64_t	PegOffsetType;
+    int64_t	PegLimitType;
+    int64_t	PegRoundDirection;
+    int64_t	PegScope;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffsetValue;
+    int64_t	DiscretionMoveType;
+    int64_t	DiscretionOffsetType;
+    int64_t	DiscretionLimitType;
+    int64_t	DiscretionRoundDirection;
+    int64_t	DiscretionScope;
+    int64_t	TargetStrategy;
+    struct _ofixStrView	TargetStrategyParameters;
+    struct _ofixDecimal	ParticipationRate;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44NewOrderSingle;
+
+extern void	fix44_decode_NewOrderSingle(ofixErr err, fix44NewOrderSingle m, const char *raw, int len);
+extern void	fix44_decode_NewOrderSingle_msg(ofixErr err, fix44NewOrderSingle m, ofixMsg msg);
+extern ofixMsg	fix44_encode_NewOrderSingle(ofixErr err, fix44NewOrderSingle m);
+
+// NewOrderList [E]
+enum {
+    FIX44_NewOrderList_BeginString = 0,
+    FIX44_NewOrderList_BodyLength = 1,
+    FIX44_NewOrderList_MsgType = 2,
+    FIX44_NewOrderList_SenderCompID = 3,
+    FIX44_NewOrderList_TargetCompID = 4,
+    FIX44_NewOrderList_OnBehalfOfCompID = 5,
+    FIX44_NewOrderList_DeliverToCompID = 6,
+    FIX44_NewOrderList_SecureDataLen = 7,
+    FIX44_NewOrderList_SecureData = 8,
+    FIX44_NewOrderList_MsgSeqNum = 9,
+    FIX44_NewOrderList_SenderSubID = 10,
+    FIX44_NewOrderList_SenderLocationID = 11,
+    FIX44_NewOrderList_TargetSubID = 12,
+    FIX44_NewOrderList_TargetLocationID = 13,
+    FIX44_NewOrderList_OnBehalfOfSubID = 14,
+    FIX44_NewOrderList_OnBehalfOfLocationID = 15,
+    FIX44_NewOrderList_DeliverToSubID = 16,
+    FIX44_NewOrderList_DeliverToLocationID = 17,
+    FIX44_NewOrderList_PossDupFlag = 18,
+    FIX44_NewOrderList_PossResend = 19,
+    FIX44_NewOrderList_SendingTime = 20,
+    FIX44_NewOrderList_OrigSendingTime = 21,
+    FIX44_NewOrderList_XmlDataLen = 22,
+    FIX44_NewOrderList_XmlData = 23,
+    FIX44_NewOrderList_MessageEncoding = 24,
+    FIX44_NewOrderList_LastMsgSeqNumProcessed = 25,
+    FIX44_NewOrderList_NoHops = 26,
+    FIX44_NewOrderList_ListID = 27,
+    FIX44_NewOrderList_BidID = 28,
+    FIX44_NewOrderList_ClientBidID = 29,
+    FIX44_NewOrderList_ProgRptReqs = 30,
+    FIX44_NewOrderList_BidType = 31,
+    FIX44_NewOrderList_ProgPeriodInterval = 32,
+    FIX44_NewOrderList_CancellationRights = 33,
+    FIX44_NewOrderList_MoneyLaunderingStatus = 34,
+    FIX44_NewOrderList_RegistID = 35,
+    FIX44_NewOrderList_ListExecInstType = 36,
+    FIX44_NewOrderList_ListExecInst = 37,
+    FIX44_NewOrderList_EncodedListExecInstLen = 38,
+    FIX44_NewOrderList_EncodedListExecInst = 39,
+    FIX44_NewOrderList_AllowableOneSidednessPct = 40,
+    FIX44_NewOrderList_AllowableOneSidednessValue = 41,
+    FIX44_NewOrderList_AllowableOneSidednessCurr = 42,
+    FIX44_NewOrderList_TotNoOrders = 43,
+    FIX44_NewOrderList_LastFragment = 44,
+    FIX44_NewOrderList_NoOrders = 45,
+    FIX44_NewOrderList_SignatureLength = 46,
+    FIX44_NewOrderList_Signature = 47,
+    FIX44_NewOrderList_CheckSum = 48,
+};
+
+typedef struct _fix44NewOrderList {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    int64_t	ProgRptReqs;
+    int64_t	BidType;
+    int64_t	ProgPeriodInterval;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    char	ListExecInstType;
+    struct _ofixStrView	ListExecInst;
+    int64_t	EncodedListExecInstLen;
+    struct _ofixStrView	EncodedListExecInst;
+    struct _ofixDecimal	AllowableOneSidednessPct;
+    struct _ofixDecimal	AllowableOneSidednessValue;
+    struct _ofixStrView	AllowableOneSidednessCurr;
+    int64_t	TotNoOrders;
+    char	LastFragment;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44NewOrderList;
+
+extern void	fix44_decode_NewOrderList(ofixErr err, fix44NewOrderList m, const char *raw, int len);
+extern void	fix44_decode_NewOrderList_msg(ofixErr err, fix44NewOrderList m, ofixMsg msg);
+extern ofixMsg	fix44_encode_NewOrderList(ofixErr err, fix44NewOrderList m);
+
+// OrderCancelRequest [F]
+enum {
+    FIX44_OrderCancelRequest_BeginString = 0,
+    FIX44_OrderCancelRequest_BodyLength = 1,
+    FIX44_OrderCancelRequest_MsgType = 2,
+    FIX44_OrderCancelRequest_SenderCompID = 3,
+    FIX44_OrderCancelRequest_TargetCompID = 4,
+    FIX44_OrderCancelRequest_OnBehalfOfCompID = 5,
+    FIX44_OrderCancelRequest_DeliverToCompID = 6,
+    FIX44_OrderCancelRequest_SecureDataLen = 7,
+    FIX44_OrderCancelRequest_SecureData = 8,
+    FIX44_OrderCancelRequest_MsgSeqNum = 9,
+    FIX44_OrderCancelRequest_SenderSubID = 10,
+    FIX44_OrderCancelRequest_SenderLocationID = 11,
+    FIX44_OrderCancelRequest_TargetSubID = 12,
+    FIX44_OrderCancelRequest_TargetLocationID = 13,
+    FIX44_OrderCancelRequest_OnBehalfOfSubID = 14,
+    FIX44_OrderCancelRequest_OnBehalfOfLocationID = 15,
+    FIX44_OrderCancelRequest_DeliverToSubID = 16,
+    FIX44_OrderCancelRequest_DeliverToLocationID = 17,
+    FIX44_OrderCancelRequest_PossDupFlag = 18,
+    FIX44_OrderCancelRequest_PossResend = 19,
+    FIX44_OrderCancelRequest_SendingTime = 20,
+    FIX44_OrderCancelRequest_OrigSendingTime = 21,
+    FIX44_OrderCancelRequest_XmlDataLen = 22,
+    FIX44_OrderCancelRequest_XmlData = 23,
+    FIX44_OrderCancelRequest_MessageEncoding = 24,
+    FIX44_OrderCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_OrderCancelRequest_NoHops = 26,
+    FIX44_OrderCancelRequest_OrigClOrdID = 27,
+    FIX44_OrderCancelRequest_OrderID = 28,
+    FIX44_OrderCancelRequest_ClOrdID = 29,
+    FIX44_OrderCancelRequest_SecondaryClOrdID = 30,
+    FIX44_OrderCancelRequest_ClOrdLinkID = 31,
+    FIX44_OrderCancelRequest_ListID = 32,
+    FIX44_OrderCancelRequest_OrigOrdModTime = 33,
+    FIX44_OrderCancelRequest_Account = 34,
+    FIX44_OrderCancelRequest_AcctIDSource = 35,
+    FIX44_OrderCancelRequest_AccountType = 36,
+    FIX44_OrderCancelRequest_NoPartyIDs = 37,
+    FIX44_OrderCancelRequest_Symbol = 38,
+    FIX44_OrderCancelRequest_SymbolSfx = 39,
+    FIX44_OrderCancelRequest_SecurityID = 40,
+    FIX44_OrderCancelRequest_SecurityIDSource = 41,
+    FIX44_OrderCancelRequest_NoSecurityAltID = 42,
+    FIX44_OrderCancelRequest_Product = 43,
+    FIX44_OrderCancelRequest_CFICode = 44,
+    FIX44_OrderCancelRequest_SecurityType = 45,
+    FIX44_OrderCancelRequest_SecuritySubType = 46,
+    FIX44_OrderCancelRequest_MaturityMonthYear = 47,
+    FIX44_OrderCancelRequest_MaturityDate = 48,
+    FIX44_OrderCancelRequest_CouponPaymentDate = 49,
+    FIX44_OrderCancelRequest_IssueDate = 50,
+    FIX44_OrderCancelRequest_RepoCollateralSecurityType = 51,
+    FIX44_OrderCancelRequest_RepurchaseTerm = 52,
+    FIX44_OrderCancelRequest_RepurchaseRate = 53,
+    FIX44_OrderCancelRequest_Factor = 54,
+    FIX44_OrderCancelRequest_CreditRating = 55,
+    FIX44_OrderCancelRequest_InstrRegistry = 56,
+    FIX44_OrderCancelRequest_CountryOfIssue = 57,
+    FIX44_OrderCancelRequest_StateOrProvinceOfIssue = 58,
+    FIX44_OrderCancelRequest_LocaleOfIssue = 59,
+    FIX44_OrderCancelRequest_RedemptionDate = 60,
+    FIX44_OrderCancelRequest_StrikePrice = 61,
+    FIX44_OrderCancelRequest_StrikeCurrency = 62,
+    FIX44_OrderCancelRequest_OptAttribute = 63,
+    FIX44_OrderCancelRequest_ContractMultiplier = 64,
+    FIX44_OrderCancelRequest_CouponRate = 65,
+    FIX44_OrderCancelRequest_SecurityExchange = 66,
+    FIX44_OrderCancelRequest_Issuer = 67,
+    FIX44_OrderCancelRequest_EncodedIssuerLen = 68,
+    FIX44_OrderCancelRequest_EncodedIssuer = 69,
+    FIX44_OrderCancelRequest_SecurityDesc = 70,
+    FIX44_OrderCancelRequest_EncodedSecurityDescLen = 71,
+    FIX44_OrderCancelRequest_EncodedSecurityDesc = 72,
+    FIX44_OrderCancelRequest_Pool = 73,
+    FIX44_OrderCancelRequest_ContractSettlMonth = 74,
+    FIX44_OrderCancelRequest_CPProgram = 75,
+    FIX44_OrderCancelRequest_CPRegType = 76,
+    FIX44_OrderCancelRequest_NoEvents = 77,
+    FIX44_OrderCancelRequest_DatedDate = 78,
+    FIX44_OrderCancelRequest_InterestAccrualDate = 79,
+    FIX44_OrderCancelRequest_AgreementDesc = 80,
+    FIX44_OrderCancelRequest_AgreementID = 81,
+    FIX44_OrderCancelRequest_AgreementDate = 82,
+    FIX44_OrderCancelRequest_AgreementCurrency = 83,
+    FIX44_OrderCancelRequest_TerminationType = 84,
+    FIX44_OrderCancelRequest_StartDate = 85,
+    FIX44_OrderCancelRequest_EndDate = 86,
+    FIX44_OrderCancelRequest_DeliveryType = 87,
+    FIX44_OrderCancelRequest_MarginRatio = 88,
+    FIX44_OrderCancelRequest_NoUnderlyings = 89,
+    FIX44_OrderCancelRequest_Side = 90,
+    FIX44_OrderCancelRequest_TransactTime = 91,
+    FIX44_OrderCancelRequest_OrderQty = 92,
+    FIX44_OrderCancelRequest_CashOrderQty = 93,
+    FIX44_OrderCancelRequest_OrderPercent = 94,
+    FIX44_OrderCancelRequest_RoundingDirection = 95,
+    FIX44_OrderCancelRequest_RoundingModulus = 96,
+    FIX44_OrderCancelRequest_ComplianceID = 97,
+    FIX44_OrderCancelRequest_Text = 98,
+    FIX44_OrderCancelRequest_EncodedTextLen = 99,
+    FIX44_OrderCancelRequest_EncodedText = 100,
+    FIX44_OrderCancelRequest_SignatureLength = 101,
+    FIX44_OrderCancelRequest_Signature = 102,
+    FIX44_OrderCancelRequest_CheckSum = 103,
+};
+
+typedef struct _fix44OrderCancelRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixStrView	ListID;
+    struct _ofixDate	OrigOrdModTime;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    struct _ofixStrView	ComplianceID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44OrderCancelRequest;
+
+extern void	fix44_decode_OrderCancelRequest(ofixErr err, fix44OrderCancelRequest m, const char *raw, int len);
+extern void	fix44_decode_OrderCancelRequest_msg(ofixErr err, fix44OrderCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_OrderCancelRequest(ofixErr err, fix44OrderCancelRequest m);
+
+// OrderCancelReplaceRequest [G]
+enum {
+    FIX44_OrderCancelReplaceRequest_BeginString = 0,
+    FIX44_OrderCancelReplaceRequest_BodyLength = 1,
+    FIX44_OrderCancelReplaceRequest_MsgType = 2,
+    FIX44_OrderCancelReplaceRequest_SenderCompID = 3,
+    FIX44_OrderCancelReplaceRequest_TargetCompID = 4,
+    FIX44_OrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX44_OrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX44_OrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX44_OrderCancelReplaceRequest_SecureData = 8,
+    FIX44_OrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX44_OrderCancelReplaceRequest_SenderSubID = 10,
+    FIX44_OrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX44_OrderCancelReplaceRequest_TargetSubID = 12,
+    FIX44_OrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX44_OrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX44_OrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX44_OrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX44_OrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX44_OrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX44_OrderCancelReplaceRequest_PossResend = 19,
+    FIX44_OrderCancelReplaceRequest_SendingTime = 20,
+    FIX44_OrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX44_OrderCancelReplaceRequest_XmlDataLen = 22,
+    FIX44_OrderCancelReplaceRequest_XmlData = 23,
+    FIX44_OrderCancelReplaceRequest_MessageEncoding = 24,
+    FIX44_OrderCancelReplaceRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_OrderCancelReplaceRequest_NoHops = 26,
+    FIX44_OrderCancelReplaceRequest_OrderID = 27,
+    FIX44_OrderCancelReplaceRequest_NoPartyIDs = 28,
+    FIX44_OrderCancelReplaceRequest_TradeOriginationDate = 29,
+    FIX44_OrderCancelReplaceRequest_TradeDate = 30,
+    FIX44_OrderCancelReplaceRequest_OrigClOrdID = 31,
+    FIX44_OrderCancelReplaceRequest_ClOrdID = 32,
+    FIX44_OrderCancelReplaceRequest_SecondaryClOrdID = 33,
+    FIX44_OrderCancelReplaceRequest_ClOrdLinkID = 34,
+    FIX44_OrderCancelReplaceRequest_ListID = 35,
+    FIX44_OrderCancelReplaceRequest_OrigOrdModTime = 36,
+    FIX44_OrderCancelReplaceRequest_Account = 37,
+    FIX44_OrderCancelReplaceRequest_AcctIDSource = 38,
+    FIX44_OrderCancelReplaceRequest_AccountType = 39,
+    FIX44_OrderCancelReplaceRequest_DayBookingInst = 40,
+    FIX44_OrderCancelReplaceRequest_BookingUnit = 41,
+    FIX44_OrderCancelReplaceRequest_PreallocMethod = 42,
+    FIX44_OrderCancelReplaceRequest_AllocID = 43,
+    FIX44_OrderCancelReplaceRequest_NoAllocs = 44,
+    FIX44_OrderCancelReplaceRequest_SettlType = 45,
+    FIX44_OrderCancelReplaceRequest_SettlDate = 46,
+    FIX44_OrderCancelReplaceRequest_CashMargin = 47,
+    FIX44_OrderCancelReplaceRequest_ClearingFeeIndicator = 48,
+    FIX44_OrderCancelReplaceRequest_HandlInst = 49,
+    FIX44_OrderCancelReplaceRequest_ExecInst = 50,
+    FIX44_OrderCancelReplaceRequest_MinQty = 51,
+    FIX44_OrderCancelReplaceRequest_MaxFloor = 52,
+    FIX44_OrderCancelReplaceRequest_ExDestination = 53,
+    FIX44_OrderCancelReplaceRequest_NoTradingSessions = 54,
+    FIX44_OrderCancelReplaceRequest_Symbol = 55,
+    FIX44_OrderCancelReplaceRequest_SymbolSfx = 56,
+    FIX44_OrderCancelReplaceRequest_SecurityID = 57,
+    FIX44_OrderCancelReplaceRequest_SecurityIDSource = 58,
+    FIX44_OrderCancelReplaceRequest_NoSecurityAltID = 59,
+    FIX44_OrderCancelReplaceRequest_Product = 60,
+    FIX44_OrderCancelReplaceRequest_CFICode = 61,
+    FIX44_OrderCancelReplaceRequest_SecurityType = 62,
+    FIX44_OrderCancelReplaceRequest_SecuritySubType = 63,
+    FIX44_OrderCancelReplaceRequest_MaturityMonthYear = 64,
+    FIX44_OrderCancelReplaceRequest_MaturityDate = 65,
+    FIX44_OrderCancelReplaceRequest_CouponPaymentDate = 66,
+    FIX44_OrderCancelReplaceRequest_IssueDate = 67,
+    FIX44_OrderCancelReplaceRequest_RepoCollateralSecurityType = 68,
+    FIX44_OrderCancelReplaceRequest_RepurchaseTerm = 69,
+    FIX44_OrderCancelReplaceRequest_RepurchaseRate = 70,
+    FIX44_OrderCancelReplaceRequest_Factor = 71,
+    FIX44_OrderCancelReplaceRequest_CreditRating = 72,
+    FIX44_OrderCancelReplaceRequest_InstrRegistry = 73,
+    FIX44_OrderCancelReplaceRequest_CountryOfIssue = 74,
+    FIX44_OrderCancelReplaceRequest_StateOrProvinceOfIssue = 75,
+    FIX44_OrderCancelReplaceRequest_LocaleOfIssue = 76,
+    FIX44_OrderCancelReplaceRequest_RedemptionDate = 77,
+    FIX44_OrderCancelReplaceRequest_StrikePrice = 78,
+    FIX44_OrderCancelReplaceRequest_StrikeCurrency = 79,
+    FIX44_OrderCancelReplaceRequest_OptAttribute = 80,
+    FIX44_OrderCancelReplaceRequest_ContractMultiplier = 81,
+    FIX44_OrderCancelReplaceRequest_CouponRate = 82,
+    FIX44_OrderCancelReplaceRequest_SecurityExchange = 83,
+    FIX44_OrderCancelReplaceRequest_Issuer = 84,
+    FIX44_OrderCancelReplaceRequest_EncodedIssuerLen = 85,
+    FIX44_OrderCancelReplaceRequest_EncodedIssuer = 86,
+    FIX44_OrderCancelReplaceRequest_SecurityDesc = 87,
+    FIX44_OrderCancelReplaceRequest_EncodedSecurityDescLen = 88,
+    FIX44_OrderCancelReplaceRequest_EncodedSecurityDesc = 89,
+    FIX44_OrderCancelReplaceRequest_Pool = 90,
+    FIX44_OrderCancelReplaceRequest_ContractSettlMonth = 91,
+    FIX44_OrderCancelReplaceRequest_CPProgram = 92,
+    FIX44_OrderCancelReplaceRequest_CPRegType = 93,
+    FIX44_OrderCancelReplaceRequest_NoEvents = 94,
+    FIX44_OrderCancelReplaceRequest_DatedDate = 95,
+    FIX44_OrderCancelReplaceRequest_InterestAccrualDate = 96,
+    FIX44_OrderCancelReplaceRequest_AgreementDesc = 97,
+    FIX44_OrderCancelReplaceRequest_AgreementID = 98,
+    FIX44_OrderCancelReplaceRequest_AgreementDate = 99,
+    FIX44_OrderCancelReplaceRequest_AgreementCurrency = 100,
+    FIX44_OrderCancelReplaceRequest_TerminationType = 101,
+    FIX44_OrderCancelReplaceRequest_StartDate = 102,
+    FIX44_OrderCancelReplaceRequest_EndDate = 103,
+    FIX44_OrderCancelReplaceRequest_DeliveryType = 104,
+    FIX44_OrderCancelReplaceRequest_MarginRatio = 105,
+    FIX44_OrderCancelReplaceRequest_NoUnderlyings = 106,
+    FIX44_OrderCancelReplaceRequest_Side = 107,
+    FIX44_OrderCancelReplaceRequest_TransactTime = 108,
+    FIX44_OrderCancelReplaceRequest_QtyType = 109,
+    FIX44_OrderCancelReplaceRequest_OrderQty = 110,
+    FIX44_OrderCancelReplaceRequest_CashOrderQty = 111,
+    FIX44_OrderCancelReplaceRequest_OrderPercent = 112,
+    FIX44_OrderCancelReplaceRequest_RoundingDirection = 113,
+    FIX44_OrderCancelReplaceRequest_RoundingModulus = 114,
+    FIX44_OrderCancelReplaceRequest_OrdType = 115,
+    FIX44_OrderCancelReplaceRequest_PriceType = 116,
+    FIX44_OrderCancelReplaceRequest_Price = 117,
+    FIX44_OrderCancelReplaceRequest_StopPx = 118,
+    FIX44_OrderCancelReplaceRequest_Spread = 119,
+    FIX44_OrderCancelReplaceRequest_BenchmarkCurveCurrency = 120,
+    FIX44_OrderCancelReplaceRequest_BenchmarkCurveName = 121,
+    FIX44_OrderCancelReplaceRequest_BenchmarkCurvePoint = 122,
+    FIX44_OrderCancelReplaceRequest_BenchmarkPrice = 123,
+    FIX44_OrderCancelReplaceRequest_BenchmarkPriceType = 124,
+    FIX44_OrderCancelReplaceRequest_BenchmarkSecurityID = 125,
+    FIX44_OrderCancelReplaceRequest_BenchmarkSecurityIDSource = 126,
+    FIX44_OrderCancelReplaceRequest_YieldType = 127,
+    FIX44_OrderCancelReplaceRequest_Yield = 128,
+    FIX44_OrderCancelReplaceRequest_YieldCalcDate = 129,
+    FIX44_OrderCancelReplaceRequest_YieldRedemptionDate = 130,
+    FIX44_OrderCancelReplaceRequest_YieldRedemptionPrice = 131,
+    FIX44_OrderCancelReplaceRequest_YieldRedemptionPriceType = 132,
+    FIX44_OrderCancelReplaceRequest_PegOffsetValue = 133,
+    FIX44_OrderCancelReplaceRequest_PegMoveType = 134,
+    FIX44_OrderCancelReplaceRequest_PegOffsetType = 135,
+    FIX44_OrderCancelReplaceRequest_PegLimitType = 136,
+    FIX44_OrderCancelReplaceRequest_PegRoundDirection = 137,
+    FIX44_OrderCancelReplaceRequest_PegScope = 138,
+    FIX44_OrderCancelReplaceRequest_DiscretionInst = 139,
+    FIX44_OrderCancelReplaceRequest_DiscretionOffsetValue = 140,
+    FIX44_OrderCancelReplaceRequest_DiscretionMoveType = 141,
+    FIX44_OrderCancelReplaceRequest_DiscretionOffsetType = 142,
+    FIX44_OrderCancelReplaceRequest_DiscretionLimitType = 143,
+    FIX44_OrderCancelReplaceRequest_DiscretionRoundDirection = 144,
+    FIX44_OrderCancelReplaceRequest_DiscretionScope = 145,
+    FIX44_OrderCancelReplaceRequest_TargetStrategy = 146,
+    FIX44_OrderCancelReplaceRequest_TargetStrategyParameters = 147,
+    FIX44_OrderCancelReplaceRequest_ParticipationRate = 148,
+    FIX44_OrderCancelReplaceRequest_ComplianceID = 149,
+    FIX44_OrderCancelReplaceRequest_SolicitedFlag = 150,
+    FIX44_OrderCancelReplaceRequest_Currency = 151,
+    FIX44_OrderCancelReplaceRequest_TimeInForce = 152,
+    FIX44_OrderCancelReplaceRequest_EffectiveTime = 153,
+    FIX44_OrderCancelReplaceRequest_ExpireDate = 154,
+    FIX44_OrderCancelReplaceRequest_ExpireTime = 155,
+    FIX44_OrderCancelReplaceRequest_GTBookingInst = 156,
+    FIX44_OrderCancelReplaceRequest_Commission = 157,
+    FIX44_OrderCancelReplaceRequest_CommType = 158,
+    FIX44_OrderCancelReplaceRequest_CommCurrency = 159,
+    FIX44_OrderCancelReplaceRequest_FundRenewWaiv = 160,
+    FIX44_OrderCancelReplaceRequest_OrderCapacity = 161,
+    FIX44_OrderCancelReplaceRequest_OrderRestrictions = 162,
+    FIX44_OrderCancelReplaceRequest_CustOrderCapacity = 163,
+    FIX44_OrderCancelReplaceRequest_ForexReq = 164,
+    FIX44_OrderCancelReplaceRequest_SettlCurrency = 165,
+    FIX44_OrderCancelReplaceRequest_BookingType = 166,
+    FIX44_OrderCancelReplaceRequest_Text = 167,
+    FIX44_OrderCancelReplaceRequest_EncodedTextLen = 168,
+    FIX44_OrderCancelReplaceRequest_EncodedText = 169,
+    FIX44_OrderCancelReplaceRequest_SettlDate2 = 170,
+    FIX44_OrderCancelReplaceRequest_OrderQty2 = 171,
+    FIX44_OrderCancelReplaceRequest_Price2 = 172,
+    FIX44_OrderCancelReplaceRequest_PositionEffect = 173,
+    FIX44_OrderCancelReplaceRequest_CoveredOrUncovered = 174,
+    FIX44_OrderCancelReplaceRequest_MaxShow = 175,
+    FIX44_OrderCancelReplaceRequest_LocateReqd = 176,
+    FIX44_OrderCancelReplaceRequest_CancellationRights = 177,
+    FIX44_OrderCancelReplaceRequest_MoneyLaunderingStatus = 178,
+    FIX44_OrderCancelReplaceRequest_RegistID = 179,
+    FIX44_OrderCancelReplaceRequest_Designation = 180,
+    FIX44_OrderCancelReplaceRequest_SignatureLength = 181,
+    FIX44_OrderCancelReplaceRequest_Signature = 182,
+    FIX44_OrderCancelReplaceRequest_CheckSum = 183,
+};
+
+typedef struct _fix44OrderCancelReplaceRequest {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	OrigClOrdID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    struct _ofixStrView	ListID;
+    struct _ofixDate	OrigOrdModTime;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    char	DayBookingInst;
+    char	BookingUnit;
+    char	PreallocMethod;
+    struct _ofixStrView	AllocID;
+    int64_t	NoAllocs;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	CashMargin;
+    struct _ofixStrView	ClearingFeeIndicator;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    int64_t	QtyType;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixDecimal	PegOffsetValue;
+    int64_t	PegMoveType;
+    int64_t	PegOffsetType;
+    int64_t	PegLimitType;
+    int64_t	PegRoundDirection;
+    int64_t	PegScope;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffsetValue;
+    int64_t	DiscretionMoveType;
+    int64_t	DiscretionOffsetType;
+    int64_t	DiscretionLimitType;
+    int64_t	DiscretionRoundDirection;
+    int64_t	DiscretionScope;
+    int64_t	TargetStrategy;
+    struct _ofixStrView	TargetStrategyParameters;
+    struct _ofixDecimal	ParticipationRate;
+    struct _ofixStrView	ComplianceID;
+    char	SolicitedFlag;
+    struct _ofixStrView	Currency;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	Commission;
+    char	CommType;
+    struct _ofixStrView	CommCurrency;
+    char	FundRenewWaiv;
+    char	OrderCapacity;
+    struct _ofixStrView	OrderRestrictions;
+    int64_t	CustOrderCapacity;
+    char	ForexReq;
+    struct _ofixStrView	SettlCurrency;
+    int64_t	BookingType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	SettlDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixDecimal	Price2;
+    char	PositionEffect;
+    int64_t	CoveredOrUncovered;
+    struct _ofixDecimal	MaxShow;
+    char	LocateReqd;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44OrderCancelReplaceRequest;
+
+extern void	fix44_decode_OrderCancelReplaceRequest(ofixErr err, fix44OrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix44_decode_OrderCancelReplaceRequest_msg(ofixErr err, fix44OrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_OrderCancelReplaceRequest(ofixErr err, fix44OrderCancelReplaceRequest m);
+
+// OrderStatusRequest [H]
+enum {
+    FIX44_OrderStatusRequest_BeginString = 0,
+    FIX44_OrderStatusRequest_BodyLength = 1,
+    FIX44_OrderStatusRequest_MsgType = 2,
+    FIX44_OrderStatusRequest_SenderCompID = 3,
+    FIX44_OrderStatusRequest_TargetCompID = 4,
+    FIX44_OrderStatusRequest_OnBehalfOfCompID = 5,
+    FIX44_OrderStatusRequest_DeliverToCompID = 6,
+    FIX44_OrderStatusRequest_SecureDataLen = 7,
+    FIX44_OrderStatusRequest_SecureData = 8,
+    FIX44_OrderStatusRequest_MsgSeqNum = 9,
+    FIX44_OrderStatusRequest_SenderSubID = 10,
+    FIX44_OrderStatusRequest_SenderLocationID = 11,
+    FIX44_OrderStatusRequest_TargetSubID = 12,
+    FIX44_OrderStatusRequest_TargetLocationID = 13,
+    FIX44_OrderStatusRequest_OnBehalfOfSubID = 14,
+    FIX44_OrderStatusRequest_OnBehalfOfLocationID = 15,
+    FIX44_OrderStatusRequest_DeliverToSubID = 16,
+    FIX44_OrderStatusRequest_DeliverToLocationID = 17,
+    FIX44_OrderStatusRequest_PossDupFlag = 18,
+    FIX44_OrderStatusRequest_PossResend = 19,
+    FIX44_OrderStatusRequest_SendingTime = 20,
+    FIX44_OrderStatusRequest_OrigSendingTime = 21,
+    FIX44_OrderStatusRequest_XmlDataLen = 22,
+    FIX44_OrderStatusRequest_XmlData = 23,
+    FIX44_OrderStatusRequest_MessageEncoding = 24,
+    FIX44_OrderStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_OrderStatusRequest_NoHops = 26,
+    FIX44_OrderStatusRequest_OrderID = 27,
+    FIX44_OrderStatusRequest_ClOrdID = 28,
+    FIX44_OrderStatusRequest_SecondaryClOrdID = 29,
+    FIX44_OrderStatusRequest_ClOrdLinkID = 30,
+    FIX44_OrderStatusRequest_NoPartyIDs = 31,
+    FIX44_OrderStatusRequest_OrdStatusReqID = 32,
+    FIX44_OrderStatusRequest_Account = 33,
+    FIX44_OrderStatusRequest_AcctIDSource = 34,
+    FIX44_OrderStatusRequest_Symbol = 35,
+    FIX44_OrderStatusRequest_SymbolSfx = 36,
+    FIX44_OrderStatusRequest_SecurityID = 37,
+    FIX44_OrderStatusRequest_SecurityIDSource = 38,
+    FIX44_OrderStatusRequest_NoSecurityAltID = 39,
+    FIX44_OrderStatusRequest_Product = 40,
+    FIX44_OrderStatusRequest_CFICode = 41,
+    FIX44_OrderStatusRequest_SecurityType = 42,
+    FIX44_OrderStatusRequest_SecuritySubType = 43,
+    FIX44_OrderStatusRequest_MaturityMonthYear = 44,
+    FIX44_OrderStatusRequest_MaturityDate = 45,
+    FIX44_OrderStatusRequest_CouponPaymentDate = 46,
+    FIX44_OrderStatusRequest_IssueDate = 47,
+    FIX44_OrderStatusRequest_RepoCollateralSecurityType = 48,
+    FIX44_OrderStatusRequest_RepurchaseTerm = 49,
+    FIX44_OrderStatusRequest_RepurchaseRate = 50,
+    FIX44_OrderStatusRequest_Factor = 51,
+    FIX44_OrderStatusRequest_CreditRating = 52,
+    FIX44_OrderStatusRequest_InstrRegistry = 53,
+    FIX44_OrderStatusRequest_CountryOfIssue = 54,
+    FIX44_OrderStatusRequest_StateOrProvinceOfIssue = 55,
+    FIX44_OrderStatusRequest_LocaleOfIssue = 56,
+    FIX44_OrderStatusRequest_RedemptionDate = 57,
+    FIX44_OrderStatusRequest_StrikePrice = 58,
+    FIX44_OrderStatusRequest_StrikeCurrency = 59,
+    FIX44_OrderStatusRequest_OptAttribute = 60,
+    FIX44_OrderStatusRequest_ContractMultiplier = 61,
+    FIX44_OrderStatusRequest_CouponRate = 62,
+    FIX44_OrderStatusRequest_SecurityExchange = 63,
+    FIX44_OrderStatusRequest_Issuer = 64,
+    FIX44_OrderStatusRequest_EncodedIssuerLen = 65,
+    FIX44_OrderStatusRequest_EncodedIssuer = 66,
+    FIX44_OrderStatusRequest_SecurityDesc = 67,
+    FIX44_OrderStatusRequest_EncodedSecurityDescLen = 68,
+    FIX44_OrderStatusRequest_EncodedSecurityDesc = 69,
+    FIX44_OrderStatusRequest_Pool = 70,
+    FIX44_OrderStatusRequest_ContractSettlMonth = 71,
+    FIX44_OrderStatusRequest_CPProgram = 72,
+    FIX44_OrderStatusRequest_CPRegType = 73,
+    FIX44_OrderStatusRequest_NoEvents = 74,
+    FIX44_OrderStatusRequest_DatedDate = 75,
+    FIX44_OrderStatusRequest_InterestAccrualDate = 76,
+    FIX44_OrderStatusRequest_AgreementDesc = 77,
+    FIX44_OrderStatusRequest_AgreementID = 78,
+    FIX44_OrderStatusRequest_AgreementDate = 79,
+    FIX44_OrderStatusRequest_AgreementCurrency = 80,
+    FIX44_OrderStatusRequest_TerminationType = 81,
+    FIX44_OrderStatusRequest_StartDate = 82,
+    FIX44_OrderStatusRequest_EndDate = 83,
+    FIX44_OrderStatusRequest_DeliveryType = 84,
+    FIX44_OrderStatusRequest_MarginRatio = 85,
+    FIX44_OrderStatusRequest_NoUnderlyings = 86,
+    FIX44_OrderStatusRequest_Side = 87,
+    FIX44_OrderStatusRequest_SignatureLength = 88,
+    FIX44_OrderStatusRequest_Signature = 89,
+    FIX44_OrderStatusRequest_CheckSum = 90,
+};
+
+typedef struct _fix44OrderStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	ClOrdLinkID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	OrdStatusReqID;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44OrderStatusRequest;
+
+extern void	fix44_decode_OrderStatusRequest(ofixErr err, fix44OrderStatusRequest m, const char *raw, int len);
+extern void	fix44_decode_OrderStatusRequest_msg(ofixErr err, fix44OrderStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_OrderStatusRequest(ofixErr err, fix44OrderStatusRequest m);
+
+// AllocationInstruction [J]
+enum {
+    FIX44_AllocationInstruction_BeginString = 0,
+    FIX44_AllocationInstruction_BodyLength = 1,
+    FIX44_AllocationInstruction_MsgType = 2,
+    FIX44_AllocationInstruction_SenderCompID = 3,
+    FIX44_AllocationInstruction_TargetCompID = 4,
+    FIX44_AllocationInstruction_OnBehalfOfCompID = 5,
+    FIX44_AllocationInstruction_DeliverToCompID = 6,
+    FIX44_AllocationInstruction_SecureDataLen = 7,
+    FIX44_AllocationInstruction_SecureData = 8,
+    FIX44_AllocationInstruction_MsgSeqNum = 9,
+    FIX44_AllocationInstruction_SenderSubID = 10,
+    FIX44_AllocationInstruction_SenderLocationID = 11,
+    FIX44_AllocationInstruction_TargetSubID = 12,
+    FIX44_AllocationInstruction_TargetLocationID = 13,
+    FIX44_AllocationInstruction_OnBehalfOfSubID = 14,
+    FIX44_AllocationInstruction_OnBehalfOfLocationID = 15,
+    FIX44_AllocationInstruction_DeliverToSubID = 16,
+    FIX44_AllocationInstruction_DeliverToLocationID = 17,
+    FIX44_AllocationInstruction_PossDupFlag = 18,
+    FIX44_AllocationInstruction_PossResend = 19,
+    FIX44_AllocationInstruction_SendingTime = 20,
+    FIX44_AllocationInstruction_OrigSendingTime = 21,
+    FIX44_AllocationInstruction_XmlDataLen = 22,
+    FIX44_AllocationInstruction_XmlData = 23,
+    FIX44_AllocationInstruction_MessageEncoding = 24,
+    FIX44_AllocationInstruction_LastMsgSeqNumProcessed = 25,
+    FIX44_AllocationInstruction_NoHops = 26,
+    FIX44_AllocationInstruction_AllocID = 27,
+    FIX44_AllocationInstruction_AllocTransType = 28,
+    FIX44_AllocationInstruction_AllocType = 29,
+    FIX44_AllocationInstruction_SecondaryAllocID = 30,
+    FIX44_AllocationInstruction_RefAllocID = 31,
+    FIX44_AllocationInstruction_AllocCancReplaceReason = 32,
+    FIX44_AllocationInstruction_AllocIntermedReqType = 33,
+    FIX44_AllocationInstruction_AllocLinkID = 34,
+    FIX44_AllocationInstruction_AllocLinkType = 35,
+    FIX44_AllocationInstruction_BookingRefID = 36,
+    FIX44_AllocationInstruction_AllocNoOrdersType = 37,
+    FIX44_AllocationInstruction_NoOrders = 38,
+    FIX44_AllocationInstruction_NoExecs = 39,
+    FIX44_AllocationInstruction_PreviouslyReported = 40,
+    FIX44_AllocationInstruction_ReversalIndicator = 41,
+    FIX44_AllocationInstruction_MatchType = 42,
+    FIX44_AllocationInstruction_Side = 43,
+    FIX44_AllocationInstruction_Symbol = 44,
+    FIX44_AllocationInstruction_SymbolSfx = 45,
+    FIX44_AllocationInstruction_SecurityID = 46,
+    FIX44_AllocationInstruction_SecurityIDSource = 47,
+    FIX44_AllocationInstruction_NoSecurityAltID = 48,
+    FIX44_AllocationInstruction_Product = 49,
+    FIX44_AllocationInstruction_CFICode = 50,
+    FIX44_AllocationInstruction_SecurityType = 51,
+    FIX44_AllocationInstruction_SecuritySubType = 52,
+    FIX44_AllocationInstruction_MaturityMonthYear = 53,
+    FIX44_AllocationInstruction_MaturityDate = 54,
+    FIX44_AllocationInstruction_CouponPaymentDate = 55,
+    FIX44_AllocationInstruction_IssueDate = 56,
+    FIX44_AllocationInstruction_RepoCollateralSecurityType = 57,
+    FIX44_AllocationInstruction_RepurchaseTerm = 58,
+    FIX44_AllocationInstruction_RepurchaseRate = 59,
+    FIX44_AllocationInstruction_Factor = 60,
+    FIX44_AllocationInstruction_CreditRating = 61,
+    FIX44_AllocationInstruction_InstrRegistry = 62,
+    FIX44_AllocationInstruction_CountryOfIssue = 63,
+    FIX44_AllocationInstruction_StateOrProvinceOfIssue = 64,
+    FIX44_AllocationInstruction_LocaleOfIssue = 65,
+    FIX44_AllocationInstruction_RedemptionDate = 66,
+    FIX44_AllocationInstruction_StrikePrice = 67,
+    FIX44_AllocationInstruction_StrikeCurrency = 68,
+    FIX44_AllocationInstruction_OptAttribute = 69,
+    FIX44_AllocationInstruction_ContractMultiplier = 70,
+    FIX44_AllocationInstruction_CouponRate = 71,
+    FIX44_AllocationInstruction_SecurityExchange = 72,
+    FIX44_AllocationInstruction_Issuer = 73,
+    FIX44_AllocationInstruction_EncodedIssuerLen = 74,
+    FIX44_AllocationInstruction_EncodedIssuer = 75,
+    FIX44_AllocationInstruction_SecurityDesc = 76,
+    FIX44_AllocationInstruction_EncodedSecurityDescLen = 77,
+    FIX44_AllocationInstruction_EncodedSecurityDesc = 78,
+    FIX44_AllocationInstruction_Pool = 79,
+    FIX44_AllocationInstruction_ContractSettlMonth = 80,
+    FIX44_AllocationInstruction_CPProgram = 81,
+    FIX44_AllocationInstruction_CPRegType = 82,
+    FIX44_AllocationInstruction_NoEvents = 83,
+    FIX44_AllocationInstruction_DatedDate = 84,
+    FIX44_AllocationInstruction_InterestAccrualDate = 85,
+    FIX44_AllocationInstruction_DeliveryForm = 86,
+    FIX44_AllocationInstruction_PctAtRisk = 87,
+    FIX44_AllocationInstruction_NoInstrAttrib = 88,
+    FIX44_AllocationInstruction_AgreementDesc = 89,
+    FIX44_AllocationInstruction_AgreementID = 90,
+    FIX44_AllocationInstruction_AgreementDate = 91,
+    FIX44_AllocationInstruction_AgreementCurrency = 92,
+    FIX44_AllocationInstruction_TerminationType = 93,
+    FIX44_AllocationInstruction_StartDate = 94,
+    FIX44_AllocationInstruction_EndDate = 95,
+    FIX44_AllocationInstruction_DeliveryType = 96,
+    FIX44_AllocationInstruction_MarginRatio = 97,
+    FIX44_AllocationInstruction_NoUnderlyings = 98,
+    FIX44_AllocationInstruction_NoLegs = 99,
+    FIX44_AllocationInstruction_Quantity = 100,
+    FIX44_AllocationInstruction_QtyType = 101,
+    FIX44_AllocationInstruction_LastMkt = 102,
+    FIX44_AllocationInstruction_TradeOriginationDate = 103,
+    FIX44_AllocationInstruction_TradingSessionID = 104,
+    FIX44_AllocationInstruction_TradingSessionSubID = 105,
+    FIX44_AllocationInstruction_PriceType = 106,
+    FIX44_AllocationInstruction_AvgPx = 107,
+    FIX44_AllocationInstruction_AvgParPx = 108,
+    FIX44_AllocationInstruction_Spread = 109,
+    FIX44_AllocationInstruction_BenchmarkCurveCurrency = 110,
+    FIX44_AllocationInstruction_BenchmarkCurveName = 111,
+    FIX44_AllocationInstruction_BenchmarkCurvePoint = 112,
+    FIX44_AllocationInstruction_BenchmarkPrice = 113,
+    FIX44_AllocationInstruction_BenchmarkPriceType = 114,
+    FIX44_AllocationInstruction_BenchmarkSecurityID = 115,
+    FIX44_AllocationInstruction_BenchmarkSecurityIDSource = 116,
+    FIX44_AllocationInstruction_Currency = 117,
+    FIX44_AllocationInstruction_AvgPxPrecision = 118,
+    FIX44_AllocationInstruction_NoPartyIDs = 119,
+    FIX44_AllocationInstruction_TradeDate = 120,
+    FIX44_AllocationInstruction_TransactTime = 121,
+    FIX44_AllocationInstruction_SettlType = 122,
+    FIX44_AllocationInstruction_SettlDate = 123,
+    FIX44_AllocationInstruction_BookingType = 124,
+    FIX44_AllocationInstruction_GrossTradeAmt = 125,
+    FIX44_AllocationInstruction_Concession = 126,
+    FIX44_AllocationInstruction_TotalTakedown = 127,
+    FIX44_AllocationInstruction_NetMoney = 128,
+    FIX44_AllocationInstruction_PositionEffect = 129,
+    FIX44_AllocationInstruction_AutoAcceptIndicator = 130,
+    FIX44_AllocationInstruction_Text = 131,
+    FIX44_AllocationInstruction_EncodedTextLen = 132,
+    FIX44_AllocationInstruction_EncodedText = 133,
+    FIX44_AllocationInstruction_NumDaysInterest = 134,
+    FIX44_AllocationInstruction_AccruedInterestRate = 135,
+    FIX44_AllocationInstruction_AccruedInterestAmt = 136,
+    FIX44_AllocationInstruction_TotalAccruedInterestAmt = 137,
+    FIX44_AllocationInstruction_InterestAtMaturity = 138,
+    FIX44_AllocationInstruction_EndAccruedInterestAmt = 139,
+    FIX44_AllocationInstruction_StartCash = 140,
+    FIX44_AllocationInstruction_EndCash = 141,
+    FIX44_AllocationInstruction_LegalConfirm = 142,
+    FIX44_AllocationInstruction_NoStipulations = 143,
+    FIX44_AllocationInstruction_YieldType = 144,
+    FIX44_AllocationInstruction_Yield = 145,
+    FIX44_AllocationInstruction_YieldCalcDate = 146,
+    FIX44_AllocationInstruction_YieldRedemptionDate = 147,
+    FIX44_AllocationInstruction_YieldRedemptionPrice = 148,
+    FIX44_AllocationInstruction_YieldRedemptionPriceType = 149,
+    FIX44_AllocationInstruction_TotNoAllocs = 150,
+    FIX44_AllocationInstruction_LastFragment = 151,
+    FIX44_AllocationInstruction_NoAllocs = 152,
+    FIX44_AllocationInstruction_SignatureLength = 153,
+    FIX44_AllocationInstruction_Signature = 154,
+    FIX44_AllocationInstruction_CheckSum = 155,
+};
+
+typedef struct _fix44AllocationInstruction {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	AllocID;
+    char	AllocTransType;
+    int64_t	AllocType;
+    struct _ofixStrView	SecondaryAllocID;
+    struct _ofixStrView	RefAllocID;
+    int64_t	AllocCancReplaceReason;
+    int64_t	AllocIntermedReqType;
+    struct _ofixStrView	AllocLinkID;
+    int64_t	AllocLinkType;
+    struct _ofixStrView	BookingRefID;
+    int64_t	AllocNoOrdersType;
+    int64_t	NoOrders;
+    int64_t	NoExecs;
+    char	PreviouslyReported;
+    char	ReversalIndicator;
+    struct _ofixStrView	MatchType;
+    char	Side;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixDecimal	Quantity;
+    int64_t	QtyType;
+    struct _ofixStrView	LastMkt;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	PriceType;
+    struct _ofixDecimal	AvgPx;
+    struct _ofixDecimal	AvgParPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	Currency;
+    int64_t	AvgPxPrecision;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    int64_t	BookingType;
+    struct _ofixDecimal	GrossTradeAmt;
+    struct _ofixDecimal	Concession;
+    struct _ofixDecimal	TotalTakedown;
+    struct _ofixDecimal	NetMoney;
+    char	PositionEffect;
+    char	AutoAcceptIndicator;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NumDaysInterest;
+    struct _ofixDecimal	AccruedInterestRate;
+    struct _ofixDecimal	AccruedInterestAmt;
+    struct _ofixDecimal	TotalAccruedInterestAmt;
+    struct _ofixDecimal	InterestAtMaturity;
+    struct _ofixDecimal	EndAccruedInterestAmt;
+    struct _ofixDecimal	StartCash;
+    struct _ofixDecimal	EndCash;
+    char	LegalConfirm;
+    int64_t	NoStipulations;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    int64_t	TotNoAllocs;
+    char	LastFragment;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44AllocationInstruction;
+
+extern void	fix44_decode_AllocationInstruction(ofixErr err, fix44AllocationInstruction m, const char *raw, int len);
+extern void	fix44_decode_AllocationInstruction_msg(ofixErr err, fix44AllocationInstruction m, ofixMsg msg);
+extern ofixMsg	fix44_encode_AllocationInstruction(ofixErr err, fix44AllocationInstruction m);
+
+// ListCancelRequest [K]
+enum {
+    FIX44_ListCancelRequest_BeginString = 0,
+    FIX44_ListCancelRequest_BodyLength = 1,
+    FIX44_ListCancelRequest_MsgType = 2,
+    FIX44_ListCancelRequest_SenderCompID = 3,
+    FIX44_ListCancelRequest_TargetCompID = 4,
+    FIX44_ListCancelRequest_OnBehalfOfCompID = 5,
+    FIX44_ListCancelRequest_DeliverToCompID = 6,
+    FIX44_ListCancelRequest_SecureDataLen = 7,
+    FIX44_ListCancelRequest_SecureData = 8,
+    FIX44_ListCancelRequest_MsgSeqNum = 9,
+    FIX44_ListCancelRequest_SenderSubID = 10,
+    FIX44_ListCancelRequest_SenderLocationID = 11,
+    FIX44_ListCancelRequest_TargetSubID = 12,
+    FIX44_ListCancelRequest_TargetLocationID = 13,
+    FIX44_ListCancelRequest_OnBehalfOfSubID = 14,
+    FIX44_ListCancelRequest_OnBehalfOfLocationID = 15,
+    FIX44_ListCancelRequest_DeliverToSubID = 16,
+    FIX44_ListCancelRequest_DeliverToLocationID = 17,
+    FIX44_ListCancelRequest_PossDupFlag = 18,
+    FIX44_ListCancelRequest_PossResend = 19,
+    FIX44_ListCancelRequest_SendingTime = 20,
+    FIX44_ListCancelRequest_OrigSendingTime = 21,
+    FIX44_ListCancelRequest_XmlDataLen = 22,
+    FIX44_ListCancelRequest_XmlData = 23,
+    FIX44_ListCancelRequest_MessageEncoding = 24,
+    FIX44_ListCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_ListCancelRequest_NoHops = 26,
+    FIX44_ListCancelRequest_ListID = 27,
+    FIX44_ListCancelRequest_TransactTime = 28,
+    FIX44_ListCancelRequest_TradeOriginationDate = 29,
+    FIX44_ListCancelRequest_TradeDate = 30,
+    FIX44_ListCancelRequest_Text = 31,
+    FIX44_ListCancelRequest_EncodedTextLen = 32,
+    FIX44_ListCancelRequest_EncodedText = 33,
+    FIX44_ListCancelRequest_SignatureLength = 34,
+    FIX44_ListCancelRequest_Signature = 35,
+    FIX44_ListCancelRequest_CheckSum = 36,
+};
+
+typedef struct _fix44ListCancelRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	TradeOriginationDate;
+    struct _ofixStrView	TradeDate;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ListCancelRequest;
+
+extern void	fix44_decode_ListCancelRequest(ofixErr err, fix44ListCancelRequest m, const char *raw, int len);
+extern void	fix44_decode_ListCancelRequest_msg(ofixErr err, fix44ListCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ListCancelRequest(ofixErr err, fix44ListCancelRequest m);
+
+// ListExecute [L]
+enum {
+    FIX44_ListExecute_BeginString = 0,
+    FIX44_ListExecute_BodyLength = 1,
+    FIX44_ListExecute_MsgType = 2,
+    FIX44_ListExecute_SenderCompID = 3,
+    FIX44_ListExecute_TargetCompID = 4,
+    FIX44_ListExecute_OnBehalfOfCompID = 5,
+    FIX44_ListExecute_DeliverToCompID = 6,
+    FIX44_ListExecute_SecureDataLen = 7,
+    FIX44_ListExecute_SecureData = 8,
+    FIX44_ListExecute_MsgSeqNum = 9,
+    FIX44_ListExecute_SenderSubID = 10,
+    FIX44_ListExecute_SenderLocationID = 11,
+    FIX44_ListExecute_TargetSubID = 12,
+    FIX44_ListExecute_TargetLocationID = 13,
+    FIX44_ListExecute_OnBehalfOfSubID = 14,
+    FIX44_ListExecute_OnBehalfOfLocationID = 15,
+    FIX44_ListExecute_DeliverToSubID = 16,
+    FIX44_ListExecute_DeliverToLocationID = 17,
+    FIX44_ListExecute_PossDupFlag = 18,
+    FIX44_ListExecute_PossResend = 19,
+    FIX44_ListExecute_SendingTime = 20,
+    FIX44_ListExecute_OrigSendingTime = 21,
+    FIX44_ListExecute_XmlDataLen = 22,
+    FIX44_ListExecute_XmlData = 23,
+    FIX44_ListExecute_MessageEncoding = 24,
+    FIX44_ListExecute_LastMsgSeqNumProcessed = 25,
+    FIX44_ListExecute_NoHops = 26,
+    FIX44_ListExecute_ListID = 27,
+    FIX44_ListExecute_ClientBidID = 28,
+    FIX44_ListExecute_BidID = 29,
+    FIX44_ListExecute_TransactTime = 30,
+    FIX44_ListExecute_Text = 31,
+    FIX44_ListExecute_EncodedTextLen = 32,
+    FIX44_ListExecute_EncodedText = 33,
+    FIX44_ListExecute_SignatureLength = 34,
+    FIX44_ListExecute_Signature = 35,
+    FIX44_ListExecute_CheckSum = 36,
+};
+
+typedef struct _fix44ListExecute {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	ClientBidID;
+    struct _ofixStrView	BidID;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ListExecute;
+
+extern void	fix44_decode_ListExecute(ofixErr err, fix44ListExecute m, const char *raw, int len);
+extern void	fix44_decode_ListExecute_msg(ofixErr err, fix44ListExecute m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ListExecute(ofixErr err, fix44ListExecute m);
+
+// ListStatusRequest [M]
+enum {
+    FIX44_ListStatusRequest_BeginString = 0,
+    FIX44_ListStatusRequest_BodyLength = 1,
+    FIX44_ListStatusRequest_MsgType = 2,
+    FIX44_ListStatusRequest_SenderCompID = 3,
+    FIX44_ListStatusRequest_TargetCompID = 4,
+    FIX44_ListStatusRequest_OnBehalfOfCompID = 5,
+    FIX44_ListStatusRequest_DeliverToCompID = 6,
+    FIX44_ListStatusRequest_SecureDataLen = 7,
+    FIX44_ListStatusRequest_SecureData = 8,
+    FIX44_ListStatusRequest_MsgSeqNum = 9,
+    FIX44_ListStatusRequest_SenderSubID = 10,
+    FIX44_ListStatusRequest_SenderLocationID = 11,
+    FIX44_ListStatusRequest_TargetSubID = 12,
+    FIX44_ListStatusRequest_TargetLocationID = 13,
+    FIX44_ListStatusRequest_OnBehalfOfSubID = 14,
+    FIX44_ListStatusRequest_OnBehalfOfLocationID = 15,
+    FIX44_ListStatusRequest_DeliverToSubID = 16,
+    FIX44_ListStatusRequest_DeliverToLocationID = 17,
+    FIX44_ListStatusRequest_PossDupFlag = 18,
+    FIX44_ListStatusRequest_PossResend = 19,
+    FIX44_ListStatusRequest_SendingTime = 20,
+    FIX44_ListStatusRequest_OrigSendingTime = 21,
+    FIX44_ListStatusRequest_XmlDataLen = 22,
+    FIX44_ListStatusRequest_XmlData = 23,
+    FIX44_ListStatusRequest_MessageEncoding = 24,
+    FIX44_ListStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_ListStatusRequest_NoHops = 26,
+    FIX44_ListStatusRequest_ListID = 27,
+    FIX44_ListStatusRequest_Text = 28,
+    FIX44_ListStatusRequest_EncodedTextLen = 29,
+    FIX44_ListStatusRequest_EncodedText = 30,
+    FIX44_ListStatusRequest_SignatureLength = 31,
+    FIX44_ListStatusRequest_Signature = 32,
+    FIX44_ListStatusRequest_CheckSum = 33,
+};
+
+typedef struct _fix44ListStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ListStatusRequest;
+
+extern void	fix44_decode_ListStatusRequest(ofixErr err, fix44ListStatusRequest m, const char *raw, int len);
+extern void	fix44_decode_ListStatusRequest_msg(ofixErr err, fix44ListStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ListStatusRequest(ofixErr err, fix44ListStatusRequest m);
+
+// ListStatus [N]
+enum {
+    FIX44_ListStatus_BeginString = 0,
+    FIX44_ListStatus_BodyLength = 1,
+    FIX44_ListStatus_MsgType = 2,
+    FIX44_ListStatus_SenderCompID = 3,
+    FIX44_ListStatus_TargetCompID = 4,
+    FIX44_ListStatus_OnBehalfOfCompID = 5,
+    FIX44_ListStatus_DeliverToCompID = 6,
+    FIX44_ListStatus_SecureDataLen = 7,
+    FIX44_ListStatus_SecureData = 8,
+    FIX44_ListStatus_MsgSeqNum = 9,
+    FIX44_ListStatus_SenderSubID = 10,
+    FIX44_ListStatus_SenderLocationID = 11,
+    FIX44_ListStatus_TargetSubID = 12,
+    FIX44_ListStatus_TargetLocationID = 13,
+    FIX44_ListStatus_OnBehalfOfSubID = 14,
+    FIX44_ListStatus_OnBehalfOfLocationID = 15,
+    FIX44_ListStatus_DeliverToSubID = 16,
+    FIX44_ListStatus_DeliverToLocationID = 17,
+    FIX44_ListStatus_PossDupFlag = 18,
+    FIX44_ListStatus_PossResend = 19,
+    FIX44_ListStatus_SendingTime = 20,
+    FIX44_ListStatus_OrigSendingTime = 21,
+    FIX44_ListStatus_XmlDataLen = 22,
+    FIX44_ListStatus_XmlData = 23,
+    FIX44_ListStatus_MessageEncoding = 24,
+    FIX44_ListStatus_LastMsgSeqNumProcessed = 25,
+    FIX44_ListStatus_NoHops = 26,
+    FIX44_ListStatus_ListID = 27,
+    FIX44_ListStatus_ListStatusType = 28,
+    FIX44_ListStatus_NoRpts = 29,
+    FIX44_ListStatus_ListOrderStatus = 30,
+    FIX44_ListStatus_RptSeq = 31,
+    FIX44_ListStatus_ListStatusText = 32,
+    FIX44_ListStatus_EncodedListStatusTextLen = 33,
+    FIX44_ListStatus_EncodedListStatusText = 34,
+    FIX44_ListStatus_TransactTime = 35,
+    FIX44_ListStatus_TotNoOrders = 36,
+    FIX44_ListStatus_LastFragment = 37,
+    FIX44_ListStatus_NoOrders = 38,
+    FIX44_ListStatus_SignatureLength = 39,
+    FIX44_ListStatus_Signature = 40,
+    FIX44_ListStatus_CheckSum = 41,
+};
+
+typedef struct _fix44ListStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    int64_t	ListStatusType;
+    int64_t	NoRpts;
+    int64_t	ListOrderStatus;
+    int64_t	RptSeq;
+    struct _ofixStrView	ListStatusText;
+    int64_t	EncodedListStatusTextLen;
+    struct _ofixStrView	EncodedListStatusText;
+    struct _ofixDate	TransactTime;
+    int64_t	TotNoOrders;
+    char	LastFragment;
+    int64_t	NoOrders;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ListStatus;
+
+extern void	fix44_decode_ListStatus(ofixErr err, fix44ListStatus m, const char *raw, int len);
+extern void	fix44_decode_ListStatus_msg(ofixErr err, fix44ListStatus m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ListStatus(ofixErr err, fix44ListStatus m);
+
+// AllocationInstructionAck [P]
+enum {
+    FIX44_AllocationInstructionAck_BeginString = 0,
+    FIX44_AllocationInstructionAck_BodyLength = 1,
+    FIX44_AllocationInstructionAck_MsgType = 2,
+    FIX44_AllocationInstructionAck_SenderCompID = 3,
+    FIX44_AllocationInstructionAck_TargetCompID = 4,
+    FIX44_AllocationInstructionAck_OnBehalfOfCompID = 5,
+    FIX44_AllocationInstructionAck_DeliverToCompID = 6,
+    FIX44_AllocationInstructionAck_SecureDataLen = 7,
+    FIX44_AllocationInstructionAck_SecureData = 8,
+    FIX44_AllocationInstructionAck_MsgSeqNum = 9,
+    FIX44_AllocationInstructionAck_SenderSubID = 10,
+    FIX44_AllocationInstructionAck_SenderLocationID = 11,
+    FIX44_AllocationInstructionAck_TargetSubID = 12,
+    FIX44_AllocationInstructionAck_TargetLocationID = 13,
+    FIX44_AllocationInstructionAck_OnBehalfOfSubID = 14,
+    FIX44_AllocationInstructionAck_OnBehalfOfLocationID = 15,
+    FIX44_AllocationInstructionAck_DeliverToSubID = 16,
+    FIX44_AllocationInstructionAck_DeliverToLocationID = 17,
+    FIX44_AllocationInstructionAck_PossDupFlag = 18,
+    FIX44_AllocationInstructionAck_PossResend = 19,
+    FIX44_AllocationInstructionAck_SendingTime = 20,
+    FIX44_AllocationInstructionAck_OrigSendingTime = 21,
+    FIX44_AllocationInstructionAck_XmlDataLen = 22,
+    FIX44_AllocationInstructionAck_XmlData = 23,
+    FIX44_AllocationInstructionAck_MessageEncoding = 24,
+    FIX44_AllocationInstructionAck_LastMsgSeqNumProcessed = 25,
+    FIX44_AllocationInstructionAck_NoHops = 26,
+    FIX44_AllocationInstructionAck_AllocID = 27,
+    FIX44_AllocationInstructionAck_NoPartyIDs = 28,
+    FIX44_AllocationInstructionAck_SecondaryAllocID = 29,
+    FIX44_AllocationInstructionAck_TradeDate = 30,
+    FIX44_AllocationInstructionAck_TransactTime = 31,
+    FIX44_AllocationInstructionAck_AllocStatus = 32,
+    FIX44_AllocationInstructionAck_AllocRejCode = 33,
+    FIX44_AllocationInstructionAck_AllocType = 34,
+    FIX44_AllocationInstructionAck_AllocIntermedReqType = 35,
+    FIX44_AllocationInstructionAck_MatchStatus = 36,
+    FIX44_AllocationInstructionAck_Product = 37,
+    FIX44_AllocationInstructionAck_SecurityType = 38,
+    FIX44_AllocationInstructionAck_Text = 39,
+    FIX44_AllocationInstructionAck_EncodedTextLen = 40,
+    FIX44_AllocationInstructionAck_EncodedText = 41,
+    FIX44_AllocationInstructionAck_NoAllocs = 42,
+    FIX44_AllocationInstructionAck_SignatureLength = 43,
+    FIX44_AllocationInstructionAck_Signature = 44,
+    FIX44_AllocationInstructionAck_CheckSum = 45,
+};
+
+typedef struct _fix44AllocationInstructionAck {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	AllocID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	SecondaryAllocID;
+    struct _ofixStrView	TradeDate;
+    struct _ofixDate	TransactTime;
+    int64_t	AllocStatus;
+    int64_t	AllocRejCode;
+    int64_t	AllocType;
+    int64_t	AllocIntermedReqType;
+    char	MatchStatus;
+    int64_t	Product;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NoAllocs;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44AllocationInstructionAck;
+
+extern void	fix44_decode_AllocationInstructionAck(ofixErr err, fix44AllocationInstructionAck m, const char *raw, int len);
+extern void	fix44_decode_AllocationInstructionAck_msg(ofixErr err, fix44AllocationInstructionAck m, ofixMsg msg);
+extern ofixMsg	fix44_encode_AllocationInstructionAck(ofixErr err, fix44AllocationInstructionAck m);
+
+// DontKnowTrade [Q]
+enum {
+    FIX44_DontKnowTrade_BeginString = 0,
+    FIX44_DontKnowTrade_BodyLength = 1,
+    FIX44_DontKnowTrade_MsgType = 2,
+    FIX44_DontKnowTrade_SenderCompID = 3,
+    FIX44_DontKnowTrade_TargetCompID = 4,
+    FIX44_DontKnowTrade_OnBehalfOfCompID = 5,
+    FIX44_DontKnowTrade_DeliverToCompID = 6,
+    FIX44_DontKnowTrade_SecureDataLen = 7,
+    FIX44_DontKnowTrade_SecureData = 8,
+    FIX44_DontKnowTrade_MsgSeqNum = 9,
+    FIX44_DontKnowTrade_SenderSubID = 10,
+    FIX44_DontKnowTrade_SenderLocationID = 11,
+    FIX44_DontKnowTrade_TargetSubID = 12,
+    FIX44_DontKnowTrade_TargetLocationID = 13,
+    FIX44_DontKnowTrade_OnBehalfOfSubID = 14,
+    FIX44_DontKnowTrade_OnBehalfOfLocationID = 15,
+    FIX44_DontKnowTrade_DeliverToSubID = 16,
+    FIX44_DontKnowTrade_DeliverToLocationID = 17,
+    FIX44_DontKnowTrade_PossDupFlag = 18,
+    FIX44_DontKnowTrade_PossResend = 19,
+    FIX44_DontKnowTrade_SendingTime = 20,
+    FIX44_DontKnowTrade_OrigSendingTime = 21,
+    FIX44_DontKnowTrade_XmlDataLen = 22,
+    FIX44_DontKnowTrade_XmlData = 23,
+    FIX44_DontKnowTrade_MessageEncoding = 24,
+    FIX44_DontKnowTrade_LastMsgSeqNumProcessed = 25,
+    FIX44_DontKnowTrade_NoHops = 26,
+    FIX44_DontKnowTrade_OrderID = 27,
+    FIX44_DontKnowTrade_SecondaryOrderID = 28,
+    FIX44_DontKnowTrade_ExecID = 29,
+    FIX44_DontKnowTrade_DKReason = 30,
+    FIX44_DontKnowTrade_Symbol = 31,
+    FIX44_DontKnowTrade_SymbolSfx = 32,
+    FIX44_DontKnowTrade_SecurityID = 33,
+    FIX44_DontKnowTrade_SecurityIDSource = 34,
+    FIX44_DontKnowTrade_NoSecurityAltID = 35,
+    FIX44_DontKnowTrade_Product = 36,
+    FIX44_DontKnowTrade_CFICode = 37,
+    FIX44_DontKnowTrade_SecurityType = 38,
+    FIX44_DontKnowTrade_SecuritySubType = 39,
+    FIX44_DontKnowTrade_MaturityMonthYear = 40,
+    FIX44_DontKnowTrade_MaturityDate = 41,
+    FIX44_DontKnowTrade_CouponPaymentDate = 42,
+    FIX44_DontKnowTrade_IssueDate = 43,
+    FIX44_DontKnowTrade_RepoCollateralSecurityType = 44,
+    FIX44_DontKnowTrade_RepurchaseTerm = 45,
+    FIX44_DontKnowTrade_RepurchaseRate = 46,
+    FIX44_DontKnowTrade_Factor = 47,
+    FIX44_DontKnowTrade_CreditRating = 48,
+    FIX44_DontKnowTrade_InstrRegistry = 49,
+    FIX44_DontKnowTrade_CountryOfIssue = 50,
+    FIX44_DontKnowTrade_StateOrProvinceOfIssue = 51,
+    FIX44_DontKnowTrade_LocaleOfIssue = 52,
+    FIX44_DontKnowTrade_RedemptionDate = 53,
+    FIX44_DontKnowTrade_StrikePrice = 54,
+    FIX44_DontKnowTrade_StrikeCurrency = 55,
+    FIX44_DontKnowTrade_OptAttribute = 56,
+    FIX44_DontKnowTrade_ContractMultiplier = 57,
+    FIX44_DontKnowTrade_CouponRate = 58,
+    FIX44_DontKnowTrade_SecurityExchange = 59,
+    FIX44_DontKnowTrade_Issuer = 60,
+    FIX44_DontKnowTrade_EncodedIssuerLen = 61,
+    FIX44_DontKnowTrade_EncodedIssuer = 62,
+    FIX44_DontKnowTrade_SecurityDesc = 63,
+    FIX44_DontKnowTrade_EncodedSecurityDescLen = 64,
+    FIX44_DontKnowTrade_EncodedSecurityDesc = 65,
+    FIX44_DontKnowTrade_Pool = 66,
+    FIX44_DontKnowTrade_ContractSettlMonth = 67,
+    FIX44_DontKnowTrade_CPProgram = 68,
+    FIX44_DontKnowTrade_CPRegType = 69,
+    FIX44_DontKnowTrade_NoEvents = 70,
+    FIX44_DontKnowTrade_DatedDate = 71,
+    FIX44_DontKnowTrade_InterestAccrualDate = 72,
+    FIX44_DontKnowTrade_NoUnderlyings = 73,
+    FIX44_DontKnowTrade_NoLegs = 74,
+    FIX44_DontKnowTrade_Side = 75,
+    FIX44_DontKnowTrade_OrderQty = 76,
+    FIX44_DontKnowTrade_CashOrderQty = 77,
+    FIX44_DontKnowTrade_OrderPercent = 78,
+    FIX44_DontKnowTrade_RoundingDirection = 79,
+    FIX44_DontKnowTrade_RoundingModulus = 80,
+    FIX44_DontKnowTrade_LastQty = 81,
+    FIX44_DontKnowTrade_LastPx = 82,
+    FIX44_DontKnowTrade_Text = 83,
+    FIX44_DontKnowTrade_EncodedTextLen = 84,
+    FIX44_DontKnowTrade_EncodedText = 85,
+    FIX44_DontKnowTrade_SignatureLength = 86,
+    FIX44_DontKnowTrade_Signature = 87,
+    FIX44_DontKnowTrade_CheckSum = 88,
+};
+
+typedef struct _fix44DontKnowTrade {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    struct _ofixStrView	ExecID;
+    char	DKReason;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    char	Side;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    struct _ofixDecimal	LastQty;
+    struct _ofixDecimal	LastPx;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44DontKnowTrade;
+
+extern void	fix44_decode_DontKnowTrade(ofixErr err, fix44DontKnowTrade m, const char *raw, int len);
+extern void	fix44_decode_DontKnowTrade_msg(ofixErr err, fix44DontKnowTrade m, ofixMsg msg);
+extern ofixMsg	fix44_encode_DontKnowTrade(ofixErr err, fix44DontKnowTrade m);
+
+// QuoteRequest [R]
+enum {
+    FIX44_QuoteRequest_BeginString = 0,
+    FIX44_QuoteRequest_BodyLength = 1,
+    FIX44_QuoteRequest_MsgType = 2,
+    FIX44_QuoteRequest_SenderCompID = 3,
+    FIX44_QuoteRequest_TargetCompID = 4,
+    FIX44_QuoteRequest_OnBehalfOfCompID = 5,
+    FIX44_QuoteRequest_DeliverToCompID = 6,
+    FIX44_QuoteRequest_SecureDataLen = 7,
+    FIX44_QuoteRequest_SecureData = 8,
+    FIX44_QuoteRequest_MsgSeqNum = 9,
+    FIX44_QuoteRequest_SenderSubID = 10,
+    FIX44_QuoteRequest_SenderLocationID = 11,
+    FIX44_QuoteRequest_TargetSubID = 12,
+    FIX44_QuoteRequest_TargetLocationID = 13,
+    FIX44_QuoteRequest_OnBehalfOfSubID = 14,
+    FIX44_QuoteRequest_OnBehalfOfLocationID = 15,
+    FIX44_QuoteRequest_DeliverToSubID = 16,
+    FIX44_QuoteRequest_DeliverToLocationID = 17,
+    FIX44_QuoteRequest_PossDupFlag = 18,
+    FIX44_QuoteRequest_PossResend = 19,
+    FIX44_QuoteRequest_SendingTime = 20,
+    FIX44_QuoteRequest_OrigSendingTime = 21,
+    FIX44_QuoteRequest_XmlDataLen = 22,
+    FIX44_QuoteRequest_XmlData = 23,
+    FIX44_QuoteRequest_MessageEncoding = 24,
+    FIX44_QuoteRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_QuoteRequest_NoHops = 26,
+    FIX44_QuoteRequest_QuoteReqID = 27,
+    FIX44_QuoteRequest_RFQReqID = 28,
+    FIX44_QuoteRequest_ClOrdID = 29,
+    FIX44_QuoteRequest_OrderCapacity = 30,
+    FIX44_QuoteRequest_NoRelatedSym = 31,
+    FIX44_QuoteRequest_Text = 32,
+    FIX44_QuoteRequest_EncodedTextLen = 33,
+    FIX44_QuoteRequest_EncodedText = 34,
+    FIX44_QuoteRequest_SignatureLength = 35,
+    FIX44_QuoteRequest_Signature = 36,
+    FIX44_QuoteRequest_CheckSum = 37,
+};
+
+typedef struct _fix44QuoteRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	RFQReqID;
+    struct _ofixStrView	ClOrdID;
+    char	OrderCapacity;
+    int64_t	NoRelatedSym;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44QuoteRequest;
+
+extern void	fix44_decode_QuoteRequest(ofixErr err, fix44QuoteRequest m, const char *raw, int len);
+extern void	fix44_decode_QuoteRequest_msg(ofixErr err, fix44QuoteRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_QuoteRequest(ofixErr err, fix44QuoteRequest m);
+
+// Quote [S]
+enum {
+    FIX44_Quote_BeginString = 0,
+    FIX44_Quote_BodyLength = 1,
+    FIX44_Quote_MsgType = 2,
+    FIX44_Quote_SenderCompID = 3,
+    FIX44_Quote_TargetCompID = 4,
+    FIX44_Quote_OnBehalfOfCompID = 5,
+    FIX44_Quote_DeliverToCompID = 6,
+    FIX44_Quote_SecureDataLen = 7,
+    FIX44_Quote_SecureData = 8,
+    FIX44_Quote_MsgSeqNum = 9,
+    FIX44_Quote_SenderSubID = 10,
+    FIX44_Quote_SenderLocationID = 11,
+    FIX44_Quote_TargetSubID = 12,
+    FIX44_Quote_TargetLocationID = 13,
+    FIX44_Quote_OnBehalfOfSubID = 14,
+    FIX44_Quote_OnBehalfOfLocationID = 15,
+    FIX44_Quote_DeliverToSubID = 16,
+    FIX44_Quote_DeliverToLocationID = 17,
+    FIX44_Quote_PossDupFlag = 18,
+    FIX44_Quote_PossResend = 19,
+    FIX44_Quote_SendingTime = 20,
+    FIX44_Quote_OrigSendingTime = 21,
+    FIX44_Quote_XmlDataLen = 22,
+    FIX44_Quote_XmlData = 23,
+    FIX44_Quote_MessageEncoding = 24,
+    FIX44_Quote_LastMsgSeqNumProcessed = 25,
+    FIX44_Quote_NoHops = 26,
+    FIX44_Quote_QuoteReqID = 27,
+    FIX44_Quote_QuoteID = 28,
+    FIX44_Quote_QuoteRespID = 29,
+    FIX44_Quote_QuoteType = 30,
+    FIX44_Quote_NoQuoteQualifiers = 31,
+    FIX44_Quote_QuoteResponseLevel = 32,
+    FIX44_Quote_NoPartyIDs = 33,
+    FIX44_Quote_TradingSessionID = 34,
+    FIX44_Quote_TradingSessionSubID = 35,
+    FIX44_Quote_Symbol = 36,
+    FIX44_Quote_SymbolSfx = 37,
+    FIX44_Quote_SecurityID = 38,
+    FIX44_Quote_SecurityIDSource = 39,
+    FIX44_Quote_NoSecurityAltID = 40,
+    FIX44_Quote_Product = 41,
+    FIX44_Quote_CFICode = 42,
+    FIX44_Quote_SecurityType = 43,
+    FIX44_Quote_SecuritySubType = 44,
+    FIX44_Quote_MaturityMonthYear = 45,
+    FIX44_Quote_MaturityDate = 46,
+    FIX44_Quote_CouponPaymentDate = 47,
+    FIX44_Quote_IssueDate = 48,
+    FIX44_Quote_RepoCollateralSecurityType = 49,
+    FIX44_Quote_RepurchaseTerm = 50,
+    FIX44_Quote_RepurchaseRate = 51,
+    FIX44_Quote_Factor = 52,
+    FIX44_Quote_CreditRating = 53,
+    FIX44_Quote_InstrRegistry = 54,
+    FIX44_Quote_CountryOfIssue = 55,
+    FIX44_Quote_StateOrProvinceOfIssue = 56,
+    FIX44_Quote_LocaleOfIssue = 57,
+    FIX44_Quote_RedemptionDate = 58,
+    FIX44_Quote_StrikePrice = 59,
+    FIX44_Quote_StrikeCurrency = 60,
+    FIX44_Quote_OptAttribute = 61,
+    FIX44_Quote_ContractMultiplier = 62,
+    FIX44_Quote_CouponRate = 63,
+    FIX44_Quote_SecurityExchange = 64,
+    FIX44_Quote_Issuer = 65,
+    FIX44_Quote_EncodedIssuerLen = 66,
+    FIX44_Quote_EncodedIssuer = 67,
+    FIX44_Quote_SecurityDesc = 68,
+    FIX44_Quote_EncodedSecurityDescLen = 69,
+    FIX44_Quote_EncodedSecurityDesc = 70,
+    FIX44_Quote_Pool = 71,
+    FIX44_Quote_ContractSettlMonth = 72,
+    FIX44_Quote_CPProgram = 73,
+    FIX44_Quote_CPRegType = 74,
+    FIX44_Quote_NoEvents = 75,
+    FIX44_Quote_DatedDate = 76,
+    FIX44_Quote_InterestAccrualDate = 77,
+    FIX44_Quote_AgreementDesc = 78,
+    FIX44_Quote_AgreementID = 79,
+    FIX44_Quote_AgreementDate = 80,
+    FIX44_Quote_AgreementCurrency = 81,
+    FIX44_Quote_TerminationType = 82,
+    FIX44_Quote_StartDate = 83,
+    FIX44_Quote_EndDate = 84,
+    FIX44_Quote_DeliveryType = 85,
+    FIX44_Quote_MarginRatio = 86,
+    FIX44_Quote_NoUnderlyings = 87,
+    FIX44_Quote_Side = 88,
+    FIX44_Quote_OrderQty = 89,
+    FIX44_Quote_CashOrderQty = 90,
+    FIX44_Quote_OrderPercent = 91,
+    FIX44_Quote_RoundingDirection = 92,
+    FIX44_Quote_RoundingModulus = 93,
+    FIX44_Quote_SettlType = 94,
+    FIX44_Quote_SettlDate = 95,
+    FIX44_Quote_SettlDate2 = 96,
+    FIX44_Quote_OrderQty2 = 97,
+    FIX44_Quote_Currency = 98,
+    FIX44_Quote_NoStipulations = 99,
+    FIX44_Quote_Account = 100,
+    FIX44_Quote_AcctIDSource = 101,
+    FIX44_Quote_AccountType = 102,
+    FIX44_Quote_NoLegs = 103,
+    FIX44_Quote_BidPx = 104,
+    FIX44_Quote_OfferPx = 105,
+    FIX44_Quote_MktBidPx = 106,
+    FIX44_Quote_MktOfferPx = 107,
+    FIX44_Quote_MinBidSize = 108,
+    FIX44_Quote_BidSize = 109,
+    FIX44_Quote_MinOfferSize = 110,
+    FIX44_Quote_OfferSize = 111,
+    FIX44_Quote_ValidUntilTime = 112,
+    FIX44_Quote_BidSpotRate = 113,
+    FIX44_Quote_OfferSpotRate = 114,
+    FIX44_Quote_BidForwardPoints = 115,
+    FIX44_Quote_OfferForwardPoints = 116,
+    FIX44_Quote_MidPx = 117,
+    FIX44_Quote_BidYield = 118,
+    FIX44_Quote_MidYield = 119,
+    FIX44_Quote_OfferYield = 120,
+    FIX44_Quote_TransactTime = 121,
+    FIX44_Quote_OrdType = 122,
+    FIX44_Quote_BidForwardPoints2 = 123,
+    FIX44_Quote_OfferForwardPoints2 = 124,
+    FIX44_Quote_SettlCurrBidFxRate = 125,
+    FIX44_Quote_SettlCurrOfferFxRate = 126,
+    FIX44_Quote_SettlCurrFxRateCalc = 127,
+    FIX44_Quote_CommType = 128,
+    FIX44_Quote_Commission = 129,
+    FIX44_Quote_CustOrderCapacity = 130,
+    FIX44_Quote_ExDestination = 131,
+    FIX44_Quote_OrderCapacity = 132,
+    FIX44_Quote_PriceType = 133,
+    FIX44_Quote_Spread = 134,
+    FIX44_Quote_BenchmarkCurveCurrency = 135,
+    FIX44_Quote_BenchmarkCurveName = 136,
+    FIX44_Quote_BenchmarkCurvePoint = 137,
+    FIX44_Quote_BenchmarkPrice = 138,
+    FIX44_Quote_BenchmarkPriceType = 139,
+    FIX44_Quote_BenchmarkSecurityID = 140,
+    FIX44_Quote_BenchmarkSecurityIDSource = 141,
+    FIX44_Quote_YieldType = 142,
+    FIX44_Quote_Yield = 143,
+    FIX44_Quote_YieldCalcDate = 144,
+    FIX44_Quote_YieldRedemptionDate = 145,
+    FIX44_Quote_YieldRedemptionPrice = 146,
+    FIX44_Quote_YieldRedemptionPriceType = 147,
+    FIX44_Quote_Text = 148,
+    FIX44_Quote_EncodedTextLen = 149,
+    FIX44_Quote_EncodedText = 150,
+    FIX44_Quote_SignatureLength = 151,
+    FIX44_Quote_Signature = 152,
+    FIX44_Quote_CheckSum = 153,
+};
+
+typedef struct _fix44Quote {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	QuoteRespID;
+    int64_t	QuoteType;
+    int64_t	NoQuoteQualifiers;
+    int64_t	QuoteResponseLevel;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    char	Side;
+    struct _ofixDecimal	OrderQty;
+    struct _ofixDecimal	CashOrderQty;
+    struct _ofixDecimal	OrderPercent;
+    char	RoundingDirection;
+    struct _ofixDecimal	RoundingModulus;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    struct _ofixStrView	SettlDate2;
+    struct _ofixDecimal	OrderQty2;
+    struct _ofixStrView	Currency;
+    int64_t	NoStipulations;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    int64_t	NoLegs;
+    struct _ofixDecimal	BidPx;
+    struct _ofixDecimal	OfferPx;
+    struct _ofixDecimal	MktBidPx;
+    struct _ofixDecimal	MktOfferPx;
+    struct _ofixDecimal	MinBidSize;
+    struct _ofixDecimal	BidSize;
+    struct _ofixDecimal	MinOfferSize;
+    struct _ofixDecimal	OfferSize;
+    struct _ofixDate	ValidUntilTime;
+    struct _ofixDecimal	BidSpotRate;
+    struct _ofixDecimal	OfferSpotRate;
+    struct _ofixDecimal	BidForwardPoints;
+    struct _ofixDecimal	OfferForwardPoints;
+    struct _ofixDecimal	MidPx;
+    struct _ofixDecimal	BidYield;
+    struct _ofixDecimal	MidYield;
+    struct _ofixDecimal	OfferYield;
+    struct _ofixDate	TransactTime;
+    char	OrdType;
+    struct _ofixDecimal	BidForwardPoints2;
+    struct _ofixDecimal	OfferForwardPoints2;
+    struct _ofixDecimal	SettlCurrBidFxRate;
+    struct _ofixDecimal	SettlCurrOfferFxRate;
+    char	SettlCurrFxRateCalc;
+    char	CommType;
+    struct _ofixDecimal	Commission;
+    int64_t	CustOrderCapacity;
+    struct _ofixStrView	ExDestination;
+    char	OrderCapacity;
+    int64_t	PriceType;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44Quote;
+
+extern void	fix44_decode_Quote(ofixErr err, fix44Quote m, const char *raw, int len);
+extern void	fix44_decode_Quote_msg(ofixErr err, fix44Quote m, ofixMsg msg);
+extern ofixMsg	fix44_encode_Quote(ofixErr err, fix44Quote m);
+
+// SettlementInstructions [T]
+enum {
+    FIX44_SettlementInstructions_BeginString = 0,
+    FIX44_SettlementInstructions_BodyLength = 1,
+    FIX44_SettlementInstructions_MsgType = 2,
+    FIX44_SettlementInstructions_SenderCompID = 3,
+    FIX44_SettlementInstructions_TargetCompID = 4,
+    FIX44_SettlementInstructions_OnBehalfOfCompID = 5,
+    FIX44_SettlementInstructions_DeliverToCompID = 6,
+    FIX44_SettlementInstructions_SecureDataLen = 7,
+    FIX44_SettlementInstructions_SecureData = 8,
+    FIX44_SettlementInstructions_MsgSeqNum = 9,
+    FIX44_SettlementInstructions_SenderSubID = 10,
+    FIX44_SettlementInstructions_SenderLocationID = 11,
+    FIX44_SettlementInstructions_TargetSubID = 12,
+    FIX44_SettlementInstructions_TargetLocationID = 13,
+    FIX44_SettlementInstructions_OnBehalfOfSubID = 14,
+    FIX44_SettlementInstructions_OnBehalfOfLocationID = 15,
+    FIX44_SettlementInstructions_DeliverToSubID = 16,
+    FIX44_SettlementInstructions_DeliverToLocationID = 17,
+    FIX44_SettlementInstructions_PossDupFlag = 18,
+    FIX44_SettlementInstructions_PossResend = 19,
+    FIX44_SettlementInstructions_SendingTime = 20,
+    FIX44_SettlementInstructions_OrigSendingTime = 21,
+    FIX44_SettlementInstructions_XmlDataLen = 22,
+    FIX44_SettlementInstructions_XmlData = 23,
+    FIX44_SettlementInstructions_MessageEncoding = 24,
+    FIX44_SettlementInstructions_LastMsgSeqNumProcessed = 25,
+    FIX44_SettlementInstructions_NoHops = 26,
+    FIX44_SettlementInstructions_SettlInstMsgID = 27,
+    FIX44_SettlementInstructions_SettlInstReqID = 28,
+    FIX44_SettlementInstructions_SettlInstMode = 29,
+    FIX44_SettlementInstructions_SettlInstReqRejCode = 30,
+    FIX44_SettlementInstructions_Text = 31,
+    FIX44_SettlementInstructions_EncodedTextLen = 32,
+    FIX44_SettlementInstructions_EncodedText = 33,
+    FIX44_SettlementInstructions_SettlInstSource = 34,
+    FIX44_SettlementInstructions_ClOrdID = 35,
+    FIX44_SettlementInstructions_TransactTime = 36,
+    FIX44_SettlementInstructions_NoSettlInst = 37,
+    FIX44_SettlementInstructions_SignatureLength = 38,
+    FIX44_SettlementInstructions_Signature = 39,
+    FIX44_SettlementInstructions_CheckSum = 40,
+};
+
+typedef struct _fix44SettlementInstructions {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SettlInstMsgID;
+    struct _ofixStrView	SettlInstReqID;
+    char	SettlInstMode;
+    int64_t	SettlInstReqRejCode;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    char	SettlInstSource;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixDate	TransactTime;
+    int64_t	NoSettlInst;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SettlementInstructions;
+
+extern void	fix44_decode_SettlementInstructions(ofixErr err, fix44SettlementInstructions m, const char *raw, int len);
+extern void	fix44_decode_SettlementInstructions_msg(ofixErr err, fix44SettlementInstructions m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SettlementInstructions(ofixErr err, fix44SettlementInstructions m);
+
+// MarketDataRequest [V]
+enum {
+    FIX44_MarketDataRequest_BeginString = 0,
+    FIX44_MarketDataRequest_BodyLength = 1,
+    FIX44_MarketDataRequest_MsgType = 2,
+    FIX44_MarketDataRequest_SenderCompID = 3,
+    FIX44_MarketDataRequest_TargetCompID = 4,
+    FIX44_MarketDataRequest_OnBehalfOfCompID = 5,
+    FIX44_MarketDataRequest_DeliverToCompID = 6,
+    FIX44_MarketDataRequest_SecureDataLen = 7,
+    FIX44_MarketDataRequest_SecureData = 8,
+    FIX44_MarketDataRequest_MsgSeqNum = 9,
+    FIX44_MarketDataRequest_SenderSubID = 10,
+    FIX44_MarketDataRequest_SenderLocationID = 11,
+    FIX44_MarketDataRequest_TargetSubID = 12,
+    FIX44_MarketDataRequest_TargetLocationID = 13,
+    FIX44_MarketDataRequest_OnBehalfOfSubID = 14,
+    FIX44_MarketDataRequest_OnBehalfOfLocationID = 15,
+    FIX44_MarketDataRequest_DeliverToSubID = 16,
+    FIX44_MarketDataRequest_DeliverToLocationID = 17,
+    FIX44_MarketDataRequest_PossDupFlag = 18,
+    FIX44_MarketDataRequest_PossResend = 19,
+    FIX44_MarketDataRequest_SendingTime = 20,
+    FIX44_MarketDataRequest_OrigSendingTime = 21,
+    FIX44_MarketDataRequest_XmlDataLen = 22,
+    FIX44_MarketDataRequest_XmlData = 23,
+    FIX44_MarketDataRequest_MessageEncoding = 24,
+    FIX44_MarketDataRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_MarketDataRequest_NoHops = 26,
+    FIX44_MarketDataRequest_MDReqID = 27,
+    FIX44_MarketDataRequest_SubscriptionRequestType = 28,
+    FIX44_MarketDataRequest_MarketDepth = 29,
+    FIX44_MarketDataRequest_MDUpdateType = 30,
+    FIX44_MarketDataRequest_AggregatedBook = 31,
+    FIX44_MarketDataRequest_OpenCloseSettlFlag = 32,
+    FIX44_MarketDataRequest_Scope = 33,
+    FIX44_MarketDataRequest_MDImplicitDelete = 34,
+    FIX44_MarketDataRequest_NoMDEntryTypes = 35,
+    FIX44_MarketDataRequest_NoRelatedSym = 36,
+    FIX44_MarketDataRequest_NoTradingSessions = 37,
+    FIX44_MarketDataRequest_ApplQueueAction = 38,
+    FIX44_MarketDataRequest_ApplQueueMax = 39,
+    FIX44_MarketDataRequest_SignatureLength = 40,
+    FIX44_MarketDataRequest_Signature = 41,
+    FIX44_MarketDataRequest_CheckSum = 42,
+};
+
+typedef struct _fix44MarketDataRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    char	SubscriptionRequestType;
+    int64_t	MarketDepth;
+    int64_t	MDUpdateType;
+    char	AggregatedBook;
+    struct _ofixStrView	OpenCloseSettlFlag;
+    struct _ofixStrView	Scope;
+    char	MDImplicitDelete;
+    int64_t	NoMDEntryTypes;
+    int64_t	NoRelatedSym;
+    int64_t	NoTradingSessions;
+    int64_t	ApplQueueAction;
+    int64_t	ApplQueueMax;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44MarketDataRequest;
+
+extern void	fix44_decode_MarketDataRequest(ofixErr err, fix44MarketDataRequest m, const char *raw, int len);
+extern void	fix44_decode_MarketDataRequest_msg(ofixErr err, fix44MarketDataRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_MarketDataRequest(ofixErr err, fix44MarketDataRequest m);
+
+// MarketDataSnapshotFullRefresh [W]
+enum {
+    FIX44_MarketDataSnapshotFullRefresh_BeginString = 0,
+    FIX44_MarketDataSnapshotFullRefresh_BodyLength = 1,
+    FIX44_MarketDataSnapshotFullRefresh_MsgType = 2,
+    FIX44_MarketDataSnapshotFullRefresh_SenderCompID = 3,
+    FIX44_MarketDataSnapshotFullRefresh_TargetCompID = 4,
+    FIX44_MarketDataSnapshotFullRefresh_OnBehalfOfCompID = 5,
+    FIX44_MarketDataSnapshotFullRefresh_DeliverToCompID = 6,
+    FIX44_MarketDataSnapshotFullRefresh_SecureDataLen = 7,
+    FIX44_MarketDataSnapshotFullRefresh_SecureData = 8,
+    FIX44_MarketDataSnapshotFullRefresh_MsgSeqNum = 9,
+    FIX44_MarketDataSnapshotFullRefresh_SenderSubID = 10,
+    FIX44_MarketDataSnapshotFullRefresh_SenderLocationID = 11,
+    FIX44_MarketDataSnapshotFullRefresh_TargetSubID = 12,
+    FIX44_MarketDataSnapshotFullRefresh_TargetLocationID = 13,
+    FIX44_MarketDataSnapshotFullRefresh_OnBehalfOfSubID = 14,
+    FIX44_MarketDataSnapshotFullRefresh_OnBehalfOfLocationID = 15,
+    FIX44_MarketDataSnapshotFullRefresh_DeliverToSubID = 16,
+    FIX44_MarketDataSnapshotFullRefresh_DeliverToLocationID = 17,
+    FIX44_MarketDataSnapshotFullRefresh_PossDupFlag = 18,
+    FIX44_MarketDataSnapshotFullRefresh_PossResend = 19,
+    FIX44_MarketDataSnapshotFullRefresh_SendingTime = 20,
+    FIX44_MarketDataSnapshotFullRefresh_OrigSendingTime = 21,
+    FIX44_MarketDataSnapshotFullRefresh_XmlDataLen = 22,
+    FIX44_MarketDataSnapshotFullRefresh_XmlData = 23,
+    FIX44_MarketDataSnapshotFullRefresh_MessageEncoding = 24,
+    FIX44_MarketDataSnapshotFullRefresh_LastMsgSeqNumProcessed = 25,
+    FIX44_MarketDataSnapshotFullRefresh_NoHops = 26,
+    FIX44_MarketDataSnapshotFullRefresh_MDReqID = 27,
+    FIX44_MarketDataSnapshotFullRefresh_Symbol = 28,
+    FIX44_MarketDataSnapshotFullRefresh_SymbolSfx = 29,
+    FIX44_MarketDataSnapshotFullRefresh_SecurityID = 30,
+    FIX44_MarketDataSnapshotFullRefresh_SecurityIDSource = 31,
+    FIX44_MarketDataSnapshotFullRefresh_NoSecurityAltID = 32,
+    FIX44_MarketDataSnapshotFullRefresh_Product = 33,
+    FIX44_MarketDataSnapshotFullRefresh_CFICode = 34,
+    FIX44_MarketDataSnapshotFullRefresh_SecurityType = 35,
+    FIX44_MarketDataSnapshotFullRefresh_SecuritySubType = 36,
+    FIX44_MarketDataSnapshotFullRefresh_MaturityMonthYear = 37,
+    FIX44_MarketDataSnapshotFullRefresh_MaturityDate = 38,
+    FIX44_MarketDataSnapshotFullRefresh_CouponPaymentDate = 39,
+    FIX44_MarketDataSnapshotFullRefresh_IssueDate = 40,
+    FIX44_MarketDataSnapshotFullRefresh_RepoCollateralSecurityType = 41,
+    FIX44_MarketDataSnapshotFullRefresh_RepurchaseTerm = 42,
+    FIX44_MarketDataSnapshotFullRefresh_RepurchaseRate = 43,
+    FIX44_MarketDataSnapshotFullRefresh_Factor = 44,
+    FIX44_MarketDataSnapshotFullRefresh_CreditRating = 45,
+    FIX44_MarketDataSnapshotFullRefresh_InstrRegistry = 46,
+    FIX44_MarketDataSnapshotFullRefresh_CountryOfIssue = 47,
+    FIX44_MarketDataSnapshotFullRefresh_StateOrProvinceOfIssue = 48,
+    FIX44_MarketDataSnapshotFullRefresh_LocaleOfIssue = 49,
+    FIX44_MarketDataSnapshotFullRefresh_RedemptionDate = 50,
+    FIX44_MarketDataSnapshotFullRefresh_StrikePrice = 51,
+    FIX44_MarketDataSnapshotFullRefresh_StrikeCurrency = 52,
+    FIX44_MarketDataSnapshotFullRefresh_OptAttribute = 53,
+    FIX44_MarketDataSnapshotFullRefresh_ContractMultiplier = 54,
+    FIX44_MarketDataSnapshotFullRefresh_CouponRate = 55,
+    FIX44_MarketDataSnapshotFullRefresh_SecurityExchange = 56,
+    FIX44_MarketDataSnapshotFullRefresh_Issuer = 57,
+    FIX44_MarketDataSnapshotFullRefresh_EncodedIssuerLen = 58,
+    FIX44_MarketDataSnapshotFullRefresh_EncodedIssuer = 59,
+    FIX44_MarketDataSnapshotFullRefresh_SecurityDesc = 60,
+    FIX44_MarketDataSnapshotFullRefresh_EncodedSecurityDescLen = 61,
+    FIX44_MarketDataSnapshotFullRefresh_EncodedSecurityDesc = 62,
+    FIX44_MarketDataSnapshotFullRefresh_Pool = 63,
+    FIX44_MarketDataSnapshotFullRefresh_ContractSettlMonth = 64,
+    FIX44_MarketDataSnapshotFullRefresh_CPProgram = 65,
+    FIX44_MarketDataSnapshotFullRefresh_CPRegType = 66,
+    FIX44_MarketDataSnapshotFullRefresh_NoEvents = 67,
+    FIX44_MarketDataSnapshotFullRefresh_DatedDate = 68,
+    FIX44_MarketDataSnapshotFullRefresh_InterestAccrualDate = 69,
+    FIX44_MarketDataSnapshotFullRefresh_NoUnderlyings = 70,
+    FIX44_MarketDataSnapshotFullRefresh_NoLegs = 71,
+    FIX44_MarketDataSnapshotFullRefresh_FinancialStatus = 72,
+    FIX44_MarketDataSnapshotFullRefresh_CorporateAction = 73,
+    FIX44_MarketDataSnapshotFullRefresh_NetChgPrevDay = 74,
+    FIX44_MarketDataSnapshotFullRefresh_NoMDEntries = 75,
+    FIX44_MarketDataSnapshotFullRefresh_ApplQueueDepth = 76,
+    FIX44_MarketDataSnapshotFullRefresh_ApplQueueResolution = 77,
+    FIX44_MarketDataSnapshotFullRefresh_SignatureLength = 78,
+    FIX44_MarketDataSnapshotFullRefresh_Signature = 79,
+    FIX44_MarketDataSnapshotFullRefresh_CheckSum = 80,
+};
+
+typedef struct _fix44MarketDataSnapshotFullRefresh {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixStrView	FinancialStatus;
+    struct _ofixStrView	CorporateAction;
+    struct _ofixDecimal	NetChgPrevDay;
+    int64_t	NoMDEntries;
+    int64_t	ApplQueueDepth;
+    int64_t	ApplQueueResolution;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44MarketDataSnapshotFullRefresh;
+
+extern void	fix44_decode_MarketDataSnapshotFullRefresh(ofixErr err, fix44MarketDataSnapshotFullRefresh m, const char *raw, int len);
+extern void	fix44_decode_MarketDataSnapshotFullRefresh_msg(ofixErr err, fix44MarketDataSnapshotFullRefresh m, ofixMsg msg);
+extern ofixMsg	fix44_encode_MarketDataSnapshotFullRefresh(ofixErr err, fix44MarketDataSnapshotFullRefresh m);
+
+// MarketDataIncrementalRefresh [X]
+enum {
+    FIX44_MarketDataIncrementalRefresh_BeginString = 0,
+    FIX44_MarketDataIncrementalRefresh_BodyLength = 1,
+    FIX44_MarketDataIncrementalRefresh_MsgType = 2,
+    FIX44_MarketDataIncrementalRefresh_SenderCompID = 3,
+    FIX44_MarketDataIncrementalRefresh_TargetCompID = 4,
+    FIX44_MarketDataIncrementalRefresh_OnBehalfOfCompID = 5,
+    FIX44_MarketDataIncrementalRefresh_DeliverToCompID = 6,
+    FIX44_MarketDataIncrementalRefresh_SecureDataLen = 7,
+    FIX44_MarketDataIncrementalRefresh_SecureData = 8,
+    FIX44_MarketDataIncrementalRefresh_MsgSeqNum = 9,
+    FIX44_MarketDataIncrementalRefresh_SenderSubID = 10,
+    FIX44_MarketDataIncrementalRefresh_SenderLocationID = 11,
+    FIX44_MarketDataIncrementalRefresh_TargetSubID = 12,
+    FIX44_MarketDataIncrementalRefresh_TargetLocationID = 13,
+    FIX44_MarketDataIncrementalRefresh_OnBehalfOfSubID = 14,
+    FIX44_MarketDataIncrementalRefresh_OnBehalfOfLocationID = 15,
+    FIX44_MarketDataIncrementalRefresh_DeliverToSubID = 16,
+    FIX44_MarketDataIncrementalRefresh_DeliverToLocationID = 17,
+    FIX44_MarketDataIncrementalRefresh_PossDupFlag = 18,
+    FIX44_MarketDataIncrementalRefresh_PossResend = 19,
+    FIX44_MarketDataIncrementalRefresh_SendingTime = 20,
+    FIX44_MarketDataIncrementalRefresh_OrigSendingTime = 21,
+    FIX44_MarketDataIncrementalRefresh_XmlDataLen = 22,
+    FIX44_MarketDataIncrementalRefresh_XmlData = 23,
+    FIX44_MarketDataIncrementalRefresh_MessageEncoding = 24,
+    FIX44_MarketDataIncrementalRefresh_LastMsgSeqNumProcessed = 25,
+    FIX44_MarketDataIncrementalRefresh_NoHops = 26,
+    FIX44_MarketDataIncrementalRefresh_MDReqID = 27,
+    FIX44_MarketDataIncrementalRefresh_NoMDEntries = 28,
+    FIX44_MarketDataIncrementalRefresh_ApplQueueDepth = 29,
+    FIX44_MarketDataIncrementalRefresh_ApplQueueResolution = 30,
+    FIX44_MarketDataIncrementalRefresh_SignatureLength = 31,
+    FIX44_MarketDataIncrementalRefresh_Signature = 32,
+    FIX44_MarketDataIncrementalRefresh_CheckSum = 33,
+};
+
+typedef struct _fix44MarketDataIncrementalRefresh {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    int64_t	NoMDEntries;
+    int64_t	ApplQueueDepth;
+    int64_t	ApplQueueResolution;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44MarketDataIncrementalRefresh;
+
+extern void	fix44_decode_MarketDataIncrementalRefresh(ofixErr err, fix44MarketDataIncrementalRefresh m, const char *raw, int len);
+extern void	fix44_decode_MarketDataIncrementalRefresh_msg(ofixErr err, fix44MarketDataIncrementalRefresh m, ofixMsg msg);
+extern ofixMsg	fix44_encode_MarketDataIncrementalRefresh(ofixErr err, fix44MarketDataIncrementalRefresh m);
+
+// MarketDataRequestReject [Y]
+enum {
+    FIX44_MarketDataRequestReject_BeginString = 0,
+    FIX44_MarketDataRequestReject_BodyLength = 1,
+    FIX44_MarketDataRequestReject_MsgType = 2,
+    FIX44_MarketDataRequestReject_SenderCompID = 3,
+    FIX44_MarketDataRequestReject_TargetCompID = 4,
+    FIX44_MarketDataRequestReject_OnBehalfOfCompID = 5,
+    FIX44_MarketDataRequestReject_DeliverToCompID = 6,
+    FIX44_MarketDataRequestReject_SecureDataLen = 7,
+    FIX44_MarketDataRequestReject_SecureData = 8,
+    FIX44_MarketDataRequestReject_MsgSeqNum = 9,
+    FIX44_MarketDataRequestReject_SenderSubID = 10,
+    FIX44_MarketDataRequestReject_SenderLocationID = 11,
+    FIX44_MarketDataRequestReject_TargetSubID = 12,
+    FIX44_MarketDataRequestReject_TargetLocationID = 13,
+    FIX44_MarketDataRequestReject_OnBehalfOfSubID = 14,
+    FIX44_MarketDataRequestReject_OnBehalfOfLocationID = 15,
+    FIX44_MarketDataRequestReject_DeliverToSubID = 16,
+    FIX44_MarketDataRequestReject_DeliverToLocationID = 17,
+    FIX44_MarketDataRequestReject_PossDupFlag = 18,
+    FIX44_MarketDataRequestReject_PossResend = 19,
+    FIX44_MarketDataRequestReject_SendingTime = 20,
+    FIX44_MarketDataRequestReject_OrigSendingTime = 21,
+    FIX44_MarketDataRequestReject_XmlDataLen = 22,
+    FIX44_MarketDataRequestReject_XmlData = 23,
+    FIX44_MarketDataRequestReject_MessageEncoding = 24,
+    FIX44_MarketDataRequestReject_LastMsgSeqNumProcessed = 25,
+    FIX44_MarketDataRequestReject_NoHops = 26,
+    FIX44_MarketDataRequestReject_MDReqID = 27,
+    FIX44_MarketDataRequestReject_MDReqRejReason = 28,
+    FIX44_MarketDataRequestReject_NoAltMDSource = 29,
+    FIX44_MarketDataRequestReject_Text = 30,
+    FIX44_MarketDataRequestReject_EncodedTextLen = 31,
+    FIX44_MarketDataRequestReject_EncodedText = 32,
+    FIX44_MarketDataRequestReject_SignatureLength = 33,
+    FIX44_MarketDataRequestReject_Signature = 34,
+    FIX44_MarketDataRequestReject_CheckSum = 35,
+};
+
+typedef struct _fix44MarketDataRequestReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	MDReqID;
+    char	MDReqRejReason;
+    int64_t	NoAltMDSource;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44MarketDataRequestReject;
+
+extern void	fix44_decode_MarketDataRequestReject(ofixErr err, fix44MarketDataRequestReject m, const char *raw, int len);
+extern void	fix44_decode_MarketDataRequestReject_msg(ofixErr err, fix44MarketDataRequestReject m, ofixMsg msg);
+extern ofixMsg	fix44_encode_MarketDataRequestReject(ofixErr err, fix44MarketDataRequestReject m);
+
+// QuoteCancel [Z]
+enum {
+    FIX44_QuoteCancel_BeginString = 0,
+    FIX44_QuoteCancel_BodyLength = 1,
+    FIX44_QuoteCancel_MsgType = 2,
+    FIX44_QuoteCancel_SenderCompID = 3,
+    FIX44_QuoteCancel_TargetCompID = 4,
+    FIX44_QuoteCancel_OnBehalfOfCompID = 5,
+    FIX44_QuoteCancel_DeliverToCompID = 6,
+    FIX44_QuoteCancel_SecureDataLen = 7,
+    FIX44_QuoteCancel_SecureData = 8,
+    FIX44_QuoteCancel_MsgSeqNum = 9,
+    FIX44_QuoteCancel_SenderSubID = 10,
+    FIX44_QuoteCancel_SenderLocationID = 11,
+    FIX44_QuoteCancel_TargetSubID = 12,
+    FIX44_QuoteCancel_TargetLocationID = 13,
+    FIX44_QuoteCancel_OnBehalfOfSubID = 14,
+    FIX44_QuoteCancel_OnBehalfOfLocationID = 15,
+    FIX44_QuoteCancel_DeliverToSubID = 16,
+    FIX44_QuoteCancel_DeliverToLocationID = 17,
+    FIX44_QuoteCancel_PossDupFlag = 18,
+    FIX44_QuoteCancel_PossResend = 19,
+    FIX44_QuoteCancel_SendingTime = 20,
+    FIX44_QuoteCancel_OrigSendingTime = 21,
+    FIX44_QuoteCancel_XmlDataLen = 22,
+    FIX44_QuoteCancel_XmlData = 23,
+    FIX44_QuoteCancel_MessageEncoding = 24,
+    FIX44_QuoteCancel_LastMsgSeqNumProcessed = 25,
+    FIX44_QuoteCancel_NoHops = 26,
+    FIX44_QuoteCancel_QuoteReqID = 27,
+    FIX44_QuoteCancel_QuoteID = 28,
+    FIX44_QuoteCancel_QuoteCancelType = 29,
+    FIX44_QuoteCancel_QuoteResponseLevel = 30,
+    FIX44_QuoteCancel_NoPartyIDs = 31,
+    FIX44_QuoteCancel_Account = 32,
+    FIX44_QuoteCancel_AcctIDSource = 33,
+    FIX44_QuoteCancel_AccountType = 34,
+    FIX44_QuoteCancel_TradingSessionID = 35,
+    FIX44_QuoteCancel_TradingSessionSubID = 36,
+    FIX44_QuoteCancel_NoQuoteEntries = 37,
+    FIX44_QuoteCancel_SignatureLength = 38,
+    FIX44_QuoteCancel_Signature = 39,
+    FIX44_QuoteCancel_CheckSum = 40,
+};
+
+typedef struct _fix44QuoteCancel {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteCancelType;
+    int64_t	QuoteResponseLevel;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	NoQuoteEntries;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44QuoteCancel;
+
+extern void	fix44_decode_QuoteCancel(ofixErr err, fix44QuoteCancel m, const char *raw, int len);
+extern void	fix44_decode_QuoteCancel_msg(ofixErr err, fix44QuoteCancel m, ofixMsg msg);
+extern ofixMsg	fix44_encode_QuoteCancel(ofixErr err, fix44QuoteCancel m);
+
+// QuoteStatusRequest [a]
+enum {
+    FIX44_QuoteStatusRequest_BeginString = 0,
+    FIX44_QuoteStatusRequest_BodyLength = 1,
+    FIX44_QuoteStatusRequest_MsgType = 2,
+    FIX44_QuoteStatusRequest_SenderCompID = 3,
+    FIX44_QuoteStatusRequest_TargetCompID = 4,
+    FIX44_QuoteStatusRequest_OnBehalfOfCompID = 5,
+    FIX44_QuoteStatusRequest_DeliverToCompID = 6,
+    FIX44_QuoteStatusRequest_SecureDataLen = 7,
+    FIX44_QuoteStatusRequest_SecureData = 8,
+    FIX44_QuoteStatusRequest_MsgSeqNum = 9,
+    FIX44_QuoteStatusRequest_SenderSubID = 10,
+    FIX44_QuoteStatusRequest_SenderLocationID = 11,
+    FIX44_QuoteStatusRequest_TargetSubID = 12,
+    FIX44_QuoteStatusRequest_TargetLocationID = 13,
+    FIX44_QuoteStatusRequest_OnBehalfOfSubID = 14,
+    FIX44_QuoteStatusRequest_OnBehalfOfLocationID = 15,
+    FIX44_QuoteStatusRequest_DeliverToSubID = 16,
+    FIX44_QuoteStatusRequest_DeliverToLocationID = 17,
+    FIX44_QuoteStatusRequest_PossDupFlag = 18,
+    FIX44_QuoteStatusRequest_PossResend = 19,
+    FIX44_QuoteStatusRequest_SendingTime = 20,
+    FIX44_QuoteStatusRequest_OrigSendingTime = 21,
+    FIX44_QuoteStatusRequest_XmlDataLen = 22,
+    FIX44_QuoteStatusRequest_XmlData = 23,
+    FIX44_QuoteStatusRequest_MessageEncoding = 24,
+    FIX44_QuoteStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_QuoteStatusRequest_NoHops = 26,
+    FIX44_QuoteStatusRequest_QuoteStatusReqID = 27,
+    FIX44_QuoteStatusRequest_QuoteID = 28,
+    FIX44_QuoteStatusRequest_Symbol = 29,
+    FIX44_QuoteStatusRequest_SymbolSfx = 30,
+    FIX44_QuoteStatusRequest_SecurityID = 31,
+    FIX44_QuoteStatusRequest_SecurityIDSource = 32,
+    FIX44_QuoteStatusRequest_NoSecurityAltID = 33,
+    FIX44_QuoteStatusRequest_Product = 34,
+    FIX44_QuoteStatusRequest_CFICode = 35,
+    FIX44_QuoteStatusRequest_SecurityType = 36,
+    FIX44_QuoteStatusRequest_SecuritySubType = 37,
+    FIX44_QuoteStatusRequest_MaturityMonthYear = 38,
+    FIX44_QuoteStatusRequest_MaturityDate = 39,
+    FIX44_QuoteStatusRequest_CouponPaymentDate = 40,
+    FIX44_QuoteStatusRequest_IssueDate = 41,
+    FIX44_QuoteStatusRequest_RepoCollateralSecurityType = 42,
+    FIX44_QuoteStatusRequest_RepurchaseTerm = 43,
+    FIX44_QuoteStatusRequest_RepurchaseRate = 44,
+    FIX44_QuoteStatusRequest_Factor = 45,
+    FIX44_QuoteStatusRequest_CreditRating = 46,
+    FIX44_QuoteStatusRequest_InstrRegistry = 47,
+    FIX44_QuoteStatusRequest_CountryOfIssue = 48,
+    FIX44_QuoteStatusRequest_StateOrProvinceOfIssue = 49,
+    FIX44_QuoteStatusRequest_LocaleOfIssue = 50,
+    FIX44_QuoteStatusRequest_RedemptionDate = 51,
+    FIX44_QuoteStatusRequest_StrikePrice = 52,
+    FIX44_QuoteStatusRequest_StrikeCurrency = 53,
+    FIX44_QuoteStatusRequest_OptAttribute = 54,
+    FIX44_QuoteStatusRequest_ContractMultiplier = 55,
+    FIX44_QuoteStatusRequest_CouponRate = 56,
+    FIX44_QuoteStatusRequest_SecurityExchange = 57,
+    FIX44_QuoteStatusRequest_Issuer = 58,
+    FIX44_QuoteStatusRequest_EncodedIssuerLen = 59,
+    FIX44_QuoteStatusRequest_EncodedIssuer = 60,
+    FIX44_QuoteStatusRequest_SecurityDesc = 61,
+    FIX44_QuoteStatusRequest_EncodedSecurityDescLen = 62,
+    FIX44_QuoteStatusRequest_EncodedSecurityDesc = 63,
+    FIX44_QuoteStatusRequest_Pool = 64,
+    FIX44_QuoteStatusRequest_ContractSettlMonth = 65,
+    FIX44_QuoteStatusRequest_CPProgram = 66,
+    FIX44_QuoteStatusRequest_CPRegType = 67,
+    FIX44_QuoteStatusRequest_NoEvents = 68,
+    FIX44_QuoteStatusRequest_DatedDate = 69,
+    FIX44_QuoteStatusRequest_InterestAccrualDate = 70,
+    FIX44_QuoteStatusRequest_AgreementDesc = 71,
+    FIX44_QuoteStatusRequest_AgreementID = 72,
+    FIX44_QuoteStatusRequest_AgreementDate = 73,
+    FIX44_QuoteStatusRequest_AgreementCurrency = 74,
+    FIX44_QuoteStatusRequest_TerminationType = 75,
+    FIX44_QuoteStatusRequest_StartDate = 76,
+    FIX44_QuoteStatusRequest_EndDate = 77,
+    FIX44_QuoteStatusRequest_DeliveryType = 78,
+    FIX44_QuoteStatusRequest_MarginRatio = 79,
+    FIX44_QuoteStatusRequest_NoUnderlyings = 80,
+    FIX44_QuoteStatusRequest_NoLegs = 81,
+    FIX44_QuoteStatusRequest_NoPartyIDs = 82,
+    FIX44_QuoteStatusRequest_Account = 83,
+    FIX44_QuoteStatusRequest_AcctIDSource = 84,
+    FIX44_QuoteStatusRequest_AccountType = 85,
+    FIX44_QuoteStatusRequest_TradingSessionID = 86,
+    FIX44_QuoteStatusRequest_TradingSessionSubID = 87,
+    FIX44_QuoteStatusRequest_SubscriptionRequestType = 88,
+    FIX44_QuoteStatusRequest_SignatureLength = 89,
+    FIX44_QuoteStatusRequest_Signature = 90,
+    FIX44_QuoteStatusRequest_CheckSum = 91,
+};
+
+typedef struct _fix44QuoteStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteStatusReqID;
+    struct _ofixStrView	QuoteID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44QuoteStatusRequest;
+
+extern void	fix44_decode_QuoteStatusRequest(ofixErr err, fix44QuoteStatusRequest m, const char *raw, int len);
+extern void	fix44_decode_QuoteStatusRequest_msg(ofixErr err, fix44QuoteStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_QuoteStatusRequest(ofixErr err, fix44QuoteStatusRequest m);
+
+// MassQuoteAcknowledgement [b]
+enum {
+    FIX44_MassQuoteAcknowledgement_BeginString = 0,
+    FIX44_MassQuoteAcknowledgement_BodyLength = 1,
+    FIX44_MassQuoteAcknowledgement_MsgType = 2,
+    FIX44_MassQuoteAcknowledgement_SenderCompID = 3,
+    FIX44_MassQuoteAcknowledgement_TargetCompID = 4,
+    FIX44_MassQuoteAcknowledgement_OnBehalfOfCompID = 5,
+    FIX44_MassQuoteAcknowledgement_DeliverToCompID = 6,
+    FIX44_MassQuoteAcknowledgement_SecureDataLen = 7,
+    FIX44_MassQuoteAcknowledgement_SecureData = 8,
+    FIX44_MassQuoteAcknowledgement_MsgSeqNum = 9,
+    FIX44_MassQuoteAcknowledgement_SenderSubID = 10,
+    FIX44_MassQuoteAcknowledgement_SenderLocationID = 11,
+    FIX44_MassQuoteAcknowledgement_TargetSubID = 12,
+    FIX44_MassQuoteAcknowledgement_TargetLocationID = 13,
+    FIX44_MassQuoteAcknowledgement_OnBehalfOfSubID = 14,
+    FIX44_MassQuoteAcknowledgement_OnBehalfOfLocationID = 15,
+    FIX44_MassQuoteAcknowledgement_DeliverToSubID = 16,
+    FIX44_MassQuoteAcknowledgement_DeliverToLocationID = 17,
+    FIX44_MassQuoteAcknowledgement_PossDupFlag = 18,
+    FIX44_MassQuoteAcknowledgement_PossResend = 19,
+    FIX44_MassQuoteAcknowledgement_SendingTime = 20,
+    FIX44_MassQuoteAcknowledgement_OrigSendingTime = 21,
+    FIX44_MassQuoteAcknowledgement_XmlDataLen = 22,
+    FIX44_MassQuoteAcknowledgement_XmlData = 23,
+    FIX44_MassQuoteAcknowledgement_MessageEncoding = 24,
+    FIX44_MassQuoteAcknowledgement_LastMsgSeqNumProcessed = 25,
+    FIX44_MassQuoteAcknowledgement_NoHops = 26,
+    FIX44_MassQuoteAcknowledgement_QuoteReqID = 27,
+    FIX44_MassQuoteAcknowledgement_QuoteID = 28,
+    FIX44_MassQuoteAcknowledgement_QuoteStatus = 29,
+    FIX44_MassQuoteAcknowledgement_QuoteRejectReason = 30,
+    FIX44_MassQuoteAcknowledgement_QuoteResponseLevel = 31,
+    FIX44_MassQuoteAcknowledgement_QuoteType = 32,
+    FIX44_MassQuoteAcknowledgement_NoPartyIDs = 33,
+    FIX44_MassQuoteAcknowledgement_Account = 34,
+    FIX44_MassQuoteAcknowledgement_AcctIDSource = 35,
+    FIX44_MassQuoteAcknowledgement_AccountType = 36,
+    FIX44_MassQuoteAcknowledgement_Text = 37,
+    FIX44_MassQuoteAcknowledgement_EncodedTextLen = 38,
+    FIX44_MassQuoteAcknowledgement_EncodedText = 39,
+    FIX44_MassQuoteAcknowledgement_NoQuoteSets = 40,
+    FIX44_MassQuoteAcknowledgement_SignatureLength = 41,
+    FIX44_MassQuoteAcknowledgement_Signature = 42,
+    FIX44_MassQuoteAcknowledgement_CheckSum = 43,
+};
+
+typedef struct _fix44MassQuoteAcknowledgement {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteStatus;
+    int64_t	QuoteRejectReason;
+    int64_t	QuoteResponseLevel;
+    int64_t	QuoteType;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NoQuoteSets;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44MassQuoteAcknowledgement;
+
+extern void	fix44_decode_MassQuoteAcknowledgement(ofixErr err, fix44MassQuoteAcknowledgement m, const char *raw, int len);
+extern void	fix44_decode_MassQuoteAcknowledgement_msg(ofixErr err, fix44MassQuoteAcknowledgement m, ofixMsg msg);
+extern ofixMsg	fix44_encode_MassQuoteAcknowledgement(ofixErr err, fix44MassQuoteAcknowledgement m);
+
+// SecurityDefinitionRequest [c]
+enum {
+    FIX44_SecurityDefinitionRequest_BeginString = 0,
+    FIX44_SecurityDefinitionRequest_BodyLength = 1,
+    FIX44_SecurityDefinitionRequest_MsgType = 2,
+    FIX44_SecurityDefinitionRequest_SenderCompID = 3,
+    FIX44_SecurityDefinitionRequest_TargetCompID = 4,
+    FIX44_SecurityDefinitionRequest_OnBehalfOfCompID = 5,
+    FIX44_SecurityDefinitionRequest_DeliverToCompID = 6,
+    FIX44_SecurityDefinitionRequest_SecureDataLen = 7,
+    FIX44_SecurityDefinitionRequest_SecureData = 8,
+    FIX44_SecurityDefinitionRequest_MsgSeqNum = 9,
+    FIX44_SecurityDefinitionRequest_SenderSubID = 10,
+    FIX44_SecurityDefinitionRequest_SenderLocationID = 11,
+    FIX44_SecurityDefinitionRequest_TargetSubID = 12,
+    FIX44_SecurityDefinitionRequest_TargetLocationID = 13,
+    FIX44_SecurityDefinitionRequest_OnBehalfOfSubID = 14,
+    FIX44_SecurityDefinitionRequest_OnBehalfOfLocationID = 15,
+    FIX44_SecurityDefinitionRequest_DeliverToSubID = 16,
+    FIX44_SecurityDefinitionRequest_DeliverToLocationID = 17,
+    FIX44_SecurityDefinitionRequest_PossDupFlag = 18,
+    FIX44_SecurityDefinitionRequest_PossResend = 19,
+    FIX44_SecurityDefinitionRequest_SendingTime = 20,
+    FIX44_SecurityDefinitionRequest_OrigSendingTime = 21,
+    FIX44_SecurityDefinitionRequest_XmlDataLen = 22,
+    FIX44_SecurityDefinitionRequest_XmlData = 23,
+    FIX44_SecurityDefinitionRequest_MessageEncoding = 24,
+    FIX44_SecurityDefinitionRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityDefinitionRequest_NoHops = 26,
+    FIX44_SecurityDefinitionRequest_SecurityReqID = 27,
+    FIX44_SecurityDefinitionRequest_SecurityRequestType = 28,
+    FIX44_SecurityDefinitionRequest_Symbol = 29,
+    FIX44_SecurityDefinitionRequest_SymbolSfx = 30,
+    FIX44_SecurityDefinitionRequest_SecurityID = 31,
+    FIX44_SecurityDefinitionRequest_SecurityIDSource = 32,
+    FIX44_SecurityDefinitionRequest_NoSecurityAltID = 33,
+    FIX44_SecurityDefinitionRequest_Product = 34,
+    FIX44_SecurityDefinitionRequest_CFICode = 35,
+    FIX44_SecurityDefinitionRequest_SecurityType = 36,
+    FIX44_SecurityDefinitionRequest_SecuritySubType = 37,
+    FIX44_SecurityDefinitionRequest_MaturityMonthYear = 38,
+    FIX44_SecurityDefinitionRequest_MaturityDate = 39,
+    FIX44_SecurityDefinitionRequest_CouponPaymentDate = 40,
+    FIX44_SecurityDefinitionRequest_IssueDate = 41,
+    FIX44_SecurityDefinitionRequest_RepoCollateralSecurityType = 42,
+    FIX44_SecurityDefinitionRequest_RepurchaseTerm = 43,
+    FIX44_SecurityDefinitionRequest_RepurchaseRate = 44,
+    FIX44_SecurityDefinitionRequest_Factor = 45,
+    FIX44_SecurityDefinitionRequest_CreditRating = 46,
+    FIX44_SecurityDefinitionRequest_InstrRegistry = 47,
+    FIX44_SecurityDefinitionRequest_CountryOfIssue = 48,
+    FIX44_SecurityDefinitionRequest_StateOrProvinceOfIssue = 49,
+    FIX44_SecurityDefinitionRequest_LocaleOfIssue = 50,
+    FIX44_SecurityDefinitionRequest_RedemptionDate = 51,
+    FIX44_SecurityDefinitionRequest_StrikePrice = 52,
+    FIX44_SecurityDefinitionRequest_StrikeCurrency = 53,
+    FIX44_SecurityDefinitionRequest_OptAttribute = 54,
+    FIX44_SecurityDefinitionRequest_ContractMultiplier = 55,
+    FIX44_SecurityDefinitionRequest_CouponRate = 56,
+    FIX44_SecurityDefinitionRequest_SecurityExchange = 57,
+    FIX44_SecurityDefinitionRequest_Issuer = 58,
+    FIX44_SecurityDefinitionRequest_EncodedIssuerLen = 59,
+    FIX44_SecurityDefinitionRequest_EncodedIssuer = 60,
+    FIX44_SecurityDefinitionRequest_SecurityDesc = 61,
+    FIX44_SecurityDefinitionRequest_EncodedSecurityDescLen = 62,
+    FIX44_SecurityDefinitionRequest_EncodedSecurityDesc = 63,
+    FIX44_SecurityDefinitionRequest_Pool = 64,
+    FIX44_SecurityDefinitionRequest_ContractSettlMonth = 65,
+    FIX44_SecurityDefinitionRequest_CPProgram = 66,
+    FIX44_SecurityDefinitionRequest_CPRegType = 67,
+    FIX44_SecurityDefinitionRequest_NoEvents = 68,
+    FIX44_SecurityDefinitionRequest_DatedDate = 69,
+    FIX44_SecurityDefinitionRequest_InterestAccrualDate = 70,
+    FIX44_SecurityDefinitionRequest_DeliveryForm = 71,
+    FIX44_SecurityDefinitionRequest_PctAtRisk = 72,
+    FIX44_SecurityDefinitionRequest_NoInstrAttrib = 73,
+    FIX44_SecurityDefinitionRequest_NoUnderlyings = 74,
+    FIX44_SecurityDefinitionRequest_Currency = 75,
+    FIX44_SecurityDefinitionRequest_Text = 76,
+    FIX44_SecurityDefinitionRequest_EncodedTextLen = 77,
+    FIX44_SecurityDefinitionRequest_EncodedText = 78,
+    FIX44_SecurityDefinitionRequest_TradingSessionID = 79,
+    FIX44_SecurityDefinitionRequest_TradingSessionSubID = 80,
+    FIX44_SecurityDefinitionRequest_NoLegs = 81,
+    FIX44_SecurityDefinitionRequest_ExpirationCycle = 82,
+    FIX44_SecurityDefinitionRequest_SubscriptionRequestType = 83,
+    FIX44_SecurityDefinitionRequest_SignatureLength = 84,
+    FIX44_SecurityDefinitionRequest_Signature = 85,
+    FIX44_SecurityDefinitionRequest_CheckSum = 86,
+};
+
+typedef struct _fix44SecurityDefinitionRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    int64_t	SecurityRequestType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    int64_t	NoUnderlyings;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	NoLegs;
+    int64_t	ExpirationCycle;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityDefinitionRequest;
+
+extern void	fix44_decode_SecurityDefinitionRequest(ofixErr err, fix44SecurityDefinitionRequest m, const char *raw, int len);
+extern void	fix44_decode_SecurityDefinitionRequest_msg(ofixErr err, fix44SecurityDefinitionRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityDefinitionRequest(ofixErr err, fix44SecurityDefinitionRequest m);
+
+// SecurityDefinition [d]
+enum {
+    FIX44_SecurityDefinition_BeginString = 0,
+    FIX44_SecurityDefinition_BodyLength = 1,
+    FIX44_SecurityDefinition_MsgType = 2,
+    FIX44_SecurityDefinition_SenderCompID = 3,
+    FIX44_SecurityDefinition_TargetCompID = 4,
+    FIX44_SecurityDefinition_OnBehalfOfCompID = 5,
+    FIX44_SecurityDefinition_DeliverToCompID = 6,
+    FIX44_SecurityDefinition_SecureDataLen = 7,
+    FIX44_SecurityDefinition_SecureData = 8,
+    FIX44_SecurityDefinition_MsgSeqNum = 9,
+    FIX44_SecurityDefinition_SenderSubID = 10,
+    FIX44_SecurityDefinition_SenderLocationID = 11,
+    FIX44_SecurityDefinition_TargetSubID = 12,
+    FIX44_SecurityDefinition_TargetLocationID = 13,
+    FIX44_SecurityDefinition_OnBehalfOfSubID = 14,
+    FIX44_SecurityDefinition_OnBehalfOfLocationID = 15,
+    FIX44_SecurityDefinition_DeliverToSubID = 16,
+    FIX44_SecurityDefinition_DeliverToLocationID = 17,
+    FIX44_SecurityDefinition_PossDupFlag = 18,
+    FIX44_SecurityDefinition_PossResend = 19,
+    FIX44_SecurityDefinition_SendingTime = 20,
+    FIX44_SecurityDefinition_OrigSendingTime = 21,
+    FIX44_SecurityDefinition_XmlDataLen = 22,
+    FIX44_SecurityDefinition_XmlData = 23,
+    FIX44_SecurityDefinition_MessageEncoding = 24,
+    FIX44_SecurityDefinition_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityDefinition_NoHops = 26,
+    FIX44_SecurityDefinition_SecurityReqID = 27,
+    FIX44_SecurityDefinition_SecurityResponseID = 28,
+    FIX44_SecurityDefinition_SecurityResponseType = 29,
+    FIX44_SecurityDefinition_Symbol = 30,
+    FIX44_SecurityDefinition_SymbolSfx = 31,
+    FIX44_SecurityDefinition_SecurityID = 32,
+    FIX44_SecurityDefinition_SecurityIDSource = 33,
+    FIX44_SecurityDefinition_NoSecurityAltID = 34,
+    FIX44_SecurityDefinition_Product = 35,
+    FIX44_SecurityDefinition_CFICode = 36,
+    FIX44_SecurityDefinition_SecurityType = 37,
+    FIX44_SecurityDefinition_SecuritySubType = 38,
+    FIX44_SecurityDefinition_MaturityMonthYear = 39,
+    FIX44_SecurityDefinition_MaturityDate = 40,
+    FIX44_SecurityDefinition_CouponPaymentDate = 41,
+    FIX44_SecurityDefinition_IssueDate = 42,
+    FIX44_SecurityDefinition_RepoCollateralSecurityType = 43,
+    FIX44_SecurityDefinition_RepurchaseTerm = 44,
+    FIX44_SecurityDefinition_RepurchaseRate = 45,
+    FIX44_SecurityDefinition_Factor = 46,
+    FIX44_SecurityDefinition_CreditRating = 47,
+    FIX44_SecurityDefinition_InstrRegistry = 48,
+    FIX44_SecurityDefinition_CountryOfIssue = 49,
+    FIX44_SecurityDefinition_StateOrProvinceOfIssue = 50,
+    FIX44_SecurityDefinition_LocaleOfIssue = 51,
+    FIX44_SecurityDefinition_RedemptionDate = 52,
+    FIX44_SecurityDefinition_StrikePrice = 53,
+    FIX44_SecurityDefinition_StrikeCurrency = 54,
+    FIX44_SecurityDefinition_OptAttribute = 55,
+    FIX44_SecurityDefinition_ContractMultiplier = 56,
+    FIX44_SecurityDefinition_CouponRate = 57,
+    FIX44_SecurityDefinition_SecurityExchange = 58,
+    FIX44_SecurityDefinition_Issuer = 59,
+    FIX44_SecurityDefinition_EncodedIssuerLen = 60,
+    FIX44_SecurityDefinition_EncodedIssuer = 61,
+    FIX44_SecurityDefinition_SecurityDesc = 62,
+    FIX44_SecurityDefinition_EncodedSecurityDescLen = 63,
+    FIX44_SecurityDefinition_EncodedSecurityDesc = 64,
+    FIX44_SecurityDefinition_Pool = 65,
+    FIX44_SecurityDefinition_ContractSettlMonth = 66,
+    FIX44_SecurityDefinition_CPProgram = 67,
+    FIX44_SecurityDefinition_CPRegType = 68,
+    FIX44_SecurityDefinition_NoEvents = 69,
+    FIX44_SecurityDefinition_DatedDate = 70,
+    FIX44_SecurityDefinition_InterestAccrualDate = 71,
+    FIX44_SecurityDefinition_DeliveryForm = 72,
+    FIX44_SecurityDefinition_PctAtRisk = 73,
+    FIX44_SecurityDefinition_NoInstrAttrib = 74,
+    FIX44_SecurityDefinition_NoUnderlyings = 75,
+    FIX44_SecurityDefinition_Currency = 76,
+    FIX44_SecurityDefinition_TradingSessionID = 77,
+    FIX44_SecurityDefinition_TradingSessionSubID = 78,
+    FIX44_SecurityDefinition_Text = 79,
+    FIX44_SecurityDefinition_EncodedTextLen = 80,
+    FIX44_SecurityDefinition_EncodedText = 81,
+    FIX44_SecurityDefinition_NoLegs = 82,
+    FIX44_SecurityDefinition_ExpirationCycle = 83,
+    FIX44_SecurityDefinition_RoundLot = 84,
+    FIX44_SecurityDefinition_MinTradeVol = 85,
+    FIX44_SecurityDefinition_SignatureLength = 86,
+    FIX44_SecurityDefinition_Signature = 87,
+    FIX44_SecurityDefinition_CheckSum = 88,
+};
+
+typedef struct _fix44SecurityDefinition {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityResponseType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    int64_t	NoUnderlyings;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	NoLegs;
+    int64_t	ExpirationCycle;
+    struct _ofixDecimal	RoundLot;
+    struct _ofixDecimal	MinTradeVol;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityDefinition;
+
+extern void	fix44_decode_SecurityDefinition(ofixErr err, fix44SecurityDefinition m, const char *raw, int len);
+extern void	fix44_decode_SecurityDefinition_msg(ofixErr err, fix44SecurityDefinition m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityDefinition(ofixErr err, fix44SecurityDefinition m);
+
+// SecurityStatusRequest [e]
+enum {
+    FIX44_SecurityStatusRequest_BeginString = 0,
+    FIX44_SecurityStatusRequest_BodyLength = 1,
+    FIX44_SecurityStatusRequest_MsgType = 2,
+    FIX44_SecurityStatusRequest_SenderCompID = 3,
+    FIX44_SecurityStatusRequest_TargetCompID = 4,
+    FIX44_SecurityStatusRequest_OnBehalfOfCompID = 5,
+    FIX44_SecurityStatusRequest_DeliverToCompID = 6,
+    FIX44_SecurityStatusRequest_SecureDataLen = 7,
+    FIX44_SecurityStatusRequest_SecureData = 8,
+    FIX44_SecurityStatusRequest_MsgSeqNum = 9,
+    FIX44_SecurityStatusRequest_SenderSubID = 10,
+    FIX44_SecurityStatusRequest_SenderLocationID = 11,
+    FIX44_SecurityStatusRequest_TargetSubID = 12,
+    FIX44_SecurityStatusRequest_TargetLocationID = 13,
+    FIX44_SecurityStatusRequest_OnBehalfOfSubID = 14,
+    FIX44_SecurityStatusRequest_OnBehalfOfLocationID = 15,
+    FIX44_SecurityStatusRequest_DeliverToSubID = 16,
+    FIX44_SecurityStatusRequest_DeliverToLocationID = 17,
+    FIX44_SecurityStatusRequest_PossDupFlag = 18,
+    FIX44_SecurityStatusRequest_PossResend = 19,
+    FIX44_SecurityStatusRequest_SendingTime = 20,
+    FIX44_SecurityStatusRequest_OrigSendingTime = 21,
+    FIX44_SecurityStatusRequest_XmlDataLen = 22,
+    FIX44_SecurityStatusRequest_XmlData = 23,
+    FIX44_SecurityStatusRequest_MessageEncoding = 24,
+    FIX44_SecurityStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityStatusRequest_NoHops = 26,
+    FIX44_SecurityStatusRequest_SecurityStatusReqID = 27,
+    FIX44_SecurityStatusRequest_Symbol = 28,
+    FIX44_SecurityStatusRequest_SymbolSfx = 29,
+    FIX44_SecurityStatusRequest_SecurityID = 30,
+    FIX44_SecurityStatusRequest_SecurityIDSource = 31,
+    FIX44_SecurityStatusRequest_NoSecurityAltID = 32,
+    FIX44_SecurityStatusRequest_Product = 33,
+    FIX44_SecurityStatusRequest_CFICode = 34,
+    FIX44_SecurityStatusRequest_SecurityType = 35,
+    FIX44_SecurityStatusRequest_SecuritySubType = 36,
+    FIX44_SecurityStatusRequest_MaturityMonthYear = 37,
+    FIX44_SecurityStatusRequest_MaturityDate = 38,
+    FIX44_SecurityStatusRequest_CouponPaymentDate = 39,
+    FIX44_SecurityStatusRequest_IssueDate = 40,
+    FIX44_SecurityStatusRequest_RepoCollateralSecurityType = 41,
+    FIX44_SecurityStatusRequest_RepurchaseTerm = 42,
+    FIX44_SecurityStatusRequest_RepurchaseRate = 43,
+    FIX44_SecurityStatusRequest_Factor = 44,
+    FIX44_SecurityStatusRequest_CreditRating = 45,
+    FIX44_SecurityStatusRequest_InstrRegistry = 46,
+    FIX44_SecurityStatusRequest_CountryOfIssue = 47,
+    FIX44_SecurityStatusRequest_StateOrProvinceOfIssue = 48,
+    FIX44_SecurityStatusRequest_LocaleOfIssue = 49,
+    FIX44_SecurityStatusRequest_RedemptionDate = 50,
+    FIX44_SecurityStatusRequest_StrikePrice = 51,
+    FIX44_SecurityStatusRequest_StrikeCurrency = 52,
+    FIX44_SecurityStatusRequest_OptAttribute = 53,
+    FIX44_SecurityStatusRequest_ContractMultiplier = 54,
+    FIX44_SecurityStatusRequest_CouponRate = 55,
+    FIX44_SecurityStatusRequest_SecurityExchange = 56,
+    FIX44_SecurityStatusRequest_Issuer = 57,
+    FIX44_SecurityStatusRequest_EncodedIssuerLen = 58,
+    FIX44_SecurityStatusRequest_EncodedIssuer = 59,
+    FIX44_SecurityStatusRequest_SecurityDesc = 60,
+    FIX44_SecurityStatusRequest_EncodedSecurityDescLen = 61,
+    FIX44_SecurityStatusRequest_EncodedSecurityDesc = 62,
+    FIX44_SecurityStatusRequest_Pool = 63,
+    FIX44_SecurityStatusRequest_ContractSettlMonth = 64,
+    FIX44_SecurityStatusRequest_CPProgram = 65,
+    FIX44_SecurityStatusRequest_CPRegType = 66,
+    FIX44_SecurityStatusRequest_NoEvents = 67,
+    FIX44_SecurityStatusRequest_DatedDate = 68,
+    FIX44_SecurityStatusRequest_InterestAccrualDate = 69,
+    FIX44_SecurityStatusRequest_DeliveryForm = 70,
+    FIX44_SecurityStatusRequest_PctAtRisk = 71,
+    FIX44_SecurityStatusRequest_NoInstrAttrib = 72,
+    FIX44_SecurityStatusRequest_NoUnderlyings = 73,
+    FIX44_SecurityStatusRequest_NoLegs = 74,
+    FIX44_SecurityStatusRequest_Currency = 75,
+    FIX44_SecurityStatusRequest_SubscriptionRequestType = 76,
+    FIX44_SecurityStatusRequest_TradingSessionID = 77,
+    FIX44_SecurityStatusRequest_TradingSessionSubID = 78,
+    FIX44_SecurityStatusRequest_SignatureLength = 79,
+    FIX44_SecurityStatusRequest_Signature = 80,
+    FIX44_SecurityStatusRequest_CheckSum = 81,
+};
+
+typedef struct _fix44SecurityStatusRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityStatusReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixStrView	Currency;
+    char	SubscriptionRequestType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityStatusRequest;
+
+extern void	fix44_decode_SecurityStatusRequest(ofixErr err, fix44SecurityStatusRequest m, const char *raw, int len);
+extern void	fix44_decode_SecurityStatusRequest_msg(ofixErr err, fix44SecurityStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityStatusRequest(ofixErr err, fix44SecurityStatusRequest m);
+
+// SecurityStatus [f]
+enum {
+    FIX44_SecurityStatus_BeginString = 0,
+    FIX44_SecurityStatus_BodyLength = 1,
+    FIX44_SecurityStatus_MsgType = 2,
+    FIX44_SecurityStatus_SenderCompID = 3,
+    FIX44_SecurityStatus_TargetCompID = 4,
+    FIX44_SecurityStatus_OnBehalfOfCompID = 5,
+    FIX44_SecurityStatus_DeliverToCompID = 6,
+    FIX44_SecurityStatus_SecureDataLen = 7,
+    FIX44_SecurityStatus_SecureData = 8,
+    FIX44_SecurityStatus_MsgSeqNum = 9,
+    FIX44_SecurityStatus_SenderSubID = 10,
+    FIX44_SecurityStatus_SenderLocationID = 11,
+    FIX44_SecurityStatus_TargetSubID = 12,
+    FIX44_SecurityStatus_TargetLocationID = 13,
+    FIX44_SecurityStatus_OnBehalfOfSubID = 14,
+    FIX44_SecurityStatus_OnBehalfOfLocationID = 15,
+    FIX44_SecurityStatus_DeliverToSubID = 16,
+    FIX44_SecurityStatus_DeliverToLocationID = 17,
+    FIX44_SecurityStatus_PossDupFlag = 18,
+    FIX44_SecurityStatus_PossResend = 19,
+    FIX44_SecurityStatus_SendingTime = 20,
+    FIX44_SecurityStatus_OrigSendingTime = 21,
+    FIX44_SecurityStatus_XmlDataLen = 22,
+    FIX44_SecurityStatus_XmlData = 23,
+    FIX44_SecurityStatus_MessageEncoding = 24,
+    FIX44_SecurityStatus_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityStatus_NoHops = 26,
+    FIX44_SecurityStatus_SecurityStatusReqID = 27,
+    FIX44_SecurityStatus_Symbol = 28,
+    FIX44_SecurityStatus_SymbolSfx = 29,
+    FIX44_SecurityStatus_SecurityID = 30,
+    FIX44_SecurityStatus_SecurityIDSource = 31,
+    FIX44_SecurityStatus_NoSecurityAltID = 32,
+    FIX44_SecurityStatus_Product = 33,
+    FIX44_SecurityStatus_CFICode = 34,
+    FIX44_SecurityStatus_SecurityType = 35,
+    FIX44_SecurityStatus_SecuritySubType = 36,
+    FIX44_SecurityStatus_MaturityMonthYear = 37,
+    FIX44_SecurityStatus_MaturityDate = 38,
+    FIX44_SecurityStatus_CouponPaymentDate = 39,
+    FIX44_SecurityStatus_IssueDate = 40,
+    FIX44_SecurityStatus_RepoCollateralSecurityType = 41,
+    FIX44_SecurityStatus_RepurchaseTerm = 42,
+    FIX44_SecurityStatus_RepurchaseRate = 43,
+    FIX44_SecurityStatus_Factor = 44,
+    FIX44_SecurityStatus_CreditRating = 45,
+    FIX44_SecurityStatus_InstrRegistry = 46,
+    FIX44_SecurityStatus_CountryOfIssue = 47,
+    FIX44_SecurityStatus_StateOrProvinceOfIssue = 48,
+    FIX44_SecurityStatus_LocaleOfIssue = 49,
+    FIX44_SecurityStatus_RedemptionDate = 50,
+    FIX44_SecurityStatus_StrikePrice = 51,
+    FIX44_SecurityStatus_StrikeCurrency = 52,
+    FIX44_SecurityStatus_OptAttribute = 53,
+    FIX44_SecurityStatus_ContractMultiplier = 54,
+    FIX44_SecurityStatus_CouponRate = 55,
+    FIX44_SecurityStatus_SecurityExchange = 56,
+    FIX44_SecurityStatus_Issuer = 57,
+    FIX44_SecurityStatus_EncodedIssuerLen = 58,
+    FIX44_SecurityStatus_EncodedIssuer = 59,
+    FIX44_SecurityStatus_SecurityDesc = 60,
+    FIX44_SecurityStatus_EncodedSecurityDescLen = 61,
+    FIX44_SecurityStatus_EncodedSecurityDesc = 62,
+    FIX44_SecurityStatus_Pool = 63,
+    FIX44_SecurityStatus_ContractSettlMonth = 64,
+    FIX44_SecurityStatus_CPProgram = 65,
+    FIX44_SecurityStatus_CPRegType = 66,
+    FIX44_SecurityStatus_NoEvents = 67,
+    FIX44_SecurityStatus_DatedDate = 68,
+    FIX44_SecurityStatus_InterestAccrualDate = 69,
+    FIX44_SecurityStatus_DeliveryForm = 70,
+    FIX44_SecurityStatus_PctAtRisk = 71,
+    FIX44_SecurityStatus_NoInstrAttrib = 72,
+    FIX44_SecurityStatus_NoUnderlyings = 73,
+    FIX44_SecurityStatus_NoLegs = 74,
+    FIX44_SecurityStatus_Currency = 75,
+    FIX44_SecurityStatus_TradingSessionID = 76,
+    FIX44_SecurityStatus_TradingSessionSubID = 77,
+    FIX44_SecurityStatus_UnsolicitedIndicator = 78,
+    FIX44_SecurityStatus_SecurityTradingStatus = 79,
+    FIX44_SecurityStatus_FinancialStatus = 80,
+    FIX44_SecurityStatus_CorporateAction = 81,
+    FIX44_SecurityStatus_HaltReason = 82,
+    FIX44_SecurityStatus_InViewOfCommon = 83,
+    FIX44_SecurityStatus_DueToRelated = 84,
+    FIX44_SecurityStatus_BuyVolume = 85,
+    FIX44_SecurityStatus_SellVolume = 86,
+    FIX44_SecurityStatus_HighPx = 87,
+    FIX44_SecurityStatus_LowPx = 88,
+    FIX44_SecurityStatus_LastPx = 89,
+    FIX44_SecurityStatus_TransactTime = 90,
+    FIX44_SecurityStatus_Adjustment = 91,
+    FIX44_SecurityStatus_Text = 92,
+    FIX44_SecurityStatus_EncodedTextLen = 93,
+    FIX44_SecurityStatus_EncodedText = 94,
+    FIX44_SecurityStatus_SignatureLength = 95,
+    FIX44_SecurityStatus_Signature = 96,
+    FIX44_SecurityStatus_CheckSum = 97,
+};
+
+typedef struct _fix44SecurityStatus {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityStatusReqID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	UnsolicitedIndicator;
+    int64_t	SecurityTradingStatus;
+    struct _ofixStrView	FinancialStatus;
+    struct _ofixStrView	CorporateAction;
+    char	HaltReason;
+    char	InViewOfCommon;
+    char	DueToRelated;
+    struct _ofixDecimal	BuyVolume;
+    struct _ofixDecimal	SellVolume;
+    struct _ofixDecimal	HighPx;
+    struct _ofixDecimal	LowPx;
+    struct _ofixDecimal	LastPx;
+    struct _ofixDate	TransactTime;
+    int64_t	Adjustment;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityStatus;
+
+extern void	fix44_decode_SecurityStatus(ofixErr err, fix44SecurityStatus m, const char *raw, int len);
+extern void	fix44_decode_SecurityStatus_msg(ofixErr err, fix44SecurityStatus m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityStatus(ofixErr err, fix44SecurityStatus m);
+
+// TradingSessionStatusRequest [g]
+enum {
+    FIX44_TradingSessionStatusRequest_BeginString = 0,
+    FIX44_TradingSessionStatusRequest_BodyLength = 1,
+    FIX44_TradingSessionStatusRequest_MsgType = 2,
+    FIX44_TradingSessionStatusRequest_SenderCompID = 3,
+    FIX44_TradingSessionStatusRequest_TargetCompID = 4,
+    FIX44_TradingSessionStatusRequest_OnBehalfOfCompID = 5,
+    FIX44_TradingSessionStatusRequest_DeliverToCompID = 6,
+    FIX44_TradingSessionStatusRequest_SecureDataLen = 7,
+    FIX44_TradingSessionStatusRequest_SecureData = 8,
+    FIX44_TradingSessionStatusRequest_MsgSeqNum = 9,
+    FIX44_TradingSessionStatusRequest_SenderSubID = 10,
+    FIX44_TradingSessionStatusRequest_SenderLocationID = 11,
+    FIX44_TradingSessionStatusRequest_TargetSubID = 12,
+    FIX44_TradingSessionStatusRequest_TargetLocationID = 13,
+    FIX44_TradingSessionStatusRequest_OnBehalfOfSubID = 14,
+    FIX44_TradingSessionStatusRequest_OnBehalfOfLocationID = 15,
+    FIX44_TradingSessionStatusRequest_DeliverToSubID = 16,
+    FIX44_TradingSessionStatusRequest_DeliverToLocationID = 17,
+    FIX44_TradingSessionStatusRequest_PossDupFlag = 18,
+    FIX44_TradingSessionStatusRequest_PossResend = 19,
+    FIX44_TradingSessionStatusRequest_SendingTime = 20,
+    FIX44_TradingSessionStatusRequest_OrigSendingTime = 21,
+    FIX44_TradingSessionStatusRequest_XmlDataLen = 22,
+    FIX44_TradingSessionStatusRequest_XmlData = 23,
+    FIX44_TradingSessionStatusRequest_MessageEncoding = 24,
+    FIX44_TradingSessionStatusRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_TradingSessionStatusRequest_NoHops = 26,
+    FIX44_TradingSessionStatusRequest_TradSesReqID = 27,
+    FIX44_TradingSessionStatusRequest_TradingSessionID = 28,
+    FIX44_TradingSessionStatusRequest_TradingSessionSubID = 29,
+    FIX44_TradingSessionStatusRequest_TradSesMethod = 30,
+    FIX44_TradingSessionStatusRequest_TradSesMode = 31,
+    FIX44_TradingSessionStatusRequest_SubscriptionRequestType = 32,
+    FIX44_TradingSessionStatusRequest_SignatureLength = 33,
+    FIX44_TradingSessionStatusRequest_Signature = 34,
+    FIX44_TradingSessionStatusRequest_CheckSum = 35,
+};
+
+typedef struct _fix44TradingSessionStatusRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TradSesReqID;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	TradSesMethod;
+    int64_t	TradSesMode;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44TradingSessionStatusRequest;
+
+extern void	fix44_decode_TradingSessionStatusRequest(ofixErr err, fix44TradingSessionStatusRequest m, const char *raw, int len);
+extern void	fix44_decode_TradingSessionStatusRequest_msg(ofixErr err, fix44TradingSessionStatusRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_TradingSessionStatusRequest(ofixErr err, fix44TradingSessionStatusRequest m);
+
+// TradingSessionStatus [h]
+enum {
+    FIX44_TradingSessionStatus_BeginString = 0,
+    FIX44_TradingSessionStatus_BodyLength = 1,
+    FIX44_TradingSessionStatus_MsgType = 2,
+    FIX44_TradingSessionStatus_SenderCompID = 3,
+    FIX44_TradingSessionStatus_TargetCompID = 4,
+    FIX44_TradingSessionStatus_OnBehalfOfCompID = 5,
+    FIX44_TradingSessionStatus_DeliverToCompID = 6,
+    FIX44_TradingSessionStatus_SecureDataLen = 7,
+    FIX44_TradingSessionStatus_SecureData = 8,
+    FIX44_TradingSessionStatus_MsgSeqNum = 9,
+    FIX44_TradingSessionStatus_SenderSubID = 10,
+    FIX44_TradingSessionStatus_SenderLocationID = 11,
+    FIX44_TradingSessionStatus_TargetSubID = 12,
+    FIX44_TradingSessionStatus_TargetLocationID = 13,
+    FIX44_TradingSessionStatus_OnBehalfOfSubID = 14,
+    FIX44_TradingSessionStatus_OnBehalfOfLocationID = 15,
+    FIX44_TradingSessionStatus_DeliverToSubID = 16,
+    FIX44_TradingSessionStatus_DeliverToLocationID = 17,
+    FIX44_TradingSessionStatus_PossDupFlag = 18,
+    FIX44_TradingSessionStatus_PossResend = 19,
+    FIX44_TradingSessionStatus_SendingTime = 20,
+    FIX44_TradingSessionStatus_OrigSendingTime = 21,
+    FIX44_TradingSessionStatus_XmlDataLen = 22,
+    FIX44_TradingSessionStatus_XmlData = 23,
+    FIX44_TradingSessionStatus_MessageEncoding = 24,
+    FIX44_TradingSessionStatus_LastMsgSeqNumProcessed = 25,
+    FIX44_TradingSessionStatus_NoHops = 26,
+    FIX44_TradingSessionStatus_TradSesReqID = 27,
+    FIX44_TradingSessionStatus_TradingSessionID = 28,
+    FIX44_TradingSessionStatus_TradingSessionSubID = 29,
+    FIX44_TradingSessionStatus_TradSesMethod = 30,
+    FIX44_TradingSessionStatus_TradSesMode = 31,
+    FIX44_TradingSessionStatus_UnsolicitedIndicator = 32,
+    FIX44_TradingSessionStatus_TradSesStatus = 33,
+    FIX44_TradingSessionStatus_TradSesStatusRejReason = 34,
+    FIX44_TradingSessionStatus_TradSesStartTime = 35,
+    FIX44_TradingSessionStatus_TradSesOpenTime = 36,
+    FIX44_TradingSessionStatus_TradSesPreCloseTime = 37,
+    FIX44_TradingSessionStatus_TradSesCloseTime = 38,
+    FIX44_TradingSessionStatus_TradSesEndTime = 39,
+    FIX44_TradingSessionStatus_TotalVolumeTraded = 40,
+    FIX44_TradingSessionStatus_Text = 41,
+    FIX44_TradingSessionStatus_EncodedTextLen = 42,
+    FIX44_TradingSessionStatus_EncodedText = 43,
+    FIX44_TradingSessionStatus_SignatureLength = 44,
+    FIX44_TradingSessionStatus_Signature = 45,
+    FIX44_TradingSessionStatus_CheckSum = 46,
+};
+
+typedef struct _fix44TradingSessionStatus {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	TradSesReqID;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	TradSesMethod;
+    int64_t	TradSesMode;
+    char	UnsolicitedIndicator;
+    int64_t	TradSesStatus;
+    int64_t	TradSesStatusRejReason;
+    struct _ofixDate	TradSesStartTime;
+    struct _ofixDate	TradSesOpenTime;
+    struct _ofixDate	TradSesPreCloseTime;
+    struct _ofixDate	TradSesCloseTime;
+    struct _ofixDate	TradSesEndTime;
+    struct _ofixDecimal	TotalVolumeTraded;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44TradingSessionStatus;
+
+extern void	fix44_decode_TradingSessionStatus(ofixErr err, fix44TradingSessionStatus m, const char *raw, int len);
+extern void	fix44_decode_TradingSessionStatus_msg(ofixErr err, fix44TradingSessionStatus m, ofixMsg msg);
+extern ofixMsg	fix44_encode_TradingSessionStatus(ofixErr err, fix44TradingSessionStatus m);
+
+// MassQuote [i]
+enum {
+    FIX44_MassQuote_BeginString = 0,
+    FIX44_MassQuote_BodyLength = 1,
+    FIX44_MassQuote_MsgType = 2,
+    FIX44_MassQuote_SenderCompID = 3,
+    FIX44_MassQuote_TargetCompID = 4,
+    FIX44_MassQuote_OnBehalfOfCompID = 5,
+    FIX44_MassQuote_DeliverToCompID = 6,
+    FIX44_MassQuote_SecureDataLen = 7,
+    FIX44_MassQuote_SecureData = 8,
+    FIX44_MassQuote_MsgSeqNum = 9,
+    FIX44_MassQuote_SenderSubID = 10,
+    FIX44_MassQuote_SenderLocationID = 11,
+    FIX44_MassQuote_TargetSubID = 12,
+    FIX44_MassQuote_TargetLocationID = 13,
+    FIX44_MassQuote_OnBehalfOfSubID = 14,
+    FIX44_MassQuote_OnBehalfOfLocationID = 15,
+    FIX44_MassQuote_DeliverToSubID = 16,
+    FIX44_MassQuote_DeliverToLocationID = 17,
+    FIX44_MassQuote_PossDupFlag = 18,
+    FIX44_MassQuote_PossResend = 19,
+    FIX44_MassQuote_SendingTime = 20,
+    FIX44_MassQuote_OrigSendingTime = 21,
+    FIX44_MassQuote_XmlDataLen = 22,
+    FIX44_MassQuote_XmlData = 23,
+    FIX44_MassQuote_MessageEncoding = 24,
+    FIX44_MassQuote_LastMsgSeqNumProcessed = 25,
+    FIX44_MassQuote_NoHops = 26,
+    FIX44_MassQuote_QuoteReqID = 27,
+    FIX44_MassQuote_QuoteID = 28,
+    FIX44_MassQuote_QuoteType = 29,
+    FIX44_MassQuote_QuoteResponseLevel = 30,
+    FIX44_MassQuote_NoPartyIDs = 31,
+    FIX44_MassQuote_Account = 32,
+    FIX44_MassQuote_AcctIDSource = 33,
+    FIX44_MassQuote_AccountType = 34,
+    FIX44_MassQuote_DefBidSize = 35,
+    FIX44_MassQuote_DefOfferSize = 36,
+    FIX44_MassQuote_NoQuoteSets = 37,
+    FIX44_MassQuote_SignatureLength = 38,
+    FIX44_MassQuote_Signature = 39,
+    FIX44_MassQuote_CheckSum = 40,
+};
+
+typedef struct _fix44MassQuote {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	QuoteReqID;
+    struct _ofixStrView	QuoteID;
+    int64_t	QuoteType;
+    int64_t	QuoteResponseLevel;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    int64_t	AccountType;
+    struct _ofixDecimal	DefBidSize;
+    struct _ofixDecimal	DefOfferSize;
+    int64_t	NoQuoteSets;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44MassQuote;
+
+extern void	fix44_decode_MassQuote(ofixErr err, fix44MassQuote m, const char *raw, int len);
+extern void	fix44_decode_MassQuote_msg(ofixErr err, fix44MassQuote m, ofixMsg msg);
+extern ofixMsg	fix44_encode_MassQuote(ofixErr err, fix44MassQuote m);
+
+// BusinessMessageReject [j]
+enum {
+    FIX44_BusinessMessageReject_BeginString = 0,
+    FIX44_BusinessMessageReject_BodyLength = 1,
+    FIX44_BusinessMessageReject_MsgType = 2,
+    FIX44_BusinessMessageReject_SenderCompID = 3,
+    FIX44_BusinessMessageReject_TargetCompID = 4,
+    FIX44_BusinessMessageReject_OnBehalfOfCompID = 5,
+    FIX44_BusinessMessageReject_DeliverToCompID = 6,
+    FIX44_BusinessMessageReject_SecureDataLen = 7,
+    FIX44_BusinessMessageReject_SecureData = 8,
+    FIX44_BusinessMessageReject_MsgSeqNum = 9,
+    FIX44_BusinessMessageReject_SenderSubID = 10,
+    FIX44_BusinessMessageReject_SenderLocationID = 11,
+    FIX44_BusinessMessageReject_TargetSubID = 12,
+    FIX44_BusinessMessageReject_TargetLocationID = 13,
+    FIX44_BusinessMessageReject_OnBehalfOfSubID = 14,
+    FIX44_BusinessMessageReject_OnBehalfOfLocationID = 15,
+    FIX44_BusinessMessageReject_DeliverToSubID = 16,
+    FIX44_BusinessMessageReject_DeliverToLocationID = 17,
+    FIX44_BusinessMessageReject_PossDupFlag = 18,
+    FIX44_BusinessMessageReject_PossResend = 19,
+    FIX44_BusinessMessageReject_SendingTime = 20,
+    FIX44_BusinessMessageReject_OrigSendingTime = 21,
+    FIX44_BusinessMessageReject_XmlDataLen = 22,
+    FIX44_BusinessMessageReject_XmlData = 23,
+    FIX44_BusinessMessageReject_MessageEncoding = 24,
+    FIX44_BusinessMessageReject_LastMsgSeqNumProcessed = 25,
+    FIX44_BusinessMessageReject_NoHops = 26,
+    FIX44_BusinessMessageReject_RefSeqNum = 27,
+    FIX44_BusinessMessageReject_RefMsgType = 28,
+    FIX44_BusinessMessageReject_BusinessRejectRefID = 29,
+    FIX44_BusinessMessageReject_BusinessRejectReason = 30,
+    FIX44_BusinessMessageReject_Text = 31,
+    FIX44_BusinessMessageReject_EncodedTextLen = 32,
+    FIX44_BusinessMessageReject_EncodedText = 33,
+    FIX44_BusinessMessageReject_SignatureLength = 34,
+    FIX44_BusinessMessageReject_Signature = 35,
+    FIX44_BusinessMessageReject_CheckSum = 36,
+};
+
+typedef struct _fix44BusinessMessageReject {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    int64_t	RefSeqNum;
+    struct _ofixStrView	RefMsgType;
+    struct _ofixStrView	BusinessRejectRefID;
+    int64_t	BusinessRejectReason;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44BusinessMessageReject;
+
+extern void	fix44_decode_BusinessMessageReject(ofixErr err, fix44BusinessMessageReject m, const char *raw, int len);
+extern void	fix44_decode_BusinessMessageReject_msg(ofixErr err, fix44BusinessMessageReject m, ofixMsg msg);
+extern ofixMsg	fix44_encode_BusinessMessageReject(ofixErr err, fix44BusinessMessageReject m);
+
+// BidRequest [k]
+enum {
+    FIX44_BidRequest_BeginString = 0,
+    FIX44_BidRequest_BodyLength = 1,
+    FIX44_BidRequest_MsgType = 2,
+    FIX44_BidRequest_SenderCompID = 3,
+    FIX44_BidRequest_TargetCompID = 4,
+    FIX44_BidRequest_OnBehalfOfCompID = 5,
+    FIX44_BidRequest_DeliverToCompID = 6,
+    FIX44_BidRequest_SecureDataLen = 7,
+    FIX44_BidRequest_SecureData = 8,
+    FIX44_BidRequest_MsgSeqNum = 9,
+    FIX44_BidRequest_SenderSubID = 10,
+    FIX44_BidRequest_SenderLocationID = 11,
+    FIX44_BidRequest_TargetSubID = 12,
+    FIX44_BidRequest_TargetLocationID = 13,
+    FIX44_BidRequest_OnBehalfOfSubID = 14,
+    FIX44_BidRequest_OnBehalfOfLocationID = 15,
+    FIX44_BidRequest_DeliverToSubID = 16,
+    FIX44_BidRequest_DeliverToLocationID = 17,
+    FIX44_BidRequest_PossDupFlag = 18,
+    FIX44_BidRequest_PossResend = 19,
+    FIX44_BidRequest_SendingTime = 20,
+    FIX44_BidRequest_OrigSendingTime = 21,
+    FIX44_BidRequest_XmlDataLen = 22,
+    FIX44_BidRequest_XmlData = 23,
+    FIX44_BidRequest_MessageEncoding = 24,
+    FIX44_BidRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_BidRequest_NoHops = 26,
+    FIX44_BidRequest_BidID = 27,
+    FIX44_BidRequest_ClientBidID = 28,
+    FIX44_BidRequest_BidRequestTransType = 29,
+    FIX44_BidRequest_ListName = 30,
+    FIX44_BidRequest_TotNoRelatedSym = 31,
+    FIX44_BidRequest_BidType = 32,
+    FIX44_BidRequest_NumTickets = 33,
+    FIX44_BidRequest_Currency = 34,
+    FIX44_BidRequest_SideValue1 = 35,
+    FIX44_BidRequest_SideValue2 = 36,
+    FIX44_BidRequest_NoBidDescriptors = 37,
+    FIX44_BidRequest_NoBidComponents = 38,
+    FIX44_BidRequest_LiquidityIndType = 39,
+    FIX44_BidRequest_WtAverageLiquidity = 40,
+    FIX44_BidRequest_ExchangeForPhysical = 41,
+    FIX44_BidRequest_OutMainCntryUIndex = 42,
+    FIX44_BidRequest_CrossPercent = 43,
+    FIX44_BidRequest_ProgRptReqs = 44,
+    FIX44_BidRequest_ProgPeriodInterval = 45,
+    FIX44_BidRequest_IncTaxInd = 46,
+    FIX44_BidRequest_ForexReq = 47,
+    FIX44_BidRequest_NumBidders = 48,
+    FIX44_BidRequest_TradeDate = 49,
+    FIX44_BidRequest_BidTradeType = 50,
+    FIX44_BidRequest_BasisPxType = 51,
+    FIX44_BidRequest_StrikeTime = 52,
+    FIX44_BidRequest_Text = 53,
+    FIX44_BidRequest_EncodedTextLen = 54,
+    FIX44_BidRequest_EncodedText = 55,
+    FIX44_BidRequest_SignatureLength = 56,
+    FIX44_BidRequest_Signature = 57,
+    FIX44_BidRequest_CheckSum = 58,
+};
+
+typedef struct _fix44BidRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    char	BidRequestTransType;
+    struct _ofixStrView	ListName;
+    int64_t	TotNoRelatedSym;
+    int64_t	BidType;
+    int64_t	NumTickets;
+    struct _ofixStrView	Currency;
+    struct _ofixDecimal	SideValue1;
+    struct _ofixDecimal	SideValue2;
+    int64_t	NoBidDescriptors;
+    int64_t	NoBidComponents;
+    int64_t	LiquidityIndType;
+    struct _ofixDecimal	WtAverageLiquidity;
+    char	ExchangeForPhysical;
+    struct _ofixDecimal	OutMainCntryUIndex;
+    struct _ofixDecimal	CrossPercent;
+    int64_t	ProgRptReqs;
+    int64_t	ProgPeriodInterval;
+    int64_t	IncTaxInd;
+    char	ForexReq;
+    int64_t	NumBidders;
+    struct _ofixStrView	TradeDate;
+    char	BidTradeType;
+    char	BasisPxType;
+    struct _ofixDate	StrikeTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44BidRequest;
+
+extern void	fix44_decode_BidRequest(ofixErr err, fix44BidRequest m, const char *raw, int len);
+extern void	fix44_decode_BidRequest_msg(ofixErr err, fix44BidRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_BidRequest(ofixErr err, fix44BidRequest m);
+
+// BidResponse [l]
+enum {
+    FIX44_BidResponse_BeginString = 0,
+    FIX44_BidResponse_BodyLength = 1,
+    FIX44_BidResponse_MsgType = 2,
+    FIX44_BidResponse_SenderCompID = 3,
+    FIX44_BidResponse_TargetCompID = 4,
+    FIX44_BidResponse_OnBehalfOfCompID = 5,
+    FIX44_BidResponse_DeliverToCompID = 6,
+    FIX44_BidResponse_SecureDataLen = 7,
+    FIX44_BidResponse_SecureData = 8,
+    FIX44_BidResponse_MsgSeqNum = 9,
+    FIX44_BidResponse_SenderSubID = 10,
+    FIX44_BidResponse_SenderLocationID = 11,
+    FIX44_BidResponse_TargetSubID = 12,
+    FIX44_BidResponse_TargetLocationID = 13,
+    FIX44_BidResponse_OnBehalfOfSubID = 14,
+    FIX44_BidResponse_OnBehalfOfLocationID = 15,
+    FIX44_BidResponse_DeliverToSubID = 16,
+    FIX44_BidResponse_DeliverToLocationID = 17,
+    FIX44_BidResponse_PossDupFlag = 18,
+    FIX44_BidResponse_PossResend = 19,
+    FIX44_BidResponse_SendingTime = 20,
+    FIX44_BidResponse_OrigSendingTime = 21,
+    FIX44_BidResponse_XmlDataLen = 22,
+    FIX44_BidResponse_XmlData = 23,
+    FIX44_BidResponse_MessageEncoding = 24,
+    FIX44_BidResponse_LastMsgSeqNumProcessed = 25,
+    FIX44_BidResponse_NoHops = 26,
+    FIX44_BidResponse_BidID = 27,
+    FIX44_BidResponse_ClientBidID = 28,
+    FIX44_BidResponse_NoBidComponents = 29,
+    FIX44_BidResponse_SignatureLength = 30,
+    FIX44_BidResponse_Signature = 31,
+    FIX44_BidResponse_CheckSum = 32,
+};
+
+typedef struct _fix44BidResponse {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	BidID;
+    struct _ofixStrView	ClientBidID;
+    int64_t	NoBidComponents;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44BidResponse;
+
+extern void	fix44_decode_BidResponse(ofixErr err, fix44BidResponse m, const char *raw, int len);
+extern void	fix44_decode_BidResponse_msg(ofixErr err, fix44BidResponse m, ofixMsg msg);
+extern ofixMsg	fix44_encode_BidResponse(ofixErr err, fix44BidResponse m);
+
+// ListStrikePrice [m]
+enum {
+    FIX44_ListStrikePrice_BeginString = 0,
+    FIX44_ListStrikePrice_BodyLength = 1,
+    FIX44_ListStrikePrice_MsgType = 2,
+    FIX44_ListStrikePrice_SenderCompID = 3,
+    FIX44_ListStrikePrice_TargetCompID = 4,
+    FIX44_ListStrikePrice_OnBehalfOfCompID = 5,
+    FIX44_ListStrikePrice_DeliverToCompID = 6,
+    FIX44_ListStrikePrice_SecureDataLen = 7,
+    FIX44_ListStrikePrice_SecureData = 8,
+    FIX44_ListStrikePrice_MsgSeqNum = 9,
+    FIX44_ListStrikePrice_SenderSubID = 10,
+    FIX44_ListStrikePrice_SenderLocationID = 11,
+    FIX44_ListStrikePrice_TargetSubID = 12,
+    FIX44_ListStrikePrice_TargetLocationID = 13,
+    FIX44_ListStrikePrice_OnBehalfOfSubID = 14,
+    FIX44_ListStrikePrice_OnBehalfOfLocationID = 15,
+    FIX44_ListStrikePrice_DeliverToSubID = 16,
+    FIX44_ListStrikePrice_DeliverToLocationID = 17,
+    FIX44_ListStrikePrice_PossDupFlag = 18,
+    FIX44_ListStrikePrice_PossResend = 19,
+    FIX44_ListStrikePrice_SendingTime = 20,
+    FIX44_ListStrikePrice_OrigSendingTime = 21,
+    FIX44_ListStrikePrice_XmlDataLen = 22,
+    FIX44_ListStrikePrice_XmlData = 23,
+    FIX44_ListStrikePrice_MessageEncoding = 24,
+    FIX44_ListStrikePrice_LastMsgSeqNumProcessed = 25,
+    FIX44_ListStrikePrice_NoHops = 26,
+    FIX44_ListStrikePrice_ListID = 27,
+    FIX44_ListStrikePrice_TotNoStrikes = 28,
+    FIX44_ListStrikePrice_LastFragment = 29,
+    FIX44_ListStrikePrice_NoStrikes = 30,
+    FIX44_ListStrikePrice_NoUnderlyings = 31,
+    FIX44_ListStrikePrice_SignatureLength = 32,
+    FIX44_ListStrikePrice_Signature = 33,
+    FIX44_ListStrikePrice_CheckSum = 34,
+};
+
+typedef struct _fix44ListStrikePrice {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ListID;
+    int64_t	TotNoStrikes;
+    char	LastFragment;
+    int64_t	NoStrikes;
+    int64_t	NoUnderlyings;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44ListStrikePrice;
+
+extern void	fix44_decode_ListStrikePrice(ofixErr err, fix44ListStrikePrice m, const char *raw, int len);
+extern void	fix44_decode_ListStrikePrice_msg(ofixErr err, fix44ListStrikePrice m, ofixMsg msg);
+extern ofixMsg	fix44_encode_ListStrikePrice(ofixErr err, fix44ListStrikePrice m);
+
+// RegistrationInstructions [o]
+enum {
+    FIX44_RegistrationInstructions_BeginString = 0,
+    FIX44_RegistrationInstructions_BodyLength = 1,
+    FIX44_RegistrationInstructions_MsgType = 2,
+    FIX44_RegistrationInstructions_SenderCompID = 3,
+    FIX44_RegistrationInstructions_TargetCompID = 4,
+    FIX44_RegistrationInstructions_OnBehalfOfCompID = 5,
+    FIX44_RegistrationInstructions_DeliverToCompID = 6,
+    FIX44_RegistrationInstructions_SecureDataLen = 7,
+    FIX44_RegistrationInstructions_SecureData = 8,
+    FIX44_RegistrationInstructions_MsgSeqNum = 9,
+    FIX44_RegistrationInstructions_SenderSubID = 10,
+    FIX44_RegistrationInstructions_SenderLocationID = 11,
+    FIX44_RegistrationInstructions_TargetSubID = 12,
+    FIX44_RegistrationInstructions_TargetLocationID = 13,
+    FIX44_RegistrationInstructions_OnBehalfOfSubID = 14,
+    FIX44_RegistrationInstructions_OnBehalfOfLocationID = 15,
+    FIX44_RegistrationInstructions_DeliverToSubID = 16,
+    FIX44_RegistrationInstructions_DeliverToLocationID = 17,
+    FIX44_RegistrationInstructions_PossDupFlag = 18,
+    FIX44_RegistrationInstructions_PossResend = 19,
+    FIX44_RegistrationInstructions_SendingTime = 20,
+    FIX44_RegistrationInstructions_OrigSendingTime = 21,
+    FIX44_RegistrationInstructions_XmlDataLen = 22,
+    FIX44_RegistrationInstructions_XmlData = 23,
+    FIX44_RegistrationInstructions_MessageEncoding = 24,
+    FIX44_RegistrationInstructions_LastMsgSeqNumProcessed = 25,
+    FIX44_RegistrationInstructions_NoHops = 26,
+    FIX44_RegistrationInstructions_RegistID = 27,
+    FIX44_RegistrationInstructions_RegistTransType = 28,
+    FIX44_RegistrationInstructions_RegistRefID = 29,
+    FIX44_RegistrationInstructions_ClOrdID = 30,
+    FIX44_RegistrationInstructions_NoPartyIDs = 31,
+    FIX44_RegistrationInstructions_Account = 32,
+    FIX44_RegistrationInstructions_AcctIDSource = 33,
+    FIX44_RegistrationInstructions_RegistAcctType = 34,
+    FIX44_RegistrationInstructions_TaxAdvantageType = 35,
+    FIX44_RegistrationInstructions_OwnershipType = 36,
+    FIX44_RegistrationInstructions_NoRegistDtls = 37,
+    FIX44_RegistrationInstructions_NoDistribInsts = 38,
+    FIX44_RegistrationInstructions_SignatureLength = 39,
+    FIX44_RegistrationInstructions_Signature = 40,
+    FIX44_RegistrationInstructions_CheckSum = 41,
+};
+
+typedef struct _fix44RegistrationInstructions {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	RegistID;
+    char	RegistTransType;
+    struct _ofixStrView	RegistRefID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    struct _ofixStrView	RegistAcctType;
+    int64_t	TaxAdvantageType;
+    char	OwnershipType;
+    int64_t	NoRegistDtls;
+    int64_t	NoDistribInsts;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44RegistrationInstructions;
+
+extern void	fix44_decode_RegistrationInstructions(ofixErr err, fix44RegistrationInstructions m, const char *raw, int len);
+extern void	fix44_decode_RegistrationInstructions_msg(ofixErr err, fix44RegistrationInstructions m, ofixMsg msg);
+extern ofixMsg	fix44_encode_RegistrationInstructions(ofixErr err, fix44RegistrationInstructions m);
+
+// RegistrationInstructionsResponse [p]
+enum {
+    FIX44_RegistrationInstructionsResponse_BeginString = 0,
+    FIX44_RegistrationInstructionsResponse_BodyLength = 1,
+    FIX44_RegistrationInstructionsResponse_MsgType = 2,
+    FIX44_RegistrationInstructionsResponse_SenderCompID = 3,
+    FIX44_RegistrationInstructionsResponse_TargetCompID = 4,
+    FIX44_RegistrationInstructionsResponse_OnBehalfOfCompID = 5,
+    FIX44_RegistrationInstructionsResponse_DeliverToCompID = 6,
+    FIX44_RegistrationInstructionsResponse_SecureDataLen = 7,
+    FIX44_RegistrationInstructionsResponse_SecureData = 8,
+    FIX44_RegistrationInstructionsResponse_MsgSeqNum = 9,
+    FIX44_RegistrationInstructionsResponse_SenderSubID = 10,
+    FIX44_RegistrationInstructionsResponse_SenderLocationID = 11,
+    FIX44_RegistrationInstructionsResponse_TargetSubID = 12,
+    FIX44_RegistrationInstructionsResponse_TargetLocationID = 13,
+    FIX44_RegistrationInstructionsResponse_OnBehalfOfSubID = 14,
+    FIX44_RegistrationInstructionsResponse_OnBehalfOfLocationID = 15,
+    FIX44_RegistrationInstructionsResponse_DeliverToSubID = 16,
+    FIX44_RegistrationInstructionsResponse_DeliverToLocationID = 17,
+    FIX44_RegistrationInstructionsResponse_PossDupFlag = 18,
+    FIX44_RegistrationInstructionsResponse_PossResend = 19,
+    FIX44_RegistrationInstructionsResponse_SendingTime = 20,
+    FIX44_RegistrationInstructionsResponse_OrigSendingTime = 21,
+    FIX44_RegistrationInstructionsResponse_XmlDataLen = 22,
+    FIX44_RegistrationInstructionsResponse_XmlData = 23,
+    FIX44_RegistrationInstructionsResponse_MessageEncoding = 24,
+    FIX44_RegistrationInstructionsResponse_LastMsgSeqNumProcessed = 25,
+    FIX44_RegistrationInstructionsResponse_NoHops = 26,
+    FIX44_RegistrationInstructionsResponse_RegistID = 27,
+    FIX44_RegistrationInstructionsResponse_RegistTransType = 28,
+    FIX44_RegistrationInstructionsResponse_RegistRefID = 29,
+    FIX44_RegistrationInstructionsResponse_ClOrdID = 30,
+    FIX44_RegistrationInstructionsResponse_NoPartyIDs = 31,
+    FIX44_RegistrationInstructionsResponse_Account = 32,
+    FIX44_RegistrationInstructionsResponse_AcctIDSource = 33,
+    FIX44_RegistrationInstructionsResponse_RegistStatus = 34,
+    FIX44_RegistrationInstructionsResponse_RegistRejReasonCode = 35,
+    FIX44_RegistrationInstructionsResponse_RegistRejReasonText = 36,
+    FIX44_RegistrationInstructionsResponse_SignatureLength = 37,
+    FIX44_RegistrationInstructionsResponse_Signature = 38,
+    FIX44_RegistrationInstructionsResponse_CheckSum = 39,
+};
+
+typedef struct _fix44RegistrationInstructionsResponse {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	RegistID;
+    char	RegistTransType;
+    struct _ofixStrView	RegistRefID;
+    struct _ofixStrView	ClOrdID;
+    int64_t	NoPartyIDs;
+    struct _ofixStrView	Account;
+    int64_t	AcctIDSource;
+    char	RegistStatus;
+    int64_t	RegistRejReasonCode;
+    struct _ofixStrView	RegistRejReasonText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44RegistrationInstructionsResponse;
+
+extern void	fix44_decode_RegistrationInstructionsResponse(ofixErr err, fix44RegistrationInstructionsResponse m, const char *raw, int len);
+extern void	fix44_decode_RegistrationInstructionsResponse_msg(ofixErr err, fix44RegistrationInstructionsResponse m, ofixMsg msg);
+extern ofixMsg	fix44_encode_RegistrationInstructionsResponse(ofixErr err, fix44RegistrationInstructionsResponse m);
+
+// OrderMassCancelRequest [q]
+enum {
+    FIX44_OrderMassCancelRequest_BeginString = 0,
+    FIX44_OrderMassCancelRequest_BodyLength = 1,
+    FIX44_OrderMassCancelRequest_MsgType = 2,
+    FIX44_OrderMassCancelRequest_SenderCompID = 3,
+    FIX44_OrderMassCancelRequest_TargetCompID = 4,
+    FIX44_OrderMassCancelRequest_OnBehalfOfCompID = 5,
+    FIX44_OrderMassCancelRequest_DeliverToCompID = 6,
+    FIX44_OrderMassCancelRequest_SecureDataLen = 7,
+    FIX44_OrderMassCancelRequest_SecureData = 8,
+    FIX44_OrderMassCancelRequest_MsgSeqNum = 9,
+    FIX44_OrderMassCancelRequest_SenderSubID = 10,
+    FIX44_OrderMassCancelRequest_SenderLocationID = 11,
+    FIX44_OrderMassCancelRequest_TargetSubID = 12,
+    FIX44_OrderMassCancelRequest_TargetLocationID = 13,
+    FIX44_OrderMassCancelRequest_OnBehalfOfSubID = 14,
+    FIX44_OrderMassCancelRequest_OnBehalfOfLocationID = 15,
+    FIX44_OrderMassCancelRequest_DeliverToSubID = 16,
+    FIX44_OrderMassCancelRequest_DeliverToLocationID = 17,
+    FIX44_OrderMassCancelRequest_PossDupFlag = 18,
+    FIX44_OrderMassCancelRequest_PossResend = 19,
+    FIX44_OrderMassCancelRequest_SendingTime = 20,
+    FIX44_OrderMassCancelRequest_OrigSendingTime = 21,
+    FIX44_OrderMassCancelRequest_XmlDataLen = 22,
+    FIX44_OrderMassCancelRequest_XmlData = 23,
+    FIX44_OrderMassCancelRequest_MessageEncoding = 24,
+    FIX44_OrderMassCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_OrderMassCancelRequest_NoHops = 26,
+    FIX44_OrderMassCancelRequest_ClOrdID = 27,
+    FIX44_OrderMassCancelRequest_SecondaryClOrdID = 28,
+    FIX44_OrderMassCancelRequest_MassCancelRequestType = 29,
+    FIX44_OrderMassCancelRequest_TradingSessionID = 30,
+    FIX44_OrderMassCancelRequest_TradingSessionSubID = 31,
+    FIX44_OrderMassCancelRequest_Symbol = 32,
+    FIX44_OrderMassCancelRequest_SymbolSfx = 33,
+    FIX44_OrderMassCancelRequest_SecurityID = 34,
+    FIX44_OrderMassCancelRequest_SecurityIDSource = 35,
+    FIX44_OrderMassCancelRequest_NoSecurityAltID = 36,
+    FIX44_OrderMassCancelRequest_Product = 37,
+    FIX44_OrderMassCancelRequest_CFICode = 38,
+    FIX44_OrderMassCancelRequest_SecurityType = 39,
+    FIX44_OrderMassCancelRequest_SecuritySubType = 40,
+    FIX44_OrderMassCancelRequest_MaturityMonthYear = 41,
+    FIX44_OrderMassCancelRequest_MaturityDate = 42,
+    FIX44_OrderMassCancelRequest_CouponPaymentDate = 43,
+    FIX44_OrderMassCancelRequest_IssueDate = 44,
+    FIX44_OrderMassCancelRequest_RepoCollateralSecurityType = 45,
+    FIX44_OrderMassCancelRequest_RepurchaseTerm = 46,
+    FIX44_OrderMassCancelRequest_RepurchaseRate = 47,
+    FIX44_OrderMassCancelRequest_Factor = 48,
+    FIX44_OrderMassCancelRequest_CreditRating = 49,
+    FIX44_OrderMassCancelRequest_InstrRegistry = 50,
+    FIX44_OrderMassCancelRequest_CountryOfIssue = 51,
+    FIX44_OrderMassCancelRequest_StateOrProvinceOfIssue = 52,
+    FIX44_OrderMassCancelRequest_LocaleOfIssue = 53,
+    FIX44_OrderMassCancelRequest_RedemptionDate = 54,
+    FIX44_OrderMassCancelRequest_StrikePrice = 55,
+    FIX44_OrderMassCancelRequest_StrikeCurrency = 56,
+    FIX44_OrderMassCancelRequest_OptAttribute = 57,
+    FIX44_OrderMassCancelRequest_ContractMultiplier = 58,
+    FIX44_OrderMassCancelRequest_CouponRate = 59,
+    FIX44_OrderMassCancelRequest_SecurityExchange = 60,
+    FIX44_OrderMassCancelRequest_Issuer = 61,
+    FIX44_OrderMassCancelRequest_EncodedIssuerLen = 62,
+    FIX44_OrderMassCancelRequest_EncodedIssuer = 63,
+    FIX44_OrderMassCancelRequest_SecurityDesc = 64,
+    FIX44_OrderMassCancelRequest_EncodedSecurityDescLen = 65,
+    FIX44_OrderMassCancelRequest_EncodedSecurityDesc = 66,
+    FIX44_OrderMassCancelRequest_Pool = 67,
+    FIX44_OrderMassCancelRequest_ContractSettlMonth = 68,
+    FIX44_OrderMassCancelRequest_CPProgram = 69,
+    FIX44_OrderMassCancelRequest_CPRegType = 70,
+    FIX44_OrderMassCancelRequest_NoEvents = 71,
+    FIX44_OrderMassCancelRequest_DatedDate = 72,
+    FIX44_OrderMassCancelRequest_InterestAccrualDate = 73,
+    FIX44_OrderMassCancelRequest_UnderlyingSymbol = 74,
+    FIX44_OrderMassCancelRequest_UnderlyingSymbolSfx = 75,
+    FIX44_OrderMassCancelRequest_UnderlyingSecurityID = 76,
+    FIX44_OrderMassCancelRequest_UnderlyingSecurityIDSource = 77,
+    FIX44_OrderMassCancelRequest_NoUnderlyingSecurityAltID = 78,
+    FIX44_OrderMassCancelRequest_UnderlyingProduct = 79,
+    FIX44_OrderMassCancelRequest_UnderlyingCFICode = 80,
+    FIX44_OrderMassCancelRequest_UnderlyingSecurityType = 81,
+    FIX44_OrderMassCancelRequest_UnderlyingSecuritySubType = 82,
+    FIX44_OrderMassCancelRequest_UnderlyingMaturityMonthYear = 83,
+    FIX44_OrderMassCancelRequest_UnderlyingMaturityDate = 84,
+    FIX44_OrderMassCancelRequest_UnderlyingCouponPaymentDate = 85,
+    FIX44_OrderMassCancelRequest_UnderlyingIssueDate = 86,
+    FIX44_OrderMassCancelRequest_UnderlyingRepoCollateralSecurityType = 87,
+    FIX44_OrderMassCancelRequest_UnderlyingRepurchaseTerm = 88,
+    FIX44_OrderMassCancelRequest_UnderlyingRepurchaseRate = 89,
+    FIX44_OrderMassCancelRequest_UnderlyingFactor = 90,
+    FIX44_OrderMassCancelRequest_UnderlyingCreditRating = 91,
+    FIX44_OrderMassCancelRequest_UnderlyingInstrRegistry = 92,
+    FIX44_OrderMassCancelRequest_UnderlyingCountryOfIssue = 93,
+    FIX44_OrderMassCancelRequest_UnderlyingStateOrProvinceOfIssue = 94,
+    FIX44_OrderMassCancelRequest_UnderlyingLocaleOfIssue = 95,
+    FIX44_OrderMassCancelRequest_UnderlyingRedemptionDate = 96,
+    FIX44_OrderMassCancelRequest_UnderlyingStrikePrice = 97,
+    FIX44_OrderMassCancelRequest_UnderlyingStrikeCurrency = 98,
+    FIX44_OrderMassCancelRequest_UnderlyingOptAttribute = 99,
+    FIX44_OrderMassCancelRequest_UnderlyingContractMultiplier = 100,
+    FIX44_OrderMassCancelRequest_UnderlyingCouponRate = 101,
+    FIX44_OrderMassCancelRequest_UnderlyingSecurityExchange = 102,
+    FIX44_OrderMassCancelRequest_UnderlyingIssuer = 103,
+    FIX44_OrderMassCancelRequest_EncodedUnderlyingIssuerLen = 104,
+    FIX44_OrderMassCancelRequest_EncodedUnderlyingIssuer = 105,
+    FIX44_OrderMassCancelRequest_UnderlyingSecurityDesc = 106,
+    FIX44_OrderMassCancelRequest_EncodedUnderlyingSecurityDescLen = 107,
+    FIX44_OrderMassCancelRequest_EncodedUnderlyingSecurityDesc = 108,
+    FIX44_OrderMassCancelRequest_UnderlyingCPProgram = 109,
+    FIX44_OrderMassCancelRequest_UnderlyingCPRegType = 110,
+    FIX44_OrderMassCancelRequest_UnderlyingCurrency = 111,
+    FIX44_OrderMassCancelRequest_UnderlyingQty = 112,
+    FIX44_OrderMassCancelRequest_UnderlyingPx = 113,
+    FIX44_OrderMassCancelRequest_UnderlyingDirtyPrice = 114,
+    FIX44_OrderMassCancelRequest_UnderlyingEndPrice = 115,
+    FIX44_OrderMassCancelRequest_UnderlyingStartValue = 116,
+    FIX44_OrderMassCancelRequest_UnderlyingCurrentValue = 117,
+    FIX44_OrderMassCancelRequest_UnderlyingEndValue = 118,
+    FIX44_OrderMassCancelRequest_NoUnderlyingStips = 119,
+    FIX44_OrderMassCancelRequest_Side = 120,
+    FIX44_OrderMassCancelRequest_TransactTime = 121,
+    FIX44_OrderMassCancelRequest_Text = 122,
+    FIX44_OrderMassCancelRequest_EncodedTextLen = 123,
+    FIX44_OrderMassCancelRequest_EncodedText = 124,
+    FIX44_OrderMassCancelRequest_SignatureLength = 125,
+    FIX44_OrderMassCancelRequest_Signature = 126,
+    FIX44_OrderMassCancelRequest_CheckSum = 127,
+};
+
+typedef struct _fix44OrderMassCancelRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    char	MassCancelRequestType;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingSecuritySubType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixStrView	UnderlyingCouponPaymentDate;
+    struct _ofixStrView	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixStrView	UnderlyingRedemptionDate;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    struct _ofixStrView	UnderlyingStrikeCurrency;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    struct _ofixStrView	UnderlyingCPProgram;
+    struct _ofixStrView	UnderlyingCPRegType;
+    struct _ofixStrView	UnderlyingCurrency;
+    struct _ofixDecimal	UnderlyingQty;
+    struct _ofixDecimal	UnderlyingPx;
+    struct _ofixDecimal	UnderlyingDirtyPrice;
+    struct _ofixDecimal	UnderlyingEndPrice;
+    struct _ofixDecimal	UnderlyingStartValue;
+    struct _ofixDecimal	UnderlyingCurrentValue;
+    struct _ofixDecimal	UnderlyingEndValue;
+    int64_t	NoUnderlyingStips;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44OrderMassCancelRequest;
+
+extern void	fix44_decode_OrderMassCancelRequest(ofixErr err, fix44OrderMassCancelRequest m, const char *raw, int len);
+extern void	fix44_decode_OrderMassCancelRequest_msg(ofixErr err, fix44OrderMassCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_OrderMassCancelRequest(ofixErr err, fix44OrderMassCancelRequest m);
+
+// OrderMassCancelReport [r]
+enum {
+    FIX44_OrderMassCancelReport_BeginString = 0,
+    FIX44_OrderMassCancelReport_BodyLength = 1,
+    FIX44_OrderMassCancelReport_MsgType = 2,
+    FIX44_OrderMassCancelReport_SenderCompID = 3,
+    FIX44_OrderMassCancelReport_TargetCompID = 4,
+    FIX44_OrderMassCancelReport_OnBehalfOfCompID = 5,
+    FIX44_OrderMassCancelReport_DeliverToCompID = 6,
+    FIX44_OrderMassCancelReport_SecureDataLen = 7,
+    FIX44_OrderMassCancelReport_SecureData = 8,
+    FIX44_OrderMassCancelReport_MsgSeqNum = 9,
+    FIX44_OrderMassCancelReport_SenderSubID = 10,
+    FIX44_OrderMassCancelReport_SenderLocationID = 11,
+    FIX44_OrderMassCancelReport_TargetSubID = 12,
+    FIX44_OrderMassCancelReport_TargetLocationID = 13,
+    FIX44_OrderMassCancelReport_OnBehalfOfSubID = 14,
+    FIX44_OrderMassCancelReport_OnBehalfOfLocationID = 15,
+    FIX44_OrderMassCancelReport_DeliverToSubID = 16,
+    FIX44_OrderMassCancelReport_DeliverToLocationID = 17,
+    FIX44_OrderMassCancelReport_PossDupFlag = 18,
+    FIX44_OrderMassCancelReport_PossResend = 19,
+    FIX44_OrderMassCancelReport_SendingTime = 20,
+    FIX44_OrderMassCancelReport_OrigSendingTime = 21,
+    FIX44_OrderMassCancelReport_XmlDataLen = 22,
+    FIX44_OrderMassCancelReport_XmlData = 23,
+    FIX44_OrderMassCancelReport_MessageEncoding = 24,
+    FIX44_OrderMassCancelReport_LastMsgSeqNumProcessed = 25,
+    FIX44_OrderMassCancelReport_NoHops = 26,
+    FIX44_OrderMassCancelReport_ClOrdID = 27,
+    FIX44_OrderMassCancelReport_SecondaryClOrdID = 28,
+    FIX44_OrderMassCancelReport_OrderID = 29,
+    FIX44_OrderMassCancelReport_SecondaryOrderID = 30,
+    FIX44_OrderMassCancelReport_MassCancelRequestType = 31,
+    FIX44_OrderMassCancelReport_MassCancelResponse = 32,
+    FIX44_OrderMassCancelReport_MassCancelRejectReason = 33,
+    FIX44_OrderMassCancelReport_TotalAffectedOrders = 34,
+    FIX44_OrderMassCancelReport_NoAffectedOrders = 35,
+    FIX44_OrderMassCancelReport_TradingSessionID = 36,
+    FIX44_OrderMassCancelReport_TradingSessionSubID = 37,
+    FIX44_OrderMassCancelReport_Symbol = 38,
+    FIX44_OrderMassCancelReport_SymbolSfx = 39,
+    FIX44_OrderMassCancelReport_SecurityID = 40,
+    FIX44_OrderMassCancelReport_SecurityIDSource = 41,
+    FIX44_OrderMassCancelReport_NoSecurityAltID = 42,
+    FIX44_OrderMassCancelReport_Product = 43,
+    FIX44_OrderMassCancelReport_CFICode = 44,
+    FIX44_OrderMassCancelReport_SecurityType = 45,
+    FIX44_OrderMassCancelReport_SecuritySubType = 46,
+    FIX44_OrderMassCancelReport_MaturityMonthYear = 47,
+    FIX44_OrderMassCancelReport_MaturityDate = 48,
+    FIX44_OrderMassCancelReport_CouponPaymentDate = 49,
+    FIX44_OrderMassCancelReport_IssueDate = 50,
+    FIX44_OrderMassCancelReport_RepoCollateralSecurityType = 51,
+    FIX44_OrderMassCancelReport_RepurchaseTerm = 52,
+    FIX44_OrderMassCancelReport_RepurchaseRate = 53,
+    FIX44_OrderMassCancelReport_Factor = 54,
+    FIX44_OrderMassCancelReport_CreditRating = 55,
+    FIX44_OrderMassCancelReport_InstrRegistry = 56,
+    FIX44_OrderMassCancelReport_CountryOfIssue = 57,
+    FIX44_OrderMassCancelReport_StateOrProvinceOfIssue = 58,
+    FIX44_OrderMassCancelReport_LocaleOfIssue = 59,
+    FIX44_OrderMassCancelReport_RedemptionDate = 60,
+    FIX44_OrderMassCancelReport_StrikePrice = 61,
+    FIX44_OrderMassCancelReport_StrikeCurrency = 62,
+    FIX44_OrderMassCancelReport_OptAttribute = 63,
+    FIX44_OrderMassCancelReport_ContractMultiplier = 64,
+    FIX44_OrderMassCancelReport_CouponRate = 65,
+    FIX44_OrderMassCancelReport_SecurityExchange = 66,
+    FIX44_OrderMassCancelReport_Issuer = 67,
+    FIX44_OrderMassCancelReport_EncodedIssuerLen = 68,
+    FIX44_OrderMassCancelReport_EncodedIssuer = 69,
+    FIX44_OrderMassCancelReport_SecurityDesc = 70,
+    FIX44_OrderMassCancelReport_EncodedSecurityDescLen = 71,
+    FIX44_OrderMassCancelReport_EncodedSecurityDesc = 72,
+    FIX44_OrderMassCancelReport_Pool = 73,
+    FIX44_OrderMassCancelReport_ContractSettlMonth = 74,
+    FIX44_OrderMassCancelReport_CPProgram = 75,
+    FIX44_OrderMassCancelReport_CPRegType = 76,
+    FIX44_OrderMassCancelReport_NoEvents = 77,
+    FIX44_OrderMassCancelReport_DatedDate = 78,
+    FIX44_OrderMassCancelReport_InterestAccrualDate = 79,
+    FIX44_OrderMassCancelReport_UnderlyingSymbol = 80,
+    FIX44_OrderMassCancelReport_UnderlyingSymbolSfx = 81,
+    FIX44_OrderMassCancelReport_UnderlyingSecurityID = 82,
+    FIX44_OrderMassCancelReport_UnderlyingSecurityIDSource = 83,
+    FIX44_OrderMassCancelReport_NoUnderlyingSecurityAltID = 84,
+    FIX44_OrderMassCancelReport_UnderlyingProduct = 85,
+    FIX44_OrderMassCancelReport_UnderlyingCFICode = 86,
+    FIX44_OrderMassCancelReport_UnderlyingSecurityType = 87,
+    FIX44_OrderMassCancelReport_UnderlyingSecuritySubType = 88,
+    FIX44_OrderMassCancelReport_UnderlyingMaturityMonthYear = 89,
+    FIX44_OrderMassCancelReport_UnderlyingMaturityDate = 90,
+    FIX44_OrderMassCancelReport_UnderlyingCouponPaymentDate = 91,
+    FIX44_OrderMassCancelReport_UnderlyingIssueDate = 92,
+    FIX44_OrderMassCancelReport_UnderlyingRepoCollateralSecurityType = 93,
+    FIX44_OrderMassCancelReport_UnderlyingRepurchaseTerm = 94,
+    FIX44_OrderMassCancelReport_UnderlyingRepurchaseRate = 95,
+    FIX44_OrderMassCancelReport_UnderlyingFactor = 96,
+    FIX44_OrderMassCancelReport_UnderlyingCreditRating = 97,
+    FIX44_OrderMassCancelReport_UnderlyingInstrRegistry = 98,
+    FIX44_OrderMassCancelReport_UnderlyingCountryOfIssue = 99,
+    FIX44_OrderMassCancelReport_UnderlyingStateOrProvinceOfIssue = 100,
+    FIX44_OrderMassCancelReport_UnderlyingLocaleOfIssue = 101,
+    FIX44_OrderMassCancelReport_UnderlyingRedemptionDate = 102,
+    FIX44_OrderMassCancelReport_UnderlyingStrikePrice = 103,
+    FIX44_OrderMassCancelReport_UnderlyingStrikeCurrency = 104,
+    FIX44_OrderMassCancelReport_UnderlyingOptAttribute = 105,
+    FIX44_OrderMassCancelReport_UnderlyingContractMultiplier = 106,
+    FIX44_OrderMassCancelReport_UnderlyingCouponRate = 107,
+    FIX44_OrderMassCancelReport_UnderlyingSecurityExchange = 108,
+    FIX44_OrderMassCancelReport_UnderlyingIssuer = 109,
+    FIX44_OrderMassCancelReport_EncodedUnderlyingIssuerLen = 110,
+    FIX44_OrderMassCancelReport_EncodedUnderlyingIssuer = 111,
+    FIX44_OrderMassCancelReport_UnderlyingSecurityDesc = 112,
+    FIX44_OrderMassCancelReport_EncodedUnderlyingSecurityDescLen = 113,
+    FIX44_OrderMassCancelReport_EncodedUnderlyingSecurityDesc = 114,
+    FIX44_OrderMassCancelReport_UnderlyingCPProgram = 115,
+    FIX44_OrderMassCancelReport_UnderlyingCPRegType = 116,
+    FIX44_OrderMassCancelReport_UnderlyingCurrency = 117,
+    FIX44_OrderMassCancelReport_UnderlyingQty = 118,
+    FIX44_OrderMassCancelReport_UnderlyingPx = 119,
+    FIX44_OrderMassCancelReport_UnderlyingDirtyPrice = 120,
+    FIX44_OrderMassCancelReport_UnderlyingEndPrice = 121,
+    FIX44_OrderMassCancelReport_UnderlyingStartValue = 122,
+    FIX44_OrderMassCancelReport_UnderlyingCurrentValue = 123,
+    FIX44_OrderMassCancelReport_UnderlyingEndValue = 124,
+    FIX44_OrderMassCancelReport_NoUnderlyingStips = 125,
+    FIX44_OrderMassCancelReport_Side = 126,
+    FIX44_OrderMassCancelReport_TransactTime = 127,
+    FIX44_OrderMassCancelReport_Text = 128,
+    FIX44_OrderMassCancelReport_EncodedTextLen = 129,
+    FIX44_OrderMassCancelReport_EncodedText = 130,
+    FIX44_OrderMassCancelReport_SignatureLength = 131,
+    FIX44_OrderMassCancelReport_Signature = 132,
+    FIX44_OrderMassCancelReport_CheckSum = 133,
+};
+
+typedef struct _fix44OrderMassCancelReport {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	ClOrdID;
+    struct _ofixStrView	SecondaryClOrdID;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	SecondaryOrderID;
+    char	MassCancelRequestType;
+    char	MassCancelResponse;
+    char	MassCancelRejectReason;
+    int64_t	TotalAffectedOrders;
+    int64_t	NoAffectedOrders;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingSecuritySubType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixStrView	UnderlyingCouponPaymentDate;
+    struct _ofixStrView	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixStrView	UnderlyingRedemptionDate;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    struct _ofixStrView	UnderlyingStrikeCurrency;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    struct _ofixStrView	UnderlyingCPProgram;
+    struct _ofixStrView	UnderlyingCPRegType;
+    struct _ofixStrView	UnderlyingCurrency;
+    struct _ofixDecimal	UnderlyingQty;
+    struct _ofixDecimal	UnderlyingPx;
+    struct _ofixDecimal	UnderlyingDirtyPrice;
+    struct _ofixDecimal	UnderlyingEndPrice;
+    struct _ofixDecimal	UnderlyingStartValue;
+    struct _ofixDecimal	UnderlyingCurrentValue;
+    struct _ofixDecimal	UnderlyingEndValue;
+    int64_t	NoUnderlyingStips;
+    char	Side;
+    struct _ofixDate	TransactTime;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44OrderMassCancelReport;
+
+extern void	fix44_decode_OrderMassCancelReport(ofixErr err, fix44OrderMassCancelReport m, const char *raw, int len);
+extern void	fix44_decode_OrderMassCancelReport_msg(ofixErr err, fix44OrderMassCancelReport m, ofixMsg msg);
+extern ofixMsg	fix44_encode_OrderMassCancelReport(ofixErr err, fix44OrderMassCancelReport m);
+
+// NewOrderCross [s]
+enum {
+    FIX44_NewOrderCross_BeginString = 0,
+    FIX44_NewOrderCross_BodyLength = 1,
+    FIX44_NewOrderCross_MsgType = 2,
+    FIX44_NewOrderCross_SenderCompID = 3,
+    FIX44_NewOrderCross_TargetCompID = 4,
+    FIX44_NewOrderCross_OnBehalfOfCompID = 5,
+    FIX44_NewOrderCross_DeliverToCompID = 6,
+    FIX44_NewOrderCross_SecureDataLen = 7,
+    FIX44_NewOrderCross_SecureData = 8,
+    FIX44_NewOrderCross_MsgSeqNum = 9,
+    FIX44_NewOrderCross_SenderSubID = 10,
+    FIX44_NewOrderCross_SenderLocationID = 11,
+    FIX44_NewOrderCross_TargetSubID = 12,
+    FIX44_NewOrderCross_TargetLocationID = 13,
+    FIX44_NewOrderCross_OnBehalfOfSubID = 14,
+    FIX44_NewOrderCross_OnBehalfOfLocationID = 15,
+    FIX44_NewOrderCross_DeliverToSubID = 16,
+    FIX44_NewOrderCross_DeliverToLocationID = 17,
+    FIX44_NewOrderCross_PossDupFlag = 18,
+    FIX44_NewOrderCross_PossResend = 19,
+    FIX44_NewOrderCross_SendingTime = 20,
+    FIX44_NewOrderCross_OrigSendingTime = 21,
+    FIX44_NewOrderCross_XmlDataLen = 22,
+    FIX44_NewOrderCross_XmlData = 23,
+    FIX44_NewOrderCross_MessageEncoding = 24,
+    FIX44_NewOrderCross_LastMsgSeqNumProcessed = 25,
+    FIX44_NewOrderCross_NoHops = 26,
+    FIX44_NewOrderCross_CrossID = 27,
+    FIX44_NewOrderCross_CrossType = 28,
+    FIX44_NewOrderCross_CrossPrioritization = 29,
+    FIX44_NewOrderCross_NoSides = 30,
+    FIX44_NewOrderCross_Symbol = 31,
+    FIX44_NewOrderCross_SymbolSfx = 32,
+    FIX44_NewOrderCross_SecurityID = 33,
+    FIX44_NewOrderCross_SecurityIDSource = 34,
+    FIX44_NewOrderCross_NoSecurityAltID = 35,
+    FIX44_NewOrderCross_Product = 36,
+    FIX44_NewOrderCross_CFICode = 37,
+    FIX44_NewOrderCross_SecurityType = 38,
+    FIX44_NewOrderCross_SecuritySubType = 39,
+    FIX44_NewOrderCross_MaturityMonthYear = 40,
+    FIX44_NewOrderCross_MaturityDate = 41,
+    FIX44_NewOrderCross_CouponPaymentDate = 42,
+    FIX44_NewOrderCross_IssueDate = 43,
+    FIX44_NewOrderCross_RepoCollateralSecurityType = 44,
+    FIX44_NewOrderCross_RepurchaseTerm = 45,
+    FIX44_NewOrderCross_RepurchaseRate = 46,
+    FIX44_NewOrderCross_Factor = 47,
+    FIX44_NewOrderCross_CreditRating = 48,
+    FIX44_NewOrderCross_InstrRegistry = 49,
+    FIX44_NewOrderCross_CountryOfIssue = 50,
+    FIX44_NewOrderCross_StateOrProvinceOfIssue = 51,
+    FIX44_NewOrderCross_LocaleOfIssue = 52,
+    FIX44_NewOrderCross_RedemptionDate = 53,
+    FIX44_NewOrderCross_StrikePrice = 54,
+    FIX44_NewOrderCross_StrikeCurrency = 55,
+    FIX44_NewOrderCross_OptAttribute = 56,
+    FIX44_NewOrderCross_ContractMultiplier = 57,
+    FIX44_NewOrderCross_CouponRate = 58,
+    FIX44_NewOrderCross_SecurityExchange = 59,
+    FIX44_NewOrderCross_Issuer = 60,
+    FIX44_NewOrderCross_EncodedIssuerLen = 61,
+    FIX44_NewOrderCross_EncodedIssuer = 62,
+    FIX44_NewOrderCross_SecurityDesc = 63,
+    FIX44_NewOrderCross_EncodedSecurityDescLen = 64,
+    FIX44_NewOrderCross_EncodedSecurityDesc = 65,
+    FIX44_NewOrderCross_Pool = 66,
+    FIX44_NewOrderCross_ContractSettlMonth = 67,
+    FIX44_NewOrderCross_CPProgram = 68,
+    FIX44_NewOrderCross_CPRegType = 69,
+    FIX44_NewOrderCross_NoEvents = 70,
+    FIX44_NewOrderCross_DatedDate = 71,
+    FIX44_NewOrderCross_InterestAccrualDate = 72,
+    FIX44_NewOrderCross_NoUnderlyings = 73,
+    FIX44_NewOrderCross_NoLegs = 74,
+    FIX44_NewOrderCross_SettlType = 75,
+    FIX44_NewOrderCross_SettlDate = 76,
+    FIX44_NewOrderCross_HandlInst = 77,
+    FIX44_NewOrderCross_ExecInst = 78,
+    FIX44_NewOrderCross_MinQty = 79,
+    FIX44_NewOrderCross_MaxFloor = 80,
+    FIX44_NewOrderCross_ExDestination = 81,
+    FIX44_NewOrderCross_NoTradingSessions = 82,
+    FIX44_NewOrderCross_ProcessCode = 83,
+    FIX44_NewOrderCross_PrevClosePx = 84,
+    FIX44_NewOrderCross_LocateReqd = 85,
+    FIX44_NewOrderCross_TransactTime = 86,
+    FIX44_NewOrderCross_NoStipulations = 87,
+    FIX44_NewOrderCross_OrdType = 88,
+    FIX44_NewOrderCross_PriceType = 89,
+    FIX44_NewOrderCross_Price = 90,
+    FIX44_NewOrderCross_StopPx = 91,
+    FIX44_NewOrderCross_Spread = 92,
+    FIX44_NewOrderCross_BenchmarkCurveCurrency = 93,
+    FIX44_NewOrderCross_BenchmarkCurveName = 94,
+    FIX44_NewOrderCross_BenchmarkCurvePoint = 95,
+    FIX44_NewOrderCross_BenchmarkPrice = 96,
+    FIX44_NewOrderCross_BenchmarkPriceType = 97,
+    FIX44_NewOrderCross_BenchmarkSecurityID = 98,
+    FIX44_NewOrderCross_BenchmarkSecurityIDSource = 99,
+    FIX44_NewOrderCross_YieldType = 100,
+    FIX44_NewOrderCross_Yield = 101,
+    FIX44_NewOrderCross_YieldCalcDate = 102,
+    FIX44_NewOrderCross_YieldRedemptionDate = 103,
+    FIX44_NewOrderCross_YieldRedemptionPrice = 104,
+    FIX44_NewOrderCross_YieldRedemptionPriceType = 105,
+    FIX44_NewOrderCross_Currency = 106,
+    FIX44_NewOrderCross_ComplianceID = 107,
+    FIX44_NewOrderCross_IOIid = 108,
+    FIX44_NewOrderCross_QuoteID = 109,
+    FIX44_NewOrderCross_TimeInForce = 110,
+    FIX44_NewOrderCross_EffectiveTime = 111,
+    FIX44_NewOrderCross_ExpireDate = 112,
+    FIX44_NewOrderCross_ExpireTime = 113,
+    FIX44_NewOrderCross_GTBookingInst = 114,
+    FIX44_NewOrderCross_MaxShow = 115,
+    FIX44_NewOrderCross_PegOffsetValue = 116,
+    FIX44_NewOrderCross_PegMoveType = 117,
+    FIX44_NewOrderCross_PegOffsetType = 118,
+    FIX44_NewOrderCross_PegLimitType = 119,
+    FIX44_NewOrderCross_PegRoundDirection = 120,
+    FIX44_NewOrderCross_PegScope = 121,
+    FIX44_NewOrderCross_DiscretionInst = 122,
+    FIX44_NewOrderCross_DiscretionOffsetValue = 123,
+    FIX44_NewOrderCross_DiscretionMoveType = 124,
+    FIX44_NewOrderCross_DiscretionOffsetType = 125,
+    FIX44_NewOrderCross_DiscretionLimitType = 126,
+    FIX44_NewOrderCross_DiscretionRoundDirection = 127,
+    FIX44_NewOrderCross_DiscretionScope = 128,
+    FIX44_NewOrderCross_TargetStrategy = 129,
+    FIX44_NewOrderCross_TargetStrategyParameters = 130,
+    FIX44_NewOrderCross_ParticipationRate = 131,
+    FIX44_NewOrderCross_CancellationRights = 132,
+    FIX44_NewOrderCross_MoneyLaunderingStatus = 133,
+    FIX44_NewOrderCross_RegistID = 134,
+    FIX44_NewOrderCross_Designation = 135,
+    FIX44_NewOrderCross_SignatureLength = 136,
+    FIX44_NewOrderCross_Signature = 137,
+    FIX44_NewOrderCross_CheckSum = 138,
+};
+
+typedef struct _fix44NewOrderCross {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	CrossID;
+    int64_t	CrossType;
+    int64_t	CrossPrioritization;
+    int64_t	NoSides;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    struct _ofixDecimal	PrevClosePx;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	NoStipulations;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegOffsetValue;
+    int64_t	PegMoveType;
+    int64_t	PegOffsetType;
+    int64_t	PegLimitType;
+    int64_t	PegRoundDirection;
+    int64_t	PegScope;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffsetValue;
+    int64_t	DiscretionMoveType;
+    int64_t	DiscretionOffsetType;
+    int64_t	DiscretionLimitType;
+    int64_t	DiscretionRoundDirection;
+    int64_t	DiscretionScope;
+    int64_t	TargetStrategy;
+    struct _ofixStrView	TargetStrategyParameters;
+    struct _ofixDecimal	ParticipationRate;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44NewOrderCross;
+
+extern void	fix44_decode_NewOrderCross(ofixErr err, fix44NewOrderCross m, const char *raw, int len);
+extern void	fix44_decode_NewOrderCross_msg(ofixErr err, fix44NewOrderCross m, ofixMsg msg);
+extern ofixMsg	fix44_encode_NewOrderCross(ofixErr err, fix44NewOrderCross m);
+
+// CrossOrderCancelReplaceRequest [t]
+enum {
+    FIX44_CrossOrderCancelReplaceRequest_BeginString = 0,
+    FIX44_CrossOrderCancelReplaceRequest_BodyLength = 1,
+    FIX44_CrossOrderCancelReplaceRequest_MsgType = 2,
+    FIX44_CrossOrderCancelReplaceRequest_SenderCompID = 3,
+    FIX44_CrossOrderCancelReplaceRequest_TargetCompID = 4,
+    FIX44_CrossOrderCancelReplaceRequest_OnBehalfOfCompID = 5,
+    FIX44_CrossOrderCancelReplaceRequest_DeliverToCompID = 6,
+    FIX44_CrossOrderCancelReplaceRequest_SecureDataLen = 7,
+    FIX44_CrossOrderCancelReplaceRequest_SecureData = 8,
+    FIX44_CrossOrderCancelReplaceRequest_MsgSeqNum = 9,
+    FIX44_CrossOrderCancelReplaceRequest_SenderSubID = 10,
+    FIX44_CrossOrderCancelReplaceRequest_SenderLocationID = 11,
+    FIX44_CrossOrderCancelReplaceRequest_TargetSubID = 12,
+    FIX44_CrossOrderCancelReplaceRequest_TargetLocationID = 13,
+    FIX44_CrossOrderCancelReplaceRequest_OnBehalfOfSubID = 14,
+    FIX44_CrossOrderCancelReplaceRequest_OnBehalfOfLocationID = 15,
+    FIX44_CrossOrderCancelReplaceRequest_DeliverToSubID = 16,
+    FIX44_CrossOrderCancelReplaceRequest_DeliverToLocationID = 17,
+    FIX44_CrossOrderCancelReplaceRequest_PossDupFlag = 18,
+    FIX44_CrossOrderCancelReplaceRequest_PossResend = 19,
+    FIX44_CrossOrderCancelReplaceRequest_SendingTime = 20,
+    FIX44_CrossOrderCancelReplaceRequest_OrigSendingTime = 21,
+    FIX44_CrossOrderCancelReplaceRequest_XmlDataLen = 22,
+    FIX44_CrossOrderCancelReplaceRequest_XmlData = 23,
+    FIX44_CrossOrderCancelReplaceRequest_MessageEncoding = 24,
+    FIX44_CrossOrderCancelReplaceRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_CrossOrderCancelReplaceRequest_NoHops = 26,
+    FIX44_CrossOrderCancelReplaceRequest_OrderID = 27,
+    FIX44_CrossOrderCancelReplaceRequest_CrossID = 28,
+    FIX44_CrossOrderCancelReplaceRequest_OrigCrossID = 29,
+    FIX44_CrossOrderCancelReplaceRequest_CrossType = 30,
+    FIX44_CrossOrderCancelReplaceRequest_CrossPrioritization = 31,
+    FIX44_CrossOrderCancelReplaceRequest_NoSides = 32,
+    FIX44_CrossOrderCancelReplaceRequest_Symbol = 33,
+    FIX44_CrossOrderCancelReplaceRequest_SymbolSfx = 34,
+    FIX44_CrossOrderCancelReplaceRequest_SecurityID = 35,
+    FIX44_CrossOrderCancelReplaceRequest_SecurityIDSource = 36,
+    FIX44_CrossOrderCancelReplaceRequest_NoSecurityAltID = 37,
+    FIX44_CrossOrderCancelReplaceRequest_Product = 38,
+    FIX44_CrossOrderCancelReplaceRequest_CFICode = 39,
+    FIX44_CrossOrderCancelReplaceRequest_SecurityType = 40,
+    FIX44_CrossOrderCancelReplaceRequest_SecuritySubType = 41,
+    FIX44_CrossOrderCancelReplaceRequest_MaturityMonthYear = 42,
+    FIX44_CrossOrderCancelReplaceRequest_MaturityDate = 43,
+    FIX44_CrossOrderCancelReplaceRequest_CouponPaymentDate = 44,
+    FIX44_CrossOrderCancelReplaceRequest_IssueDate = 45,
+    FIX44_CrossOrderCancelReplaceRequest_RepoCollateralSecurityType = 46,
+    FIX44_CrossOrderCancelReplaceRequest_RepurchaseTerm = 47,
+    FIX44_CrossOrderCancelReplaceRequest_RepurchaseRate = 48,
+    FIX44_CrossOrderCancelReplaceRequest_Factor = 49,
+    FIX44_CrossOrderCancelReplaceRequest_CreditRating = 50,
+    FIX44_CrossOrderCancelReplaceRequest_InstrRegistry = 51,
+    FIX44_CrossOrderCancelReplaceRequest_CountryOfIssue = 52,
+    FIX44_CrossOrderCancelReplaceRequest_StateOrProvinceOfIssue = 53,
+    FIX44_CrossOrderCancelReplaceRequest_LocaleOfIssue = 54,
+    FIX44_CrossOrderCancelReplaceRequest_RedemptionDate = 55,
+    FIX44_CrossOrderCancelReplaceRequest_StrikePrice = 56,
+    FIX44_CrossOrderCancelReplaceRequest_StrikeCurrency = 57,
+    FIX44_CrossOrderCancelReplaceRequest_OptAttribute = 58,
+    FIX44_CrossOrderCancelReplaceRequest_ContractMultiplier = 59,
+    FIX44_CrossOrderCancelReplaceRequest_CouponRate = 60,
+    FIX44_CrossOrderCancelReplaceRequest_SecurityExchange = 61,
+    FIX44_CrossOrderCancelReplaceRequest_Issuer = 62,
+    FIX44_CrossOrderCancelReplaceRequest_EncodedIssuerLen = 63,
+    FIX44_CrossOrderCancelReplaceRequest_EncodedIssuer = 64,
+    FIX44_CrossOrderCancelReplaceRequest_SecurityDesc = 65,
+    FIX44_CrossOrderCancelReplaceRequest_EncodedSecurityDescLen = 66,
+    FIX44_CrossOrderCancelReplaceRequest_EncodedSecurityDesc = 67,
+    FIX44_CrossOrderCancelReplaceRequest_Pool = 68,
+    FIX44_CrossOrderCancelReplaceRequest_ContractSettlMonth = 69,
+    FIX44_CrossOrderCancelReplaceRequest_CPProgram = 70,
+    FIX44_CrossOrderCancelReplaceRequest_CPRegType = 71,
+    FIX44_CrossOrderCancelReplaceRequest_NoEvents = 72,
+    FIX44_CrossOrderCancelReplaceRequest_DatedDate = 73,
+    FIX44_CrossOrderCancelReplaceRequest_InterestAccrualDate = 74,
+    FIX44_CrossOrderCancelReplaceRequest_NoUnderlyings = 75,
+    FIX44_CrossOrderCancelReplaceRequest_NoLegs = 76,
+    FIX44_CrossOrderCancelReplaceRequest_SettlType = 77,
+    FIX44_CrossOrderCancelReplaceRequest_SettlDate = 78,
+    FIX44_CrossOrderCancelReplaceRequest_HandlInst = 79,
+    FIX44_CrossOrderCancelReplaceRequest_ExecInst = 80,
+    FIX44_CrossOrderCancelReplaceRequest_MinQty = 81,
+    FIX44_CrossOrderCancelReplaceRequest_MaxFloor = 82,
+    FIX44_CrossOrderCancelReplaceRequest_ExDestination = 83,
+    FIX44_CrossOrderCancelReplaceRequest_NoTradingSessions = 84,
+    FIX44_CrossOrderCancelReplaceRequest_ProcessCode = 85,
+    FIX44_CrossOrderCancelReplaceRequest_PrevClosePx = 86,
+    FIX44_CrossOrderCancelReplaceRequest_LocateReqd = 87,
+    FIX44_CrossOrderCancelReplaceRequest_TransactTime = 88,
+    FIX44_CrossOrderCancelReplaceRequest_NoStipulations = 89,
+    FIX44_CrossOrderCancelReplaceRequest_OrdType = 90,
+    FIX44_CrossOrderCancelReplaceRequest_PriceType = 91,
+    FIX44_CrossOrderCancelReplaceRequest_Price = 92,
+    FIX44_CrossOrderCancelReplaceRequest_StopPx = 93,
+    FIX44_CrossOrderCancelReplaceRequest_Spread = 94,
+    FIX44_CrossOrderCancelReplaceRequest_BenchmarkCurveCurrency = 95,
+    FIX44_CrossOrderCancelReplaceRequest_BenchmarkCurveName = 96,
+    FIX44_CrossOrderCancelReplaceRequest_BenchmarkCurvePoint = 97,
+    FIX44_CrossOrderCancelReplaceRequest_BenchmarkPrice = 98,
+    FIX44_CrossOrderCancelReplaceRequest_BenchmarkPriceType = 99,
+    FIX44_CrossOrderCancelReplaceRequest_BenchmarkSecurityID = 100,
+    FIX44_CrossOrderCancelReplaceRequest_BenchmarkSecurityIDSource = 101,
+    FIX44_CrossOrderCancelReplaceRequest_YieldType = 102,
+    FIX44_CrossOrderCancelReplaceRequest_Yield = 103,
+    FIX44_CrossOrderCancelReplaceRequest_YieldCalcDate = 104,
+    FIX44_CrossOrderCancelReplaceRequest_YieldRedemptionDate = 105,
+    FIX44_CrossOrderCancelReplaceRequest_YieldRedemptionPrice = 106,
+    FIX44_CrossOrderCancelReplaceRequest_YieldRedemptionPriceType = 107,
+    FIX44_CrossOrderCancelReplaceRequest_Currency = 108,
+    FIX44_CrossOrderCancelReplaceRequest_ComplianceID = 109,
+    FIX44_CrossOrderCancelReplaceRequest_IOIid = 110,
+    FIX44_CrossOrderCancelReplaceRequest_QuoteID = 111,
+    FIX44_CrossOrderCancelReplaceRequest_TimeInForce = 112,
+    FIX44_CrossOrderCancelReplaceRequest_EffectiveTime = 113,
+    FIX44_CrossOrderCancelReplaceRequest_ExpireDate = 114,
+    FIX44_CrossOrderCancelReplaceRequest_ExpireTime = 115,
+    FIX44_CrossOrderCancelReplaceRequest_GTBookingInst = 116,
+    FIX44_CrossOrderCancelReplaceRequest_MaxShow = 117,
+    FIX44_CrossOrderCancelReplaceRequest_PegOffsetValue = 118,
+    FIX44_CrossOrderCancelReplaceRequest_PegMoveType = 119,
+    FIX44_CrossOrderCancelReplaceRequest_PegOffsetType = 120,
+    FIX44_CrossOrderCancelReplaceRequest_PegLimitType = 121,
+    FIX44_CrossOrderCancelReplaceRequest_PegRoundDirection = 122,
+    FIX44_CrossOrderCancelReplaceRequest_PegScope = 123,
+    FIX44_CrossOrderCancelReplaceRequest_DiscretionInst = 124,
+    FIX44_CrossOrderCancelReplaceRequest_DiscretionOffsetValue = 125,
+    FIX44_CrossOrderCancelReplaceRequest_DiscretionMoveType = 126,
+    FIX44_CrossOrderCancelReplaceRequest_DiscretionOffsetType = 127,
+    FIX44_CrossOrderCancelReplaceRequest_DiscretionLimitType = 128,
+    FIX44_CrossOrderCancelReplaceRequest_DiscretionRoundDirection = 129,
+    FIX44_CrossOrderCancelReplaceRequest_DiscretionScope = 130,
+    FIX44_CrossOrderCancelReplaceRequest_TargetStrategy = 131,
+    FIX44_CrossOrderCancelReplaceRequest_TargetStrategyParameters = 132,
+    FIX44_CrossOrderCancelReplaceRequest_ParticipationRate = 133,
+    FIX44_CrossOrderCancelReplaceRequest_CancellationRights = 134,
+    FIX44_CrossOrderCancelReplaceRequest_MoneyLaunderingStatus = 135,
+    FIX44_CrossOrderCancelReplaceRequest_RegistID = 136,
+    FIX44_CrossOrderCancelReplaceRequest_Designation = 137,
+    FIX44_CrossOrderCancelReplaceRequest_SignatureLength = 138,
+    FIX44_CrossOrderCancelReplaceRequest_Signature = 139,
+    FIX44_CrossOrderCancelReplaceRequest_CheckSum = 140,
+};
+
+typedef struct _fix44CrossOrderCancelReplaceRequest {
+    uint64_t	present[3];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	CrossID;
+    struct _ofixStrView	OrigCrossID;
+    int64_t	CrossType;
+    int64_t	CrossPrioritization;
+    int64_t	NoSides;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    char	SettlType;
+    struct _ofixStrView	SettlDate;
+    char	HandlInst;
+    struct _ofixStrView	ExecInst;
+    struct _ofixDecimal	MinQty;
+    struct _ofixDecimal	MaxFloor;
+    struct _ofixStrView	ExDestination;
+    int64_t	NoTradingSessions;
+    char	ProcessCode;
+    struct _ofixDecimal	PrevClosePx;
+    char	LocateReqd;
+    struct _ofixDate	TransactTime;
+    int64_t	NoStipulations;
+    char	OrdType;
+    int64_t	PriceType;
+    struct _ofixDecimal	Price;
+    struct _ofixDecimal	StopPx;
+    struct _ofixDecimal	Spread;
+    struct _ofixStrView	BenchmarkCurveCurrency;
+    struct _ofixStrView	BenchmarkCurveName;
+    struct _ofixStrView	BenchmarkCurvePoint;
+    struct _ofixDecimal	BenchmarkPrice;
+    int64_t	BenchmarkPriceType;
+    struct _ofixStrView	BenchmarkSecurityID;
+    struct _ofixStrView	BenchmarkSecurityIDSource;
+    struct _ofixStrView	YieldType;
+    struct _ofixDecimal	Yield;
+    struct _ofixStrView	YieldCalcDate;
+    struct _ofixStrView	YieldRedemptionDate;
+    struct _ofixDecimal	YieldRedemptionPrice;
+    int64_t	YieldRedemptionPriceType;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	ComplianceID;
+    struct _ofixStrView	IOIid;
+    struct _ofixStrView	QuoteID;
+    char	TimeInForce;
+    struct _ofixDate	EffectiveTime;
+    struct _ofixStrView	ExpireDate;
+    struct _ofixDate	ExpireTime;
+    int64_t	GTBookingInst;
+    struct _ofixDecimal	MaxShow;
+    struct _ofixDecimal	PegOffsetValue;
+    int64_t	PegMoveType;
+    int64_t	PegOffsetType;
+    int64_t	PegLimitType;
+    int64_t	PegRoundDirection;
+    int64_t	PegScope;
+    char	DiscretionInst;
+    struct _ofixDecimal	DiscretionOffsetValue;
+    int64_t	DiscretionMoveType;
+    int64_t	DiscretionOffsetType;
+    int64_t	DiscretionLimitType;
+    int64_t	DiscretionRoundDirection;
+    int64_t	DiscretionScope;
+    int64_t	TargetStrategy;
+    struct _ofixStrView	TargetStrategyParameters;
+    struct _ofixDecimal	ParticipationRate;
+    char	CancellationRights;
+    char	MoneyLaunderingStatus;
+    struct _ofixStrView	RegistID;
+    struct _ofixStrView	Designation;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CrossOrderCancelReplaceRequest;
+
+extern void	fix44_decode_CrossOrderCancelReplaceRequest(ofixErr err, fix44CrossOrderCancelReplaceRequest m, const char *raw, int len);
+extern void	fix44_decode_CrossOrderCancelReplaceRequest_msg(ofixErr err, fix44CrossOrderCancelReplaceRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CrossOrderCancelReplaceRequest(ofixErr err, fix44CrossOrderCancelReplaceRequest m);
+
+// CrossOrderCancelRequest [u]
+enum {
+    FIX44_CrossOrderCancelRequest_BeginString = 0,
+    FIX44_CrossOrderCancelRequest_BodyLength = 1,
+    FIX44_CrossOrderCancelRequest_MsgType = 2,
+    FIX44_CrossOrderCancelRequest_SenderCompID = 3,
+    FIX44_CrossOrderCancelRequest_TargetCompID = 4,
+    FIX44_CrossOrderCancelRequest_OnBehalfOfCompID = 5,
+    FIX44_CrossOrderCancelRequest_DeliverToCompID = 6,
+    FIX44_CrossOrderCancelRequest_SecureDataLen = 7,
+    FIX44_CrossOrderCancelRequest_SecureData = 8,
+    FIX44_CrossOrderCancelRequest_MsgSeqNum = 9,
+    FIX44_CrossOrderCancelRequest_SenderSubID = 10,
+    FIX44_CrossOrderCancelRequest_SenderLocationID = 11,
+    FIX44_CrossOrderCancelRequest_TargetSubID = 12,
+    FIX44_CrossOrderCancelRequest_TargetLocationID = 13,
+    FIX44_CrossOrderCancelRequest_OnBehalfOfSubID = 14,
+    FIX44_CrossOrderCancelRequest_OnBehalfOfLocationID = 15,
+    FIX44_CrossOrderCancelRequest_DeliverToSubID = 16,
+    FIX44_CrossOrderCancelRequest_DeliverToLocationID = 17,
+    FIX44_CrossOrderCancelRequest_PossDupFlag = 18,
+    FIX44_CrossOrderCancelRequest_PossResend = 19,
+    FIX44_CrossOrderCancelRequest_SendingTime = 20,
+    FIX44_CrossOrderCancelRequest_OrigSendingTime = 21,
+    FIX44_CrossOrderCancelRequest_XmlDataLen = 22,
+    FIX44_CrossOrderCancelRequest_XmlData = 23,
+    FIX44_CrossOrderCancelRequest_MessageEncoding = 24,
+    FIX44_CrossOrderCancelRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_CrossOrderCancelRequest_NoHops = 26,
+    FIX44_CrossOrderCancelRequest_OrderID = 27,
+    FIX44_CrossOrderCancelRequest_CrossID = 28,
+    FIX44_CrossOrderCancelRequest_OrigCrossID = 29,
+    FIX44_CrossOrderCancelRequest_CrossType = 30,
+    FIX44_CrossOrderCancelRequest_CrossPrioritization = 31,
+    FIX44_CrossOrderCancelRequest_NoSides = 32,
+    FIX44_CrossOrderCancelRequest_Symbol = 33,
+    FIX44_CrossOrderCancelRequest_SymbolSfx = 34,
+    FIX44_CrossOrderCancelRequest_SecurityID = 35,
+    FIX44_CrossOrderCancelRequest_SecurityIDSource = 36,
+    FIX44_CrossOrderCancelRequest_NoSecurityAltID = 37,
+    FIX44_CrossOrderCancelRequest_Product = 38,
+    FIX44_CrossOrderCancelRequest_CFICode = 39,
+    FIX44_CrossOrderCancelRequest_SecurityType = 40,
+    FIX44_CrossOrderCancelRequest_SecuritySubType = 41,
+    FIX44_CrossOrderCancelRequest_MaturityMonthYear = 42,
+    FIX44_CrossOrderCancelRequest_MaturityDate = 43,
+    FIX44_CrossOrderCancelRequest_CouponPaymentDate = 44,
+    FIX44_CrossOrderCancelRequest_IssueDate = 45,
+    FIX44_CrossOrderCancelRequest_RepoCollateralSecurityType = 46,
+    FIX44_CrossOrderCancelRequest_RepurchaseTerm = 47,
+    FIX44_CrossOrderCancelRequest_RepurchaseRate = 48,
+    FIX44_CrossOrderCancelRequest_Factor = 49,
+    FIX44_CrossOrderCancelRequest_CreditRating = 50,
+    FIX44_CrossOrderCancelRequest_InstrRegistry = 51,
+    FIX44_CrossOrderCancelRequest_CountryOfIssue = 52,
+    FIX44_CrossOrderCancelRequest_StateOrProvinceOfIssue = 53,
+    FIX44_CrossOrderCancelRequest_LocaleOfIssue = 54,
+    FIX44_CrossOrderCancelRequest_RedemptionDate = 55,
+    FIX44_CrossOrderCancelRequest_StrikePrice = 56,
+    FIX44_CrossOrderCancelRequest_StrikeCurrency = 57,
+    FIX44_CrossOrderCancelRequest_OptAttribute = 58,
+    FIX44_CrossOrderCancelRequest_ContractMultiplier = 59,
+    FIX44_CrossOrderCancelRequest_CouponRate = 60,
+    FIX44_CrossOrderCancelRequest_SecurityExchange = 61,
+    FIX44_CrossOrderCancelRequest_Issuer = 62,
+    FIX44_CrossOrderCancelRequest_EncodedIssuerLen = 63,
+    FIX44_CrossOrderCancelRequest_EncodedIssuer = 64,
+    FIX44_CrossOrderCancelRequest_SecurityDesc = 65,
+    FIX44_CrossOrderCancelRequest_EncodedSecurityDescLen = 66,
+    FIX44_CrossOrderCancelRequest_EncodedSecurityDesc = 67,
+    FIX44_CrossOrderCancelRequest_Pool = 68,
+    FIX44_CrossOrderCancelRequest_ContractSettlMonth = 69,
+    FIX44_CrossOrderCancelRequest_CPProgram = 70,
+    FIX44_CrossOrderCancelRequest_CPRegType = 71,
+    FIX44_CrossOrderCancelRequest_NoEvents = 72,
+    FIX44_CrossOrderCancelRequest_DatedDate = 73,
+    FIX44_CrossOrderCancelRequest_InterestAccrualDate = 74,
+    FIX44_CrossOrderCancelRequest_NoUnderlyings = 75,
+    FIX44_CrossOrderCancelRequest_NoLegs = 76,
+    FIX44_CrossOrderCancelRequest_TransactTime = 77,
+    FIX44_CrossOrderCancelRequest_SignatureLength = 78,
+    FIX44_CrossOrderCancelRequest_Signature = 79,
+    FIX44_CrossOrderCancelRequest_CheckSum = 80,
+};
+
+typedef struct _fix44CrossOrderCancelRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	OrderID;
+    struct _ofixStrView	CrossID;
+    struct _ofixStrView	OrigCrossID;
+    int64_t	CrossType;
+    int64_t	CrossPrioritization;
+    int64_t	NoSides;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixDate	TransactTime;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44CrossOrderCancelRequest;
+
+extern void	fix44_decode_CrossOrderCancelRequest(ofixErr err, fix44CrossOrderCancelRequest m, const char *raw, int len);
+extern void	fix44_decode_CrossOrderCancelRequest_msg(ofixErr err, fix44CrossOrderCancelRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_CrossOrderCancelRequest(ofixErr err, fix44CrossOrderCancelRequest m);
+
+// SecurityTypeRequest [v]
+enum {
+    FIX44_SecurityTypeRequest_BeginString = 0,
+    FIX44_SecurityTypeRequest_BodyLength = 1,
+    FIX44_SecurityTypeRequest_MsgType = 2,
+    FIX44_SecurityTypeRequest_SenderCompID = 3,
+    FIX44_SecurityTypeRequest_TargetCompID = 4,
+    FIX44_SecurityTypeRequest_OnBehalfOfCompID = 5,
+    FIX44_SecurityTypeRequest_DeliverToCompID = 6,
+    FIX44_SecurityTypeRequest_SecureDataLen = 7,
+    FIX44_SecurityTypeRequest_SecureData = 8,
+    FIX44_SecurityTypeRequest_MsgSeqNum = 9,
+    FIX44_SecurityTypeRequest_SenderSubID = 10,
+    FIX44_SecurityTypeRequest_SenderLocationID = 11,
+    FIX44_SecurityTypeRequest_TargetSubID = 12,
+    FIX44_SecurityTypeRequest_TargetLocationID = 13,
+    FIX44_SecurityTypeRequest_OnBehalfOfSubID = 14,
+    FIX44_SecurityTypeRequest_OnBehalfOfLocationID = 15,
+    FIX44_SecurityTypeRequest_DeliverToSubID = 16,
+    FIX44_SecurityTypeRequest_DeliverToLocationID = 17,
+    FIX44_SecurityTypeRequest_PossDupFlag = 18,
+    FIX44_SecurityTypeRequest_PossResend = 19,
+    FIX44_SecurityTypeRequest_SendingTime = 20,
+    FIX44_SecurityTypeRequest_OrigSendingTime = 21,
+    FIX44_SecurityTypeRequest_XmlDataLen = 22,
+    FIX44_SecurityTypeRequest_XmlData = 23,
+    FIX44_SecurityTypeRequest_MessageEncoding = 24,
+    FIX44_SecurityTypeRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityTypeRequest_NoHops = 26,
+    FIX44_SecurityTypeRequest_SecurityReqID = 27,
+    FIX44_SecurityTypeRequest_Text = 28,
+    FIX44_SecurityTypeRequest_EncodedTextLen = 29,
+    FIX44_SecurityTypeRequest_EncodedText = 30,
+    FIX44_SecurityTypeRequest_TradingSessionID = 31,
+    FIX44_SecurityTypeRequest_TradingSessionSubID = 32,
+    FIX44_SecurityTypeRequest_Product = 33,
+    FIX44_SecurityTypeRequest_SecurityType = 34,
+    FIX44_SecurityTypeRequest_SecuritySubType = 35,
+    FIX44_SecurityTypeRequest_SignatureLength = 36,
+    FIX44_SecurityTypeRequest_Signature = 37,
+    FIX44_SecurityTypeRequest_CheckSum = 38,
+};
+
+typedef struct _fix44SecurityTypeRequest {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    int64_t	Product;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityTypeRequest;
+
+extern void	fix44_decode_SecurityTypeRequest(ofixErr err, fix44SecurityTypeRequest m, const char *raw, int len);
+extern void	fix44_decode_SecurityTypeRequest_msg(ofixErr err, fix44SecurityTypeRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityTypeRequest(ofixErr err, fix44SecurityTypeRequest m);
+
+// SecurityTypes [w]
+enum {
+    FIX44_SecurityTypes_BeginString = 0,
+    FIX44_SecurityTypes_BodyLength = 1,
+    FIX44_SecurityTypes_MsgType = 2,
+    FIX44_SecurityTypes_SenderCompID = 3,
+    FIX44_SecurityTypes_TargetCompID = 4,
+    FIX44_SecurityTypes_OnBehalfOfCompID = 5,
+    FIX44_SecurityTypes_DeliverToCompID = 6,
+    FIX44_SecurityTypes_SecureDataLen = 7,
+    FIX44_SecurityTypes_SecureData = 8,
+    FIX44_SecurityTypes_MsgSeqNum = 9,
+    FIX44_SecurityTypes_SenderSubID = 10,
+    FIX44_SecurityTypes_SenderLocationID = 11,
+    FIX44_SecurityTypes_TargetSubID = 12,
+    FIX44_SecurityTypes_TargetLocationID = 13,
+    FIX44_SecurityTypes_OnBehalfOfSubID = 14,
+    FIX44_SecurityTypes_OnBehalfOfLocationID = 15,
+    FIX44_SecurityTypes_DeliverToSubID = 16,
+    FIX44_SecurityTypes_DeliverToLocationID = 17,
+    FIX44_SecurityTypes_PossDupFlag = 18,
+    FIX44_SecurityTypes_PossResend = 19,
+    FIX44_SecurityTypes_SendingTime = 20,
+    FIX44_SecurityTypes_OrigSendingTime = 21,
+    FIX44_SecurityTypes_XmlDataLen = 22,
+    FIX44_SecurityTypes_XmlData = 23,
+    FIX44_SecurityTypes_MessageEncoding = 24,
+    FIX44_SecurityTypes_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityTypes_NoHops = 26,
+    FIX44_SecurityTypes_SecurityReqID = 27,
+    FIX44_SecurityTypes_SecurityResponseID = 28,
+    FIX44_SecurityTypes_SecurityResponseType = 29,
+    FIX44_SecurityTypes_TotNoSecurityTypes = 30,
+    FIX44_SecurityTypes_LastFragment = 31,
+    FIX44_SecurityTypes_NoSecurityTypes = 32,
+    FIX44_SecurityTypes_Text = 33,
+    FIX44_SecurityTypes_EncodedTextLen = 34,
+    FIX44_SecurityTypes_EncodedText = 35,
+    FIX44_SecurityTypes_TradingSessionID = 36,
+    FIX44_SecurityTypes_TradingSessionSubID = 37,
+    FIX44_SecurityTypes_SubscriptionRequestType = 38,
+    FIX44_SecurityTypes_SignatureLength = 39,
+    FIX44_SecurityTypes_Signature = 40,
+    FIX44_SecurityTypes_CheckSum = 41,
+};
+
+typedef struct _fix44SecurityTypes {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityResponseType;
+    int64_t	TotNoSecurityTypes;
+    char	LastFragment;
+    int64_t	NoSecurityTypes;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityTypes;
+
+extern void	fix44_decode_SecurityTypes(ofixErr err, fix44SecurityTypes m, const char *raw, int len);
+extern void	fix44_decode_SecurityTypes_msg(ofixErr err, fix44SecurityTypes m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityTypes(ofixErr err, fix44SecurityTypes m);
+
+// SecurityListRequest [x]
+enum {
+    FIX44_SecurityListRequest_BeginString = 0,
+    FIX44_SecurityListRequest_BodyLength = 1,
+    FIX44_SecurityListRequest_MsgType = 2,
+    FIX44_SecurityListRequest_SenderCompID = 3,
+    FIX44_SecurityListRequest_TargetCompID = 4,
+    FIX44_SecurityListRequest_OnBehalfOfCompID = 5,
+    FIX44_SecurityListRequest_DeliverToCompID = 6,
+    FIX44_SecurityListRequest_SecureDataLen = 7,
+    FIX44_SecurityListRequest_SecureData = 8,
+    FIX44_SecurityListRequest_MsgSeqNum = 9,
+    FIX44_SecurityListRequest_SenderSubID = 10,
+    FIX44_SecurityListRequest_SenderLocationID = 11,
+    FIX44_SecurityListRequest_TargetSubID = 12,
+    FIX44_SecurityListRequest_TargetLocationID = 13,
+    FIX44_SecurityListRequest_OnBehalfOfSubID = 14,
+    FIX44_SecurityListRequest_OnBehalfOfLocationID = 15,
+    FIX44_SecurityListRequest_DeliverToSubID = 16,
+    FIX44_SecurityListRequest_DeliverToLocationID = 17,
+    FIX44_SecurityListRequest_PossDupFlag = 18,
+    FIX44_SecurityListRequest_PossResend = 19,
+    FIX44_SecurityListRequest_SendingTime = 20,
+    FIX44_SecurityListRequest_OrigSendingTime = 21,
+    FIX44_SecurityListRequest_XmlDataLen = 22,
+    FIX44_SecurityListRequest_XmlData = 23,
+    FIX44_SecurityListRequest_MessageEncoding = 24,
+    FIX44_SecurityListRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityListRequest_NoHops = 26,
+    FIX44_SecurityListRequest_SecurityReqID = 27,
+    FIX44_SecurityListRequest_SecurityListRequestType = 28,
+    FIX44_SecurityListRequest_Symbol = 29,
+    FIX44_SecurityListRequest_SymbolSfx = 30,
+    FIX44_SecurityListRequest_SecurityID = 31,
+    FIX44_SecurityListRequest_SecurityIDSource = 32,
+    FIX44_SecurityListRequest_NoSecurityAltID = 33,
+    FIX44_SecurityListRequest_Product = 34,
+    FIX44_SecurityListRequest_CFICode = 35,
+    FIX44_SecurityListRequest_SecurityType = 36,
+    FIX44_SecurityListRequest_SecuritySubType = 37,
+    FIX44_SecurityListRequest_MaturityMonthYear = 38,
+    FIX44_SecurityListRequest_MaturityDate = 39,
+    FIX44_SecurityListRequest_CouponPaymentDate = 40,
+    FIX44_SecurityListRequest_IssueDate = 41,
+    FIX44_SecurityListRequest_RepoCollateralSecurityType = 42,
+    FIX44_SecurityListRequest_RepurchaseTerm = 43,
+    FIX44_SecurityListRequest_RepurchaseRate = 44,
+    FIX44_SecurityListRequest_Factor = 45,
+    FIX44_SecurityListRequest_CreditRating = 46,
+    FIX44_SecurityListRequest_InstrRegistry = 47,
+    FIX44_SecurityListRequest_CountryOfIssue = 48,
+    FIX44_SecurityListRequest_StateOrProvinceOfIssue = 49,
+    FIX44_SecurityListRequest_LocaleOfIssue = 50,
+    FIX44_SecurityListRequest_RedemptionDate = 51,
+    FIX44_SecurityListRequest_StrikePrice = 52,
+    FIX44_SecurityListRequest_StrikeCurrency = 53,
+    FIX44_SecurityListRequest_OptAttribute = 54,
+    FIX44_SecurityListRequest_ContractMultiplier = 55,
+    FIX44_SecurityListRequest_CouponRate = 56,
+    FIX44_SecurityListRequest_SecurityExchange = 57,
+    FIX44_SecurityListRequest_Issuer = 58,
+    FIX44_SecurityListRequest_EncodedIssuerLen = 59,
+    FIX44_SecurityListRequest_EncodedIssuer = 60,
+    FIX44_SecurityListRequest_SecurityDesc = 61,
+    FIX44_SecurityListRequest_EncodedSecurityDescLen = 62,
+    FIX44_SecurityListRequest_EncodedSecurityDesc = 63,
+    FIX44_SecurityListRequest_Pool = 64,
+    FIX44_SecurityListRequest_ContractSettlMonth = 65,
+    FIX44_SecurityListRequest_CPProgram = 66,
+    FIX44_SecurityListRequest_CPRegType = 67,
+    FIX44_SecurityListRequest_NoEvents = 68,
+    FIX44_SecurityListRequest_DatedDate = 69,
+    FIX44_SecurityListRequest_InterestAccrualDate = 70,
+    FIX44_SecurityListRequest_DeliveryForm = 71,
+    FIX44_SecurityListRequest_PctAtRisk = 72,
+    FIX44_SecurityListRequest_NoInstrAttrib = 73,
+    FIX44_SecurityListRequest_AgreementDesc = 74,
+    FIX44_SecurityListRequest_AgreementID = 75,
+    FIX44_SecurityListRequest_AgreementDate = 76,
+    FIX44_SecurityListRequest_AgreementCurrency = 77,
+    FIX44_SecurityListRequest_TerminationType = 78,
+    FIX44_SecurityListRequest_StartDate = 79,
+    FIX44_SecurityListRequest_EndDate = 80,
+    FIX44_SecurityListRequest_DeliveryType = 81,
+    FIX44_SecurityListRequest_MarginRatio = 82,
+    FIX44_SecurityListRequest_NoUnderlyings = 83,
+    FIX44_SecurityListRequest_NoLegs = 84,
+    FIX44_SecurityListRequest_Currency = 85,
+    FIX44_SecurityListRequest_Text = 86,
+    FIX44_SecurityListRequest_EncodedTextLen = 87,
+    FIX44_SecurityListRequest_EncodedText = 88,
+    FIX44_SecurityListRequest_TradingSessionID = 89,
+    FIX44_SecurityListRequest_TradingSessionSubID = 90,
+    FIX44_SecurityListRequest_SubscriptionRequestType = 91,
+    FIX44_SecurityListRequest_SignatureLength = 92,
+    FIX44_SecurityListRequest_Signature = 93,
+    FIX44_SecurityListRequest_CheckSum = 94,
+};
+
+typedef struct _fix44SecurityListRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    int64_t	SecurityListRequestType;
+    struct _ofixStrView	Symbol;
+    struct _ofixStrView	SymbolSfx;
+    struct _ofixStrView	SecurityID;
+    struct _ofixStrView	SecurityIDSource;
+    int64_t	NoSecurityAltID;
+    int64_t	Product;
+    struct _ofixStrView	CFICode;
+    struct _ofixStrView	SecurityType;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	MaturityMonthYear;
+    struct _ofixStrView	MaturityDate;
+    struct _ofixStrView	CouponPaymentDate;
+    struct _ofixStrView	IssueDate;
+    int64_t	RepoCollateralSecurityType;
+    int64_t	RepurchaseTerm;
+    struct _ofixDecimal	RepurchaseRate;
+    struct _ofixDecimal	Factor;
+    struct _ofixStrView	CreditRating;
+    struct _ofixStrView	InstrRegistry;
+    struct _ofixStrView	CountryOfIssue;
+    struct _ofixStrView	StateOrProvinceOfIssue;
+    struct _ofixStrView	LocaleOfIssue;
+    struct _ofixStrView	RedemptionDate;
+    struct _ofixDecimal	StrikePrice;
+    struct _ofixStrView	StrikeCurrency;
+    char	OptAttribute;
+    struct _ofixDecimal	ContractMultiplier;
+    struct _ofixDecimal	CouponRate;
+    struct _ofixStrView	SecurityExchange;
+    struct _ofixStrView	Issuer;
+    int64_t	EncodedIssuerLen;
+    struct _ofixStrView	EncodedIssuer;
+    struct _ofixStrView	SecurityDesc;
+    int64_t	EncodedSecurityDescLen;
+    struct _ofixStrView	EncodedSecurityDesc;
+    struct _ofixStrView	Pool;
+    struct _ofixStrView	ContractSettlMonth;
+    int64_t	CPProgram;
+    struct _ofixStrView	CPRegType;
+    int64_t	NoEvents;
+    struct _ofixStrView	DatedDate;
+    struct _ofixStrView	InterestAccrualDate;
+    int64_t	DeliveryForm;
+    struct _ofixDecimal	PctAtRisk;
+    int64_t	NoInstrAttrib;
+    struct _ofixStrView	AgreementDesc;
+    struct _ofixStrView	AgreementID;
+    struct _ofixStrView	AgreementDate;
+    struct _ofixStrView	AgreementCurrency;
+    int64_t	TerminationType;
+    struct _ofixStrView	StartDate;
+    struct _ofixStrView	EndDate;
+    int64_t	DeliveryType;
+    struct _ofixDecimal	MarginRatio;
+    int64_t	NoUnderlyings;
+    int64_t	NoLegs;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityListRequest;
+
+extern void	fix44_decode_SecurityListRequest(ofixErr err, fix44SecurityListRequest m, const char *raw, int len);
+extern void	fix44_decode_SecurityListRequest_msg(ofixErr err, fix44SecurityListRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityListRequest(ofixErr err, fix44SecurityListRequest m);
+
+// SecurityList [y]
+enum {
+    FIX44_SecurityList_BeginString = 0,
+    FIX44_SecurityList_BodyLength = 1,
+    FIX44_SecurityList_MsgType = 2,
+    FIX44_SecurityList_SenderCompID = 3,
+    FIX44_SecurityList_TargetCompID = 4,
+    FIX44_SecurityList_OnBehalfOfCompID = 5,
+    FIX44_SecurityList_DeliverToCompID = 6,
+    FIX44_SecurityList_SecureDataLen = 7,
+    FIX44_SecurityList_SecureData = 8,
+    FIX44_SecurityList_MsgSeqNum = 9,
+    FIX44_SecurityList_SenderSubID = 10,
+    FIX44_SecurityList_SenderLocationID = 11,
+    FIX44_SecurityList_TargetSubID = 12,
+    FIX44_SecurityList_TargetLocationID = 13,
+    FIX44_SecurityList_OnBehalfOfSubID = 14,
+    FIX44_SecurityList_OnBehalfOfLocationID = 15,
+    FIX44_SecurityList_DeliverToSubID = 16,
+    FIX44_SecurityList_DeliverToLocationID = 17,
+    FIX44_SecurityList_PossDupFlag = 18,
+    FIX44_SecurityList_PossResend = 19,
+    FIX44_SecurityList_SendingTime = 20,
+    FIX44_SecurityList_OrigSendingTime = 21,
+    FIX44_SecurityList_XmlDataLen = 22,
+    FIX44_SecurityList_XmlData = 23,
+    FIX44_SecurityList_MessageEncoding = 24,
+    FIX44_SecurityList_LastMsgSeqNumProcessed = 25,
+    FIX44_SecurityList_NoHops = 26,
+    FIX44_SecurityList_SecurityReqID = 27,
+    FIX44_SecurityList_SecurityResponseID = 28,
+    FIX44_SecurityList_SecurityRequestResult = 29,
+    FIX44_SecurityList_TotNoRelatedSym = 30,
+    FIX44_SecurityList_LastFragment = 31,
+    FIX44_SecurityList_NoRelatedSym = 32,
+    FIX44_SecurityList_SignatureLength = 33,
+    FIX44_SecurityList_Signature = 34,
+    FIX44_SecurityList_CheckSum = 35,
+};
+
+typedef struct _fix44SecurityList {
+    uint64_t	present[1];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    struct _ofixStrView	SecurityResponseID;
+    int64_t	SecurityRequestResult;
+    int64_t	TotNoRelatedSym;
+    char	LastFragment;
+    int64_t	NoRelatedSym;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44SecurityList;
+
+extern void	fix44_decode_SecurityList(ofixErr err, fix44SecurityList m, const char *raw, int len);
+extern void	fix44_decode_SecurityList_msg(ofixErr err, fix44SecurityList m, ofixMsg msg);
+extern ofixMsg	fix44_encode_SecurityList(ofixErr err, fix44SecurityList m);
+
+// DerivativeSecurityListRequest [z]
+enum {
+    FIX44_DerivativeSecurityListRequest_BeginString = 0,
+    FIX44_DerivativeSecurityListRequest_BodyLength = 1,
+    FIX44_DerivativeSecurityListRequest_MsgType = 2,
+    FIX44_DerivativeSecurityListRequest_SenderCompID = 3,
+    FIX44_DerivativeSecurityListRequest_TargetCompID = 4,
+    FIX44_DerivativeSecurityListRequest_OnBehalfOfCompID = 5,
+    FIX44_DerivativeSecurityListRequest_DeliverToCompID = 6,
+    FIX44_DerivativeSecurityListRequest_SecureDataLen = 7,
+    FIX44_DerivativeSecurityListRequest_SecureData = 8,
+    FIX44_DerivativeSecurityListRequest_MsgSeqNum = 9,
+    FIX44_DerivativeSecurityListRequest_SenderSubID = 10,
+    FIX44_DerivativeSecurityListRequest_SenderLocationID = 11,
+    FIX44_DerivativeSecurityListRequest_TargetSubID = 12,
+    FIX44_DerivativeSecurityListRequest_TargetLocationID = 13,
+    FIX44_DerivativeSecurityListRequest_OnBehalfOfSubID = 14,
+    FIX44_DerivativeSecurityListRequest_OnBehalfOfLocationID = 15,
+    FIX44_DerivativeSecurityListRequest_DeliverToSubID = 16,
+    FIX44_DerivativeSecurityListRequest_DeliverToLocationID = 17,
+    FIX44_DerivativeSecurityListRequest_PossDupFlag = 18,
+    FIX44_DerivativeSecurityListRequest_PossResend = 19,
+    FIX44_DerivativeSecurityListRequest_SendingTime = 20,
+    FIX44_DerivativeSecurityListRequest_OrigSendingTime = 21,
+    FIX44_DerivativeSecurityListRequest_XmlDataLen = 22,
+    FIX44_DerivativeSecurityListRequest_XmlData = 23,
+    FIX44_DerivativeSecurityListRequest_MessageEncoding = 24,
+    FIX44_DerivativeSecurityListRequest_LastMsgSeqNumProcessed = 25,
+    FIX44_DerivativeSecurityListRequest_NoHops = 26,
+    FIX44_DerivativeSecurityListRequest_SecurityReqID = 27,
+    FIX44_DerivativeSecurityListRequest_SecurityListRequestType = 28,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSymbol = 29,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSymbolSfx = 30,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSecurityID = 31,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSecurityIDSource = 32,
+    FIX44_DerivativeSecurityListRequest_NoUnderlyingSecurityAltID = 33,
+    FIX44_DerivativeSecurityListRequest_UnderlyingProduct = 34,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCFICode = 35,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSecurityType = 36,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSecuritySubType = 37,
+    FIX44_DerivativeSecurityListRequest_UnderlyingMaturityMonthYear = 38,
+    FIX44_DerivativeSecurityListRequest_UnderlyingMaturityDate = 39,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCouponPaymentDate = 40,
+    FIX44_DerivativeSecurityListRequest_UnderlyingIssueDate = 41,
+    FIX44_DerivativeSecurityListRequest_UnderlyingRepoCollateralSecurityType = 42,
+    FIX44_DerivativeSecurityListRequest_UnderlyingRepurchaseTerm = 43,
+    FIX44_DerivativeSecurityListRequest_UnderlyingRepurchaseRate = 44,
+    FIX44_DerivativeSecurityListRequest_UnderlyingFactor = 45,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCreditRating = 46,
+    FIX44_DerivativeSecurityListRequest_UnderlyingInstrRegistry = 47,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCountryOfIssue = 48,
+    FIX44_DerivativeSecurityListRequest_UnderlyingStateOrProvinceOfIssue = 49,
+    FIX44_DerivativeSecurityListRequest_UnderlyingLocaleOfIssue = 50,
+    FIX44_DerivativeSecurityListRequest_UnderlyingRedemptionDate = 51,
+    FIX44_DerivativeSecurityListRequest_UnderlyingStrikePrice = 52,
+    FIX44_DerivativeSecurityListRequest_UnderlyingStrikeCurrency = 53,
+    FIX44_DerivativeSecurityListRequest_UnderlyingOptAttribute = 54,
+    FIX44_DerivativeSecurityListRequest_UnderlyingContractMultiplier = 55,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCouponRate = 56,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSecurityExchange = 57,
+    FIX44_DerivativeSecurityListRequest_UnderlyingIssuer = 58,
+    FIX44_DerivativeSecurityListRequest_EncodedUnderlyingIssuerLen = 59,
+    FIX44_DerivativeSecurityListRequest_EncodedUnderlyingIssuer = 60,
+    FIX44_DerivativeSecurityListRequest_UnderlyingSecurityDesc = 61,
+    FIX44_DerivativeSecurityListRequest_EncodedUnderlyingSecurityDescLen = 62,
+    FIX44_DerivativeSecurityListRequest_EncodedUnderlyingSecurityDesc = 63,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCPProgram = 64,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCPRegType = 65,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCurrency = 66,
+    FIX44_DerivativeSecurityListRequest_UnderlyingQty = 67,
+    FIX44_DerivativeSecurityListRequest_UnderlyingPx = 68,
+    FIX44_DerivativeSecurityListRequest_UnderlyingDirtyPrice = 69,
+    FIX44_DerivativeSecurityListRequest_UnderlyingEndPrice = 70,
+    FIX44_DerivativeSecurityListRequest_UnderlyingStartValue = 71,
+    FIX44_DerivativeSecurityListRequest_UnderlyingCurrentValue = 72,
+    FIX44_DerivativeSecurityListRequest_UnderlyingEndValue = 73,
+    FIX44_DerivativeSecurityListRequest_NoUnderlyingStips = 74,
+    FIX44_DerivativeSecurityListRequest_SecuritySubType = 75,
+    FIX44_DerivativeSecurityListRequest_Currency = 76,
+    FIX44_DerivativeSecurityListRequest_Text = 77,
+    FIX44_DerivativeSecurityListRequest_EncodedTextLen = 78,
+    FIX44_DerivativeSecurityListRequest_EncodedText = 79,
+    FIX44_DerivativeSecurityListRequest_TradingSessionID = 80,
+    FIX44_DerivativeSecurityListRequest_TradingSessionSubID = 81,
+    FIX44_DerivativeSecurityListRequest_SubscriptionRequestType = 82,
+    FIX44_DerivativeSecurityListRequest_SignatureLength = 83,
+    FIX44_DerivativeSecurityListRequest_Signature = 84,
+    FIX44_DerivativeSecurityListRequest_CheckSum = 85,
+};
+
+typedef struct _fix44DerivativeSecurityListRequest {
+    uint64_t	present[2];
+    struct _ofixStrView	BeginString;
+    int64_t	BodyLength;
+    struct _ofixStrView	MsgType;
+    struct _ofixStrView	SenderCompID;
+    struct _ofixStrView	TargetCompID;
+    struct _ofixStrView	OnBehalfOfCompID;
+    struct _ofixStrView	DeliverToCompID;
+    int64_t	SecureDataLen;
+    struct _ofixStrView	SecureData;
+    int64_t	MsgSeqNum;
+    struct _ofixStrView	SenderSubID;
+    struct _ofixStrView	SenderLocationID;
+    struct _ofixStrView	TargetSubID;
+    struct _ofixStrView	TargetLocationID;
+    struct _ofixStrView	OnBehalfOfSubID;
+    struct _ofixStrView	OnBehalfOfLocationID;
+    struct _ofixStrView	DeliverToSubID;
+    struct _ofixStrView	DeliverToLocationID;
+    char	PossDupFlag;
+    char	PossResend;
+    struct _ofixDate	SendingTime;
+    struct _ofixDate	OrigSendingTime;
+    int64_t	XmlDataLen;
+    struct _ofixStrView	XmlData;
+    struct _ofixStrView	MessageEncoding;
+    int64_t	LastMsgSeqNumProcessed;
+    int64_t	NoHops;
+    struct _ofixStrView	SecurityReqID;
+    int64_t	SecurityListRequestType;
+    struct _ofixStrView	UnderlyingSymbol;
+    struct _ofixStrView	UnderlyingSymbolSfx;
+    struct _ofixStrView	UnderlyingSecurityID;
+    struct _ofixStrView	UnderlyingSecurityIDSource;
+    int64_t	NoUnderlyingSecurityAltID;
+    int64_t	UnderlyingProduct;
+    struct _ofixStrView	UnderlyingCFICode;
+    struct _ofixStrView	UnderlyingSecurityType;
+    struct _ofixStrView	UnderlyingSecuritySubType;
+    struct _ofixStrView	UnderlyingMaturityMonthYear;
+    struct _ofixStrView	UnderlyingMaturityDate;
+    struct _ofixStrView	UnderlyingCouponPaymentDate;
+    struct _ofixStrView	UnderlyingIssueDate;
+    int64_t	UnderlyingRepoCollateralSecurityType;
+    int64_t	UnderlyingRepurchaseTerm;
+    struct _ofixDecimal	UnderlyingRepurchaseRate;
+    struct _ofixDecimal	UnderlyingFactor;
+    struct _ofixStrView	UnderlyingCreditRating;
+    struct _ofixStrView	UnderlyingInstrRegistry;
+    struct _ofixStrView	UnderlyingCountryOfIssue;
+    struct _ofixStrView	UnderlyingStateOrProvinceOfIssue;
+    struct _ofixStrView	UnderlyingLocaleOfIssue;
+    struct _ofixStrView	UnderlyingRedemptionDate;
+    struct _ofixDecimal	UnderlyingStrikePrice;
+    struct _ofixStrView	UnderlyingStrikeCurrency;
+    char	UnderlyingOptAttribute;
+    struct _ofixDecimal	UnderlyingContractMultiplier;
+    struct _ofixDecimal	UnderlyingCouponRate;
+    struct _ofixStrView	UnderlyingSecurityExchange;
+    struct _ofixStrView	UnderlyingIssuer;
+    int64_t	EncodedUnderlyingIssuerLen;
+    struct _ofixStrView	EncodedUnderlyingIssuer;
+    struct _ofixStrView	UnderlyingSecurityDesc;
+    int64_t	EncodedUnderlyingSecurityDescLen;
+    struct _ofixStrView	EncodedUnderlyingSecurityDesc;
+    struct _ofixStrView	UnderlyingCPProgram;
+    struct _ofixStrView	UnderlyingCPRegType;
+    struct _ofixStrView	UnderlyingCurrency;
+    struct _ofixDecimal	UnderlyingQty;
+    struct _ofixDecimal	UnderlyingPx;
+    struct _ofixDecimal	UnderlyingDirtyPrice;
+    struct _ofixDecimal	UnderlyingEndPrice;
+    struct _ofixDecimal	UnderlyingStartValue;
+    struct _ofixDecimal	UnderlyingCurrentValue;
+    struct _ofixDecimal	UnderlyingEndValue;
+    int64_t	NoUnderlyingStips;
+    struct _ofixStrView	SecuritySubType;
+    struct _ofixStrView	Currency;
+    struct _ofixStrView	Text;
+    int64_t	EncodedTextLen;
+    struct _ofixStrView	EncodedText;
+    struct _ofixStrView	TradingSessionID;
+    struct _ofixStrView	TradingSessionSubID;
+    char	SubscriptionRequestType;
+    int64_t	SignatureLength;
+    struct _ofixStrView	Signature;
+    struct _ofixStrView	CheckSum;
+} *fix44DerivativeSecurityListRequest;
+
+extern void	fix44_decode_DerivativeSecurityListRequest(ofixErr err, fix44DerivativeSecurityListRequest m, const char *raw, int len);
+extern void	fix44_decode_DerivativeSecurityListRequest_msg(ofixErr err, fix44DerivativeSecurityListRequest m, ofixMsg msg);
+extern ofixMsg	fix44_encode_DerivativeSecurityListRequest(ofixErr err, fix44DerivativeSecurityListRequest m);
+
+#endif /* __OFIX_FIX44MSGS_H__ */
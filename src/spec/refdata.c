@@ -1,5 +1,6 @@
 // Copyright 2009 by Peter Ohler, All Rights Reserved
 
+#include <pthread.h>
 #include <stdio.h>
 
 #include "ofix/versionspec.h"
@@ -19,18 +20,36 @@ static ofixVersionSpec	specs[] = {
     0
 };
     
+static pthread_once_t	init_once = PTHREAD_ONCE_INIT;
+static struct _ofixErr	init_err = OFIX_ERR_INIT;
+
+static void
+init_specs() {
+    ofixVersionSpec	*s;
+
+    for (s = specs; 0 != *s; s++) {
+	ofix_version_spec_prepare(&init_err, *s);
+    }
+}
+
+void
+ofix_init(ofixErr err) {
+    if (NULL != err && OFIX_OK != err->code) {
+	return;
+    }
+    pthread_once(&init_once, init_specs);
+    if (NULL != err && OFIX_OK != init_err.code) {
+	*err = init_err;
+    }
+}
+
 ofixVersionSpec
 ofix_get_spec(ofixErr err, int major, int minor) {
     ofixVersionSpec	*s;
-    
-    for (s = specs; 0 != s; s++) {
+
+    pthread_once(&init_once, init_specs);
+    for (s = specs; 0 != *s; s++) {
 	if (major == (*s)->major && minor == (*s)->minor) {
-	    if (!(*s)->ready) {
-		ofix_version_spec_prepare(err, *s);
-		if (NULL != err && OFIX_OK != err->code) {
-		    return NULL;
-		}
-	    }
 	    return *s;
 	}
     }
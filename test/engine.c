@@ -23,8 +23,21 @@
 extern ofixVersionSpec	ofix_get_spec(ofixErr err, int major, int minor);
 extern void		_ofix_client_raw_send(ofixErr err, ofixClient client, ofixMsg msg);
 extern ofixSession	_ofix_client_get_session(ofixClient client);
+extern int		_ofix_engine_uring_cnt(ofixEngine eng);
 
 static const char	*client_storage = "client_storage.fix";
+// when positive the server runs sessions on a reactor with this many threads
+static int		reactor_threads = 0;
+static bool		reactor_uring = false;
+static int		send_delay = 0;
+// when true the client spins on its socket pinned to the first core
+static bool		busy_poll = false;
+// when true the server stores sessions in a shared journal
+static bool		use_journal = false;
+// when true the client takes a while with each message
+static bool		slow_client = false;
+// when true the server takes a while with each message
+static bool		slow_server = false;
 
 static char*
 load_fix_file(const char *filename) {
@@ -84,6 +97,9 @@ server_cb(ofixSession session, ofixMsg msg, void *ctx) {
 	//printf("*** Received a %s message.\n", mt);
 	return true;
     }
+    if (slow_server) {
+	dsleep(0.002);
+    }
     reply = ofix_msg_create_from_spec(&err, spec, 16);
     if (OFIX_OK != err.code || NULL == reply) {
 	printf("Failed to create message [%d] %s\n", err.code, err.msg);
@@ -121,6 +137,9 @@ client_cb(ofixSession session, ofixMsg msg, void *ctx) {
 
     //printf("*** client callback: %s\n", s);
     free(s);
+    if (slow_client) {
+	dsleep(0.002);
+    }
     return true;
 }
 
@@ -154,6 +173,27 @@ create_client_server(ofixErr err,
     }
     ofix_engine_on_recv(*server, server_cb, NULL);
     ofix_engine_set_log(*server, log_on, log, stdout);
+    ofix_engine_set_send_delay(*server, send_delay);
+    if (use_journal) {
+	ofix_engine_set_journal(err, *server, OFIX_SYNC_NONE, 0);
+    }
+    if (0 < reactor_threads) {
+	if (reactor_uring) {
+	    ofix_engine_set_uring(err, *server, reactor_threads);
+	    // an epoll fallback would pass without testing io_uring
+	    if (!test_true(0 < _ofix_engine_uring_cnt(*server))) {
+		test_print("The engine is not using io_uring.\n");
+		return false;
+	    }
+	} else {
+	    ofix_engine_set_reactor(err, *server, reactor_threads);
+	}
+	if (OFIX_OK != err->code) {
+	    test_print("Failed to set reactor [%d] %s\n", err->code, err->msg);
+	    test_fail();
+	    return false;
+	}
+    }
 
     // throw server into a separate thread
     if (0 != pthread_create(&server_thread, 0, start_engine, *server)) {
@@ -171,6 +211,8 @@ create_client_server(ofixErr err,
     ofix_client_set_log(*client, log_on, log, stdout);
     ofix_client_set_credentials(*client, user, password);
     ofix_client_set_heartbeat(*client, hb_interval);
+    ofix_client_set_send_delay(*client, send_delay);
+    ofix_client_set_busy_poll(*client, busy_poll, 0);
     // wait for engine to start
     giveup = dtime() + 1.0;
     while (!ofix_engine_running(*server)) {
@@ -1009,12 +1051,102 @@ resend_request_test() {
 8=FIX.4.4^9=125^35=8^49=Server^56=Client^34=3^52=$-$:$:$.$^37=order-124^17=x-order-124^150=0^39=0^55=IBM^54=1^151=250^14=250^6=0^10=$^\n\
 8=FIX.4.4^9=064^35=2^49=Client^56=Server^34=4^52=$-$:$:$.$^7=2^16=2^10=$^\n\
 8=FIX.4.4^9=117^35=D^49=Client^56=Server^34=5^52=$-$:$:$.$^11=order-125^55=IBM^54=1^60=$-$:$:$.$^38=250^40=1^10=$^\n\
-8=FIX.4.4^9=130^35=8^49=Server^56=Client^34=2^43=Y^52=$-$:$:$.$^37=order-123^17=x-order-123^150=0^39=0^55=IBM^54=1^151=250^14=250^6=0^10=$^\n\
+8=FIX.4.4^9=156^35=8^49=Server^56=Client^34=2^43=Y^52=$-$:$:$.$^122=$-$:$:$.$^37=order-123^17=x-order-123^150=0^39=0^55=IBM^54=1^151=250^14=250^6=0^10=$^\n\
 8=FIX.4.4^9=125^35=8^49=Server^56=Client^34=4^52=$-$:$:$.$^37=order-125^17=x-order-125^150=0^39=0^55=IBM^54=1^151=250^14=250^6=0^10=$^\n",
 	      actual);
     free(actual);
 }
 
+// The Logon is collapsed into a GapFill and a stored message that already
+// has an OrigSendingTime can not be patched so it is re-encoded with a new
+// SendingTime and the original OrigSendingTime.
+static void
+resend_fallback_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixMsgSpec		spec = ofix_version_spec_get_msg_spec(&err, "8", 4, 4);
+    ofixMsgSpec		resend_spec = ofix_version_spec_get_msg_spec(&err, "2", 4, 4);
+    ofixEngine		server;
+    ofixClient		client;
+    ofixSession		session;
+    ofixMsg		msg;
+    ofixMsg		rmsg;
+    double		giveup;
+    char		*actual;
+    struct _ofixDate	orig;
+
+    ofix_date_set_timestamp(&orig, 1420070400000000LL); // 2015-01-01
+
+    if (!create_client_server(&err, &server, &client, 6186, "Client", NULL, NULL, 4, 30)) {
+	return;
+    }
+    // wait for exchanges to complete
+    giveup = dtime() + 1.0;
+    while (1 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive responses.\n");
+	    test_fail();
+	    return;
+	}
+	dsleep(0.01);
+    }
+    session = ofix_engine_get_session(&err, server, "Client");
+    msg = ofix_msg_create_from_spec(&err, spec, 16);
+    if (OFIX_OK != err.code || NULL == msg || NULL == session) {
+	test_print("Failed to create message [%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    ofix_msg_set_date(&err, msg, OFIX_OrigSendingTimeTAG, &orig);
+    ofix_msg_set_str(&err, msg, OFIX_OrderIDTAG, "order-123");
+    ofix_msg_set_str(&err, msg, OFIX_ExecIDTAG, "x-order-123");
+    ofix_msg_set_char(&err, msg, OFIX_ExecTypeTAG, '0');
+    ofix_msg_set_char(&err, msg, OFIX_OrdStatusTAG, '0');
+    ofix_msg_set_str(&err, msg, OFIX_SymbolTAG, "IBM");
+    ofix_msg_set_char(&err, msg, OFIX_SideTAG, '1');
+    ofix_msg_set_int(&err, msg, OFIX_LeavesQtyTAG, 250);
+    ofix_msg_set_int(&err, msg, OFIX_CumQtyTAG, 250);
+    ofix_msg_set_float(&err, msg, OFIX_AvgPxTAG, 0.0, 4);
+    if (OFIX_OK != err.code) {
+	test_print("Error while setting fields in message [%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    ofix_session_send(&err, session, msg);
+    while (2 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive responses.\n");
+	    test_fail();
+	    return;
+	}
+	dsleep(0.01);
+    }
+    // resend everything from the Logon on
+    rmsg = ofix_msg_create_from_spec(&err, resend_spec, 10);
+    if (OFIX_OK != err.code || NULL == rmsg) {
+	test_print("Failed to create message [%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    ofix_msg_set_int(&err, rmsg, OFIX_BeginSeqNoTAG, 1);
+    ofix_msg_set_int(&err, rmsg, OFIX_EndSeqNoTAG, 0);
+    ofix_client_send(&err, client, rmsg);
+    dsleep(0.5);
+
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+    actual = load_fix_file(client_storage);
+    test_same("sender: Client\n\
+\n\
+8=FIX.4.4^9=073^35=A^49=Client^56=Server^34=1^52=$-$:$:$.$^98=0^108=30^141=Y^10=$^\n\
+8=FIX.4.4^9=067^35=A^49=Server^56=Client^34=1^52=$-$:$:$.$^98=0^108=30^10=$^\n\
+8=FIX.4.4^9=147^35=8^49=Server^56=Client^34=2^52=$-$:$:$.$^122=20150101-00:00:00^37=order-123^17=x-order-123^150=0^39=0^55=IBM^54=1^151=250^14=250^6=0^10=$^\n\
+8=FIX.4.4^9=064^35=2^49=Client^56=Server^34=2^52=$-$:$:$.$^7=1^16=0^10=$^\n\
+8=FIX.4.4^9=071^35=4^49=Server^56=Client^34=1^43=Y^52=$-$:$:$.$^123=Y^36=2^10=$^\n\
+8=FIX.4.4^9=152^35=8^49=Server^56=Client^34=2^43=Y^52=$-$:$:$.$^122=20150101-00:00:00^37=order-123^17=x-order-123^150=0^39=0^55=IBM^54=1^151=250^14=250^6=0^10=$^\n",
+	      actual);
+    free(actual);
+}
+
 static void
 sequence_reset_test() {
     struct _ofixErr	err = OFIX_ERR_INIT;
@@ -1098,6 +1230,488 @@ sequence_reset_test() {
     free(actual);
 }
 
+static void
+send_order(ofixErr err, ofixClient client, const char *cl_ord_id, const char *text) {
+    ofixMsgSpec		spec = ofix_version_spec_get_msg_spec(err, "D", 4, 4);
+    ofixMsg		msg;
+    struct timeval	tv;
+    struct timezone	tz;
+    struct _ofixDate	now;
+
+    gettimeofday(&tv, &tz);
+    ofix_date_set_timestamp(&now, (uint64_t)tv.tv_sec * 1000000LL + (uint64_t)tv.tv_usec);
+    if (NULL == (msg = ofix_msg_create_from_spec(err, spec, 16))) {
+	return;
+    }
+    ofix_msg_set_str(err, msg, OFIX_ClOrdIDTAG, cl_ord_id);
+    ofix_msg_set_str(err, msg, OFIX_SymbolTAG, "IBM");
+    ofix_msg_set_char(err, msg, OFIX_SideTAG, '1'); // buy
+    ofix_msg_set_int(err, msg, OFIX_OrderQtyTAG, 250);
+    ofix_msg_set_date(err, msg, OFIX_TransactTimeTAG, &now);
+    ofix_msg_set_char(err, msg, OFIX_OrdTypeTAG, '1'); // market order
+    if (NULL != text) {
+	ofix_msg_set_str(err, msg, OFIX_TextTAG, text);
+    }
+    ofix_client_send(err, client, msg);
+    ofix_msg_destroy(msg);
+}
+
+// Two clients share one reactor thread on the server.
+static void
+run_reactor(int port) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixVersionSpec	cspec = ofix_get_spec(&err, 4, 4);
+    ofixEngine		server;
+    ofixClient		client;
+    ofixClient		acme;
+    double		giveup;
+
+    reactor_threads = 1;
+    if (!create_client_server(&err, &server, &client, port, "Client", NULL, NULL, 4, 30)) {
+	reactor_threads = 0;
+	return;
+    }
+    reactor_threads = 0;
+    acme = ofix_client_create(&err, "Acme", "Server", "acme_storage.fix", cspec, client_cb, NULL);
+    ofix_client_set_log(acme, log_on, log, stdout);
+    ofix_client_set_credentials(acme, "fred", "secret");
+    ofix_client_connect(&err, acme, "localhost", port, 1.0);
+    if (OFIX_OK != err.code) {
+	test_print("Connect failed [%d] %s\n", err.code, err.msg);
+	test_fail();
+	ofix_client_destroy(&err, client);
+	ofix_engine_destroy(&err, server);
+	return;
+    }
+    send_order(&err, client, "order-123", NULL);
+    send_order(&err, acme, "order-a1", NULL);
+    send_order(&err, client, "order-124", NULL);
+    send_order(&err, acme, "order-a2", NULL);
+    test_true(OFIX_OK == err.code);
+
+    // the logon reply and two execution reports each
+    giveup = dtime() + 2.0;
+    while (3 > ofix_client_recv_seqnum(client) || 3 > ofix_client_recv_seqnum(acme)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for clients to receive responses.\n");
+	    test_fail();
+	    break;
+	}
+	dsleep(0.01);
+    }
+    test_true(NULL != ofix_engine_get_session(&err, server, "Client"));
+    test_true(NULL != ofix_engine_get_session(&err, server, "Acme"));
+
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_logout(&err, acme, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_client_destroy(&err, acme);
+    ofix_engine_destroy(&err, server);
+}
+
+static void
+reactor_test() {
+    run_reactor(6176);
+}
+
+// Returns true if the kernel supports the io_uring features the reactor
+// needs. Tests that need io_uring are skipped without it.
+static bool
+uring_supported() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixEngine		eng = ofix_engine_create(&err, "Probe", 0, "auth.txt", "server_storage",
+						 ofix_get_spec(&err, 4, 4), 30);
+    int			cnt;
+
+    if (NULL == eng) {
+	test_print("Failed to create engine [%d] %s\n", err.code, err.msg);
+	test_fail();
+	return false;
+    }
+    ofix_engine_set_log(eng, log_on, log, stdout);
+    ofix_engine_set_uring(&err, eng, 1);
+    cnt = _ofix_engine_uring_cnt(eng);
+    ofix_engine_destroy(&err, eng);
+    if (0 == cnt) {
+	test_print("io_uring is not supported, skipped.\n");
+    }
+    return 0 < cnt;
+}
+
+static void
+uring_test() {
+    if (!uring_supported()) {
+	return;
+    }
+    reactor_uring = true;
+    run_reactor(6177);
+    reactor_uring = false;
+}
+
+// An order larger than the initial session read buffer.
+static void
+large_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixEngine		server;
+    ofixClient		client;
+    char		*text = (char*)malloc(100001);
+    double		giveup;
+
+    if (!create_client_server(&err, &server, &client, 6178, "Client", NULL, NULL, 4, 30)) {
+	free(text);
+	return;
+    }
+    memset(text, 't', 100000);
+    text[100000] = '\0';
+    send_order(&err, client, "order-big", text);
+    send_order(&err, client, "order-small", NULL);
+    free(text);
+    test_true(OFIX_OK == err.code);
+
+    giveup = dtime() + 2.0;
+    while (3 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive responses.\n");
+	    test_fail();
+	    break;
+	}
+	dsleep(0.01);
+    }
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+}
+
+// Sends held for a short delay on both ends, the orders and reports still
+// arrive in order.
+static void
+coalesce_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixEngine		server;
+    ofixClient		client;
+    char		cid[32];
+    double		giveup;
+
+    send_delay = 2000;
+    reactor_threads = 1;
+    if (!create_client_server(&err, &server, &client, 6179, "Client", NULL, NULL, 4, 30)) {
+	send_delay = 0;
+	reactor_threads = 0;
+	return;
+    }
+    send_delay = 0;
+    reactor_threads = 0;
+    for (int i = 0; i < 20; i++) {
+	snprintf(cid, sizeof(cid), "order-%d", i);
+	send_order(&err, client, cid, NULL);
+    }
+    test_true(OFIX_OK == err.code);
+
+    // the logon reply and an execution report for each order
+    giveup = dtime() + 2.0;
+    while (21 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive responses.\n");
+	    test_fail();
+	    break;
+	}
+	dsleep(0.01);
+    }
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+}
+
+#define BACKLOG_CNT	1000
+#define BACKLOG_TEXT	8000
+
+// The server sends more than the socket buffers hold to a slow client. The
+// reactor keeps what does not fit queued and writes it as the client
+// catches up.
+static void
+run_backlog(int port) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixMsgSpec		spec = ofix_version_spec_get_msg_spec(&err, "8", 4, 4);
+    ofixEngine		server;
+    ofixClient		client;
+    ofixSession		session;
+    ofixMsg		msg;
+    char		*text = (char*)malloc(BACKLOG_TEXT + 1);
+    char		xid[16];
+    double		giveup;
+
+    reactor_threads = 1;
+    if (!create_client_server(&err, &server, &client, port, "Client", NULL, NULL, 4, 30)) {
+	reactor_threads = 0;
+	free(text);
+	return;
+    }
+    reactor_threads = 0;
+    memset(text, 't', BACKLOG_TEXT);
+    text[BACKLOG_TEXT] = '\0';
+    giveup = dtime() + 2.0;
+    while (NULL == (session = ofix_engine_get_session(&err, server, "Client")) && dtime() < giveup) {
+	dsleep(0.01);
+    }
+    test_true(NULL != session);
+    slow_client = true;
+    for (int i = 0; NULL != session && i < BACKLOG_CNT; i++) {
+	snprintf(xid, sizeof(xid), "x-%d", i);
+	msg = ofix_msg_create_from_spec(&err, spec, 16);
+	ofix_msg_set_str(&err, msg, OFIX_OrderIDTAG, xid);
+	ofix_msg_set_str(&err, msg, OFIX_ExecIDTAG, xid);
+	ofix_msg_set_char(&err, msg, OFIX_ExecTypeTAG, '0');
+	ofix_msg_set_char(&err, msg, OFIX_OrdStatusTAG, '0');
+	ofix_msg_set_str(&err, msg, OFIX_SymbolTAG, "IBM");
+	ofix_msg_set_char(&err, msg, OFIX_SideTAG, '1');
+	ofix_msg_set_int(&err, msg, OFIX_LeavesQtyTAG, 0);
+	ofix_msg_set_int(&err, msg, OFIX_CumQtyTAG, 0);
+	ofix_msg_set_float(&err, msg, OFIX_AvgPxTAG, 0.0, 4);
+	ofix_msg_set_str(&err, msg, OFIX_TextTAG, text);
+	ofix_session_send(&err, session, msg);
+	ofix_msg_destroy(msg);
+    }
+    free(text);
+    test_true(OFIX_OK == err.code);
+
+    // the logon reply and every report
+    giveup = dtime() + 10.0;
+    while (BACKLOG_CNT + 1 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive the backlog, got %lld.\n",
+		       (long long)ofix_client_recv_seqnum(client));
+	    test_fail();
+	    break;
+	}
+	dsleep(0.01);
+    }
+    slow_client = false;
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+}
+
+static void
+backlog_test() {
+    run_backlog(6183);
+}
+
+static void
+uring_backlog_test() {
+    if (!uring_supported()) {
+	return;
+    }
+    reactor_uring = true;
+    run_backlog(6184);
+    reactor_uring = false;
+}
+
+#define PRODUCER_CNT	4
+#define PRODUCER_SENDS	50
+
+typedef struct _Producer {
+    pthread_t	thread;
+    ofixClient	client;
+    int		id;
+} *Producer;
+
+static void*
+produce(void *arg) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Producer		p = (Producer)arg;
+    char		cid[16];
+
+    for (int i = 0; i < PRODUCER_SENDS; i++) {
+	snprintf(cid, sizeof(cid), "o%d-%d", p->id, i);
+	send_order(&err, p->client, cid, NULL);
+    }
+    if (OFIX_OK != err.code) {
+	test_print("Send failed [%d] %s\n", err.code, err.msg);
+	test_fail();
+    }
+    return NULL;
+}
+
+// Several threads send on the same client at once. The stored messages must
+// be in sequence number order.
+static void
+producers_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixEngine		server;
+    ofixClient		client;
+    struct _Producer	producers[PRODUCER_CNT];
+    char		pat[64];
+    char		*actual;
+    char		*s;
+    int64_t		seq = 0;
+    double		giveup;
+
+    if (!create_client_server(&err, &server, &client, 6180, "Client", NULL, NULL, 4, 30)) {
+	return;
+    }
+    for (int i = 0; i < PRODUCER_CNT; i++) {
+	producers[i].client = client;
+	producers[i].id = i;
+	pthread_create(&producers[i].thread, 0, produce, &producers[i]);
+    }
+    for (int i = 0; i < PRODUCER_CNT; i++) {
+	pthread_join(producers[i].thread, NULL);
+    }
+    // the logon reply and an execution report for each order
+    giveup = dtime() + 5.0;
+    while (PRODUCER_CNT * PRODUCER_SENDS + 1 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive responses.\n");
+	    test_fail();
+	    break;
+	}
+	dsleep(0.01);
+    }
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+
+    actual = load_fix_file(client_storage);
+    for (s = actual; NULL != (s = strstr(s, "^49=Client^56=Server^34=")); s++) {
+	if (++seq != strtoll(s + 24, NULL, 10)) {
+	    snprintf(pat, sizeof(pat), "34=%lld", (long long)seq);
+	    test_print("Expected stored %s, got %.16s\n", pat, s + 21);
+	    test_fail();
+	    break;
+	}
+    }
+    // logon, orders, and logout
+    test_true(PRODUCER_CNT * PRODUCER_SENDS + 2 == seq);
+    free(actual);
+}
+
+static void
+busy_poll_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixEngine		server;
+    ofixClient		client;
+    double		giveup;
+
+    busy_poll = true;
+    if (!create_client_server(&err, &server, &client, 6181, "Client", NULL, NULL, 4, 30)) {
+	busy_poll = false;
+	return;
+    }
+    busy_poll = false;
+    send_order(&err, client, "order-123", NULL);
+    send_order(&err, client, "order-124", NULL);
+    test_true(OFIX_OK == err.code);
+
+    giveup = dtime() + 2.0;
+    while (3 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive responses.\n");
+	    test_fail();
+	    break;
+	}
+	dsleep(0.01);
+    }
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+}
+
+// A spinning client sends faster than the server reads. The sends that do
+// not fit in the socket buffer stay queued and are written on later spins.
+static void
+busy_backlog_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixEngine		server;
+    ofixClient		client;
+    char		*text = (char*)malloc(BACKLOG_TEXT + 1);
+    char		cid[16];
+    double		giveup;
+
+    busy_poll = true;
+    if (!create_client_server(&err, &server, &client, 6185, "Client", NULL, NULL, 4, 30)) {
+	busy_poll = false;
+	free(text);
+	return;
+    }
+    busy_poll = false;
+    memset(text, 't', BACKLOG_TEXT);
+    text[BACKLOG_TEXT] = '\0';
+    slow_server = true;
+    for (int i = 0; i < BACKLOG_CNT; i++) {
+	snprintf(cid, sizeof(cid), "order-%d", i);
+	send_order(&err, client, cid, text);
+    }
+    free(text);
+    test_true(OFIX_OK == err.code);
+
+    // the logon reply and a report for every order
+    giveup = dtime() + 10.0;
+    while (BACKLOG_CNT + 1 > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for the server to take the backlog, got %lld.\n",
+		       (long long)ofix_client_recv_seqnum(client));
+	    test_fail();
+	    break;
+	}
+	dsleep(0.01);
+    }
+    slow_server = false;
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+}
+
+static bool
+journal_logon(const char *cid, const char *password, int64_t seq) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixEngine		server;
+    ofixClient		client;
+    double		giveup;
+    bool		ok = true;
+
+    use_journal = true;
+    if (!create_client_server(&err, &server, &client, 6182, cid, "fred", password, 4, 30)) {
+	use_journal = false;
+	return false;
+    }
+    use_journal = false;
+    giveup = dtime() + 1.0;
+    while (seq > ofix_client_recv_seqnum(client)) {
+	if (giveup < dtime()) {
+	    test_print("Timed out waiting for client to receive responses.\n");
+	    ok = false;
+	    break;
+	}
+	dsleep(0.01);
+    }
+    ofix_client_logout(&err, client, "bye bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+
+    return ok;
+}
+
+static void
+journal_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Journal		j = ofix_journal_create(&err, "server_storage/journal", "Server", 0);
+
+    ofix_journal_destroy(j);
+    // a rejected logon does not register a session
+    test_true(journal_logon("Acme", "password", 2));
+    j = ofix_journal_open(&err, "server_storage/journal", "Server", 0);
+    test_true(OFIX_OK == err.code && NULL != j && 0 == j->sess_cnt);
+    ofix_journal_destroy(j);
+
+    // each new connection starts the session over in the same slot
+    test_true(journal_logon("Client", NULL, 1));
+    test_true(journal_logon("Client", NULL, 1));
+    j = ofix_journal_open(&err, "server_storage/journal", "Server", 0);
+    test_true(OFIX_OK == err.code && NULL != j && 1 == j->sess_cnt);
+    test_true(0 < ofix_journal_last_seq(j, 1, OFIX_IODIR_RECV));
+    ofix_journal_destroy(j);
+}
+
 void
 append_engine_tests(Test tests) {
     test_append(tests, "engine.normal", normal_test);
@@ -1114,5 +1728,16 @@ append_engine_tests(Test tests) {
     test_append(tests, "engine.heartbeat", heartbeat_test);
     test_append(tests, "engine.test_request", test_request_test);
     test_append(tests, "engine.resend_request", resend_request_test);
+    test_append(tests, "engine.resend_fallback", resend_fallback_test);
     test_append(tests, "engine.sequence_reset", sequence_reset_test);
+    test_append(tests, "engine.reactor", reactor_test);
+    test_append(tests, "engine.uring", uring_test);
+    test_append(tests, "engine.large", large_test);
+    test_append(tests, "engine.coalesce", coalesce_test);
+    test_append(tests, "engine.backlog", backlog_test);
+    test_append(tests, "engine.uring_backlog", uring_backlog_test);
+    test_append(tests, "engine.producers", producers_test);
+    test_append(tests, "engine.busy_poll", busy_poll_test);
+    test_append(tests, "engine.busy_backlog", busy_backlog_test);
+    test_append(tests, "engine.journal", journal_test);
 }
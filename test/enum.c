@@ -0,0 +1,114 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "ofix/ofix.h"
+
+static ofixMsg
+parse(ofixErr err, const char *msg_str) {
+    char	msg_buf[4096];
+    char	*b;
+    const char	*str;
+
+    for (str = msg_str, b = msg_buf; '\0' != *str; str++, b++) {
+	if ('^' == *str) {
+	    *b = '\1';
+	} else {
+	    *b = *str;
+	}
+    }
+    *b = '\0';
+
+    return ofix_msg_parse(err, msg_buf, strlen(msg_buf));
+}
+
+static ofixTagSpec
+tag_spec(int tag) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixVersionSpec	vspec = ofix_version_spec_get_msg_spec(&err, "D", 4, 4)->version;
+
+    return ofix_version_spec_get_tag_spec(&err, vspec, tag, false);
+}
+
+static void
+char_test() {
+    ofixTagSpec	side = tag_spec(OFIX_SideTAG);
+
+    test_true(ofix_tag_spec_check_enum(side, "1", 1));
+    test_true(ofix_tag_spec_check_enum(side, "G", 1));
+    test_false(ofix_tag_spec_check_enum(side, "Z", 1));
+    test_false(ofix_tag_spec_check_enum(side, "12", 2));
+    test_false(ofix_tag_spec_check_enum(side, "", 0));
+}
+
+static void
+string_test() {
+    ofixTagSpec	mt = tag_spec(OFIX_MsgTypeTAG);
+
+    test_true(ofix_tag_spec_check_enum(mt, "D", 1));
+    test_true(ofix_tag_spec_check_enum(mt, "AE", 2));
+    test_false(ofix_tag_spec_check_enum(mt, "A", 0));
+    test_false(ofix_tag_spec_check_enum(mt, "ZZ", 2));
+    test_false(ofix_tag_spec_check_enum(mt, "AEX", 3));
+}
+
+static void
+multiple_test() {
+    ofixTagSpec	inst = tag_spec(OFIX_ExecInstTAG);
+
+    test_true(ofix_tag_spec_check_enum(inst, "1", 1));
+    test_true(ofix_tag_spec_check_enum(inst, "1 G", 3));
+    test_false(ofix_tag_spec_check_enum(inst, "1 %", 3));
+    test_false(ofix_tag_spec_check_enum(inst, "1G", 2));
+}
+
+static void
+msg_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixMsg		msg = parse(&err, "8=FIX.4.4^9=116^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^54=Z^60=20071031-17:42:11.321^40=7^10=087^");
+
+    test_true(OFIX_OK == err.code);
+    test_true(ofix_msg_check_enum(&err, msg, OFIX_OrdTypeTAG));
+    test_true(ofix_msg_check_enum(&err, msg, OFIX_SymbolTAG));
+    test_false(ofix_msg_check_enum(&err, msg, OFIX_SideTAG));
+    test_true(OFIX_REASON_BAD_VALUE == err.reason);
+    test_true(OFIX_SideTAG == err.tag);
+    test_true(42 == err.seq);
+
+    ofix_err_clear(&err);
+    test_false(ofix_msg_check_enum(&err, msg, OFIX_TimeInForceTAG));
+    test_true(OFIX_NOT_FOUND_ERR == err.code);
+    ofix_msg_destroy(msg);
+}
+
+static void
+parse_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    const char		*str = "8=FIX.4.4^9=116^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^54=Z^60=20071031-17:42:11.321^40=7^10=087^";
+    ofixMsg		msg;
+
+    ofix_msg_set_parse_check_enums(true);
+    msg = parse(&err, str);
+    ofix_msg_set_parse_check_enums(false);
+    test_true(NULL == msg);
+    test_true(OFIX_PARSE_ERR == err.code);
+    test_true(OFIX_REASON_BAD_VALUE == err.reason);
+    test_true(OFIX_SideTAG == err.tag);
+
+    ofix_err_clear(&err);
+    msg = parse(&err, str);
+    test_true(OFIX_OK == err.code && NULL != msg);
+    ofix_msg_destroy(msg);
+}
+
+void
+append_enum_tests(Test tests) {
+    test_append(tests, "enum.char", char_test);
+    test_append(tests, "enum.string", string_test);
+    test_append(tests, "enum.multiple", multiple_test);
+    test_append(tests, "enum.msg", msg_test);
+    test_append(tests, "enum.parse", parse_test);
+}
@@ -0,0 +1,144 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "ofix/ofix.h"
+
+#define HB	"8=FIX.4.4^9=037^35=0^49=Server^56=Client^34=1^108=30^10=066^"
+#define ORDER	"8=FIX.4.4^9=048^35=D^49=Client^56=Server^34=2^11=order-2^55=IBM^10=186^"
+
+static char*
+soh(const char *str) {
+    char	*s = strdup(str);
+    char	*c;
+
+    for (c = s; '\0' != *c; c++) {
+	if ('^' == *c) {
+	    *c = '\1';
+	}
+    }
+    return s;
+}
+
+// Pushes str in pieces of step bytes and returns the frames pulled as a
+// string with a newline after each, SOH replaced by ^.
+static void
+run_test(const char *str, int step, bool check_sum, const char *expect, int64_t skipped) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixFramer		fr = ofix_framer_create(&err, check_sum);
+    struct _ofixFrame	frames[4];
+    char		actual[1024];
+    char		*a = actual;
+    char		*s = soh(str);
+    char		*c;
+    int			len = (int)strlen(s);
+    int			cnt;
+    int			i;
+    int			n;
+
+    *a = '\0';
+    for (i = 0; i < len; i += step) {
+	n = (len - i < step) ? len - i : step;
+	ofix_framer_push(&err, fr, s + i, n);
+	while (0 < (cnt = ofix_framer_pull(&err, fr, frames, sizeof(frames) / sizeof(*frames)))) {
+	    for (ofixFrame f = frames; 0 < cnt; cnt--, f++) {
+		memcpy(a, f->str, f->len);
+		for (c = a; c < a + f->len; c++) {
+		    if ('\1' == *c) {
+			*c = '^';
+		    }
+		}
+		a += f->len;
+		*a++ = '\n';
+		*a = '\0';
+	    }
+	}
+    }
+    free(s);
+    if (OFIX_OK != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+    }
+    test_same(expect, actual);
+    if (skipped != ofix_framer_skipped(fr)) {
+	test_print("expected %lld bytes skipped, not %lld\n", (long long)skipped, (long long)ofix_framer_skipped(fr));
+	test_fail();
+    }
+    ofix_framer_destroy(fr);
+}
+
+static void
+split_test() {
+    run_test(HB ORDER "\n" HB, 1, true, HB "\n" ORDER "\n" HB "\n", 0);
+    run_test(HB ORDER "\n" HB, 7, true, HB "\n" ORDER "\n" HB "\n", 0);
+    run_test(HB ORDER "\n" HB, 1000, true, HB "\n" ORDER "\n" HB "\n", 0);
+}
+
+static void
+garbage_test() {
+    // leading garbage
+    run_test("junk" HB, 3, false, HB "\n", 4);
+    // the BodyLength of the first message is too short
+    run_test("8=FIX.4.4^9=030^35=0^49=Server^56=Client^34=1^108=30^10=066^" ORDER, 5, false, ORDER "\n", 60);
+    // a truncated message followed by a good one
+    run_test("8=FIX.4.4^9=037^35=0^49=Ser" HB, 1, false, HB "\n", 27);
+    // a BodyLength that is not a number
+    run_test("8=FIX.4.4^9=0x7^" ORDER, 2, false, ORDER "\n", 16);
+}
+
+#define BAD_SUM	"8=FIX.4.4^9=037^35=0^49=Server^56=Client^34=1^108=30^10=067^"
+
+static void
+check_sum_test() {
+    run_test(BAD_SUM ORDER, 10, true, ORDER "\n", 60);
+    run_test(BAD_SUM ORDER, 10, false, BAD_SUM "\n" ORDER "\n", 0);
+}
+
+// A message larger than the initial framer buffer, read directly into the
+// framer space.
+static void
+large_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixFramer		fr = ofix_framer_create(&err, true);
+    ofixMsg		msg = ofix_msg_create(&err, "D", 4, 4, 8);
+    struct _ofixFrame	frame;
+    char		*text = (char*)malloc(200001);
+    char		*str;
+    char		*b;
+    size_t		space;
+    size_t		len;
+    size_t		i;
+    size_t		n;
+    int			cnt = 0;
+
+    memset(text, 'x', 200000);
+    text[200000] = '\0';
+    ofix_msg_set_str(&err, msg, 58, text);
+    free(text);
+    str = (char*)ofix_msg_FIX_str(&err, msg);
+    len = strlen(str);
+    for (i = 0; i < len; i += n) {
+	b = ofix_framer_space(fr, &space);
+	n = (len - i < space) ? len - i : space;
+	memcpy(b, str + i, n);
+	ofix_framer_commit(fr, n);
+	cnt += ofix_framer_pull(&err, fr, &frame, 1);
+    }
+    test_true(OFIX_OK == err.code);
+    test_true(1 == cnt);
+    test_true(len == (size_t)frame.len);
+    test_true(0 == ofix_framer_skipped(fr));
+    ofix_msg_destroy(msg);
+    ofix_framer_destroy(fr);
+}
+
+void
+append_framer_tests(Test tests) {
+    test_append(tests, "framer.split", split_test);
+    test_append(tests, "framer.garbage", garbage_test);
+    test_append(tests, "framer.check_sum", check_sum_test);
+    test_append(tests, "framer.large", large_test);
+}
@@ -0,0 +1,137 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "ofix/ofix.h"
+
+static const char	*md_str = "8=FIX.4.4^9=000^35=X^49=Server^56=Client^34=5^52=20071031-17:42:33.123^\
+268=3^\
+279=0^269=0^55=IBM^454=2^455=A1^456=1^455=A2^456=2^270=101.25^271=100^\
+279=0^269=1^55=IBM^270=101.5^271=200^\
+279=2^269=0^55=MSFT^270=30^271=300^\
+10=000^";
+
+static ofixMsg
+parse(ofixErr err, const char *msg_str) {
+    char	msg_buf[4096];
+    char	*b;
+    const char	*str;
+
+    for (str = msg_str, b = msg_buf; '\0' != *str; str++, b++) {
+	if ('^' == *str) {
+	    *b = '\1';
+	} else {
+	    *b = *str;
+	}
+    }
+    *b = '\0';
+
+    return ofix_msg_parse(err, msg_buf, strlen(msg_buf));
+}
+
+static bool
+value_is(const char *expected, const char *value, int len) {
+    return NULL != value && (int)strlen(expected) == len && 0 == strncmp(expected, value, len);
+}
+
+static void
+cursor_test() {
+    struct _ofixErr		err = OFIX_ERR_INIT;
+    struct _ofixGroupCursor	entries;
+    ofixMsg			msg = parse(&err, md_str);
+    const char			*value;
+    int				len;
+
+    if (OFIX_OK != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    ofix_msg_group(&err, msg, OFIX_NoMDEntriesTAG, &entries);
+    test_true(OFIX_OK == err.code);
+    test_true(3 == ofix_group_count(&entries));
+
+    ofix_group_entry(&err, &entries, 2);
+    value = ofix_group_get(&err, &entries, OFIX_MDEntryPxTAG, &len);
+    test_true(value_is("30", value, len));
+    value = ofix_group_get(&err, &entries, OFIX_SymbolTAG, &len);
+    test_true(value_is("MSFT", value, len));
+
+    ofix_group_entry(&err, &entries, 1);
+    test_true(200 == ofix_group_get_int(&err, &entries, OFIX_MDEntrySizeTAG));
+    test_true('1' == ofix_group_get_char(&err, &entries, OFIX_MDEntryTypeTAG));
+
+    ofix_group_entry(&err, &entries, 0);
+    value = ofix_group_get(&err, &entries, OFIX_MDEntryPxTAG, &len);
+    test_true(value_is("101.25", value, len));
+    test_true(OFIX_OK == err.code);
+
+    // Fields of a nested group are not part of the entry.
+    ofix_group_get(&err, &entries, OFIX_SecurityAltIDTAG, &len);
+    test_true(OFIX_NOT_FOUND_ERR == err.code);
+    ofix_err_clear(&err);
+
+    ofix_group_entry(&err, &entries, 3);
+    test_true(OFIX_ARG_ERR == err.code);
+    ofix_msg_destroy(msg);
+}
+
+static void
+nested_test() {
+    struct _ofixErr		err = OFIX_ERR_INIT;
+    struct _ofixGroupCursor	entries;
+    struct _ofixGroupCursor	alts;
+    ofixMsg			msg = parse(&err, md_str);
+    const char			*value;
+    int				len;
+
+    ofix_msg_group(&err, msg, OFIX_NoMDEntriesTAG, &entries);
+    ofix_group_subgroup(&err, &entries, OFIX_NoSecurityAltIDTAG, &alts);
+    test_true(OFIX_OK == err.code);
+    test_true(2 == ofix_group_count(&alts));
+    ofix_group_entry(&err, &alts, 1);
+    value = ofix_group_get(&err, &alts, OFIX_SecurityAltIDTAG, &len);
+    test_true(value_is("A2", value, len));
+
+    ofix_group_entry(&err, &entries, 1);
+    ofix_group_subgroup(&err, &entries, OFIX_NoSecurityAltIDTAG, &alts);
+    test_true(OFIX_NOT_FOUND_ERR == err.code);
+    test_true(0 == ofix_group_count(&alts));
+    ofix_err_clear(&err);
+
+    // Nested groups are not top level groups.
+    ofix_msg_group(&err, msg, OFIX_NoSecurityAltIDTAG, &alts);
+    test_true(OFIX_NOT_FOUND_ERR == err.code);
+    ofix_msg_destroy(msg);
+}
+
+static void
+count_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixMsg		msg = parse(&err, md_str);
+    char		*str = strdup(md_str);
+    char		*s = strstr(str, "268=3");
+
+    ofix_msg_validate(&err, msg);
+    test_true(OFIX_OK == err.code);
+    ofix_msg_destroy(msg);
+
+    s[4] = '4';
+    msg = parse(&err, str);
+    ofix_msg_validate(&err, msg);
+    test_true(OFIX_PARSE_ERR == err.code);
+    test_true(OFIX_REASON_NUM_GROUP == err.reason);
+    test_true(OFIX_NoMDEntriesTAG == err.tag);
+    ofix_msg_destroy(msg);
+    free(str);
+}
+
+void
+append_group_tests(Test tests) {
+    test_append(tests, "group.cursor", cursor_test);
+    test_append(tests, "group.nested", nested_test);
+    test_append(tests, "group.count", count_test);
+}
@@ -0,0 +1,865 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+
+#include "test.h"
+#include "ofix/crc.h"
+#include "ofix/dtime.h"
+#include "ofix/lz.h"
+#include "ofix/ofix.h"
+#include "ofix/store.h"
+
+static const char	*msgs[] = {
+    "8=FIX.4.4^9=113^35=D^49=Client^56=Server^34=1^52=20071031-17:42:33.123^11=order-1^21=1^55=IBM^54=2^60=20071031-17:42:11.321^40=7^10=200^",
+    "8=FIX.4.4^9=037^35=0^49=Server^56=Client^34=1^108=30^10=066^",
+    "8=FIX.4.4^9=113^35=D^49=Client^56=Server^34=3^52=20071031-17:42:33.123^11=order-3^21=1^55=IBM^54=2^60=20071031-17:42:11.321^40=7^10=204^",
+    NULL
+};
+
+static char*
+soh_str(const char *str) {
+    char	*s = strdup(str);
+
+    for (char *c = s; '\0' != *c; c++) {
+	if ('^' == *c) {
+	    *c = '\1';
+	}
+    }
+    return s;
+}
+
+static void
+store_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Store		s = ofix_store_create_journal(&err, "journal_storage", "Client");
+    ofixMsg		msg;
+    char		*actual;
+
+    if (OFIX_OK != err.code || NULL == s) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    for (const char **mp = msgs; NULL != *mp; mp++) {
+	char	*mstr = soh_str(*mp);
+
+	msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+	free(mstr);
+	if (0 == strcmp("Client", ofix_msg_get_str(&err, msg, OFIX_SenderCompIDTAG))) {
+	    ofix_store_add(&err, s, ofix_msg_get_int(&err, msg, OFIX_MsgSeqNumTAG), OFIX_IODIR_SEND, msg);
+	} else {
+	    ofix_store_add(&err, s, ofix_msg_get_int(&err, msg, OFIX_MsgSeqNumTAG), OFIX_IODIR_RECV, msg);
+	}
+	ofix_msg_destroy(msg);
+    }
+    test_true(OFIX_OK == err.code);
+
+    msg = ofix_store_get(&err, s, 3, OFIX_IODIR_SEND);
+    test_true(NULL != msg);
+    actual = ofix_msg_to_str(&err, msg);
+    test_same(msgs[2], actual);
+    free(actual);
+    ofix_msg_destroy(msg);
+
+    msg = ofix_store_get(&err, s, 1, OFIX_IODIR_RECV);
+    test_true(NULL != msg);
+    actual = ofix_msg_to_str(&err, msg);
+    test_same(msgs[1], actual);
+    free(actual);
+    ofix_msg_destroy(msg);
+
+    test_true(NULL == ofix_store_get(&err, s, 2, OFIX_IODIR_SEND));
+    test_true(NULL == ofix_store_get(&err, s, 3, OFIX_IODIR_RECV));
+    test_true(NULL == ofix_store_get(&err, s, 100000, OFIX_IODIR_SEND));
+    test_true(OFIX_OK == err.code);
+
+    ofix_store_destroy(s);
+}
+
+static void
+roll_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    char		*mstr = soh_str(msgs[0]);
+    int			mlen = strlen(mstr);
+    // room for two messages per segment
+    Journal		j = ofix_journal_create(&err, "journal_roll", "Client",
+						sizeof(struct _JSegHead) + 2 * ((sizeof(struct _JRec) + mlen + 7) & ~7));
+    char		*big;
+    const char		*str;
+    int			len;
+    int			i;
+
+    if (OFIX_OK != err.code || NULL == j) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	free(mstr);
+	return;
+    }
+    for (i = 1; i <= 5; i++) {
+	ofix_journal_add(&err, j, 0, i, OFIX_IODIR_SEND, mstr, mlen);
+    }
+    ofix_journal_add(&err, j, 0, 100000, OFIX_IODIR_SEND, mstr, mlen);
+    test_true(OFIX_OK == err.code);
+    test_true(3 == j->seg_cnt);
+    test_true(100000 == j->sindex.head->last_seq);
+
+    // a message larger than a segment gets a segment of its own
+    big = (char*)malloc(3 * mlen);
+    memcpy(big, mstr, mlen);
+    memset(big + mlen, 'x', 2 * mlen);
+    ofix_journal_add(&err, j, 0, 7, OFIX_IODIR_RECV, big, 3 * mlen);
+    test_true(4 == j->seg_cnt);
+    str = ofix_journal_get(&err, j, 0, 7, OFIX_IODIR_RECV, &len);
+    test_true(NULL != str && len == 3 * mlen && 0 == memcmp(big, str, len));
+    free(big);
+
+    for (i = 1; i <= 5; i++) {
+	str = ofix_journal_get(&err, j, 0, i, OFIX_IODIR_SEND, &len);
+	test_true(NULL != str && len == mlen && 0 == memcmp(mstr, str, len));
+    }
+    str = ofix_journal_get(&err, j, 0, 100000, OFIX_IODIR_NONE, &len);
+    test_true(NULL != str && len == mlen);
+    test_true(0 == access("journal_roll/000003.seg", F_OK));
+
+    ofix_journal_destroy(j);
+    free(mstr);
+}
+
+static bool
+iterate_cb(const char *str, int len, void *ctx) {
+    (*(int*)ctx)++;
+    return true;
+}
+
+static void
+iterate_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Journal		j = ofix_journal_create(&err, "journal_iterate", "Client", 4096);
+    int			cnt = 0;
+    int			i;
+
+    for (i = 0; NULL != msgs[i]; i++) {
+	char	*mstr = soh_str(msgs[i]);
+
+	ofix_journal_add(&err, j, 0, i + 1, OFIX_IODIR_SEND, mstr, strlen(mstr));
+	free(mstr);
+    }
+    ofix_journal_iterate(&err, j, 0, iterate_cb, &cnt);
+    test_true(OFIX_OK == err.code);
+    test_true(3 == cnt);
+    ofix_journal_destroy(j);
+}
+
+static void
+writer_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Store		s = ofix_store_create_journal(&err, "journal_writer", "Client");
+    char		*mstr = soh_str(msgs[0]);
+    ofixMsg		msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+    int			i;
+
+    free(mstr);
+    ofix_store_set_durability(&err, s, OFIX_SYNC_COUNT, 4);
+    for (i = 1; i <= 10; i++) {
+	ofix_store_add(&err, s, i, OFIX_IODIR_SEND, msg);
+    }
+    test_true(OFIX_OK == err.code);
+    // a read sees everything added before it
+    test_true(NULL != ofix_journal_get(&err, s->journal, 0, 10, OFIX_IODIR_SEND, NULL));
+    test_true(ofix_store_wait_durable(&err, s, 10, OFIX_IODIR_SEND, 2.0));
+    test_false(ofix_store_wait_durable(&err, s, 11, OFIX_IODIR_SEND, 0.01));
+    test_true(OFIX_OK == err.code);
+    ofix_store_destroy(s);
+
+    s = ofix_store_create_journal(&err, "journal_writer", "Client");
+    ofix_store_set_durability(&err, s, OFIX_SYNC_INTERVAL, 5);
+    ofix_store_add(&err, s, 1, OFIX_IODIR_RECV, msg);
+    test_true(ofix_store_wait_durable(&err, s, 1, OFIX_IODIR_RECV, 2.0));
+    ofix_store_destroy(s);
+
+    s = ofix_store_create(&err, "journal_writer.fix", "Client");
+    ofix_store_set_durability(&err, s, OFIX_SYNC_NONE, 0);
+    test_true(OFIX_ARG_ERR == err.code);
+    ofix_store_destroy(s);
+    ofix_msg_destroy(msg);
+}
+
+static void
+open_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Store		s = ofix_store_create_journal(&err, "journal_open", "Client");
+    char		*mstr;
+    char		*actual;
+    ofixMsg		msg;
+    int64_t		sent_seq = 0;
+    int64_t		recv_seq = 0;
+    int			i;
+
+    for (i = 0; NULL != msgs[i]; i++) {
+	mstr = soh_str(msgs[i]);
+	msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+	free(mstr);
+	ofix_store_add(&err, s, ofix_msg_get_int(&err, msg, OFIX_MsgSeqNumTAG),
+		       (0 == i % 2) ? OFIX_IODIR_SEND : OFIX_IODIR_RECV, msg);
+	ofix_msg_destroy(msg);
+    }
+    ofix_store_destroy(s);
+
+    s = ofix_store_open(&err, "journal_open", "Client", &sent_seq, &recv_seq);
+    if (OFIX_OK != err.code || NULL == s) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    test_true(3 == sent_seq);
+    test_true(1 == recv_seq);
+    msg = ofix_store_get(&err, s, 1, OFIX_IODIR_SEND);
+    actual = ofix_msg_to_str(&err, msg);
+    test_same(msgs[0], actual);
+    free(actual);
+    ofix_msg_destroy(msg);
+
+    // new messages go after the old ones
+    mstr = soh_str(msgs[1]);
+    msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+    free(mstr);
+    ofix_store_add(&err, s, 2, OFIX_IODIR_RECV, msg);
+    ofix_msg_destroy(msg);
+    ofix_store_destroy(s);
+
+    s = ofix_store_open(&err, "journal_open", "Client", &sent_seq, &recv_seq);
+    test_true(OFIX_OK == err.code);
+    test_true(2 == recv_seq);
+    msg = ofix_store_get(&err, s, 3, OFIX_IODIR_SEND);
+    actual = ofix_msg_to_str(&err, msg);
+    test_same(msgs[2], actual);
+    free(actual);
+    ofix_msg_destroy(msg);
+    ofix_store_destroy(s);
+
+    // a directory without a journal gets a new one
+    s = ofix_store_open(&err, "journal_open_new", "Client", &sent_seq, &recv_seq);
+    test_true(OFIX_OK == err.code && NULL != s);
+    test_true(0 == sent_seq && 0 == recv_seq);
+    ofix_store_destroy(s);
+}
+
+static void
+crc_test() {
+    test_true(0xE3069283 == ofix_crc32c(0, "123456789", 9));
+    // continuing a checksum is the same as one pass
+    test_true(0xE3069283 == ofix_crc32c(ofix_crc32c(0, "1234", 4), "56789", 5));
+    test_true(0 == ofix_crc32c(0, "", 0));
+}
+
+static void
+torn_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Journal		j = ofix_journal_create(&err, "journal_torn", "Client", 0);
+    char		*mstr = soh_str(msgs[0]);
+    int			mlen = strlen(mstr);
+    int64_t		end;
+    const char		*str;
+    FILE		*f;
+    int			i;
+
+    for (i = 1; i <= 3; i++) {
+	ofix_journal_add(&err, j, 0, i, OFIX_IODIR_SEND, mstr, mlen);
+    }
+    end = ((JSegHead)j->segs[0].base)->end;
+    ofix_journal_destroy(j);
+
+    // flip a byte in the body of the last message
+    f = fopen("journal_torn/000000.seg", "r+");
+    fseek(f, end - 20, SEEK_SET);
+    fputc('#', f);
+    fclose(f);
+
+    j = ofix_journal_open(&err, "journal_torn", "Client", 0);
+    if (OFIX_OK != err.code || NULL == j) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	free(mstr);
+	return;
+    }
+    test_true(2 == j->sindex.head->last_seq);
+    test_true(NULL != ofix_journal_get(&err, j, 0, 2, OFIX_IODIR_SEND, NULL));
+    test_true(NULL == ofix_journal_get(&err, j, 0, 3, OFIX_IODIR_SEND, NULL));
+    test_true(end > ((JSegHead)j->segs[0].base)->end);
+
+    ofix_journal_add(&err, j, 0, 3, OFIX_IODIR_SEND, mstr, mlen);
+    ofix_journal_destroy(j);
+
+    j = ofix_journal_open(&err, "journal_torn", "Client", 0);
+    test_true(3 == j->sindex.head->last_seq);
+    str = ofix_journal_get(&err, j, 0, 3, OFIX_IODIR_SEND, &i);
+    test_true(NULL != str && i == mlen && 0 == memcmp(mstr, str, mlen));
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(j);
+    free(mstr);
+}
+
+static void
+shared_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Journal		j = ofix_journal_create(&err, "journal_shared", "Server", 0);
+    char		*astr = soh_str(msgs[0]);
+    char		*bstr = soh_str(msgs[2]);
+    int			alen = strlen(astr);
+    int			blen = strlen(bstr);
+    int64_t		sent_seq = 0;
+    int64_t		recv_seq = 0;
+    const char		*str;
+    Store		s;
+    int			alpha;
+    int			beta;
+    int			len;
+    int			cnt = 0;
+    int			i;
+
+    ofix_journal_start_writer(&err, j, OFIX_SYNC_COUNT, 8);
+    alpha = ofix_journal_session(&err, j, "Alpha", false);
+    beta = ofix_journal_session(&err, j, "Beta", false);
+    test_true(0 < alpha && 0 < beta && alpha != beta);
+    test_true(alpha == ofix_journal_session(&err, j, "Alpha", false));
+    for (i = 1; i <= 5; i++) {
+	ofix_journal_add(&err, j, alpha, i, OFIX_IODIR_SEND, astr, alen);
+	ofix_journal_add(&err, j, beta, i, OFIX_IODIR_SEND, bstr, blen);
+    }
+    ofix_journal_add(&err, j, beta, 1, OFIX_IODIR_RECV, astr, alen);
+    test_true(OFIX_OK == err.code);
+    str = ofix_journal_get(&err, j, beta, 3, OFIX_IODIR_SEND, &len);
+    test_true(NULL != str && len == blen && 0 == memcmp(bstr, str, len));
+    test_true(NULL == ofix_journal_get(&err, j, alpha, 1, OFIX_IODIR_RECV, NULL));
+    test_true(NULL == ofix_journal_get(&err, j, 0, 1, OFIX_IODIR_SEND, NULL));
+
+    s = ofix_store_create_shared(&err, j, "Alpha", true, &sent_seq, &recv_seq);
+    test_true(NULL != s && alpha == s->sid);
+    test_true(5 == sent_seq && 0 == recv_seq);
+    test_true(ofix_store_wait_durable(&err, s, 5, OFIX_IODIR_SEND, 2.0));
+    ofix_store_destroy(s);
+    ofix_journal_iterate(&err, j, beta, iterate_cb, &cnt);
+    test_true(6 == cnt);
+    ofix_journal_destroy(j);
+
+    j = ofix_journal_open(&err, "journal_shared", "Server", 0);
+    if (OFIX_OK != err.code || NULL == j) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	free(astr);
+	free(bstr);
+	return;
+    }
+    test_true(alpha == ofix_journal_session(&err, j, "Alpha", false));
+    test_true(5 == ofix_journal_last_seq(j, alpha, OFIX_IODIR_SEND));
+    test_true(1 == ofix_journal_last_seq(j, beta, OFIX_IODIR_RECV));
+    str = ofix_journal_get(&err, j, alpha, 5, OFIX_IODIR_SEND, &len);
+    test_true(NULL != str && len == alen && 0 == memcmp(astr, str, len));
+
+    // a fresh session keeps its id but does not see the old messages
+    s = ofix_store_create_shared(&err, j, "Beta", false, &sent_seq, &recv_seq);
+    test_true(NULL != s && beta == s->sid);
+    test_true(0 == sent_seq && 0 == recv_seq);
+    test_true(NULL == ofix_store_get(&err, s, 1, OFIX_IODIR_SEND));
+    ofix_journal_add(&err, j, beta, 1, OFIX_IODIR_SEND, astr, alen);
+    ofix_store_destroy(s);
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(j);
+
+    // the fresh start and the other sessions survive a reopen
+    j = ofix_journal_open(&err, "journal_shared", "Server", 0);
+    test_true(OFIX_OK == err.code && NULL != j);
+    test_true(2 == j->sess_cnt);
+    test_true(beta == ofix_journal_session(&err, j, "Beta", false));
+    test_true(1 == ofix_journal_last_seq(j, beta, OFIX_IODIR_SEND));
+    test_true(0 == ofix_journal_last_seq(j, beta, OFIX_IODIR_RECV));
+    str = ofix_journal_get(&err, j, beta, 1, OFIX_IODIR_SEND, &len);
+    test_true(NULL != str && len == alen && 0 == memcmp(astr, str, len));
+    test_true(NULL == ofix_journal_get(&err, j, beta, 2, OFIX_IODIR_SEND, NULL));
+    test_true(5 == ofix_journal_last_seq(j, alpha, OFIX_IODIR_SEND));
+    cnt = 0;
+    ofix_journal_iterate(&err, j, beta, iterate_cb, &cnt);
+    test_true(7 == cnt);
+    test_true(OFIX_OK == err.code);
+
+    ofix_journal_destroy(j);
+    free(astr);
+    free(bstr);
+}
+
+static bool
+count_cb(ofixMsg msg, void *ctx) {
+    (*(int*)ctx)++;
+    return true;
+}
+
+static void
+find_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Store		s = ofix_store_create_journal(&err, "journal_find", "Client");
+    ofixMsg		msg;
+    int			cnt = 0;
+    int			i;
+
+    ofix_store_index_tag(&err, s, OFIX_ClOrdIDTAG);
+    for (i = 1; i <= 300; i++) {
+	char	*mstr = soh_str(msgs[(0 == i % 100) ? 2 : 0]);
+
+	msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+	free(mstr);
+	ofix_store_add(&err, s, i, OFIX_IODIR_SEND, msg);
+	ofix_msg_destroy(msg);
+	if (150 == i) {
+	    // tags added later still cover the earlier messages
+	    ofix_store_index_tag(&err, s, OFIX_SymbolTAG);
+	}
+    }
+    // finds only search what the writer has written
+    ofix_store_wait_durable(&err, s, 300, OFIX_IODIR_SEND, 2.0);
+    test_true(3 == ofix_store_find(&err, s, OFIX_ClOrdIDTAG, "order-3", count_cb, &cnt));
+    test_true(3 == cnt);
+    test_true(297 == ofix_store_find(&err, s, OFIX_ClOrdIDTAG, "order-1", count_cb, &cnt));
+    test_true(0 == ofix_store_find(&err, s, OFIX_ClOrdIDTAG, "order-2", count_cb, &cnt));
+    test_true(300 == ofix_store_find(&err, s, OFIX_SymbolTAG, "IBM", count_cb, &cnt));
+    test_true(OFIX_OK == err.code);
+    ofix_store_find(&err, s, OFIX_OrderIDTAG, "x", count_cb, &cnt);
+    test_true(OFIX_ARG_ERR == err.code);
+    ofix_store_destroy(s);
+}
+
+static int64_t
+now_ns() {
+    struct timespec	ts;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+
+    return (int64_t)ts.tv_sec * 1000000000LL + ts.tv_nsec;
+}
+
+static bool
+range_cb(const char *str, int len, void *ctx) {
+    (*(int*)ctx)++;
+    return true;
+}
+
+static void
+time_range_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    // small segments so ranges cross segments
+    Journal		j = ofix_journal_create(&err, "journal_time", "Client", 16384);
+    char		*mstr = soh_str(msgs[1]);
+    int			mlen = strlen(mstr);
+    int64_t		t0;
+    int64_t		t1;
+    int64_t		t2;
+    int			cnt = 0;
+    int			i;
+
+    t0 = now_ns();
+    for (i = 1; i <= 200; i++) {
+	ofix_journal_add(&err, j, 0, i, OFIX_IODIR_RECV, mstr, mlen);
+    }
+    t1 = now_ns();
+    for (i = 201; i <= 500; i++) {
+	ofix_journal_add(&err, j, 0, i, OFIX_IODIR_RECV, mstr, mlen);
+    }
+    t2 = now_ns();
+    test_true(200 == ofix_journal_time_range(&err, j, -1, t0, t1, range_cb, &cnt));
+    test_true(300 == ofix_journal_time_range(&err, j, 0, t1, t2, range_cb, &cnt));
+    test_true(0 == ofix_journal_time_range(&err, j, 1, t0, t2, range_cb, &cnt));
+    test_true(0 == ofix_journal_time_range(&err, j, -1, t2 + 1, t2 + 1000000000LL, range_cb, &cnt));
+    test_true(500 == cnt);
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(j);
+
+    // a reopen starts from an entry per segment instead of reading them all
+    j = ofix_journal_open(&err, "journal_time", "Client", 16384);
+    test_true(j->seg_cnt == j->time_cnt && 0 == j->irec_cnt);
+    test_true(200 == ofix_journal_time_range(&err, j, -1, t0, t1, range_cb, &cnt));
+    test_true(0 == j->irec_cnt);
+    // a new tag reads the records for itself without a rebuild
+    ofix_journal_index_tag(&err, j, OFIX_HeartBtIntTAG);
+    test_true(500 == j->key_cnt && j->seg_cnt == j->time_cnt);
+    test_true(500 == ofix_journal_find(&err, j, -1, OFIX_HeartBtIntTAG, "30", range_cb, &cnt));
+    // a late stamp is written with the time of the record before it
+    ofix_journal_add(&err, j, 0, 501, OFIX_IODIR_RECV, mstr, mlen);
+    j->last_ts += 1000000000LL;
+    ofix_journal_add(&err, j, 0, 502, OFIX_IODIR_RECV, mstr, mlen);
+    test_true(1 == ofix_journal_time_range(&err, j, -1, j->last_ts, j->last_ts, range_cb, &cnt));
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(j);
+    free(mstr);
+}
+
+static int
+seg_files(const char *dir) {
+    char	path[256];
+    int		cnt = 0;
+    int		i;
+
+    for (i = 0; i < 1000; i++) {
+	snprintf(path, sizeof(path), "%s/%06d.seg", dir, i);
+	cnt += (0 == access(path, F_OK));
+    }
+    return cnt;
+}
+
+static void
+retention_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    char		*mstr = soh_str(msgs[0]);
+    int			mlen = strlen(mstr);
+    int64_t		seg_size = sizeof(struct _JSegHead) + 4 * ((sizeof(struct _JRec) + mlen + 7) & ~7);
+    Journal		j = ofix_journal_create(&err, "journal_retention", "Client", seg_size);
+    struct stat		st;
+    const char		*str;
+    int64_t		pin;
+    int			cnt = 0;
+    int			len;
+    int			i;
+
+    // 4 messages per segment, 10 segments
+    for (i = 1; i <= 40; i++) {
+	ofix_journal_add(&err, j, 0, i, OFIX_IODIR_SEND, mstr, mlen);
+    }
+    test_true(10 == j->seg_cnt);
+    // replacing 1 through 8 leaves nothing live in the first two segments
+    for (i = 1; i <= 8; i++) {
+	ofix_journal_add(&err, j, 0, i, OFIX_IODIR_SEND, mstr, mlen);
+    }
+    test_true(12 == j->seg_cnt);
+    // every record is keyed by its MsgType
+    ofix_journal_index_tag(&err, j, 35);
+    test_true(48 == ofix_journal_find(&err, j, -1, 35, "D", iterate_cb, &cnt));
+    test_true(48 == j->key_cnt && 1 == j->time_cnt);
+    ofix_journal_set_retention(&err, j, 0.0, 0, 0.0);
+    ofix_journal_maintain(&err, j);
+    test_true(10 == seg_files("journal_retention"));
+    // the entries of the removed segments are dropped
+    test_true(40 == j->key_cnt && 0 == j->time_cnt);
+    test_true(40 == ofix_journal_find(&err, j, -1, 35, "D", iterate_cb, &cnt));
+    test_true(NULL != ofix_journal_get(&err, j, 0, 1, OFIX_IODIR_SEND, NULL));
+    // closed segments are cut back to the bytes used
+    stat("journal_retention/000002.seg", &st);
+    test_true(st.st_size == ((JSegHead)j->segs[2].base)->end);
+
+    // a pinned reader keeps removed segments mapped
+    pin = ofix_journal_pin(j);
+    str = ofix_journal_get(&err, j, 0, 9, OFIX_IODIR_SEND, &len);
+    test_true(NULL != str);
+    ofix_journal_set_retention(&err, j, 0.0, 3, 0.0);
+    ofix_journal_maintain(&err, j);
+    test_true(3 == seg_files("journal_retention"));
+    test_true(len == mlen && 0 == memcmp(mstr, str, len));
+    ofix_journal_maintain(&err, j);
+    test_true(0 < j->limbo_cnt[0] + j->limbo_cnt[1]);
+    ofix_journal_unpin(j, pin);
+    ofix_journal_maintain(&err, j);
+    ofix_journal_maintain(&err, j);
+    test_true(0 == j->limbo_cnt[0] + j->limbo_cnt[1]);
+    test_true(NULL == ofix_journal_get(&err, j, 0, 9, OFIX_IODIR_SEND, NULL));
+    test_true(NULL == ofix_journal_get(&err, j, 0, 36, OFIX_IODIR_SEND, NULL));
+    test_true(NULL != ofix_journal_get(&err, j, 0, 40, OFIX_IODIR_SEND, NULL));
+    str = ofix_journal_get(&err, j, 0, 8, OFIX_IODIR_SEND, &len);
+    test_true(NULL != str && len == mlen && 0 == memcmp(mstr, str, len));
+    ofix_journal_destroy(j);
+
+    // a reopen skips the removed segments
+    j = ofix_journal_open(&err, "journal_retention", "Client", seg_size);
+    test_true(OFIX_OK == err.code && NULL != j);
+    test_true(8 == ofix_journal_last_seq(j, 0, OFIX_IODIR_SEND));
+    test_true(NULL != ofix_journal_get(&err, j, 0, 5, OFIX_IODIR_SEND, NULL));
+    test_true(NULL == ofix_journal_get(&err, j, 0, 20, OFIX_IODIR_SEND, NULL));
+
+    // segments also roll by time
+    ofix_journal_set_retention(&err, j, 0.02, 0, 0.02);
+    ofix_journal_add(&err, j, 0, 9, OFIX_IODIR_SEND, mstr, mlen);
+    i = j->seg_cnt;
+    dsleep(0.05);
+    ofix_journal_add(&err, j, 0, 10, OFIX_IODIR_SEND, mstr, mlen);
+    test_true(i + 1 == j->seg_cnt);
+    dsleep(0.05);
+    ofix_journal_maintain(&err, j);
+    test_true(1 == seg_files("journal_retention"));
+    test_true(NULL != ofix_journal_get(&err, j, 0, 10, OFIX_IODIR_SEND, NULL));
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(j);
+    free(mstr);
+}
+
+#define COMPRESS_CNT	5000
+
+static int
+compress_msg(char *buf, size_t size, int seq) {
+    return snprintf(buf, size, "8=FIX.4.4\0019=113\00135=D\00149=Client\00156=Server\00134=%d\001"
+		    "52=20071031-17:42:33.123\00111=order-%d\00121=1\00155=IBM\00154=2\00140=7\00110=200\001",
+		    seq, seq % 100);
+}
+
+static void
+compress_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Journal		j = ofix_journal_create(&err, "journal_compress", "Client", 128 * 1024);
+    char		mstr[512];
+    char		zbuf[512];
+    char		out[512];
+    const char		*str;
+    struct stat		st;
+    int64_t		raw = 0;
+    int64_t		comp = 0;
+    int			mlen;
+    int			zlen;
+    int			len;
+    int			cnt;
+    int			i;
+
+    // repeats between messages are what compress
+    mlen = compress_msg(mstr, sizeof(mstr), 1);
+    mlen += compress_msg(mstr + mlen, sizeof(mstr) - mlen, 2);
+    zlen = ofix_lz_compress(mstr, mlen, zbuf, sizeof(zbuf));
+    test_true(0 < zlen && zlen < mlen);
+    test_true(mlen == ofix_lz_decompress(zbuf, zlen, out, sizeof(out)) && 0 == memcmp(mstr, out, mlen));
+    test_true(-1 == ofix_lz_compress("abcdefgh", 8, zbuf, sizeof(zbuf)));
+
+    for (i = 1; i <= COMPRESS_CNT; i++) {
+	mlen = compress_msg(mstr, sizeof(mstr), i);
+	ofix_journal_add(&err, j, 0, i, OFIX_IODIR_SEND, mstr, mlen);
+    }
+    test_true(4 <= j->seg_cnt);
+    for (i = 0; i < j->seg_cnt - 1; i++) {
+	raw += ((JSegHead)j->segs[i].base)->end;
+    }
+    ofix_journal_set_compress(&err, j, true);
+    ofix_journal_maintain(&err, j);
+    // the segment being written is left alone
+    for (i = 0; i < j->seg_cnt - 1; i++) {
+	char	path[256];
+
+	test_true(NULL != j->segs[i].z);
+	snprintf(path, sizeof(path), "journal_compress/%06d.segz", i);
+	test_true(0 == stat(path, &st));
+	comp += st.st_size;
+	snprintf(path, sizeof(path), "journal_compress/%06d.seg", i);
+	test_true(0 != access(path, F_OK));
+    }
+    test_true(NULL == j->segs[j->seg_cnt - 1].z);
+    test_true(comp * 3 < raw);
+    // the original mappings are released on the next pass
+    ofix_journal_maintain(&err, j);
+    test_true(j->segs[0].base == j->segs[0].z->base);
+
+    for (i = 1; i <= COMPRESS_CNT; i += 7) {
+	mlen = compress_msg(mstr, sizeof(mstr), i);
+	str = ofix_journal_get(&err, j, 0, i, OFIX_IODIR_SEND, &len);
+	if (NULL == str || len != mlen || 0 != memcmp(mstr, str, len)) {
+	    test_print("*** compressed get of %d failed\n", i);
+	    test_fail();
+	    break;
+	}
+    }
+    cnt = 0;
+    ofix_journal_iterate(&err, j, -1, iterate_cb, &cnt);
+    test_true(COMPRESS_CNT == cnt);
+    ofix_journal_index_tag(&err, j, OFIX_ClOrdIDTAG);
+    cnt = 0;
+    test_true(COMPRESS_CNT / 100 == ofix_journal_find(&err, j, -1, OFIX_ClOrdIDTAG, "order-7", range_cb, &cnt));
+    test_true(COMPRESS_CNT / 100 == cnt);
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(j);
+
+    // compressed segments are picked up on open
+    j = ofix_journal_open(&err, "journal_compress", "Client", 128 * 1024);
+    test_true(OFIX_OK == err.code && NULL != j);
+    test_true(COMPRESS_CNT == ofix_journal_last_seq(j, 0, OFIX_IODIR_SEND));
+    test_true(NULL != j->segs[0].z);
+    mlen = compress_msg(mstr, sizeof(mstr), 2);
+    str = ofix_journal_get(&err, j, 0, 2, OFIX_IODIR_SEND, &len);
+    test_true(NULL != str && len == mlen && 0 == memcmp(mstr, str, len));
+    cnt = 0;
+    ofix_journal_iterate(&err, j, -1, iterate_cb, &cnt);
+    test_true(COMPRESS_CNT == cnt);
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(j);
+}
+
+#define REPL_PORT	6190
+
+static void
+replicate_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    char		*mstr = soh_str(msgs[0]);
+    int			mlen = strlen(mstr);
+    int64_t		seg_size = sizeof(struct _JSegHead) + 50 * ((sizeof(struct _JRec) + mlen + 7) & ~7);
+    Journal		f = ofix_journal_create(&err, "journal_follower", "Client", seg_size);
+    Journal		p = ofix_journal_create(&err, "journal_primary", "Client", seg_size);
+    const char		*str;
+    int			alpha;
+    int			beta;
+    int			len;
+    int			i;
+
+    // records written before replication starts are caught up
+    alpha = ofix_journal_session(&err, p, "Alpha", false);
+    for (i = 1; i <= 100; i++) {
+	ofix_journal_add(&err, p, alpha, i, OFIX_IODIR_SEND, mstr, mlen);
+    }
+    ofix_journal_follow(&err, f, NULL, REPL_PORT);
+    ofix_journal_start_writer(&err, p, OFIX_SYNC_COUNT, 16);
+    ofix_journal_replicate(&err, p, "127.0.0.1", REPL_PORT, true);
+    for (i = 101; i <= 300; i++) {
+	ofix_journal_add(&err, p, alpha, i, OFIX_IODIR_SEND, mstr, mlen);
+    }
+    test_true(ofix_journal_wait_durable(&err, p, alpha, 300, OFIX_IODIR_SEND, 5.0));
+    test_true(300 == ofix_journal_last_seq(f, alpha, OFIX_IODIR_SEND));
+    test_true(p->seg_cnt == f->seg_cnt);
+    str = ofix_journal_get(&err, f, alpha, 150, OFIX_IODIR_SEND, &len);
+    test_true(NULL != str && len == mlen && 0 == memcmp(mstr, str, len));
+    ofix_journal_destroy(p);
+
+    // a reopened primary resumes where the follower left off
+    p = ofix_journal_open(&err, "journal_primary", "Client", seg_size);
+    beta = ofix_journal_session(&err, p, "Beta", true);
+    ofix_journal_replicate(&err, p, "127.0.0.1", REPL_PORT, true);
+    for (i = 1; i <= 10; i++) {
+	ofix_journal_add(&err, p, beta, i, OFIX_IODIR_RECV, mstr, mlen);
+    }
+    test_true(ofix_journal_wait_durable(&err, p, beta, 10, OFIX_IODIR_RECV, 5.0));
+    test_true(OFIX_OK == err.code);
+    ofix_journal_destroy(p);
+    ofix_journal_destroy(f);
+
+    // on failover the follower is opened as a journal of its own
+    f = ofix_journal_open(&err, "journal_follower", "Client", seg_size);
+    test_true(OFIX_OK == err.code && NULL != f);
+    test_true(alpha == ofix_journal_session(&err, f, "Alpha", false));
+    test_true(beta == ofix_journal_session(&err, f, "Beta", false));
+    test_true(300 == ofix_journal_last_seq(f, alpha, OFIX_IODIR_SEND));
+    test_true(10 == ofix_journal_last_seq(f, beta, OFIX_IODIR_RECV));
+    str = ofix_journal_get(&err, f, beta, 10, OFIX_IODIR_RECV, &len);
+    test_true(NULL != str && len == mlen && 0 == memcmp(mstr, str, len));
+    ofix_journal_destroy(f);
+    free(mstr);
+}
+
+#define CONCURRENT_CNT	20000
+
+typedef struct _Shared {
+    Store	store;
+    ofixMsg	msg;
+    const char	*expect;
+    int		len;
+    IoDir	dir;
+    volatile bool	done;
+} *Shared;
+
+static void*
+add_loop(void *arg) {
+    Shared		sh = (Shared)arg;
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    int			i;
+
+    for (i = 1; i <= CONCURRENT_CNT; i++) {
+	ofix_store_add(&err, sh->store, i, sh->dir, sh->msg);
+    }
+    return (OFIX_OK == err.code) ? NULL : (void*)1;
+}
+
+static void*
+read_loop(void *arg) {
+    Shared		sh = (Shared)arg;
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    struct _MsgView	views[16];
+    int64_t		seq = 1;
+    int			cnt;
+    int			i;
+
+    while (!sh->done) {
+	cnt = ofix_store_get_range(&err, sh->store, seq, seq + 15, OFIX_IODIR_SEND, views, 16);
+	for (i = 0; i < cnt; i++) {
+	    if (NULL != views[i].str && (views[i].len != sh->len || 0 != memcmp(sh->expect, views[i].str, sh->len))) {
+		return (void*)1;
+	    }
+	}
+	seq = (seq + 7919) % (CONCURRENT_CNT - 16) + 1;
+    }
+    return (OFIX_OK == err.code) ? NULL : (void*)1;
+}
+
+static void
+concurrent_run(Store s) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    char		*mstr = soh_str(msgs[0]);
+    struct _Shared	send_sh = { s, NULL, NULL, 0, OFIX_IODIR_SEND, false };
+    struct _Shared	recv_sh;
+    pthread_t		writers[2];
+    pthread_t		readers[3];
+    void		*result;
+    int			fails = 0;
+    int			i;
+
+    send_sh.msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+    send_sh.expect = ofix_msg_FIX_str(&err, send_sh.msg);
+    send_sh.len = ofix_msg_size(&err, send_sh.msg);
+    recv_sh = send_sh;
+    recv_sh.dir = OFIX_IODIR_RECV;
+    free(mstr);
+
+    pthread_create(&writers[0], NULL, add_loop, &send_sh);
+    pthread_create(&writers[1], NULL, add_loop, &recv_sh);
+    for (i = 0; i < 3; i++) {
+	pthread_create(&readers[i], NULL, read_loop, &send_sh);
+    }
+    for (i = 0; i < 2; i++) {
+	pthread_join(writers[i], &result);
+	fails += (NULL != result);
+    }
+    send_sh.done = true;
+    for (i = 0; i < 3; i++) {
+	pthread_join(readers[i], &result);
+	fails += (NULL != result);
+    }
+    test_true(0 == fails);
+    for (i = 1; i <= CONCURRENT_CNT; i += 997) {
+	ofixMsg	msg = ofix_store_get(&err, s, i, OFIX_IODIR_RECV);
+
+	test_true(NULL != msg);
+	if (NULL != msg) {
+	    ofix_msg_destroy(msg);
+	}
+    }
+    ofix_msg_destroy(send_sh.msg);
+    ofix_store_destroy(s);
+}
+
+static void
+concurrent_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+
+    concurrent_run(ofix_store_create(&err, "journal_concurrent.fix", "Client"));
+    concurrent_run(ofix_store_create_journal(&err, "journal_concurrent", "Client"));
+    test_true(OFIX_OK == err.code);
+}
+
+void
+append_journal_tests(Test tests) {
+    test_append(tests, "journal.store", store_test);
+    test_append(tests, "journal.roll", roll_test);
+    test_append(tests, "journal.iterate", iterate_test);
+    test_append(tests, "journal.writer", writer_test);
+    test_append(tests, "journal.open", open_test);
+    test_append(tests, "journal.concurrent", concurrent_test);
+    test_append(tests, "journal.crc", crc_test);
+    test_append(tests, "journal.torn", torn_test);
+    test_append(tests, "journal.shared", shared_test);
+    test_append(tests, "journal.find", find_test);
+    test_append(tests, "journal.time_range", time_range_test);
+    test_append(tests, "journal.retention", retention_test);
+    test_append(tests, "journal.compress", compress_test);
+    test_append(tests, "journal.replicate", replicate_test);
+}
@@ -16,11 +16,19 @@ extern void	append_iterator_tests(Test tests);
 extern void	append_parse_tests(Test tests);
 extern void	append_store_tests(Test tests);
 extern void	append_engine_tests(Test tests);
+extern void	append_typed_tests(Test tests);
+extern void	append_validate_tests(Test tests);
+extern void	append_enum_tests(Test tests);
+extern void	append_spec_tests(Test tests);
+extern void	append_group_tests(Test tests);
+extern void	append_journal_tests(Test tests);
+extern void	append_framer_tests(Test tests);
 extern void	benchmark(int iter);
+extern void	latency_benchmark(int iter, int cpu);
 
 int
 main(int argc, char **argv) {
-    struct _Test	tests[100] = { { NULL, NULL } };
+    struct _Test	tests[128] = { { NULL, NULL } };
     /*
     append_get_tests(tests);
     append_set_tests(tests);
@@ -31,7 +39,14 @@ main(int argc, char **argv) {
     append_parse_tests(tests);
     */
 
-    //append_store_tests(tests);
+    append_store_tests(tests);
+    append_typed_tests(tests);
+    append_validate_tests(tests);
+    append_enum_tests(tests);
+    append_spec_tests(tests);
+    append_group_tests(tests);
+    append_journal_tests(tests);
+    append_framer_tests(tests);
     append_engine_tests(tests);
 
     test_init(argc, argv, "oFIX", tests);
@@ -40,6 +55,7 @@ main(int argc, char **argv) {
     test_done();
 
     //benchmark(10000);
+    //latency_benchmark(10000, 1);
 
     return 0;
 }
@@ -0,0 +1,96 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "ofix/ofix.h"
+
+extern ofixVersionSpec	ofix_get_spec(ofixErr err, int major, int minor);
+
+static void
+unknown_version_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+
+    test_true(NULL == ofix_get_spec(&err, 4, 9));
+    test_true(OFIX_NOT_FOUND_ERR == err.code);
+    ofix_err_clear(&err);
+    test_true(NULL == ofix_version_spec_get_msg_spec(&err, "D", 3, 0));
+    test_true(OFIX_NOT_FOUND_ERR == err.code);
+}
+
+static void
+unknown_tag_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixVersionSpec	v42 = ofix_get_spec(&err, 4, 2);
+    ofixVersionSpec	v44 = ofix_get_spec(&err, 4, 4);
+    ofixTagSpec		ts;
+
+    ofix_init(&err);
+    test_true(OFIX_OK == err.code);
+    ts = ofix_version_spec_get_tag_spec(&err, v44, 999, true);
+    test_true(NULL != ts && OFIX_UnknownType == ts->type);
+    test_same("999=", ts->tag_bytes);
+    test_true(ts == ofix_version_spec_get_tag_spec(&err, v42, 999, true));
+
+    ts = ofix_version_spec_get_tag_spec(&err, v44, 9901, true);
+    test_true(NULL != ts && 9901 == ts->tag);
+    test_true(ts == ofix_version_spec_get_tag_spec(&err, v44, 9901, false));
+    // unknown tags above the table are shared by all versions too
+    test_true(ts == ofix_version_spec_get_tag_spec(&err, v42, 9901, false));
+    test_true(NULL == ofix_version_spec_get_tag_spec(&err, v44, 9902, false));
+    test_true(OFIX_NOT_FOUND_ERR == err.code);
+}
+
+static void*
+lookup_loop(void *arg) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    int			i;
+
+    for (i = 0; i < 1000; i++) {
+	ofixVersionSpec	vspec = ofix_get_spec(&err, 4, i % 5);
+
+	if (NULL == vspec || NULL == ofix_version_spec_get_tag_spec(&err, vspec, 1000 + i % 50, true)) {
+	    return (void*)1;
+	}
+    }
+    return NULL;
+}
+
+static void
+threads_test() {
+    pthread_t	threads[8];
+    void	*result;
+    int		fails = 0;
+    int		i;
+
+    for (i = 0; i < 8; i++) {
+	pthread_create(&threads[i], NULL, lookup_loop, NULL);
+    }
+    for (i = 0; i < 8; i++) {
+	pthread_join(threads[i], &result);
+	if (NULL != result) {
+	    fails++;
+	}
+    }
+    test_true(0 == fails);
+    // racing creates all end up with the one spec that was published
+    for (i = 1000; i < 1050; i++) {
+	struct _ofixErr	err = OFIX_ERR_INIT;
+	ofixTagSpec	ts = ofix_version_spec_get_tag_spec(&err, ofix_get_spec(&err, 4, 0), i, false);
+
+	if (NULL == ts || i != ts->tag || ts != ofix_version_spec_get_tag_spec(&err, ofix_get_spec(&err, 4, 4), i, false)) {
+	    fails++;
+	}
+    }
+    test_true(0 == fails);
+}
+
+void
+append_spec_tests(Test tests) {
+    test_append(tests, "spec.unknown_version", unknown_version_test);
+    test_append(tests, "spec.unknown_tag", unknown_tag_test);
+    test_append(tests, "spec.threads", threads_test);
+}
@@ -1,8 +1,12 @@
 // Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
 
+#include <pthread.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
+#include <time.h>
 
+#include "ofix/client.h"
 #include "ofix/dtime.h"
 #include "ofix/ofix.h"
 
@@ -314,3 +318,169 @@ benchmark(int iter) {
     printf("Update:      %0.3f nsec/msg\n", update(iter) * 1000000000.0 / (double)iter);
     printf("Enhance:     %0.3f nsec/msg\n", enhance(iter) * 1000000000.0 / (double)iter);
 }
+
+#define LATENCY_PORT	6190
+
+extern ofixVersionSpec	ofix_get_spec(ofixErr err, int major, int minor);
+
+static int64_t		*lat_samples;
+static volatile int	lat_cnt;
+
+static int64_t
+mono_nsec() {
+    struct timespec	ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (int64_t)ts.tv_sec * 1000000000LL + (int64_t)ts.tv_nsec;
+}
+
+static bool
+quiet_log_on(void *ctx, ofixLogLevel level) {
+    return false;
+}
+
+static void
+quiet_log(void *ctx, ofixLogLevel level, const char *format, ...) {
+}
+
+// Replies to each order with an execution report that carries the time it
+// was sent in the Text field.
+static bool
+lat_server_cb(ofixSession session, ofixMsg msg, void *ctx) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixMsg		reply;
+    char		*cid;
+    char		sent[32];
+    const char		*mt = ofix_msg_type(msg);
+
+    if (NULL == mt || 0 != strcmp("D", mt) ||
+	NULL == (reply = ofix_session_create_msg(&err, session, "8"))) {
+	return true;
+    }
+    cid = ofix_msg_get_str(&err, msg, OFIX_ClOrdIDTAG);
+    ofix_msg_set_str(&err, reply, OFIX_OrderIDTAG, cid);
+    ofix_msg_set_str(&err, reply, OFIX_ExecIDTAG, cid);
+    free(cid);
+    ofix_msg_set_str(&err, reply, OFIX_SymbolTAG, "IBM");
+    ofix_msg_set_char(&err, reply, OFIX_SideTAG, '1');
+    ofix_msg_set_char(&err, reply, OFIX_ExecTypeTAG, '0');
+    ofix_msg_set_char(&err, reply, OFIX_OrdStatusTAG, '0');
+    ofix_msg_set_int(&err, reply, OFIX_LeavesQtyTAG, 100);
+    ofix_msg_set_int(&err, reply, OFIX_CumQtyTAG, 0);
+    ofix_msg_set_float(&err, reply, OFIX_AvgPxTAG, 0.0, 4);
+    snprintf(sent, sizeof(sent), "%lld", (long long)mono_nsec());
+    ofix_msg_set_str(&err, reply, OFIX_TextTAG, sent);
+    ofix_session_send(&err, session, reply);
+    ofix_msg_destroy(reply);
+
+    return true;
+}
+
+static bool
+lat_client_cb(ofixSession session, ofixMsg msg, void *ctx) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    int64_t		now = mono_nsec();
+    const char		*mt = ofix_msg_type(msg);
+    char		*sent;
+
+    if (NULL != mt && 0 == strcmp("8", mt) && NULL != (sent = ofix_msg_get_str(&err, msg, OFIX_TextTAG))) {
+	lat_samples[lat_cnt] = now - strtoll(sent, NULL, 10);
+	free(sent);
+	__atomic_add_fetch(&lat_cnt, 1, __ATOMIC_RELEASE);
+    }
+    return true;
+}
+
+static void*
+lat_engine(void *arg) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+
+    ofix_engine_start(&err, (ofixEngine)arg);
+
+    return NULL;
+}
+
+static int
+cmp_samples(const void *a, const void *b) {
+    int64_t	x = *(const int64_t*)a;
+    int64_t	y = *(const int64_t*)b;
+
+    return (x < y) ? -1 : (x > y);
+}
+
+// Sends iter orders one at a time and reports the time from the server
+// sending each execution report to the client receive callback.
+static void
+latency(int iter, bool busy, int cpu) {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixVersionSpec	spec = ofix_get_spec(&err, 4, 4);
+    ofixEngine		server;
+    ofixClient		client;
+    pthread_t		thread;
+    ofixMsg		order;
+    char		cid[16];
+    double		giveup;
+
+    lat_samples = (int64_t*)calloc(iter, sizeof(int64_t));
+    lat_cnt = 0;
+    server = ofix_engine_create(&err, "Server", LATENCY_PORT, "auth.txt", "server_storage", spec, 30);
+    if (OFIX_OK != err.code) {
+	printf("Failed to create server [%d] %s\n", err.code, err.msg);
+	return;
+    }
+    ofix_engine_on_recv(server, lat_server_cb, NULL);
+    ofix_engine_set_log(server, quiet_log_on, quiet_log, NULL);
+    pthread_create(&thread, 0, lat_engine, server);
+    dsleep(0.1);
+
+    client = ofix_client_create(&err, "Client", "Server", "client_storage.fix", spec, lat_client_cb, NULL);
+    ofix_client_set_log(client, quiet_log_on, quiet_log, NULL);
+    ofix_client_set_busy_poll(client, busy, cpu);
+    ofix_client_connect(&err, client, "localhost", LATENCY_PORT, 1.0);
+    if (OFIX_OK != err.code) {
+	printf("Failed to connect [%d] %s\n", err.code, err.msg);
+	ofix_engine_destroy(&err, server);
+	return;
+    }
+    for (int i = 0; i < iter; i++) {
+	if (NULL == (order = ofix_msg_create(&err, "D", 4, 4, 10))) {
+	    break;
+	}
+	snprintf(cid, sizeof(cid), "o-%d", i);
+	ofix_msg_set_str(&err, order, OFIX_ClOrdIDTAG, cid);
+	ofix_msg_set_str(&err, order, OFIX_SymbolTAG, "IBM");
+	ofix_msg_set_char(&err, order, OFIX_SideTAG, '1');
+	ofix_msg_set_int(&err, order, OFIX_OrderQtyTAG, 100);
+	ofix_msg_set_date(&err, order, OFIX_TransactTimeTAG, &sender_time);
+	ofix_msg_set_char(&err, order, OFIX_OrdTypeTAG, '1');
+	ofix_client_send(&err, client, order);
+	ofix_msg_destroy(order);
+	for (giveup = dtime() + 1.0; i >= __atomic_load_n(&lat_cnt, __ATOMIC_ACQUIRE) && dtime() < giveup;) {
+	}
+    }
+    ofix_client_logout(&err, client, "bye");
+    ofix_client_destroy(&err, client);
+    ofix_engine_destroy(&err, server);
+
+    if (0 < lat_cnt) {
+	qsort(lat_samples, lat_cnt, sizeof(int64_t), cmp_samples);
+	printf("%s p50: %0.1f  p99: %0.1f  max: %0.1f usec (%d samples)\n",
+	       busy ? "Busy poll:" : "Select:   ",
+	       (double)lat_samples[lat_cnt / 2] / 1000.0,
+	       (double)lat_samples[lat_cnt * 99 / 100] / 1000.0,
+	       (double)lat_samples[lat_cnt - 1] / 1000.0,
+	       lat_cnt);
+    }
+    free(lat_samples);
+    lat_samples = NULL;
+}
+
+// Loopback tick to callback latency of a client session with and without
+// busy polling. The busy polling client is pinned to cpu. Run from the test
+// directory for the auth.txt file.
+void
+latency_benchmark(int iter, int cpu) {
+    latency(iter, false, -1);
+    latency(iter, true, cpu);
+}
@@ -1,5 +1,6 @@
 // Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
 
+#include <pthread.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
@@ -8,6 +9,7 @@
 #include "test.h"
 #include "ofix/store.h"
 #include "ofix/engine.h"
+#include "ofix/export.h"
 #include "ofix/role.h"
 
 static void
@@ -263,6 +265,355 @@ iterate_test() {
     ofix_store_destroy(s);
 }
 
+#define REPLAY_CNT	20000
+
+typedef struct _ReplayCtx {
+    int64_t	next;
+    int64_t	cnt;
+    int64_t	sum;
+    int64_t	bad;
+} *ReplayCtx;
+
+static bool
+ordered_cb(ofixMsg msg, void *ctx) {
+    ReplayCtx		rc = (ReplayCtx)ctx;
+    struct _ofixErr	err = OFIX_ERR_INIT;
+
+    if (rc->next++ != ofix_msg_get_int(&err, msg, 34)) {
+	rc->bad++;
+    }
+    rc->cnt++;
+
+    return true;
+}
+
+static bool
+unordered_cb(ofixMsg msg, void *ctx) {
+    ReplayCtx		rc = (ReplayCtx)ctx;
+    struct _ofixErr	err = OFIX_ERR_INIT;
+
+    __atomic_add_fetch(&rc->sum, ofix_msg_get_int(&err, msg, 34), __ATOMIC_RELAXED);
+    __atomic_add_fetch(&rc->cnt, 1, __ATOMIC_RELAXED);
+
+    return true;
+}
+
+static void
+piterate_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    const char		*store_filename = "replay.fix";
+    Store		s = ofix_store_create(&err, store_filename, "Client");
+    struct _ReplayCtx	rc;
+    char		mstr[256];
+    ofixMsg		msg;
+    int			i;
+
+    if (OFIX_OK != err.code || NULL == s) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    for (i = 1; i <= REPLAY_CNT; i++) {
+	// the 8=FIX in the text field must not be taken for a message start
+	snprintf(mstr, sizeof(mstr),
+		 "8=FIX.4.4\0019=000\00135=D\00149=Client\00156=Server\00134=%d\00111=order-%d\00155=IBM\00158=\n8=FIX.4.4\00110=000\001",
+		 i, i);
+	msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+	ofix_msg_set_changed(msg);
+	ofix_store_add(&err, s, i, OFIX_IODIR_SEND, msg);
+	ofix_msg_destroy(msg);
+    }
+    test_true(OFIX_OK == err.code);
+    ofix_store_destroy(s);
+
+    memset(&rc, 0, sizeof(rc));
+    rc.next = 1;
+    ofix_store_piterate(&err, store_filename, 4, true, ordered_cb, &rc);
+    test_true(OFIX_OK == err.code);
+    test_true(REPLAY_CNT == rc.cnt);
+    test_true(0 == rc.bad);
+
+    memset(&rc, 0, sizeof(rc));
+    ofix_store_piterate(&err, store_filename, 0, false, unordered_cb, &rc);
+    test_true(OFIX_OK == err.code);
+    test_true(REPLAY_CNT == rc.cnt);
+    test_true((int64_t)REPLAY_CNT * (REPLAY_CNT + 1) / 2 == rc.sum);
+}
+
+#define LARGE_CNT	10
+// more than the initial read buffer so it has to grow
+#define LARGE_TEXT	100000
+
+static bool
+large_cb(ofixMsg msg, void *ctx) {
+    ReplayCtx		rc = (ReplayCtx)ctx;
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    const char		*text = ofix_msg_get_str(&err, msg, 58);
+    int			len = (0 == rc->next % 2) ? LARGE_TEXT : 10;
+
+    if (rc->next++ != ofix_msg_get_int(&err, msg, 34) || NULL == text || len != (int)strlen(text)) {
+	rc->bad++;
+    }
+    rc->cnt++;
+
+    return true;
+}
+
+static void
+fiterate_large_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    const char		*store_filename = "large.fix";
+    Store		s = ofix_store_create(&err, store_filename, "Client");
+    struct _ReplayCtx	rc;
+    char		*text = (char*)malloc(LARGE_TEXT + 1);
+    ofixMsg		msg;
+    FILE		*f;
+    int			i;
+
+    if (OFIX_OK != err.code || NULL == s) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    memset(text, 'x', LARGE_TEXT);
+    text[LARGE_TEXT] = '\0';
+    for (i = 1; i <= LARGE_CNT; i++) {
+	msg = ofix_msg_create(&err, "D", 4, 4, 8);
+	ofix_msg_set_int(&err, msg, 34, i);
+	ofix_msg_set_str(&err, msg, 11, "order");
+	ofix_msg_set_str(&err, msg, 58, (0 == i % 2) ? text : "xxxxxxxxxx");
+	ofix_store_add(&err, s, i, OFIX_IODIR_SEND, msg);
+	ofix_msg_destroy(msg);
+    }
+    free(text);
+    test_true(OFIX_OK == err.code);
+    ofix_store_destroy(s);
+
+    if (NULL == (f = fopen(store_filename, "r"))) {
+	test_print("Failed to open %s\n", store_filename);
+	test_fail();
+	return;
+    }
+    memset(&rc, 0, sizeof(rc));
+    rc.next = 1;
+    ofix_store_fiterate(&err, f, large_cb, &rc);
+    fclose(f);
+    if (OFIX_OK != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+    }
+    test_true(OFIX_OK == err.code);
+    test_true(LARGE_CNT == rc.cnt);
+    test_true(0 == rc.bad);
+}
+
+// enough from both directions to grow the mapping twice
+#define GROW_CNT	4000
+#define GROW_TEXT	1000
+
+typedef struct _GrowCtx {
+    Store		store;
+    IoDir		dir;
+    struct _ofixErr	err;
+} *GrowCtx;
+
+static void*
+grow_add(void *arg) {
+    GrowCtx	gc = (GrowCtx)arg;
+    char	text[GROW_TEXT + 1];
+    ofixMsg	msg;
+    int		i;
+
+    memset(text, (OFIX_IODIR_SEND == gc->dir) ? 's' : 'r', GROW_TEXT);
+    text[GROW_TEXT] = '\0';
+    for (i = 2; i <= GROW_CNT && OFIX_OK == gc->err.code; i++) {
+	msg = ofix_msg_create(&gc->err, "D", 4, 4, 8);
+	ofix_msg_set_int(&gc->err, msg, 34, i);
+	ofix_msg_set_str(&gc->err, msg, 58, text);
+	ofix_store_add(&gc->err, gc->store, i, gc->dir, msg);
+	ofix_msg_destroy(msg);
+    }
+    return NULL;
+}
+
+static bool
+count_cb(ofixMsg msg, void *ctx) {
+    (*(int*)ctx)++;
+
+    return true;
+}
+
+// Adds from two threads at once past the initial mapping. A view taken
+// before the mapping grew must stay readable and every message must be
+// found afterwards.
+static void
+grow_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    Store		s = ofix_store_create(&err, "grow.fix", "Client");
+    struct _GrowCtx	send = { s, OFIX_IODIR_SEND, OFIX_ERR_INIT };
+    struct _GrowCtx	recv = { s, OFIX_IODIR_RECV, OFIX_ERR_INIT };
+    struct _MsgView	view;
+    pthread_t		thread;
+    ofixMsg		msg;
+    char		*first;
+    char		*text;
+    int			bad = 0;
+    int			cnt = 0;
+    int			i;
+
+    if (OFIX_OK != err.code || NULL == s) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    msg = ofix_msg_create(&err, "D", 4, 4, 8);
+    ofix_msg_set_int(&err, msg, 34, 1);
+    ofix_msg_set_str(&err, msg, 58, "first");
+    ofix_store_add(&err, s, 1, OFIX_IODIR_SEND, msg);
+    ofix_msg_destroy(msg);
+    if (1 != ofix_store_get_range(&err, s, 1, 1, OFIX_IODIR_SEND, &view, 1) || NULL == view.str) {
+	test_print("first message not found [%d] %s\n", err.code, err.msg);
+	test_fail();
+	ofix_store_destroy(s);
+	return;
+    }
+    first = strndup(view.str, view.len);
+
+    pthread_create(&thread, 0, grow_add, &recv);
+    grow_add(&send);
+    pthread_join(thread, NULL);
+    if (OFIX_OK != send.err.code || OFIX_OK != recv.err.code) {
+	test_print("add failed [%d] %s [%d] %s\n", send.err.code, send.err.msg, recv.err.code, recv.err.msg);
+	test_fail();
+    }
+    test_true(OFIX_STORE_MAP_SIZE < s->map_size);
+    test_true(s->where == s->committed);
+    test_true(0 == strncmp(first, view.str, view.len));
+    free(first);
+
+    for (i = 2; i <= GROW_CNT; i++) {
+	if (NULL == (msg = ofix_store_get(&err, s, i, OFIX_IODIR_SEND))) {
+	    bad++;
+	    continue;
+	}
+	text = ofix_msg_get_str(&err, msg, 58);
+	if (i != ofix_msg_get_int(&err, msg, 34) || NULL == text || GROW_TEXT != strlen(text) || 's' != *text) {
+	    bad++;
+	}
+	free(text);
+	ofix_msg_destroy(msg);
+	if (NULL == (msg = ofix_store_get(&err, s, i, OFIX_IODIR_RECV))) {
+	    bad++;
+	    continue;
+	}
+	text = ofix_msg_get_str(&err, msg, 58);
+	if (i != ofix_msg_get_int(&err, msg, 34) || NULL == text || 'r' != *text) {
+	    bad++;
+	}
+	free(text);
+	ofix_msg_destroy(msg);
+    }
+    test_true(0 == bad);
+    ofix_store_iterate(&err, s, count_cb, &cnt);
+    test_true(OFIX_OK == err.code);
+    test_true(GROW_CNT * 2 - 1 == cnt);
+
+    ofix_store_destroy(s);
+}
+
+#define EXPORT_CNT	(OFIX_EXPORT_CHUNK_ROWS + 1000)
+
+static void
+export_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    const char		*store_filename = "export.fix";
+    const char		*export_filename = "export.col";
+    Store		s = ofix_store_create(&err, store_filename, "Client");
+    int			tags[] = { 34, 11, 38, 44, 54 };
+    const char		*types[] = { "D" };
+    Export		ex;
+    ExportReader	r;
+    char		mstr[256];
+    char		expect[32];
+    const char		*str;
+    ofixMsg		msg;
+    int64_t		seq = 0;
+    int64_t		bad = 0;
+    int			len;
+    int			rows;
+    int			row;
+    int			i;
+
+    if (OFIX_OK != err.code || NULL == s) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    for (i = 1; i <= EXPORT_CNT; i++) {
+	if (0 == i % 10) {
+	    // heartbeats are not exported
+	    snprintf(mstr, sizeof(mstr),
+		     "8=FIX.4.4\0019=000\00135=0\00149=Client\00156=Server\00134=%d\00110=000\001", i);
+	} else if (0 == i % 3) {
+	    // no price
+	    snprintf(mstr, sizeof(mstr),
+		     "8=FIX.4.4\0019=000\00135=D\00149=Client\00156=Server\00134=%d\00111=order-%d\00138=%d\00154=2\00155=IBM\00110=000\001",
+		     i, i % 100, i);
+	} else {
+	    snprintf(mstr, sizeof(mstr),
+		     "8=FIX.4.4\0019=000\00135=D\00149=Client\00156=Server\00134=%d\00111=order-%d\00138=%d\00144=%d.5\00154=1\00155=IBM\00110=000\001",
+		     i, i % 100, i, i);
+	}
+	msg = ofix_msg_parse(&err, mstr, strlen(mstr));
+	ofix_msg_set_changed(msg);
+	ofix_store_add(&err, s, i, OFIX_IODIR_SEND, msg);
+	ofix_msg_destroy(msg);
+    }
+    test_true(OFIX_OK == err.code);
+    ofix_store_destroy(s);
+
+    ex = ofix_export_create(&err, export_filename, 4, 4, tags, sizeof(tags) / sizeof(*tags), types, 1);
+    ofix_export_store_file(&err, ex, store_filename, 4);
+    test_true(EXPORT_CNT - EXPORT_CNT / 10 == ofix_export_close(&err, ex));
+    if (OFIX_OK != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    if (NULL == (r = ofix_export_reader_open(&err, export_filename))) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    test_true(5 == ofix_export_reader_col_cnt(r));
+    test_true(OFIX_COL_INT == ofix_export_reader_col_type(r, 0));
+    test_true(OFIX_COL_STR == ofix_export_reader_col_type(r, 1));
+    test_true(OFIX_COL_FLOAT == ofix_export_reader_col_type(r, 2));
+    test_true(OFIX_COL_FLOAT == ofix_export_reader_col_type(r, 3));
+    test_true(OFIX_COL_CHAR == ofix_export_reader_col_type(r, 4));
+    test_true(44 == ofix_export_reader_col_tag(r, 3));
+    while (0 < (rows = ofix_export_reader_next(&err, r))) {
+	for (row = 0; row < rows; row++) {
+	    if (0 == ++seq % 10) {
+		seq++;
+	    }
+	    snprintf(expect, sizeof(expect), "order-%d", (int)(seq % 100));
+	    str = ofix_export_reader_str(r, 1, row, &len);
+	    if (seq != ofix_export_reader_int(r, 0, row) ||
+		(int)strlen(expect) != len || 0 != strncmp(expect, str, len) ||
+		(double)seq != ofix_export_reader_float(r, 2, row) ||
+		(0 == seq % 3) != ofix_export_reader_is_null(r, 3, row) ||
+		(0 != seq % 3 && (double)seq + 0.5 != ofix_export_reader_float(r, 3, row)) ||
+		((0 == seq % 3) ? '2' : '1') != ofix_export_reader_char(r, 4, row)) {
+		bad++;
+	    }
+	}
+    }
+    test_true(OFIX_OK == err.code);
+    test_true(0 == bad);
+    test_true(EXPORT_CNT == seq);
+    ofix_export_reader_destroy(r);
+}
+
 void
 append_store_tests(Test tests) {
     system("rm -rf storage"); // clear out old results
@@ -270,4 +621,8 @@ append_store_tests(Test tests) {
     test_append(tests, "store.add_get", add_get_test);
     test_append(tests, "store.multiple", multi_test);
     test_append(tests, "store.iterate", iterate_test);
+    test_append(tests, "store.piterate", piterate_test);
+    test_append(tests, "store.fiterate_large", fiterate_large_test);
+    test_append(tests, "store.grow", grow_test);
+    test_append(tests, "store.export", export_test);
 }
@@ -0,0 +1,124 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "ofix/ofix.h"
+#include "ofix/fix44msgs.h"
+
+static const char	*exec_str = "8=FIX.4.4^9=133^35=8^49=Server^56=Client^34=2^52=20071031-17:42:33.123^37=order-123^17=x-order-123^150=0^39=0^55=IBM^54=1^44=101.25^151=250^14=0^6=0^10=113^";
+
+static char*
+soh_str(const char *str) {
+    char	*s = strdup(str);
+
+    for (char *c = s; '\0' != *c; c++) {
+	if ('^' == *c) {
+	    *c = '\1';
+	}
+    }
+    return s;
+}
+
+static void
+decode_test() {
+    struct _ofixErr			err = OFIX_ERR_INIT;
+    struct _fix44ExecutionReport	er;
+    char				*raw = soh_str(exec_str);
+    char				buf[64];
+
+    fix44_decode_ExecutionReport(&err, &er, raw, strlen(raw));
+    if (OFIX_OK != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	free(raw);
+	return;
+    }
+    test_true(2 == er.MsgSeqNum);
+    test_true(ofix_typed_has(er.present, FIX44_ExecutionReport_MsgSeqNum));
+    test_true(9 == er.OrderID.len && 0 == strncmp("order-123", er.OrderID.str, er.OrderID.len));
+    test_true('1' == er.Side);
+    test_true(10125 == er.Price.mantissa && 2 == er.Price.scale);
+    ofix_decimal_to_str(&er.Price, buf);
+    test_same("101.25", buf);
+    test_true(250 == er.LeavesQty.mantissa && 0 == er.LeavesQty.scale);
+    test_true(2007 == er.SendingTime.year && 123 == er.SendingTime.msec);
+    test_false(ofix_typed_has(er.present, FIX44_ExecutionReport_ClOrdID));
+    free(raw);
+}
+
+// The allocations repeat AccruedInterestAmt which is also a top level field.
+static const char	*alloc_str = "8=FIX.4.4^9=000^35=J^49=Server^56=Client^34=3^52=20071031-17:42:33.123^70=alloc-1^71=0^626=1^857=0^54=1^55=IBM^53=100^6=50.5^75=20071031^159=12.5^78=2^79=acct-1^80=60^136=1^137=2.5^139=1^159=7.5^79=acct-2^80=40^159=5^58=done^10=000^";
+
+static void
+group_test() {
+    struct _ofixErr			err = OFIX_ERR_INIT;
+    struct _fix44AllocationInstruction	ai;
+    char				*raw = soh_str(alloc_str);
+
+    fix44_decode_AllocationInstruction(&err, &ai, raw, strlen(raw));
+    if (OFIX_OK != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	free(raw);
+	return;
+    }
+    test_true(125 == ai.AccruedInterestAmt.mantissa && 1 == ai.AccruedInterestAmt.scale);
+    test_true(2 == ai.NoAllocs);
+    test_true(100 == ai.Quantity.mantissa && 0 == ai.Quantity.scale);
+    // the group ends at the first field that is not in it
+    test_true(4 == ai.Text.len && 0 == strncmp("done", ai.Text.str, ai.Text.len));
+    free(raw);
+}
+
+static void
+encode_test() {
+    struct _ofixErr			err = OFIX_ERR_INIT;
+    struct _fix44ExecutionReport	er;
+    struct _fix44ExecutionReport	er2;
+    char				*raw = soh_str(exec_str);
+    char				*actual;
+    ofixMsg				msg;
+
+    fix44_decode_ExecutionReport(&err, &er, raw, strlen(raw));
+    msg = fix44_encode_ExecutionReport(&err, &er);
+    if (OFIX_OK != err.code || NULL == msg) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	free(raw);
+	return;
+    }
+    // The raw string is still referenced by er until msg is encoded.
+    free(raw);
+    actual = ofix_msg_to_str(&err, msg);
+    test_same("8=FIX.4.4^9=133^35=8^49=Server^56=Client^34=2^52=20071031-17:42:33.123^37=order-123^17=x-order-123^150=0^39=0^55=IBM^54=1^44=101.25^151=250^14=0^6=0^10=$^", actual);
+    free(actual);
+
+    fix44_decode_ExecutionReport_msg(&err, &er2, msg);
+    test_true(OFIX_OK == err.code);
+    test_true(0 == memcmp(er.present, er2.present, sizeof(er.present)));
+    test_true(10125 == er2.Price.mantissa && 2 == er2.Price.scale);
+    ofix_msg_destroy(msg);
+}
+
+static void
+bad_value_test() {
+    struct _ofixErr			err = OFIX_ERR_INIT;
+    struct _fix44ExecutionReport	er;
+    char				*raw = soh_str("8=FIX.4.4^9=050^35=8^49=Server^56=Client^34=x2^10=000^");
+
+    fix44_decode_ExecutionReport(&err, &er, raw, strlen(raw));
+    test_true(OFIX_PARSE_ERR == err.code);
+    test_true(OFIX_MsgSeqNumTAG == err.tag);
+    free(raw);
+}
+
+void
+append_typed_tests(Test tests) {
+    test_append(tests, "typed.decode", decode_test);
+    test_append(tests, "typed.encode", encode_test);
+    test_append(tests, "typed.group", group_test);
+    test_append(tests, "typed.bad_value", bad_value_test);
+}
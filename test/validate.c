@@ -0,0 +1,124 @@
+// Copyright 2009, 2015 by Peter Ohler, All Rights Reserved
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "test.h"
+#include "ofix/ofix.h"
+
+static void
+run_check(void (*check)(ofixErr err, ofixMsg msg), const char *msg_str, int code, int reason, int tag) {
+    char		msg_buf[4096];
+    char		*b;
+    const char		*str;
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixMsg		msg;
+
+    for (str = msg_str, b = msg_buf; '\0' != *str; str++, b++) {
+	if ('^' == *str) {
+	    *b = '\1';
+	} else {
+	    *b = *str;
+	}
+    }
+    *b = '\0';
+    msg = ofix_msg_parse(&err, msg_buf, strlen(msg_buf));
+    if (OFIX_OK != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+	return;
+    }
+    check(&err, msg);
+    if (code != err.code) {
+	test_print("[%d] %s\n", err.code, err.msg);
+	test_fail();
+    } else if (OFIX_OK == code) {
+	test_true(OFIX_OK == err.code);
+    } else {
+	test_true(reason == err.reason);
+	test_true(tag == err.tag);
+	test_true(42 == err.seq);
+    }
+    ofix_msg_destroy(msg);
+}
+
+static void
+run_test(const char *msg_str, int code, int reason, int tag) {
+    run_check(ofix_msg_validate, msg_str, code, reason, tag);
+}
+
+static void
+valid_test() {
+    run_test("8=FIX.4.4^9=116^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^54=2^60=20071031-17:42:11.321^40=7^10=087^",
+	     OFIX_OK, 0, 0);
+}
+
+static void
+missing_test() {
+    // no Side (54)
+    run_test("8=FIX.4.4^9=111^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^60=20071031-17:42:11.321^40=7^10=087^",
+	     OFIX_PARSE_ERR, OFIX_REASON_MISSING_TAG, OFIX_SideTAG);
+}
+
+static void
+wrong_test() {
+    // TestReqID (112) is not part of a NewOrderSingle
+    run_test("8=FIX.4.4^9=123^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^54=2^60=20071031-17:42:11.321^40=7^112=x^10=087^",
+	     OFIX_PARSE_ERR, OFIX_REASON_WRONG_TAG, OFIX_TestReqIDTAG);
+}
+
+static void
+group_test() {
+    // PartyID (448) is only allowed in the Parties group
+    run_test("8=FIX.4.4^9=142^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^453=1^448=abc^447=D^452=1^21=1^55=IBM^54=2^60=20071031-17:42:11.321^40=7^10=087^",
+	     OFIX_OK, 0, 0);
+}
+
+static void
+required_test() {
+    // TestReqID (112) and the user defined 5001 are let through
+    run_check(ofix_msg_validate_required,
+	      "8=FIX.4.4^9=123^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^54=2^60=20071031-17:42:11.321^40=7^112=x^5001=y^10=087^",
+	      OFIX_OK, 0, 0);
+    run_test("8=FIX.4.4^9=123^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^54=2^60=20071031-17:42:11.321^40=7^5001=y^10=087^",
+	     OFIX_PARSE_ERR, OFIX_REASON_WRONG_TAG, 5001);
+    // required tags are still checked
+    run_check(ofix_msg_validate_required,
+	      "8=FIX.4.4^9=111^35=D^49=Sender^56=Target^34=42^52=20071031-17:42:33.123^11=order-123^21=1^55=IBM^60=20071031-17:42:11.321^40=7^5001=y^10=087^",
+	      OFIX_PARSE_ERR, OFIX_REASON_MISSING_TAG, OFIX_SideTAG);
+}
+
+static void
+built_test() {
+    struct _ofixErr	err = OFIX_ERR_INIT;
+    ofixMsg		msg = ofix_msg_create(&err, "0", 4, 4, 8);
+
+    ofix_msg_set_str(&err, msg, OFIX_SenderCompIDTAG, "Sender");
+    ofix_msg_set_str(&err, msg, OFIX_TargetCompIDTAG, "Target");
+    ofix_msg_set_int(&err, msg, OFIX_MsgSeqNumTAG, 7);
+    ofix_msg_validate(&err, msg);
+    test_true(OFIX_PARSE_ERR == err.code);
+    test_true(OFIX_SendingTimeTAG == err.tag);
+
+    ofix_err_clear(&err);
+    ofix_msg_set_str(&err, msg, OFIX_SendingTimeTAG, "20071031-17:42:33.123");
+    ofix_msg_validate(&err, msg);
+    test_true(OFIX_OK == err.code);
+
+    ofix_msg_remove(&err, msg, OFIX_SendingTimeTAG);
+    ofix_msg_validate(&err, msg);
+    test_true(OFIX_PARSE_ERR == err.code);
+    test_true(OFIX_SendingTimeTAG == err.tag);
+    ofix_msg_destroy(msg);
+}
+
+void
+append_validate_tests(Test tests) {
+    test_append(tests, "validate.valid", valid_test);
+    test_append(tests, "validate.missing", missing_test);
+    test_append(tests, "validate.wrong", wrong_test);
+    test_append(tests, "validate.group", group_test);
+    test_append(tests, "validate.required", required_test);
+    test_append(tests, "validate.built", built_test);
+}